@@ -0,0 +1,132 @@
+/*
+ * Copyright (C) 2014-2019 Stichting Mapcode Foundation (http://www.mapcode.com)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Benchmark of the base-31 routines of mapcoder.c in isolation: the pair-table encoder and the
+// fixed-length decoder against the one-character-at-a-time loops they replaced, for the code
+// lengths the encoder uses (2-6 characters), and the triple encoder/decoder. Includes mapcoder.c
+// to reach its static routines; every result is checked against the loops first.
+//
+// Build and run (from the root of the repository):
+//
+//     gcc -O2 -Imapcodelib examples/base31_benchmark.c -lm -o base31_benchmark
+//     ./base31_benchmark
+
+#include <stdio.h>
+#include <time.h>
+#include "mapcoder.c"
+
+#define NR_ROUNDS 4000000
+
+// the routines as they were: one character per division and per decodeChar
+static void encodeBase31Loop(char *result, int value, int nrchars) {
+    result[nrchars] = 0;
+    while (nrchars > 0) {
+        nrchars--;
+        result[nrchars] = ENCODE_CHARS[value % 31];
+        value /= 31;
+    }
+}
+
+static int decodeBase31Loop(const char *code) {
+    int value = 0;
+    while (*code != '.' && *code != 0) {
+        value = value * 31 + decodeChar(*code++);
+    }
+    return value;
+}
+
+static int powerOf31(const int n) {
+    int p = 1;
+    int i;
+    for (i = 0; i < n; i++) {
+        p *= 31;
+    }
+    return p;
+}
+
+static double secondsSince(const clock_t start) {
+    return (double) (clock() - start) / CLOCKS_PER_SEC;
+}
+
+int main(void) {
+    char a[16], b[16];
+    int n, v, difx, dify;
+    long sum = 0;
+
+    // check: every value for 2-4 characters, a sample for 5 and 6, and every triple
+    for (n = 2; n <= 6; n++) {
+        const int max = powerOf31(n);
+        const int step = (n <= 4) ? 1 : 997;
+        for (v = 0; v < max; v += step) {
+            encodeBase31Loop(a, v, n);
+            encodeBase31(b, v, n);
+            if (strcmp(a, b) != 0 || decodeBase31OfLength(b, n) != v || decodeBase31Loop(b) != v) {
+                printf("difference for %d characters, value %d: %s %s\n", n, v, a, b);
+                return 1;
+            }
+        }
+    }
+    for (difx = 0; difx < 168; difx++) {
+        for (dify = 0; dify < 176; dify++) {
+            int x, y;
+            encodeTriple(a, difx, dify);
+            decodeTriple(a, &x, &y);
+            if (x != difx || y != dify) {
+                printf("difference for triple %d,%d: %s %d,%d\n", difx, dify, a, x, y);
+                return 1;
+            }
+        }
+    }
+
+    for (n = 2; n <= 6; n++) {
+        const int max = powerOf31(n);
+        double loopSeconds, tableSeconds;
+        clock_t start;
+        int i;
+
+        start = clock();
+        for (i = 0, v = 0; i < NR_ROUNDS; i++, v = (v + 7919) % max) {
+            encodeBase31Loop(a, v, n);
+            sum += decodeBase31Loop(a);
+        }
+        loopSeconds = secondsSince(start);
+
+        start = clock();
+        for (i = 0, v = 0; i < NR_ROUNDS; i++, v = (v + 7919) % max) {
+            encodeBase31(a, v, n);
+            sum += decodeBase31OfLength(a, n);
+        }
+        tableSeconds = secondsSince(start);
+
+        printf("%d characters: %d encodes and decodes in %.3f seconds (loops), %.3f seconds (tables)\n",
+               n, NR_ROUNDS, loopSeconds, tableSeconds);
+    }
+    {
+        double seconds;
+        clock_t start = clock();
+        int i;
+        for (i = 0; i < NR_ROUNDS; i++) {
+            int x, y;
+            encodeTriple(a, i % 168, (i / 168) % 176);
+            decodeTriple(a, &x, &y);
+            sum += x + y;
+        }
+        seconds = secondsSince(start);
+        printf("triples: %d encodes and decodes in %.3f seconds\n", NR_ROUNDS, seconds);
+    }
+    printf("(checksum %ld)\n", sum);
+    return 0;
+}
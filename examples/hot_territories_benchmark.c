@@ -0,0 +1,113 @@
+/*
+ * Copyright (C) 2014-2019 Stichting Mapcode Foundation (http://www.mapcode.com)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Benchmark of the specialised encoders and decoders of the hot territories (tools/generate_hot_territories.py):
+// encodes random coordinates in NLD, USA and IND (in the context of that territory) and decodes the mapcodes.
+// Build it twice, with the generic and the specialised code, and compare:
+//
+//     gcc -O2 -Imapcodelib examples/hot_territories_benchmark.c mapcodelib/mapcoder.c -lm -o hot
+//     gcc -O2 -Imapcodelib -DNO_HOT_TERRITORIES examples/hot_territories_benchmark.c mapcodelib/mapcoder.c -lm -o generic
+//     ./generic; ./hot
+//
+// With -v, all mapcodes and decoded coordinates are printed, so the output of both builds can be compared.
+
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include "mapcoder.h"
+
+#define NR_COORDINATES 200000
+
+typedef struct {
+    const char *name;
+    enum Territory territory;
+    double minLat, maxLat, minLon, maxLon;
+} Area;
+
+static const Area AREAS[] = {
+        {"NLD", TERRITORY_NLD, 50.75, 53.56, 3.36, 7.23},
+        {"USA", TERRITORY_USA, 24.50, 49.38, -124.77, -66.95},
+        {"IND", TERRITORY_IND, 8.07, 35.50, 68.11, 97.40}
+};
+
+static unsigned long randomState = 12345;
+
+static double randomBetween(double min, double max) {
+    randomState = randomState * 1103515245UL + 12345UL;
+    return min + (max - min) * (double) ((randomState >> 8) % 1000000) / 1000000.0;
+}
+
+int main(int argc, char **argv) {
+    const int verbose = (argc > 1 && strcmp(argv[1], "-v") == 0);
+    static double lat[NR_COORDINATES];
+    static double lon[NR_COORDINATES];
+    static char shortest[NR_COORDINATES][MAX_MAPCODE_RESULT_ASCII_LEN];
+    static Mapcodes mapcodes;
+    int a;
+
+#ifdef NO_HOT_TERRITORIES
+    printf("generic encoders and decoders\n");
+#else
+    printf("specialised encoders and decoders of the hot territories\n");
+#endif
+    for (a = 0; a < (int) (sizeof(AREAS) / sizeof(AREAS[0])); a++) {
+        const Area *area = &AREAS[a];
+        long nrMapcodes = 0, nrDecodes = 0, nrErrors = 0;
+        double encodeSeconds, decodeSeconds;
+        clock_t start;
+        int i, k;
+
+        for (i = 0; i < NR_COORDINATES; i++) {
+            lat[i] = randomBetween(area->minLat, area->maxLat);
+            lon[i] = randomBetween(area->minLon, area->maxLon);
+        }
+
+        // encode, keeping the shortest mapcode of every coordinate
+        start = clock();
+        for (i = 0; i < NR_COORDINATES; i++) {
+            encodeLatLonToMapcodes(&mapcodes, lat[i], lon[i], area->territory, i % 3);
+            strcpy(shortest[i], mapcodes.count > 0 ? mapcodes.mapcode[0] : "");
+            nrMapcodes += mapcodes.count;
+            if (verbose) {
+                for (k = 0; k < mapcodes.count; k++) {
+                    printf("%.9f %.9f %s\n", lat[i], lon[i], mapcodes.mapcode[k]);
+                }
+            }
+        }
+        encodeSeconds = (double) (clock() - start) / CLOCKS_PER_SEC;
+
+        // decode the shortest mapcodes
+        start = clock();
+        for (i = 0; i < NR_COORDINATES; i++) {
+            double decodedLat, decodedLon;
+            if (*shortest[i]) {
+                nrDecodes++;
+                if (decodeMapcodeToLatLonUtf8(&decodedLat, &decodedLon, shortest[i], area->territory, NULL)) {
+                    nrErrors++;
+                } else if (verbose) {
+                    printf("%s %.9f %.9f\n", shortest[i], decodedLat, decodedLon);
+                }
+            }
+        }
+        decodeSeconds = (double) (clock() - start) / CLOCKS_PER_SEC;
+
+        printf("%s: %d encodes (%ld mapcodes) in %.3f seconds (%.0f per second), "
+               "%ld decodes (%ld errors) in %.3f seconds (%.0f per second)\n",
+               area->name, NR_COORDINATES, nrMapcodes, encodeSeconds, NR_COORDINATES / encodeSeconds,
+               nrDecodes, nrErrors, decodeSeconds, nrDecodes / decodeSeconds);
+    }
+    return 0;
+}
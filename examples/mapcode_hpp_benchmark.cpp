@@ -0,0 +1,118 @@
+/*
+ * Copyright (C) 2014-2019 Stichting Mapcode Foundation (http://www.mapcode.com)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Benchmark of the C++ interface (mapcodelib/mapcode.hpp): encodes random coordinates, decodes all
+// their mapcodes, and counts the heap allocations made while doing so (by replacing the global
+// operator new). The single and span based calls should make no allocations at all.
+//
+// Build and run (from the root of the repository):
+//
+//     gcc -O2 -c mapcodelib/mapcoder.c -o mapcoder.o
+//     g++ -std=c++17 -O2 -Imapcodelib examples/mapcode_hpp_benchmark.cpp mapcoder.o -o mapcode_hpp_benchmark
+//     ./mapcode_hpp_benchmark [number of coordinates]
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#include <string_view>
+#include <vector>
+
+#include "mapcode.hpp"
+
+static long nrAllocations = 0;
+
+void *operator new(std::size_t size) {
+    ++nrAllocations;
+    void *p = std::malloc(size ? size : 1);
+    if (p == nullptr) {
+        throw std::bad_alloc();
+    }
+    return p;
+}
+
+void operator delete(void *p) noexcept {
+    std::free(p);
+}
+
+void operator delete(void *p, std::size_t) noexcept {
+    std::free(p);
+}
+
+static double secondsSince(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+int main(int argc, char **argv) {
+    const std::size_t count = (argc > 1) ? static_cast<std::size_t>(std::atol(argv[1])) : 100000;
+    std::vector<double> latitudes(count);
+    std::vector<double> longitudes(count);
+    std::vector<mapcode::MapcodeResults> results(count);
+    std::vector<std::string_view> mapcodes;
+    std::vector<mapcode::DecodeResult> decoded;
+    unsigned long random = 12345;
+    std::size_t i;
+
+    for (i = 0; i < count; ++i) {
+        random = random * 1103515245UL + 12345UL;
+        latitudes[i] = (static_cast<double>((random >> 8) % 1800000) / 10000.0) - 90.0;
+        random = random * 1103515245UL + 12345UL;
+        longitudes[i] = (static_cast<double>((random >> 8) % 3600000) / 10000.0) - 180.0;
+    }
+
+    // single encode and decode
+    long allocations = nrAllocations;
+    long nrMapcodes = 0, nrErrors = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (i = 0; i < count; ++i) {
+        const mapcode::MapcodeResults r = mapcode::encode(latitudes[i], longitudes[i]);
+        for (std::string_view m : r) {
+            const mapcode::DecodeResult d = mapcode::decode(m);
+            ++nrMapcodes;
+            nrErrors += !d;
+        }
+    }
+    double seconds = secondsSince(start);
+    std::printf("single:  %lu encodes, %ld decodes (%ld errors) in %.3f seconds; %ld allocations\n",
+                static_cast<unsigned long>(count), nrMapcodes, nrErrors, seconds, nrAllocations - allocations);
+
+    // batch encode into a span
+    allocations = nrAllocations;
+    start = std::chrono::steady_clock::now();
+    std::size_t n = mapcode::encode(latitudes, longitudes, results);
+    seconds = secondsSince(start);
+    std::printf("batch:   %lu encodes in %.3f seconds (%.0f per second); %ld allocations\n",
+                static_cast<unsigned long>(n), seconds, n / seconds, nrAllocations - allocations);
+
+    // batch decode of all mapcodes into a span (the vectors are allocated up front)
+    for (const mapcode::MapcodeResults &r : results) {
+        for (std::string_view m : r) {
+            mapcodes.push_back(m);
+        }
+    }
+    decoded.resize(mapcodes.size());
+    allocations = nrAllocations;
+    start = std::chrono::steady_clock::now();
+    n = mapcode::decode(mapcodes, decoded);
+    seconds = secondsSince(start);
+    nrErrors = 0;
+    for (i = 0; i < n; ++i) {
+        nrErrors += !decoded[i];
+    }
+    std::printf("batch:   %lu decodes (%ld errors) in %.3f seconds (%.0f per second); %ld allocations\n",
+                static_cast<unsigned long>(n), nrErrors, seconds, n / seconds, nrAllocations - allocations);
+    return (nrErrors == 0) ? 0 : 1;
+}
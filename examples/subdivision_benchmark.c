@@ -0,0 +1,110 @@
+/*
+ * Copyright (C) 2014-2019 Stichting Mapcode Foundation (http://www.mapcode.com)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Benchmark of the reuse of parent results for subdivisions: encodes random coordinates in the USA,
+// Brazil and India to all their mapcodes (in all territories), where most coordinates fall in the
+// bounding rectangles of several subdivisions. Build it twice, with and without the reuse, and compare:
+//
+//     gcc -O2 -Imapcodelib examples/subdivision_benchmark.c mapcodelib/mapcoder.c -lm -o reuse
+//     gcc -O2 -Imapcodelib -DNO_PARENT_RESULT_REUSE examples/subdivision_benchmark.c mapcodelib/mapcoder.c -lm -o noreuse
+//     ./noreuse; ./reuse
+//
+// With -v, all mapcodes are printed (also of encodes in a subdivision and of single encodes), so the output of
+// both builds can be compared.
+
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include "mapcoder.h"
+
+#define NR_COORDINATES 100000
+
+typedef struct {
+    const char *name;
+    enum Territory subdivision; // used as encoding context with -v
+    double minLat, maxLat, minLon, maxLon;
+} Area;
+
+static const Area AREAS[] = {
+        {"USA", TERRITORY_US_CA, 24.50, 49.38, -124.77, -66.95},
+        {"BRA", TERRITORY_BR_MT, -33.75, 5.27, -73.99, -34.79},
+        {"IND", TERRITORY_IN_MP, 8.07, 35.50, 68.11, 97.40}
+};
+
+static unsigned long randomState = 12345;
+
+static double randomBetween(double min, double max) {
+    randomState = randomState * 1103515245UL + 12345UL;
+    return min + (max - min) * (double) ((randomState >> 8) % 1000000) / 1000000.0;
+}
+
+static void printMapcodes(const Mapcodes *mapcodes, double lat, double lon) {
+    int k;
+    for (k = 0; k < mapcodes->count; k++) {
+        printf("%.9f %.9f %s\n", lat, lon, mapcodes->mapcode[k]);
+    }
+}
+
+int main(int argc, char **argv) {
+    const int verbose = (argc > 1 && strcmp(argv[1], "-v") == 0);
+    static double lat[NR_COORDINATES];
+    static double lon[NR_COORDINATES];
+    static Mapcodes mapcodes;
+    int a;
+
+#ifdef NO_PARENT_RESULT_REUSE
+    printf("parent encoded for every subdivision\n");
+#else
+    printf("parent results reused for subdivisions\n");
+#endif
+    for (a = 0; a < (int) (sizeof(AREAS) / sizeof(AREAS[0])); a++) {
+        const Area *area = &AREAS[a];
+        long nrMapcodes = 0;
+        double seconds;
+        clock_t start;
+        int i;
+
+        for (i = 0; i < NR_COORDINATES; i++) {
+            lat[i] = randomBetween(area->minLat, area->maxLat);
+            lon[i] = randomBetween(area->minLon, area->maxLon);
+        }
+
+        start = clock();
+        for (i = 0; i < NR_COORDINATES; i++) {
+            encodeLatLonToMapcodes(&mapcodes, lat[i], lon[i], TERRITORY_NONE, i % 3);
+            nrMapcodes += mapcodes.count;
+            if (verbose) {
+                printMapcodes(&mapcodes, lat[i], lon[i]);
+            }
+        }
+        seconds = (double) (clock() - start) / CLOCKS_PER_SEC;
+
+        printf("%s: %d encodes (%ld mapcodes) in %.3f seconds (%.0f per second)\n",
+               area->name, NR_COORDINATES, nrMapcodes, seconds, NR_COORDINATES / seconds);
+
+        if (verbose) {
+            for (i = 0; i < NR_COORDINATES; i++) {
+                char mapcode[MAX_MAPCODE_RESULT_ASCII_LEN];
+                encodeLatLonToMapcodes(&mapcodes, lat[i], lon[i], area->subdivision, i % 3);
+                printMapcodes(&mapcodes, lat[i], lon[i]);
+                if (encodeLatLonToSingleMapcode(mapcode, lat[i], lon[i], area->subdivision, i % 3) > 0) {
+                    printf("%.9f %.9f single %s\n", lat[i], lon[i], mapcode);
+                }
+            }
+        }
+    }
+    return 0;
+}
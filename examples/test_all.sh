@@ -1 +1,3 @@
 for f in *.txt; do python3 test_geocoder.py $f; done
+python3 test_geocoder.py --api
+cc -O2 -I../mapcodelib test_api.c ../mapcodelib/mapcoder.c -lm -o "${TMPDIR:-/tmp}/mapcode_test_api" && "${TMPDIR:-/tmp}/mapcode_test_api"
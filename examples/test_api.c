@@ -0,0 +1,733 @@
+/*
+ * Copyright (C) 2014-2019 Stichting Mapcode Foundation (http://www.mapcode.com)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Tests of the functions of the C library that the Python module does not use: every result is
+// checked against the functions it must agree with (e.g. the parser against
+// compareWithMapcodeFormatUtf8 and decodeMapcodeToLatLonUtf8), for mapcodes of random coordinates,
+// in all alphabets, and for damaged copies of them. Prints the differences found, if any.
+//
+// Build and run (from the root of the repository; test_all.sh does this too):
+//
+//     gcc -O2 -Imapcodelib examples/test_api.c mapcodelib/mapcoder.c -lm -o test_api
+//     ./test_api
+
+#include <stdio.h>
+#include <string.h>
+#include "mapcoder.h"
+
+#define NR_COORDINATES 400
+#define NR_BATCH_MAPCODES 200
+#define NR_TERRITORIES (_TERRITORY_MAX - _TERRITORY_MIN - 1)
+#define NR_LOCALES 27       // the languages of the territory names (LOCALE_REGISTRY)
+#define NAMES_LOCAL NR_LOCALES
+#define NAMES_ISO_CODE (NR_LOCALES + 1)
+#define MAX_NR_NAMES 40000
+
+static unsigned int randomState = 2019;
+
+static int nrErrors = 0;
+
+// the mapcodes of the batch tests: the first NR_BATCH_MAPCODES of forEachMapcode
+static char batchMapcode[NR_BATCH_MAPCODES][MAX_MAPCODE_RESULT_ASCII_LEN + 1];
+static enum Alphabet batchAlphabet[NR_BATCH_MAPCODES];
+static enum Territory batchContext[NR_BATCH_MAPCODES];
+static int nrBatchMapcodes = 0;
+
+static const char *const LOCALES[NR_LOCALES] = {
+        "af", "ar", "be", "cn", "cs", "da", "de", "en", "es", "fi", "fr", "he", "hi", "hr",
+        "id", "it", "ja", "ko", "nl", "no", "pt", "pl", "ru", "sv", "sw", "tr", "uk"};
+
+// all names of all territories (with the ascii characters in lowercase), per territory, with their language
+static char namePool[MAX_NR_NAMES * 24];
+static const char *territoryName[MAX_NR_NAMES];
+static int territoryNameLocale[MAX_NR_NAMES];
+static int firstTerritoryName[NR_TERRITORIES + 1];
+
+// returns a pseudo-random number in [0, n) (the same ones on every platform)
+static int randomNumber(const int n) {
+    randomState = randomState * 1103515245U + 12345U;
+    return (int) ((randomState >> 8) % (unsigned int) n);
+}
+
+static double randomDegrees(const double range) {
+    return (randomNumber(1 << 22) / (double) (1 << 22) - 0.5) * range;
+}
+
+static void error(const char *what, const char *input, const int got, const int expected) {
+    if (++nrErrors <= 100) {
+        printf("%s(\"%s\"): %d != %d\n", what, input, got, expected);
+    }
+}
+
+// stores a copy of mapcode (ascii) in input, damaged in a random way (a character removed, replaced or inserted)
+static void damageMapcode(char *input, const char *mapcode) {
+    static const char characters[] = " .-AEIOUZ0K\t";
+    const int len = (int) strlen(mapcode);
+    const int i = randomNumber(len + 1);
+    const char c = characters[randomNumber((int) sizeof(characters) - 1)];
+    strcpy(input, mapcode);
+    switch (randomNumber(3)) {
+        case 0:
+            memmove(input + i, input + i + 1, (size_t) (len - i)); // remove (nothing at the end)
+            break;
+        case 1:
+            if (i < len) {
+                input[i] = c; // replace
+                break;
+            }
+            /* fall through */
+        default:
+            memmove(input + i + 1, input + i, (size_t) (len - i + 1)); // insert
+            input[i] = c;
+            break;
+    }
+}
+
+// calls test for every mapcode of NR_COORDINATES random coordinates (with 0-2 extra digits), for the mapcode
+// with and without its territory code, and for a damaged copy of it, in a (rotating) alphabet
+static int forEachMapcode(void (*test)(const char *ascii, enum Alphabet alphabet, enum Territory context)) {
+    int counter = 0;
+    int i, j;
+    for (i = 0; i < NR_COORDINATES; i++) {
+        Mapcodes mapcodes;
+        const int n = encodeLatLonToMapcodes(&mapcodes, randomDegrees(180.0), randomDegrees(360.0), TERRITORY_NONE,
+                                             i % 3);
+        for (j = 0; j < n; j++) {
+            const enum Alphabet alphabet = (enum Alphabet) ((i + j) % _ALPHABET_MAX);
+            char local[MAX_MAPCODE_RESULT_ASCII_LEN];
+            char damaged[MAX_MAPCODE_RESULT_ASCII_LEN + 1];
+            const char *space = strchr(mapcodes.mapcode[j], ' ');
+            enum Territory context = TERRITORY_NONE;
+
+            test(mapcodes.mapcode[j], alphabet, context);
+            if (space) {
+                memcpy(local, mapcodes.mapcode[j], (size_t) (space - mapcodes.mapcode[j]));
+                local[space - mapcodes.mapcode[j]] = 0;
+                context = getTerritoryCode(local, TERRITORY_NONE);
+                strcpy(local, space + 1);
+                test(local, alphabet, context);
+            }
+            damageMapcode(damaged, space ? local : mapcodes.mapcode[j]);
+            test(damaged, alphabet, context);
+            counter += space ? 3 : 2;
+        }
+    }
+    return counter;
+}
+
+
+// the parser must give the status of compareWithMapcodeFormatUtf8 after every character that is added or
+// removed, and the result of decodeMapcodeToLatLonUtf8 (also for utf16 input)
+static void testParser(const char *ascii, const enum Alphabet alphabet, const enum Territory context) {
+    MapcodeParser parser;
+    char utf8[MAX_MAPCODE_RESULT_UTF8_LEN + 1];
+    char prefix[MAX_MAPCODE_RESULT_UTF8_LEN + 1];
+    UWORD utf16[MAX_MAPCODE_RESULT_UTF16_LEN + 1];
+    int lengths[MAX_MAPCODE_RESULT_UTF8_LEN + 1];
+    int n = 0;
+    int i = 0;
+    double lat1, lon1, lat2, lon2;
+    enum MapcodeError err1, err2;
+
+    convertMapcodeToAlphabetUtf8(utf8, ascii, alphabet);
+    convertMapcodeToAlphabetUtf16(utf16, ascii, alphabet);
+
+    // add the characters one at a time
+    initMapcodeParser(&parser, context);
+    lengths[n++] = 0;
+    while (utf8[i]) {
+        char character[5];
+        const int len = ((unsigned char) utf8[i] < 0xC0) ? 1 : ((unsigned char) utf8[i] < 0xE0) ? 2 : 3;
+        memcpy(character, utf8 + i, (size_t) len);
+        character[len] = 0;
+        i += len;
+        memcpy(prefix, utf8, (size_t) i);
+        prefix[i] = 0;
+        lengths[n++] = i;
+        err1 = appendToMapcodeParserUtf8(&parser, character);
+        err2 = compareWithMapcodeFormatUtf8(prefix);
+        if (err1 != err2 || parser.status != err2) {
+            error("appendToMapcodeParserUtf8", prefix, err1, err2);
+        }
+    }
+
+    err1 = decodeMapcodeParserToLatLon(&lat1, &lon1, &parser, NULL);
+    err2 = decodeMapcodeToLatLonUtf8(&lat2, &lon2, utf8, context, NULL);
+    if (err1 != err2 || (err1 == ERR_OK && (lat1 != lat2 || lon1 != lon2))) {
+        error("decodeMapcodeParserToLatLon", utf8, err1, err2);
+    }
+
+    // remove them again
+    while (--n > 0) {
+        memcpy(prefix, utf8, (size_t) lengths[n - 1]);
+        prefix[lengths[n - 1]] = 0;
+        err1 = removeLastFromMapcodeParser(&parser);
+        err2 = compareWithMapcodeFormatUtf8(prefix);
+        if (err1 != err2) {
+            error("removeLastFromMapcodeParser", prefix, err1, err2);
+        }
+    }
+
+    // add all characters at once, as utf16
+    err1 = appendToMapcodeParserUtf16(&parser, utf16);
+    err2 = compareWithMapcodeFormatUtf16(utf16);
+    if (err1 != err2) {
+        error("appendToMapcodeParserUtf16", utf8, err1, err2);
+    }
+    err1 = decodeMapcodeParserToLatLon(&lat1, &lon1, &parser, NULL);
+    err2 = decodeMapcodeToLatLonUtf16(&lat2, &lon2, utf16, context, NULL);
+    if (err1 != err2 || (err1 == ERR_OK && (lat1 != lat2 || lon1 != lon2))) {
+        error("decodeMapcodeParserToLatLon(utf16)", utf8, err1, err2);
+    }
+}
+
+
+static void collectBatchMapcode(const char *ascii, const enum Alphabet alphabet, const enum Territory context) {
+    if (nrBatchMapcodes < NR_BATCH_MAPCODES) {
+        strcpy(batchMapcode[nrBatchMapcodes], ascii);
+        batchAlphabet[nrBatchMapcodes] = alphabet;
+        batchContext[nrBatchMapcodes] = context;
+        nrBatchMapcodes++;
+    }
+}
+
+
+// decoding a converted mapcode must give the result of decoding its utf16 source; every buffer size must
+// convert as many mapcodes as fit (a mapcode needs the length of its source while it is converted)
+static int testUtf16ToAscii(void) {
+    UWORD utf16Buffer[NR_BATCH_MAPCODES * MAX_MAPCODE_RESULT_UTF16_LEN];
+    char expected[NR_BATCH_MAPCODES * MAX_MAPCODE_RESULT_ASCII_LEN];
+    char asciiBuffer[NR_BATCH_MAPCODES * MAX_MAPCODE_RESULT_ASCII_LEN];
+    int sourceLength[NR_BATCH_MAPCODES];
+    int total = 0;
+    int size, i, n;
+    const UWORD *utf16 = utf16Buffer;
+    const char *ascii = expected;
+
+    for (i = 0; i < nrBatchMapcodes; i++) {
+        convertMapcodeToAlphabetUtf16(utf16Buffer + total, batchMapcode[i], batchAlphabet[i]);
+        sourceLength[i] = 0;
+        while (utf16Buffer[total + sourceLength[i]]) {
+            sourceLength[i]++;
+        }
+        total += sourceLength[i] + 1;
+    }
+    n = convertMapcodesUtf16ToAscii(expected, (int) sizeof(expected), utf16Buffer, nrBatchMapcodes);
+    if (n != nrBatchMapcodes) {
+        error("convertMapcodesUtf16ToAscii", "", n, nrBatchMapcodes);
+    }
+    for (i = 0; i < n; i++) {
+        double lat1, lon1, lat2, lon2;
+        const enum MapcodeError err1 = decodeMapcodeToLatLonUtf8(&lat1, &lon1, ascii, batchContext[i], NULL);
+        const enum MapcodeError err2 = decodeMapcodeToLatLonUtf16(&lat2, &lon2, utf16, batchContext[i], NULL);
+        if (err1 != err2 || (err1 == ERR_OK && (lat1 != lat2 || lon1 != lon2))) {
+            error("convertMapcodesUtf16ToAscii", ascii, err1, err2);
+        }
+        if ((int) strlen(ascii) > sourceLength[i]) {
+            error("convertMapcodesUtf16ToAscii (length)", ascii, (int) strlen(ascii), sourceLength[i]);
+        }
+        ascii += strlen(ascii) + 1;
+        utf16 += sourceLength[i] + 1;
+    }
+
+    for (size = 0; size <= (int) (ascii - expected); size++) {
+        int used = 0;
+        n = convertMapcodesUtf16ToAscii(asciiBuffer, size, utf16Buffer, nrBatchMapcodes);
+        for (i = 0; i < nrBatchMapcodes && used + sourceLength[i] + 1 <= size; i++) {
+            used += (int) strlen(expected + used) + 1;
+        }
+        if (n != i || memcmp(asciiBuffer, expected, (size_t) used) != 0) {
+            error("convertMapcodesUtf16ToAscii (buffer full)", "", n, i);
+        }
+    }
+    if (convertMapcodesUtf16ToAscii(asciiBuffer, -1, utf16Buffer, 1) != ERR_BAD_ARGUMENTS ||
+        convertMapcodesUtf16ToAscii(asciiBuffer, 1, NULL, 1) != ERR_BAD_ARGUMENTS) {
+        error("convertMapcodesUtf16ToAscii (bad arguments)", "", 0, ERR_BAD_ARGUMENTS);
+    }
+    return size;
+}
+
+
+// the batch conversions must give the mapcodes of convertMapcodeToAlphabetUtf8/Utf16, back to back, and every
+// buffer size must convert exactly the mapcodes that fit (checked for the first nrSizeTests mapcodes)
+static int testToAlphabet(void) {
+    const char *mapcodes[NR_BATCH_MAPCODES];
+    char utf8Buffer[NR_BATCH_MAPCODES * (MAX_MAPCODE_RESULT_UTF8_LEN + 1)];
+    UWORD utf16Buffer[NR_BATCH_MAPCODES * (MAX_MAPCODE_RESULT_UTF16_LEN + 1)];
+    char utf8Expected[NR_BATCH_MAPCODES * (MAX_MAPCODE_RESULT_UTF8_LEN + 1)];
+    UWORD utf16Expected[NR_BATCH_MAPCODES * (MAX_MAPCODE_RESULT_UTF16_LEN + 1)];
+    int utf8End[NR_BATCH_MAPCODES];
+    int utf16End[NR_BATCH_MAPCODES];
+    const int nrSizeTests = 40;
+    int counter = 0;
+    int alphabet, size, i, n;
+
+    for (i = 0; i < nrBatchMapcodes; i++) {
+        mapcodes[i] = batchMapcode[i];
+    }
+    for (alphabet = ALPHABET_ROMAN; alphabet < _ALPHABET_MAX; alphabet++) {
+        int utf8Length = 0;
+        int utf16Length = 0;
+        for (i = 0; i < nrBatchMapcodes; i++) {
+            convertMapcodeToAlphabetUtf8(utf8Expected + utf8Length, mapcodes[i], (enum Alphabet) alphabet);
+            utf8Length += (int) strlen(utf8Expected + utf8Length) + 1;
+            utf8End[i] = utf8Length;
+            convertMapcodeToAlphabetUtf16(utf16Expected + utf16Length, mapcodes[i], (enum Alphabet) alphabet);
+            while (utf16Expected[utf16Length]) {
+                utf16Length++;
+            }
+            utf16End[i] = ++utf16Length;
+        }
+
+        n = convertMapcodesToAlphabetUtf8(utf8Buffer, (int) sizeof(utf8Buffer), mapcodes, nrBatchMapcodes,
+                                          (enum Alphabet) alphabet);
+        if (n != nrBatchMapcodes || memcmp(utf8Buffer, utf8Expected, (size_t) utf8Length) != 0) {
+            error("convertMapcodesToAlphabetUtf8", "", n, nrBatchMapcodes);
+        }
+        n = convertMapcodesToAlphabetUtf16(utf16Buffer, (int) (sizeof(utf16Buffer) / sizeof(UWORD)), mapcodes,
+                                           nrBatchMapcodes, (enum Alphabet) alphabet);
+        if (n != nrBatchMapcodes || memcmp(utf16Buffer, utf16Expected, (size_t) utf16Length * sizeof(UWORD)) != 0) {
+            error("convertMapcodesToAlphabetUtf16", "", n, nrBatchMapcodes);
+        }
+
+        for (size = 0; size <= utf8End[nrSizeTests - 1]; size++) {
+            n = convertMapcodesToAlphabetUtf8(utf8Buffer, size, mapcodes, nrSizeTests, (enum Alphabet) alphabet);
+            i = 0;
+            while (i < nrSizeTests && utf8End[i] <= size) {
+                i++;
+            }
+            if (n != i || memcmp(utf8Buffer, utf8Expected, (size_t) (i > 0 ? utf8End[i - 1] : 0)) != 0) {
+                error("convertMapcodesToAlphabetUtf8 (buffer full)", "", n, i);
+            }
+            counter++;
+        }
+        for (size = 0; size <= utf16End[nrSizeTests - 1]; size++) {
+            n = convertMapcodesToAlphabetUtf16(utf16Buffer, size, mapcodes, nrSizeTests, (enum Alphabet) alphabet);
+            i = 0;
+            while (i < nrSizeTests && utf16End[i] <= size) {
+                i++;
+            }
+            if (n != i ||
+                memcmp(utf16Buffer, utf16Expected, (size_t) (i > 0 ? utf16End[i - 1] : 0) * sizeof(UWORD)) != 0) {
+                error("convertMapcodesToAlphabetUtf16 (buffer full)", "", n, i);
+            }
+            counter++;
+        }
+    }
+    if (convertMapcodesToAlphabetUtf8(utf8Buffer, 100, mapcodes, 1, _ALPHABET_MAX) != ERR_BAD_ARGUMENTS ||
+        convertMapcodesToAlphabetUtf16(utf16Buffer, 100, mapcodes, 1, _ALPHABET_MIN) != ERR_BAD_ARGUMENTS ||
+        convertMapcodesToAlphabetUtf8(utf8Buffer, -1, mapcodes, 1, ALPHABET_ROMAN) != ERR_BAD_ARGUMENTS) {
+        error("convertMapcodesToAlphabet (bad arguments)", "", 0, ERR_BAD_ARGUMENTS);
+    }
+    return counter;
+}
+
+
+// stores the names of all territories in territoryName
+static void collectTerritoryNames(void) {
+    char *pool = namePool;
+    int nrNames = 0;
+    int i, locale, alternative;
+    for (i = 0; i < NR_TERRITORIES; i++) {
+        firstTerritoryName[i] = nrNames;
+        for (locale = 0; locale <= NAMES_ISO_CODE; locale++) {
+            for (alternative = 0; ; alternative++) {
+                char *c;
+                if (nrNames >= MAX_NR_NAMES ||
+                    pool + MAX_TERRITORY_FULLNAME_UTF8_LEN + 1 > namePool + sizeof(namePool)) {
+                    printf("collectTerritoryNames: too many names\n");
+                    nrErrors++;
+                    return;
+                }
+                if (locale == NAMES_ISO_CODE) {
+                    if (alternative > 0) {
+                        break;
+                    }
+                    getTerritoryIsoName(pool, TERRITORY_OF_INDEX(i), 0);
+                } else if (!getFullTerritoryNameInLocaleUtf8(pool, TERRITORY_OF_INDEX(i), alternative,
+                                                             locale == NAMES_LOCAL ? NULL : LOCALES[locale])) {
+                    break;
+                }
+                for (c = pool; *c; c++) {
+                    if (*c >= 'A' && *c <= 'Z') {
+                        *c = (char) (*c - 'A' + 'a');
+                    }
+                }
+                territoryName[nrNames] = pool;
+                territoryNameLocale[nrNames++] = locale;
+                pool = c + 1;
+            }
+        }
+    }
+    firstTerritoryName[NR_TERRITORIES] = nrNames;
+}
+
+
+// returns the code of the utf8 character at *s, and skips it
+static int nextCharacter(const unsigned char **s) {
+    int c = *(*s)++;
+    if (c >= 0xC0) {
+        const int is3Bytes = (c >= 0xE0);
+        c = (c & (is3Bytes ? 0x0F : 0x1F)) << 6 | (*(*s)++ & 0x3F);
+        if (is3Bytes) {
+            c = c << 6 | (*(*s)++ & 0x3F);
+        }
+    }
+    return c;
+}
+
+
+// returns nonzero if the character c may fold to ascii (latin letters with diacritics) or to nothing
+static int mayFoldToAscii(const int c) {
+    return (c >= 0x80 && c < 0x370) || (c >= 0x1E00 && c < 0x1F00);
+}
+
+
+// returns 1 if name starts with (or, if exact, is) the lowercase ascii prefix, as getTerritoriesWithNamePrefix
+// compares them (without diacritics), 0 if not, or -1 if that depends on how the non-ascii characters fold
+static int nameMatches(const char *name, const char *prefix, const int exact) {
+    const unsigned char *n = (const unsigned char *) name;
+    for (; *prefix; prefix++) {
+        const int c = nextCharacter(&n);
+        if (mayFoldToAscii(c)) {
+            return -1;
+        }
+        if (c != (unsigned char) *prefix) {
+            return 0;
+        }
+    }
+    if (!exact) {
+        return 1;
+    }
+    if (*n) {
+        const int c = nextCharacter(&n);
+        return (c >= 0x300 && c < 0x370) ? -1 : 0; // a combining character folds to nothing
+    }
+    return 1;
+}
+
+
+// returns 1 if a name of territory (in locale, or in any language if locale < 0) matches prefix, 0 if none
+// does, or -1 if that can not be decided (see nameMatches)
+static int territoryMatches(const enum Territory territory, const int locale, const char *prefix, const int exact) {
+    int result = 0;
+    int i;
+    for (i = firstTerritoryName[INDEX_OF_TERRITORY(territory)];
+         i < firstTerritoryName[INDEX_OF_TERRITORY(territory) + 1]; i++) {
+        if (locale < 0 || territoryNameLocale[i] == locale) {
+            const int matches = nameMatches(territoryName[i], prefix, exact);
+            if (matches > 0) {
+                return 1;
+            }
+            if (matches < 0) {
+                result = -1;
+            }
+        }
+    }
+    return result;
+}
+
+
+// returns the rank of territory for an ascii prefix: exact matches first, then names in locale, then
+// countries; -1 if it can not be decided
+static int rankOf(const enum Territory territory, const int locale, const char *prefix) {
+    const int exact = territoryMatches(territory, -1, prefix, 1);
+    const int preferred = (locale < 0) ? 0 : territoryMatches(territory, locale, prefix, exact);
+    if (exact < 0 || preferred < 0) {
+        return -1;
+    }
+    return exact * 4 + preferred * 2 + (getParentCountryOf(territory) == TERRITORY_NONE);
+}
+
+
+// every prefix of every name of every territory (in a few languages) must find that territory; the
+// territories must be ranked as documented; a longer prefix may only drop territories, and asking for
+// fewer territories must give the best ones
+static int testNamePrefix(void) {
+    static const int testLocales[] = {NAMES_LOCAL, 6, 7, 10, 16, 18}; // local, de, en, fr, ja, nl
+    enum Territory all[NR_TERRITORIES];
+    enum Territory previous[NR_TERRITORIES];
+    enum Territory best[3];
+    int counter = 0;
+    int i, l, j, k;
+
+    collectTerritoryNames();
+    for (i = 0; i < NR_TERRITORIES; i++) {
+        for (l = 0; l < (int) (sizeof(testLocales) / sizeof(testLocales[0])); l++) {
+            const char *locale = (testLocales[l] == NAMES_LOCAL) ? NULL : LOCALES[testLocales[l]];
+            char name[MAX_TERRITORY_FULLNAME_UTF8_LEN + 1];
+            char prefix[MAX_TERRITORY_FULLNAME_UTF8_LEN + 1];
+            int nrPrevious = NR_TERRITORIES;
+            int len = 0;
+            getFullTerritoryNameInLocaleUtf8(name, TERRITORY_OF_INDEX(i), 0, locale);
+            for (j = 0; j < NR_TERRITORIES; j++) {
+                previous[j] = TERRITORY_OF_INDEX(j);
+            }
+            while (name[len]) {
+                int n, ascii, lastRank;
+                do {
+                    len++;
+                } while (((unsigned char) name[len] & 0xC0) == 0x80); // add a whole character
+                memcpy(prefix, name, (size_t) len);
+                prefix[len] = 0;
+                n = getTerritoriesWithNamePrefix(all, NR_TERRITORIES, prefix, locale);
+                counter++;
+
+                j = 0;
+                while (j < n && all[j] != TERRITORY_OF_INDEX(i)) {
+                    j++;
+                }
+                if (j == n) {
+                    error("getTerritoriesWithNamePrefix (not found)", prefix, n, i);
+                }
+                for (j = 0; j < n; j++) {
+                    k = 0;
+                    while (k < nrPrevious && previous[k] != all[j]) {
+                        k++;
+                    }
+                    if (k == nrPrevious) {
+                        error("getTerritoriesWithNamePrefix (not found for a shorter prefix)", prefix, all[j], 0);
+                    }
+                }
+                k = getTerritoriesWithNamePrefix(best, 3, prefix, locale);
+                if (k != (n < 3 ? n : 3) || memcmp(best, all, (size_t) k * sizeof(enum Territory)) != 0) {
+                    error("getTerritoriesWithNamePrefix (3 best)", prefix, k, n);
+                }
+
+                // the rank must not increase (for the ascii prefixes, without trailing spaces)
+                ascii = 1;
+                for (j = 0; j < len; j++) {
+                    if ((unsigned char) prefix[j] >= 0x80) {
+                        ascii = 0;
+                    } else if (prefix[j] >= 'A' && prefix[j] <= 'Z') {
+                        prefix[j] = (char) (prefix[j] - 'A' + 'a');
+                    }
+                }
+                lastRank = 7;
+                for (j = 0; ascii && prefix[len - 1] != ' ' && j < n; j++) {
+                    const int rank = rankOf(all[j], locale == NULL ? -1 : testLocales[l], prefix);
+                    if (rank > lastRank) {
+                        error("getTerritoriesWithNamePrefix (rank)", prefix, rank, lastRank);
+                    }
+                    if (rank >= 0) {
+                        lastRank = rank;
+                    }
+                }
+                memcpy(previous, all, (size_t) n * sizeof(enum Territory));
+                nrPrevious = n;
+            }
+        }
+    }
+    if (getTerritoriesWithNamePrefix(all, NR_TERRITORIES, "", NULL) != 0 ||
+        getTerritoriesWithNamePrefix(all, 0, "Ne", NULL) != 0 ||
+        getTerritoriesWithNamePrefix(all, NR_TERRITORIES, "No such territory", NULL) != 0) {
+        error("getTerritoriesWithNamePrefix (no match)", "", 1, 0);
+    }
+    return counter;
+}
+
+
+// every mapcode in an alphabet must be recognized as that alphabet (as roman if it is all ascii), and as
+// no alphabet if its utf8 is cut in the middle of a character; recognizeAlphabetsUtf8 must agree
+static int testRecognizeAlphabet(void) {
+    static const char *const unrecognized[] = {"\xE2\x82\xAC", "\xF0\x9F\x98\x80", "\x80", "NLD \xC3", NULL};
+    char utf8[_ALPHABET_MAX][MAX_MAPCODE_RESULT_UTF8_LEN + 1];
+    const char *strings[_ALPHABET_MAX + 5];
+    enum Alphabet alphabets[_ALPHABET_MAX + 5];
+    int counter = 0;
+    int i, alphabet, n;
+
+    for (i = 0; i < nrBatchMapcodes; i++) {
+        for (alphabet = ALPHABET_ROMAN; alphabet < _ALPHABET_MAX; alphabet++) {
+            const char *s = convertMapcodeToAlphabetUtf8(utf8[alphabet], batchMapcode[i], (enum Alphabet) alphabet);
+            enum Alphabet expected = ALPHABET_ROMAN;
+            enum Alphabet recognized;
+            char cut[MAX_MAPCODE_RESULT_UTF8_LEN + 1];
+            while (*s && (unsigned char) *s < 0x80) {
+                s++;
+            }
+            if (*s) {
+                expected = (enum Alphabet) alphabet;
+            }
+            recognized = recognizeAlphabetUtf8(utf8[alphabet]);
+            if (recognized != expected) {
+                error("recognizeAlphabetUtf8", utf8[alphabet], recognized, expected);
+            }
+            if (*s) {
+                memcpy(cut, utf8[alphabet], (size_t) (s - utf8[alphabet] + 1));
+                cut[s - utf8[alphabet] + 1] = 0;
+                recognized = recognizeAlphabetUtf8(cut);
+                if (recognized != _ALPHABET_MIN) {
+                    error("recognizeAlphabetUtf8 (utf8 error)", cut, recognized, _ALPHABET_MIN);
+                }
+            }
+            strings[alphabet] = utf8[alphabet];
+            counter++;
+        }
+
+        memcpy(strings + _ALPHABET_MAX, unrecognized, sizeof(unrecognized));
+        n = recognizeAlphabetsUtf8(alphabets, strings, _ALPHABET_MAX + 5);
+        if (n != _ALPHABET_MAX) {
+            error("recognizeAlphabetsUtf8", batchMapcode[i], n, _ALPHABET_MAX);
+        }
+        for (alphabet = 0; alphabet < _ALPHABET_MAX + 5; alphabet++) {
+            const enum Alphabet expected = (alphabet < _ALPHABET_MAX) ? recognizeAlphabetUtf8(strings[alphabet])
+                                                                      : _ALPHABET_MIN;
+            if (alphabets[alphabet] != expected) {
+                error("recognizeAlphabetsUtf8", batchMapcode[i], alphabets[alphabet], expected);
+            }
+        }
+    }
+    if (recognizeAlphabetUtf8("") != ALPHABET_ROMAN || recognizeAlphabetUtf8("Caf\xC3\xA9") != ALPHABET_ROMAN ||
+        recognizeAlphabetsUtf8(alphabets, NULL, 1) != ERR_BAD_ARGUMENTS ||
+        recognizeAlphabetsUtf8(alphabets, strings, -1) != ERR_BAD_ARGUMENTS) {
+        error("recognizeAlphabetUtf8", "", 0, ALPHABET_ROMAN);
+    }
+    return counter;
+}
+
+
+// returns the roman form of one mapcode (in alphabet) by convertMapcodesToRomanUtf8, after checking that
+// convertMapcodesToRomanUtf16 gives the same
+static const char *romanOf(char *roman, const char *ascii, const enum Alphabet alphabet) {
+    char utf8[MAX_MAPCODE_RESULT_UTF8_LEN + 1];
+    UWORD utf16[MAX_MAPCODE_RESULT_UTF16_LEN + 1];
+    char fromUtf16[MAX_MAPCODE_RESULT_ASCII_LEN];
+    int n;
+    convertMapcodeToAlphabetUtf8(utf8, ascii, alphabet);
+    convertMapcodeToAlphabetUtf16(utf16, ascii, alphabet);
+    n = convertMapcodesToRomanUtf8(roman, MAX_MAPCODE_RESULT_ASCII_LEN, utf8, 1);
+    if (n != 1 || convertMapcodesToRomanUtf16(fromUtf16, MAX_MAPCODE_RESULT_ASCII_LEN, utf16, 1) != 1 ||
+        strcmp(roman, fromUtf16) != 0) {
+        error("convertMapcodesToRomanUtf16", utf8, n, 1);
+    }
+    return roman;
+}
+
+
+// the roman form of a mapcode must be empty if the mapcode does not have a valid format, or can not be decoded
+// because of an invalid character; otherwise it must decode as the mapcode does, and be its own roman form
+static void testRoman(const char *ascii, const enum Alphabet alphabet, const enum Territory context) {
+    static const char *const invalidExtensions[] = {"-", "-Z", "-K2Z", "-A", "-K2K2K2K2K", "-K-2", "-!"};
+    char utf8[MAX_MAPCODE_RESULT_UTF8_LEN + 1];
+    char roman[MAX_MAPCODE_RESULT_ASCII_LEN];
+    char again[MAX_MAPCODE_RESULT_ASCII_LEN];
+    double lat1, lon1, lat2, lon2;
+    enum MapcodeError err1, err2;
+    int i;
+
+    convertMapcodeToAlphabetUtf8(utf8, ascii, alphabet);
+    romanOf(roman, ascii, alphabet);
+    err1 = decodeMapcodeToLatLonUtf8(&lat1, &lon1, utf8, context, NULL);
+    if (!*roman) {
+        if (err1 == ERR_OK) {
+            error("convertMapcodesToRomanUtf8 (empty)", utf8, 0, 1);
+        }
+    } else {
+        err2 = decodeMapcodeToLatLonUtf8(&lat2, &lon2, roman, context, NULL);
+        if (err1 != err2 || (err1 == ERR_OK && (lat1 != lat2 || lon1 != lon2)) ||
+            compareWithMapcodeFormatUtf8(utf8) != ERR_OK) {
+            error("convertMapcodesToRomanUtf8", utf8, err2, err1);
+        }
+        if (strcmp(romanOf(again, roman, ALPHABET_ROMAN), roman) != 0) {
+            error("convertMapcodesToRomanUtf8 (of the roman form)", roman, 0, 1);
+        }
+    }
+
+    // a mapcode with an invalid extension must be converted to an empty string
+    if (err1 == ERR_OK && strchr(ascii, '-') == NULL) {
+        for (i = 0; i < (int) (sizeof(invalidExtensions) / sizeof(invalidExtensions[0])); i++) {
+            char invalid[MAX_MAPCODE_RESULT_ASCII_LEN + 16];
+            strcpy(invalid, ascii);
+            strcat(invalid, invalidExtensions[i]);
+            if (*romanOf(roman, invalid, alphabet)) {
+                error("convertMapcodesToRomanUtf8 (invalid extension)", invalid, (int) strlen(roman), 0);
+            }
+        }
+    }
+}
+
+
+// the roman form of the mapcodes of the encoder must be the mapcodes themselves, in every alphabet; the batch
+// conversion must give the single conversions back to back, and every buffer size must convert exactly the
+// mapcodes that fit
+static int testRomanBatch(void) {
+    char utf8Buffer[NR_BATCH_MAPCODES * (MAX_MAPCODE_RESULT_UTF8_LEN + 1)];
+    char expected[NR_BATCH_MAPCODES * MAX_MAPCODE_RESULT_ASCII_LEN];
+    char asciiBuffer[NR_BATCH_MAPCODES * MAX_MAPCODE_RESULT_ASCII_LEN];
+    int romanEnd[NR_BATCH_MAPCODES];
+    int utf8Length = 0;
+    int romanLength = 0;
+    int size, i, j, n;
+
+    for (i = 0; i < NR_COORDINATES; i++) {
+        Mapcodes mapcodes;
+        n = encodeLatLonToMapcodes(&mapcodes, randomDegrees(180.0), randomDegrees(360.0), TERRITORY_NONE, i % 3);
+        for (j = 0; j < n; j++) {
+            const char *space = strchr(mapcodes.mapcode[j], ' ');
+            const char *local = space ? space + 1 : mapcodes.mapcode[j];
+            const enum Alphabet alphabet = (enum Alphabet) ((i + j) % _ALPHABET_MAX);
+            if (strcmp(romanOf(asciiBuffer, mapcodes.mapcode[j], alphabet), mapcodes.mapcode[j]) != 0 ||
+                strcmp(romanOf(asciiBuffer, local, alphabet), local) != 0) {
+                error("convertMapcodesToRomanUtf8 (not the mapcode)", mapcodes.mapcode[j], alphabet, 0);
+            }
+        }
+    }
+    for (i = 0; i < nrBatchMapcodes; i++) {
+        convertMapcodeToAlphabetUtf8(utf8Buffer + utf8Length, batchMapcode[i], batchAlphabet[i]);
+        utf8Length += (int) strlen(utf8Buffer + utf8Length) + 1;
+        romanOf(expected + romanLength, batchMapcode[i], batchAlphabet[i]);
+        romanLength += (int) strlen(expected + romanLength) + 1;
+        romanEnd[i] = romanLength;
+    }
+    for (size = 0; size <= romanLength; size++) {
+        n = convertMapcodesToRomanUtf8(asciiBuffer, size, utf8Buffer, nrBatchMapcodes);
+        i = 0;
+        while (i < nrBatchMapcodes && romanEnd[i] <= size) {
+            i++;
+        }
+        if (n != i || memcmp(asciiBuffer, expected, (size_t) (i > 0 ? romanEnd[i - 1] : 0)) != 0) {
+            error("convertMapcodesToRomanUtf8 (buffer full)", "", n, i);
+        }
+    }
+    if (strcmp(romanOf(asciiBuffer, "NLD 49.4V-K2", ALPHABET_ROMAN), "NLD 49.4V-K2") != 0 ||
+        strcmp(romanOf(asciiBuffer, " nld\t49.4v-k2 ", ALPHABET_GREEK), "NLD 49.4V-K2") != 0 ||
+        strcmp(romanOf(asciiBuffer, "49.4V", ALPHABET_ARABIC), "49.4V") != 0) {
+        error("convertMapcodesToRomanUtf8", asciiBuffer, 0, 1);
+    }
+    if (convertMapcodesToRomanUtf8(asciiBuffer, -1, utf8Buffer, 1) != ERR_BAD_ARGUMENTS ||
+        convertMapcodesToRomanUtf16(asciiBuffer, 100, NULL, 1) != ERR_BAD_ARGUMENTS) {
+        error("convertMapcodesToRoman (bad arguments)", "", 0, ERR_BAD_ARGUMENTS);
+    }
+    return size;
+}
+
+
+int main(void) {
+    printf("Did %d mapcode parser tests.\n", forEachMapcode(testParser));
+    forEachMapcode(collectBatchMapcode);
+    printf("Did %d utf16 to ascii batch tests.\n", testUtf16ToAscii());
+    printf("Did %d alphabet batch tests.\n", testToAlphabet());
+    printf("Did %d territory name prefix tests.\n", testNamePrefix());
+    printf("Did %d recognize alphabet tests.\n", testRecognizeAlphabet());
+    printf("Did %d roman tests.\n", forEachMapcode(testRoman));
+    printf("Did %d roman batch tests.\n", testRomanBatch());
+    if (nrErrors > 0) {
+        printf("%d error(s).\n", nrErrors);
+        return 1;
+    }
+    return 0;
+}
@@ -26,12 +26,25 @@
 # ITA 65C.X5QK
 # ITA J0QN.7X4
 # AAA TJKM1.D2Z6
+#
+# With --api it tests the other functions of the module instead, including loading generated
+# (and deliberately corrupted) data files.
 
 
 from __future__ import print_function
+from array import array
+import math
+import os
+import random
+import re
+import shutil
+import struct
+import subprocess
 import sys
+import tempfile
 import time
-import re
+import unicodedata
+import zlib
 import mapcode
 
 # The allowed margin in latitude, longitude
@@ -121,9 +134,292 @@ def parse_boundary_file(filename, mapcode_function):
                                                                mapcode_function.__name__, duration, counter / duration))
 
 
+# Data file layout (see tools/generate_data_file.py): a 64-byte header with the CRC-32 of the rest of
+# the file at byte 20 and the number of tables at byte 24, followed by a directory of (id, count,
+# offset, element size) entries per table
+DATA_START_TABLE = 1
+TERRITORY_BOUNDARIES_TABLE = 2
+
+
+def generate_data_file(directory, name):
+    filename = os.path.join(directory, name)
+    generator = os.path.join(os.path.dirname(os.path.abspath(__file__)), '..', 'tools', 'generate_data_file.py')
+    subprocess.check_call([sys.executable, generator, filename], stdout=subprocess.DEVNULL)
+    return filename
+
+
+def read_table(data, table_id):
+    for i in range(struct.unpack_from('<I', data, 24)[0]):
+        entry_id, count, offset, element_size = struct.unpack_from('<4I', data, 64 + 16 * i)
+        if entry_id == table_id:
+            return count, offset, element_size
+    raise KeyError(table_id)
+
+
+def territory_records(data, territory_index):
+    count, offset, _ = read_table(data, DATA_START_TABLE)
+    starts = struct.unpack_from('<%di' % count, data, offset)
+    return range(starts[territory_index], starts[territory_index + 1])
+
+
+def modify_data_file(filename, new_filename, modify_record, records, version=None):
+    # Rewrites the boundary records (minx, miny, maxx, maxy, flags) with the given indices, and optionally the
+    # data version, and fixes the checksum (the library derives its other tables from the records when loading)
+    data = bytearray(open(filename, 'rb').read())
+    if version is not None:
+        data[32:64] = version.encode('ascii').ljust(32, b'\0')
+    _, offset, element_size = read_table(data, TERRITORY_BOUNDARIES_TABLE)
+    for r in records:
+        record = struct.unpack_from('<5i', data, offset + element_size * r)
+        struct.pack_into('<5i', data, offset + element_size * r, *modify_record(record))
+    struct.pack_into('<I', data, 20, zlib.crc32(bytes(data[64:])) & 0xFFFFFFFF)
+    with open(new_filename, 'wb') as f:
+        f.write(data)
+    return new_filename
+
+
+def expect_error(description, function, *args):
+    try:
+        function(*args)
+    except (ValueError, IOError) as e:
+        return str(e)
+    print('%s: no error raised' % description)
+    return ''
+
+
+def test_invalid_data_files(directory):
+    # Data files with boundary records the encoder or decoder cannot handle must be rejected when loaded
+    filename = generate_data_file(directory, 'valid.dat')
+    netherlands = mapcode.territories.iso_names.index('NLD')
+    records = territory_records(open(filename, 'rb').read(), netherlands)
+    corruptions = [
+        ('grid without rows', records[1:2], lambda r: r[:4] + (12,)),
+        ('empty rectangle', records[:1], lambda r: (r[2], r[1], r[2], r[3], r[4])),
+        ('unknown codex', records[:1], lambda r: r[:4] + ((r[4] & ~31) | 3,)),
+        ('nameless last record', records[-1:], lambda r: r[:4] + (r[4] | 64,)),
+        ('auto-header last record', records[-1:], lambda r: r[:4] + (r[4] | (2 << 7),))]
+    for description, corrupted, modify in corruptions:
+        corrupt = modify_data_file(filename, os.path.join(directory, 'corrupt.dat'), modify, corrupted)
+        error = expect_error(description, mapcode.open_data, corrupt)
+        if 'invalid mapcode data file' not in error:
+            print('open_data(%s): unexpected error %r' % (description, error))
+    print('Did %d invalid data file tests.' % len(corruptions))
+
+
+def test_data_files(directory):
+    # Compares a generated data file with a copy in which the records of the Netherlands (including two
+    # restricted ones) are shrunk and its bounding box is extended to the east
+    filename = generate_data_file(directory, 'old.dat')
+    netherlands = mapcode.territories.iso_names.index('NLD')
+    records = territory_records(open(filename, 'rb').read(), netherlands)
+    new_filename = modify_data_file(filename, os.path.join(directory, 'new.dat'),
+                                    lambda r: (r[0] + (r[2] - r[0]) // 4,) + r[1:], records[:-1], '9.9.9')
+    modify_data_file(new_filename, new_filename, lambda r: r[:2] + (r[2] + 500000,) + r[3:], records[-1:])
+    old_data = mapcode.open_data(filename)
+    new_data = mapcode.open_data(new_filename)
+    if (old_data.version(), new_data.version()) != (mapcode.data_version(), '9.9.9'):
+        print('open_data: versions %s, %s' % (old_data.version(), new_data.version()))
+
+    # coordinates in and around the Netherlands, and elsewhere
+    rng = random.Random(2019)
+    latitudes = [rng.uniform(50.5, 54.0) for _ in range(2000)] + [rng.uniform(-80, 80) for _ in range(200)]
+    longitudes = [rng.uniform(2.5, 7.5) for _ in range(2000)] + [rng.uniform(-180, 180) for _ in range(200)]
+    expected = [(i, old_data.encode(lat, lon), new_data.encode(lat, lon))
+                for i, (lat, lon) in enumerate(zip(latitudes, longitudes))]
+    expected = [e for e in expected if e[1] != e[2]]
+    if not 0 < len(expected) < 2000:
+        print('diff: the modified records change %d of the coordinates' % len(expected))
+    counter = 0
+    for i, _, new_mapcodes in expected:
+        for m_code, m_territory in new_mapcodes:
+            decoded_latitude, decoded_longitude = new_data.decode(m_code, m_territory)
+            if outside_margin(decoded_latitude, latitudes[i]) or outside_margin(decoded_longitude, longitudes[i]):
+                print('decode(%s %s) with the modified data: %f,%f != %f,%f' % (
+                    m_territory, m_code, decoded_latitude, decoded_longitude, latitudes[i], longitudes[i]))
+            counter += 1
+    for threads in (1, 4):
+        for lats, lons in ((latitudes, longitudes), (array('d', latitudes), array('d', longitudes))):
+            result = mapcode.diff(old_data, new_data, lats, lons, threads)
+            if sorted(result) != expected:
+                print('diff(%d threads, %s): %d differences != %d expected' %
+                      (threads, type(lats).__name__, len(result), len(expected)))
+            counter += 1
+    if mapcode.diff(old_data, old_data, latitudes, longitudes, 2):
+        print('diff: differences between identical data sets')
+
+    error = expect_error('diff with different lengths', mapcode.diff, old_data, new_data, latitudes, longitudes[1:])
+    if 'same length' not in error:
+        print('diff: unexpected error %r' % error)
+    with open(os.path.join(directory, 'garbage.dat'), 'wb') as f:
+        f.write(b'MAPCODE\0' + b'\1' * 100)
+    for name, message in (('garbage.dat', 'invalid mapcode data file'), ('missing.dat', '')):
+        error = expect_error('open_data(%s)' % name, mapcode.open_data, os.path.join(directory, name))
+        if message not in error:
+            print('open_data(%s): unexpected error %r' % (name, error))
+        error = expect_error('load_data(%s)' % name, mapcode.load_data, os.path.join(directory, name))
+        if message not in error or mapcode.data_version() != old_data.version():
+            print('load_data(%s): unexpected error %r or version %s' % (name, error, mapcode.data_version()))
+
+    # switch the module functions to the new data and back
+    lat, lon = latitudes[expected[0][0]], longitudes[expected[0][0]]
+    for load, version in ((lambda: mapcode.load_data(new_filename), '9.9.9'), (lambda: mapcode.load_data(), None),
+                          (lambda: mapcode.load_data(new_filename), '9.9.9'), (lambda: mapcode.load_data(None), None),
+                          (lambda: mapcode.load_data(filename), None)):
+        data = new_data if version else old_data
+        if load() != data.version() or mapcode.data_version() != data.version() or \
+                mapcode.encode(lat, lon) != data.encode(lat, lon):
+            print('load_data: data version %s, expected %s' % (mapcode.data_version(), data.version()))
+        counter += 1
+    mapcode.load_data()
+    print('Did %d data file tests (%d differences).' % (counter, len(expected)))
+
+
+def random_coordinates(count, seed):
+    rng = random.Random(seed)
+    return [(rng.uniform(-80, 80), rng.uniform(-180, 180)) for _ in range(count // 2)] + \
+           [(rng.uniform(50.5, 54.0), rng.uniform(2.5, 7.5)) for _ in range(count - count // 2)]
+
+
+def test_territories():
+    # Every subdivision has a parent country (without parent), which is also its country
+    t = mapcode.territories
+    counter = 0
+    for row, iso_name in enumerate(t.iso_names):
+        parent = t.parents[row]
+        if ('-' in iso_name) != (parent >= 0) or iso_name.split('-')[-1] != t.iso_short_names[row] or \
+                (parent >= 0 and (t.parents[parent] >= 0 or t.countries[row] != parent)) or \
+                not 0 <= t.alphabets.tolist()[row][0] < 64:
+            print('territories: inconsistent row %d (%s)' % (row, iso_name))
+        counter += 1
+    print('Did %d territory table tests.' % counter)
+
+
+def read_territory_names(mapcodelib, language):
+    # Returns the names (with their alternatives) of every territory from internal_territory_names_<language>.h
+    with open(os.path.join(mapcodelib, 'internal_territory_names_%s.h' % language), 'rb') as f:
+        source = f.read().decode('utf-8')
+    return [line.split('|') for line in re.findall(r'^\s*(?:/\*[^*]*\*/\s*)?"([^"]*)",?\s*$', source, re.M)]
+
+
+def simplified_name(name):
+    # territory_from_name compares names without case and diacritics
+    decomposed = unicodedata.normalize('NFKD', name)
+    return ''.join(c for c in decomposed if not unicodedata.combining(c)).lower()
+
+
+def test_territory_names():
+    # Every full name and alternative, in every language, must be found by territory_from_name (in that
+    # language and in any language); a name shared by several territories may be found for any of them
+    mapcodelib = os.path.join(os.path.dirname(os.path.abspath(__file__)), '..', 'mapcodelib')
+    t = mapcode.territories
+    languages = sorted(re.match(r'internal_territory_names_(\w+)\.h$', name).group(1) for name in os.listdir(mapcodelib)
+                       if re.match(r'internal_territory_names_(?!packed)\w+\.h$', name))
+    names = dict((language, [set(simplified_name(n) for n in alternatives)
+                             for alternatives in read_territory_names(mapcodelib, language)])
+                 for language in languages)
+    # A build may include only some languages (see MAPCODE_LANGUAGES in setup.py); names() falls back to
+    # English for the others, so their names cannot be found
+    supported = [language for language in languages
+                 if language in ('en', 'local') or list(t.names(language)) != list(t.names('en'))]
+    counter = 0
+    for language in supported:
+        locale = None if language == 'local' else language
+        all_names = read_territory_names(mapcodelib, language)
+        if [alternatives[0] for alternatives in all_names] != list(t.names(locale)):
+            print('names(%s): different from internal_territory_names_%s.h' % (locale, language))
+        for row, alternatives in enumerate(all_names):
+            for name in alternatives:
+                if locale is not None:
+                    found = mapcode.territory_from_name(name, locale)
+                    if found is None or simplified_name(name) not in names[language][t.iso_names.index(found)]:
+                        print('territory_from_name(%s, %s) = %s != %s' % (name, locale, found, t.iso_names[row]))
+                    counter += 1
+                found = mapcode.territory_from_name(name)
+                if found is None or not any(simplified_name(name) in names[other][t.iso_names.index(found)]
+                                            for other in languages):
+                    print('territory_from_name(%s) = %s != %s' % (name, found, t.iso_names[row]))
+                counter += 1
+    if mapcode.territory_from_name('No such territory') is not None:
+        print('territory_from_name: found a territory for an unknown name')
+    print('Did %d territory name tests.' % counter)
+
+
+def test_decode_all():
+    # decode_all must find the location of every territory in which decode succeeds, and reports each
+    # territory it decodes in once (a subdivision can decode a mapcode of its country, and every territory
+    # decodes international mapcodes)
+    territories = mapcode.territories.iso_names
+    counter = 0
+    for latitude, longitude in random_coordinates(40, 29):
+        for m_code, m_territory in mapcode.encode(latitude, longitude)[:3]:
+            expected = set()
+            for territory in territories:
+                decoded = mapcode.decode(m_code, territory)
+                if not math.isnan(decoded[0]):
+                    expected.add(decoded)
+            result = mapcode.decode_all(m_code)
+            found = [d[2] for d in result]
+            if set(d[:2] for d in result) != expected or len(set(found)) != len(found) or \
+                    any(mapcode.decode(m_code, d[2]) != d[:2] for d in result):
+                print('decode_all(%s): %s != %s' % (m_code, result, expected))
+            result = mapcode.decode_all(m_code, [m_territory, 'XXX'])
+            if len(result) != 1 or result[0][:2] != mapcode.decode(m_code, m_territory) or \
+                    result[0] not in mapcode.decode_all(m_code):
+                print('decode_all(%s, [%s]): %s' % (m_code, m_territory, result))
+            counter += 1
+    print('Did %d decode_all tests.' % counter)
+
+
+def test_encode_precisions():
+    # The mapcodes with n extra digits must be those of encode() with extra_digits n
+    counter = 0
+    for latitude, longitude in random_coordinates(400, 48):
+        for territory in (None, 'NLD'):
+            mapcodes, max_errors = mapcode.encode_precisions(latitude, longitude, territory)
+            if len(max_errors) != 9 or sorted(max_errors, reverse=True) != max_errors:
+                print('encode_precisions(%f,%f): maximum errors %s' % (latitude, longitude, max_errors))
+            for digits in range(9):
+                expected = mapcode.encode(latitude, longitude, territory, digits)
+                result = [((code + '-' + extension[:digits]) if digits else code, context)
+                          for code, context, extension in mapcodes]
+                if result != expected:
+                    print('encode_precisions(%f,%f,%s) with %d digits: %s != %s' %
+                          (latitude, longitude, territory, digits, result, expected))
+                counter += 1
+    print('Did %d encode_precisions tests.' % counter)
+
+
+def test_generated_tables():
+    # The compiled-in tables generated by the tools must match the data version of the module
+    mapcodelib = os.path.join(os.path.dirname(os.path.abspath(__file__)), '..', 'mapcodelib')
+    generated = [('internal_restricted_overlaps.h', 'RESTRICTED_OVERLAPS_DATA_VERSION')]
+    for name, define in generated:
+        with open(os.path.join(mapcodelib, name), 'r') as f:
+            version = re.search(r'#define %s "([^"]+)"' % define, f.read()).group(1)
+        if version != mapcode.data_version():
+            print('%s: data version %s != %s' % (name, version, mapcode.data_version()))
+    print('Did %d generated table tests.' % len(generated))
+
+
+def test_api():
+    test_territories()
+    test_territory_names()
+    test_decode_all()
+    test_encode_precisions()
+    test_generated_tables()
+    directory = tempfile.mkdtemp()
+    try:
+        test_data_files(directory)
+        test_invalid_data_files(directory)
+    finally:
+        shutil.rmtree(directory)
+
+
 if __name__ == "__main__":
     if len(sys.argv) == 1:
-        print('Usage: %s <input file> [input file]' % (sys.argv[0]))
+        print('Usage: %s <input file> [input file] | --api' % (sys.argv[0]))
+    elif sys.argv[1] == '--api':
+        test_api()
     else:
         for file in sys.argv[1::]:
             print('Processing', file)
@@ -0,0 +1,263 @@
+/*
+ * Copyright (C) 2014-2019 Stichting Mapcode Foundation (http://www.mapcode.com)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __INTERNAL_ALPHABET_UTF8_H__
+#define __INTERNAL_ALPHABET_UTF8_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// *** GENERATED FILE (tools/generate_alphabet_utf8.py), DO NOT CHANGE OR PRETTIFY ***
+
+typedef struct {
+    unsigned char length;   // number of bytes in utf8 (1..3)
+    char utf8[4];           // utf8 encoding (zero-terminated)
+} AlphabetUtf8Char;
+
+// utf8 equivalents for ascii characters A to Z, 0-9, per alphabet
+static const AlphabetUtf8Char ASCII_TO_UTF8[_ALPHABET_MAX][36] = {
+        { // roman
+                {1, "\x41"}, {1, "\x42"}, {1, "\x43"}, {1, "\x44"}, {1, "\x45"}, {1, "\x46"},
+                {1, "\x47"}, {1, "\x48"}, {1, "\x49"}, {1, "\x4a"}, {1, "\x4b"}, {1, "\x4c"},
+                {1, "\x4d"}, {1, "\x4e"}, {1, "\x4f"}, {1, "\x50"}, {1, "\x51"}, {1, "\x52"},
+                {1, "\x53"}, {1, "\x54"}, {1, "\x55"}, {1, "\x56"}, {1, "\x57"}, {1, "\x58"},
+                {1, "\x59"}, {1, "\x5a"}, {1, "\x30"}, {1, "\x31"}, {1, "\x32"}, {1, "\x33"},
+                {1, "\x34"}, {1, "\x35"}, {1, "\x36"}, {1, "\x37"}, {1, "\x38"}, {1, "\x39"},
+        },
+        { // greek
+                {2, "\xce\x91"}, {2, "\xce\x92"}, {2, "\xce\x9e"}, {2, "\xce\x94"}, {2, "\xce\x88"}, {2, "\xce\x95"},
+                {2, "\xce\x93"}, {2, "\xce\x97"}, {2, "\xce\x99"}, {2, "\xce\xa0"}, {2, "\xce\x9a"}, {2, "\xce\x9b"},
+                {2, "\xce\x9c"}, {2, "\xce\x9d"}, {2, "\xce\x9f"}, {2, "\xce\xa1"}, {2, "\xce\x98"}, {2, "\xce\xa8"},
+                {2, "\xce\xa3"}, {2, "\xce\xa4"}, {2, "\xce\x89"}, {2, "\xce\xa6"}, {2, "\xce\xa9"}, {2, "\xce\xa7"},
+                {2, "\xce\xa5"}, {2, "\xce\x96"}, {1, "\x30"}, {1, "\x31"}, {1, "\x32"}, {1, "\x33"},
+                {1, "\x34"}, {1, "\x35"}, {1, "\x36"}, {1, "\x37"}, {1, "\x38"}, {1, "\x39"},
+        },
+        { // cyrillic
+                {2, "\xd0\x90"}, {2, "\xd0\x92"}, {2, "\xd0\xa1"}, {2, "\xd0\x94"}, {2, "\xd0\x95"}, {2, "\xd0\x96"},
+                {2, "\xd0\x93"}, {2, "\xd0\x9d"}, {1, "\x49"}, {2, "\xd0\x9f"}, {2, "\xd0\x9a"}, {2, "\xd0\x9b"},
+                {2, "\xd0\x9c"}, {2, "\xd0\x97"}, {2, "\xd0\x9e"}, {2, "\xd0\xa0"}, {2, "\xd0\xa4"}, {2, "\xd0\xaf"},
+                {2, "\xd0\xa6"}, {2, "\xd0\xa2"}, {2, "\xd0\xad"}, {2, "\xd0\xa7"}, {2, "\xd0\xa8"}, {2, "\xd0\xa5"},
+                {2, "\xd0\xa3"}, {2, "\xd0\x91"}, {1, "\x30"}, {1, "\x31"}, {1, "\x32"}, {1, "\x33"},
+                {1, "\x34"}, {1, "\x35"}, {1, "\x36"}, {1, "\x37"}, {1, "\x38"}, {1, "\x39"},
+        },
+        { // hebrew
+                {2, "\xd7\x90"}, {2, "\xd7\x91"}, {2, "\xd7\x92"}, {2, "\xd7\x93"}, {2, "\xd7\xa3"}, {2, "\xd7\x94"},
+                {2, "\xd7\x96"}, {2, "\xd7\x97"}, {2, "\xd7\x95"}, {2, "\xd7\x98"}, {2, "\xd7\x99"}, {2, "\xd7\x9a"},
+                {2, "\xd7\x9b"}, {2, "\xd7\x9c"}, {2, "\xd7\xa1"}, {2, "\xd7\x9d"}, {2, "\xd7\x9e"}, {2, "\xd7\xa0"},
+                {2, "\xd7\xa2"}, {2, "\xd7\xa4"}, {2, "\xd7\xa5"}, {2, "\xd7\xa6"}, {2, "\xd7\xa7"}, {2, "\xd7\xa8"},
+                {2, "\xd7\xa9"}, {2, "\xd7\xaa"}, {1, "\x30"}, {1, "\x31"}, {1, "\x32"}, {1, "\x33"},
+                {1, "\x34"}, {1, "\x35"}, {1, "\x36"}, {1, "\x37"}, {1, "\x38"}, {1, "\x39"},
+        },
+        { // Devanagari
+                {3, "\xe0\xa4\x85"}, {3, "\xe0\xa4\x95"}, {3, "\xe0\xa4\x97"}, {3, "\xe0\xa4\x98"}, {3, "\xe0\xa4\x8f"}, {3, "\xe0\xa4\x9a"},
+                {3, "\xe0\xa4\x9c"}, {3, "\xe0\xa4\x9f"}, {1, "\x49"}, {3, "\xe0\xa4\xa0"}, {3, "\xe0\xa4\xa3"}, {3, "\xe0\xa4\xa4"},
+                {3, "\xe0\xa4\xa6"}, {3, "\xe0\xa4\xa7"}, {1, "\x4f"}, {3, "\xe0\xa4\xa8"}, {3, "\xe0\xa4\xaa"}, {3, "\xe0\xa4\xad"},
+                {3, "\xe0\xa4\xae"}, {3, "\xe0\xa4\xb0"}, {3, "\xe0\xa4\xab"}, {3, "\xe0\xa4\xb2"}, {3, "\xe0\xa4\xb5"}, {3, "\xe0\xa4\xb8"},
+                {3, "\xe0\xa4\xb9"}, {3, "\xe0\xa4\xac"}, {3, "\xe0\xa5\xa6"}, {3, "\xe0\xa5\xa7"}, {3, "\xe0\xa5\xa8"}, {3, "\xe0\xa5\xa9"},
+                {3, "\xe0\xa5\xaa"}, {3, "\xe0\xa5\xab"}, {3, "\xe0\xa5\xac"}, {3, "\xe0\xa5\xad"}, {3, "\xe0\xa5\xae"}, {3, "\xe0\xa5\xaf"},
+        },
+        { // Malayalam
+                {3, "\xe0\xb4\x92"}, {3, "\xe0\xb4\x95"}, {3, "\xe0\xb4\x96"}, {3, "\xe0\xb4\x97"}, {3, "\xe0\xb4\x8b"}, {3, "\xe0\xb4\x9a"},
+                {3, "\xe0\xb4\x9c"}, {3, "\xe0\xb4\x9f"}, {1, "\x49"}, {3, "\xe0\xb4\xa1"}, {3, "\xe0\xb4\xa4"}, {3, "\xe0\xb4\xa5"},
+                {3, "\xe0\xb4\xa6"}, {3, "\xe0\xb4\xa7"}, {3, "\xe0\xb4\xa0"}, {3, "\xe0\xb4\xa8"}, {3, "\xe0\xb4\xae"}, {3, "\xe0\xb4\xb0"},
+                {3, "\xe0\xb4\xb1"}, {3, "\xe0\xb4\xb2"}, {3, "\xe0\xb4\x89"}, {3, "\xe0\xb4\xb4"}, {3, "\xe0\xb4\xb5"}, {3, "\xe0\xb4\xb6"},
+                {3, "\xe0\xb4\xb8"}, {3, "\xe0\xb4\xb9"}, {3, "\xe0\xb5\xa6"}, {3, "\xe0\xb5\xa7"}, {3, "\xe0\xb5\xa8"}, {3, "\xe0\xb5\xa9"},
+                {3, "\xe0\xb5\xaa"}, {3, "\xe0\xb5\xab"}, {3, "\xe0\xb5\xac"}, {3, "\xe0\xb5\xad"}, {3, "\xe0\xb5\xae"}, {3, "\xe0\xb5\xaf"},
+        },
+        { // Georgian
+                {3, "\xe1\x82\xa0"}, {3, "\xe1\x82\xa1"}, {3, "\xe1\x82\xa3"}, {3, "\xe1\x82\xa6"}, {3, "\xe1\x82\xa4"}, {3, "\xe1\x82\xa9"},
+                {3, "\xe1\x82\xab"}, {3, "\xe1\x82\xac"}, {1, "\x49"}, {3, "\xe1\x82\xae"}, {3, "\xe1\x82\xb0"}, {3, "\xe1\x82\xb1"},
+                {3, "\xe1\x82\xb2"}, {3, "\xe1\x82\xb4"}, {3, "\xe1\x82\xad"}, {3, "\xe1\x82\xb5"}, {3, "\xe1\x82\xb6"}, {3, "\xe1\x82\xb7"},
+                {3, "\xe1\x82\xb8"}, {3, "\xe1\x82\xb9"}, {3, "\xe1\x82\xa8"}, {3, "\xe1\x82\xba"}, {3, "\xe1\x82\xbb"}, {3, "\xe1\x82\xbd"},
+                {3, "\xe1\x82\xbe"}, {3, "\xe1\x82\xbf"}, {1, "\x30"}, {1, "\x31"}, {1, "\x32"}, {1, "\x33"},
+                {1, "\x34"}, {1, "\x35"}, {1, "\x36"}, {1, "\x37"}, {1, "\x38"}, {1, "\x39"},
+        },
+        { // Katakana
+                {3, "\xe3\x82\xa2"}, {3, "\xe3\x82\xab"}, {3, "\xe3\x82\xad"}, {3, "\xe3\x82\xaf"}, {3, "\xe3\x82\xaa"}, {3, "\xe3\x82\xb1"},
+                {3, "\xe3\x82\xb3"}, {3, "\xe3\x82\xb5"}, {1, "\x49"}, {3, "\xe3\x82\xb9"}, {3, "\xe3\x83\x81"}, {3, "\xe3\x83\x88"},
+                {3, "\xe3\x83\x8a"}, {3, "\xe3\x83\x8c"}, {1, "\x4f"}, {3, "\xe3\x83\x92"}, {3, "\xe3\x83\x95"}, {3, "\xe3\x83\x98"},
+                {3, "\xe3\x83\x9b"}, {3, "\xe3\x83\xa1"}, {3, "\xe3\x82\xa8"}, {3, "\xe3\x83\xa2"}, {3, "\xe3\x83\xa8"}, {3, "\xe3\x83\xa9"},
+                {3, "\xe3\x83\xad"}, {3, "\xe3\x83\xb2"}, {1, "\x30"}, {1, "\x31"}, {1, "\x32"}, {1, "\x33"},
+                {1, "\x34"}, {1, "\x35"}, {1, "\x36"}, {1, "\x37"}, {1, "\x38"}, {1, "\x39"},
+        },
+        { // Thai
+                {3, "\xe0\xb8\xb0"}, {3, "\xe0\xb8\x81"}, {3, "\xe0\xb8\x82"}, {3, "\xe0\xb8\x84"}, {3, "\xe0\xb8\xb2"}, {3, "\xe0\xb8\x87"},
+                {3, "\xe0\xb8\x88"}, {3, "\xe0\xb8\x89"}, {1, "\x49"}, {3, "\xe0\xb8\x8a"}, {3, "\xe0\xb8\x91"}, {3, "\xe0\xb8\x94"},
+                {3, "\xe0\xb8\x96"}, {3, "\xe0\xb8\x97"}, {1, "\x4f"}, {3, "\xe0\xb8\x98"}, {3, "\xe0\xb8\x9a"}, {3, "\xe0\xb8\x9c"},
+                {3, "\xe0\xb8\xa1"}, {3, "\xe0\xb8\xa3"}, {3, "\xe0\xb8\xac"}, {3, "\xe0\xb8\xa5"}, {3, "\xe0\xb8\xa7"}, {3, "\xe0\xb8\xad"},
+                {3, "\xe0\xb8\xae"}, {3, "\xe0\xb8\xaf"}, {3, "\xe0\xb9\x90"}, {3, "\xe0\xb9\x91"}, {3, "\xe0\xb9\x92"}, {3, "\xe0\xb9\x93"},
+                {3, "\xe0\xb9\x94"}, {3, "\xe0\xb9\x95"}, {3, "\xe0\xb9\x96"}, {3, "\xe0\xb9\x97"}, {3, "\xe0\xb9\x98"}, {3, "\xe0\xb9\x99"},
+        },
+        { // Laos
+                {3, "\xe0\xba\xb0"}, {3, "\xe0\xba\x81"}, {3, "\xe0\xba\x82"}, {3, "\xe0\xba\x84"}, {3, "\xe0\xbb\x83"}, {3, "\xe0\xba\x87"},
+                {3, "\xe0\xba\x88"}, {3, "\xe0\xba\x8a"}, {3, "\xe0\xbb\x84"}, {3, "\xe0\xba\x8d"}, {3, "\xe0\xba\x94"}, {3, "\xe0\xba\x97"},
+                {3, "\xe0\xba\x99"}, {3, "\xe0\xba\x9a"}, {1, "\x4f"}, {3, "\xe0\xba\x9c"}, {3, "\xe0\xba\x9e"}, {3, "\xe0\xba\xa1"},
+                {3, "\xe0\xba\xa2"}, {3, "\xe0\xba\xa3"}, {3, "\xe0\xba\xbd"}, {3, "\xe0\xba\xa7"}, {3, "\xe0\xba\xaa"}, {3, "\xe0\xba\xab"},
+                {3, "\xe0\xba\xad"}, {3, "\xe0\xba\xaf"}, {1, "\x30"}, {1, "\x31"}, {1, "\x32"}, {1, "\x33"},
+                {1, "\x34"}, {1, "\x35"}, {1, "\x36"}, {1, "\x37"}, {1, "\x38"}, {1, "\x39"},
+        },
+        { // armenian
+                {2, "\xd5\x96"}, {2, "\xd4\xb2"}, {2, "\xd4\xb3"}, {2, "\xd4\xb4"}, {2, "\xd4\xb5"}, {2, "\xd4\xb8"},
+                {2, "\xd4\xb9"}, {2, "\xd4\xba"}, {2, "\xd4\xbb"}, {2, "\xd4\xbd"}, {2, "\xd4\xbf"}, {2, "\xd5\x80"},
+                {2, "\xd5\x81"}, {2, "\xd5\x83"}, {2, "\xd5\x95"}, {2, "\xd5\x87"}, {2, "\xd5\x88"}, {2, "\xd5\x8a"},
+                {2, "\xd5\x8d"}, {2, "\xd5\x8e"}, {2, "\xd5\x85"}, {2, "\xd5\x8f"}, {2, "\xd5\x90"}, {2, "\xd5\x91"},
+                {2, "\xd5\x92"}, {2, "\xd5\x93"}, {1, "\x30"}, {1, "\x31"}, {1, "\x32"}, {1, "\x33"},
+                {1, "\x34"}, {1, "\x35"}, {1, "\x36"}, {1, "\x37"}, {1, "\x38"}, {1, "\x39"},
+        },
+        { // Bengali/Assamese
+                {3, "\xe0\xa6\x9c"}, {3, "\xe0\xa6\x98"}, {3, "\xe0\xa6\x95"}, {3, "\xe0\xa6\x96"}, {3, "\xe0\xa6\xae"}, {3, "\xe0\xa6\x97"},
+                {3, "\xe0\xa6\x99"}, {3, "\xe0\xa6\x9a"}, {1, "\x49"}, {3, "\xe0\xa6\x9d"}, {3, "\xe0\xa6\xa0"}, {3, "\xe0\xa6\xa1"},
+                {3, "\xe0\xa6\xa2"}, {3, "\xe0\xa6\xa3"}, {1, "\x4f"}, {3, "\xe0\xa6\xa4"}, {3, "\xe0\xa6\xa5"}, {3, "\xe0\xa6\xa6"},
+                {3, "\xe0\xa6\xa8"}, {3, "\xe0\xa6\xaa"}, {3, "\xe0\xa6\x9f"}, {3, "\xe0\xa6\xac"}, {3, "\xe0\xa6\xad"}, {3, "\xe0\xa6\xaf"},
+                {3, "\xe0\xa6\xb2"}, {3, "\xe0\xa6\xb9"}, {3, "\xe0\xa7\xa6"}, {3, "\xe0\xa7\xa7"}, {3, "\xe0\xa7\xa8"}, {3, "\xe0\xa7\xa9"},
+                {3, "\xe0\xa7\xaa"}, {3, "\xe0\xa7\xab"}, {3, "\xe0\xa7\xac"}, {3, "\xe0\xa7\xad"}, {3, "\xe0\xa7\xae"}, {3, "\xe0\xa7\xaf"},
+        },
+        { // Gurmukhi
+                {3, "\xe0\xa8\x85"}, {3, "\xe0\xa8\x95"}, {3, "\xe0\xa8\x97"}, {3, "\xe0\xa8\x98"}, {3, "\xe0\xa8\x8f"}, {3, "\xe0\xa8\x9a"},
+                {3, "\xe0\xa8\x9c"}, {3, "\xe0\xa8\x9f"}, {1, "\x49"}, {3, "\xe0\xa8\xa0"}, {3, "\xe0\xa8\xa3"}, {3, "\xe0\xa8\xa4"},
+                {3, "\xe0\xa8\xa6"}, {3, "\xe0\xa8\xa7"}, {1, "\x4f"}, {3, "\xe0\xa8\xa8"}, {3, "\xe0\xa8\xaa"}, {3, "\xe0\xa8\xad"},
+                {3, "\xe0\xa8\xae"}, {3, "\xe0\xa8\xb0"}, {3, "\xe0\xa8\xab"}, {3, "\xe0\xa8\xb2"}, {3, "\xe0\xa8\xb5"}, {3, "\xe0\xa8\xb8"},
+                {3, "\xe0\xa8\xb9"}, {3, "\xe0\xa8\xa1"}, {3, "\xe0\xa9\xa6"}, {3, "\xe0\xa9\xa7"}, {3, "\xe0\xa9\xa8"}, {3, "\xe0\xa9\xa9"},
+                {3, "\xe0\xa9\xaa"}, {3, "\xe0\xa9\xab"}, {3, "\xe0\xa9\xac"}, {3, "\xe0\xa9\xad"}, {3, "\xe0\xa9\xae"}, {3, "\xe0\xa9\xaf"},
+        },
+        { // Tibetan
+                {3, "\xe0\xbd\x98"}, {3, "\xe0\xbd\x80"}, {3, "\xe0\xbd\x81"}, {3, "\xe0\xbd\x82"}, {3, "\xe0\xbd\xa4"}, {3, "\xe0\xbd\x84"},
+                {3, "\xe0\xbd\x85"}, {3, "\xe0\xbd\x86"}, {1, "\x49"}, {3, "\xe0\xbd\x87"}, {3, "\xe0\xbd\x89"}, {3, "\xe0\xbd\x95"},
+                {3, "\xe0\xbd\x90"}, {3, "\xe0\xbd\x8f"}, {1, "\x4f"}, {3, "\xe0\xbd\x91"}, {3, "\xe0\xbd\x93"}, {3, "\xe0\xbd\x94"},
+                {3, "\xe0\xbd\x96"}, {3, "\xe0\xbd\x9e"}, {3, "\xe0\xbd\xa0"}, {3, "\xe0\xbd\x9f"}, {3, "\xe0\xbd\xa1"}, {3, "\xe0\xbd\xa2"},
+                {3, "\xe0\xbd\xa3"}, {3, "\xe0\xbd\xa6"}, {3, "\xe0\xbc\xa0"}, {3, "\xe0\xbc\xa1"}, {3, "\xe0\xbc\xa2"}, {3, "\xe0\xbc\xa3"},
+                {3, "\xe0\xbc\xa4"}, {3, "\xe0\xbc\xa5"}, {3, "\xe0\xbc\xa6"}, {3, "\xe0\xbc\xa7"}, {3, "\xe0\xbc\xa8"}, {3, "\xe0\xbc\xa9"},
+        },
+        { // Arabic
+                {2, "\xd8\xa8"}, {2, "\xd8\xaa"}, {2, "\xd8\xad"}, {2, "\xd8\xae"}, {2, "\xd8\xab"}, {2, "\xd8\xaf"},
+                {2, "\xd8\xb0"}, {2, "\xd8\xb1"}, {2, "\xd8\xa7"}, {2, "\xd8\xb2"}, {2, "\xd8\xb3"}, {2, "\xd8\xb4"},
+                {2, "\xd8\xb5"}, {2, "\xd8\xb6"}, {2, "\xd9\x87"}, {2, "\xd8\xb7"}, {2, "\xd8\xb8"}, {2, "\xd8\xb9"},
+                {2, "\xd8\xba"}, {2, "\xd9\x81"}, {2, "\xd9\x82"}, {2, "\xd8\xac"}, {2, "\xd9\x84"}, {2, "\xd9\x85"},
+                {2, "\xd9\x86"}, {2, "\xd9\x88"}, {1, "\x30"}, {1, "\x31"}, {1, "\x32"}, {1, "\x33"},
+                {1, "\x34"}, {1, "\x35"}, {1, "\x36"}, {1, "\x37"}, {1, "\x38"}, {1, "\x39"},
+        },
+        { // Korean
+                {3, "\xe1\x84\x92"}, {3, "\xe1\x84\x80"}, {3, "\xe1\x84\x82"}, {3, "\xe1\x84\x83"}, {3, "\xe1\x85\xa6"}, {3, "\xe1\x84\x85"},
+                {3, "\xe1\x84\x87"}, {3, "\xe1\x84\x89"}, {3, "\xe1\x85\xb5"}, {3, "\xe1\x84\x90"}, {3, "\xe1\x84\x91"}, {3, "\xe1\x85\xa1"},
+                {3, "\xe1\x85\xa2"}, {3, "\xe1\x85\xa3"}, {3, "\xe1\x84\x8b"}, {3, "\xe1\x85\xa4"}, {3, "\xe1\x85\xa5"}, {3, "\xe1\x85\xa7"},
+                {3, "\xe1\x85\xa9"}, {3, "\xe1\x85\xb2"}, {3, "\xe1\x85\xb4"}, {3, "\xe1\x84\x8c"}, {3, "\xe1\x84\x8e"}, {3, "\xe1\x84\x8f"},
+                {3, "\xe1\x85\xad"}, {3, "\xe1\x85\xae"}, {1, "\x30"}, {1, "\x31"}, {1, "\x32"}, {1, "\x33"},
+                {1, "\x34"}, {1, "\x35"}, {1, "\x36"}, {1, "\x37"}, {1, "\x38"}, {1, "\x39"},
+        },
+        { // Burmese
+                {3, "\xe1\x80\x85"}, {3, "\xe1\x80\x80"}, {3, "\xe1\x80\x81"}, {3, "\xe1\x80\x82"}, {3, "\xe1\x80\x93"}, {3, "\xe1\x80\x83"},
+                {3, "\xe1\x80\x84"}, {3, "\xe1\x80\x9a"}, {1, "\x49"}, {3, "\xe1\x80\x87"}, {3, "\xe1\x80\x8c"}, {3, "\xe1\x80\x8d"},
+                {3, "\xe1\x80\x8e"}, {3, "\xe1\x80\x90"}, {3, "\xe1\x80\x9d"}, {3, "\xe1\x80\x91"}, {3, "\xe1\x80\x92"}, {3, "\xe1\x80\x9e"},
+                {3, "\xe1\x80\x94"}, {3, "\xe1\x80\x95"}, {3, "\xe1\x80\x96"}, {3, "\xe1\x80\x9f"}, {3, "\xe1\x80\x97"}, {3, "\xe1\x80\x98"},
+                {3, "\xe1\x80\x8f"}, {3, "\xe1\x80\x9c"}, {3, "\xe1\x81\x80"}, {3, "\xe1\x81\x81"}, {3, "\xe1\x81\x82"}, {3, "\xe1\x81\x83"},
+                {3, "\xe1\x81\x84"}, {3, "\xe1\x81\x85"}, {3, "\xe1\x81\x86"}, {3, "\xe1\x81\x87"}, {3, "\xe1\x81\x88"}, {3, "\xe1\x81\x89"},
+        },
+        { // Khmer
+                {3, "\xe1\x9e\x89"}, {3, "\xe1\x9e\x80"}, {3, "\xe1\x9e\x81"}, {3, "\xe1\x9e\x82"}, {3, "\xe1\x9e\x85"}, {3, "\xe1\x9e\x83"},
+                {3, "\xe1\x9e\x84"}, {3, "\xe1\x9e\x87"}, {3, "\xe1\x9e\x9a"}, {3, "\xe1\x9e\x88"}, {3, "\xe1\x9e\x8a"}, {3, "\xe1\x9e\x8c"},
+                {3, "\xe1\x9e\x8d"}, {3, "\xe1\x9e\x8e"}, {1, "\x4f"}, {3, "\xe1\x9e\x91"}, {3, "\xe1\x9e\x92"}, {3, "\xe1\x9e\x93"},
+                {3, "\xe1\x9e\x94"}, {3, "\xe1\x9e\x95"}, {3, "\xe1\x9e\x9f"}, {3, "\xe1\x9e\x96"}, {3, "\xe1\x9e\x98"}, {3, "\xe1\x9e\x9b"},
+                {3, "\xe1\x9e\xa0"}, {3, "\xe1\x9e\xa2"}, {3, "\xe1\x9f\xa0"}, {3, "\xe1\x9f\xa1"}, {3, "\xe1\x9f\xa2"}, {3, "\xe1\x9f\xa3"},
+                {3, "\xe1\x9f\xa4"}, {3, "\xe1\x9f\xa5"}, {3, "\xe1\x9f\xa6"}, {3, "\xe1\x9f\xa7"}, {3, "\xe1\x9f\xa8"}, {3, "\xe1\x9f\xa9"},
+        },
+        { // Sinhalese
+                {3, "\xe0\xb6\x85"}, {3, "\xe0\xb6\x9a"}, {3, "\xe0\xb6\x9c"}, {3, "\xe0\xb6\x9f"}, {3, "\xe0\xb6\x89"}, {3, "\xe0\xb6\xa2"},
+                {3, "\xe0\xb6\xa7"}, {3, "\xe0\xb6\xa9"}, {1, "\x49"}, {3, "\xe0\xb6\xac"}, {3, "\xe0\xb6\xad"}, {3, "\xe0\xb6\xaf"},
+                {3, "\xe0\xb6\xb1"}, {3, "\xe0\xb6\xb3"}, {1, "\x4f"}, {3, "\xe0\xb6\xb4"}, {3, "\xe0\xb6\xb6"}, {3, "\xe0\xb6\xb8"},
+                {3, "\xe0\xb6\xb9"}, {3, "\xe0\xb6\xba"}, {3, "\xe0\xb6\x8b"}, {3, "\xe0\xb6\xbb"}, {3, "\xe0\xb6\xbd"}, {3, "\xe0\xb7\x80"},
+                {3, "\xe0\xb7\x83"}, {3, "\xe0\xb7\x84"}, {1, "\x30"}, {1, "\x31"}, {1, "\x32"}, {1, "\x33"},
+                {1, "\x34"}, {1, "\x35"}, {1, "\x36"}, {1, "\x37"}, {1, "\x38"}, {1, "\x39"},
+        },
+        { // Thaana
+                {2, "\xde\x94"}, {2, "\xde\x80"}, {2, "\xde\x81"}, {2, "\xde\x82"}, {2, "\xde\x97"}, {2, "\xde\x83"},
+                {2, "\xde\x84"}, {2, "\xde\x85"}, {1, "\x49"}, {2, "\xde\x86"}, {2, "\xde\x87"}, {2, "\xde\x88"},
+                {2, "\xde\x89"}, {2, "\xde\x8a"}, {1, "\x4f"}, {2, "\xde\x8b"}, {2, "\xde\x8c"}, {2, "\xde\x8d"},
+                {2, "\xde\x8e"}, {2, "\xde\x8f"}, {2, "\xde\x9c"}, {2, "\xde\x90"}, {2, "\xde\x91"}, {2, "\xde\x92"},
+                {2, "\xde\x93"}, {2, "\xde\xb1"}, {1, "\x30"}, {1, "\x31"}, {1, "\x32"}, {1, "\x33"},
+                {1, "\x34"}, {1, "\x35"}, {1, "\x36"}, {1, "\x37"}, {1, "\x38"}, {1, "\x39"},
+        },
+        { // Chinese
+                {3, "\xe3\x84\xa3"}, {3, "\xe3\x84\x85"}, {3, "\xe3\x84\x88"}, {3, "\xe3\x84\x86"}, {3, "\xe3\x84\x94"}, {3, "\xe3\x84\x87"},
+                {3, "\xe3\x84\x89"}, {3, "\xe3\x84\x8a"}, {1, "\x49"}, {3, "\xe3\x84\x8b"}, {3, "\xe3\x84\x8c"}, {3, "\xe3\x84\x8d"},
+                {3, "\xe3\x84\x8e"}, {3, "\xe3\x84\x8f"}, {1, "\x4f"}, {3, "\xe3\x84\x95"}, {3, "\xe3\x84\x96"}, {3, "\xe3\x84\x90"},
+                {3, "\xe3\x84\x91"}, {3, "\xe3\x84\x92"}, {3, "\xe3\x84\x93"}, {3, "\xe3\x84\xa9"}, {3, "\xe3\x84\x97"}, {3, "\xe3\x84\xa8"},
+                {3, "\xe3\x84\x98"}, {3, "\xe3\x84\x99"}, {1, "\x30"}, {1, "\x31"}, {1, "\x32"}, {1, "\x33"},
+                {1, "\x34"}, {1, "\x35"}, {1, "\x36"}, {1, "\x37"}, {1, "\x38"}, {1, "\x39"},
+        },
+        { // Tifinagh (BERBER)
+                {3, "\xe2\xb5\x89"}, {3, "\xe2\xb4\xb1"}, {3, "\xe2\xb4\xb3"}, {3, "\xe2\xb4\xb7"}, {3, "\xe2\xb5\x93"}, {3, "\xe2\xb4\xbc"},
+                {3, "\xe2\xb4\xbd"}, {3, "\xe2\xb5\x80"}, {3, "\xe2\xb5\x8f"}, {3, "\xe2\xb5\x83"}, {3, "\xe2\xb5\x84"}, {3, "\xe2\xb5\x85"},
+                {3, "\xe2\xb5\x87"}, {3, "\xe2\xb5\x8d"}, {3, "\xe2\xb5\x94"}, {3, "\xe2\xb5\x8e"}, {3, "\xe2\xb5\x95"}, {3, "\xe2\xb5\x96"},
+                {3, "\xe2\xb5\x99"}, {3, "\xe2\xb5\x9a"}, {3, "\xe2\xb5\xa2"}, {3, "\xe2\xb5\x9b"}, {3, "\xe2\xb5\x9c"}, {3, "\xe2\xb5\x9f"},
+                {3, "\xe2\xb5\xa1"}, {3, "\xe2\xb5\xa3"}, {1, "\x30"}, {1, "\x31"}, {1, "\x32"}, {1, "\x33"},
+                {1, "\x34"}, {1, "\x35"}, {1, "\x36"}, {1, "\x37"}, {1, "\x38"}, {1, "\x39"},
+        },
+        { // Tamil (digits 0xBE6-0xBEF)
+                {3, "\xe0\xae\x99"}, {3, "\xe0\xae\x95"}, {3, "\xe0\xae\x9a"}, {3, "\xe0\xae\x9f"}, {3, "\xe0\xae\x86"}, {3, "\xe0\xae\xa4"},
+                {3, "\xe0\xae\xa8"}, {3, "\xe0\xae\xaa"}, {1, "\x49"}, {3, "\xe0\xae\xae"}, {3, "\xe0\xae\xaf"}, {3, "\xe0\xae\xb0"},
+                {3, "\xe0\xae\xb2"}, {3, "\xe0\xae\xb5"}, {1, "\x4f"}, {3, "\xe0\xae\xb4"}, {3, "\xe0\xae\xb3"}, {3, "\xe0\xae\xb1"},
+                {3, "\xe0\xae\x85"}, {3, "\xe0\xae\x88"}, {3, "\xe0\xae\x93"}, {3, "\xe0\xae\x89"}, {3, "\xe0\xae\x8e"}, {3, "\xe0\xae\x8f"},
+                {3, "\xe0\xae\x90"}, {3, "\xe0\xae\x92"}, {1, "\x30"}, {1, "\x31"}, {1, "\x32"}, {1, "\x33"},
+                {1, "\x34"}, {1, "\x35"}, {1, "\x36"}, {1, "\x37"}, {1, "\x38"}, {1, "\x39"},
+        },
+        { // Amharic (digits 1372|1369-1371)
+                {3, "\xe1\x88\x9b"}, {3, "\xe1\x89\xa0"}, {3, "\xe1\x89\xa4"}, {3, "\xe1\x8b\xb0"}, {3, "\xe1\x88\x9e"}, {3, "\xe1\x8d\x8a"},
+                {3, "\xe1\x8c\x88"}, {3, "\xe1\x88\x80"}, {1, "\x49"}, {3, "\xe1\x8b\xa8"}, {3, "\xe1\x8a\xac"}, {3, "\xe1\x88\x88"},
+                {3, "\xe1\x8a\x93"}, {3, "\xe1\x8d\x90"}, {3, "\xe1\x8b\x90"}, {3, "\xe1\x8d\x94"}, {3, "\xe1\x89\x80"}, {3, "\xe1\x89\x84"},
+                {3, "\xe1\x88\xac"}, {3, "\xe1\x88\xa0"}, {3, "\xe1\x8b\x88"}, {3, "\xe1\x88\xa6"}, {3, "\xe1\x89\xb0"}, {3, "\xe1\x89\xb6"},
+                {3, "\xe1\x8c\xb8"}, {3, "\xe1\x8b\x9c"}, {3, "\xe1\x8d\xb2"}, {3, "\xe1\x8d\xa9"}, {3, "\xe1\x8d\xaa"}, {3, "\xe1\x8d\xab"},
+                {3, "\xe1\x8d\xac"}, {3, "\xe1\x8d\xad"}, {3, "\xe1\x8d\xae"}, {3, "\xe1\x8d\xaf"}, {3, "\xe1\x8d\xb0"}, {3, "\xe1\x8d\xb1"},
+        },
+        { // Telugu
+                {3, "\xe0\xb0\x9e"}, {3, "\xe0\xb0\x95"}, {3, "\xe0\xb0\x97"}, {3, "\xe0\xb0\x99"}, {3, "\xe0\xb0\xab"}, {3, "\xe0\xb0\x9a"},
+                {3, "\xe0\xb0\x9c"}, {3, "\xe0\xb0\x9f"}, {1, "\x49"}, {3, "\xe0\xb0\xa0"}, {3, "\xe0\xb0\xa1"}, {3, "\xe0\xb0\xa3"},
+                {3, "\xe0\xb0\xa4"}, {3, "\xe0\xb0\xa5"}, {1, "\x4f"}, {3, "\xe0\xb0\xa6"}, {3, "\xe0\xb0\xa7"}, {3, "\xe0\xb0\xa8"},
+                {3, "\xe0\xb0\xaa"}, {3, "\xe0\xb0\xac"}, {3, "\xe0\xb0\xad"}, {3, "\xe0\xb0\xae"}, {3, "\xe0\xb0\xb0"}, {3, "\xe0\xb0\xb2"},
+                {3, "\xe0\xb0\xb3"}, {3, "\xe0\xb0\xb5"}, {1, "\x30"}, {1, "\x31"}, {1, "\x32"}, {1, "\x33"},
+                {1, "\x34"}, {1, "\x35"}, {1, "\x36"}, {1, "\x37"}, {1, "\x38"}, {1, "\x39"},
+        },
+        { // Odia
+                {3, "\xe0\xac\x9d"}, {3, "\xe0\xac\x95"}, {3, "\xe0\xac\x96"}, {3, "\xe0\xac\x97"}, {3, "\xe0\xac\xa3"}, {3, "\xe0\xac\x98"},
+                {3, "\xe0\xac\x9a"}, {3, "\xe0\xac\x9c"}, {1, "\x49"}, {3, "\xe0\xac\x9f"}, {3, "\xe0\xac\xa1"}, {3, "\xe0\xac\xa2"},
+                {3, "\xe0\xac\xa4"}, {3, "\xe0\xac\xa5"}, {3, "\xe0\xac\xa0"}, {3, "\xe0\xac\xa6"}, {3, "\xe0\xac\xa7"}, {3, "\xe0\xac\xa8"},
+                {3, "\xe0\xac\xaa"}, {3, "\xe0\xac\xac"}, {3, "\xe0\xac\xb9"}, {3, "\xe0\xac\xae"}, {3, "\xe0\xac\xaf"}, {3, "\xe0\xac\xb0"},
+                {3, "\xe0\xac\xb3"}, {3, "\xe0\xac\xb8"}, {1, "\x30"}, {1, "\x31"}, {1, "\x32"}, {1, "\x33"},
+                {1, "\x34"}, {1, "\x35"}, {1, "\x36"}, {1, "\x37"}, {1, "\x38"}, {1, "\x39"},
+        },
+        { // Kannada
+                {3, "\xe0\xb2\x92"}, {3, "\xe0\xb2\x95"}, {3, "\xe0\xb2\x96"}, {3, "\xe0\xb2\x97"}, {3, "\xe0\xb2\x8e"}, {3, "\xe0\xb2\x99"},
+                {3, "\xe0\xb2\x9a"}, {3, "\xe0\xb2\x9b"}, {1, "\x49"}, {3, "\xe0\xb2\x9c"}, {3, "\xe0\xb2\xa0"}, {3, "\xe0\xb2\xa1"},
+                {3, "\xe0\xb2\xa3"}, {3, "\xe0\xb2\xa4"}, {1, "\x4f"}, {3, "\xe0\xb2\xa6"}, {3, "\xe0\xb2\xa7"}, {3, "\xe0\xb2\xa8"},
+                {3, "\xe0\xb2\xaa"}, {3, "\xe0\xb2\xab"}, {3, "\xe0\xb2\x87"}, {3, "\xe0\xb2\xac"}, {3, "\xe0\xb2\xad"}, {3, "\xe0\xb2\xb0"},
+                {3, "\xe0\xb2\xb2"}, {3, "\xe0\xb2\xb5"}, {1, "\x30"}, {1, "\x31"}, {1, "\x32"}, {1, "\x33"},
+                {1, "\x34"}, {1, "\x35"}, {1, "\x36"}, {1, "\x37"}, {1, "\x38"}, {1, "\x39"},
+        },
+        { // Gujarati
+                {3, "\xe0\xaa\xb3"}, {3, "\xe0\xaa\x97"}, {3, "\xe0\xaa\x9c"}, {3, "\xe0\xaa\xa1"}, {3, "\xe0\xaa\x87"}, {3, "\xe0\xaa\xa6"},
+                {3, "\xe0\xaa\xac"}, {3, "\xe0\xaa\x95"}, {1, "\x49"}, {3, "\xe0\xaa\x9a"}, {3, "\xe0\xaa\x9f"}, {3, "\xe0\xaa\xa4"},
+                {3, "\xe0\xaa\xaa"}, {3, "\xe0\xaa\xa0"}, {1, "\x4f"}, {3, "\xe0\xaa\xb0"}, {3, "\xe0\xaa\xb5"}, {3, "\xe0\xaa\x9e"},
+                {3, "\xe0\xaa\xae"}, {3, "\xe0\xaa\xab"}, {3, "\xe0\xaa\x89"}, {3, "\xe0\xaa\xb7"}, {3, "\xe0\xaa\xa8"}, {3, "\xe0\xaa\x9d"},
+                {3, "\xe0\xaa\xa2"}, {3, "\xe0\xaa\xad"}, {1, "\x30"}, {1, "\x31"}, {1, "\x32"}, {1, "\x33"},
+                {1, "\x34"}, {1, "\x35"}, {1, "\x36"}, {1, "\x37"}, {1, "\x38"}, {1, "\x39"},
+        },
+};
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // __INTERNAL_ALPHABET_UTF8_H__
@@ -0,0 +1,311 @@
+/*
+ * Copyright (C) 2014-2019 Stichting Mapcode Foundation (http://www.mapcode.com)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __INTERNAL_HOT_DECODERS_H__
+#define __INTERNAL_HOT_DECODERS_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// *** GENERATED FILE (tools/generate_hot_territories.py), DO NOT CHANGE OR PRETTIFY ***
+
+#define HOT_TERRITORIES_DATA_VERSION "2.3.0"
+
+#if MAPCODE_BOUNDARY_MAX != 16356
+#error "internal_hot_decoders.h does not match internal_data.h: run tools/generate_hot_territories.py"
+#endif
+
+// decodes in grid record m of a hot territory (see decodeGrid) into *err; returns 0 if m is not such a record
+static int decodeHotGrid(enum MapcodeError *err, DecodeRec *dec, const int m, const int hasHeaderLetter) {
+    switch (m) {
+#if !defined(MAPCODE_SELECT_HOT_TERRITORIES) || defined(MAPCODE_HOT_TERRITORY_NLD)
+        case 1273:
+            *err = decodeGridInBoundary(dec, &TERRITORY_BOUNDARIES[1273], hasHeaderLetter);
+            return 1;
+        case 1307:
+            *err = decodeGridInBoundary(dec, &TERRITORY_BOUNDARIES[1307], hasHeaderLetter);
+            return 1;
+        case 1308:
+            *err = decodeGridInBoundary(dec, &TERRITORY_BOUNDARIES[1308], hasHeaderLetter);
+            return 1;
+        case 1309:
+            *err = decodeGridInBoundary(dec, &TERRITORY_BOUNDARIES[1309], hasHeaderLetter);
+            return 1;
+        case 1310:
+            *err = decodeGridInBoundary(dec, &TERRITORY_BOUNDARIES[1310], hasHeaderLetter);
+            return 1;
+        case 1311:
+            *err = decodeGridInBoundary(dec, &TERRITORY_BOUNDARIES[1311], hasHeaderLetter);
+            return 1;
+        case 1312:
+            *err = decodeGridInBoundary(dec, &TERRITORY_BOUNDARIES[1312], hasHeaderLetter);
+            return 1;
+        case 1313:
+            *err = decodeGridInBoundary(dec, &TERRITORY_BOUNDARIES[1313], hasHeaderLetter);
+            return 1;
+        case 1314:
+            *err = decodeGridInBoundary(dec, &TERRITORY_BOUNDARIES[1314], hasHeaderLetter);
+            return 1;
+        case 1315:
+            *err = decodeGridInBoundary(dec, &TERRITORY_BOUNDARIES[1315], hasHeaderLetter);
+            return 1;
+        case 1316:
+            *err = decodeGridInBoundary(dec, &TERRITORY_BOUNDARIES[1316], hasHeaderLetter);
+            return 1;
+        case 1317:
+            *err = decodeGridInBoundary(dec, &TERRITORY_BOUNDARIES[1317], hasHeaderLetter);
+            return 1;
+        case 1318:
+            *err = decodeGridInBoundary(dec, &TERRITORY_BOUNDARIES[1318], hasHeaderLetter);
+            return 1;
+        case 1319:
+            *err = decodeGridInBoundary(dec, &TERRITORY_BOUNDARIES[1319], hasHeaderLetter);
+            return 1;
+        case 1320:
+            *err = decodeGridInBoundary(dec, &TERRITORY_BOUNDARIES[1320], hasHeaderLetter);
+            return 1;
+        case 1321:
+            *err = decodeGridInBoundary(dec, &TERRITORY_BOUNDARIES[1321], hasHeaderLetter);
+            return 1;
+        case 1322:
+            *err = decodeGridInBoundary(dec, &TERRITORY_BOUNDARIES[1322], hasHeaderLetter);
+            return 1;
+        case 1323:
+            *err = decodeGridInBoundary(dec, &TERRITORY_BOUNDARIES[1323], hasHeaderLetter);
+            return 1;
+        case 1324:
+            *err = decodeGridInBoundary(dec, &TERRITORY_BOUNDARIES[1324], hasHeaderLetter);
+            return 1;
+        case 1325:
+            *err = decodeGridInBoundary(dec, &TERRITORY_BOUNDARIES[1325], hasHeaderLetter);
+            return 1;
+        case 1326:
+            *err = decodeGridInBoundary(dec, &TERRITORY_BOUNDARIES[1326], hasHeaderLetter);
+            return 1;
+        case 1327:
+            *err = decodeGridInBoundary(dec, &TERRITORY_BOUNDARIES[1327], hasHeaderLetter);
+            return 1;
+        case 1328:
+            *err = decodeGridInBoundary(dec, &TERRITORY_BOUNDARIES[1328], hasHeaderLetter);
+            return 1;
+        case 1329:
+            *err = decodeGridInBoundary(dec, &TERRITORY_BOUNDARIES[1329], hasHeaderLetter);
+            return 1;
+        case 1330:
+            *err = decodeGridInBoundary(dec, &TERRITORY_BOUNDARIES[1330], hasHeaderLetter);
+            return 1;
+        case 1331:
+            *err = decodeGridInBoundary(dec, &TERRITORY_BOUNDARIES[1331], hasHeaderLetter);
+            return 1;
+        case 1332:
+            *err = decodeGridInBoundary(dec, &TERRITORY_BOUNDARIES[1332], hasHeaderLetter);
+            return 1;
+        case 1333:
+            *err = decodeGridInBoundary(dec, &TERRITORY_BOUNDARIES[1333], hasHeaderLetter);
+            return 1;
+        case 1334:
+            *err = decodeGridInBoundary(dec, &TERRITORY_BOUNDARIES[1334], hasHeaderLetter);
+            return 1;
+        case 1335:
+            *err = decodeGridInBoundary(dec, &TERRITORY_BOUNDARIES[1335], hasHeaderLetter);
+            return 1;
+#endif
+#if !defined(MAPCODE_SELECT_HOT_TERRITORIES) || defined(MAPCODE_HOT_TERRITORY_USA)
+        case 14371:
+            *err = decodeGridInBoundary(dec, &TERRITORY_BOUNDARIES[14371], hasHeaderLetter);
+            return 1;
+#endif
+#if !defined(MAPCODE_SELECT_HOT_TERRITORIES) || defined(MAPCODE_HOT_TERRITORY_IND)
+        case 14313:
+            *err = decodeGridInBoundary(dec, &TERRITORY_BOUNDARIES[14313], hasHeaderLetter);
+            return 1;
+        case 14314:
+            *err = decodeGridInBoundary(dec, &TERRITORY_BOUNDARIES[14314], hasHeaderLetter);
+            return 1;
+        case 14315:
+            *err = decodeGridInBoundary(dec, &TERRITORY_BOUNDARIES[14315], hasHeaderLetter);
+            return 1;
+        case 14316:
+            *err = decodeGridInBoundary(dec, &TERRITORY_BOUNDARIES[14316], hasHeaderLetter);
+            return 1;
+        case 14317:
+            *err = decodeGridInBoundary(dec, &TERRITORY_BOUNDARIES[14317], hasHeaderLetter);
+            return 1;
+        case 14318:
+            *err = decodeGridInBoundary(dec, &TERRITORY_BOUNDARIES[14318], hasHeaderLetter);
+            return 1;
+        case 14319:
+            *err = decodeGridInBoundary(dec, &TERRITORY_BOUNDARIES[14319], hasHeaderLetter);
+            return 1;
+        case 14320:
+            *err = decodeGridInBoundary(dec, &TERRITORY_BOUNDARIES[14320], hasHeaderLetter);
+            return 1;
+        case 14321:
+            *err = decodeGridInBoundary(dec, &TERRITORY_BOUNDARIES[14321], hasHeaderLetter);
+            return 1;
+        case 14322:
+            *err = decodeGridInBoundary(dec, &TERRITORY_BOUNDARIES[14322], hasHeaderLetter);
+            return 1;
+        case 14323:
+            *err = decodeGridInBoundary(dec, &TERRITORY_BOUNDARIES[14323], hasHeaderLetter);
+            return 1;
+        case 14324:
+            *err = decodeGridInBoundary(dec, &TERRITORY_BOUNDARIES[14324], hasHeaderLetter);
+            return 1;
+        case 14325:
+            *err = decodeGridInBoundary(dec, &TERRITORY_BOUNDARIES[14325], hasHeaderLetter);
+            return 1;
+        case 14326:
+            *err = decodeGridInBoundary(dec, &TERRITORY_BOUNDARIES[14326], hasHeaderLetter);
+            return 1;
+        case 14327:
+            *err = decodeGridInBoundary(dec, &TERRITORY_BOUNDARIES[14327], hasHeaderLetter);
+            return 1;
+        case 14328:
+            *err = decodeGridInBoundary(dec, &TERRITORY_BOUNDARIES[14328], hasHeaderLetter);
+            return 1;
+        case 14329:
+            *err = decodeGridInBoundary(dec, &TERRITORY_BOUNDARIES[14329], hasHeaderLetter);
+            return 1;
+        case 14330:
+            *err = decodeGridInBoundary(dec, &TERRITORY_BOUNDARIES[14330], hasHeaderLetter);
+            return 1;
+        case 14331:
+            *err = decodeGridInBoundary(dec, &TERRITORY_BOUNDARIES[14331], hasHeaderLetter);
+            return 1;
+        case 14332:
+            *err = decodeGridInBoundary(dec, &TERRITORY_BOUNDARIES[14332], hasHeaderLetter);
+            return 1;
+        case 14333:
+            *err = decodeGridInBoundary(dec, &TERRITORY_BOUNDARIES[14333], hasHeaderLetter);
+            return 1;
+        case 14334:
+            *err = decodeGridInBoundary(dec, &TERRITORY_BOUNDARIES[14334], hasHeaderLetter);
+            return 1;
+        case 14335:
+            *err = decodeGridInBoundary(dec, &TERRITORY_BOUNDARIES[14335], hasHeaderLetter);
+            return 1;
+        case 14336:
+            *err = decodeGridInBoundary(dec, &TERRITORY_BOUNDARIES[14336], hasHeaderLetter);
+            return 1;
+        case 14337:
+            *err = decodeGridInBoundary(dec, &TERRITORY_BOUNDARIES[14337], hasHeaderLetter);
+            return 1;
+        case 14338:
+            *err = decodeGridInBoundary(dec, &TERRITORY_BOUNDARIES[14338], hasHeaderLetter);
+            return 1;
+        case 14339:
+            *err = decodeGridInBoundary(dec, &TERRITORY_BOUNDARIES[14339], hasHeaderLetter);
+            return 1;
+        case 14340:
+            *err = decodeGridInBoundary(dec, &TERRITORY_BOUNDARIES[14340], hasHeaderLetter);
+            return 1;
+        case 14341:
+            *err = decodeGridInBoundary(dec, &TERRITORY_BOUNDARIES[14341], hasHeaderLetter);
+            return 1;
+        case 14342:
+            *err = decodeGridInBoundary(dec, &TERRITORY_BOUNDARIES[14342], hasHeaderLetter);
+            return 1;
+        case 14343:
+            *err = decodeGridInBoundary(dec, &TERRITORY_BOUNDARIES[14343], hasHeaderLetter);
+            return 1;
+        case 14344:
+            *err = decodeGridInBoundary(dec, &TERRITORY_BOUNDARIES[14344], hasHeaderLetter);
+            return 1;
+        case 14345:
+            *err = decodeGridInBoundary(dec, &TERRITORY_BOUNDARIES[14345], hasHeaderLetter);
+            return 1;
+        case 14346:
+            *err = decodeGridInBoundary(dec, &TERRITORY_BOUNDARIES[14346], hasHeaderLetter);
+            return 1;
+        case 14347:
+            *err = decodeGridInBoundary(dec, &TERRITORY_BOUNDARIES[14347], hasHeaderLetter);
+            return 1;
+        case 14348:
+            *err = decodeGridInBoundary(dec, &TERRITORY_BOUNDARIES[14348], hasHeaderLetter);
+            return 1;
+        case 14349:
+            *err = decodeGridInBoundary(dec, &TERRITORY_BOUNDARIES[14349], hasHeaderLetter);
+            return 1;
+        case 14350:
+            *err = decodeGridInBoundary(dec, &TERRITORY_BOUNDARIES[14350], hasHeaderLetter);
+            return 1;
+        case 14351:
+            *err = decodeGridInBoundary(dec, &TERRITORY_BOUNDARIES[14351], hasHeaderLetter);
+            return 1;
+        case 14352:
+            *err = decodeGridInBoundary(dec, &TERRITORY_BOUNDARIES[14352], hasHeaderLetter);
+            return 1;
+        case 14353:
+            *err = decodeGridInBoundary(dec, &TERRITORY_BOUNDARIES[14353], hasHeaderLetter);
+            return 1;
+        case 14354:
+            *err = decodeGridInBoundary(dec, &TERRITORY_BOUNDARIES[14354], hasHeaderLetter);
+            return 1;
+        case 14355:
+            *err = decodeGridInBoundary(dec, &TERRITORY_BOUNDARIES[14355], hasHeaderLetter);
+            return 1;
+        case 14356:
+            *err = decodeGridInBoundary(dec, &TERRITORY_BOUNDARIES[14356], hasHeaderLetter);
+            return 1;
+        case 14357:
+            *err = decodeGridInBoundary(dec, &TERRITORY_BOUNDARIES[14357], hasHeaderLetter);
+            return 1;
+        case 14358:
+            *err = decodeGridInBoundary(dec, &TERRITORY_BOUNDARIES[14358], hasHeaderLetter);
+            return 1;
+        case 14359:
+            *err = decodeGridInBoundary(dec, &TERRITORY_BOUNDARIES[14359], hasHeaderLetter);
+            return 1;
+        case 14360:
+            *err = decodeGridInBoundary(dec, &TERRITORY_BOUNDARIES[14360], hasHeaderLetter);
+            return 1;
+        case 14361:
+            *err = decodeGridInBoundary(dec, &TERRITORY_BOUNDARIES[14361], hasHeaderLetter);
+            return 1;
+        case 14362:
+            *err = decodeGridInBoundary(dec, &TERRITORY_BOUNDARIES[14362], hasHeaderLetter);
+            return 1;
+        case 14363:
+            *err = decodeGridInBoundary(dec, &TERRITORY_BOUNDARIES[14363], hasHeaderLetter);
+            return 1;
+        case 14364:
+            *err = decodeGridInBoundary(dec, &TERRITORY_BOUNDARIES[14364], hasHeaderLetter);
+            return 1;
+        case 14365:
+            *err = decodeGridInBoundary(dec, &TERRITORY_BOUNDARIES[14365], hasHeaderLetter);
+            return 1;
+        case 14366:
+            *err = decodeGridInBoundary(dec, &TERRITORY_BOUNDARIES[14366], hasHeaderLetter);
+            return 1;
+        case 14367:
+            *err = decodeGridInBoundary(dec, &TERRITORY_BOUNDARIES[14367], hasHeaderLetter);
+            return 1;
+        case 14368:
+            *err = decodeGridInBoundary(dec, &TERRITORY_BOUNDARIES[14368], hasHeaderLetter);
+            return 1;
+#endif
+        default:
+            return 0;
+    }
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // __INTERNAL_HOT_DECODERS_H__
@@ -0,0 +1,977 @@
+/*
+ * Copyright (C) 2014-2019 Stichting Mapcode Foundation (http://www.mapcode.com)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __INTERNAL_HOT_ENCODERS_H__
+#define __INTERNAL_HOT_ENCODERS_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// *** GENERATED FILE (tools/generate_hot_territories.py), DO NOT CHANGE OR PRETTIFY ***
+
+#define HOT_TERRITORIES_DATA_VERSION "2.3.0"
+
+#if MAPCODE_BOUNDARY_MAX != 16356
+#error "internal_hot_encoders.h does not match internal_data.h: run tools/generate_hot_territories.py"
+#endif
+
+// returns nonzero if territory ccode, of which the records start at from, is a hot territory
+static int isHotTerritory(const enum Territory ccode, const int from) {
+    switch (ccode) {
+#if !defined(MAPCODE_SELECT_HOT_TERRITORIES) || defined(MAPCODE_HOT_TERRITORY_NLD)
+        case TERRITORY_NLD:
+            return from == 1268;
+#endif
+#if !defined(MAPCODE_SELECT_HOT_TERRITORIES) || defined(MAPCODE_HOT_TERRITORY_USA)
+        case TERRITORY_USA:
+            return from == 14371;
+#endif
+#if !defined(MAPCODE_SELECT_HOT_TERRITORIES) || defined(MAPCODE_HOT_TERRITORY_IND)
+        case TERRITORY_IND:
+            return from == 14313;
+#endif
+        default:
+            return 0;
+    }
+}
+
+// returns the first record, from record m on, of a hot territory that contains coord32 (or its last record + 1)
+static int nextHotRecord(const Point32 *coord32, const int m) {
+    const int lat = coord32->latMicroDeg;
+    const int lon = coord32->lonMicroDeg;
+    switch (m) {
+#if !defined(MAPCODE_SELECT_HOT_TERRITORIES) || defined(MAPCODE_HOT_TERRITORY_NLD)
+        // NLD
+        case 1268:
+            if (52348840 <= lat && lat < 52387449 && isInRange(lon, 4865037, 4927562)) {
+                return 1268;
+            }
+            /* fall through */
+        case 1269:
+            if (51910740 <= lat && lat < 51949349 && isInRange(lon, 4448737, 4511262)) {
+                return 1269;
+            }
+            /* fall through */
+        case 1270:
+            if (52056640 <= lat && lat < 52095249 && isInRange(lon, 4276537, 4339062)) {
+                return 1270;
+            }
+            /* fall through */
+        case 1271:
+            if (52080740 <= lat && lat < 52119349 && isInRange(lon, 5078737, 5141262)) {
+                return 1271;
+            }
+            /* fall through */
+        case 1272:
+            if (51420740 <= lat && lat < 51459349 && isInRange(lon, 5446459, 5508341)) {
+                return 1272;
+            }
+            /* fall through */
+        case 1273:
+            if (52041272 <= lat && lat < 52532312 && isInRange(lon, 4557401, 5312561)) {
+                return 1273;
+            }
+            /* fall through */
+        case 1274:
+            if (52168200 <= lat && lat < 52254689 && isInRange(lon, 6826868, 6966932)) {
+                return 1274;
+            }
+            /* fall through */
+        case 1275:
+            if (51925200 <= lat && lat < 52011689 && isInRange(lon, 5839968, 5980032)) {
+                return 1275;
+            }
+            /* fall through */
+        case 1276:
+            if (51545400 <= lat && lat < 51631889 && isInRange(lon, 4700688, 4839311)) {
+                return 1276;
+            }
+            /* fall through */
+        case 1277:
+            if (51875900 <= lat && lat < 51962389 && isInRange(lon, 4513588, 4652211)) {
+                return 1277;
+            }
+            /* fall through */
+        case 1278:
+            if (51969100 <= lat && lat < 52055589 && isInRange(lon, 4289968, 4430032)) {
+                return 1278;
+            }
+            /* fall through */
+        case 1279:
+            if (52121100 <= lat && lat < 52207589 && isInRange(lon, 5309968, 5450032)) {
+                return 1279;
+            }
+            /* fall through */
+        case 1280:
+            if (53169500 <= lat && lat < 53255989 && isInRange(lon, 6489666, 6633334)) {
+                return 1280;
+            }
+            /* fall through */
+        case 1281:
+            if (52036800 <= lat && lat < 52123289 && isInRange(lon, 4182268, 4322332)) {
+                return 1281;
+            }
+            /* fall through */
+        case 1282:
+            if (51656800 <= lat && lat < 51743289 && isInRange(lon, 5247588, 5386211)) {
+                return 1282;
+            }
+            /* fall through */
+        case 1283:
+            if (51774100 <= lat && lat < 51860589 && isInRange(lon, 4600688, 4739311)) {
+                return 1283;
+            }
+            /* fall through */
+        case 1284:
+            if (53153800 <= lat && lat < 53240289 && isInRange(lon, 5746466, 5890134)) {
+                return 1284;
+            }
+            /* fall through */
+        case 1285:
+            if (50815400 <= lat && lat < 50901889 && isInRange(lon, 5635750, 5771250)) {
+                return 1285;
+            }
+            /* fall through */
+        case 1286:
+            if (51779500 <= lat && lat < 51865989 && isInRange(lon, 5752988, 5891611)) {
+                return 1286;
+            }
+            /* fall through */
+        case 1287:
+            if (52159500 <= lat && lat < 52245989 && isInRange(lon, 5903768, 6043832)) {
+                return 1287;
+            }
+            /* fall through */
+        case 1288:
+            if (51896000 <= lat && lat < 51950000 && isInRange(lon, 4153920, 4375487)) {
+                return 1288;
+            }
+            /* fall through */
+        case 1289:
+            if (51867300 <= lat && lat < 51953789 && isInRange(lon, 4375288, 4513911)) {
+                return 1289;
+            }
+            /* fall through */
+        case 1290:
+            if (51806800 <= lat && lat < 51893289 && isInRange(lon, 4250688, 4389311)) {
+                return 1290;
+            }
+            /* fall through */
+        case 1291:
+            if (51509500 <= lat && lat < 51595989 && isInRange(lon, 4986888, 5125511)) {
+                return 1291;
+            }
+            /* fall through */
+        case 1292:
+            if (51405400 <= lat && lat < 51491889 && isInRange(lon, 5386888, 5525511)) {
+                return 1292;
+            }
+            /* fall through */
+        case 1293:
+            if (51952000 <= lat && lat < 52057000 && isInRange(lon, 5589668, 5704955)) {
+                return 1293;
+            }
+            /* fall through */
+        case 1294:
+            if (52055000 <= lat && lat < 52155000 && isInRange(lon, 4320000, 4440971)) {
+                return 1294;
+            }
+            /* fall through */
+        case 1295:
+            if (51996500 <= lat && lat < 52082989 && isInRange(lon, 4426868, 4566932)) {
+                return 1295;
+            }
+            /* fall through */
+        case 1296:
+            if (52126800 <= lat && lat < 52213289 && isInRange(lon, 4419968, 4560032)) {
+                return 1296;
+            }
+            /* fall through */
+        case 1297:
+            if (52459400 <= lat && lat < 52545889 && isInRange(lon, 6019127, 6160873)) {
+                return 1297;
+            }
+            /* fall through */
+        case 1298:
+            if (50947300 <= lat && lat < 51033789 && isInRange(lon, 5776629, 5913570)) {
+                return 1298;
+            }
+            /* fall through */
+        case 1299:
+            if (50866200 <= lat && lat < 50952689 && isInRange(lon, 5902829, 6039770)) {
+                return 1299;
+            }
+            /* fall through */
+        case 1300:
+            if (52609300 <= lat && lat < 52695789 && isInRange(lon, 4714627, 4856373)) {
+                return 1300;
+            }
+            /* fall through */
+        case 1301:
+            if (51338200 <= lat && lat < 51424689 && isInRange(lon, 6100829, 6237770)) {
+                return 1301;
+            }
+            /* fall through */
+        case 1302:
+            if (52206300 <= lat && lat < 52292789 && isInRange(lon, 6090168, 6230232)) {
+                return 1302;
+            }
+            /* fall through */
+        case 1303:
+            if (51454350 <= lat && lat < 51516449 && isInRange(lon, 5607434, 5706965)) {
+                return 1303;
+            }
+            /* fall through */
+        case 1304:
+            if (52243240 <= lat && lat < 52303359 && isInRange(lon, 6737320, 6834680)) {
+                return 1304;
+            }
+            /* fall through */
+        case 1305:
+            if (51500750 <= lat && lat < 51562849 && isInRange(lon, 4410634, 4510165)) {
+                return 1305;
+            }
+            /* fall through */
+        case 1306:
+            if (52324840 <= lat && lat < 52384959 && isInRange(lon, 6602720, 6700080)) {
+                return 1306;
+            }
+            /* fall through */
+        case 1307:
+            if (50743216 <= lat && lat < 51174240 && isInRange(lon, 5573755, 6219547)) {
+                return 1307;
+            }
+            /* fall through */
+        case 1308:
+            if (51174240 <= lat && lat < 51605264 && isInRange(lon, 5586670, 6237670)) {
+                return 1308;
+            }
+            /* fall through */
+        case 1309:
+            if (51174240 <= lat && lat < 51605264 && isInRange(lon, 4935670, 5586670)) {
+                return 1309;
+            }
+            /* fall through */
+        case 1310:
+            if (51174240 <= lat && lat < 51605264 && isInRange(lon, 4284670, 4935670)) {
+                return 1310;
+            }
+            /* fall through */
+        case 1311:
+            if (51174240 <= lat && lat < 51605264 && isInRange(lon, 3633670, 4284670)) {
+                return 1311;
+            }
+            /* fall through */
+        case 1312:
+            if (51174240 <= lat && lat < 51605264 && isInRange(lon, 2982670, 3633670)) {
+                return 1312;
+            }
+            /* fall through */
+        case 1313:
+            if (51605264 <= lat && lat < 52036288 && isInRange(lon, 6219442, 6875650)) {
+                return 1313;
+            }
+            /* fall through */
+        case 1314:
+            if (51605264 <= lat && lat < 52036288 && isInRange(lon, 5563234, 6219442)) {
+                return 1314;
+            }
+            /* fall through */
+        case 1315:
+            if (51605264 <= lat && lat < 52036288 && isInRange(lon, 4907026, 5563234)) {
+                return 1315;
+            }
+            /* fall through */
+        case 1316:
+            if (51605264 <= lat && lat < 52036288 && isInRange(lon, 4250818, 4907026)) {
+                return 1316;
+            }
+            /* fall through */
+        case 1317:
+            if (51605264 <= lat && lat < 52036288 && isInRange(lon, 3594610, 4250818)) {
+                return 1317;
+            }
+            /* fall through */
+        case 1318:
+            if (52036288 <= lat && lat < 52467312 && isInRange(lon, 6509528, 7176152)) {
+                return 1318;
+            }
+            /* fall through */
+        case 1319:
+            if (52036288 <= lat && lat < 52467312 && isInRange(lon, 5842904, 6509528)) {
+                return 1319;
+            }
+            /* fall through */
+        case 1320:
+            if (52036288 <= lat && lat < 52467312 && isInRange(lon, 5176280, 5842904)) {
+                return 1320;
+            }
+            /* fall through */
+        case 1321:
+            if (52036288 <= lat && lat < 52467312 && isInRange(lon, 4509656, 5176280)) {
+                return 1321;
+            }
+            /* fall through */
+        case 1322:
+            if (52036288 <= lat && lat < 52467312 && isInRange(lon, 3843032, 4509656)) {
+                return 1322;
+            }
+            /* fall through */
+        case 1323:
+            if (52467312 <= lat && lat < 52898336 && isInRange(lon, 6509528, 7181360)) {
+                return 1323;
+            }
+            /* fall through */
+        case 1324:
+            if (52467312 <= lat && lat < 52898336 && isInRange(lon, 5837696, 6509528)) {
+                return 1324;
+            }
+            /* fall through */
+        case 1325:
+            if (52467312 <= lat && lat < 52898336 && isInRange(lon, 5165864, 5837696)) {
+                return 1325;
+            }
+            /* fall through */
+        case 1326:
+            if (52467312 <= lat && lat < 52898336 && isInRange(lon, 4494032, 5165864)) {
+                return 1326;
+            }
+            /* fall through */
+        case 1327:
+            if (52898336 <= lat && lat < 53329360 && isInRange(lon, 6576711, 7248543)) {
+                return 1327;
+            }
+            /* fall through */
+        case 1328:
+            if (52898336 <= lat && lat < 53329360 && isInRange(lon, 5904879, 6576711)) {
+                return 1328;
+            }
+            /* fall through */
+        case 1329:
+            if (52898336 <= lat && lat < 53329360 && isInRange(lon, 5233047, 5904879)) {
+                return 1329;
+            }
+            /* fall through */
+        case 1330:
+            if (52898336 <= lat && lat < 53329360 && isInRange(lon, 4561215, 5233047)) {
+                return 1330;
+            }
+            /* fall through */
+        case 1331:
+            if (53125976 <= lat && lat < 53557000 && isInRange(lon, 6269179, 6951427)) {
+                return 1331;
+            }
+            /* fall through */
+        case 1332:
+            if (53125976 <= lat && lat < 53557000 && isInRange(lon, 5586931, 6269179)) {
+                return 1332;
+            }
+            /* fall through */
+        case 1333:
+            if (53125976 <= lat && lat < 53557000 && isInRange(lon, 4904683, 5586931)) {
+                return 1333;
+            }
+            /* fall through */
+        case 1334:
+            if (41310000 <= lat && lat < 53557000 && isInRange(lon, -5200000, 9600000)) {
+                return 1334;
+            }
+            /* fall through */
+        case 1335:
+            if (50747000 <= lat && lat < 53557000 && isInRange(lon, 3350000, 7236000)) {
+                return 1335;
+            }
+            return 1336;
+#endif
+#if !defined(MAPCODE_SELECT_HOT_TERRITORIES) || defined(MAPCODE_HOT_TERRITORY_USA)
+        // USA
+        case 14371:
+            if (17821000 <= lat && lat < 71425000 && isInRange(lon, 172300000, 295454000)) {
+                return 14371;
+            }
+            return 14372;
+#endif
+#if !defined(MAPCODE_SELECT_HOT_TERRITORIES) || defined(MAPCODE_HOT_TERRITORY_IND)
+        // IND
+        case 14313:
+            if (33864760 <= lat && lat < 37100000 && isInRange(lon, 72500000, 75000000)) {
+                return 14313;
+            }
+            /* fall through */
+        case 14314:
+            if (33864760 <= lat && lat < 37100000 && isInRange(lon, 75000000, 77500000)) {
+                return 14314;
+            }
+            /* fall through */
+        case 14315:
+            if (33864760 <= lat && lat < 36545950 && isInRange(lon, 77495479, 80500000)) {
+                return 14315;
+            }
+            /* fall through */
+        case 14316:
+            if (31183570 <= lat && lat < 33864760 && isInRange(lon, 73426660, 76554715)) {
+                return 14316;
+            }
+            /* fall through */
+        case 14317:
+            if (31183570 <= lat && lat < 33864760 && isInRange(lon, 76554715, 79682770)) {
+                return 14317;
+            }
+            /* fall through */
+        case 14318:
+            if (23188563 <= lat && lat < 25869753 && isInRange(lon, 82608667, 85498394)) {
+                return 14318;
+            }
+            /* fall through */
+        case 14319:
+            if (23188563 <= lat && lat < 25869753 && isInRange(lon, 85498394, 88388000)) {
+                return 14319;
+            }
+            /* fall through */
+        case 14320:
+            if (20507373 <= lat && lat < 23188563 && isInRange(lon, 82669712, 85529648)) {
+                return 14320;
+            }
+            /* fall through */
+        case 14321:
+            if (20507373 <= lat && lat < 23188563 && isInRange(lon, 85529648, 88388000)) {
+                return 14321;
+            }
+            /* fall through */
+        case 14322:
+            if (20507373 <= lat && lat < 25869753 && isInRange(lon, 88388000, 89100000)) {
+                return 14322;
+            }
+            /* fall through */
+        case 14323:
+            if (20507373 <= lat && lat < 23188563 && isInRange(lon, 68370032, 71229968)) {
+                return 14323;
+            }
+            /* fall through */
+        case 14324:
+            if (20507373 <= lat && lat < 23188563 && isInRange(lon, 71229968, 74089904)) {
+                return 14324;
+            }
+            /* fall through */
+        case 14325:
+            if (20507373 <= lat && lat < 23188563 && isInRange(lon, 74089904, 76949840)) {
+                return 14325;
+            }
+            /* fall through */
+        case 14326:
+            if (20507373 <= lat && lat < 23188563 && isInRange(lon, 76949840, 79809776)) {
+                return 14326;
+            }
+            /* fall through */
+        case 14327:
+            if (20507373 <= lat && lat < 23188563 && isInRange(lon, 79809776, 82669712)) {
+                return 14327;
+            }
+            /* fall through */
+        case 14328:
+            if (18094000 <= lat && lat < 20507373 && isInRange(lon, 72600000, 75500000)) {
+                return 14328;
+            }
+            /* fall through */
+        case 14329:
+            if (18094000 <= lat && lat < 20507373 && isInRange(lon, 75500000, 78400000)) {
+                return 14329;
+            }
+            /* fall through */
+        case 14330:
+            if (18094000 <= lat && lat < 20507373 && isInRange(lon, 78400000, 81300000)) {
+                return 14330;
+            }
+            /* fall through */
+        case 14331:
+            if (18094000 <= lat && lat < 20507373 && isInRange(lon, 81300000, 84200000)) {
+                return 14331;
+            }
+            /* fall through */
+        case 14332:
+            if (18094000 <= lat && lat < 20507373 && isInRange(lon, 84200000, 87100000)) {
+                return 14332;
+            }
+            /* fall through */
+        case 14333:
+            if (15547171 <= lat && lat < 18094000 && isInRange(lon, 72800000, 75600000)) {
+                return 14333;
+            }
+            /* fall through */
+        case 14334:
+            if (15547171 <= lat && lat < 18094000 && isInRange(lon, 75600000, 78400000)) {
+                return 14334;
+            }
+            /* fall through */
+        case 14335:
+            if (15547171 <= lat && lat < 18094000 && isInRange(lon, 78400000, 81200000)) {
+                return 14335;
+            }
+            /* fall through */
+        case 14336:
+            if (15547171 <= lat && lat < 18094000 && isInRange(lon, 81200000, 84000000)) {
+                return 14336;
+            }
+            /* fall through */
+        case 14337:
+            if (12865982 <= lat && lat < 15547172 && isInRange(lon, 73454123, 76194895)) {
+                return 14337;
+            }
+            /* fall through */
+        case 14338:
+            if (12865982 <= lat && lat < 15547172 && isInRange(lon, 76194895, 78935667)) {
+                return 14338;
+            }
+            /* fall through */
+        case 14339:
+            if (12865982 <= lat && lat < 15547172 && isInRange(lon, 78935667, 81676439)) {
+                return 14339;
+            }
+            /* fall through */
+        case 14340:
+            if (10640595 <= lat && lat < 12865982 && isInRange(lon, 74371790, 77520000)) {
+                return 14340;
+            }
+            /* fall through */
+        case 14341:
+            if (10640595 <= lat && lat < 12865982 && isInRange(lon, 77520000, 80668000)) {
+                return 14341;
+            }
+            /* fall through */
+        case 14342:
+            if (7959405 <= lat && lat < 10640595 && isInRange(lon, 74839405, 77520000)) {
+                return 14342;
+            }
+            /* fall through */
+        case 14343:
+            if (7959405 <= lat && lat < 10640595 && isInRange(lon, 77520000, 79915000)) {
+                return 14343;
+            }
+            /* fall through */
+        case 14344:
+            if (28502380 <= lat && lat < 31183570 && isInRange(lon, 72077876, 75124004)) {
+                return 14344;
+            }
+            /* fall through */
+        case 14345:
+            if (28502380 <= lat && lat < 31183570 && isInRange(lon, 75127726, 78166408)) {
+                return 14345;
+            }
+            /* fall through */
+        case 14346:
+            if (28502380 <= lat && lat < 31183570 && isInRange(lon, 78166408, 81205090)) {
+                return 14346;
+            }
+            /* fall through */
+        case 14347:
+            if (25869753 <= lat && lat < 28310000 && isInRange(lon, 69450000, 72100717)) {
+                return 14347;
+            }
+            /* fall through */
+        case 14348:
+            if (25869753 <= lat && lat < 28550943 && isInRange(lon, 72115613, 75064922)) {
+                return 14348;
+            }
+            /* fall through */
+        case 14349:
+            if (25869753 <= lat && lat < 28550943 && isInRange(lon, 75064922, 78014231)) {
+                return 14349;
+            }
+            /* fall through */
+        case 14350:
+            if (25869753 <= lat && lat < 28550943 && isInRange(lon, 78014231, 80963540)) {
+                return 14350;
+            }
+            /* fall through */
+        case 14351:
+            if (25869753 <= lat && lat < 28550943 && isInRange(lon, 80963540, 83912849)) {
+                return 14351;
+            }
+            /* fall through */
+        case 14352:
+            if (25869753 <= lat && lat < 28550943 && isInRange(lon, 83912849, 86862158)) {
+                return 14352;
+            }
+            /* fall through */
+        case 14353:
+            if (25869753 <= lat && lat < 28550943 && isInRange(lon, 86862158, 89811467)) {
+                return 14353;
+            }
+            /* fall through */
+        case 14354:
+            if (23188563 <= lat && lat < 25869753 && isInRange(lon, 68160032, 71049759)) {
+                return 14354;
+            }
+            /* fall through */
+        case 14355:
+            if (23188563 <= lat && lat < 25869753 && isInRange(lon, 71049759, 73939486)) {
+                return 14355;
+            }
+            /* fall through */
+        case 14356:
+            if (23188563 <= lat && lat < 25869753 && isInRange(lon, 73939486, 76829213)) {
+                return 14356;
+            }
+            /* fall through */
+        case 14357:
+            if (23188563 <= lat && lat < 25869753 && isInRange(lon, 76829213, 79718940)) {
+                return 14357;
+            }
+            /* fall through */
+        case 14358:
+            if (23188563 <= lat && lat < 25869753 && isInRange(lon, 79718940, 82608667)) {
+                return 14358;
+            }
+            /* fall through */
+        case 14359:
+            if (26808169 <= lat && lat < 29489359 && isInRange(lon, 94436900, 97416000)) {
+                return 14359;
+            }
+            /* fall through */
+        case 14360:
+            if (26808169 <= lat && lat < 29489359 && isInRange(lon, 91457800, 94436900)) {
+                return 14360;
+            }
+            /* fall through */
+        case 14361:
+            if (24245000 <= lat && lat < 26919000 && isInRange(lon, 89781676, 92701194)) {
+                return 14361;
+            }
+            /* fall through */
+        case 14362:
+            if (24245000 <= lat && lat < 26919000 && isInRange(lon, 92701194, 95620712)) {
+                return 14362;
+            }
+            /* fall through */
+        case 14363:
+            if (21930000 <= lat && lat < 24245000 && isInRange(lon, 91126000, 94324762)) {
+                return 14363;
+            }
+            /* fall through */
+        case 14364:
+            if (9770405 <= lat && lat < 12451595 && isInRange(lon, 71660809, 74371790)) {
+                return 14364;
+            }
+            /* fall through */
+        case 14365:
+            if (11130000 <= lat && lat < 14333000 && isInRange(lon, 92200000, 94320000)) {
+                return 14365;
+            }
+            /* fall through */
+        case 14366:
+            if (6730000 <= lat && lat < 11000000 && isInRange(lon, 92190000, 93970000)) {
+                return 14366;
+            }
+            /* fall through */
+        case 14367:
+            if (28502380 <= lat && lat < 31183570 && isInRange(lon, 74450000, 75450000)) {
+                return 14367;
+            }
+            /* fall through */
+        case 14368:
+            if (5900143 <= lat && lat < 37299857 && isInRange(lon, 67050143, 97416000)) {
+                return 14368;
+            }
+            return 14369;
+#endif
+        default:
+            ASSERT(0);
+            return m;
+    }
+}
+
+// encodes in grid record m of a hot territory (see encodeGrid); returns 0 if m is not such a record
+static int encodeHotGrid(char *result, const EncodeRec *enc, const int m, const int extraDigits,
+                         const char headerLetter) {
+    switch (m) {
+#if !defined(MAPCODE_SELECT_HOT_TERRITORIES) || defined(MAPCODE_HOT_TERRITORY_NLD)
+        case 1273:
+            encodeGridInBoundary(result, enc, &TERRITORY_BOUNDARIES[1273], extraDigits, headerLetter);
+            return 1;
+        case 1307:
+            encodeGridInBoundary(result, enc, &TERRITORY_BOUNDARIES[1307], extraDigits, headerLetter);
+            return 1;
+        case 1308:
+            encodeGridInBoundary(result, enc, &TERRITORY_BOUNDARIES[1308], extraDigits, headerLetter);
+            return 1;
+        case 1309:
+            encodeGridInBoundary(result, enc, &TERRITORY_BOUNDARIES[1309], extraDigits, headerLetter);
+            return 1;
+        case 1310:
+            encodeGridInBoundary(result, enc, &TERRITORY_BOUNDARIES[1310], extraDigits, headerLetter);
+            return 1;
+        case 1311:
+            encodeGridInBoundary(result, enc, &TERRITORY_BOUNDARIES[1311], extraDigits, headerLetter);
+            return 1;
+        case 1312:
+            encodeGridInBoundary(result, enc, &TERRITORY_BOUNDARIES[1312], extraDigits, headerLetter);
+            return 1;
+        case 1313:
+            encodeGridInBoundary(result, enc, &TERRITORY_BOUNDARIES[1313], extraDigits, headerLetter);
+            return 1;
+        case 1314:
+            encodeGridInBoundary(result, enc, &TERRITORY_BOUNDARIES[1314], extraDigits, headerLetter);
+            return 1;
+        case 1315:
+            encodeGridInBoundary(result, enc, &TERRITORY_BOUNDARIES[1315], extraDigits, headerLetter);
+            return 1;
+        case 1316:
+            encodeGridInBoundary(result, enc, &TERRITORY_BOUNDARIES[1316], extraDigits, headerLetter);
+            return 1;
+        case 1317:
+            encodeGridInBoundary(result, enc, &TERRITORY_BOUNDARIES[1317], extraDigits, headerLetter);
+            return 1;
+        case 1318:
+            encodeGridInBoundary(result, enc, &TERRITORY_BOUNDARIES[1318], extraDigits, headerLetter);
+            return 1;
+        case 1319:
+            encodeGridInBoundary(result, enc, &TERRITORY_BOUNDARIES[1319], extraDigits, headerLetter);
+            return 1;
+        case 1320:
+            encodeGridInBoundary(result, enc, &TERRITORY_BOUNDARIES[1320], extraDigits, headerLetter);
+            return 1;
+        case 1321:
+            encodeGridInBoundary(result, enc, &TERRITORY_BOUNDARIES[1321], extraDigits, headerLetter);
+            return 1;
+        case 1322:
+            encodeGridInBoundary(result, enc, &TERRITORY_BOUNDARIES[1322], extraDigits, headerLetter);
+            return 1;
+        case 1323:
+            encodeGridInBoundary(result, enc, &TERRITORY_BOUNDARIES[1323], extraDigits, headerLetter);
+            return 1;
+        case 1324:
+            encodeGridInBoundary(result, enc, &TERRITORY_BOUNDARIES[1324], extraDigits, headerLetter);
+            return 1;
+        case 1325:
+            encodeGridInBoundary(result, enc, &TERRITORY_BOUNDARIES[1325], extraDigits, headerLetter);
+            return 1;
+        case 1326:
+            encodeGridInBoundary(result, enc, &TERRITORY_BOUNDARIES[1326], extraDigits, headerLetter);
+            return 1;
+        case 1327:
+            encodeGridInBoundary(result, enc, &TERRITORY_BOUNDARIES[1327], extraDigits, headerLetter);
+            return 1;
+        case 1328:
+            encodeGridInBoundary(result, enc, &TERRITORY_BOUNDARIES[1328], extraDigits, headerLetter);
+            return 1;
+        case 1329:
+            encodeGridInBoundary(result, enc, &TERRITORY_BOUNDARIES[1329], extraDigits, headerLetter);
+            return 1;
+        case 1330:
+            encodeGridInBoundary(result, enc, &TERRITORY_BOUNDARIES[1330], extraDigits, headerLetter);
+            return 1;
+        case 1331:
+            encodeGridInBoundary(result, enc, &TERRITORY_BOUNDARIES[1331], extraDigits, headerLetter);
+            return 1;
+        case 1332:
+            encodeGridInBoundary(result, enc, &TERRITORY_BOUNDARIES[1332], extraDigits, headerLetter);
+            return 1;
+        case 1333:
+            encodeGridInBoundary(result, enc, &TERRITORY_BOUNDARIES[1333], extraDigits, headerLetter);
+            return 1;
+        case 1334:
+            encodeGridInBoundary(result, enc, &TERRITORY_BOUNDARIES[1334], extraDigits, headerLetter);
+            return 1;
+        case 1335:
+            encodeGridInBoundary(result, enc, &TERRITORY_BOUNDARIES[1335], extraDigits, headerLetter);
+            return 1;
+#endif
+#if !defined(MAPCODE_SELECT_HOT_TERRITORIES) || defined(MAPCODE_HOT_TERRITORY_USA)
+        case 14371:
+            encodeGridInBoundary(result, enc, &TERRITORY_BOUNDARIES[14371], extraDigits, headerLetter);
+            return 1;
+#endif
+#if !defined(MAPCODE_SELECT_HOT_TERRITORIES) || defined(MAPCODE_HOT_TERRITORY_IND)
+        case 14313:
+            encodeGridInBoundary(result, enc, &TERRITORY_BOUNDARIES[14313], extraDigits, headerLetter);
+            return 1;
+        case 14314:
+            encodeGridInBoundary(result, enc, &TERRITORY_BOUNDARIES[14314], extraDigits, headerLetter);
+            return 1;
+        case 14315:
+            encodeGridInBoundary(result, enc, &TERRITORY_BOUNDARIES[14315], extraDigits, headerLetter);
+            return 1;
+        case 14316:
+            encodeGridInBoundary(result, enc, &TERRITORY_BOUNDARIES[14316], extraDigits, headerLetter);
+            return 1;
+        case 14317:
+            encodeGridInBoundary(result, enc, &TERRITORY_BOUNDARIES[14317], extraDigits, headerLetter);
+            return 1;
+        case 14318:
+            encodeGridInBoundary(result, enc, &TERRITORY_BOUNDARIES[14318], extraDigits, headerLetter);
+            return 1;
+        case 14319:
+            encodeGridInBoundary(result, enc, &TERRITORY_BOUNDARIES[14319], extraDigits, headerLetter);
+            return 1;
+        case 14320:
+            encodeGridInBoundary(result, enc, &TERRITORY_BOUNDARIES[14320], extraDigits, headerLetter);
+            return 1;
+        case 14321:
+            encodeGridInBoundary(result, enc, &TERRITORY_BOUNDARIES[14321], extraDigits, headerLetter);
+            return 1;
+        case 14322:
+            encodeGridInBoundary(result, enc, &TERRITORY_BOUNDARIES[14322], extraDigits, headerLetter);
+            return 1;
+        case 14323:
+            encodeGridInBoundary(result, enc, &TERRITORY_BOUNDARIES[14323], extraDigits, headerLetter);
+            return 1;
+        case 14324:
+            encodeGridInBoundary(result, enc, &TERRITORY_BOUNDARIES[14324], extraDigits, headerLetter);
+            return 1;
+        case 14325:
+            encodeGridInBoundary(result, enc, &TERRITORY_BOUNDARIES[14325], extraDigits, headerLetter);
+            return 1;
+        case 14326:
+            encodeGridInBoundary(result, enc, &TERRITORY_BOUNDARIES[14326], extraDigits, headerLetter);
+            return 1;
+        case 14327:
+            encodeGridInBoundary(result, enc, &TERRITORY_BOUNDARIES[14327], extraDigits, headerLetter);
+            return 1;
+        case 14328:
+            encodeGridInBoundary(result, enc, &TERRITORY_BOUNDARIES[14328], extraDigits, headerLetter);
+            return 1;
+        case 14329:
+            encodeGridInBoundary(result, enc, &TERRITORY_BOUNDARIES[14329], extraDigits, headerLetter);
+            return 1;
+        case 14330:
+            encodeGridInBoundary(result, enc, &TERRITORY_BOUNDARIES[14330], extraDigits, headerLetter);
+            return 1;
+        case 14331:
+            encodeGridInBoundary(result, enc, &TERRITORY_BOUNDARIES[14331], extraDigits, headerLetter);
+            return 1;
+        case 14332:
+            encodeGridInBoundary(result, enc, &TERRITORY_BOUNDARIES[14332], extraDigits, headerLetter);
+            return 1;
+        case 14333:
+            encodeGridInBoundary(result, enc, &TERRITORY_BOUNDARIES[14333], extraDigits, headerLetter);
+            return 1;
+        case 14334:
+            encodeGridInBoundary(result, enc, &TERRITORY_BOUNDARIES[14334], extraDigits, headerLetter);
+            return 1;
+        case 14335:
+            encodeGridInBoundary(result, enc, &TERRITORY_BOUNDARIES[14335], extraDigits, headerLetter);
+            return 1;
+        case 14336:
+            encodeGridInBoundary(result, enc, &TERRITORY_BOUNDARIES[14336], extraDigits, headerLetter);
+            return 1;
+        case 14337:
+            encodeGridInBoundary(result, enc, &TERRITORY_BOUNDARIES[14337], extraDigits, headerLetter);
+            return 1;
+        case 14338:
+            encodeGridInBoundary(result, enc, &TERRITORY_BOUNDARIES[14338], extraDigits, headerLetter);
+            return 1;
+        case 14339:
+            encodeGridInBoundary(result, enc, &TERRITORY_BOUNDARIES[14339], extraDigits, headerLetter);
+            return 1;
+        case 14340:
+            encodeGridInBoundary(result, enc, &TERRITORY_BOUNDARIES[14340], extraDigits, headerLetter);
+            return 1;
+        case 14341:
+            encodeGridInBoundary(result, enc, &TERRITORY_BOUNDARIES[14341], extraDigits, headerLetter);
+            return 1;
+        case 14342:
+            encodeGridInBoundary(result, enc, &TERRITORY_BOUNDARIES[14342], extraDigits, headerLetter);
+            return 1;
+        case 14343:
+            encodeGridInBoundary(result, enc, &TERRITORY_BOUNDARIES[14343], extraDigits, headerLetter);
+            return 1;
+        case 14344:
+            encodeGridInBoundary(result, enc, &TERRITORY_BOUNDARIES[14344], extraDigits, headerLetter);
+            return 1;
+        case 14345:
+            encodeGridInBoundary(result, enc, &TERRITORY_BOUNDARIES[14345], extraDigits, headerLetter);
+            return 1;
+        case 14346:
+            encodeGridInBoundary(result, enc, &TERRITORY_BOUNDARIES[14346], extraDigits, headerLetter);
+            return 1;
+        case 14347:
+            encodeGridInBoundary(result, enc, &TERRITORY_BOUNDARIES[14347], extraDigits, headerLetter);
+            return 1;
+        case 14348:
+            encodeGridInBoundary(result, enc, &TERRITORY_BOUNDARIES[14348], extraDigits, headerLetter);
+            return 1;
+        case 14349:
+            encodeGridInBoundary(result, enc, &TERRITORY_BOUNDARIES[14349], extraDigits, headerLetter);
+            return 1;
+        case 14350:
+            encodeGridInBoundary(result, enc, &TERRITORY_BOUNDARIES[14350], extraDigits, headerLetter);
+            return 1;
+        case 14351:
+            encodeGridInBoundary(result, enc, &TERRITORY_BOUNDARIES[14351], extraDigits, headerLetter);
+            return 1;
+        case 14352:
+            encodeGridInBoundary(result, enc, &TERRITORY_BOUNDARIES[14352], extraDigits, headerLetter);
+            return 1;
+        case 14353:
+            encodeGridInBoundary(result, enc, &TERRITORY_BOUNDARIES[14353], extraDigits, headerLetter);
+            return 1;
+        case 14354:
+            encodeGridInBoundary(result, enc, &TERRITORY_BOUNDARIES[14354], extraDigits, headerLetter);
+            return 1;
+        case 14355:
+            encodeGridInBoundary(result, enc, &TERRITORY_BOUNDARIES[14355], extraDigits, headerLetter);
+            return 1;
+        case 14356:
+            encodeGridInBoundary(result, enc, &TERRITORY_BOUNDARIES[14356], extraDigits, headerLetter);
+            return 1;
+        case 14357:
+            encodeGridInBoundary(result, enc, &TERRITORY_BOUNDARIES[14357], extraDigits, headerLetter);
+            return 1;
+        case 14358:
+            encodeGridInBoundary(result, enc, &TERRITORY_BOUNDARIES[14358], extraDigits, headerLetter);
+            return 1;
+        case 14359:
+            encodeGridInBoundary(result, enc, &TERRITORY_BOUNDARIES[14359], extraDigits, headerLetter);
+            return 1;
+        case 14360:
+            encodeGridInBoundary(result, enc, &TERRITORY_BOUNDARIES[14360], extraDigits, headerLetter);
+            return 1;
+        case 14361:
+            encodeGridInBoundary(result, enc, &TERRITORY_BOUNDARIES[14361], extraDigits, headerLetter);
+            return 1;
+        case 14362:
+            encodeGridInBoundary(result, enc, &TERRITORY_BOUNDARIES[14362], extraDigits, headerLetter);
+            return 1;
+        case 14363:
+            encodeGridInBoundary(result, enc, &TERRITORY_BOUNDARIES[14363], extraDigits, headerLetter);
+            return 1;
+        case 14364:
+            encodeGridInBoundary(result, enc, &TERRITORY_BOUNDARIES[14364], extraDigits, headerLetter);
+            return 1;
+        case 14365:
+            encodeGridInBoundary(result, enc, &TERRITORY_BOUNDARIES[14365], extraDigits, headerLetter);
+            return 1;
+        case 14366:
+            encodeGridInBoundary(result, enc, &TERRITORY_BOUNDARIES[14366], extraDigits, headerLetter);
+            return 1;
+        case 14367:
+            encodeGridInBoundary(result, enc, &TERRITORY_BOUNDARIES[14367], extraDigits, headerLetter);
+            return 1;
+        case 14368:
+            encodeGridInBoundary(result, enc, &TERRITORY_BOUNDARIES[14368], extraDigits, headerLetter);
+            return 1;
+#endif
+        default:
+            return 0;
+    }
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // __INTERNAL_HOT_ENCODERS_H__
@@ -0,0 +1,977 @@
+/*
+ * Copyright (C) 2014-2019 Stichting Mapcode Foundation (http://www.mapcode.com)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __INTERNAL_ISO_HASH_H__
+#define __INTERNAL_ISO_HASH_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// *** GENERATED FILE (tools/generate_iso_hash.py), DO NOT CHANGE OR PRETTIFY ***
+
+#define ISO_HASH_SEED 0x2545F491U
+#define NR_ISO_HASH_BUCKETS 229
+#define NR_ISO_HASH 916
+
+typedef struct {
+    unsigned int code[2];       // packed uppercase ISO3166 code
+    enum Territory territory;
+} IsoHashRec;
+
+// displacement (seed of hashIsoCode) of the codes in each bucket
+static const unsigned int ISO_HASH_DISPLACEMENT[NR_ISO_HASH_BUCKETS] = {
+        26, 282, 3, 10, 6, 8, 1, 13, 48, 2, 88, 58, 55, 5, 21, 3,
+        25, 40, 29, 2, 47, 2, 1, 14, 17, 12, 7, 69, 9, 18, 20, 13,
+        190, 85, 0, 15, 59, 6, 1, 2, 6, 528, 545, 31, 1, 2, 48, 256,
+        9, 5, 8, 39, 4, 17, 180, 165, 2, 39, 9, 33, 6, 23, 1, 209,
+        2, 46, 21, 476, 4, 81, 27, 76, 14, 212, 291, 14, 3, 1, 1, 173,
+        89, 3, 24, 37, 1, 56, 69, 30, 45, 88, 33, 18, 83, 2, 26, 68,
+        143, 188, 249, 1, 65, 121, 10, 167, 171, 54, 7, 15, 11, 415, 434, 73,
+        55, 336, 81, 1130, 72, 43, 184, 48, 2038, 1, 5, 146, 8, 17, 570, 19,
+        161, 23, 351, 151, 13, 5, 30, 228, 640, 30, 52, 27, 9, 852, 358, 16,
+        58, 2, 73, 22, 235, 1, 28, 267, 198, 18, 1831, 253, 1, 1335, 1, 312,
+        566, 1531, 13, 149, 141, 293, 11, 14, 467, 87, 30, 1, 166, 45, 59, 9,
+        146, 1, 518, 383, 5, 21, 6, 116, 23, 11, 2, 99, 209, 165, 111, 104,
+        54, 104, 1, 64, 15, 586, 3, 222, 111, 270, 30, 15, 17, 685, 4, 1460,
+        3, 27, 4, 3, 226, 1, 1424, 781, 420, 1156, 93, 200, 18, 114, 7, 14,
+        20, 55, 3083, 13, 227,
+};
+
+static const IsoHashRec ISO_HASH[NR_ISO_HASH] = {
+        {{0x482d4e49, 0x000052}, TERRITORY_IN_HR}, // IN-HR
+        {{0x00004741, 0x000000}, TERRITORY_MX_AGU}, // AG
+        {{0x00424e47, 0x000000}, TERRITORY_GNB}, // GNB
+        {{0x362d4e43, 0x000035}, TERRITORY_CN_XJ}, // CN-65
+        {{0x00534842, 0x000000}, TERRITORY_BHS}, // BHS
+        {{0x00004148, 0x000000}, TERRITORY_CN_HA}, // HA
+        {{0x432d584d, 0x000053}, TERRITORY_MX_CHP}, // MX-CS
+        {{0x00494a44, 0x000000}, TERRITORY_DJI}, // DJI
+        {{0x562d584d, 0x005245}, TERRITORY_MX_VER}, // MX-VER
+        {{0x4e2d5355, 0x000045}, TERRITORY_US_NE}, // US-NE
+        {{0x00524550, 0x000000}, TERRITORY_PER}, // PER
+        {{0x482d584d, 0x000047}, TERRITORY_MX_HID}, // MX-HG
+        {{0x0000444e, 0x000000}, TERRITORY_US_ND}, // ND
+        {{0x00004c41, 0x000000}, TERRITORY_BR_AL}, // AL
+        {{0x0000544e, 0x000000}, TERRITORY_AU_NT}, // NT
+        {{0x00594745, 0x000000}, TERRITORY_EGY}, // EGY
+        {{0x004e4843, 0x000000}, TERRITORY_CHN}, // CHN
+        {{0x572d5355, 0x000056}, TERRITORY_US_WV}, // US-WV
+        {{0x004e454c, 0x000000}, TERRITORY_RU_LEN}, // LEN
+        {{0x432d4e49, 0x000054}, TERRITORY_IN_CT}, // IN-CT
+        {{0x004d484b, 0x000000}, TERRITORY_KHM}, // KHM
+        {{0x542d584d, 0x004d41}, TERRITORY_MX_TAM}, // MX-TAM
+        {{0x4d2d4e43, 0x000043}, TERRITORY_MAC}, // CN-MC
+        {{0x542d4e43, 0x000057}, TERRITORY_TWN}, // CN-TW
+        {{0x542d5552, 0x004d41}, TERRITORY_RU_TT}, // RU-TAM
+        {{0x00414e4b, 0x000000}, TERRITORY_KNA}, // KNA
+        {{0x0000494b, 0x000000}, TERRITORY_RU_KI}, // KI
+        {{0x00004a5a, 0x000000}, TERRITORY_CN_ZJ}, // ZJ
+        {{0x00004548, 0x000000}, TERRITORY_CN_HE}, // HE
+        {{0x352d4e43, 0x000031}, TERRITORY_CN_SC}, // CN-51
+        {{0x00424d5a, 0x000000}, TERRITORY_ZMB}, // ZMB
+        {{0x005a4f4d, 0x000000}, TERRITORY_MOZ}, // MOZ
+        {{0x5a2d584d, 0x000041}, TERRITORY_MX_ZAC}, // MX-ZA
+        {{0x00424756, 0x000000}, TERRITORY_VGB}, // VGB
+        {{0x442d5355, 0x000043}, TERRITORY_US_DC}, // US-DC
+        {{0x004e5653, 0x000000}, TERRITORY_SVN}, // SVN
+        {{0x00004754, 0x000000}, TERRITORY_IN_TG}, // TG
+        {{0x442d4e49, 0x00004c}, TERRITORY_IN_DL}, // IN-DL
+        {{0x372d4e43, 0x000031}, TERRITORY_TWN}, // CN-71
+        {{0x4d2d5355, 0x000044}, TERRITORY_US_MD}, // US-MD
+        {{0x00505453, 0x000000}, TERRITORY_STP}, // STP
+        {{0x00004544, 0x000000}, TERRITORY_US_DE}, // DE
+        {{0x312d4e43, 0x000033}, TERRITORY_CN_HE}, // CN-13
+        {{0x0056444d, 0x000000}, TERRITORY_MDV}, // MDV
+        {{0x00005853, 0x000000}, TERRITORY_CN_SX}, // SX
+        {{0x00004953, 0x000000}, TERRITORY_MX_SIN}, // SI
+        {{0x542d584d, 0x00004d}, TERRITORY_MX_TAM}, // MX-TM
+        {{0x00004250, 0x000000}, TERRITORY_IN_PB}, // PB
+        {{0x432d584d, 0x00004f}, TERRITORY_MX_COA}, // MX-CO
+        {{0x004e4853, 0x000000}, TERRITORY_SHN}, // SHN
+        {{0x00004344, 0x000000}, TERRITORY_US_DC}, // DC
+        {{0x522d5242, 0x000053}, TERRITORY_BR_RS}, // BR-RS
+        {{0x00004556, 0x000000}, TERRITORY_MX_VER}, // VE
+        {{0x4d2d584d, 0x000058}, TERRITORY_MX_MX}, // MX-MX
+        {{0x422d584d, 0x000053}, TERRITORY_MX_BCS}, // MX-BS
+        {{0x004e4150, 0x000000}, TERRITORY_PAN}, // PAN
+        {{0x0041434c, 0x000000}, TERRITORY_LCA}, // LCA
+        {{0x0052474e, 0x000000}, TERRITORY_RU_NGR}, // NGR
+        {{0x552d5552, 0x00594c}, TERRITORY_RU_ULY}, // RU-ULY
+        {{0x00534753, 0x000000}, TERRITORY_SGS}, // SGS
+        {{0x4b2d5552, 0x004d41}, TERRITORY_RU_KAM}, // RU-KAM
+        {{0x4a2d4e43, 0x00004c}, TERRITORY_CN_JL}, // CN-JL
+        {{0x332d4e43, 0x000035}, TERRITORY_CN_FJ}, // CN-35
+        {{0x00004a54, 0x000000}, TERRITORY_CN_TJ}, // TJ
+        {{0x00004a58, 0x000000}, TERRITORY_CN_XJ}, // XJ
+        {{0x432d5541, 0x000043}, TERRITORY_CCK}, // AU-CC
+        {{0x00005143, 0x000000}, TERRITORY_CN_CQ}, // CQ
+        {{0x00444354, 0x000000}, TERRITORY_TCD}, // TCD
+        {{0x532d584d, 0x00504c}, TERRITORY_MX_SLP}, // MX-SLP
+        {{0x00455241, 0x000000}, TERRITORY_ARE}, // ARE
+        {{0x00414141, 0x000000}, TERRITORY_AAA}, // AAA
+        {{0x00555954, 0x000000}, TERRITORY_RU_TYU}, // TYU
+        {{0x332d4e43, 0x000037}, TERRITORY_CN_SD}, // CN-37
+        {{0x004d4153, 0x000000}, TERRITORY_RU_SAM}, // SAM
+        {{0x00005541, 0x000000}, TERRITORY_AUS}, // AU
+        {{0x562d5355, 0x000054}, TERRITORY_US_VT}, // US-VT
+        {{0x422d5552, 0x004c45}, TERRITORY_RU_BE}, // RU-BEL
+        {{0x005a474b, 0x000000}, TERRITORY_KGZ}, // KGZ
+        {{0x00595255, 0x000000}, TERRITORY_URY}, // URY
+        {{0x502d4e49, 0x000059}, TERRITORY_IN_PY}, // IN-PY
+        {{0x432d5552, 0x000045}, TERRITORY_RU_CE}, // RU-CE
+        {{0x00005459, 0x000000}, TERRITORY_CA_YT}, // YT
+        {{0x482d4e49, 0x000050}, TERRITORY_IN_HP}, // IN-HP
+        {{0x4b2d5552, 0x004e47}, TERRITORY_RU_KGN}, // RU-KGN
+        {{0x492d5355, 0x000041}, TERRITORY_US_IA}, // US-IA
+        {{0x00554552, 0x000000}, TERRITORY_REU}, // REU
+        {{0x4b2d5552, 0x004d45}, TERRITORY_RU_KEM}, // RU-KEM
+        {{0x00414f43, 0x000000}, TERRITORY_MX_COA}, // COA
+        {{0x312d4e43, 0x000031}, TERRITORY_CN_BJ}, // CN-11
+        {{0x00565248, 0x000000}, TERRITORY_HRV}, // HRV
+        {{0x472d4e43, 0x000053}, TERRITORY_CN_GS}, // CN-GS
+        {{0x00474e4d, 0x000000}, TERRITORY_MNG}, // MNG
+        {{0x00525553, 0x000000}, TERRITORY_SUR}, // SUR
+        {{0x592d4e43, 0x00004e}, TERRITORY_CN_YN}, // CN-YN
+        {{0x00004e44, 0x000000}, TERRITORY_IN_DN}, // DN
+        {{0x004e4159, 0x000000}, TERRITORY_RU_YAN}, // YAN
+        {{0x00004254, 0x000000}, TERRITORY_MX_TAB}, // TB
+        {{0x00544c41, 0x000000}, TERRITORY_RU_ALT}, // ALT
+        {{0x00454c53, 0x000000}, TERRITORY_SLE}, // SLE
+        {{0x00455a41, 0x000000}, TERRITORY_AZE}, // AZE
+        {{0x0045494c, 0x000000}, TERRITORY_LIE}, // LIE
+        {{0x412d584d, 0x000047}, TERRITORY_MX_AGU}, // MX-AG
+        {{0x0000584e, 0x000000}, TERRITORY_CN_NX}, // NX
+        {{0x00534154, 0x000000}, TERRITORY_AU_TAS}, // TAS
+        {{0x0000444f, 0x000000}, TERRITORY_IN_OR}, // OD
+        {{0x0044474b, 0x000000}, TERRITORY_RU_KGD}, // KGD
+        {{0x352d4e43, 0x000032}, TERRITORY_CN_GZ}, // CN-52
+        {{0x4d2d584d, 0x004349}, TERRITORY_MX_MIC}, // MX-MIC
+        {{0x004b5653, 0x000000}, TERRITORY_SVK}, // SVK
+        {{0x00004d50, 0x000000}, TERRITORY_RU_PM}, // PM
+        {{0x00544356, 0x000000}, TERRITORY_VCT}, // VCT
+        {{0x322d4e43, 0x000033}, TERRITORY_CN_HL}, // CN-23
+        {{0x422d4e43, 0x00004a}, TERRITORY_CN_BJ}, // CN-BJ
+        {{0x0053594d, 0x000000}, TERRITORY_MYS}, // MYS
+        {{0x005a5753, 0x000000}, TERRITORY_SWZ}, // SWZ
+        {{0x00445353, 0x000000}, TERRITORY_SSD}, // SSD
+        {{0x00424d47, 0x000000}, TERRITORY_GMB}, // GMB
+        {{0x00004e49, 0x000000}, TERRITORY_US_IN}, // IN
+        {{0x00444c51, 0x000000}, TERRITORY_AU_QLD}, // QLD
+        {{0x00444742, 0x000000}, TERRITORY_BGD}, // BGD
+        {{0x00004551, 0x000000}, TERRITORY_MX_QUE}, // QE
+        {{0x4b2d4e49, 0x00004c}, TERRITORY_IN_KL}, // IN-KL
+        {{0x4d2d5242, 0x000041}, TERRITORY_BR_MA}, // BR-MA
+        {{0x00545345, 0x000000}, TERRITORY_EST}, // EST
+        {{0x4e2d4143, 0x000054}, TERRITORY_CA_NT}, // CA-NT
+        {{0x342d4e43, 0x000034}, TERRITORY_CN_GD}, // CN-44
+        {{0x4f2d5355, 0x00004b}, TERRITORY_US_OK}, // US-OK
+        {{0x4c2d5552, 0x004e45}, TERRITORY_RU_LEN}, // RU-LEN
+        {{0x00504c53, 0x000000}, TERRITORY_MX_SLP}, // SLP
+        {{0x532d4e43, 0x000044}, TERRITORY_CN_SD}, // CN-SD
+        {{0x00424154, 0x000000}, TERRITORY_MX_TAB}, // TAB
+        {{0x392d4e43, 0x000031}, TERRITORY_HKG}, // CN-91
+        {{0x004e454e, 0x000000}, TERRITORY_RU_NEN}, // NEN
+        {{0x522d4e49, 0x00004a}, TERRITORY_IN_RJ}, // IN-RJ
+        {{0x522d5242, 0x00004f}, TERRITORY_BR_RO}, // BR-RO
+        {{0x422d4e49, 0x000052}, TERRITORY_IN_BR}, // IN-BR
+        {{0x4f2d584d, 0x005841}, TERRITORY_MX_OAX}, // MX-OAX
+        {{0x00004952, 0x000000}, TERRITORY_US_RI}, // RI
+        {{0x4f2d5355, 0x000052}, TERRITORY_US_OR}, // US-OR
+        {{0x00005248, 0x000000}, TERRITORY_IN_HR}, // HR
+        {{0x552d4e49, 0x000050}, TERRITORY_IN_UP}, // IN-UP
+        {{0x00484942, 0x000000}, TERRITORY_BIH}, // BIH
+        {{0x00004e59, 0x000000}, TERRITORY_CN_YN}, // YN
+        {{0x462d5355, 0x00004c}, TERRITORY_US_FL}, // US-FL
+        {{0x0000484f, 0x000000}, TERRITORY_US_OH}, // OH
+        {{0x00574c50, 0x000000}, TERRITORY_PLW}, // PLW
+        {{0x432d584d, 0x00004d}, TERRITORY_MX_CAM}, // MX-CM
+        {{0x312d4e43, 0x000034}, TERRITORY_CN_SX}, // CN-14
+        {{0x412d4143, 0x000042}, TERRITORY_CA_AB}, // CA-AB
+        {{0x432d5552, 0x005548}, TERRITORY_RU_CHU}, // RU-CHU
+        {{0x00495243, 0x000000}, TERRITORY_CRI}, // CRI
+        {{0x004b5249, 0x000000}, TERRITORY_RU_IRK}, // IRK
+        {{0x592d5552, 0x005241}, TERRITORY_RU_YAR}, // RU-YAR
+        {{0x4e2d4e43, 0x000058}, TERRITORY_CN_NX}, // CN-NX
+        {{0x542d5552, 0x004d4f}, TERRITORY_RU_TOM}, // RU-TOM
+        {{0x00455654, 0x000000}, TERRITORY_RU_TVE}, // TVE
+        {{0x00004343, 0x000000}, TERRITORY_CCK}, // CC
+        {{0x0000584a, 0x000000}, TERRITORY_CN_JX}, // JX
+        {{0x4b2d5552, 0x004447}, TERRITORY_RU_KGD}, // RU-KGD
+        {{0x00414c41, 0x000000}, TERRITORY_ALA}, // ALA
+        {{0x00005854, 0x000000}, TERRITORY_US_TX}, // TX
+        {{0x00004957, 0x000000}, TERRITORY_US_WI}, // WI
+        {{0x4d2d5355, 0x004449}, TERRITORY_US_HI}, // US-MID
+        {{0x4d2d5552, 0x000045}, TERRITORY_RU_ME}, // RU-ME
+        {{0x532d5552, 0x004550}, TERRITORY_RU_SPE}, // RU-SPE
+        {{0x442d5242, 0x000046}, TERRITORY_BR_DF}, // BR-DF
+        {{0x004b5250, 0x000000}, TERRITORY_PRK}, // PRK
+        {{0x532d5552, 0x005241}, TERRITORY_RU_SAR}, // RU-SAR
+        {{0x004e5554, 0x000000}, TERRITORY_TUN}, // TUN
+        {{0x4b2d5552, 0x00534f}, TERRITORY_RU_KOS}, // RU-KOS
+        {{0x00525843, 0x000000}, TERRITORY_CXR}, // CXR
+        {{0x004d4b54, 0x000000}, TERRITORY_TKM}, // TKM
+        {{0x4e2d584d, 0x005941}, TERRITORY_MX_NAY}, // MX-NAY
+        {{0x00414744, 0x000000}, TERRITORY_IOT}, // DGA
+        {{0x572d4e49, 0x000042}, TERRITORY_IN_WB}, // IN-WB
+        {{0x432d5355, 0x000041}, TERRITORY_US_CA}, // US-CA
+        {{0x4e2d4143, 0x00004c}, TERRITORY_CA_NL}, // CA-NL
+        {{0x00004453, 0x000000}, TERRITORY_US_SD}, // SD
+        {{0x00004851, 0x000000}, TERRITORY_CN_QH}, // QH
+        {{0x00004b4a, 0x000000}, TERRITORY_IN_JK}, // JK
+        {{0x542d4e43, 0x00004a}, TERRITORY_CN_TJ}, // CN-TJ
+        {{0x00004147, 0x000000}, TERRITORY_IN_GA}, // GA
+        {{0x004f5246, 0x000000}, TERRITORY_FRO}, // FRO
+        {{0x542d584d, 0x00004c}, TERRITORY_MX_TLA}, // MX-TL
+        {{0x4e2d5355, 0x00004d}, TERRITORY_US_NM}, // US-NM
+        {{0x004d4559, 0x000000}, TERRITORY_YEM}, // YEM
+        {{0x00415242, 0x000000}, TERRITORY_BRA}, // BRA
+        {{0x00454e4d, 0x000000}, TERRITORY_MNE}, // MNE
+        {{0x00574f4d, 0x000000}, TERRITORY_RU_MOW}, // MOW
+        {{0x004e4f54, 0x000000}, TERRITORY_TON}, // TON
+        {{0x00414c54, 0x000000}, TERRITORY_MX_TLA}, // TLA
+        {{0x00464c57, 0x000000}, TERRITORY_WLF}, // WLF
+        {{0x00004156, 0x000000}, TERRITORY_US_VA}, // VA
+        {{0x492d5355, 0x000044}, TERRITORY_US_ID}, // US-ID
+        {{0x00005950, 0x000000}, TERRITORY_IN_PY}, // PY
+        {{0x00005254, 0x000000}, TERRITORY_IN_TR}, // TR
+        {{0x00454c4e, 0x000000}, TERRITORY_MX_NLE}, // NLE
+        {{0x00435247, 0x000000}, TERRITORY_GRC}, // GRC
+        {{0x482d4e43, 0x000042}, TERRITORY_CN_HB}, // CN-HB
+        {{0x00004149, 0x000000}, TERRITORY_US_IA}, // IA
+        {{0x004c4843, 0x000000}, TERRITORY_CHL}, // CHL
+        {{0x00504c47, 0x000000}, TERRITORY_GLP}, // GLP
+        {{0x422d5552, 0x005952}, TERRITORY_RU_BRY}, // RU-BRY
+        {{0x00554153, 0x000000}, TERRITORY_SAU}, // SAU
+        {{0x004d4f43, 0x000000}, TERRITORY_COM}, // COM
+        {{0x00004d4b, 0x000000}, TERRITORY_RU_KM}, // KM
+        {{0x004b4150, 0x000000}, TERRITORY_PAK}, // PAK
+        {{0x502d5552, 0x005a4e}, TERRITORY_RU_PNZ}, // RU-PNZ
+        {{0x00565554, 0x000000}, TERRITORY_TUV}, // TUV
+        {{0x00455753, 0x000000}, TERRITORY_SWE}, // SWE
+        {{0x00004c54, 0x000000}, TERRITORY_MX_TLA}, // TL
+        {{0x342d4e43, 0x000032}, TERRITORY_CN_HB}, // CN-42
+        {{0x00004956, 0x000000}, TERRITORY_VIR}, // VI
+        {{0x00455550, 0x000000}, TERRITORY_MX_PUE}, // PUE
+        {{0x4e2d5552, 0x005356}, TERRITORY_RU_NVS}, // RU-NVS
+        {{0x562d5552, 0x00524f}, TERRITORY_RU_VOR}, // RU-VOR
+        {{0x412d5552, 0x00004c}, TERRITORY_RU_AL}, // RU-AL
+        {{0x412d5355, 0x000053}, TERRITORY_ASM}, // US-AS
+        {{0x00004447, 0x000000}, TERRITORY_CN_GD}, // GD
+        {{0x432d5355, 0x000054}, TERRITORY_US_CT}, // US-CT
+        {{0x0000594b, 0x000000}, TERRITORY_US_KY}, // KY
+        {{0x004c4f42, 0x000000}, TERRITORY_BOL}, // BOL
+        {{0x532d4e43, 0x000058}, TERRITORY_CN_SX}, // CN-SX
+        {{0x004e4350, 0x000000}, TERRITORY_PCN}, // PCN
+        {{0x4f2d5552, 0x00534d}, TERRITORY_RU_OMS}, // RU-OMS
+        {{0x562d5552, 0x00474c}, TERRITORY_RU_VLG}, // RU-VLG
+        {{0x00525554, 0x000000}, TERRITORY_TUR}, // TUR
+        {{0x0047414d, 0x000000}, TERRITORY_RU_MAG}, // MAG
+        {{0x00525349, 0x000000}, TERRITORY_ISR}, // ISR
+        {{0x004c4b54, 0x000000}, TERRITORY_TKL}, // TKL
+        {{0x004f4754, 0x000000}, TERRITORY_TGO}, // TGO
+        {{0x442d584d, 0x005255}, TERRITORY_MX_DUR}, // MX-DUR
+        {{0x332d4e43, 0x000036}, TERRITORY_CN_JX}, // CN-36
+        {{0x00004853, 0x000000}, TERRITORY_CN_SH}, // SH
+        {{0x502d4143, 0x000045}, TERRITORY_CA_PE}, // CA-PE
+        {{0x472d5355, 0x000055}, TERRITORY_GUM}, // US-GU
+        {{0x00544341, 0x000000}, TERRITORY_AU_ACT}, // ACT
+        {{0x00524742, 0x000000}, TERRITORY_BGR}, // BGR
+        {{0x00005559, 0x000000}, TERRITORY_MX_YUC}, // YU
+        {{0x004e4947, 0x000000}, TERRITORY_GIN}, // GIN
+        {{0x00444948, 0x000000}, TERRITORY_MX_HID}, // HID
+        {{0x00524f4d, 0x000000}, TERRITORY_MX_MOR}, // MOR
+        {{0x004c5a4e, 0x000000}, TERRITORY_NZL}, // NZL
+        {{0x542d584d, 0x000042}, TERRITORY_MX_TAB}, // MX-TB
+        {{0x004d5447, 0x000000}, TERRITORY_GTM}, // GTM
+        {{0x4a2d584d, 0x004c41}, TERRITORY_MX_JAL}, // MX-JAL
+        {{0x00004157, 0x000000}, TERRITORY_AU_WA}, // WA
+        {{0x00005055, 0x000000}, TERRITORY_IN_UP}, // UP
+        {{0x412d5355, 0x000052}, TERRITORY_US_AR}, // US-AR
+        {{0x4f2d4143, 0x00004e}, TERRITORY_CA_ON}, // CA-ON
+        {{0x522d5552, 0x004159}, TERRITORY_RU_RYA}, // RU-RYA
+        {{0x00004c4a, 0x000000}, TERRITORY_CN_JL}, // JL
+        {{0x4b2d5355, 0x000053}, TERRITORY_US_KS}, // US-KS
+        {{0x00004a42, 0x000000}, TERRITORY_CN_BJ}, // BJ
+        {{0x542d5552, 0x004c55}, TERRITORY_RU_TUL}, // RU-TUL
+        {{0x00545043, 0x000000}, TERRITORY_CPT}, // CPT
+        {{0x0000434b, 0x000000}, TERRITORY_RU_KC}, // KC
+        {{0x00535552, 0x000000}, TERRITORY_RUS}, // RUS
+        {{0x522d5242, 0x00004a}, TERRITORY_BR_RJ}, // BR-RJ
+        {{0x00564559, 0x000000}, TERRITORY_RU_YEV}, // YEV
+        {{0x412d5242, 0x00004c}, TERRITORY_BR_AL}, // BR-AL
+        {{0x00485445, 0x000000}, TERRITORY_ETH}, // ETH
+        {{0x00004a4e, 0x000000}, TERRITORY_US_NJ}, // NJ
+        {{0x004e5548, 0x000000}, TERRITORY_HUN}, // HUN
+        {{0x00474f43, 0x000000}, TERRITORY_COG}, // COG
+        {{0x00004744, 0x000000}, TERRITORY_MX_DUR}, // DG
+        {{0x004b5241, 0x000000}, TERRITORY_RU_ARK}, // ARK
+        {{0x502d5552, 0x005245}, TERRITORY_RU_PM}, // RU-PER
+        {{0x004d454b, 0x000000}, TERRITORY_RU_KEM}, // KEM
+        {{0x432d4e49, 0x000047}, TERRITORY_IN_CT}, // IN-CG
+        {{0x332d4e43, 0x000032}, TERRITORY_CN_JS}, // CN-32
+        {{0x00004b4f, 0x000000}, TERRITORY_US_OK}, // OK
+        {{0x00524f56, 0x000000}, TERRITORY_RU_VOR}, // VOR
+        {{0x00454843, 0x000000}, TERRITORY_CHE}, // CHE
+        {{0x00004d4e, 0x000000}, TERRITORY_US_NM}, // NM
+        {{0x532d4e43, 0x000043}, TERRITORY_CN_SC}, // CN-SC
+        {{0x00004841, 0x000000}, TERRITORY_CN_AH}, // AH
+        {{0x4d2d4e49, 0x000050}, TERRITORY_IN_MP}, // IN-MP
+        {{0x00455551, 0x000000}, TERRITORY_MX_QUE}, // QUE
+        {{0x4b2d5552, 0x00004c}, TERRITORY_RU_KL}, // RU-KL
+        {{0x00005552, 0x000000}, TERRITORY_RUS}, // RU
+        {{0x412d5541, 0x005443}, TERRITORY_AU_ACT}, // AU-ACT
+        {{0x0045575a, 0x000000}, TERRITORY_ZWE}, // ZWE
+        {{0x00524f4a, 0x000000}, TERRITORY_JOR}, // JOR
+        {{0x522d5552, 0x00534f}, TERRITORY_RU_ROS}, // RU-ROS
+        {{0x00004e53, 0x000000}, TERRITORY_CN_SN}, // SN
+        {{0x4b2d5552, 0x00004f}, TERRITORY_RU_KO}, // RU-KO
+        {{0x00005a4d, 0x000000}, TERRITORY_IN_MZ}, // MZ
+        {{0x502d5552, 0x00004d}, TERRITORY_RU_PM}, // RU-PM
+        {{0x00504843, 0x000000}, TERRITORY_MX_CHP}, // CHP
+        {{0x00524c42, 0x000000}, TERRITORY_BLR}, // BLR
+        {{0x00004b41, 0x000000}, TERRITORY_US_AK}, // AK
+        {{0x332d4e43, 0x000034}, TERRITORY_CN_AH}, // CN-34
+        {{0x0000414a, 0x000000}, TERRITORY_MX_JAL}, // JA
+        {{0x4f2d5355, 0x000048}, TERRITORY_US_OH}, // US-OH
+        {{0x00524956, 0x000000}, TERRITORY_VIR}, // VIR
+        {{0x412d5242, 0x000050}, TERRITORY_BR_AP}, // BR-AP
+        {{0x004e4542, 0x000000}, TERRITORY_BEN}, // BEN
+        {{0x0053564e, 0x000000}, TERRITORY_RU_NVS}, // NVS
+        {{0x004d4e56, 0x000000}, TERRITORY_VNM}, // VNM
+        {{0x4d2d5552, 0x004741}, TERRITORY_RU_MAG}, // RU-MAG
+        {{0x542d4e49, 0x00004e}, TERRITORY_IN_TN}, // IN-TN
+        {{0x004d5053, 0x000000}, TERRITORY_SPM}, // SPM
+        {{0x582d4e43, 0x00004a}, TERRITORY_CN_XJ}, // CN-XJ
+        {{0x0052494b, 0x000000}, TERRITORY_KIR}, // KIR
+        {{0x00554843, 0x000000}, TERRITORY_RU_CHU}, // CHU
+        {{0x00005456, 0x000000}, TERRITORY_US_VT}, // VT
+        {{0x4a2d4e43, 0x000053}, TERRITORY_CN_JS}, // CN-JS
+        {{0x4d2d584d, 0x000049}, TERRITORY_MX_MIC}, // MX-MI
+        {{0x472d584d, 0x000054}, TERRITORY_MX_GUA}, // MX-GT
+        {{0x005a4c42, 0x000000}, TERRITORY_BLZ}, // BLZ
+        {{0x004c5554, 0x000000}, TERRITORY_RU_TUL}, // TUL
+        {{0x0059454a, 0x000000}, TERRITORY_JEY}, // JEY
+        {{0x482d5355, 0x000049}, TERRITORY_US_HI}, // US-HI
+        {{0x422d584d, 0x005343}, TERRITORY_MX_BCS}, // MX-BCS
+        {{0x412d5552, 0x00544c}, TERRITORY_RU_ALT}, // RU-ALT
+        {{0x00444e41, 0x000000}, TERRITORY_AND}, // AND
+        {{0x004b4a54, 0x000000}, TERRITORY_TJK}, // TJK
+        {{0x004e4556, 0x000000}, TERRITORY_VEN}, // VEN
+        {{0x0041484b, 0x000000}, TERRITORY_RU_KHA}, // KHA
+        {{0x00474e50, 0x000000}, TERRITORY_PNG}, // PNG
+        {{0x00005a58, 0x000000}, TERRITORY_CN_XZ}, // XZ
+        {{0x4f2d4e49, 0x000044}, TERRITORY_IN_OR}, // IN-OD
+        {{0x00504e4d, 0x000000}, TERRITORY_MNP}, // MNP
+        {{0x004f4d53, 0x000000}, TERRITORY_RU_SMO}, // SMO
+        {{0x502d5552, 0x004b53}, TERRITORY_RU_PSK}, // RU-PSK
+        {{0x4c2d5355, 0x000041}, TERRITORY_US_LA}, // US-LA
+        {{0x004b4c46, 0x000000}, TERRITORY_FLK}, // FLK
+        {{0x412d5355, 0x00005a}, TERRITORY_US_AZ}, // US-AZ
+        {{0x00005252, 0x000000}, TERRITORY_BR_RR}, // RR
+        {{0x0000474d, 0x000000}, TERRITORY_BR_MG}, // MG
+        {{0x00005048, 0x000000}, TERRITORY_IN_HP}, // HP
+        {{0x00545250, 0x000000}, TERRITORY_PRT}, // PRT
+        {{0x0054424a, 0x000000}, TERRITORY_AU_JBT}, // JBT
+        {{0x4e2d4143, 0x000042}, TERRITORY_CA_NB}, // CA-NB
+        {{0x00414847, 0x000000}, TERRITORY_GHA}, // GHA
+        {{0x0043415a, 0x000000}, TERRITORY_MX_ZAC}, // ZAC
+        {{0x4e2d5541, 0x000054}, TERRITORY_AU_NT}, // AU-NT
+        {{0x0000434d, 0x000000}, TERRITORY_MAC}, // MC
+        {{0x0054594d, 0x000000}, TERRITORY_MYT}, // MYT
+        {{0x472d4e49, 0x00004a}, TERRITORY_IN_GJ}, // IN-GJ
+        {{0x004d4143, 0x000000}, TERRITORY_MX_CAM}, // CAM
+        {{0x532d584d, 0x004e4f}, TERRITORY_MX_SON}, // MX-SON
+        {{0x00004c4d, 0x000000}, TERRITORY_IN_ML}, // ML
+        {{0x00495448, 0x000000}, TERRITORY_HTI}, // HTI
+        {{0x512d4e43, 0x000048}, TERRITORY_CN_QH}, // CN-QH
+        {{0x00494d55, 0x000000}, TERRITORY_UMI}, // UMI
+        {{0x00564943, 0x000000}, TERRITORY_CIV}, // CIV
+        {{0x00004f53, 0x000000}, TERRITORY_MX_SON}, // SO
+        {{0x442d4e49, 0x00004e}, TERRITORY_IN_DN}, // IN-DN
+        {{0x542d5355, 0x00004e}, TERRITORY_US_TN}, // US-TN
+        {{0x0000414f, 0x000000}, TERRITORY_MX_OAX}, // OA
+        {{0x0000444d, 0x000000}, TERRITORY_US_MD}, // MD
+        {{0x4d2d5355, 0x000041}, TERRITORY_US_MA}, // US-MA
+        {{0x00005954, 0x000000}, TERRITORY_RU_TY}, // TY
+        {{0x442d5552, 0x000041}, TERRITORY_RU_DA}, // RU-DA
+        {{0x00004743, 0x000000}, TERRITORY_IN_CT}, // CG
+        {{0x422d584d, 0x004e43}, TERRITORY_MX_BCN}, // MX-BCN
+        {{0x00004441, 0x000000}, TERRITORY_RU_AD}, // AD
+        {{0x442d584d, 0x004649}, TERRITORY_MX_DIF}, // MX-DIF
+        {{0x432d5355, 0x00004f}, TERRITORY_US_CO}, // US-CO
+        {{0x004e454b, 0x000000}, TERRITORY_KEN}, // KEN
+        {{0x502d5242, 0x000049}, TERRITORY_BR_PI}, // BR-PI
+        {{0x322d4e43, 0x000032}, TERRITORY_CN_JL}, // CN-22
+        {{0x00004542, 0x000000}, TERRITORY_RU_BE}, // BE
+        {{0x4b2d5552, 0x00554c}, TERRITORY_RU_KLU}, // RU-KLU
+        {{0x004e424c, 0x000000}, TERRITORY_LBN}, // LBN
+        {{0x562d5355, 0x000049}, TERRITORY_VIR}, // US-VI
+        {{0x432d4e49, 0x000048}, TERRITORY_IN_CH}, // IN-CH
+        {{0x00465950, 0x000000}, TERRITORY_PYF}, // PYF
+        {{0x4a2d4e43, 0x000058}, TERRITORY_CN_JX}, // CN-JX
+        {{0x482d4e43, 0x00004c}, TERRITORY_CN_HL}, // CN-HL
+        {{0x004e544a, 0x000000}, TERRITORY_UMI}, // JTN
+        {{0x0043414d, 0x000000}, TERRITORY_MAC}, // MAC
+        {{0x00004e4f, 0x000000}, TERRITORY_CA_ON}, // ON
+        {{0x342d4e43, 0x000031}, TERRITORY_CN_HA}, // CN-41
+        {{0x562d5552, 0x004747}, TERRITORY_RU_VGG}, // RU-VGG
+        {{0x0054574b, 0x000000}, TERRITORY_KWT}, // KWT
+        {{0x4d2d5552, 0x00004f}, TERRITORY_RU_MO}, // RU-MO
+        {{0x00455a43, 0x000000}, TERRITORY_CZE}, // CZE
+        {{0x0044494d, 0x000000}, TERRITORY_US_HI}, // MID
+        {{0x522d5242, 0x000052}, TERRITORY_BR_RR}, // BR-RR
+        {{0x0059424c, 0x000000}, TERRITORY_LBY}, // LBY
+        {{0x0053524b, 0x000000}, TERRITORY_RU_KRS}, // KRS
+        {{0x0046415a, 0x000000}, TERRITORY_ZAF}, // ZAF
+        {{0x4e2d5355, 0x000043}, TERRITORY_US_NC}, // US-NC
+        {{0x004d5341, 0x000000}, TERRITORY_ASM}, // ASM
+        {{0x0000524f, 0x000000}, TERRITORY_IN_OR}, // OR
+        {{0x004c4f43, 0x000000}, TERRITORY_COL}, // COL
+        {{0x432d5552, 0x000048}, TERRITORY_RU_CH}, // RU-CH
+        {{0x00425543, 0x000000}, TERRITORY_CUB}, // CUB
+        {{0x4b2d5552, 0x004144}, TERRITORY_RU_KDA}, // RU-KDA
+        {{0x00004543, 0x000000}, TERRITORY_BR_CE}, // CE
+        {{0x4e2d5355, 0x00004a}, TERRITORY_US_NJ}, // US-NJ
+        {{0x00415453, 0x000000}, TERRITORY_RU_STA}, // STA
+        {{0x562d5541, 0x004349}, TERRITORY_AU_VIC}, // AU-VIC
+        {{0x412d4e49, 0x000052}, TERRITORY_IN_AR}, // IN-AR
+        {{0x00415742, 0x000000}, TERRITORY_BWA}, // BWA
+        {{0x552d5355, 0x00004d}, TERRITORY_UMI}, // US-UM
+        {{0x432d4e43, 0x000051}, TERRITORY_CN_CQ}, // CN-CQ
+        {{0x0043494e, 0x000000}, TERRITORY_NIC}, // NIC
+        {{0x00425242, 0x000000}, TERRITORY_BRB}, // BRB
+        {{0x4e2d584d, 0x00004c}, TERRITORY_MX_NLE}, // MX-NL
+        {{0x422d5242, 0x000041}, TERRITORY_BR_BA}, // BR-BA
+        {{0x562d584d, 0x000045}, TERRITORY_MX_VER}, // MX-VE
+        {{0x00484843, 0x000000}, TERRITORY_MX_CHH}, // CHH
+        {{0x00004b48, 0x000000}, TERRITORY_HKG}, // HK
+        {{0x00544156, 0x000000}, TERRITORY_VAT}, // VAT
+        {{0x522d5242, 0x00004e}, TERRITORY_BR_RN}, // BR-RN
+        {{0x00554d42, 0x000000}, TERRITORY_BMU}, // BMU
+        {{0x00005443, 0x000000}, TERRITORY_IN_CT}, // CT
+        {{0x0043494d, 0x000000}, TERRITORY_MX_MIC}, // MIC
+        {{0x00545541, 0x000000}, TERRITORY_AUT}, // AUT
+        {{0x4d2d5552, 0x005255}, TERRITORY_RU_MUR}, // RU-MUR
+        {{0x00515249, 0x000000}, TERRITORY_IRQ}, // IRQ
+        {{0x00525544, 0x000000}, TERRITORY_MX_DUR}, // DUR
+        {{0x00005447, 0x000000}, TERRITORY_MX_GUA}, // GT
+        {{0x0000424e, 0x000000}, TERRITORY_CA_NB}, // NB
+        {{0x005a494e, 0x000000}, TERRITORY_RU_NIZ}, // NIZ
+        {{0x432d584d, 0x000048}, TERRITORY_MX_CHH}, // MX-CH
+        {{0x004c524f, 0x000000}, TERRITORY_RU_ORL}, // ORL
+        {{0x532d5355, 0x000043}, TERRITORY_US_SC}, // US-SC
+        {{0x004f434d, 0x000000}, TERRITORY_MCO}, // MCO
+        {{0x00435341, 0x000000}, TERRITORY_SHN}, // ASC
+        {{0x0000554e, 0x000000}, TERRITORY_CA_NU}, // NU
+        {{0x00004353, 0x000000}, TERRITORY_BR_SC}, // SC
+        {{0x00415246, 0x000000}, TERRITORY_FRA}, // FRA
+        {{0x004b4f43, 0x000000}, TERRITORY_COK}, // COK
+        {{0x502d5242, 0x000041}, TERRITORY_BR_PA}, // BR-PA
+        {{0x00424c53, 0x000000}, TERRITORY_SLB}, // SLB
+        {{0x00415441, 0x000000}, TERRITORY_ATA}, // ATA
+        {{0x4d2d584d, 0x00524f}, TERRITORY_MX_MOR}, // MX-MOR
+        {{0x004c434e, 0x000000}, TERRITORY_NCL}, // NCL
+        {{0x502d5242, 0x000042}, TERRITORY_BR_PB}, // BR-PB
+        {{0x4d2d5355, 0x000049}, TERRITORY_US_MI}, // US-MI
+        {{0x4e2d5552, 0x004e45}, TERRITORY_RU_NEN}, // RU-NEN
+        {{0x532d5552, 0x000045}, TERRITORY_RU_SE}, // RU-SE
+        {{0x4b2d5552, 0x000042}, TERRITORY_RU_KB}, // RU-KB
+        {{0x542d4e49, 0x000047}, TERRITORY_IN_TG}, // IN-TG
+        {{0x00005a47, 0x000000}, TERRITORY_CN_GZ}, // GZ
+        {{0x004d414b, 0x000000}, TERRITORY_RU_KAM}, // KAM
+        {{0x0000414d, 0x000000}, TERRITORY_BR_MA}, // MA
+        {{0x4e2d5552, 0x005a49}, TERRITORY_RU_NIZ}, // RU-NIZ
+        {{0x472d5242, 0x00004f}, TERRITORY_BR_GO}, // BR-GO
+        {{0x552d4e49, 0x000054}, TERRITORY_IN_UT}, // IN-UT
+        {{0x4e2d5355, 0x000048}, TERRITORY_US_NH}, // US-NH
+        {{0x00524842, 0x000000}, TERRITORY_BHR}, // BHR
+        {{0x0041444d, 0x000000}, TERRITORY_MDA}, // MDA
+        {{0x0000464e, 0x000000}, TERRITORY_NFK}, // NF
+        {{0x00425253, 0x000000}, TERRITORY_SRB}, // SRB
+        {{0x0000494d, 0x000000}, TERRITORY_US_MI}, // MI
+        {{0x00455350, 0x000000}, TERRITORY_PSE}, // PSE
+        {{0x572d5355, 0x000059}, TERRITORY_US_WY}, // US-WY
+        {{0x0052534d, 0x000000}, TERRITORY_MSR}, // MSR
+        {{0x4d2d5242, 0x000047}, TERRITORY_BR_MG}, // BR-MG
+        {{0x4a2d4e49, 0x000048}, TERRITORY_IN_JH}, // IN-JH
+        {{0x532d5355, 0x000044}, TERRITORY_US_SD}, // US-SD
+        {{0x00004341, 0x000000}, TERRITORY_BR_AC}, // AC
+        {{0x00474756, 0x000000}, TERRITORY_RU_VGG}, // VGG
+        {{0x00004e52, 0x000000}, TERRITORY_BR_RN}, // RN
+        {{0x482d5541, 0x00004d}, TERRITORY_HMD}, // AU-HM
+        {{0x442d584d, 0x000047}, TERRITORY_MX_DUR}, // MX-DG
+        {{0x512d4143, 0x000043}, TERRITORY_CA_QC}, // CA-QC
+        {{0x532d4143, 0x00004b}, TERRITORY_CA_SK}, // CA-SK
+        {{0x00444b4d, 0x000000}, TERRITORY_MKD}, // MKD
+        {{0x352d4e43, 0x000033}, TERRITORY_CN_YN}, // CN-53
+        {{0x532d5552, 0x004556}, TERRITORY_RU_SVE}, // RU-SVE
+        {{0x00494442, 0x000000}, TERRITORY_BDI}, // BDI
+        {{0x0000564e, 0x000000}, TERRITORY_US_NV}, // NV
+        {{0x00474b48, 0x000000}, TERRITORY_HKG}, // HKG
+        {{0x4a2d584d, 0x000041}, TERRITORY_MX_JAL}, // MX-JA
+        {{0x592d584d, 0x004355}, TERRITORY_MX_YUC}, // MX-YUC
+        {{0x502d5552, 0x004952}, TERRITORY_RU_PO}, // RU-PRI
+        {{0x332d4e43, 0x000033}, TERRITORY_CN_ZJ}, // CN-33
+        {{0x004e4453, 0x000000}, TERRITORY_SDN}, // SDN
+        {{0x00004a52, 0x000000}, TERRITORY_IN_RJ}, // RJ
+        {{0x582d4e43, 0x00005a}, TERRITORY_CN_XZ}, // CN-XZ
+        {{0x592d584d, 0x000055}, TERRITORY_MX_YUC}, // MX-YU
+        {{0x00004950, 0x000000}, TERRITORY_BR_PI}, // PI
+        {{0x00004f50, 0x000000}, TERRITORY_RU_PO}, // PO
+        {{0x004b4343, 0x000000}, TERRITORY_CCK}, // CCK
+        {{0x00005251, 0x000000}, TERRITORY_MX_ROO}, // QR
+        {{0x542d5355, 0x000058}, TERRITORY_US_TX}, // US-TX
+        {{0x00504753, 0x000000}, TERRITORY_SGP}, // SGP
+        {{0x005a4e50, 0x000000}, TERRITORY_RU_PNZ}, // PNZ
+        {{0x412d4e49, 0x000050}, TERRITORY_IN_AP}, // IN-AP
+        {{0x00004644, 0x000000}, TERRITORY_BR_DF}, // DF
+        {{0x4b2d5552, 0x004d48}, TERRITORY_RU_KM}, // RU-KHM
+        {{0x4d2d5355, 0x000050}, TERRITORY_MNP}, // US-MP
+        {{0x442d5355, 0x000045}, TERRITORY_US_DE}, // US-DE
+        {{0x00495245, 0x000000}, TERRITORY_ERI}, // ERI
+        {{0x004b5350, 0x000000}, TERRITORY_RU_PSK}, // PSK
+        {{0x492d5552, 0x004b52}, TERRITORY_RU_IRK}, // RU-IRK
+        {{0x4a2d5541, 0x005442}, TERRITORY_AU_JBT}, // AU-JBT
+        {{0x412d5552, 0x000044}, TERRITORY_RU_AD}, // RU-AD
+        {{0x00005542, 0x000000}, TERRITORY_RU_BU}, // BU
+        {{0x472d584d, 0x004155}, TERRITORY_MX_GUA}, // MX-GUA
+        {{0x412d5355, 0x00004b}, TERRITORY_US_AK}, // US-AK
+        {{0x00554d41, 0x000000}, TERRITORY_RU_AMU}, // AMU
+        {{0x0041594b, 0x000000}, TERRITORY_RU_KYA}, // KYA
+        {{0x4e2d5355, 0x000056}, TERRITORY_US_NV}, // US-NV
+        {{0x00425a55, 0x000000}, TERRITORY_UZB}, // UZB
+        {{0x542d584d, 0x00414c}, TERRITORY_MX_TLA}, // MX-TLA
+        {{0x342d4e43, 0x000033}, TERRITORY_CN_HN}, // CN-43
+        {{0x0000594e, 0x000000}, TERRITORY_US_NY}, // NY
+        {{0x572d5541, 0x000041}, TERRITORY_AU_WA}, // AU-WA
+        {{0x432d584d, 0x00414f}, TERRITORY_MX_COA}, // MX-COA
+        {{0x004f4547, 0x000000}, TERRITORY_GEO}, // GEO
+        {{0x472d4e43, 0x00005a}, TERRITORY_CN_GZ}, // CN-GZ
+        {{0x412d4e43, 0x000048}, TERRITORY_CN_AH}, // CN-AH
+        {{0x004d5346, 0x000000}, TERRITORY_FSM}, // FSM
+        {{0x0000454d, 0x000000}, TERRITORY_US_ME}, // ME
+        {{0x00004e41, 0x000000}, TERRITORY_IN_AN}, // AN
+        {{0x352d4e43, 0x000034}, TERRITORY_CN_XZ}, // CN-54
+        {{0x542d4e49, 0x000052}, TERRITORY_IN_TR}, // IN-TR
+        {{0x00005843, 0x000000}, TERRITORY_CXR}, // CX
+        {{0x00495250, 0x000000}, TERRITORY_PRI}, // PRI
+        {{0x0000484a, 0x000000}, TERRITORY_IN_JH}, // JH
+        {{0x004c4542, 0x000000}, TERRITORY_BEL}, // BEL
+        {{0x004d4154, 0x000000}, TERRITORY_MX_TAM}, // TAM
+        {{0x004c5247, 0x000000}, TERRITORY_GRL}, // GRL
+        {{0x00415449, 0x000000}, TERRITORY_ITA}, // ITA
+        {{0x502d5552, 0x00004f}, TERRITORY_RU_PO}, // RU-PO
+        {{0x412d5552, 0x00554d}, TERRITORY_RU_AMU}, // RU-AMU
+        {{0x00444c4e, 0x000000}, TERRITORY_NLD}, // NLD
+        {{0x00004e4c, 0x000000}, TERRITORY_CN_LN}, // LN
+        {{0x00464143, 0x000000}, TERRITORY_CAF}, // CAF
+        {{0x4b2d4e49, 0x000041}, TERRITORY_IN_KA}, // IN-KA
+        {{0x00004248, 0x000000}, TERRITORY_CN_HB}, // HB
+        {{0x00475241, 0x000000}, TERRITORY_ARG}, // ARG
+        {{0x00004257, 0x000000}, TERRITORY_IN_WB}, // WB
+        {{0x004f5454, 0x000000}, TERRITORY_TTO}, // TTO
+        {{0x522d5355, 0x000049}, TERRITORY_US_RI}, // US-RI
+        {{0x432d584d, 0x004c4f}, TERRITORY_MX_CL}, // MX-COL
+        {{0x00004154, 0x000000}, TERRITORY_RU_TA}, // TA
+        {{0x432d5541, 0x000058}, TERRITORY_CXR}, // AU-CX
+        {{0x00004c46, 0x000000}, TERRITORY_US_FL}, // FL
+        {{0x502d5355, 0x000041}, TERRITORY_US_PA}, // US-PA
+        {{0x004c5249, 0x000000}, TERRITORY_IRL}, // IRL
+        {{0x4f2d5552, 0x004552}, TERRITORY_RU_ORE}, // RU-ORE
+        {{0x482d4e43, 0x000041}, TERRITORY_CN_HA}, // CN-HA
+        {{0x572d5355, 0x000049}, TERRITORY_US_WI}, // US-WI
+        {{0x4e2d4e43, 0x00004d}, TERRITORY_CN_NM}, // CN-NM
+        {{0x512d584d, 0x004555}, TERRITORY_MX_QUE}, // MX-QUE
+        {{0x0046414d, 0x000000}, TERRITORY_MAF}, // MAF
+        {{0x0057534e, 0x000000}, TERRITORY_AU_NSW}, // NSW
+        {{0x004f414c, 0x000000}, TERRITORY_LAO}, // LAO
+        {{0x00005341, 0x000000}, TERRITORY_IN_AS}, // AS
+        {{0x4d2d5242, 0x000054}, TERRITORY_BR_MT}, // BR-MT
+        {{0x00005957, 0x000000}, TERRITORY_US_WY}, // WY
+        {{0x004d414e, 0x000000}, TERRITORY_NAM}, // NAM
+        {{0x412d4e49, 0x00004e}, TERRITORY_IN_AN}, // IN-AN
+        {{0x4d2d5355, 0x000045}, TERRITORY_US_ME}, // US-ME
+        {{0x00544c4d, 0x000000}, TERRITORY_MLT}, // MLT
+        {{0x00004e4d, 0x000000}, TERRITORY_IN_MN}, // MN
+        {{0x00004241, 0x000000}, TERRITORY_CA_AB}, // AB
+        {{0x4e2d5355, 0x000044}, TERRITORY_US_ND}, // US-ND
+        {{0x00524d53, 0x000000}, TERRITORY_SMR}, // SMR
+        {{0x00005250, 0x000000}, TERRITORY_BR_PR}, // PR
+        {{0x0000434e, 0x000000}, TERRITORY_US_NC}, // NC
+        {{0x412d5242, 0x00004d}, TERRITORY_BR_AM}, // BR-AM
+        {{0x522d584d, 0x004f4f}, TERRITORY_MX_ROO}, // MX-ROO
+        {{0x00004d43, 0x000000}, TERRITORY_MX_CAM}, // CM
+        {{0x532d5541, 0x000041}, TERRITORY_AU_SA}, // AU-SA
+        {{0x4d2d4e49, 0x00004c}, TERRITORY_IN_ML}, // IN-ML
+        {{0x00004b55, 0x000000}, TERRITORY_IN_UT}, // UK
+        {{0x482d4e43, 0x00004e}, TERRITORY_CN_HN}, // CN-HN
+        {{0x00004342, 0x000000}, TERRITORY_CA_BC}, // BC
+        {{0x0000484e, 0x000000}, TERRITORY_US_NH}, // NH
+        {{0x4d2d5355, 0x000053}, TERRITORY_US_MS}, // US-MS
+        {{0x004d4f54, 0x000000}, TERRITORY_RU_TOM}, // TOM
+        {{0x00004455, 0x000000}, TERRITORY_RU_UD}, // UD
+        {{0x00424147, 0x000000}, TERRITORY_GAB}, // GAB
+        {{0x004b464e, 0x000000}, TERRITORY_NFK}, // NFK
+        {{0x5a2d584d, 0x004341}, TERRITORY_MX_ZAC}, // MX-ZAC
+        {{0x532d584d, 0x004e49}, TERRITORY_MX_SIN}, // MX-SIN
+        {{0x00534c54, 0x000000}, TERRITORY_TLS}, // TLS
+        {{0x00415752, 0x000000}, TERRITORY_RWA}, // RWA
+        {{0x00574241, 0x000000}, TERRITORY_ABW}, // ABW
+        {{0x004c484d, 0x000000}, TERRITORY_MHL}, // MHL
+        {{0x0000504d, 0x000000}, TERRITORY_IN_MP}, // MP
+        {{0x492d5355, 0x00004c}, TERRITORY_US_IL}, // US-IL
+        {{0x00595250, 0x000000}, TERRITORY_PRY}, // PRY
+        {{0x0000524b, 0x000000}, TERRITORY_RU_KR}, // KR
+        {{0x00524f4b, 0x000000}, TERRITORY_KOR}, // KOR
+        {{0x00554741, 0x000000}, TERRITORY_MX_AGU}, // AGU
+        {{0x492d5552, 0x00004e}, TERRITORY_RU_IN}, // RU-IN
+        {{0x00444d48, 0x000000}, TERRITORY_HMD}, // HMD
+        {{0x4d2d4143, 0x000042}, TERRITORY_CA_MB}, // CA-MB
+        {{0x004e4342, 0x000000}, TERRITORY_MX_BCN}, // BCN
+        {{0x00414941, 0x000000}, TERRITORY_AIA}, // AIA
+        {{0x00414154, 0x000000}, TERRITORY_SHN}, // TAA
+        {{0x0047444d, 0x000000}, TERRITORY_MDG}, // MDG
+        {{0x432d5552, 0x004548}, TERRITORY_RU_CH}, // RU-CHE
+        {{0x362d4e43, 0x000034}, TERRITORY_CN_NX}, // CN-64
+        {{0x004e4d49, 0x000000}, TERRITORY_IMN}, // IMN
+        {{0x00455653, 0x000000}, TERRITORY_RU_SVE}, // SVE
+        {{0x00524f4e, 0x000000}, TERRITORY_NOR}, // NOR
+        {{0x00415a54, 0x000000}, TERRITORY_TZA}, // TZA
+        {{0x00505943, 0x000000}, TERRITORY_CYP}, // CYP
+        {{0x00004550, 0x000000}, TERRITORY_BR_PE}, // PE
+        {{0x00004c4b, 0x000000}, TERRITORY_IN_KL}, // KL
+        {{0x004e5249, 0x000000}, TERRITORY_IRN}, // IRN
+        {{0x004d5943, 0x000000}, TERRITORY_CYM}, // CYM
+        {{0x00005241, 0x000000}, TERRITORY_IN_AR}, // AR
+        {{0x005a414b, 0x000000}, TERRITORY_KAZ}, // KAZ
+        {{0x00004553, 0x000000}, TERRITORY_BR_SE}, // SE
+        {{0x00514e47, 0x000000}, TERRITORY_GNQ}, // GNQ
+        {{0x552d5552, 0x000044}, TERRITORY_RU_UD}, // RU-UD
+        {{0x00475441, 0x000000}, TERRITORY_ATG}, // ATG
+        {{0x00465547, 0x000000}, TERRITORY_GUF}, // GUF
+        {{0x4e2d4e49, 0x00004c}, TERRITORY_IN_NL}, // IN-NL
+        {{0x4d2d4e49, 0x00004e}, TERRITORY_IN_MN}, // IN-MN
+        {{0x422d584d, 0x000043}, TERRITORY_MX_BCN}, // MX-BC
+        {{0x352d4e43, 0x000030}, TERRITORY_CN_CQ}, // CN-50
+        {{0x532d5552, 0x000041}, TERRITORY_RU_SA}, // RU-SA
+        {{0x004e5242, 0x000000}, TERRITORY_BRN}, // BRN
+        {{0x00005053, 0x000000}, TERRITORY_BR_SP}, // SP
+        {{0x552d5355, 0x000054}, TERRITORY_US_UT}, // US-UT
+        {{0x4d2d5355, 0x00004e}, TERRITORY_US_MN}, // US-MN
+        {{0x00594747, 0x000000}, TERRITORY_GGY}, // GGY
+        {{0x00004d48, 0x000000}, TERRITORY_HMD}, // HM
+        {{0x00004449, 0x000000}, TERRITORY_US_ID}, // ID
+        {{0x0052454e, 0x000000}, TERRITORY_NER}, // NER
+        {{0x482d4e43, 0x000045}, TERRITORY_CN_HE}, // CN-HE
+        {{0x0041474e, 0x000000}, TERRITORY_NGA}, // NGA
+        {{0x00594c55, 0x000000}, TERRITORY_RU_ULY}, // ULY
+        {{0x00564c53, 0x000000}, TERRITORY_SLV}, // SLV
+        {{0x00004f4d, 0x000000}, TERRITORY_US_MO}, // MO
+        {{0x4d2d5242, 0x000053}, TERRITORY_BR_MS}, // BR-MS
+        {{0x4b2d5552, 0x005249}, TERRITORY_RU_KI}, // RU-KIR
+        {{0x482d4e43, 0x00004b}, TERRITORY_HKG}, // CN-HK
+        {{0x562d5552, 0x00414c}, TERRITORY_RU_VLA}, // RU-VLA
+        {{0x00004142, 0x000000}, TERRITORY_BR_BA}, // BA
+        {{0x4d2d584d, 0x00004f}, TERRITORY_MX_MOR}, // MX-MO
+        {{0x542d5242, 0x00004f}, TERRITORY_BR_TO}, // BR-TO
+        {{0x00004f43, 0x000000}, TERRITORY_US_CO}, // CO
+        {{0x0058554c, 0x000000}, TERRITORY_LUX}, // LUX
+        {{0x00005352, 0x000000}, TERRITORY_BR_RS}, // RS
+        {{0x432d5242, 0x000045}, TERRITORY_BR_CE}, // BR-CE
+        {{0x004c414a, 0x000000}, TERRITORY_MX_JAL}, // JAL
+        {{0x00004843, 0x000000}, TERRITORY_IN_CH}, // CH
+        {{0x512d584d, 0x000052}, TERRITORY_MX_ROO}, // MX-QR
+        {{0x00554f52, 0x000000}, TERRITORY_ROU}, // ROU
+        {{0x00004c4e, 0x000000}, TERRITORY_IN_NL}, // NL
+        {{0x00524153, 0x000000}, TERRITORY_RU_SAR}, // SAR
+        {{0x00535541, 0x000000}, TERRITORY_AUS}, // AUS
+        {{0x512d584d, 0x000045}, TERRITORY_MX_QUE}, // MX-QE
+        {{0x004f4741, 0x000000}, TERRITORY_AGO}, // AGO
+        {{0x004f534c, 0x000000}, TERRITORY_LSO}, // LSO
+        {{0x004b4e44, 0x000000}, TERRITORY_DNK}, // DNK
+        {{0x492d5355, 0x00004e}, TERRITORY_US_IN}, // US-IN
+        {{0x4b2d5552, 0x004148}, TERRITORY_RU_KHA}, // RU-KHA
+        {{0x00005345, 0x000000}, TERRITORY_BR_ES}, // ES
+        {{0x0000414b, 0x000000}, TERRITORY_IN_KA}, // KA
+        {{0x00004e48, 0x000000}, TERRITORY_CN_HN}, // HN
+        {{0x00424c41, 0x000000}, TERRITORY_ALB}, // ALB
+        {{0x442d584d, 0x000046}, TERRITORY_MX_DIF}, // MX-DF
+        {{0x00545556, 0x000000}, TERRITORY_VUT}, // VUT
+        {{0x00414854, 0x000000}, TERRITORY_THA}, // THA
+        {{0x0041444b, 0x000000}, TERRITORY_RU_KDA}, // KDA
+        {{0x4d2d584d, 0x000045}, TERRITORY_MX_MX}, // MX-ME
+        {{0x004e4d4f, 0x000000}, TERRITORY_OMN}, // OMN
+        {{0x412d5242, 0x000043}, TERRITORY_BR_AC}, // BR-AC
+        {{0x00004a47, 0x000000}, TERRITORY_IN_GJ}, // GJ
+        {{0x00544151, 0x000000}, TERRITORY_QAT}, // QAT
+        {{0x0042415a, 0x000000}, TERRITORY_RU_ZAB}, // ZAB
+        {{0x0051544d, 0x000000}, TERRITORY_MTQ}, // MTQ
+        {{0x004c4850, 0x000000}, TERRITORY_PHL}, // PHL
+        {{0x00415649, 0x000000}, TERRITORY_RU_IVA}, // IVA
+        {{0x00554c4b, 0x000000}, TERRITORY_RU_KLU}, // KLU
+        {{0x4d2d4e49, 0x000048}, TERRITORY_IN_MH}, // IN-MH
+        {{0x0000415a, 0x000000}, TERRITORY_MX_ZAC}, // ZA
+        {{0x00414b4c, 0x000000}, TERRITORY_LKA}, // LKA
+        {{0x392d4e43, 0x000032}, TERRITORY_MAC}, // CN-92
+        {{0x0055494e, 0x000000}, TERRITORY_NIU}, // NIU
+        {{0x4d2d4e49, 0x00005a}, TERRITORY_IN_MZ}, // IN-MZ
+        {{0x0000424d, 0x000000}, TERRITORY_CA_MB}, // MB
+        {{0x004e4553, 0x000000}, TERRITORY_SEN}, // SEN
+        {{0x4d2d584d, 0x005845}, TERRITORY_MX_MX}, // MX-MEX
+        {{0x4f2d5552, 0x004c52}, TERRITORY_RU_ORL}, // RU-ORL
+        {{0x532d584d, 0x00004c}, TERRITORY_MX_SLP}, // MX-SL
+        {{0x00415952, 0x000000}, TERRITORY_RU_RYA}, // RYA
+        {{0x0000484d, 0x000000}, TERRITORY_IN_MH}, // MH
+        {{0x362d4e43, 0x000031}, TERRITORY_CN_SN}, // CN-61
+        {{0x4a2d4e49, 0x00004b}, TERRITORY_IN_JK}, // IN-JK
+        {{0x004e474b, 0x000000}, TERRITORY_RU_KGN}, // KGN
+        {{0x4d2d5355, 0x00004f}, TERRITORY_US_MO}, // US-MO
+        {{0x0000534e, 0x000000}, TERRITORY_CA_NS}, // NS
+        {{0x0055524e, 0x000000}, TERRITORY_NRU}, // NRU
+        {{0x004c4f50, 0x000000}, TERRITORY_POL}, // POL
+        {{0x00465441, 0x000000}, TERRITORY_ATF}, // ATF
+        {{0x00444e49, 0x000000}, TERRITORY_IND}, // IND
+        {{0x00005242, 0x000000}, TERRITORY_IN_BR}, // BR
+        {{0x512d5541, 0x00444c}, TERRITORY_AU_QLD}, // AU-QLD
+        {{0x004b4153, 0x000000}, TERRITORY_RU_SAK}, // SAK
+        {{0x00554544, 0x000000}, TERRITORY_DEU}, // DEU
+        {{0x0000534d, 0x000000}, TERRITORY_BR_MS}, // MS
+        {{0x542d5552, 0x000054}, TERRITORY_RU_TT}, // RU-TT
+        {{0x312d4e43, 0x000032}, TERRITORY_CN_TJ}, // CN-12
+        {{0x00435559, 0x000000}, TERRITORY_MX_YUC}, // YUC
+        {{0x004d4f44, 0x000000}, TERRITORY_DOM}, // DOM
+        {{0x00595547, 0x000000}, TERRITORY_GUY}, // GUY
+        {{0x00005454, 0x000000}, TERRITORY_RU_TT}, // TT
+        {{0x4b2d5552, 0x004159}, TERRITORY_RU_KYA}, // RU-KYA
+        {{0x00004444, 0x000000}, TERRITORY_IN_DD}, // DD
+        {{0x552d4e49, 0x00004b}, TERRITORY_IN_UT}, // IN-UK
+        {{0x4b2d5355, 0x000059}, TERRITORY_US_KY}, // US-KY
+        {{0x472d584d, 0x004f52}, TERRITORY_MX_GRO}, // MX-GRO
+        {{0x004f5247, 0x000000}, TERRITORY_MX_GRO}, // GRO
+        {{0x422d5552, 0x000041}, TERRITORY_RU_BA}, // RU-BA
+        {{0x00524d43, 0x000000}, TERRITORY_CMR}, // CMR
+        {{0x4f2d584d, 0x000041}, TERRITORY_MX_OAX}, // MX-OA
+        {{0x572d5355, 0x000041}, TERRITORY_US_WA}, // US-WA
+        {{0x004e4143, 0x000000}, TERRITORY_CAN}, // CAN
+        {{0x00474c56, 0x000000}, TERRITORY_RU_VLG}, // VLG
+        {{0x004d5547, 0x000000}, TERRITORY_GUM}, // GUM
+        {{0x502d5355, 0x000052}, TERRITORY_PRI}, // US-PR
+        {{0x00415547, 0x000000}, TERRITORY_MX_GUA}, // GUA
+        {{0x00005343, 0x000000}, TERRITORY_MX_CHP}, // CS
+        {{0x542d5552, 0x000041}, TERRITORY_RU_TA}, // RU-TA
+        {{0x00414c56, 0x000000}, TERRITORY_RU_VLA}, // VLA
+        {{0x00004f4b, 0x000000}, TERRITORY_RU_KO}, // KO
+        {{0x0000454e, 0x000000}, TERRITORY_US_NE}, // NE
+        {{0x0000534b, 0x000000}, TERRITORY_US_KS}, // KS
+        {{0x00414354, 0x000000}, TERRITORY_TCA}, // TCA
+        {{0x00005a41, 0x000000}, TERRITORY_US_AZ}, // AZ
+        {{0x00545341, 0x000000}, TERRITORY_RU_AST}, // AST
+        {{0x00444f43, 0x000000}, TERRITORY_COD}, // COD
+        {{0x00494a46, 0x000000}, TERRITORY_FJI}, // FJI
+        {{0x00505345, 0x000000}, TERRITORY_ESP}, // ESP
+        {{0x432d584d, 0x00004c}, TERRITORY_MX_CL}, // MX-CL
+        {{0x00464944, 0x000000}, TERRITORY_MX_DIF}, // DIF
+        {{0x00565043, 0x000000}, TERRITORY_CPV}, // CPV
+        {{0x00524556, 0x000000}, TERRITORY_MX_VER}, // VER
+        {{0x472d4e43, 0x000058}, TERRITORY_CN_GX}, // CN-GX
+        {{0x532d5552, 0x004d41}, TERRITORY_RU_SAM}, // RU-SAM
+        {{0x412d5355, 0x00004c}, TERRITORY_US_AL}, // US-AL
+        {{0x00435953, 0x000000}, TERRITORY_SYC}, // SYC
+        {{0x00004f52, 0x000000}, TERRITORY_BR_RO}, // RO
+        {{0x4d2d5552, 0x00574f}, TERRITORY_RU_MOW}, // RU-MOW
+        {{0x502d584d, 0x000042}, TERRITORY_MX_PUE}, // MX-PB
+        {{0x0052554d, 0x000000}, TERRITORY_RU_MUR}, // MUR
+        {{0x532d5242, 0x000043}, TERRITORY_BR_SC}, // BR-SC
+        {{0x0000534a, 0x000000}, TERRITORY_CN_JS}, // JS
+        {{0x4b2d5552, 0x00004b}, TERRITORY_RU_KK}, // RU-KK
+        {{0x00534542, 0x000000}, TERRITORY_BES}, // BES
+        {{0x0052424c, 0x000000}, TERRITORY_LBR}, // LBR
+        {{0x502d4e49, 0x000042}, TERRITORY_IN_PB}, // IN-PB
+        {{0x00004153, 0x000000}, TERRITORY_AU_SA}, // SA
+        {{0x00005847, 0x000000}, TERRITORY_CN_GX}, // GX
+        {{0x4f2d4e49, 0x000052}, TERRITORY_IN_OR}, // IN-OR
+        {{0x00004c43, 0x000000}, TERRITORY_MX_CL}, // CL
+        {{0x462d4e43, 0x00004a}, TERRITORY_CN_FJ}, // CN-FJ
+        {{0x004f4f52, 0x000000}, TERRITORY_MX_ROO}, // ROO
+        {{0x00005547, 0x000000}, TERRITORY_GUM}, // GU
+        {{0x00004d55, 0x000000}, TERRITORY_UMI}, // UM
+        {{0x00005355, 0x000000}, TERRITORY_USA}, // US
+        {{0x00005347, 0x000000}, TERRITORY_CN_GS}, // GS
+        {{0x00534f52, 0x000000}, TERRITORY_RU_ROS}, // ROS
+        {{0x0058454d, 0x000000}, TERRITORY_MEX}, // MEX
+        {{0x4e2d5541, 0x005753}, TERRITORY_AU_NSW}, // AU-NSW
+        {{0x0058414f, 0x000000}, TERRITORY_MX_OAX}, // OAX
+        {{0x00415a44, 0x000000}, TERRITORY_DZA}, // DZA
+        {{0x00414755, 0x000000}, TERRITORY_UGA}, // UGA
+        {{0x00524b55, 0x000000}, TERRITORY_UKR}, // UKR
+        {{0x0000414e, 0x000000}, TERRITORY_MX_NAY}, // NA
+        {{0x00004d41, 0x000000}, TERRITORY_BR_AM}, // AM
+        {{0x00524159, 0x000000}, TERRITORY_RU_YAR}, // YAR
+        {{0x4b2d5552, 0x000049}, TERRITORY_RU_KI}, // RU-KI
+        {{0x362d4e43, 0x000033}, TERRITORY_CN_QH}, // CN-63
+        {{0x004d4c42, 0x000000}, TERRITORY_BLM}, // BLM
+        {{0x004d5357, 0x000000}, TERRITORY_WSM}, // WSM
+        {{0x492d5552, 0x004156}, TERRITORY_RU_IVA}, // RU-IVA
+        {{0x00004e43, 0x000000}, TERRITORY_CHN}, // CN
+        {{0x00445247, 0x000000}, TERRITORY_GRD}, // GRD
+        {{0x542d5552, 0x004556}, TERRITORY_RU_TVE}, // RU-TVE
+        {{0x412d5552, 0x005453}, TERRITORY_RU_AST}, // RU-AST
+        {{0x4b2d5552, 0x00004d}, TERRITORY_RU_KM}, // RU-KM
+        {{0x0049574d, 0x000000}, TERRITORY_MWI}, // MWI
+        {{0x004d414a, 0x000000}, TERRITORY_JAM}, // JAM
+        {{0x00444e48, 0x000000}, TERRITORY_HND}, // HND
+        {{0x0000544d, 0x000000}, TERRITORY_BR_MT}, // MT
+        {{0x00004c48, 0x000000}, TERRITORY_CN_HL}, // HL
+        {{0x0059414e, 0x000000}, TERRITORY_MX_NAY}, // NAY
+        {{0x592d5552, 0x004e41}, TERRITORY_RU_YAN}, // RU-YAN
+        {{0x482d4e43, 0x000049}, TERRITORY_CN_HI}, // CN-HI
+        {{0x00534f4d, 0x000000}, TERRITORY_RU_MOS}, // MOS
+        {{0x00005342, 0x000000}, TERRITORY_MX_BCS}, // BS
+        {{0x00004e54, 0x000000}, TERRITORY_IN_TN}, // TN
+        {{0x00004b4b, 0x000000}, TERRITORY_RU_KK}, // KK
+        {{0x00455053, 0x000000}, TERRITORY_RU_SPE}, // SPE
+        {{0x00005543, 0x000000}, TERRITORY_RU_CU}, // CU
+        {{0x0055544c, 0x000000}, TERRITORY_LTU}, // LTU
+        {{0x482d584d, 0x004449}, TERRITORY_MX_HID}, // MX-HID
+        {{0x502d584d, 0x004555}, TERRITORY_MX_PUE}, // MX-PUE
+        {{0x532d5552, 0x004f4d}, TERRITORY_RU_SMO}, // RU-SMO
+        {{0x4e2d4143, 0x000053}, TERRITORY_CA_NS}, // CA-NS
+        {{0x4e2d584d, 0x000041}, TERRITORY_MX_NAY}, // MX-NA
+        {{0x4d2d5552, 0x00534f}, TERRITORY_RU_MOS}, // RU-MOS
+        {{0x00434956, 0x000000}, TERRITORY_AU_VIC}, // VIC
+        {{0x422d5552, 0x000045}, TERRITORY_RU_BE}, // RU-BE
+        {{0x412d4e49, 0x000053}, TERRITORY_IN_AS}, // IN-AS
+        {{0x00414d44, 0x000000}, TERRITORY_DMA}, // DMA
+        {{0x312d4e43, 0x000035}, TERRITORY_CN_NM}, // CN-15
+        {{0x00545642, 0x000000}, TERRITORY_BVT}, // BVT
+        {{0x00415355, 0x000000}, TERRITORY_USA}, // USA
+        {{0x00005041, 0x000000}, TERRITORY_IN_AP}, // AP
+        {{0x00534342, 0x000000}, TERRITORY_MX_BCS}, // BCS
+        {{0x532d584d, 0x00004f}, TERRITORY_MX_SON}, // MX-SO
+        {{0x00005455, 0x000000}, TERRITORY_IN_UT}, // UT
+        {{0x0053554d, 0x000000}, TERRITORY_MUS}, // MUS
+        {{0x542d5552, 0x005559}, TERRITORY_RU_TYU}, // RU-TYU
+        {{0x004d4f53, 0x000000}, TERRITORY_SOM}, // SOM
+        {{0x004d5241, 0x000000}, TERRITORY_ARM}, // ARM
+        {{0x532d5242, 0x000045}, TERRITORY_BR_SE}, // BR-SE
+        {{0x4b2d5552, 0x000043}, TERRITORY_RU_KC}, // RU-KC
+        {{0x00005247, 0x000000}, TERRITORY_MX_GRO}, // GR
+        {{0x0000414c, 0x000000}, TERRITORY_US_LA}, // LA
+        {{0x342d4e43, 0x000036}, TERRITORY_CN_HI}, // CN-46
+        {{0x00004351, 0x000000}, TERRITORY_CA_QC}, // QC
+        {{0x00004b53, 0x000000}, TERRITORY_IN_SK}, // SK
+        {{0x452d5242, 0x000053}, TERRITORY_BR_ES}, // BR-ES
+        {{0x004e504a, 0x000000}, TERRITORY_JPN}, // JPN
+        {{0x542d5552, 0x000059}, TERRITORY_RU_TY}, // RU-TY
+        {{0x004e5754, 0x000000}, TERRITORY_TWN}, // TWN
+        {{0x00554345, 0x000000}, TERRITORY_ECU}, // ECU
+        {{0x532d5552, 0x004154}, TERRITORY_RU_STA}, // RU-STA
+        {{0x322d4e43, 0x000031}, TERRITORY_CN_LN}, // CN-21
+        {{0x502d5242, 0x000045}, TERRITORY_BR_PE}, // BR-PE
+        {{0x4e2d5355, 0x000059}, TERRITORY_US_NY}, // US-NY
+        {{0x472d584d, 0x000052}, TERRITORY_MX_GRO}, // MX-GR
+        {{0x00485345, 0x000000}, TERRITORY_ESH}, // ESH
+        {{0x00004144, 0x000000}, TERRITORY_RU_DA}, // DA
+        {{0x4e2d5541, 0x000046}, TERRITORY_NFK}, // AU-NF
+        {{0x00474641, 0x000000}, TERRITORY_AFG}, // AFG
+        {{0x542d584d, 0x004241}, TERRITORY_MX_TAB}, // MX-TAB
+        {{0x00004a46, 0x000000}, TERRITORY_CN_FJ}, // FJ
+        {{0x532d4e43, 0x00004e}, TERRITORY_CN_SN}, // CN-SN
+        {{0x4c2d4e49, 0x000044}, TERRITORY_IN_LD}, // IN-LD
+        {{0x432d584d, 0x004d41}, TERRITORY_MX_CAM}, // MX-CAM
+        {{0x4c2d4e43, 0x00004e}, TERRITORY_CN_LN}, // CN-LN
+        {{0x442d4e49, 0x000044}, TERRITORY_IN_DD}, // IN-DD
+        {{0x542d5541, 0x005341}, TERRITORY_AU_TAS}, // AU-TAS
+        {{0x00004c49, 0x000000}, TERRITORY_US_IL}, // IL
+        {{0x00004c44, 0x000000}, TERRITORY_IN_DL}, // DL
+        {{0x00524247, 0x000000}, TERRITORY_GBR}, // GBR
+        {{0x0045524f, 0x000000}, TERRITORY_RU_ORE}, // ORE
+        {{0x532d4e43, 0x000048}, TERRITORY_CN_SH}, // CN-SH
+        {{0x004c504e, 0x000000}, TERRITORY_NPL}, // NPL
+        {{0x00534d4f, 0x000000}, TERRITORY_RU_OMS}, // OMS
+        {{0x4b2d5552, 0x000052}, TERRITORY_RU_KR}, // RU-KR
+        {{0x00004f54, 0x000000}, TERRITORY_BR_TO}, // TO
+        {{0x00005754, 0x000000}, TERRITORY_TWN}, // TW
+        {{0x00414642, 0x000000}, TERRITORY_BFA}, // BFA
+        {{0x592d4143, 0x000054}, TERRITORY_CA_YT}, // CA-YT
+        {{0x472d5355, 0x000041}, TERRITORY_US_GA}, // US-GA
+        {{0x532d5552, 0x004b41}, TERRITORY_RU_SAK}, // RU-SAK
+        {{0x00004f47, 0x000000}, TERRITORY_BR_GO}, // GO
+        {{0x004e4f53, 0x000000}, TERRITORY_MX_SON}, // SON
+        {{0x0000584d, 0x000000}, TERRITORY_MX_MX}, // MX
+        {{0x004e4946, 0x000000}, TERRITORY_FIN}, // FIN
+        {{0x4c2d5552, 0x005049}, TERRITORY_RU_LIP}, // RU-LIP
+        {{0x4d2d5355, 0x000054}, TERRITORY_US_MT}, // US-MT
+        {{0x0041564c, 0x000000}, TERRITORY_LVA}, // LVA
+        {{0x0000444c, 0x000000}, TERRITORY_IN_LD}, // LD
+        {{0x0000424b, 0x000000}, TERRITORY_RU_KB}, // KB
+        {{0x4e2d5552, 0x005247}, TERRITORY_RU_NGR}, // RU-NGR
+        {{0x472d4e49, 0x000041}, TERRITORY_IN_GA}, // IN-GA
+        {{0x00575543, 0x000000}, TERRITORY_CUW}, // CUW
+        {{0x004d4a53, 0x000000}, TERRITORY_SJM}, // SJM
+        {{0x332d4e43, 0x000031}, TERRITORY_CN_SH}, // CN-31
+        {{0x00005657, 0x000000}, TERRITORY_US_WV}, // WV
+        {{0x432d5552, 0x000055}, TERRITORY_RU_CU}, // RU-CU
+        {{0x00524d4d, 0x000000}, TERRITORY_MMR}, // MMR
+        {{0x5a2d5552, 0x004241}, TERRITORY_RU_ZAB}, // RU-ZAB
+        {{0x412d5552, 0x004b52}, TERRITORY_RU_ARK}, // RU-ARK
+        {{0x004e4449, 0x000000}, TERRITORY_IDN}, // IDN
+        {{0x00424947, 0x000000}, TERRITORY_GIB}, // GIB
+        {{0x342d4e43, 0x000035}, TERRITORY_CN_GX}, // CN-45
+        {{0x004e4953, 0x000000}, TERRITORY_MX_SIN}, // SIN
+        {{0x532d5242, 0x000050}, TERRITORY_BR_SP}, // BR-SP
+        {{0x00004150, 0x000000}, TERRITORY_BR_PA}, // PA
+        {{0x00004748, 0x000000}, TERRITORY_MX_HID}, // HG
+        {{0x004e5442, 0x000000}, TERRITORY_BTN}, // BTN
+        {{0x004b4157, 0x000000}, TERRITORY_MHL}, // WAK
+        {{0x422d5552, 0x000055}, TERRITORY_RU_BU}, // RU-BU
+        {{0x5a2d4e43, 0x00004a}, TERRITORY_CN_ZJ}, // CN-ZJ
+        {{0x00534f4b, 0x000000}, TERRITORY_RU_KOS}, // KOS
+        {{0x432d584d, 0x004848}, TERRITORY_MX_CHH}, // MX-CHH
+        {{0x472d4e43, 0x000044}, TERRITORY_CN_GD}, // CN-GD
+        {{0x4e2d584d, 0x00454c}, TERRITORY_MX_NLE}, // MX-NLE
+        {{0x00004c53, 0x000000}, TERRITORY_MX_SLP}, // SL
+        {{0x4b2d5552, 0x005352}, TERRITORY_RU_KRS}, // RU-KRS
+        {{0x00004948, 0x000000}, TERRITORY_US_HI}, // HI
+        {{0x532d584d, 0x000049}, TERRITORY_MX_SIN}, // MX-SI
+        {{0x502d5242, 0x000052}, TERRITORY_BR_PR}, // BR-PR
+        {{0x592d5552, 0x005645}, TERRITORY_RU_YEV}, // RU-YEV
+        {{0x00494c4d, 0x000000}, TERRITORY_MLI}, // MLI
+        {{0x00544f49, 0x000000}, TERRITORY_IOT}, // IOT
+        {{0x4e2d4143, 0x000055}, TERRITORY_CA_NU}, // CA-NU
+        {{0x532d4e49, 0x00004b}, TERRITORY_IN_SK}, // IN-SK
+        {{0x422d4143, 0x000043}, TERRITORY_CA_BC}, // CA-BC
+        {{0x0054524d, 0x000000}, TERRITORY_MRT}, // MRT
+        {{0x562d5355, 0x000041}, TERRITORY_US_VA}, // US-VA
+        {{0x00004d54, 0x000000}, TERRITORY_MX_TAM}, // TM
+        {{0x0050494c, 0x000000}, TERRITORY_RU_LIP}, // LIP
+        {{0x00595242, 0x000000}, TERRITORY_RU_BRY}, // BRY
+        {{0x362d4e43, 0x000032}, TERRITORY_CN_GS}, // CN-62
+        {{0x00525953, 0x000000}, TERRITORY_SYR}, // SYR
+        {{0x00004143, 0x000000}, TERRITORY_US_CA}, // CA
+        {{0x004d5853, 0x000000}, TERRITORY_SXM}, // SXM
+        {{0x412d584d, 0x005547}, TERRITORY_MX_AGU}, // MX-AGU
+        {{0x004c5349, 0x000000}, TERRITORY_ISL}, // ISL
+        {{0x432d584d, 0x005048}, TERRITORY_MX_CHP}, // MX-CHP
+        {{0x0052414d, 0x000000}, TERRITORY_MAR}, // MAR
+};
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // __INTERNAL_ISO_HASH_H__
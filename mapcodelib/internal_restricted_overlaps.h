@@ -0,0 +1,2752 @@
+/*
+ * Copyright (C) 2014-2019 Stichting Mapcode Foundation (http://www.mapcode.com)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __INTERNAL_RESTRICTED_OVERLAPS_H__
+#define __INTERNAL_RESTRICTED_OVERLAPS_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// *** GENERATED FILE (tools/generate_restricted_overlaps.py), DO NOT CHANGE OR PRETTIFY ***
+
+#define RESTRICTED_OVERLAPS_DATA_VERSION "2.3.0"
+#define RESTRICTED_OVERLAPS_GRID 4
+#define NR_RESTRICTED_RECS 612
+
+#if MAPCODE_BOUNDARY_MAX != 16356
+#error "internal_restricted_overlaps.h does not match internal_data.h: run tools/generate_restricted_overlaps.py"
+#endif
+
+// restricted grid records (ascending)
+static const int RESTRICTED_REC[NR_RESTRICTED_RECS] = {
+        1, 2, 4, 5, 9, 57, 58, 61, 62, 69, 70, 80, 86, 93, 94, 138,
+        172, 180, 187, 196, 206, 211, 234, 242, 248, 249, 280, 289, 296, 328, 332, 339,
+        363, 367, 371, 372, 385, 399, 428, 433, 434, 446, 447, 496, 497, 569, 570, 588,
+        635, 636, 701, 702, 736, 737, 775, 776, 787, 788, 824, 825, 925, 960, 961, 1079,
+        1080, 1137, 1138, 1151, 1152, 1214, 1266, 1267, 1334, 1335, 1412, 1413, 1465, 1466, 1545, 1629,
+        1630, 1681, 1682, 1756, 1757, 1833, 1834, 1894, 1895, 1936, 1937, 1961, 1962, 2010, 2053, 2097,
+        2098, 2158, 2159, 2244, 2245, 2331, 2332, 2383, 2446, 2530, 2531, 2622, 2706, 2707, 2765, 2766,
+        2880, 2881, 2983, 2984, 3077, 3258, 3259, 3321, 3424, 3425, 3490, 3491, 3585, 3586, 3681, 3682,
+        3768, 3856, 3946, 4052, 4053, 4199, 4300, 4301, 4405, 4436, 4550, 4586, 4619, 4620, 4656, 4772,
+        4823, 4873, 5019, 5020, 5105, 5106, 5232, 5257, 5325, 5381, 5382, 5499, 5550, 5623, 5715, 5716,
+        5829, 5888, 5954, 6064, 6121, 6249, 6381, 6513, 6609, 6642, 6723, 6987, 6988, 7022, 7174, 7178,
+        7380, 7446, 7447, 7866, 8052, 8671, 8783, 8784, 8864, 9119, 9190, 9276, 9389, 9390, 9538, 9543,
+        9548, 9553, 9559, 9564, 9572, 9580, 9591, 9599, 9614, 9623, 9634, 9667, 9676, 9684, 9699, 9709,
+        9719, 9727, 9735, 9751, 9759, 9769, 9780, 9790, 9800, 9809, 9818, 9829, 9870, 9911, 9929, 10026,
+        10178, 10269, 10351, 10546, 10549, 10552, 10555, 10565, 10570, 10573, 10585, 10598, 10609, 10625, 10634, 10640,
+        10674, 10702, 10721, 10791, 10884, 10899, 10903, 10939, 11026, 11037, 11055, 11072, 11136, 11168, 11209, 11229,
+        11334, 11414, 11478, 11532, 11591, 11647, 11707, 11714, 11756, 11760, 11763, 11773, 11788, 11799, 11837, 11900,
+        11946, 11951, 11958, 11963, 11982, 11992, 11999, 12007, 12021, 12037, 12044, 12052, 12061, 12109, 12118, 12129,
+        12179, 12190, 12200, 12219, 12235, 12248, 12260, 12279, 12313, 12322, 12334, 12346, 12349, 12350, 12355, 12356,
+        12361, 12362, 12373, 12374, 12384, 12385, 12393, 12394, 12399, 12400, 12413, 12414, 12434, 12444, 12445, 12486,
+        12487, 12537, 12538, 12587, 12588, 12643, 12644, 12656, 12657, 12669, 12670, 12732, 12733, 12792, 12793, 12853,
+        12854, 12918, 12919, 12989, 12990, 13054, 13055, 13123, 13124, 13198, 13199, 13266, 13267, 13345, 13346, 13422,
+        13423, 13436, 13437, 13451, 13452, 13496, 13497, 13509, 13510, 13538, 13551, 13552, 13564, 13565, 13580, 13581,
+        13596, 13597, 13608, 13609, 13650, 13651, 13662, 13663, 13674, 13708, 13709, 13723, 13724, 13736, 13752, 13753,
+        13761, 13799, 13812, 13827, 13947, 13995, 14039, 14079, 14103, 14144, 14183, 14203, 14219, 14236, 14237, 14248,
+        14249, 14262, 14263, 14270, 14271, 14282, 14299, 14312, 14368, 14412, 14417, 14418, 14422, 14423, 14428, 14432,
+        14433, 14438, 14439, 14445, 14446, 14451, 14452, 14460, 14461, 14466, 14467, 14474, 14475, 14481, 14487, 14488,
+        14496, 14497, 14504, 14505, 14513, 14514, 14525, 14526, 14534, 14535, 14542, 14543, 14553, 14554, 14564, 14565,
+        14573, 14574, 14583, 14584, 14590, 14591, 14640, 14641, 14674, 14675, 14683, 14684, 14695, 14696, 14706, 14707,
+        14745, 14746, 14756, 14757, 14770, 14771, 14787, 14788, 14799, 14800, 14812, 14813, 14826, 14827, 14841, 14842,
+        14854, 14855, 14875, 14876, 14883, 14884, 14902, 14903, 14911, 14912, 14924, 14935, 14948, 14949, 14963, 14964,
+        14976, 14977, 14990, 14991, 15003, 15004, 15017, 15018, 15032, 15033, 15050, 15051, 15070, 15071, 15082, 15083,
+        15102, 15103, 15115, 15116, 15130, 15131, 15144, 15145, 15162, 15163, 15178, 15179, 15192, 15193, 15205, 15206,
+        15222, 15223, 15242, 15243, 15259, 15260, 15277, 15278, 15292, 15293, 15306, 15307, 15322, 15323, 15333, 15334,
+        15349, 15350, 15362, 15363, 15377, 15378, 15392, 15393, 15439, 15453, 15462, 15472, 15485, 15499, 15510, 15523,
+        15539, 15554, 15582, 15587, 15588, 15595, 15596, 15601, 15602, 15617, 15618, 15654, 15655, 15671, 15672, 15695,
+        15696, 15718, 15719, 15735, 15736, 15755, 15756, 15781, 15782, 15807, 15808, 15826, 15827, 15843, 15844, 15896,
+        15897, 15937, 15938, 15960, 15987, 16007, 16028, 16046, 16077, 16103, 16123, 16144, 16162, 16180, 16199, 16215,
+        16231, 16286, 16312, 16319,
+};
+
+// per restricted record, per cell (row-major, from miny/minx): first entry in RESTRICTED_OVERLAP
+static const int RESTRICTED_OVERLAP_START[NR_RESTRICTED_RECS * RESTRICTED_OVERLAPS_GRID * RESTRICTED_OVERLAPS_GRID + 1] = {
+        0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16,
+        17, 17, 17, 17, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+        18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33,
+        34, 36, 38, 40, 42, 44, 46, 48, 50, 52, 54, 56, 58, 60, 62, 64,
+        66, 66, 66, 66, 66, 67, 69, 74, 74, 75, 76, 77, 77, 77, 77, 77,
+        77, 80, 83, 88, 91, 94, 97, 102, 105, 108, 111, 116, 119, 122, 125, 130,
+        133, 133, 133, 135, 135, 135, 135, 135, 135, 135, 135, 135, 135, 135, 135, 135,
+        135, 137, 139, 140, 141, 143, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154,
+        155, 155, 155, 157, 157, 157, 157, 157, 157, 157, 157, 157, 157, 157, 157, 157,
+        157, 159, 161, 163, 165, 167, 169, 171, 173, 174, 175, 176, 177, 178, 179, 180,
+        181, 182, 182, 182, 182, 183, 183, 183, 183, 183, 183, 183, 189, 189, 189, 189,
+        190, 192, 195, 197, 198, 199, 201, 203, 204, 204, 205, 207, 209, 209, 210, 211,
+        212, 212, 212, 212, 212, 212, 212, 212, 212, 212, 218, 218, 218, 218, 218, 218,
+        218, 221, 224, 226, 227, 230, 233, 236, 237, 241, 245, 247, 248, 250, 252, 253,
+        254, 257, 259, 261, 262, 263, 264, 265, 265, 266, 267, 268, 268, 270, 271, 272,
+        272, 281, 281, 281, 281, 281, 281, 281, 281, 281, 281, 281, 281, 281, 281, 281,
+        283, 283, 286, 289, 289, 289, 290, 291, 291, 291, 293, 295, 295, 295, 298, 300,
+        300, 302, 304, 305, 305, 305, 305, 305, 305, 305, 305, 305, 307, 308, 308, 308,
+        310, 310, 311, 312, 313, 313, 313, 313, 313, 314, 315, 316, 317, 320, 323, 325,
+        327, 329, 330, 331, 332, 333, 335, 337, 339, 340, 343, 348, 350, 351, 354, 357,
+        359, 360, 361, 362, 362, 363, 365, 367, 368, 368, 371, 374, 376, 376, 378, 380,
+        381, 382, 383, 384, 384, 385, 386, 387, 387, 387, 388, 389, 391, 391, 392, 393,
+        397, 399, 401, 402, 403, 405, 407, 408, 409, 411, 413, 414, 415, 416, 417, 418,
+        419, 419, 419, 419, 419, 419, 421, 422, 422, 422, 422, 422, 422, 422, 422, 422,
+        422, 423, 424, 425, 426, 427, 429, 431, 432, 433, 434, 435, 436, 437, 438, 439,
+        440, 440, 440, 441, 442, 443, 444, 447, 451, 452, 459, 466, 472, 477, 484, 488,
+        490, 492, 496, 499, 501, 503, 505, 507, 510, 512, 514, 516, 519, 520, 521, 522,
+        523, 523, 524, 525, 526, 527, 529, 531, 533, 534, 536, 538, 540, 541, 543, 546,
+        547, 547, 549, 550, 550, 550, 551, 552, 552, 552, 552, 553, 554, 554, 554, 555,
+        556, 557, 558, 559, 560, 561, 562, 564, 565, 566, 567, 568, 569, 570, 571, 572,
+        573, 573, 574, 575, 576, 576, 577, 578, 579, 580, 582, 586, 588, 589, 590, 592,
+        593, 593, 598, 598, 599, 600, 600, 602, 602, 602, 602, 602, 602, 603, 604, 604,
+        604, 604, 604, 604, 604, 604, 606, 608, 608, 608, 611, 613, 613, 613, 613, 613,
+        613, 613, 613, 613, 613, 613, 613, 613, 613, 613, 613, 615, 618, 618, 618, 618,
+        618, 619, 621, 623, 624, 626, 629, 632, 634, 636, 638, 640, 642, 643, 644, 645,
+        646, 646, 646, 646, 647, 647, 647, 647, 648, 649, 651, 651, 652, 655, 660, 660,
+        660, 661, 663, 666, 667, 669, 672, 673, 674, 677, 683, 684, 685, 688, 688, 689,
+        690, 690, 695, 695, 697, 697, 697, 697, 699, 701, 701, 701, 701, 704, 705, 705,
+        705, 705, 705, 705, 709, 709, 709, 709, 709, 709, 709, 709, 709, 709, 709, 709,
+        709, 710, 712, 714, 715, 716, 718, 721, 723, 724, 726, 729, 731, 732, 733, 736,
+        738, 738, 738, 738, 738, 738, 738, 738, 738, 744, 744, 744, 744, 744, 744, 744,
+        744, 746, 749, 750, 751, 752, 756, 758, 759, 760, 764, 767, 768, 769, 771, 773,
+        774, 774, 779, 779, 779, 779, 787, 787, 787, 787, 787, 787, 787, 787, 787, 787,
+        787, 789, 792, 793, 794, 798, 804, 805, 806, 808, 810, 812, 813, 814, 816, 818,
+        819, 819, 819, 819, 823, 823, 823, 823, 823, 823, 823, 823, 823, 823, 823, 823,
+        823, 824, 825, 827, 829, 830, 832, 836, 838, 839, 841, 844, 845, 846, 847, 848,
+        849, 850, 851, 852, 855, 863, 870, 872, 873, 874, 876, 880, 881, 882, 882, 882,
+        882, 882, 882, 882, 882, 882, 882, 882, 882, 916, 916, 916, 916, 916, 916, 916,
+        916, 921, 925, 928, 929, 934, 940, 946, 947, 951, 955, 968, 970, 971, 973, 977,
+        979, 981, 981, 981, 981, 1043, 1043, 1043, 1043, 1048, 1048, 1048, 1048, 1048, 1048, 1048,
+        1048, 1049, 1051, 1052, 1053, 1061, 1068, 1073, 1074, 1080, 1103, 1122, 1124, 1125, 1133, 1147,
+        1149, 1150, 1150, 1150, 1150, 1183, 1183, 1183, 1183, 1184, 1184, 1184, 1184, 1184, 1184, 1184,
+        1184, 1193, 1196, 1206, 1208, 1210, 1212, 1220, 1226, 1227, 1228, 1235, 1241, 1242, 1243, 1249,
+        1254, 1254, 1254, 1254, 1254, 1254, 1254, 1254, 1254, 1283, 1294, 1294, 1294, 1294, 1294, 1294,
+        1294, 1295, 1296, 1301, 1303, 1308, 1313, 1322, 1326, 1338, 1349, 1355, 1358, 1359, 1362, 1363,
+        1364, 1364, 1364, 1364, 1364, 1364, 1364, 1364, 1364, 1364, 1364, 1364, 1364, 1370, 1376, 1376,
+        1376, 1378, 1380, 1381, 1382, 1384, 1387, 1389, 1390, 1393, 1397, 1400, 1401, 1402, 1405, 1408,
+        1410, 1410, 1420, 1439, 1439, 1439, 1439, 1439, 1439, 1439, 1439, 1439, 1439, 1439, 1439, 1439,
+        1439, 1443, 1445, 1446, 1448, 1451, 1454, 1457, 1460, 1464, 1469, 1475, 1479, 1483, 1488, 1491,
+        1492, 1493, 1493, 1493, 1493, 1493, 1493, 1495, 1501, 1501, 1501, 1509, 1529, 1529, 1531, 1537,
+        1537, 1537, 1571, 1571, 1571, 1571, 1572, 1572, 1572, 1572, 1572, 1572, 1572, 1572, 1572, 1572,
+        1572, 1573, 1577, 1580, 1581, 1590, 1599, 1603, 1606, 1610, 1617, 1621, 1622, 1625, 1626, 1628,
+        1629, 1629, 1629, 1629, 1629, 1629, 1629, 1629, 1629, 1629, 1629, 1646, 1651, 1651, 1651, 1695,
+        1699, 1699, 1700, 1705, 1709, 1710, 1717, 1726, 1732, 1740, 1752, 1765, 1777, 1783, 1793, 1806,
+        1811, 1811, 1811, 1811, 1811, 1811, 1811, 1811, 1811, 1811, 1811, 1811, 1866, 1866, 1866, 1866,
+        1875, 1875, 1879, 1886, 1887, 1887, 1890, 1897, 1907, 1910, 1921, 1935, 1941, 1950, 1962, 1969,
+        1971, 1971, 1971, 1971, 1971, 1971, 1971, 1971, 1971, 1983, 1983, 1983, 1983, 1984, 1984, 1984,
+        1984, 1985, 1988, 1990, 1991, 1992, 1997, 2000, 2001, 2003, 2009, 2012, 2014, 2015, 2017, 2019,
+        2021, 2021, 2028, 2044, 2047, 2047, 2054, 2072, 2077, 2078, 2080, 2096, 2110, 2110, 2112, 2115,
+        2118, 2118, 2118, 2118, 2118, 2118, 2118, 2118, 2118, 2143, 2147, 2147, 2147, 2147, 2147, 2147,
+        2147, 2151, 2153, 2156, 2157, 2162, 2165, 2166, 2167, 2171, 2177, 2180, 2182, 2183, 2188, 2193,
+        2195, 2195, 2195, 2195, 2195, 2195, 2195, 2195, 2195, 2195, 2195, 2195, 2195, 2195, 2195, 2246,
+        2270, 2273, 2275, 2284, 2284, 2296, 2321, 2337, 2340, 2342, 2352, 2361, 2368, 2368, 2373, 2380,
+        2387, 2442, 2468, 2468, 2468, 2468, 2468, 2468, 2468, 2468, 2468, 2468, 2468, 2468, 2468, 2468,
+        2468, 2477, 2489, 2496, 2498, 2514, 2531, 2543, 2543, 2560, 2570, 2572, 2572, 2577, 2585, 2585,
+        2585, 2585, 2585, 2585, 2585, 2585, 2585, 2585, 2585, 2585, 2585, 2585, 2585, 2585, 2593, 2640,
+        2642, 2644, 2647, 2652, 2657, 2662, 2669, 2679, 2685, 2689, 2699, 2713, 2719, 2719, 2723, 2730,
+        2738, 2743, 2747, 2750, 2752, 2761, 2773, 2785, 2792, 2799, 2814, 2830, 2837, 2846, 2860, 2866,
+        2868, 2868, 2868, 2868, 2868, 2868, 2868, 2868, 2868, 2868, 2881, 2881, 2881, 2881, 2947, 2963,
+        2963, 2975, 2983, 2987, 2989, 3000, 3011, 3018, 3021, 3034, 3050, 3061, 3072, 3075, 3087, 3095,
+        3102, 3102, 3109, 3133, 3133, 3133, 3148, 3169, 3169, 3169, 3169, 3169, 3169, 3169, 3169, 3169,
+        3169, 3170, 3170, 3170, 3170, 3170, 3170, 3170, 3171, 3171, 3172, 3180, 3191, 3191, 3205, 3226,
+        3241, 3241, 3241, 3241, 3241, 3253, 3319, 3319, 3319, 3321, 3325, 3325, 3325, 3325, 3325, 3325,
+        3325, 3325, 3328, 3335, 3337, 3338, 3345, 3355, 3361, 3365, 3380, 3397, 3407, 3418, 3427, 3439,
+        3444, 3445, 3446, 3446, 3446, 3477, 3502, 3502, 3502, 3522, 3543, 3543, 3543, 3543, 3543, 3543,
+        3543, 3543, 3548, 3556, 3559, 3562, 3576, 3581, 3581, 3592, 3603, 3610, 3621, 3625, 3640, 3655,
+        3661, 3661, 3661, 3661, 3675, 3675, 3675, 3675, 3713, 3713, 3713, 3713, 3729, 3729, 3729, 3729,
+        3729, 3729, 3735, 3746, 3753, 3753, 3762, 3776, 3780, 3782, 3791, 3805, 3811, 3816, 3824, 3830,
+        3832, 3832, 3832, 3832, 3832, 3832, 3832, 3832, 3832, 3832, 3842, 3863, 3864, 3864, 3869, 3883,
+        3883, 3885, 3888, 3890, 3893, 3899, 3906, 3914, 3918, 3923, 3930, 3940, 3944, 3945, 3947, 3954,
+        3955, 3955, 3955, 3955, 3955, 3955, 3956, 3958, 3958, 3958, 3969, 3983, 3983, 3983, 3983, 3983,
+        3983, 3983, 3984, 3988, 3990, 3991, 3993, 3998, 4002, 4004, 4008, 4013, 4017, 4019, 4024, 4027,
+        4029, 4035, 4044, 4049, 4052, 4058, 4069, 4073, 4079, 4083, 4089, 4095, 4098, 4105, 4112, 4114,
+        4115, 4117, 4121, 4124, 4130, 4132, 4146, 4154, 4161, 4167, 4178, 4180, 4182, 4189, 4191, 4192,
+        4192, 4197, 4198, 4198, 4198, 4217, 4241, 4241, 4241, 4242, 4243, 4243, 4243, 4243, 4243, 4243,
+        4243, 4245, 4250, 4256, 4258, 4260, 4265, 4275, 4282, 4284, 4289, 4296, 4305, 4306, 4307, 4309,
+        4310, 4311, 4312, 4312, 4312, 4350, 4378, 4378, 4378, 4381, 4383, 4383, 4383, 4383, 4383, 4383,
+        4383, 4384, 4391, 4396, 4400, 4406, 4416, 4425, 4434, 4442, 4456, 4469, 4478, 4479, 4484, 4491,
+        4494, 4494, 4494, 4529, 4583, 4583, 4583, 4583, 4583, 4583, 4583, 4583, 4583, 4583, 4583, 4583,
+        4583, 4589, 4598, 4600, 4606, 4618, 4637, 4643, 4651, 4665, 4677, 4693, 4700, 4707, 4711, 4723,
+        4729, 4729, 4729, 4729, 4729, 4729, 4729, 4729, 4729, 4730, 4730, 4730, 4730, 4789, 4820, 4820,
+        4820, 4823, 4833, 4843, 4851, 4856, 4867, 4877, 4894, 4903, 4915, 4925, 4932, 4940, 4955, 4961,
+        4962, 4967, 4976, 4983, 4984, 4988, 4996, 5005, 5009, 5016, 5024, 5032, 5039, 5045, 5052, 5060,
+        5065, 5068, 5074, 5082, 5084, 5092, 5101, 5118, 5126, 5130, 5134, 5151, 5160, 5161, 5162, 5165,
+        5178, 5178, 5178, 5178, 5178, 5178, 5178, 5178, 5178, 5178, 5195, 5245, 5271, 5271, 5271, 5271,
+        5271, 5274, 5280, 5294, 5299, 5312, 5326, 5342, 5356, 5356, 5363, 5377, 5390, 5390, 5391, 5398,
+        5407, 5410, 5413, 5422, 5425, 5433, 5447, 5465, 5471, 5479, 5500, 5513, 5521, 5526, 5533, 5543,
+        5544, 5544, 5551, 5557, 5557, 5557, 5603, 5635, 5635, 5635, 5648, 5649, 5649, 5649, 5649, 5649,
+        5649, 5650, 5662, 5675, 5679, 5685, 5696, 5711, 5723, 5733, 5745, 5758, 5763, 5774, 5786, 5790,
+        5790, 5812, 5814, 5814, 5814, 5847, 5857, 5857, 5857, 5860, 5865, 5865, 5865, 5865, 5865, 5865,
+        5865, 5873, 5881, 5886, 5886, 5895, 5904, 5911, 5911, 5919, 5931, 5938, 5944, 5950, 5958, 5964,
+        5972, 5972, 5974, 5974, 5974, 5974, 5979, 5979, 5979, 5989, 5989, 6042, 6042, 6044, 6044, 6095,
+        6095, 6095, 6095, 6101, 6101, 6101, 6101, 6104, 6105, 6114, 6117, 6117, 6153, 6157, 6157, 6157,
+        6224, 6224, 6224, 6224, 6224, 6224, 6224, 6224, 6224, 6229, 6317, 6336, 6336, 6336, 6341, 6344,
+        6344, 6353, 6370, 6381, 6383, 6394, 6411, 6435, 6442, 6453, 6465, 6481, 6489, 6492, 6496, 6508,
+        6515, 6520, 6529, 6533, 6533, 6539, 6559, 6582, 6584, 6587, 6609, 6630, 6635, 6639, 6652, 6663,
+        6665, 6665, 6665, 6665, 6665, 6665, 6665, 6665, 6665, 6741, 6743, 6743, 6743, 6773, 6774, 6774,
+        6774, 6785, 6801, 6810, 6811, 6833, 6858, 6871, 6877, 6882, 6890, 6899, 6905, 6906, 6913, 6923,
+        6926, 6926, 6927, 6930, 6942, 6943, 6945, 6953, 6958, 6960, 6969, 6979, 6980, 6990, 7008, 7011,
+        7011, 7011, 7011, 7046, 7064, 7064, 7064, 7102, 7135, 7135, 7135, 7135, 7135, 7135, 7135, 7135,
+        7135, 7144, 7155, 7166, 7168, 7183, 7200, 7219, 7227, 7237, 7248, 7261, 7268, 7275, 7280, 7289,
+        7296, 7296, 7341, 7341, 7341, 7341, 7368, 7368, 7368, 7368, 7368, 7368, 7368, 7368, 7368, 7368,
+        7368, 7368, 7371, 7379, 7388, 7393, 7404, 7414, 7423, 7434, 7445, 7460, 7465, 7471, 7481, 7488,
+        7490, 7490, 7490, 7490, 7490, 7490, 7493, 7493, 7493, 7502, 7575, 7585, 7585, 7585, 7601, 7605,
+        7605, 7615, 7636, 7641, 7641, 7661, 7682, 7694, 7701, 7709, 7729, 7739, 7746, 7746, 7749, 7750,
+        7751, 7751, 7751, 7751, 7767, 7767, 7767, 7767, 7807, 7807, 7807, 7807, 7855, 7855, 7855, 7855,
+        7855, 7859, 7877, 7891, 7891, 7895, 7908, 7919, 7920, 7928, 7945, 7957, 7967, 7971, 7979, 7996,
+        8007, 8007, 8007, 8010, 8022, 8034, 8050, 8061, 8065, 8082, 8103, 8111, 8111, 8119, 8131, 8132,
+        8132, 8132, 8134, 8148, 8165, 8173, 8188, 8206, 8216, 8224, 8241, 8247, 8247, 8253, 8266, 8268,
+        8268, 8282, 8296, 8300, 8300, 8317, 8337, 8352, 8353, 8358, 8370, 8385, 8395, 8395, 8396, 8399,
+        8412, 8412, 8412, 8412, 8412, 8412, 8461, 8481, 8481, 8481, 8517, 8539, 8539, 8539, 8539, 8539,
+        8539, 8543, 8557, 8568, 8572, 8591, 8614, 8628, 8633, 8646, 8666, 8678, 8684, 8686, 8695, 8704,
+        8712, 8712, 8719, 8734, 8741, 8754, 8784, 8803, 8807, 8831, 8858, 8867, 8867, 8877, 8904, 8918,
+        8918, 8918, 8925, 8986, 8989, 8989, 8994, 9039, 9039, 9039, 9039, 9039, 9039, 9039, 9039, 9039,
+        9039, 9053, 9064, 9068, 9069, 9092, 9111, 9121, 9128, 9141, 9152, 9160, 9164, 9175, 9193, 9193,
+        9193, 9194, 9195, 9196, 9203, 9212, 9229, 9247, 9260, 9277, 9298, 9318, 9328, 9339, 9350, 9353,
+        9356, 9356, 9357, 9365, 9374, 9377, 9383, 9389, 9390, 9395, 9397, 9399, 9400, 9401, 9403, 9404,
+        9404, 9405, 9415, 9423, 9428, 9434, 9443, 9452, 9461, 9470, 9479, 9490, 9498, 9504, 9516, 9531,
+        9544, 9549, 9556, 9562, 9564, 9570, 9575, 9577, 9582, 9586, 9589, 9591, 9594, 9596, 9598, 9600,
+        9601, 9601, 9602, 9603, 9603, 9603, 9610, 9633, 9636, 9636, 9636, 9637, 9638, 9638, 9638, 9638,
+        9638, 9642, 9645, 9646, 9646, 9649, 9655, 9662, 9663, 9668, 9675, 9681, 9683, 9686, 9688, 9691,
+        9693, 9701, 9703, 9704, 9705, 9712, 9716, 9719, 9722, 9736, 9741, 9747, 9749, 9752, 9757, 9760,
+        9764, 9770, 9773, 9774, 9775, 9779, 9797, 9814, 9818, 9821, 9832, 9846, 9855, 9857, 9862, 9870,
+        9875, 9880, 9884, 9890, 9895, 9903, 9910, 9920, 9925, 9931, 9940, 9949, 9956, 9958, 9961, 9966,
+        9968, 9969, 9970, 9974, 9983, 9985, 9990, 9999, 10001, 10005, 10013, 10017, 10018, 10025, 10029, 10034,
+        10035, 10035, 10035, 10035, 10035, 10035, 10036, 10071, 10105, 10105, 10110, 10168, 10210, 10210, 10210, 10210,
+        10212, 10217, 10233, 10253, 10266, 10278, 10300, 10321, 10334, 10345, 10364, 10383, 10392, 10397, 10412, 10426,
+        10430, 10430, 10430, 10468, 10507, 10507, 10507, 10517, 10524, 10524, 10524, 10526, 10529, 10529, 10529, 10529,
+        10529, 10541, 10565, 10587, 10598, 10606, 10620, 10626, 10633, 10636, 10639, 10643, 10645, 10647, 10648, 10652,
+        10653, 10654, 10668, 10685, 10691, 10695, 10708, 10737, 10742, 10745, 10756, 10766, 10768, 10769, 10770, 10771,
+        10772, 10773, 10774, 10777, 10781, 10787, 10790, 10795, 10799, 10805, 10810, 10814, 10818, 10820, 10825, 10828,
+        10831, 10831, 10831, 10838, 10842, 10842, 10842, 10863, 10874, 10875, 10875, 10891, 10908, 10910, 10910, 10916,
+        10926, 10932, 10934, 10934, 10934, 10938, 10944, 10945, 10945, 10946, 10953, 10959, 10960, 10960, 10960, 10985,
+        10993, 10994, 10996, 10997, 10997, 11001, 11005, 11007, 11007, 11008, 11011, 11013, 11013, 11014, 11019, 11025,
+        11026, 11026, 11026, 11026, 11026, 11029, 11034, 11036, 11038, 11039, 11056, 11082, 11083, 11083, 11085, 11125,
+        11126, 11131, 11136, 11137, 11138, 11145, 11157, 11170, 11173, 11176, 11191, 11202, 11204, 11205, 11207, 11210,
+        11211, 11213, 11219, 11232, 11244, 11248, 11251, 11268, 11274, 11276, 11297, 11305, 11307, 11309, 11315, 11317,
+        11319, 11321, 11326, 11340, 11352, 11364, 11385, 11404, 11419, 11425, 11438, 11444, 11444, 11444, 11444, 11444,
+        11444, 11444, 11446, 11460, 11464, 11469, 11473, 11482, 11499, 11504, 11521, 11536, 11541, 11553, 11575, 11580,
+        11580, 11582, 11596, 11614, 11625, 11632, 11645, 11659, 11666, 11671, 11678, 11691, 11694, 11699, 11706, 11710,
+        11711, 11715, 11722, 11732, 11739, 11745, 11755, 11767, 11776, 11780, 11783, 11789, 11793, 11795, 11799, 11801,
+        11803, 11803, 11857, 11867, 11868, 11869, 11872, 11879, 11881, 11882, 11883, 11885, 11887, 11888, 11889, 11890,
+        11891, 11892, 11901, 11911, 11913, 11914, 11916, 11918, 11929, 11930, 11933, 11936, 11943, 11944, 11953, 11966,
+        11967, 11975, 11995, 12009, 12012, 12015, 12022, 12032, 12035, 12036, 12042, 12047, 12050, 12052, 12054, 12056,
+        12058, 12065, 12071, 12079, 12080, 12095, 12103, 12111, 12117, 12139, 12151, 12162, 12173, 12177, 12187, 12193,
+        12196, 12200, 12202, 12205, 12206, 12209, 12251, 12259, 12259, 12259, 12271, 12336, 12336, 12336, 12337, 12350,
+        12355, 12356, 12357, 12360, 12367, 12368, 12370, 12387, 12390, 12391, 12399, 12409, 12410, 12411, 12421, 12430,
+        12431, 12437, 12439, 12439, 12439, 12443, 12450, 12451, 12451, 12452, 12466, 12487, 12493, 12493, 12494, 12534,
+        12559, 12560, 12562, 12568, 12569, 12571, 12576, 12585, 12599, 12603, 12607, 12609, 12613, 12615, 12617, 12618,
+        12619, 12641, 12667, 12673, 12674, 12680, 12695, 12703, 12704, 12706, 12712, 12719, 12723, 12725, 12727, 12729,
+        12734, 12734, 12740, 12741, 12741, 12741, 12741, 12741, 12742, 12742, 12742, 12760, 12787, 12787, 12787, 12801,
+        12841, 12847, 12847, 12847, 12847, 12847, 12847, 12848, 12848, 12848, 12854, 12884, 12897, 12897, 12902, 12932,
+        12954, 12958, 12964, 12965, 12966, 12968, 12973, 12976, 12977, 12978, 12992, 12996, 12998, 13001, 13006, 13008,
+        13009, 13011, 13020, 13035, 13042, 13044, 13055, 13077, 13082, 13095, 13116, 13130, 13139, 13142, 13151, 13167,
+        13173, 13174, 13175, 13177, 13179, 13181, 13183, 13186, 13188, 13190, 13192, 13195, 13197, 13199, 13201, 13204,
+        13206, 13218, 13230, 13231, 13231, 13239, 13269, 13278, 13278, 13279, 13290, 13304, 13304, 13305, 13308, 13312,
+        13312, 13312, 13312, 13312, 13312, 13312, 13312, 13312, 13312, 13312, 13312, 13337, 13337, 13337, 13337, 13338,
+        13338, 13339, 13342, 13348, 13350, 13351, 13355, 13362, 13364, 13366, 13371, 13379, 13383, 13385, 13387, 13392,
+        13396, 13396, 13396, 13397, 13406, 13406, 13406, 13407, 13427, 13428, 13428, 13430, 13470, 13471, 13471, 13472,
+        13481, 13485, 13496, 13497, 13497, 13500, 13519, 13534, 13534, 13534, 13541, 13573, 13575, 13575, 13578, 13591,
+        13595, 13596, 13597, 13598, 13599, 13601, 13622, 13626, 13627, 13628, 13645, 13670, 13672, 13675, 13684, 13693,
+        13694, 13694, 13707, 13781, 13781, 13781, 13782, 13815, 13815, 13815, 13815, 13815, 13815, 13815, 13815, 13815,
+        13815, 13815, 13815, 13815, 13816, 13817, 13818, 13819, 13820, 13835, 13861, 13882, 13883, 13885, 13903, 13947,
+        13948, 13960, 13987, 13990, 13990, 14000, 14020, 14043, 14048, 14048, 14050, 14056, 14062, 14062, 14064, 14069,
+        14071, 14071, 14071, 14071, 14071, 14071, 14071, 14071, 14071, 14107, 14148, 14148, 14148, 14151, 14157, 14157,
+        14157, 14158, 14161, 14166, 14167, 14170, 14182, 14193, 14199, 14210, 14229, 14247, 14256, 14263, 14272, 14281,
+        14284, 14284, 14288, 14294, 14299, 14307, 14318, 14330, 14339, 14354, 14370, 14380, 14387, 14399, 14408, 14418,
+        14423, 14423, 14423, 14423, 14423, 14423, 14423, 14423, 14423, 14423, 14423, 14473, 14473, 14473, 14473, 14486,
+        14486, 14492, 14503, 14511, 14514, 14521, 14525, 14545, 14555, 14556, 14557, 14565, 14571, 14572, 14573, 14574,
+        14576, 14577, 14578, 14579, 14580, 14582, 14584, 14586, 14588, 14590, 14593, 14596, 14598, 14600, 14603, 14606,
+        14608, 14610, 14612, 14615, 14617, 14619, 14622, 14626, 14628, 14630, 14632, 14635, 14637, 14639, 14641, 14644,
+        14646, 14647, 14648, 14650, 14652, 14654, 14656, 14659, 14661, 14663, 14666, 14669, 14671, 14673, 14676, 14679,
+        14681, 14683, 14685, 14687, 14688, 14690, 14693, 14697, 14699, 14700, 14702, 14704, 14706, 14707, 14709, 14711,
+        14713, 14714, 14715, 14717, 14719, 14721, 14723, 14727, 14730, 14732, 14734, 14738, 14741, 14742, 14743, 14745,
+        14747, 14749, 14752, 14754, 14755, 14758, 14761, 14763, 14764, 14765, 14767, 14769, 14770, 14771, 14772, 14773,
+        14774, 14775, 14778, 14781, 14783, 14784, 14789, 14793, 14795, 14796, 14798, 14799, 14800, 14801, 14802, 14803,
+        14804, 14805, 14806, 14807, 14808, 14809, 14811, 14815, 14818, 14819, 14821, 14827, 14832, 14833, 14834, 14836,
+        14838, 14839, 14840, 14841, 14843, 14845, 14849, 14852, 14854, 14857, 14862, 14863, 14864, 14866, 14870, 14871,
+        14872, 14873, 14875, 14879, 14881, 14882, 14884, 14888, 14889, 14890, 14893, 14895, 14896, 14897, 14899, 14900,
+        14901, 14902, 14905, 14907, 14908, 14911, 14917, 14920, 14921, 14926, 14930, 14933, 14934, 14935, 14936, 14937,
+        14938, 14939, 14940, 14942, 14944, 14947, 14952, 14954, 14956, 14958, 14960, 14962, 14964, 14965, 14967, 14968,
+        14969, 14971, 14973, 14974, 14975, 14980, 14985, 14988, 14989, 14991, 14993, 14995, 14997, 14998, 14999, 15000,
+        15001, 15007, 15014, 15019, 15021, 15027, 15034, 15041, 15043, 15045, 15048, 15053, 15060, 15060, 15060, 15062,
+        15068, 15068, 15069, 15071, 15073, 15074, 15078, 15082, 15083, 15086, 15092, 15096, 15097, 15098, 15099, 15100,
+        15100, 15101, 15104, 15107, 15108, 15110, 15115, 15119, 15120, 15121, 15124, 15129, 15130, 15131, 15133, 15135,
+        15136, 15138, 15141, 15143, 15145, 15147, 15150, 15152, 15154, 15156, 15159, 15166, 15171, 15173, 15178, 15182,
+        15185, 15186, 15189, 15192, 15195, 15196, 15200, 15203, 15206, 15207, 15210, 15212, 15213, 15214, 15217, 15219,
+        15220, 15221, 15224, 15228, 15229, 15231, 15234, 15238, 15240, 15242, 15244, 15247, 15249, 15250, 15252, 15256,
+        15257, 15258, 15259, 15260, 15261, 15262, 15264, 15267, 15268, 15271, 15275, 15277, 15279, 15280, 15281, 15283,
+        15284, 15285, 15287, 15289, 15290, 15292, 15295, 15298, 15299, 15301, 15303, 15305, 15305, 15308, 15313, 15315,
+        15315, 15316, 15318, 15321, 15325, 15326, 15334, 15340, 15342, 15346, 15351, 15353, 15354, 15355, 15356, 15357,
+        15357, 15358, 15360, 15362, 15362, 15364, 15366, 15369, 15370, 15373, 15378, 15381, 15382, 15383, 15384, 15385,
+        15386, 15386, 15386, 15387, 15392, 15393, 15395, 15398, 15402, 15403, 15405, 15408, 15410, 15411, 15413, 15414,
+        15415, 15416, 15417, 15418, 15419, 15420, 15426, 15431, 15432, 15434, 15438, 15440, 15442, 15443, 15444, 15445,
+        15446, 15447, 15448, 15450, 15451, 15452, 15454, 15459, 15462, 15463, 15465, 15469, 15473, 15473, 15474, 15475,
+        15476, 15477, 15479, 15482, 15485, 15487, 15490, 15492, 15494, 15495, 15496, 15498, 15500, 15502, 15503, 15504,
+        15505, 15505, 15505, 15505, 15505, 15506, 15508, 15511, 15513, 15514, 15518, 15519, 15520, 15522, 15524, 15526,
+        15527, 15528, 15529, 15530, 15531, 15533, 15536, 15541, 15543, 15545, 15548, 15551, 15554, 15555, 15556, 15558,
+        15560, 15562, 15563, 15566, 15568, 15570, 15572, 15576, 15578, 15579, 15580, 15583, 15584, 15585, 15586, 15589,
+        15592, 15592, 15592, 15594, 15597, 15597, 15603, 15611, 15613, 15614, 15627, 15632, 15633, 15642, 15655, 15660,
+        15662, 15665, 15669, 15671, 15673, 15679, 15683, 15690, 15697, 15701, 15703, 15715, 15723, 15728, 15731, 15737,
+        15738, 15738, 15748, 15751, 15752, 15752, 15759, 15761, 15762, 15763, 15765, 15767, 15769, 15770, 15771, 15772,
+        15773, 15774, 15785, 15792, 15795, 15805, 15821, 15831, 15836, 15849, 15868, 15899, 15902, 15910, 15919, 15926,
+        15927, 15927, 15927, 15938, 15950, 15963, 15985, 16008, 16024, 16028, 16049, 16065, 16083, 16083, 16095, 16119,
+        16129, 16130, 16135, 16139, 16144, 16149, 16158, 16166, 16173, 16176, 16185, 16196, 16200, 16200, 16216, 16253,
+        16265, 16271, 16276, 16289, 16292, 16301, 16314, 16328, 16339, 16346, 16355, 16367, 16376, 16379, 16387, 16401,
+        16404, 16413, 16420, 16421, 16421, 16431, 16449, 16460, 16463, 16471, 16509, 16566, 16588, 16592, 16621, 16643,
+        16662, 16662, 16662, 16662, 16663, 16663, 16663, 16663, 16664, 16664, 16664, 16664, 16664, 16665, 16665, 16665,
+        16665, 16666, 16667, 16668, 16669, 16670, 16671, 16672, 16673, 16674, 16675, 16676, 16677, 16679, 16681, 16682,
+        16683, 16684, 16685, 16686, 16687, 16689, 16691, 16693, 16694, 16696, 16698, 16700, 16701, 16702, 16703, 16704,
+        16705, 16706, 16707, 16709, 16710, 16711, 16712, 16713, 16713, 16716, 16721, 16722, 16723, 16724, 16725, 16726,
+        16727, 16727, 16728, 16729, 16729, 16730, 16731, 16732, 16733, 16735, 16738, 16739, 16740, 16741, 16742, 16743,
+        16744, 16745, 16746, 16747, 16748, 16749, 16750, 16752, 16754, 16755, 16756, 16758, 16760, 16761, 16762, 16763,
+        16764, 16767, 16769, 16771, 16773, 16778, 16782, 16786, 16790, 16792, 16794, 16799, 16801, 16802, 16803, 16805,
+        16806, 16808, 16810, 16812, 16813, 16816, 16819, 16824, 16825, 16826, 16828, 16833, 16835, 16836, 16837, 16839,
+        16842, 16843, 16846, 16848, 16849, 16850, 16855, 16861, 16862, 16863, 16866, 16871, 16873, 16874, 16875, 16877,
+        16878, 16880, 16884, 16887, 16888, 16890, 16893, 16895, 16896, 16899, 16902, 16907, 16911, 16912, 16913, 16917,
+        16922, 16923, 16924, 16926, 16927, 16928, 16931, 16934, 16935, 16937, 16941, 16945, 16947, 16949, 16952, 16954,
+        16955, 16957, 16960, 16963, 16965, 16967, 16970, 16974, 16977, 16978, 16979, 16981, 16983, 16984, 16985, 16987,
+        16989, 16992, 16996, 16999, 17001, 17005, 17011, 17019, 17025, 17026, 17030, 17036, 17037, 17038, 17042, 17046,
+        17047, 17047, 17048, 17051, 17054, 17055, 17060, 17065, 17071, 17073, 17076, 17080, 17086, 17086, 17087, 17091,
+        17097, 17100, 17104, 17108, 17109, 17112, 17116, 17119, 17121, 17122, 17124, 17131, 17132, 17133, 17134, 17137,
+        17139, 17139, 17147, 17153, 17153, 17157, 17164, 17173, 17173, 17187, 17203, 17221, 17225, 17228, 17232, 17245,
+        17258, 17270, 17284, 17294, 17299, 17306, 17323, 17337, 17347, 17355, 17370, 17385, 17395, 17401, 17405, 17409,
+        17410, 17410, 17414, 17417, 17418, 17422, 17425, 17428, 17432, 17436, 17437, 17438, 17440, 17441, 17442, 17443,
+        17444, 17444, 17445, 17446, 17447, 17447, 17448, 17449, 17450, 17452, 17455, 17457, 17459, 17460, 17461, 17462,
+        17463, 17463, 17464, 17469, 17477, 17477, 17483, 17495, 17502, 17503, 17512, 17519, 17522, 17527, 17531, 17532,
+        17532, 17535, 17547, 17550, 17550, 17556, 17571, 17588, 17590, 17603, 17619, 17637, 17644, 17644, 17650, 17660,
+        17669, 17669, 17673, 17676, 17676, 17677, 17683, 17687, 17688, 17691, 17694, 17696, 17697, 17699, 17700, 17702,
+        17703, 17706, 17712, 17714, 17715, 17718, 17722, 17724, 17725, 17728, 17731, 17734, 17735, 17737, 17738, 17739,
+        17739, 17740, 17742, 17743, 17743, 17746, 17749, 17751, 17752, 17756, 17763, 17767, 17770, 17771, 17773, 17776,
+        17777, 17781, 17788, 17797, 17799, 17804, 17820, 17829, 17830, 17839, 17853, 17867, 17876, 17879, 17883, 17887,
+        17894, 17897, 17900, 17904, 17910, 17913, 17920, 17924, 17927, 17931, 17936, 17942, 17944, 17945, 17947, 17950,
+        17952, 17952, 17954, 17957, 17958, 17958, 17962, 17972, 17978, 17978, 17982, 17992, 18000, 18000, 18002, 18006,
+        18007, 18008, 18009, 18010, 18010, 18012, 18016, 18022, 18023, 18024, 18027, 18032, 18035, 18036, 18040, 18043,
+        18046, 18047, 18053, 18064, 18075, 18081, 18108, 18128, 18145, 18149, 18160, 18179, 18195, 18196, 18197, 18212,
+        18217, 18221, 18234, 18254, 18259, 18265, 18281, 18300, 18302, 18302, 18306, 18319, 18322, 18322, 18323, 18333,
+        18341, 18346, 18353, 18357, 18358, 18370, 18379, 18384, 18386, 18391, 18401, 18408, 18414, 18415, 18422, 18426,
+        18426, 18428, 18432, 18436, 18445, 18446, 18449, 18454, 18456, 18457, 18459, 18465, 18465, 18466, 18469, 18469,
+        18469, 18473, 18479, 18479, 18479, 18488, 18497, 18499, 18499, 18503, 18515, 18523, 18529, 18533, 18538, 18538,
+        18542, 18546, 18548, 18548, 18548, 18555, 18560, 18561, 18561, 18569, 18575, 18581, 18584, 18587, 18594, 18602,
+        18610, 18613, 18616, 18621, 18625, 18631, 18641, 18649, 18655, 18668, 18678, 18682, 18683, 18694, 18696, 18696,
+        18696, 18698, 18698, 18701, 18701, 18701, 18701, 18701, 18701, 18701, 18701, 18701, 18701, 18701, 18701, 18701,
+        18702, 18703, 18708, 18710, 18711, 18712, 18719, 18736, 18737, 18739, 18743, 18756, 18757, 18758, 18761, 18771,
+        18772, 18773, 18774, 18775, 18775, 18776, 18777, 18778, 18778, 18780, 18782, 18785, 18786, 18787, 18788, 18790,
+        18791, 18792, 18794, 18796, 18798, 18799, 18801, 18803, 18805, 18806, 18808, 18810, 18812, 18813, 18815, 18817,
+        18819, 18820, 18822, 18825, 18826, 18827, 18828, 18829, 18830, 18832, 18835, 18837, 18838, 18844, 18848, 18850,
+        18851, 18852, 18853, 18855, 18860, 18861, 18863, 18870, 18877, 18878, 18879, 18880, 18881, 18882, 18883, 18884,
+        18885, 18886, 18888, 18890, 18892, 18893, 18895, 18900, 18902, 18904, 18908, 18914, 18917, 18919, 18922, 18924,
+        18926, 18932, 18944, 18951, 18953, 18958, 18969, 18973, 18975, 18979, 18985, 18989, 18991, 18995, 18997, 18998,
+        18999, 19014, 19027, 19037, 19042, 19050, 19059, 19068, 19074, 19078, 19087, 19095, 19101, 19101, 19103, 19109,
+        19113, 19114, 19115, 19140, 19141, 19143, 19152, 19160, 19161, 19163, 19171, 19173, 19174, 19175, 19176, 19176,
+        19176, 19178, 19181, 19183, 19185, 19187, 19191, 19193, 19195, 19197, 19201, 19203, 19205, 19207, 19210, 19212,
+        19214, 19215, 19218, 19221, 19222, 19223, 19226, 19230, 19231, 19232, 19234, 19236, 19237, 19238, 19239, 19240,
+        19241, 19242, 19243, 19244, 19245, 19246, 19248, 19251, 19254, 19255, 19257, 19260, 19263, 19264, 19265, 19266,
+        19267, 19269, 19275, 19280, 19282, 19285, 19291, 19296, 19299, 19300, 19301, 19303, 19306, 19306, 19306, 19307,
+        19308, 19309, 19311, 19314, 19316, 19317, 19318, 19322, 19324, 19325, 19326, 19328, 19331, 19332, 19333, 19334,
+        19336, 19338, 19341, 19343, 19345, 19347, 19350, 19352, 19355, 19357, 19359, 19361, 19365, 19367, 19370, 19372,
+        19374, 19376, 19378, 19380, 19381, 19383, 19386, 19389, 19393, 19396, 19399, 19402, 19406, 19408, 19410, 19412,
+        19413, 19413, 19413, 19414, 19416, 19417, 19418, 19421, 19423, 19425, 19426, 19428, 19435, 19436, 19437, 19439,
+        19443, 19445, 19447, 19449, 19451, 19452, 19454, 19457, 19461, 19462, 19465, 19466, 19475, 19476, 19478, 19479,
+        19483, 19484, 19487, 19490, 19493, 19494, 19497, 19500, 19503, 19504, 19506, 19507, 19508, 19508, 19509, 19510,
+        19511, 19512, 19514, 19516, 19517, 19519, 19521, 19524, 19526, 19527, 19528, 19531, 19533, 19535, 19537, 19541,
+        19543, 19544, 19546, 19549, 19552, 19554, 19557, 19561, 19565, 19567, 19570, 19574, 19576, 19579, 19582, 19584,
+        19585, 19587, 19588, 19590, 19592, 19600, 19602, 19605, 19610, 19617, 19624, 19630, 19632, 19640, 19656, 19668,
+        19670, 19671, 19672, 19674, 19676, 19678, 19680, 19685, 19688, 19690, 19692, 19699, 19702, 19704, 19706, 19709,
+        19711, 19713, 19715, 19718, 19721, 19723, 19725, 19730, 19733, 19735, 19738, 19744, 19747, 19748, 19752, 19754,
+        19756, 19757, 19758, 19764, 19768, 19770, 19773, 19798, 19808, 19811, 19818, 19826, 19828, 19830, 19834, 19837,
+        19839, 19841, 19843, 19844, 19845, 19847, 19850, 19853, 19856, 19857, 19859, 19865, 19868, 19869, 19870, 19874,
+        19878, 19880, 19883, 19886, 19888, 19890, 19896, 19901, 19903, 19904, 19907, 19910, 19911, 19912, 19915, 19918,
+        19919, 19920, 19921, 19924, 19926, 19928, 19932, 19937, 19939, 19943, 19947, 19952, 19959, 19960, 19961, 19965,
+        19967, 19968, 19969, 19970, 19971, 19972, 19975, 19977, 19979, 19983, 19988, 19994, 20000, 20002, 20004, 20009,
+        20011, 20012, 20015, 20018, 20020, 20021, 20025, 20032, 20035, 20036, 20039, 20043, 20047, 20048, 20050, 20052,
+        20054, 20055, 20058, 20061, 20062, 20063, 20068, 20073, 20076, 20078, 20082, 20086, 20088, 20089, 20091, 20094,
+        20096, 20097, 20098, 20101, 20105, 20107, 20109, 20114, 20119, 20122, 20124, 20126, 20132, 20133, 20134, 20136,
+        20138, 20139, 20144, 20153, 20156, 20160, 20168, 20179, 20185, 20187, 20190, 20193, 20196, 20197, 20198, 20199,
+        20200, 20201, 20205, 20209, 20210, 20211, 20215, 20219, 20220, 20222, 20225, 20228, 20229, 20231, 20233, 20234,
+        20235, 20236, 20237, 20238, 20239, 20241, 20243, 20245, 20248, 20250, 20253, 20256, 20263, 20264, 20265, 20268,
+        20270, 20271, 20272, 20273, 20274, 20275, 20277, 20281, 20284, 20285, 20287, 20292, 20299, 20300, 20301, 20302,
+        20303, 20303, 20303, 20305, 20305, 20305, 20305, 20305, 20305, 20305, 20305, 20305, 20305, 20305, 20305, 20305,
+        20305, 20306, 20307, 20308, 20309, 20311, 20313, 20315, 20316, 20318, 20320, 20322, 20323, 20325, 20327, 20329,
+        20330, 20330, 20330, 20330, 20330, 20330, 20330, 20331, 20335, 20335, 20335, 20336, 20337, 20337, 20337, 20337,
+        20337, 20339, 20341, 20343, 20345, 20347, 20349, 20351, 20353, 20356, 20359, 20363, 20366, 20368, 20370, 20373,
+        20375, 20375, 20375, 20378, 20378, 20378, 20378, 20381, 20381, 20381, 20381, 20381, 20381, 20381, 20381, 20381,
+        20381, 20383, 20385, 20387, 20389, 20392, 20395, 20397, 20399, 20401, 20403, 20404, 20405, 20408, 20411, 20412,
+        20413, 20413, 20413, 20413, 20413, 20413, 20413, 20417, 20426, 20426, 20426, 20427, 20428, 20428, 20428, 20428,
+        20428, 20431, 20436, 20438, 20439, 20442, 20447, 20450, 20453, 20454, 20456, 20458, 20460, 20461, 20463, 20465,
+        20466, 20466, 20466, 20468, 20468, 20468, 20468, 20477, 20477, 20477, 20477, 20477, 20477, 20477, 20477, 20477,
+        20477, 20479, 20481, 20482, 20483, 20484, 20487, 20489, 20491, 20492, 20494, 20498, 20503, 20504, 20505, 20507,
+        20510, 20510, 20510, 20510, 20510, 20510, 20510, 20510, 20510, 20510, 20510, 20511, 20518, 20518, 20518, 20518,
+        20518, 20520, 20523, 20527, 20531, 20532, 20533, 20534, 20536, 20537, 20538, 20539, 20540, 20541, 20542, 20543,
+        20544, 20544, 20544, 20544, 20544, 20544, 20544, 20544, 20544, 20544, 20544, 20545, 20549, 20549, 20549, 20549,
+        20549, 20550, 20551, 20552, 20553, 20554, 20555, 20556, 20557, 20560, 20563, 20565, 20566, 20569, 20572, 20574,
+        20575, 20575, 20575, 20575, 20575, 20575, 20575, 20576, 20586, 20586, 20586, 20587, 20593, 20593, 20593, 20593,
+        20593, 20594, 20595, 20597, 20598, 20599, 20600, 20605, 20606, 20609, 20612, 20616, 20617, 20619, 20620, 20624,
+        20625, 20626, 20627, 20628, 20634, 20635, 20636, 20640, 20649, 20651, 20653, 20656, 20657, 20662, 20663, 20664,
+        20665, 20665, 20665, 20672, 20672, 20672, 20672, 20677, 20677, 20677, 20677, 20677, 20677, 20677, 20677, 20677,
+        20677, 20678, 20679, 20680, 20681, 20682, 20683, 20685, 20686, 20687, 20689, 20694, 20695, 20696, 20699, 20703,
+        20704, 20704, 20732, 20743, 20743, 20743, 20753, 20759, 20759, 20759, 20759, 20759, 20759, 20759, 20759, 20759,
+        20759, 20764, 20771, 20772, 20772, 20782, 20791, 20797, 20799, 20803, 20811, 20819, 20825, 20825, 20829, 20829,
+        20829, 20829, 20829, 20829, 20829, 20829, 20829, 20829, 20829, 20829, 20829, 20844, 20856, 20856, 20856, 20881,
+        20893, 20893, 20896, 20904, 20905, 20906, 20913, 20925, 20931, 20937, 20948, 20960, 20969, 20976, 20983, 20988,
+        20990, 20990, 20990, 20990, 20990, 20990, 20990, 20990, 20990, 20990, 20990, 20990, 21022, 21022, 21022, 21022,
+        21045, 21055, 21062, 21065, 21067, 21074, 21084, 21091, 21099, 21104, 21112, 21119, 21124, 21126, 21134, 21140,
+        21143, 21159, 21170, 21170, 21170, 21191, 21214, 21214, 21214, 21214, 21214, 21214, 21214, 21214, 21214, 21214,
+        21214, 21218, 21224, 21228, 21230, 21234, 21245, 21254, 21260, 21263, 21274, 21283, 21291, 21296, 21306, 21315,
+        21322, 21326, 21335, 21335, 21335, 21335, 21335, 21335, 21335, 21335, 21335, 21335, 21335, 21335, 21335, 21335,
+        21335, 21336, 21339, 21341, 21342, 21343, 21345, 21348, 21349, 21350, 21353, 21359, 21360, 21361, 21362, 21366,
+        21367, 21367, 21367, 21367, 21367, 21367, 21367, 21367, 21367, 21367, 21367, 21367, 21367, 21370, 21378, 21381,
+        21381, 21384, 21385, 21388, 21389, 21391, 21393, 21395, 21396, 21397, 21400, 21403, 21404, 21405, 21408, 21410,
+        21412, 21412, 21428, 21478, 21478, 21478, 21478, 21479, 21479, 21479, 21479, 21479, 21479, 21479, 21479, 21479,
+        21479, 21486, 21497, 21507, 21516, 21519, 21528, 21545, 21555, 21555, 21557, 21570, 21577, 21577, 21578, 21587,
+        21592, 21592, 21607, 21607, 21607, 21607, 21657, 21657, 21657, 21657, 21657, 21657, 21657, 21657, 21657, 21657,
+        21657, 21664, 21669, 21676, 21679, 21688, 21698, 21708, 21715, 21721, 21730, 21740, 21749, 21753, 21760, 21768,
+        21775, 21775, 21775, 21775, 21775, 21775, 21787, 21841, 21841, 21841, 21841, 21841, 21841, 21841, 21841, 21841,
+        21841, 21848, 21854, 21864, 21873, 21880, 21886, 21894, 21901, 21910, 21919, 21930, 21940, 21945, 21948, 21951,
+        21954, 21954, 21954, 21954, 21954, 21955, 21959, 21959, 21959, 21991, 22017, 22017, 22017, 22027, 22039, 22039,
+        22039, 22043, 22049, 22057, 22064, 22072, 22085, 22095, 22104, 22111, 22117, 22126, 22132, 22136, 22143, 22153,
+        22160, 22160, 22160, 22160, 22160, 22199, 22209, 22209, 22209, 22243, 22244, 22244, 22244, 22244, 22244, 22244,
+        22244, 22248, 22256, 22267, 22277, 22287, 22298, 22310, 22320, 22329, 22338, 22344, 22346, 22356, 22366, 22372,
+        22372, 22372, 22372, 22372, 22372, 22372, 22374, 22374, 22374, 22374, 22425, 22427, 22427, 22427, 22445, 22445,
+        22445, 22452, 22458, 22462, 22467, 22473, 22482, 22489, 22498, 22507, 22522, 22531, 22541, 22547, 22556, 22565,
+        22569, 22569, 22569, 22569, 22569, 22569, 22569, 22569, 22569, 22588, 22588, 22588, 22588, 22643, 22644, 22644,
+        22644, 22651, 22661, 22669, 22671, 22680, 22692, 22703, 22708, 22717, 22730, 22740, 22747, 22754, 22760, 22766,
+        22772, 22772, 22772, 22772, 22772, 22772, 22772, 22772, 22772, 22772, 22772, 22772, 22772, 22772, 22772, 22800,
+        22850, 22850, 22850, 22857, 22859, 22864, 22873, 22888, 22899, 22907, 22920, 22932, 22943, 22947, 22960, 22973,
+        22983, 22983, 22983, 22983, 22983, 22983, 22983, 23007, 23013, 23013, 23013, 23064, 23071, 23071, 23071, 23071,
+        23071, 23071, 23071, 23083, 23090, 23097, 23105, 23120, 23125, 23132, 23144, 23159, 23165, 23165, 23170, 23183,
+        23188, 23188, 23188, 23188, 23188, 23188, 23192, 23232, 23265, 23265, 23267, 23280, 23289, 23289, 23289, 23289,
+        23289, 23294, 23302, 23309, 23317, 23324, 23334, 23341, 23352, 23362, 23376, 23388, 23401, 23407, 23415, 23422,
+        23427, 23455, 23455, 23455, 23455, 23509, 23509, 23509, 23509, 23516, 23516, 23516, 23516, 23516, 23516, 23516,
+        23516, 23517, 23523, 23535, 23540, 23546, 23558, 23570, 23578, 23586, 23599, 23611, 23619, 23623, 23629, 23639,
+        23652, 23652, 23652, 23652, 23652, 23652, 23652, 23653, 23653, 23653, 23656, 23666, 23666, 23666, 23667, 23672,
+        23672, 23673, 23675, 23677, 23678, 23681, 23685, 23688, 23690, 23694, 23700, 23704, 23706, 23708, 23711, 23713,
+        23714, 23714, 23714, 23714, 23714, 23714, 23714, 23714, 23714, 23727, 23727, 23727, 23727, 23729, 23729, 23729,
+        23729, 23730, 23731, 23735, 23740, 23743, 23746, 23751, 23754, 23756, 23758, 23760, 23761, 23762, 23764, 23766,
+        23767, 23767, 23767, 23780, 23784, 23784, 23797, 23818, 23819, 23819, 23824, 23829, 23829, 23829, 23829, 23829,
+        23829, 23829, 23829, 23833, 23841, 23841, 23841, 23844, 23848, 23848, 23848, 23853, 23856, 23865, 23880, 23885,
+        23888, 23888, 23888, 23894, 23900, 23900, 23900, 23902, 23903, 23903, 23903, 23903, 23903, 23903, 23903, 23903,
+        23903, 23905, 23907, 23909, 23910, 23912, 23914, 23916, 23917, 23921, 23924, 23929, 23933, 23935, 23936, 23937,
+        23938, 23938, 23941, 23945, 23947, 23947, 23951, 23957, 23959, 23959, 23964, 23971, 23978, 23983, 23991, 23998,
+        24004, 24004, 24004, 24004, 24004, 24004, 24004, 24004, 24004, 24006, 24008, 24009, 24009, 24015, 24022, 24024,
+        24024, 24025, 24028, 24030, 24032, 24034, 24037, 24040, 24043, 24045, 24048, 24050, 24052, 24054, 24057, 24059,
+        24060, 24060, 24060, 24060, 24060, 24060, 24060, 24060, 24060, 24064, 24067, 24067, 24067, 24073, 24076, 24076,
+        24076, 24077, 24080, 24083, 24084, 24085, 24089, 24092, 24093, 24094, 24099, 24101, 24103, 24104, 24107, 24109,
+        24110, 24110, 24110, 24110, 24110, 24110, 24111, 24112, 24112, 24116, 24128, 24130, 24130, 24130, 24130, 24130,
+        24130, 24131, 24133, 24135, 24139, 24141, 24143, 24145, 24149, 24151, 24154, 24157, 24161, 24162, 24164, 24167,
+        24168, 24168, 24168, 24168, 24168, 24171, 24181, 24186, 24186, 24188, 24190, 24191, 24191, 24191, 24191, 24191,
+        24191, 24192, 24194, 24198, 24200, 24201, 24204, 24208, 24215, 24216, 24218, 24221, 24223, 24224, 24226, 24228,
+        24229, 24230, 24237, 24242, 24242, 24243, 24246, 24247, 24247, 24247, 24247, 24247, 24247, 24247, 24247, 24247,
+        24247, 24248, 24250, 24254, 24255, 24256, 24258, 24261, 24262, 24263, 24265, 24269, 24274, 24275, 24277, 24280,
+        24282, 24282, 24284, 24288, 24288, 24288, 24295, 24301, 24301, 24301, 24323, 24332, 24332, 24332, 24343, 24343,
+        24343, 24346, 24349, 24351, 24354, 24360, 24370, 24374, 24375, 24386, 24398, 24399, 24399, 24409, 24414, 24414,
+        24414, 24414, 24414, 24414, 24414, 24414, 24414, 24414, 24414, 24414, 24417, 24421, 24421, 24421, 24422, 24430,
+        24430, 24432, 24433, 24434, 24435, 24437, 24439, 24442, 24444, 24445, 24450, 24454, 24455, 24456, 24461, 24463,
+        24464, 24466, 24471, 24477, 24479, 24481, 24487, 24492, 24495, 24497, 24500, 24503, 24505, 24507, 24510, 24512,
+        24514, 24514, 24514, 24514, 24514, 24516, 24521, 24521, 24521, 24526, 24535, 24535, 24535, 24558, 24560, 24560,
+        24560, 24560, 24562, 24565, 24571, 24571, 24573, 24575, 24578, 24588, 24600, 24602, 24603, 24610, 24616, 24617,
+        24618, 24618, 24618, 24621, 24630, 24630, 24630, 24632, 24638, 24638, 24638, 24639, 24642, 24642, 24642, 24642,
+        24642, 24645, 24648, 24650, 24654, 24655, 24658, 24661, 24662, 24664, 24667, 24669, 24670, 24671, 24673, 24676,
+        24678, 24681, 24684, 24686, 24688, 24691, 24695, 24697, 24699, 24705, 24710, 24713, 24716, 24720, 24724, 24726,
+        24728, 24728, 24728, 24728, 24728, 24728, 24728, 24728, 24728, 24728, 24728, 24731, 24738, 24738, 24738, 24739,
+        24749, 24750, 24751, 24752, 24753, 24755, 24757, 24763, 24765, 24767, 24768, 24774, 24775, 24776, 24777, 24785,
+        24786, 24787, 24789, 24791, 24795, 24796, 24798, 24800, 24802, 24805, 24807, 24810, 24812, 24814, 24816, 24819,
+        24821, 24823, 24826, 24829, 24831, 24833, 24857, 24875, 24877, 24879, 24883, 24886, 24889, 24891, 24894, 24896,
+        24898, 24900, 24903, 24906, 24909, 24911, 24913, 24917, 24921, 24924, 24930, 24935, 24938, 24941, 24944, 24947,
+        24948, 24949, 24951, 24954, 24956, 24958, 24964, 24969, 24972, 24975, 24980, 24983, 24985, 24988, 24991, 24995,
+        24997, 24998, 25002, 25037, 25047, 25049, 25074, 25093, 25095, 25113, 25143, 25145, 25146, 25166, 25174, 25175,
+        25176, 25176, 25177, 25185, 25188, 25190, 25194, 25208, 25225, 25227, 25232, 25244, 25252, 25252, 25256, 25261,
+        25263, 25266, 25271, 25272, 25274, 25275, 25281, 25292, 25298, 25299, 25306, 25324, 25327, 25327, 25332, 25339,
+        25341, 25342, 25343, 25364, 25378, 25379, 25380, 25385, 25388, 25389, 25392, 25394, 25396, 25397, 25398, 25399,
+        25400, 25401, 25404, 25411, 25416, 25417, 25420, 25432, 25437, 25439, 25441, 25443, 25447, 25448, 25449, 25450,
+        25451, 25452, 25453, 25470, 25492, 25493, 25495, 25500, 25504, 25505, 25506, 25507, 25508, 25509, 25510, 25511,
+        25512, 25519, 25549, 25551, 25552, 25553, 25554, 25556, 25557, 25559, 25561, 25563, 25565, 25566, 25567, 25568,
+        25569, 25573, 25578, 25584, 25590, 25595, 25601, 25606, 25608, 25609, 25610, 25611, 25612, 25613, 25614, 25615,
+        25616, 25621, 25631, 25632, 25633, 25636, 25639, 25640, 25641, 25644, 25647, 25648, 25649, 25650, 25651, 25652,
+        25653, 25653, 25653, 25654, 25660, 25661, 25662, 25668, 25676, 25678, 25679, 25681, 25682, 25683, 25684, 25685,
+        25686, 25686, 25686, 25692, 25702, 25704, 25706, 25710, 25713, 25714, 25715, 25716, 25717, 25718, 25719, 25720,
+        25721, 25729, 25732, 25732, 25732, 25735, 25736, 25736, 25736, 25736, 25736, 25736, 25736, 25736, 25736, 25736,
+        25736, 25737, 25738, 25741, 25742, 25744, 25747, 25750, 25753, 25755, 25757, 25760, 25762, 25764, 25766, 25768,
+        25769, 25772, 25782, 25784, 25784, 25784, 25784, 25784, 25784, 25784, 25784, 25784, 25784, 25784, 25784, 25784,
+        25784, 25787, 25789, 25792, 25794, 25796, 25802, 25805, 25807, 25808, 25811, 25815, 25819, 25819, 25819, 25820,
+        25821, 25821, 25827, 25827, 25827, 25827, 25827, 25827, 25827, 25827, 25827, 25827, 25827, 25827, 25827, 25827,
+        25827, 25829, 25832, 25836, 25838, 25840, 25843, 25846, 25848, 25850, 25851, 25852, 25853, 25855, 25856, 25857,
+        25858, 25861, 25867, 25870, 25871, 25875, 25879, 25881, 25882, 25884, 25886, 25887, 25888, 25889, 25890, 25891,
+        25892, 25893, 25897, 25905, 25906, 25911, 25913, 25914, 25915, 25919, 25921, 25923, 25925, 25926, 25927, 25928,
+        25929, 25930, 25934, 25936, 25940, 25944, 25947, 25949, 25951, 25952, 25953, 25954, 25955, 25956, 25957, 25958,
+        25959, 25962, 25969, 25969, 25971, 25977, 25991, 25998, 25999, 26009, 26023, 26034, 26039, 26043, 26052, 26052,
+        26054, 26056, 26060, 26067, 26073, 26076, 26082, 26088, 26092, 26097, 26106, 26113, 26114, 26122, 26128, 26131,
+        26131, 26131, 26131, 26131, 26131, 26131, 26133, 26135, 26135, 26135, 26139, 26143, 26143, 26143, 26143, 26143,
+        26143, 26146, 26149, 26152, 26155, 26157, 26160, 26163, 26165, 26167, 26170, 26173, 26175, 26177, 26179, 26181,
+        26183, 26183, 26183, 26183, 26183, 26183, 26183, 26183, 26183, 26183, 26183, 26183, 26183, 26186, 26186, 26186,
+        26186, 26186, 26187, 26188, 26189, 26190, 26192, 26195, 26196, 26197, 26199, 26202, 26203, 26204, 26206, 26208,
+        26209, 26211, 26214, 26216, 26217, 26220, 26224, 26226, 26227, 26229, 26232, 26234, 26235, 26236, 26237, 26238,
+        26239, 26239, 26239, 26242, 26242, 26242, 26242, 26242, 26242, 26242, 26242, 26242, 26242, 26242, 26242, 26242,
+        26242, 26243, 26244, 26245, 26246, 26247, 26248, 26249, 26250, 26252, 26255, 26258, 26260, 26261, 26262, 26263,
+        26264, 26265, 26266, 26266, 26266, 26269, 26271, 26271, 26271, 26271, 26271, 26271, 26271, 26271, 26271, 26271,
+        26271, 26272, 26273, 26274, 26275, 26276, 26277, 26279, 26281, 26283, 26285, 26287, 26289, 26292, 26294, 26296,
+        26298, 26298, 26298, 26303, 26303, 26303, 26303, 26305, 26305, 26305, 26305, 26305, 26305, 26305, 26305, 26305,
+        26305, 26306, 26307, 26309, 26311, 26312, 26314, 26317, 26320, 26321, 26323, 26326, 26328, 26329, 26330, 26332,
+        26334, 26334, 26335, 26339, 26339, 26339, 26340, 26343, 26343, 26343, 26343, 26343, 26343, 26343, 26343, 26343,
+        26343, 26344, 26345, 26346, 26347, 26348, 26350, 26353, 26355, 26356, 26358, 26362, 26364, 26365, 26366, 26368,
+        26370, 26370, 26372, 26372, 26372, 26372, 26379, 26379, 26379, 26379, 26379, 26379, 26379, 26379, 26379, 26379,
+        26379, 26380, 26381, 26382, 26383, 26385, 26388, 26391, 26393, 26395, 26398, 26402, 26405, 26406, 26407, 26410,
+        26412, 26412, 26412, 26416, 26417, 26417, 26417, 26418, 26419, 26419, 26419, 26419, 26419, 26419, 26419, 26419,
+        26419, 26420, 26422, 26424, 26425, 26426, 26429, 26432, 26433, 26434, 26437, 26440, 26441, 26442, 26443, 26444,
+        26445, 26445, 26445, 26445, 26445, 26445, 26445, 26445, 26449, 26449, 26449, 26449, 26454, 26454, 26454, 26454,
+        26454, 26456, 26458, 26459, 26460, 26462, 26464, 26466, 26467, 26469, 26472, 26475, 26477, 26478, 26480, 26483,
+        26485, 26486, 26488, 26490, 26491, 26493, 26497, 26499, 26500, 26502, 26505, 26508, 26510, 26511, 26512, 26514,
+        26516, 26516, 26516, 26520, 26520, 26520, 26520, 26525, 26525, 26525, 26525, 26525, 26525, 26525, 26525, 26525,
+        26525, 26526, 26527, 26528, 26529, 26531, 26533, 26536, 26538, 26540, 26543, 26546, 26548, 26549, 26550, 26551,
+        26552, 26552, 26554, 26556, 26556, 26556, 26562, 26563, 26563, 26563, 26563, 26563, 26563, 26563, 26563, 26563,
+        26563, 26564, 26565, 26566, 26568, 26569, 26571, 26574, 26577, 26578, 26582, 26586, 26588, 26589, 26592, 26594,
+        26595, 26595, 26595, 26595, 26595, 26595, 26599, 26604, 26604, 26604, 26604, 26604, 26604, 26604, 26604, 26604,
+        26604, 26605, 26606, 26607, 26608, 26609, 26611, 26615, 26618, 26619, 26621, 26625, 26627, 26628, 26630, 26631,
+        26632, 26632, 26637, 26641, 26641, 26641, 26641, 26641, 26641, 26641, 26641, 26641, 26641, 26641, 26641, 26641,
+        26641, 26642, 26643, 26644, 26645, 26647, 26650, 26651, 26653, 26655, 26659, 26661, 26663, 26664, 26665, 26668,
+        26669, 26669, 26669, 26669, 26669, 26669, 26669, 26672, 26672, 26672, 26672, 26682, 26682, 26682, 26682, 26682,
+        26682, 26683, 26685, 26687, 26689, 26691, 26695, 26698, 26700, 26704, 26708, 26711, 26713, 26715, 26717, 26720,
+        26721, 26721, 26728, 26729, 26729, 26729, 26729, 26729, 26729, 26729, 26729, 26729, 26729, 26729, 26729, 26729,
+        26729, 26730, 26731, 26732, 26733, 26736, 26739, 26741, 26742, 26744, 26748, 26751, 26752, 26754, 26756, 26757,
+        26758, 26758, 26758, 26758, 26758, 26758, 26764, 26764, 26764, 26764, 26764, 26764, 26764, 26764, 26764, 26764,
+        26764, 26765, 26766, 26767, 26768, 26770, 26773, 26775, 26776, 26777, 26778, 26781, 26784, 26785, 26786, 26788,
+        26791, 26791, 26791, 26795, 26796, 26796, 26796, 26803, 26804, 26804, 26804, 26804, 26804, 26804, 26804, 26804,
+        26804, 26805, 26807, 26810, 26812, 26813, 26816, 26818, 26819, 26821, 26825, 26828, 26830, 26831, 26833, 26836,
+        26837, 26839, 26840, 26840, 26840, 26843, 26851, 26851, 26851, 26851, 26851, 26851, 26851, 26851, 26851, 26851,
+        26851, 26852, 26853, 26854, 26855, 26858, 26861, 26862, 26863, 26864, 26866, 26870, 26875, 26876, 26877, 26881,
+        26884, 26884, 26884, 26884, 26884, 26884, 26884, 26884, 26884, 26884, 26885, 26892, 26892, 26892, 26893, 26894,
+        26894, 26895, 26898, 26900, 26901, 26902, 26905, 26909, 26910, 26911, 26913, 26916, 26917, 26918, 26919, 26920,
+        26921, 26921, 26921, 26921, 26921, 26921, 26921, 26929, 26929, 26929, 26929, 26929, 26929, 26929, 26929, 26929,
+        26929, 26931, 26934, 26935, 26936, 26939, 26941, 26942, 26944, 26948, 26951, 26953, 26955, 26956, 26957, 26959,
+        26960, 26960, 26960, 26960, 26960, 26960, 26960, 26961, 26963, 26963, 26963, 26966, 26971, 26971, 26971, 26972,
+        26973, 26974, 26975, 26976, 26977, 26979, 26981, 26985, 26987, 26989, 26991, 26993, 26995, 26997, 26999, 27000,
+        27001, 27001, 27001, 27001, 27001, 27001, 27011, 27028, 27028, 27028, 27046, 27070, 27070, 27070, 27070, 27070,
+        27070, 27070, 27072, 27077, 27080, 27086, 27096, 27110, 27117, 27122, 27132, 27148, 27151, 27153, 27158, 27163,
+        27163, 27163, 27163, 27163, 27163, 27175, 27200, 27200, 27200, 27203, 27210, 27210, 27210, 27210, 27210, 27210,
+        27210, 27212, 27218, 27220, 27220, 27224, 27231, 27235, 27237, 27244, 27254, 27265, 27272, 27275, 27277, 27281,
+        27285, 27285, 27285, 27287, 27294, 27294, 27294, 27296, 27298, 27298, 27298, 27298, 27298, 27298, 27298, 27298,
+        27298, 27299, 27300, 27301, 27303, 27305, 27309, 27315, 27319, 27321, 27324, 27328, 27331, 27333, 27335, 27337,
+        27339, 27339, 27339, 27349, 27349, 27349, 27349, 27349, 27349, 27349, 27349, 27349, 27349, 27349, 27349, 27349,
+        27349, 27351, 27356, 27358, 27360, 27362, 27366, 27368, 27370, 27374, 27379, 27381, 27384, 27388, 27391, 27393,
+        27396, 27396, 27396, 27396, 27396, 27396, 27396, 27396, 27396, 27401, 27406, 27406, 27406, 27410, 27413, 27413,
+        27413, 27415, 27417, 27419, 27421, 27424, 27427, 27429, 27431, 27435, 27439, 27443, 27446, 27448, 27451, 27453,
+        27455, 27455, 27455, 27455, 27455, 27455, 27455, 27455, 27455, 27492, 27492, 27492, 27492, 27495, 27495, 27495,
+        27495, 27497, 27502, 27510, 27515, 27520, 27529, 27536, 27540, 27549, 27559, 27566, 27568, 27572, 27577, 27579,
+        27579, 27579, 27579, 27579, 27579, 27579, 27579, 27579, 27579, 27579, 27579, 27585, 27590, 27590, 27590, 27592,
+        27594, 27597, 27600, 27602, 27604, 27608, 27612, 27616, 27619, 27622, 27625, 27628, 27630, 27631, 27633, 27635,
+        27637, 27637, 27638, 27639, 27639, 27639, 27648, 27654, 27654, 27654, 27655, 27656, 27656, 27656, 27656, 27656,
+        27656, 27658, 27663, 27666, 27668, 27672, 27676, 27679, 27681, 27685, 27690, 27693, 27695, 27697, 27699, 27701,
+        27703, 27705, 27707, 27707, 27707, 27716, 27722, 27722, 27722, 27724, 27725, 27725, 27725, 27725, 27725, 27725,
+        27725, 27726, 27728, 27731, 27732, 27736, 27741, 27743, 27747, 27749, 27754, 27758, 27762, 27763, 27765, 27766,
+        27767, 27767, 27767, 27767, 27767, 27767, 27769, 27773, 27776, 27776, 27778, 27786, 27788, 27788, 27788, 27788,
+        27788, 27789, 27791, 27793, 27795, 27797, 27802, 27805, 27807, 27808, 27813, 27817, 27819, 27820, 27825, 27829,
+        27830, 27830, 27830, 27830, 27830, 27830, 27830, 27830, 27830, 27831, 27842, 27843, 27843, 27843, 27844, 27845,
+        27845, 27846, 27849, 27851, 27852, 27853, 27856, 27861, 27864, 27865, 27869, 27872, 27873, 27874, 27876, 27878,
+        27879, 27879, 27879, 27879, 27879, 27879, 27879, 27879, 27879, 27880, 27880, 27880, 27880, 27891, 27894, 27894,
+        27894, 27895, 27897, 27898, 27899, 27901, 27910, 27914, 27916, 27919, 27924, 27926, 27927, 27929, 27932, 27934,
+        27935, 27935, 27935, 27935, 27935, 27937, 27939, 27940, 27940, 27948, 27958, 27959, 27959, 27960, 27961, 27961,
+        27961, 27965, 27968, 27972, 27975, 27982, 27990, 27994, 27997, 27998, 28000, 28001, 28002, 28003, 28004, 28005,
+        28006, 28006, 28006, 28006, 28006, 28006, 28006, 28006, 28006, 28006, 28007, 28012, 28014, 28014, 28017, 28027,
+        28029, 28030, 28032, 28034, 28036, 28038, 28042, 28048, 28051, 28053, 28058, 28063, 28066, 28068, 28070, 28073,
+        28075, 28075, 28075, 28075, 28075, 28075, 28075, 28075, 28075, 28075, 28076, 28078, 28079, 28079, 28085, 28097,
+        28102, 28106, 28114, 28116, 28118, 28121, 28130, 28133, 28137, 28138, 28141, 28143, 28147, 28149, 28152, 28154,
+        28156, 28156, 28156, 28156, 28156, 28156, 28156, 28156, 28156, 28160, 28162, 28162, 28162, 28168, 28170, 28170,
+        28170, 28171, 28174, 28176, 28177, 28178, 28182, 28184, 28185, 28186, 28191, 28193, 28194, 28195, 28199, 28200,
+        28200, 28208, 28209, 28209, 28209, 28219, 28220, 28220, 28220, 28222, 28222, 28222, 28222, 28222, 28222, 28222,
+        28222, 28226, 28230, 28234, 28236, 28238, 28241, 28246, 28248, 28251, 28253, 28258, 28260, 28261, 28262, 28263,
+        28264, 28264, 28264, 28264, 28264, 28264, 28264, 28264, 28264, 28264, 28266, 28272, 28276, 28276, 28278, 28283,
+        28286, 28288, 28291, 28294, 28296, 28298, 28303, 28307, 28309, 28311, 28314, 28317, 28319, 28320, 28322, 28325,
+        28327, 28330, 28333, 28334, 28335, 28339, 28346, 28348, 28349, 28350, 28352, 28357, 28359, 28360, 28361, 28364,
+        28367, 28375, 28380, 28382, 28384, 28387, 28389, 28391, 28393, 28394, 28395, 28396, 28397, 28398, 28399, 28400,
+        28401, 28401, 28401, 28401, 28401, 28413, 28413, 28413, 28413, 28413, 28413, 28413, 28413, 28413, 28413, 28413,
+        28413, 28416, 28419, 28421, 28422, 28424, 28427, 28431, 28432, 28433, 28436, 28439, 28442, 28443, 28444, 28445,
+        28447, 28447, 28447, 28447, 28447, 28452, 28453, 28453, 28453, 28463, 28464, 28464, 28464, 28464, 28464, 28464,
+        28464, 28466, 28468, 28469, 28470, 28475, 28483, 28487, 28489, 28492, 28499, 28501, 28503, 28504, 28505, 28507,
+        28508, 28509, 28510, 28510, 28510, 28521, 28523, 28523, 28523, 28523, 28523, 28523, 28523, 28523, 28523, 28523,
+        28523, 28524, 28525, 28526, 28527, 28528, 28529, 28533, 28536, 28538, 28541, 28545, 28547, 28549, 28550, 28551,
+        28553, 28553, 28553, 28553, 28553, 28553, 28553, 28553, 28553, 28555, 28563, 28566, 28566, 28567, 28572, 28575,
+        28575, 28577, 28578, 28580, 28580, 28583, 28588, 28592, 28593, 28594, 28599, 28602, 28605, 28607, 28609, 28611,
+        28612, 28612, 28612, 28612, 28612, 28612, 28612, 28612, 28612, 28616, 28625, 28625, 28625, 28625, 28625, 28625,
+        28625, 28627, 28629, 28632, 28633, 28636, 28638, 28640, 28641, 28643, 28648, 28654, 28656, 28657, 28659, 28663,
+        28665, 28665, 28666, 28673, 28679, 28679, 28680, 28683, 28684, 28684, 28684, 28684, 28684, 28684, 28684, 28684,
+        28684, 28685, 28688, 28694, 28696, 28698, 28702, 28705, 28706, 28709, 28711, 28713, 28714, 28715, 28717, 28718,
+        28718, 28719, 28721, 28721, 28721, 28724, 28735, 28735, 28735, 28735, 28735, 28735, 28735, 28735, 28735, 28735,
+        28735, 28736, 28740, 28742, 28743, 28745, 28750, 28752, 28753, 28756, 28762, 28765, 28768, 28769, 28772, 28775,
+        28777, 28777, 28777, 28777, 28777, 28777, 28777, 28777, 28777, 28777, 28777, 28783, 28789, 28789, 28789, 28794,
+        28800, 28800, 28802, 28804, 28805, 28806, 28809, 28814, 28819, 28821, 28824, 28828, 28831, 28833, 28836, 28839,
+        28841, 28841, 28841, 28843, 28846, 28846, 28846, 28860, 28865, 28865, 28865, 28868, 28870, 28870, 28870, 28870,
+        28870, 28871, 28873, 28875, 28878, 28881, 28888, 28892, 28895, 28899, 28904, 28906, 28907, 28909, 28911, 28913,
+        28914, 28914, 28914, 28914, 28914, 28914, 28914, 28914, 28914, 28914, 28915, 28925, 28925, 28925, 28925, 28925,
+        28925, 28926, 28928, 28930, 28932, 28934, 28937, 28941, 28944, 28945, 28946, 28949, 28951, 28952, 28954, 28957,
+        28959, 28959, 28959, 28959, 28959, 28959, 28967, 28974, 28974, 28974, 28983, 28986, 28986, 28986, 28986, 28986,
+        28986, 28987, 28990, 28994, 28997, 28999, 29002, 29008, 29011, 29014, 29019, 29026, 29028, 29029, 29032, 29035,
+        29036, 29036, 29038, 29040, 29040, 29040, 29051, 29053, 29053, 29053, 29053, 29053, 29053, 29053, 29053, 29053,
+        29053, 29055, 29057, 29059, 29061, 29064, 29069, 29073, 29075, 29079, 29085, 29091, 29094, 29096, 29098, 29101,
+        29103, 29112, 29117, 29117, 29117, 29117, 29118, 29118, 29118, 29118, 29118, 29118, 29118, 29118, 29118, 29118,
+        29118, 29119, 29120, 29122, 29123, 29125, 29126, 29128, 29129, 29131, 29135, 29140, 29142, 29144, 29147, 29152,
+        29154, 29154, 29154, 29154, 29154, 29154, 29154, 29154, 29154, 29155, 29156, 29159, 29164, 29165, 29167, 29172,
+        29183, 29184, 29186, 29194, 29196, 29198, 29201, 29207, 29210, 29211, 29213, 29215, 29217, 29218, 29219, 29220,
+        29221, 29221, 29221, 29221, 29221, 29222, 29223, 29224, 29225, 29227, 29233, 29241, 29248, 29250, 29252, 29253,
+        29254, 29255, 29258, 29260, 29261, 29266, 29272, 29282, 29283, 29286, 29290, 29294, 29295, 29296, 29297, 29298,
+        29299, 29299, 29299, 29299, 29299, 29310, 29313, 29313, 29313, 29318, 29321, 29321, 29321, 29321, 29321, 29321,
+        29321, 29323, 29331, 29334, 29335, 29338, 29342, 29345, 29347, 29350, 29355, 29358, 29360, 29362, 29364, 29366,
+        29367, 29367, 29368, 29369, 29369, 29369, 29379, 29384, 29385, 29385, 29386, 29387, 29388, 29388, 29388, 29388,
+        29388, 29389, 29391, 29392, 29392, 29398, 29402, 29404, 29404, 29405, 29409, 29411, 29412, 29413, 29415, 29417,
+        29418, 29419, 29426, 29426, 29426, 29429, 29435, 29435, 29435, 29435, 29435, 29435, 29435, 29435, 29435, 29435,
+        29435, 29436, 29438, 29440, 29441, 29443, 29447, 29451, 29454, 29457, 29462, 29465, 29466, 29469, 29471, 29473,
+        29474, 29488, 29490, 29490, 29490, 29493, 29494, 29494, 29494, 29494, 29494, 29494, 29494, 29494, 29494, 29494,
+        29494, 29494, 29495, 29497, 29498, 29498, 29500, 29503, 29504, 29506, 29511, 29516, 29518, 29519, 29523, 29528,
+        29529, 29530, 29542, 29546, 29547, 29548, 29552, 29558, 29559, 29560, 29561, 29565, 29566, 29566, 29566, 29566,
+        29566, 29568, 29576, 29579, 29580, 29581, 29587, 29592, 29593, 29594, 29595, 29599, 29601, 29602, 29603, 29606,
+        29609, 29609, 29611, 29620, 29626, 29626, 29627, 29630, 29635, 29635, 29636, 29637, 29638, 29638, 29638, 29638,
+        29638, 29641, 29643, 29648, 29650, 29651, 29657, 29663, 29667, 29668, 29669, 29671, 29674, 29675, 29676, 29677,
+        29678, 29680, 29684, 29685, 29686, 29690, 29699, 29700, 29701, 29706, 29711, 29713, 29714, 29716, 29718, 29719,
+        29720, 29722, 29731, 29732, 29733, 29739, 29743, 29744, 29745, 29747, 29750, 29752, 29753, 29754, 29755, 29756,
+        29757, 29757, 29757, 29757, 29757, 29759, 29766, 29767, 29767, 29770, 29778, 29779, 29779, 29779, 29779, 29779,
+        29779, 29780, 29781, 29785, 29786, 29790, 29793, 29799, 29804, 29806, 29809, 29812, 29814, 29815, 29816, 29818,
+        29819, 29819, 29819, 29819, 29819, 29819, 29819, 29819, 29819, 29820, 29827, 29832, 29832, 29835, 29841, 29843,
+        29843, 29845, 29848, 29854, 29857, 29859, 29862, 29869, 29872, 29875, 29878, 29882, 29883, 29886, 29888, 29890,
+        29891, 29891, 29891, 29891, 29891, 29899, 29899, 29899, 29899, 29909, 29909, 29909, 29909, 29910, 29910, 29910,
+        29910, 29912, 29915, 29920, 29923, 29927, 29932, 29937, 29939, 29941, 29943, 29946, 29949, 29950, 29951, 29952,
+        29953, 29953, 29953, 29954, 29954, 29954, 29954, 29963, 29963, 29963, 29963, 29964, 29964, 29964, 29964, 29964,
+        29964, 29966, 29968, 29970, 29972, 29974, 29976, 29981, 29985, 29987, 29990, 29994, 29998, 29999, 30001, 30003,
+        30004, 30004, 30004, 30004, 30004, 30004, 30005, 30014, 30014, 30014, 30016, 30022, 30022, 30022, 30022, 30022,
+        30022, 30023, 30024, 30026, 30027, 30029, 30034, 30039, 30042, 30046, 30052, 30054, 30056, 30058, 30061, 30063,
+        30064, 30064, 30067, 30077, 30077, 30077, 30078, 30081, 30081, 30081, 30081, 30081, 30081, 30081, 30081, 30081,
+        30081, 30082, 30083, 30084, 30086, 30088, 30092, 30094, 30097, 30099, 30104, 30105, 30106, 30107, 30110, 30112,
+        30113, 30113, 30116, 30118, 30118, 30118, 30126, 30131, 30131, 30131, 30131, 30131, 30131, 30131, 30131, 30131,
+        30131, 30132, 30134, 30136, 30137, 30139, 30142, 30146, 30150, 30151, 30152, 30157, 30159, 30160, 30162, 30167,
+        30169, 30169, 30169, 30174, 30183, 30183, 30183, 30184, 30187, 30187, 30187, 30187, 30187, 30187, 30187, 30187,
+        30187, 30188, 30190, 30191, 30192, 30197, 30203, 30209, 30211, 30212, 30217, 30221, 30223, 30223, 30224, 30225,
+        30226, 30226, 30242, 30250, 30251, 30254, 30265, 30277, 30282, 30286, 30298, 30307, 30313, 30314, 30316, 30319,
+        30321, 30323, 30328, 30329, 30330, 30333, 30339, 30342, 30345, 30348, 30353, 30355, 30357, 30358, 30359, 30360,
+        30361, 30362, 30363, 30365, 30366, 30367, 30368, 30372, 30373, 30376, 30380, 30382, 30383, 30385, 30389, 30391,
+        30392, 30398, 30399, 30400, 30401, 30406, 30408, 30409, 30410, 30413, 30415, 30416, 30417, 30418, 30419, 30420,
+        30421, 30423, 30424, 30425, 30426, 30432, 30433, 30434, 30435, 30442, 30443, 30444, 30445, 30450, 30451, 30452,
+        30453, 30458, 30463, 30465, 30467, 30470, 30475, 30478, 30480, 30482, 30487, 30490, 30493, 30494, 30496, 30498,
+        30500, 30502, 30504, 30506, 30507, 30508, 30510, 30513, 30517, 30519, 30522, 30526, 30529, 30531, 30533, 30534,
+        30535, 30538, 30547, 30550, 30551, 30553, 30557, 30560, 30561, 30562, 30563, 30564, 30565, 30566, 30567, 30568,
+        30570, 30571, 30573, 30582, 30584, 30585, 30588, 30594, 30596, 30598, 30602, 30605, 30606, 30608, 30611, 30612,
+        30613, 30616, 30621, 30622, 30622, 30626, 30634, 30636, 30637, 30638, 30639, 30640, 30641, 30642, 30643, 30644,
+        30645, 30648, 30651, 30657, 30660, 30666, 30672, 30679, 30683, 30686, 30691, 30696, 30700, 30702, 30705, 30707,
+        30707, 30707, 30707, 30707, 30711, 30711, 30711, 30711, 30711, 30711, 30711, 30711, 30711, 30711, 30711, 30711,
+        30711, 30713, 30715, 30717, 30719, 30722, 30726, 30729, 30731, 30733, 30735, 30737, 30738, 30739, 30740, 30741,
+        30742, 30742, 30742, 30742, 30742, 30742, 30742, 30742, 30742, 30742, 30742, 30748, 30748, 30748, 30748, 30751,
+        30751, 30753, 30756, 30760, 30762, 30764, 30767, 30771, 30774, 30776, 30778, 30780, 30781, 30782, 30783, 30784,
+        30785, 30785, 30785, 30785, 30785, 30785, 30785, 30785, 30785, 30785, 30785, 30786, 30786, 30786, 30786, 30790,
+        30790, 30791, 30793, 30795, 30796, 30797, 30801, 30804, 30805, 30806, 30808, 30810, 30811, 30812, 30813, 30814,
+        30815, 30815, 30815, 30816, 30817, 30818, 30819, 30820, 30821, 30826, 30828, 30828, 30828, 30837, 30838, 30838,
+        30838, 30838, 30838, 30839, 30840, 30841, 30842, 30843, 30844, 30849, 30851, 30851, 30851, 30860, 30861, 30861,
+        30861, 30861, 30861, 30861, 30861, 30861, 30861, 30861, 30877, 30877, 30877, 30877, 30901, 30901, 30901, 30901,
+        30901, 30901, 30906, 30912, 30914, 30916, 30923, 30929, 30932, 30936, 30944, 30954, 30960, 30960, 30964, 30974,
+        30978, 30978, 30978, 30978, 30978, 30978, 30978, 30978, 30978, 30978, 30978, 30992, 30996, 30996, 30996, 30998,
+        31000, 31002, 31006, 31008, 31010, 31016, 31023, 31025, 31027, 31028, 31031, 31036, 31039, 31039, 31040, 31042,
+        31043, 31043, 31043, 31043, 31043, 31043, 31043, 31043, 31043, 31043, 31043, 31045, 31052, 31052, 31052, 31056,
+        31074, 31075, 31076, 31080, 31081, 31084, 31089, 31094, 31096, 31097, 31103, 31109, 31110, 31111, 31117, 31121,
+        31122, 31122, 31122, 31123, 31137, 31137, 31137, 31142, 31151, 31151, 31151, 31151, 31151, 31151, 31151, 31151,
+        31151, 31151, 31152, 31157, 31160, 31161, 31166, 31175, 31178, 31180, 31184, 31187, 31189, 31192, 31195, 31197,
+        31199, 31199, 31199, 31199, 31199, 31199, 31200, 31210, 31212, 31212, 31212, 31219, 31221, 31221, 31221, 31221,
+        31221, 31222, 31225, 31226, 31227, 31230, 31236, 31244, 31246, 31247, 31252, 31256, 31257, 31258, 31260, 31262,
+        31263, 31263, 31263, 31275, 31278, 31278, 31278, 31286, 31287, 31287, 31287, 31287, 31287, 31287, 31287, 31287,
+        31287, 31288, 31290, 31292, 31293, 31295, 31300, 31307, 31310, 31313, 31317, 31321, 31322, 31325, 31329, 31331,
+        31332, 31347, 31361, 31361, 31361, 31363, 31364, 31364, 31364, 31364, 31364, 31364, 31364, 31364, 31364, 31364,
+        31364, 31364, 31367, 31368, 31369, 31370, 31378, 31383, 31386, 31388, 31395, 31405, 31407, 31408, 31410, 31412,
+        31413, 31413, 31413, 31413, 31413, 31413, 31413, 31421, 31425, 31425, 31425, 31436, 31447, 31447, 31447, 31447,
+        31447, 31450, 31455, 31458, 31459, 31462, 31469, 31477, 31479, 31482, 31487, 31494, 31496, 31498, 31501, 31504,
+        31507, 31507, 31507, 31507, 31507, 31507, 31513, 31513, 31513, 31513, 31524, 31525, 31525, 31525, 31527, 31528,
+        31528, 31532, 31536, 31538, 31539, 31541, 31546, 31549, 31551, 31553, 31555, 31561, 31564, 31565, 31566, 31568,
+        31570, 31570, 31570, 31570, 31570, 31570, 31571, 31572, 31572, 31572, 31580, 31587, 31587, 31587, 31590, 31597,
+        31597, 31598, 31600, 31601, 31601, 31603, 31608, 31611, 31612, 31615, 31620, 31625, 31627, 31628, 31633, 31638,
+        31640, 31640, 31643, 31644, 31644, 31644, 31670, 31695, 31695, 31695, 31699, 31708, 31708, 31708, 31708, 31708,
+        31708, 31709, 31711, 31713, 31714, 31715, 31719, 31726, 31729, 31731, 31740, 31759, 31770, 31771, 31775, 31790,
+        31797, 31797, 31797, 31797, 31797, 31797, 31809, 31839, 31841, 31841, 31841, 31845, 31847, 31847, 31847, 31847,
+        31847, 31854, 31863, 31864, 31865, 31874, 31885, 31890, 31892, 31899, 31909, 31913, 31916, 31916, 31917, 31919,
+        31920, 31923, 31925, 31926, 31927, 31930, 31937, 31942, 31944, 31946, 31954, 31960, 31965, 31966, 31967, 31970,
+        31972, 31974, 31976, 31979, 31984, 31986, 31993, 32003, 32009, 32011, 32015, 32021, 32023, 32025, 32030, 32032,
+        32033, 32034, 32038, 32042, 32044, 32045, 32050, 32055, 32058, 32060, 32068, 32073, 32075, 32078, 32081, 32083,
+        32084, 32088, 32093, 32095, 32097, 32102, 32109, 32112, 32114, 32119, 32125, 32130, 32135, 32137, 32139, 32141,
+        32142, 32145, 32148, 32151, 32153, 32156, 32160, 32171, 32175, 32177, 32179, 32182, 32185, 32186, 32187, 32190,
+        32193, 32194, 32203, 32209, 32210, 32211, 32214, 32221, 32226, 32227, 32228, 32231, 32240, 32240, 32240, 32243,
+        32248, 32250, 32256, 32261, 32263, 32267, 32276, 32283, 32286, 32287, 32289, 32291, 32293, 32294, 32295, 32296,
+        32297, 32299, 32302, 32304, 32307, 32309, 32314, 32320, 32324, 32328, 32331, 32337, 32342, 32344, 32348, 32351,
+        32354, 32355, 32357, 32362, 32364, 32366, 32371, 32381, 32386, 32388, 32392, 32397, 32400, 32402, 32404, 32408,
+        32411, 32412, 32416, 32418, 32419, 32420, 32423, 32432, 32434, 32435, 32437, 32444, 32447, 32448, 32450, 32454,
+        32457, 32459, 32464, 32467, 32469, 32470, 32473, 32482, 32484, 32485, 32488, 32494, 32497, 32498, 32499, 32502,
+        32504, 32505, 32508, 32515, 32517, 32518, 32521, 32532, 32538, 32540, 32542, 32543, 32544, 32545, 32546, 32547,
+        32548, 32549, 32550, 32552, 32555, 32556, 32558, 32565, 32568, 32570, 32576, 32581, 32582, 32584, 32586, 32587,
+        32588, 32589, 32590, 32592, 32594, 32595, 32596, 32598, 32602, 32603, 32606, 32607, 32617, 32618, 32621, 32622,
+        32626, 32631, 32638, 32642, 32643, 32653, 32665, 32673, 32678, 32679, 32691, 32703, 32710, 32710, 32716, 32726,
+        32729, 32729, 32730, 32735, 32736, 32740, 32745, 32755, 32758, 32763, 32767, 32773, 32776, 32779, 32781, 32785,
+        32789, 32791, 32791, 32791, 32792, 32792, 32792, 32792, 32794, 32794, 32794, 32794, 32794, 32794, 32795, 32795,
+        32795,
+};
+
+// non-restricted records (ascending per cell) that intersect the cell
+static const unsigned short RESTRICTED_OVERLAP[32795] = {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+        3, 3, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+        6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+        6, 7, 55, 55, 56, 52, 53, 54, 55, 56, 55, 55, 55, 52, 55, 56,
+        52, 55, 56, 52, 53, 54, 55, 56, 53, 54, 56, 52, 55, 56, 52, 55,
+        56, 52, 53, 54, 55, 56, 53, 54, 56, 52, 55, 56, 52, 55, 56, 52,
+        53, 54, 55, 56, 53, 54, 56, 52, 55, 56, 52, 55, 56, 52, 53, 54,
+        55, 56, 53, 54, 56, 59, 60, 59, 60, 59, 60, 60, 60, 59, 60, 59,
+        60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 67, 68, 67, 68, 67,
+        68, 67, 68, 67, 68, 67, 68, 67, 68, 67, 68, 67, 68, 68, 68, 68,
+        68, 68, 68, 68, 68, 78, 78, 73, 74, 75, 76, 77, 79, 79, 82, 83,
+        81, 82, 83, 83, 84, 84, 83, 81, 83, 83, 84, 84, 85, 84, 85, 84,
+        85, 85, 85, 85, 87, 88, 89, 90, 91, 92, 87, 88, 92, 87, 88, 92,
+        88, 92, 92, 88, 89, 92, 88, 89, 92, 88, 89, 92, 92, 89, 90, 91,
+        92, 89, 90, 91, 92, 89, 92, 92, 91, 92, 91, 92, 92, 92, 132, 134,
+        137, 135, 137, 135, 137, 136, 137, 137, 137, 137, 137, 137, 133, 137, 137, 137,
+        161, 162, 163, 164, 165, 166, 167, 168, 169, 170, 171, 174, 178, 179, 174, 178,
+        179, 177, 177, 173, 177, 173, 177, 175, 176, 177, 176, 177, 184, 185, 184, 186,
+        186, 181, 183, 182, 181, 183, 194, 194, 194, 195, 195, 195, 195, 192, 193, 195,
+        192, 193, 195, 193, 195, 193, 195, 202, 204, 204, 204, 204, 204, 204, 205, 204,
+        205, 204, 205, 204, 203, 204, 205, 200, 201, 203, 204, 205, 204, 205, 204, 203,
+        204, 205, 203, 204, 205, 204, 205, 210, 210, 210, 210, 209, 210, 209, 210, 209,
+        207, 208, 209, 207, 208, 209, 208, 209, 207, 208, 207, 208, 208, 233, 233, 233,
+        233, 233, 233, 232, 232, 231, 232, 232, 232, 229, 230, 231, 232, 239, 240, 239,
+        240, 240, 240, 239, 240, 239, 240, 240, 240, 239, 240, 239, 240, 240, 240, 240,
+        240, 240, 240, 246, 247, 247, 247, 247, 247, 247, 247, 246, 247, 246, 247, 247,
+        247, 247, 247, 247, 247, 247, 247, 247, 279, 279, 278, 278, 268, 278, 279, 271,
+        275, 278, 279, 278, 258, 259, 262, 263, 264, 276, 278, 252, 267, 268, 269, 270,
+        277, 278, 253, 271, 272, 273, 275, 278, 254, 255, 256, 257, 278, 260, 261, 262,
+        265, 266, 276, 278, 266, 269, 277, 278, 274, 278, 286, 288, 283, 284, 286, 288,
+        284, 286, 288, 286, 288, 286, 288, 286, 288, 286, 288, 285, 286, 288, 286, 287,
+        286, 287, 286, 287, 285, 286, 287, 287, 287, 287, 287, 295, 295, 295, 294, 294,
+        295, 294, 295, 294, 295, 294, 294, 295, 294, 295, 294, 295, 294, 292, 294, 292,
+        293, 294, 294, 325, 326, 326, 326, 326, 327, 327, 327, 327, 330, 330, 330, 330,
+        330, 330, 329, 330, 330, 330, 330, 330, 330, 330, 330, 330, 330, 338, 338, 338,
+        338, 338, 338, 336, 336, 338, 335, 336, 337, 338, 337, 338, 336, 336, 336, 337,
+        337, 353, 354, 355, 356, 361, 357, 360, 358, 362, 359, 359, 365, 366, 365, 366,
+        364, 365, 366, 365, 366, 369, 370, 368, 369, 370, 369, 368, 369, 368, 369, 369,
+        369, 370, 368, 369, 370, 368, 369, 370, 369, 370, 369, 370, 369, 370, 369, 370,
+        369, 370, 370, 370, 370, 370, 381, 381, 380, 380, 384, 381, 380, 382, 383, 377,
+        378, 379, 380, 384, 398, 396, 398, 396, 397, 398, 398, 391, 398, 390, 391, 398,
+        398, 398, 389, 391, 398, 386, 387, 388, 390, 391, 398, 398, 398, 393, 394, 395,
+        392, 392, 417, 418, 419, 420, 421, 413, 416, 414, 415, 424, 425, 422, 423, 427,
+        426, 429, 430, 431, 432, 432, 431, 432, 431, 432, 432, 432, 431, 432, 430, 431,
+        432, 430, 432, 432, 431, 432, 430, 431, 432, 430, 432, 432, 432, 429, 430, 432,
+        430, 432, 440, 441, 442, 443, 444, 445, 444, 445, 443, 444, 445, 445, 445, 445,
+        440, 441, 443, 445, 441, 445, 445, 445, 440, 441, 442, 445, 441, 442, 445, 445,
+        445, 442, 445, 442, 445, 445, 487, 491, 493, 494, 495, 487, 488, 489, 490, 492,
+        493, 494, 495, 491, 495, 491, 494, 495, 495, 495, 489, 491, 493, 495, 487, 489,
+        491, 492, 494, 495, 495, 495, 489, 495, 489, 495, 488, 495, 495, 495, 490, 495,
+        490, 495, 495, 565, 566, 567, 568, 568, 568, 567, 568, 567, 568, 568, 566, 568,
+        565, 566, 567, 568, 567, 568, 568, 566, 568, 565, 566, 568, 568, 568, 568, 568,
+        568, 582, 582, 579, 579, 584, 585, 573, 574, 575, 576, 578, 580, 581, 582, 571,
+        572, 573, 578, 581, 582, 583, 578, 579, 579, 578, 577, 578, 577, 578, 579, 587,
+        579, 586, 601, 602, 603, 604, 605, 606, 607, 608, 609, 610, 611, 612, 613, 614,
+        615, 616, 617, 618, 619, 620, 621, 622, 623, 624, 625, 626, 627, 628, 629, 630,
+        631, 632, 633, 634, 606, 607, 628, 629, 634, 614, 615, 628, 634, 608, 624, 634,
+        634, 602, 612, 622, 623, 634, 601, 602, 610, 615, 621, 634, 608, 610, 618, 620,
+        626, 634, 634, 602, 611, 625, 634, 602, 610, 616, 634, 603, 604, 605, 609, 610,
+        617, 619, 627, 630, 631, 632, 633, 634, 609, 634, 634, 616, 634, 603, 617, 633,
+        634, 613, 634, 663, 700, 637, 638, 639, 640, 641, 642, 643, 644, 645, 646, 647,
+        648, 649, 650, 651, 652, 653, 654, 655, 656, 657, 659, 660, 661, 662, 664, 665,
+        666, 667, 668, 669, 670, 671, 672, 673, 674, 675, 676, 677, 678, 679, 680, 681,
+        682, 683, 684, 685, 686, 687, 688, 689, 690, 691, 692, 693, 694, 695, 696, 697,
+        698, 699, 700, 658, 660, 661, 662, 700, 700, 663, 700, 700, 700, 670, 671, 672,
+        673, 674, 675, 676, 700, 651, 668, 683, 684, 686, 687, 700, 684, 685, 687, 688,
+        700, 700, 646, 653, 669, 670, 671, 700, 638, 639, 640, 641, 642, 643, 644, 645,
+        646, 652, 655, 656, 657, 659, 667, 680, 681, 683, 684, 690, 691, 697, 700, 637,
+        677, 678, 679, 681, 682, 684, 685, 689, 690, 692, 693, 694, 695, 696, 697, 698,
+        699, 700, 692, 700, 700, 647, 648, 649, 655, 656, 660, 665, 700, 648, 649, 650,
+        654, 658, 660, 661, 662, 664, 665, 666, 693, 694, 700, 664, 700, 735, 703, 704,
+        705, 706, 707, 708, 709, 710, 711, 712, 713, 714, 715, 716, 717, 718, 719, 720,
+        721, 722, 723, 724, 725, 726, 727, 728, 729, 730, 731, 732, 733, 734, 735, 735,
+        704, 705, 706, 707, 708, 709, 710, 711, 735, 704, 706, 735, 715, 716, 717, 718,
+        719, 720, 721, 722, 723, 735, 717, 735, 704, 735, 704, 735, 703, 712, 715, 716,
+        717, 730, 732, 735, 703, 712, 714, 717, 727, 735, 735, 735, 712, 713, 724, 726,
+        731, 732, 735, 712, 713, 724, 727, 731, 735, 735, 735, 724, 725, 728, 729, 733,
+        735, 724, 729, 733, 734, 735, 738, 739, 740, 742, 743, 744, 745, 746, 747, 748,
+        749, 751, 752, 753, 755, 756, 757, 758, 760, 762, 763, 764, 765, 767, 768, 770,
+        772, 773, 774, 741, 744, 750, 754, 759, 760, 761, 766, 769, 771, 774, 774, 774,
+        744, 754, 757, 769, 774, 750, 774, 742, 751, 758, 773, 774, 738, 739, 745, 758,
+        774, 739, 744, 745, 746, 754, 760, 764, 766, 774, 741, 759, 761, 774, 740, 742,
+        747, 748, 758, 763, 765, 767, 768, 772, 773, 774, 738, 739, 740, 743, 749, 756,
+        758, 762, 767, 768, 774, 739, 743, 752, 755, 771, 774, 759, 771, 774, 774, 753,
+        770, 774, 774, 774, 778, 779, 781, 783, 785, 786, 777, 780, 782, 783, 784, 786,
+        785, 786, 785, 786, 786, 786, 779, 786, 779, 782, 786, 782, 786, 786, 778, 779,
+        786, 778, 779, 780, 786, 777, 780, 786, 786, 786, 781, 783, 786, 783, 784, 786,
+        784, 786, 802, 803, 804, 806, 807, 811, 813, 819, 821, 823, 798, 799, 800, 801,
+        803, 804, 805, 808, 809, 810, 812, 814, 815, 816, 817, 818, 820, 822, 823, 806,
+        811, 821, 823, 800, 823, 823, 816, 823, 813, 819, 823, 801, 822, 823, 810, 817,
+        823, 809, 814, 823, 802, 803, 807, 823, 798, 799, 803, 805, 823, 799, 805, 808,
+        812, 818, 823, 812, 814, 820, 823, 802, 803, 804, 823, 798, 799, 803, 804, 823,
+        799, 815, 823, 823, 906, 920, 921, 902, 905, 921, 922, 923, 924, 893, 895, 897,
+        911, 915, 916, 920, 921, 896, 898, 899, 900, 901, 903, 904, 905, 911, 912, 913,
+        914, 916, 917, 918, 919, 921, 922, 923, 924, 907, 909, 892, 894, 907, 908, 909,
+        910, 926, 927, 928, 929, 930, 931, 932, 933, 934, 935, 936, 937, 938, 939, 940,
+        941, 942, 943, 944, 945, 946, 947, 948, 949, 950, 951, 952, 953, 954, 955, 956,
+        957, 958, 959, 959, 959, 937, 942, 948, 959, 937, 952, 959, 959, 927, 930, 932,
+        934, 953, 955, 956, 957, 959, 927, 928, 933, 934, 938, 939, 945, 949, 959, 946,
+        947, 950, 959, 931, 935, 959, 927, 936, 941, 959, 926, 927, 936, 941, 944, 954,
+        959, 943, 947, 951, 959, 959, 929, 958, 959, 959, 940, 959, 959, 1031, 1032, 1033,
+        1035, 1045, 1055, 1056, 1057, 1058, 1059, 1060, 1061, 1062, 1063, 1064, 1065, 1066, 1056, 1059,
+        1060, 1065, 1066, 1026, 1027, 1028, 1029, 1030, 1031, 1034, 1036, 1037, 1038, 1039, 1040, 1041,
+        1042, 1043, 1044, 1045, 1046, 1047, 1048, 1049, 1050, 1051, 1052, 1053, 1054, 1061, 1062, 1063,
+        1064, 1065, 1066, 1067, 1068, 1069, 1070, 1071, 1072, 1073, 1074, 1075, 1076, 1077, 1078, 1042,
+        1065, 1066, 1072, 1057, 1055, 1056, 1057, 1058, 1059, 1055, 1056, 1059, 1060, 1061, 1032, 1035,
+        1045, 1057, 1061, 1062, 1063, 1031, 1032, 1033, 1055, 1057, 1058, 1059, 1063, 1064, 1055, 1059,
+        1060, 1064, 1065, 1066, 1039, 1041, 1043, 1044, 1061, 1067, 1068, 1074, 1026, 1028, 1029, 1045,
+        1061, 1062, 1063, 1068, 1069, 1070, 1074, 1075, 1028, 1031, 1034, 1037, 1040, 1047, 1048, 1052,
+        1063, 1064, 1070, 1071, 1078, 1040, 1042, 1046, 1047, 1048, 1049, 1064, 1065, 1066, 1071, 1072,
+        1078, 1030, 1038, 1067, 1068, 1073, 1074, 1027, 1028, 1029, 1054, 1068, 1069, 1070, 1074, 1075,
+        1076, 1027, 1028, 1036, 1040, 1050, 1051, 1053, 1054, 1070, 1071, 1076, 1077, 1078, 1040, 1071,
+        1072, 1077, 1078, 1081, 1082, 1083, 1084, 1085, 1086, 1087, 1088, 1089, 1090, 1091, 1092, 1093,
+        1094, 1095, 1096, 1097, 1098, 1099, 1100, 1101, 1102, 1103, 1104, 1105, 1106, 1107, 1108, 1109,
+        1110, 1112, 1113, 1114, 1115, 1116, 1117, 1118, 1119, 1120, 1121, 1122, 1123, 1124, 1125, 1126,
+        1127, 1128, 1129, 1130, 1131, 1132, 1133, 1134, 1135, 1136, 1088, 1096, 1109, 1111, 1112, 1117,
+        1118, 1119, 1120, 1087, 1102, 1132, 1135, 1093, 1102, 1106, 1132, 1133, 1135, 1136, 1133, 1113,
+        1129, 1132, 1082, 1092, 1104, 1129, 1130, 1132, 1133, 1083, 1085, 1095, 1099, 1107, 1115, 1130,
+        1131, 1133, 1134, 1121, 1122, 1125, 1084, 1089, 1097, 1100, 1105, 1116, 1122, 1123, 1125, 1126,
+        1129, 1081, 1082, 1086, 1090, 1091, 1098, 1114, 1116, 1123, 1124, 1126, 1127, 1129, 1130, 1114,
+        1124, 1127, 1128, 1130, 1131, 1096, 1103, 1110, 1111, 1112, 1117, 1118, 1121, 1122, 1084, 1088,
+        1094, 1101, 1103, 1109, 1110, 1111, 1118, 1119, 1122, 1123, 1086, 1098, 1108, 1119, 1120, 1123,
+        1124, 1120, 1124, 1139, 1140, 1141, 1142, 1143, 1144, 1145, 1146, 1147, 1148, 1149, 1150, 1150,
+        1150, 1146, 1147, 1150, 1147, 1150, 1150, 1150, 1140, 1144, 1146, 1147, 1150, 1147, 1149, 1150,
+        1150, 1145, 1150, 1139, 1140, 1143, 1145, 1148, 1150, 1141, 1148, 1150, 1142, 1150, 1150, 1143,
+        1150, 1141, 1150, 1142, 1150, 1156, 1159, 1181, 1198, 1201, 1204, 1208, 1156, 1157, 1158, 1159,
+        1173, 1174, 1181, 1198, 1199, 1200, 1201, 1202, 1203, 1204, 1205, 1206, 1200, 1203, 1206, 1169,
+        1170, 1191, 1195, 1198, 1207, 1208, 1162, 1170, 1171, 1172, 1175, 1176, 1179, 1180, 1184, 1191,
+        1192, 1193, 1195, 1196, 1197, 1198, 1199, 1200, 1178, 1193, 1194, 1197, 1200, 1209, 1191, 1210,
+        1154, 1155, 1160, 1161, 1162, 1172, 1177, 1182, 1183, 1185, 1186, 1188, 1189, 1191, 1192, 1193,
+        1153, 1154, 1163, 1164, 1165, 1166, 1167, 1168, 1186, 1187, 1189, 1190, 1193, 1194, 1211, 1213,
+        1185, 1186, 1213, 1186, 1187, 1212, 1239, 1240, 1241, 1242, 1243, 1244, 1245, 1246, 1247, 1248,
+        1250, 1251, 1252, 1253, 1254, 1255, 1257, 1258, 1259, 1260, 1261, 1262, 1263, 1264, 1265, 1249,
+        1256, 1261, 1265, 1240, 1246, 1247, 1265, 1258, 1265, 1259, 1261, 1265, 1265, 1248, 1260, 1262,
+        1264, 1265, 1252, 1255, 1265, 1265, 1265, 1253, 1257, 1262, 1265, 1242, 1243, 1245, 1251, 1255,
+        1265, 1243, 1250, 1265, 1256, 1265, 1265, 1241, 1243, 1244, 1263, 1265, 1239, 1243, 1249, 1254,
+        1265, 1249, 1265, 1268, 1269, 1270, 1271, 1272, 1273, 1275, 1276, 1277, 1278, 1279, 1281, 1282,
+        1283, 1284, 1285, 1286, 1288, 1289, 1290, 1291, 1292, 1293, 1294, 1295, 1296, 1298, 1300, 1303,
+        1305, 1307, 1308, 1309, 1310, 1311, 1312, 1314, 1315, 1316, 1317, 1319, 1320, 1321, 1322, 1324,
+        1325, 1326, 1329, 1330, 1332, 1333, 1274, 1275, 1280, 1287, 1297, 1298, 1299, 1301, 1302, 1304,
+        1306, 1307, 1308, 1313, 1314, 1318, 1319, 1323, 1324, 1327, 1328, 1329, 1331, 1332, 1310, 1311,
+        1312, 1309, 1310, 1272, 1285, 1292, 1298, 1299, 1301, 1307, 1308, 1309, 1270, 1278, 1281, 1288,
+        1290, 1294, 1310, 1311, 1312, 1316, 1317, 1322, 1269, 1270, 1271, 1273, 1276, 1277, 1278, 1281,
+        1282, 1283, 1288, 1289, 1290, 1291, 1294, 1295, 1296, 1305, 1309, 1310, 1315, 1316, 1320, 1321,
+        1322, 1272, 1273, 1275, 1279, 1282, 1286, 1292, 1293, 1303, 1308, 1309, 1313, 1314, 1315, 1319,
+        1320, 1313, 1318, 1319, 1294, 1322, 1268, 1273, 1294, 1296, 1300, 1320, 1321, 1322, 1325, 1326,
+        1273, 1279, 1287, 1297, 1302, 1319, 1320, 1324, 1325, 1274, 1304, 1306, 1318, 1319, 1323, 1324,
+        1325, 1326, 1329, 1330, 1333, 1284, 1324, 1325, 1328, 1329, 1332, 1333, 1280, 1323, 1324, 1327,
+        1328, 1331, 1332, 1339, 1340, 1341, 1342, 1343, 1344, 1345, 1346, 1348, 1349, 1351, 1352, 1353,
+        1354, 1355, 1357, 1358, 1359, 1360, 1362, 1365, 1366, 1367, 1368, 1369, 1370, 1371, 1373, 1374,
+        1375, 1376, 1378, 1379, 1380, 1381, 1382, 1383, 1384, 1385, 1386, 1387, 1388, 1389, 1390, 1391,
+        1392, 1393, 1394, 1395, 1396, 1397, 1398, 1399, 1400, 1408, 1336, 1337, 1338, 1347, 1350, 1356,
+        1361, 1363, 1364, 1372, 1377, 1397, 1398, 1399, 1400, 1401, 1402, 1403, 1404, 1405, 1406, 1407,
+        1408, 1409, 1410, 1411, 1359, 1362, 1365, 1380, 1381, 1382, 1383, 1384, 1385, 1341, 1358, 1359,
+        1367, 1368, 1371, 1382, 1385, 1399, 1400, 1401, 1402, 1347, 1364, 1401, 1402, 1405, 1406, 1411,
+        1372, 1410, 1343, 1345, 1346, 1348, 1349, 1353, 1355, 1369, 1373, 1376, 1383, 1384, 1385, 1386,
+        1387, 1388, 1339, 1341, 1346, 1349, 1356, 1366, 1368, 1373, 1374, 1385, 1388, 1397, 1398, 1399,
+        1402, 1403, 1407, 1336, 1337, 1338, 1350, 1361, 1363, 1377, 1402, 1403, 1404, 1405, 1407, 1348,
+        1351, 1352, 1353, 1357, 1369, 1375, 1379, 1386, 1387, 1388, 1389, 1390, 1391, 1392, 1393, 1394,
+        1339, 1340, 1344, 1370, 1388, 1391, 1394, 1397, 1407, 1409, 1407, 1409, 1375, 1392, 1393, 1394,
+        1395, 1342, 1354, 1360, 1378, 1394, 1395, 1396, 1408, 1423, 1437, 1442, 1443, 1449, 1450, 1456,
+        1457, 1414, 1415, 1416, 1417, 1418, 1419, 1420, 1421, 1422, 1424, 1425, 1426, 1427, 1428, 1429,
+        1430, 1431, 1432, 1433, 1434, 1435, 1436, 1437, 1438, 1439, 1440, 1441, 1443, 1444, 1445, 1446,
+        1447, 1448, 1450, 1451, 1452, 1453, 1454, 1455, 1457, 1458, 1459, 1460, 1461, 1462, 1463, 1464,
+        1417, 1441, 1456, 1457, 1457, 1458, 1459, 1425, 1459, 1460, 1461, 1463, 1424, 1431, 1461, 1462,
+        1463, 1423, 1449, 1450, 1456, 1457, 1419, 1450, 1451, 1452, 1457, 1458, 1459, 1416, 1420, 1434,
+        1436, 1452, 1453, 1454, 1459, 1460, 1461, 1416, 1431, 1454, 1455, 1461, 1462, 1442, 1443, 1449,
+        1450, 1426, 1435, 1437, 1438, 1443, 1444, 1445, 1450, 1451, 1452, 1428, 1430, 1432, 1433, 1436,
+        1438, 1439, 1440, 1445, 1446, 1447, 1452, 1453, 1454, 1440, 1441, 1447, 1448, 1454, 1455, 1414,
+        1415, 1437, 1438, 1415, 1421, 1430, 1438, 1439, 1440, 1464, 1417, 1418, 1422, 1427, 1429, 1440,
+        1441, 1464, 1515, 1535, 1536, 1541, 1542, 1536, 1537, 1538, 1542, 1538, 1539, 1540, 1540, 1544,
+        1477, 1495, 1504, 1507, 1512, 1528, 1529, 1535, 1536, 1468, 1477, 1481, 1482, 1486, 1489, 1529,
+        1530, 1531, 1536, 1537, 1538, 1467, 1468, 1472, 1486, 1494, 1503, 1531, 1532, 1533, 1538, 1539,
+        1540, 1471, 1479, 1533, 1534, 1540, 1543, 1544, 1478, 1491, 1514, 1521, 1522, 1528, 1529, 1474,
+        1475, 1476, 1480, 1484, 1492, 1493, 1499, 1506, 1522, 1523, 1524, 1529, 1530, 1531, 1484, 1487,
+        1488, 1498, 1500, 1502, 1508, 1509, 1510, 1513, 1524, 1525, 1526, 1531, 1532, 1533, 1488, 1496,
+        1526, 1527, 1533, 1534, 1543, 1483, 1497, 1501, 1505, 1511, 1516, 1517, 1521, 1522, 1469, 1470,
+        1473, 1480, 1483, 1485, 1490, 1499, 1517, 1518, 1519, 1522, 1523, 1524, 1487, 1519, 1520, 1524,
+        1525, 1526, 1526, 1527, 1546, 1547, 1559, 1562, 1563, 1575, 1592, 1599, 1624, 1625, 1626, 1627,
+        1628, 1547, 1549, 1551, 1552, 1553, 1554, 1555, 1556, 1557, 1558, 1560, 1563, 1566, 1567, 1568,
+        1569, 1570, 1571, 1572, 1573, 1574, 1576, 1577, 1580, 1581, 1583, 1584, 1585, 1586, 1587, 1588,
+        1589, 1590, 1591, 1592, 1593, 1594, 1595, 1596, 1597, 1598, 1599, 1600, 1601, 1602, 1603, 1604,
+        1605, 1608, 1609, 1610, 1611, 1612, 1613, 1616, 1617, 1618, 1619, 1620, 1621, 1622, 1624, 1625,
+        1626, 1627, 1628, 1548, 1550, 1561, 1564, 1565, 1578, 1579, 1582, 1605, 1606, 1607, 1613, 1614,
+        1615, 1622, 1623, 1546, 1547, 1559, 1562, 1575, 1592, 1616, 1617, 1618, 1624, 1625, 1626, 1563,
+        1599, 1618, 1619, 1620, 1626, 1627, 1628, 1620, 1621, 1622, 1628, 1622, 1623, 1547, 1549, 1567,
+        1569, 1576, 1581, 1590, 1592, 1616, 1617, 1618, 1557, 1563, 1570, 1574, 1586, 1594, 1595, 1599,
+        1618, 1619, 1620, 1570, 1573, 1587, 1597, 1620, 1621, 1622, 1579, 1622, 1623, 1554, 1572, 1580,
+        1581, 1584, 1596, 1598, 1600, 1608, 1609, 1616, 1617, 1618, 1552, 1553, 1556, 1558, 1566, 1568,
+        1577, 1584, 1588, 1589, 1609, 1610, 1611, 1618, 1619, 1620, 1555, 1560, 1583, 1587, 1597, 1611,
+        1612, 1613, 1620, 1621, 1622, 1548, 1550, 1561, 1564, 1578, 1582, 1613, 1614, 1615, 1622, 1623,
+        1601, 1608, 1609, 1551, 1558, 1571, 1585, 1588, 1591, 1601, 1602, 1603, 1609, 1610, 1611, 1583,
+        1593, 1603, 1604, 1605, 1611, 1612, 1613, 1565, 1605, 1606, 1607, 1613, 1614, 1615, 1635, 1636,
+        1661, 1662, 1663, 1668, 1669, 1631, 1632, 1633, 1636, 1637, 1639, 1648, 1649, 1663, 1664, 1665,
+        1666, 1667, 1669, 1670, 1671, 1672, 1673, 1674, 1675, 1676, 1677, 1678, 1679, 1634, 1635, 1636,
+        1638, 1641, 1646, 1651, 1652, 1653, 1655, 1656, 1657, 1661, 1662, 1663, 1632, 1633, 1636, 1640,
+        1642, 1643, 1644, 1645, 1647, 1650, 1653, 1654, 1657, 1658, 1659, 1660, 1663, 1664, 1665, 1666,
+        1667, 1680, 1679, 1668, 1637, 1648, 1668, 1669, 1670, 1671, 1674, 1677, 1637, 1649, 1671, 1672,
+        1673, 1674, 1675, 1676, 1677, 1678, 1679, 1634, 1638, 1641, 1646, 1651, 1652, 1653, 1655, 1656,
+        1657, 1661, 1662, 1663, 1668, 1631, 1632, 1635, 1636, 1639, 1640, 1642, 1647, 1650, 1653, 1654,
+        1657, 1658, 1659, 1663, 1664, 1665, 1668, 1669, 1670, 1671, 1633, 1639, 1642, 1643, 1644, 1645,
+        1650, 1659, 1660, 1665, 1666, 1667, 1671, 1672, 1673, 1688, 1696, 1698, 1703, 1709, 1720, 1729,
+        1730, 1734, 1735, 1740, 1746, 1683, 1684, 1685, 1686, 1687, 1689, 1690, 1691, 1692, 1693, 1694,
+        1695, 1697, 1699, 1700, 1701, 1702, 1704, 1705, 1706, 1707, 1708, 1709, 1710, 1711, 1712, 1713,
+        1714, 1715, 1716, 1717, 1718, 1719, 1721, 1722, 1723, 1724, 1725, 1726, 1727, 1728, 1730, 1731,
+        1732, 1733, 1735, 1736, 1737, 1738, 1739, 1740, 1741, 1742, 1743, 1744, 1745, 1746, 1747, 1748,
+        1749, 1750, 1751, 1752, 1753, 1754, 1755, 1729, 1730, 1730, 1731, 1732, 1733, 1723, 1751, 1754,
+        1693, 1711, 1751, 1752, 1753, 1754, 1755, 1753, 1755, 1746, 1712, 1721, 1724, 1746, 1747, 1748,
+        1751, 1683, 1684, 1687, 1699, 1725, 1748, 1749, 1751, 1752, 1753, 1697, 1704, 1727, 1749, 1750,
+        1753, 1734, 1735, 1740, 1746, 1692, 1694, 1710, 1717, 1718, 1719, 1726, 1735, 1736, 1740, 1741,
+        1742, 1746, 1747, 1748, 1684, 1686, 1694, 1700, 1701, 1702, 1708, 1717, 1728, 1736, 1737, 1738,
+        1742, 1743, 1744, 1748, 1749, 1686, 1700, 1722, 1727, 1738, 1739, 1744, 1745, 1749, 1750, 1688,
+        1691, 1696, 1698, 1703, 1709, 1720, 1729, 1730, 1734, 1735, 1685, 1691, 1707, 1709, 1714, 1730,
+        1731, 1735, 1736, 1695, 1705, 1706, 1713, 1715, 1716, 1731, 1732, 1733, 1736, 1737, 1738, 1689,
+        1690, 1733, 1738, 1739, 1831, 1830, 1760, 1761, 1762, 1764, 1765, 1769, 1784, 1788, 1789, 1801,
+        1802, 1803, 1804, 1805, 1811, 1812, 1813, 1814, 1815, 1816, 1817, 1818, 1819, 1820, 1821, 1822,
+        1823, 1824, 1826, 1827, 1831, 1766, 1771, 1772, 1773, 1776, 1777, 1781, 1783, 1785, 1786, 1788,
+        1805, 1806, 1807, 1808, 1809, 1810, 1822, 1824, 1825, 1827, 1828, 1829, 1830, 1832, 1758, 1759,
+        1762, 1767, 1768, 1770, 1778, 1782, 1787, 1791, 1792, 1794, 1795, 1796, 1797, 1801, 1802, 1803,
+        1804, 1805, 1763, 1771, 1773, 1774, 1775, 1776, 1777, 1779, 1780, 1790, 1792, 1793, 1797, 1798,
+        1799, 1800, 1805, 1806, 1807, 1808, 1809, 1823, 1824, 1826, 1827, 1831, 1781, 1785, 1824, 1825,
+        1827, 1828, 1829, 1831, 1772, 1829, 1830, 1815, 1816, 1819, 1760, 1761, 1764, 1769, 1789, 1816,
+        1817, 1818, 1819, 1820, 1821, 1822, 1823, 1824, 1761, 1788, 1822, 1824, 1825, 1762, 1765, 1784,
+        1801, 1802, 1803, 1811, 1812, 1813, 1815, 1816, 1767, 1770, 1782, 1803, 1804, 1805, 1813, 1814,
+        1816, 1817, 1818, 1766, 1777, 1780, 1786, 1805, 1806, 1807, 1763, 1766, 1771, 1773, 1776, 1783,
+        1807, 1808, 1809, 1810, 1832, 1794, 1801, 1802, 1803, 1758, 1759, 1767, 1768, 1770, 1778, 1791,
+        1792, 1794, 1795, 1796, 1797, 1803, 1804, 1805, 1774, 1775, 1778, 1779, 1780, 1787, 1790, 1792,
+        1793, 1797, 1798, 1799, 1805, 1806, 1807, 1763, 1799, 1800, 1807, 1808, 1809, 1835, 1836, 1837,
+        1839, 1844, 1854, 1856, 1862, 1888, 1889, 1890, 1891, 1892, 1893, 1838, 1840, 1841, 1843, 1845,
+        1847, 1848, 1849, 1850, 1851, 1853, 1855, 1857, 1858, 1859, 1860, 1863, 1870, 1871, 1872, 1873,
+        1874, 1875, 1876, 1877, 1878, 1879, 1880, 1881, 1882, 1883, 1884, 1885, 1886, 1887, 1888, 1889,
+        1890, 1842, 1846, 1848, 1852, 1858, 1861, 1863, 1864, 1865, 1866, 1867, 1868, 1869, 1870, 1871,
+        1872, 1839, 1885, 1886, 1888, 1889, 1891, 1835, 1836, 1837, 1844, 1862, 1886, 1887, 1889, 1890,
+        1891, 1892, 1837, 1854, 1856, 1887, 1890, 1892, 1893, 1847, 1876, 1877, 1879, 1880, 1882, 1883,
+        1885, 1886, 1840, 1850, 1851, 1853, 1855, 1857, 1877, 1878, 1880, 1881, 1883, 1884, 1886, 1887,
+        1878, 1881, 1884, 1887, 1870, 1873, 1843, 1858, 1859, 1870, 1871, 1873, 1874, 1876, 1877, 1838,
+        1841, 1843, 1848, 1849, 1859, 1860, 1863, 1871, 1872, 1874, 1875, 1877, 1878, 1845, 1860, 1863,
+        1872, 1875, 1878, 1842, 1864, 1865, 1867, 1870, 1846, 1852, 1865, 1866, 1867, 1868, 1870, 1871,
+        1861, 1866, 1868, 1869, 1871, 1872, 1869, 1872, 1899, 1900, 1906, 1908, 1909, 1914, 1926, 1929,
+        1930, 1931, 1896, 1897, 1898, 1902, 1903, 1905, 1911, 1912, 1913, 1915, 1916, 1918, 1920, 1921,
+        1922, 1925, 1928, 1931, 1932, 1934, 1935, 1935, 1901, 1910, 1929, 1930, 1931, 1904, 1907, 1913,
+        1917, 1919, 1922, 1923, 1924, 1927, 1928, 1931, 1932, 1933, 1934, 1929, 1930, 1930, 1931, 1932,
+        1932, 1935, 1898, 1912, 1935, 1899, 1900, 1909, 1926, 1929, 1930, 1897, 1905, 1911, 1914, 1930,
+        1931, 1932, 1903, 1905, 1916, 1918, 1921, 1925, 1932, 1935, 1902, 1915, 1920, 1935, 1901, 1908,
+        1910, 1929, 1930, 1896, 1897, 1906, 1928, 1930, 1931, 1932, 1904, 1907, 1913, 1918, 1919, 1923,
+        1928, 1932, 1934, 1935, 1917, 1922, 1934, 1935, 1930, 1930, 1932, 1904, 1919, 1924, 1927, 1932,
+        1933, 1934, 1934, 1959, 1944, 1959, 1941, 1942, 1945, 1946, 1950, 1952, 1954, 1955, 1956, 1958,
+        1959, 1938, 1939, 1940, 1943, 1944, 1945, 1947, 1948, 1949, 1951, 1953, 1957, 1959, 1960, 1959,
+        1939, 1944, 1945, 1959, 1939, 1959, 1958, 1958, 1959, 1939, 1940, 1945, 1947, 1959, 1938, 1939,
+        1959, 1960, 1941, 1958, 1952, 1955, 1958, 1959, 1943, 1948, 1951, 1957, 1959, 1949, 1953, 1959,
+        1960, 1956, 1958, 1946, 1950, 1954, 1958, 1959, 1942, 1957, 1959, 1959, 1960, 1964, 1965, 1992,
+        2007, 2008, 2009, 1965, 1970, 1978, 1979, 1990, 1992, 2007, 2008, 2009, 1999, 2000, 2007, 2008,
+        2009, 2007, 2008, 2009, 1963, 1964, 1965, 1988, 1991, 2007, 1965, 1967, 1975, 1983, 1985, 1987,
+        1991, 1995, 1996, 1997, 2007, 1975, 1981, 1986, 2007, 1969, 1972, 1984, 1989, 1994, 2007, 1982,
+        2005, 2006, 2007, 1975, 1976, 1977, 2005, 2006, 2007, 1971, 1975, 1998, 2005, 2006, 2007, 2005,
+        2006, 2007, 1966, 1980, 2001, 2002, 2003, 2004, 2005, 1966, 1968, 1973, 1974, 1993, 2004, 2005,
+        2004, 2005, 2005, 2020, 2046, 2020, 2030, 2046, 2048, 2012, 2043, 2048, 2012, 2048, 2049, 2050,
+        2051, 2052, 2022, 2046, 2013, 2021, 2022, 2025, 2026, 2027, 2029, 2031, 2033, 2034, 2035, 2039,
+        2046, 2048, 2011, 2012, 2015, 2023, 2024, 2032, 2035, 2048, 2012, 2028, 2038, 2041, 2048, 2049,
+        2051, 2018, 2019, 2036, 2042, 2045, 2046, 2014, 2018, 2031, 2033, 2034, 2036, 2039, 2040, 2046,
+        2047, 2048, 2047, 2048, 2048, 2049, 2016, 2017, 2037, 2042, 2044, 2045, 2046, 2046, 2047, 2047,
+        2056, 2078, 2086, 2094, 2095, 2095, 2057, 2058, 2062, 2064, 2065, 2066, 2068, 2072, 2073, 2074,
+        2077, 2080, 2081, 2084, 2086, 2089, 2090, 2095, 2096, 2054, 2055, 2059, 2060, 2061, 2063, 2067,
+        2069, 2070, 2071, 2074, 2075, 2076, 2079, 2082, 2083, 2085, 2087, 2088, 2091, 2092, 2093, 2095,
+        2096, 2096, 2096, 2062, 2095, 2056, 2078, 2084, 2094, 2095, 2059, 2068, 2086, 2091, 2092, 2095,
+        2067, 2095, 2073, 2095, 2057, 2058, 2064, 2081, 2095, 2055, 2063, 2066, 2069, 2074, 2075, 2089,
+        2092, 2093, 2095, 2054, 2055, 2076, 2082, 2083, 2085, 2095, 2095, 2096, 2065, 2077, 2080, 2095,
+        2096, 2055, 2066, 2070, 2071, 2090, 2095, 2096, 2055, 2060, 2061, 2070, 2079, 2087, 2088, 2095,
+        2096, 2096, 2096, 2072, 2096, 2096, 2157, 2157, 2099, 2100, 2102, 2103, 2107, 2108, 2109, 2110,
+        2111, 2112, 2113, 2114, 2117, 2119, 2120, 2124, 2125, 2126, 2128, 2129, 2130, 2131, 2134, 2135,
+        2136, 2137, 2140, 2141, 2142, 2143, 2144, 2147, 2148, 2149, 2150, 2153, 2154, 2157, 2101, 2104,
+        2105, 2106, 2115, 2116, 2118, 2121, 2122, 2123, 2126, 2127, 2131, 2132, 2133, 2137, 2138, 2139,
+        2144, 2145, 2146, 2150, 2151, 2152, 2154, 2155, 2156, 2157, 2124, 2125, 2126, 2126, 2127, 2148,
+        2112, 2114, 2148, 2149, 2150, 2153, 2154, 2150, 2151, 2154, 2155, 2157, 2151, 2152, 2155, 2156,
+        2099, 2100, 2140, 2141, 2147, 2148, 2100, 2108, 2117, 2141, 2142, 2143, 2147, 2148, 2149, 2150,
+        2103, 2104, 2113, 2123, 2143, 2144, 2145, 2150, 2151, 2105, 2115, 2118, 2121, 2122, 2145, 2146,
+        2151, 2152, 2099, 2100, 2119, 2120, 2128, 2134, 2140, 2141, 2100, 2102, 2107, 2109, 2111, 2128,
+        2129, 2130, 2134, 2135, 2136, 2141, 2142, 2143, 2102, 2106, 2110, 2111, 2130, 2131, 2132, 2136,
+        2137, 2138, 2143, 2144, 2145, 2101, 2105, 2106, 2132, 2133, 2138, 2139, 2145, 2146, 2128, 2124,
+        2125, 2128, 2129, 2130, 2116, 2125, 2126, 2127, 2130, 2131, 2132, 2127, 2132, 2133, 2163, 2166,
+        2167, 2168, 2169, 2170, 2171, 2181, 2183, 2185, 2186, 2188, 2189, 2193, 2194, 2195, 2196, 2197,
+        2198, 2199, 2200, 2201, 2202, 2203, 2204, 2205, 2206, 2207, 2208, 2209, 2210, 2211, 2241, 2242,
+        2243, 2160, 2161, 2162, 2164, 2165, 2172, 2173, 2174, 2175, 2176, 2177, 2178, 2179, 2180, 2182,
+        2184, 2186, 2187, 2190, 2191, 2192, 2208, 2209, 2210, 2211, 2212, 2213, 2214, 2215, 2216, 2217,
+        2218, 2219, 2220, 2221, 2222, 2223, 2224, 2225, 2226, 2227, 2228, 2229, 2230, 2231, 2232, 2233,
+        2234, 2235, 2236, 2237, 2238, 2239, 2240, 2196, 2200, 2204, 2207, 2241, 2242, 2177, 2187, 2204,
+        2207, 2210, 2211, 2214, 2215, 2219, 2219, 2229, 2229, 2233, 2234, 2237, 2238, 2240, 2163, 2169,
+        2188, 2195, 2196, 2199, 2200, 2202, 2203, 2206, 2207, 2242, 2166, 2168, 2175, 2176, 2179, 2180,
+        2182, 2183, 2185, 2186, 2187, 2206, 2207, 2209, 2210, 2213, 2214, 2218, 2219, 2218, 2219, 2222,
+        2225, 2228, 2229, 2228, 2229, 2232, 2233, 2236, 2237, 2239, 2240, 2163, 2170, 2171, 2181, 2189,
+        2194, 2195, 2198, 2199, 2201, 2202, 2205, 2206, 2243, 2172, 2175, 2205, 2206, 2208, 2209, 2212,
+        2213, 2216, 2217, 2218, 2243, 2160, 2161, 2162, 2184, 2190, 2191, 2192, 2216, 2217, 2218, 2221,
+        2222, 2224, 2225, 2227, 2228, 2227, 2228, 2231, 2232, 2235, 2236, 2239, 2167, 2193, 2194, 2197,
+        2198, 2201, 2243, 2208, 2212, 2216, 2243, 2162, 2164, 2165, 2173, 2178, 2216, 2220, 2221, 2223,
+        2224, 2226, 2227, 2174, 2226, 2227, 2230, 2231, 2235, 2330, 2246, 2247, 2248, 2250, 2252, 2253,
+        2254, 2255, 2256, 2258, 2259, 2261, 2262, 2263, 2264, 2265, 2268, 2269, 2270, 2271, 2273, 2274,
+        2275, 2276, 2277, 2278, 2279, 2285, 2291, 2292, 2293, 2294, 2295, 2296, 2297, 2298, 2299, 2300,
+        2301, 2302, 2303, 2305, 2306, 2307, 2308, 2309, 2310, 2314, 2315, 2316, 2317, 2318, 2319, 2323,
+        2324, 2325, 2326, 2327, 2330, 2248, 2249, 2251, 2257, 2260, 2266, 2267, 2272, 2280, 2281, 2282,
+        2283, 2284, 2286, 2287, 2288, 2289, 2290, 2303, 2304, 2310, 2311, 2312, 2313, 2319, 2320, 2321,
+        2322, 2327, 2328, 2329, 2314, 2315, 2323, 2253, 2315, 2316, 2317, 2318, 2323, 2324, 2325, 2326,
+        2330, 2248, 2275, 2284, 2288, 2318, 2319, 2320, 2326, 2327, 2328, 2257, 2284, 2287, 2320, 2321,
+        2322, 2328, 2329, 2250, 2305, 2306, 2314, 2315, 2273, 2274, 2279, 2306, 2307, 2308, 2309, 2315,
+        2316, 2317, 2318, 2248, 2265, 2267, 2271, 2309, 2310, 2311, 2318, 2319, 2320, 2249, 2251, 2257,
+        2266, 2267, 2272, 2281, 2282, 2283, 2286, 2289, 2311, 2312, 2313, 2320, 2321, 2322, 2261, 2264,
+        2276, 2291, 2297, 2298, 2299, 2305, 2306, 2246, 2247, 2258, 2268, 2278, 2299, 2300, 2301, 2306,
+        2307, 2308, 2309, 2254, 2256, 2280, 2301, 2302, 2303, 2304, 2309, 2310, 2311, 2249, 2260, 2290,
+        2304, 2311, 2312, 2313, 2259, 2263, 2264, 2285, 2293, 2297, 2298, 2299, 2252, 2255, 2262, 2263,
+        2268, 2269, 2270, 2292, 2293, 2294, 2295, 2296, 2299, 2300, 2301, 2277, 2296, 2301, 2302, 2303,
+        2304, 2304, 2366, 2371, 2372, 2376, 2377, 2366, 2367, 2368, 2372, 2373, 2374, 2377, 2378, 2379,
+        2368, 2369, 2370, 2374, 2375, 2379, 2380, 2370, 2355, 2356, 2361, 2366, 2356, 2357, 2361, 2362,
+        2363, 2366, 2367, 2368, 2357, 2358, 2359, 2363, 2364, 2365, 2368, 2369, 2370, 2359, 2360, 2365,
+        2370, 2339, 2344, 2345, 2349, 2350, 2355, 2356, 2345, 2346, 2347, 2350, 2351, 2352, 2356, 2357,
+        2334, 2347, 2348, 2352, 2353, 2357, 2358, 2359, 2334, 2348, 2353, 2354, 2359, 2360, 2382, 2335,
+        2337, 2338, 2341, 2344, 2345, 2337, 2341, 2342, 2343, 2345, 2346, 2347, 2333, 2334, 2336, 2340,
+        2343, 2347, 2348, 2381, 2333, 2334, 2348, 2381, 2382, 2432, 2436, 2439, 2432, 2433, 2434, 2439,
+        2440, 2441, 2434, 2435, 2437, 2438, 2441, 2442, 2443, 2444, 2438, 2444, 2415, 2416, 2417, 2424,
+        2425, 2426, 2432, 2436, 2417, 2418, 2419, 2426, 2427, 2428, 2432, 2433, 2434, 2386, 2387, 2388,
+        2389, 2390, 2419, 2420, 2421, 2422, 2428, 2429, 2430, 2431, 2434, 2435, 2437, 2438, 2393, 2394,
+        2395, 2396, 2422, 2423, 2431, 2438, 2415, 2416, 2417, 2445, 2417, 2418, 2419, 2445, 2384, 2385,
+        2386, 2387, 2388, 2391, 2392, 2403, 2410, 2411, 2412, 2413, 2419, 2420, 2421, 2422, 2445, 2385,
+        2399, 2407, 2409, 2410, 2413, 2414, 2422, 2423, 2445, 2445, 2385, 2410, 2445, 2385, 2397, 2398,
+        2400, 2401, 2402, 2404, 2405, 2406, 2407, 2408, 2409, 2410, 2452, 2459, 2460, 2461, 2471, 2477,
+        2479, 2480, 2483, 2520, 2521, 2522, 2523, 2524, 2525, 2526, 2527, 2449, 2450, 2451, 2453, 2454,
+        2455, 2456, 2458, 2462, 2463, 2465, 2466, 2467, 2468, 2469, 2470, 2471, 2472, 2474, 2476, 2481,
+        2482, 2484, 2485, 2486, 2487, 2488, 2491, 2492, 2493, 2494, 2498, 2499, 2500, 2501, 2505, 2506,
+        2507, 2508, 2511, 2512, 2513, 2514, 2517, 2518, 2519, 2526, 2527, 2528, 2529, 2447, 2448, 2450,
+        2451, 2457, 2464, 2473, 2475, 2478, 2488, 2489, 2490, 2494, 2495, 2496, 2497, 2501, 2502, 2503,
+        2504, 2508, 2509, 2510, 2514, 2515, 2516, 2521, 2523, 2525, 2485, 2511, 2517, 2525, 2527, 2529,
+        2454, 2455, 2463, 2470, 2472, 2476, 2482, 2511, 2512, 2513, 2514, 2517, 2518, 2519, 2451, 2473,
+        2514, 2515, 2516, 2452, 2459, 2460, 2461, 2477, 2479, 2480, 2520, 2521, 2522, 2523, 2524, 2525,
+        2452, 2468, 2471, 2474, 2483, 2498, 2505, 2511, 2524, 2525, 2526, 2527, 2528, 2529, 2462, 2467,
+        2472, 2484, 2498, 2499, 2500, 2501, 2505, 2506, 2507, 2508, 2511, 2512, 2513, 2514, 2450, 2451,
+        2467, 2475, 2501, 2502, 2503, 2504, 2508, 2509, 2510, 2514, 2515, 2516, 2453, 2468, 2469, 2491,
+        2498, 2526, 2528, 2449, 2456, 2458, 2465, 2466, 2481, 2491, 2492, 2493, 2494, 2498, 2499, 2500,
+        2501, 2447, 2448, 2457, 2475, 2478, 2494, 2495, 2496, 2497, 2501, 2502, 2503, 2504, 2491, 2486,
+        2487, 2488, 2491, 2492, 2493, 2494, 2448, 2464, 2488, 2489, 2490, 2494, 2495, 2496, 2497, 2538,
+        2620, 2621, 2608, 2609, 2613, 2542, 2547, 2572, 2610, 2611, 2614, 2615, 2616, 2617, 2611, 2612,
+        2616, 2592, 2593, 2601, 2602, 2618, 2619, 2620, 2621, 2541, 2543, 2550, 2562, 2593, 2594, 2595,
+        2596, 2602, 2603, 2604, 2608, 2609, 2613, 2537, 2546, 2551, 2553, 2554, 2556, 2561, 2564, 2568,
+        2596, 2597, 2598, 2604, 2605, 2606, 2607, 2610, 2611, 2561, 2598, 2599, 2607, 2611, 2612, 2549,
+        2577, 2578, 2579, 2584, 2585, 2592, 2593, 2534, 2535, 2536, 2540, 2544, 2548, 2555, 2565, 2567,
+        2571, 2579, 2580, 2581, 2585, 2586, 2587, 2588, 2593, 2594, 2595, 2596, 2548, 2552, 2566, 2569,
+        2581, 2582, 2583, 2588, 2589, 2590, 2596, 2597, 2598, 2532, 2533, 2583, 2590, 2591, 2598, 2599,
+        2600, 2560, 2573, 2577, 2578, 2579, 2539, 2563, 2573, 2574, 2579, 2580, 2581, 2545, 2557, 2558,
+        2559, 2570, 2575, 2576, 2581, 2582, 2583, 2583, 2627, 2629, 2633, 2700, 2701, 2704, 2705, 2631,
+        2632, 2701, 2702, 2703, 2705, 2623, 2624, 2625, 2626, 2628, 2630, 2634, 2635, 2637, 2639, 2640,
+        2642, 2643, 2644, 2646, 2648, 2655, 2658, 2659, 2660, 2664, 2668, 2669, 2670, 2671, 2672, 2673,
+        2674, 2675, 2676, 2677, 2678, 2679, 2682, 2683, 2684, 2685, 2688, 2689, 2690, 2691, 2694, 2695,
+        2696, 2700, 2701, 2625, 2631, 2634, 2636, 2641, 2645, 2647, 2650, 2652, 2653, 2654, 2656, 2657,
+        2663, 2671, 2675, 2679, 2680, 2681, 2685, 2686, 2687, 2691, 2692, 2693, 2696, 2697, 2698, 2699,
+        2701, 2702, 2703, 2638, 2639, 2649, 2651, 2661, 2662, 2665, 2666, 2667, 2668, 2669, 2670, 2671,
+        2671, 2694, 2627, 2628, 2629, 2630, 2633, 2694, 2695, 2696, 2700, 2701, 2704, 2705, 2625, 2626,
+        2630, 2631, 2632, 2634, 2647, 2696, 2697, 2701, 2702, 2703, 2705, 2697, 2698, 2699, 2703, 2646,
+        2682, 2683, 2688, 2689, 2694, 2637, 2640, 2644, 2646, 2683, 2684, 2689, 2690, 2694, 2695, 2696,
+        2634, 2636, 2637, 2641, 2645, 2657, 2663, 2684, 2685, 2686, 2690, 2691, 2692, 2696, 2697, 2636,
+        2641, 2652, 2653, 2654, 2686, 2687, 2692, 2693, 2697, 2698, 2699, 2643, 2648, 2655, 2658, 2672,
+        2673, 2676, 2677, 2682, 2683, 2623, 2624, 2637, 2642, 2643, 2660, 2673, 2674, 2677, 2678, 2683,
+        2684, 2637, 2642, 2650, 2656, 2664, 2674, 2675, 2678, 2679, 2680, 2684, 2685, 2686, 2654, 2680,
+        2681, 2686, 2687, 2635, 2638, 2649, 2659, 2661, 2665, 2666, 2668, 2669, 2672, 2673, 2624, 2635,
+        2639, 2651, 2662, 2666, 2667, 2669, 2670, 2671, 2673, 2674, 2656, 2671, 2674, 2675, 2712, 2715,
+        2745, 2746, 2747, 2748, 2749, 2750, 2751, 2752, 2753, 2754, 2755, 2756, 2757, 2758, 2759, 2760,
+        2761, 2762, 2763, 2764, 2750, 2756, 2708, 2709, 2710, 2711, 2713, 2714, 2716, 2717, 2718, 2719,
+        2722, 2723, 2724, 2727, 2728, 2729, 2730, 2731, 2734, 2735, 2736, 2737, 2738, 2741, 2742, 2743,
+        2744, 2745, 2746, 2747, 2748, 2749, 2750, 2724, 2725, 2726, 2731, 2732, 2733, 2738, 2739, 2740,
+        2750, 2722, 2723, 2724, 2720, 2721, 2724, 2725, 2726, 2712, 2715, 2751, 2752, 2757, 2758, 2762,
+        2763, 2752, 2753, 2754, 2758, 2759, 2760, 2763, 2764, 2754, 2755, 2756, 2760, 2761, 2715, 2716,
+        2718, 2741, 2742, 2745, 2746, 2751, 2752, 2742, 2743, 2744, 2746, 2747, 2748, 2752, 2753, 2754,
+        2744, 2748, 2749, 2750, 2754, 2755, 2756, 2708, 2709, 2711, 2717, 2727, 2734, 2741, 2742, 2709,
+        2714, 2717, 2727, 2728, 2729, 2734, 2735, 2736, 2742, 2743, 2744, 2729, 2730, 2731, 2736, 2737,
+        2738, 2744, 2731, 2732, 2733, 2738, 2739, 2740, 2710, 2711, 2713, 2717, 2722, 2727, 2713, 2714,
+        2717, 2719, 2722, 2727, 2728, 2729, 2720, 2723, 2724, 2729, 2730, 2731, 2720, 2721, 2724, 2725,
+        2726, 2731, 2732, 2733, 2865, 2876, 2776, 2863, 2864, 2875, 2876, 2798, 2866, 2867, 2868, 2869,
+        2870, 2871, 2877, 2878, 2879, 2767, 2768, 2778, 2779, 2781, 2782, 2783, 2785, 2786, 2787, 2788,
+        2792, 2793, 2794, 2796, 2800, 2803, 2804, 2807, 2809, 2811, 2814, 2815, 2816, 2836, 2837, 2838,
+        2839, 2840, 2841, 2842, 2843, 2844, 2845, 2846, 2847, 2848, 2849, 2850, 2851, 2852, 2853, 2854,
+        2855, 2856, 2857, 2858, 2859, 2860, 2861, 2862, 2873, 2874, 2866, 2877, 2769, 2770, 2771, 2772,
+        2773, 2774, 2775, 2777, 2778, 2780, 2784, 2786, 2789, 2790, 2791, 2795, 2797, 2799, 2801, 2802,
+        2805, 2806, 2808, 2810, 2812, 2813, 2817, 2818, 2819, 2820, 2821, 2822, 2823, 2824, 2825, 2826,
+        2827, 2828, 2829, 2830, 2831, 2832, 2833, 2834, 2835, 2836, 2837, 2838, 2839, 2872, 2873, 2776,
+        2863, 2864, 2865, 2875, 2876, 2863, 2864, 2875, 2874, 2798, 2867, 2868, 2869, 2870, 2871, 2877,
+        2878, 2879, 2870, 2871, 2879, 2767, 2768, 2779, 2781, 2782, 2783, 2785, 2787, 2794, 2796, 2803,
+        2807, 2809, 2814, 2815, 2844, 2845, 2846, 2847, 2848, 2849, 2850, 2851, 2852, 2853, 2854, 2855,
+        2856, 2857, 2858, 2859, 2860, 2861, 2862, 2873, 2874, 2866, 2868, 2877, 2878, 2769, 2770, 2771,
+        2772, 2773, 2774, 2775, 2777, 2778, 2780, 2784, 2786, 2788, 2789, 2790, 2791, 2792, 2793, 2795,
+        2797, 2799, 2800, 2801, 2802, 2804, 2805, 2806, 2808, 2810, 2811, 2812, 2813, 2816, 2817, 2818,
+        2819, 2820, 2821, 2822, 2823, 2824, 2825, 2826, 2827, 2828, 2829, 2830, 2831, 2832, 2833, 2834,
+        2835, 2836, 2837, 2838, 2839, 2840, 2841, 2842, 2843, 2844, 2845, 2846, 2847, 2848, 2872, 2873,
+        2892, 2900, 2947, 2956, 2965, 2882, 2883, 2885, 2886, 2887, 2888, 2890, 2891, 2892, 2893, 2894,
+        2895, 2896, 2897, 2898, 2899, 2900, 2901, 2902, 2903, 2904, 2906, 2907, 2908, 2909, 2910, 2914,
+        2915, 2916, 2917, 2918, 2919, 2920, 2921, 2922, 2923, 2925, 2926, 2927, 2928, 2929, 2930, 2931,
+        2932, 2933, 2934, 2935, 2938, 2939, 2940, 2941, 2942, 2943, 2944, 2947, 2948, 2949, 2950, 2951,
+        2952, 2953, 2954, 2956, 2957, 2958, 2959, 2960, 2961, 2962, 2963, 2965, 2966, 2967, 2968, 2969,
+        2970, 2971, 2972, 2973, 2974, 2975, 2976, 2977, 2978, 2979, 2980, 2981, 2982, 2884, 2889, 2896,
+        2911, 2913, 2924, 2930, 2935, 2936, 2937, 2944, 2945, 2946, 2954, 2955, 2963, 2964, 2972, 2978,
+        2905, 2912, 2933, 2934, 2935, 2935, 2936, 2937, 2895, 2902, 2965, 2966, 2967, 2973, 2974, 2979,
+        2980, 2887, 2895, 2906, 2908, 2918, 2920, 2932, 2967, 2968, 2969, 2970, 2974, 2975, 2976, 2980,
+        2981, 2982, 2886, 2903, 2918, 2922, 2970, 2971, 2972, 2976, 2977, 2978, 2982, 2972, 2978, 2897,
+        2902, 2929, 2948, 2949, 2956, 2957, 2958, 2965, 2966, 2967, 2891, 2898, 2901, 2918, 2925, 2931,
+        2949, 2950, 2951, 2958, 2959, 2960, 2961, 2967, 2968, 2969, 2970, 2890, 2893, 2896, 2903, 2907,
+        2914, 2915, 2916, 2918, 2921, 2927, 2930, 2951, 2952, 2953, 2954, 2961, 2962, 2963, 2970, 2971,
+        2972, 2977, 2978, 2911, 2954, 2955, 2963, 2964, 2972, 2978, 2888, 2892, 2900, 2910, 2917, 2938,
+        2939, 2947, 2948, 2949, 2956, 2882, 2883, 2891, 2894, 2923, 2931, 2939, 2940, 2941, 2949, 2950,
+        2951, 2893, 2899, 2907, 2909, 2919, 2926, 2927, 2928, 2941, 2942, 2943, 2944, 2951, 2952, 2953,
+        2954, 2884, 2913, 2924, 2944, 2945, 2946, 2954, 2955, 2917, 2938, 2939, 2933, 2939, 2940, 2941,
+        2885, 2899, 2904, 2905, 2912, 2933, 2934, 2935, 2941, 2942, 2943, 2944, 2889, 2935, 2936, 2937,
+        2944, 2945, 2946, 3057, 3064, 3065, 3066, 3073, 3001, 3066, 3067, 3068, 3071, 3072, 3073, 3074,
+        3076, 3068, 3069, 3070, 3076, 3037, 3050, 3057, 3058, 3065, 3066, 2991, 2992, 2994, 3005, 3010,
+        3037, 3044, 3045, 3046, 3050, 3051, 3052, 3053, 3058, 3059, 3060, 3061, 3066, 3067, 3068, 2987,
+        2988, 2989, 2993, 2996, 2997, 3000, 3008, 3013, 3046, 3047, 3048, 3049, 3053, 3054, 3055, 3056,
+        3061, 3062, 3063, 3068, 3069, 3070, 3049, 3056, 3024, 3030, 3037, 2986, 2990, 2994, 2995, 3002,
+        3003, 3006, 3024, 3025, 3026, 3027, 3030, 3031, 3032, 3033, 3037, 3038, 3039, 3040, 3044, 3045,
+        3046, 2988, 2989, 2999, 3004, 3012, 3013, 3027, 3028, 3029, 3033, 3034, 3035, 3036, 3040, 3041,
+        3042, 3043, 3046, 3047, 3048, 3049, 2999, 3029, 3036, 3043, 3049, 3017, 3018, 3019, 3024, 2985,
+        2986, 2998, 3007, 3014, 3015, 3019, 3020, 3021, 3024, 3025, 3026, 3027, 3007, 3009, 3011, 3015,
+        3016, 3021, 3022, 3023, 3027, 3028, 3029, 3029, 3075, 3162, 3163, 3164, 3165, 3166, 3167, 3168,
+        3169, 3170, 3171, 3172, 3173, 3174, 3175, 3176, 3177, 3179, 3180, 3181, 3182, 3183, 3184, 3185,
+        3186, 3187, 3188, 3189, 3190, 3191, 3192, 3193, 3194, 3195, 3196, 3197, 3198, 3199, 3200, 3201,
+        3202, 3203, 3204, 3205, 3225, 3226, 3227, 3228, 3229, 3230, 3231, 3232, 3233, 3234, 3235, 3236,
+        3237, 3238, 3239, 3240, 3241, 3242, 3243, 3244, 3245, 3246, 3247, 3248, 3249, 3250, 3251, 3252,
+        3253, 3254, 3255, 3256, 3257, 3232, 3240, 3167, 3178, 3203, 3206, 3207, 3208, 3209, 3210, 3211,
+        3212, 3213, 3214, 3215, 3216, 3217, 3218, 3219, 3220, 3221, 3222, 3223, 3224, 3225, 3226, 3227,
+        3228, 3229, 3230, 3231, 3232, 3232, 3171, 3172, 3194, 3197, 3241, 3242, 3243, 3248, 3249, 3254,
+        3255, 3163, 3165, 3179, 3189, 3190, 3198, 3243, 3244, 3245, 3249, 3250, 3251, 3252, 3255, 3256,
+        3257, 3177, 3179, 3186, 3245, 3246, 3247, 3252, 3253, 3257, 3247, 3164, 3166, 3169, 3170, 3172,
+        3173, 3174, 3180, 3181, 3183, 3192, 3193, 3202, 3203, 3225, 3226, 3233, 3234, 3235, 3241, 3242,
+        3243, 3162, 3163, 3168, 3175, 3182, 3184, 3185, 3187, 3188, 3191, 3195, 3196, 3199, 3202, 3204,
+        3205, 3226, 3227, 3228, 3235, 3236, 3237, 3243, 3244, 3245, 3176, 3186, 3200, 3201, 3228, 3229,
+        3230, 3237, 3238, 3239, 3245, 3246, 3247, 3230, 3231, 3232, 3239, 3240, 3247, 3203, 3219, 3220,
+        3225, 3226, 3215, 3216, 3220, 3221, 3222, 3226, 3227, 3228, 3216, 3217, 3218, 3222, 3223, 3224,
+        3228, 3229, 3230, 3167, 3218, 3224, 3230, 3231, 3232, 3210, 3206, 3207, 3210, 3211, 3212, 3215,
+        3216, 3178, 3207, 3208, 3209, 3212, 3213, 3214, 3216, 3217, 3218, 3209, 3214, 3218, 3320, 3273,
+        3318, 3320, 3262, 3266, 3267, 3274, 3278, 3279, 3281, 3285, 3287, 3304, 3308, 3318, 3319, 3319,
+        3320, 3263, 3271, 3293, 3294, 3301, 3305, 3318, 3320, 3264, 3277, 3279, 3300, 3318, 3268, 3319,
+        3265, 3269, 3289, 3297, 3298, 3303, 3311, 3319, 3320, 3272, 3275, 3290, 3293, 3294, 3299, 3306,
+        3315, 3318, 3320, 3318, 3260, 3261, 3268, 3282, 3283, 3286, 3309, 3312, 3316, 3319, 3261, 3265,
+        3270, 3276, 3280, 3284, 3288, 3291, 3292, 3295, 3296, 3302, 3307, 3310, 3314, 3317, 3319, 3320,
+        3307, 3313, 3320, 3324, 3328, 3333, 3334, 3336, 3342, 3344, 3345, 3348, 3352, 3354, 3355, 3356,
+        3359, 3366, 3367, 3370, 3398, 3399, 3400, 3401, 3402, 3403, 3407, 3408, 3409, 3410, 3411, 3412,
+        3416, 3417, 3418, 3419, 3420, 3422, 3326, 3328, 3335, 3358, 3363, 3371, 3403, 3404, 3405, 3406,
+        3412, 3413, 3414, 3415, 3420, 3421, 3422, 3423, 3322, 3323, 3329, 3337, 3338, 3339, 3340, 3341,
+        3343, 3347, 3353, 3357, 3360, 3362, 3368, 3369, 3372, 3373, 3374, 3375, 3379, 3380, 3381, 3382,
+        3383, 3384, 3389, 3390, 3391, 3392, 3393, 3394, 3398, 3399, 3400, 3401, 3402, 3403, 3325, 3326,
+        3327, 3330, 3331, 3332, 3335, 3337, 3346, 3349, 3350, 3351, 3358, 3361, 3364, 3365, 3375, 3376,
+        3377, 3378, 3384, 3385, 3386, 3387, 3388, 3394, 3395, 3396, 3397, 3403, 3404, 3405, 3406, 3336,
+        3354, 3356, 3367, 3407, 3408, 3409, 3416, 3417, 3324, 3345, 3352, 3409, 3410, 3411, 3417, 3418,
+        3419, 3420, 3422, 3333, 3363, 3371, 3411, 3412, 3413, 3414, 3420, 3421, 3422, 3423, 3414, 3415,
+        3322, 3323, 3336, 3342, 3348, 3355, 3389, 3390, 3391, 3398, 3399, 3400, 3407, 3408, 3409, 3324,
+        3334, 3340, 3357, 3359, 3366, 3368, 3370, 3391, 3392, 3393, 3400, 3401, 3402, 3409, 3410, 3411,
+        3328, 3330, 3333, 3335, 3344, 3358, 3364, 3393, 3394, 3395, 3396, 3402, 3403, 3404, 3405, 3411,
+        3412, 3413, 3414, 3326, 3361, 3396, 3397, 3405, 3406, 3414, 3415, 3323, 3339, 3343, 3362, 3379,
+        3380, 3381, 3389, 3390, 3391, 3329, 3338, 3347, 3360, 3369, 3381, 3382, 3383, 3391, 3392, 3393,
+        3332, 3337, 3346, 3350, 3365, 3383, 3384, 3385, 3386, 3393, 3394, 3395, 3396, 3325, 3361, 3386,
+        3387, 3388, 3396, 3397, 3341, 3372, 3373, 3374, 3379, 3380, 3381, 3353, 3374, 3381, 3382, 3383,
+        3327, 3351, 3375, 3376, 3377, 3383, 3384, 3385, 3386, 3331, 3349, 3377, 3378, 3386, 3387, 3388,
+        3426, 3427, 3428, 3429, 3431, 3432, 3433, 3434, 3436, 3438, 3439, 3441, 3456, 3457, 3458, 3459,
+        3460, 3461, 3462, 3463, 3464, 3465, 3466, 3467, 3468, 3469, 3471, 3472, 3473, 3474, 3475, 3476,
+        3477, 3478, 3479, 3480, 3481, 3482, 3483, 3484, 3485, 3486, 3487, 3488, 3489, 3430, 3431, 3435,
+        3437, 3440, 3442, 3443, 3444, 3445, 3446, 3447, 3448, 3449, 3450, 3451, 3452, 3453, 3454, 3455,
+        3456, 3457, 3458, 3459, 3460, 3461, 3462, 3470, 3441, 3478, 3479, 3434, 3479, 3480, 3481, 3484,
+        3485, 3486, 3488, 3432, 3436, 3481, 3482, 3483, 3486, 3487, 3488, 3489, 3426, 3427, 3463, 3464,
+        3471, 3427, 3429, 3441, 3464, 3465, 3466, 3471, 3472, 3473, 3478, 3479, 3439, 3466, 3467, 3468,
+        3473, 3474, 3475, 3479, 3480, 3481, 3428, 3468, 3469, 3475, 3476, 3477, 3481, 3482, 3483, 3427,
+        3433, 3438, 3449, 3450, 3451, 3456, 3457, 3458, 3463, 3464, 3427, 3431, 3451, 3452, 3453, 3458,
+        3459, 3460, 3464, 3465, 3466, 3430, 3431, 3435, 3439, 3440, 3453, 3454, 3455, 3460, 3461, 3462,
+        3466, 3467, 3468, 3470, 3455, 3462, 3468, 3469, 3470, 3442, 3445, 3446, 3449, 3450, 3451, 3437,
+        3442, 3443, 3444, 3446, 3447, 3448, 3451, 3452, 3453, 3430, 3444, 3448, 3453, 3454, 3455, 3470,
+        3455, 3470, 3582, 3583, 3584, 3505, 3511, 3538, 3539, 3553, 3554, 3564, 3565, 3572, 3492, 3493,
+        3494, 3496, 3497, 3499, 3500, 3501, 3502, 3504, 3506, 3507, 3508, 3509, 3510, 3512, 3513, 3514,
+        3515, 3516, 3517, 3519, 3520, 3521, 3522, 3523, 3528, 3529, 3530, 3531, 3532, 3533, 3534, 3535,
+        3538, 3540, 3541, 3542, 3543, 3544, 3545, 3546, 3547, 3551, 3552, 3553, 3555, 3556, 3557, 3558,
+        3559, 3560, 3563, 3565, 3566, 3567, 3568, 3569, 3570, 3571, 3572, 3573, 3574, 3575, 3576, 3577,
+        3578, 3579, 3580, 3581, 3582, 3583, 3584, 3535, 3536, 3537, 3547, 3548, 3549, 3550, 3560, 3561,
+        3562, 3495, 3498, 3503, 3504, 3518, 3525, 3526, 3527, 3528, 3529, 3530, 3531, 3532, 3533, 3534,
+        3535, 3524, 3535, 3536, 3537, 3521, 3564, 3565, 3566, 3567, 3572, 3573, 3574, 3579, 3582, 3492,
+        3494, 3496, 3499, 3507, 3508, 3514, 3567, 3568, 3569, 3570, 3574, 3575, 3576, 3577, 3579, 3580,
+        3581, 3582, 3583, 3584, 3563, 3570, 3571, 3577, 3578, 3493, 3500, 3505, 3511, 3512, 3515, 3520,
+        3521, 3538, 3539, 3540, 3541, 3551, 3552, 3553, 3554, 3564, 3565, 3566, 3567, 3492, 3493, 3494,
+        3497, 3501, 3509, 3510, 3513, 3516, 3541, 3542, 3543, 3544, 3551, 3555, 3556, 3557, 3567, 3568,
+        3569, 3570, 3502, 3544, 3545, 3546, 3547, 3557, 3558, 3559, 3560, 3563, 3570, 3571, 3547, 3548,
+        3549, 3550, 3560, 3561, 3562, 3493, 3498, 3528, 3529, 3538, 3539, 3540, 3541, 3493, 3495, 3503,
+        3506, 3517, 3518, 3519, 3522, 3523, 3525, 3526, 3527, 3529, 3530, 3531, 3532, 3541, 3542, 3543,
+        3544, 3504, 3527, 3532, 3533, 3534, 3535, 3544, 3545, 3546, 3547, 3535, 3536, 3537, 3547, 3548,
+        3549, 3550, 3525, 3526, 3527, 3527, 3524, 3587, 3588, 3595, 3598, 3601, 3609, 3610, 3616, 3617,
+        3618, 3624, 3625, 3626, 3627, 3628, 3629, 3589, 3590, 3591, 3592, 3593, 3596, 3600, 3601, 3602,
+        3603, 3606, 3611, 3613, 3619, 3622, 3623, 3627, 3628, 3629, 3630, 3631, 3632, 3633, 3634, 3635,
+        3636, 3637, 3638, 3639, 3640, 3641, 3642, 3643, 3644, 3645, 3646, 3647, 3648, 3649, 3650, 3591,
+        3594, 3597, 3599, 3604, 3605, 3607, 3608, 3612, 3614, 3615, 3620, 3621, 3646, 3647, 3648, 3649,
+        3650, 3651, 3652, 3653, 3654, 3655, 3656, 3657, 3658, 3659, 3660, 3661, 3662, 3663, 3664, 3665,
+        3666, 3667, 3668, 3669, 3670, 3671, 3672, 3673, 3674, 3675, 3676, 3677, 3678, 3679, 3680, 3624,
+        3627, 3630, 3633, 3588, 3592, 3593, 3595, 3601, 3609, 3616, 3617, 3618, 3623, 3624, 3625, 3627,
+        3628, 3630, 3631, 3633, 3634, 3587, 3588, 3598, 3610, 3622, 3623, 3625, 3626, 3628, 3629, 3631,
+        3632, 3634, 3635, 3633, 3636, 3639, 3642, 3600, 3602, 3606, 3611, 3633, 3634, 3636, 3637, 3639,
+        3640, 3642, 3643, 3644, 3596, 3603, 3619, 3634, 3635, 3637, 3638, 3640, 3641, 3644, 3645, 3645,
+        3594, 3620, 3642, 3646, 3651, 3652, 3658, 3659, 3591, 3597, 3613, 3614, 3621, 3642, 3643, 3644,
+        3646, 3647, 3648, 3652, 3653, 3654, 3659, 3660, 3661, 3589, 3590, 3604, 3612, 3644, 3645, 3648,
+        3649, 3654, 3655, 3661, 3662, 3607, 3645, 3649, 3650, 3655, 3656, 3657, 3662, 3663, 3664, 3658,
+        3659, 3665, 3666, 3621, 3659, 3660, 3661, 3666, 3667, 3671, 3676, 3599, 3605, 3661, 3662, 3667,
+        3668, 3669, 3671, 3672, 3673, 3674, 3675, 3676, 3677, 3678, 3679, 3680, 3608, 3615, 3662, 3663,
+        3664, 3669, 3670, 3673, 3675, 3678, 3680, 3756, 3757, 3759, 3686, 3692, 3757, 3758, 3759, 3760,
+        3761, 3762, 3763, 3764, 3765, 3766, 3690, 3696, 3703, 3704, 3736, 3737, 3738, 3739, 3745, 3746,
+        3747, 3748, 3684, 3689, 3691, 3693, 3694, 3695, 3739, 3740, 3741, 3742, 3748, 3749, 3750, 3751,
+        3752, 3767, 3697, 3742, 3743, 3744, 3752, 3753, 3754, 3755, 3756, 3757, 3767, 3688, 3755, 3757,
+        3758, 3701, 3702, 3715, 3716, 3717, 3720, 3721, 3722, 3723, 3726, 3727, 3728, 3729, 3736, 3737,
+        3738, 3739, 3683, 3684, 3685, 3687, 3699, 3700, 3717, 3718, 3719, 3723, 3724, 3725, 3729, 3730,
+        3731, 3732, 3739, 3740, 3741, 3742, 3767, 3732, 3733, 3734, 3735, 3742, 3743, 3744, 3767, 3706,
+        3707, 3710, 3711, 3712, 3715, 3716, 3717, 3698, 3705, 3707, 3708, 3709, 3712, 3713, 3714, 3717,
+        3718, 3719, 3767, 3767, 3845, 3849, 3769, 3770, 3792, 3795, 3797, 3842, 3843, 3845, 3846, 3849,
+        3850, 3853, 3854, 3855, 3770, 3773, 3779, 3785, 3790, 3797, 3800, 3843, 3844, 3846, 3847, 3848,
+        3850, 3851, 3852, 3854, 3855, 3786, 3821, 3822, 3824, 3825, 3830, 3831, 3836, 3771, 3781, 3787,
+        3796, 3799, 3822, 3823, 3825, 3826, 3827, 3831, 3832, 3833, 3836, 3837, 3777, 3781, 3782, 3791,
+        3793, 3801, 3823, 3827, 3828, 3829, 3833, 3834, 3835, 3837, 3838, 3839, 3842, 3843, 3775, 3780,
+        3802, 3829, 3835, 3839, 3840, 3841, 3843, 3844, 3776, 3810, 3813, 3816, 3818, 3819, 3821, 3822,
+        3772, 3776, 3778, 3784, 3789, 3810, 3811, 3812, 3813, 3814, 3815, 3816, 3817, 3819, 3820, 3822,
+        3823, 3778, 3789, 3812, 3815, 3820, 3823, 3794, 3803, 3804, 3806, 3808, 3810, 3774, 3783, 3788,
+        3798, 3804, 3805, 3806, 3807, 3808, 3809, 3810, 3811, 3812, 3805, 3812, 3858, 3863, 3865, 3868,
+        3872, 3881, 3929, 3930, 3935, 3936, 3937, 3942, 3943, 3944, 3858, 3865, 3866, 3868, 3930, 3931,
+        3932, 3933, 3937, 3938, 3939, 3940, 3944, 3945, 3933, 3934, 3940, 3941, 3857, 3858, 3861, 3862,
+        3867, 3880, 3908, 3909, 3910, 3916, 3917, 3918, 3923, 3924, 3925, 3929, 3930, 3857, 3858, 3859,
+        3864, 3867, 3910, 3911, 3912, 3913, 3918, 3919, 3920, 3921, 3925, 3926, 3927, 3930, 3931, 3932,
+        3933, 3859, 3864, 3877, 3878, 3879, 3883, 3913, 3914, 3915, 3921, 3922, 3927, 3928, 3933, 3934,
+        3915, 3900, 3901, 3908, 3909, 3910, 3869, 3889, 3894, 3895, 3896, 3901, 3902, 3903, 3910, 3911,
+        3912, 3913, 3871, 3876, 3883, 3890, 3891, 3896, 3897, 3898, 3903, 3904, 3905, 3906, 3913, 3914,
+        3915, 3860, 3870, 3891, 3892, 3893, 3898, 3899, 3906, 3907, 3915, 3889, 3886, 3890, 3891, 3860,
+        3873, 3874, 3875, 3882, 3884, 3885, 3886, 3887, 3888, 3891, 3892, 3893, 3947, 3948, 3949, 3950,
+        3955, 3957, 3959, 3962, 3964, 3965, 3966, 3967, 3968, 3970, 3971, 3972, 3973, 3975, 3979, 3981,
+        3984, 3987, 3988, 4015, 4016, 4017, 4018, 4019, 4020, 4021, 4024, 4025, 4026, 4027, 4028, 4029,
+        4030, 4033, 4034, 4035, 4036, 4037, 4040, 4041, 4042, 4043, 4046, 4047, 4048, 3953, 3958, 3963,
+        3986, 4021, 4022, 4023, 4030, 4031, 4032, 4037, 4038, 4039, 4043, 4044, 4045, 4048, 4049, 4050,
+        4051, 3951, 3952, 3954, 3956, 3960, 3967, 3969, 3974, 3976, 3977, 3978, 3980, 3981, 3982, 3983,
+        3989, 3990, 3994, 3995, 3999, 4000, 4001, 4002, 4003, 4007, 4008, 4009, 4010, 4011, 4015, 4016,
+        4017, 4018, 4019, 4020, 4021, 3961, 3985, 3990, 3991, 3992, 3993, 3995, 3996, 3997, 3998, 4003,
+        4004, 4005, 4006, 4011, 4012, 4013, 4014, 4021, 4022, 4023, 4051, 3948, 4033, 4034, 4040, 3948,
+        3962, 3988, 4034, 4035, 4036, 4037, 4040, 4041, 4042, 4043, 4046, 4047, 4048, 3958, 3975, 4037,
+        4038, 4039, 4043, 4044, 4045, 4048, 4049, 4050, 4039, 4045, 4050, 4051, 3948, 3949, 3950, 3955,
+        3959, 3964, 3966, 3968, 3970, 3983, 3987, 4015, 4016, 4017, 4024, 4025, 4026, 4033, 4034, 3947,
+        3948, 3957, 3965, 3967, 3971, 3972, 3973, 3979, 3981, 3984, 4017, 4018, 4019, 4020, 4026, 4027,
+        4028, 4029, 4034, 4035, 4036, 4037, 3953, 3963, 3984, 4020, 4021, 4022, 4023, 4029, 4030, 4031,
+        4032, 4037, 4038, 4039, 3986, 4023, 4032, 4039, 4051, 3952, 3954, 3969, 3974, 3980, 3983, 3999,
+        4000, 4007, 4008, 4015, 4016, 4017, 3951, 3952, 3956, 3960, 3967, 3976, 3977, 3982, 4000, 4001,
+        4002, 4003, 4008, 4009, 4010, 4011, 4017, 4018, 4019, 4020, 3978, 3985, 4003, 4004, 4005, 4011,
+        4012, 4013, 4020, 4021, 4022, 4023, 4005, 4006, 4013, 4014, 4023, 4051, 3999, 4000, 3960, 3989,
+        3990, 3994, 3995, 4000, 4001, 4002, 4003, 3990, 3991, 3992, 3995, 3996, 3997, 4003, 4004, 4005,
+        3961, 3992, 3993, 3997, 3998, 4005, 4006, 4051, 4065, 4082, 4099, 4100, 4187, 4188, 4195, 4057,
+        4082, 4100, 4101, 4102, 4103, 4104, 4113, 4114, 4119, 4193, 4194, 4195, 4196, 4197, 4066, 4106,
+        4107, 4119, 4194, 4197, 4198, 4056, 4088, 4097, 4098, 4166, 4167, 4168, 4173, 4174, 4179, 4180,
+        4184, 4190, 4054, 4055, 4068, 4085, 4086, 4090, 4094, 4105, 4115, 4121, 4168, 4169, 4170, 4171,
+        4172, 4174, 4175, 4176, 4177, 4178, 4180, 4181, 4182, 4183, 4184, 4185, 4186, 4187, 4188, 4192,
+        4105, 4110, 4111, 4112, 4113, 4114, 4115, 4116, 4117, 4120, 4121, 4125, 4126, 4172, 4178, 4192,
+        4193, 4194, 4197, 4110, 4125, 4194, 4197, 4056, 4061, 4070, 4074, 4076, 4077, 4093, 4096, 4097,
+        4147, 4148, 4149, 4154, 4155, 4156, 4157, 4160, 4161, 4162, 4166, 4167, 4168, 4189, 4190, 4058,
+        4060, 4064, 4071, 4076, 4089, 4090, 4091, 4122, 4149, 4150, 4151, 4152, 4153, 4157, 4158, 4159,
+        4162, 4163, 4164, 4165, 4168, 4169, 4170, 4171, 4172, 4191, 4083, 4087, 4108, 4109, 4118, 4122,
+        4126, 4172, 4191, 4080, 4081, 4132, 4133, 4141, 4142, 4143, 4147, 4148, 4149, 4059, 4062, 4063,
+        4067, 4073, 4075, 4079, 4084, 4092, 4095, 4123, 4127, 4128, 4133, 4134, 4135, 4136, 4137, 4143,
+        4144, 4145, 4146, 4149, 4150, 4151, 4152, 4153, 4069, 4072, 4078, 4118, 4123, 4124, 4128, 4129,
+        4130, 4131, 4137, 4138, 4139, 4140, 4223, 4262, 4263, 4273, 4287, 4292, 4297, 4200, 4201, 4202,
+        4203, 4205, 4206, 4209, 4212, 4213, 4215, 4216, 4217, 4218, 4219, 4223, 4229, 4230, 4231, 4232,
+        4234, 4235, 4236, 4239, 4240, 4241, 4263, 4264, 4265, 4266, 4267, 4268, 4269, 4270, 4271, 4272,
+        4273, 4274, 4275, 4276, 4277, 4278, 4279, 4280, 4281, 4282, 4283, 4285, 4286, 4287, 4288, 4289,
+        4290, 4291, 4292, 4293, 4294, 4295, 4296, 4297, 4298, 4299, 4241, 4283, 4284, 4211, 4251, 4252,
+        4262, 4263, 4204, 4207, 4208, 4210, 4214, 4220, 4221, 4222, 4224, 4225, 4226, 4227, 4228, 4233,
+        4237, 4238, 4242, 4243, 4244, 4245, 4246, 4247, 4248, 4249, 4250, 4252, 4253, 4254, 4255, 4256,
+        4257, 4258, 4259, 4260, 4261, 4263, 4264, 4265, 4266, 4267, 4268, 4269, 4270, 4271, 4272, 4215,
+        4219, 4223, 4236, 4239, 4287, 4288, 4289, 4292, 4293, 4294, 4297, 4298, 4299, 4216, 4217, 4285,
+        4286, 4289, 4290, 4291, 4294, 4295, 4296, 4299, 4212, 4241, 4285, 4286, 4241, 4200, 4201, 4202,
+        4203, 4206, 4209, 4218, 4229, 4232, 4234, 4235, 4239, 4240, 4262, 4263, 4264, 4265, 4273, 4274,
+        4275, 4287, 4288, 4289, 4203, 4205, 4213, 4218, 4230, 4231, 4235, 4265, 4266, 4267, 4268, 4275,
+        4276, 4277, 4278, 4285, 4289, 4290, 4291, 4241, 4268, 4269, 4270, 4271, 4278, 4279, 4280, 4281,
+        4285, 4241, 4271, 4272, 4281, 4282, 4283, 4284, 4208, 4211, 4238, 4248, 4249, 4251, 4252, 4253,
+        4254, 4262, 4263, 4264, 4265, 4226, 4249, 4250, 4254, 4255, 4256, 4257, 4265, 4266, 4267, 4268,
+        4257, 4258, 4259, 4260, 4268, 4269, 4270, 4271, 4260, 4261, 4271, 4272, 4208, 4221, 4224, 4233,
+        4237, 4238, 4242, 4244, 4245, 4248, 4249, 4204, 4207, 4210, 4214, 4220, 4221, 4222, 4224, 4225,
+        4227, 4228, 4242, 4243, 4245, 4246, 4247, 4249, 4250, 4404, 4404, 4404, 4314, 4399, 4400, 4401,
+        4402, 4403, 4404, 4315, 4328, 4330, 4339, 4376, 4377, 4382, 4391, 4404, 4303, 4306, 4313, 4315,
+        4332, 4339, 4377, 4378, 4379, 4382, 4383, 4384, 4385, 4391, 4392, 4393, 4404, 4303, 4308, 4313,
+        4325, 4326, 4329, 4338, 4379, 4380, 4381, 4385, 4386, 4387, 4393, 4394, 4395, 4396, 4404, 4304,
+        4305, 4381, 4387, 4388, 4389, 4390, 4396, 4397, 4398, 4399, 4400, 4404, 4307, 4320, 4323, 4327,
+        4328, 4333, 4335, 4352, 4353, 4354, 4361, 4362, 4363, 4369, 4370, 4376, 4377, 4303, 4316, 4319,
+        4321, 4322, 4324, 4332, 4336, 4337, 4354, 4355, 4356, 4363, 4364, 4365, 4370, 4371, 4372, 4377,
+        4378, 4379, 4302, 4303, 4309, 4312, 4317, 4334, 4340, 4342, 4356, 4357, 4358, 4365, 4366, 4367,
+        4372, 4373, 4374, 4379, 4380, 4381, 4310, 4358, 4359, 4360, 4367, 4368, 4374, 4375, 4381, 4388,
+        4318, 4343, 4344, 4345, 4346, 4347, 4349, 4350, 4352, 4353, 4354, 4311, 4331, 4341, 4344, 4347,
+        4348, 4350, 4351, 4354, 4355, 4356, 4356, 4357, 4358, 4358, 4359, 4360, 4435, 4410, 4413, 4417,
+        4427, 4430, 4432, 4434, 4435, 4408, 4411, 4419, 4422, 4425, 4428, 4429, 4431, 4434, 4418, 4421,
+        4433, 4409, 4415, 4420, 4424, 4433, 4435, 4406, 4407, 4412, 4417, 4434, 4435, 4434, 4414, 4416,
+        4423, 4426, 4433, 4433, 4435, 4434, 4435, 4434, 4433, 4433, 4435, 4435, 4533, 4533, 4534, 4535,
+        4540, 4541, 4542, 4546, 4547, 4548, 4549, 4535, 4536, 4537, 4542, 4543, 4544, 4547, 4549, 4537,
+        4538, 4539, 4544, 4545, 4516, 4517, 4518, 4525, 4526, 4533, 4518, 4519, 4520, 4526, 4527, 4528,
+        4533, 4534, 4535, 4520, 4521, 4522, 4528, 4529, 4530, 4535, 4536, 4537, 4522, 4523, 4524, 4530,
+        4531, 4532, 4537, 4538, 4539, 4500, 4501, 4502, 4508, 4509, 4510, 4516, 4517, 4518, 4502, 4503,
+        4504, 4510, 4511, 4512, 4518, 4519, 4520, 4483, 4484, 4504, 4505, 4506, 4512, 4513, 4514, 4520,
+        4521, 4522, 4484, 4506, 4507, 4514, 4515, 4522, 4523, 4524, 4477, 4486, 4493, 4500, 4501, 4502,
+        4477, 4480, 4485, 4486, 4487, 4488, 4493, 4494, 4495, 4502, 4503, 4504, 4474, 4475, 4476, 4482,
+        4483, 4484, 4488, 4489, 4490, 4495, 4496, 4497, 4504, 4505, 4506, 4476, 4478, 4479, 4481, 4484,
+        4490, 4491, 4492, 4497, 4498, 4499, 4506, 4507, 4565, 4573, 4580, 4582, 4583, 4551, 4552, 4563,
+        4564, 4571, 4574, 4583, 4552, 4556, 4557, 4562, 4569, 4583, 4568, 4583, 4560, 4566, 4576, 4577,
+        4583, 4584, 4567, 4572, 4579, 4583, 4584, 4583, 4584, 4570, 4575, 4581, 4583, 4584, 4553, 4554,
+        4584, 4585, 4558, 4584, 4585, 4584, 4585, 4559, 4584, 4585, 4578, 4585, 4561, 4585, 4555, 4585,
+        4585, 4614, 4615, 4590, 4592, 4600, 4604, 4610, 4616, 4618, 4587, 4588, 4589, 4591, 4593, 4594,
+        4595, 4596, 4597, 4598, 4599, 4601, 4602, 4603, 4605, 4606, 4609, 4611, 4612, 4613, 4616, 4617,
+        4618, 4607, 4608, 4617, 4617, 4617, 4589, 4614, 4615, 4616, 4602, 4606, 4616, 4616, 4589, 4604,
+        4616, 4587, 4588, 4596, 4597, 4602, 4616, 4588, 4594, 4598, 4605, 4612, 4616, 4617, 4617, 4590,
+        4610, 4613, 4616, 4618, 4591, 4593, 4595, 4603, 4611, 4616, 4618, 4599, 4601, 4612, 4616, 4617,
+        4618, 4607, 4617, 4592, 4600, 4618, 4591, 4618, 4609, 4617, 4618, 4608, 4617, 4621, 4622, 4633,
+        4636, 4642, 4649, 4653, 4655, 4653, 4655, 4655, 4655, 4622, 4624, 4648, 4651, 4652, 4653, 4655,
+        4645, 4652, 4653, 4655, 4652, 4654, 4655, 4643, 4654, 4655, 4623, 4625, 4626, 4631, 4632, 4637,
+        4638, 4639, 4640, 4644, 4646, 4650, 4652, 4655, 4623, 4630, 4634, 4652, 4655, 4627, 4630, 4647,
+        4652, 4654, 4655, 4654, 4655, 4623, 4652, 4655, 4623, 4635, 4641, 4652, 4655, 4652, 4654, 4655,
+        4628, 4629, 4654, 4655, 4730, 4733, 4739, 4740, 4741, 4771, 4739, 4770, 4771, 4771, 4771, 4739,
+        4740, 4741, 4771, 4711, 4712, 4717, 4718, 4720, 4721, 4723, 4726, 4732, 4739, 4751, 4752, 4759,
+        4760, 4765, 4766, 4770, 4771, 4729, 4734, 4752, 4753, 4754, 4755, 4756, 4760, 4761, 4762, 4763,
+        4764, 4766, 4767, 4768, 4769, 4771, 4756, 4757, 4764, 4771, 4738, 4739, 4771, 4722, 4723, 4724,
+        4725, 4738, 4739, 4742, 4743, 4751, 4752, 4771, 4715, 4731, 4738, 4743, 4744, 4745, 4746, 4747,
+        4752, 4753, 4754, 4755, 4756, 4771, 4738, 4747, 4748, 4749, 4750, 4756, 4757, 4758, 4771, 4738,
+        4771, 4709, 4710, 4716, 4738, 4771, 4710, 4714, 4719, 4727, 4736, 4737, 4738, 4771, 4713, 4728,
+        4735, 4738, 4771, 4780, 4781, 4797, 4819, 4822, 4785, 4814, 4819, 4822, 4787, 4794, 4803, 4819,
+        4820, 4822, 4775, 4794, 4816, 4820, 4822, 4778, 4779, 4801, 4802, 4807, 4810, 4819, 4822, 4783,
+        4788, 4796, 4808, 4811, 4819, 4822, 4782, 4793, 4795, 4800, 4805, 4812, 4815, 4819, 4820, 4822,
+        4775, 4798, 4818, 4820, 4822, 4778, 4779, 4790, 4819, 4821, 4822, 4773, 4774, 4791, 4804, 4809,
+        4811, 4819, 4821, 4822, 4776, 4784, 4786, 4799, 4817, 4819, 4820, 4821, 4822, 4776, 4786, 4798,
+        4806, 4820, 4821, 4822, 4821, 4822, 4813, 4821, 4822, 4777, 4789, 4792, 4821, 4822, 4821, 4822,
+        4872, 4872, 4843, 4857, 4864, 4872, 4843, 4847, 4852, 4855, 4857, 4859, 4862, 4864, 4872, 4865,
+        4872, 4839, 4840, 4841, 4865, 4872, 4842, 4845, 4863, 4864, 4865, 4866, 4868, 4871, 4872, 4864,
+        4872, 4854, 4861, 4865, 4872, 4841, 4846, 4848, 4851, 4858, 4860, 4865, 4872, 4863, 4865, 4871,
+        4872, 4872, 4849, 4850, 4861, 4865, 4869, 4870, 4872, 4853, 4865, 4870, 4872, 4844, 4856, 4865,
+        4867, 4872, 4872, 4974, 4880, 4888, 4895, 4898, 4900, 4902, 4903, 4905, 4920, 4974, 4975, 4976,
+        4977, 4978, 4979, 4980, 4981, 4987, 4988, 4989, 4990, 4991, 4992, 4993, 5000, 5001, 5002, 5003,
+        5004, 5005, 5011, 5012, 5013, 5014, 5015, 4874, 4875, 4879, 4883, 4884, 4892, 4901, 4908, 4909,
+        4918, 4923, 4981, 4982, 4983, 4984, 4985, 4986, 4993, 4994, 4995, 4996, 4997, 4998, 4999, 5005,
+        5006, 5007, 5008, 5009, 5010, 5015, 5016, 5017, 5018, 4878, 4950, 4961, 4962, 4974, 4877, 4878,
+        4882, 4885, 4887, 4889, 4890, 4891, 4893, 4903, 4904, 4906, 4911, 4913, 4914, 4916, 4917, 4921,
+        4922, 4926, 4927, 4928, 4931, 4932, 4933, 4934, 4935, 4936, 4940, 4941, 4942, 4943, 4944, 4945,
+        4946, 4950, 4951, 4952, 4953, 4954, 4955, 4956, 4962, 4963, 4964, 4965, 4966, 4967, 4968, 4969,
+        4974, 4975, 4976, 4977, 4978, 4979, 4980, 4981, 4876, 4881, 4882, 4886, 4894, 4896, 4897, 4899,
+        4907, 4910, 4912, 4915, 4919, 4924, 4925, 4928, 4929, 4930, 4936, 4937, 4938, 4939, 4946, 4947,
+        4948, 4949, 4956, 4957, 4958, 4959, 4960, 4969, 4970, 4971, 4972, 4973, 4981, 4982, 4983, 4984,
+        4985, 4986, 4929, 4930, 4898, 4987, 4988, 5000, 5001, 4880, 4898, 4905, 4988, 4989, 4990, 4991,
+        4992, 5001, 5002, 5003, 5004, 5011, 5012, 5013, 5014, 4874, 4875, 4908, 4909, 4918, 4920, 4992,
+        4993, 4994, 4995, 4996, 5004, 5005, 5006, 5007, 5008, 5014, 5015, 5016, 5017, 4879, 4908, 4918,
+        4923, 4996, 4997, 4998, 4999, 5008, 5009, 5010, 5017, 5018, 4878, 4903, 4922, 4961, 4962, 4963,
+        4964, 4974, 4975, 4976, 4987, 4988, 4888, 4889, 4895, 4900, 4906, 4911, 4921, 4964, 4965, 4966,
+        4967, 4968, 4976, 4977, 4978, 4979, 4980, 4988, 4989, 4990, 4991, 4992, 4882, 4883, 4892, 4899,
+        4902, 4915, 4968, 4969, 4970, 4971, 4972, 4980, 4981, 4982, 4983, 4984, 4992, 4993, 4994, 4995,
+        4996, 4881, 4884, 4901, 4924, 4972, 4973, 4984, 4985, 4986, 4996, 4997, 4998, 4999, 4885, 4887,
+        4940, 4941, 4950, 4951, 4952, 4961, 4962, 4963, 4964, 4877, 4890, 4913, 4916, 4917, 4941, 4942,
+        4943, 4944, 4945, 4952, 4953, 4954, 4955, 4964, 4965, 4966, 4967, 4968, 4886, 4897, 4910, 4919,
+        4925, 4945, 4946, 4947, 4948, 4955, 4956, 4957, 4958, 4959, 4968, 4969, 4970, 4971, 4972, 4876,
+        4907, 4912, 4948, 4949, 4959, 4960, 4972, 4973, 4885, 4931, 4932, 4940, 4941, 4891, 4893, 4904,
+        4914, 4926, 4927, 4932, 4933, 4934, 4935, 4941, 4942, 4943, 4944, 4945, 4894, 4896, 4928, 4929,
+        4930, 4935, 4936, 4937, 4938, 4939, 4945, 4946, 4947, 4948, 4876, 4939, 4948, 4949, 5024, 5025,
+        5026, 5027, 5029, 5032, 5034, 5039, 5049, 5050, 5059, 5061, 5063, 5065, 5066, 5069, 5070, 5071,
+        5072, 5075, 5076, 5077, 5078, 5079, 5080, 5085, 5086, 5087, 5088, 5089, 5094, 5095, 5096, 5097,
+        5101, 5102, 5103, 5104, 5021, 5022, 5023, 5031, 5034, 5035, 5038, 5041, 5042, 5043, 5046, 5048,
+        5051, 5052, 5053, 5054, 5055, 5056, 5060, 5064, 5067, 5068, 5069, 5072, 5080, 5081, 5082, 5083,
+        5084, 5089, 5090, 5091, 5092, 5093, 5097, 5098, 5099, 5100, 5104, 5033, 5044, 5045, 5050, 5057,
+        5062, 5072, 5073, 5074, 5075, 5028, 5040, 5047, 5058, 5060, 5072, 5073, 5036, 5073, 5030, 5037,
+        5073, 5063, 5065, 5076, 5077, 5078, 5085, 5086, 5087, 5094, 5095, 5101, 5102, 5029, 5032, 5034,
+        5039, 5049, 5059, 5061, 5063, 5068, 5070, 5071, 5078, 5079, 5080, 5087, 5088, 5089, 5095, 5096,
+        5097, 5098, 5102, 5103, 5104, 5021, 5022, 5023, 5031, 5041, 5043, 5046, 5051, 5052, 5053, 5064,
+        5067, 5080, 5081, 5082, 5089, 5090, 5091, 5098, 5099, 5100, 5104, 5023, 5048, 5054, 5055, 5082,
+        5083, 5084, 5091, 5092, 5093, 5100, 5033, 5045, 5072, 5074, 5075, 5076, 5077, 5078, 5024, 5025,
+        5026, 5027, 5042, 5044, 5050, 5057, 5066, 5069, 5072, 5078, 5079, 5080, 5038, 5056, 5072, 5080,
+        5081, 5082, 5035, 5047, 5060, 5072, 5082, 5083, 5084, 5072, 5073, 5074, 5062, 5072, 5073, 5028,
+        5040, 5072, 5073, 5072, 5073, 5036, 5073, 5073, 5030, 5037, 5058, 5073, 5073, 5231, 5182, 5191,
+        5209, 5210, 5211, 5213, 5214, 5216, 5217, 5219, 5220, 5221, 5228, 5231, 5170, 5176, 5181, 5183,
+        5189, 5192, 5193, 5195, 5211, 5212, 5214, 5215, 5217, 5218, 5220, 5229, 5231, 5157, 5158, 5187,
+        5194, 5229, 5231, 5222, 5223, 5224, 5231, 5179, 5202, 5203, 5204, 5206, 5207, 5209, 5210, 5211,
+        5222, 5224, 5230, 5231, 5160, 5161, 5162, 5163, 5164, 5165, 5166, 5168, 5169, 5171, 5172, 5174,
+        5175, 5177, 5178, 5180, 5185, 5186, 5188, 5197, 5204, 5205, 5207, 5208, 5211, 5212, 5229, 5230,
+        5231, 5173, 5190, 5229, 5230, 5231, 5223, 5224, 5231, 5159, 5198, 5199, 5200, 5201, 5202, 5224,
+        5225, 5226, 5230, 5231, 5167, 5184, 5185, 5196, 5200, 5225, 5226, 5227, 5230, 5231, 5230, 5231,
+        5231, 5231, 5231, 5231, 5256, 5256, 5240, 5254, 5256, 5237, 5251, 5254, 5256, 5233, 5234, 5235,
+        5236, 5253, 5256, 5253, 5255, 5256, 5240, 5242, 5254, 5255, 5256, 5245, 5254, 5255, 5256, 5236,
+        5241, 5246, 5247, 5253, 5256, 5238, 5243, 5253, 5255, 5256, 5250, 5252, 5255, 5256, 5239, 5249,
+        5255, 5256, 5253, 5256, 5243, 5248, 5253, 5255, 5256, 5252, 5255, 5256, 5244, 5255, 5256, 5277,
+        5279, 5280, 5307, 5310, 5321, 5322, 5269, 5307, 5310, 5322, 5258, 5259, 5263, 5270, 5273, 5274,
+        5277, 5284, 5288, 5290, 5293, 5297, 5298, 5303, 5305, 5310, 5311, 5318, 5319, 5321, 5322, 5261,
+        5267, 5287, 5291, 5301, 5302, 5310, 5311, 5319, 5320, 5322, 5323, 5264, 5265, 5268, 5278, 5281,
+        5282, 5283, 5286, 5294, 5295, 5304, 5311, 5315, 5316, 5318, 5319, 5260, 5262, 5266, 5267, 5275,
+        5276, 5285, 5299, 5302, 5308, 5311, 5313, 5314, 5316, 5317, 5319, 5320, 5323, 5324, 5272, 5289,
+        5311, 5312, 5315, 5316, 5271, 5292, 5296, 5300, 5306, 5309, 5311, 5314, 5316, 5317, 5371, 5374,
+        5377, 5378, 5379, 5380, 5378, 5380, 5373, 5375, 5377, 5378, 5370, 5372, 5373, 5375, 5376, 5378,
+        5376, 5375, 5333, 5334, 5349, 5366, 5369, 5375, 5376, 5331, 5332, 5359, 5363, 5368, 5376, 5353,
+        5326, 5327, 5328, 5329, 5335, 5336, 5338, 5339, 5340, 5341, 5342, 5343, 5345, 5346, 5347, 5348,
+        5351, 5352, 5355, 5356, 5358, 5361, 5362, 5365, 5367, 5330, 5337, 5344, 5350, 5354, 5357, 5360,
+        5364, 5379, 5379, 5380, 5380, 5371, 5374, 5377, 5379, 5377, 5378, 5379, 5380, 5378, 5380, 5377,
+        5373, 5377, 5378, 5373, 5378, 5377, 5370, 5373, 5375, 5377, 5378, 5370, 5372, 5373, 5375, 5376,
+        5378, 5376, 5488, 5494, 5495, 5488, 5489, 5494, 5495, 5497, 5492, 5496, 5492, 5496, 5488, 5422,
+        5431, 5440, 5445, 5451, 5456, 5461, 5464, 5472, 5477, 5481, 5482, 5485, 5486, 5487, 5488, 5489,
+        5420, 5421, 5422, 5423, 5424, 5425, 5426, 5427, 5428, 5435, 5442, 5444, 5448, 5449, 5457, 5460,
+        5461, 5462, 5466, 5468, 5474, 5476, 5479, 5485, 5487, 5491, 5493, 5485, 5498, 5418, 5419, 5429,
+        5430, 5432, 5433, 5434, 5436, 5437, 5438, 5439, 5441, 5443, 5446, 5447, 5450, 5452, 5453, 5454,
+        5455, 5458, 5459, 5460, 5463, 5465, 5466, 5467, 5469, 5470, 5471, 5473, 5475, 5478, 5480, 5483,
+        5484, 5485, 5490, 5491, 5498, 5484, 5505, 5529, 5535, 5547, 5549, 5534, 5535, 5538, 5547, 5549,
+        5549, 5549, 5502, 5512, 5521, 5531, 5541, 5547, 5549, 5501, 5503, 5512, 5514, 5526, 5528, 5537,
+        5540, 5542, 5546, 5547, 5549, 5501, 5508, 5509, 5515, 5518, 5519, 5520, 5525, 5533, 5545, 5546,
+        5548, 5549, 5544, 5548, 5549, 5524, 5547, 5549, 5500, 5501, 5503, 5504, 5506, 5511, 5516, 5517,
+        5522, 5523, 5530, 5536, 5546, 5547, 5549, 5500, 5501, 5507, 5516, 5519, 5527, 5532, 5539, 5546,
+        5548, 5549, 5548, 5549, 5549, 5513, 5549, 5510, 5543, 5549, 5549, 5621, 5622, 5570, 5592, 5602,
+        5611, 5621, 5622, 5557, 5565, 5569, 5573, 5597, 5599, 5601, 5605, 5613, 5614, 5615, 5621, 5622,
+        5553, 5554, 5581, 5584, 5587, 5596, 5599, 5609, 5615, 5618, 5621, 5622, 5589, 5610, 5621, 5622,
+        5595, 5621, 5622, 5555, 5556, 5558, 5559, 5567, 5568, 5571, 5577, 5582, 5588, 5595, 5597, 5600,
+        5603, 5613, 5621, 5622, 5579, 5600, 5606, 5616, 5621, 5622, 5621, 5622, 5551, 5552, 5560, 5561,
+        5562, 5563, 5564, 5566, 5574, 5575, 5576, 5578, 5580, 5583, 5585, 5591, 5594, 5598, 5607, 5621,
+        5622, 5572, 5590, 5593, 5604, 5612, 5619, 5621, 5622, 5621, 5622, 5621, 5622, 5586, 5608, 5617,
+        5620, 5621, 5622, 5621, 5622, 5621, 5622, 5680, 5706, 5643, 5680, 5706, 5711, 5713, 5629, 5633,
+        5655, 5674, 5675, 5677, 5682, 5693, 5694, 5699, 5701, 5711, 5713, 5714, 5637, 5644, 5667, 5677,
+        5688, 5689, 5696, 5700, 5703, 5711, 5712, 5714, 5628, 5632, 5657, 5673, 5683, 5685, 5692, 5698,
+        5702, 5705, 5706, 5707, 5630, 5631, 5641, 5642, 5645, 5647, 5650, 5651, 5653, 5660, 5666, 5671,
+        5695, 5697, 5704, 5705, 5706, 5707, 5708, 5709, 5711, 5624, 5626, 5627, 5646, 5649, 5651, 5654,
+        5656, 5658, 5662, 5670, 5681, 5686, 5704, 5705, 5708, 5709, 5710, 5711, 5634, 5648, 5652, 5668,
+        5672, 5676, 5679, 5689, 5690, 5696, 5700, 5704, 5710, 5711, 5712, 5625, 5663, 5685, 5691, 5705,
+        5707, 5625, 5636, 5639, 5640, 5659, 5661, 5665, 5669, 5684, 5687, 5705, 5707, 5708, 5635, 5638,
+        5664, 5678, 5705, 5708, 5693, 5713, 5629, 5633, 5637, 5655, 5674, 5675, 5677, 5682, 5693, 5694,
+        5699, 5701, 5713, 5714, 5637, 5644, 5677, 5714, 5643, 5657, 5680, 5683, 5706, 5704, 5706, 5711,
+        5713, 5627, 5649, 5677, 5696, 5704, 5711, 5712, 5713, 5714, 5634, 5652, 5667, 5668, 5672, 5676,
+        5677, 5679, 5688, 5689, 5690, 5696, 5700, 5703, 5704, 5712, 5714, 5698, 5702, 5705, 5706, 5707,
+        5624, 5626, 5630, 5642, 5646, 5647, 5654, 5666, 5681, 5695, 5697, 5704, 5705, 5706, 5707, 5709,
+        5711, 5624, 5626, 5648, 5654, 5656, 5658, 5662, 5670, 5681, 5686, 5704, 5709, 5710, 5711, 5712,
+        5648, 5690, 5704, 5710, 5712, 5625, 5628, 5632, 5663, 5673, 5685, 5691, 5692, 5698, 5702, 5705,
+        5707, 5631, 5635, 5636, 5639, 5640, 5641, 5645, 5650, 5651, 5653, 5659, 5660, 5661, 5665, 5669,
+        5671, 5684, 5687, 5705, 5707, 5708, 5709, 5638, 5664, 5678, 5708, 5709, 5795, 5828, 5753, 5773,
+        5776, 5790, 5795, 5796, 5797, 5798, 5799, 5806, 5807, 5808, 5814, 5828, 5753, 5760, 5783, 5792,
+        5799, 5800, 5801, 5802, 5808, 5809, 5810, 5811, 5814, 5815, 5816, 5817, 5818, 5828, 5775, 5802,
+        5803, 5804, 5805, 5811, 5812, 5813, 5818, 5819, 5828, 5777, 5784, 5787, 5791, 5795, 5826, 5828,
+        5753, 5761, 5769, 5778, 5785, 5795, 5796, 5797, 5798, 5799, 5821, 5826, 5828, 5753, 5759, 5769,
+        5770, 5771, 5794, 5799, 5800, 5801, 5802, 5821, 5826, 5827, 5828, 5766, 5802, 5803, 5804, 5805,
+        5827, 5828, 5781, 5784, 5823, 5826, 5828, 5762, 5765, 5772, 5782, 5821, 5826, 5828, 5752, 5754,
+        5755, 5756, 5757, 5758, 5779, 5793, 5820, 5821, 5826, 5827, 5828, 5767, 5827, 5828, 5764, 5786,
+        5823, 5825, 5828, 5763, 5768, 5788, 5789, 5822, 5824, 5828, 5774, 5780, 5824, 5828, 5828, 5883,
+        5885, 5886, 5887, 5837, 5855, 5863, 5878, 5885, 5886, 5887, 5830, 5831, 5838, 5844, 5861, 5879,
+        5884, 5885, 5886, 5887, 5830, 5831, 5860, 5867, 5884, 5886, 5887, 5839, 5846, 5856, 5865, 5885,
+        5887, 5834, 5840, 5842, 5845, 5850, 5869, 5870, 5876, 5885, 5887, 5835, 5843, 5844, 5851, 5853,
+        5872, 5873, 5874, 5882, 5884, 5885, 5887, 5841, 5854, 5858, 5859, 5862, 5868, 5871, 5884, 5887,
+        5875, 5880, 5885, 5887, 5857, 5885, 5887, 5832, 5833, 5849, 5884, 5885, 5887, 5847, 5881, 5884,
+        5887, 5852, 5887, 5836, 5864, 5866, 5887, 5848, 5887, 5877, 5887, 5889, 5890, 5891, 5892, 5893,
+        5894, 5895, 5896, 5897, 5898, 5899, 5900, 5902, 5903, 5904, 5905, 5906, 5907, 5909, 5910, 5911,
+        5913, 5914, 5916, 5917, 5918, 5919, 5921, 5927, 5928, 5929, 5930, 5931, 5932, 5933, 5934, 5935,
+        5936, 5937, 5938, 5939, 5940, 5941, 5942, 5943, 5944, 5945, 5946, 5947, 5948, 5949, 5950, 5951,
+        5953, 5890, 5898, 5910, 5912, 5922, 5924, 5926, 5931, 5950, 5953, 5953, 5952, 5931, 5952, 5953,
+        5908, 5915, 5920, 5925, 5931, 5952, 5953, 5952, 5953, 5952, 5952, 5901, 5952, 5923, 5952, 5952,
+        5952, 5952, 5952, 6063, 6022, 6023, 6025, 6039, 6040, 6049, 6059, 6060, 6063, 6012, 6013, 6024,
+        6035, 6036, 6041, 6052, 6053, 6060, 6063, 6027, 6063, 6063, 6060, 6063, 6060, 6063, 6021, 6029,
+        6031, 6032, 6034, 6037, 6044, 6047, 6057, 6062, 6063, 6063, 6043, 6061, 6063, 6020, 6061, 6063,
+        6015, 6016, 6017, 6018, 6050, 6062, 6063, 6063, 6014, 6030, 6038, 6042, 6045, 6046, 6048, 6061,
+        6063, 6014, 6019, 6026, 6028, 6030, 6033, 6051, 6054, 6055, 6056, 6058, 6061, 6063, 6063, 6068,
+        6073, 6081, 6094, 6109, 6116, 6117, 6120, 6065, 6066, 6067, 6068, 6078, 6082, 6083, 6085, 6092,
+        6093, 6100, 6102, 6105, 6108, 6112, 6114, 6115, 6116, 6117, 6120, 6070, 6072, 6074, 6076, 6079,
+        6080, 6088, 6096, 6099, 6101, 6111, 6116, 6117, 6120, 6089, 6091, 6120, 6075, 6116, 6120, 6086,
+        6090, 6104, 6107, 6116, 6118, 6120, 6071, 6072, 6087, 6095, 6096, 6103, 6110, 6116, 6118, 6120,
+        6077, 6118, 6120, 6120, 6069, 6097, 6098, 6113, 6118, 6120, 6069, 6084, 6113, 6118, 6120, 6106,
+        6118, 6120, 6119, 6120, 6119, 6120, 6119, 6120, 6119, 6120, 6198, 6205, 6215, 6224, 6227, 6234,
+        6248, 6169, 6183, 6215, 6236, 6242, 6248, 6165, 6186, 6215, 6228, 6242, 6243, 6244, 6248, 6248,
+        6166, 6181, 6188, 6190, 6205, 6209, 6210, 6212, 6215, 6227, 6230, 6233, 6234, 6247, 6248, 6167,
+        6182, 6189, 6203, 6213, 6215, 6247, 6248, 6175, 6200, 6215, 6221, 6225, 6231, 6247, 6248, 6177,
+        6187, 6220, 6221, 6246, 6248, 6168, 6170, 6171, 6174, 6178, 6179, 6184, 6185, 6190, 6192, 6194,
+        6199, 6204, 6206, 6207, 6208, 6209, 6211, 6212, 6218, 6247, 6248, 6172, 6173, 6180, 6193, 6202,
+        6211, 6214, 6218, 6238, 6240, 6247, 6248, 6176, 6191, 6193, 6195, 6219, 6222, 6225, 6237, 6240,
+        6247, 6248, 6159, 6160, 6161, 6162, 6163, 6216, 6220, 6232, 6241, 6246, 6248, 6211, 6218, 6229,
+        6248, 6164, 6196, 6211, 6217, 6218, 6223, 6229, 6235, 6240, 6248, 6197, 6201, 6223, 6226, 6240,
+        6248, 6239, 6245, 6248, 6342, 6359, 6360, 6361, 6359, 6366, 6363, 6364, 6365, 6365, 6358, 6359,
+        6367, 6282, 6285, 6287, 6288, 6290, 6292, 6293, 6294, 6298, 6299, 6301, 6302, 6304, 6306, 6308,
+        6309, 6311, 6312, 6315, 6316, 6317, 6319, 6325, 6327, 6328, 6330, 6331, 6333, 6335, 6336, 6338,
+        6341, 6347, 6350, 6352, 6358, 6359, 6367, 6368, 6369, 6372, 6375, 6296, 6318, 6325, 6362, 6363,
+        6372, 6375, 6377, 6286, 6301, 6312, 6315, 6325, 6349, 6356, 6368, 6372, 6375, 6379, 6380, 6250,
+        6251, 6252, 6253, 6254, 6255, 6256, 6257, 6258, 6259, 6260, 6261, 6262, 6263, 6264, 6265, 6266,
+        6267, 6268, 6269, 6270, 6271, 6272, 6273, 6274, 6275, 6276, 6277, 6278, 6279, 6280, 6281, 6283,
+        6289, 6291, 6295, 6297, 6300, 6303, 6305, 6307, 6310, 6313, 6314, 6320, 6321, 6322, 6324, 6325,
+        6329, 6332, 6334, 6339, 6340, 6344, 6345, 6348, 6349, 6353, 6372, 6374, 6375, 6376, 6377, 6379,
+        6379, 6284, 6323, 6326, 6337, 6343, 6346, 6351, 6370, 6371, 6373, 6376, 6378, 6379, 6354, 6355,
+        6357, 6370, 6371, 6512, 6512, 6476, 6510, 6512, 6464, 6476, 6485, 6491, 6507, 6510, 6512, 6512,
+        6509, 6512, 6474, 6475, 6477, 6479, 6480, 6487, 6488, 6490, 6495, 6497, 6498, 6501, 6506, 6508,
+        6509, 6510, 6512, 6481, 6510, 6512, 6512, 6478, 6496, 6500, 6504, 6505, 6509, 6511, 6512, 6462,
+        6463, 6482, 6483, 6484, 6493, 6503, 6509, 6511, 6512, 6512, 6512, 6465, 6466, 6467, 6468, 6486,
+        6492, 6499, 6502, 6511, 6512, 6469, 6470, 6471, 6472, 6473, 6489, 6494, 6511, 6512, 6512, 6560,
+        6593, 6605, 6606, 6607, 6608, 6606, 6608, 6562, 6603, 6605, 6606, 6559, 6561, 6562, 6588, 6603,
+        6604, 6606, 6604, 6603, 6522, 6523, 6538, 6555, 6558, 6571, 6578, 6584, 6587, 6588, 6597, 6600,
+        6603, 6604, 6520, 6521, 6548, 6552, 6557, 6570, 6571, 6573, 6576, 6582, 6584, 6589, 6591, 6592,
+        6594, 6597, 6598, 6600, 6601, 6602, 6604, 6542, 6580, 6594, 6598, 6599, 6602, 6597, 6514, 6515,
+        6516, 6517, 6518, 6524, 6525, 6527, 6528, 6529, 6530, 6531, 6532, 6534, 6535, 6536, 6537, 6540,
+        6541, 6544, 6545, 6547, 6550, 6551, 6554, 6556, 6563, 6564, 6565, 6566, 6567, 6568, 6573, 6574,
+        6575, 6576, 6594, 6595, 6597, 6598, 6519, 6526, 6533, 6539, 6543, 6546, 6549, 6553, 6564, 6566,
+        6568, 6569, 6572, 6577, 6579, 6581, 6583, 6585, 6586, 6590, 6594, 6595, 6596, 6598, 6599, 6641,
+        6639, 6641, 6618, 6627, 6630, 6633, 6639, 6641, 6641, 6640, 6641, 6615, 6636, 6639, 6640, 6641,
+        6613, 6622, 6624, 6631, 6632, 6636, 6638, 6639, 6641, 6610, 6611, 6612, 6614, 6617, 6619, 6623,
+        6625, 6626, 6628, 6635, 6637, 6638, 6641, 6616, 6629, 6640, 6641, 6621, 6634, 6640, 6641, 6638,
+        6641, 6611, 6620, 6638, 6641, 6640, 6641, 6640, 6641, 6641, 6641, 6645, 6646, 6651, 6652, 6654,
+        6657, 6660, 6664, 6669, 6671, 6672, 6675, 6678, 6679, 6680, 6682, 6683, 6687, 6688, 6715, 6720,
+        6722, 6650, 6652, 6653, 6661, 6668, 6670, 6673, 6677, 6688, 6689, 6690, 6691, 6692, 6693, 6694,
+        6695, 6696, 6697, 6698, 6699, 6700, 6701, 6702, 6703, 6720, 6722, 6686, 6710, 6711, 6712, 6720,
+        6722, 6722, 6659, 6713, 6714, 6715, 6720, 6722, 6647, 6648, 6649, 6656, 6658, 6666, 6667, 6676,
+        6677, 6684, 6717, 6718, 6719, 6720, 6722, 6643, 6644, 6647, 6681, 6717, 6718, 6720, 6722, 6722,
+        6708, 6722, 6662, 6665, 6708, 6716, 6717, 6722, 6655, 6674, 6707, 6709, 6716, 6717, 6722, 6663,
+        6685, 6704, 6722, 6721, 6722, 6721, 6722, 6721, 6722, 6704, 6705, 6706, 6721, 6722, 6924, 6925,
+        6957, 6958, 6984, 6985, 6985, 6986, 6903, 6910, 6921, 6933, 6935, 6936, 6945, 6947, 6951, 6955,
+        6959, 6965, 6966, 6970, 6975, 6976, 6978, 6979, 6898, 6905, 6906, 6909, 6913, 6916, 6918, 6923,
+        6929, 6932, 6937, 6939, 6940, 6942, 6944, 6947, 6948, 6951, 6952, 6956, 6963, 6967, 6978, 6979,
+        6981, 6982, 6983, 6908, 6911, 6912, 6914, 6917, 6931, 6938, 6941, 6950, 6964, 6974, 6975, 6977,
+        6978, 6895, 6896, 6897, 6899, 6900, 6901, 6902, 6904, 6907, 6915, 6919, 6920, 6922, 6926, 6927,
+        6928, 6930, 6934, 6942, 6943, 6946, 6949, 6950, 6953, 6954, 6956, 6960, 6961, 6962, 6963, 6968,
+        6969, 6971, 6972, 6973, 6977, 6978, 6980, 6981, 6983, 6924, 6925, 6957, 6958, 6984, 6985, 6986,
+        6933, 6936, 6965, 6966, 6975, 6976, 6903, 6905, 6910, 6913, 6921, 6929, 6932, 6933, 6935, 6937,
+        6939, 6940, 6942, 6945, 6947, 6948, 6951, 6952, 6955, 6959, 6965, 6966, 6967, 6970, 6975, 6976,
+        6978, 6979, 6981, 6982, 6898, 6906, 6909, 6916, 6918, 6923, 6940, 6944, 6956, 6963, 6981, 6982,
+        6983, 6911, 6914, 6941, 6974, 6975, 6895, 6897, 6907, 6908, 6912, 6915, 6917, 6919, 6926, 6927,
+        6928, 6931, 6934, 6938, 6941, 6942, 6949, 6950, 6953, 6954, 6960, 6961, 6962, 6964, 6974, 6975,
+        6977, 6978, 6980, 6981, 6896, 6899, 6900, 6901, 6902, 6904, 6920, 6922, 6930, 6943, 6946, 6954,
+        6956, 6963, 6968, 6969, 6971, 6972, 6973, 6980, 6981, 6983, 6999, 7012, 7019, 7021, 6995, 7000,
+        7010, 7011, 7019, 7021, 7021, 7021, 7019, 7021, 7003, 7008, 7018, 7019, 7021, 7007, 7018, 7021,
+        7021, 7021, 6989, 6990, 6992, 6996, 7002, 7004, 7006, 7009, 7013, 7015, 7016, 7017, 7018, 7021,
+        6993, 6998, 7018, 7021, 7001, 7021, 6994, 7020, 7021, 6997, 7005, 7014, 7020, 7021, 6991, 7021,
+        7021, 7164, 7173, 7073, 7074, 7107, 7112, 7135, 7154, 7157, 7164, 7173, 7076, 7079, 7086, 7092,
+        7103, 7110, 7116, 7121, 7128, 7134, 7139, 7154, 7157, 7166, 7173, 7075, 7086, 7113, 7121, 7153,
+        7160, 7173, 7137, 7173, 7080, 7097, 7112, 7117, 7130, 7137, 7144, 7152, 7154, 7159, 7173, 7070,
+        7071, 7072, 7085, 7088, 7093, 7094, 7109, 7111, 7123, 7127, 7128, 7142, 7149, 7154, 7162, 7165,
+        7166, 7167, 7169, 7170, 7173, 7113, 7123, 7149, 7170, 7173, 7077, 7081, 7089, 7114, 7118, 7124,
+        7137, 7140, 7143, 7146, 7148, 7158, 7173, 7069, 7077, 7087, 7090, 7096, 7101, 7108, 7114, 7118,
+        7122, 7125, 7129, 7136, 7137, 7141, 7144, 7147, 7148, 7151, 7172, 7173, 7069, 7091, 7126, 7131,
+        7132, 7141, 7150, 7155, 7162, 7167, 7168, 7169, 7172, 7173, 7078, 7099, 7102, 7115, 7131, 7132,
+        7133, 7171, 7173, 7146, 7158, 7173, 7069, 7082, 7100, 7104, 7119, 7138, 7156, 7172, 7173, 7068,
+        7069, 7083, 7084, 7095, 7106, 7120, 7131, 7138, 7145, 7155, 7156, 7161, 7163, 7172, 7173, 7098,
+        7105, 7115, 7131, 7161, 7173, 7177, 7177, 7176, 7177, 7176, 7177, 7175, 7177, 7175, 7177, 7175,
+        7176, 7177, 7176, 7177, 7175, 7177, 7175, 7177, 7175, 7176, 7177, 7176, 7177, 7175, 7177, 7175,
+        7177, 7175, 7176, 7177, 7176, 7177, 7301, 7326, 7338, 7344, 7347, 7355, 7361, 7366, 7369, 7370,
+        7375, 7379, 7306, 7308, 7318, 7329, 7339, 7342, 7357, 7361, 7362, 7371, 7372, 7379, 7379, 7315,
+        7337, 7343, 7363, 7369, 7373, 7378, 7379, 7295, 7296, 7299, 7300, 7305, 7310, 7316, 7317, 7321,
+        7323, 7325, 7327, 7330, 7331, 7332, 7333, 7334, 7335, 7336, 7340, 7341, 7350, 7352, 7354, 7364,
+        7365, 7367, 7368, 7377, 7379, 7297, 7298, 7312, 7313, 7332, 7352, 7353, 7367, 7379, 7379, 7303,
+        7307, 7328, 7346, 7349, 7356, 7358, 7360, 7374, 7376, 7379, 7309, 7311, 7314, 7319, 7320, 7322,
+        7324, 7345, 7348, 7351, 7353, 7358, 7360, 7379, 7379, 7302, 7360, 7379, 7304, 7359, 7360, 7379,
+        7421, 7422, 7423, 7424, 7425, 7426, 7427, 7428, 7429, 7430, 7431, 7432, 7433, 7434, 7435, 7436,
+        7437, 7438, 7439, 7440, 7441, 7442, 7443, 7444, 7445, 7445, 7444, 7426, 7439, 7444, 7421, 7422,
+        7425, 7427, 7436, 7444, 7436, 7444, 7444, 7424, 7430, 7437, 7444, 7430, 7432, 7433, 7436, 7437,
+        7441, 7444, 7436, 7444, 7444, 7445, 7428, 7429, 7437, 7444, 7445, 7423, 7434, 7437, 7438, 7440,
+        7442, 7444, 7445, 7431, 7440, 7444, 7445, 7444, 7445, 7444, 7445, 7435, 7442, 7443, 7444, 7445,
+        7435, 7443, 7444, 7445, 7856, 7808, 7855, 7856, 7857, 7858, 7859, 7860, 7861, 7862, 7856, 7797,
+        7802, 7803, 7807, 7809, 7811, 7828, 7829, 7833, 7834, 7838, 7839, 7840, 7842, 7843, 7852, 7853,
+        7854, 7855, 7856, 7865, 7863, 7864, 7791, 7792, 7793, 7795, 7796, 7799, 7800, 7804, 7805, 7806,
+        7807, 7812, 7813, 7814, 7815, 7816, 7817, 7818, 7819, 7820, 7821, 7822, 7823, 7824, 7825, 7826,
+        7827, 7830, 7831, 7832, 7835, 7836, 7837, 7841, 7842, 7848, 7849, 7850, 7851, 7852, 7865, 7864,
+        7794, 7798, 7801, 7810, 7844, 7845, 7846, 7847, 7848, 8039, 8040, 8043, 8044, 7975, 7976, 7987,
+        8006, 8007, 8013, 8040, 8041, 8044, 8045, 8046, 8046, 8035, 8039, 8040, 7990, 7994, 7997, 8001,
+        8005, 8013, 8014, 8015, 8016, 8017, 8021, 8024, 8029, 8035, 8036, 8037, 8040, 8041, 8042, 7986,
+        7993, 8005, 8011, 8017, 8018, 8019, 8020, 8021, 8022, 8023, 8025, 8037, 8038, 8042, 8024, 8026,
+        8031, 8033, 8034, 8036, 8037, 7977, 7978, 7979, 7980, 7981, 7982, 7983, 7984, 7985, 7988, 7991,
+        7992, 7995, 7996, 7998, 8000, 8002, 8003, 8004, 8009, 8010, 8012, 8023, 8025, 8026, 8027, 8030,
+        8031, 8034, 8037, 8038, 8050, 8050, 8051, 8032, 8033, 8034, 7982, 7989, 7999, 8004, 8008, 8012,
+        8027, 8028, 8032, 8034, 8047, 8048, 8050, 8048, 8049, 8050, 8051, 8669, 8669, 8669, 8669, 8651,
+        8669, 8598, 8608, 8609, 8611, 8613, 8618, 8619, 8620, 8623, 8625, 8626, 8629, 8637, 8641, 8642,
+        8644, 8645, 8647, 8663, 8668, 8669, 8597, 8612, 8637, 8669, 8669, 8669, 8599, 8606, 8610, 8615,
+        8622, 8624, 8635, 8637, 8638, 8652, 8654, 8655, 8657, 8660, 8664, 8665, 8669, 8596, 8597, 8604,
+        8605, 8617, 8621, 8628, 8630, 8631, 8636, 8637, 8638, 8639, 8640, 8646, 8649, 8653, 8656, 8658,
+        8661, 8662, 8665, 8666, 8667, 8669, 8656, 8669, 8659, 8669, 8670, 8600, 8601, 8602, 8603, 8616,
+        8632, 8633, 8638, 8669, 8607, 8614, 8627, 8634, 8638, 8643, 8648, 8650, 8669, 8669, 8672, 8673,
+        8696, 8702, 8714, 8717, 8726, 8733, 8740, 8743, 8767, 8773, 8781, 8674, 8677, 8678, 8680, 8681,
+        8682, 8684, 8685, 8686, 8687, 8689, 8690, 8691, 8692, 8694, 8695, 8698, 8699, 8700, 8706, 8707,
+        8708, 8709, 8712, 8715, 8716, 8718, 8719, 8720, 8721, 8722, 8723, 8724, 8725, 8727, 8728, 8731,
+        8734, 8736, 8737, 8738, 8739, 8741, 8742, 8744, 8745, 8747, 8749, 8750, 8751, 8752, 8753, 8754,
+        8755, 8756, 8757, 8758, 8759, 8760, 8762, 8763, 8764, 8766, 8769, 8770, 8771, 8772, 8774, 8775,
+        8777, 8779, 8780, 8781, 8782, 8781, 8675, 8676, 8677, 8679, 8683, 8685, 8688, 8690, 8691, 8693,
+        8697, 8701, 8703, 8704, 8705, 8710, 8711, 8713, 8729, 8730, 8732, 8735, 8737, 8746, 8747, 8748,
+        8761, 8765, 8768, 8776, 8778, 8780, 8781, 8782, 8781, 8781, 8781, 8781, 8672, 8673, 8696, 8702,
+        8714, 8717, 8726, 8733, 8740, 8743, 8744, 8745, 8767, 8773, 8781, 8678, 8684, 8692, 8695, 8698,
+        8708, 8719, 8721, 8722, 8725, 8727, 8728, 8738, 8742, 8744, 8751, 8753, 8754, 8760, 8762, 8763,
+        8772, 8775, 8777, 8779, 8781, 8674, 8681, 8682, 8709, 8712, 8718, 8720, 8721, 8731, 8734, 8736,
+        8749, 8752, 8755, 8756, 8758, 8766, 8771, 8777, 8779, 8781, 8781, 8745, 8781, 8689, 8699, 8700,
+        8705, 8707, 8716, 8724, 8737, 8746, 8750, 8759, 8764, 8769, 8774, 8775, 8779, 8780, 8781, 8675,
+        8676, 8677, 8679, 8680, 8683, 8685, 8686, 8687, 8688, 8690, 8691, 8693, 8694, 8697, 8701, 8703,
+        8704, 8706, 8710, 8711, 8713, 8715, 8723, 8729, 8730, 8731, 8732, 8735, 8739, 8741, 8747, 8748,
+        8749, 8757, 8761, 8765, 8768, 8770, 8776, 8778, 8779, 8780, 8781, 8781, 8786, 8807, 8808, 8820,
+        8825, 8835, 8842, 8853, 8854, 8859, 8860, 8863, 8785, 8786, 8787, 8788, 8792, 8793, 8794, 8797,
+        8801, 8802, 8804, 8805, 8813, 8814, 8819, 8822, 8824, 8825, 8826, 8828, 8833, 8839, 8854, 8860,
+        8861, 8862, 8863, 8826, 8837, 8862, 8791, 8795, 8825, 8829, 8830, 8835, 8853, 8854, 8859, 8860,
+        8789, 8790, 8799, 8803, 8806, 8811, 8815, 8818, 8821, 8825, 8826, 8834, 8838, 8849, 8854, 8855,
+        8856, 8860, 8861, 8862, 8796, 8798, 8800, 8810, 8811, 8812, 8816, 8817, 8823, 8826, 8827, 8831,
+        8832, 8837, 8838, 8840, 8841, 8849, 8850, 8851, 8856, 8857, 8862, 8827, 8851, 8852, 8857, 8858,
+        8845, 8849, 8845, 8846, 8847, 8849, 8850, 8851, 8809, 8836, 8847, 8848, 8851, 8852, 8843, 8845,
+        8843, 8844, 8845, 8846, 8847, 8847, 8848, 9040, 9041, 9043, 9044, 9045, 9046, 9049, 9050, 9053,
+        9054, 9061, 9065, 9066, 9069, 9070, 9071, 9072, 9075, 9076, 9080, 9082, 9084, 9085, 9087, 9088,
+        9091, 9092, 9094, 9102, 9103, 9104, 9109, 9112, 9115, 9116, 9118, 9042, 9051, 9052, 9055, 9056,
+        9057, 9058, 9059, 9060, 9062, 9063, 9064, 9067, 9073, 9074, 9077, 9078, 9079, 9081, 9083, 9086,
+        9087, 9095, 9096, 9097, 9098, 9099, 9100, 9101, 9102, 9105, 9106, 9107, 9108, 9110, 9111, 9113,
+        9114, 9116, 9117, 9118, 9068, 9088, 9118, 9047, 9048, 9089, 9090, 9093, 9118, 9185, 9185, 9186,
+        9187, 9138, 9158, 9187, 9188, 9189, 9189, 9177, 9178, 9185, 9132, 9133, 9135, 9145, 9147, 9156,
+        9178, 9179, 9180, 9185, 9186, 9187, 9126, 9140, 9144, 9150, 9160, 9180, 9181, 9182, 9187, 9188,
+        9189, 9139, 9159, 9182, 9183, 9184, 9189, 9125, 9127, 9149, 9151, 9163, 9164, 9169, 9170, 9171,
+        9177, 9178, 9130, 9134, 9137, 9142, 9146, 9147, 9153, 9154, 9157, 9162, 9164, 9165, 9166, 9171,
+        9172, 9173, 9178, 9179, 9180, 9120, 9121, 9122, 9123, 9136, 9141, 9143, 9146, 9157, 9161, 9166,
+        9167, 9173, 9174, 9175, 9180, 9181, 9182, 9124, 9148, 9159, 9168, 9175, 9176, 9182, 9183, 9184,
+        9128, 9152, 9163, 9164, 9169, 9170, 9171, 9129, 9146, 9153, 9164, 9165, 9166, 9171, 9172, 9173,
+        9123, 9131, 9146, 9155, 9166, 9167, 9173, 9174, 9175, 9168, 9175, 9176, 9245, 9268, 9269, 9273,
+        9214, 9233, 9269, 9270, 9273, 9274, 9270, 9271, 9272, 9274, 9275, 9199, 9210, 9220, 9229, 9242,
+        9257, 9258, 9263, 9196, 9219, 9220, 9245, 9258, 9259, 9263, 9264, 9265, 9268, 9269, 9203, 9204,
+        9224, 9225, 9240, 9259, 9260, 9261, 9265, 9266, 9269, 9270, 9201, 9222, 9261, 9262, 9266, 9267,
+        9270, 9271, 9272, 9200, 9207, 9211, 9213, 9215, 9221, 9228, 9230, 9232, 9234, 9242, 9251, 9252,
+        9257, 9258, 9191, 9192, 9194, 9197, 9198, 9206, 9217, 9218, 9227, 9234, 9236, 9247, 9252, 9253,
+        9258, 9259, 9237, 9247, 9248, 9253, 9254, 9255, 9256, 9259, 9260, 9261, 9239, 9244, 9248, 9255,
+        9256, 9261, 9262, 9195, 9202, 9208, 9212, 9223, 9231, 9241, 9246, 9249, 9250, 9251, 9252, 9205,
+        9209, 9217, 9226, 9238, 9247, 9250, 9252, 9253, 9216, 9235, 9237, 9243, 9247, 9248, 9253, 9254,
+        9255, 9256, 9193, 9239, 9248, 9255, 9256, 9327, 9328, 9331, 9332, 9333, 9334, 9335, 9336, 9337,
+        9338, 9339, 9340, 9341, 9342, 9343, 9345, 9347, 9348, 9349, 9350, 9352, 9353, 9354, 9355, 9356,
+        9357, 9358, 9359, 9361, 9362, 9363, 9364, 9365, 9366, 9368, 9369, 9370, 9372, 9373, 9374, 9375,
+        9376, 9377, 9378, 9381, 9382, 9383, 9384, 9387, 9388, 9329, 9330, 9344, 9346, 9351, 9360, 9367,
+        9371, 9379, 9380, 9385, 9386, 9387, 9331, 9372, 9378, 9384, 9387, 9388, 9341, 9342, 9352, 9354,
+        9355, 9369, 9378, 9382, 9383, 9387, 9388, 9339, 9362, 9363, 9368, 9369, 9377, 9387, 9388, 9377,
+        9387, 9388, 9337, 9338, 9359, 9375, 9376, 9384, 9387, 9332, 9369, 9382, 9387, 9327, 9328, 9332,
+        9335, 9336, 9340, 9343, 9345, 9347, 9348, 9349, 9353, 9356, 9358, 9361, 9365, 9366, 9369, 9370,
+        9387, 9333, 9334, 9350, 9357, 9364, 9370, 9373, 9374, 9381, 9387, 9387, 9387, 9344, 9346, 9351,
+        9367, 9379, 9380, 9386, 9387, 9329, 9330, 9360, 9371, 9385, 9387, 9387, 9387, 9387, 9371, 9387,
+        9537, 9537, 9537, 9537, 9536, 9537, 9536, 9537, 9536, 9537, 9536, 9537, 9536, 9537, 9535, 9536,
+        9537, 9535, 9536, 9537, 9536, 9537, 9536, 9537, 9535, 9536, 9537, 9535, 9536, 9537, 9536, 9537,
+        9541, 9542, 9541, 9542, 9540, 9541, 9542, 9540, 9542, 9541, 9542, 9539, 9541, 9542, 9539, 9540,
+        9541, 9542, 9540, 9542, 9541, 9542, 9541, 9542, 9540, 9541, 9542, 9540, 9542, 9541, 9542, 9541,
+        9542, 9540, 9541, 9542, 9540, 9542, 9547, 9547, 9546, 9547, 9546, 9547, 9545, 9547, 9545, 9547,
+        9545, 9546, 9547, 9546, 9547, 9545, 9547, 9544, 9545, 9547, 9545, 9546, 9547, 9546, 9547, 9545,
+        9547, 9544, 9545, 9547, 9545, 9546, 9547, 9546, 9547, 9550, 9552, 9550, 9552, 9550, 9552, 9552,
+        9550, 9552, 9550, 9551, 9552, 9549, 9550, 9551, 9552, 9551, 9552, 9552, 9551, 9552, 9551, 9552,
+        9551, 9552, 9552, 9551, 9552, 9551, 9552, 9551, 9552, 9558, 9558, 9557, 9558, 9557, 9558, 9556,
+        9558, 9556, 9558, 9555, 9556, 9557, 9558, 9555, 9557, 9558, 9556, 9558, 9556, 9558, 9554, 9555,
+        9556, 9558, 9554, 9555, 9558, 9558, 9558, 9555, 9558, 9555, 9558, 9561, 9563, 9561, 9562, 9563,
+        9562, 9563, 9563, 9560, 9561, 9563, 9561, 9562, 9563, 9562, 9563, 9563, 9563, 9562, 9563, 9562,
+        9563, 9563, 9563, 9563, 9563, 9563, 9571, 9566, 9567, 9571, 9566, 9570, 9571, 9570, 9571, 9571,
+        9566, 9567, 9568, 9569, 9571, 9565, 9566, 9570, 9571, 9570, 9571, 9571, 9569, 9571, 9571, 9571,
+        9571, 9571, 9571, 9571, 9579, 9579, 9579, 9579, 9579, 9575, 9579, 9574, 9575, 9578, 9579, 9574,
+        9577, 9579, 9579, 9575, 9579, 9573, 9574, 9575, 9576, 9578, 9579, 9573, 9574, 9576, 9577, 9579,
+        9579, 9579, 9576, 9579, 9576, 9579, 9590, 9590, 9590, 9584, 9590, 9583, 9590, 9582, 9583, 9586,
+        9590, 9586, 9587, 9590, 9587, 9590, 9583, 9585, 9590, 9581, 9582, 9583, 9585, 9590, 9590, 9590,
+        9585, 9590, 9585, 9588, 9589, 9590, 9590, 9590, 9598, 9595, 9598, 9593, 9595, 9597, 9598, 9597,
+        9598, 9598, 9596, 9598, 9592, 9593, 9596, 9598, 9598, 9598, 9594, 9596, 9598, 9596, 9598, 9598,
+        9598, 9594, 9598, 9598, 9598, 9613, 9609, 9611, 9613, 9612, 9613, 9613, 9602, 9606, 9613, 9602,
+        9603, 9604, 9606, 9609, 9613, 9603, 9608, 9613, 9613, 9600, 9601, 9606, 9607, 9613, 9605, 9606,
+        9610, 9613, 9608, 9610, 9613, 9613, 9613, 9613, 9613, 9613, 9622, 9622, 9617, 9622, 9617, 9622,
+        9618, 9619, 9622, 9615, 9616, 9618, 9619, 9622, 9617, 9622, 9617, 9622, 9619, 9622, 9619, 9622,
+        9620, 9622, 9620, 9622, 9622, 9621, 9622, 9622, 9622, 9630, 9632, 9629, 9632, 9632, 9632, 9624,
+        9625, 9628, 9630, 9632, 9624, 9625, 9628, 9631, 9632, 9626, 9627, 9632, 9632, 9632, 9633, 9632,
+        9633, 9632, 9633, 9632, 9633, 9633, 9633, 9633, 9633, 9656, 9657, 9660, 9661, 9664, 9665, 9637,
+        9657, 9658, 9661, 9662, 9665, 9666, 9658, 9659, 9662, 9663, 9666, 9659, 9663, 9648, 9649, 9652,
+        9653, 9656, 9657, 9639, 9649, 9650, 9653, 9654, 9657, 9658, 9639, 9650, 9651, 9654, 9655, 9658,
+        9659, 9647, 9659, 9648, 9649, 9644, 9649, 9650, 9642, 9644, 9645, 9650, 9651, 9636, 9638, 9642,
+        9643, 9645, 9646, 9647, 9640, 9642, 9635, 9636, 9640, 9641, 9642, 9643, 9675, 9670, 9675, 9670,
+        9675, 9674, 9668, 9669, 9674, 9675, 9668, 9669, 9674, 9675, 9675, 9671, 9672, 9674, 9668, 9669,
+        9672, 9673, 9674, 9675, 9668, 9669, 9674, 9675, 9675, 9674, 9674, 9674, 9683, 9681, 9682, 9683,
+        9681, 9682, 9683, 9682, 9679, 9683, 9679, 9680, 9681, 9682, 9683, 9680, 9681, 9682, 9683, 9682,
+        9683, 9680, 9682, 9683, 9677, 9678, 9680, 9682, 9683, 9682, 9683, 9682, 9683, 9682, 9683, 9682,
+        9697, 9698, 9691, 9697, 9698, 9697, 9698, 9697, 9698, 9697, 9698, 9689, 9697, 9698, 9697, 9698,
+        9697, 9698, 9697, 9698, 9687, 9697, 9698, 9685, 9686, 9687, 9695, 9696, 9697, 9698, 9686, 9690,
+        9694, 9697, 9698, 9697, 9698, 9688, 9692, 9693, 9697, 9698, 9686, 9695, 9697, 9698, 9686, 9697,
+        9698, 9707, 9701, 9707, 9708, 9704, 9707, 9708, 9702, 9705, 9708, 9707, 9700, 9701, 9707, 9708,
+        9704, 9707, 9708, 9702, 9706, 9708, 9707, 9703, 9707, 9708, 9707, 9708, 9708, 9707, 9703, 9707,
+        9708, 9707, 9708, 9708, 9717, 9711, 9717, 9718, 9710, 9711, 9717, 9718, 9718, 9714, 9717, 9711,
+        9717, 9718, 9711, 9712, 9717, 9718, 9716, 9718, 9714, 9717, 9717, 9718, 9712, 9717, 9718, 9716,
+        9718, 9717, 9717, 9718, 9713, 9715, 9717, 9718, 9718, 9725, 9725, 9725, 9725, 9725, 9722, 9725,
+        9722, 9723, 9725, 9725, 9721, 9725, 9726, 9720, 9721, 9725, 9726, 9725, 9726, 9725, 9726, 9726,
+        9726, 9724, 9726, 9726, 9734, 9733, 9734, 9733, 9734, 9733, 9732, 9734, 9732, 9733, 9734, 9732,
+        9733, 9734, 9733, 9732, 9734, 9732, 9734, 9732, 9734, 9728, 9729, 9732, 9728, 9729, 9730, 9731,
+        9732, 9730, 9732, 9748, 9748, 9749, 9746, 9748, 9749, 9740, 9742, 9748, 9749, 9748, 9736, 9737,
+        9738, 9739, 9743, 9744, 9748, 9749, 9736, 9737, 9738, 9746, 9748, 9749, 9748, 9749, 9741, 9745,
+        9748, 9750, 9741, 9745, 9747, 9748, 9750, 9748, 9750, 9748, 9750, 9750, 9750, 9758, 9756, 9758,
+        9756, 9758, 9757, 9758, 9757, 9758, 9754, 9757, 9758, 9757, 9753, 9757, 9758, 9752, 9753, 9755,
+        9757, 9758, 9754, 9757, 9758, 9757, 9757, 9757, 9757, 9757, 9766, 9760, 9761, 9762, 9764, 9766,
+        9768, 9767, 9768, 9765, 9766, 9767, 9760, 9761, 9766, 9767, 9768, 9767, 9768, 9763, 9766, 9767,
+        9766, 9767, 9768, 9767, 9768, 9767, 9767, 9778, 9778, 9778, 9778, 9778, 9770, 9771, 9772, 9773,
+        9775, 9778, 9771, 9772, 9774, 9777, 9778, 9778, 9778, 9779, 9773, 9776, 9778, 9779, 9778, 9779,
+        9778, 9779, 9779, 9779, 9779, 9779, 9788, 9788, 9784, 9788, 9788, 9788, 9783, 9788, 9781, 9782,
+        9786, 9787, 9788, 9786, 9787, 9788, 9788, 9788, 9789, 9782, 9786, 9788, 9789, 9785, 9786, 9788,
+        9789, 9789, 9789, 9789, 9798, 9797, 9798, 9791, 9792, 9798, 9791, 9792, 9798, 9798, 9799, 9796,
+        9798, 9799, 9798, 9799, 9798, 9799, 9799, 9799, 9793, 9799, 9794, 9799, 9795, 9799, 9799, 9799,
+        9799, 9807, 9807, 9808, 9804, 9805, 9808, 9805, 9808, 9807, 9801, 9802, 9807, 9808, 9808, 9808,
+        9806, 9807, 9807, 9808, 9803, 9808, 9808, 9815, 9815, 9815, 9815, 9815, 9816, 9814, 9815, 9816,
+        9810, 9811, 9815, 9816, 9817, 9815, 9817, 9815, 9816, 9813, 9815, 9816, 9815, 9816, 9817, 9812,
+        9815, 9817, 9816, 9816, 9816, 9817, 9812, 9817, 9821, 9826, 9826, 9819, 9820, 9826, 9820, 9826,
+        9826, 9827, 9826, 9827, 9822, 9826, 9827, 9828, 9826, 9828, 9827, 9827, 9825, 9827, 9828, 9828,
+        9827, 9827, 9824, 9827, 9828, 9823, 9824, 9828, 9832, 9839, 9832, 9835, 9839, 9864, 9865, 9866,
+        9867, 9868, 9869, 9830, 9831, 9836, 9839, 9840, 9865, 9867, 9869, 9839, 9840, 9854, 9838, 9854,
+        9855, 9856, 9857, 9858, 9859, 9860, 9861, 9862, 9863, 9864, 9865, 9840, 9857, 9860, 9863, 9865,
+        9840, 9834, 9841, 9842, 9843, 9844, 9845, 9846, 9850, 9854, 9845, 9846, 9847, 9848, 9849, 9850,
+        9851, 9852, 9853, 9854, 9855, 9856, 9857, 9833, 9840, 9849, 9853, 9857, 9837, 9840, 9878, 9887,
+        9908, 9878, 9908, 9909, 9910, 9875, 9878, 9878, 9907, 9878, 9879, 9884, 9885, 9886, 9887, 9873,
+        9876, 9878, 9879, 9873, 9874, 9878, 9879, 9900, 9901, 9902, 9878, 9902, 9903, 9904, 9905, 9906,
+        9907, 9879, 9882, 9883, 9884, 9873, 9879, 9873, 9879, 9891, 9892, 9893, 9894, 9896, 9897, 9898,
+        9900, 9901, 9902, 9892, 9894, 9895, 9898, 9899, 9902, 9903, 9904, 9877, 9879, 9880, 9881, 9882,
+        9871, 9872, 9879, 9879, 9888, 9889, 9890, 9891, 9892, 9892, 9912, 9913, 9916, 9919, 9920, 9922,
+        9923, 9924, 9925, 9927, 9921, 9924, 9927, 9927, 9914, 9915, 9917, 9918, 9925, 9926, 9927, 9921,
+        9927, 9927, 9928, 9927, 9928, 9927, 9928, 9927, 9928, 9928, 9928, 9928, 9928, 10016, 9953, 9957,
+        9973, 9983, 9984, 9986, 10016, 10017, 10018, 10022, 10023, 9989, 10018, 10019, 10020, 10023, 10024, 10025,
+        10020, 10021, 10025, 9931, 9935, 9938, 9961, 9965, 9966, 9978, 9992, 10010, 10016, 9935, 9936, 9937,
+        9938, 9939, 9950, 9966, 9969, 9986, 9994, 10010, 10011, 10012, 10016, 10017, 10018, 9955, 9962, 9975,
+        10012, 10013, 10014, 10018, 10019, 10020, 10025, 10014, 10015, 10020, 10021, 10025, 9940, 9941, 9942, 9943,
+        9961, 9967, 9970, 9978, 9998, 9999, 10004, 10005, 10010, 9934, 9954, 9960, 9967, 9971, 9974, 9982,
+        9987, 9988, 9994, 9999, 10000, 10001, 10005, 10006, 10007, 10010, 10011, 10012, 9930, 9932, 9944, 9945,
+        9946, 9947, 9948, 9949, 9951, 9952, 9955, 9959, 9962, 9963, 9964, 9968, 9972, 9975, 9979, 9985,
+        9987, 9991, 10001, 10002, 10003, 10007, 10008, 10009, 10012, 10013, 10014, 10003, 10009, 10014, 9933, 9970,
+        9980, 9990, 9995, 9996, 9998, 9999, 9958, 9977, 9981, 9993, 9996, 9997, 9999, 10000, 10001, 9956,
+        9976, 9985, 9997, 10001, 10002, 10003, 10003, 10031, 10057, 10073, 10081, 10102, 10116, 10139, 10140, 10141,
+        10143, 10144, 10029, 10034, 10056, 10078, 10083, 10101, 10140, 10141, 10142, 10144, 10145, 10146, 10027, 10028,
+        10035, 10038, 10055, 10070, 10080, 10084, 10100, 10113, 10164, 10170, 10171, 10036, 10039, 10050, 10064, 10071,
+        10072, 10077, 10085, 10087, 10097, 10106, 10108, 10114, 10115, 10120, 10164, 10165, 10166, 10171, 10172, 10173,
+        10177, 10030, 10032, 10041, 10053, 10057, 10060, 10062, 10067, 10079, 10102, 10106, 10120, 10121, 10135, 10139,
+        10140, 10141, 10166, 10167, 10168, 10173, 10174, 10175, 10051, 10061, 10075, 10098, 10105, 10118, 10126, 10132,
+        10133, 10140, 10141, 10142, 10168, 10169, 10175, 10176, 10134, 10158, 10164, 10170, 10042, 10049, 10068, 10069,
+        10089, 10096, 10111, 10112, 10114, 10122, 10123, 10130, 10134, 10152, 10153, 10158, 10159, 10160, 10164, 10165,
+        10166, 10033, 10048, 10059, 10082, 10095, 10104, 10117, 10128, 10153, 10154, 10155, 10160, 10161, 10166, 10167,
+        10168, 10037, 10040, 10043, 10044, 10052, 10086, 10088, 10090, 10091, 10124, 10155, 10156, 10157, 10161, 10162,
+        10163, 10168, 10169, 10047, 10058, 10063, 10094, 10103, 10107, 10131, 10136, 10147, 10148, 10152, 10153, 10054,
+        10058, 10065, 10066, 10074, 10076, 10082, 10099, 10103, 10109, 10110, 10117, 10119, 10125, 10127, 10128, 10129,
+        10137, 10148, 10149, 10150, 10153, 10154, 10155, 10045, 10046, 10092, 10093, 10138, 10150, 10151, 10155, 10156,
+        10157, 10259, 10259, 10260, 10261, 10265, 10266, 10261, 10262, 10266, 10267, 10262, 10263, 10264, 10267, 10268,
+        10245, 10246, 10252, 10253, 10259, 10246, 10247, 10248, 10253, 10254, 10255, 10259, 10260, 10261, 10248, 10249,
+        10250, 10255, 10256, 10257, 10261, 10262, 10250, 10251, 10257, 10258, 10262, 10263, 10264, 10240, 10245, 10246,
+        10195, 10236, 10237, 10240, 10241, 10242, 10246, 10247, 10248, 10200, 10217, 10237, 10238, 10239, 10242, 10243,
+        10244, 10248, 10249, 10250, 10239, 10244, 10250, 10251, 10181, 10186, 10192, 10193, 10197, 10199, 10202, 10208,
+        10214, 10220, 10228, 10229, 10232, 10233, 10236, 10237, 10179, 10180, 10182, 10183, 10185, 10187, 10188, 10191,
+        10194, 10196, 10198, 10205, 10206, 10207, 10209, 10210, 10211, 10213, 10215, 10216, 10218, 10221, 10222, 10223,
+        10224, 10225, 10226, 10227, 10229, 10230, 10231, 10233, 10234, 10235, 10237, 10238, 10239, 10184, 10189, 10190,
+        10201, 10203, 10204, 10207, 10212, 10219, 10231, 10235, 10239, 10285, 10299, 10332, 10333, 10334, 10335, 10333,
+        10343, 10344, 10345, 10349, 10270, 10271, 10273, 10274, 10288, 10297, 10302, 10303, 10345, 10346, 10347, 10349,
+        10350, 10303, 10347, 10348, 10286, 10319, 10320, 10321, 10329, 10330, 10331, 10332, 10333, 10276, 10295, 10321,
+        10322, 10323, 10324, 10331, 10333, 10336, 10337, 10343, 10344, 10345, 10290, 10293, 10294, 10303, 10324, 10325,
+        10326, 10337, 10338, 10339, 10340, 10345, 10346, 10347, 10292, 10303, 10318, 10326, 10327, 10328, 10340, 10341,
+        10342, 10347, 10348, 10283, 10309, 10310, 10311, 10319, 10320, 10321, 10280, 10301, 10311, 10312, 10313, 10321,
+        10322, 10323, 10324, 10272, 10275, 10284, 10287, 10301, 10313, 10314, 10315, 10316, 10324, 10325, 10326, 10278,
+        10279, 10296, 10316, 10317, 10318, 10326, 10327, 10328, 10309, 10310, 10311, 10281, 10289, 10304, 10305, 10306,
+        10311, 10312, 10313, 10277, 10282, 10287, 10291, 10298, 10300, 10304, 10306, 10307, 10308, 10313, 10314, 10315,
+        10316, 10308, 10316, 10317, 10393, 10471, 10500, 10539, 10540, 10541, 10542, 10543, 10545, 10442, 10500, 10540,
+        10542, 10543, 10544, 10545, 10544, 10384, 10418, 10465, 10486, 10529, 10534, 10535, 10537, 10539, 10540, 10369,
+        10378, 10385, 10398, 10407, 10437, 10453, 10460, 10466, 10480, 10529, 10530, 10531, 10535, 10536, 10537, 10538,
+        10540, 10371, 10397, 10402, 10416, 10454, 10474, 10477, 10490, 10531, 10532, 10536, 10474, 10532, 10533, 10360,
+        10409, 10445, 10450, 10515, 10520, 10524, 10529, 10354, 10355, 10356, 10357, 10366, 10377, 10380, 10383, 10386,
+        10388, 10389, 10413, 10419, 10421, 10424, 10430, 10444, 10445, 10450, 10459, 10461, 10464, 10467, 10469, 10488,
+        10489, 10515, 10516, 10517, 10520, 10521, 10522, 10524, 10525, 10526, 10529, 10530, 10531, 10353, 10358, 10359,
+        10365, 10373, 10379, 10387, 10390, 10391, 10392, 10395, 10399, 10400, 10403, 10405, 10406, 10410, 10414, 10422,
+        10423, 10425, 10426, 10428, 10432, 10433, 10434, 10435, 10439, 10440, 10441, 10443, 10449, 10468, 10470, 10473,
+        10474, 10475, 10478, 10479, 10482, 10488, 10490, 10493, 10494, 10497, 10498, 10499, 10517, 10518, 10519, 10522,
+        10523, 10526, 10527, 10528, 10531, 10532, 10352, 10353, 10361, 10363, 10381, 10396, 10404, 10412, 10438, 10443,
+        10447, 10462, 10474, 10483, 10496, 10518, 10519, 10523, 10527, 10528, 10532, 10533, 10501, 10505, 10509, 10515,
+        10362, 10364, 10368, 10374, 10376, 10382, 10408, 10417, 10427, 10431, 10446, 10448, 10452, 10456, 10458, 10463,
+        10481, 10485, 10491, 10501, 10502, 10505, 10506, 10509, 10510, 10511, 10515, 10516, 10517, 10367, 10370, 10394,
+        10401, 10411, 10429, 10451, 10472, 10476, 10485, 10492, 10502, 10503, 10504, 10506, 10507, 10508, 10511, 10512,
+        10517, 10518, 10519, 10372, 10375, 10415, 10420, 10436, 10451, 10455, 10457, 10484, 10487, 10492, 10495, 10504,
+        10508, 10512, 10513, 10514, 10518, 10519, 10547, 10547, 10548, 10551, 10551, 10551, 10551, 10551, 10551, 10551,
+        10551, 10551, 10551, 10551, 10551, 10550, 10551, 10550, 10551, 10551, 10551, 10554, 10554, 10554, 10554, 10553,
+        10554, 10553, 10554, 10553, 10554, 10554, 10553, 10554, 10553, 10554, 10553, 10554, 10554, 10554, 10554, 10554,
+        10554, 10560, 10560, 10560, 10561, 10561, 10560, 10560, 10560, 10557, 10558, 10559, 10556, 10557, 10558, 10559,
+        10562, 10559, 10564, 10559, 10559, 10559, 10563, 10566, 10566, 10569, 10569, 10569, 10569, 10568, 10569, 10567,
+        10568, 10569, 10569, 10569, 10569, 10569, 10569, 10569, 10572, 10572, 10572, 10572, 10572, 10572, 10571, 10572,
+        10571, 10572, 10572, 10572, 10571, 10572, 10571, 10572, 10572, 10572, 10572, 10572, 10578, 10581, 10584, 10578,
+        10584, 10575, 10584, 10575, 10584, 10577, 10578, 10580, 10581, 10584, 10576, 10577, 10578, 10584, 10574, 10575,
+        10576, 10584, 10575, 10579, 10582, 10584, 10580, 10584, 10576, 10584, 10574, 10575, 10576, 10583, 10584, 10575,
+        10584, 10584, 10584, 10583, 10584, 10584, 10587, 10597, 10587, 10597, 10596, 10597, 10597, 10586, 10587, 10597,
+        10587, 10590, 10597, 10590, 10592, 10593, 10596, 10597, 10597, 10597, 10590, 10597, 10588, 10589, 10590, 10591,
+        10597, 10591, 10597, 10597, 10597, 10588, 10597, 10594, 10595, 10597, 10608, 10606, 10607, 10608, 10607, 10608,
+        10608, 10608, 10600, 10604, 10606, 10607, 10608, 10599, 10600, 10604, 10605, 10607, 10608, 10608, 10608, 10600,
+        10603, 10608, 10599, 10600, 10601, 10602, 10608, 10601, 10608, 10608, 10608, 10602, 10608, 10608, 10623, 10624,
+        10612, 10622, 10623, 10624, 10612, 10622, 10624, 10624, 10611, 10624, 10611, 10612, 10624, 10612, 10624, 10624,
+        10610, 10611, 10624, 10611, 10621, 10624, 10613, 10618, 10619, 10620, 10624, 10613, 10617, 10618, 10624, 10624,
+        10624, 10614, 10618, 10620, 10624, 10614, 10615, 10616, 10618, 10624, 10633, 10633, 10628, 10633, 10633, 10633,
+        10631, 10632, 10633, 10631, 10632, 10633, 10633, 10627, 10633, 10626, 10627, 10632, 10633, 10627, 10629, 10632,
+        10633, 10629, 10633, 10627, 10633, 10627, 10630, 10633, 10627, 10633, 10633, 10638, 10639, 10636, 10638, 10639,
+        10635, 10636, 10639, 10636, 10639, 10638, 10639, 10636, 10638, 10639, 10635, 10636, 10637, 10639, 10636, 10637,
+        10639, 10639, 10639, 10637, 10639, 10637, 10639, 10639, 10639, 10637, 10639, 10637, 10639, 10652, 10665, 10672,
+        10646, 10664, 10672, 10673, 10661, 10664, 10672, 10645, 10672, 10656, 10667, 10670, 10672, 10646, 10650, 10660,
+        10663, 10670, 10672, 10641, 10642, 10653, 10657, 10661, 10662, 10669, 10672, 10645, 10649, 10654, 10659, 10669,
+        10672, 10672, 10643, 10658, 10668, 10672, 10642, 10644, 10648, 10655, 10658, 10672, 10672, 10672, 10651, 10666,
+        10671, 10672, 10647, 10666, 10671, 10672, 10672, 10701, 10695, 10697, 10701, 10675, 10676, 10701, 10700, 10684,
+        10685, 10696, 10700, 10701, 10682, 10683, 10689, 10692, 10701, 10675, 10676, 10678, 10687, 10691, 10701, 10690,
+        10700, 10698, 10700, 10701, 10692, 10693, 10694, 10701, 10677, 10678, 10681, 10686, 10693, 10701, 10701, 10679,
+        10688, 10699, 10701, 10679, 10680, 10681, 10688, 10699, 10701, 10715, 10716, 10719, 10703, 10704, 10716, 10719,
+        10708, 10709, 10719, 10720, 10720, 10707, 10716, 10719, 10714, 10716, 10718, 10719, 10705, 10719, 10720, 10710,
+        10720, 10719, 10714, 10719, 10705, 10706, 10711, 10713, 10717, 10719, 10720, 10720, 10719, 10719, 10712, 10719,
+        10720, 10712, 10720, 10724, 10737, 10774, 10775, 10777, 10778, 10780, 10781, 10724, 10775, 10776, 10778, 10779,
+        10781, 10735, 10764, 10765, 10766, 10723, 10766, 10767, 10768, 10769, 10774, 10775, 10732, 10738, 10739, 10769,
+        10770, 10771, 10772, 10775, 10776, 10734, 10735, 10740, 10741, 10742, 10743, 10744, 10745, 10761, 10762, 10763,
+        10764, 10765, 10766, 10722, 10723, 10725, 10728, 10745, 10746, 10747, 10748, 10758, 10759, 10760, 10761, 10766,
+        10767, 10768, 10769, 10725, 10727, 10732, 10733, 10748, 10749, 10750, 10751, 10755, 10756, 10757, 10758, 10769,
+        10770, 10771, 10772, 10788, 10790, 10731, 10788, 10789, 10790, 10743, 10744, 10745, 10745, 10746, 10747, 10748,
+        10736, 10748, 10749, 10750, 10751, 10752, 10753, 10754, 10773, 10782, 10785, 10788, 10790, 10726, 10729, 10730,
+        10731, 10782, 10783, 10784, 10785, 10786, 10787, 10788, 10789, 10790, 10809, 10810, 10819, 10858, 10859, 10860,
+        10868, 10869, 10870, 10876, 10877, 10878, 10795, 10812, 10860, 10861, 10862, 10863, 10870, 10871, 10872, 10873,
+        10878, 10879, 10880, 10881, 10822, 10863, 10864, 10865, 10873, 10874, 10875, 10881, 10882, 10883, 10865, 10866,
+        10867, 10875, 10883, 10814, 10829, 10848, 10849, 10858, 10859, 10860, 10792, 10793, 10794, 10800, 10801, 10803,
+        10804, 10818, 10824, 10849, 10850, 10851, 10852, 10860, 10861, 10862, 10863, 10796, 10802, 10806, 10808, 10817,
+        10821, 10824, 10826, 10852, 10853, 10854, 10863, 10864, 10865, 10796, 10798, 10805, 10854, 10855, 10856, 10857,
+        10865, 10866, 10867, 10820, 10827, 10832, 10833, 10839, 10840, 10848, 10849, 10797, 10811, 10816, 10824, 10833,
+        10834, 10835, 10840, 10841, 10842, 10843, 10849, 10850, 10851, 10852, 10799, 10808, 10823, 10824, 10828, 10835,
+        10836, 10837, 10838, 10843, 10844, 10845, 10852, 10853, 10854, 10815, 10825, 10838, 10845, 10846, 10847, 10854,
+        10855, 10856, 10857, 10807, 10813, 10830, 10831, 10832, 10833, 10831, 10833, 10834, 10835, 10835, 10836, 10837,
+        10838, 10838, 10891, 10894, 10895, 10898, 10889, 10890, 10898, 10898, 10887, 10888, 10892, 10896, 10894, 10896,
+        10898, 10893, 10896, 10898, 10893, 10896, 10897, 10898, 10885, 10886, 10892, 10896, 10896, 10896, 10896, 10897,
+        10896, 10896, 10896, 10896, 10902, 10902, 10902, 10902, 10902, 10902, 10900, 10901, 10900, 10901, 10902, 10901,
+        10902, 10901, 10902, 10901, 10901, 10901, 10901, 10932, 10908, 10932, 10933, 10935, 10937, 10904, 10905, 10933,
+        10934, 10935, 10936, 10937, 10938, 10909, 10923, 10924, 10926, 10929, 10932, 10906, 10909, 10910, 10913, 10924,
+        10925, 10926, 10927, 10929, 10930, 10932, 10933, 10925, 10927, 10928, 10930, 10931, 10933, 10934, 10917, 10907,
+        10909, 10917, 10918, 10919, 10920, 10921, 10923, 10924, 10909, 10911, 10919, 10921, 10922, 10924, 10925, 10911,
+        10922, 10925, 10912, 10914, 10915, 10916, 10917, 10916, 10917, 10918, 10919, 10919, 11015, 11022, 11023, 10945,
+        10948, 10950, 11015, 11016, 11017, 11020, 11021, 11022, 11023, 11024, 11025, 11017, 11018, 11019, 11001, 11002,
+        11003, 11004, 11014, 11015, 10942, 10951, 10954, 10999, 11000, 11001, 11004, 11005, 11006, 11012, 11013, 11014,
+        11015, 11016, 11017, 10943, 10949, 10953, 10996, 10997, 10998, 10999, 11006, 11007, 11008, 11009, 11010, 11011,
+        11012, 11017, 11018, 11019, 10996, 11009, 10946, 10956, 10957, 10958, 10959, 10985, 10986, 10987, 10988, 10989,
+        10990, 11001, 11002, 10944, 10946, 10955, 10962, 10977, 10978, 10979, 10983, 10984, 10985, 10990, 10991, 10992,
+        10999, 11000, 11001, 10943, 10949, 10963, 10975, 10976, 10977, 10980, 10981, 10982, 10983, 10992, 10993, 10994,
+        10995, 10996, 10997, 10998, 10999, 10947, 10960, 10974, 10975, 10980, 10995, 10996, 10968, 10969, 10970, 10977,
+        10978, 10979, 10952, 10964, 10966, 10967, 10970, 10971, 10972, 10975, 10976, 10977, 10940, 10941, 10961, 10965,
+        10966, 10972, 10973, 10974, 10975, 11027, 11028, 11031, 11036, 11028, 11031, 11036, 11034, 11027, 11028, 11030,
+        11032, 11034, 11036, 11028, 11034, 11035, 11036, 11035, 11029, 11033, 11034, 11029, 11030, 11034, 11034, 11035,
+        11035, 11033, 11034, 11034, 11034, 11035, 11035, 11047, 11049, 11053, 11040, 11043, 11044, 11050, 11051, 11053,
+        11053, 11054, 11054, 11042, 11048, 11053, 11038, 11039, 11041, 11053, 11053, 11054, 11054, 11045, 11052, 11053,
+        11046, 11052, 11053, 11052, 11053, 11054, 11054, 11045, 11052, 11052, 11052, 11071, 11062, 11071, 11071, 11066,
+        11070, 11071, 11064, 11070, 11071, 11070, 11071, 11070, 11057, 11060, 11069, 11070, 11056, 11057, 11059, 11067,
+        11068, 11069, 11070, 11058, 11061, 11069, 11070, 11061, 11069, 11070, 11069, 11065, 11069, 11063, 11065, 11069,
+        11069, 11124, 11125, 11130, 11131, 11090, 11125, 11126, 11127, 11131, 11132, 11133, 11076, 11086, 11090, 11127,
+        11128, 11129, 11133, 11134, 11135, 11129, 11135, 11112, 11113, 11119, 11124, 11125, 11073, 11075, 11080, 11081,
+        11089, 11113, 11114, 11115, 11116, 11119, 11120, 11121, 11122, 11125, 11126, 11127, 11074, 11076, 11116, 11117,
+        11122, 11123, 11127, 11128, 11129, 11129, 11082, 11094, 11095, 11096, 11103, 11104, 11105, 11112, 11113, 11078,
+        11080, 11081, 11085, 11096, 11097, 11098, 11105, 11106, 11107, 11113, 11114, 11115, 11116, 11074, 11077, 11079,
+        11083, 11087, 11098, 11099, 11100, 11107, 11108, 11109, 11116, 11117, 11118, 11083, 11088, 11100, 11101, 11102,
+        11109, 11110, 11111, 11118, 11094, 11095, 11096, 11085, 11096, 11097, 11098, 11077, 11098, 11099, 11100, 11084,
+        11091, 11092, 11093, 11100, 11101, 11102, 11143, 11159, 11166, 11157, 11160, 11166, 11138, 11140, 11156, 11166,
+        11137, 11138, 11153, 11155, 11164, 11166, 11159, 11166, 11167, 11144, 11147, 11152, 11160, 11161, 11166, 11167,
+        11148, 11154, 11166, 11167, 11164, 11166, 11167, 11139, 11142, 11165, 11167, 11139, 11158, 11163, 11165, 11167,
+        11145, 11149, 11151, 11162, 11165, 11167, 11165, 11167, 11165, 11146, 11165, 11141, 11150, 11165, 11150, 11165,
+        11175, 11203, 11196, 11200, 11203, 11200, 11171, 11180, 11203, 11205, 11172, 11174, 11176, 11182, 11185, 11190,
+        11194, 11200, 11201, 11203, 11187, 11191, 11192, 11200, 11201, 11207, 11173, 11198, 11202, 11208, 11169, 11170,
+        11179, 11183, 11188, 11189, 11195, 11197, 11201, 11208, 11177, 11178, 11186, 11193, 11199, 11201, 11204, 11207,
+        11181, 11206, 11181, 11184, 11201, 11206, 11201, 11228, 11228, 11228, 11227, 11228, 11222, 11223, 11227, 11228,
+        11211, 11212, 11214, 11226, 11227, 11228, 11226, 11227, 11218, 11221, 11227, 11210, 11211, 11225, 11226, 11227,
+        11220, 11224, 11226, 11227, 11215, 11219, 11221, 11227, 11213, 11226, 11227, 11216, 11217, 11226, 11320, 11249,
+        11320, 11321, 11322, 11323, 11333, 11232, 11239, 11248, 11251, 11265, 11323, 11324, 11325, 11328, 11331, 11333,
+        11232, 11239, 11248, 11251, 11325, 11326, 11327, 11328, 11329, 11330, 11331, 11244, 11289, 11300, 11310, 11320,
+        11332, 11234, 11237, 11256, 11257, 11259, 11261, 11266, 11270, 11289, 11290, 11291, 11292, 11293, 11300, 11301,
+        11302, 11303, 11304, 11310, 11311, 11312, 11313, 11314, 11320, 11321, 11322, 11323, 11232, 11235, 11253, 11264,
+        11266, 11293, 11294, 11295, 11296, 11304, 11305, 11306, 11307, 11314, 11315, 11316, 11317, 11323, 11324, 11325,
+        11232, 11233, 11247, 11258, 11296, 11297, 11298, 11299, 11307, 11308, 11309, 11317, 11318, 11319, 11325, 11326,
+        11327, 11250, 11271, 11289, 11332, 11236, 11238, 11245, 11250, 11269, 11271, 11289, 11290, 11291, 11292, 11293,
+        11230, 11231, 11240, 11241, 11242, 11243, 11246, 11268, 11271, 11278, 11279, 11280, 11283, 11284, 11285, 11293,
+        11294, 11295, 11296, 11233, 11243, 11252, 11262, 11263, 11280, 11281, 11282, 11285, 11286, 11287, 11288, 11296,
+        11297, 11298, 11299, 11271, 11271, 11242, 11254, 11255, 11260, 11267, 11271, 11272, 11273, 11274, 11275, 11276,
+        11277, 11278, 11279, 11280, 11274, 11277, 11280, 11281, 11282, 11392, 11393, 11399, 11405, 11345, 11346, 11393,
+        11394, 11395, 11399, 11400, 11401, 11405, 11406, 11407, 11410, 11411, 11335, 11336, 11342, 11351, 11355, 11361,
+        11395, 11396, 11397, 11398, 11401, 11402, 11403, 11404, 11407, 11408, 11409, 11411, 11412, 11413, 11355, 11398,
+        11404, 11409, 11413, 11343, 11382, 11386, 11387, 11392, 11393, 11337, 11338, 11341, 11352, 11353, 11354, 11380,
+        11382, 11383, 11384, 11387, 11388, 11389, 11393, 11394, 11395, 11336, 11340, 11347, 11349, 11356, 11358, 11359,
+        11362, 11380, 11381, 11384, 11385, 11389, 11390, 11391, 11395, 11396, 11397, 11398, 11359, 11398, 11371, 11375,
+        11378, 11380, 11344, 11348, 11350, 11371, 11372, 11373, 11375, 11376, 11377, 11378, 11379, 11380, 11381, 11373,
+        11374, 11377, 11371, 11339, 11357, 11360, 11363, 11364, 11367, 11368, 11371, 11372, 11373, 11364, 11365, 11366,
+        11368, 11369, 11370, 11373, 11374, 11427, 11442, 11457, 11459, 11464, 11427, 11428, 11443, 11450, 11458, 11459,
+        11464, 11435, 11444, 11446, 11458, 11458, 11415, 11416, 11420, 11421, 11425, 11438, 11445, 11447, 11449, 11452,
+        11454, 11459, 11417, 11433, 11440, 11441, 11451, 11455, 11458, 11459, 11477, 11418, 11424, 11426, 11439, 11458,
+        11453, 11458, 11434, 11437, 11466, 11473, 11476, 11431, 11432, 11458, 11466, 11467, 11468, 11469, 11470, 11472,
+        11477, 11436, 11456, 11458, 11461, 11470, 11471, 11474, 11422, 11423, 11458, 11461, 11462, 11463, 11476, 11419,
+        11429, 11432, 11448, 11460, 11472, 11475, 11430, 11448, 11465, 11475, 11525, 11530, 11490, 11509, 11525, 11530,
+        11520, 11524, 11525, 11526, 11484, 11485, 11486, 11501, 11505, 11507, 11518, 11524, 11526, 11530, 11479, 11480,
+        11530, 11504, 11514, 11522, 11526, 11527, 11504, 11526, 11528, 11495, 11528, 11487, 11488, 11498, 11499, 11527,
+        11529, 11528, 11519, 11528, 11531, 11565, 11567, 11571, 11579, 11543, 11550, 11564, 11579, 11583, 11585, 11544,
+        11551, 11557, 11560, 11562, 11569, 11571, 11575, 11579, 11543, 11546, 11556, 11561, 11574, 11578, 11579, 11580,
+        11583, 11559, 11580, 11533, 11534, 11563, 11588, 11538, 11539, 11540, 11541, 11542, 11558, 11561, 11568, 11574,
+        11576, 11580, 11582, 11545, 11547, 11548, 11555, 11566, 11572, 11577, 11580, 11535, 11536, 11537, 11581, 11587,
+        11589, 11549, 11573, 11584, 11590, 11552, 11553, 11582, 11586, 11590, 11554, 11570, 11587, 11589, 11612, 11613,
+        11622, 11635, 11613, 11635, 11594, 11595, 11596, 11597, 11606, 11627, 11631, 11608, 11617, 11628, 11630, 11631,
+        11630, 11592, 11593, 11602, 11603, 11604, 11605, 11610, 11631, 11607, 11619, 11623, 11625, 11630, 11631, 11611,
+        11621, 11629, 11630, 11641, 11644, 11620, 11641, 11642, 11614, 11636, 11645, 11615, 11618, 11624, 11636, 11637,
+        11638, 11639, 11609, 11616, 11632, 11634, 11639, 11640, 11644, 11646, 11598, 11599, 11600, 11601, 11626, 11632,
+        11633, 11643, 11669, 11697, 11705, 11690, 11693, 11702, 11660, 11661, 11662, 11678, 11693, 11658, 11659, 11693,
+        11706, 11654, 11655, 11668, 11669, 11694, 11697, 11650, 11651, 11677, 11682, 11684, 11690, 11693, 11694, 11701,
+        11702, 11648, 11650, 11660, 11662, 11683, 11687, 11688, 11693, 11667, 11674, 11693, 11696, 11700, 11706, 11649,
+        11652, 11653, 11654, 11655, 11665, 11668, 11671, 11676, 11679, 11680, 11692, 11694, 11663, 11672, 11673, 11675,
+        11686, 11689, 11691, 11693, 11694, 11703, 11685, 11693, 11703, 11704, 11693, 11649, 11656, 11657, 11664, 11666,
+        11670, 11681, 11694, 11695, 11698, 11699, 11673, 11694, 11712, 11713, 11708, 11709, 11710, 11711, 11755, 11723,
+        11724, 11729, 11752, 11755, 11752, 11755, 11755, 11755, 11728, 11729, 11736, 11743, 11750, 11752, 11755, 11715,
+        11716, 11717, 11718, 11719, 11720, 11721, 11722, 11725, 11735, 11738, 11739, 11745, 11749, 11750, 11752, 11755,
+        11755, 11737, 11755, 11732, 11752, 11753, 11755, 11727, 11731, 11733, 11734, 11739, 11740, 11745, 11746, 11747,
+        11748, 11752, 11753, 11755, 11755, 11755, 11753, 11754, 11755, 11726, 11730, 11734, 11741, 11742, 11744, 11751,
+        11753, 11754, 11755, 11755, 11759, 11759, 11759, 11759, 11759, 11759, 11758, 11759, 11758, 11759, 11757, 11758,
+        11759, 11758, 11758, 11758, 11757, 11758, 11758, 11762, 11761, 11762, 11761, 11762, 11761, 11762, 11762, 11761,
+        11762, 11761, 11762, 11761, 11762, 11762, 11761, 11762, 11761, 11762, 11761, 11762, 11762, 11761, 11762, 11761,
+        11762, 11761, 11762, 11772, 11771, 11772, 11767, 11771, 11772, 11772, 11772, 11772, 11772, 11772, 11770, 11772,
+        11768, 11770, 11772, 11770, 11772, 11772, 11764, 11765, 11766, 11769, 11770, 11772, 11768, 11769, 11770, 11772,
+        11770, 11772, 11772, 11787, 11787, 11785, 11787, 11777, 11781, 11784, 11785, 11787, 11787, 11786, 11787, 11776,
+        11779, 11780, 11782, 11785, 11786, 11787, 11774, 11775, 11778, 11780, 11783, 11785, 11787, 11787, 11787, 11787,
+        11787, 11787, 11787, 11787, 11787, 11798, 11795, 11798, 11795, 11798, 11795, 11798, 11798, 11795, 11798, 11789,
+        11790, 11791, 11795, 11798, 11795, 11798, 11797, 11798, 11795, 11796, 11797, 11798, 11792, 11793, 11794, 11795,
+        11796, 11798, 11795, 11796, 11798, 11797, 11798, 11796, 11797, 11798, 11796, 11798, 11796, 11798, 11811, 11825,
+        11826, 11833, 11835, 11836, 11801, 11802, 11803, 11806, 11807, 11812, 11823, 11825, 11827, 11830, 11833, 11836,
+        11814, 11816, 11817, 11818, 11833, 11834, 11836, 11834, 11836, 11820, 11829, 11833, 11835, 11836, 11800, 11801,
+        11804, 11805, 11810, 11813, 11819, 11822, 11832, 11833, 11836, 11824, 11833, 11834, 11836, 11834, 11836, 11828,
+        11833, 11835, 11836, 11809, 11821, 11828, 11831, 11833, 11836, 11815, 11833, 11834, 11836, 11834, 11836, 11808,
+        11828, 11835, 11836, 11828, 11836, 11836, 11836, 11838, 11839, 11840, 11841, 11842, 11845, 11849, 11852, 11854,
+        11855, 11856, 11877, 11878, 11880, 11885, 11846, 11856, 11857, 11858, 11878, 11879, 11880, 11881, 11882, 11885,
+        11886, 11887, 11895, 11843, 11851, 11858, 11879, 11882, 11883, 11887, 11888, 11895, 11896, 11883, 11884, 11888,
+        11896, 11897, 11844, 11853, 11871, 11872, 11874, 11875, 11877, 11878, 11872, 11873, 11875, 11876, 11878, 11879,
+        11889, 11892, 11895, 11873, 11876, 11879, 11889, 11890, 11892, 11893, 11895, 11896, 11890, 11891, 11893, 11894,
+        11896, 11897, 11865, 11866, 11871, 11872, 11847, 11850, 11862, 11866, 11867, 11872, 11873, 11889, 11899, 11862,
+        11863, 11867, 11868, 11869, 11873, 11889, 11890, 11863, 11864, 11869, 11870, 11890, 11891, 11862, 11899, 11848,
+        11859, 11860, 11862, 11863, 11898, 11860, 11861, 11863, 11864, 11944, 11944, 11901, 11902, 11903, 11904, 11905,
+        11906, 11907, 11908, 11909, 11910, 11911, 11916, 11919, 11920, 11922, 11924, 11925, 11926, 11927, 11929, 11935,
+        11936, 11941, 11942, 11944, 11944, 11921, 11944, 11912, 11913, 11930, 11931, 11933, 11934, 11938, 11943, 11944,
+        11917, 11918, 11923, 11928, 11939, 11942, 11943, 11944, 11944, 11944, 11945, 11914, 11915, 11932, 11937, 11940,
+        11943, 11944, 11945, 11943, 11944, 11944, 11945, 11945, 11948, 11950, 11948, 11949, 11950, 11949, 11950, 11949,
+        11950, 11948, 11950, 11947, 11948, 11949, 11950, 11949, 11950, 11949, 11950, 11948, 11950, 11947, 11948, 11949,
+        11950, 11949, 11950, 11949, 11950, 11948, 11950, 11948, 11949, 11950, 11949, 11950, 11949, 11950, 11957, 11955,
+        11956, 11957, 11953, 11955, 11957, 11957, 11957, 11954, 11956, 11957, 11952, 11953, 11954, 11957, 11957, 11957,
+        11954, 11957, 11954, 11957, 11957, 11957, 11957, 11957, 11957, 11962, 11962, 11962, 11962, 11962, 11961, 11962,
+        11960, 11961, 11962, 11959, 11960, 11962, 11962, 11961, 11962, 11960, 11961, 11962, 11959, 11960, 11962, 11962,
+        11962, 11962, 11962, 11976, 11980, 11964, 11965, 11966, 11968, 11969, 11980, 11968, 11970, 11978, 11980, 11981,
+        11980, 11981, 11973, 11979, 11980, 11966, 11967, 11968, 11972, 11977, 11980, 11968, 11974, 11977, 11980, 11981,
+        11975, 11980, 11981, 11980, 11980, 11980, 11981, 11971, 11980, 11981, 11981, 11981, 11991, 11986, 11991, 11984,
+        11985, 11991, 11984, 11991, 11991, 11991, 11983, 11984, 11990, 11991, 11984, 11991, 11991, 11991, 11988, 11991,
+        11987, 11989, 11991, 11991, 11991, 11991, 11989, 11991, 11997, 11998, 11996, 11997, 11998, 11997, 11998, 11997,
+        11998, 11997, 11998, 11996, 11997, 11998, 11997, 11998, 11994, 11997, 11998, 11997, 11998, 11997, 11998, 11997,
+        11998, 11993, 11994, 11997, 11998, 11997, 11998, 11995, 11997, 11998, 11997, 11998, 11997, 11998, 12005, 12006,
+        12005, 12006, 12005, 12006, 12005, 12005, 12006, 12003, 12005, 12006, 12002, 12005, 12006, 12000, 12001, 12002,
+        12005, 12004, 12005, 12006, 12003, 12005, 12006, 12002, 12005, 12006, 12000, 12001, 12002, 12005, 12005, 12006,
+        12005, 12006, 12005, 12006, 12005, 12019, 12013, 12019, 12020, 12020, 12012, 12019, 12020, 12009, 12019, 12015,
+        12020, 12020, 12019, 12020, 12008, 12009, 12011, 12014, 12017, 12018, 12019, 12020, 12020, 12019, 12020, 12010,
+        12014, 12016, 12019, 12025, 12036, 12035, 12036, 12026, 12035, 12026, 12035, 12036, 12035, 12036, 12026, 12031,
+        12035, 12024, 12026, 12033, 12035, 12036, 12032, 12035, 12036, 12035, 12022, 12023, 12024, 12027, 12028, 12029,
+        12030, 12033, 12035, 12036, 12035, 12036, 12035, 12023, 12029, 12034, 12035, 12043, 12040, 12041, 12043, 12039,
+        12040, 12041, 12038, 12039, 12041, 12043, 12041, 12042, 12043, 12039, 12041, 12042, 12039, 12041, 12042, 12043,
+        12042, 12043, 12042, 12042, 12042, 12042, 12042, 12051, 12047, 12051, 12047, 12051, 12051, 12050, 12051, 12050,
+        12051, 12049, 12050, 12051, 12049, 12051, 12050, 12050, 12046, 12049, 12050, 12046, 12049, 12048, 12050, 12048,
+        12050, 12045, 12046, 12049, 12050, 12046, 12049, 12060, 12058, 12060, 12057, 12058, 12060, 12054, 12057, 12060,
+        12059, 12060, 12058, 12059, 12060, 12056, 12057, 12058, 12060, 12053, 12054, 12057, 12060, 12059, 12060, 12058,
+        12059, 12060, 12056, 12057, 12058, 12060, 12057, 12060, 12055, 12059, 12060, 12058, 12059, 12060, 12058, 12060,
+        12060, 12079, 12080, 12079, 12078, 12079, 12063, 12078, 12067, 12068, 12072, 12079, 12080, 12081, 12082, 12083,
+        12069, 12079, 12066, 12078, 12079, 12062, 12063, 12070, 12075, 12078, 12076, 12079, 12083, 12084, 12085, 12086,
+        12087, 12071, 12077, 12079, 12087, 12088, 12089, 12090, 12078, 12079, 12090, 12091, 12092, 12093, 12078, 12093,
+        12085, 12086, 12087, 12094, 12095, 12096, 12103, 12104, 12064, 12071, 12073, 12074, 12087, 12088, 12089, 12090,
+        12096, 12097, 12098, 12099, 12104, 12105, 12106, 12107, 12065, 12074, 12090, 12091, 12092, 12093, 12099, 12100,
+        12101, 12102, 12107, 12108, 12093, 12102, 12117, 12117, 12114, 12117, 12114, 12117, 12116, 12117, 12116, 12117,
+        12112, 12113, 12114, 12116, 12117, 12113, 12114, 12117, 12116, 12117, 12116, 12117, 12110, 12111, 12112, 12114,
+        12115, 12116, 12117, 12114, 12115, 12117, 12116, 12117, 12116, 12117, 12115, 12116, 12117, 12115, 12117, 12127,
+        12128, 12127, 12128, 12126, 12127, 12128, 12123, 12126, 12128, 12127, 12128, 12127, 12128, 12121, 12124, 12126,
+        12127, 12128, 12124, 12126, 12128, 12127, 12128, 12125, 12127, 12128, 12121, 12122, 12125, 12126, 12127, 12128,
+        12125, 12126, 12128, 12128, 12119, 12120, 12125, 12128, 12125, 12128, 12125, 12128, 12178, 12178, 12137, 12141,
+        12150, 12171, 12175, 12178, 12137, 12145, 12175, 12178, 12176, 12178, 12176, 12177, 12178, 12130, 12131, 12132,
+        12133, 12136, 12139, 12143, 12146, 12149, 12151, 12156, 12157, 12159, 12160, 12163, 12164, 12165, 12166, 12169,
+        12170, 12171, 12173, 12175, 12177, 12178, 12131, 12134, 12142, 12147, 12148, 12153, 12167, 12175, 12177, 12178,
+        12154, 12176, 12178, 12140, 12152, 12162, 12174, 12176, 12177, 12178, 12135, 12155, 12158, 12161, 12168, 12172,
+        12177, 12178, 12177, 12178, 12176, 12178, 12138, 12176, 12177, 12178, 12144, 12177, 12178, 12177, 12178, 12188,
+        12189, 12188, 12189, 12189, 12189, 12188, 12189, 12187, 12188, 12189, 12184, 12187, 12189, 12183, 12187, 12189,
+        12189, 12187, 12189, 12180, 12181, 12184, 12186, 12187, 12189, 12186, 12187, 12189, 12189, 12189, 12182, 12185,
+        12186, 12189, 12182, 12185, 12186, 12189, 12196, 12199, 12193, 12196, 12199, 12196, 12197, 12199, 12197, 12199,
+        12196, 12199, 12191, 12194, 12195, 12196, 12198, 12199, 12191, 12196, 12197, 12198, 12199, 12197, 12199, 12199,
+        12192, 12198, 12199, 12192, 12198, 12199, 12199, 12199, 12192, 12198, 12199, 12192, 12198, 12199, 12199, 12218,
+        12218, 12206, 12217, 12218, 12217, 12218, 12216, 12218, 12210, 12212, 12216, 12218, 12204, 12206, 12216, 12217,
+        12218, 12217, 12218, 12208, 12214, 12216, 12218, 12205, 12214, 12216, 12218, 12209, 12215, 12216, 12217, 12218,
+        12201, 12202, 12203, 12213, 12215, 12217, 12218, 12218, 12218, 12207, 12211, 12215, 12218, 12215, 12218, 12234,
+        12234, 12234, 12234, 12234, 12228, 12233, 12234, 12233, 12234, 12233, 12234, 12222, 12225, 12232, 12234, 12227,
+        12230, 12232, 12233, 12234, 12226, 12230, 12231, 12232, 12233, 12234, 12223, 12224, 12229, 12231, 12233, 12234,
+        12232, 12234, 12232, 12234, 12220, 12221, 12231, 12232, 12234, 12231, 12234, 12247, 12240, 12245, 12247, 12242,
+        12245, 12247, 12245, 12247, 12247, 12240, 12244, 12245, 12247, 12236, 12237, 12238, 12239, 12244, 12245, 12247,
+        12244, 12245, 12247, 12247, 12244, 12246, 12247, 12241, 12244, 12246, 12247, 12243, 12244, 12246, 12247, 12247,
+        12246, 12247, 12246, 12247, 12246, 12247, 12259, 12254, 12256, 12259, 12255, 12256, 12259, 12259, 12259, 12250,
+        12251, 12256, 12257, 12259, 12250, 12256, 12257, 12258, 12259, 12253, 12258, 12259, 12252, 12259, 12249, 12250,
+        12257, 12259, 12250, 12257, 12258, 12259, 12258, 12259, 12259, 12257, 12259, 12257, 12258, 12259, 12258, 12259,
+        12278, 12278, 12271, 12275, 12278, 12272, 12274, 12275, 12278, 12277, 12278, 12277, 12278, 12264, 12269, 12275,
+        12276, 12278, 12265, 12267, 12275, 12276, 12278, 12268, 12277, 12278, 12277, 12278, 12276, 12278, 12261, 12262,
+        12263, 12270, 12276, 12278, 12278, 12278, 12266, 12278, 12273, 12278, 12312, 12290, 12293, 12294, 12305, 12312,
+        12283, 12292, 12293, 12302, 12305, 12306, 12307, 12309, 12312, 12301, 12309, 12312, 12282, 12303, 12311, 12312,
+        12282, 12285, 12291, 12299, 12300, 12304, 12311, 12312, 12280, 12281, 12288, 12289, 12295, 12297, 12298, 12308,
+        12309, 12310, 12312, 12286, 12287, 12297, 12309, 12310, 12312, 12311, 12312, 12291, 12311, 12312, 12284, 12310,
+        12312, 12296, 12310, 12312, 12312, 12312, 12312, 12312, 12321, 12314, 12315, 12318, 12321, 12315, 12316, 12318,
+        12321, 12321, 12321, 12315, 12318, 12319, 12321, 12315, 12318, 12319, 12321, 12321, 12320, 12321, 12319, 12320,
+        12321, 12317, 12319, 12321, 12321, 12320, 12321, 12320, 12321, 12321, 12321, 12333, 12333, 12333, 12333, 12331,
+        12333, 12331, 12333, 12332, 12333, 12327, 12332, 12333, 12331, 12333, 12326, 12331, 12333, 12330, 12332, 12333,
+        12323, 12324, 12328, 12329, 12330, 12332, 12333, 12333, 12333, 12325, 12330, 12333, 12330, 12333, 12345, 12345,
+        12345, 12345, 12345, 12344, 12345, 12341, 12342, 12344, 12345, 12342, 12343, 12345, 12345, 12344, 12345, 12338,
+        12340, 12342, 12344, 12345, 12335, 12336, 12337, 12339, 12342, 12343, 12345, 12345, 12345, 12345, 12345, 12347,
+        12348, 12348, 12348, 12348, 12348, 12347, 12348, 12347, 12348, 12347, 12348, 12348, 12347, 12348, 12347, 12348,
+        12347, 12348, 12348, 12347, 12348, 12347, 12348, 12347, 12348, 12348, 12354, 12351, 12352, 12353, 12354, 12354,
+        12354, 12353, 12354, 12353, 12354, 12353, 12354, 12353, 12354, 12353, 12354, 12353, 12354, 12353, 12354, 12353,
+        12354, 12352, 12353, 12354, 12352, 12353, 12354, 12351, 12352, 12353, 12354, 12352, 12353, 12354, 12352, 12354,
+        12352, 12354, 12351, 12352, 12354, 12352, 12354, 12358, 12359, 12360, 12357, 12358, 12360, 12359, 12360, 12359,
+        12360, 12359, 12360, 12359, 12360, 12358, 12359, 12360, 12358, 12359, 12360, 12359, 12360, 12359, 12360, 12358,
+        12360, 12358, 12360, 12360, 12360, 12357, 12358, 12360, 12357, 12358, 12360, 12360, 12360, 12366, 12367, 12369,
+        12372, 12363, 12364, 12365, 12366, 12368, 12369, 12370, 12371, 12372, 12372, 12372, 12366, 12367, 12372, 12363,
+        12365, 12366, 12368, 12372, 12368, 12372, 12372, 12366, 12369, 12372, 12364, 12365, 12366, 12368, 12372, 12364,
+        12368, 12372, 12370, 12371, 12372, 12372, 12364, 12372, 12364, 12372, 12370, 12372, 12372, 12364, 12372, 12364,
+        12372, 12372, 12382, 12383, 12375, 12376, 12377, 12378, 12379, 12380, 12381, 12382, 12383, 12382, 12383, 12382,
+        12383, 12383, 12383, 12383, 12380, 12381, 12383, 12380, 12383, 12379, 12383, 12383, 12380, 12383, 12377, 12378,
+        12380, 12383, 12375, 12376, 12377, 12378, 12383, 12383, 12383, 12377, 12383, 12375, 12377, 12383, 12392, 12386,
+        12387, 12388, 12389, 12390, 12391, 12392, 12391, 12392, 12387, 12388, 12392, 12386, 12387, 12388, 12392, 12387,
+        12389, 12390, 12392, 12392, 12392, 12392, 12390, 12392, 12392, 12392, 12392, 12392, 12392, 12392, 12392, 12392,
+        12398, 12395, 12396, 12397, 12398, 12398, 12398, 12398, 12398, 12398, 12398, 12398, 12398, 12395, 12396, 12398,
+        12396, 12397, 12398, 12397, 12398, 12398, 12395, 12396, 12398, 12396, 12397, 12398, 12397, 12398, 12398, 12412,
+        12401, 12402, 12403, 12404, 12406, 12408, 12409, 12410, 12411, 12412, 12412, 12401, 12402, 12405, 12407, 12411,
+        12412, 12412, 12412, 12406, 12412, 12412, 12412, 12412, 12406, 12408, 12409, 12410, 12412, 12412, 12404, 12411,
+        12412, 12403, 12404, 12412, 12401, 12402, 12408, 12412, 12412, 12411, 12412, 12412, 12402, 12405, 12407, 12412,
+        12412, 12433, 12433, 12433, 12419, 12420, 12422, 12423, 12424, 12433, 12433, 12433, 12426, 12427, 12428, 12433,
+        12415, 12416, 12417, 12418, 12419, 12421, 12422, 12423, 12433, 12430, 12433, 12429, 12433, 12427, 12428, 12433,
+        12433, 12425, 12430, 12431, 12432, 12433, 12433, 12433, 12433, 12435, 12436, 12437, 12438, 12439, 12440, 12443,
+        12436, 12440, 12441, 12442, 12443, 12443, 12443, 12443, 12443, 12443, 12443, 12439, 12443, 12443, 12443, 12437,
+        12443, 12435, 12436, 12437, 12438, 12443, 12443, 12443, 12440, 12441, 12443, 12435, 12436, 12442, 12443, 12443,
+        12446, 12447, 12448, 12452, 12453, 12457, 12458, 12459, 12460, 12464, 12465, 12466, 12467, 12468, 12471, 12472,
+        12473, 12474, 12475, 12477, 12478, 12479, 12480, 12481, 12482, 12483, 12484, 12485, 12454, 12460, 12461, 12462,
+        12463, 12468, 12469, 12470, 12475, 12476, 12481, 12449, 12450, 12451, 12452, 12455, 12456, 12457, 12458, 12459,
+        12460, 12450, 12454, 12460, 12461, 12462, 12463, 12477, 12478, 12479, 12482, 12483, 12453, 12479, 12480, 12481,
+        12483, 12484, 12485, 12481, 12446, 12447, 12464, 12465, 12471, 12472, 12473, 12477, 12478, 12479, 12465, 12466,
+        12467, 12473, 12474, 12475, 12479, 12480, 12481, 12467, 12468, 12469, 12475, 12476, 12481, 12469, 12470, 12448,
+        12457, 12464, 12465, 12452, 12456, 12457, 12458, 12459, 12465, 12466, 12467, 12450, 12452, 12459, 12460, 12461,
+        12467, 12468, 12469, 12454, 12461, 12462, 12463, 12469, 12470, 12449, 12451, 12455, 12456, 12490, 12495, 12518,
+        12519, 12520, 12521, 12525, 12526, 12527, 12528, 12531, 12532, 12533, 12535, 12536, 12489, 12490, 12521, 12522,
+        12523, 12524, 12528, 12529, 12530, 12533, 12534, 12536, 12488, 12491, 12492, 12493, 12494, 12497, 12498, 12499,
+        12500, 12501, 12502, 12503, 12504, 12505, 12506, 12507, 12510, 12511, 12512, 12513, 12514, 12518, 12519, 12520,
+        12521, 12496, 12507, 12508, 12509, 12514, 12515, 12516, 12517, 12521, 12522, 12523, 12524, 12531, 12532, 12535,
+        12489, 12490, 12495, 12532, 12533, 12534, 12535, 12536, 12534, 12518, 12518, 12519, 12520, 12525, 12526, 12531,
+        12532, 12489, 12490, 12520, 12521, 12522, 12526, 12527, 12528, 12529, 12532, 12533, 12534, 12522, 12523, 12524,
+        12529, 12530, 12534, 12502, 12503, 12504, 12510, 12511, 12518, 12488, 12491, 12504, 12505, 12506, 12511, 12512,
+        12513, 12518, 12519, 12520, 12491, 12494, 12496, 12506, 12507, 12508, 12513, 12514, 12515, 12520, 12521, 12522,
+        12496, 12508, 12509, 12515, 12516, 12517, 12522, 12523, 12524, 12493, 12497, 12498, 12499, 12502, 12503, 12504,
+        12492, 12499, 12500, 12501, 12504, 12505, 12506, 12492, 12501, 12506, 12507, 12508, 12508, 12509, 12539, 12540,
+        12541, 12542, 12543, 12544, 12550, 12551, 12552, 12553, 12554, 12555, 12556, 12557, 12558, 12559, 12560, 12561,
+        12562, 12563, 12564, 12565, 12566, 12567, 12568, 12569, 12570, 12571, 12572, 12573, 12574, 12575, 12545, 12546,
+        12547, 12548, 12549, 12550, 12551, 12552, 12553, 12554, 12555, 12556, 12576, 12577, 12578, 12579, 12580, 12581,
+        12582, 12583, 12584, 12585, 12586, 12539, 12540, 12541, 12543, 12564, 12565, 12570, 12571, 12574, 12575, 12540,
+        12565, 12566, 12567, 12571, 12572, 12573, 12567, 12568, 12573, 12568, 12569, 12541, 12550, 12551, 12557, 12558,
+        12564, 12565, 12544, 12551, 12552, 12553, 12558, 12559, 12560, 12565, 12566, 12567, 12542, 12553, 12554, 12560,
+        12561, 12567, 12568, 12554, 12555, 12556, 12561, 12562, 12563, 12568, 12569, 12545, 12546, 12550, 12551, 12583,
+        12546, 12547, 12551, 12552, 12553, 12583, 12584, 12585, 12547, 12548, 12549, 12553, 12554, 12585, 12586, 12549,
+        12554, 12555, 12556, 12586, 12579, 12583, 12576, 12577, 12579, 12580, 12581, 12583, 12584, 12585, 12577, 12578,
+        12581, 12582, 12585, 12586, 12578, 12582, 12586, 12595, 12597, 12601, 12623, 12624, 12625, 12628, 12629, 12630,
+        12633, 12634, 12635, 12638, 12639, 12640, 12641, 12625, 12626, 12627, 12630, 12631, 12632, 12635, 12636, 12637,
+        12641, 12642, 12590, 12592, 12596, 12598, 12600, 12601, 12603, 12604, 12605, 12608, 12609, 12610, 12613, 12614,
+        12615, 12618, 12619, 12620, 12623, 12624, 12625, 12589, 12590, 12591, 12592, 12593, 12594, 12599, 12602, 12605,
+        12606, 12607, 12610, 12611, 12612, 12615, 12616, 12617, 12620, 12621, 12622, 12625, 12626, 12627, 12595, 12633,
+        12638, 12639, 12633, 12634, 12635, 12639, 12640, 12641, 12635, 12636, 12641, 12642, 12636, 12637, 12601, 12623,
+        12628, 12633, 12590, 12597, 12623, 12624, 12625, 12628, 12629, 12630, 12633, 12634, 12635, 12589, 12590, 12597,
+        12625, 12626, 12630, 12631, 12635, 12636, 12626, 12627, 12631, 12632, 12636, 12637, 12613, 12618, 12623, 12590,
+        12600, 12613, 12614, 12615, 12618, 12619, 12620, 12623, 12624, 12625, 12589, 12590, 12602, 12615, 12616, 12620,
+        12621, 12625, 12626, 12599, 12602, 12616, 12617, 12621, 12622, 12626, 12627, 12596, 12598, 12603, 12608, 12613,
+        12598, 12603, 12604, 12605, 12608, 12609, 12610, 12613, 12614, 12615, 12592, 12593, 12594, 12605, 12606, 12610,
+        12611, 12615, 12616, 12591, 12606, 12607, 12611, 12612, 12616, 12617, 12648, 12649, 12651, 12654, 12645, 12646,
+        12647, 12648, 12650, 12652, 12653, 12654, 12655, 12654, 12648, 12651, 12654, 12654, 12655, 12655, 12654, 12649,
+        12654, 12652, 12654, 12655, 12655, 12654, 12647, 12649, 12654, 12645, 12646, 12647, 12652, 12654, 12655, 12655,
+        12654, 12654, 12650, 12653, 12654, 12655, 12655, 12658, 12659, 12667, 12659, 12660, 12662, 12663, 12664, 12665,
+        12667, 12668, 12661, 12666, 12668, 12658, 12659, 12667, 12667, 12662, 12667, 12668, 12668, 12665, 12667, 12664,
+        12667, 12667, 12668, 12668, 12667, 12660, 12664, 12667, 12661, 12667, 12668, 12668, 12667, 12660, 12663, 12667,
+        12667, 12668, 12666, 12668, 12675, 12689, 12696, 12713, 12714, 12715, 12716, 12717, 12718, 12719, 12720, 12721,
+        12722, 12723, 12727, 12728, 12671, 12672, 12673, 12674, 12675, 12676, 12677, 12678, 12679, 12680, 12681, 12682,
+        12683, 12684, 12685, 12686, 12687, 12688, 12689, 12690, 12691, 12692, 12693, 12694, 12695, 12696, 12697, 12698,
+        12699, 12700, 12701, 12702, 12703, 12704, 12705, 12706, 12707, 12708, 12709, 12710, 12711, 12712, 12723, 12724,
+        12725, 12726, 12728, 12729, 12730, 12731, 12682, 12713, 12714, 12715, 12717, 12718, 12719, 12720, 12675, 12715,
+        12716, 12720, 12721, 12722, 12723, 12724, 12727, 12728, 12729, 12705, 12706, 12709, 12710, 12724, 12725, 12726,
+        12729, 12730, 12731, 12671, 12672, 12676, 12706, 12707, 12708, 12710, 12711, 12712, 12713, 12714, 12715, 12675,
+        12689, 12696, 12697, 12715, 12716, 12722, 12723, 12724, 12674, 12677, 12689, 12690, 12691, 12692, 12693, 12697,
+        12698, 12699, 12700, 12701, 12705, 12706, 12724, 12725, 12726, 12693, 12694, 12695, 12701, 12702, 12703, 12704,
+        12706, 12707, 12708, 12684, 12689, 12678, 12679, 12681, 12684, 12685, 12686, 12687, 12688, 12689, 12690, 12691,
+        12692, 12693, 12678, 12679, 12688, 12693, 12694, 12695, 12704, 12684, 12678, 12680, 12682, 12683, 12684, 12685,
+        12686, 12687, 12688, 12673, 12678, 12680, 12683, 12688, 12738, 12739, 12779, 12780, 12781, 12782, 12783, 12784,
+        12785, 12786, 12787, 12788, 12789, 12790, 12791, 12734, 12735, 12736, 12737, 12740, 12741, 12742, 12743, 12744,
+        12745, 12746, 12747, 12748, 12749, 12750, 12751, 12752, 12753, 12754, 12755, 12756, 12757, 12758, 12759, 12760,
+        12761, 12762, 12763, 12764, 12765, 12766, 12767, 12768, 12769, 12770, 12771, 12772, 12773, 12774, 12775, 12776,
+        12777, 12778, 12779, 12780, 12781, 12782, 12783, 12784, 12785, 12738, 12739, 12779, 12780, 12781, 12786, 12787,
+        12781, 12782, 12787, 12788, 12791, 12782, 12783, 12784, 12788, 12789, 12790, 12791, 12784, 12785, 12790, 12737,
+        12739, 12765, 12766, 12772, 12773, 12779, 12780, 12781, 12734, 12735, 12766, 12767, 12768, 12773, 12774, 12775,
+        12781, 12782, 12768, 12769, 12770, 12775, 12776, 12777, 12782, 12783, 12784, 12790, 12770, 12771, 12777, 12778,
+        12784, 12785, 12790, 12751, 12752, 12758, 12759, 12765, 12766, 12752, 12753, 12754, 12759, 12760, 12761, 12766,
+        12767, 12768, 12741, 12754, 12755, 12756, 12761, 12762, 12763, 12768, 12769, 12770, 12741, 12742, 12743, 12756,
+        12757, 12763, 12764, 12770, 12771, 12744, 12745, 12751, 12752, 12740, 12745, 12746, 12747, 12752, 12753, 12754,
+        12736, 12741, 12747, 12748, 12749, 12754, 12755, 12756, 12736, 12741, 12743, 12749, 12750, 12756, 12757, 12796,
+        12804, 12805, 12807, 12815, 12816, 12824, 12825, 12834, 12835, 12843, 12844, 12794, 12795, 12796, 12797, 12798,
+        12799, 12800, 12801, 12802, 12803, 12805, 12806, 12807, 12808, 12809, 12810, 12811, 12812, 12813, 12814, 12816,
+        12817, 12818, 12819, 12820, 12821, 12822, 12823, 12825, 12826, 12827, 12828, 12829, 12830, 12831, 12832, 12833,
+        12835, 12836, 12837, 12838, 12839, 12840, 12841, 12842, 12844, 12845, 12846, 12847, 12848, 12849, 12850, 12851,
+        12852, 12796, 12834, 12835, 12836, 12843, 12844, 12845, 12836, 12837, 12838, 12845, 12846, 12847, 12801, 12803,
+        12838, 12839, 12840, 12841, 12847, 12848, 12849, 12850, 12794, 12795, 12798, 12802, 12841, 12842, 12850, 12851,
+        12852, 12796, 12824, 12825, 12826, 12834, 12835, 12836, 12826, 12827, 12828, 12836, 12837, 12838, 12828, 12829,
+        12830, 12831, 12838, 12839, 12840, 12841, 12797, 12798, 12831, 12832, 12841, 12842, 12852, 12805, 12806, 12808,
+        12815, 12816, 12817, 12824, 12825, 12826, 12808, 12809, 12810, 12817, 12818, 12819, 12826, 12827, 12828, 12810,
+        12811, 12812, 12819, 12820, 12821, 12822, 12828, 12829, 12830, 12831, 12799, 12800, 12812, 12813, 12814, 12822,
+        12823, 12831, 12832, 12833, 12804, 12805, 12806, 12807, 12808, 12808, 12809, 12810, 12810, 12811, 12812, 12812,
+        12813, 12814, 12915, 12857, 12915, 12916, 12917, 12855, 12856, 12862, 12873, 12874, 12875, 12876, 12879, 12880,
+        12881, 12882, 12885, 12886, 12887, 12888, 12891, 12892, 12893, 12894, 12897, 12898, 12899, 12900, 12903, 12904,
+        12905, 12906, 12909, 12910, 12911, 12912, 12915, 12859, 12860, 12876, 12877, 12878, 12882, 12883, 12884, 12888,
+        12889, 12890, 12894, 12895, 12896, 12900, 12901, 12902, 12906, 12907, 12908, 12912, 12913, 12914, 12915, 12916,
+        12917, 12858, 12863, 12864, 12868, 12869, 12870, 12873, 12874, 12875, 12876, 12858, 12861, 12864, 12865, 12866,
+        12867, 12870, 12871, 12872, 12876, 12877, 12878, 12903, 12904, 12909, 12910, 12904, 12905, 12906, 12910, 12911,
+        12912, 12857, 12859, 12906, 12907, 12912, 12913, 12915, 12916, 12857, 12907, 12908, 12913, 12914, 12916, 12917,
+        12885, 12886, 12891, 12892, 12897, 12898, 12903, 12904, 12855, 12856, 12886, 12887, 12892, 12893, 12894, 12898,
+        12899, 12900, 12904, 12905, 12906, 12859, 12887, 12888, 12889, 12894, 12895, 12900, 12901, 12906, 12907, 12860,
+        12889, 12890, 12895, 12896, 12901, 12902, 12907, 12908, 12862, 12873, 12874, 12879, 12880, 12885, 12886, 12874,
+        12875, 12880, 12881, 12886, 12887, 12875, 12876, 12877, 12881, 12882, 12883, 12887, 12888, 12889, 12877, 12878,
+        12883, 12884, 12889, 12890, 12863, 12868, 12873, 12874, 12858, 12863, 12864, 12868, 12869, 12874, 12875, 12858,
+        12864, 12865, 12866, 12869, 12870, 12871, 12875, 12876, 12877, 12861, 12866, 12867, 12871, 12872, 12877, 12878,
+        12920, 12921, 12922, 12924, 12925, 12950, 12951, 12952, 12953, 12954, 12955, 12956, 12957, 12958, 12959, 12960,
+        12961, 12962, 12963, 12964, 12965, 12967, 12968, 12969, 12970, 12971, 12972, 12973, 12974, 12977, 12978, 12979,
+        12980, 12981, 12982, 12983, 12985, 12986, 12987, 12957, 12965, 12966, 12974, 12975, 12976, 12983, 12984, 12987,
+        12988, 12922, 12923, 12926, 12927, 12928, 12929, 12930, 12931, 12932, 12933, 12934, 12935, 12936, 12937, 12938,
+        12939, 12940, 12941, 12942, 12943, 12944, 12945, 12946, 12947, 12948, 12949, 12950, 12951, 12952, 12953, 12954,
+        12955, 12956, 12957, 12957, 12967, 12968, 12969, 12977, 12969, 12970, 12971, 12972, 12977, 12978, 12979, 12980,
+        12920, 12921, 12972, 12973, 12974, 12980, 12981, 12982, 12985, 12986, 12987, 12920, 12921, 12974, 12975, 12976,
+        12982, 12983, 12984, 12987, 12988, 12925, 12950, 12951, 12952, 12958, 12959, 12960, 12967, 12968, 12969, 12924,
+        12952, 12953, 12954, 12960, 12961, 12962, 12969, 12970, 12971, 12972, 12920, 12921, 12922, 12954, 12955, 12956,
+        12962, 12963, 12964, 12972, 12973, 12974, 12920, 12921, 12956, 12957, 12964, 12965, 12966, 12974, 12975, 12976,
+        12939, 12940, 12941, 12945, 12946, 12947, 12950, 12951, 12952, 12941, 12942, 12943, 12947, 12948, 12949, 12952,
+        12953, 12954, 12943, 12944, 12949, 12954, 12955, 12956, 12956, 12957, 12923, 12927, 12928, 12929, 12933, 12934,
+        12935, 12939, 12940, 12941, 12926, 12929, 12930, 12931, 12935, 12936, 12937, 12941, 12942, 12943, 12931, 12932,
+        12937, 12938, 12943, 12944, 13052, 13053, 12991, 12992, 12993, 12995, 12996, 12997, 12999, 13010, 13011, 13012,
+        13013, 13014, 13015, 13016, 13017, 13018, 13019, 13020, 13021, 13022, 13023, 13024, 13025, 13026, 13027, 13028,
+        13029, 13030, 13031, 13032, 13033, 13034, 13035, 13036, 13037, 13038, 13039, 13040, 13041, 13042, 13043, 13044,
+        13045, 13046, 13047, 13048, 13049, 13050, 13051, 13052, 13053, 13034, 13047, 12994, 12998, 13000, 13001, 13002,
+        13003, 13004, 13005, 13006, 13007, 13008, 13009, 13010, 13011, 13012, 13013, 13014, 13015, 12995, 13041, 13042,
+        13048, 13049, 13052, 13053, 13042, 13043, 13044, 13049, 13050, 13053, 13044, 13045, 13050, 13051, 12997, 13045,
+        13046, 13047, 13051, 13028, 13029, 13035, 13036, 13041, 13042, 13029, 13030, 13031, 13036, 13037, 13038, 13042,
+        13043, 13044, 12993, 13031, 13032, 13038, 13039, 13044, 13045, 12999, 13032, 13033, 13034, 13039, 13040, 13045,
+        13046, 13047, 12996, 13010, 13011, 13016, 13017, 13022, 13023, 13028, 13029, 12991, 12992, 12996, 13011, 13012,
+        13013, 13017, 13018, 13019, 13023, 13024, 13025, 13029, 13030, 13031, 12992, 13013, 13014, 13019, 13020, 13025,
+        13026, 13031, 13032, 12999, 13014, 13015, 13020, 13021, 13026, 13027, 13032, 13033, 13034, 13000, 13001, 13005,
+        13006, 13010, 13011, 12994, 12998, 13001, 13002, 13006, 13007, 13011, 13012, 13013, 12994, 13002, 13003, 13004,
+        13007, 13008, 13009, 13013, 13014, 13004, 13009, 13014, 13015, 13104, 13105, 13106, 13107, 13108, 13109, 13110,
+        13111, 13112, 13113, 13114, 13115, 13116, 13117, 13118, 13119, 13120, 13121, 13122, 13056, 13057, 13058, 13059,
+        13060, 13061, 13062, 13063, 13064, 13065, 13066, 13067, 13068, 13069, 13070, 13071, 13072, 13073, 13074, 13075,
+        13076, 13077, 13078, 13079, 13080, 13081, 13082, 13083, 13084, 13085, 13086, 13087, 13088, 13089, 13090, 13091,
+        13092, 13093, 13094, 13095, 13096, 13097, 13098, 13099, 13100, 13101, 13102, 13103, 13104, 13105, 13106, 13107,
+        13108, 13109, 13110, 13079, 13104, 13105, 13106, 13111, 13112, 13117, 13118, 13106, 13107, 13108, 13112, 13113,
+        13114, 13115, 13118, 13119, 13120, 13108, 13109, 13110, 13115, 13116, 13120, 13121, 13122, 13110, 13122, 13088,
+        13089, 13090, 13096, 13097, 13098, 13104, 13105, 13106, 13056, 13058, 13062, 13090, 13091, 13092, 13098, 13099,
+        13100, 13106, 13107, 13108, 13058, 13062, 13092, 13093, 13094, 13100, 13101, 13102, 13108, 13109, 13110, 13094,
+        13095, 13102, 13103, 13110, 13059, 13071, 13072, 13073, 13080, 13081, 13088, 13089, 13090, 13056, 13058, 13061,
+        13073, 13074, 13075, 13081, 13082, 13083, 13084, 13090, 13091, 13092, 13058, 13075, 13076, 13077, 13084, 13085,
+        13086, 13092, 13093, 13094, 13077, 13078, 13079, 13086, 13087, 13094, 13095, 13057, 13063, 13064, 13065, 13071,
+        13072, 13073, 13065, 13066, 13067, 13073, 13074, 13075, 13067, 13068, 13069, 13075, 13076, 13077, 13060, 13069,
+        13070, 13077, 13078, 13079, 13125, 13126, 13131, 13135, 13136, 13137, 13138, 13139, 13140, 13142, 13143, 13144,
+        13145, 13146, 13147, 13148, 13150, 13151, 13152, 13153, 13154, 13155, 13156, 13157, 13159, 13160, 13161, 13162,
+        13127, 13128, 13129, 13130, 13131, 13132, 13133, 13134, 13140, 13141, 13148, 13149, 13157, 13158, 13162, 13163,
+        13164, 13165, 13166, 13167, 13168, 13169, 13170, 13171, 13172, 13173, 13174, 13175, 13176, 13177, 13178, 13179,
+        13180, 13181, 13182, 13183, 13184, 13185, 13186, 13187, 13188, 13189, 13190, 13191, 13192, 13193, 13194, 13195,
+        13196, 13197, 13130, 13164, 13165, 13166, 13194, 13195, 13196, 13196, 13197, 13150, 13151, 13152, 13153, 13159,
+        13126, 13153, 13154, 13155, 13156, 13157, 13160, 13161, 13162, 13129, 13157, 13158, 13162, 13163, 13164, 13181,
+        13182, 13183, 13188, 13189, 13190, 13194, 13195, 13196, 13183, 13184, 13185, 13186, 13187, 13190, 13191, 13192,
+        13193, 13196, 13197, 13135, 13142, 13143, 13144, 13150, 13151, 13152, 13153, 13125, 13126, 13133, 13144, 13145,
+        13146, 13147, 13148, 13153, 13154, 13155, 13156, 13157, 13127, 13129, 13148, 13149, 13157, 13158, 13174, 13175,
+        13176, 13181, 13182, 13183, 13134, 13176, 13177, 13178, 13179, 13180, 13183, 13184, 13185, 13186, 13187, 13136,
+        13142, 13143, 13144, 13131, 13132, 13133, 13136, 13137, 13138, 13139, 13140, 13144, 13145, 13146, 13147, 13148,
+        13127, 13128, 13132, 13140, 13141, 13148, 13149, 13167, 13168, 13169, 13174, 13175, 13176, 13169, 13170, 13171,
+        13172, 13173, 13176, 13177, 13178, 13179, 13180, 13200, 13201, 13202, 13203, 13208, 13229, 13230, 13231, 13232,
+        13233, 13234, 13235, 13236, 13255, 13256, 13257, 13258, 13259, 13260, 13261, 13262, 13263, 13264, 13265, 13203,
+        13233, 13236, 13237, 13238, 13265, 13204, 13205, 13206, 13207, 13209, 13210, 13211, 13212, 13213, 13214, 13215,
+        13216, 13217, 13218, 13219, 13220, 13221, 13222, 13223, 13224, 13225, 13226, 13227, 13228, 13239, 13240, 13241,
+        13242, 13243, 13244, 13245, 13246, 13247, 13248, 13249, 13250, 13251, 13252, 13253, 13254, 13255, 13256, 13257,
+        13258, 13259, 13260, 13261, 13262, 13263, 13264, 13265, 13218, 13228, 13239, 13243, 13248, 13254, 13265, 13200,
+        13201, 13202, 13203, 13208, 13229, 13230, 13231, 13232, 13233, 13234, 13235, 13203, 13231, 13233, 13235, 13236,
+        13237, 13238, 13219, 13220, 13221, 13255, 13256, 13257, 13258, 13221, 13222, 13223, 13224, 13258, 13259, 13260,
+        13261, 13207, 13224, 13225, 13226, 13227, 13228, 13229, 13230, 13231, 13234, 13261, 13262, 13263, 13264, 13265,
+        13207, 13228, 13231, 13264, 13265, 13204, 13209, 13210, 13211, 13219, 13220, 13221, 13205, 13206, 13211, 13212,
+        13213, 13214, 13221, 13222, 13223, 13224, 13249, 13250, 13207, 13214, 13215, 13216, 13217, 13218, 13224, 13225,
+        13226, 13227, 13228, 13250, 13251, 13252, 13253, 13207, 13217, 13218, 13228, 13253, 13254, 13240, 13244, 13245,
+        13249, 13250, 13239, 13240, 13241, 13242, 13243, 13245, 13246, 13247, 13248, 13250, 13251, 13252, 13253, 13239,
+        13243, 13248, 13253, 13254, 13293, 13303, 13314, 13325, 13268, 13269, 13272, 13275, 13276, 13279, 13282, 13293,
+        13294, 13295, 13296, 13297, 13298, 13303, 13304, 13305, 13306, 13307, 13308, 13309, 13314, 13315, 13316, 13317,
+        13318, 13319, 13320, 13325, 13326, 13327, 13328, 13329, 13330, 13331, 13335, 13336, 13337, 13338, 13339, 13340,
+        13270, 13271, 13273, 13274, 13277, 13279, 13280, 13281, 13283, 13298, 13299, 13300, 13301, 13302, 13309, 13310,
+        13311, 13312, 13313, 13320, 13321, 13322, 13323, 13324, 13331, 13332, 13333, 13334, 13340, 13341, 13342, 13343,
+        13344, 13284, 13293, 13278, 13284, 13285, 13286, 13287, 13288, 13289, 13293, 13294, 13295, 13296, 13297, 13298,
+        13289, 13290, 13291, 13292, 13298, 13299, 13300, 13301, 13302, 13325, 13326, 13327, 13335, 13336, 13327, 13328,
+        13329, 13330, 13336, 13337, 13338, 13339, 13283, 13330, 13331, 13332, 13339, 13340, 13341, 13281, 13332, 13333,
+        13334, 13341, 13342, 13343, 13344, 13275, 13314, 13315, 13316, 13325, 13326, 13327, 13268, 13269, 13316, 13317,
+        13318, 13319, 13327, 13328, 13329, 13330, 13270, 13319, 13320, 13321, 13330, 13331, 13332, 13270, 13271, 13274,
+        13280, 13321, 13322, 13323, 13324, 13332, 13333, 13334, 13272, 13293, 13294, 13295, 13303, 13304, 13305, 13314,
+        13315, 13316, 13276, 13282, 13295, 13296, 13297, 13298, 13305, 13306, 13307, 13308, 13316, 13317, 13318, 13319,
+        13270, 13273, 13279, 13298, 13299, 13300, 13308, 13309, 13310, 13319, 13320, 13321, 13270, 13277, 13300, 13301,
+        13302, 13310, 13311, 13312, 13313, 13321, 13322, 13323, 13324, 13284, 13285, 13286, 13293, 13294, 13295, 13286,
+        13287, 13288, 13289, 13295, 13296, 13297, 13298, 13278, 13289, 13290, 13291, 13298, 13299, 13300, 13291, 13292,
+        13300, 13301, 13302, 13394, 13395, 13396, 13397, 13398, 13399, 13400, 13401, 13402, 13403, 13404, 13405, 13406,
+        13407, 13408, 13409, 13410, 13411, 13412, 13413, 13414, 13415, 13416, 13417, 13418, 13419, 13420, 13421, 13347,
+        13348, 13349, 13350, 13351, 13352, 13353, 13354, 13355, 13356, 13357, 13358, 13359, 13360, 13361, 13362, 13363,
+        13364, 13365, 13366, 13367, 13368, 13369, 13370, 13371, 13372, 13373, 13374, 13375, 13376, 13377, 13378, 13379,
+        13380, 13381, 13382, 13383, 13384, 13385, 13386, 13387, 13388, 13389, 13390, 13391, 13392, 13393, 13394, 13395,
+        13396, 13397, 13398, 13399, 13400, 13353, 13356, 13357, 13358, 13359, 13360, 13361, 13407, 13407, 13408, 13412,
+        13413, 13416, 13419, 13408, 13409, 13410, 13413, 13414, 13415, 13416, 13417, 13418, 13419, 13420, 13421, 13410,
+        13411, 13415, 13418, 13421, 13387, 13388, 13394, 13395, 13401, 13407, 13354, 13388, 13389, 13390, 13395, 13396,
+        13397, 13401, 13402, 13403, 13407, 13408, 13390, 13391, 13392, 13397, 13398, 13399, 13403, 13404, 13405, 13408,
+        13409, 13410, 13392, 13393, 13399, 13400, 13405, 13406, 13410, 13411, 13367, 13368, 13373, 13374, 13380, 13381,
+        13387, 13388, 13354, 13355, 13368, 13369, 13374, 13375, 13376, 13381, 13382, 13383, 13388, 13389, 13390, 13369,
+        13370, 13371, 13376, 13377, 13378, 13383, 13384, 13385, 13390, 13391, 13392, 13371, 13372, 13378, 13379, 13385,
+        13386, 13392, 13393, 13357, 13362, 13367, 13368, 13357, 13358, 13362, 13363, 13368, 13369, 13353, 13358, 13359,
+        13360, 13363, 13364, 13365, 13369, 13370, 13371, 13347, 13348, 13349, 13350, 13351, 13352, 13356, 13360, 13361,
+        13365, 13366, 13371, 13372, 13434, 13427, 13433, 13435, 13425, 13426, 13427, 13428, 13430, 13431, 13432, 13433,
+        13434, 13435, 13433, 13424, 13425, 13429, 13433, 13434, 13435, 13431, 13435, 13434, 13435, 13434, 13427, 13433,
+        13435, 13431, 13432, 13433, 13435, 13433, 13434, 13435, 13428, 13434, 13424, 13425, 13433, 13435, 13424, 13425,
+        13430, 13432, 13433, 13435, 13426, 13433, 13434, 13435, 13426, 13434, 13425, 13433, 13425, 13429, 13433, 13433,
+        13434, 13434, 13438, 13439, 13440, 13441, 13442, 13443, 13444, 13445, 13446, 13447, 13448, 13449, 13450, 13448,
+        13449, 13450, 13450, 13439, 13440, 13447, 13450, 13438, 13439, 13442, 13443, 13450, 13446, 13449, 13450, 13448,
+        13449, 13450, 13444, 13445, 13448, 13449, 13450, 13441, 13448, 13450, 13446, 13449, 13448, 13449, 13448, 13449,
+        13448, 13449, 13448, 13449, 13448, 13449, 13448, 13453, 13455, 13461, 13462, 13463, 13466, 13468, 13469, 13470,
+        13471, 13472, 13473, 13474, 13455, 13463, 13466, 13469, 13475, 13476, 13477, 13478, 13479, 13483, 13484, 13485,
+        13486, 13487, 13488, 13492, 13493, 13454, 13456, 13457, 13458, 13459, 13460, 13464, 13465, 13466, 13467, 13479,
+        13480, 13481, 13482, 13488, 13489, 13490, 13491, 13493, 13494, 13495, 13466, 13475, 13476, 13477, 13478, 13479,
+        13467, 13479, 13480, 13481, 13482, 13466, 13470, 13471, 13472, 13453, 13455, 13466, 13468, 13469, 13472, 13473,
+        13474, 13458, 13462, 13466, 13455, 13461, 13463, 13466, 13457, 13458, 13464, 13466, 13467, 13459, 13466, 13467,
+        13475, 13476, 13477, 13478, 13483, 13484, 13485, 13486, 13487, 13460, 13478, 13479, 13480, 13481, 13482, 13487,
+        13488, 13489, 13490, 13491, 13492, 13493, 13494, 13495, 13465, 13467, 13482, 13491, 13495, 13454, 13456, 13467,
+        13498, 13499, 13501, 13504, 13506, 13508, 13500, 13502, 13503, 13506, 13507, 13508, 13505, 13508, 13508, 13504,
+        13506, 13501, 13506, 13506, 13507, 13507, 13504, 13506, 13501, 13506, 13506, 13507, 13507, 13498, 13499, 13506,
+        13508, 13502, 13506, 13508, 13502, 13503, 13506, 13507, 13508, 13500, 13503, 13507, 13508, 13505, 13508, 13508,
+        13508, 13508, 13523, 13534, 13536, 13522, 13523, 13536, 13537, 13522, 13537, 13523, 13533, 13534, 13536, 13512,
+        13517, 13522, 13523, 13536, 13537, 13522, 13537, 13523, 13531, 13532, 13533, 13536, 13511, 13512, 13519, 13522,
+        13523, 13536, 13537, 13513, 13514, 13515, 13516, 13520, 13522, 13537, 13524, 13525, 13526, 13527, 13535, 13523,
+        13527, 13528, 13529, 13530, 13531, 13535, 13536, 13518, 13519, 13522, 13523, 13535, 13536, 13537, 13513, 13514,
+        13521, 13522, 13535, 13537, 13548, 13549, 13549, 13550, 13550, 13541, 13543, 13544, 13546, 13548, 13549, 13539,
+        13540, 13542, 13545, 13547, 13549, 13550, 13547, 13550, 13548, 13541, 13548, 13549, 13549, 13550, 13547, 13550,
+        13544, 13548, 13541, 13548, 13549, 13545, 13549, 13550, 13539, 13540, 13550, 13546, 13548, 13543, 13548, 13549,
+        13549, 13550, 13542, 13550, 13546, 13548, 13543, 13548, 13549, 13549, 13550, 13550, 13557, 13560, 13561, 13562,
+        13559, 13562, 13563, 13553, 13554, 13556, 13558, 13561, 13562, 13555, 13562, 13563, 13561, 13557, 13561, 13562,
+        13559, 13562, 13563, 13563, 13561, 13554, 13556, 13561, 13562, 13560, 13562, 13563, 13563, 13561, 13553, 13554,
+        13556, 13561, 13562, 13562, 13563, 13555, 13563, 13561, 13558, 13561, 13562, 13562, 13563, 13563, 13579, 13579,
+        13568, 13574, 13577, 13578, 13566, 13567, 13569, 13570, 13571, 13572, 13573, 13574, 13575, 13576, 13578, 13579,
+        13567, 13579, 13577, 13577, 13578, 13578, 13579, 13567, 13573, 13576, 13579, 13568, 13577, 13577, 13578, 13578,
+        13579, 13566, 13567, 13572, 13579, 13568, 13577, 13574, 13577, 13578, 13574, 13578, 13579, 13570, 13571, 13575,
+        13579, 13577, 13577, 13578, 13569, 13578, 13579, 13579, 13590, 13593, 13594, 13583, 13585, 13586, 13587, 13588,
+        13589, 13591, 13592, 13594, 13595, 13582, 13584, 13585, 13588, 13595, 13593, 13594, 13594, 13595, 13595, 13593,
+        13593, 13594, 13587, 13589, 13594, 13595, 13585, 13595, 13593, 13590, 13593, 13594, 13586, 13587, 13594, 13595,
+        13582, 13583, 13584, 13585, 13588, 13592, 13595, 13593, 13593, 13594, 13591, 13594, 13595, 13591, 13595, 13593,
+        13593, 13594, 13594, 13595, 13595, 13605, 13598, 13600, 13603, 13604, 13605, 13606, 13607, 13599, 13601, 13602,
+        13603, 13607, 13605, 13605, 13606, 13607, 13607, 13605, 13605, 13606, 13598, 13600, 13606, 13607, 13607, 13605,
+        13605, 13606, 13600, 13606, 13607, 13607, 13605, 13605, 13606, 13603, 13604, 13606, 13607, 13599, 13601, 13602,
+        13603, 13607, 13605, 13605, 13606, 13603, 13606, 13607, 13603, 13607, 13615, 13617, 13613, 13615, 13617, 13618,
+        13610, 13611, 13617, 13644, 13645, 13646, 13647, 13612, 13617, 13618, 13647, 13648, 13649, 13616, 13626, 13627,
+        13628, 13629, 13630, 13631, 13632, 13633, 13634, 13635, 13636, 13637, 13638, 13639, 13640, 13641, 13642, 13644,
+        13645, 13646, 13647, 13632, 13633, 13637, 13638, 13642, 13643, 13647, 13648, 13649, 13614, 13619, 13620, 13621,
+        13622, 13623, 13624, 13625, 13626, 13627, 13628, 13610, 13611, 13617, 13615, 13617, 13618, 13613, 13618, 13612,
+        13613, 13618, 13611, 13617, 13639, 13640, 13644, 13645, 13617, 13618, 13640, 13641, 13642, 13643, 13645, 13646,
+        13647, 13648, 13618, 13643, 13648, 13649, 13618, 13616, 13626, 13627, 13629, 13630, 13631, 13634, 13635, 13636,
+        13639, 13640, 13627, 13628, 13631, 13632, 13633, 13636, 13637, 13638, 13640, 13641, 13642, 13643, 13643, 13614,
+        13619, 13620, 13621, 13622, 13623, 13624, 13625, 13626, 13627, 13622, 13624, 13625, 13627, 13628, 13658, 13659,
+        13661, 13658, 13659, 13660, 13661, 13659, 13652, 13653, 13654, 13655, 13656, 13657, 13659, 13660, 13658, 13661,
+        13661, 13661, 13661, 13659, 13661, 13659, 13661, 13659, 13660, 13661, 13660, 13661, 13659, 13652, 13653, 13654,
+        13655, 13659, 13654, 13655, 13659, 13660, 13660, 13659, 13652, 13653, 13656, 13657, 13659, 13659, 13660, 13660,
+        13672, 13673, 13665, 13669, 13670, 13672, 13673, 13664, 13665, 13666, 13669, 13670, 13673, 13670, 13673, 13672,
+        13673, 13665, 13668, 13670, 13671, 13672, 13673, 13664, 13665, 13670, 13671, 13673, 13670, 13671, 13673, 13672,
+        13673, 13671, 13672, 13673, 13667, 13671, 13673, 13671, 13673, 13672, 13673, 13671, 13672, 13673, 13671, 13673,
+        13671, 13673, 13682, 13687, 13675, 13676, 13679, 13681, 13682, 13682, 13683, 13705, 13706, 13707, 13675, 13676,
+        13677, 13678, 13680, 13682, 13683, 13686, 13707, 13683, 13684, 13685, 13688, 13689, 13690, 13691, 13692, 13693,
+        13694, 13695, 13696, 13697, 13698, 13699, 13700, 13701, 13702, 13703, 13704, 13705, 13706, 13707, 13683, 13707,
+        13682, 13687, 13677, 13678, 13682, 13675, 13676, 13679, 13680, 13681, 13682, 13682, 13683, 13682, 13683, 13682,
+        13683, 13686, 13690, 13691, 13692, 13693, 13695, 13696, 13697, 13698, 13701, 13702, 13683, 13693, 13694, 13698,
+        13699, 13700, 13702, 13703, 13704, 13705, 13706, 13707, 13683, 13707, 13683, 13684, 13685, 13688, 13690, 13691,
+        13692, 13693, 13683, 13685, 13688, 13689, 13693, 13694, 13683, 13683, 13712, 13717, 13720, 13710, 13711, 13712,
+        13713, 13714, 13718, 13720, 13721, 13722, 13719, 13720, 13715, 13716, 13718, 13720, 13721, 13722, 13720, 13720,
+        13721, 13722, 13712, 13717, 13720, 13712, 13720, 13721, 13721, 13722, 13710, 13711, 13714, 13722, 13720, 13718,
+        13720, 13721, 13713, 13721, 13722, 13722, 13719, 13720, 13718, 13720, 13721, 13721, 13722, 13722, 13720, 13720,
+        13721, 13716, 13721, 13722, 13715, 13722, 13730, 13732, 13735, 13732, 13733, 13735, 13733, 13735, 13733, 13735,
+        13727, 13732, 13735, 13731, 13732, 13733, 13735, 13733, 13735, 13733, 13735, 13727, 13728, 13729, 13732, 13734,
+        13735, 13731, 13732, 13733, 13734, 13735, 13733, 13734, 13735, 13733, 13734, 13735, 13725, 13726, 13734, 13735,
+        13725, 13726, 13734, 13735, 13734, 13735, 13734, 13735, 13747, 13750, 13751, 13739, 13740, 13743, 13748, 13749,
+        13750, 13751, 13750, 13737, 13738, 13741, 13742, 13744, 13745, 13746, 13748, 13749, 13750, 13751, 13751, 13751,
+        13751, 13750, 13751, 13750, 13751, 13739, 13740, 13743, 13749, 13750, 13751, 13749, 13751, 13747, 13750, 13750,
+        13737, 13738, 13744, 13748, 13749, 13750, 13749, 13750, 13750, 13738, 13741, 13742, 13744, 13745, 13746, 13749,
+        13750, 13749, 13760, 13757, 13760, 13757, 13760, 13754, 13755, 13757, 13760, 13760, 13757, 13760, 13757, 13760,
+        13757, 13760, 13756, 13758, 13760, 13758, 13760, 13758, 13759, 13760, 13759, 13760, 13758, 13760, 13758, 13760,
+        13758, 13759, 13760, 13759, 13760, 13797, 13798, 13795, 13797, 13798, 13763, 13795, 13798, 13795, 13798, 13797,
+        13798, 13762, 13764, 13765, 13766, 13767, 13768, 13769, 13770, 13771, 13772, 13773, 13775, 13776, 13777, 13778,
+        13779, 13783, 13784, 13785, 13790, 13791, 13795, 13797, 13798, 13769, 13773, 13774, 13779, 13780, 13781, 13782,
+        13785, 13786, 13787, 13788, 13789, 13791, 13792, 13793, 13794, 13795, 13798, 13795, 13798, 13797, 13798, 13795,
+        13796, 13797, 13798, 13795, 13796, 13798, 13795, 13796, 13798, 13797, 13798, 13796, 13797, 13798, 13796, 13798,
+        13796, 13798, 13809, 13811, 13803, 13809, 13811, 13809, 13810, 13811, 13807, 13810, 13811, 13809, 13811, 13809,
+        13811, 13804, 13809, 13810, 13811, 13804, 13807, 13810, 13811, 13808, 13809, 13811, 13800, 13801, 13802, 13808,
+        13809, 13811, 13802, 13808, 13809, 13810, 13811, 13806, 13810, 13811, 13805, 13808, 13811, 13802, 13808, 13811,
+        13802, 13808, 13811, 13811, 13826, 13824, 13826, 13824, 13825, 13826, 13825, 13826, 13823, 13826, 13817, 13818,
+        13819, 13823, 13824, 13826, 13813, 13814, 13824, 13825, 13826, 13822, 13825, 13826, 13815, 13823, 13826, 13816,
+        13819, 13823, 13824, 13826, 13824, 13825, 13826, 13825, 13826, 13820, 13823, 13826, 13823, 13824, 13826, 13821,
+        13824, 13825, 13826, 13825, 13826, 13946, 13923, 13924, 13930, 13946, 13828, 13829, 13833, 13834, 13835, 13841,
+        13845, 13846, 13847, 13848, 13849, 13850, 13851, 13852, 13855, 13856, 13924, 13925, 13926, 13927, 13928, 13929,
+        13930, 13931, 13932, 13933, 13934, 13935, 13936, 13937, 13938, 13941, 13942, 13943, 13946, 13929, 13935, 13938,
+        13939, 13940, 13942, 13943, 13944, 13945, 13946, 13897, 13946, 13830, 13854, 13897, 13898, 13899, 13900, 13901,
+        13902, 13903, 13904, 13905, 13906, 13907, 13908, 13909, 13910, 13912, 13913, 13914, 13917, 13918, 13919, 13923,
+        13924, 13946, 13840, 13901, 13906, 13910, 13911, 13914, 13915, 13916, 13919, 13920, 13921, 13922, 13924, 13925,
+        13926, 13927, 13928, 13929, 13946, 13929, 13946, 13832, 13836, 13837, 13853, 13874, 13875, 13876, 13879, 13880,
+        13881, 13884, 13885, 13886, 13889, 13890, 13893, 13897, 13946, 13831, 13832, 13838, 13839, 13842, 13843, 13844,
+        13857, 13876, 13877, 13878, 13881, 13882, 13883, 13886, 13887, 13888, 13890, 13891, 13892, 13893, 13894, 13895,
+        13896, 13897, 13898, 13899, 13900, 13901, 13946, 13901, 13946, 13946, 13858, 13859, 13860, 13861, 13862, 13863,
+        13864, 13865, 13866, 13867, 13868, 13869, 13870, 13871, 13872, 13873, 13874, 13875, 13876, 13946, 13861, 13865,
+        13869, 13873, 13876, 13877, 13878, 13946, 13946, 13946, 13989, 13954, 13955, 13971, 13973, 13989, 13990, 13992,
+        13994, 13990, 13991, 13994, 13984, 13985, 13984, 13985, 13986, 13989, 13950, 13963, 13964, 13965, 13966, 13967,
+        13968, 13978, 13986, 13987, 13989, 13990, 13993, 13994, 13948, 13956, 13957, 13958, 13959, 13960, 13961, 13962,
+        13972, 13977, 13978, 13987, 13988, 13990, 13991, 13993, 13994, 13952, 13984, 13969, 13981, 13982, 13984, 13986,
+        13949, 13951, 13953, 13974, 13975, 13978, 13979, 13982, 13983, 13986, 13987, 13993, 13949, 13977, 13978, 13979,
+        13983, 13987, 13988, 13993, 13970, 13980, 13981, 13982, 13976, 13979, 13980, 13982, 13983, 13979, 13983, 14036,
+        14037, 14038, 14032, 14033, 14034, 14035, 14036, 14033, 14004, 14006, 14023, 14023, 14027, 14028, 14031, 14032,
+        14033, 13996, 13997, 14005, 14024, 14025, 14026, 14027, 14029, 14030, 14031, 14033, 13999, 14003, 14006, 14007,
+        14008, 14024, 14023, 14016, 14017, 14021, 14022, 14023, 14027, 14028, 13996, 13997, 13998, 14000, 14001, 14002,
+        14005, 14014, 14015, 14016, 14018, 14019, 14020, 14021, 14024, 14025, 14026, 14027, 14014, 14018, 14024, 14009,
+        14012, 14013, 14016, 14017, 14009, 14010, 14011, 14012, 14014, 14015, 14016, 14010, 14014, 14078, 14078, 14040,
+        14041, 14042, 14043, 14044, 14045, 14047, 14048, 14050, 14051, 14053, 14056, 14059, 14062, 14064, 14071, 14073,
+        14074, 14075, 14076, 14078, 14046, 14055, 14056, 14057, 14058, 14060, 14063, 14067, 14069, 14070, 14072, 14076,
+        14077, 14078, 14078, 14078, 14049, 14066, 14068, 14076, 14078, 14076, 14077, 14078, 14078, 14052, 14054, 14078,
+        14061, 14078, 14065, 14078, 14078, 14078, 14078, 14078, 14102, 14099, 14100, 14102, 14080, 14082, 14085, 14089,
+        14099, 14100, 14102, 14086, 14095, 14099, 14100, 14102, 14102, 14100, 14101, 14102, 14081, 14083, 14084, 14090,
+        14091, 14092, 14094, 14097, 14098, 14100, 14101, 14102, 14093, 14096, 14100, 14101, 14102, 14087, 14102, 14101,
+        14102, 14101, 14102, 14088, 14096, 14101, 14102, 14102, 14102, 14102, 14102, 14143, 14143, 14105, 14110, 14111,
+        14112, 14113, 14114, 14116, 14119, 14120, 14121, 14122, 14126, 14129, 14137, 14140, 14141, 14143, 14104, 14105,
+        14106, 14107, 14108, 14109, 14115, 14117, 14118, 14123, 14127, 14128, 14130, 14131, 14133, 14134, 14136, 14139,
+        14140, 14141, 14142, 14143, 14143, 14125, 14143, 14124, 14132, 14138, 14141, 14143, 14135, 14141, 14142, 14143,
+        14143, 14143, 14143, 14143, 14143, 14143, 14143, 14143, 14152, 14153, 14168, 14171, 14178, 14179, 14181, 14145,
+        14146, 14147, 14148, 14149, 14150, 14151, 14154, 14155, 14156, 14157, 14158, 14159, 14160, 14161, 14162, 14163,
+        14164, 14166, 14167, 14169, 14170, 14172, 14173, 14175, 14176, 14177, 14178, 14180, 14181, 14165, 14181, 14181,
+        14181, 14181, 14174, 14181, 14181, 14181, 14182, 14181, 14182, 14181, 14182, 14181, 14182, 14182, 14182, 14182,
+        14182, 14190, 14199, 14201, 14202, 14190, 14199, 14200, 14201, 14202, 14186, 14188, 14193, 14200, 14201, 14202,
+        14189, 14192, 14198, 14200, 14201, 14202, 14191, 14194, 14196, 14199, 14202, 14184, 14185, 14187, 14199, 14200,
+        14202, 14187, 14195, 14197, 14200, 14202, 14200, 14202, 14202, 14202, 14202, 14202, 14202, 14202, 14202, 14202,
+        14206, 14212, 14215, 14216, 14218, 14204, 14205, 14207, 14208, 14210, 14213, 14214, 14215, 14216, 14218, 14218,
+        14218, 14216, 14217, 14218, 14216, 14217, 14218, 14218, 14218, 14211, 14217, 14218, 14209, 14217, 14218, 14218,
+        14218, 14218, 14218, 14218, 14218, 14233, 14220, 14221, 14230, 14231, 14232, 14233, 14235, 14235, 14222, 14227,
+        14229, 14233, 14234, 14235, 14221, 14223, 14224, 14228, 14232, 14233, 14234, 14235, 14225, 14235, 14235, 14226,
+        14235, 14235, 14235, 14235, 14235, 14235, 14222, 14227, 14229, 14232, 14233, 14234, 14220, 14221, 14223, 14224,
+        14228, 14230, 14231, 14232, 14233, 14234, 14225, 14235, 14226, 14235, 14226, 14233, 14234, 14235, 14233, 14234,
+        14235, 14235, 14235, 14235, 14235, 14235, 14235, 14235, 14235, 14238, 14239, 14241, 14242, 14244, 14245, 14246,
+        14247, 14240, 14246, 14247, 14242, 14243, 14247, 14247, 14246, 14246, 14238, 14239, 14246, 14246, 14246, 14247,
+        14241, 14246, 14247, 14239, 14246, 14247, 14240, 14246, 14247, 14246, 14247, 14246, 14247, 14245, 14246, 14247,
+        14246, 14247, 14244, 14247, 14243, 14247, 14242, 14247, 14247, 14254, 14259, 14260, 14250, 14251, 14252, 14255,
+        14256, 14257, 14258, 14259, 14260, 14261, 14253, 14261, 14254, 14259, 14260, 14259, 14260, 14259, 14260, 14261,
+        14259, 14261, 14259, 14260, 14250, 14251, 14255, 14258, 14259, 14260, 14259, 14260, 14261, 14259, 14261, 14259,
+        14255, 14257, 14259, 14252, 14256, 14259, 14261, 14253, 14256, 14259, 14261, 14261, 14261, 14264, 14265, 14266,
+        14267, 14268, 14269, 14265, 14269, 14264, 14265, 14269, 14264, 14265, 14266, 14269, 14266, 14269, 14265, 14269,
+        14264, 14265, 14269, 14264, 14265, 14269, 14268, 14269, 14267, 14269, 14269, 14269, 14269, 14267, 14269, 14269,
+        14269, 14269, 14276, 14278, 14281, 14272, 14273, 14277, 14278, 14279, 14281, 14275, 14279, 14281, 14281, 14274,
+        14278, 14280, 14281, 14278, 14279, 14280, 14281, 14279, 14281, 14281, 14280, 14281, 14280, 14281, 14281, 14281,
+        14281, 14281, 14281, 14281, 14297, 14288, 14293, 14295, 14297, 14283, 14284, 14285, 14287, 14289, 14294, 14295,
+        14297, 14297, 14286, 14291, 14292, 14296, 14297, 14290, 14297, 14297, 14297, 14291, 14296, 14297, 14298, 14297,
+        14298, 14297, 14298, 14297, 14298, 14298, 14298, 14298, 14298, 14310, 14302, 14306, 14309, 14310, 14304, 14310,
+        14300, 14301, 14307, 14310, 14305, 14308, 14310, 14311, 14303, 14310, 14311, 14310, 14311, 14310, 14311, 14311,
+        14311, 14311, 14311, 14311, 14311, 14311, 14311, 14337, 14340, 14364, 14337, 14338, 14339, 14340, 14341, 14342,
+        14343, 14365, 14366, 14323, 14324, 14325, 14328, 14333, 14337, 14325, 14326, 14327, 14328, 14329, 14330, 14331,
+        14333, 14334, 14335, 14336, 14337, 14338, 14339, 14320, 14321, 14322, 14327, 14331, 14332, 14336, 14365, 14323,
+        14324, 14325, 14344, 14347, 14348, 14354, 14355, 14356, 14367, 14325, 14326, 14327, 14344, 14345, 14346, 14348,
+        14349, 14350, 14351, 14356, 14357, 14358, 14367, 14318, 14319, 14320, 14321, 14322, 14327, 14351, 14352, 14353,
+        14358, 14361, 14359, 14360, 14361, 14362, 14363, 14313, 14316, 14344, 14367, 14313, 14314, 14315, 14316, 14317,
+        14344, 14345, 14346, 14367, 14359, 14360, 14377, 14378, 14377, 14403, 14404, 14407, 14404, 14405, 14406, 14407,
+        14408, 14409, 14410, 14372, 14373, 14374, 14380, 14410, 14411, 14377, 14378, 14394, 14377, 14394, 14399, 14400,
+        14403, 14404, 14400, 14401, 14402, 14404, 14405, 14406, 14373, 14374, 14375, 14379, 14387, 14388, 14389, 14393,
+        14394, 14389, 14390, 14391, 14394, 14395, 14396, 14397, 14399, 14400, 14391, 14392, 14397, 14398, 14400, 14401,
+        14402, 14379, 14376, 14381, 14382, 14383, 14384, 14387, 14388, 14389, 14384, 14385, 14386, 14389, 14390, 14391,
+        14386, 14391, 14392, 14414, 14416, 14414, 14416, 14413, 14414, 14415, 14416, 14413, 14414, 14415, 14416, 14414,
+        14415, 14416, 14414, 14415, 14416, 14414, 14415, 14416, 14414, 14415, 14416, 14414, 14415, 14413, 14414, 14415,
+        14413, 14414, 14415, 14414, 14415, 14414, 14415, 14413, 14414, 14415, 14413, 14414, 14415, 14414, 14415, 14414,
+        14415, 14414, 14415, 14414, 14415, 14414, 14415, 14419, 14420, 14421, 14420, 14420, 14420, 14421, 14420, 14421,
+        14419, 14420, 14421, 14420, 14421, 14420, 14421, 14419, 14420, 14421, 14420, 14421, 14420, 14421, 14420, 14421,
+        14420, 14425, 14427, 14425, 14426, 14427, 14426, 14427, 14427, 14424, 14425, 14427, 14424, 14425, 14426, 14427,
+        14426, 14427, 14427, 14425, 14427, 14425, 14426, 14427, 14426, 14427, 14427, 14427, 14427, 14427, 14427, 14429,
+        14430, 14431, 14431, 14431, 14431, 14431, 14431, 14431, 14431, 14431, 14430, 14431, 14429, 14430, 14431, 14429,
+        14430, 14431, 14430, 14431, 14430, 14430, 14430, 14430, 14437, 14437, 14434, 14435, 14437, 14436, 14437, 14437,
+        14437, 14437, 14437, 14437, 14437, 14436, 14437, 14436, 14437, 14435, 14437, 14435, 14437, 14436, 14437, 14436,
+        14437, 14434, 14435, 14437, 14435, 14437, 14436, 14437, 14436, 14437, 14440, 14441, 14442, 14443, 14444, 14443,
+        14444, 14444, 14444, 14441, 14444, 14441, 14444, 14444, 14442, 14444, 14441, 14442, 14444, 14440, 14441, 14444,
+        14444, 14442, 14444, 14441, 14442, 14444, 14441, 14444, 14444, 14444, 14443, 14444, 14443, 14444, 14450, 14447,
+        14448, 14449, 14450, 14450, 14448, 14449, 14450, 14450, 14450, 14450, 14450, 14450, 14448, 14450, 14448, 14449,
+        14450, 14449, 14450, 14450, 14448, 14450, 14447, 14448, 14449, 14450, 14449, 14450, 14450, 14450, 14449, 14450,
+        14449, 14450, 14457, 14459, 14453, 14454, 14455, 14456, 14457, 14458, 14459, 14459, 14459, 14459, 14459, 14455,
+        14459, 14455, 14456, 14459, 14456, 14457, 14459, 14458, 14459, 14455, 14459, 14455, 14456, 14459, 14454, 14456,
+        14457, 14459, 14454, 14458, 14459, 14459, 14459, 14453, 14454, 14459, 14454, 14459, 14462, 14463, 14464, 14465,
+        14465, 14465, 14465, 14465, 14464, 14465, 14464, 14465, 14465, 14465, 14463, 14464, 14465, 14463, 14464, 14465,
+        14465, 14465, 14462, 14463, 14465, 14462, 14463, 14465, 14465, 14465, 14465, 14465, 14465, 14470, 14471, 14472,
+        14473, 14468, 14469, 14471, 14472, 14473, 14470, 14473, 14470, 14473, 14473, 14473, 14472, 14473, 14472, 14473,
+        14471, 14473, 14473, 14472, 14473, 14469, 14472, 14473, 14469, 14471, 14473, 14469, 14473, 14473, 14469, 14473,
+        14468, 14469, 14473, 14469, 14473, 14480, 14477, 14480, 14477, 14480, 14480, 14479, 14480, 14476, 14477, 14479,
+        14480, 14477, 14480, 14480, 14479, 14480, 14477, 14479, 14480, 14477, 14478, 14480, 14478, 14480, 14480, 14480,
+        14478, 14480, 14478, 14480, 14482, 14483, 14484, 14486, 14482, 14483, 14484, 14485, 14486, 14486, 14486, 14486,
+        14486, 14484, 14486, 14484, 14486, 14482, 14483, 14486, 14483, 14486, 14484, 14486, 14484, 14485, 14486, 14483,
+        14485, 14486, 14483, 14486, 14486, 14486, 14486, 14486, 14492, 14495, 14492, 14495, 14489, 14490, 14491, 14493,
+        14494, 14495, 14495, 14495, 14495, 14495, 14492, 14495, 14495, 14490, 14495, 14490, 14494, 14495, 14492, 14494,
+        14495, 14495, 14489, 14490, 14491, 14495, 14490, 14491, 14494, 14495, 14494, 14495, 14495, 14491, 14493, 14495,
+        14491, 14495, 14495, 14498, 14499, 14501, 14503, 14498, 14499, 14500, 14502, 14503, 14503, 14503, 14503, 14503,
+        14503, 14499, 14503, 14499, 14500, 14502, 14503, 14500, 14502, 14503, 14503, 14499, 14503, 14498, 14499, 14500,
+        14503, 14500, 14503, 14503, 14501, 14503, 14503, 14503, 14506, 14507, 14508, 14510, 14512, 14508, 14509, 14511,
+        14512, 14512, 14512, 14512, 14512, 14507, 14512, 14506, 14507, 14512, 14512, 14511, 14512, 14507, 14512, 14506,
+        14507, 14510, 14512, 14510, 14512, 14511, 14512, 14512, 14512, 14508, 14509, 14512, 14512, 14518, 14519, 14524,
+        14515, 14516, 14517, 14518, 14519, 14520, 14521, 14522, 14523, 14524, 14524, 14519, 14524, 14519, 14524, 14518,
+        14524, 14521, 14524, 14516, 14519, 14521, 14524, 14516, 14519, 14524, 14518, 14524, 14520, 14521, 14523, 14524,
+        14515, 14516, 14521, 14524, 14516, 14517, 14524, 14522, 14524, 14520, 14524, 14516, 14524, 14516, 14517, 14524,
+        14524, 14527, 14528, 14529, 14530, 14531, 14532, 14533, 14533, 14533, 14533, 14533, 14533, 14530, 14531, 14533,
+        14528, 14531, 14533, 14528, 14533, 14533, 14531, 14533, 14527, 14528, 14531, 14533, 14528, 14532, 14533, 14533,
+        14529, 14533, 14529, 14533, 14533, 14533, 14536, 14537, 14538, 14539, 14540, 14541, 14541, 14541, 14541, 14541,
+        14539, 14541, 14539, 14540, 14541, 14540, 14541, 14541, 14541, 14541, 14536, 14537, 14541, 14536, 14537, 14541,
+        14541, 14541, 14537, 14541, 14537, 14538, 14541, 14545, 14547, 14549, 14552, 14552, 14544, 14545, 14546, 14548,
+        14550, 14551, 14552, 14552, 14552, 14549, 14552, 14547, 14549, 14552, 14547, 14552, 14552, 14544, 14545, 14552,
+        14545, 14552, 14552, 14546, 14552, 14544, 14545, 14548, 14552, 14545, 14548, 14552, 14550, 14552, 14552, 14548,
+        14552, 14548, 14551, 14552, 14552, 14559, 14563, 14563, 14558, 14559, 14563, 14555, 14556, 14557, 14558, 14560,
+        14561, 14562, 14563, 14563, 14563, 14563, 14563, 14558, 14559, 14563, 14558, 14560, 14563, 14563, 14563, 14563,
+        14560, 14563, 14556, 14557, 14562, 14563, 14555, 14556, 14557, 14562, 14563, 14563, 14563, 14557, 14561, 14562,
+        14563, 14557, 14562, 14563, 14572, 14566, 14567, 14568, 14569, 14570, 14571, 14572, 14572, 14572, 14572, 14570,
+        14571, 14572, 14570, 14572, 14572, 14572, 14569, 14570, 14572, 14566, 14567, 14570, 14572, 14572, 14572, 14568,
+        14572, 14567, 14568, 14572, 14572, 14572, 14572, 14572, 14572, 14575, 14576, 14577, 14578, 14579, 14580, 14581,
+        14582, 14581, 14582, 14577, 14581, 14582, 14582, 14582, 14580, 14581, 14582, 14581, 14582, 14582, 14578, 14582,
+        14575, 14576, 14580, 14582, 14575, 14576, 14582, 14579, 14582, 14578, 14582, 14582, 14582, 14579, 14582, 14582,
+        14589, 14586, 14589, 14587, 14588, 14589, 14585, 14586, 14587, 14588, 14589, 14588, 14588, 14589, 14589, 14589,
+        14589, 14588, 14589, 14588, 14589, 14585, 14586, 14588, 14589, 14588, 14589, 14588, 14589, 14588, 14589, 14588,
+        14589, 14588, 14589, 14587, 14588, 14587, 14588, 14588, 14588, 14593, 14594, 14598, 14603, 14605, 14628, 14629,
+        14630, 14631, 14635, 14593, 14594, 14595, 14596, 14603, 14604, 14607, 14609, 14631, 14632, 14633, 14634, 14635,
+        14636, 14637, 14638, 14639, 14592, 14593, 14602, 14608, 14610, 14612, 14615, 14617, 14618, 14619, 14621, 14622,
+        14623, 14624, 14628, 14629, 14630, 14631, 14592, 14593, 14595, 14597, 14599, 14600, 14601, 14606, 14610, 14611,
+        14613, 14614, 14615, 14616, 14619, 14620, 14624, 14625, 14626, 14627, 14631, 14632, 14633, 14634, 14598, 14635,
+        14609, 14635, 14636, 14637, 14639, 14637, 14638, 14639, 14621, 14622, 14623, 14628, 14629, 14630, 14593, 14594,
+        14598, 14603, 14605, 14623, 14624, 14630, 14631, 14635, 14593, 14595, 14596, 14603, 14604, 14624, 14625, 14626,
+        14631, 14632, 14633, 14635, 14636, 14637, 14607, 14626, 14627, 14633, 14634, 14637, 14638, 14617, 14618, 14621,
+        14622, 14623, 14592, 14593, 14602, 14608, 14610, 14612, 14618, 14619, 14623, 14624, 14592, 14593, 14595, 14597,
+        14599, 14600, 14601, 14606, 14611, 14613, 14614, 14619, 14620, 14624, 14625, 14626, 14599, 14626, 14627, 14617,
+        14618, 14602, 14610, 14615, 14618, 14619, 14601, 14615, 14616, 14619, 14620, 14642, 14643, 14648, 14651, 14652,
+        14657, 14658, 14663, 14664, 14669, 14670, 14672, 14642, 14643, 14644, 14645, 14646, 14647, 14652, 14653, 14654,
+        14655, 14656, 14658, 14659, 14660, 14661, 14662, 14664, 14665, 14666, 14667, 14668, 14670, 14671, 14672, 14673,
+        14648, 14651, 14652, 14649, 14650, 14652, 14653, 14654, 14655, 14656, 14669, 14672, 14644, 14669, 14670, 14671,
+        14672, 14673, 14671, 14673, 14643, 14663, 14664, 14669, 14642, 14643, 14664, 14665, 14669, 14670, 14671, 14665,
+        14666, 14667, 14671, 14667, 14668, 14643, 14651, 14652, 14657, 14658, 14663, 14664, 14642, 14643, 14646, 14647,
+        14652, 14653, 14658, 14659, 14664, 14665, 14645, 14647, 14653, 14654, 14655, 14659, 14660, 14661, 14665, 14666,
+        14667, 14645, 14655, 14656, 14661, 14662, 14667, 14668, 14648, 14651, 14652, 14652, 14653, 14649, 14653, 14654,
+        14655, 14649, 14650, 14655, 14656, 14681, 14682, 14676, 14677, 14678, 14679, 14680, 14681, 14682, 14681, 14682,
+        14681, 14682, 14681, 14681, 14681, 14679, 14681, 14681, 14682, 14678, 14680, 14681, 14682, 14676, 14677, 14678,
+        14680, 14681, 14682, 14677, 14679, 14681, 14682, 14681, 14682, 14678, 14681, 14682, 14677, 14678, 14681, 14682,
+        14677, 14681, 14682, 14681, 14682, 14681, 14682, 14681, 14682, 14681, 14682, 14685, 14686, 14687, 14688, 14689,
+        14690, 14691, 14692, 14693, 14694, 14693, 14694, 14690, 14691, 14692, 14693, 14694, 14693, 14694, 14693, 14694,
+        14693, 14694, 14690, 14692, 14693, 14694, 14693, 14694, 14693, 14694, 14686, 14688, 14693, 14694, 14686, 14688,
+        14689, 14693, 14694, 14693, 14694, 14687, 14693, 14694, 14685, 14686, 14693, 14694, 14686, 14693, 14694, 14693,
+        14694, 14687, 14693, 14694, 14697, 14698, 14703, 14704, 14705, 14699, 14701, 14702, 14704, 14705, 14698, 14700,
+        14704, 14705, 14702, 14704, 14705, 14704, 14705, 14704, 14705, 14704, 14705, 14704, 14705, 14703, 14704, 14705,
+        14703, 14704, 14705, 14704, 14705, 14704, 14705, 14697, 14698, 14704, 14705, 14697, 14698, 14704, 14705, 14699,
+        14701, 14704, 14705, 14702, 14704, 14705, 14704, 14705, 14700, 14704, 14705, 14704, 14705, 14704, 14705, 14708,
+        14709, 14710, 14711, 14712, 14713, 14714, 14715, 14716, 14717, 14718, 14719, 14720, 14721, 14722, 14723, 14724,
+        14725, 14726, 14727, 14728, 14729, 14730, 14731, 14732, 14733, 14734, 14735, 14736, 14737, 14738, 14739, 14740,
+        14741, 14742, 14743, 14744, 14718, 14719, 14720, 14736, 14741, 14715, 14736, 14737, 14741, 14742, 14710, 14713,
+        14715, 14737, 14738, 14739, 14742, 14743, 14710, 14739, 14740, 14743, 14744, 14711, 14728, 14729, 14732, 14736,
+        14711, 14716, 14729, 14730, 14732, 14733, 14734, 14736, 14737, 14730, 14731, 14734, 14735, 14737, 14738, 14739,
+        14731, 14735, 14739, 14740, 14708, 14709, 14711, 14721, 14722, 14724, 14725, 14728, 14729, 14708, 14709, 14711,
+        14712, 14722, 14723, 14725, 14726, 14729, 14730, 14712, 14714, 14723, 14726, 14727, 14730, 14731, 14727, 14731,
+        14718, 14719, 14721, 14722, 14717, 14719, 14720, 14722, 14723, 14720, 14723, 14747, 14748, 14749, 14750, 14754,
+        14755, 14751, 14752, 14753, 14754, 14755, 14754, 14755, 14754, 14755, 14747, 14748, 14754, 14753, 14754, 14755,
+        14754, 14755, 14754, 14755, 14748, 14749, 14750, 14754, 14750, 14753, 14754, 14755, 14751, 14752, 14754, 14755,
+        14752, 14754, 14755, 14749, 14750, 14754, 14750, 14754, 14755, 14751, 14754, 14755, 14754, 14755, 14754, 14754,
+        14755, 14754, 14755, 14754, 14755, 14769, 14769, 14758, 14759, 14760, 14761, 14762, 14765, 14766, 14768, 14769,
+        14760, 14763, 14764, 14767, 14768, 14769, 14768, 14768, 14768, 14769, 14760, 14761, 14763, 14768, 14769, 14763,
+        14768, 14769, 14768, 14769, 14759, 14762, 14768, 14769, 14759, 14765, 14768, 14769, 14764, 14768, 14769, 14768,
+        14769, 14758, 14759, 14768, 14769, 14759, 14766, 14767, 14768, 14769, 14767, 14768, 14769, 14768, 14769, 14768,
+        14769, 14768, 14769, 14768, 14769, 14768, 14769, 14774, 14785, 14774, 14785, 14772, 14773, 14775, 14779, 14781,
+        14783, 14784, 14785, 14786, 14776, 14777, 14780, 14782, 14785, 14786, 14778, 14786, 14786, 14785, 14781, 14785,
+        14774, 14781, 14785, 14785, 14775, 14783, 14785, 14786, 14772, 14773, 14783, 14785, 14786, 14785, 14786, 14777,
+        14782, 14785, 14786, 14785, 14786, 14773, 14779, 14784, 14785, 14786, 14776, 14780, 14785, 14786, 14776, 14777,
+        14785, 14786, 14786, 14778, 14786, 14786, 14786, 14794, 14798, 14790, 14796, 14797, 14798, 14795, 14796, 14797,
+        14794, 14798, 14789, 14790, 14791, 14792, 14793, 14796, 14797, 14798, 14796, 14797, 14798, 14796, 14798, 14796,
+        14798, 14795, 14796, 14794, 14798, 14789, 14790, 14796, 14797, 14798, 14796, 14797, 14798, 14796, 14797, 14798,
+        14790, 14792, 14796, 14797, 14798, 14792, 14796, 14797, 14798, 14796, 14797, 14798, 14791, 14792, 14793, 14797,
+        14798, 14792, 14793, 14797, 14798, 14797, 14811, 14801, 14802, 14803, 14804, 14805, 14806, 14807, 14808, 14809,
+        14810, 14811, 14810, 14810, 14810, 14811, 14803, 14810, 14811, 14810, 14811, 14810, 14811, 14805, 14810, 14811,
+        14801, 14802, 14806, 14810, 14811, 14804, 14809, 14810, 14811, 14807, 14808, 14810, 14811, 14807, 14810, 14811,
+        14810, 14811, 14810, 14811, 14810, 14811, 14810, 14824, 14814, 14815, 14816, 14817, 14818, 14820, 14821, 14822,
+        14823, 14824, 14825, 14819, 14823, 14825, 14824, 14823, 14824, 14823, 14823, 14824, 14825, 14814, 14815, 14816,
+        14818, 14820, 14822, 14823, 14824, 14825, 14819, 14821, 14823, 14825, 14819, 14823, 14817, 14824, 14825, 14815,
+        14822, 14823, 14824, 14825, 14823, 14825, 14823, 14824, 14825, 14823, 14824, 14825, 14823, 14825, 14823, 14839,
+        14840, 14839, 14840, 14840, 14828, 14829, 14830, 14833, 14834, 14838, 14839, 14840, 14829, 14831, 14832, 14833,
+        14835, 14836, 14837, 14838, 14839, 14840, 14840, 14838, 14838, 14834, 14838, 14839, 14840, 14838, 14839, 14840,
+        14837, 14838, 14839, 14840, 14838, 14839, 14840, 14828, 14829, 14830, 14834, 14838, 14839, 14840, 14828, 14829,
+        14831, 14833, 14836, 14838, 14839, 14840, 14832, 14838, 14839, 14840, 14838, 14839, 14840, 14838, 14835, 14838,
+        14838, 14838, 14838, 14838, 14838, 14838, 14851, 14843, 14844, 14845, 14851, 14853, 14851, 14853, 14850, 14851,
+        14852, 14843, 14844, 14845, 14846, 14847, 14848, 14849, 14851, 14852, 14853, 14851, 14853, 14851, 14851, 14853,
+        14851, 14853, 14851, 14853, 14851, 14852, 14844, 14851, 14852, 14853, 14843, 14844, 14845, 14851, 14852, 14853,
+        14851, 14852, 14853, 14851, 14852, 14847, 14848, 14851, 14852, 14853, 14846, 14849, 14851, 14852, 14853, 14851,
+        14852, 14853, 14850, 14852, 14852, 14853, 14849, 14852, 14853, 14852, 14853, 14872, 14872, 14873, 14873, 14857,
+        14861, 14863, 14864, 14868, 14872, 14856, 14857, 14858, 14859, 14860, 14862, 14865, 14870, 14871, 14872, 14873,
+        14874, 14866, 14867, 14869, 14873, 14874, 14857, 14861, 14868, 14872, 14856, 14857, 14858, 14859, 14865, 14872,
+        14873, 14874, 14873, 14874, 14873, 14874, 14857, 14863, 14872, 14857, 14858, 14859, 14860, 14862, 14870, 14872,
+        14873, 14874, 14871, 14873, 14874, 14866, 14869, 14873, 14874, 14872, 14872, 14873, 14874, 14873, 14874, 14866,
+        14867, 14873, 14874, 14864, 14872, 14872, 14873, 14874, 14873, 14874, 14873, 14874, 14879, 14880, 14881, 14882,
+        14881, 14882, 14877, 14878, 14879, 14880, 14881, 14882, 14881, 14882, 14880, 14880, 14881, 14882, 14881, 14882,
+        14882, 14880, 14879, 14880, 14881, 14882, 14881, 14882, 14882, 14880, 14877, 14878, 14880, 14881, 14882, 14881,
+        14882, 14882, 14880, 14877, 14878, 14880, 14881, 14881, 14885, 14886, 14888, 14891, 14894, 14895, 14898, 14899,
+        14899, 14886, 14887, 14889, 14890, 14892, 14893, 14896, 14899, 14900, 14901, 14899, 14897, 14901, 14891, 14894,
+        14898, 14899, 14888, 14893, 14898, 14899, 14885, 14886, 14887, 14899, 14895, 14899, 14899, 14900, 14893, 14899,
+        14900, 14887, 14889, 14892, 14899, 14900, 14899, 14900, 14896, 14900, 14901, 14900, 14901, 14889, 14890, 14897,
+        14900, 14901, 14900, 14901, 14901, 14901, 14901, 14901, 14909, 14910, 14904, 14905, 14906, 14908, 14909, 14910,
+        14906, 14907, 14908, 14910, 14909, 14910, 14904, 14905, 14908, 14909, 14910, 14907, 14908, 14910, 14909, 14910,
+        14908, 14909, 14910, 14907, 14908, 14910, 14907, 14910, 14909, 14910, 14904, 14905, 14908, 14909, 14910, 14906,
+        14907, 14908, 14910, 14907, 14910, 14909, 14910, 14908, 14909, 14910, 14907, 14908, 14910, 14907, 14910, 14910,
+        14908, 14910, 14907, 14908, 14910, 14907, 14910, 14914, 14920, 14923, 14914, 14920, 14923, 14923, 14923, 14914,
+        14919, 14920, 14923, 14913, 14914, 14915, 14919, 14920, 14921, 14923, 14921, 14923, 14923, 14923, 14921, 14923,
+        14917, 14918, 14921, 14922, 14923, 14922, 14923, 14923, 14923, 14917, 14922, 14923, 14916, 14922, 14923, 14925,
+        14926, 14927, 14930, 14931, 14932, 14933, 14934, 14928, 14929, 14932, 14933, 14934, 14933, 14934, 14933, 14934,
+        14930, 14933, 14934, 14933, 14934, 14933, 14934, 14933, 14934, 14933, 14933, 14933, 14933, 14933, 14933, 14933,
+        14933, 14936, 14937, 14938, 14939, 14940, 14941, 14942, 14943, 14944, 14945, 14946, 14947, 14940, 14941, 14947,
+        14941, 14944, 14947, 14937, 14947, 14947, 14940, 14947, 14938, 14944, 14947, 14936, 14937, 14945, 14947, 14947,
+        14947, 14938, 14939, 14947, 14945, 14946, 14947, 14942, 14943, 14947, 14947, 14947, 14947, 14942, 14947, 14953,
+        14955, 14957, 14961, 14962, 14962, 14950, 14951, 14952, 14954, 14956, 14958, 14959, 14960, 14961, 14962, 14962,
+        14955, 14961, 14953, 14961, 14961, 14961, 14952, 14954, 14955, 14961, 14962, 14950, 14951, 14952, 14953, 14954,
+        14956, 14961, 14962, 14957, 14960, 14961, 14962, 14961, 14962, 14952, 14961, 14962, 14950, 14951, 14952, 14956,
+        14958, 14961, 14962, 14961, 14962, 14961, 14962, 14962, 14962, 14959, 14962, 14962, 14975, 14975, 14965, 14966,
+        14967, 14968, 14969, 14970, 14971, 14972, 14973, 14974, 14975, 14968, 14975, 14975, 14975, 14975, 14975, 14975,
+        14975, 14965, 14966, 14974, 14975, 14968, 14972, 14975, 14971, 14975, 14970, 14973, 14975, 14965, 14966, 14970,
+        14975, 14968, 14975, 14969, 14975, 14975, 14975, 14967, 14975, 14988, 14989, 14978, 14979, 14981, 14982, 14986,
+        14987, 14988, 14989, 14980, 14987, 14989, 14988, 14979, 14984, 14985, 14987, 14988, 14980, 14983, 14987, 14986,
+        14989, 14989, 14982, 14989, 14986, 14988, 14989, 14979, 14981, 14987, 14988, 14989, 14979, 14987, 14988, 14989,
+        14987, 14988, 14978, 14979, 14984, 14987, 14988, 14979, 14987, 14988, 14980, 14983, 14987, 14985, 14988, 14987,
+        14988, 14987, 14988, 14987, 14994, 14997, 15000, 15002, 14992, 14993, 14995, 14996, 14998, 14999, 15000, 15001,
+        15002, 14997, 15002, 14998, 15002, 14995, 14998, 15002, 15002, 14994, 14997, 15002, 14993, 15002, 14993, 15002,
+        15002, 15000, 15002, 14992, 14993, 14996, 15000, 15002, 14992, 14993, 14996, 14999, 15001, 15002, 14999, 15002,
+        15002, 14996, 15002, 14996, 14999, 15001, 15002, 14999, 15002, 15014, 15005, 15006, 15009, 15012, 15013, 15014,
+        15015, 15007, 15008, 15010, 15011, 15015, 15016, 15014, 15009, 15014, 15015, 15015, 15014, 15013, 15014, 15015,
+        15007, 15008, 15010, 15011, 15015, 15016, 15011, 15016, 15012, 15014, 15005, 15006, 15014, 15015, 15010, 15015,
+        15016, 15016, 15009, 15012, 15014, 15014, 15015, 15015, 15016, 15016, 15014, 15014, 15015, 15015, 15031, 15030,
+        15031, 15026, 15027, 15031, 15019, 15020, 15021, 15022, 15023, 15024, 15025, 15027, 15028, 15029, 15031, 15031,
+        15025, 15029, 15030, 15031, 15025, 15031, 15031, 15027, 15031, 15023, 15025, 15027, 15029, 15031, 15025, 15031,
+        15031, 15026, 15027, 15031, 15020, 15022, 15023, 15024, 15027, 15031, 15019, 15020, 15031, 15021, 15028, 15031,
+        15031, 15020, 15024, 15031, 15019, 15020, 15031, 15028, 15031, 15034, 15035, 15038, 15042, 15047, 15048, 15039,
+        15040, 15041, 15046, 15047, 15048, 15036, 15037, 15043, 15048, 15049, 15036, 15037, 15044, 15045, 15048, 15049,
+        15038, 15047, 15040, 15047, 15047, 15048, 15042, 15047, 15048, 15034, 15035, 15042, 15047, 15048, 15039, 15041,
+        15046, 15047, 15048, 15048, 15049, 15043, 15048, 15049, 15036, 15037, 15048, 15049, 15045, 15048, 15049, 15048,
+        15049, 15043, 15048, 15049, 15044, 15048, 15049, 15048, 15049, 15060, 15068, 15064, 15065, 15068, 15052, 15053,
+        15054, 15055, 15057, 15059, 15060, 15061, 15062, 15063, 15066, 15067, 15068, 15069, 15058, 15064, 15067, 15068,
+        15069, 15056, 15067, 15069, 15067, 15069, 15068, 15060, 15068, 15065, 15068, 15064, 15065, 15068, 15061, 15067,
+        15068, 15054, 15055, 15057, 15059, 15067, 15068, 15069, 15058, 15067, 15068, 15069, 15058, 15068, 15069, 15061,
+        15062, 15063, 15067, 15052, 15053, 15066, 15067, 15069, 15067, 15069, 15069, 15056, 15067, 15067, 15069, 15067,
+        15069, 15069, 15081, 15072, 15073, 15074, 15075, 15076, 15077, 15078, 15079, 15080, 15081, 15081, 15077, 15081,
+        15074, 15081, 15074, 15081, 15079, 15081, 15073, 15079, 15081, 15072, 15073, 15074, 15081, 15074, 15075, 15081,
+        15081, 15081, 15078, 15080, 15081, 15080, 15081, 15081, 15076, 15081, 15076, 15080, 15081, 15080, 15081, 15085,
+        15086, 15091, 15093, 15095, 15097, 15100, 15101, 15085, 15087, 15089, 15090, 15092, 15094, 15101, 15084, 15085,
+        15086, 15088, 15095, 15096, 15098, 15100, 15101, 15085, 15099, 15101, 15100, 15093, 15100, 15101, 15090, 15093,
+        15100, 15101, 15089, 15090, 15101, 15097, 15100, 15091, 15100, 15101, 15087, 15090, 15091, 15092, 15100, 15101,
+        15090, 15094, 15101, 15086, 15088, 15100, 15084, 15086, 15091, 15100, 15101, 15085, 15091, 15092, 15095, 15099,
+        15100, 15101, 15085, 15101, 15100, 15098, 15100, 15101, 15096, 15100, 15101, 15101, 15113, 15114, 15113, 15114,
+        15104, 15105, 15106, 15107, 15108, 15109, 15110, 15111, 15112, 15113, 15114, 15113, 15114, 15113, 15114, 15113,
+        15114, 15113, 15114, 15113, 15114, 15107, 15113, 15114, 15104, 15105, 15108, 15113, 15114, 15105, 15111, 15113,
+        15114, 15113, 15114, 15107, 15109, 15113, 15114, 15104, 15105, 15106, 15109, 15113, 15114, 15105, 15110, 15111,
+        15112, 15113, 15114, 15110, 15113, 15114, 15113, 15114, 15113, 15114, 15112, 15113, 15114, 15113, 15114, 15117,
+        15118, 15120, 15123, 15124, 15125, 15126, 15127, 15128, 15119, 15121, 15122, 15128, 15129, 15129, 15128, 15128,
+        15128, 15129, 15129, 15127, 15128, 15128, 15128, 15129, 15129, 15120, 15128, 15117, 15118, 15123, 15128, 15119,
+        15121, 15122, 15128, 15129, 15122, 15129, 15126, 15128, 15124, 15125, 15128, 15119, 15121, 15122, 15128, 15129,
+        15122, 15129, 15143, 15143, 15139, 15140, 15143, 15134, 15139, 15140, 15141, 15143, 15143, 15137, 15143, 15135,
+        15139, 15140, 15142, 15143, 15132, 15133, 15134, 15135, 15136, 15138, 15139, 15140, 15141, 15142, 15143, 15143,
+        15140, 15143, 15134, 15135, 15136, 15138, 15139, 15140, 15141, 15143, 15141, 15143, 15137, 15143, 15140, 15142,
+        15143, 15132, 15133, 15140, 15141, 15142, 15143, 15141, 15142, 15143, 15143, 15142, 15143, 15142, 15143, 15142,
+        15143, 15143, 15143, 15143, 15143, 15161, 15161, 15161, 15161, 15160, 15161, 15152, 15153, 15155, 15159, 15160,
+        15161, 15146, 15147, 15149, 15150, 15151, 15158, 15159, 15161, 15148, 15151, 15154, 15156, 15157, 15158, 15161,
+        15160, 15161, 15160, 15161, 15161, 15161, 15161, 15158, 15159, 15161, 15158, 15161, 15161, 15152, 15153, 15155,
+        15160, 15161, 15149, 15150, 15158, 15159, 15160, 15161, 15146, 15147, 15148, 15149, 15151, 15154, 15156, 15157,
+        15158, 15161, 15161, 15153, 15160, 15161, 15158, 15159, 15160, 15161, 15151, 15154, 15158, 15161, 15161, 15161,
+        15161, 15161, 15161, 15164, 15165, 15166, 15167, 15168, 15170, 15171, 15173, 15174, 15176, 15177, 15174, 15176,
+        15177, 15169, 15172, 15175, 15176, 15177, 15175, 15176, 15177, 15174, 15177, 15164, 15165, 15166, 15170, 15171,
+        15173, 15174, 15177, 15168, 15174, 15177, 15177, 15174, 15176, 15177, 15167, 15174, 15176, 15177, 15174, 15176,
+        15177, 15176, 15177, 15175, 15176, 15177, 15169, 15172, 15175, 15176, 15177, 15175, 15176, 15177, 15176, 15177,
+        15175, 15177, 15175, 15177, 15175, 15177, 15177, 15189, 15189, 15180, 15181, 15182, 15184, 15185, 15186, 15187,
+        15189, 15190, 15191, 15183, 15188, 15189, 15190, 15191, 15191, 15191, 15191, 15191, 15189, 15183, 15189, 15189,
+        15180, 15181, 15184, 15185, 15189, 15190, 15187, 15188, 15189, 15190, 15189, 15190, 15190, 15182, 15186, 15190,
+        15191, 15190, 15191, 15191, 15190, 15190, 15191, 15190, 15191, 15191, 15203, 15194, 15195, 15197, 15198, 15200,
+        15203, 15204, 15199, 15202, 15203, 15195, 15196, 15201, 15202, 15203, 15204, 15203, 15203, 15204, 15203, 15204,
+        15204, 15198, 15203, 15194, 15195, 15203, 15204, 15194, 15195, 15203, 15204, 15197, 15200, 15204, 15196, 15202,
+        15203, 15195, 15196, 15201, 15203, 15204, 15195, 15203, 15204, 15204, 15199, 15202, 15203, 15203, 15204, 15203,
+        15204, 15204, 15207, 15208, 15209, 15210, 15211, 15212, 15213, 15214, 15216, 15217, 15218, 15219, 15220, 15221,
+        15220, 15221, 15212, 15215, 15220, 15220, 15221, 15218, 15221, 15221, 15209, 15221, 15213, 15218, 15221, 15221,
+        15219, 15220, 15210, 15211, 15214, 15220, 15221, 15207, 15208, 15216, 15220, 15221, 15220, 15221, 15220, 15214,
+        15215, 15217, 15220, 15208, 15212, 15215, 15217, 15220, 15220, 15241, 15224, 15225, 15226, 15228, 15229, 15230,
+        15231, 15232, 15235, 15238, 15239, 15241, 15233, 15238, 15239, 15241, 15241, 15241, 15231, 15238, 15239, 15241,
+        15236, 15237, 15238, 15239, 15240, 15241, 15241, 15241, 15241, 15227, 15234, 15240, 15241, 15241, 15232, 15241,
+        15225, 15226, 15228, 15229, 15232, 15235, 15238, 15241, 15238, 15239, 15241, 15241, 15241, 15224, 15225, 15230,
+        15231, 15238, 15241, 15233, 15237, 15238, 15239, 15241, 15241, 15241, 15241, 15236, 15239, 15240, 15241, 15240,
+        15241, 15241, 15241, 15227, 15240, 15241, 15234, 15240, 15241, 15248, 15258, 15244, 15245, 15248, 15250, 15251,
+        15253, 15255, 15256, 15258, 15246, 15247, 15249, 15252, 15256, 15258, 15258, 15255, 15256, 15258, 15247, 15254,
+        15256, 15257, 15258, 15258, 15258, 15258, 15248, 15253, 15258, 15255, 15258, 15246, 15252, 15255, 15256, 15258,
+        15256, 15258, 15258, 15244, 15245, 15250, 15251, 15255, 15258, 15247, 15249, 15255, 15256, 15257, 15258, 15254,
+        15256, 15257, 15258, 15258, 15258, 15257, 15258, 15254, 15257, 15258, 15258, 15258, 15258, 15258, 15273, 15276,
+        15261, 15262, 15273, 15276, 15276, 15276, 15270, 15273, 15275, 15276, 15261, 15262, 15263, 15267, 15268, 15272,
+        15273, 15275, 15276, 15276, 15276, 15264, 15265, 15274, 15275, 15276, 15266, 15269, 15274, 15275, 15276, 15271,
+        15276, 15276, 15274, 15276, 15274, 15276, 15276, 15276, 15275, 15276, 15261, 15262, 15263, 15267, 15268, 15272,
+        15273, 15275, 15276, 15276, 15276, 15264, 15265, 15270, 15274, 15275, 15276, 15269, 15274, 15275, 15276, 15276,
+        15276, 15274, 15276, 15266, 15274, 15276, 15271, 15276, 15276, 15276, 15276, 15276, 15276, 15283, 15291, 15279,
+        15280, 15281, 15286, 15288, 15289, 15291, 15289, 15284, 15290, 15291, 15279, 15280, 15282, 15285, 15287, 15289,
+        15290, 15291, 15289, 15291, 15291, 15286, 15288, 15289, 15291, 15289, 15283, 15284, 15290, 15291, 15285, 15290,
+        15291, 15280, 15285, 15286, 15289, 15290, 15291, 15279, 15280, 15281, 15287, 15289, 15284, 15290, 15282, 15285,
+        15290, 15285, 15289, 15290, 15287, 15289, 15290, 15290, 15289, 15290, 15289, 15305, 15295, 15299, 15300, 15301,
+        15302, 15303, 15305, 15294, 15295, 15296, 15302, 15305, 15297, 15304, 15305, 15297, 15298, 15302, 15303, 15304,
+        15305, 15302, 15305, 15303, 15305, 15300, 15303, 15305, 15294, 15295, 15300, 15302, 15303, 15305, 15296, 15302,
+        15305, 15303, 15305, 15300, 15303, 15305, 15298, 15299, 15300, 15301, 15302, 15303, 15305, 15296, 15302, 15305,
+        15303, 15304, 15305, 15303, 15304, 15305, 15298, 15303, 15304, 15305, 15305, 15297, 15304, 15305, 15304, 15305,
+        15304, 15305, 15305, 15308, 15309, 15312, 15313, 15314, 15316, 15319, 15320, 15309, 15310, 15311, 15315, 15316,
+        15317, 15318, 15319, 15320, 15321, 15321, 15319, 15320, 15309, 15319, 15320, 15309, 15313, 15314, 15319, 15320,
+        15314, 15319, 15320, 15312, 15315, 15319, 15320, 15309, 15310, 15318, 15319, 15320, 15308, 15309, 15316, 15319,
+        15320, 15319, 15320, 15320, 15321, 15320, 15321, 15311, 15320, 15321, 15317, 15320, 15321, 15321, 15321, 15321,
+        15321, 15332, 15324, 15325, 15326, 15327, 15328, 15329, 15330, 15331, 15332, 15331, 15331, 15332, 15331, 15332,
+        15331, 15332, 15331, 15332, 15331, 15332, 15331, 15332, 15327, 15329, 15330, 15331, 15332, 15326, 15329, 15331,
+        15332, 15331, 15332, 15328, 15331, 15332, 15325, 15328, 15331, 15332, 15324, 15325, 15331, 15332, 15331, 15328,
+        15331, 15328, 15331, 15331, 15347, 15335, 15336, 15338, 15339, 15340, 15342, 15346, 15347, 15348, 15341, 15347,
+        15337, 15341, 15343, 15344, 15345, 15347, 15348, 15348, 15346, 15348, 15348, 15347, 15348, 15336, 15338, 15342,
+        15347, 15348, 15335, 15336, 15340, 15347, 15348, 15340, 15347, 15348, 15337, 15341, 15347, 15348, 15337, 15339,
+        15342, 15344, 15347, 15348, 15347, 15348, 15347, 15348, 15341, 15347, 15343, 15344, 15347, 15345, 15347, 15347,
+        15355, 15360, 15361, 15351, 15352, 15353, 15355, 15356, 15357, 15358, 15359, 15360, 15361, 15360, 15352, 15354,
+        15360, 15361, 15361, 15361, 15359, 15361, 15360, 15361, 15357, 15358, 15360, 15361, 15360, 15361, 15359, 15360,
+        15361, 15355, 15360, 15352, 15353, 15356, 15357, 15360, 15360, 15360, 15360, 15351, 15352, 15360, 15354, 15360,
+        15360, 15367, 15374, 15375, 15369, 15374, 15364, 15365, 15370, 15372, 15373, 15374, 15375, 15376, 15366, 15368,
+        15369, 15371, 15374, 15375, 15367, 15375, 15374, 15375, 15374, 15375, 15376, 15367, 15375, 15376, 15372, 15374,
+        15375, 15376, 15366, 15369, 15371, 15374, 15376, 15376, 15364, 15365, 15372, 15374, 15376, 15366, 15374, 15376,
+        15370, 15376, 15365, 15368, 15373, 15374, 15376, 15368, 15374, 15381, 15383, 15384, 15386, 15391, 15379, 15380,
+        15382, 15385, 15387, 15388, 15389, 15390, 15391, 15391, 15387, 15390, 15391, 15391, 15389, 15391, 15389, 15389,
+        15381, 15383, 15384, 15386, 15391, 15380, 15382, 15386, 15389, 15390, 15391, 15379, 15380, 15385, 15388, 15389,
+        15390, 15389, 15390, 15391, 15380, 15387, 15389, 15390, 15391, 15380, 15387, 15389, 15390, 15389, 15390, 15390,
+        15390, 15390, 15394, 15395, 15397, 15399, 15400, 15401, 15403, 15404, 15405, 15406, 15430, 15431, 15434, 15435,
+        15436, 15437, 15398, 15405, 15406, 15431, 15432, 15433, 15435, 15437, 15433, 15417, 15421, 15425, 15406, 15417,
+        15418, 15419, 15421, 15422, 15425, 15426, 15427, 15430, 15431, 15406, 15419, 15420, 15422, 15423, 15424, 15427,
+        15428, 15429, 15431, 15432, 15433, 15420, 15424, 15428, 15429, 15433, 15409, 15412, 15417, 15438, 15396, 15402,
+        15407, 15409, 15410, 15412, 15413, 15414, 15417, 15418, 15419, 15438, 15407, 15408, 15410, 15411, 15414, 15415,
+        15419, 15420, 15438, 15408, 15411, 15415, 15416, 15420, 15438, 15438, 15407, 15438, 15407, 15408, 15438, 15408,
+        15438, 15449, 15452, 15440, 15441, 15442, 15449, 15452, 15452, 15452, 15449, 15450, 15452, 15446, 15448, 15449,
+        15450, 15451, 15452, 15445, 15451, 15452, 15447, 15451, 15452, 15444, 15450, 15452, 15443, 15448, 15450, 15451,
+        15452, 15451, 15452, 15451, 15452, 15452, 15452, 15452, 15452, 15461, 15461, 15458, 15461, 15461, 15461, 15461,
+        15454, 15455, 15458, 15461, 15461, 15456, 15459, 15461, 15456, 15459, 15460, 15461, 15460, 15461, 15461, 15459,
+        15461, 15457, 15459, 15460, 15461, 15460, 15461, 15461, 15463, 15464, 15467, 15468, 15469, 15471, 15471, 15471,
+        15471, 15465, 15466, 15469, 15470, 15471, 15470, 15471, 15471, 15471, 15466, 15470, 15471, 15470, 15471, 15471,
+        15471, 15471, 15471, 15471, 15471, 15481, 15484, 15484, 15484, 15484, 15473, 15474, 15477, 15481, 15483, 15484,
+        15484, 15484, 15484, 15475, 15476, 15478, 15481, 15482, 15483, 15484, 15484, 15484, 15484, 15479, 15480, 15482,
+        15483, 15484, 15484, 15484, 15484, 15486, 15487, 15488, 15495, 15498, 15489, 15491, 15495, 15496, 15498, 15496,
+        15498, 15496, 15498, 15488, 15495, 15498, 15490, 15492, 15495, 15496, 15498, 15493, 15496, 15498, 15496, 15498,
+        15495, 15498, 15494, 15495, 15496, 15497, 15498, 15496, 15497, 15498, 15496, 15497, 15498, 15498, 15497, 15498,
+        15497, 15498, 15497, 15498, 15507, 15509, 15506, 15509, 15506, 15509, 15509, 15509, 15501, 15509, 15501, 15502,
+        15509, 15502, 15504, 15508, 15509, 15503, 15509, 15501, 15505, 15509, 15500, 15501, 15502, 15509, 15502, 15504,
+        15509, 15503, 15509, 15505, 15509, 15509, 15509, 15519, 15520, 15522, 15511, 15512, 15513, 15514, 15518, 15519,
+        15520, 15521, 15522, 15515, 15521, 15522, 15522, 15520, 15522, 15513, 15520, 15521, 15522, 15516, 15521, 15522,
+        15522, 15522, 15522, 15522, 15522, 15522, 15522, 15522, 15517, 15522, 15538, 15535, 15538, 15524, 15525, 15526,
+        15529, 15530, 15533, 15534, 15535, 15538, 15535, 15538, 15538, 15535, 15536, 15538, 15526, 15527, 15531, 15535,
+        15536, 15538, 15535, 15538, 15537, 15538, 15528, 15536, 15537, 15538, 15528, 15536, 15538, 15538, 15537, 15538,
+        15532, 15537, 15538, 15538, 15538, 15545, 15551, 15552, 15542, 15546, 15549, 15550, 15552, 15552, 15547, 15551,
+        15552, 15553, 15540, 15541, 15543, 15544, 15548, 15549, 15552, 15553, 15552, 15553, 15553, 15553, 15553, 15553,
+        15553, 15553, 15553, 15553, 15553, 15573, 15574, 15575, 15576, 15577, 15578, 15563, 15565, 15578, 15579, 15580,
+        15581, 15563, 15564, 15565, 15566, 15567, 15571, 15572, 15573, 15575, 15567, 15568, 15569, 15576, 15577, 15578,
+        15561, 15563, 15569, 15570, 15578, 15579, 15580, 15561, 15562, 15563, 15564, 15557, 15566, 15567, 15557, 15558,
+        15567, 15568, 15569, 15558, 15559, 15561, 15569, 15570, 15559, 15560, 15561, 15562, 15556, 15557, 15556, 15557,
+        15558, 15556, 15558, 15583, 15584, 15585, 15586, 15585, 15586, 15585, 15586, 15585, 15586, 15585, 15586, 15584,
+        15585, 15586, 15583, 15584, 15585, 15586, 15584, 15585, 15586, 15585, 15586, 15584, 15586, 15584, 15586, 15584,
+        15586, 15586, 15586, 15586, 15586, 15586, 15589, 15590, 15591, 15592, 15593, 15594, 15590, 15592, 15594, 15590,
+        15594, 15590, 15593, 15594, 15590, 15591, 15593, 15594, 15591, 15594, 15590, 15594, 15589, 15590, 15594, 15590,
+        15591, 15592, 15594, 15591, 15592, 15594, 15590, 15594, 15590, 15594, 15590, 15594, 15594, 15594, 15594, 15594,
+        15594, 15600, 15597, 15598, 15599, 15600, 15600, 15598, 15600, 15598, 15600, 15600, 15600, 15597, 15598, 15599,
+        15600, 15598, 15599, 15600, 15600, 15600, 15599, 15600, 15599, 15600, 15600, 15600, 15600, 15600, 15600, 15616,
+        15616, 15615, 15615, 15616, 15616, 15606, 15612, 15613, 15614, 15615, 15614, 15615, 15603, 15604, 15605, 15607,
+        15608, 15609, 15610, 15611, 15614, 15614, 15616, 15616, 15615, 15615, 15616, 15616, 15606, 15612, 15613, 15614,
+        15615, 15614, 15615, 15603, 15604, 15605, 15607, 15608, 15609, 15610, 15611, 15614, 15614, 15624, 15639, 15640,
+        15641, 15642, 15643, 15644, 15645, 15646, 15647, 15648, 15649, 15650, 15651, 15652, 15653, 15619, 15620, 15621,
+        15622, 15623, 15625, 15626, 15627, 15628, 15629, 15630, 15631, 15632, 15633, 15634, 15635, 15636, 15637, 15638,
+        15639, 15640, 15641, 15642, 15643, 15647, 15648, 15650, 15651, 15653, 15624, 15648, 15649, 15651, 15652, 15653,
+        15649, 15652, 15639, 15644, 15639, 15640, 15641, 15644, 15645, 15647, 15648, 15641, 15642, 15645, 15646, 15648,
+        15649, 15642, 15643, 15649, 15623, 15633, 15634, 15639, 15620, 15623, 15630, 15634, 15635, 15639, 15640, 15641,
+        15619, 15620, 15622, 15630, 15631, 15635, 15636, 15637, 15641, 15642, 15631, 15632, 15637, 15638, 15642, 15643,
+        15620, 15626, 15628, 15630, 15619, 15620, 15621, 15625, 15626, 15627, 15628, 15629, 15630, 15631, 15627, 15629,
+        15631, 15632, 15656, 15657, 15658, 15659, 15660, 15661, 15662, 15663, 15664, 15665, 15667, 15668, 15669, 15670,
+        15658, 15668, 15669, 15670, 15666, 15669, 15666, 15669, 15661, 15668, 15665, 15667, 15668, 15670, 15668, 15670,
+        15668, 15670, 15656, 15657, 15659, 15660, 15663, 15668, 15656, 15657, 15662, 15664, 15667, 15668, 15670, 15668,
+        15670, 15668, 15670, 15668, 15668, 15669, 15670, 15658, 15666, 15668, 15669, 15670, 15668, 15669, 15670, 15669,
+        15666, 15669, 15669, 15693, 15694, 15675, 15676, 15682, 15684, 15687, 15693, 15694, 15688, 15692, 15693, 15694,
+        15673, 15674, 15675, 15677, 15678, 15679, 15680, 15681, 15683, 15685, 15686, 15687, 15689, 15690, 15691, 15692,
+        15693, 15694, 15693, 15693, 15676, 15682, 15684, 15693, 15693, 15688, 15693, 15694, 15681, 15687, 15692, 15693,
+        15694, 15675, 15685, 15692, 15693, 15694, 15692, 15693, 15694, 15674, 15683, 15686, 15691, 15692, 15694, 15677,
+        15679, 15689, 15691, 15692, 15694, 15692, 15694, 15673, 15674, 15680, 15690, 15692, 15694, 15678, 15689, 15692,
+        15694, 15692, 15715, 15697, 15698, 15699, 15701, 15702, 15703, 15705, 15707, 15710, 15711, 15712, 15713, 15714,
+        15715, 15700, 15709, 15715, 15716, 15717, 15704, 15705, 15706, 15707, 15708, 15714, 15715, 15716, 15717, 15715,
+        15699, 15701, 15702, 15713, 15715, 15712, 15713, 15715, 15717, 15697, 15698, 15710, 15715, 15717, 15702, 15703,
+        15705, 15707, 15710, 15711, 15714, 15715, 15717, 15711, 15715, 15717, 15716, 15717, 15706, 15709, 15716, 15717,
+        15704, 15716, 15717, 15716, 15717, 15700, 15716, 15717, 15708, 15716, 15717, 15716, 15717, 15716, 15717, 15732,
+        15722, 15723, 15725, 15727, 15729, 15730, 15731, 15732, 15733, 15734, 15732, 15733, 15720, 15721, 15724, 15726,
+        15728, 15733, 15734, 15721, 15733, 15732, 15722, 15723, 15732, 15732, 15732, 15729, 15732, 15734, 15722, 15728,
+        15729, 15732, 15733, 15734, 15721, 15725, 15727, 15730, 15731, 15732, 15733, 15734, 15732, 15733, 15734, 15724,
+        15726, 15728, 15733, 15734, 15720, 15721, 15733, 15734, 15733, 15734, 15733, 15734, 15733, 15734, 15733, 15737,
+        15738, 15742, 15743, 15744, 15745, 15746, 15747, 15750, 15752, 15753, 15754, 15742, 15752, 15753, 15739, 15740,
+        15741, 15748, 15749, 15751, 15753, 15754, 15753, 15752, 15744, 15752, 15750, 15752, 15752, 15752, 15753, 15737,
+        15738, 15747, 15752, 15753, 15737, 15738, 15742, 15743, 15745, 15752, 15753, 15742, 15752, 15753, 15749, 15753,
+        15754, 15739, 15740, 15753, 15754, 15740, 15746, 15753, 15754, 15753, 15748, 15753, 15754, 15741, 15751, 15753,
+        15754, 15753, 15754, 15753, 15759, 15760, 15765, 15767, 15769, 15770, 15771, 15772, 15774, 15775, 15776, 15777,
+        15778, 15779, 15780, 15757, 15758, 15760, 15761, 15762, 15763, 15764, 15766, 15768, 15770, 15773, 15775, 15778,
+        15780, 15779, 15780, 15780, 15759, 15774, 15778, 15778, 15778, 15779, 15767, 15769, 15770, 15772, 15777, 15778,
+        15779, 15780, 15760, 15770, 15775, 15778, 15780, 15768, 15778, 15780, 15771, 15779, 15765, 15767, 15769, 15776,
+        15777, 15779, 15780, 15757, 15758, 15760, 15761, 15762, 15763, 15764, 15766, 15773, 15780, 15762, 15780, 15779,
+        15779, 15780, 15773, 15780, 15780, 15789, 15792, 15793, 15796, 15797, 15798, 15805, 15806, 15794, 15803, 15805,
+        15806, 15783, 15784, 15786, 15788, 15791, 15795, 15796, 15801, 15804, 15805, 15806, 15785, 15787, 15790, 15791,
+        15799, 15800, 15802, 15803, 15804, 15805, 15806, 15789, 15793, 15805, 15792, 15797, 15798, 15805, 15806, 15794,
+        15805, 15806, 15806, 15789, 15804, 15805, 15783, 15788, 15796, 15797, 15804, 15805, 15806, 15785, 15794, 15800,
+        15802, 15803, 15804, 15805, 15806, 15803, 15806, 15784, 15795, 15804, 15784, 15786, 15791, 15804, 15806, 15785,
+        15790, 15799, 15802, 15803, 15804, 15806, 15803, 15806, 15801, 15804, 15791, 15804, 15806, 15803, 15804, 15806,
+        15787, 15803, 15806, 15812, 15814, 15816, 15818, 15820, 15824, 15809, 15810, 15813, 15815, 15817, 15819, 15821,
+        15822, 15823, 15824, 15825, 15825, 15811, 15825, 15825, 15816, 15818, 15820, 15824, 15812, 15815, 15818, 15824,
+        15814, 15824, 15824, 15823, 15824, 15815, 15821, 15822, 15823, 15824, 15810, 15823, 15824, 15823, 15824, 15823,
+        15825, 15823, 15825, 15809, 15810, 15817, 15819, 15823, 15825, 15813, 15823, 15825, 15825, 15825, 15811, 15825,
+        15811, 15825, 15840, 15840, 15829, 15830, 15834, 15835, 15836, 15839, 15840, 15841, 15829, 15833, 15837, 15838,
+        15840, 15841, 15842, 15828, 15829, 15841, 15828, 15829, 15831, 15832, 15833, 15841, 15842, 15840, 15834, 15840,
+        15840, 15840, 15841, 15834, 15835, 15840, 15841, 15842, 15840, 15841, 15842, 15842, 15830, 15836, 15841, 15828,
+        15829, 15839, 15841, 15842, 15829, 15837, 15838, 15841, 15842, 15833, 15842, 15841, 15828, 15829, 15832, 15841,
+        15842, 15829, 15831, 15832, 15841, 15842, 15831, 15842, 15849, 15894, 15895, 15894, 15845, 15846, 15847, 15848,
+        15851, 15854, 15855, 15856, 15858, 15859, 15860, 15861, 15868, 15869, 15873, 15874, 15875, 15877, 15878, 15879,
+        15883, 15884, 15885, 15890, 15894, 15895, 15852, 15853, 15857, 15860, 15862, 15869, 15870, 15871, 15872, 15875,
+        15876, 15879, 15880, 15881, 15882, 15885, 15886, 15887, 15888, 15889, 15890, 15891, 15892, 15893, 15894, 15863,
+        15864, 15868, 15869, 15850, 15864, 15865, 15866, 15867, 15869, 15870, 15871, 15872, 15895, 15894, 15895, 15849,
+        15894, 15894, 15895, 15848, 15859, 15894, 15895, 15856, 15857, 15861, 15890, 15891, 15892, 15894, 15892, 15893,
+        15894, 15858, 15895, 15846, 15847, 15873, 15877, 15878, 15883, 15884, 15894, 15895, 15845, 15846, 15852, 15855,
+        15873, 15874, 15875, 15876, 15878, 15879, 15880, 15884, 15885, 15886, 15887, 15890, 15891, 15892, 15894, 15862,
+        15876, 15880, 15881, 15882, 15887, 15888, 15889, 15892, 15893, 15894, 15895, 15854, 15868, 15873, 15895, 15850,
+        15851, 15853, 15860, 15863, 15864, 15865, 15868, 15869, 15870, 15871, 15873, 15874, 15875, 15876, 15853, 15865,
+        15866, 15867, 15871, 15872, 15876, 15909, 15913, 15914, 15915, 15918, 15919, 15920, 15923, 15926, 15927, 15930,
+        15933, 15898, 15899, 15901, 15902, 15903, 15904, 15905, 15908, 15910, 15911, 15912, 15915, 15916, 15917, 15920,
+        15921, 15922, 15923, 15924, 15925, 15927, 15928, 15929, 15930, 15931, 15932, 15933, 15934, 15935, 15936, 15910,
+        15911, 15900, 15907, 15910, 15912, 15906, 15910, 15905, 15926, 15927, 15930, 15931, 15933, 15934, 15911, 15927,
+        15928, 15929, 15931, 15932, 15934, 15935, 15936, 15911, 15911, 15902, 15909, 15918, 15919, 15920, 15923, 15924,
+        15926, 15927, 15899, 15901, 15911, 15920, 15921, 15922, 15924, 15925, 15927, 15928, 15929, 15898, 15899, 15903,
+        15904, 15911, 15903, 15911, 15909, 15913, 15914, 15915, 15918, 15919, 15920, 15908, 15910, 15911, 15912, 15915,
+        15916, 15917, 15920, 15921, 15922, 15900, 15907, 15910, 15911, 15906, 15910, 15911, 15910, 15907, 15910, 15910,
+        15943, 15958, 15959, 15958, 15959, 15959, 15959, 15951, 15958, 15959, 15947, 15949, 15952, 15955, 15956, 15958,
+        15959, 15946, 15952, 15956, 15957, 15959, 15957, 15959, 15958, 15959, 15939, 15940, 15945, 15953, 15955, 15956,
+        15958, 15959, 15940, 15948, 15954, 15956, 15957, 15959, 15941, 15942, 15950, 15957, 15959, 15959, 15959, 15944,
+        15957, 15959, 15957, 15959, 15985, 15986, 15985, 15986, 15978, 15983, 15986, 15963, 15973, 15976, 15983, 15986,
+        15985, 15986, 15964, 15966, 15977, 15980, 15984, 15985, 15986, 15962, 15966, 15969, 15971, 15972, 15979, 15981,
+        15983, 15984, 15986, 15961, 15962, 15963, 15974, 15983, 15986, 15985, 15986, 15965, 15984, 15985, 15986, 15968,
+        15975, 15982, 15983, 15984, 15986, 15983, 15986, 15985, 15986, 15967, 15970, 15984, 15985, 15986, 15984, 15986,
+        15986, 16006, 15993, 15996, 16003, 16006, 15996, 16003, 16005, 16006, 16005, 16006, 16006, 15991, 15992, 16000,
+        16003, 16006, 15999, 16001, 16003, 16005, 16006, 15994, 16005, 16006, 16004, 16006, 15988, 15989, 15990, 15998,
+        16002, 16003, 16004, 16006, 15990, 16003, 16004, 16005, 16006, 16005, 16006, 15995, 16004, 16006, 15997, 16004,
+        16006, 16004, 16006, 16006, 16010, 16017, 16024, 16027, 16019, 16020, 16024, 16025, 16027, 16025, 16027, 16025,
+        16027, 16008, 16009, 16022, 16024, 16027, 16011, 16020, 16022, 16023, 16024, 16025, 16027, 16018, 16025, 16027,
+        16025, 16027, 16016, 16021, 16024, 16026, 16027, 16014, 16021, 16024, 16025, 16026, 16027, 16012, 16014, 16025,
+        16026, 16027, 16012, 16013, 16015, 16025, 16027, 16026, 16027, 16026, 16027, 16026, 16027, 16027, 16034, 16044,
+        16045, 16034, 16044, 16045, 16037, 16044, 16045, 16044, 16045, 16042, 16044, 16045, 16031, 16042, 16044, 16045,
+        16029, 16030, 16032, 16033, 16035, 16036, 16039, 16040, 16042, 16044, 16045, 16041, 16042, 16044, 16045, 16042,
+        16045, 16042, 16045, 16042, 16043, 16045, 16042, 16043, 16045, 16045, 16045, 16038, 16043, 16045, 16038, 16043,
+        16045, 16075, 16047, 16048, 16049, 16054, 16056, 16058, 16063, 16064, 16075, 16049, 16052, 16063, 16067, 16075,
+        16076, 16076, 16075, 16063, 16064, 16075, 16050, 16059, 16063, 16065, 16071, 16075, 16076, 16050, 16051, 16065,
+        16066, 16076, 16075, 16075, 16073, 16075, 16076, 16053, 16055, 16057, 16060, 16068, 16069, 16070, 16072, 16076,
+        16061, 16073, 16076, 16062, 16068, 16072, 16074, 16076, 16099, 16102, 16078, 16079, 16096, 16098, 16099, 16102,
+        16082, 16084, 16085, 16101, 16102, 16101, 16102, 16080, 16086, 16099, 16102, 16087, 16088, 16089, 16091, 16092,
+        16094, 16095, 16099, 16102, 16081, 16083, 16090, 16093, 16100, 16101, 16102, 16100, 16101, 16102, 16102, 16097,
+        16102, 16100, 16102, 16100, 16102, 16102, 16102, 16102, 16102, 16121, 16122, 16120, 16121, 16122, 16120, 16122,
+        16112, 16120, 16122, 16121, 16122, 16109, 16119, 16120, 16121, 16122, 16107, 16114, 16117, 16119, 16120, 16122,
+        16114, 16119, 16120, 16122, 16115, 16116, 16121, 16122, 16119, 16121, 16122, 16105, 16106, 16111, 16113, 16119,
+        16122, 16104, 16105, 16106, 16119, 16122, 16121, 16122, 16118, 16119, 16121, 16122, 16110, 16119, 16122, 16108,
+        16119, 16122, 16143, 16140, 16143, 16129, 16132, 16137, 16140, 16143, 16140, 16143, 16142, 16143, 16124, 16125,
+        16140, 16142, 16143, 16124, 16125, 16130, 16134, 16135, 16136, 16140, 16141, 16142, 16143, 16128, 16130, 16140,
+        16141, 16143, 16142, 16143, 16131, 16133, 16142, 16143, 16126, 16138, 16141, 16142, 16143, 16139, 16141, 16143,
+        16142, 16143, 16142, 16143, 16127, 16141, 16142, 16143, 16127, 16141, 16143, 16161, 16150, 16157, 16159, 16161,
+        16159, 16161, 16161, 16161, 16158, 16159, 16161, 16147, 16149, 16151, 16155, 16156, 16158, 16159, 16160, 16161,
+        16160, 16161, 16161, 16158, 16161, 16145, 16146, 16148, 16154, 16158, 16160, 16161, 16153, 16160, 16161, 16161,
+        16158, 16161, 16152, 16158, 16160, 16161, 16152, 16160, 16161, 16178, 16179, 16174, 16175, 16176, 16178, 16179,
+        16176, 16178, 16179, 16176, 16179, 16179, 16173, 16176, 16179, 16163, 16164, 16166, 16169, 16170, 16171, 16172,
+        16176, 16179, 16176, 16179, 16179, 16168, 16176, 16179, 16164, 16165, 16167, 16176, 16177, 16179, 16176, 16177,
+        16179, 16179, 16179, 16165, 16177, 16179, 16177, 16179, 16198, 16183, 16196, 16198, 16183, 16184, 16188, 16195,
+        16196, 16197, 16198, 16197, 16198, 16198, 16183, 16196, 16198, 16181, 16182, 16183, 16184, 16186, 16189, 16191,
+        16195, 16196, 16197, 16198, 16185, 16187, 16192, 16193, 16197, 16198, 16190, 16198, 16194, 16198, 16198, 16198,
+        16198, 16198, 16198, 16198, 16214, 16214, 16211, 16214, 16205, 16211, 16214, 16214, 16212, 16214, 16200, 16201,
+        16203, 16204, 16211, 16212, 16214, 16208, 16211, 16214, 16213, 16214, 16202, 16207, 16210, 16212, 16213, 16214,
+        16202, 16206, 16209, 16212, 16214, 16214, 16213, 16214, 16213, 16214, 16214, 16214, 16230, 16230, 16228, 16230,
+        16228, 16230, 16230, 16230, 16228, 16230, 16226, 16227, 16228, 16230, 16230, 16221, 16229, 16230, 16230, 16216,
+        16217, 16218, 16219, 16222, 16223, 16224, 16225, 16227, 16230, 16230, 16220, 16229, 16230, 16230, 16222, 16224,
+        16227, 16230, 16277, 16278, 16283, 16284, 16285, 16244, 16255, 16278, 16279, 16280, 16283, 16284, 16280, 16281,
+        16282, 16283, 16282, 16237, 16246, 16251, 16256, 16265, 16266, 16271, 16277, 16278, 16285, 16236, 16250, 16255,
+        16266, 16267, 16268, 16271, 16272, 16273, 16278, 16279, 16280, 16268, 16269, 16270, 16273, 16274, 16280, 16281,
+        16282, 16270, 16274, 16275, 16276, 16282, 16271, 16238, 16241, 16247, 16248, 16249, 16250, 16257, 16261, 16262,
+        16271, 16272, 16273, 16232, 16233, 16234, 16235, 16239, 16241, 16248, 16252, 16262, 16263, 16273, 16274, 16243,
+        16254, 16263, 16264, 16274, 16275, 16276, 16240, 16248, 16249, 16258, 16261, 16262, 16240, 16242, 16245, 16248,
+        16253, 16258, 16259, 16260, 16262, 16263, 16260, 16263, 16264, 16307, 16307, 16308, 16309, 16310, 16311, 16310,
+        16297, 16298, 16302, 16303, 16298, 16299, 16303, 16304, 16307, 16299, 16300, 16301, 16304, 16305, 16306, 16307,
+        16308, 16309, 16310, 16301, 16306, 16310, 16288, 16289, 16296, 16297, 16298, 16289, 16290, 16298, 16299, 16290,
+        16291, 16294, 16299, 16300, 16301, 16294, 16295, 16301, 16287, 16288, 16289, 16287, 16289, 16291, 16292, 16293,
+        16294, 16292, 16293, 16294, 16295, 16317, 16318, 16316, 16313, 16314, 16315,
+};
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // __INTERNAL_RESTRICTED_OVERLAPS_H__
@@ -0,0 +1,16306 @@
+/*
+ * Copyright (C) 2014-2019 Stichting Mapcode Foundation (http://www.mapcode.com)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __INTERNAL_TERRITORY_NAME_INDEX_H__
+#define __INTERNAL_TERRITORY_NAME_INDEX_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// *** GENERATED FILE (tools/generate_territory_name_index.py), DO NOT CHANGE OR PRETTIFY ***
+
+#define NAME_FOLD_LOW_END 0x0700
+#define NAME_FOLD_HIGH_START 0x1E00
+#define NAME_FOLD_HIGH_END 0x2000
+#define NAME_FOLD_SIZE (NAME_FOLD_LOW_END + NAME_FOLD_HIGH_END - NAME_FOLD_HIGH_START)
+
+// utf8 of the lowercase character without diacritics, for characters 0..NAME_FOLD_LOW_END-1,
+// followed by NAME_FOLD_HIGH_START..NAME_FOLD_HIGH_END-1 (other characters fold to themselves)
+static const char NAME_FOLD[NAME_FOLD_SIZE][4] = {
+        "\x00", "\x01", "\x02", "\x03", "\x04", "\x05", "\x06", "\x07",
+        "\x08", "\x09", "\x0a", "\x0b", "\x0c", "\x0d", "\x0e", "\x0f",
+        "\x10", "\x11", "\x12", "\x13", "\x14", "\x15", "\x16", "\x17",
+        "\x18", "\x19", "\x1a", "\x1b", "\x1c", "\x1d", "\x1e", "\x1f",
+        " ", "!", "\"", "#", "$", "%", "&", "'",
+        "(", ")", "*", "+", ",", "-", ".", "/",
+        "0", "1", "2", "3", "4", "5", "6", "7",
+        "8", "9", ":", ";", "<", "=", ">", "?",
+        "@", "a", "b", "c", "d", "e", "f", "g",
+        "h", "i", "j", "k", "l", "m", "n", "o",
+        "p", "q", "r", "s", "t", "u", "v", "w",
+        "x", "y", "z", "[", "\\", "]", "^", "_",
+        "`", "a", "b", "c", "d", "e", "f", "g",
+        "h", "i", "j", "k", "l", "m", "n", "o",
+        "p", "q", "r", "s", "t", "u", "v", "w",
+        "x", "y", "z", "{", "|", "}", "~", "\x7f",
+        "\xc2\x80", "\xc2\x81", "\xc2\x82", "\xc2\x83", "\xc2\x84", "\xc2\x85", "\xc2\x86", "\xc2\x87",
+        "\xc2\x88", "\xc2\x89", "\xc2\x8a", "\xc2\x8b", "\xc2\x8c", "\xc2\x8d", "\xc2\x8e", "\xc2\x8f",
+        "\xc2\x90", "\xc2\x91", "\xc2\x92", "\xc2\x93", "\xc2\x94", "\xc2\x95", "\xc2\x96", "\xc2\x97",
+        "\xc2\x98", "\xc2\x99", "\xc2\x9a", "\xc2\x9b", "\xc2\x9c", "\xc2\x9d", "\xc2\x9e", "\xc2\x9f",
+        " ", "\xc2\xa1", "\xc2\xa2", "\xc2\xa3", "\xc2\xa4", "\xc2\xa5", "\xc2\xa6", "\xc2\xa7",
+        " ", "\xc2\xa9", "a", "\xc2\xab", "\xc2\xac", "\xc2\xad", "\xc2\xae", " ",
+        "\xc2\xb0", "\xc2\xb1", "2", "3", " ", "\xce\xbc", "\xc2\xb6", "\xc2\xb7",
+        " ", "1", "o", "\xc2\xbb", "\xc2\xbc", "\xc2\xbd", "\xc2\xbe", "\xc2\xbf",
+        "a", "a", "a", "a", "a", "a", "\xc3\xa6", "c",
+        "e", "e", "e", "e", "i", "i", "i", "i",
+        "\xc3\xb0", "n", "o", "o", "o", "o", "o", "\xc3\x97",
+        "\xc3\xb8", "u", "u", "u", "u", "y", "\xc3\xbe", "\xc3\x9f",
+        "a", "a", "a", "a", "a", "a", "\xc3\xa6", "c",
+        "e", "e", "e", "e", "i", "i", "i", "i",
+        "\xc3\xb0", "n", "o", "o", "o", "o", "o", "\xc3\xb7",
+        "\xc3\xb8", "u", "u", "u", "u", "y", "\xc3\xbe", "y",
+        "a", "a", "a", "a", "a", "a", "c", "c",
+        "c", "c", "c", "c", "c", "c", "d", "d",
+        "\xc4\x91", "\xc4\x91", "e", "e", "e", "e", "e", "e",
+        "e", "e", "e", "e", "g", "g", "g", "g",
+        "g", "g", "g", "g", "h", "h", "\xc4\xa7", "\xc4\xa7",
+        "i", "i", "i", "i", "i", "i", "i", "i",
+        "i", "\xc4\xb1", "ij", "ij", "j", "j", "k", "k",
+        "\xc4\xb8", "l", "l", "l", "l", "l", "l", "\x6c\xc2\xb7",
+        "\x6c\xc2\xb7", "\xc5\x82", "\xc5\x82", "n", "n", "n", "n", "n",
+        "n", "\xca\xbc\x6e", "\xc5\x8b", "\xc5\x8b", "o", "o", "o", "o",
+        "o", "o", "\xc5\x93", "\xc5\x93", "r", "r", "r", "r",
+        "r", "r", "s", "s", "s", "s", "s", "s",
+        "s", "s", "t", "t", "t", "t", "\xc5\xa7", "\xc5\xa7",
+        "u", "u", "u", "u", "u", "u", "u", "u",
+        "u", "u", "u", "u", "w", "w", "y", "y",
+        "y", "z", "z", "z", "z", "z", "z", "s",
+        "\xc6\x80", "\xc9\x93", "\xc6\x83", "\xc6\x83", "\xc6\x85", "\xc6\x85", "\xc9\x94", "\xc6\x88",
+        "\xc6\x88", "\xc9\x96", "\xc9\x97", "\xc6\x8c", "\xc6\x8c", "\xc6\x8d", "\xc7\x9d", "\xc9\x99",
+        "\xc9\x9b", "\xc6\x92", "\xc6\x92", "\xc9\xa0", "\xc9\xa3", "\xc6\x95", "\xc9\xa9", "\xc9\xa8",
+        "\xc6\x99", "\xc6\x99", "\xc6\x9a", "\xc6\x9b", "\xc9\xaf", "\xc9\xb2", "\xc6\x9e", "\xc9\xb5",
+        "o", "o", "\xc6\xa3", "\xc6\xa3", "\xc6\xa5", "\xc6\xa5", "\xca\x80", "\xc6\xa8",
+        "\xc6\xa8", "\xca\x83", "\xc6\xaa", "\xc6\xab", "\xc6\xad", "\xc6\xad", "\xca\x88", "u",
+        "u", "\xca\x8a", "\xca\x8b", "\xc6\xb4", "\xc6\xb4", "\xc6\xb6", "\xc6\xb6", "\xca\x92",
+        "\xc6\xb9", "\xc6\xb9", "\xc6\xba", "\xc6\xbb", "\xc6\xbd", "\xc6\xbd", "\xc6\xbe", "\xc6\xbf",
+        "\xc7\x80", "\xc7\x81", "\xc7\x82", "\xc7\x83", "dz", "dz", "dz", "lj",
+        "lj", "lj", "nj", "nj", "nj", "a", "a", "i",
+        "i", "o", "o", "u", "u", "u", "u", "u",
+        "u", "u", "u", "u", "u", "\xc7\x9d", "a", "a",
+        "a", "a", "\xc3\xa6", "\xc3\xa6", "\xc7\xa5", "\xc7\xa5", "g", "g",
+        "k", "k", "o", "o", "o", "o", "\xca\x92", "\xca\x92",
+        "j", "dz", "dz", "dz", "g", "g", "\xc6\x95", "\xc6\xbf",
+        "n", "n", "a", "a", "\xc3\xa6", "\xc3\xa6", "\xc3\xb8", "\xc3\xb8",
+        "a", "a", "a", "a", "e", "e", "e", "e",
+        "i", "i", "i", "i", "o", "o", "o", "o",
+        "r", "r", "r", "r", "u", "u", "u", "u",
+        "s", "s", "t", "t", "\xc8\x9d", "\xc8\x9d", "h", "h",
+        "\xc6\x9e", "\xc8\xa1", "\xc8\xa3", "\xc8\xa3", "\xc8\xa5", "\xc8\xa5", "a", "a",
+        "e", "e", "o", "o", "o", "o", "o", "o",
+        "o", "o", "y", "y", "\xc8\xb4", "\xc8\xb5", "\xc8\xb6", "\xc8\xb7",
+        "\xc8\xb8", "\xc8\xb9", "\xe2\xb1\xa5", "\xc8\xbc", "\xc8\xbc", "\xc6\x9a", "\xe2\xb1\xa6", "\xc8\xbf",
+        "\xc9\x80", "\xc9\x82", "\xc9\x82", "\xc6\x80", "\xca\x89", "\xca\x8c", "\xc9\x87", "\xc9\x87",
+        "\xc9\x89", "\xc9\x89", "\xc9\x8b", "\xc9\x8b", "\xc9\x8d", "\xc9\x8d", "\xc9\x8f", "\xc9\x8f",
+        "\xc9\x90", "\xc9\x91", "\xc9\x92", "\xc9\x93", "\xc9\x94", "\xc9\x95", "\xc9\x96", "\xc9\x97",
+        "\xc9\x98", "\xc9\x99", "\xc9\x9a", "\xc9\x9b", "\xc9\x9c", "\xc9\x9d", "\xc9\x9e", "\xc9\x9f",
+        "\xc9\xa0", "\xc9\xa1", "\xc9\xa2", "\xc9\xa3", "\xc9\xa4", "\xc9\xa5", "\xc9\xa6", "\xc9\xa7",
+        "\xc9\xa8", "\xc9\xa9", "\xc9\xaa", "\xc9\xab", "\xc9\xac", "\xc9\xad", "\xc9\xae", "\xc9\xaf",
+        "\xc9\xb0", "\xc9\xb1", "\xc9\xb2", "\xc9\xb3", "\xc9\xb4", "\xc9\xb5", "\xc9\xb6", "\xc9\xb7",
+        "\xc9\xb8", "\xc9\xb9", "\xc9\xba", "\xc9\xbb", "\xc9\xbc", "\xc9\xbd", "\xc9\xbe", "\xc9\xbf",
+        "\xca\x80", "\xca\x81", "\xca\x82", "\xca\x83", "\xca\x84", "\xca\x85", "\xca\x86", "\xca\x87",
+        "\xca\x88", "\xca\x89", "\xca\x8a", "\xca\x8b", "\xca\x8c", "\xca\x8d", "\xca\x8e", "\xca\x8f",
+        "\xca\x90", "\xca\x91", "\xca\x92", "\xca\x93", "\xca\x94", "\xca\x95", "\xca\x96", "\xca\x97",
+        "\xca\x98", "\xca\x99", "\xca\x9a", "\xca\x9b", "\xca\x9c", "\xca\x9d", "\xca\x9e", "\xca\x9f",
+        "\xca\xa0", "\xca\xa1", "\xca\xa2", "\xca\xa3", "\xca\xa4", "\xca\xa5", "\xca\xa6", "\xca\xa7",
+        "\xca\xa8", "\xca\xa9", "\xca\xaa", "\xca\xab", "\xca\xac", "\xca\xad", "\xca\xae", "\xca\xaf",
+        "h", "\xc9\xa6", "j", "r", "\xc9\xb9", "\xc9\xbb", "\xca\x81", "w",
+        "y", "\xca\xb9", "\xca\xba", "\xca\xbb", "\xca\xbc", "\xca\xbd", "\xca\xbe", "\xca\xbf",
+        "\xcb\x80", "\xcb\x81", "\xcb\x82", "\xcb\x83", "\xcb\x84", "\xcb\x85", "\xcb\x86", "\xcb\x87",
+        "\xcb\x88", "\xcb\x89", "\xcb\x8a", "\xcb\x8b", "\xcb\x8c", "\xcb\x8d", "\xcb\x8e", "\xcb\x8f",
+        "\xcb\x90", "\xcb\x91", "\xcb\x92", "\xcb\x93", "\xcb\x94", "\xcb\x95", "\xcb\x96", "\xcb\x97",
+        " ", " ", " ", " ", " ", " ", "\xcb\x9e", "\xcb\x9f",
+        "\xc9\xa3", "l", "s", "x", "\xca\x95", "\xcb\xa5", "\xcb\xa6", "\xcb\xa7",
+        "\xcb\xa8", "\xcb\xa9", "\xcb\xaa", "\xcb\xab", "\xcb\xac", "\xcb\xad", "\xcb\xae", "\xcb\xaf",
+        "\xcb\xb0", "\xcb\xb1", "\xcb\xb2", "\xcb\xb3", "\xcb\xb4", "\xcb\xb5", "\xcb\xb6", "\xcb\xb7",
+        "\xcb\xb8", "\xcb\xb9", "\xcb\xba", "\xcb\xbb", "\xcb\xbc", "\xcb\xbd", "\xcb\xbe", "\xcb\xbf",
+        "", "", "", "", "", "", "", "",
+        "", "", "", "", "", "", "", "",
+        "", "", "", "", "", "", "", "",
+        "", "", "", "", "", "", "", "",
+        "", "", "", "", "", "", "", "",
+        "", "", "", "", "", "", "", "",
+        "", "", "", "", "", "", "", "",
+        "", "", "", "", "", "", "", "",
+        "", "", "", "", "", "", "", "",
+        "", "", "", "", "", "", "", "\xcd\x8f",
+        "", "", "", "", "", "", "", "",
+        "", "", "", "", "", "", "", "",
+        "", "", "", "", "", "", "", "",
+        "", "", "", "", "", "", "", "",
+        "\xcd\xb1", "\xcd\xb1", "\xcd\xb3", "\xcd\xb3", "\xca\xb9", "\xcd\xb5", "\xcd\xb7", "\xcd\xb7",
+        "\xcd\xb8", "\xcd\xb9", " ", "\xcd\xbb", "\xcd\xbc", "\xcd\xbd", ";", "\xcf\xb3",
+        "\xce\x80", "\xce\x81", "\xce\x82", "\xce\x83", " ", " ", "\xce\xb1", "\xc2\xb7",
+        "\xce\xb5", "\xce\xb7", "\xce\xb9", "\xce\x8b", "\xce\xbf", "\xce\x8d", "\xcf\x85", "\xcf\x89",
+        "\xce\xb9", "\xce\xb1", "\xce\xb2", "\xce\xb3", "\xce\xb4", "\xce\xb5", "\xce\xb6", "\xce\xb7",
+        "\xce\xb8", "\xce\xb9", "\xce\xba", "\xce\xbb", "\xce\xbc", "\xce\xbd", "\xce\xbe", "\xce\xbf",
+        "\xcf\x80", "\xcf\x81", "\xce\xa2", "\xcf\x83", "\xcf\x84", "\xcf\x85", "\xcf\x86", "\xcf\x87",
+        "\xcf\x88", "\xcf\x89", "\xce\xb9", "\xcf\x85", "\xce\xb1", "\xce\xb5", "\xce\xb7", "\xce\xb9",
+        "\xcf\x85", "\xce\xb1", "\xce\xb2", "\xce\xb3", "\xce\xb4", "\xce\xb5", "\xce\xb6", "\xce\xb7",
+        "\xce\xb8", "\xce\xb9", "\xce\xba", "\xce\xbb", "\xce\xbc", "\xce\xbd", "\xce\xbe", "\xce\xbf",
+        "\xcf\x80", "\xcf\x81", "\xcf\x83", "\xcf\x83", "\xcf\x84", "\xcf\x85", "\xcf\x86", "\xcf\x87",
+        "\xcf\x88", "\xcf\x89", "\xce\xb9", "\xcf\x85", "\xce\xbf", "\xcf\x85", "\xcf\x89", "\xcf\x97",
+        "\xce\xb2", "\xce\xb8", "\xcf\x85", "\xcf\x85", "\xcf\x85", "\xcf\x86", "\xcf\x80", "\xcf\x97",
+        "\xcf\x99", "\xcf\x99", "\xcf\x9b", "\xcf\x9b", "\xcf\x9d", "\xcf\x9d", "\xcf\x9f", "\xcf\x9f",
+        "\xcf\xa1", "\xcf\xa1", "\xcf\xa3", "\xcf\xa3", "\xcf\xa5", "\xcf\xa5", "\xcf\xa7", "\xcf\xa7",
+        "\xcf\xa9", "\xcf\xa9", "\xcf\xab", "\xcf\xab", "\xcf\xad", "\xcf\xad", "\xcf\xaf", "\xcf\xaf",
+        "\xce\xba", "\xcf\x81", "\xcf\x83", "\xcf\xb3", "\xce\xb8", "\xce\xb5", "\xcf\xb6", "\xcf\xb8",
+        "\xcf\xb8", "\xcf\x83", "\xcf\xbb", "\xcf\xbb", "\xcf\xbc", "\xcd\xbb", "\xcd\xbc", "\xcd\xbd",
+        "\xd0\xb5", "\xd0\xb5", "\xd1\x92", "\xd0\xb3", "\xd1\x94", "\xd1\x95", "\xd1\x96", "\xd1\x96",
+        "\xd1\x98", "\xd1\x99", "\xd1\x9a", "\xd1\x9b", "\xd0\xba", "\xd0\xb8", "\xd1\x83", "\xd1\x9f",
+        "\xd0\xb0", "\xd0\xb1", "\xd0\xb2", "\xd0\xb3", "\xd0\xb4", "\xd0\xb5", "\xd0\xb6", "\xd0\xb7",
+        "\xd0\xb8", "\xd0\xb8", "\xd0\xba", "\xd0\xbb", "\xd0\xbc", "\xd0\xbd", "\xd0\xbe", "\xd0\xbf",
+        "\xd1\x80", "\xd1\x81", "\xd1\x82", "\xd1\x83", "\xd1\x84", "\xd1\x85", "\xd1\x86", "\xd1\x87",
+        "\xd1\x88", "\xd1\x89", "\xd1\x8a", "\xd1\x8b", "\xd1\x8c", "\xd1\x8d", "\xd1\x8e", "\xd1\x8f",
+        "\xd0\xb0", "\xd0\xb1", "\xd0\xb2", "\xd0\xb3", "\xd0\xb4", "\xd0\xb5", "\xd0\xb6", "\xd0\xb7",
+        "\xd0\xb8", "\xd0\xb8", "\xd0\xba", "\xd0\xbb", "\xd0\xbc", "\xd0\xbd", "\xd0\xbe", "\xd0\xbf",
+        "\xd1\x80", "\xd1\x81", "\xd1\x82", "\xd1\x83", "\xd1\x84", "\xd1\x85", "\xd1\x86", "\xd1\x87",
+        "\xd1\x88", "\xd1\x89", "\xd1\x8a", "\xd1\x8b", "\xd1\x8c", "\xd1\x8d", "\xd1\x8e", "\xd1\x8f",
+        "\xd0\xb5", "\xd0\xb5", "\xd1\x92", "\xd0\xb3", "\xd1\x94", "\xd1\x95", "\xd1\x96", "\xd1\x96",
+        "\xd1\x98", "\xd1\x99", "\xd1\x9a", "\xd1\x9b", "\xd0\xba", "\xd0\xb8", "\xd1\x83", "\xd1\x9f",
+        "\xd1\xa1", "\xd1\xa1", "\xd1\xa3", "\xd1\xa3", "\xd1\xa5", "\xd1\xa5", "\xd1\xa7", "\xd1\xa7",
+        "\xd1\xa9", "\xd1\xa9", "\xd1\xab", "\xd1\xab", "\xd1\xad", "\xd1\xad", "\xd1\xaf", "\xd1\xaf",
+        "\xd1\xb1", "\xd1\xb1", "\xd1\xb3", "\xd1\xb3", "\xd1\xb5", "\xd1\xb5", "\xd1\xb5", "\xd1\xb5",
+        "\xd1\xb9", "\xd1\xb9", "\xd1\xbb", "\xd1\xbb", "\xd1\xbd", "\xd1\xbd", "\xd1\xbf", "\xd1\xbf",
+        "\xd2\x81", "\xd2\x81", "\xd2\x82", "", "", "", "", "",
+        "\xd2\x88", "\xd2\x89", "\xd2\x8b", "\xd2\x8b", "\xd2\x8d", "\xd2\x8d", "\xd2\x8f", "\xd2\x8f",
+        "\xd2\x91", "\xd2\x91", "\xd2\x93", "\xd2\x93", "\xd2\x95", "\xd2\x95", "\xd2\x97", "\xd2\x97",
+        "\xd2\x99", "\xd2\x99", "\xd2\x9b", "\xd2\x9b", "\xd2\x9d", "\xd2\x9d", "\xd2\x9f", "\xd2\x9f",
+        "\xd2\xa1", "\xd2\xa1", "\xd2\xa3", "\xd2\xa3", "\xd2\xa5", "\xd2\xa5", "\xd2\xa7", "\xd2\xa7",
+        "\xd2\xa9", "\xd2\xa9", "\xd2\xab", "\xd2\xab", "\xd2\xad", "\xd2\xad", "\xd2\xaf", "\xd2\xaf",
+        "\xd2\xb1", "\xd2\xb1", "\xd2\xb3", "\xd2\xb3", "\xd2\xb5", "\xd2\xb5", "\xd2\xb7", "\xd2\xb7",
+        "\xd2\xb9", "\xd2\xb9", "\xd2\xbb", "\xd2\xbb", "\xd2\xbd", "\xd2\xbd", "\xd2\xbf", "\xd2\xbf",
+        "\xd3\x8f", "\xd0\xb6", "\xd0\xb6", "\xd3\x84", "\xd3\x84", "\xd3\x86", "\xd3\x86", "\xd3\x88",
+        "\xd3\x88", "\xd3\x8a", "\xd3\x8a", "\xd3\x8c", "\xd3\x8c", "\xd3\x8e", "\xd3\x8e", "\xd3\x8f",
+        "\xd0\xb0", "\xd0\xb0", "\xd0\xb0", "\xd0\xb0", "\xd3\x95", "\xd3\x95", "\xd0\xb5", "\xd0\xb5",
+        "\xd3\x99", "\xd3\x99", "\xd3\x99", "\xd3\x99", "\xd0\xb6", "\xd0\xb6", "\xd0\xb7", "\xd0\xb7",
+        "\xd3\xa1", "\xd3\xa1", "\xd0\xb8", "\xd0\xb8", "\xd0\xb8", "\xd0\xb8", "\xd0\xbe", "\xd0\xbe",
+        "\xd3\xa9", "\xd3\xa9", "\xd3\xa9", "\xd3\xa9", "\xd1\x8d", "\xd1\x8d", "\xd1\x83", "\xd1\x83",
+        "\xd1\x83", "\xd1\x83", "\xd1\x83", "\xd1\x83", "\xd1\x87", "\xd1\x87", "\xd3\xb7", "\xd3\xb7",
+        "\xd1\x8b", "\xd1\x8b", "\xd3\xbb", "\xd3\xbb", "\xd3\xbd", "\xd3\xbd", "\xd3\xbf", "\xd3\xbf",
+        "\xd4\x81", "\xd4\x81", "\xd4\x83", "\xd4\x83", "\xd4\x85", "\xd4\x85", "\xd4\x87", "\xd4\x87",
+        "\xd4\x89", "\xd4\x89", "\xd4\x8b", "\xd4\x8b", "\xd4\x8d", "\xd4\x8d", "\xd4\x8f", "\xd4\x8f",
+        "\xd4\x91", "\xd4\x91", "\xd4\x93", "\xd4\x93", "\xd4\x95", "\xd4\x95", "\xd4\x97", "\xd4\x97",
+        "\xd4\x99", "\xd4\x99", "\xd4\x9b", "\xd4\x9b", "\xd4\x9d", "\xd4\x9d", "\xd4\x9f", "\xd4\x9f",
+        "\xd4\xa1", "\xd4\xa1", "\xd4\xa3", "\xd4\xa3", "\xd4\xa5", "\xd4\xa5", "\xd4\xa7", "\xd4\xa7",
+        "\xd4\xa9", "\xd4\xa9", "\xd4\xab", "\xd4\xab", "\xd4\xad", "\xd4\xad", "\xd4\xaf", "\xd4\xaf",
+        "\xd4\xb0", "\xd5\xa1", "\xd5\xa2", "\xd5\xa3", "\xd5\xa4", "\xd5\xa5", "\xd5\xa6", "\xd5\xa7",
+        "\xd5\xa8", "\xd5\xa9", "\xd5\xaa", "\xd5\xab", "\xd5\xac", "\xd5\xad", "\xd5\xae", "\xd5\xaf",
+        "\xd5\xb0", "\xd5\xb1", "\xd5\xb2", "\xd5\xb3", "\xd5\xb4", "\xd5\xb5", "\xd5\xb6", "\xd5\xb7",
+        "\xd5\xb8", "\xd5\xb9", "\xd5\xba", "\xd5\xbb", "\xd5\xbc", "\xd5\xbd", "\xd5\xbe", "\xd5\xbf",
+        "\xd6\x80", "\xd6\x81", "\xd6\x82", "\xd6\x83", "\xd6\x84", "\xd6\x85", "\xd6\x86", "\xd5\x97",
+        "\xd5\x98", "\xd5\x99", "\xd5\x9a", "\xd5\x9b", "\xd5\x9c", "\xd5\x9d", "\xd5\x9e", "\xd5\x9f",
+        "\xd5\xa0", "\xd5\xa1", "\xd5\xa2", "\xd5\xa3", "\xd5\xa4", "\xd5\xa5", "\xd5\xa6", "\xd5\xa7",
+        "\xd5\xa8", "\xd5\xa9", "\xd5\xaa", "\xd5\xab", "\xd5\xac", "\xd5\xad", "\xd5\xae", "\xd5\xaf",
+        "\xd5\xb0", "\xd5\xb1", "\xd5\xb2", "\xd5\xb3", "\xd5\xb4", "\xd5\xb5", "\xd5\xb6", "\xd5\xb7",
+        "\xd5\xb8", "\xd5\xb9", "\xd5\xba", "\xd5\xbb", "\xd5\xbc", "\xd5\xbd", "\xd5\xbe", "\xd5\xbf",
+        "\xd6\x80", "\xd6\x81", "\xd6\x82", "\xd6\x83", "\xd6\x84", "\xd6\x85", "\xd6\x86", "\xd6\x87",
+        "\xd6\x88", "\xd6\x89", "\xd6\x8a", "\xd6\x8b", "\xd6\x8c", "\xd6\x8d", "\xd6\x8e", "\xd6\x8f",
+        "\xd6\x90", "", "", "", "", "", "", "",
+        "", "", "", "", "", "", "", "",
+        "", "", "", "", "", "", "", "",
+        "", "", "", "", "", "", "", "",
+        "", "", "", "", "", "", "", "",
+        "", "", "", "", "", "", "\xd6\xbe", "",
+        "\xd7\x80", "", "", "\xd7\x83", "", "", "\xd7\x86", "",
+        "\xd7\x88", "\xd7\x89", "\xd7\x8a", "\xd7\x8b", "\xd7\x8c", "\xd7\x8d", "\xd7\x8e", "\xd7\x8f",
+        "\xd7\x90", "\xd7\x91", "\xd7\x92", "\xd7\x93", "\xd7\x94", "\xd7\x95", "\xd7\x96", "\xd7\x97",
+        "\xd7\x98", "\xd7\x99", "\xd7\x9a", "\xd7\x9b", "\xd7\x9c", "\xd7\x9d", "\xd7\x9e", "\xd7\x9f",
+        "\xd7\xa0", "\xd7\xa1", "\xd7\xa2", "\xd7\xa3", "\xd7\xa4", "\xd7\xa5", "\xd7\xa6", "\xd7\xa7",
+        "\xd7\xa8", "\xd7\xa9", "\xd7\xaa", "\xd7\xab", "\xd7\xac", "\xd7\xad", "\xd7\xae", "\xd7\xaf",
+        "\xd7\xb0", "\xd7\xb1", "\xd7\xb2", "\xd7\xb3", "\xd7\xb4", "\xd7\xb5", "\xd7\xb6", "\xd7\xb7",
+        "\xd7\xb8", "\xd7\xb9", "\xd7\xba", "\xd7\xbb", "\xd7\xbc", "\xd7\xbd", "\xd7\xbe", "\xd7\xbf",
+        "\xd8\x80", "\xd8\x81", "\xd8\x82", "\xd8\x83", "\xd8\x84", "\xd8\x85", "\xd8\x86", "\xd8\x87",
+        "\xd8\x88", "\xd8\x89", "\xd8\x8a", "\xd8\x8b", "\xd8\x8c", "\xd8\x8d", "\xd8\x8e", "\xd8\x8f",
+        "", "", "", "", "", "", "", "",
+        "", "", "", "\xd8\x9b", "\xd8\x9c", "\xd8\x9d", "\xd8\x9e", "\xd8\x9f",
+        "\xd8\xa0", "\xd8\xa1", "\xd8\xa7", "\xd8\xa7", "\xd9\x88", "\xd8\xa7", "\xd9\x8a", "\xd8\xa7",
+        "\xd8\xa8", "\xd8\xa9", "\xd8\xaa", "\xd8\xab", "\xd8\xac", "\xd8\xad", "\xd8\xae", "\xd8\xaf",
+        "\xd8\xb0", "\xd8\xb1", "\xd8\xb2", "\xd8\xb3", "\xd8\xb4", "\xd8\xb5", "\xd8\xb6", "\xd8\xb7",
+        "\xd8\xb8", "\xd8\xb9", "\xd8\xba", "\xd8\xbb", "\xd8\xbc", "\xd8\xbd", "\xd8\xbe", "\xd8\xbf",
+        "\xd9\x80", "\xd9\x81", "\xd9\x82", "\xd9\x83", "\xd9\x84", "\xd9\x85", "\xd9\x86", "\xd9\x87",
+        "\xd9\x88", "\xd9\x89", "\xd9\x8a", "", "", "", "", "",
+        "", "", "", "", "", "", "", "",
+        "", "", "", "", "", "", "", "",
+        "\xd9\xa0", "\xd9\xa1", "\xd9\xa2", "\xd9\xa3", "\xd9\xa4", "\xd9\xa5", "\xd9\xa6", "\xd9\xa7",
+        "\xd9\xa8", "\xd9\xa9", "\xd9\xaa", "\xd9\xab", "\xd9\xac", "\xd9\xad", "\xd9\xae", "\xd9\xaf",
+        "", "\xd9\xb1", "\xd9\xb2", "\xd9\xb3", "\xd9\xb4", "\xd9\xb5", "\xd9\xb6", "\xd9\xb7",
+        "\xd9\xb8", "\xd9\xb9", "\xd9\xba", "\xd9\xbb", "\xd9\xbc", "\xd9\xbd", "\xd9\xbe", "\xd9\xbf",
+        "\xda\x80", "\xda\x81", "\xda\x82", "\xda\x83", "\xda\x84", "\xda\x85", "\xda\x86", "\xda\x87",
+        "\xda\x88", "\xda\x89", "\xda\x8a", "\xda\x8b", "\xda\x8c", "\xda\x8d", "\xda\x8e", "\xda\x8f",
+        "\xda\x90", "\xda\x91", "\xda\x92", "\xda\x93", "\xda\x94", "\xda\x95", "\xda\x96", "\xda\x97",
+        "\xda\x98", "\xda\x99", "\xda\x9a", "\xda\x9b", "\xda\x9c", "\xda\x9d", "\xda\x9e", "\xda\x9f",
+        "\xda\xa0", "\xda\xa1", "\xda\xa2", "\xda\xa3", "\xda\xa4", "\xda\xa5", "\xda\xa6", "\xda\xa7",
+        "\xda\xa8", "\xda\xa9", "\xda\xaa", "\xda\xab", "\xda\xac", "\xda\xad", "\xda\xae", "\xda\xaf",
+        "\xda\xb0", "\xda\xb1", "\xda\xb2", "\xda\xb3", "\xda\xb4", "\xda\xb5", "\xda\xb6", "\xda\xb7",
+        "\xda\xb8", "\xda\xb9", "\xda\xba", "\xda\xbb", "\xda\xbc", "\xda\xbd", "\xda\xbe", "\xda\xbf",
+        "\xdb\x95", "\xdb\x81", "\xdb\x81", "\xdb\x83", "\xdb\x84", "\xdb\x85", "\xdb\x86", "\xdb\x87",
+        "\xdb\x88", "\xdb\x89", "\xdb\x8a", "\xdb\x8b", "\xdb\x8c", "\xdb\x8d", "\xdb\x8e", "\xdb\x8f",
+        "\xdb\x90", "\xdb\x91", "\xdb\x92", "\xdb\x92", "\xdb\x94", "\xdb\x95", "", "",
+        "", "", "", "", "", "\xdb\x9d", "\xdb\x9e", "",
+        "", "", "", "", "", "\xdb\xa5", "\xdb\xa6", "",
+        "", "\xdb\xa9", "", "", "", "", "\xdb\xae", "\xdb\xaf",
+        "\xdb\xb0", "\xdb\xb1", "\xdb\xb2", "\xdb\xb3", "\xdb\xb4", "\xdb\xb5", "\xdb\xb6", "\xdb\xb7",
+        "\xdb\xb8", "\xdb\xb9", "\xdb\xba", "\xdb\xbb", "\xdb\xbc", "\xdb\xbd", "\xdb\xbe", "\xdb\xbf",
+        "a", "a", "b", "b", "b", "b", "b", "b",
+        "c", "c", "d", "d", "d", "d", "d", "d",
+        "d", "d", "d", "d", "e", "e", "e", "e",
+        "e", "e", "e", "e", "e", "e", "f", "f",
+        "g", "g", "h", "h", "h", "h", "h", "h",
+        "h", "h", "h", "h", "i", "i", "i", "i",
+        "k", "k", "k", "k", "k", "k", "l", "l",
+        "l", "l", "l", "l", "l", "l", "m", "m",
+        "m", "m", "m", "m", "n", "n", "n", "n",
+        "n", "n", "n", "n", "o", "o", "o", "o",
+        "o", "o", "o", "o", "p", "p", "p", "p",
+        "r", "r", "r", "r", "r", "r", "r", "r",
+        "s", "s", "s", "s", "s", "s", "s", "s",
+        "s", "s", "t", "t", "t", "t", "t", "t",
+        "t", "t", "u", "u", "u", "u", "u", "u",
+        "u", "u", "u", "u", "v", "v", "v", "v",
+        "w", "w", "w", "w", "w", "w", "w", "w",
+        "w", "w", "x", "x", "x", "x", "y", "y",
+        "z", "z", "z", "z", "z", "z", "h", "t",
+        "w", "y", "\x61\xca\xbe", "s", "\xe1\xba\x9c", "\xe1\xba\x9d", "\xc3\x9f", "\xe1\xba\x9f",
+        "a", "a", "a", "a", "a", "a", "a", "a",
+        "a", "a", "a", "a", "a", "a", "a", "a",
+        "a", "a", "a", "a", "a", "a", "a", "a",
+        "e", "e", "e", "e", "e", "e", "e", "e",
+        "e", "e", "e", "e", "e", "e", "e", "e",
+        "i", "i", "i", "i", "o", "o", "o", "o",
+        "o", "o", "o", "o", "o", "o", "o", "o",
+        "o", "o", "o", "o", "o", "o", "o", "o",
+        "o", "o", "o", "o", "u", "u", "u", "u",
+        "u", "u", "u", "u", "u", "u", "u", "u",
+        "u", "u", "y", "y", "y", "y", "y", "y",
+        "y", "y", "\xe1\xbb\xbb", "\xe1\xbb\xbb", "\xe1\xbb\xbd", "\xe1\xbb\xbd", "\xe1\xbb\xbf", "\xe1\xbb\xbf",
+        "\xce\xb1", "\xce\xb1", "\xce\xb1", "\xce\xb1", "\xce\xb1", "\xce\xb1", "\xce\xb1", "\xce\xb1",
+        "\xce\xb1", "\xce\xb1", "\xce\xb1", "\xce\xb1", "\xce\xb1", "\xce\xb1", "\xce\xb1", "\xce\xb1",
+        "\xce\xb5", "\xce\xb5", "\xce\xb5", "\xce\xb5", "\xce\xb5", "\xce\xb5", "\xe1\xbc\x96", "\xe1\xbc\x97",
+        "\xce\xb5", "\xce\xb5", "\xce\xb5", "\xce\xb5", "\xce\xb5", "\xce\xb5", "\xe1\xbc\x9e", "\xe1\xbc\x9f",
+        "\xce\xb7", "\xce\xb7", "\xce\xb7", "\xce\xb7", "\xce\xb7", "\xce\xb7", "\xce\xb7", "\xce\xb7",
+        "\xce\xb7", "\xce\xb7", "\xce\xb7", "\xce\xb7", "\xce\xb7", "\xce\xb7", "\xce\xb7", "\xce\xb7",
+        "\xce\xb9", "\xce\xb9", "\xce\xb9", "\xce\xb9", "\xce\xb9", "\xce\xb9", "\xce\xb9", "\xce\xb9",
+        "\xce\xb9", "\xce\xb9", "\xce\xb9", "\xce\xb9", "\xce\xb9", "\xce\xb9", "\xce\xb9", "\xce\xb9",
+        "\xce\xbf", "\xce\xbf", "\xce\xbf", "\xce\xbf", "\xce\xbf", "\xce\xbf", "\xe1\xbd\x86", "\xe1\xbd\x87",
+        "\xce\xbf", "\xce\xbf", "\xce\xbf", "\xce\xbf", "\xce\xbf", "\xce\xbf", "\xe1\xbd\x8e", "\xe1\xbd\x8f",
+        "\xcf\x85", "\xcf\x85", "\xcf\x85", "\xcf\x85", "\xcf\x85", "\xcf\x85", "\xcf\x85", "\xcf\x85",
+        "\xe1\xbd\x98", "\xcf\x85", "\xe1\xbd\x9a", "\xcf\x85", "\xe1\xbd\x9c", "\xcf\x85", "\xe1\xbd\x9e", "\xcf\x85",
+        "\xcf\x89", "\xcf\x89", "\xcf\x89", "\xcf\x89", "\xcf\x89", "\xcf\x89", "\xcf\x89", "\xcf\x89",
+        "\xcf\x89", "\xcf\x89", "\xcf\x89", "\xcf\x89", "\xcf\x89", "\xcf\x89", "\xcf\x89", "\xcf\x89",
+        "\xce\xb1", "\xce\xb1", "\xce\xb5", "\xce\xb5", "\xce\xb7", "\xce\xb7", "\xce\xb9", "\xce\xb9",
+        "\xce\xbf", "\xce\xbf", "\xcf\x85", "\xcf\x85", "\xcf\x89", "\xcf\x89", "\xe1\xbd\xbe", "\xe1\xbd\xbf",
+        "\xce\xb1", "\xce\xb1", "\xce\xb1", "\xce\xb1", "\xce\xb1", "\xce\xb1", "\xce\xb1", "\xce\xb1",
+        "\xce\xb1", "\xce\xb1", "\xce\xb1", "\xce\xb1", "\xce\xb1", "\xce\xb1", "\xce\xb1", "\xce\xb1",
+        "\xce\xb7", "\xce\xb7", "\xce\xb7", "\xce\xb7", "\xce\xb7", "\xce\xb7", "\xce\xb7", "\xce\xb7",
+        "\xce\xb7", "\xce\xb7", "\xce\xb7", "\xce\xb7", "\xce\xb7", "\xce\xb7", "\xce\xb7", "\xce\xb7",
+        "\xcf\x89", "\xcf\x89", "\xcf\x89", "\xcf\x89", "\xcf\x89", "\xcf\x89", "\xcf\x89", "\xcf\x89",
+        "\xcf\x89", "\xcf\x89", "\xcf\x89", "\xcf\x89", "\xcf\x89", "\xcf\x89", "\xcf\x89", "\xcf\x89",
+        "\xce\xb1", "\xce\xb1", "\xce\xb1", "\xce\xb1", "\xce\xb1", "\xe1\xbe\xb5", "\xce\xb1", "\xce\xb1",
+        "\xce\xb1", "\xce\xb1", "\xce\xb1", "\xce\xb1", "\xce\xb1", " ", "\xce\xb9", " ",
+        " ", " ", "\xce\xb7", "\xce\xb7", "\xce\xb7", "\xe1\xbf\x85", "\xce\xb7", "\xce\xb7",
+        "\xce\xb5", "\xce\xb5", "\xce\xb7", "\xce\xb7", "\xce\xb7", " ", " ", " ",
+        "\xce\xb9", "\xce\xb9", "\xce\xb9", "\xce\xb9", "\xe1\xbf\x94", "\xe1\xbf\x95", "\xce\xb9", "\xce\xb9",
+        "\xce\xb9", "\xce\xb9", "\xce\xb9", "\xce\xb9", "\xe1\xbf\x9c", " ", " ", " ",
+        "\xcf\x85", "\xcf\x85", "\xcf\x85", "\xcf\x85", "\xcf\x81", "\xcf\x81", "\xcf\x85", "\xcf\x85",
+        "\xcf\x85", "\xcf\x85", "\xcf\x85", "\xcf\x85", "\xcf\x81", " ", " ", "`",
+        "\xe1\xbf\xb0", "\xe1\xbf\xb1", "\xcf\x89", "\xcf\x89", "\xcf\x89", "\xe1\xbf\xb5", "\xcf\x89", "\xcf\x89",
+        "\xce\xbf", "\xce\xbf", "\xcf\x89", "\xcf\x89", "\xcf\x89", " ", " ", "\xe1\xbf\xbf",
+};
+
+#define MAX_FOLDED_TERRITORY_NAME_LEN 110
+#define TERRITORY_NAMES_ISO_CODE 28 // bit number (in locales) of the ISO3166 codes
+
+typedef struct {
+    const char *name;           // folded name
+    enum Territory territory;
+    unsigned int locales;       // bit l is set if locale number l uses the name
+} TerritoryNameRec;
+
+static const TerritoryNameRec TERRITORY_NAME_INDEX[] = {
+        {"'muso oa lesotho", TERRITORY_LSO, 0x08000000},
+        {"aaa", TERRITORY_AAA, 0x10000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FR)
+        {"aaland", TERRITORY_ALA, 0x00000400},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"aaland adaları", TERRITORY_ALA, 0x02000000},
+#endif
+        {"aaland islands", TERRITORY_ALA, 0x00000080},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_SW)
+        {"aaland visiwa", TERRITORY_ALA, 0x01000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AF)
+        {"aaland-eilande", TERRITORY_ALA, 0x00000001},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_NL)
+        {"aaland-eilanden", TERRITORY_ALA, 0x00040000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DE)
+        {"aaland-inseln", TERRITORY_ALA, 0x00000040},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AF) || defined(MAPCODE_SUPPORT_LANGUAGE_NL)
+        {"aarde", TERRITORY_AAA, 0x00040001},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"abd", TERRITORY_USA, 0x02000000},
+        {"abd virjin adaları", TERRITORY_VIR, 0x02000000},
+#endif
+        {"abw", TERRITORY_ABW, 0x10000000},
+        {"acre", TERRITORY_BR_AC, 0x0b9ce7f1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"adası ve mcdonald adaları heard", TERRITORY_HMD, 0x02000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"adigejska republika", TERRITORY_RU_AD, 0x00002000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"adigey cumhuriyeti", TERRITORY_RU_AD, 0x02000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_SW)
+        {"adygea jamhuri", TERRITORY_RU_AD, 0x01000000},
+#endif
+        {"adygea republic", TERRITORY_RU_AD, 0x00800090},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AF) || defined(MAPCODE_SUPPORT_LANGUAGE_NL)
+        {"adygea republiek", TERRITORY_RU_AD, 0x00040001},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DA) || defined(MAPCODE_SUPPORT_LANGUAGE_DE) || defined(MAPCODE_SUPPORT_LANGUAGE_ID)
+        {"adygea republik", TERRITORY_RU_AD, 0x00004060},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FI)
+        {"adygeia tasavalta", TERRITORY_RU_AD, 0x00000200},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_NO)
+        {"adygia republikk", TERRITORY_RU_AD, 0x00080000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PT)
+        {"afeganistao", TERRITORY_AFG, 0x00100000},
+#endif
+        {"afg", TERRITORY_AFG, 0x10000000},
+        {"afganistan", TERRITORY_AFG, 0x0a206300},
+        {"afghanistan", TERRITORY_AFG, 0x018c84f1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PT)
+        {"africa do sul", TERRITORY_ZAF, 0x00100000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_SW)
+        {"africa kusini", TERRITORY_ZAF, 0x01000000},
+#endif
+        {"afrika borwa", TERRITORY_ZAF, 0x08000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ID)
+        {"afrika selatan", TERRITORY_ZAF, 0x00004000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FR)
+        {"afrique du sud", TERRITORY_ZAF, 0x00000400},
+#endif
+        {"ago", TERRITORY_AGO, 0x10000000},
+        {"aguascalientes", TERRITORY_MX_AGU, 0x0bbce7f1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DE)
+        {"agypten", TERRITORY_EGY, 0x00000040},
+#endif
+        {"ahvenanmaa", TERRITORY_ALA, 0x08000200},
+        {"aia", TERRITORY_AIA, 0x10000000},
+        {"airlann", TERRITORY_IRL, 0x08000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"ajdaho", TERRITORY_US_ID, 0x00002000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PL)
+        {"akr", TERRITORY_BR_AC, 0x00200000},
+#endif
+        {"al-bahrayn", TERRITORY_BHR, 0x08000000},
+        {"ala", TERRITORY_ALA, 0x10000000},
+        {"alabama", TERRITORY_US_AL, 0x0bbce7f1},
+        {"alagoas", TERRITORY_BR_AL, 0x0bbce7f1},
+        {"aland", TERRITORY_ALA, 0x08880000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FR)
+        {"aland iles", TERRITORY_ALA, 0x00000400},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DE)
+        {"aland-inseln", TERRITORY_ALA, 0x00000040},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CS)
+        {"alandske ostrovy", TERRITORY_ALA, 0x00000010},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"alandski otoci", TERRITORY_ALA, 0x00002000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DA)
+        {"alandsøerne", TERRITORY_ALA, 0x00000020},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PL)
+        {"alandzkie, wyspy", TERRITORY_ALA, 0x00200000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FI)
+        {"alankomaat", TERRITORY_NLD, 0x00000200},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PT)
+        {"alasca", TERRITORY_US_AK, 0x00100000},
+#endif
+        {"alaska", TERRITORY_US_AK, 0x0bacc7e1},
+        {"alb", TERRITORY_ALB, 0x10000000},
+        {"albania", TERRITORY_ALB, 0x0138c380},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AF) || defined(MAPCODE_SUPPORT_LANGUAGE_CS) || defined(MAPCODE_SUPPORT_LANGUAGE_FR) || defined(MAPCODE_SUPPORT_LANGUAGE_NL)
+        {"albanie", TERRITORY_ALB, 0x00040411},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DA) || defined(MAPCODE_SUPPORT_LANGUAGE_DE) || defined(MAPCODE_SUPPORT_LANGUAGE_SV)
+        {"albanien", TERRITORY_ALB, 0x00800060},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"albanija", TERRITORY_ALB, 0x00002000},
+#endif
+        {"alberta", TERRITORY_CA_AB, 0x0bbce7f1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PT)
+        {"alemanha", TERRITORY_DEU, 0x00100000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ES)
+        {"alemania", TERRITORY_DEU, 0x00000100},
+#endif
+        {"algeria", TERRITORY_DZA, 0x01008280},
+        {"algerie", TERRITORY_DZA, 0x08080401},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DE)
+        {"algerien", TERRITORY_DZA, 0x00000040},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DA) || defined(MAPCODE_SUPPORT_LANGUAGE_SV)
+        {"algeriet", TERRITORY_DZA, 0x00800020},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_NL)
+        {"algerije", TERRITORY_DZA, 0x00040000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PL)
+        {"algieria", TERRITORY_DZA, 0x00200000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CS) || defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"aljaska", TERRITORY_US_AK, 0x00002010},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ID)
+        {"aljazair", TERRITORY_DZA, 0x00004000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FR)
+        {"allemagne", TERRITORY_DEU, 0x00000400},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"almanya", TERRITORY_DEU, 0x02000000},
+#endif
+        {"altai krai", TERRITORY_RU_ALT, 0x031cc0f1},
+        {"altai republic", TERRITORY_RU_AL, 0x01082290},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AF) || defined(MAPCODE_SUPPORT_LANGUAGE_NL)
+        {"altai republiek", TERRITORY_RU_AL, 0x00040001},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DA) || defined(MAPCODE_SUPPORT_LANGUAGE_DE)
+        {"altai republik", TERRITORY_RU_AL, 0x00000060},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FI)
+        {"altain aluepiiri", TERRITORY_RU_ALT, 0x00000200},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_SV)
+        {"altaj kraj", TERRITORY_RU_ALT, 0x00800000},
+        {"altajrepubliken", TERRITORY_RU_AL, 0x00800000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"altajski kraj", TERRITORY_RU_ALT, 0x00002000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"altay cumhuriyeti", TERRITORY_RU_AL, 0x02000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"alzir", TERRITORY_DZA, 0x00002000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CS)
+        {"alzirsko", TERRITORY_DZA, 0x00000010},
+#endif
+        {"amapa", TERRITORY_BR_AP, 0x0bbce7f1},
+        {"amazonas", TERRITORY_BR_AM, 0x0bbce7f1},
+        {"america", TERRITORY_USA, 0x08188190},
+        {"american samoa", TERRITORY_ASM, 0x09000080},
+        {"american virgin islands", TERRITORY_VIR, 0x08000080},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CS) || defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"americka samoa", TERRITORY_ASM, 0x00002010},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CS)
+        {"americke panenske ostrovy", TERRITORY_VIR, 0x00000010},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AF) || defined(MAPCODE_SUPPORT_LANGUAGE_DA) || defined(MAPCODE_SUPPORT_LANGUAGE_DE) || defined(MAPCODE_SUPPORT_LANGUAGE_HR) || defined(MAPCODE_SUPPORT_LANGUAGE_ID) || defined(MAPCODE_SUPPORT_LANGUAGE_NL) || defined(MAPCODE_SUPPORT_LANGUAGE_SV) || defined(MAPCODE_SUPPORT_LANGUAGE_SW) || defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"amerika", TERRITORY_USA, 0x03846061},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"amerika birlesik devletleri", TERRITORY_USA, 0x02000000},
+        {"amerika birlesik devletleri kucuk dıs adaları", TERRITORY_UMI, 0x02000000},
+#endif
+        {"amerika samoa", TERRITORY_ASM, 0x08000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ID)
+        {"amerika serikat", TERRITORY_USA, 0x00004000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_NL)
+        {"amerikaans samoa", TERRITORY_ASM, 0x00040000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AF)
+        {"amerikaanse maagde-eilande", TERRITORY_VIR, 0x00000001},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_NL)
+        {"amerikaanse maagdeneilanden", TERRITORY_VIR, 0x00040000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AF)
+        {"amerikaanse samoa", TERRITORY_ASM, 0x00000001},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FI)
+        {"amerikan samoa", TERRITORY_ASM, 0x00000200},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"amerikan samoası", TERRITORY_ASM, 0x02000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DE)
+        {"amerikanisch samoa", TERRITORY_ASM, 0x00000040},
+        {"amerikanische jungferninseln", TERRITORY_VIR, 0x00000040},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DA) || defined(MAPCODE_SUPPORT_LANGUAGE_NO)
+        {"amerikansk samoa", TERRITORY_ASM, 0x00080020},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_SV)
+        {"amerikanska jungfruoarna", TERRITORY_VIR, 0x00800000},
+        {"amerikanska samoa", TERRITORY_ASM, 0x00800000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_NO)
+        {"amerikanske jomfruøyer", TERRITORY_VIR, 0x00080000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_SV)
+        {"amerikas forenta stater", TERRITORY_USA, 0x00800000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FI)
+        {"amerikka", TERRITORY_USA, 0x00000200},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FR)
+        {"amerique", TERRITORY_USA, 0x00000400},
+#endif
+        {"amur oblast", TERRITORY_RU_AMU, 0x038c60f0},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FI)
+        {"amurin alue", TERRITORY_RU_AMU, 0x00000200},
+#endif
+        {"and", TERRITORY_AND, 0x10000000},
+        {"andaman", TERRITORY_IN_AN, 0x00000080},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CS)
+        {"andaman a nicobar", TERRITORY_IN_AN, 0x00000010},
+#endif
+        {"andaman and nicobar", TERRITORY_IN_AN, 0x09802081},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ID)
+        {"andaman dan nicobar", TERRITORY_IN_AN, 0x00004000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PT)
+        {"andaman e nicobar", TERRITORY_IN_AN, 0x00100000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_NL)
+        {"andaman en nicobar", TERRITORY_IN_AN, 0x00040000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PL)
+        {"andaman i nicobar", TERRITORY_IN_AN, 0x00200000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FI)
+        {"andaman ja nicobar", TERRITORY_IN_AN, 0x00000200},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DA) || defined(MAPCODE_SUPPORT_LANGUAGE_NO)
+        {"andaman og nicobar", TERRITORY_IN_AN, 0x00080020},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"andaman ve nikobar", TERRITORY_IN_AN, 0x02000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ES)
+        {"andaman y nicobar", TERRITORY_IN_AN, 0x00000100},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FR)
+        {"andaman-et-nicobar", TERRITORY_IN_AN, 0x00000400},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_IT)
+        {"andamane e nicobar", TERRITORY_IN_AN, 0x00008000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DE)
+        {"andamanen-und nikobaren", TERRITORY_IN_AN, 0x00000040},
+#endif
+        {"andhra pradesh", TERRITORY_IN_AP, 0x01bce7f1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR) || defined(MAPCODE_SUPPORT_LANGUAGE_PL)
+        {"andora", TERRITORY_AND, 0x00202000},
+#endif
+        {"andorra", TERRITORY_AND, 0x0b9cc3f1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FR)
+        {"andorre", TERRITORY_AND, 0x00000400},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"andra prades", TERRITORY_IN_AP, 0x02000000},
+#endif
+        {"angola", TERRITORY_AGO, 0x0bbce7f1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ES)
+        {"anguila", TERRITORY_AIA, 0x00000100},
+#endif
+        {"anguilla", TERRITORY_AIA, 0x0bbce6f1},
+        {"anhui", TERRITORY_CN_AH, 0x03bce7f1},
+        {"antarctica", TERRITORY_ATA, 0x090400b0},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FR)
+        {"antarctique", TERRITORY_ATA, 0x00000400},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AF) || defined(MAPCODE_SUPPORT_LANGUAGE_HR) || defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"antarktika", TERRITORY_ATA, 0x02002001},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DE) || defined(MAPCODE_SUPPORT_LANGUAGE_FI) || defined(MAPCODE_SUPPORT_LANGUAGE_NO) || defined(MAPCODE_SUPPORT_LANGUAGE_SV)
+        {"antarktis", TERRITORY_ATA, 0x00880240},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PL)
+        {"antarktyka", TERRITORY_ATA, 0x00200000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PT)
+        {"antartica", TERRITORY_ATA, 0x00100000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ES)
+        {"antartida", TERRITORY_ATA, 0x00000100},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_IT)
+        {"antartide", TERRITORY_ATA, 0x00008000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ID)
+        {"antartika", TERRITORY_ATA, 0x00004000},
+#endif
+        {"antigua", TERRITORY_ATG, 0x00000080},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CS)
+        {"antigua a barbuda", TERRITORY_ATG, 0x00000010},
+#endif
+        {"antigua and barbuda", TERRITORY_ATG, 0x08000080},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ID)
+        {"antigua dan barbuda", TERRITORY_ATG, 0x00004000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_IT) || defined(MAPCODE_SUPPORT_LANGUAGE_PT)
+        {"antigua e barbuda", TERRITORY_ATG, 0x00108000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AF) || defined(MAPCODE_SUPPORT_LANGUAGE_NL)
+        {"antigua en barbuda", TERRITORY_ATG, 0x00040001},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PL)
+        {"antigua i barbuda", TERRITORY_ATG, 0x00200000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FI)
+        {"antigua ja barbuda", TERRITORY_ATG, 0x00000200},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_SW)
+        {"antigua na barbuda", TERRITORY_ATG, 0x01000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_SV)
+        {"antigua och barbuda", TERRITORY_ATG, 0x00800000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DA) || defined(MAPCODE_SUPPORT_LANGUAGE_NO)
+        {"antigua og barbuda", TERRITORY_ATG, 0x00080020},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DE)
+        {"antigua und barbuda", TERRITORY_ATG, 0x00000040},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"antigua ve barbuda", TERRITORY_ATG, 0x02000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ES)
+        {"antigua y barbuda", TERRITORY_ATG, 0x00000100},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FR)
+        {"antigua-et-barbuda", TERRITORY_ATG, 0x00000400},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"antigva i barbuda", TERRITORY_ATG, 0x00002000},
+#endif
+        {"aolepan aorokin majel", TERRITORY_MHL, 0x08000000},
+        {"aomen", TERRITORY_MAC, 0x00000080},
+        {"aotearoa", TERRITORY_NZL, 0x08000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DE)
+        {"aquatorial-guinea", TERRITORY_GNQ, 0x00000040},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ID)
+        {"arab saudi", TERRITORY_SAU, 0x00004000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ES) || defined(MAPCODE_SUPPORT_LANGUAGE_IT) || defined(MAPCODE_SUPPORT_LANGUAGE_PT)
+        {"arabia saudita", TERRITORY_SAU, 0x00108100},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PL)
+        {"arabia saudyjska", TERRITORY_SAU, 0x00200000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FR)
+        {"arabie saoudite", TERRITORY_SAU, 0x00000400},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DE)
+        {"archangelsk oblast", TERRITORY_RU_ARK, 0x00000040},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PL)
+        {"archangielsk oblast", TERRITORY_RU_ARK, 0x00200000},
+#endif
+        {"are", TERRITORY_ARE, 0x10000000},
+        {"arg", TERRITORY_ARG, 0x10000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ES) || defined(MAPCODE_SUPPORT_LANGUAGE_PT)
+        {"argelia", TERRITORY_DZA, 0x00100100},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FI)
+        {"argentiina", TERRITORY_ARG, 0x00000200},
+#endif
+        {"argentina", TERRITORY_ARG, 0x0998e1b0},
+        {"argentine", TERRITORY_ARG, 0x08000400},
+        {"argentine republic", TERRITORY_ARG, 0x00000080},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AF) || defined(MAPCODE_SUPPORT_LANGUAGE_NL)
+        {"argentinie", TERRITORY_ARG, 0x00040001},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DE)
+        {"argentinien", TERRITORY_ARG, 0x00000040},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PL)
+        {"argentyna", TERRITORY_ARG, 0x00200000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"arhangelska oblast", TERRITORY_RU_ARK, 0x00002000},
+#endif
+        {"arizona", TERRITORY_US_AZ, 0x0bbce7f1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"arjantin", TERRITORY_ARG, 0x02000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FI)
+        {"arkangelin", TERRITORY_RU_ARK, 0x00000200},
+#endif
+        {"arkansas", TERRITORY_US_AR, 0x0bbcc7f1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"arkanzas", TERRITORY_US_AR, 0x00002000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_SV)
+        {"arkhangelsk", TERRITORY_RU_ARK, 0x00800000},
+#endif
+        {"arkhangelsk oblast", TERRITORY_RU_ARK, 0x031cc1b1},
+        {"arm", TERRITORY_ARM, 0x10000000},
+        {"armenia", TERRITORY_ARM, 0x0138c380},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AF) || defined(MAPCODE_SUPPORT_LANGUAGE_CS) || defined(MAPCODE_SUPPORT_LANGUAGE_FR) || defined(MAPCODE_SUPPORT_LANGUAGE_NL)
+        {"armenie", TERRITORY_ARM, 0x00040411},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DA) || defined(MAPCODE_SUPPORT_LANGUAGE_DE) || defined(MAPCODE_SUPPORT_LANGUAGE_SV)
+        {"armenien", TERRITORY_ARM, 0x00800060},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"armenija", TERRITORY_ARM, 0x00002000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"arnavutluk", TERRITORY_ALB, 0x02000000},
+#endif
+        {"aruba", TERRITORY_ABW, 0x0bbce7f1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"arunacal prades", TERRITORY_IN_AR, 0x02000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CS)
+        {"arunacalprades", TERRITORY_IN_AR, 0x00000010},
+#endif
+        {"arunachal pradesh", TERRITORY_IN_AR, 0x09bce7e1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PT)
+        {"ascensao", TERRITORY_SHN, 0x00100000},
+#endif
+        {"ascension", TERRITORY_SHN, 0x01886790},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_IT)
+        {"ascensione", TERRITORY_SHN, 0x00008000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DE)
+        {"aserbaidschan", TERRITORY_AZE, 0x00000040},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DA) || defined(MAPCODE_SUPPORT_LANGUAGE_NO)
+        {"aserbajdsjan", TERRITORY_AZE, 0x00080020},
+#endif
+        {"asm", TERRITORY_ASM, 0x10000000},
+        {"assam", TERRITORY_IN_AS, 0x03bce7f1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CS) || defined(MAPCODE_SUPPORT_LANGUAGE_PL) || defined(MAPCODE_SUPPORT_LANGUAGE_SV)
+        {"astrachan oblast", TERRITORY_RU_AST, 0x00a00010},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"astrahan oblast", TERRITORY_RU_AST, 0x00002000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FI)
+        {"astrahanin alue", TERRITORY_RU_AST, 0x00000200},
+#endif
+        {"astrakhan oblast", TERRITORY_RU_AST, 0x030c40e1},
+        {"ata", TERRITORY_ATA, 0x10000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_SV)
+        {"aterforening", TERRITORY_REU, 0x00800000},
+#endif
+        {"atf", TERRITORY_ATF, 0x10000000},
+        {"atg", TERRITORY_ATG, 0x10000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DE)
+        {"athiopien", TERRITORY_ETH, 0x00000040},
+#endif
+        {"au-act", TERRITORY_AU_ACT, 0x10000000},
+        {"au-jbt", TERRITORY_AU_JBT, 0x10000000},
+        {"au-nsw", TERRITORY_AU_NSW, 0x10000000},
+        {"au-nt", TERRITORY_AU_NT, 0x10000000},
+        {"au-qld", TERRITORY_AU_QLD, 0x10000000},
+        {"au-sa", TERRITORY_AU_SA, 0x10000000},
+        {"au-tas", TERRITORY_AU_TAS, 0x10000000},
+        {"au-vic", TERRITORY_AU_VIC, 0x10000000},
+        {"au-wa", TERRITORY_AU_WA, 0x10000000},
+        {"aus", TERRITORY_AUS, 0x10000000},
+        {"australia", TERRITORY_AUS, 0x0938c380},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ID)
+        {"australia barat", TERRITORY_AU_WA, 0x00004000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_IT)
+        {"australia del sud", TERRITORY_AU_SA, 0x00008000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ES)
+        {"australia del sur", TERRITORY_AU_SA, 0x00000100},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_SW)
+        {"australia kusini", TERRITORY_AU_SA, 0x01000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ES)
+        {"australia occidental", TERRITORY_AU_WA, 0x00000100},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_IT)
+        {"australia occidentale", TERRITORY_AU_WA, 0x00008000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PT)
+        {"australia ocidental", TERRITORY_AU_WA, 0x00100000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ID)
+        {"australia selatan", TERRITORY_AU_SA, 0x00004000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_SW)
+        {"australia ya magharibi", TERRITORY_AU_WA, 0x01000000},
+#endif
+        {"australian capital territory", TERRITORY_AU_ACT, 0x098ca3f1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FI)
+        {"australian paakaupunkiterritorio", TERRITORY_AU_ACT, 0x00000200},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AF) || defined(MAPCODE_SUPPORT_LANGUAGE_CS) || defined(MAPCODE_SUPPORT_LANGUAGE_FR) || defined(MAPCODE_SUPPORT_LANGUAGE_NL)
+        {"australie", TERRITORY_AUS, 0x00040411},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FR)
+        {"australie meridionale", TERRITORY_AU_SA, 0x00000400},
+        {"australie-occidentale", TERRITORY_AU_WA, 0x00000400},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DA) || defined(MAPCODE_SUPPORT_LANGUAGE_DE) || defined(MAPCODE_SUPPORT_LANGUAGE_SV)
+        {"australien", TERRITORY_AUS, 0x00800060},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"australija", TERRITORY_AUS, 0x00002000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PL)
+        {"australijskie terytorium stołeczne", TERRITORY_AU_ACT, 0x00200000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"australski glavni teritorij", TERRITORY_AU_ACT, 0x00002000},
+#endif
+        {"austria", TERRITORY_AUT, 0x0130c180},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"austrija", TERRITORY_AUT, 0x00002000},
+#endif
+        {"aut", TERRITORY_AUT, 0x10000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FR)
+        {"autriche", TERRITORY_AUT, 0x00000400},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"avustralya", TERRITORY_AUS, 0x02000000},
+        {"avustralya baskent bolgesi", TERRITORY_AU_ACT, 0x02000000},
+        {"avusturya", TERRITORY_AUT, 0x02000000},
+#endif
+        {"ayiti", TERRITORY_HTI, 0x08000000},
+        {"aze", TERRITORY_AZE, 0x10000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FR)
+        {"azerbaidjan", TERRITORY_AZE, 0x00000400},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FI)
+        {"azerbaidzan", TERRITORY_AZE, 0x00000200},
+#endif
+        {"azerbaijan", TERRITORY_AZE, 0x0180c081},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PT)
+        {"azerbaijao", TERRITORY_AZE, 0x00100000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ES)
+        {"azerbaiyan", TERRITORY_AZE, 0x00000100},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CS)
+        {"azerbajdzan", TERRITORY_AZE, 0x00000010},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"azerbaycan", TERRITORY_AZE, 0x02000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_NL)
+        {"azerbeidzjan", TERRITORY_AZE, 0x00040000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR) || defined(MAPCODE_SUPPORT_LANGUAGE_PL)
+        {"azerbejdzan", TERRITORY_AZE, 0x00202000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"aziz pierre ve miquelon", TERRITORY_SPM, 0x02000000},
+#endif
+        {"azərbaycan", TERRITORY_AZE, 0x08000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FI) || defined(MAPCODE_SUPPORT_LANGUAGE_ID)
+        {"bahama", TERRITORY_BHS, 0x00004200},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"bahamalar", TERRITORY_BHS, 0x02000000},
+#endif
+        {"bahamas", TERRITORY_BHS, 0x099c85e1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"bahami", TERRITORY_BHS, 0x00002000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CS)
+        {"bahamske ostrovy", TERRITORY_BHS, 0x00000010},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PL)
+        {"bahamy", TERRITORY_BHS, 0x00200000},
+#endif
+        {"bahia", TERRITORY_BR_BA, 0x0bbce7f1},
+        {"bahrain", TERRITORY_BHR, 0x0188c2e1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CS) || defined(MAPCODE_SUPPORT_LANGUAGE_PL)
+        {"bahrajn", TERRITORY_BHR, 0x00200010},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ES) || defined(MAPCODE_SUPPORT_LANGUAGE_FR) || defined(MAPCODE_SUPPORT_LANGUAGE_HR) || defined(MAPCODE_SUPPORT_LANGUAGE_NL) || defined(MAPCODE_SUPPORT_LANGUAGE_PT)
+        {"bahrein", TERRITORY_BHR, 0x00142500},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"bahreyn", TERRITORY_BHR, 0x02000000},
+#endif
+        {"bailliage de jerri", TERRITORY_JEY, 0x08000000},
+        {"baja california", TERRITORY_MX_BCN, 0x03bc63f1},
+        {"baja california", TERRITORY_MX_BCS, 0x08000000},
+        {"baja california sur", TERRITORY_MX_BCN, 0x08000000},
+        {"baja california sur", TERRITORY_MX_BCS, 0x03bc63f1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CS) || defined(MAPCODE_SUPPORT_LANGUAGE_HR) || defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"banglades", TERRITORY_BGD, 0x02002010},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DE)
+        {"bangladesch", TERRITORY_BGD, 0x00000040},
+#endif
+        {"bangladesh", TERRITORY_BGD, 0x019cc7a0},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AF)
+        {"bangladesj", TERRITORY_BGD, 0x00000001},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PL)
+        {"bangladesz", TERRITORY_BGD, 0x00200000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FR)
+        {"barbade", TERRITORY_BRB, 0x00000400},
+#endif
+        {"barbados", TERRITORY_BRB, 0x0bbce3f1},
+        {"barbuda", TERRITORY_ATG, 0x039ce7f1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CS)
+        {"barma", TERRITORY_MMR, 0x00000010},
+#endif
+        {"bashkortostan republic", TERRITORY_RU_BA, 0x01804080},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AF) || defined(MAPCODE_SUPPORT_LANGUAGE_NL)
+        {"bashkortostan republiek", TERRITORY_RU_BA, 0x00040001},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DA)
+        {"bashkortostan republik", TERRITORY_RU_BA, 0x00000020},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"bashkortostan republika", TERRITORY_RU_BA, 0x00002000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_NO)
+        {"bashkortostan republikk", TERRITORY_RU_BA, 0x00080000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FI)
+        {"bashkortostanin tasavalta", TERRITORY_RU_BA, 0x00000200},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"baskortostan cumhuriyeti", TERRITORY_RU_BA, 0x02000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CS)
+        {"baskortostan republic", TERRITORY_RU_BA, 0x00000010},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_IT)
+        {"bassa california", TERRITORY_MX_BCN, 0x00008000},
+        {"bassa california del sud", TERRITORY_MX_BCS, 0x00008000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FR)
+        {"basse-californie", TERRITORY_MX_BCN, 0x00000400},
+        {"basse-californie du sud", TERRITORY_MX_BCS, 0x00000400},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"batı avustralya", TERRITORY_AU_WA, 0x02000000},
+        {"batı bengal", TERRITORY_IN_WB, 0x02000000},
+        {"batı sahra", TERRITORY_ESH, 0x02000000},
+#endif
+        {"bdi", TERRITORY_BDI, 0x10000000},
+        {"beijing", TERRITORY_CN_BJ, 0x010c41a1},
+        {"bel", TERRITORY_BEL, 0x10000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ID)
+        {"belanda", TERRITORY_NLD, 0x00004000},
+#endif
+        {"belarus", TERRITORY_BLR, 0x090044a0},
+        {"belau", TERRITORY_PLW, 0x08000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"belcika", TERRITORY_BEL, 0x02000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FI) || defined(MAPCODE_SUPPORT_LANGUAGE_NO) || defined(MAPCODE_SUPPORT_LANGUAGE_PL)
+        {"belgia", TERRITORY_BEL, 0x00280200},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ES) || defined(MAPCODE_SUPPORT_LANGUAGE_PT)
+        {"belgica", TERRITORY_BEL, 0x00100100},
+#endif
+        {"belgie", TERRITORY_BEL, 0x08040011},
+        {"belgien", TERRITORY_BEL, 0x08800060},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"belgija", TERRITORY_BEL, 0x00002000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_IT)
+        {"belgio", TERRITORY_BEL, 0x00008000},
+#endif
+        {"belgique", TERRITORY_BEL, 0x08000400},
+        {"belgium", TERRITORY_BEL, 0x00004080},
+        {"belgorod oblast", TERRITORY_RU_BE, 0x019c61f1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"belgorod oblastı", TERRITORY_RU_BE, 0x02000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FI)
+        {"belgorodin alue", TERRITORY_RU_BE, 0x00000200},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ES)
+        {"belice", TERRITORY_BLZ, 0x00000100},
+#endif
+        {"belize", TERRITORY_BLZ, 0x0bbce6f1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CS)
+        {"belorusko", TERRITORY_BLR, 0x00000010},
+#endif
+        {"ben", TERRITORY_BEN, 0x10000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PL)
+        {"bengal zachodni", TERRITORY_IN_WB, 0x00200000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ES)
+        {"bengala occidental", TERRITORY_IN_WB, 0x00000100},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PT)
+        {"bengala ocidental", TERRITORY_IN_WB, 0x00100000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FR)
+        {"bengale-occidental", TERRITORY_IN_WB, 0x00000400},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ID)
+        {"benggala barat", TERRITORY_IN_WB, 0x00004000},
+#endif
+        {"benin", TERRITORY_BEN, 0x0bbce7f1},
+        {"bermuda", TERRITORY_BMU, 0x0b8cc2e1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ES) || defined(MAPCODE_SUPPORT_LANGUAGE_PT)
+        {"bermudas", TERRITORY_BMU, 0x00100100},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FR)
+        {"bermudes", TERRITORY_BMU, 0x00000400},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"bermudi", TERRITORY_BMU, 0x00002000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CS) || defined(MAPCODE_SUPPORT_LANGUAGE_PL)
+        {"bermudy", TERRITORY_BMU, 0x00200010},
+#endif
+        {"bes", TERRITORY_BES, 0x10000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"beyaz rusya", TERRITORY_BLR, 0x02000000},
+#endif
+        {"bfa", TERRITORY_BFA, 0x10000000},
+        {"bgd", TERRITORY_BGD, 0x10000000},
+        {"bgr", TERRITORY_BGR, 0x10000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AF)
+        {"bhoetan", TERRITORY_BTN, 0x00000001},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FR)
+        {"bhoutan", TERRITORY_BTN, 0x00000400},
+#endif
+        {"bhr", TERRITORY_BHR, 0x10000000},
+        {"bhs", TERRITORY_BHS, 0x10000000},
+        {"bhutan", TERRITORY_BTN, 0x03acc2f0},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PL)
+        {"białorus", TERRITORY_BLR, 0x00200000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ES)
+        {"bielorrusia", TERRITORY_BLR, 0x00000100},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PT)
+        {"bielorrussia", TERRITORY_BLR, 0x00100000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_IT)
+        {"bielorussia", TERRITORY_BLR, 0x00008000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PL)
+        {"biełgorod oblast", TERRITORY_RU_BE, 0x00200000},
+#endif
+        {"bih", TERRITORY_BIH, 0x10000000},
+        {"bihar", TERRITORY_IN_BR, 0x03bce7f1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"birlesik arap emirlikleri", TERRITORY_ARE, 0x02000000},
+        {"birlesik krallık", TERRITORY_GBR, 0x02000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AF) || defined(MAPCODE_SUPPORT_LANGUAGE_DE) || defined(MAPCODE_SUPPORT_LANGUAGE_NL)
+        {"birma", TERRITORY_MMR, 0x00040041},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ES) || defined(MAPCODE_SUPPORT_LANGUAGE_IT) || defined(MAPCODE_SUPPORT_LANGUAGE_PT)
+        {"birmania", TERRITORY_MMR, 0x00108100},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FR)
+        {"birmanie", TERRITORY_MMR, 0x00000400},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"bjelorusija", TERRITORY_BLR, 0x00002000},
+#endif
+        {"blm", TERRITORY_BLM, 0x10000000},
+        {"blr", TERRITORY_BLR, 0x10000000},
+        {"blz", TERRITORY_BLZ, 0x10000000},
+        {"bmu", TERRITORY_BMU, 0x10000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"bocvana", TERRITORY_BWA, 0x00002000},
+#endif
+        {"bol", TERRITORY_BOL, 0x10000000},
+        {"bolivia", TERRITORY_BOL, 0x099cc3a1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CS) || defined(MAPCODE_SUPPORT_LANGUAGE_FR)
+        {"bolivie", TERRITORY_BOL, 0x00000410},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DE)
+        {"bolivien", TERRITORY_BOL, 0x00000040},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"bolivija", TERRITORY_BOL, 0x00002000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"bolivya", TERRITORY_BOL, 0x02000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PL)
+        {"boliwia", TERRITORY_BOL, 0x00200000},
+#endif
+        {"bonaire", TERRITORY_BES, 0x00002080},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DA)
+        {"bonaire, saint eustasuis og saba", TERRITORY_BES, 0x00000020},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FR)
+        {"bonaire, saint-eustache et saba", TERRITORY_BES, 0x00000400},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_NL)
+        {"bonaire, sint eustasuis en saba", TERRITORY_BES, 0x00040000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PL)
+        {"bonaire, sint eustatius i saba", TERRITORY_BES, 0x00200000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_NO)
+        {"bonaire, sint eustatius og saba", TERRITORY_BES, 0x00080000},
+#endif
+        {"bonaire, st eustasuis and saba", TERRITORY_BES, 0x00000080},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CS)
+        {"bonaire, st eustatuis a saba", TERRITORY_BES, 0x00000010},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ID)
+        {"bonaire, st eustatuis dan saba", TERRITORY_BES, 0x00004000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_IT) || defined(MAPCODE_SUPPORT_LANGUAGE_PT)
+        {"bonaire, st eustatuis e saba", TERRITORY_BES, 0x00108000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AF)
+        {"bonaire, st eustatuis en saba", TERRITORY_BES, 0x00000001},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FI)
+        {"bonaire, st eustatuis ja saba", TERRITORY_BES, 0x00000200},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_SW)
+        {"bonaire, st eustatuis na saba", TERRITORY_BES, 0x01000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_SV)
+        {"bonaire, st eustatuis och saba", TERRITORY_BES, 0x00800000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ES)
+        {"bonaire, st eustatuis y saba", TERRITORY_BES, 0x00000100},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DE)
+        {"bonaire, st. eustatius und saba", TERRITORY_BES, 0x00000040},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"bonaire, st. eustatuis ve saba", TERRITORY_BES, 0x02000000},
+#endif
+        {"boneiru", TERRITORY_BES, 0x08000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CS)
+        {"bosna a hercegovina", TERRITORY_BIH, 0x00000010},
+#endif
+        {"bosna i hercegovina", TERRITORY_BIH, 0x08002000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"bosna-hersek", TERRITORY_BIH, 0x02000000},
+#endif
+        {"bosnia and herzegovina", TERRITORY_BIH, 0x00000080},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ID)
+        {"bosnia dan herzegovina", TERRITORY_BIH, 0x00004000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PT)
+        {"bosnia e herzegovina", TERRITORY_BIH, 0x00100000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PL)
+        {"bosnia i hercegowina", TERRITORY_BIH, 0x00200000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FI)
+        {"bosnia ja hertsegovina", TERRITORY_BIH, 0x00000200},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_SW)
+        {"bosnia na herzegovina", TERRITORY_BIH, 0x01000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ES)
+        {"bosnia y herzegovina", TERRITORY_BIH, 0x00000100},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_IT)
+        {"bosnia-erzegovina", TERRITORY_BIH, 0x00008000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_NO)
+        {"bosnia-hercegovina", TERRITORY_BIH, 0x00080000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AF) || defined(MAPCODE_SUPPORT_LANGUAGE_NL)
+        {"bosnie en herzegovina", TERRITORY_BIH, 0x00040001},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FR)
+        {"bosnie-herzegovine", TERRITORY_BIH, 0x00000400},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_SV)
+        {"bosnien och hercegovina", TERRITORY_BIH, 0x00800000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DA)
+        {"bosnien og hercegovina", TERRITORY_BIH, 0x00000020},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DE)
+        {"bosnien und herzegowina", TERRITORY_BIH, 0x00000040},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"botsvana", TERRITORY_BWA, 0x02000000},
+#endif
+        {"botswana", TERRITORY_BWA, 0x09bcc7f1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"bouvet adası", TERRITORY_BVT, 0x02000000},
+#endif
+        {"bouvet island", TERRITORY_BVT, 0x01040081},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ID)
+        {"bouvet pulau", TERRITORY_BVT, 0x00004000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DE)
+        {"bouvet-insel", TERRITORY_BVT, 0x00000040},
+#endif
+        {"bouvet-øya", TERRITORY_BVT, 0x08000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FI)
+        {"bouvet`nsaari", TERRITORY_BVT, 0x00000200},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PL)
+        {"bouveta, wyspy", TERRITORY_BVT, 0x00200000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_SV)
+        {"bouveton", TERRITORY_BVT, 0x00800000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"bouvetov otok", TERRITORY_BVT, 0x00002000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CS)
+        {"bouvetuv ostrov", TERRITORY_BVT, 0x00000010},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DA)
+        {"bouvetø", TERRITORY_BVT, 0x00000020},
+#endif
+        {"bouvetøya", TERRITORY_BVT, 0x08080000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PL)
+        {"bozego narodzenia, wyspy", TERRITORY_CXR, 0x00200000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"bozicni otok", TERRITORY_CXR, 0x00002000},
+#endif
+        {"br-ac", TERRITORY_BR_AC, 0x10000000},
+        {"br-al", TERRITORY_BR_AL, 0x10000000},
+        {"br-am", TERRITORY_BR_AM, 0x10000000},
+        {"br-ap", TERRITORY_BR_AP, 0x10000000},
+        {"br-ba", TERRITORY_BR_BA, 0x10000000},
+        {"br-ce", TERRITORY_BR_CE, 0x10000000},
+        {"br-df", TERRITORY_BR_DF, 0x10000000},
+        {"br-es", TERRITORY_BR_ES, 0x10000000},
+        {"br-go", TERRITORY_BR_GO, 0x10000000},
+        {"br-ma", TERRITORY_BR_MA, 0x10000000},
+        {"br-mg", TERRITORY_BR_MG, 0x10000000},
+        {"br-ms", TERRITORY_BR_MS, 0x10000000},
+        {"br-mt", TERRITORY_BR_MT, 0x10000000},
+        {"br-pa", TERRITORY_BR_PA, 0x10000000},
+        {"br-pb", TERRITORY_BR_PB, 0x10000000},
+        {"br-pe", TERRITORY_BR_PE, 0x10000000},
+        {"br-pi", TERRITORY_BR_PI, 0x10000000},
+        {"br-pr", TERRITORY_BR_PR, 0x10000000},
+        {"br-rj", TERRITORY_BR_RJ, 0x10000000},
+        {"br-rn", TERRITORY_BR_RN, 0x10000000},
+        {"br-ro", TERRITORY_BR_RO, 0x10000000},
+        {"br-rr", TERRITORY_BR_RR, 0x10000000},
+        {"br-rs", TERRITORY_BR_RS, 0x10000000},
+        {"br-sc", TERRITORY_BR_SC, 0x10000000},
+        {"br-se", TERRITORY_BR_SE, 0x10000000},
+        {"br-sp", TERRITORY_BR_SP, 0x10000000},
+        {"br-to", TERRITORY_BR_TO, 0x10000000},
+        {"bra", TERRITORY_BRA, 0x10000000},
+        {"brasil", TERRITORY_BRA, 0x08180100},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_IT)
+        {"brasile", TERRITORY_BRA, 0x00008000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FI)
+        {"brasilia", TERRITORY_BRA, 0x00000200},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AF)
+        {"brasilie", TERRITORY_BRA, 0x00000001},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DA) || defined(MAPCODE_SUPPORT_LANGUAGE_DE) || defined(MAPCODE_SUPPORT_LANGUAGE_SV)
+        {"brasilien", TERRITORY_BRA, 0x00800060},
+#endif
+        {"brazil", TERRITORY_BRA, 0x01006080},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CS) || defined(MAPCODE_SUPPORT_LANGUAGE_NL)
+        {"brazilie", TERRITORY_BRA, 0x00040010},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PL)
+        {"brazylia", TERRITORY_BRA, 0x00200000},
+#endif
+        {"brb", TERRITORY_BRB, 0x10000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FR)
+        {"bresil", TERRITORY_BRA, 0x00000400},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"brezilya", TERRITORY_BRA, 0x02000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PL)
+        {"briansk oblast", TERRITORY_RU_BRY, 0x00200000},
+#endif
+        {"britain", TERRITORY_GBR, 0x00000080},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ID)
+        {"britania di samudra hindia", TERRITORY_IOT, 0x00004000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"britanska kolumbija", TERRITORY_CA_BC, 0x00002000},
+        {"britanski djevicanski otoci", TERRITORY_VGB, 0x00002000},
+        {"britanski indijskooceanski teritorij", TERRITORY_IOT, 0x00002000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"britanya virjin adaları", TERRITORY_VGB, 0x02000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DE)
+        {"britische jungferninseln", TERRITORY_VGB, 0x00000040},
+        {"britisches territorium im indischen ozean", TERRITORY_IOT, 0x00000040},
+#endif
+        {"british columbia", TERRITORY_CA_BC, 0x0b8cc0e1},
+        {"british indian ocean territory", TERRITORY_IOT, 0x080400a0},
+        {"british virgin islands", TERRITORY_VGB, 0x010040a0},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_NO)
+        {"britiske jomfruøyer", TERRITORY_VGB, 0x00080000},
+        {"britiske territoriet i indiahavet", TERRITORY_IOT, 0x00080000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AF)
+        {"britse indiese oseaan gebied", TERRITORY_IOT, 0x00000001},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_NL)
+        {"britse maagdeneilanden", TERRITORY_VGB, 0x00040000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AF)
+        {"britse virgin eilande", TERRITORY_VGB, 0x00000001},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CS)
+        {"britska kolumbie", TERRITORY_CA_BC, 0x00000010},
+        {"britske indickooceanske uzemi", TERRITORY_IOT, 0x00000010},
+        {"britske panenske ostrovy", TERRITORY_VGB, 0x00000010},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FI)
+        {"brittilainen intian valtameren alue", TERRITORY_IOT, 0x00000200},
+        {"brittilainen kolumbia", TERRITORY_CA_BC, 0x00000200},
+        {"brittilaiset neitsytsaaret", TERRITORY_VGB, 0x00000200},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_SV)
+        {"brittiska jungfruoarna", TERRITORY_VGB, 0x00800000},
+        {"brittiska territoriet i indiska oceanen", TERRITORY_IOT, 0x00800000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DE)
+        {"brjansk", TERRITORY_RU_BRY, 0x00000040},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_SV)
+        {"brjansk oblast", TERRITORY_RU_BRY, 0x00800000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CS) || defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"brjanska oblast", TERRITORY_RU_BRY, 0x00002010},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FI)
+        {"brjanskin alue", TERRITORY_RU_BRY, 0x00000200},
+#endif
+        {"brn", TERRITORY_BRN, 0x10000000},
+        {"brunei", TERRITORY_BRN, 0x03bcc7e1},
+        {"brunei darussalam", TERRITORY_BRN, 0x08000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CS) || defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"brunej", TERRITORY_BRN, 0x00002010},
+#endif
+        {"bryansk oblast", TERRITORY_RU_BRY, 0x030cc0a1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PL)
+        {"brytyjska kolumbia", TERRITORY_CA_BC, 0x00200000},
+        {"brytyjskie terytorium oceanu indyjskiego", TERRITORY_IOT, 0x00200000},
+        {"brytyjskie wyspy dziewicze", TERRITORY_VGB, 0x00200000},
+#endif
+        {"btn", TERRITORY_BTN, 0x10000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"bugarska", TERRITORY_BGR, 0x00002000},
+#endif
+        {"bulgaria", TERRITORY_BGR, 0x0118c380},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FR)
+        {"bulgarie", TERRITORY_BGR, 0x00000400},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DA) || defined(MAPCODE_SUPPORT_LANGUAGE_DE) || defined(MAPCODE_SUPPORT_LANGUAGE_SV)
+        {"bulgarien", TERRITORY_BGR, 0x00800060},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_NL)
+        {"bulgarije", TERRITORY_BGR, 0x00040000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"bulgaristan", TERRITORY_BGR, 0x02000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AF)
+        {"bulgarye", TERRITORY_BGR, 0x00000001},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CS)
+        {"bulharsko", TERRITORY_BGR, 0x00000010},
+#endif
+        {"buliwya", TERRITORY_BOL, 0x08000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ID)
+        {"bumi", TERRITORY_AAA, 0x00004000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FI)
+        {"burjatian tasavalta", TERRITORY_RU_BU, 0x00000200},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DE)
+        {"burjatien republik", TERRITORY_RU_BU, 0x00000040},
+#endif
+        {"burkina faso", TERRITORY_BFA, 0x0bbce7f1},
+        {"burma", TERRITORY_MMR, 0x038862a0},
+        {"burundi", TERRITORY_BDI, 0x0bbce7f1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"buryatia cumhuriyeti", TERRITORY_RU_BU, 0x02000000},
+#endif
+        {"buryatia republic", TERRITORY_RU_BU, 0x01044090},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AF)
+        {"buryatia republiek", TERRITORY_RU_BU, 0x00000001},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DA)
+        {"buryatia republik", TERRITORY_RU_BU, 0x00000020},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"buryatia republika", TERRITORY_RU_BU, 0x00002000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_NO)
+        {"buryatia republikk", TERRITORY_RU_BU, 0x00080000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ES) || defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"butan", TERRITORY_BTN, 0x00002100},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PT)
+        {"butao", TERRITORY_BTN, 0x00100000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"buyuk britanya", TERRITORY_GBR, 0x02000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PL)
+        {"bułgaria", TERRITORY_BGR, 0x00200000},
+#endif
+        {"bvt", TERRITORY_BVT, 0x10000000},
+        {"bwa", TERRITORY_BWA, 0x10000000},
+        {"ca-ab", TERRITORY_CA_AB, 0x10000000},
+        {"ca-bc", TERRITORY_CA_BC, 0x10000000},
+        {"ca-mb", TERRITORY_CA_MB, 0x10000000},
+        {"ca-nb", TERRITORY_CA_NB, 0x10000000},
+        {"ca-nl", TERRITORY_CA_NL, 0x10000000},
+        {"ca-ns", TERRITORY_CA_NS, 0x10000000},
+        {"ca-nt", TERRITORY_CA_NT, 0x10000000},
+        {"ca-nu", TERRITORY_CA_NU, 0x10000000},
+        {"ca-on", TERRITORY_CA_ON, 0x10000000},
+        {"ca-pe", TERRITORY_CA_PE, 0x10000000},
+        {"ca-qc", TERRITORY_CA_QC, 0x10000000},
+        {"ca-sk", TERRITORY_CA_SK, 0x10000000},
+        {"ca-yt", TERRITORY_CA_YT, 0x10000000},
+        {"cabo verde", TERRITORY_CPV, 0x08100180},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR) || defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"cad", TERRITORY_TCD, 0x02002000},
+#endif
+        {"caf", TERRITORY_CAF, 0x10000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CS) || defined(MAPCODE_SUPPORT_LANGUAGE_IT) || defined(MAPCODE_SUPPORT_LANGUAGE_SW)
+        {"caicos", TERRITORY_TCA, 0x01008010},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"caicos adaları", TERRITORY_TCA, 0x02000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AF)
+        {"caicos eilande", TERRITORY_TCA, 0x00000001},
+#endif
+        {"caicos islands", TERRITORY_TCA, 0x00004080},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DE)
+        {"caicos-inseln", TERRITORY_TCA, 0x00000040},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_NL)
+        {"caicoseilanden", TERRITORY_TCA, 0x00040000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_SV)
+        {"caicosoarna", TERRITORY_TCA, 0x00800000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FI)
+        {"caicossaaret", TERRITORY_TCA, 0x00000200},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DA)
+        {"caicosøerne", TERRITORY_TCA, 0x00000020},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_NO)
+        {"caicosøyene", TERRITORY_TCA, 0x00080000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FR)
+        {"caiques", TERRITORY_TCA, 0x00000400},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_SW)
+        {"caledonia new", TERRITORY_NCL, 0x01000000},
+#endif
+        {"california", TERRITORY_US_CA, 0x0b18c1a0},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FR) || defined(MAPCODE_SUPPORT_LANGUAGE_NL)
+        {"californie", TERRITORY_US_CA, 0x00040400},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PT)
+        {"camaroes", TERRITORY_CMR, 0x00100000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FR)
+        {"cambodge", TERRITORY_KHM, 0x00000400},
+#endif
+        {"cambodia", TERRITORY_KHM, 0x010000a0},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_NL)
+        {"cambodja", TERRITORY_KHM, 0x00040000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_IT)
+        {"cambogia", TERRITORY_KHM, 0x00008000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PT)
+        {"camboja", TERRITORY_KHM, 0x00100000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ES)
+        {"camboya", TERRITORY_KHM, 0x00000100},
+#endif
+        {"cameroon", TERRITORY_CMR, 0x010000a0},
+        {"cameroun", TERRITORY_CMR, 0x08000400},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ES) || defined(MAPCODE_SUPPORT_LANGUAGE_IT)
+        {"camerun", TERRITORY_CMR, 0x00008100},
+#endif
+        {"campeche", TERRITORY_MX_CAM, 0x0bbce7f1},
+        {"can", TERRITORY_CAN, 0x10000000},
+        {"canada", TERRITORY_CAN, 0x091c85a0},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_SV)
+        {"cap verde", TERRITORY_CPV, 0x00800000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FR)
+        {"cap-vert", TERRITORY_CPV, 0x00000400},
+#endif
+        {"cape verde", TERRITORY_CPV, 0x03004080},
+        {"capital territory", TERRITORY_AU_ACT, 0x08000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_IT)
+        {"capo verde", TERRITORY_CPV, 0x00008000},
+        {"carolina del nord", TERRITORY_US_NC, 0x00008000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ES)
+        {"carolina del norte", TERRITORY_US_NC, 0x00000100},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_IT)
+        {"carolina del sud", TERRITORY_US_SC, 0x00008000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ES)
+        {"carolina del sur", TERRITORY_US_SC, 0x00000100},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PT)
+        {"carolina do norte", TERRITORY_US_NC, 0x00100000},
+        {"carolina do sul", TERRITORY_US_SC, 0x00100000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FR)
+        {"caroline du nord", TERRITORY_US_NC, 0x00000400},
+        {"caroline du sud", TERRITORY_US_SC, 0x00000400},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PT)
+        {"catar", TERRITORY_QAT, 0x00100000},
+        {"caxemira", TERRITORY_IN_JK, 0x00100000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"cayman adaları", TERRITORY_CYM, 0x02000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_NL)
+        {"cayman eilanden", TERRITORY_CYM, 0x00040000},
+#endif
+        {"cayman islands", TERRITORY_CYM, 0x080000a0},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DE)
+        {"cayman-inseln", TERRITORY_CYM, 0x00000040},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_SV)
+        {"caymanoarna", TERRITORY_CYM, 0x00800000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FI)
+        {"caymansaaret", TERRITORY_CYM, 0x00000200},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_NO)
+        {"caymanøyene", TERRITORY_CYM, 0x00080000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PT)
+        {"cazaquistao", TERRITORY_KAZ, 0x00100000},
+#endif
+        {"cck", TERRITORY_CCK, 0x10000000},
+        {"ceara", TERRITORY_BR_CE, 0x0bbce7f1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"cebelitarık", TERRITORY_GIB, 0x02000000},
+        {"cecen cumhuriyeti", TERRITORY_RU_CE, 0x02000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"cecenija republika", TERRITORY_RU_CE, 0x00002000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CS)
+        {"cecenska republika", TERRITORY_RU_CE, 0x00000010},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"cek cumhuriyeti", TERRITORY_CZE, 0x02000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CS)
+        {"celjabinsk oblast", TERRITORY_RU_CH, 0x00000010},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_NL)
+        {"centraal-afrikaanse republiek", TERRITORY_CAF, 0x00040000},
+#endif
+        {"centrafricaine", TERRITORY_CAF, 0x08000000},
+        {"central african republic", TERRITORY_CAF, 0x00000080},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_SV)
+        {"centralafrikanska republiken", TERRITORY_CAF, 0x00800000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DA)
+        {"centralafrikanske republik", TERRITORY_CAF, 0x00000020},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CS)
+        {"cerna hora", TERRITORY_MNE, 0x00000010},
+#endif
+        {"ceska republika", TERRITORY_CZE, 0x08002010},
+        {"cesko", TERRITORY_CZE, 0x08000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"cezayir", TERRITORY_DZA, 0x02000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_SV)
+        {"chabarovsk", TERRITORY_RU_KHA, 0x00800000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CS)
+        {"chabarovsky kraj", TERRITORY_RU_KHA, 0x00000010},
+#endif
+        {"chad", TERRITORY_TCD, 0x0900c3b1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PT)
+        {"chade", TERRITORY_TCD, 0x00100000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CS)
+        {"chakaske republice", TERRITORY_RU_KK, 0x00000010},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DE)
+        {"chakassien republik", TERRITORY_RU_KK, 0x00000040},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_SV)
+        {"chakassien republiken", TERRITORY_RU_KK, 0x00800000},
+#endif
+        {"chandigarh", TERRITORY_IN_CH, 0x0bbce7f1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CS) || defined(MAPCODE_SUPPORT_LANGUAGE_PL)
+        {"chanty-mansi", TERRITORY_RU_KM, 0x00200010},
+#endif
+        {"che", TERRITORY_CHE, 0x10000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_SW)
+        {"chechen jamhuri", TERRITORY_RU_CE, 0x01000000},
+#endif
+        {"chechen republic", TERRITORY_RU_CE, 0x00000080},
+        {"chechnya", TERRITORY_RU_CE, 0x00000080},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"chelyabinsk", TERRITORY_RU_CH, 0x02000000},
+#endif
+        {"chelyabinsk oblast", TERRITORY_RU_CH, 0x0114e1e1},
+        {"chhattisgarh", TERRITORY_IN_CT, 0x03bce7f1},
+        {"chiapas", TERRITORY_MX_CHP, 0x0bbce7f1},
+        {"chihuahua", TERRITORY_MX_CHH, 0x0bbce7f1},
+        {"chile", TERRITORY_CHL, 0x09b883f0},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AF) || defined(MAPCODE_SUPPORT_LANGUAGE_FR) || defined(MAPCODE_SUPPORT_LANGUAGE_ID) || defined(MAPCODE_SUPPORT_LANGUAGE_NL)
+        {"chili", TERRITORY_CHL, 0x00044401},
+#endif
+        {"china", TERRITORY_CHN, 0x011401c0},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FR)
+        {"chine", TERRITORY_CHN, 0x00000400},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PL)
+        {"chiny", TERRITORY_CHN, 0x00200000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ES) || defined(MAPCODE_SUPPORT_LANGUAGE_PT)
+        {"chipre", TERRITORY_CYP, 0x00100100},
+#endif
+        {"chl", TERRITORY_CHL, 0x10000000},
+        {"chn", TERRITORY_CHN, 0x10000000},
+        {"chongqing", TERRITORY_CN_CQ, 0x03bce7f1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CS)
+        {"chorvatsko", TERRITORY_HRV, 0x00000010},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PL)
+        {"chorwacja", TERRITORY_HRV, 0x00200000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DE)
+        {"christi himmelfahrt", TERRITORY_SHN, 0x00000040},
+#endif
+        {"christmas island", TERRITORY_CXR, 0x08044081},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_NO)
+        {"christmasøya", TERRITORY_CXR, 0x00080000},
+#endif
+        {"chukotka okrug", TERRITORY_RU_CHU, 0x03bce181},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FI)
+        {"chukotkan okrugin", TERRITORY_RU_CHU, 0x00000200},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_SW)
+        {"chuvash jamhuri", TERRITORY_RU_CU, 0x01000000},
+#endif
+        {"chuvash republic", TERRITORY_RU_CU, 0x00a8c0b0},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AF) || defined(MAPCODE_SUPPORT_LANGUAGE_NL)
+        {"chuvash republiek", TERRITORY_RU_CU, 0x00040001},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FR)
+        {"chypre", TERRITORY_CYP, 0x00000400},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"cibuti", TERRITORY_DJI, 0x02000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PT)
+        {"cidade do vaticano", TERRITORY_VAT, 0x00100000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"cile", TERRITORY_CHL, 0x00002000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"cin halk cumhuriyeti", TERRITORY_CHN, 0x02000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CS) || defined(MAPCODE_SUPPORT_LANGUAGE_ID) || defined(MAPCODE_SUPPORT_LANGUAGE_IT)
+        {"cina", TERRITORY_CHN, 0x0000c010},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PT)
+        {"cingapura", TERRITORY_SGP, 0x00100000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"cipar", TERRITORY_CYP, 0x00002000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_IT)
+        {"cipro", TERRITORY_CYP, 0x00008000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AF)
+        {"ciprus", TERRITORY_CYP, 0x00000001},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FR)
+        {"cite du vatican", TERRITORY_VAT, 0x00000400},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_IT)
+        {"citta del vaticano", TERRITORY_VAT, 0x00008000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ES)
+        {"ciudad del vaticano", TERRITORY_VAT, 0x00000100},
+#endif
+        {"civ", TERRITORY_CIV, 0x10000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_SV)
+        {"clipperton", TERRITORY_CPT, 0x00800000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"clipperton adası", TERRITORY_CPT, 0x02000000},
+#endif
+        {"clipperton island", TERRITORY_CPT, 0x000400b1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_SW)
+        {"clipperton kisiwa", TERRITORY_CPT, 0x01000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DE)
+        {"clipperton-insel", TERRITORY_CPT, 0x00000040},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FI)
+        {"clippertoninsaari", TERRITORY_CPT, 0x00000200},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_NO)
+        {"clippertonøya", TERRITORY_CPT, 0x00080000},
+#endif
+        {"cmr", TERRITORY_CMR, 0x10000000},
+        {"cn-ah", TERRITORY_CN_AH, 0x10000000},
+        {"cn-bj", TERRITORY_CN_BJ, 0x10000000},
+        {"cn-cq", TERRITORY_CN_CQ, 0x10000000},
+        {"cn-fj", TERRITORY_CN_FJ, 0x10000000},
+        {"cn-gd", TERRITORY_CN_GD, 0x10000000},
+        {"cn-gs", TERRITORY_CN_GS, 0x10000000},
+        {"cn-gx", TERRITORY_CN_GX, 0x10000000},
+        {"cn-gz", TERRITORY_CN_GZ, 0x10000000},
+        {"cn-ha", TERRITORY_CN_HA, 0x10000000},
+        {"cn-hb", TERRITORY_CN_HB, 0x10000000},
+        {"cn-he", TERRITORY_CN_HE, 0x10000000},
+        {"cn-hi", TERRITORY_CN_HI, 0x10000000},
+        {"cn-hl", TERRITORY_CN_HL, 0x10000000},
+        {"cn-hn", TERRITORY_CN_HN, 0x10000000},
+        {"cn-jl", TERRITORY_CN_JL, 0x10000000},
+        {"cn-js", TERRITORY_CN_JS, 0x10000000},
+        {"cn-jx", TERRITORY_CN_JX, 0x10000000},
+        {"cn-ln", TERRITORY_CN_LN, 0x10000000},
+        {"cn-nm", TERRITORY_CN_NM, 0x10000000},
+        {"cn-nx", TERRITORY_CN_NX, 0x10000000},
+        {"cn-qh", TERRITORY_CN_QH, 0x10000000},
+        {"cn-sc", TERRITORY_CN_SC, 0x10000000},
+        {"cn-sd", TERRITORY_CN_SD, 0x10000000},
+        {"cn-sh", TERRITORY_CN_SH, 0x10000000},
+        {"cn-sn", TERRITORY_CN_SN, 0x10000000},
+        {"cn-sx", TERRITORY_CN_SX, 0x10000000},
+        {"cn-tj", TERRITORY_CN_TJ, 0x10000000},
+        {"cn-xj", TERRITORY_CN_XJ, 0x10000000},
+        {"cn-xz", TERRITORY_CN_XZ, 0x10000000},
+        {"cn-yn", TERRITORY_CN_YN, 0x10000000},
+        {"cn-zj", TERRITORY_CN_ZJ, 0x10000000},
+        {"coahuila", TERRITORY_MX_COA, 0x0bbce7f1},
+        {"coahuila de zaragoza", TERRITORY_MX_COA, 0x08000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"cocos adaları", TERRITORY_CCK, 0x02000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_NL)
+        {"cocos eilanden", TERRITORY_CCK, 0x00040000},
+#endif
+        {"cocos islands", TERRITORY_CCK, 0x08000081},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_SW)
+        {"cocos visiwa vya", TERRITORY_CCK, 0x01000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DA)
+        {"cocosøerne", TERRITORY_CCK, 0x00000020},
+#endif
+        {"cod", TERRITORY_COD, 0x10000000},
+        {"cog", TERRITORY_COG, 0x10000000},
+        {"cok", TERRITORY_COK, 0x10000000},
+        {"col", TERRITORY_COL, 0x10000000},
+        {"colima", TERRITORY_MX_CL, 0x0bbce7f1},
+        {"colombia", TERRITORY_COL, 0x099c81a1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FR)
+        {"colombie", TERRITORY_COL, 0x00000400},
+#endif
+        {"colombie-britannique", TERRITORY_CA_BC, 0x08000400},
+        {"colorado", TERRITORY_US_CO, 0x0b9cc7f1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"colorado eyaletinde bir sehir", TERRITORY_MX_DUR, 0x02000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ES) || defined(MAPCODE_SUPPORT_LANGUAGE_PT)
+        {"columbia britanica", TERRITORY_CA_BC, 0x00100100},
+#endif
+        {"com", TERRITORY_COM, 0x10000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ES)
+        {"comoras", TERRITORY_COM, 0x00000100},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AF) || defined(MAPCODE_SUPPORT_LANGUAGE_IT)
+        {"comore", TERRITORY_COM, 0x00008001},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_NL)
+        {"comoren", TERRITORY_COM, 0x00040000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DA)
+        {"comorerne", TERRITORY_COM, 0x00000020},
+#endif
+        {"comores", TERRITORY_COM, 0x08100400},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_SW)
+        {"comoro", TERRITORY_COM, 0x01000000},
+#endif
+        {"comoros", TERRITORY_COM, 0x00800080},
+        {"congo", TERRITORY_COG, 0x08000000},
+        {"congo-brazzaville", TERRITORY_COG, 0x011485a0},
+        {"congo-kinshasa", TERRITORY_COD, 0x011485a0},
+        {"connecticut", TERRITORY_US_CT, 0x0bbce7f1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"cook adaları", TERRITORY_COK, 0x02000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AF)
+        {"cook eilande", TERRITORY_COK, 0x00000001},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_NL)
+        {"cook eilanden", TERRITORY_COK, 0x00040000},
+#endif
+        {"cook islands", TERRITORY_COK, 0x08000080},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_SV)
+        {"cook oarna", TERRITORY_COK, 0x00800000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FI)
+        {"cook saaret", TERRITORY_COK, 0x00000200},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PL)
+        {"cooka, wyspy", TERRITORY_COK, 0x00200000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DE)
+        {"cookinseln", TERRITORY_COK, 0x00000040},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"cookovi otoci", TERRITORY_COK, 0x00002000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CS)
+        {"cookovy ostrovy", TERRITORY_COK, 0x00000010},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DA)
+        {"cookøerne", TERRITORY_COK, 0x00000020},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_NO)
+        {"cookøyene", TERRITORY_COK, 0x00080000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_IT)
+        {"corea del nord", TERRITORY_PRK, 0x00008000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ES)
+        {"corea del norte", TERRITORY_PRK, 0x00000100},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_IT)
+        {"corea del sud", TERRITORY_KOR, 0x00008000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ES)
+        {"corea del sur", TERRITORY_KOR, 0x00000100},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FR)
+        {"coree du nord", TERRITORY_PRK, 0x00000400},
+        {"coree du sud", TERRITORY_KOR, 0x00000400},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PT)
+        {"coreia do norte", TERRITORY_PRK, 0x00100000},
+        {"coreia do sul", TERRITORY_KOR, 0x00100000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_IT)
+        {"costa d`avorio", TERRITORY_CIV, 0x00008000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ES)
+        {"costa de marfil", TERRITORY_CIV, 0x00000100},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PT)
+        {"costa do marfim", TERRITORY_CIV, 0x00100000},
+#endif
+        {"costa rica", TERRITORY_CRI, 0x099c87e1},
+        {"cote d'ivoire", TERRITORY_CIV, 0x08000080},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FR)
+        {"cote-d`ivoire", TERRITORY_CIV, 0x00000400},
+#endif
+        {"cpt", TERRITORY_CPT, 0x10000000},
+        {"cpv", TERRITORY_CPV, 0x10000000},
+        {"cri", TERRITORY_CRI, 0x10000000},
+        {"crna gora", TERRITORY_MNE, 0x08002000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ES) || defined(MAPCODE_SUPPORT_LANGUAGE_PT)
+        {"croacia", TERRITORY_HRV, 0x00100100},
+#endif
+        {"croatia", TERRITORY_HRV, 0x01000080},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FR)
+        {"croatie", TERRITORY_HRV, 0x00000400},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_IT)
+        {"croazia", TERRITORY_HRV, 0x00008000},
+#endif
+        {"cub", TERRITORY_CUB, 0x10000000},
+        {"cuba", TERRITORY_CUB, 0x091c85a0},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CS)
+        {"cukotka okrug", TERRITORY_RU_CHU, 0x00000010},
+#endif
+        {"curacao", TERRITORY_CUW, 0x0bbce6f1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ES)
+        {"curazao", TERRITORY_CUW, 0x00000100},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"cuvas cumhuriyeti", TERRITORY_RU_CU, 0x02000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"cuvaski republika", TERRITORY_RU_CU, 0x00002000},
+#endif
+        {"cuw", TERRITORY_CUW, 0x10000000},
+        {"cxr", TERRITORY_CXR, 0x10000000},
+        {"cym", TERRITORY_CYM, 0x10000000},
+        {"cyp", TERRITORY_CYP, 0x10000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DA) || defined(MAPCODE_SUPPORT_LANGUAGE_SV)
+        {"cypern", TERRITORY_CYP, 0x00800020},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PL)
+        {"cypr", TERRITORY_CYP, 0x00200000},
+#endif
+        {"cyprus", TERRITORY_CYP, 0x01040080},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PL)
+        {"czad", TERRITORY_TCD, 0x00200000},
+        {"czarnogora", TERRITORY_MNE, 0x00200000},
+#endif
+        {"cze", TERRITORY_CZE, 0x10000000},
+        {"czech republic", TERRITORY_CZE, 0x00000080},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PL)
+        {"czechy", TERRITORY_CZE, 0x00200000},
+        {"czeczenia", TERRITORY_RU_CE, 0x00200000},
+#endif
+        {"dadra", TERRITORY_IN_DN, 0x00000080},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CS)
+        {"dadra a nagar haveli", TERRITORY_IN_DN, 0x00000010},
+#endif
+        {"dadra and nagar haveli", TERRITORY_IN_DN, 0x0a800080},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ID)
+        {"dadra dan nagar haveli", TERRITORY_IN_DN, 0x00004000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_IT) || defined(MAPCODE_SUPPORT_LANGUAGE_PT)
+        {"dadra e nagar haveli", TERRITORY_IN_DN, 0x00108000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AF) || defined(MAPCODE_SUPPORT_LANGUAGE_NL)
+        {"dadra en nagar haveli", TERRITORY_IN_DN, 0x00040001},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FR)
+        {"dadra et nagar haveli", TERRITORY_IN_DN, 0x00000400},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"dadra i nagar haveli", TERRITORY_IN_DN, 0x00002000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PL)
+        {"dadra i nagarhaweli", TERRITORY_IN_DN, 0x00200000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FI)
+        {"dadra ja nagar haveli", TERRITORY_IN_DN, 0x00000200},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_SW)
+        {"dadra na nagar haveli", TERRITORY_IN_DN, 0x01000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DA) || defined(MAPCODE_SUPPORT_LANGUAGE_NO)
+        {"dadra og nagar haveli", TERRITORY_IN_DN, 0x00080020},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DE)
+        {"dadra und nagar haveli", TERRITORY_IN_DN, 0x00000040},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ES)
+        {"dadra y nagar haveli", TERRITORY_IN_DN, 0x00000100},
+#endif
+        {"dagestan republic", TERRITORY_RU_DA, 0x01002090},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_NL)
+        {"dagestan republiek", TERRITORY_RU_DA, 0x00040000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DA) || defined(MAPCODE_SUPPORT_LANGUAGE_ID)
+        {"dagestan republik", TERRITORY_RU_DA, 0x00004020},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_SV)
+        {"dagestan republiken", TERRITORY_RU_DA, 0x00800000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_NO)
+        {"dagestan republikk", TERRITORY_RU_DA, 0x00080000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FI)
+        {"dagestanin tasavalta", TERRITORY_RU_DA, 0x00000200},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"dagıstan cumhuriyeti", TERRITORY_RU_DA, 0x02000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_IT)
+        {"dakota del nord", TERRITORY_US_ND, 0x00008000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ES)
+        {"dakota del norte", TERRITORY_US_ND, 0x00000100},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_IT)
+        {"dakota del sud", TERRITORY_US_SD, 0x00008000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ES)
+        {"dakota del sur", TERRITORY_US_SD, 0x00000100},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PT)
+        {"dakota do norte", TERRITORY_US_ND, 0x00100000},
+        {"dakota do sul", TERRITORY_US_SD, 0x00100000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FR)
+        {"dakota du nord", TERRITORY_US_ND, 0x00000400},
+        {"dakota du sud", TERRITORY_US_SD, 0x00000400},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PL)
+        {"dakota połnocna", TERRITORY_US_ND, 0x00200000},
+        {"dakota południowa", TERRITORY_US_SD, 0x00200000},
+        {"dalekie wyspy mniejsze stanow zjednoczonych", TERRITORY_UMI, 0x00200000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CS)
+        {"daman a diu", TERRITORY_IN_DD, 0x00000010},
+#endif
+        {"daman and diu", TERRITORY_IN_DD, 0x0200a080},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ID)
+        {"daman dan diu", TERRITORY_IN_DD, 0x00004000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AF) || defined(MAPCODE_SUPPORT_LANGUAGE_NL)
+        {"daman en diu", TERRITORY_IN_DD, 0x00040001},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FR)
+        {"daman et diu", TERRITORY_IN_DD, 0x00000400},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PL)
+        {"daman i diu", TERRITORY_IN_DD, 0x00200000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FI)
+        {"daman ja diu", TERRITORY_IN_DD, 0x00000200},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_SW)
+        {"daman na diu", TERRITORY_IN_DD, 0x01000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_SV)
+        {"daman och diu", TERRITORY_IN_DD, 0x00800000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DA) || defined(MAPCODE_SUPPORT_LANGUAGE_NO)
+        {"daman og diu", TERRITORY_IN_DD, 0x00080020},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DE)
+        {"daman und diu", TERRITORY_IN_DD, 0x00000040},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ES)
+        {"daman y diu", TERRITORY_IN_DD, 0x00000100},
+#endif
+        {"damao e diu", TERRITORY_IN_DD, 0x08100000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DE) || defined(MAPCODE_SUPPORT_LANGUAGE_FR)
+        {"danemark", TERRITORY_DNK, 0x00000440},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PL)
+        {"dania", TERRITORY_DNK, 0x00200000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_IT)
+        {"danimarca", TERRITORY_DNK, 0x00008000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"danimarka", TERRITORY_DNK, 0x02000000},
+#endif
+        {"danmark", TERRITORY_DNK, 0x08880020},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"danska", TERRITORY_DNK, 0x00002000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CS)
+        {"dansko", TERRITORY_DNK, 0x00000010},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ID)
+        {"daratan selatan dan antarktika perancis", TERRITORY_ATF, 0x00004000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"delaver", TERRITORY_US_DE, 0x00002000},
+#endif
+        {"delaware", TERRITORY_US_DE, 0x0bbcc7f1},
+        {"delhi", TERRITORY_IN_DL, 0x0bbce7f1},
+        {"democratic people's republic of korea", TERRITORY_PRK, 0x00000080},
+        {"democratic republic of the congo", TERRITORY_COD, 0x00000080},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_NO)
+        {"demokratiske republikken kongo", TERRITORY_COD, 0x00080000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PL)
+        {"demokratyczna republika konga", TERRITORY_COD, 0x00200000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DA)
+        {"den dominikanske republik", TERRITORY_DOM, 0x00000020},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_NO)
+        {"den jødiske autonome oblast", TERRITORY_RU_YEV, 0x00080000},
+        {"den sentralafrikanske republikk", TERRITORY_CAF, 0x00080000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AF)
+        {"denemarke", TERRITORY_DNK, 0x00000001},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_NL)
+        {"denemarken", TERRITORY_DNK, 0x00040000},
+#endif
+        {"denmark", TERRITORY_DNK, 0x01004080},
+        {"deu", TERRITORY_DEU, 0x10000000},
+        {"deutschland", TERRITORY_DEU, 0x08000040},
+        {"dhivehi raa'jeyge jumhooriyya", TERRITORY_MDV, 0x08000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ES) || defined(MAPCODE_SUPPORT_LANGUAGE_PT)
+        {"dinamarca", TERRITORY_DNK, 0x00100100},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_IT)
+        {"distretto della colombia", TERRITORY_US_DC, 0x00008000},
+        {"distretto federale", TERRITORY_MX_DIF, 0x00008000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FR)
+        {"district autonome de nenetsie", TERRITORY_RU_NEN, 0x00000400},
+        {"district de columbia", TERRITORY_US_DC, 0x00000400},
+        {"district federal", TERRITORY_MX_DIF, 0x00000400},
+        {"district federal", TERRITORY_BR_DF, 0x00000400},
+#endif
+        {"district of columbia", TERRITORY_US_DC, 0x088c62e0},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ID)
+        {"distrik federal", TERRITORY_MX_DIF, 0x00004000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AF)
+        {"distrik van columbia", TERRITORY_US_DC, 0x00000001},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ES) || defined(MAPCODE_SUPPORT_LANGUAGE_PT)
+        {"distrito de columbia", TERRITORY_US_DC, 0x00100100},
+        {"distrito federal", TERRITORY_MX_DIF, 0x00100100},
+#endif
+        {"distrito federal", TERRITORY_BR_DF, 0x0bbcc3f1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"djevicanski otoci, britanski", TERRITORY_VGB, 0x00002000},
+        {"djevicanski otoci, sad", TERRITORY_VIR, 0x00002000},
+#endif
+        {"dji", TERRITORY_DJI, 0x10000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AF)
+        {"djiboeti", TERRITORY_DJI, 0x00000001},
+#endif
+        {"djibouti", TERRITORY_DJI, 0x019cc7a0},
+        {"dma", TERRITORY_DMA, 0x10000000},
+        {"dnk", TERRITORY_DNK, 0x10000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"dogu timor", TERRITORY_TLS, 0x02000000},
+#endif
+        {"dom", TERRITORY_DOM, 0x10000000},
+        {"dominica", TERRITORY_DMA, 0x019cc3e1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_NL)
+        {"dominicaanse republiek", TERRITORY_DOM, 0x00040000},
+#endif
+        {"dominican republic", TERRITORY_DOM, 0x00000080},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"dominik cumhuriyeti", TERRITORY_DOM, 0x02000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CS) || defined(MAPCODE_SUPPORT_LANGUAGE_HR) || defined(MAPCODE_SUPPORT_LANGUAGE_PL) || defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"dominika", TERRITORY_DMA, 0x02202010},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FI)
+        {"dominikaaninen tasavalta", TERRITORY_DOM, 0x00000200},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AF)
+        {"dominikaanse republiek", TERRITORY_DOM, 0x00000001},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PL)
+        {"dominikana", TERRITORY_DOM, 0x00200000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DE)
+        {"dominikanische republik", TERRITORY_DOM, 0x00000040},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CS) || defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"dominikanska republika", TERRITORY_DOM, 0x00002010},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_SV)
+        {"dominikanska republiken", TERRITORY_DOM, 0x00800000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_NO)
+        {"dominikanske republikk", TERRITORY_DOM, 0x00080000},
+#endif
+        {"dominique", TERRITORY_DMA, 0x08000400},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"drzava meksiko", TERRITORY_MX_MX, 0x00002000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DE)
+        {"dschibuti", TERRITORY_DJI, 0x00000040},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AF) || defined(MAPCODE_SUPPORT_LANGUAGE_NL)
+        {"duitsland", TERRITORY_DEU, 0x00040001},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ID) || defined(MAPCODE_SUPPORT_LANGUAGE_SW)
+        {"dunia", TERRITORY_AAA, 0x01004000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"dunya", TERRITORY_AAA, 0x02000000},
+#endif
+        {"durango", TERRITORY_MX_DUR, 0x09bce7f1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PL)
+        {"dystrykt kolumbii", TERRITORY_US_DC, 0x00200000},
+#endif
+        {"dza", TERRITORY_DZA, 0x10000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CS)
+        {"dzammu a kasmir", TERRITORY_IN_JK, 0x00000010},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PL)
+        {"dzammu i kaszmir", TERRITORY_IN_JK, 0x00200000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR) || defined(MAPCODE_SUPPORT_LANGUAGE_PL)
+        {"dzibuti", TERRITORY_DJI, 0x00202000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CS)
+        {"dzibutsko", TERRITORY_DJI, 0x00000010},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PL)
+        {"dziewicze, brytyjskie wyspy", TERRITORY_VGB, 0x00200000},
+#endif
+        {"earth", TERRITORY_AAA, 0x08000080},
+        {"east congo", TERRITORY_COD, 0x00000080},
+        {"east timor", TERRITORY_TLS, 0x00000080},
+        {"ecu", TERRITORY_ECU, 0x10000000},
+        {"ecuador", TERRITORY_ECU, 0x098c83e1},
+        {"eesti", TERRITORY_EST, 0x08000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"egipat", TERRITORY_EGY, 0x00002000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PL)
+        {"egipt", TERRITORY_EGY, 0x00200000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AF)
+        {"egipte", TERRITORY_EGY, 0x00000001},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ES)
+        {"egipto", TERRITORY_EGY, 0x00000100},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PT)
+        {"egito", TERRITORY_EGY, 0x00100000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_IT)
+        {"egitto", TERRITORY_EGY, 0x00008000},
+#endif
+        {"egy", TERRITORY_EGY, 0x10000000},
+        {"egypt", TERRITORY_EGY, 0x08080090},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FR) || defined(MAPCODE_SUPPORT_LANGUAGE_NL)
+        {"egypte", TERRITORY_EGY, 0x00040400},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DA) || defined(MAPCODE_SUPPORT_LANGUAGE_SV)
+        {"egypten", TERRITORY_EGY, 0x00800020},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FI)
+        {"egypti", TERRITORY_EGY, 0x00000200},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AF)
+        {"eiland man", TERRITORY_IMN, 0x00000001},
+#endif
+        {"eire", TERRITORY_IRL, 0x08000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ID)
+        {"ekuador", TERRITORY_ECU, 0x00004000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CS) || defined(MAPCODE_SUPPORT_LANGUAGE_HR) || defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"ekvador", TERRITORY_ECU, 0x02002010},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"ekvator ginesi", TERRITORY_GNQ, 0x02000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_NO)
+        {"ekvatorial-guinea", TERRITORY_GNQ, 0x00080000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_SV)
+        {"ekvatorialguinea", TERRITORY_GNQ, 0x00800000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"ekvatorijalna gvineja", TERRITORY_GNQ, 0x00002000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PL)
+        {"ekwador", TERRITORY_ECU, 0x00200000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AF)
+        {"ekwatoriaal-guinee", TERRITORY_GNQ, 0x00000001},
+#endif
+        {"el salvador", TERRITORY_SLV, 0x0b9cc3d1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DE)
+        {"elfenbeinkuste", TERRITORY_CIV, 0x00000040},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_SV)
+        {"elfenbenskusten", TERRITORY_CIV, 0x00800000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DA) || defined(MAPCODE_SUPPORT_LANGUAGE_NO)
+        {"elfenbenskysten", TERRITORY_CIV, 0x00080020},
+#endif
+        {"ellan vannin", TERRITORY_IMN, 0x08000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PT)
+        {"emirados arabes unidos", TERRITORY_ARE, 0x00100000},
+#endif
+        {"emirates", TERRITORY_ARE, 0x08000080},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_IT)
+        {"emirati arabi uniti", TERRITORY_ARE, 0x00008000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ES)
+        {"emiratos arabes unidos", TERRITORY_ARE, 0x00000100},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FR)
+        {"emirats arabes unis", TERRITORY_ARE, 0x00000400},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"endonezya", TERRITORY_IDN, 0x02000000},
+#endif
+        {"england", TERRITORY_GBR, 0x00000080},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PT)
+        {"equador", TERRITORY_ECU, 0x00100000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FR)
+        {"equateur", TERRITORY_ECU, 0x00000400},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_NL)
+        {"equatoriaal-guinea", TERRITORY_GNQ, 0x00040000},
+#endif
+        {"equatorial guinea", TERRITORY_GNQ, 0x01000080},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DE)
+        {"erde", TERRITORY_AAA, 0x00000040},
+#endif
+        {"eri", TERRITORY_ERI, 0x10000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"eritre", TERRITORY_ERI, 0x02000000},
+#endif
+        {"eritrea", TERRITORY_ERI, 0x098c43f1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PT)
+        {"eritreia", TERRITORY_ERI, 0x00100000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"eritreja", TERRITORY_ERI, 0x00002000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"ermenistan", TERRITORY_ARM, 0x02000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FR)
+        {"erythree", TERRITORY_ERI, 0x00000400},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PL)
+        {"erytrea", TERRITORY_ERI, 0x00200000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ES) || defined(MAPCODE_SUPPORT_LANGUAGE_PT)
+        {"escocia", TERRITORY_GBR, 0x00100100},
+#endif
+        {"esh", TERRITORY_ESH, 0x10000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ES) || defined(MAPCODE_SUPPORT_LANGUAGE_PT)
+        {"eslovaquia", TERRITORY_SVK, 0x00100100},
+        {"eslovenia", TERRITORY_SVN, 0x00100100},
+#endif
+        {"esp", TERRITORY_ESP, 0x10000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FR)
+        {"espagne", TERRITORY_ESP, 0x00000400},
+#endif
+        {"espana", TERRITORY_ESP, 0x08000100},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PT)
+        {"espanha", TERRITORY_ESP, 0x00100000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FI)
+        {"espanja", TERRITORY_ESP, 0x00000200},
+#endif
+        {"espirito santo", TERRITORY_BR_ES, 0x0bbce7f1},
+        {"est", TERRITORY_EST, 0x10000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ES)
+        {"estado de mexico", TERRITORY_MX_MX, 0x00000100},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PT)
+        {"estado do mexico", TERRITORY_MX_MX, 0x00100000},
+        {"estados federados da micronesia", TERRITORY_FSM, 0x00100000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ES)
+        {"estados federados de micronesia", TERRITORY_FSM, 0x00000100},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PT)
+        {"estados unidos da america", TERRITORY_USA, 0x00100000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ES)
+        {"estados unidos de america", TERRITORY_USA, 0x00000100},
+#endif
+        {"estados unidos mexicanos", TERRITORY_MEX, 0x08000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AF) || defined(MAPCODE_SUPPORT_LANGUAGE_DA) || defined(MAPCODE_SUPPORT_LANGUAGE_DE) || defined(MAPCODE_SUPPORT_LANGUAGE_NL) || defined(MAPCODE_SUPPORT_LANGUAGE_NO) || defined(MAPCODE_SUPPORT_LANGUAGE_SV)
+        {"estland", TERRITORY_EST, 0x008c0061},
+#endif
+        {"estonia", TERRITORY_EST, 0x0130c180},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FR)
+        {"estonie", TERRITORY_EST, 0x00000400},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"estonija", TERRITORY_EST, 0x00002000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CS)
+        {"estonsko", TERRITORY_EST, 0x00000010},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"estonya", TERRITORY_EST, 0x02000000},
+#endif
+        {"eswatini", TERRITORY_SWZ, 0x08000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FR)
+        {"etat de mexico", TERRITORY_MX_MX, 0x00000400},
+        {"etats federes de micronesie", TERRITORY_FSM, 0x00000400},
+        {"etats-unis d`amerique", TERRITORY_USA, 0x00000400},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FI)
+        {"etela-afrikka", TERRITORY_ZAF, 0x00000200},
+        {"etela-carolina", TERRITORY_US_SC, 0x00000200},
+        {"etela-dakota", TERRITORY_US_SD, 0x00000200},
+        {"etela-georgia ja etelaiset sandwichsaaret", TERRITORY_SGS, 0x00000200},
+        {"etela-korea", TERRITORY_KOR, 0x00000200},
+        {"etela-sudan", TERRITORY_SSD, 0x00000200},
+#endif
+        {"eth", TERRITORY_ETH, 0x10000000},
+        {"ethiopia", TERRITORY_ETH, 0x09000080},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AF) || defined(MAPCODE_SUPPORT_LANGUAGE_FR) || defined(MAPCODE_SUPPORT_LANGUAGE_NL)
+        {"ethiopie", TERRITORY_ETH, 0x00040401},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ES) || defined(MAPCODE_SUPPORT_LANGUAGE_FI) || defined(MAPCODE_SUPPORT_LANGUAGE_ID) || defined(MAPCODE_SUPPORT_LANGUAGE_IT) || defined(MAPCODE_SUPPORT_LANGUAGE_NO) || defined(MAPCODE_SUPPORT_LANGUAGE_PT) || defined(MAPCODE_SUPPORT_LANGUAGE_PL)
+        {"etiopia", TERRITORY_ETH, 0x0038c300},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CS)
+        {"etiopie", TERRITORY_ETH, 0x00000010},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DA) || defined(MAPCODE_SUPPORT_LANGUAGE_SV)
+        {"etiopien", TERRITORY_ETH, 0x00800020},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"etiopija", TERRITORY_ETH, 0x00002000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"etiyopya", TERRITORY_ETH, 0x02000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PT)
+        {"eua", TERRITORY_USA, 0x00100000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_NL)
+        {"faeroer", TERRITORY_FRO, 0x00040000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CS)
+        {"faerske ostrovy", TERRITORY_FRO, 0x00000010},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"falkland adaları", TERRITORY_FLK, 0x02000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_NL)
+        {"falkland eilanden", TERRITORY_FLK, 0x00040000},
+#endif
+        {"falkland islands", TERRITORY_FLK, 0x08000080},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AF)
+        {"falkland-eilande", TERRITORY_FLK, 0x00000001},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DE)
+        {"falkland-inseln", TERRITORY_FLK, 0x00000040},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FI)
+        {"falklandinsaaret", TERRITORY_FLK, 0x00000200},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ID)
+        {"falklands", TERRITORY_FLK, 0x00004000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"falklandski otoci", TERRITORY_FLK, 0x00002000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_SV)
+        {"falklandsoarna", TERRITORY_FLK, 0x00800000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DA)
+        {"falklandsøerne", TERRITORY_FLK, 0x00000020},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_NO)
+        {"falklandsøyene", TERRITORY_FLK, 0x00080000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CS) || defined(MAPCODE_SUPPORT_LANGUAGE_PL)
+        {"falklandy", TERRITORY_FLK, 0x00200010},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_SV)
+        {"faroarna", TERRITORY_FRO, 0x00800000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ID)
+        {"faroe", TERRITORY_FRO, 0x00004000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"faroe adaları", TERRITORY_FRO, 0x02000000},
+#endif
+        {"faroe islands", TERRITORY_FRO, 0x00000080},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DE)
+        {"faroer-inseln", TERRITORY_FRO, 0x00000040},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AF)
+        {"faroereilande", TERRITORY_FRO, 0x00000001},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FI)
+        {"farsaaret", TERRITORY_FRO, 0x00000200},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"farski otoci", TERRITORY_FRO, 0x00002000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"fas", TERRITORY_MAR, 0x02000000},
+        {"federal bolge", TERRITORY_MX_DIF, 0x02000000},
+#endif
+        {"federal district", TERRITORY_MX_DIF, 0x00ac02e0},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AF)
+        {"federale distrik", TERRITORY_MX_DIF, 0x00000001},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CS)
+        {"federalni okruh", TERRITORY_MX_DIF, 0x00000010},
+#endif
+        {"federated states of micronesia", TERRITORY_FSM, 0x000400a0},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CS)
+        {"federativni staty mikronesie", TERRITORY_FSM, 0x00000010},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AF)
+        {"fidji-eilande", TERRITORY_FJI, 0x00000001},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DE)
+        {"fidschi-inseln", TERRITORY_FJI, 0x00000040},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR) || defined(MAPCODE_SUPPORT_LANGUAGE_PL)
+        {"fidzi", TERRITORY_FJI, 0x00202000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CS)
+        {"fidzi ostrovy", TERRITORY_FJI, 0x00000010},
+#endif
+        {"fiji", TERRITORY_FJI, 0x02984280},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_SW)
+        {"fiji visiwa vya", TERRITORY_FJI, 0x01000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_NL)
+        {"fiji-eilanden", TERRITORY_FJI, 0x00040000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DA)
+        {"fijiøerne", TERRITORY_FJI, 0x00000020},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"fildisi sahili", TERRITORY_CIV, 0x02000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"filip otok", TERRITORY_NFK, 0x00002000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ES) || defined(MAPCODE_SUPPORT_LANGUAGE_PT)
+        {"filipinas", TERRITORY_PHL, 0x00100100},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"filipini", TERRITORY_PHL, 0x00002000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"filipinler", TERRITORY_PHL, 0x02000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CS) || defined(MAPCODE_SUPPORT_LANGUAGE_PL)
+        {"filipiny", TERRITORY_PHL, 0x00200010},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FI)
+        {"filippiinit", TERRITORY_PHL, 0x00000200},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_NL)
+        {"filippijnen", TERRITORY_PHL, 0x00040000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_IT)
+        {"filippine", TERRITORY_PHL, 0x00008000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_NO)
+        {"filippinene", TERRITORY_PHL, 0x00080000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_SV)
+        {"filippinerna", TERRITORY_PHL, 0x00800000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DA)
+        {"filippinerne", TERRITORY_PHL, 0x00000020},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AF)
+        {"filippyne", TERRITORY_PHL, 0x00000001},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"filistin bolgesi", TERRITORY_PSE, 0x02000000},
+#endif
+        {"fin", TERRITORY_FIN, 0x10000000},
+        {"finland", TERRITORY_FIN, 0x018c00a1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FR)
+        {"finlande", TERRITORY_FIN, 0x00000400},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ES) || defined(MAPCODE_SUPPORT_LANGUAGE_ID) || defined(MAPCODE_SUPPORT_LANGUAGE_IT) || defined(MAPCODE_SUPPORT_LANGUAGE_PT) || defined(MAPCODE_SUPPORT_LANGUAGE_PL)
+        {"finlandia", TERRITORY_FIN, 0x0030c100},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"finlandiya", TERRITORY_FIN, 0x02000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DE)
+        {"finnland", TERRITORY_FIN, 0x00000040},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"finska", TERRITORY_FIN, 0x00002000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CS)
+        {"finsko", TERRITORY_FIN, 0x00000010},
+#endif
+        {"fji", TERRITORY_FJI, 0x10000000},
+        {"flk", TERRITORY_FLK, 0x10000000},
+        {"florida", TERRITORY_US_FL, 0x0b9ce3f1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FR)
+        {"floride", TERRITORY_US_FL, 0x00000400},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PL)
+        {"floryda", TERRITORY_US_FL, 0x00200000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DE)
+        {"foderierte staaten von mikronesien", TERRITORY_FSM, 0x00000040},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_SV)
+        {"forenade arabemiraten", TERRITORY_ARE, 0x00800000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DA)
+        {"forenede arabiske emirater", TERRITORY_ARE, 0x00000020},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_SV)
+        {"forenta staternas avlagset belagna oar", TERRITORY_UMI, 0x00800000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_NO)
+        {"forente arabiske emirater", TERRITORY_ARE, 0x00080000},
+#endif
+        {"former yugoslav republic of macedonia", TERRITORY_MKD, 0x00000080},
+        {"fra", TERRITORY_FRA, 0x10000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PT)
+        {"franca", TERRITORY_FRA, 0x00100000},
+#endif
+        {"france", TERRITORY_FRA, 0x080004a0},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ES) || defined(MAPCODE_SUPPORT_LANGUAGE_IT)
+        {"francia", TERRITORY_FRA, 0x00008100},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CS)
+        {"francie", TERRITORY_FRA, 0x00000010},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PL)
+        {"francja", TERRITORY_FRA, 0x00200000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CS)
+        {"francouzska jizni a antarkticka uzemi", TERRITORY_ATF, 0x00000010},
+        {"francouzska polynesie", TERRITORY_PYF, 0x00000010},
+        {"francouzsky guyana", TERRITORY_GUF, 0x00000010},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"francuska", TERRITORY_FRA, 0x00002000},
+        {"francuska gvajana", TERRITORY_GUF, 0x00002000},
+        {"francuska polinezija", TERRITORY_PYF, 0x00002000},
+        {"francuski juzni i antarkticki teritoriji", TERRITORY_ATF, 0x00002000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PL)
+        {"francuskie terytoria południowe i antarktyczne", TERRITORY_ATF, 0x00200000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DE)
+        {"frankreich", TERRITORY_FRA, 0x00000040},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_NL)
+        {"frankrijk", TERRITORY_FRA, 0x00040000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_NO) || defined(MAPCODE_SUPPORT_LANGUAGE_SV)
+        {"frankrike", TERRITORY_FRA, 0x00880000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AF)
+        {"frankryk", TERRITORY_FRA, 0x00000001},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_NL)
+        {"frans-guyana", TERRITORY_GUF, 0x00040000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AF)
+        {"frans-polinesie", TERRITORY_PYF, 0x00000001},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_NL)
+        {"frans-polynesie", TERRITORY_PYF, 0x00040000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"fransa", TERRITORY_FRA, 0x02000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AF)
+        {"franse guiana", TERRITORY_GUF, 0x00000001},
+        {"franse suidelike en antarktiese gebiede", TERRITORY_ATF, 0x00000001},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_NL)
+        {"franse zuidelijke en antarctische gebieden", TERRITORY_ATF, 0x00040000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DA) || defined(MAPCODE_SUPPORT_LANGUAGE_NO)
+        {"fransk guyana", TERRITORY_GUF, 0x00080020},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_NO)
+        {"fransk polynesia", TERRITORY_PYF, 0x00080000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DA)
+        {"fransk polynesien", TERRITORY_PYF, 0x00000020},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_SV)
+        {"franska guyana", TERRITORY_GUF, 0x00800000},
+        {"franska polynesien", TERRITORY_PYF, 0x00800000},
+        {"franska sydliga och antarktiska lands", TERRITORY_ATF, 0x00800000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DA)
+        {"franske sydlige og antarktiske lands", TERRITORY_ATF, 0x00000020},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_NO)
+        {"franske sørterritorier", TERRITORY_ATF, 0x00080000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"fransız guney ve antarktik", TERRITORY_ATF, 0x02000000},
+        {"fransız guyanası", TERRITORY_GUF, 0x02000000},
+        {"fransız polinezyası", TERRITORY_PYF, 0x02000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DE)
+        {"franzosisch sud- und antarktisgebiete", TERRITORY_ATF, 0x00000040},
+        {"franzosisch-guayana", TERRITORY_GUF, 0x00000040},
+        {"franzosisch-polynesien", TERRITORY_PYF, 0x00000040},
+#endif
+        {"french guiana", TERRITORY_GUF, 0x00000080},
+        {"french polynesia", TERRITORY_PYF, 0x00000080},
+        {"french republic", TERRITORY_FRA, 0x00000080},
+        {"french southern and antarctic lands", TERRITORY_ATF, 0x00000080},
+        {"fro", TERRITORY_FRO, 0x10000000},
+        {"fsm", TERRITORY_FSM, 0x10000000},
+        {"fujian", TERRITORY_CN_FJ, 0x03bce7f1},
+        {"futuna", TERRITORY_WLF, 0x0394e7e1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_NO)
+        {"futunaøyene", TERRITORY_WLF, 0x00080000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CS)
+        {"futune", TERRITORY_WLF, 0x00000010},
+#endif
+        {"fyrom", TERRITORY_MKD, 0x00000080},
+        {"færøerne", TERRITORY_FRO, 0x08000020},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_NO)
+        {"færøyene", TERRITORY_FRO, 0x00080000},
+#endif
+        {"føroyar", TERRITORY_FRO, 0x08000000},
+        {"gab", TERRITORY_GAB, 0x10000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PT)
+        {"gabao", TERRITORY_GAB, 0x00100000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AF)
+        {"gaboen", TERRITORY_GAB, 0x00000001},
+#endif
+        {"gabon", TERRITORY_GAB, 0x0bace7b0},
+        {"gabonese republic", TERRITORY_GAB, 0x00000080},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DE)
+        {"gabun", TERRITORY_GAB, 0x00000040},
+#endif
+        {"gabuuti", TERRITORY_DJI, 0x08000000},
+        {"gambia", TERRITORY_GMB, 0x09bcc3e0},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AF) || defined(MAPCODE_SUPPORT_LANGUAGE_CS) || defined(MAPCODE_SUPPORT_LANGUAGE_FR)
+        {"gambie", TERRITORY_GMB, 0x00000411},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"gambija", TERRITORY_GMB, 0x00002000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"gambiya", TERRITORY_GMB, 0x02000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR) || defined(MAPCODE_SUPPORT_LANGUAGE_PT) || defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"gana", TERRITORY_GHA, 0x02102000},
+#endif
+        {"gannaar", TERRITORY_MRT, 0x08000000},
+        {"gansu", TERRITORY_CN_GS, 0x03bce5f1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FI)
+        {"gansun", TERRITORY_CN_GS, 0x00000200},
+#endif
+        {"gbr", TERRITORY_GBR, 0x10000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AF)
+        {"gefedereerde state van mikronesie", TERRITORY_FSM, 0x00000001},
+        {"gehoor island en mcdonald eilande", TERRITORY_HMD, 0x00000001},
+#endif
+        {"geo", TERRITORY_GEO, 0x10000000},
+        {"georgia", TERRITORY_GEO, 0x0118c3b1},
+        {"georgia", TERRITORY_US_GA, 0x091cc3f1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_IT)
+        {"georgia del sud e isole sandwich del sud", TERRITORY_SGS, 0x00008000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ES)
+        {"georgia del sur y las islas sandwich del sur", TERRITORY_SGS, 0x00000100},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PT)
+        {"georgia do sul e ilhas sandwich do sul", TERRITORY_SGS, 0x00100000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PL)
+        {"georgia południowa i sandwich południowy", TERRITORY_SGS, 0x00200000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ID)
+        {"georgia selatan dan kepulauan sandwich selatan", TERRITORY_SGS, 0x00004000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FR) || defined(MAPCODE_SUPPORT_LANGUAGE_NL)
+        {"georgie", TERRITORY_GEO, 0x00040400},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FR)
+        {"georgie", TERRITORY_US_GA, 0x00000400},
+        {"georgie du sud-et-les iles sandwich du sud", TERRITORY_SGS, 0x00000400},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DE) || defined(MAPCODE_SUPPORT_LANGUAGE_SV)
+        {"georgien", TERRITORY_GEO, 0x00800040},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_SV)
+        {"georgien", TERRITORY_US_GA, 0x00800000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_IT)
+        {"germania", TERRITORY_DEU, 0x00008000},
+#endif
+        {"germany", TERRITORY_DEU, 0x00000080},
+        {"ggy", TERRITORY_GGY, 0x10000000},
+        {"gha", TERRITORY_GHA, 0x10000000},
+        {"ghana", TERRITORY_GHA, 0x09acc7f1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_IT)
+        {"giamaica", TERRITORY_JAM, 0x00008000},
+        {"giappone", TERRITORY_JPN, 0x00008000},
+#endif
+        {"gib", TERRITORY_GIB, 0x10000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_IT)
+        {"gibilterra", TERRITORY_GIB, 0x00008000},
+#endif
+        {"gibraltar", TERRITORY_GIB, 0x09bc67f1},
+        {"gin", TERRITORY_GIN, 0x10000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"gine", TERRITORY_GIN, 0x02000000},
+        {"gine-bissau", TERRITORY_GNB, 0x02000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_IT)
+        {"giordania", TERRITORY_JOR, 0x00008000},
+#endif
+        {"glp", TERRITORY_GLP, 0x10000000},
+        {"gmb", TERRITORY_GMB, 0x10000000},
+        {"gnb", TERRITORY_GNB, 0x10000000},
+        {"gnq", TERRITORY_GNQ, 0x10000000},
+        {"goa", TERRITORY_IN_GA, 0x03bce7f1},
+        {"goias", TERRITORY_BR_GO, 0x0bbce7f1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PT)
+        {"gra-bretanha", TERRITORY_GBR, 0x00100000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_IT)
+        {"gran bretagna", TERRITORY_GBR, 0x00008000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ES)
+        {"gran bretana", TERRITORY_GBR, 0x00000100},
+        {"granada", TERRITORY_GRD, 0x00000100},
+        {"granadinas", TERRITORY_VCT, 0x00000100},
+#endif
+        {"grc", TERRITORY_GRC, 0x10000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"grcka", TERRITORY_GRC, 0x00002000},
+#endif
+        {"grd", TERRITORY_GRD, 0x10000000},
+        {"great britain", TERRITORY_GBR, 0x00000080},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FR)
+        {"grece", TERRITORY_GRC, 0x00000400},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ES) || defined(MAPCODE_SUPPORT_LANGUAGE_IT) || defined(MAPCODE_SUPPORT_LANGUAGE_PT)
+        {"grecia", TERRITORY_GRC, 0x00108100},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PL)
+        {"grecja", TERRITORY_GRC, 0x00200000},
+#endif
+        {"greece", TERRITORY_GRC, 0x00000080},
+        {"greenland", TERRITORY_GRL, 0x01000080},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_SV)
+        {"grekland", TERRITORY_GRC, 0x00800000},
+#endif
+        {"grenada", TERRITORY_GRD, 0x03bce2f1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FR)
+        {"grenade", TERRITORY_GRD, 0x00000400},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FI)
+        {"grenadiinit", TERRITORY_VCT, 0x00000200},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_IT)
+        {"grenadine", TERRITORY_VCT, 0x00008000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_NO)
+        {"grenadinene", TERRITORY_VCT, 0x00080000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_SV)
+        {"grenadinerna", TERRITORY_VCT, 0x00800000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DA)
+        {"grenadinerne", TERRITORY_VCT, 0x00000020},
+#endif
+        {"grenadines", TERRITORY_VCT, 0x011444c1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"grenadini", TERRITORY_VCT, 0x00002000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"grenadinler", TERRITORY_VCT, 0x02000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CS)
+        {"grenadiny", TERRITORY_VCT, 0x00000010},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"grenland", TERRITORY_GRL, 0x00002000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PL)
+        {"grenlandia", TERRITORY_GRL, 0x00200000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DE)
+        {"griechenland", TERRITORY_GRC, 0x00000040},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AF)
+        {"griekeland", TERRITORY_GRC, 0x00000001},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_NL)
+        {"griekenland", TERRITORY_GRC, 0x00040000},
+#endif
+        {"grl", TERRITORY_GRL, 0x10000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AF) || defined(MAPCODE_SUPPORT_LANGUAGE_FR) || defined(MAPCODE_SUPPORT_LANGUAGE_NL)
+        {"groenland", TERRITORY_GRL, 0x00040401},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_IT)
+        {"groenlandia", TERRITORY_GRL, 0x00008000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PT)
+        {"gronelandia", TERRITORY_GRL, 0x00100000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DE) || defined(MAPCODE_SUPPORT_LANGUAGE_SV) || defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"gronland", TERRITORY_GRL, 0x02800040},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FI)
+        {"gronlanti", TERRITORY_GRL, 0x00000200},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CS)
+        {"gronsko", TERRITORY_GRL, 0x00000010},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_NL)
+        {"groot brittannie", TERRITORY_GBR, 0x00040000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AF)
+        {"groot-brittanje", TERRITORY_GBR, 0x00000001},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"gruzija", TERRITORY_GEO, 0x00002000},
+        {"gruzija", TERRITORY_US_GA, 0x00002000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PL)
+        {"gruzja", TERRITORY_GEO, 0x00200000},
+        {"gruzja", TERRITORY_US_GA, 0x00200000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DA)
+        {"grækenland", TERRITORY_GRC, 0x00000020},
+#endif
+        {"grønland", TERRITORY_GRL, 0x08080020},
+        {"gtm", TERRITORY_GTM, 0x10000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ES) || defined(MAPCODE_SUPPORT_LANGUAGE_PT)
+        {"guadalupe", TERRITORY_GLP, 0x00100100},
+#endif
+        {"guadeloupe", TERRITORY_GLP, 0x0b8cc6f1},
+        {"guahan", TERRITORY_GUM, 0x08000000},
+        {"guam", TERRITORY_GUM, 0x0bbce7f1},
+        {"guanajuato", TERRITORY_MX_GUA, 0x0bbce7f1},
+        {"guangdong", TERRITORY_CN_GD, 0x03bce6f0},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"guangksi", TERRITORY_CN_GX, 0x02000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DA)
+        {"guangxi", TERRITORY_CN_GX, 0x00000020},
+#endif
+        {"guangxi zhuang", TERRITORY_CN_GX, 0x01bce3d1},
+        {"guatemala", TERRITORY_GTM, 0x0b9cc7f1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ES)
+        {"guayana", TERRITORY_GUY, 0x00000100},
+        {"guayana frances", TERRITORY_GUF, 0x00000100},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ES) || defined(MAPCODE_SUPPORT_LANGUAGE_FR)
+        {"guernesey", TERRITORY_GGY, 0x00000500},
+#endif
+        {"guernsey", TERRITORY_GGY, 0x0bbce2f1},
+        {"guerrero", TERRITORY_MX_GRO, 0x0bbce7f1},
+        {"guf", TERRITORY_GUF, 0x10000000},
+        {"guiana", TERRITORY_GUF, 0x08000080},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PT)
+        {"guiana", TERRITORY_GUY, 0x00100000},
+        {"guiana francesa", TERRITORY_GUF, 0x00100000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_IT)
+        {"guiana francese", TERRITORY_GUF, 0x00008000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PT)
+        {"guine", TERRITORY_GIN, 0x00100000},
+#endif
+        {"guine equatorial", TERRITORY_GNQ, 0x08100000},
+        {"guine-bissau", TERRITORY_GNB, 0x08100000},
+        {"guinea", TERRITORY_GIN, 0x0188c3f0},
+        {"guinea ecuatorial", TERRITORY_GNQ, 0x08000100},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ID)
+        {"guinea ekuator", TERRITORY_GNQ, 0x00004000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_IT)
+        {"guinea equatoriale", TERRITORY_GNQ, 0x00008000},
+#endif
+        {"guinea-bissau", TERRITORY_GNB, 0x0188c3f0},
+        {"guinea-conakry", TERRITORY_GIN, 0x00000080},
+        {"guinee", TERRITORY_GIN, 0x08040401},
+        {"guinee equatoriale", TERRITORY_GNQ, 0x08000400},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AF) || defined(MAPCODE_SUPPORT_LANGUAGE_FR) || defined(MAPCODE_SUPPORT_LANGUAGE_NL)
+        {"guinee-bissau", TERRITORY_GNB, 0x00040401},
+#endif
+        {"guizhou", TERRITORY_CN_GZ, 0x03bce5f1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FI)
+        {"guizhoun", TERRITORY_CN_GZ, 0x00000200},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PL)
+        {"gujana", TERRITORY_GUY, 0x00200000},
+        {"gujana francuska", TERRITORY_GUF, 0x00200000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AF)
+        {"gujarat", TERRITORY_IN_TR, 0x00000001},
+#endif
+        {"gujarat", TERRITORY_IN_GJ, 0x0bbce5f1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FI)
+        {"gujaratin", TERRITORY_IN_GJ, 0x00000200},
+#endif
+        {"gum", TERRITORY_GUM, 0x10000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"guney afrika", TERRITORY_ZAF, 0x02000000},
+        {"guney avustralya", TERRITORY_AU_SA, 0x02000000},
+        {"guney georgia ve guney sandwich adaları", TERRITORY_SGS, 0x02000000},
+        {"guney kore", TERRITORY_KOR, 0x02000000},
+        {"guney sandwich adaları", TERRITORY_SGS, 0x02000000},
+        {"guney sudan", TERRITORY_SSD, 0x02000000},
+        {"gurcistan", TERRITORY_GEO, 0x02000000},
+        {"gurcistan", TERRITORY_US_GA, 0x02000000},
+#endif
+        {"guy", TERRITORY_GUY, 0x10000000},
+        {"guyana", TERRITORY_GUY, 0x0b8cc6f1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ID)
+        {"guyana perancis", TERRITORY_GUF, 0x00004000},
+#endif
+        {"guyane", TERRITORY_GUF, 0x08000000},
+        {"guyane francaise", TERRITORY_GUF, 0x08000400},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"gvadalupe", TERRITORY_GLP, 0x00002000},
+        {"gvajana", TERRITORY_GUY, 0x00002000},
+        {"gvatemala", TERRITORY_GTM, 0x00002000},
+        {"gvineja", TERRITORY_GIN, 0x00002000},
+        {"gvineja bisao", TERRITORY_GNB, 0x00002000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PL)
+        {"gwadelupa", TERRITORY_GLP, 0x00200000},
+#endif
+        {"gwadloup", TERRITORY_GLP, 0x08000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PL)
+        {"gwatemala", TERRITORY_GTM, 0x00200000},
+        {"gwinea", TERRITORY_GIN, 0x00200000},
+        {"gwinea bissau", TERRITORY_GNB, 0x00200000},
+        {"gwinea rownikowa", TERRITORY_GNQ, 0x00200000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FI)
+        {"habarovskin aluepiiri", TERRITORY_RU_KHA, 0x00000200},
+#endif
+        {"hainan", TERRITORY_CN_HI, 0x03bce7f1},
+        {"haiti", TERRITORY_HTI, 0x0bbce7f1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FI)
+        {"hakassian tasavalta", TERRITORY_RU_KK, 0x00000200},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"hakasya cumhuriyeti", TERRITORY_RU_KK, 0x02000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FI) || defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"hanti-mansi", TERRITORY_RU_KM, 0x02000200},
+#endif
+        {"haryana", TERRITORY_IN_HR, 0x0bbce7f0},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PT)
+        {"havai", TERRITORY_US_HI, 0x00100000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FI)
+        {"havaiji", TERRITORY_US_HI, 0x00000200},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CS)
+        {"havaj", TERRITORY_US_HI, 0x00000010},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"havaji", TERRITORY_US_HI, 0x00002000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ES) || defined(MAPCODE_SUPPORT_LANGUAGE_FR) || defined(MAPCODE_SUPPORT_LANGUAGE_NL)
+        {"hawai", TERRITORY_US_HI, 0x00040500},
+#endif
+        {"hawaii", TERRITORY_US_HI, 0x0b88c0e1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PL)
+        {"hawaje", TERRITORY_US_HI, 0x00200000},
+#endif
+        {"hayastan", TERRITORY_ARM, 0x08000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_NL)
+        {"heard eiland en mcdonald eilanden", TERRITORY_HMD, 0x00040000},
+#endif
+        {"heard island", TERRITORY_HMD, 0x08000080},
+        {"heard island and mcdonald islands", TERRITORY_HMD, 0x00000080},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FI)
+        {"heard ja mcdonald islands", TERRITORY_HMD, 0x00000200},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DA)
+        {"heard og mcdonald-øerne", TERRITORY_HMD, 0x00000020},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PL)
+        {"heard, wyspy", TERRITORY_HMD, 0x00200000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_SV)
+        {"heard- och mcdonaldoarna", TERRITORY_HMD, 0x00800000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_NO)
+        {"heard- og mcdonaldøyene", TERRITORY_HMD, 0x00080000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DE)
+        {"heard- und mcdonald-inseln", TERRITORY_HMD, 0x00000040},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CS)
+        {"hearduv ostrov a mcdonaldovy ostrovy", TERRITORY_HMD, 0x00000010},
+#endif
+        {"hebei", TERRITORY_CN_HE, 0x03bce7f1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AF) || defined(MAPCODE_SUPPORT_LANGUAGE_NL)
+        {"heilige stoel", TERRITORY_VAT, 0x00040001},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DE)
+        {"heiliger stuhl", TERRITORY_VAT, 0x00000040},
+#endif
+        {"heilongjiang", TERRITORY_CN_HL, 0x03bce5f0},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FI)
+        {"heilongjiangin", TERRITORY_CN_HL, 0x00000200},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AF)
+        {"heilunkiang", TERRITORY_CN_HL, 0x00000001},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_SV)
+        {"heliga stolen", TERRITORY_VAT, 0x00800000},
+#endif
+        {"hellas", TERRITORY_GRC, 0x08080080},
+        {"hellenic republic", TERRITORY_GRC, 0x00000080},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AF) || defined(MAPCODE_SUPPORT_LANGUAGE_NL)
+        {"hemelvaart", TERRITORY_SHN, 0x00040001},
+#endif
+        {"henan", TERRITORY_CN_HA, 0x03bce7f1},
+        {"hidalgo", TERRITORY_MX_HID, 0x0bbce7f1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CS)
+        {"himacalprades", TERRITORY_IN_HP, 0x00000010},
+#endif
+        {"himachal pradesh", TERRITORY_IN_HP, 0x0bbce7e1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"hindistan", TERRITORY_IND, 0x02000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_SW)
+        {"hispania", TERRITORY_ESP, 0x01000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PL)
+        {"hiszpania", TERRITORY_ESP, 0x00200000},
+#endif
+        {"hkg", TERRITORY_HKG, 0x10000000},
+        {"hmd", TERRITORY_HMD, 0x10000000},
+        {"hnd", TERRITORY_HND, 0x10000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PT)
+        {"holanda", TERRITORY_NLD, 0x00100000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PL)
+        {"holandia", TERRITORY_NLD, 0x00200000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"holandija", TERRITORY_NLD, 0x00002000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DA)
+        {"holland", TERRITORY_NLD, 0x00000020},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"hollanda", TERRITORY_NLD, 0x02000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FI)
+        {"hollanti", TERRITORY_NLD, 0x00000200},
+#endif
+        {"holy see", TERRITORY_VAT, 0x0a004080},
+        {"honduras", TERRITORY_HND, 0x0bbce7f1},
+        {"hong kong", TERRITORY_HKG, 0x0b94a5e1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ID)
+        {"hongaria", TERRITORY_HUN, 0x00004000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_NL)
+        {"hongarije", TERRITORY_HUN, 0x00040000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AF)
+        {"hongarye", TERRITORY_HUN, 0x00000001},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CS) || defined(MAPCODE_SUPPORT_LANGUAGE_FI) || defined(MAPCODE_SUPPORT_LANGUAGE_ID) || defined(MAPCODE_SUPPORT_LANGUAGE_NO) || defined(MAPCODE_SUPPORT_LANGUAGE_PL)
+        {"hongkong", TERRITORY_HKG, 0x00284210},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FR)
+        {"hongrie", TERRITORY_HUN, 0x00000400},
+#endif
+        {"hrv", TERRITORY_HRV, 0x10000000},
+        {"hrvatska", TERRITORY_HRV, 0x08002000},
+        {"hti", TERRITORY_HTI, 0x10000000},
+        {"hubei", TERRITORY_CN_HB, 0x03bce5f1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FI)
+        {"hubein", TERRITORY_CN_HB, 0x00000200},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FR)
+        {"hui du ningxia", TERRITORY_CN_NX, 0x00000400},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FI)
+        {"huippuvuoret ja jan mayen", TERRITORY_SJM, 0x00000200},
+#endif
+        {"hun", TERRITORY_HUN, 0x10000000},
+        {"hunan", TERRITORY_CN_HN, 0x03bce7f1},
+        {"hungary", TERRITORY_HUN, 0x01000080},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ES) || defined(MAPCODE_SUPPORT_LANGUAGE_PT)
+        {"hungria", TERRITORY_HUN, 0x00100100},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_NO)
+        {"hviterussland", TERRITORY_BLR, 0x00080000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"hırvatistan", TERRITORY_HRV, 0x02000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FR)
+        {"iamalo-nenetsie", TERRITORY_RU_YAN, 0x00000400},
+#endif
+        {"iceland", TERRITORY_ISL, 0x01000080},
+        {"ichkeria", TERRITORY_RU_CE, 0x00000080},
+        {"idaho", TERRITORY_US_ID, 0x0bbcc7f1},
+        {"idn", TERRITORY_IDN, 0x10000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PT)
+        {"iemen", TERRITORY_YEM, 0x00100000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AF) || defined(MAPCODE_SUPPORT_LANGUAGE_NL)
+        {"ierland", TERRITORY_IRL, 0x00040001},
+        {"ierland, noord", TERRITORY_GBR, 0x00040001},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_NL)
+        {"ijsland", TERRITORY_ISL, 0x00040000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_IT)
+        {"il mondo", TERRITORY_AAA, 0x00008000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FR)
+        {"ile bouvet", TERRITORY_BVT, 0x00000400},
+        {"ile christmas", TERRITORY_CXR, 0x00000400},
+#endif
+        {"ile de clipperton", TERRITORY_CPT, 0x08000400},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FR)
+        {"ile de man", TERRITORY_IMN, 0x00000400},
+        {"ile heard-et-macdonald", TERRITORY_HMD, 0x00000400},
+        {"ile maurice", TERRITORY_MUS, 0x00000400},
+#endif
+        {"ile-du-prince-edouard", TERRITORY_CA_PE, 0x08000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FR)
+        {"ile-du-prince-edward", TERRITORY_CA_PE, 0x00000400},
+        {"iles caimans", TERRITORY_CYM, 0x00000400},
+        {"iles cocos", TERRITORY_CCK, 0x00000400},
+        {"iles cook", TERRITORY_COK, 0x00000400},
+        {"iles falkland", TERRITORY_FLK, 0x00000400},
+        {"iles feroe", TERRITORY_FRO, 0x00000400},
+        {"iles fidji", TERRITORY_FJI, 0x00000400},
+        {"iles keeling", TERRITORY_CCK, 0x00000400},
+        {"iles macdonald", TERRITORY_HMD, 0x00000400},
+        {"iles mariannes du nord", TERRITORY_MNP, 0x00000400},
+        {"iles marshall", TERRITORY_MHL, 0x00000400},
+        {"iles mineures eloignees des etats-unis", TERRITORY_UMI, 0x00000400},
+        {"iles pitcairn", TERRITORY_PCN, 0x00000400},
+        {"iles salomon", TERRITORY_SLB, 0x00000400},
+        {"iles sandwich du sud", TERRITORY_SGS, 0x00000400},
+        {"iles turques-et-caiques", TERRITORY_TCA, 0x00000400},
+        {"iles vierges americaines", TERRITORY_VIR, 0x00000400},
+        {"iles vierges britanniques", TERRITORY_VGB, 0x00000400},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PT)
+        {"ilha de bouvet", TERRITORY_BVT, 0x00100000},
+        {"ilha de clipperton", TERRITORY_CPT, 0x00100000},
+        {"ilha de man", TERRITORY_IMN, 0x00100000},
+        {"ilha de philip", TERRITORY_NFK, 0x00100000},
+        {"ilha do natal", TERRITORY_CXR, 0x00100000},
+        {"ilha principe edward", TERRITORY_CA_PE, 0x00100000},
+        {"ilhas aaland", TERRITORY_ALA, 0x00100000},
+        {"ilhas caicos", TERRITORY_TCA, 0x00100000},
+        {"ilhas cayman", TERRITORY_CYM, 0x00100000},
+        {"ilhas cocos", TERRITORY_CCK, 0x00100000},
+        {"ilhas cook", TERRITORY_COK, 0x00100000},
+        {"ilhas falkland", TERRITORY_FLK, 0x00100000},
+        {"ilhas faroe", TERRITORY_FRO, 0x00100000},
+        {"ilhas fiji", TERRITORY_FJI, 0x00100000},
+        {"ilhas heard e ilhas mcdonald", TERRITORY_HMD, 0x00100000},
+        {"ilhas keeling", TERRITORY_CCK, 0x00100000},
+        {"ilhas marshall", TERRITORY_MHL, 0x00100000},
+        {"ilhas mcdonald", TERRITORY_HMD, 0x00100000},
+        {"ilhas menores distantes dos estados unidos", TERRITORY_UMI, 0x00100000},
+        {"ilhas norfolk e philip", TERRITORY_NFK, 0x00100000},
+        {"ilhas pitcairn", TERRITORY_PCN, 0x00100000},
+        {"ilhas salomao", TERRITORY_SLB, 0x00100000},
+        {"ilhas sandwich do sul", TERRITORY_SGS, 0x00100000},
+        {"ilhas turcas e caicos", TERRITORY_TCA, 0x00100000},
+        {"ilhas virgens americanas", TERRITORY_VIR, 0x00100000},
+        {"ilhas virgens britanicas", TERRITORY_VGB, 0x00100000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"ilinois", TERRITORY_US_IL, 0x00002000},
+#endif
+        {"illinois", TERRITORY_US_IL, 0x0bbcc7f1},
+        {"imn", TERRITORY_IMN, 0x10000000},
+        {"in-an", TERRITORY_IN_AN, 0x10000000},
+        {"in-ap", TERRITORY_IN_AP, 0x10000000},
+        {"in-ar", TERRITORY_IN_AR, 0x10000000},
+        {"in-as", TERRITORY_IN_AS, 0x10000000},
+        {"in-br", TERRITORY_IN_BR, 0x10000000},
+        {"in-ch", TERRITORY_IN_CH, 0x10000000},
+        {"in-ct", TERRITORY_IN_CT, 0x10000000},
+        {"in-dd", TERRITORY_IN_DD, 0x10000000},
+        {"in-dl", TERRITORY_IN_DL, 0x10000000},
+        {"in-dn", TERRITORY_IN_DN, 0x10000000},
+        {"in-ga", TERRITORY_IN_GA, 0x10000000},
+        {"in-gj", TERRITORY_IN_GJ, 0x10000000},
+        {"in-hp", TERRITORY_IN_HP, 0x10000000},
+        {"in-hr", TERRITORY_IN_HR, 0x10000000},
+        {"in-jh", TERRITORY_IN_JH, 0x10000000},
+        {"in-jk", TERRITORY_IN_JK, 0x10000000},
+        {"in-ka", TERRITORY_IN_KA, 0x10000000},
+        {"in-kl", TERRITORY_IN_KL, 0x10000000},
+        {"in-ld", TERRITORY_IN_LD, 0x10000000},
+        {"in-mh", TERRITORY_IN_MH, 0x10000000},
+        {"in-ml", TERRITORY_IN_ML, 0x10000000},
+        {"in-mn", TERRITORY_IN_MN, 0x10000000},
+        {"in-mp", TERRITORY_IN_MP, 0x10000000},
+        {"in-mz", TERRITORY_IN_MZ, 0x10000000},
+        {"in-nl", TERRITORY_IN_NL, 0x10000000},
+        {"in-or", TERRITORY_IN_OR, 0x10000000},
+        {"in-pb", TERRITORY_IN_PB, 0x10000000},
+        {"in-py", TERRITORY_IN_PY, 0x10000000},
+        {"in-rj", TERRITORY_IN_RJ, 0x10000000},
+        {"in-sk", TERRITORY_IN_SK, 0x10000000},
+        {"in-tg", TERRITORY_IN_TG, 0x10000000},
+        {"in-tn", TERRITORY_IN_TN, 0x10000000},
+        {"in-tr", TERRITORY_IN_TR, 0x10000000},
+        {"in-up", TERRITORY_IN_UP, 0x10000000},
+        {"in-ut", TERRITORY_IN_UT, 0x10000000},
+        {"in-wb", TERRITORY_IN_WB, 0x10000000},
+        {"ind", TERRITORY_IND, 0x10000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FR)
+        {"inde", TERRITORY_IND, 0x00000400},
+#endif
+        {"india", TERRITORY_IND, 0x091cc180},
+        {"indiana", TERRITORY_US_IN, 0x0bbcc7f1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AF) || defined(MAPCODE_SUPPORT_LANGUAGE_CS) || defined(MAPCODE_SUPPORT_LANGUAGE_PL)
+        {"indie", TERRITORY_IND, 0x00200011},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DA) || defined(MAPCODE_SUPPORT_LANGUAGE_DE) || defined(MAPCODE_SUPPORT_LANGUAGE_SV)
+        {"indien", TERRITORY_IND, 0x00800060},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"indija", TERRITORY_IND, 0x00002000},
+        {"indijana", TERRITORY_US_IN, 0x00002000},
+#endif
+        {"indonesia", TERRITORY_IDN, 0x0918c380},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AF) || defined(MAPCODE_SUPPORT_LANGUAGE_CS) || defined(MAPCODE_SUPPORT_LANGUAGE_FR) || defined(MAPCODE_SUPPORT_LANGUAGE_NL)
+        {"indonesie", TERRITORY_IDN, 0x00040411},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DA) || defined(MAPCODE_SUPPORT_LANGUAGE_DE) || defined(MAPCODE_SUPPORT_LANGUAGE_SV)
+        {"indonesien", TERRITORY_IDN, 0x00800060},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"indonezija", TERRITORY_IDN, 0x00002000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PL)
+        {"indonezja", TERRITORY_IDN, 0x00200000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_NO)
+        {"indre mongolia", TERRITORY_CN_NM, 0x00080000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ID)
+        {"inggris", TERRITORY_GBR, 0x00004000},
+        {"inggris raya", TERRITORY_GBR, 0x00004000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"ingiliz hint okyanusu toprakları", TERRITORY_IOT, 0x02000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AF) || defined(MAPCODE_SUPPORT_LANGUAGE_NL)
+        {"ingoesjetie republiek", TERRITORY_RU_IN, 0x00040001},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FR)
+        {"ingouchie", TERRITORY_RU_IN, 0x00000400},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DE)
+        {"inguschetien republik", TERRITORY_RU_IN, 0x00000040},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"ingusetije republika", TERRITORY_RU_IN, 0x00002000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"ingusetya cumhuriyeti", TERRITORY_RU_IN, 0x02000000},
+#endif
+        {"ingushetia", TERRITORY_RU_IN, 0x00000080},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PT) || defined(MAPCODE_SUPPORT_LANGUAGE_SW)
+        {"ingushetia republic", TERRITORY_RU_IN, 0x01100000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ID)
+        {"ingushetia republik", TERRITORY_RU_IN, 0x00004000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_SV)
+        {"ingushetia republiken", TERRITORY_RU_IN, 0x00800000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FI)
+        {"ingusian tasavalta", TERRITORY_RU_IN, 0x00000200},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_NO)
+        {"ingusjetia republikk", TERRITORY_RU_IN, 0x00080000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DA)
+        {"ingusjetien republik", TERRITORY_RU_IN, 0x00000020},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CS)
+        {"ingussko republic", TERRITORY_RU_IN, 0x00000010},
+#endif
+        {"inner mongolia", TERRITORY_CN_NM, 0x030422e1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_SV)
+        {"inre mongoliet", TERRITORY_CN_NM, 0x00800000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ES) || defined(MAPCODE_SUPPORT_LANGUAGE_PT)
+        {"internacional", TERRITORY_AAA, 0x00100100},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ID)
+        {"internasional", TERRITORY_AAA, 0x00004000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_NO)
+        {"internasjonal", TERRITORY_AAA, 0x00080000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_NL)
+        {"internationaal", TERRITORY_AAA, 0x00040000},
+#endif
+        {"international", TERRITORY_AAA, 0x012024e1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_SV)
+        {"internationell", TERRITORY_AAA, 0x00800000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_IT)
+        {"internazionale", TERRITORY_AAA, 0x00008000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FI)
+        {"intia", TERRITORY_IND, 0x00000200},
+#endif
+        {"iot", TERRITORY_IOT, 0x10000000},
+        {"iowa", TERRITORY_US_IA, 0x0bbce7f1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PT)
+        {"ira", TERRITORY_IRN, 0x00100000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AF) || defined(MAPCODE_SUPPORT_LANGUAGE_CS) || defined(MAPCODE_SUPPORT_LANGUAGE_DE) || defined(MAPCODE_SUPPORT_LANGUAGE_ES) || defined(MAPCODE_SUPPORT_LANGUAGE_FI) || defined(MAPCODE_SUPPORT_LANGUAGE_FR) || defined(MAPCODE_SUPPORT_LANGUAGE_HR) || defined(MAPCODE_SUPPORT_LANGUAGE_ID) || defined(MAPCODE_SUPPORT_LANGUAGE_NL) || defined(MAPCODE_SUPPORT_LANGUAGE_NO) || defined(MAPCODE_SUPPORT_LANGUAGE_PL) || defined(MAPCODE_SUPPORT_LANGUAGE_SV) || defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"irak", TERRITORY_IRQ, 0x02ac6751},
+#endif
+        {"iran", TERRITORY_IRN, 0x0bace7f1},
+        {"iraq", TERRITORY_IRQ, 0x090080a0},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PT)
+        {"iraque", TERRITORY_IRQ, 0x00100000},
+#endif
+        {"ireland", TERRITORY_IRL, 0x01000080},
+        {"ireland, northern", TERRITORY_GBR, 0x01000090},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_NL)
+        {"irkoetsk oblast", TERRITORY_RU_IRK, 0x00040000},
+#endif
+        {"irkutsk oblast", TERRITORY_RU_IRK, 0x038860f1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FI)
+        {"irkutskin alue", TERRITORY_RU_IRK, 0x00000200},
+#endif
+        {"irl", TERRITORY_IRL, 0x10000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DA) || defined(MAPCODE_SUPPORT_LANGUAGE_DE) || defined(MAPCODE_SUPPORT_LANGUAGE_NO) || defined(MAPCODE_SUPPORT_LANGUAGE_SV)
+        {"irland", TERRITORY_IRL, 0x00880060},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_NO)
+        {"irland, nord", TERRITORY_GBR, 0x00080000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_SV)
+        {"irland, northern", TERRITORY_GBR, 0x00800000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ES) || defined(MAPCODE_SUPPORT_LANGUAGE_IT) || defined(MAPCODE_SUPPORT_LANGUAGE_PT) || defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"irlanda", TERRITORY_IRL, 0x02108100},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_IT)
+        {"irlanda del nord", TERRITORY_GBR, 0x00008000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ES)
+        {"irlanda del norte", TERRITORY_GBR, 0x00000100},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PT)
+        {"irlanda do norte", TERRITORY_GBR, 0x00100000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_IT)
+        {"irlanda, del nord", TERRITORY_GBR, 0x00008000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"irlanda, kuzey", TERRITORY_GBR, 0x02000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ES)
+        {"irlanda, norte", TERRITORY_GBR, 0x00000100},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FR)
+        {"irlande", TERRITORY_IRL, 0x00000400},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ID) || defined(MAPCODE_SUPPORT_LANGUAGE_PL)
+        {"irlandia", TERRITORY_IRL, 0x00204000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ID)
+        {"irlandia utara", TERRITORY_GBR, 0x00004000},
+        {"irlandia, northern", TERRITORY_GBR, 0x00004000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FI)
+        {"irlanti", TERRITORY_IRL, 0x00000200},
+        {"irlanti, pohjois", TERRITORY_GBR, 0x00000200},
+#endif
+        {"irn", TERRITORY_IRN, 0x10000000},
+        {"irq", TERRITORY_IRQ, 0x10000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"irska", TERRITORY_IRL, 0x00002000},
+        {"irska, sjeverna", TERRITORY_GBR, 0x00002000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CS)
+        {"irsko", TERRITORY_IRL, 0x00000010},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"iskocya", TERRITORY_GBR, 0x02000000},
+#endif
+        {"isl", TERRITORY_ISL, 0x10000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ES)
+        {"isla bouvet", TERRITORY_BVT, 0x00000100},
+        {"isla clipperton", TERRITORY_CPT, 0x00000100},
+#endif
+        {"isla de la pasion", TERRITORY_CPT, 0x08000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ES)
+        {"isla de man", TERRITORY_IMN, 0x00000100},
+        {"isla de navidad", TERRITORY_CXR, 0x00000100},
+        {"isla de norfolk", TERRITORY_NFK, 0x00000100},
+        {"isla de phillip", TERRITORY_NFK, 0x00000100},
+        {"isla del principe eduardo", TERRITORY_CA_PE, 0x00000100},
+#endif
+        {"island", TERRITORY_ISL, 0x08882070},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_IT)
+        {"islanda", TERRITORY_ISL, 0x00008000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FR)
+        {"islande", TERRITORY_ISL, 0x00000400},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ES) || defined(MAPCODE_SUPPORT_LANGUAGE_ID) || defined(MAPCODE_SUPPORT_LANGUAGE_PT) || defined(MAPCODE_SUPPORT_LANGUAGE_PL)
+        {"islandia", TERRITORY_ISL, 0x00304100},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FI)
+        {"islanti", TERRITORY_ISL, 0x00000200},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ES)
+        {"islas aland", TERRITORY_ALA, 0x00000100},
+        {"islas bermudas", TERRITORY_BMU, 0x00000100},
+        {"islas caicos", TERRITORY_TCA, 0x00000100},
+        {"islas caiman", TERRITORY_CYM, 0x00000100},
+        {"islas cocos", TERRITORY_CCK, 0x00000100},
+        {"islas cook", TERRITORY_COK, 0x00000100},
+        {"islas faroe", TERRITORY_FRO, 0x00000100},
+        {"islas fiji", TERRITORY_FJI, 0x00000100},
+        {"islas heard y mcdonald", TERRITORY_HMD, 0x00000100},
+        {"islas keeling", TERRITORY_CCK, 0x00000100},
+#endif
+        {"islas malvinas", TERRITORY_FLK, 0x08000100},
+        {"islas marianas", TERRITORY_MNP, 0x08000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ES)
+        {"islas marianas del norte", TERRITORY_MNP, 0x00000100},
+        {"islas marshall", TERRITORY_MHL, 0x00000100},
+        {"islas mcdonald", TERRITORY_HMD, 0x00000100},
+        {"islas menores alejadas de los estados unidos", TERRITORY_UMI, 0x00000100},
+        {"islas pitcairn", TERRITORY_PCN, 0x00000100},
+        {"islas salomon", TERRITORY_SLB, 0x00000100},
+        {"islas sandwich del sur", TERRITORY_SGS, 0x00000100},
+        {"islas turcas y caicos", TERRITORY_TCA, 0x00000100},
+        {"islas virgenes britanicas", TERRITORY_VGB, 0x00000100},
+        {"islas virgenes de ee.uu", TERRITORY_VIR, 0x00000100},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CS) || defined(MAPCODE_SUPPORT_LANGUAGE_DA) || defined(MAPCODE_SUPPORT_LANGUAGE_DE) || defined(MAPCODE_SUPPORT_LANGUAGE_NL) || defined(MAPCODE_SUPPORT_LANGUAGE_NO)
+        {"isle of man", TERRITORY_IMN, 0x000c0070},
+#endif
+        {"isle of mann", TERRITORY_IMN, 0x00000080},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FI)
+        {"iso-britannia", TERRITORY_GBR, 0x00000200},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_IT)
+        {"isola bouvet", TERRITORY_BVT, 0x00008000},
+        {"isola clipperton", TERRITORY_CPT, 0x00008000},
+        {"isola del principe edoardo", TERRITORY_CA_PE, 0x00008000},
+        {"isola di man", TERRITORY_IMN, 0x00008000},
+        {"isola di natale", TERRITORY_CXR, 0x00008000},
+        {"isole aland", TERRITORY_ALA, 0x00008000},
+        {"isole cayman", TERRITORY_CYM, 0x00008000},
+        {"isole cocos", TERRITORY_CCK, 0x00008000},
+        {"isole cook", TERRITORY_COK, 0x00008000},
+        {"isole falkland", TERRITORY_FLK, 0x00008000},
+        {"isole faroe", TERRITORY_FRO, 0x00008000},
+        {"isole figi", TERRITORY_FJI, 0x00008000},
+        {"isole heard e mcdonald", TERRITORY_HMD, 0x00008000},
+        {"isole keeling", TERRITORY_CCK, 0x00008000},
+        {"isole marianne settentrionali", TERRITORY_MNP, 0x00008000},
+        {"isole marshall", TERRITORY_MHL, 0x00008000},
+        {"isole mcdonald", TERRITORY_HMD, 0x00008000},
+        {"isole minori esterne degli stati uniti d`america", TERRITORY_UMI, 0x00008000},
+        {"isole pitcairn", TERRITORY_PCN, 0x00008000},
+        {"isole salomone", TERRITORY_SLB, 0x00008000},
+        {"isole sandwich meridionali", TERRITORY_SGS, 0x00008000},
+        {"isole vergini britanniche", TERRITORY_VGB, 0x00008000},
+        {"isole vergini, usa", TERRITORY_VIR, 0x00008000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"ispanya", TERRITORY_ESP, 0x02000000},
+#endif
+        {"isr", TERRITORY_ISR, 0x10000000},
+        {"israel", TERRITORY_ISR, 0x099c47e1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_IT)
+        {"israele", TERRITORY_ISR, 0x00008000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"israil", TERRITORY_ISR, 0x02000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"istocni timor", TERRITORY_TLS, 0x00002000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"isvec", TERRITORY_SWE, 0x02000000},
+        {"isvicre", TERRITORY_CHE, 0x02000000},
+#endif
+        {"ita", TERRITORY_ITA, 0x10000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FI)
+        {"ita-timor", TERRITORY_TLS, 0x00000200},
+#endif
+        {"italia", TERRITORY_ITA, 0x0918c300},
+        {"italian republic", TERRITORY_ITA, 0x00000080},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AF) || defined(MAPCODE_SUPPORT_LANGUAGE_CS) || defined(MAPCODE_SUPPORT_LANGUAGE_FR) || defined(MAPCODE_SUPPORT_LANGUAGE_NL)
+        {"italie", TERRITORY_ITA, 0x00040411},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DA) || defined(MAPCODE_SUPPORT_LANGUAGE_DE) || defined(MAPCODE_SUPPORT_LANGUAGE_SV)
+        {"italien", TERRITORY_ITA, 0x00800060},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"italija", TERRITORY_ITA, 0x00002000},
+#endif
+        {"italy", TERRITORY_ITA, 0x00000080},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"italya", TERRITORY_ITA, 0x02000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FI)
+        {"itavalta", TERRITORY_AUT, 0x00000200},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PT)
+        {"iucata", TERRITORY_MX_YUC, 0x00100000},
+#endif
+        {"ivanovo oblast", TERRITORY_RU_IVA, 0x039cc0f1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FI)
+        {"ivanovon alue", TERRITORY_RU_IVA, 0x00000200},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"ivanovska oblast", TERRITORY_RU_IVA, 0x00002000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AF)
+        {"ivoorkus", TERRITORY_CIV, 0x00000001},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_NL)
+        {"ivoorkust", TERRITORY_CIV, 0x00040000},
+#endif
+        {"ivory coast", TERRITORY_CIV, 0x01000080},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PL)
+        {"iwanowo oblast", TERRITORY_RU_IVA, 0x00200000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"izlanda", TERRITORY_ISL, 0x02000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CS) || defined(MAPCODE_SUPPORT_LANGUAGE_HR) || defined(MAPCODE_SUPPORT_LANGUAGE_PL)
+        {"izrael", TERRITORY_ISR, 0x00202010},
+#endif
+        {"jabuuti", TERRITORY_DJI, 0x08000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PL)
+        {"jakucja republika", TERRITORY_RU_SA, 0x00200000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"jakutska", TERRITORY_RU_SA, 0x00002000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CS)
+        {"jakutsko republika", TERRITORY_RU_SA, 0x00000010},
+#endif
+        {"jalisco", TERRITORY_MX_JAL, 0x0bbce7f1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FI)
+        {"jalleennakeminen", TERRITORY_REU, 0x00000200},
+#endif
+        {"jam", TERRITORY_JAM, 0x10000000},
+        {"jamaica", TERRITORY_JAM, 0x099c01b1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DE) || defined(MAPCODE_SUPPORT_LANGUAGE_FI) || defined(MAPCODE_SUPPORT_LANGUAGE_ID) || defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"jamaika", TERRITORY_JAM, 0x02004240},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FR)
+        {"jamaique", TERRITORY_JAM, 0x00000400},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR) || defined(MAPCODE_SUPPORT_LANGUAGE_PL)
+        {"jamajka", TERRITORY_JAM, 0x00202000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DE)
+        {"jamal-nenzen", TERRITORY_RU_YAN, 0x00000040},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FI)
+        {"jamalin nenetsian", TERRITORY_RU_YAN, 0x00000200},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CS)
+        {"jamalskon nenets", TERRITORY_RU_YAN, 0x00000010},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_SW)
+        {"jamhuri ya afrika ya kati", TERRITORY_CAF, 0x01000000},
+        {"jamhuri ya czech", TERRITORY_CZE, 0x01000000},
+        {"jamhuri ya dominika", TERRITORY_DOM, 0x01000000},
+#endif
+        {"jammu", TERRITORY_IN_JK, 0x00000080},
+        {"jammu and kashmir", TERRITORY_IN_JK, 0x00000080},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ID)
+        {"jammu dan kashmir", TERRITORY_IN_JK, 0x00004000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PT)
+        {"jammu e caxemira", TERRITORY_IN_JK, 0x00100000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_IT)
+        {"jammu e kashmir", TERRITORY_IN_JK, 0x00008000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AF) || defined(MAPCODE_SUPPORT_LANGUAGE_NL)
+        {"jammu en kasjmir", TERRITORY_IN_JK, 0x00040001},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"jammu i kasmir", TERRITORY_IN_JK, 0x00002000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_SW)
+        {"jammu na kashmir", TERRITORY_IN_JK, 0x01000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_SV)
+        {"jammu och kashmir", TERRITORY_IN_JK, 0x00800000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DA) || defined(MAPCODE_SUPPORT_LANGUAGE_NO)
+        {"jammu og kashmir", TERRITORY_IN_JK, 0x00080020},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DE)
+        {"jammu und kaschmir", TERRITORY_IN_JK, 0x00000040},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"jammu ve kesmir", TERRITORY_IN_JK, 0x02000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ES)
+        {"jammu y cachemira", TERRITORY_IN_JK, 0x00000100},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FR)
+        {"jammu-et-cachemire", TERRITORY_IN_JK, 0x00000400},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FI)
+        {"jammun ja kashmirin", TERRITORY_IN_JK, 0x00000200},
+#endif
+        {"jan mayen", TERRITORY_SJM, 0x039ce7f1},
+        {"japan", TERRITORY_JPN, 0x018c20e1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FI)
+        {"japani", TERRITORY_JPN, 0x00000200},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PT)
+        {"japao", TERRITORY_JPN, 0x00100000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ES) || defined(MAPCODE_SUPPORT_LANGUAGE_FR)
+        {"japon", TERRITORY_JPN, 0x00000500},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PL)
+        {"japonia", TERRITORY_JPN, 0x00200000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CS)
+        {"japonsko", TERRITORY_JPN, 0x00000010},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"japonya", TERRITORY_JPN, 0x02000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CS)
+        {"jaroslavl oblast", TERRITORY_RU_YAR, 0x00000010},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FI)
+        {"jaroslavlin alue", TERRITORY_RU_YAR, 0x00000200},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PL)
+        {"jarosław oblast", TERRITORY_RU_YAR, 0x00200000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AF) || defined(MAPCODE_SUPPORT_LANGUAGE_CS) || defined(MAPCODE_SUPPORT_LANGUAGE_DE) || defined(MAPCODE_SUPPORT_LANGUAGE_FI) || defined(MAPCODE_SUPPORT_LANGUAGE_HR) || defined(MAPCODE_SUPPORT_LANGUAGE_NL) || defined(MAPCODE_SUPPORT_LANGUAGE_NO) || defined(MAPCODE_SUPPORT_LANGUAGE_PL) || defined(MAPCODE_SUPPORT_LANGUAGE_SV)
+        {"jemen", TERRITORY_YEM, 0x00ac2251},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ID)
+        {"jepang", TERRITORY_JPN, 0x00004000},
+        {"jerman", TERRITORY_DEU, 0x00004000},
+#endif
+        {"jersey", TERRITORY_JEY, 0x03bce7f1},
+        {"jervis bay", TERRITORY_AU_JBT, 0x08000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"jervis bay bolge", TERRITORY_AU_JBT, 0x02000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"jervis bay teritorij", TERRITORY_AU_JBT, 0x00002000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_IT)
+        {"jervis bay territorio", TERRITORY_AU_JBT, 0x00008000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_NL)
+        {"jervis bay territorium", TERRITORY_AU_JBT, 0x00040000},
+#endif
+        {"jervis bay territory", TERRITORY_AU_JBT, 0x088802f1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_SW)
+        {"jervis bay wapelestina", TERRITORY_AU_JBT, 0x01000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ID)
+        {"jervis bay wilayah", TERRITORY_AU_JBT, 0x00004000},
+#endif
+        {"jewish autonomous oblast", TERRITORY_RU_YEV, 0x01000080},
+        {"jey", TERRITORY_JEY, 0x10000000},
+        {"jharkhand", TERRITORY_IN_JH, 0x0bbce7f1},
+        {"jiangsu", TERRITORY_CN_JS, 0x03bce7f1},
+        {"jiangxi", TERRITORY_CN_JX, 0x03bce7f0},
+        {"jilin", TERRITORY_CN_JL, 0x03bce7f1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CS)
+        {"jizni afrika", TERRITORY_ZAF, 0x00000010},
+        {"jizni australie", TERRITORY_AU_SA, 0x00000010},
+        {"jizni dakota", TERRITORY_US_SD, 0x00000010},
+        {"jizni georgie a jizni sandwichovy ostrovy", TERRITORY_SGS, 0x00000010},
+        {"jizni karolina", TERRITORY_US_SC, 0x00000010},
+        {"jizni korea", TERRITORY_KOR, 0x00000010},
+        {"jizni sandwichovy ostrovy", TERRITORY_SGS, 0x00000010},
+        {"jizni sudan", TERRITORY_SSD, 0x00000010},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_NO)
+        {"jomfruøyer, amerikanske", TERRITORY_VIR, 0x00080000},
+        {"jomfruøyer, britiske", TERRITORY_VGB, 0x00080000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_NL)
+        {"joodse autonome oblast", TERRITORY_RU_YEV, 0x00040000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AF)
+        {"joodse outonome oblast", TERRITORY_RU_YEV, 0x00000001},
+#endif
+        {"jor", TERRITORY_JOR, 0x10000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DA)
+        {"jord", TERRITORY_AAA, 0x00000020},
+#endif
+        {"jordan", TERRITORY_JOR, 0x090c61f1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FI) || defined(MAPCODE_SUPPORT_LANGUAGE_PT) || defined(MAPCODE_SUPPORT_LANGUAGE_PL)
+        {"jordania", TERRITORY_JOR, 0x00300200},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FR)
+        {"jordanie", TERRITORY_JOR, 0x00000400},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_SV)
+        {"jordanien", TERRITORY_JOR, 0x00800000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_NO) || defined(MAPCODE_SUPPORT_LANGUAGE_SV)
+        {"jorden", TERRITORY_AAA, 0x00880000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FI)
+        {"joulusaari", TERRITORY_CXR, 0x00000200},
+#endif
+        {"jpn", TERRITORY_JPN, 0x10000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DE)
+        {"judischen autonomen oblast", TERRITORY_RU_YEV, 0x00000040},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_SV)
+        {"judiska autonoma lanet", TERRITORY_RU_YEV, 0x00800000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DA)
+        {"juleøen", TERRITORY_CXR, 0x00000020},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_SV)
+        {"julon", TERRITORY_CXR, 0x00800000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DE)
+        {"jungferninseln, britisch", TERRITORY_VGB, 0x00000040},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FI)
+        {"juutalaisten autonominen alue", TERRITORY_RU_YEV, 0x00000200},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"juzna afrika", TERRITORY_ZAF, 0x00002000},
+        {"juzna dakota", TERRITORY_US_SD, 0x00002000},
+        {"juzna georgija i otocje juzni sandwich", TERRITORY_SGS, 0x00002000},
+        {"juzna karolina", TERRITORY_US_SC, 0x00002000},
+        {"juzna koreja", TERRITORY_KOR, 0x00002000},
+        {"juzne australije", TERRITORY_AU_SA, 0x00002000},
+        {"juzni sudan", TERRITORY_SSD, 0x00002000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DA)
+        {"jødisk selvstyrende oblast", TERRITORY_RU_YEV, 0x00000020},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AF)
+        {"kaaimanseilande", TERRITORY_CYM, 0x00000001},
+        {"kaap verde", TERRITORY_CPV, 0x00000001},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_NL)
+        {"kaapverdie", TERRITORY_CPV, 0x00040000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"kabardey-balkar cumhuriyeti", TERRITORY_RU_KB, 0x02000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FI)
+        {"kabardi-balkarian tasavalta", TERRITORY_RU_KB, 0x00000200},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_SW)
+        {"kabardino-balkar jamhuri", TERRITORY_RU_KB, 0x01000000},
+#endif
+        {"kabardino-balkar republic", TERRITORY_RU_KB, 0x0088c0b1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_NL)
+        {"kabardino-balkar republiek", TERRITORY_RU_KB, 0x00040000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"kabardino-balkar republika", TERRITORY_RU_KB, 0x00002000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FR)
+        {"kabardino-balkarie", TERRITORY_RU_KB, 0x00000400},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DE)
+        {"kabardino-balkarien", TERRITORY_RU_KB, 0x00000040},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PL)
+        {"kabardyno-balkar republic", TERRITORY_RU_KB, 0x00200000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CS)
+        {"kajmanske ostrovy", TERRITORY_CYM, 0x00000010},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"kajmanski otoci", TERRITORY_CYM, 0x00002000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PL)
+        {"kajmany", TERRITORY_CYM, 0x00200000},
+#endif
+        {"kalaallit nunaat", TERRITORY_GRL, 0x08000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ID)
+        {"kaledonia baru", TERRITORY_NCL, 0x00004000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FI) || defined(MAPCODE_SUPPORT_LANGUAGE_PL)
+        {"kalifornia", TERRITORY_US_CA, 0x00200200},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AF) || defined(MAPCODE_SUPPORT_LANGUAGE_CS)
+        {"kalifornie", TERRITORY_US_CA, 0x00000011},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DE) || defined(MAPCODE_SUPPORT_LANGUAGE_SV)
+        {"kalifornien", TERRITORY_US_CA, 0x00800040},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"kalifornija", TERRITORY_US_CA, 0x00002000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_IT) || defined(MAPCODE_SUPPORT_LANGUAGE_SV)
+        {"kaliningrad", TERRITORY_RU_KGD, 0x00808000},
+#endif
+        {"kaliningrad oblast", TERRITORY_RU_KGD, 0x031c41f1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FI)
+        {"kaliningradin alue", TERRITORY_RU_KGD, 0x00000200},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"kalinjingrad oblast", TERRITORY_RU_KGD, 0x00002000},
+        {"kalmikiji republika", TERRITORY_RU_KL, 0x00002000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_NL)
+        {"kalmukkie republiek", TERRITORY_RU_KL, 0x00040000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"kalmykia cumhuriyeti", TERRITORY_RU_KL, 0x02000000},
+#endif
+        {"kalmykia republic", TERRITORY_RU_KL, 0x01000090},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AF)
+        {"kalmykia republiek", TERRITORY_RU_KL, 0x00000001},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DA) || defined(MAPCODE_SUPPORT_LANGUAGE_DE) || defined(MAPCODE_SUPPORT_LANGUAGE_ID)
+        {"kalmykia republik", TERRITORY_RU_KL, 0x00004060},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_NO)
+        {"kalmykia republikk", TERRITORY_RU_KL, 0x00080000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FI)
+        {"kalmykia tasavalta", TERRITORY_RU_KL, 0x00000200},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_SV)
+        {"kalmykiarepubliken", TERRITORY_RU_KL, 0x00800000},
+#endif
+        {"kalmykiya", TERRITORY_RU_KL, 0x08000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DE)
+        {"kaluga", TERRITORY_RU_KLU, 0x00000040},
+#endif
+        {"kaluga oblast", TERRITORY_RU_KLU, 0x019ce1b1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"kaluga oblastı", TERRITORY_RU_KLU, 0x02000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FI)
+        {"kalugan alue", TERRITORY_RU_KLU, 0x00000200},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"kambocya", TERRITORY_KHM, 0x02000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AF) || defined(MAPCODE_SUPPORT_LANGUAGE_SV)
+        {"kambodja", TERRITORY_KHM, 0x00800001},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DE)
+        {"kambodscha", TERRITORY_KHM, 0x00000040},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_NO)
+        {"kambodsja", TERRITORY_KHM, 0x00080000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CS) || defined(MAPCODE_SUPPORT_LANGUAGE_FI) || defined(MAPCODE_SUPPORT_LANGUAGE_HR) || defined(MAPCODE_SUPPORT_LANGUAGE_PL)
+        {"kambodza", TERRITORY_KHM, 0x00202210},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ID)
+        {"kamboja", TERRITORY_KHM, 0x00004000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"kamcatski kraj", TERRITORY_RU_KAM, 0x00002000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CS)
+        {"kamcatsky kraj", TERRITORY_RU_KAM, 0x00000010},
+#endif
+        {"kamchatka krai", TERRITORY_RU_KAM, 0x039cc1e1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AF) || defined(MAPCODE_SUPPORT_LANGUAGE_NL)
+        {"kameroen", TERRITORY_CMR, 0x00040001},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CS) || defined(MAPCODE_SUPPORT_LANGUAGE_DE) || defined(MAPCODE_SUPPORT_LANGUAGE_FI) || defined(MAPCODE_SUPPORT_LANGUAGE_HR) || defined(MAPCODE_SUPPORT_LANGUAGE_ID) || defined(MAPCODE_SUPPORT_LANGUAGE_NO) || defined(MAPCODE_SUPPORT_LANGUAGE_PL) || defined(MAPCODE_SUPPORT_LANGUAGE_SV) || defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"kamerun", TERRITORY_CMR, 0x02a86250},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FI)
+        {"kamtsatkan aluepiiri", TERRITORY_RU_KAM, 0x00000200},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AF) || defined(MAPCODE_SUPPORT_LANGUAGE_CS) || defined(MAPCODE_SUPPORT_LANGUAGE_DE) || defined(MAPCODE_SUPPORT_LANGUAGE_FI) || defined(MAPCODE_SUPPORT_LANGUAGE_HR) || defined(MAPCODE_SUPPORT_LANGUAGE_ID) || defined(MAPCODE_SUPPORT_LANGUAGE_PL) || defined(MAPCODE_SUPPORT_LANGUAGE_SV) || defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"kanada", TERRITORY_CAN, 0x02a06251},
+#endif
+        {"kangwane", TERRITORY_SWZ, 0x08000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FI)
+        {"kansainvalinen", TERRITORY_AAA, 0x00000200},
+#endif
+        {"kansas", TERRITORY_US_KS, 0x0bbcc7f1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"kanzas", TERRITORY_US_KS, 0x00002000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DA) || defined(MAPCODE_SUPPORT_LANGUAGE_DE) || defined(MAPCODE_SUPPORT_LANGUAGE_FI)
+        {"kap verde", TERRITORY_CPV, 0x00000260},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_NO)
+        {"kapp verde", TERRITORY_CPV, 0x00080000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CS)
+        {"kapverdy", TERRITORY_CPV, 0x00000010},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"karacay-cerkes cumhuriyeti", TERRITORY_RU_KC, 0x02000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"karachay-cerkezi republika", TERRITORY_RU_KC, 0x00002000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_SW)
+        {"karachay-cherkess jamhuri", TERRITORY_RU_KC, 0x01000000},
+#endif
+        {"karachay-cherkess republic", TERRITORY_RU_KC, 0x0080c0b0},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AF) || defined(MAPCODE_SUPPORT_LANGUAGE_NL)
+        {"karachay-cherkess republiek", TERRITORY_RU_KC, 0x00040001},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_NO)
+        {"karachay-cherkess republikk", TERRITORY_RU_KC, 0x00080000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PL)
+        {"karaczajo-cherkess republic", TERRITORY_RU_KC, 0x00200000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"karadag", TERRITORY_MNE, 0x02000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FI)
+        {"karatsai-tserkessit tasavalta", TERRITORY_RU_KC, 0x00000200},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DE)
+        {"karatschai-tscherkessien republik", TERRITORY_RU_KC, 0x00000040},
+#endif
+        {"karelia republic", TERRITORY_RU_KR, 0x01000080},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_NL)
+        {"karelia republiek", TERRITORY_RU_KR, 0x00040000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DA) || defined(MAPCODE_SUPPORT_LANGUAGE_ID)
+        {"karelia republik", TERRITORY_RU_KR, 0x00004020},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"karelia republika", TERRITORY_RU_KR, 0x00002000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_SV)
+        {"karelia republiken", TERRITORY_RU_KR, 0x00800000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_NO)
+        {"karelia republikk", TERRITORY_RU_KR, 0x00080000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CS)
+        {"karelie republic", TERRITORY_RU_KR, 0x00000010},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AF)
+        {"karelie republiek", TERRITORY_RU_KR, 0x00000001},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"karelya cumhuriyeti", TERRITORY_RU_KR, 0x02000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FI)
+        {"karjalan tasavalta", TERRITORY_RU_KR, 0x00000200},
+#endif
+        {"karnataka", TERRITORY_IN_KA, 0x0b3ce7f1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_SV)
+        {"karnatakaen", TERRITORY_IN_KA, 0x00800000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PL)
+        {"karolina połnocna", TERRITORY_US_NC, 0x00200000},
+        {"karolina południowa", TERRITORY_US_SC, 0x00200000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DE)
+        {"kasachstan", TERRITORY_KAZ, 0x00000040},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DA) || defined(MAPCODE_SUPPORT_LANGUAGE_NO)
+        {"kasakhstan", TERRITORY_KAZ, 0x00080020},
+#endif
+        {"kashmir", TERRITORY_IN_JK, 0x00000080},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"kasmir", TERRITORY_IN_JK, 0x00002000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AF) || defined(MAPCODE_SUPPORT_LANGUAGE_CS) || defined(MAPCODE_SUPPORT_LANGUAGE_DE) || defined(MAPCODE_SUPPORT_LANGUAGE_ES) || defined(MAPCODE_SUPPORT_LANGUAGE_HR) || defined(MAPCODE_SUPPORT_LANGUAGE_PL) || defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"katar", TERRITORY_QAT, 0x02202151},
+#endif
+        {"kaz", TERRITORY_KAZ, 0x10000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CS) || defined(MAPCODE_SUPPORT_LANGUAGE_NL) || defined(MAPCODE_SUPPORT_LANGUAGE_PL)
+        {"kazachstan", TERRITORY_KAZ, 0x00240010},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"kazahstan", TERRITORY_KAZ, 0x00002000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ES)
+        {"kazajstan", TERRITORY_KAZ, 0x00000100},
+#endif
+        {"kazakhstan", TERRITORY_KAZ, 0x0900c480},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"kazakistan", TERRITORY_KAZ, 0x02000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AF) || defined(MAPCODE_SUPPORT_LANGUAGE_FI) || defined(MAPCODE_SUPPORT_LANGUAGE_SV)
+        {"kazakstan", TERRITORY_KAZ, 0x00800201},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"keeling adaları", TERRITORY_CCK, 0x02000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AF)
+        {"keeling eilande", TERRITORY_CCK, 0x00000001},
+#endif
+        {"keeling islands", TERRITORY_CCK, 0x098c42b0},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"keeling otoci", TERRITORY_CCK, 0x00002000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DE)
+        {"keeling-insel", TERRITORY_CCK, 0x00000040},
+#endif
+        {"kemerovo oblast", TERRITORY_RU_KEM, 0x019c60b1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"kemerovo oblastı", TERRITORY_RU_KEM, 0x02000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FI)
+        {"kemerovon alue", TERRITORY_RU_KEM, 0x00000200},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DE)
+        {"kemerowo", TERRITORY_RU_KEM, 0x00000040},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PL)
+        {"kemerowo oblast", TERRITORY_RU_KEM, 0x00200000},
+#endif
+        {"ken", TERRITORY_KEN, 0x10000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CS)
+        {"kena", TERRITORY_KEN, 0x00000010},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AF) || defined(MAPCODE_SUPPORT_LANGUAGE_DE) || defined(MAPCODE_SUPPORT_LANGUAGE_ES) || defined(MAPCODE_SUPPORT_LANGUAGE_FI) || defined(MAPCODE_SUPPORT_LANGUAGE_IT) || defined(MAPCODE_SUPPORT_LANGUAGE_NL) || defined(MAPCODE_SUPPORT_LANGUAGE_PL)
+        {"kenia", TERRITORY_KEN, 0x00248341},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"kenija", TERRITORY_KEN, 0x00002000},
+        {"kentaki", TERRITORY_US_KY, 0x00002000},
+#endif
+        {"kentucky", TERRITORY_US_KY, 0x0bbce7f1},
+        {"kenya", TERRITORY_KEN, 0x0b8844a0},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ID)
+        {"kepulauan aaland", TERRITORY_ALA, 0x00004000},
+#endif
+        {"kepulauan cocos", TERRITORY_CCK, 0x08004000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ID)
+        {"kepulauan cook", TERRITORY_COK, 0x00004000},
+        {"kepulauan falkland", TERRITORY_FLK, 0x00004000},
+        {"kepulauan faroe", TERRITORY_FRO, 0x00004000},
+        {"kepulauan fiji", TERRITORY_FJI, 0x00004000},
+        {"kepulauan mariana utara", TERRITORY_MNP, 0x00004000},
+        {"kepulauan pitcairn", TERRITORY_PCN, 0x00004000},
+        {"kepulauan terluar kecil amerika serikat", TERRITORY_UMI, 0x00004000},
+        {"kepulauan turks dan caicos", TERRITORY_TCA, 0x00004000},
+        {"kepulauan virgin, as", TERRITORY_VIR, 0x00004000},
+        {"kepulauan virgin, inggris", TERRITORY_VGB, 0x00004000},
+#endif
+        {"kerala", TERRITORY_IN_KL, 0x0bbce7f1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FI)
+        {"keski-afrikan tasavalta", TERRITORY_CAF, 0x00000200},
+#endif
+        {"kgz", TERRITORY_KGZ, 0x10000000},
+        {"khabarovsk krai", TERRITORY_RU_KHA, 0x031ce0e1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_SW)
+        {"khakassia jamhuri", TERRITORY_RU_KK, 0x01000000},
+#endif
+        {"khakassia republic", TERRITORY_RU_KK, 0x00000080},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AF) || defined(MAPCODE_SUPPORT_LANGUAGE_NL)
+        {"khakassia republiek", TERRITORY_RU_KK, 0x00040001},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DA) || defined(MAPCODE_SUPPORT_LANGUAGE_ID)
+        {"khakassia republik", TERRITORY_RU_KK, 0x00004020},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"khakassia republika", TERRITORY_RU_KK, 0x00002000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_NO)
+        {"khakassia republikk", TERRITORY_RU_KK, 0x00080000},
+#endif
+        {"khanty-mansi", TERRITORY_RU_KM, 0x019ce1e1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FR)
+        {"khantys-mansis", TERRITORY_RU_KM, 0x00000400},
+#endif
+        {"khm", TERRITORY_KHM, 0x10000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_SW)
+        {"kifaransa guiana", TERRITORY_GUF, 0x01000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FI)
+        {"kiina", TERRITORY_CHN, 0x00000200},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DA) || defined(MAPCODE_SUPPORT_LANGUAGE_HR) || defined(MAPCODE_SUPPORT_LANGUAGE_NO) || defined(MAPCODE_SUPPORT_LANGUAGE_SV)
+        {"kina", TERRITORY_CHN, 0x00882020},
+#endif
+        {"kir", TERRITORY_KIR, 0x10000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FR)
+        {"kirghizistan", TERRITORY_KGZ, 0x00000400},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FI)
+        {"kirgisia", TERRITORY_KGZ, 0x00000200},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DA) || defined(MAPCODE_SUPPORT_LANGUAGE_DE) || defined(MAPCODE_SUPPORT_LANGUAGE_NO)
+        {"kirgisistan", TERRITORY_KGZ, 0x00080060},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR) || defined(MAPCODE_SUPPORT_LANGUAGE_PL)
+        {"kirgistan", TERRITORY_KGZ, 0x00202000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_NL)
+        {"kirgizie", TERRITORY_KGZ, 0x00040000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ES)
+        {"kirguistan", TERRITORY_KGZ, 0x00000100},
+#endif
+        {"kiribati", TERRITORY_KIR, 0x0bace7f1},
+        {"kirov oblast", TERRITORY_RU_KI, 0x03bce0f1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FI)
+        {"kirovin alue", TERRITORY_RU_KI, 0x00000200},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_SW)
+        {"kisiwa cha krismasi", TERRITORY_CXR, 0x01000000},
+        {"kisiwa cha man", TERRITORY_IMN, 0x01000000},
+        {"kitakatifu", TERRITORY_VAT, 0x01000000},
+#endif
+        {"kna", TERRITORY_KNA, 0x10000000},
+        {"kodorosese ti beafrika", TERRITORY_CAF, 0x08000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AF)
+        {"koersk oblast", TERRITORY_RU_KRS, 0x00000001},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_NL)
+        {"koeweit", TERRITORY_KWT, 0x00040000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DE)
+        {"kokosinseln", TERRITORY_CCK, 0x00000040},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_SV)
+        {"kokosoarna", TERRITORY_CCK, 0x00800000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CS)
+        {"kokosove ostrovy", TERRITORY_CCK, 0x00000010},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"kokosovi otoci", TERRITORY_CCK, 0x00002000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PL)
+        {"kokosowe, wyspy", TERRITORY_CCK, 0x00200000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_NO)
+        {"kokosøyene", TERRITORY_CCK, 0x00080000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"kolombiya", TERRITORY_COL, 0x02000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR) || defined(MAPCODE_SUPPORT_LANGUAGE_PL)
+        {"kolorado", TERRITORY_US_CO, 0x00202000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FI) || defined(MAPCODE_SUPPORT_LANGUAGE_ID) || defined(MAPCODE_SUPPORT_LANGUAGE_PL)
+        {"kolumbia", TERRITORY_COL, 0x00204200},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CS)
+        {"kolumbie", TERRITORY_COL, 0x00000010},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DE)
+        {"kolumbien", TERRITORY_COL, 0x00000040},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"kolumbija", TERRITORY_COL, 0x00002000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"kolumbiya bolgesi", TERRITORY_US_DC, 0x02000000},
+#endif
+        {"komi republic", TERRITORY_RU_KO, 0x039c40b0},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AF)
+        {"komi republiek", TERRITORY_RU_KO, 0x00000001},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"komi republika", TERRITORY_RU_KO, 0x00002000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FI)
+        {"komin", TERRITORY_RU_KO, 0x00000200},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DE)
+        {"komoren", TERRITORY_COM, 0x00000040},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_NO)
+        {"komorene", TERRITORY_COM, 0x00080000},
+#endif
+        {"komori", TERRITORY_COM, 0x08002000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FI)
+        {"komorit", TERRITORY_COM, 0x00000200},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"komorlar", TERRITORY_COM, 0x02000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ID)
+        {"komoro", TERRITORY_COM, 0x00004000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CS) || defined(MAPCODE_SUPPORT_LANGUAGE_PL)
+        {"komory", TERRITORY_COM, 0x00200010},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PL)
+        {"konga-kinshasa", TERRITORY_COD, 0x00200000},
+        {"kongo", TERRITORY_COG, 0x00200000},
+#endif
+        {"kongo", TERRITORY_COD, 0x08000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"kongo kinsasa", TERRITORY_COD, 0x02000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CS) || defined(MAPCODE_SUPPORT_LANGUAGE_DE) || defined(MAPCODE_SUPPORT_LANGUAGE_HR) || defined(MAPCODE_SUPPORT_LANGUAGE_ID) || defined(MAPCODE_SUPPORT_LANGUAGE_NO) || defined(MAPCODE_SUPPORT_LANGUAGE_SV) || defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"kongo-brazzaville", TERRITORY_COG, 0x02886050},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AF) || defined(MAPCODE_SUPPORT_LANGUAGE_CS) || defined(MAPCODE_SUPPORT_LANGUAGE_DE) || defined(MAPCODE_SUPPORT_LANGUAGE_FI) || defined(MAPCODE_SUPPORT_LANGUAGE_HR) || defined(MAPCODE_SUPPORT_LANGUAGE_ID) || defined(MAPCODE_SUPPORT_LANGUAGE_NO) || defined(MAPCODE_SUPPORT_LANGUAGE_SV)
+        {"kongo-kinshasa", TERRITORY_COD, 0x00886251},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FI)
+        {"kongon", TERRITORY_COG, 0x00000200},
+        {"kookossaaret", TERRITORY_CCK, 0x00000200},
+#endif
+        {"kor", TERRITORY_KOR, 0x10000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_SW)
+        {"korea kaskazini", TERRITORY_PRK, 0x01000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PL)
+        {"korea połnocna", TERRITORY_PRK, 0x00200000},
+        {"korea południowa", TERRITORY_KOR, 0x00200000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ID)
+        {"korea selatan", TERRITORY_KOR, 0x00004000},
+        {"korea utara", TERRITORY_PRK, 0x00004000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_SW)
+        {"korea ya kusini", TERRITORY_KOR, 0x01000000},
+#endif
+        {"korea, north", TERRITORY_PRK, 0x00000080},
+        {"korea, south", TERRITORY_KOR, 0x00000080},
+        {"korsou", TERRITORY_CUW, 0x08000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ID) || defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"kosta rika", TERRITORY_CRI, 0x02004000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CS) || defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"kostarika", TERRITORY_CRI, 0x00002010},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PL)
+        {"kostaryka", TERRITORY_CRI, 0x00200000},
+#endif
+        {"kostroma oblast", TERRITORY_RU_KOS, 0x039ce1f1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FI)
+        {"kostromossa", TERRITORY_RU_KOS, 0x00000200},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FR)
+        {"koweit", TERRITORY_KWT, 0x00000400},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ES)
+        {"krai de altai", TERRITORY_RU_ALT, 0x00000100},
+        {"krai de jabarovsk", TERRITORY_RU_KHA, 0x00000100},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FR)
+        {"krai de khabarovsk", TERRITORY_RU_KHA, 0x00000400},
+        {"krai de krasnodar", TERRITORY_RU_KDA, 0x00000400},
+        {"krai de krasnoiarsk", TERRITORY_RU_KYA, 0x00000400},
+        {"krai de l’altai", TERRITORY_RU_ALT, 0x00000400},
+        {"krai de perm", TERRITORY_RU_PM, 0x00000400},
+        {"krai de stavropol", TERRITORY_RU_STA, 0x00000400},
+        {"krai de transbaikalie", TERRITORY_RU_ZAB, 0x00000400},
+        {"krai du kamtchatka", TERRITORY_RU_KAM, 0x00000400},
+        {"krai du krai", TERRITORY_RU_PO, 0x00000400},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ID)
+        {"krai zabaykalsky", TERRITORY_RU_ZAB, 0x00004000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PL)
+        {"kraj ałtajski", TERRITORY_RU_ALT, 0x00200000},
+        {"kraj chabarowski", TERRITORY_RU_KHA, 0x00200000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_IT)
+        {"kraj di stavropol `", TERRITORY_RU_STA, 0x00008000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PL)
+        {"kraj kamczacki", TERRITORY_RU_KAM, 0x00200000},
+        {"kraj krasnodarski", TERRITORY_RU_KDA, 0x00200000},
+        {"kraj krasnojarski", TERRITORY_RU_KYA, 0x00200000},
+        {"kraj stawropolski", TERRITORY_RU_STA, 0x00200000},
+        {"kraj zabajkalski", TERRITORY_RU_ZAB, 0x00200000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"kraljevina butan", TERRITORY_BTN, 0x00002000},
+        {"krasnodar", TERRITORY_RU_KDA, 0x00002000},
+#endif
+        {"krasnodar krai", TERRITORY_RU_KDA, 0x039cc1f1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FI)
+        {"krasnodarin", TERRITORY_RU_KDA, 0x00000200},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"krasnojarsk krai", TERRITORY_RU_KYA, 0x00002000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FI)
+        {"krasnojarskin aluepiiri", TERRITORY_RU_KYA, 0x00000200},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CS)
+        {"krasnojarsky kraj", TERRITORY_RU_KYA, 0x00000010},
+#endif
+        {"krasnoyarsk krai", TERRITORY_RU_KYA, 0x039cc1e1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FI)
+        {"kreikka", TERRITORY_GRC, 0x00000200},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DA)
+        {"kristi himmelfart", TERRITORY_SHN, 0x00000020},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ID)
+        {"kroasia", TERRITORY_HRV, 0x00004000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AF)
+        {"kroasie", TERRITORY_HRV, 0x00000001},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FI) || defined(MAPCODE_SUPPORT_LANGUAGE_NO)
+        {"kroatia", TERRITORY_HRV, 0x00080200},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_NL)
+        {"kroatie", TERRITORY_HRV, 0x00040000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DA) || defined(MAPCODE_SUPPORT_LANGUAGE_DE) || defined(MAPCODE_SUPPORT_LANGUAGE_SV)
+        {"kroatien", TERRITORY_HRV, 0x00800060},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PL)
+        {"ksiazeca, wyspy", TERRITORY_STP, 0x00200000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AF) || defined(MAPCODE_SUPPORT_LANGUAGE_CS) || defined(MAPCODE_SUPPORT_LANGUAGE_DE) || defined(MAPCODE_SUPPORT_LANGUAGE_HR) || defined(MAPCODE_SUPPORT_LANGUAGE_ID) || defined(MAPCODE_SUPPORT_LANGUAGE_PL) || defined(MAPCODE_SUPPORT_LANGUAGE_SV) || defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"kuba", TERRITORY_CUB, 0x02a06051},
+#endif
+        {"kuki 'airani", TERRITORY_COK, 0x08000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DE)
+        {"kurgan", TERRITORY_RU_KGN, 0x00000040},
+#endif
+        {"kurgan oblast", TERRITORY_RU_KGN, 0x038ce0b1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FI)
+        {"kurganin alue", TERRITORY_RU_KGN, 0x00000200},
+#endif
+        {"kursk oblast", TERRITORY_RU_KRS, 0x03acc0f0},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"kurska oblast", TERRITORY_RU_KRS, 0x00002000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FI)
+        {"kurskin alue", TERRITORY_RU_KRS, 0x00000200},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_SW)
+        {"kusikia kisiwa na mcdonald visiwa", TERRITORY_HMD, 0x01000000},
+        {"kusini mwa ufaransa na antarctic ardhi", TERRITORY_ATF, 0x01000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FI)
+        {"kuuba", TERRITORY_CUB, 0x00000200},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CS) || defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"kuvajt", TERRITORY_KWT, 0x00002010},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"kuveyt", TERRITORY_KWT, 0x02000000},
+#endif
+        {"kuwait", TERRITORY_KWT, 0x0998c3e1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PL)
+        {"kuwejt", TERRITORY_KWT, 0x00200000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"kuzey irlanda", TERRITORY_GBR, 0x02000000},
+        {"kuzey kore", TERRITORY_PRK, 0x02000000},
+        {"kuzey mariana adaları", TERRITORY_MNP, 0x02000000},
+        {"kuzey osetya-alania cumhuriyeti", TERRITORY_RU_SE, 0x02000000},
+        {"kuzeybatı bolgesi", TERRITORY_CA_NT, 0x02000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AF)
+        {"kwazulu-natal", TERRITORY_CN_GD, 0x00000001},
+#endif
+        {"kwt", TERRITORY_KWT, 0x10000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CS)
+        {"kypr", TERRITORY_CYP, 0x00000010},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FI) || defined(MAPCODE_SUPPORT_LANGUAGE_NO)
+        {"kypros", TERRITORY_CYP, 0x00080200},
+#endif
+        {"kyrgyz republic", TERRITORY_KGZ, 0x00000080},
+        {"kyrgyzstan", TERRITORY_KGZ, 0x0180c091},
+        {"kıbrıs", TERRITORY_CYP, 0x08000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"kıbrıs cumhuriyeti", TERRITORY_CYP, 0x02000000},
+        {"kırgızistan", TERRITORY_KGZ, 0x02000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_IT)
+        {"l`eritrea", TERRITORY_ERI, 0x00008000},
+#endif
+        {"la grenade", TERRITORY_GRD, 0x08000000},
+        {"la reunion", TERRITORY_REU, 0x08000000},
+        {"labrador", TERRITORY_CA_NL, 0x00000080},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_IT)
+        {"laccadive", TERRITORY_IN_LD, 0x00008000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AF)
+        {"ladismith", TERRITORY_IN_HR, 0x00000001},
+#endif
+        {"lakshadweep", TERRITORY_IN_LD, 0x0b9ce7f1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PL)
+        {"lakszadiwy", TERRITORY_IN_LD, 0x00200000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FI)
+        {"lansi-bengal", TERRITORY_IN_WB, 0x00000200},
+        {"lansi-sahara", TERRITORY_ESH, 0x00000200},
+        {"lansi-saharan", TERRITORY_ESH, 0x00000200},
+        {"lansi-virginia", TERRITORY_US_WV, 0x00000200},
+#endif
+        {"lao", TERRITORY_LAO, 0x18000000},
+        {"lao people's democratic republic", TERRITORY_LAO, 0x00000080},
+        {"laos", TERRITORY_LAO, 0x03bce7f1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ES)
+        {"laquedivas", TERRITORY_IN_LD, 0x00000100},
+#endif
+        {"latvia", TERRITORY_LVA, 0x01084280},
+        {"latvija", TERRITORY_LVA, 0x08000000},
+        {"lbn", TERRITORY_LBN, 0x10000000},
+        {"lbr", TERRITORY_LBR, 0x10000000},
+        {"lby", TERRITORY_LBY, 0x10000000},
+        {"lca", TERRITORY_LCA, 0x10000000},
+        {"lebanese republic", TERRITORY_LBN, 0x00000080},
+        {"lebanon", TERRITORY_LBN, 0x01000080},
+        {"leningrad oblast", TERRITORY_RU_LEN, 0x03ace0f1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FI)
+        {"leningradin", TERRITORY_RU_LEN, 0x00000200},
+#endif
+        {"lesotho", TERRITORY_LSO, 0x03ac46f1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ES) || defined(MAPCODE_SUPPORT_LANGUAGE_HR) || defined(MAPCODE_SUPPORT_LANGUAGE_IT) || defined(MAPCODE_SUPPORT_LANGUAGE_PT)
+        {"lesoto", TERRITORY_LSO, 0x0010a100},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AF) || defined(MAPCODE_SUPPORT_LANGUAGE_DA) || defined(MAPCODE_SUPPORT_LANGUAGE_NL)
+        {"letland", TERRITORY_LVA, 0x00040021},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ES) || defined(MAPCODE_SUPPORT_LANGUAGE_PT)
+        {"letonia", TERRITORY_LVA, 0x00100100},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"letonija", TERRITORY_LVA, 0x00002000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"letonya", TERRITORY_LVA, 0x02000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DE) || defined(MAPCODE_SUPPORT_LANGUAGE_SV)
+        {"lettland", TERRITORY_LVA, 0x00800040},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_IT)
+        {"lettonia", TERRITORY_LVA, 0x00008000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FR)
+        {"lettonie", TERRITORY_LVA, 0x00000400},
+#endif
+        {"letzebuerg", TERRITORY_LUX, 0x08000000},
+        {"liaoning", TERRITORY_CN_LN, 0x03bce5f1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FI)
+        {"liaoningin", TERRITORY_CN_LN, 0x00000200},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FR) || defined(MAPCODE_SUPPORT_LANGUAGE_PL)
+        {"liban", TERRITORY_LBN, 0x00200400},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ES) || defined(MAPCODE_SUPPORT_LANGUAGE_IT) || defined(MAPCODE_SUPPORT_LANGUAGE_PT)
+        {"libano", TERRITORY_LBN, 0x00108100},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AF) || defined(MAPCODE_SUPPORT_LANGUAGE_CS) || defined(MAPCODE_SUPPORT_LANGUAGE_DA) || defined(MAPCODE_SUPPORT_LANGUAGE_DE) || defined(MAPCODE_SUPPORT_LANGUAGE_FI) || defined(MAPCODE_SUPPORT_LANGUAGE_HR) || defined(MAPCODE_SUPPORT_LANGUAGE_ID) || defined(MAPCODE_SUPPORT_LANGUAGE_NL) || defined(MAPCODE_SUPPORT_LANGUAGE_NO) || defined(MAPCODE_SUPPORT_LANGUAGE_SV)
+        {"libanon", TERRITORY_LBN, 0x008c6271},
+#endif
+        {"liberia", TERRITORY_LBR, 0x09bcc7e0},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AF) || defined(MAPCODE_SUPPORT_LANGUAGE_CS)
+        {"liberie", TERRITORY_LBR, 0x00000011},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"liberija", TERRITORY_LBR, 0x00002000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"liberya", TERRITORY_LBR, 0x02000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ES) || defined(MAPCODE_SUPPORT_LANGUAGE_IT) || defined(MAPCODE_SUPPORT_LANGUAGE_PT) || defined(MAPCODE_SUPPORT_LANGUAGE_PL)
+        {"libia", TERRITORY_LBY, 0x00308100},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AF) || defined(MAPCODE_SUPPORT_LANGUAGE_NL)
+        {"libie", TERRITORY_LBY, 0x00040001},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"libija", TERRITORY_LBY, 0x00002000},
+#endif
+        {"libnan", TERRITORY_LBN, 0x08000000},
+        {"libya", TERRITORY_LBY, 0x0b084280},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CS) || defined(MAPCODE_SUPPORT_LANGUAGE_FR)
+        {"libye", TERRITORY_LBY, 0x00000410},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DA) || defined(MAPCODE_SUPPORT_LANGUAGE_DE) || defined(MAPCODE_SUPPORT_LANGUAGE_SV)
+        {"libyen", TERRITORY_LBY, 0x00800060},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CS)
+        {"lichtenstejnsko", TERRITORY_LIE, 0x00000010},
+#endif
+        {"lie", TERRITORY_LIE, 0x10000000},
+        {"liechtenstein", TERRITORY_LIE, 0x09bcc7e1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FI)
+        {"liettua", TERRITORY_LTU, 0x00000200},
+#endif
+        {"lietuva", TERRITORY_LTU, 0x08000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"lihtenstajn", TERRITORY_LIE, 0x00002000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"lihtenstayn", TERRITORY_LIE, 0x02000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CS) || defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"lipecka oblast", TERRITORY_RU_LIP, 0x00002010},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_NL)
+        {"lipetsk", TERRITORY_RU_LIP, 0x00040000},
+#endif
+        {"lipetsk oblast", TERRITORY_RU_LIP, 0x0398c0e1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FI)
+        {"lipetskin alue", TERRITORY_RU_LIP, 0x00000200},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AF)
+        {"litaue", TERRITORY_LTU, 0x00000001},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DA) || defined(MAPCODE_SUPPORT_LANGUAGE_DE) || defined(MAPCODE_SUPPORT_LANGUAGE_NO) || defined(MAPCODE_SUPPORT_LANGUAGE_SV)
+        {"litauen", TERRITORY_LTU, 0x00880060},
+#endif
+        {"lithuania", TERRITORY_LTU, 0x01004080},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_NL)
+        {"litouwen", TERRITORY_LTU, 0x00040000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ES) || defined(MAPCODE_SUPPORT_LANGUAGE_IT) || defined(MAPCODE_SUPPORT_LANGUAGE_PT)
+        {"lituania", TERRITORY_LTU, 0x00108100},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FR)
+        {"lituanie", TERRITORY_LTU, 0x00000400},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CS) || defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"litva", TERRITORY_LTU, 0x00002010},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"litvanya", TERRITORY_LTU, 0x02000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PL)
+        {"litwa", TERRITORY_LTU, 0x00200000},
+#endif
+        {"lka", TERRITORY_LKA, 0x10000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ES)
+        {"llevar a la fuerza", TERRITORY_CN_SH, 0x00000100},
+#endif
+        {"llol marianas", TERRITORY_MNP, 0x08000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CS)
+        {"lotyssko", TERRITORY_LVA, 0x00000010},
+#endif
+        {"louisiana", TERRITORY_US_LA, 0x0b8ce2f1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FR)
+        {"louisiane", TERRITORY_US_LA, 0x00000400},
+#endif
+        {"lso", TERRITORY_LSO, 0x10000000},
+        {"ltu", TERRITORY_LTU, 0x10000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"lubnan", TERRITORY_LBN, 0x02000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CS)
+        {"lucembursko", TERRITORY_LUX, 0x00000010},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ES) || defined(MAPCODE_SUPPORT_LANGUAGE_PT)
+        {"luisiana", TERRITORY_US_LA, 0x00100100},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PL)
+        {"luizjana", TERRITORY_US_LA, 0x00200000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR) || defined(MAPCODE_SUPPORT_LANGUAGE_ID) || defined(MAPCODE_SUPPORT_LANGUAGE_PL) || defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"luksemburg", TERRITORY_LUX, 0x02206000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FI)
+        {"luoteisterritoriot", TERRITORY_CA_NT, 0x00000200},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_IT)
+        {"lussemburgo", TERRITORY_LUX, 0x00008000},
+#endif
+        {"lux", TERRITORY_LUX, 0x10000000},
+        {"luxembourg", TERRITORY_LUX, 0x010804a0},
+        {"luxemburg", TERRITORY_LUX, 0x08840241},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ES) || defined(MAPCODE_SUPPORT_LANGUAGE_PT)
+        {"luxemburgo", TERRITORY_LUX, 0x00100100},
+#endif
+        {"lva", TERRITORY_LVA, 0x10000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_NL)
+        {"maagdeneilanden, usa", TERRITORY_VIR, 0x00040000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FI)
+        {"maailma", TERRITORY_AAA, 0x00000200},
+        {"maapallo", TERRITORY_AAA, 0x00000200},
+#endif
+        {"mac", TERRITORY_MAC, 0x10000000},
+        {"macao", TERRITORY_MAC, 0x08080600},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"macaristan", TERRITORY_HUN, 0x02000000},
+#endif
+        {"macau", TERRITORY_MAC, 0x0194c1f1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FR)
+        {"macedoine", TERRITORY_MKD, 0x00000400},
+#endif
+        {"macedonia", TERRITORY_MKD, 0x08308180},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AF) || defined(MAPCODE_SUPPORT_LANGUAGE_NL)
+        {"macedonie", TERRITORY_MKD, 0x00040001},
+#endif
+        {"madagascar", TERRITORY_MDG, 0x091485a0},
+        {"madagasikara", TERRITORY_MDG, 0x08000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AF) || defined(MAPCODE_SUPPORT_LANGUAGE_CS) || defined(MAPCODE_SUPPORT_LANGUAGE_DE) || defined(MAPCODE_SUPPORT_LANGUAGE_FI) || defined(MAPCODE_SUPPORT_LANGUAGE_HR) || defined(MAPCODE_SUPPORT_LANGUAGE_ID) || defined(MAPCODE_SUPPORT_LANGUAGE_NO) || defined(MAPCODE_SUPPORT_LANGUAGE_PL) || defined(MAPCODE_SUPPORT_LANGUAGE_SV) || defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"madagaskar", TERRITORY_MDG, 0x02a86251},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CS)
+        {"madarsko", TERRITORY_HUN, 0x00000010},
+        {"madhjaprades", TERRITORY_IN_MP, 0x00000010},
+#endif
+        {"madhya pradesh", TERRITORY_IN_MP, 0x01bce7e1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"madya prades", TERRITORY_IN_MP, 0x02000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_SW)
+        {"maeneo ya palestina", TERRITORY_PSE, 0x01000000},
+#endif
+        {"maf", TERRITORY_MAF, 0x10000000},
+        {"magadan oblast", TERRITORY_RU_MAG, 0x009ce0f1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"magadan oblastı", TERRITORY_RU_MAG, 0x02000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_SW)
+        {"magadani oblast", TERRITORY_RU_MAG, 0x01000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FI)
+        {"magadanin alue", TERRITORY_RU_MAG, 0x00000200},
+#endif
+        {"magyarorszag", TERRITORY_HUN, 0x08000000},
+        {"maharashtra", TERRITORY_IN_MH, 0x039ce7f1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PL)
+        {"maharasztra", TERRITORY_IN_MH, 0x00200000},
+#endif
+        {"maine", TERRITORY_US_ME, 0x0bbce7f1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PL)
+        {"majotta", TERRITORY_MYT, 0x00200000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR) || defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"makao", TERRITORY_MAC, 0x02002000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PL)
+        {"makau", TERRITORY_MAC, 0x00200000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FI) || defined(MAPCODE_SUPPORT_LANGUAGE_ID) || defined(MAPCODE_SUPPORT_LANGUAGE_NO) || defined(MAPCODE_SUPPORT_LANGUAGE_SW)
+        {"makedonia", TERRITORY_MKD, 0x01084200},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CS)
+        {"makedonie", TERRITORY_MKD, 0x00000010},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DA) || defined(MAPCODE_SUPPORT_LANGUAGE_SV)
+        {"makedonien", TERRITORY_MKD, 0x00800020},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"makedonija", TERRITORY_MKD, 0x00002000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"makedonya", TERRITORY_MKD, 0x02000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ID)
+        {"maladewa", TERRITORY_MDV, 0x00004000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FR)
+        {"malaisie", TERRITORY_MYS, 0x00000400},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CS)
+        {"malajsie", TERRITORY_MYS, 0x00000010},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ES) || defined(MAPCODE_SUPPORT_LANGUAGE_PT)
+        {"malasia", TERRITORY_MYS, 0x00100100},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR) || defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"malavi", TERRITORY_MWI, 0x02002000},
+#endif
+        {"malawi", TERRITORY_MWI, 0x09bcc7f1},
+        {"malaysia", TERRITORY_MYS, 0x0988c0e0},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ES) || defined(MAPCODE_SUPPORT_LANGUAGE_PT)
+        {"maldivas", TERRITORY_MDV, 0x00100100},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_IT)
+        {"maldive", TERRITORY_MDV, 0x00008000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_NO)
+        {"maldivene", TERRITORY_MDV, 0x00080000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_SV)
+        {"maldiverna", TERRITORY_MDV, 0x00800000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DA)
+        {"maldiverne", TERRITORY_MDV, 0x00000020},
+#endif
+        {"maldives", TERRITORY_MDV, 0x01000481},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"maldivi", TERRITORY_MDV, 0x00002000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"maldivler", TERRITORY_MDV, 0x02000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FI)
+        {"malediivit", TERRITORY_MDV, 0x00000200},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DE) || defined(MAPCODE_SUPPORT_LANGUAGE_NL)
+        {"malediven", TERRITORY_MDV, 0x00040040},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CS)
+        {"maledivy", TERRITORY_MDV, 0x00000010},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PL)
+        {"malediwy", TERRITORY_MDV, 0x00200000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AF) || defined(MAPCODE_SUPPORT_LANGUAGE_NL)
+        {"maleisie", TERRITORY_MYS, 0x00040001},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FI)
+        {"malesia", TERRITORY_MYS, 0x00000200},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"malezija", TERRITORY_MYS, 0x00002000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PL)
+        {"malezja", TERRITORY_MYS, 0x00200000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"malezya", TERRITORY_MYS, 0x02000000},
+#endif
+        {"mali", TERRITORY_MLI, 0x0bbce7f1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"mali udaljeni otoci sad-a", TERRITORY_UMI, 0x00002000},
+#endif
+        {"malta", TERRITORY_MLT, 0x0bbce3f1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FR)
+        {"malte", TERRITORY_MLT, 0x00000400},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"man adası", TERRITORY_IMN, 0x02000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PL)
+        {"man, wyspa", TERRITORY_IMN, 0x00200000},
+#endif
+        {"manipur", TERRITORY_IN_MN, 0x03bce7f1},
+        {"manitoba", TERRITORY_CA_MB, 0x0bbce7f1},
+        {"mann", TERRITORY_IMN, 0x08040080},
+        {"mannin", TERRITORY_IMN, 0x08000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FI)
+        {"mansaari", TERRITORY_IMN, 0x00000200},
+#endif
+        {"maore", TERRITORY_MYT, 0x08000080},
+        {"mar", TERRITORY_MAR, 0x10000000},
+        {"maranhao", TERRITORY_BR_MA, 0x0bbce6f1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ES)
+        {"maranon", TERRITORY_BR_MA, 0x00000100},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_SW)
+        {"marekani", TERRITORY_USA, 0x01000000},
+        {"marekani ndogo visiwa outlying", TERRITORY_UMI, 0x01000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"mari el cumhuriyeti", TERRITORY_RU_ME, 0x02000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_SW)
+        {"mari el jamhuri", TERRITORY_RU_ME, 0x01000000},
+#endif
+        {"mari el republic", TERRITORY_RU_ME, 0x0090c180},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AF)
+        {"mari el republiek", TERRITORY_RU_ME, 0x00000001},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DA)
+        {"mari el republik", TERRITORY_RU_ME, 0x00000020},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CS) || defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"mari el republika", TERRITORY_RU_ME, 0x00002010},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_NO)
+        {"mari el republikk", TERRITORY_RU_ME, 0x00080000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PT)
+        {"marianas setentrionais", TERRITORY_MNP, 0x00100000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PL)
+        {"mariany połnocne", TERRITORY_MNP, 0x00200000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FI)
+        {"marin tasavallan", TERRITORY_RU_ME, 0x00000200},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FR)
+        {"maroc", TERRITORY_MAR, 0x00000400},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_IT)
+        {"marocco", TERRITORY_MAR, 0x00008000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_SV)
+        {"marocko", TERRITORY_MAR, 0x00800000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AF) || defined(MAPCODE_SUPPORT_LANGUAGE_DA) || defined(MAPCODE_SUPPORT_LANGUAGE_DE) || defined(MAPCODE_SUPPORT_LANGUAGE_FI) || defined(MAPCODE_SUPPORT_LANGUAGE_NL) || defined(MAPCODE_SUPPORT_LANGUAGE_NO)
+        {"marokko", TERRITORY_MAR, 0x000c0261},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CS) || defined(MAPCODE_SUPPORT_LANGUAGE_HR) || defined(MAPCODE_SUPPORT_LANGUAGE_ID) || defined(MAPCODE_SUPPORT_LANGUAGE_PL)
+        {"maroko", TERRITORY_MAR, 0x00206010},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PT)
+        {"marrocos", TERRITORY_MAR, 0x00100000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ES)
+        {"marruecos", TERRITORY_MAR, 0x00000100},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"marsal adaları", TERRITORY_MHL, 0x02000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"marsalovi otoci", TERRITORY_MHL, 0x00002000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_NL)
+        {"marshall eilanden", TERRITORY_MHL, 0x00040000},
+#endif
+        {"marshall islands", TERRITORY_MHL, 0x08000080},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AF)
+        {"marshall-eilande", TERRITORY_MHL, 0x00000001},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DE)
+        {"marshall-inseln", TERRITORY_MHL, 0x00000040},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PL)
+        {"marshalla, wyspy", TERRITORY_MHL, 0x00200000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FI)
+        {"marshallinsaaret", TERRITORY_MHL, 0x00000200},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_SV)
+        {"marshalloarna", TERRITORY_MHL, 0x00800000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CS)
+        {"marshallovy ostrovy", TERRITORY_MHL, 0x00000010},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DA)
+        {"marshalløerne", TERRITORY_MHL, 0x00000020},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_NO)
+        {"marshalløyene", TERRITORY_MHL, 0x00080000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ES) || defined(MAPCODE_SUPPORT_LANGUAGE_IT) || defined(MAPCODE_SUPPORT_LANGUAGE_PT)
+        {"martinica", TERRITORY_MTQ, 0x00108100},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CS) || defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"martinik", TERRITORY_MTQ, 0x02000010},
+#endif
+        {"martinique", TERRITORY_MTQ, 0x098c66e1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PL)
+        {"martynika", TERRITORY_MTQ, 0x00200000},
+#endif
+        {"maryland", TERRITORY_US_MD, 0x0bbce7f1},
+        {"massachusetts", TERRITORY_US_MA, 0x0bbce7f1},
+        {"mato grosso", TERRITORY_BR_MT, 0x09bce7f1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"mato grosso do", TERRITORY_BR_MT, 0x02000000},
+#endif
+        {"mato grosso do sul", TERRITORY_BR_MS, 0x0bbce7f1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PL)
+        {"mauretania", TERRITORY_MRT, 0x00200000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DA) || defined(MAPCODE_SUPPORT_LANGUAGE_DE) || defined(MAPCODE_SUPPORT_LANGUAGE_SV)
+        {"mauretanien", TERRITORY_MRT, 0x00800060},
+#endif
+        {"maurice", TERRITORY_MUS, 0x08000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"mauricijus", TERRITORY_MUS, 0x00002000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ES) || defined(MAPCODE_SUPPORT_LANGUAGE_PT)
+        {"mauricio", TERRITORY_MUS, 0x00100100},
+#endif
+        {"mauritania", TERRITORY_MRT, 0x0118c380},
+        {"mauritanie", TERRITORY_MRT, 0x08040411},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"mauritanija", TERRITORY_MRT, 0x00002000},
+#endif
+        {"mauritius", TERRITORY_MUS, 0x03acc2f1},
+        {"mayotte", TERRITORY_MYT, 0x0b9ce7f1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DE)
+        {"mazedonien", TERRITORY_MKD, 0x00000040},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"mađarska", TERRITORY_HUN, 0x00002000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"mcdonald adaları", TERRITORY_HMD, 0x02000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AF)
+        {"mcdonald eilande", TERRITORY_HMD, 0x00000001},
+#endif
+        {"mcdonald islands", TERRITORY_HMD, 0x080440a0},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_SV)
+        {"mcdonald oar", TERRITORY_HMD, 0x00800000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CS)
+        {"mcdonald ostrovy", TERRITORY_HMD, 0x00000010},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_SW)
+        {"mcdonald visiwa", TERRITORY_HMD, 0x01000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DE)
+        {"mcdonald-inseln", TERRITORY_HMD, 0x00000040},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FI)
+        {"mcdonald-saaret", TERRITORY_HMD, 0x00000200},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PL)
+        {"mcdonalda, wyspy", TERRITORY_HMD, 0x00200000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_NO)
+        {"mcdonaldøyene", TERRITORY_HMD, 0x00080000},
+#endif
+        {"mco", TERRITORY_MCO, 0x10000000},
+        {"mda", TERRITORY_MDA, 0x10000000},
+        {"mdg", TERRITORY_MDG, 0x10000000},
+        {"mdv", TERRITORY_MDV, 0x10000000},
+        {"megahalaya", TERRITORY_IN_ML, 0x08000000},
+        {"meghalaya", TERRITORY_IN_ML, 0x03bce7f1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ES)
+        {"mejico", TERRITORY_MEX, 0x00000100},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"meksika", TERRITORY_MEX, 0x02000000},
+        {"meksika devlet", TERRITORY_MX_MX, 0x02000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FI) || defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"meksiko", TERRITORY_MEX, 0x00002200},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"meksiko, drzava", TERRITORY_MX_MX, 0x00002000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PL)
+        {"meksyk", TERRITORY_MEX, 0x00200000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ID)
+        {"menculik", TERRITORY_CN_SH, 0x00004000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CS)
+        {"mensi americke odlehle ostrovy", TERRITORY_UMI, 0x00000010},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ID)
+        {"mesir", TERRITORY_EGY, 0x00004000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_IT)
+        {"messico", TERRITORY_MEX, 0x00008000},
+#endif
+        {"mex", TERRITORY_MEX, 0x10000000},
+        {"mexico", TERRITORY_MEX, 0x099c40a0},
+        {"mexico", TERRITORY_MX_MX, 0x08000000},
+        {"mexico city", TERRITORY_MX_DIF, 0x08000000},
+        {"mexico state", TERRITORY_MX_MX, 0x01ac42f0},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PT)
+        {"mexico, estado do", TERRITORY_MX_MX, 0x00100000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AF) || defined(MAPCODE_SUPPORT_LANGUAGE_CS) || defined(MAPCODE_SUPPORT_LANGUAGE_DE)
+        {"mexiko", TERRITORY_MEX, 0x00000051},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AF)
+        {"mexiko", TERRITORY_MX_MX, 0x00000001},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FR)
+        {"mexique", TERRITORY_MEX, 0x00000400},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CS)
+        {"mezinarodni", TERRITORY_AAA, 0x00000010},
+#endif
+        {"mhl", TERRITORY_MHL, 0x10000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR) || defined(MAPCODE_SUPPORT_LANGUAGE_PT)
+        {"mianmar", TERRITORY_MMR, 0x00102000},
+#endif
+        {"michigan", TERRITORY_US_MI, 0x0bbce7f1},
+        {"michoacan", TERRITORY_MX_MIC, 0x0bbce7f1},
+        {"michoacan de ocampo", TERRITORY_MX_MIC, 0x08000000},
+        {"micronesia", TERRITORY_FSM, 0x091481e0},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FR)
+        {"micronesie", TERRITORY_FSM, 0x00000400},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"mikelon", TERRITORY_SPM, 0x00002000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FI) || defined(MAPCODE_SUPPORT_LANGUAGE_ID)
+        {"mikronesia", TERRITORY_FSM, 0x00004200},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_NO)
+        {"mikronesiaføderasjonen", TERRITORY_FSM, 0x00080000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AF) || defined(MAPCODE_SUPPORT_LANGUAGE_CS)
+        {"mikronesie", TERRITORY_FSM, 0x00000011},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_SV)
+        {"mikronesiska federationen", TERRITORY_FSM, 0x00800000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"mikronezija", TERRITORY_FSM, 0x00002000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PL)
+        {"mikronezja", TERRITORY_FSM, 0x00200000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"mikronezya federal devletleri", TERRITORY_FSM, 0x02000000},
+#endif
+        {"minas gerais", TERRITORY_BR_MG, 0x0bbce7f1},
+        {"minnesota", TERRITORY_US_MN, 0x0bbce7f1},
+        {"miquelon", TERRITORY_SPM, 0x039cc7f1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ES) || defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"misisipi", TERRITORY_US_MS, 0x00002100},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_SW)
+        {"misri", TERRITORY_EGY, 0x01000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PL)
+        {"missisipi", TERRITORY_US_MS, 0x00200000},
+#endif
+        {"mississippi", TERRITORY_US_MS, 0x0b9cc6f1},
+        {"missouri", TERRITORY_US_MO, 0x0bbce6f1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ES)
+        {"misuri", TERRITORY_US_MO, 0x00000100},
+#endif
+        {"mizoram", TERRITORY_IN_MZ, 0x0bbce7f1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PL)
+        {"mjanma", TERRITORY_MMR, 0x00200000},
+#endif
+        {"mkd", TERRITORY_MKD, 0x10000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_SW)
+        {"mkuu wa uingereza", TERRITORY_GBR, 0x01000000},
+#endif
+        {"mli", TERRITORY_MLI, 0x10000000},
+        {"mlt", TERRITORY_MLT, 0x10000000},
+        {"mmr", TERRITORY_MMR, 0x10000000},
+        {"mne", TERRITORY_MNE, 0x10000000},
+        {"mng", TERRITORY_MNG, 0x10000000},
+        {"mnp", TERRITORY_MNP, 0x10000000},
+        {"mocambique", TERRITORY_MOZ, 0x08900000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AF)
+        {"moermansk oblast", TERRITORY_RU_MUR, 0x00000001},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"mogolistan", TERRITORY_MNG, 0x02000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ES) || defined(MAPCODE_SUPPORT_LANGUAGE_PT)
+        {"moldavia", TERRITORY_MDA, 0x00100100},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FR) || defined(MAPCODE_SUPPORT_LANGUAGE_NL)
+        {"moldavie", TERRITORY_MDA, 0x00040400},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_SV)
+        {"moldavien", TERRITORY_MDA, 0x00800000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"moldavija", TERRITORY_MDA, 0x00002000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CS)
+        {"moldavsko", TERRITORY_MDA, 0x00000010},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AF)
+        {"moldawie", TERRITORY_MDA, 0x00000001},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DE)
+        {"moldawien", TERRITORY_MDA, 0x00000040},
+#endif
+        {"moldova", TERRITORY_MDA, 0x0b08c2a0},
+        {"monaco", TERRITORY_MCO, 0x099c87f1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR) || defined(MAPCODE_SUPPORT_LANGUAGE_ID) || defined(MAPCODE_SUPPORT_LANGUAGE_PL) || defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"monako", TERRITORY_MCO, 0x02206000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FR)
+        {"monde", TERRITORY_AAA, 0x00000400},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DE)
+        {"mongolei", TERRITORY_MNG, 0x00000040},
+#endif
+        {"mongolia", TERRITORY_MNG, 0x0138c380},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ID)
+        {"mongolia dalam", TERRITORY_CN_NM, 0x00004000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ES) || defined(MAPCODE_SUPPORT_LANGUAGE_PT)
+        {"mongolia interior", TERRITORY_CN_NM, 0x00100100},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_IT)
+        {"mongolia interna", TERRITORY_CN_NM, 0x00008000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PL)
+        {"mongolia wewnetrzna", TERRITORY_CN_NM, 0x00200000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AF) || defined(MAPCODE_SUPPORT_LANGUAGE_FR) || defined(MAPCODE_SUPPORT_LANGUAGE_NL)
+        {"mongolie", TERRITORY_MNG, 0x00040401},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FR)
+        {"mongolie-interieure", TERRITORY_CN_NM, 0x00000400},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DA) || defined(MAPCODE_SUPPORT_LANGUAGE_SV)
+        {"mongoliet", TERRITORY_MNG, 0x00800020},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"mongolija", TERRITORY_MNG, 0x00002000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CS)
+        {"mongolsko", TERRITORY_MNG, 0x00000010},
+#endif
+        {"montana", TERRITORY_US_MT, 0x0bbce7f1},
+        {"montenegro", TERRITORY_MNE, 0x011cc7e1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_SV)
+        {"monte~~pos=trunc", TERRITORY_MNE, 0x00800000},
+#endif
+        {"montserrat", TERRITORY_MSR, 0x0bbce7f1},
+        {"mordovia republic", TERRITORY_RU_MO, 0x018000c0},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AF)
+        {"mordovia republiek", TERRITORY_RU_MO, 0x00000001},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ID)
+        {"mordovia republik", TERRITORY_RU_MO, 0x00004000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_NO)
+        {"mordovia republikk", TERRITORY_RU_MO, 0x00080000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CS)
+        {"mordovie republic", TERRITORY_RU_MO, 0x00000010},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_NL)
+        {"mordovie republiek", TERRITORY_RU_MO, 0x00040000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DA)
+        {"mordovien republik", TERRITORY_RU_MO, 0x00000020},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"mordovya cumhuriyeti", TERRITORY_RU_MO, 0x02000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FI)
+        {"mordvan tasavalta", TERRITORY_RU_MO, 0x00000200},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"mordvinska republika", TERRITORY_RU_MO, 0x00002000},
+#endif
+        {"morelos", TERRITORY_MX_MOR, 0x0bbce7f1},
+        {"moris", TERRITORY_MUS, 0x08000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"moritanya", TERRITORY_MRT, 0x02000000},
+#endif
+        {"morocco", TERRITORY_MAR, 0x09000080},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AF)
+        {"mosambiek", TERRITORY_MOZ, 0x00000001},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CS) || defined(MAPCODE_SUPPORT_LANGUAGE_DE) || defined(MAPCODE_SUPPORT_LANGUAGE_FI) || defined(MAPCODE_SUPPORT_LANGUAGE_NO)
+        {"mosambik", TERRITORY_MOZ, 0x00080250},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_IT)
+        {"mosca", TERRITORY_RU_MOW, 0x00008000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FR) || defined(MAPCODE_SUPPORT_LANGUAGE_PT)
+        {"moscou", TERRITORY_RU_MOW, 0x00100400},
+#endif
+        {"moscow", TERRITORY_RU_MOW, 0x01000080},
+        {"moscow oblast", TERRITORY_RU_MOS, 0x0388c080},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ES)
+        {"moscu", TERRITORY_RU_MOW, 0x00000100},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DE)
+        {"moskau", TERRITORY_RU_MOW, 0x00000040},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AF) || defined(MAPCODE_SUPPORT_LANGUAGE_NL)
+        {"moskou", TERRITORY_RU_MOW, 0x00040001},
+        {"moskou oblast", TERRITORY_RU_MOS, 0x00040001},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FI) || defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"moskova", TERRITORY_RU_MOW, 0x02000200},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FI)
+        {"moskovan", TERRITORY_RU_MOS, 0x00000200},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"moskovska oblast", TERRITORY_RU_MOS, 0x00002000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ID)
+        {"moskow", TERRITORY_RU_MOW, 0x00004000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CS) || defined(MAPCODE_SUPPORT_LANGUAGE_DA) || defined(MAPCODE_SUPPORT_LANGUAGE_HR) || defined(MAPCODE_SUPPORT_LANGUAGE_NO) || defined(MAPCODE_SUPPORT_LANGUAGE_SV)
+        {"moskva", TERRITORY_RU_MOW, 0x00882030},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CS) || defined(MAPCODE_SUPPORT_LANGUAGE_DA)
+        {"moskva oblast", TERRITORY_RU_MOS, 0x00000030},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PL)
+        {"moskwa", TERRITORY_RU_MOW, 0x00200000},
+#endif
+        {"moz", TERRITORY_MOZ, 0x10000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_IT)
+        {"mozambico", TERRITORY_MOZ, 0x00008000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR) || defined(MAPCODE_SUPPORT_LANGUAGE_ID) || defined(MAPCODE_SUPPORT_LANGUAGE_PL) || defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"mozambik", TERRITORY_MOZ, 0x02206000},
+#endif
+        {"mozambique", TERRITORY_MOZ, 0x000405a0},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PL)
+        {"mołdawia", TERRITORY_MDA, 0x00200000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AF)
+        {"mpumalanga", TERRITORY_CN_JX, 0x00000001},
+#endif
+        {"mrt", TERRITORY_MRT, 0x10000000},
+        {"msr", TERRITORY_MSR, 0x10000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_SW)
+        {"msumbiji", TERRITORY_MOZ, 0x01000000},
+        {"mtakatifu lucia", TERRITORY_LCA, 0x01000000},
+#endif
+        {"mtq", TERRITORY_MTQ, 0x10000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ES)
+        {"mundial", TERRITORY_AAA, 0x00000100},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PT)
+        {"mundo", TERRITORY_AAA, 0x00100000},
+#endif
+        {"muritanya", TERRITORY_MRT, 0x08000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_SV)
+        {"murmansk", TERRITORY_RU_MUR, 0x00800000},
+#endif
+        {"murmansk oblast", TERRITORY_RU_MUR, 0x033cc1f0},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"murmanska oblast", TERRITORY_RU_MUR, 0x00002000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FI)
+        {"murmanskin alue", TERRITORY_RU_MUR, 0x00000200},
+#endif
+        {"mus", TERRITORY_MUS, 0x10000000},
+        {"mwi", TERRITORY_MWI, 0x10000000},
+        {"mx-agu", TERRITORY_MX_AGU, 0x10000000},
+        {"mx-bcn", TERRITORY_MX_BCN, 0x10000000},
+        {"mx-bcs", TERRITORY_MX_BCS, 0x10000000},
+        {"mx-cam", TERRITORY_MX_CAM, 0x10000000},
+        {"mx-chh", TERRITORY_MX_CHH, 0x10000000},
+        {"mx-chp", TERRITORY_MX_CHP, 0x10000000},
+        {"mx-cl", TERRITORY_MX_CL, 0x10000000},
+        {"mx-coa", TERRITORY_MX_COA, 0x10000000},
+        {"mx-dif", TERRITORY_MX_DIF, 0x10000000},
+        {"mx-dur", TERRITORY_MX_DUR, 0x10000000},
+        {"mx-gro", TERRITORY_MX_GRO, 0x10000000},
+        {"mx-gua", TERRITORY_MX_GUA, 0x10000000},
+        {"mx-hid", TERRITORY_MX_HID, 0x10000000},
+        {"mx-jal", TERRITORY_MX_JAL, 0x10000000},
+        {"mx-mic", TERRITORY_MX_MIC, 0x10000000},
+        {"mx-mor", TERRITORY_MX_MOR, 0x10000000},
+        {"mx-mx", TERRITORY_MX_MX, 0x10000000},
+        {"mx-nay", TERRITORY_MX_NAY, 0x10000000},
+        {"mx-nle", TERRITORY_MX_NLE, 0x10000000},
+        {"mx-oax", TERRITORY_MX_OAX, 0x10000000},
+        {"mx-pue", TERRITORY_MX_PUE, 0x10000000},
+        {"mx-que", TERRITORY_MX_QUE, 0x10000000},
+        {"mx-roo", TERRITORY_MX_ROO, 0x10000000},
+        {"mx-sin", TERRITORY_MX_SIN, 0x10000000},
+        {"mx-slp", TERRITORY_MX_SLP, 0x10000000},
+        {"mx-son", TERRITORY_MX_SON, 0x10000000},
+        {"mx-tab", TERRITORY_MX_TAB, 0x10000000},
+        {"mx-tam", TERRITORY_MX_TAM, 0x10000000},
+        {"mx-tla", TERRITORY_MX_TLA, 0x10000000},
+        {"mx-ver", TERRITORY_MX_VER, 0x10000000},
+        {"mx-yuc", TERRITORY_MX_YUC, 0x10000000},
+        {"mx-zac", TERRITORY_MX_ZAC, 0x10000000},
+        {"myanmar", TERRITORY_MMR, 0x0b8cc7f1},
+        {"mys", TERRITORY_MYS, 0x10000000},
+        {"myt", TERRITORY_MYT, 0x10000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"mısır", TERRITORY_EGY, 0x02000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PL)
+        {"nadmorskim", TERRITORY_RU_PO, 0x00200000},
+#endif
+        {"nagaland", TERRITORY_IN_NL, 0x0bbce7f1},
+        {"nagar haveli", TERRITORY_IN_DN, 0x00000080},
+        {"naijiria", TERRITORY_NGA, 0x08000000},
+        {"naijiriya", TERRITORY_NGA, 0x08000000},
+        {"nam", TERRITORY_NAM, 0x10000000},
+        {"namibia", TERRITORY_NAM, 0x09b8c3e0},
+        {"namibie", TERRITORY_NAM, 0x08040411},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"namibija", TERRITORY_NAM, 0x00002000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"namibya", TERRITORY_NAM, 0x02000000},
+#endif
+        {"naoero", TERRITORY_NRU, 0x08000000},
+        {"nauru", TERRITORY_NRU, 0x03bce7f1},
+        {"nayarit", TERRITORY_MX_NAY, 0x0bbce7f1},
+        {"ncl", TERRITORY_NCL, 0x10000000},
+        {"nebraska", TERRITORY_US_NE, 0x0bbce7f1},
+        {"nederland", TERRITORY_NLD, 0x080c0001},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_SV)
+        {"nederlanderna", TERRITORY_NLD, 0x00800000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ID)
+        {"negara federasi mikronesia", TERRITORY_FSM, 0x00004000},
+#endif
+        {"nei mongol", TERRITORY_CN_NM, 0x03bce3f1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CS)
+        {"nemecko", TERRITORY_DEU, 0x00000010},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"nenecki autonomni okrug", TERRITORY_RU_NEN, 0x00002000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CS)
+        {"nenecky autonomni okruh", TERRITORY_RU_NEN, 0x00000010},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ES)
+        {"nenets autonoma okrug", TERRITORY_RU_NEN, 0x00000100},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DA) || defined(MAPCODE_SUPPORT_LANGUAGE_NL)
+        {"nenets autonome okrug", TERRITORY_RU_NEN, 0x00040020},
+#endif
+        {"nenets autonomous okrug", TERRITORY_RU_NEN, 0x01100080},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AF)
+        {"nenets outonome okrug", TERRITORY_RU_NEN, 0x00000001},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"nenets ozerk okrugu", TERRITORY_RU_NEN, 0x02000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ID)
+        {"nenetsia", TERRITORY_RU_NEN, 0x00004000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FI)
+        {"nenetsiassa", TERRITORY_RU_NEN, 0x00000200},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_NO)
+        {"nenetsk", TERRITORY_RU_NEN, 0x00080000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_SV)
+        {"nentsien", TERRITORY_RU_NEN, 0x00800000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DE)
+        {"nenzen", TERRITORY_RU_NEN, 0x00000040},
+#endif
+        {"nepal", TERRITORY_NPL, 0x0bbce7f1},
+        {"ner", TERRITORY_NER, 0x10000000},
+        {"netherlands", TERRITORY_NLD, 0x00000080},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DE)
+        {"neukaledonien", TERRITORY_NCL, 0x00000040},
+        {"neuseeland", TERRITORY_NZL, 0x00000040},
+#endif
+        {"nevada", TERRITORY_US_NV, 0x0bbce7f1},
+        {"nevis", TERRITORY_KNA, 0x039ce3f1},
+        {"new brunswick", TERRITORY_CA_NB, 0x098ce2e1},
+        {"new caledonia", TERRITORY_NCL, 0x00040081},
+        {"new hampshire", TERRITORY_US_NH, 0x0bace6f1},
+        {"new jersey", TERRITORY_US_NJ, 0x0bace7f1},
+        {"new leon", TERRITORY_MX_NLE, 0x00000080},
+        {"new mexico", TERRITORY_US_NM, 0x0b8c42e1},
+        {"new south wales", TERRITORY_AU_NSW, 0x098c62e1},
+        {"new york", TERRITORY_US_NY, 0x0b8ce6f1},
+        {"new zealand", TERRITORY_NZL, 0x010000a0},
+        {"newfoundland", TERRITORY_CA_NL, 0x038c42e1},
+        {"newfoundland and labrador", TERRITORY_CA_NL, 0x08000080},
+        {"nfk", TERRITORY_NFK, 0x10000000},
+        {"nga", TERRITORY_NGA, 0x10000000},
+        {"nic", TERRITORY_NIC, 0x10000000},
+        {"nicaragua", TERRITORY_NIC, 0x099c87e1},
+        {"nicobar", TERRITORY_IN_AN, 0x00000080},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DE)
+        {"niederlande", TERRITORY_NLD, 0x00000040},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PL)
+        {"niemcy", TERRITORY_DEU, 0x00200000},
+        {"nieniecki okreg autonomiczny", TERRITORY_RU_NEN, 0x00200000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AF)
+        {"nieu-seeland", TERRITORY_NZL, 0x00000001},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_NL)
+        {"nieuw-zeeland", TERRITORY_NZL, 0x00040000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FR)
+        {"nieves", TERRITORY_KNA, 0x00000400},
+#endif
+        {"niger", TERRITORY_NER, 0x09bce7f1},
+        {"nigeria", TERRITORY_NGA, 0x01bcc7e0},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AF) || defined(MAPCODE_SUPPORT_LANGUAGE_CS)
+        {"nigerie", TERRITORY_NGA, 0x00000011},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"nigerija", TERRITORY_NGA, 0x00002000},
+#endif
+        {"nihon", TERRITORY_JPN, 0x08000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"nijer", TERRITORY_NER, 0x02000000},
+#endif
+        {"nijeriya", TERRITORY_NGA, 0x08000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"nijerya", TERRITORY_NGA, 0x02000000},
+        {"nijniy novgorod oblastı", TERRITORY_RU_NIZ, 0x02000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CS) || defined(MAPCODE_SUPPORT_LANGUAGE_ID) || defined(MAPCODE_SUPPORT_LANGUAGE_PL) || defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"nikaragua", TERRITORY_NIC, 0x02204010},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"nikaragva", TERRITORY_NIC, 0x00002000},
+#endif
+        {"ningxia hui", TERRITORY_CN_NX, 0x03bce3f1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FR)
+        {"nioue", TERRITORY_NIU, 0x00000400},
+#endif
+        {"nippon", TERRITORY_JPN, 0x08000000},
+        {"niu", TERRITORY_NIU, 0x10000000},
+        {"niue", TERRITORY_NIU, 0x0bbce3f1},
+        {"nizhny novgorod oblast", TERRITORY_RU_NIZ, 0x019cc0e0},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AF)
+        {"nizjni nowgorod oblast", TERRITORY_RU_NIZ, 0x00000001},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CS)
+        {"niznenovgorodska oblast", TERRITORY_RU_NIZ, 0x00000010},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FI)
+        {"nizni novgorodin alue", TERRITORY_RU_NIZ, 0x00000200},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"niznjenovgorodska oblast", TERRITORY_RU_NIZ, 0x00002000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CS)
+        {"nizozemi", TERRITORY_NLD, 0x00000010},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"nizozemska", TERRITORY_NLD, 0x00002000},
+        {"njemacka", TERRITORY_DEU, 0x00002000},
+        {"njufaundlend", TERRITORY_CA_NL, 0x00002000},
+#endif
+        {"nld", TERRITORY_NLD, 0x10000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"noel adası", TERRITORY_CXR, 0x02000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_NL)
+        {"noord ierland", TERRITORY_GBR, 0x00040000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AF)
+        {"noord mariana eilande", TERRITORY_MNP, 0x00000001},
+        {"noord-carolina", TERRITORY_US_NC, 0x00000001},
+        {"noord-ierland", TERRITORY_GBR, 0x00000001},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AF) || defined(MAPCODE_SUPPORT_LANGUAGE_NL)
+        {"noord-korea", TERRITORY_PRK, 0x00040001},
+        {"noord-ossetie-alania republiek", TERRITORY_RU_SE, 0x00040001},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AF)
+        {"noorwee", TERRITORY_NOR, 0x00000001},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_NL)
+        {"noorwegen", TERRITORY_NOR, 0x00040000},
+#endif
+        {"nor", TERRITORY_NOR, 0x10000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_NO)
+        {"nord-carolina", TERRITORY_US_NC, 0x00080000},
+        {"nord-dakota", TERRITORY_US_ND, 0x00080000},
+        {"nord-irland", TERRITORY_GBR, 0x00080000},
+        {"nord-korea", TERRITORY_PRK, 0x00080000},
+        {"nord-marianene", TERRITORY_MNP, 0x00080000},
+        {"nord-ossetia republikk", TERRITORY_RU_SE, 0x00080000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_SV)
+        {"nordirland", TERRITORY_GBR, 0x00800000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DA) || defined(MAPCODE_SUPPORT_LANGUAGE_DE) || defined(MAPCODE_SUPPORT_LANGUAGE_SV)
+        {"nordkorea", TERRITORY_PRK, 0x00800060},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DE)
+        {"nordliche marianen", TERRITORY_MNP, 0x00000040},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_SV)
+        {"nordmarianerna", TERRITORY_MNP, 0x00800000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DA)
+        {"nordmarianerne", TERRITORY_MNP, 0x00000020},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_SV)
+        {"nordossetien republiken", TERRITORY_RU_SE, 0x00800000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DE)
+        {"nordossetien-alania republic", TERRITORY_RU_SE, 0x00000040},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DA)
+        {"nordossetien-alania republik", TERRITORY_RU_SE, 0x00000020},
+#endif
+        {"noreg", TERRITORY_NOR, 0x08000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PL)
+        {"norfolk", TERRITORY_NFK, 0x00200000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CS)
+        {"norfolk a philip island", TERRITORY_NFK, 0x00000010},
+#endif
+        {"norfolk and philip island", TERRITORY_NFK, 0x00000080},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ID)
+        {"norfolk dan philip island", TERRITORY_NFK, 0x00004000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_IT)
+        {"norfolk e phillip island", TERRITORY_NFK, 0x00008000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AF) || defined(MAPCODE_SUPPORT_LANGUAGE_NL)
+        {"norfolk en philip island", TERRITORY_NFK, 0x00040001},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FR)
+        {"norfolk et phillip island", TERRITORY_NFK, 0x00000400},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"norfolk i filip otoci", TERRITORY_NFK, 0x00002000},
+#endif
+        {"norfolk island", TERRITORY_NFK, 0x08000080},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FI)
+        {"norfolk ja philip island", TERRITORY_NFK, 0x00000200},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_SW)
+        {"norfolk na philip island", TERRITORY_NFK, 0x01000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_SV)
+        {"norfolk och philip island", TERRITORY_NFK, 0x00800000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DA)
+        {"norfolk og philip island", TERRITORY_NFK, 0x00000020},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"norfolk ve philip island", TERRITORY_NFK, 0x02000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ES)
+        {"norfolk y phillip island", TERRITORY_NFK, 0x00000100},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DE)
+        {"norfolkinsel", TERRITORY_NFK, 0x00000040},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_NO)
+        {"norfolkøya", TERRITORY_NFK, 0x00080000},
+#endif
+        {"norge", TERRITORY_NOR, 0x08880020},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FI)
+        {"norja", TERRITORY_NOR, 0x00000200},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_SV)
+        {"norra carolina", TERRITORY_US_NC, 0x00800000},
+        {"norra dakota", TERRITORY_US_ND, 0x00800000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CS)
+        {"norsko", TERRITORY_NOR, 0x00000010},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FI)
+        {"norsunluurannikko", TERRITORY_CIV, 0x00000200},
+#endif
+        {"north carolina", TERRITORY_US_NC, 0x0b0440e0},
+        {"north dakota", TERRITORY_US_ND, 0x0b0442e1},
+        {"north korea", TERRITORY_PRK, 0x00000080},
+        {"north ossetia-alania republic", TERRITORY_RU_SE, 0x00000080},
+        {"northern ireland", TERRITORY_GBR, 0x01000080},
+        {"northern mariana islands", TERRITORY_MNP, 0x00040080},
+        {"northern territory", TERRITORY_AU_NT, 0x0a8c22f1},
+        {"northwest territories", TERRITORY_CA_NT, 0x098c60e1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ES) || defined(MAPCODE_SUPPORT_LANGUAGE_PT)
+        {"noruega", TERRITORY_NOR, 0x00100100},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"norvec", TERRITORY_NOR, 0x02000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FR)
+        {"norvege", TERRITORY_NOR, 0x00000400},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_IT)
+        {"norvegia", TERRITORY_NOR, 0x00008000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"norveska", TERRITORY_NOR, 0x00002000},
+#endif
+        {"norway", TERRITORY_NOR, 0x01004080},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DE)
+        {"norwegen", TERRITORY_NOR, 0x00000040},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PL)
+        {"norwegia", TERRITORY_NOR, 0x00200000},
+#endif
+        {"nouveau-brunswick", TERRITORY_CA_NB, 0x08000400},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FR)
+        {"nouveau-mexique", TERRITORY_US_NM, 0x00000400},
+#endif
+        {"nouvelle-caledonie", TERRITORY_NCL, 0x08000400},
+        {"nouvelle-ecosse", TERRITORY_CA_NS, 0x08000400},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FR)
+        {"nouvelle-galles du sud", TERRITORY_AU_NSW, 0x00000400},
+        {"nouvelle-zelande", TERRITORY_NZL, 0x00000400},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PT)
+        {"nova caledonia", TERRITORY_NCL, 0x00100000},
+        {"nova escocia", TERRITORY_CA_NS, 0x00100000},
+        {"nova gales do sul", TERRITORY_AU_NSW, 0x00100000},
+        {"nova hampshire", TERRITORY_US_NH, 0x00100000},
+        {"nova iorque", TERRITORY_US_NY, 0x00100000},
+        {"nova jersei", TERRITORY_US_NJ, 0x00100000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CS)
+        {"nova kaledonie", TERRITORY_NCL, 0x00000010},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"nova kaledonija", TERRITORY_NCL, 0x00002000},
+#endif
+        {"nova scotia", TERRITORY_CA_NS, 0x0b8c42e1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"nova skotska", TERRITORY_CA_NS, 0x00002000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PT)
+        {"nova zelandia", TERRITORY_NZL, 0x00100000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CS)
+        {"nove mexiko", TERRITORY_US_NM, 0x00000010},
+        {"nove skotsko", TERRITORY_CA_NS, 0x00000010},
+#endif
+        {"novgorod oblast", TERRITORY_RU_NGR, 0x03ace0f0},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FI)
+        {"novgorodin alue", TERRITORY_RU_NGR, 0x00000200},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"novi juzni wales", TERRITORY_AU_NSW, 0x00002000},
+        {"novi meksiko", TERRITORY_US_NM, 0x00002000},
+        {"novi zeland", TERRITORY_NZL, 0x00002000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PT)
+        {"novo brunswick", TERRITORY_CA_NB, 0x00100000},
+        {"novo mexico", TERRITORY_US_NM, 0x00100000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CS)
+        {"novofundlandan", TERRITORY_CA_NL, 0x00000010},
+#endif
+        {"novosibirsk oblast", TERRITORY_RU_NVS, 0x038c40f1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"novosibirska oblast", TERRITORY_RU_NVS, 0x00002000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FI)
+        {"novosibirskin alue", TERRITORY_RU_NVS, 0x00000200},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CS)
+        {"novy brunswick", TERRITORY_CA_NB, 0x00000010},
+        {"novy jizni wales", TERRITORY_AU_NSW, 0x00000010},
+        {"novy zeland", TERRITORY_NZL, 0x00000010},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PL)
+        {"nowa fundlandia", TERRITORY_CA_NL, 0x00200000},
+        {"nowa kaledonia", TERRITORY_NCL, 0x00200000},
+        {"nowa południowa walia", TERRITORY_AU_NSW, 0x00200000},
+        {"nowa szkocja", TERRITORY_CA_NS, 0x00200000},
+        {"nowa zelandia", TERRITORY_NZL, 0x00200000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AF)
+        {"nowgorod oblast", TERRITORY_RU_NGR, 0x00000001},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PL)
+        {"nowy brunszwik", TERRITORY_CA_NB, 0x00200000},
+        {"nowy jork", TERRITORY_US_NY, 0x00200000},
+        {"nowy meksyk", TERRITORY_US_NM, 0x00200000},
+#endif
+        {"npl", TERRITORY_NPL, 0x10000000},
+        {"nru", TERRITORY_NRU, 0x10000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ES)
+        {"nueva caledonia", TERRITORY_NCL, 0x00000100},
+        {"nueva escocia", TERRITORY_CA_NS, 0x00000100},
+        {"nueva gales del sur", TERRITORY_AU_NSW, 0x00000100},
+        {"nueva hampshire", TERRITORY_US_NH, 0x00000100},
+        {"nueva york", TERRITORY_US_NY, 0x00000100},
+        {"nueva zelanda", TERRITORY_NZL, 0x00000100},
+        {"nuevo brunswick", TERRITORY_CA_NB, 0x00000100},
+#endif
+        {"nuevo leon", TERRITORY_MX_NLE, 0x0bbce7f1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ES)
+        {"nuevo mexico", TERRITORY_US_NM, 0x00000100},
+#endif
+        {"nunavut", TERRITORY_CA_NU, 0x0bbce7f1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_IT)
+        {"nuova caledonia", TERRITORY_NCL, 0x00008000},
+        {"nuova scozia", TERRITORY_CA_NS, 0x00008000},
+        {"nuova zelanda", TERRITORY_NZL, 0x00008000},
+        {"nuovo brunswick", TERRITORY_CA_NB, 0x00008000},
+        {"nuovo galles del sud", TERRITORY_AU_NSW, 0x00008000},
+        {"nuovo messico", TERRITORY_US_NM, 0x00008000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DA)
+        {"ny kaledonien", TERRITORY_NCL, 0x00000020},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_NO)
+        {"ny-caledonia", TERRITORY_NCL, 0x00080000},
+        {"ny-zealand", TERRITORY_NZL, 0x00080000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_SV)
+        {"nya kaledonien", TERRITORY_NCL, 0x00800000},
+        {"nya zeeland", TERRITORY_NZL, 0x00800000},
+#endif
+        {"nzl", TERRITORY_NZL, 0x10000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_SV)
+        {"o av man", TERRITORY_IMN, 0x00800000},
+#endif
+        {"oaxaca", TERRITORY_MX_OAX, 0x0bbce7f1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"obala bjelokosti", TERRITORY_CIV, 0x00002000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_IT)
+        {"oblast", TERRITORY_RU_AMU, 0x00008000},
+        {"oblast `autonoma ebraica", TERRITORY_RU_YEV, 0x00008000},
+        {"oblast `di astrachan", TERRITORY_RU_AST, 0x00008000},
+        {"oblast `di belgorod", TERRITORY_RU_BE, 0x00008000},
+        {"oblast `di irkutsk", TERRITORY_RU_IRK, 0x00008000},
+        {"oblast `di kemerovo", TERRITORY_RU_KEM, 0x00008000},
+        {"oblast `di novosibirsk", TERRITORY_RU_NVS, 0x00008000},
+        {"oblast `di omsk", TERRITORY_RU_OMS, 0x00008000},
+        {"oblast `di saratov", TERRITORY_RU_SAR, 0x00008000},
+        {"oblast `di volgograd", TERRITORY_RU_VGG, 0x00008000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FR)
+        {"oblast autonome juif", TERRITORY_RU_YEV, 0x00000400},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PT)
+        {"oblast autonomo judaico", TERRITORY_RU_YEV, 0x00100000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ES)
+        {"oblast autonomo judio", TERRITORY_RU_YEV, 0x00000100},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ES) || defined(MAPCODE_SUPPORT_LANGUAGE_PT)
+        {"oblast de amur", TERRITORY_RU_AMU, 0x00100100},
+        {"oblast de astrakhan", TERRITORY_RU_AST, 0x00100100},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FR)
+        {"oblast de belgorod", TERRITORY_RU_BE, 0x00000400},
+        {"oblast de briansk", TERRITORY_RU_BRY, 0x00000400},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ES) || defined(MAPCODE_SUPPORT_LANGUAGE_PT)
+        {"oblast de bryansk", TERRITORY_RU_BRY, 0x00100100},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FR)
+        {"oblast de iaroslavl", TERRITORY_RU_YAR, 0x00000400},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ES) || defined(MAPCODE_SUPPORT_LANGUAGE_PT)
+        {"oblast de irkutsk", TERRITORY_RU_IRK, 0x00100100},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ES)
+        {"oblast de ivanovo", TERRITORY_RU_IVA, 0x00000100},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FR)
+        {"oblast de kaliningrad", TERRITORY_RU_KGD, 0x00000400},
+        {"oblast de kaluga", TERRITORY_RU_KLU, 0x00000400},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ES) || defined(MAPCODE_SUPPORT_LANGUAGE_FR)
+        {"oblast de kemerovo", TERRITORY_RU_KEM, 0x00000500},
+        {"oblast de kirov", TERRITORY_RU_KI, 0x00000500},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FR)
+        {"oblast de kostroma", TERRITORY_RU_KOS, 0x00000400},
+        {"oblast de kourgan", TERRITORY_RU_KGN, 0x00000400},
+        {"oblast de koursk", TERRITORY_RU_KRS, 0x00000400},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ES) || defined(MAPCODE_SUPPORT_LANGUAGE_PT)
+        {"oblast de kurgan", TERRITORY_RU_KGN, 0x00100100},
+        {"oblast de kursk", TERRITORY_RU_KRS, 0x00100100},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FR)
+        {"oblast de leningrad", TERRITORY_RU_LEN, 0x00000400},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ES) || defined(MAPCODE_SUPPORT_LANGUAGE_PT)
+        {"oblast de leningrado", TERRITORY_RU_LEN, 0x00100100},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ES) || defined(MAPCODE_SUPPORT_LANGUAGE_FR)
+        {"oblast de lipetsk", TERRITORY_RU_LIP, 0x00000500},
+        {"oblast de magadan", TERRITORY_RU_MAG, 0x00000500},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FR) || defined(MAPCODE_SUPPORT_LANGUAGE_PT)
+        {"oblast de moscou", TERRITORY_RU_MOS, 0x00100400},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ES)
+        {"oblast de moscu", TERRITORY_RU_MOS, 0x00000100},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FR)
+        {"oblast de mourmansk", TERRITORY_RU_MUR, 0x00000400},
+        {"oblast de nijni novgorod", TERRITORY_RU_NIZ, 0x00000400},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ES)
+        {"oblast de nizhny novgorod", TERRITORY_RU_NIZ, 0x00000100},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ES) || defined(MAPCODE_SUPPORT_LANGUAGE_FR) || defined(MAPCODE_SUPPORT_LANGUAGE_PT)
+        {"oblast de novgorod", TERRITORY_RU_NGR, 0x00100500},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ES) || defined(MAPCODE_SUPPORT_LANGUAGE_PT)
+        {"oblast de novosibirsk", TERRITORY_RU_NVS, 0x00100100},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FR)
+        {"oblast de novossibirsk", TERRITORY_RU_NVS, 0x00000400},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ES) || defined(MAPCODE_SUPPORT_LANGUAGE_PT)
+        {"oblast de omsk", TERRITORY_RU_OMS, 0x00100100},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FR)
+        {"oblast de penza", TERRITORY_RU_PNZ, 0x00000400},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ES) || defined(MAPCODE_SUPPORT_LANGUAGE_FR)
+        {"oblast de pskov", TERRITORY_RU_PSK, 0x00000500},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FR)
+        {"oblast de riazan", TERRITORY_RU_RYA, 0x00000400},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ES) || defined(MAPCODE_SUPPORT_LANGUAGE_FR) || defined(MAPCODE_SUPPORT_LANGUAGE_PT)
+        {"oblast de rostov", TERRITORY_RU_ROS, 0x00100500},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ES)
+        {"oblast de sajalin", TERRITORY_RU_SAK, 0x00000100},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FR)
+        {"oblast de sakhaline", TERRITORY_RU_SAK, 0x00000400},
+        {"oblast de samara", TERRITORY_RU_SAM, 0x00000400},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ES) || defined(MAPCODE_SUPPORT_LANGUAGE_FR)
+        {"oblast de saratov", TERRITORY_RU_SAR, 0x00000500},
+        {"oblast de smolensk", TERRITORY_RU_SMO, 0x00000500},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ES) || defined(MAPCODE_SUPPORT_LANGUAGE_FR) || defined(MAPCODE_SUPPORT_LANGUAGE_PT)
+        {"oblast de sverdlovsk", TERRITORY_RU_SVE, 0x00100500},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ES) || defined(MAPCODE_SUPPORT_LANGUAGE_FR)
+        {"oblast de tambov", TERRITORY_RU_TT, 0x00000500},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FR)
+        {"oblast de tcheliabinsk", TERRITORY_RU_CH, 0x00000400},
+        {"oblast de tioumen", TERRITORY_RU_TYU, 0x00000400},
+        {"oblast de tomsk", TERRITORY_RU_TOM, 0x00000400},
+        {"oblast de toula", TERRITORY_RU_TUL, 0x00000400},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ES) || defined(MAPCODE_SUPPORT_LANGUAGE_FR)
+        {"oblast de tver", TERRITORY_RU_TVE, 0x00000500},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FR)
+        {"oblast de vladimir", TERRITORY_RU_VLA, 0x00000400},
+        {"oblast de volgograd", TERRITORY_RU_VGG, 0x00000400},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ES)
+        {"oblast de volgogrado", TERRITORY_RU_VGG, 0x00000100},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ES) || defined(MAPCODE_SUPPORT_LANGUAGE_FR)
+        {"oblast de vologda", TERRITORY_RU_VLG, 0x00000500},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FR)
+        {"oblast de voronej", TERRITORY_RU_VOR, 0x00000400},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ES)
+        {"oblast de voronezh", TERRITORY_RU_VOR, 0x00000100},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FR)
+        {"oblast d’amour", TERRITORY_RU_AMU, 0x00000400},
+        {"oblast d’arkhangelsk", TERRITORY_RU_ARK, 0x00000400},
+        {"oblast d’astrakhan", TERRITORY_RU_AST, 0x00000400},
+        {"oblast d’irkoutsk", TERRITORY_RU_IRK, 0x00000400},
+        {"oblast d’ivanovo", TERRITORY_RU_IVA, 0x00000400},
+        {"oblast d’omsk", TERRITORY_RU_OMS, 0x00000400},
+        {"oblast d’orel", TERRITORY_RU_ORL, 0x00000400},
+        {"oblast d’orenbourg", TERRITORY_RU_ORE, 0x00000400},
+        {"oblast d’oulianovsk", TERRITORY_RU_ULY, 0x00000400},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DE)
+        {"oblast jaroslawl", TERRITORY_RU_YAR, 0x00000040},
+        {"oblast moskau", TERRITORY_RU_MOS, 0x00000040},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ID)
+        {"oblast otonom yahudi", TERRITORY_RU_YEV, 0x00004000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DE)
+        {"oblast swerdlowsk", TERRITORY_RU_SVE, 0x00000040},
+        {"oblast twer", TERRITORY_RU_TVE, 0x00000040},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PL)
+        {"obwod amurski", TERRITORY_RU_AMU, 0x00200000},
+        {"obwod czelabinski", TERRITORY_RU_CH, 0x00200000},
+        {"obwod irkucki", TERRITORY_RU_IRK, 0x00200000},
+        {"obwod kaliningradzki", TERRITORY_RU_KGD, 0x00200000},
+        {"obwod kałuski", TERRITORY_RU_KLU, 0x00200000},
+        {"obwod kostromski", TERRITORY_RU_KOS, 0x00200000},
+        {"obwod kurganski", TERRITORY_RU_KGN, 0x00200000},
+        {"obwod lipiecki", TERRITORY_RU_LIP, 0x00200000},
+        {"obwod magadanski", TERRITORY_RU_MAG, 0x00200000},
+        {"obwod moskiewski", TERRITORY_RU_MOS, 0x00200000},
+        {"obwod niznonowogrodzki", TERRITORY_RU_NIZ, 0x00200000},
+        {"obwod nowosybirsk", TERRITORY_RU_NVS, 0x00200000},
+        {"obwod orłowski", TERRITORY_RU_ORL, 0x00200000},
+        {"obwod pskow", TERRITORY_RU_PSK, 0x00200000},
+        {"obwod riazanski", TERRITORY_RU_RYA, 0x00200000},
+        {"obwod rostowski", TERRITORY_RU_ROS, 0x00200000},
+        {"obwod sachalinski", TERRITORY_RU_SAK, 0x00200000},
+        {"obwod saratowski", TERRITORY_RU_SAR, 0x00200000},
+        {"obwod smolenski", TERRITORY_RU_SMO, 0x00200000},
+        {"obwod swierdłowski", TERRITORY_RU_SVE, 0x00200000},
+        {"obwod tambowski", TERRITORY_RU_TT, 0x00200000},
+        {"obwod tiumen", TERRITORY_RU_TYU, 0x00200000},
+        {"obwod tomski", TERRITORY_RU_TOM, 0x00200000},
+        {"obwod twerski", TERRITORY_RU_TVE, 0x00200000},
+        {"obwod uljanowski", TERRITORY_RU_ULY, 0x00200000},
+        {"obwod woroneski", TERRITORY_RU_VOR, 0x00200000},
+        {"obwod wołgogradzki", TERRITORY_RU_VGG, 0x00200000},
+        {"obwod włodzimierski", TERRITORY_RU_VLA, 0x00200000},
+#endif
+        {"odisha", TERRITORY_IN_OR, 0x0bbcc7e1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_NL)
+        {"oeganda", TERRITORY_UGA, 0x00040000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AF) || defined(MAPCODE_SUPPORT_LANGUAGE_NL)
+        {"oekraine", TERRITORY_UKR, 0x00040001},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AF)
+        {"oesbekistan", TERRITORY_UZB, 0x00000001},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_NL)
+        {"oezbekistan", TERRITORY_UZB, 0x00040000},
+#endif
+        {"ohio", TERRITORY_US_OH, 0x0bbce7f1},
+        {"oklahoma", TERRITORY_US_OK, 0x0bbce7f1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_IT)
+        {"okrug autonoma nenets", TERRITORY_RU_NEN, 0x00008000},
+        {"olanda", TERRITORY_NLD, 0x00008000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PT)
+        {"oma", TERRITORY_OMN, 0x00100000},
+#endif
+        {"oman", TERRITORY_OMN, 0x09ace7f1},
+        {"omn", TERRITORY_OMN, 0x10000000},
+        {"omsk oblast", TERRITORY_RU_OMS, 0x03ac40f1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"omska oblast", TERRITORY_RU_OMS, 0x00002000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FI)
+        {"omskin alue", TERRITORY_RU_OMS, 0x00000200},
+#endif
+        {"ontario", TERRITORY_CA_ON, 0x0bbce7f1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AF)
+        {"oos-timor", TERRITORY_TLS, 0x00000001},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_NL)
+        {"oost-timor", TERRITORY_TLS, 0x00040000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AF)
+        {"oostelike oblast", TERRITORY_RU_AMU, 0x00000001},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_NL)
+        {"oostenrijk", TERRITORY_AUT, 0x00040000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AF)
+        {"oostenryk", TERRITORY_AUT, 0x00000001},
+#endif
+        {"oregon", TERRITORY_US_OR, 0x0bbce7f1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CS) || defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"orelska oblast", TERRITORY_RU_ORL, 0x00002010},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_SV)
+        {"oren oblast", TERRITORY_RU_ORE, 0x00800000},
+#endif
+        {"orenburg oblast", TERRITORY_RU_ORE, 0x033ce1f1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FI)
+        {"orenburgin alue", TERRITORY_RU_ORE, 0x00000200},
+#endif
+        {"orissa", TERRITORY_IN_OR, 0x03bce7f1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DE)
+        {"orjol oblast", TERRITORY_RU_ORL, 0x00000040},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FI)
+        {"orjolin alue", TERRITORY_RU_ORL, 0x00000200},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"orta afrika cumhuriyeti", TERRITORY_CAF, 0x02000000},
+#endif
+        {"oryol oblast", TERRITORY_RU_ORL, 0x039cc1a1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PL)
+        {"osetia połnocna republika", TERRITORY_RU_SE, 0x00200000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_SW)
+        {"ossetia ya kaskazini-alania republic", TERRITORY_RU_SE, 0x01000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ID)
+        {"ossetia-alania republik utara", TERRITORY_RU_SE, 0x00004000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_IT)
+        {"ossezia del nord-alania repubblica", TERRITORY_RU_SE, 0x00008000},
+#endif
+        {"osterreich", TERRITORY_AUT, 0x08000040},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_SV)
+        {"osterrike", TERRITORY_AUT, 0x00800000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DE) || defined(MAPCODE_SUPPORT_LANGUAGE_SV)
+        {"osttimor", TERRITORY_TLS, 0x00800040},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"otoci turks i caicos", TERRITORY_TCA, 0x00002000},
+        {"otocje mcdonald", TERRITORY_HMD, 0x00002000},
+        {"otok clipperton", TERRITORY_CPT, 0x00002000},
+        {"otok heard i otocje mcdonald", TERRITORY_HMD, 0x00002000},
+        {"otok man", TERRITORY_IMN, 0x00002000},
+        {"otok rhode", TERRITORY_US_RI, 0x00002000},
+        {"otoki caicos", TERRITORY_TCA, 0x00002000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FR)
+        {"oudmourtie", TERRITORY_RU_UD, 0x00000400},
+        {"ouganda", TERRITORY_UGA, 0x00000400},
+        {"ouzbekistan", TERRITORY_UZB, 0x00000400},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PL)
+        {"owcze, wyspy", TERRITORY_FRO, 0x00200000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"ozbekistan", TERRITORY_UZB, 0x02000000},
+#endif
+        {"oʻzbekiston", TERRITORY_UZB, 0x08000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ES)
+        {"paises bajos", TERRITORY_NLD, 0x00000100},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FI)
+        {"paivantasaajan guinea", TERRITORY_GNQ, 0x00000200},
+#endif
+        {"pak", TERRITORY_PAK, 0x10000000},
+        {"pakistan", TERRITORY_PAK, 0x0bace7f1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FR)
+        {"palaos", TERRITORY_PLW, 0x00000400},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DE)
+        {"palastinensische autonomiegebiete", TERRITORY_PSE, 0x00000040},
+#endif
+        {"palau", TERRITORY_PLW, 0x03bce3f1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FI)
+        {"palestiinalaisalueet", TERRITORY_PSE, 0x00000200},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"palestina", TERRITORY_PSE, 0x00002000},
+#endif
+        {"palestinian territories", TERRITORY_PSE, 0x00000080},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DA) || defined(MAPCODE_SUPPORT_LANGUAGE_NL)
+        {"palestinian territory", TERRITORY_PSE, 0x00040020},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_SV)
+        {"palestinska territorier", TERRITORY_PSE, 0x00800000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CS)
+        {"palestinska uzemi", TERRITORY_PSE, 0x00000010},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_NO)
+        {"palestinske territoriene", TERRITORY_PSE, 0x00080000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PL)
+        {"palestyna", TERRITORY_PSE, 0x00200000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AF)
+        {"palestynse gebiede", TERRITORY_PSE, 0x00000001},
+#endif
+        {"pan", TERRITORY_PAN, 0x10000000},
+        {"panama", TERRITORY_PAN, 0x0bbce7f1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CS)
+        {"pandzab", TERRITORY_IN_PB, 0x00000010},
+        {"panenske ostrovy, usa", TERRITORY_VIR, 0x00000010},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ID)
+        {"pantai gading", TERRITORY_CIV, 0x00004000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AF)
+        {"papoea-nieu-guinee", TERRITORY_PNG, 0x00000001},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_NL)
+        {"papoea-nieuw-guinea", TERRITORY_PNG, 0x00040000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FR)
+        {"papouasie-nouvelle-guinee", TERRITORY_PNG, 0x00000400},
+#endif
+        {"papua new guinea", TERRITORY_PNG, 0x01000080},
+        {"papua niu gini", TERRITORY_PNG, 0x08000000},
+        {"papua niugini", TERRITORY_PNG, 0x08000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PT)
+        {"papua nova guine", TERRITORY_PNG, 0x00100000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"papua nova gvineja", TERRITORY_PNG, 0x00002000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ES)
+        {"papua nueva guinea", TERRITORY_PNG, 0x00000100},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ID)
+        {"papua nugini", TERRITORY_PNG, 0x00004000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_IT)
+        {"papua nuova guinea", TERRITORY_PNG, 0x00008000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DA)
+        {"papua ny guinea", TERRITORY_PNG, 0x00000020},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_NO)
+        {"papua ny-guinea", TERRITORY_PNG, 0x00080000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_SV)
+        {"papua nya guinea", TERRITORY_PNG, 0x00800000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"papua yeni gine", TERRITORY_PNG, 0x02000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DE)
+        {"papua-neuguinea", TERRITORY_PNG, 0x00000040},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CS)
+        {"papua-nova guinea", TERRITORY_PNG, 0x00000010},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PL)
+        {"papua-nowa gwinea", TERRITORY_PNG, 0x00200000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FI)
+        {"papua-uusi-guinea", TERRITORY_PNG, 0x00000200},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PT)
+        {"paquistao", TERRITORY_PAK, 0x00100000},
+#endif
+        {"para", TERRITORY_BR_PA, 0x0bbce6f1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ES)
+        {"paraca", TERRITORY_BR_PA, 0x00000100},
+#endif
+        {"paraguai", TERRITORY_PRY, 0x08104000},
+        {"paraguay", TERRITORY_PRY, 0x0b8c87f1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"paragvaj", TERRITORY_PRY, 0x00002000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PL)
+        {"paragwaj", TERRITORY_PRY, 0x00200000},
+#endif
+        {"paraiba", TERRITORY_BR_PB, 0x0bbce7f1},
+        {"parana", TERRITORY_BR_PR, 0x0bbce7f1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DA)
+        {"pavestolen", TERRITORY_VAT, 0x00000020},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FR)
+        {"pays-bas", TERRITORY_NLD, 0x00000400},
+#endif
+        {"pcn", TERRITORY_PCN, 0x10000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_IT)
+        {"pechino", TERRITORY_CN_BJ, 0x00008000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FR) || defined(MAPCODE_SUPPORT_LANGUAGE_PL) || defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"pekin", TERRITORY_CN_BJ, 0x02200400},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CS) || defined(MAPCODE_SUPPORT_LANGUAGE_DE) || defined(MAPCODE_SUPPORT_LANGUAGE_FI) || defined(MAPCODE_SUPPORT_LANGUAGE_HR) || defined(MAPCODE_SUPPORT_LANGUAGE_SV)
+        {"peking", TERRITORY_CN_BJ, 0x00802250},
+#endif
+        {"pelew", TERRITORY_PLW, 0x08000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"pencap", TERRITORY_IN_PB, 0x02000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FR)
+        {"pendjab", TERRITORY_IN_PB, 0x00000400},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PL)
+        {"pendzab", TERRITORY_IN_PB, 0x00200000},
+#endif
+        {"pennsylvania", TERRITORY_US_PA, 0x0b0cc2f1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_SV)
+        {"pennsylvania sylvania~~pos=headcomp", TERRITORY_US_PA, 0x00800000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FR)
+        {"pennsylvanie", TERRITORY_US_PA, 0x00000400},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ES) || defined(MAPCODE_SUPPORT_LANGUAGE_PT)
+        {"pensilvania", TERRITORY_US_PA, 0x00100100},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"pensilvanija", TERRITORY_US_PA, 0x00002000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PL)
+        {"pensylwania", TERRITORY_US_PA, 0x00200000},
+#endif
+        {"penza oblast", TERRITORY_RU_PNZ, 0x03bce1f1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FI)
+        {"penzan alue", TERRITORY_RU_PNZ, 0x00000200},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PT)
+        {"pequim", TERRITORY_CN_BJ, 0x00100000},
+#endif
+        {"per", TERRITORY_PER, 0x10000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ID)
+        {"perancis", TERRITORY_FRA, 0x00004000},
+#endif
+        {"perm krai", TERRITORY_RU_PM, 0x03bce3f1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FR)
+        {"pernambouc", TERRITORY_BR_PE, 0x00000400},
+#endif
+        {"pernambuco", TERRITORY_BR_PE, 0x0bbce3f1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FR)
+        {"perou", TERRITORY_PER, 0x00000400},
+#endif
+        {"persia", TERRITORY_IRN, 0x08000080},
+        {"peru", TERRITORY_PER, 0x0bbce3f1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"petersburg", TERRITORY_RU_SPE, 0x02000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CS)
+        {"petrohrad", TERRITORY_RU_SPE, 0x00000010},
+#endif
+        {"philip island", TERRITORY_NFK, 0x0b8c42b1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DE)
+        {"philip-insel", TERRITORY_NFK, 0x00000040},
+        {"philippinen", TERRITORY_PHL, 0x00000040},
+#endif
+        {"philippines", TERRITORY_PHL, 0x01000480},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FR) || defined(MAPCODE_SUPPORT_LANGUAGE_IT)
+        {"phillip island", TERRITORY_NFK, 0x00008400},
+#endif
+        {"phl", TERRITORY_PHL, 0x10000000},
+        {"piaui", TERRITORY_BR_PI, 0x0bbce7f1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FI)
+        {"pietari", TERRITORY_RU_SPE, 0x00000200},
+        {"pihkovan alue", TERRITORY_RU_PSK, 0x00000200},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ID)
+        {"pilipina", TERRITORY_PHL, 0x00004000},
+#endif
+        {"pilipinas", TERRITORY_PHL, 0x08000000},
+        {"piruw", TERRITORY_PER, 0x08000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AF) || defined(MAPCODE_SUPPORT_LANGUAGE_CS) || defined(MAPCODE_SUPPORT_LANGUAGE_DA) || defined(MAPCODE_SUPPORT_LANGUAGE_PL)
+        {"pitcairn", TERRITORY_PCN, 0x00200031},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"pitcairn adaları", TERRITORY_PCN, 0x02000000},
+#endif
+        {"pitcairn islands", TERRITORY_PCN, 0x00840080},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"pitcairn otoci", TERRITORY_PCN, 0x00002000},
+#endif
+        {"pitcairn, henderson, ducie and oeno islands", TERRITORY_PCN, 0x00000080},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DE)
+        {"pitcairninseln", TERRITORY_PCN, 0x00000040},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FI)
+        {"pitcairnsaaret", TERRITORY_PCN, 0x00000200},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_NO)
+        {"pitcairnøyene", TERRITORY_PCN, 0x00080000},
+#endif
+        {"pitkern", TERRITORY_PCN, 0x08000000},
+        {"pitkern ailen", TERRITORY_PCN, 0x08000000},
+        {"plw", TERRITORY_PLW, 0x10000000},
+        {"png", TERRITORY_PNG, 0x10000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CS)
+        {"pobrezi slonoviny", TERRITORY_CIV, 0x00000010},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FI)
+        {"pohjois-carolina", TERRITORY_US_NC, 0x00000200},
+        {"pohjois-irlanti", TERRITORY_GBR, 0x00000200},
+        {"pohjois-korea", TERRITORY_PRK, 0x00000200},
+        {"pohjois-mariaanit", TERRITORY_MNP, 0x00000200},
+        {"pohjois-ossetia-alania tasavalta", TERRITORY_RU_SE, 0x00000200},
+#endif
+        {"pol", TERRITORY_POL, 0x10000000},
+        {"poland", TERRITORY_POL, 0x01000080},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ID)
+        {"polandia", TERRITORY_POL, 0x00004000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AF)
+        {"pole", TERRITORY_POL, 0x00000001},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DA) || defined(MAPCODE_SUPPORT_LANGUAGE_DE) || defined(MAPCODE_SUPPORT_LANGUAGE_NL) || defined(MAPCODE_SUPPORT_LANGUAGE_NO) || defined(MAPCODE_SUPPORT_LANGUAGE_SV)
+        {"polen", TERRITORY_POL, 0x008c0060},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ES)
+        {"polinesia frances", TERRITORY_PYF, 0x00000100},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PT)
+        {"polinesia francesa", TERRITORY_PYF, 0x00100000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_IT)
+        {"polinesia francese", TERRITORY_PYF, 0x00008000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ID)
+        {"polinesia perancis", TERRITORY_PYF, 0x00004000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PL)
+        {"polinezja francuska", TERRITORY_PYF, 0x00200000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"poljska", TERRITORY_POL, 0x00002000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FR)
+        {"pologne", TERRITORY_POL, 0x00000400},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ES) || defined(MAPCODE_SUPPORT_LANGUAGE_IT) || defined(MAPCODE_SUPPORT_LANGUAGE_PT)
+        {"polonia", TERRITORY_POL, 0x00108100},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"polonya", TERRITORY_POL, 0x02000000},
+#endif
+        {"polska", TERRITORY_POL, 0x08200000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CS)
+        {"polsko", TERRITORY_POL, 0x00000010},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_SW)
+        {"polynesia ya kifaransa", TERRITORY_PYF, 0x01000000},
+#endif
+        {"polynesie francaise", TERRITORY_PYF, 0x08000400},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FR)
+        {"pondichery", TERRITORY_IN_PY, 0x00000400},
+#endif
+        {"porinetia farani", TERRITORY_PYF, 0x08000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"portekiz", TERRITORY_PRT, 0x02000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PT)
+        {"porto rico", TERRITORY_PRI, 0x00100000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"porto riko", TERRITORY_PRI, 0x02000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_IT)
+        {"portogallo", TERRITORY_PRT, 0x00008000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CS) || defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"portoriko", TERRITORY_PRI, 0x00002010},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PL)
+        {"portoryko", TERRITORY_PRI, 0x00200000},
+#endif
+        {"portugal", TERRITORY_PRT, 0x089c65e1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FI)
+        {"portugali", TERRITORY_PRT, 0x00000200},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PL)
+        {"portugalia", TERRITORY_PRT, 0x00200000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CS)
+        {"portugalsko", TERRITORY_PRT, 0x00000010},
+#endif
+        {"portuguese republic", TERRITORY_PRT, 0x00000080},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PL)
+        {"połnocne terytorium", TERRITORY_AU_NT, 0x00200000},
+        {"połnocno - zachodnie terytoria", TERRITORY_CA_NT, 0x00200000},
+        {"południowa afryka", TERRITORY_ZAF, 0x00200000},
+        {"południowa australia", TERRITORY_AU_SA, 0x00200000},
+#endif
+        {"prathet thai", TERRITORY_THA, 0x08000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"prens edward adası", TERRITORY_CA_PE, 0x02000000},
+#endif
+        {"pri", TERRITORY_PRI, 0x10000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"primorski kraj", TERRITORY_RU_PO, 0x00002000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FI)
+        {"primorsky aluepiiri", TERRITORY_RU_PO, 0x00000200},
+#endif
+        {"primorsky krai", TERRITORY_RU_PO, 0x039cc1f1},
+        {"prince edward island", TERRITORY_CA_PE, 0x090c22b1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DE)
+        {"prince edward-insel", TERRITORY_CA_PE, 0x00000040},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"princip", TERRITORY_STP, 0x00002000},
+#endif
+        {"principat d'andorra", TERRITORY_AND, 0x08000000},
+        {"principe", TERRITORY_STP, 0x0b9cc7f1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_SV)
+        {"prins edward o", TERRITORY_CA_PE, 0x00800000},
+#endif
+        {"prk", TERRITORY_PRK, 0x10000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ES)
+        {"provincia de guangdong", TERRITORY_CN_GD, 0x00000100},
+#endif
+        {"prt", TERRITORY_PRT, 0x10000000},
+        {"pry", TERRITORY_PRY, 0x10000000},
+        {"pse", TERRITORY_PSE, 0x10000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_IT)
+        {"pskov", TERRITORY_RU_PSK, 0x00008000},
+#endif
+        {"pskov oblast", TERRITORY_RU_PSK, 0x039c40f1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"pskovska oblast", TERRITORY_RU_PSK, 0x00002000},
+#endif
+        {"puducherry", TERRITORY_IN_PY, 0x0bbce3f1},
+        {"puebla", TERRITORY_MX_PUE, 0x0bbce7f1},
+        {"puerto rico", TERRITORY_PRI, 0x088cc7e1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ID)
+        {"pulau cayman", TERRITORY_CYM, 0x00004000},
+        {"pulau clipperton", TERRITORY_CPT, 0x00004000},
+        {"pulau heard dan kepulauan mcdonald", TERRITORY_HMD, 0x00004000},
+        {"pulau manusia", TERRITORY_IMN, 0x00004000},
+        {"pulau marshall", TERRITORY_MHL, 0x00004000},
+        {"pulau pangeran edward", TERRITORY_CA_PE, 0x00004000},
+        {"pulau solomon", TERRITORY_SLB, 0x00004000},
+#endif
+        {"punjab", TERRITORY_IN_PB, 0x099ce3e1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FI)
+        {"puola", TERRITORY_POL, 0x00000200},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_SW)
+        {"pwetoriko", TERRITORY_PRI, 0x01000000},
+#endif
+        {"pyf", TERRITORY_PYF, 0x10000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FI)
+        {"pyha istuin", TERRITORY_VAT, 0x00000200},
+#endif
+        {"qat", TERRITORY_QAT, 0x10000000},
+        {"qatar", TERRITORY_QAT, 0x098cc6a0},
+        {"qazaqstan", TERRITORY_KAZ, 0x08000000},
+        {"qinghai", TERRITORY_CN_QH, 0x03bce7f1},
+        {"quebec", TERRITORY_CA_QC, 0x0bbce7f1},
+        {"queensland", TERRITORY_AU_QLD, 0x0bbce7f1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PT)
+        {"quenia", TERRITORY_KEN, 0x00100000},
+#endif
+        {"queretaro", TERRITORY_MX_QUE, 0x0bbce7f1},
+        {"queretaro de arteaga", TERRITORY_MX_QUE, 0x08000000},
+        {"quintana roo", TERRITORY_MX_ROO, 0x0bbce7f1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PT)
+        {"quirguistao", TERRITORY_KGZ, 0x00100000},
+        {"quiribati", TERRITORY_KIR, 0x00100000},
+#endif
+        {"rajasthan", TERRITORY_IN_RJ, 0x03bce7f1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CS)
+        {"rakousko", TERRITORY_AUT, 0x00000010},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FI)
+        {"ranska", TERRITORY_FRA, 0x00000200},
+        {"ranskan etelaiset alueet", TERRITORY_ATF, 0x00000200},
+        {"ranskan guayana", TERRITORY_GUF, 0x00000200},
+        {"ranskan polynesia", TERRITORY_PYF, 0x00000200},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CS)
+        {"recko", TERRITORY_GRC, 0x00000010},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FR)
+        {"region autonome ouighoure du xinjiang", TERRITORY_CN_XJ, 0x00000400},
+        {"region autonome zhuang du guangxi", TERRITORY_CN_GX, 0x00000400},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_IT)
+        {"regno unito", TERRITORY_GBR, 0x00008000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ES) || defined(MAPCODE_SUPPORT_LANGUAGE_PT)
+        {"reino unido", TERRITORY_GBR, 0x00100100},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_IT)
+        {"repubblica adygea", TERRITORY_RU_AD, 0x00008000},
+        {"repubblica bashkortostan", TERRITORY_RU_BA, 0x00008000},
+        {"repubblica buryatia", TERRITORY_RU_BU, 0x00008000},
+        {"repubblica carelia", TERRITORY_RU_KR, 0x00008000},
+        {"repubblica ceca", TERRITORY_CZE, 0x00008000},
+        {"repubblica cecena", TERRITORY_RU_CE, 0x00008000},
+        {"repubblica centrafricana", TERRITORY_CAF, 0x00008000},
+        {"repubblica del daghestan", TERRITORY_RU_DA, 0x00008000},
+        {"repubblica dell`altaj", TERRITORY_RU_AL, 0x00008000},
+        {"repubblica di komi", TERRITORY_RU_KO, 0x00008000},
+        {"repubblica di sakha", TERRITORY_RU_SA, 0x00008000},
+        {"repubblica di udmurtia", TERRITORY_RU_UD, 0x00008000},
+        {"repubblica dominicana", TERRITORY_DOM, 0x00008000},
+        {"repubblica inguscezia", TERRITORY_RU_IN, 0x00008000},
+        {"repubblica kalmykia", TERRITORY_RU_KL, 0x00008000},
+        {"repubblica khakassia", TERRITORY_RU_KK, 0x00008000},
+        {"repubblica mordovia", TERRITORY_RU_MO, 0x00008000},
+        {"repubblica tatarstan", TERRITORY_RU_TA, 0x00008000},
+        {"repubblica tuva", TERRITORY_RU_TY, 0x00008000},
+#endif
+        {"republic of cabo verde", TERRITORY_CPV, 0x00000080},
+        {"republic of china", TERRITORY_TWN, 0x00000080},
+        {"republic of cote d'ivoire", TERRITORY_CIV, 0x00000080},
+        {"republic of korea", TERRITORY_KOR, 0x00000080},
+        {"republic of the congo", TERRITORY_COG, 0x00000080},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PT)
+        {"republica altai", TERRITORY_RU_AL, 0x00100000},
+        {"republica centro-africana", TERRITORY_CAF, 0x00100000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ES)
+        {"republica centroafricana", TERRITORY_CAF, 0x00000100},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ES) || defined(MAPCODE_SUPPORT_LANGUAGE_PT)
+        {"republica checa", TERRITORY_CZE, 0x00100100},
+        {"republica chechena", TERRITORY_RU_CE, 0x00100100},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PT)
+        {"republica da bashkortosta", TERRITORY_RU_BA, 0x00100000},
+        {"republica da buryatia", TERRITORY_RU_BU, 0x00100000},
+        {"republica da carelia", TERRITORY_RU_KR, 0x00100000},
+        {"republica da kalmukia", TERRITORY_RU_KL, 0x00100000},
+        {"republica da mordovia", TERRITORY_RU_MO, 0x00100000},
+        {"republica da ossetia do norte-alania", TERRITORY_RU_SE, 0x00100000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ES) || defined(MAPCODE_SUPPORT_LANGUAGE_PT)
+        {"republica de adygea", TERRITORY_RU_AD, 0x00100100},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ES)
+        {"republica de altai", TERRITORY_RU_AL, 0x00000100},
+        {"republica de bashkortostan", TERRITORY_RU_BA, 0x00000100},
+        {"republica de buriatia", TERRITORY_RU_BU, 0x00000100},
+        {"republica de carelia", TERRITORY_RU_KR, 0x00000100},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ES) || defined(MAPCODE_SUPPORT_LANGUAGE_PT)
+        {"republica de chuvash", TERRITORY_RU_CU, 0x00100100},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ES)
+        {"republica de daguestan", TERRITORY_RU_DA, 0x00000100},
+        {"republica de ingushetia", TERRITORY_RU_IN, 0x00000100},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ES) || defined(MAPCODE_SUPPORT_LANGUAGE_PT)
+        {"republica de kabardino-balkar", TERRITORY_RU_KB, 0x00100100},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ES)
+        {"republica de kalmykia", TERRITORY_RU_KL, 0x00000100},
+        {"republica de khakassia", TERRITORY_RU_KK, 0x00000100},
+        {"republica de komi", TERRITORY_RU_KO, 0x00000100},
+        {"republica de mordovia", TERRITORY_RU_MO, 0x00000100},
+        {"republica de osetia del norte-alania", TERRITORY_RU_SE, 0x00000100},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ES) || defined(MAPCODE_SUPPORT_LANGUAGE_PT)
+        {"republica de sakha", TERRITORY_RU_SA, 0x00100100},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ES)
+        {"republica de tatarstan", TERRITORY_RU_TA, 0x00000100},
+        {"republica de udmurt", TERRITORY_RU_UD, 0x00000100},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ES) || defined(MAPCODE_SUPPORT_LANGUAGE_PT)
+        {"republica de yakutia", TERRITORY_RU_SA, 0x00100100},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PT)
+        {"republica do daguestao", TERRITORY_RU_DA, 0x00100000},
+#endif
+        {"republica dominicana", TERRITORY_DOM, 0x08100100},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ES) || defined(MAPCODE_SUPPORT_LANGUAGE_PT)
+        {"republica karachay-cherkess", TERRITORY_RU_KC, 0x00100100},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PT)
+        {"republica khakassia", TERRITORY_RU_KK, 0x00100000},
+        {"republica tatarstan", TERRITORY_RU_TA, 0x00100000},
+        {"republica udmurt", TERRITORY_RU_UD, 0x00100000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_NL)
+        {"republiek mari el", TERRITORY_RU_ME, 0x00040000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AF)
+        {"republiek van die kongo", TERRITORY_COG, 0x00000001},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ID)
+        {"republik afrika tengah", TERRITORY_CAF, 0x00004000},
+        {"republik altai", TERRITORY_RU_AL, 0x00004000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DE)
+        {"republik baschkortostan", TERRITORY_RU_BA, 0x00000040},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ID)
+        {"republik ceko", TERRITORY_CZE, 0x00004000},
+        {"republik chechnya", TERRITORY_RU_CE, 0x00004000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DE)
+        {"republik dagestan", TERRITORY_RU_DA, 0x00000040},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ID)
+        {"republik dominika", TERRITORY_DOM, 0x00004000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DE)
+        {"republik karelien", TERRITORY_RU_KR, 0x00000040},
+        {"republik komi", TERRITORY_RU_KO, 0x00000040},
+        {"republik mari el", TERRITORY_RU_ME, 0x00000040},
+        {"republik sacha", TERRITORY_RU_SA, 0x00000040},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ID)
+        {"republik sakha", TERRITORY_RU_SA, 0x00004000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DE) || defined(MAPCODE_SUPPORT_LANGUAGE_ID)
+        {"republik tatarstan", TERRITORY_RU_TA, 0x00004040},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DE)
+        {"republik tschuwaschien", TERRITORY_RU_CU, 0x00000040},
+        {"republik udmurtien", TERRITORY_RU_UD, 0x00000040},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PL)
+        {"republika adygeja", TERRITORY_RU_AD, 0x00200000},
+        {"republika ałtaju", TERRITORY_RU_AL, 0x00200000},
+        {"republika baszkirii", TERRITORY_RU_BA, 0x00200000},
+        {"republika buriacja", TERRITORY_RU_BU, 0x00200000},
+        {"republika chakasja", TERRITORY_RU_KK, 0x00200000},
+        {"republika inguszetii", TERRITORY_RU_IN, 0x00200000},
+        {"republika karelia", TERRITORY_RU_KR, 0x00200000},
+        {"republika kałmucji", TERRITORY_RU_KL, 0x00200000},
+        {"republika komi", TERRITORY_RU_KO, 0x00200000},
+        {"republika mari eł", TERRITORY_RU_ME, 0x00200000},
+        {"republika mordowia", TERRITORY_RU_MO, 0x00200000},
+        {"republika sacha", TERRITORY_RU_SA, 0x00200000},
+        {"republika srodkowoafrykanska", TERRITORY_CAF, 0x00200000},
+        {"republika tatarstan", TERRITORY_RU_TA, 0x00200000},
+        {"republika tuwy", TERRITORY_RU_TY, 0x00200000},
+        {"republika udmurt", TERRITORY_RU_UD, 0x00200000},
+        {"republika zielonego przyladka", TERRITORY_CPV, 0x00200000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_SV)
+        {"republiken burjatien", TERRITORY_RU_BU, 0x00800000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PL)
+        {"republiki dagestan", TERRITORY_RU_DA, 0x00200000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_NO)
+        {"republikken kongo", TERRITORY_COG, 0x00080000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FR)
+        {"republique centrafricaine", TERRITORY_CAF, 0x00000400},
+        {"republique de bachkirie", TERRITORY_RU_BA, 0x00000400},
+        {"republique de bouriatie", TERRITORY_RU_BU, 0x00000400},
+        {"republique de carelie", TERRITORY_RU_KR, 0x00000400},
+        {"republique de kalmoukie", TERRITORY_RU_KL, 0x00000400},
+        {"republique de karatchaievo-tcherkessie", TERRITORY_RU_KC, 0x00000400},
+        {"republique de khakassie", TERRITORY_RU_KK, 0x00000400},
+        {"republique de l’altai", TERRITORY_RU_AL, 0x00000400},
+        {"republique de mordovie", TERRITORY_RU_MO, 0x00000400},
+        {"republique de sakha", TERRITORY_RU_SA, 0x00000400},
+        {"republique de tchouvachie", TERRITORY_RU_CU, 0x00000400},
+        {"republique de touva", TERRITORY_RU_TY, 0x00000400},
+        {"republique de yakoutie", TERRITORY_RU_SA, 0x00000400},
+        {"republique des komis", TERRITORY_RU_KO, 0x00000400},
+        {"republique des maris", TERRITORY_RU_ME, 0x00000400},
+        {"republique dominicaine", TERRITORY_DOM, 0x00000400},
+        {"republique du daguestan", TERRITORY_RU_DA, 0x00000400},
+        {"republique du tatarstan", TERRITORY_RU_TA, 0x00000400},
+        {"republique d’adyguee", TERRITORY_RU_AD, 0x00000400},
+        {"republique d’ossetie du nord-alanie", TERRITORY_RU_SE, 0x00000400},
+        {"republique tcheque", TERRITORY_CZE, 0x00000400},
+        {"republique tchetchene", TERRITORY_RU_CE, 0x00000400},
+#endif
+        {"republique togolaise", TERRITORY_TGO, 0x08000000},
+        {"reu", TERRITORY_REU, 0x10000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ID)
+        {"reuni", TERRITORY_REU, 0x00004000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PT)
+        {"reuniao", TERRITORY_REU, 0x00100000},
+#endif
+        {"reunion", TERRITORY_REU, 0x0b2c85e1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"reunion otok", TERRITORY_REU, 0x00002000},
+#endif
+        {"rhode island", TERRITORY_US_RI, 0x0bbcc7f1},
+        {"rio de janeiro", TERRITORY_BR_RJ, 0x0bbce7f1},
+        {"rio grande do norte", TERRITORY_BR_RN, 0x0bbce7f1},
+        {"rio grande do sul", TERRITORY_BR_RS, 0x0bbce7f1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FI)
+        {"rjazanin alue", TERRITORY_RU_RYA, 0x00000200},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"rjazanjska oblast", TERRITORY_RU_RYA, 0x00002000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AF) || defined(MAPCODE_SUPPORT_LANGUAGE_NL)
+        {"roemenie", TERRITORY_ROU, 0x00040001},
+#endif
+        {"romania", TERRITORY_ROU, 0x09088280},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"romanya", TERRITORY_ROU, 0x02000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PT)
+        {"romenia", TERRITORY_ROU, 0x00100000},
+#endif
+        {"rondonia", TERRITORY_BR_RO, 0x0bbce7f1},
+        {"roraima", TERRITORY_BR_RR, 0x0bbce7f1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PL)
+        {"rosja", TERRITORY_RUS, 0x00200000},
+#endif
+        {"rostov oblast", TERRITORY_RU_ROS, 0x038ce0f1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FI)
+        {"rostovin alue", TERRITORY_RU_ROS, 0x00000200},
+#endif
+        {"rou", TERRITORY_ROU, 0x10000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FR)
+        {"roumanie", TERRITORY_ROU, 0x00000400},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CS)
+        {"rovnikova guinea", TERRITORY_GNQ, 0x00000010},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FR)
+        {"royaume des pays-bas", TERRITORY_SXM, 0x00000400},
+        {"royaume-uni", TERRITORY_GBR, 0x00000400},
+#endif
+        {"ru-ad", TERRITORY_RU_AD, 0x10000000},
+        {"ru-al", TERRITORY_RU_AL, 0x10000000},
+        {"ru-alt", TERRITORY_RU_ALT, 0x10000000},
+        {"ru-amu", TERRITORY_RU_AMU, 0x10000000},
+        {"ru-ark", TERRITORY_RU_ARK, 0x10000000},
+        {"ru-ast", TERRITORY_RU_AST, 0x10000000},
+        {"ru-ba", TERRITORY_RU_BA, 0x10000000},
+        {"ru-be", TERRITORY_RU_BE, 0x10000000},
+        {"ru-bry", TERRITORY_RU_BRY, 0x10000000},
+        {"ru-bu", TERRITORY_RU_BU, 0x10000000},
+        {"ru-ce", TERRITORY_RU_CE, 0x10000000},
+        {"ru-ch", TERRITORY_RU_CH, 0x10000000},
+        {"ru-chu", TERRITORY_RU_CHU, 0x10000000},
+        {"ru-cu", TERRITORY_RU_CU, 0x10000000},
+        {"ru-da", TERRITORY_RU_DA, 0x10000000},
+        {"ru-in", TERRITORY_RU_IN, 0x10000000},
+        {"ru-irk", TERRITORY_RU_IRK, 0x10000000},
+        {"ru-iva", TERRITORY_RU_IVA, 0x10000000},
+        {"ru-kam", TERRITORY_RU_KAM, 0x10000000},
+        {"ru-kb", TERRITORY_RU_KB, 0x10000000},
+        {"ru-kc", TERRITORY_RU_KC, 0x10000000},
+        {"ru-kda", TERRITORY_RU_KDA, 0x10000000},
+        {"ru-kem", TERRITORY_RU_KEM, 0x10000000},
+        {"ru-kgd", TERRITORY_RU_KGD, 0x10000000},
+        {"ru-kgn", TERRITORY_RU_KGN, 0x10000000},
+        {"ru-kha", TERRITORY_RU_KHA, 0x10000000},
+        {"ru-ki", TERRITORY_RU_KI, 0x10000000},
+        {"ru-kk", TERRITORY_RU_KK, 0x10000000},
+        {"ru-kl", TERRITORY_RU_KL, 0x10000000},
+        {"ru-klu", TERRITORY_RU_KLU, 0x10000000},
+        {"ru-km", TERRITORY_RU_KM, 0x10000000},
+        {"ru-ko", TERRITORY_RU_KO, 0x10000000},
+        {"ru-kos", TERRITORY_RU_KOS, 0x10000000},
+        {"ru-kr", TERRITORY_RU_KR, 0x10000000},
+        {"ru-krs", TERRITORY_RU_KRS, 0x10000000},
+        {"ru-kya", TERRITORY_RU_KYA, 0x10000000},
+        {"ru-len", TERRITORY_RU_LEN, 0x10000000},
+        {"ru-lip", TERRITORY_RU_LIP, 0x10000000},
+        {"ru-mag", TERRITORY_RU_MAG, 0x10000000},
+        {"ru-me", TERRITORY_RU_ME, 0x10000000},
+        {"ru-mo", TERRITORY_RU_MO, 0x10000000},
+        {"ru-mos", TERRITORY_RU_MOS, 0x10000000},
+        {"ru-mow", TERRITORY_RU_MOW, 0x10000000},
+        {"ru-mur", TERRITORY_RU_MUR, 0x10000000},
+        {"ru-nen", TERRITORY_RU_NEN, 0x10000000},
+        {"ru-ngr", TERRITORY_RU_NGR, 0x10000000},
+        {"ru-niz", TERRITORY_RU_NIZ, 0x10000000},
+        {"ru-nvs", TERRITORY_RU_NVS, 0x10000000},
+        {"ru-oms", TERRITORY_RU_OMS, 0x10000000},
+        {"ru-ore", TERRITORY_RU_ORE, 0x10000000},
+        {"ru-orl", TERRITORY_RU_ORL, 0x10000000},
+        {"ru-pm", TERRITORY_RU_PM, 0x10000000},
+        {"ru-pnz", TERRITORY_RU_PNZ, 0x10000000},
+        {"ru-po", TERRITORY_RU_PO, 0x10000000},
+        {"ru-psk", TERRITORY_RU_PSK, 0x10000000},
+        {"ru-ros", TERRITORY_RU_ROS, 0x10000000},
+        {"ru-rya", TERRITORY_RU_RYA, 0x10000000},
+        {"ru-sa", TERRITORY_RU_SA, 0x10000000},
+        {"ru-sak", TERRITORY_RU_SAK, 0x10000000},
+        {"ru-sam", TERRITORY_RU_SAM, 0x10000000},
+        {"ru-sar", TERRITORY_RU_SAR, 0x10000000},
+        {"ru-se", TERRITORY_RU_SE, 0x10000000},
+        {"ru-smo", TERRITORY_RU_SMO, 0x10000000},
+        {"ru-spe", TERRITORY_RU_SPE, 0x10000000},
+        {"ru-sta", TERRITORY_RU_STA, 0x10000000},
+        {"ru-sve", TERRITORY_RU_SVE, 0x10000000},
+        {"ru-ta", TERRITORY_RU_TA, 0x10000000},
+        {"ru-tom", TERRITORY_RU_TOM, 0x10000000},
+        {"ru-tt", TERRITORY_RU_TT, 0x10000000},
+        {"ru-tul", TERRITORY_RU_TUL, 0x10000000},
+        {"ru-tve", TERRITORY_RU_TVE, 0x10000000},
+        {"ru-ty", TERRITORY_RU_TY, 0x10000000},
+        {"ru-tyu", TERRITORY_RU_TYU, 0x10000000},
+        {"ru-ud", TERRITORY_RU_UD, 0x10000000},
+        {"ru-uly", TERRITORY_RU_ULY, 0x10000000},
+        {"ru-vgg", TERRITORY_RU_VGG, 0x10000000},
+        {"ru-vla", TERRITORY_RU_VLA, 0x10000000},
+        {"ru-vlg", TERRITORY_RU_VLG, 0x10000000},
+        {"ru-vor", TERRITORY_RU_VOR, 0x10000000},
+        {"ru-yan", TERRITORY_RU_YAN, 0x10000000},
+        {"ru-yar", TERRITORY_RU_YAR, 0x10000000},
+        {"ru-yev", TERRITORY_RU_YEV, 0x10000000},
+        {"ru-zab", TERRITORY_RU_ZAB, 0x10000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DE) || defined(MAPCODE_SUPPORT_LANGUAGE_ES) || defined(MAPCODE_SUPPORT_LANGUAGE_FI) || defined(MAPCODE_SUPPORT_LANGUAGE_HR) || defined(MAPCODE_SUPPORT_LANGUAGE_IT) || defined(MAPCODE_SUPPORT_LANGUAGE_PT) || defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"ruanda", TERRITORY_RWA, 0x0210a340},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ES) || defined(MAPCODE_SUPPORT_LANGUAGE_ID)
+        {"rumania", TERRITORY_ROU, 0x00004100},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DE) || defined(MAPCODE_SUPPORT_LANGUAGE_SV)
+        {"rumanien", TERRITORY_ROU, 0x00800040},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PL)
+        {"rumunia", TERRITORY_ROU, 0x00200000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"rumunjska", TERRITORY_ROU, 0x00002000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CS)
+        {"rumunsko", TERRITORY_ROU, 0x00000010},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DA)
+        {"rumænien", TERRITORY_ROU, 0x00000020},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FI)
+        {"ruotsi", TERRITORY_SWE, 0x00000200},
+#endif
+        {"rus", TERRITORY_RUS, 0x10000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ES) || defined(MAPCODE_SUPPORT_LANGUAGE_ID)
+        {"rusia", TERRITORY_RUS, 0x00004100},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"ruska federacija", TERRITORY_RUS, 0x00002000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CS)
+        {"rusko", TERRITORY_RUS, 0x00000010},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AF) || defined(MAPCODE_SUPPORT_LANGUAGE_DA) || defined(MAPCODE_SUPPORT_LANGUAGE_NL)
+        {"rusland", TERRITORY_RUS, 0x00040021},
+#endif
+        {"russia", TERRITORY_RUS, 0x01108080},
+        {"russian federation", TERRITORY_RUS, 0x00000080},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FR)
+        {"russie", TERRITORY_RUS, 0x00000400},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DE) || defined(MAPCODE_SUPPORT_LANGUAGE_NO)
+        {"russland", TERRITORY_RUS, 0x00080040},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"rusya", TERRITORY_RUS, 0x02000000},
+#endif
+        {"rwa", TERRITORY_RWA, 0x10000000},
+        {"rwanda", TERRITORY_RWA, 0x09ac44b1},
+        {"ryazan oblast", TERRITORY_RU_RYA, 0x019cc1f1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"ryazan oblastı", TERRITORY_RU_RYA, 0x02000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_SV)
+        {"ryssland", TERRITORY_RUS, 0x00800000},
+#endif
+        {"saba", TERRITORY_BES, 0x0b9cc7f1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"saba i karipski otoci bonaire i sveti eustazije", TERRITORY_BES, 0x00002000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CS)
+        {"sacha", TERRITORY_RU_SA, 0x00000010},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_SV)
+        {"sacha republiken", TERRITORY_RU_SA, 0x00800000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DE)
+        {"sachalin oblast", TERRITORY_RU_SAK, 0x00000040},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"sad", TERRITORY_USA, 0x00002000},
+        {"sad djevicanski otoci", TERRITORY_VIR, 0x00002000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FI)
+        {"sahalinin alue", TERRITORY_RU_SAK, 0x00000200},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"sahalinska oblast", TERRITORY_RU_SAK, 0x00002000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FI)
+        {"sahan tasavallassa", TERRITORY_RU_SA, 0x00000200},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ID)
+        {"sahara barat", TERRITORY_ESH, 0x00004000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ES) || defined(MAPCODE_SUPPORT_LANGUAGE_FR)
+        {"sahara occidental", TERRITORY_ESH, 0x00000500},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_IT)
+        {"sahara occidentale", TERRITORY_ESH, 0x00008000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PT)
+        {"sahara ocidental", TERRITORY_ESH, 0x00100000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PL)
+        {"sahara zachodnia", TERRITORY_ESH, 0x00200000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ES) || defined(MAPCODE_SUPPORT_LANGUAGE_PT)
+        {"saharaui", TERRITORY_ESH, 0x00100100},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_IT) || defined(MAPCODE_SUPPORT_LANGUAGE_SW)
+        {"saharawi", TERRITORY_ESH, 0x01008000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_NO)
+        {"saharawiske", TERRITORY_ESH, 0x00080000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FR)
+        {"sahraoui", TERRITORY_ESH, 0x00000400},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AF) || defined(MAPCODE_SUPPORT_LANGUAGE_CS) || defined(MAPCODE_SUPPORT_LANGUAGE_DA) || defined(MAPCODE_SUPPORT_LANGUAGE_DE) || defined(MAPCODE_SUPPORT_LANGUAGE_ID) || defined(MAPCODE_SUPPORT_LANGUAGE_NL) || defined(MAPCODE_SUPPORT_LANGUAGE_SV)
+        {"sahrawi", TERRITORY_ESH, 0x00844071},
+#endif
+        {"sahrawi arab democratic republic", TERRITORY_ESH, 0x00000080},
+        {"saint helena", TERRITORY_SHN, 0x08000080},
+        {"saint helena, ascension and tristan da cunha", TERRITORY_SHN, 0x08000080},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ID)
+        {"saint helena, ascension dan tristan da cunha", TERRITORY_SHN, 0x00004000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AF)
+        {"saint helena, ascension en tristan da cunha", TERRITORY_SHN, 0x00000001},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FI)
+        {"saint helena, ascension ja tristan da cunha", TERRITORY_SHN, 0x00000200},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_SW)
+        {"saint helena, ascension na tristan da cunha", TERRITORY_SHN, 0x01000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_SV)
+        {"saint helena, ascension och tristan da cunha", TERRITORY_SHN, 0x00800000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DA) || defined(MAPCODE_SUPPORT_LANGUAGE_NO)
+        {"saint helena, ascension og tristan da cunha", TERRITORY_SHN, 0x00080020},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DE)
+        {"saint helena, ascension und tristan da cunha", TERRITORY_SHN, 0x00000040},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"saint helena, ascension ve tristan da cunha", TERRITORY_SHN, 0x02000000},
+#endif
+        {"saint kitts", TERRITORY_KNA, 0x00000080},
+        {"saint kitts and nevis", TERRITORY_KNA, 0x08000080},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ID)
+        {"saint kitts dan nevis", TERRITORY_KNA, 0x00004000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_IT)
+        {"saint kitts e nevis", TERRITORY_KNA, 0x00008000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AF) || defined(MAPCODE_SUPPORT_LANGUAGE_NL)
+        {"saint kitts en nevis", TERRITORY_KNA, 0x00040001},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PL)
+        {"saint kitts i nevis", TERRITORY_KNA, 0x00200000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FI)
+        {"saint kitts ja nevis", TERRITORY_KNA, 0x00000200},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_SW)
+        {"saint kitts na nevis", TERRITORY_KNA, 0x01000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_SV)
+        {"saint kitts och nevis", TERRITORY_KNA, 0x00800000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DA) || defined(MAPCODE_SUPPORT_LANGUAGE_NO)
+        {"saint kitts og nevis", TERRITORY_KNA, 0x00080020},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DE)
+        {"saint kitts und nevis", TERRITORY_KNA, 0x00000040},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"saint kitts ve nevis", TERRITORY_KNA, 0x02000000},
+#endif
+        {"saint lucia", TERRITORY_LCA, 0x02ac42e1},
+        {"saint martin", TERRITORY_MAF, 0x00100080},
+        {"saint petersburg", TERRITORY_RU_SPE, 0x010860c1},
+        {"saint pierre", TERRITORY_SPM, 0x00000080},
+        {"saint pierre and miquelon", TERRITORY_SPM, 0x00000080},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ID)
+        {"saint pierre dan miquelon", TERRITORY_SPM, 0x00004000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_IT) || defined(MAPCODE_SUPPORT_LANGUAGE_PT)
+        {"saint pierre e miquelon", TERRITORY_SPM, 0x00108000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_SW)
+        {"saint pierre na miquelon", TERRITORY_SPM, 0x01000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_SV)
+        {"saint pierre och miquelon", TERRITORY_SPM, 0x00800000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DA)
+        {"saint pierre og miquelon", TERRITORY_SPM, 0x00000020},
+#endif
+        {"saint vincent", TERRITORY_VCT, 0x08000080},
+        {"saint vincent and the grenadines", TERRITORY_VCT, 0x08000080},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ID)
+        {"saint vincent dan grenadines", TERRITORY_VCT, 0x00004000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_IT)
+        {"saint vincent e grenadine", TERRITORY_VCT, 0x00008000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_NL)
+        {"saint vincent en de grenadines", TERRITORY_VCT, 0x00040000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PL)
+        {"saint vincent i grenadyny", TERRITORY_VCT, 0x00200000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FI)
+        {"saint vincent ja grenadiinit", TERRITORY_VCT, 0x00000200},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_SW)
+        {"saint vincent na grenadines", TERRITORY_VCT, 0x01000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_SV)
+        {"saint vincent och grenadinerna", TERRITORY_VCT, 0x00800000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_NO)
+        {"saint vincent og grenadinene", TERRITORY_VCT, 0x00080000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DA)
+        {"saint vincent og grenadinerne", TERRITORY_VCT, 0x00000020},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DE)
+        {"saint vincent und die grenadinen", TERRITORY_VCT, 0x00000040},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"saint vincent ve grenadines", TERRITORY_VCT, 0x02000000},
+#endif
+        {"saint-barthelemy", TERRITORY_BLM, 0x0bbcc6b1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FR)
+        {"saint-christophe-et-nieves", TERRITORY_KNA, 0x00000400},
+        {"saint-marin", TERRITORY_SMR, 0x00000400},
+#endif
+        {"saint-martin", TERRITORY_SXM, 0x08000400},
+        {"saint-martin", TERRITORY_MAF, 0x0bacc671},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FR)
+        {"saint-petersbourg", TERRITORY_RU_SPE, 0x00000400},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CS)
+        {"saint-pierre a miquelon", TERRITORY_SPM, 0x00000010},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AF) || defined(MAPCODE_SUPPORT_LANGUAGE_NL)
+        {"saint-pierre en miquelon", TERRITORY_SPM, 0x00040001},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PL)
+        {"saint-pierre i miquelon", TERRITORY_SPM, 0x00200000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FI)
+        {"saint-pierre ja miquelon", TERRITORY_SPM, 0x00000200},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_NO)
+        {"saint-pierre og miquelon", TERRITORY_SPM, 0x00080000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DE)
+        {"saint-pierre und miquelon", TERRITORY_SPM, 0x00000040},
+#endif
+        {"saint-pierre-et-miquelon", TERRITORY_SPM, 0x08000400},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FR)
+        {"saint-siege", TERRITORY_VAT, 0x00000400},
+        {"saint-vincent-et-les-grenadines", TERRITORY_VCT, 0x00000400},
+        {"sainte-helene, ascension et tristan da cunha", TERRITORY_SHN, 0x00000400},
+#endif
+        {"sainte-lucie", TERRITORY_LCA, 0x08000400},
+        {"sakartvelo", TERRITORY_GEO, 0x08000000},
+        {"sakha republic", TERRITORY_RU_SA, 0x01000080},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AF) || defined(MAPCODE_SUPPORT_LANGUAGE_NL)
+        {"sakha republiek", TERRITORY_RU_SA, 0x00040001},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DA)
+        {"sakha republik", TERRITORY_RU_SA, 0x00000020},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_NO)
+        {"sakha republikk", TERRITORY_RU_SA, 0x00080000},
+#endif
+        {"sakhalin oblast", TERRITORY_RU_SAK, 0x039cc0b1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FI)
+        {"saksa", TERRITORY_DEU, 0x00000200},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CS)
+        {"salamounovy ostrovy", TERRITORY_SLB, 0x00000010},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DE)
+        {"salomon-inseln", TERRITORY_SLB, 0x00000040},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PL)
+        {"salomona, wyspy", TERRITORY_SLB, 0x00200000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_SV)
+        {"salomonoarna", TERRITORY_SLB, 0x00800000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FI)
+        {"salomonsaaret", TERRITORY_SLB, 0x00000200},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"salomonski otoci", TERRITORY_SLB, 0x00002000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DA)
+        {"salomonøerne", TERRITORY_SLB, 0x00000020},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_NO)
+        {"salomonøyene", TERRITORY_SLB, 0x00080000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DA) || defined(MAPCODE_SUPPORT_LANGUAGE_FR) || defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"salvador", TERRITORY_SLV, 0x00002420},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PL)
+        {"salwador", TERRITORY_SLV, 0x00200000},
+#endif
+        {"samara oblast", TERRITORY_RU_SAM, 0x03bce1e1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FI)
+        {"samaran alue", TERRITORY_RU_SAM, 0x00000200},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CS)
+        {"samarska oblast", TERRITORY_RU_SAM, 0x00000010},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DE) || defined(MAPCODE_SUPPORT_LANGUAGE_FI)
+        {"sambia", TERRITORY_ZMB, 0x00000240},
+#endif
+        {"samoa", TERRITORY_WSM, 0x0bbce7f1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FR)
+        {"samoa americaines", TERRITORY_ASM, 0x00000400},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ES) || defined(MAPCODE_SUPPORT_LANGUAGE_PT)
+        {"samoa americana", TERRITORY_ASM, 0x00100100},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_IT)
+        {"samoa americane", TERRITORY_ASM, 0x00008000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ID)
+        {"samoa amerika", TERRITORY_ASM, 0x00004000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PL)
+        {"samoa amerykanskie", TERRITORY_ASM, 0x00200000},
+#endif
+        {"samoa, american", TERRITORY_ASM, 0x01000090},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"samoa, americka", TERRITORY_ASM, 0x00002000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ID)
+        {"samoa, amerika", TERRITORY_ASM, 0x00004000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_NL)
+        {"samoa, amerikaans", TERRITORY_ASM, 0x00040000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AF)
+        {"samoa, amerikaanse", TERRITORY_ASM, 0x00000001},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DE)
+        {"samoa, amerikanisch", TERRITORY_ASM, 0x00000040},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DA) || defined(MAPCODE_SUPPORT_LANGUAGE_NO) || defined(MAPCODE_SUPPORT_LANGUAGE_SV)
+        {"samoa, amerikansk", TERRITORY_ASM, 0x00880020},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FI)
+        {"samoa, amerikkalainen", TERRITORY_ASM, 0x00000200},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ES)
+        {"san bartolome", TERRITORY_BLM, 0x00000100},
+        {"san cristobal y nieves", TERRITORY_KNA, 0x00000100},
+        {"san eustaquio", TERRITORY_BES, 0x00000100},
+#endif
+        {"san luis potosi", TERRITORY_MX_SLP, 0x0bbce7f1},
+        {"san marino", TERRITORY_SMR, 0x0bbce3f1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ES)
+        {"san martin", TERRITORY_MAF, 0x00000100},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_IT)
+        {"san paolo", TERRITORY_BR_SP, 0x00008000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PL)
+        {"san paulo", TERRITORY_BR_SP, 0x00200000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ES)
+        {"san pedro y miquelon", TERRITORY_SPM, 0x00000100},
+        {"san petersburgo", TERRITORY_RU_SPE, 0x00000100},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_IT)
+        {"san pietroburgo", TERRITORY_RU_SPE, 0x00008000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ES)
+        {"san vicente y las granadinas", TERRITORY_VCT, 0x00000100},
+#endif
+        {"sancta sedes", TERRITORY_VAT, 0x08000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PL)
+        {"sandwich południowy", TERRITORY_SGS, 0x00200000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FI)
+        {"sandwichsaaret", TERRITORY_SGS, 0x00000200},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"sangaj", TERRITORY_CN_SH, 0x00002000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"sangay", TERRITORY_CN_SH, 0x02000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DE)
+        {"sankt bartholomaus", TERRITORY_BLM, 0x00000040},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DA)
+        {"sankt petersborg", TERRITORY_RU_SPE, 0x00000020},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PL) || defined(MAPCODE_SUPPORT_LANGUAGE_SV)
+        {"sankt petersburg", TERRITORY_RU_SPE, 0x00a00000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_IT)
+        {"sant`elena, ascensione e tristan da cunha", TERRITORY_SHN, 0x00008000},
+#endif
+        {"santa catarina", TERRITORY_BR_SC, 0x0bbce7f1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PT)
+        {"santa helena, ascensao e tristao da cunha", TERRITORY_SHN, 0x00100000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ES)
+        {"santa helena, ascension y tristan da cunha", TERRITORY_SHN, 0x00000100},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ES) || defined(MAPCODE_SUPPORT_LANGUAGE_IT) || defined(MAPCODE_SUPPORT_LANGUAGE_PT)
+        {"santa lucia", TERRITORY_LCA, 0x00108100},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PT)
+        {"santa se", TERRITORY_VAT, 0x00100000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ES) || defined(MAPCODE_SUPPORT_LANGUAGE_IT)
+        {"santa sede", TERRITORY_VAT, 0x00008100},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ES)
+        {"santo tome y principe", TERRITORY_STP, 0x00000100},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PT)
+        {"sao bartolomeu", TERRITORY_BLM, 0x00100000},
+        {"sao cristovao e nevis", TERRITORY_KNA, 0x00100000},
+#endif
+        {"sao paulo", TERRITORY_BR_SP, 0x0b9c67f1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PT)
+        {"sao petersburgo", TERRITORY_RU_SPE, 0x00100000},
+        {"sao pierre e miquelon", TERRITORY_SPM, 0x00100000},
+#endif
+        {"sao tome", TERRITORY_STP, 0x08000080},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CS)
+        {"sao tome a principe", TERRITORY_STP, 0x00000010},
+#endif
+        {"sao tome and principe", TERRITORY_STP, 0x00000080},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ID)
+        {"sao tome dan principe", TERRITORY_STP, 0x00004000},
+#endif
+        {"sao tome e principe", TERRITORY_STP, 0x08108000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AF) || defined(MAPCODE_SUPPORT_LANGUAGE_NL)
+        {"sao tome en principe", TERRITORY_STP, 0x00040001},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FI)
+        {"sao tome ja principe", TERRITORY_STP, 0x00000200},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_SW)
+        {"sao tome na principe", TERRITORY_STP, 0x01000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_SV)
+        {"sao tome och principe", TERRITORY_STP, 0x00800000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DA) || defined(MAPCODE_SUPPORT_LANGUAGE_NO)
+        {"sao tome og principe", TERRITORY_STP, 0x00080020},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DE)
+        {"sao tome und principe", TERRITORY_STP, 0x00000040},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"sao tome ve principe", TERRITORY_STP, 0x02000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FR)
+        {"sao tome-et-principe", TERRITORY_STP, 0x00000400},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PT)
+        {"sao vicente e granadinas", TERRITORY_VCT, 0x00100000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AF)
+        {"saoedi-arabie", TERRITORY_SAU, 0x00000001},
+#endif
+        {"saratov oblast", TERRITORY_RU_SAR, 0x039c60f1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FI)
+        {"saratovin alue", TERRITORY_RU_SAR, 0x00000200},
+#endif
+        {"saskatchewan", TERRITORY_CA_SK, 0x0bbce7f1},
+        {"sau", TERRITORY_SAU, 0x10000000},
+        {"saudi arabia", TERRITORY_SAU, 0x09000080},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DA)
+        {"saudi arabien", TERRITORY_SAU, 0x00000020},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FI) || defined(MAPCODE_SUPPORT_LANGUAGE_NO)
+        {"saudi-arabia", TERRITORY_SAU, 0x00080200},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_NL)
+        {"saudi-arabie", TERRITORY_SAU, 0x00040000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DE)
+        {"saudi-arabien", TERRITORY_SAU, 0x00000040},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_SV)
+        {"saudiarabien", TERRITORY_SAU, 0x00800000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"saudijska arabija", TERRITORY_SAU, 0x00002000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CS)
+        {"saudska arabie", TERRITORY_SAU, 0x00000010},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"savezna oblast", TERRITORY_MX_DIF, 0x00002000},
+        {"savezna oblast", TERRITORY_BR_DF, 0x00002000},
+        {"savezne drzave mikronezije", TERRITORY_FSM, 0x00002000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_NL)
+        {"schotland", TERRITORY_GBR, 0x00040000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DE)
+        {"schweden", TERRITORY_SWE, 0x00000040},
+#endif
+        {"schweiz", TERRITORY_CHE, 0x08800060},
+        {"scotland", TERRITORY_GBR, 0x01000080},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_IT)
+        {"scozia", TERRITORY_GBR, 0x00008000},
+#endif
+        {"sdn", TERRITORY_SDN, 0x10000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"sejseli", TERRITORY_SYC, 0x00002000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ID)
+        {"selandia baru", TERRITORY_NZL, 0x00004000},
+#endif
+        {"sen", TERRITORY_SEN, 0x10000000},
+        {"senegal", TERRITORY_SEN, 0x0bbce7f1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AF)
+        {"sentraal-afrikaanse republiek", TERRITORY_CAF, 0x00000001},
+#endif
+        {"serbia", TERRITORY_SRB, 0x012cc3e0},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FR)
+        {"serbie", TERRITORY_SRB, 0x00000400},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_SV)
+        {"serbien", TERRITORY_SRB, 0x00800000},
+#endif
+        {"sergipe", TERRITORY_BR_SE, 0x0bbce7f1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PT)
+        {"serra leoa", TERRITORY_SLE, 0x00100000},
+        {"servia", TERRITORY_SRB, 0x00100000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AF)
+        {"serwie", TERRITORY_SRB, 0x00000001},
+#endif
+        {"sesel", TERRITORY_SYC, 0x08000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PL)
+        {"seszele", TERRITORY_SYC, 0x00200000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CS)
+        {"severni dakota", TERRITORY_US_ND, 0x00000010},
+        {"severni irsko", TERRITORY_GBR, 0x00000010},
+        {"severni karolina", TERRITORY_US_NC, 0x00000010},
+        {"severni korea", TERRITORY_PRK, 0x00000010},
+        {"severni mariany", TERRITORY_MNP, 0x00000010},
+        {"severni osetie-alanie republic", TERRITORY_RU_SE, 0x00000010},
+        {"severozapadni teritoria", TERRITORY_CA_NT, 0x00000010},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AF)
+        {"seychelle", TERRITORY_SYC, 0x00000001},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DE) || defined(MAPCODE_SUPPORT_LANGUAGE_NL)
+        {"seychellen", TERRITORY_SYC, 0x00040040},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_NO)
+        {"seychellene", TERRITORY_SYC, 0x00080000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_SV)
+        {"seychellerna", TERRITORY_SYC, 0x00800000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DA)
+        {"seychellerne", TERRITORY_SYC, 0x00000020},
+#endif
+        {"seychelles", TERRITORY_SYC, 0x0810c580},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FI)
+        {"seychellit", TERRITORY_SYC, 0x00000200},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CS)
+        {"seychely", TERRITORY_SYC, 0x00000010},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"seyseller", TERRITORY_SYC, 0x02000000},
+#endif
+        {"sgp", TERRITORY_SGP, 0x10000000},
+        {"sgs", TERRITORY_SGS, 0x10000000},
+        {"sgssi", TERRITORY_SGS, 0x08000000},
+        {"shaanxi", TERRITORY_CN_SN, 0x03bce5f1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FI)
+        {"shaanxin", TERRITORY_CN_SN, 0x00000200},
+#endif
+        {"shandong", TERRITORY_CN_SD, 0x03bce7f1},
+        {"shanghai", TERRITORY_CN_SH, 0x018886f0},
+        {"shanxi", TERRITORY_CN_SX, 0x03bce7f1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_SW)
+        {"shelisheli", TERRITORY_SYC, 0x01000000},
+        {"shirikisho la mikronesia", TERRITORY_FSM, 0x01000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CS)
+        {"shledani", TERRITORY_REU, 0x00000010},
+#endif
+        {"shn", TERRITORY_SHN, 0x10000000},
+        {"shqiperi", TERRITORY_ALB, 0x08000000},
+        {"shqiperia", TERRITORY_ALB, 0x08000000},
+        {"shqipni", TERRITORY_ALB, 0x08000000},
+        {"shqypni", TERRITORY_ALB, 0x08000000},
+        {"sichuan", TERRITORY_CN_SC, 0x039ce7f1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ES)
+        {"sierra leona", TERRITORY_SLE, 0x00000100},
+#endif
+        {"sierra leone", TERRITORY_SLE, 0x0bacc6f1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"sijera leone", TERRITORY_SLE, 0x00002000},
+#endif
+        {"sikkim", TERRITORY_IN_SK, 0x03bce7f1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"sili", TERRITORY_CHL, 0x02000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DE)
+        {"simbabwe", TERRITORY_ZWE, 0x00000040},
+#endif
+        {"sinaloa", TERRITORY_MX_SIN, 0x0bbce7f1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"sincan uygur", TERRITORY_CN_XJ, 0x02000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AF)
+        {"singapoer", TERRITORY_SGP, 0x00000001},
+#endif
+        {"singapore", TERRITORY_SGP, 0x018c82b0},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FR)
+        {"singapour", TERRITORY_SGP, 0x00000400},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DE) || defined(MAPCODE_SUPPORT_LANGUAGE_ES) || defined(MAPCODE_SUPPORT_LANGUAGE_HR) || defined(MAPCODE_SUPPORT_LANGUAGE_PL) || defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"singapur", TERRITORY_SGP, 0x02202140},
+#endif
+        {"singapura", TERRITORY_SGP, 0x08004000},
+        {"sint eustatius", TERRITORY_BES, 0x08080000},
+        {"sint maarten", TERRITORY_SXM, 0x0bbcc3f1},
+        {"sint maarten", TERRITORY_MAF, 0x08000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_NL)
+        {"sint-helena, ascension en tristan da cunha", TERRITORY_SHN, 0x00040000},
+        {"sint-petersburg", TERRITORY_RU_SPE, 0x00040000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ID)
+        {"siprus", TERRITORY_CYP, 0x00004000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ES) || defined(MAPCODE_SUPPORT_LANGUAGE_IT) || defined(MAPCODE_SUPPORT_LANGUAGE_PT)
+        {"siria", TERRITORY_SYR, 0x00108100},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AF)
+        {"sirie", TERRITORY_SYR, 0x00000001},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"sirija", TERRITORY_SYR, 0x00002000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AF) || defined(MAPCODE_SUPPORT_LANGUAGE_NL)
+        {"sjanghai", TERRITORY_CN_SH, 0x00040001},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"sjedinjene americke drzave", TERRITORY_USA, 0x00002000},
+        {"sjeverna dakota", TERRITORY_US_ND, 0x00002000},
+        {"sjeverna irska", TERRITORY_GBR, 0x00002000},
+        {"sjeverna karolina", TERRITORY_US_NC, 0x00002000},
+        {"sjeverna koreja", TERRITORY_PRK, 0x00002000},
+        {"sjeverna osetija-alanija republika", TERRITORY_RU_SE, 0x00002000},
+        {"sjeverni marijanski otoci", TERRITORY_MNP, 0x00002000},
+        {"sjeverni teritorij", TERRITORY_AU_NT, 0x00002000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AF)
+        {"sjina", TERRITORY_CHN, 0x00000001},
+#endif
+        {"sjm", TERRITORY_SJM, 0x10000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AF)
+        {"skotland", TERRITORY_GBR, 0x00000001},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ID)
+        {"skotlandia", TERRITORY_GBR, 0x00004000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FI)
+        {"skotlanti", TERRITORY_GBR, 0x00000200},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"skotska", TERRITORY_GBR, 0x00002000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CS)
+        {"skotsko", TERRITORY_GBR, 0x00000010},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_NO) || defined(MAPCODE_SUPPORT_LANGUAGE_SV)
+        {"skottland", TERRITORY_GBR, 0x00880000},
+#endif
+        {"slb", TERRITORY_SLB, 0x10000000},
+        {"sle", TERRITORY_SLE, 0x10000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_IT)
+        {"slovacchia", TERRITORY_SVK, 0x00008000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"slovacka", TERRITORY_SVK, 0x00002000},
+#endif
+        {"slovak republic", TERRITORY_SVK, 0x00000080},
+        {"slovakia", TERRITORY_SVK, 0x01084280},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_SV)
+        {"slovakien", TERRITORY_SVK, 0x00800000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DA)
+        {"slovakiet", TERRITORY_SVK, 0x00000020},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"slovakya", TERRITORY_SVK, 0x02000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FR)
+        {"slovaquie", TERRITORY_SVK, 0x00000400},
+#endif
+        {"slovenia", TERRITORY_SVN, 0x0108c280},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FR) || defined(MAPCODE_SUPPORT_LANGUAGE_NL)
+        {"slovenie", TERRITORY_SVN, 0x00040400},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DA) || defined(MAPCODE_SUPPORT_LANGUAGE_SV)
+        {"slovenien", TERRITORY_SVN, 0x00800020},
+#endif
+        {"slovenija", TERRITORY_SVN, 0x08002000},
+        {"slovensko", TERRITORY_SVK, 0x08000010},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"slovenya", TERRITORY_SVN, 0x02000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CS)
+        {"slovinsko", TERRITORY_SVN, 0x00000010},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DE)
+        {"slowakei", TERRITORY_SVK, 0x00000040},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_NL)
+        {"slowakije", TERRITORY_SVK, 0x00040000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AF)
+        {"slowakye", TERRITORY_SVK, 0x00000001},
+        {"slowenie", TERRITORY_SVN, 0x00000001},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DE)
+        {"slowenien", TERRITORY_SVN, 0x00000040},
+#endif
+        {"slv", TERRITORY_SLV, 0x10000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_IT)
+        {"smolensk", TERRITORY_RU_SMO, 0x00008000},
+#endif
+        {"smolensk oblast", TERRITORY_RU_SMO, 0x039c40e1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CS) || defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"smolenska oblast", TERRITORY_RU_SMO, 0x00002010},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FI)
+        {"smolenskin alue", TERRITORY_RU_SMO, 0x00000200},
+#endif
+        {"smr", TERRITORY_SMR, 0x10000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_SV)
+        {"sodra sudan", TERRITORY_SSD, 0x00800000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AF) || defined(MAPCODE_SUPPORT_LANGUAGE_NL)
+        {"soedan", TERRITORY_SDN, 0x00040001},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"solomon adaları", TERRITORY_SLB, 0x02000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AF)
+        {"solomon eilande", TERRITORY_SLB, 0x00000001},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_NL)
+        {"solomon eilanden", TERRITORY_SLB, 0x00040000},
+#endif
+        {"solomon islands", TERRITORY_SLB, 0x08000080},
+        {"som", TERRITORY_SOM, 0x10000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"somali", TERRITORY_SOM, 0x02000000},
+#endif
+        {"somalia", TERRITORY_SOM, 0x01b8c3e0},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AF) || defined(MAPCODE_SUPPORT_LANGUAGE_FR) || defined(MAPCODE_SUPPORT_LANGUAGE_NL)
+        {"somalie", TERRITORY_SOM, 0x00040401},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"somalija", TERRITORY_SOM, 0x00002000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CS)
+        {"somalsko", TERRITORY_SOM, 0x00000010},
+#endif
+        {"somers isles", TERRITORY_BMU, 0x00000080},
+        {"sonora", TERRITORY_MX_SON, 0x0bbce7f1},
+        {"soomaaliya", TERRITORY_SOM, 0x08000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PL)
+        {"sos tabasco", TERRITORY_MX_TAB, 0x00200000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FR)
+        {"soudan", TERRITORY_SDN, 0x00000400},
+#endif
+        {"south africa", TERRITORY_ZAF, 0x00000080},
+        {"south australia", TERRITORY_AU_SA, 0x088c22e0},
+        {"south carolina", TERRITORY_US_SC, 0x0b8440e0},
+        {"south dakota", TERRITORY_US_SD, 0x0b8442e1},
+        {"south georgia", TERRITORY_SGS, 0x00000080},
+        {"south georgia and the south sandwich islands", TERRITORY_SGS, 0x00000080},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_SW)
+        {"south georgia na south sandwich islands", TERRITORY_SGS, 0x01000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DA)
+        {"south georgia og de sydlige sandwichøer", TERRITORY_SGS, 0x00000020},
+#endif
+        {"south korea", TERRITORY_KOR, 0x08000080},
+        {"south sandwich islands", TERRITORY_SGS, 0x00004080},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DE)
+        {"south sandwich-inseln", TERRITORY_SGS, 0x00000040},
+#endif
+        {"south sudan", TERRITORY_SSD, 0x08000080},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_IT)
+        {"spagna", TERRITORY_ESP, 0x00008000},
+#endif
+        {"spain", TERRITORY_ESP, 0x00000080},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CS)
+        {"spanelsko", TERRITORY_ESP, 0x00000010},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_NO)
+        {"spania", TERRITORY_ESP, 0x00080000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DA) || defined(MAPCODE_SUPPORT_LANGUAGE_DE) || defined(MAPCODE_SUPPORT_LANGUAGE_SV)
+        {"spanien", TERRITORY_ESP, 0x00800060},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AF) || defined(MAPCODE_SUPPORT_LANGUAGE_NL)
+        {"spanje", TERRITORY_ESP, 0x00040001},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"spanjolska", TERRITORY_ESP, 0x00002000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ID)
+        {"spanyol", TERRITORY_ESP, 0x00004000},
+#endif
+        {"spitsbergen", TERRITORY_SJM, 0x00000080},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DE)
+        {"spitzbergen", TERRITORY_SJM, 0x00000040},
+#endif
+        {"spm", TERRITORY_SPM, 0x10000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CS)
+        {"spojene arabske emiraty", TERRITORY_ARE, 0x00000010},
+        {"spojene kralovstvi", TERRITORY_GBR, 0x00000010},
+#endif
+        {"srb", TERRITORY_SRB, 0x10000000},
+        {"srbija", TERRITORY_SRB, 0x08002000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CS)
+        {"srbsko", TERRITORY_SRB, 0x00000010},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"srednjoafricka republika", TERRITORY_CAF, 0x00002000},
+#endif
+        {"sri lanka", TERRITORY_LKA, 0x0bbca7f1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ID)
+        {"srilanka", TERRITORY_LKA, 0x00004000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PL)
+        {"srodkowoafrykanska, republika", TERRITORY_CAF, 0x00200000},
+#endif
+        {"ssd", TERRITORY_SSD, 0x10000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FR)
+        {"st eustache", TERRITORY_BES, 0x00000400},
+#endif
+        {"st eustasius", TERRITORY_BES, 0x000400a0},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AF) || defined(MAPCODE_SUPPORT_LANGUAGE_CS) || defined(MAPCODE_SUPPORT_LANGUAGE_DE) || defined(MAPCODE_SUPPORT_LANGUAGE_FI) || defined(MAPCODE_SUPPORT_LANGUAGE_ID) || defined(MAPCODE_SUPPORT_LANGUAGE_IT) || defined(MAPCODE_SUPPORT_LANGUAGE_PT) || defined(MAPCODE_SUPPORT_LANGUAGE_SV) || defined(MAPCODE_SUPPORT_LANGUAGE_SW) || defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"st eustatius", TERRITORY_BES, 0x0390c251},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AF)
+        {"st vincent en die grenadine", TERRITORY_VCT, 0x00000001},
+        {"stan republiek", TERRITORY_RU_DA, 0x00000001},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PL)
+        {"stany zjednoczone", TERRITORY_USA, 0x00200000},
+#endif
+        {"state of palestine", TERRITORY_PSE, 0x00000080},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_IT)
+        {"stati federati di micronesia", TERRITORY_FSM, 0x00008000},
+        {"stati uniti d`america", TERRITORY_USA, 0x00008000},
+#endif
+        {"statia", TERRITORY_BES, 0x08000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_IT)
+        {"stato del messico", TERRITORY_MX_MX, 0x00008000},
+#endif
+        {"stavropol krai", TERRITORY_RU_STA, 0x039c41b1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FI)
+        {"stavropolin aluepiiri", TERRITORY_RU_STA, 0x00000200},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"stavropoljski kraj", TERRITORY_RU_STA, 0x00002000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DE)
+        {"stawropol", TERRITORY_RU_STA, 0x00000040},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_NO)
+        {"storbritannia", TERRITORY_GBR, 0x00080000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DA) || defined(MAPCODE_SUPPORT_LANGUAGE_SV)
+        {"storbritannien", TERRITORY_GBR, 0x00800020},
+#endif
+        {"stp", TERRITORY_STP, 0x10000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CS)
+        {"stredoafricka republika", TERRITORY_CAF, 0x00000010},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PL)
+        {"suazi", TERRITORY_SWZ, 0x00200000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PT)
+        {"suazilandia", TERRITORY_SWZ, 0x00100000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_IT)
+        {"sud africa", TERRITORY_ZAF, 0x00008000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FR)
+        {"sud-soudan", TERRITORY_SSD, 0x00000400},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DE)
+        {"sud-sudan", TERRITORY_SSD, 0x00000040},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ES)
+        {"sudafrica", TERRITORY_ZAF, 0x00000100},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DE)
+        {"sudafrika", TERRITORY_ZAF, 0x00000040},
+#endif
+        {"sudan", TERRITORY_SDN, 0x0ba8e3f0},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_IT)
+        {"sudan del sud", TERRITORY_SSD, 0x00008000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ES)
+        {"sudan del sur", TERRITORY_SSD, 0x00000100},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_SW)
+        {"sudan kusini", TERRITORY_SSD, 0x01000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PL)
+        {"sudan południowy", TERRITORY_SSD, 0x00200000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ID)
+        {"sudan selatan", TERRITORY_SSD, 0x00004000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PT)
+        {"sudao", TERRITORY_SDN, 0x00100000},
+        {"sudao do sul", TERRITORY_SSD, 0x00100000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DE)
+        {"sudgeorgien und die sudlichen sandwich-inseln", TERRITORY_SGS, 0x00000040},
+        {"sudkorea", TERRITORY_KOR, 0x00000040},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ES) || defined(MAPCODE_SUPPORT_LANGUAGE_PT)
+        {"suecia", TERRITORY_SWE, 0x00100100},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FR)
+        {"suede", TERRITORY_SWE, 0x00000400},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PT)
+        {"suica", TERRITORY_CHE, 0x00100000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AF)
+        {"suid carolina", TERRITORY_US_SC, 0x00000001},
+#endif
+        {"suid-afrika", TERRITORY_ZAF, 0x08000001},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AF)
+        {"suid-australie", TERRITORY_AU_SA, 0x00000001},
+        {"suid-georgie en die suid-sandwich eilande", TERRITORY_SGS, 0x00000001},
+        {"suid-korea", TERRITORY_KOR, 0x00000001},
+        {"suid-sandwich eilande", TERRITORY_SGS, 0x00000001},
+        {"suid-soedan", TERRITORY_SSD, 0x00000001},
+#endif
+        {"suisse", TERRITORY_CHE, 0x08000400},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ES)
+        {"suiza", TERRITORY_CHE, 0x00000100},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PT)
+        {"sul da australia", TERRITORY_AU_SA, 0x00100000},
+#endif
+        {"suomi", TERRITORY_FIN, 0x08000200},
+        {"sur", TERRITORY_SUR, 0x10000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ID)
+        {"suriah", TERRITORY_SYR, 0x00004000},
+#endif
+        {"surinam", TERRITORY_SUR, 0x0b282070},
+        {"suriname", TERRITORY_SUR, 0x0894c781},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"suriye", TERRITORY_SYR, 0x02000000},
+        {"suudi arabistan", TERRITORY_SAU, 0x02000000},
+#endif
+        {"svalbard", TERRITORY_SJM, 0x00000080},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CS)
+        {"svalbard a jan mayen", TERRITORY_SJM, 0x00000010},
+#endif
+        {"svalbard and jan mayen", TERRITORY_SJM, 0x000400a0},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ID)
+        {"svalbard dan jan mayen", TERRITORY_SJM, 0x00004000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_IT) || defined(MAPCODE_SUPPORT_LANGUAGE_PT)
+        {"svalbard e jan mayen", TERRITORY_SJM, 0x00108000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AF)
+        {"svalbard en jan mayen", TERRITORY_SJM, 0x00000001},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FR)
+        {"svalbard et jan mayen", TERRITORY_SJM, 0x00000400},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR) || defined(MAPCODE_SUPPORT_LANGUAGE_PL)
+        {"svalbard i jan mayen", TERRITORY_SJM, 0x00202000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_SW)
+        {"svalbard na jan mayen", TERRITORY_SJM, 0x01000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_SV)
+        {"svalbard och jan mayen", TERRITORY_SJM, 0x00800000},
+#endif
+        {"svalbard og jan mayen", TERRITORY_SJM, 0x08080000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"svalbard ve jan mayen", TERRITORY_SJM, 0x02000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ES)
+        {"svalbard y jan mayen", TERRITORY_SJM, 0x00000100},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CS)
+        {"svata helena, ascension a tristan da cunha", TERRITORY_SHN, 0x00000010},
+        {"svata lucie", TERRITORY_LCA, 0x00000010},
+        {"svaty krystof a nevis", TERRITORY_KNA, 0x00000010},
+        {"svaty stolec", TERRITORY_VAT, 0x00000010},
+        {"svaty vincenc a grenadiny", TERRITORY_VCT, 0x00000010},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"svazi", TERRITORY_SWZ, 0x00002000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CS)
+        {"svazijsko", TERRITORY_SWZ, 0x00000010},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"svaziland", TERRITORY_SWZ, 0x02000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"svedska", TERRITORY_SWE, 0x00002000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CS)
+        {"svedsko", TERRITORY_SWE, 0x00000010},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_NO)
+        {"sveits", TERRITORY_CHE, 0x00080000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FI)
+        {"sveitsi", TERRITORY_CHE, 0x00000200},
+#endif
+        {"sverdlovsk oblast", TERRITORY_RU_SVE, 0x038ce0b1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FI)
+        {"sverdlovskin alue", TERRITORY_RU_SVE, 0x00000200},
+#endif
+        {"sverige", TERRITORY_SWE, 0x08880020},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CS)
+        {"svet", TERRITORY_AAA, 0x00000010},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"sveta helena otok, ascension i tristan da cunha", TERRITORY_SHN, 0x00002000},
+        {"sveta lucija", TERRITORY_LCA, 0x00002000},
+        {"sveta stolica", TERRITORY_VAT, 0x00002000},
+        {"sveti bartolomej", TERRITORY_BLM, 0x00002000},
+        {"sveti eustazije", TERRITORY_BES, 0x00002000},
+        {"sveti kristofor i nevis", TERRITORY_KNA, 0x00002000},
+        {"sveti martin nld", TERRITORY_SXM, 0x00002000},
+        {"sveti martin otok fra", TERRITORY_MAF, 0x00002000},
+        {"sveti petar i mikelon", TERRITORY_SPM, 0x00002000},
+        {"sveti toma i princip", TERRITORY_STP, 0x00002000},
+        {"sveti vincent i grenadini", TERRITORY_VCT, 0x00002000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_IT)
+        {"svezia", TERRITORY_SWE, 0x00008000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"svicarska", TERRITORY_CHE, 0x00002000},
+        {"svijet", TERRITORY_AAA, 0x00002000},
+#endif
+        {"svizzera", TERRITORY_CHE, 0x08008000},
+        {"svk", TERRITORY_SVK, 0x10000000},
+        {"svn", TERRITORY_SVN, 0x10000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CS)
+        {"svycarsko", TERRITORY_CHE, 0x00000010},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DE)
+        {"swasiland", TERRITORY_SWZ, 0x00000040},
+#endif
+        {"swaziland", TERRITORY_SWZ, 0x018cc4a1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ES)
+        {"swazilandia", TERRITORY_SWZ, 0x00000100},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FI)
+        {"swazimaa", TERRITORY_SWZ, 0x00000200},
+#endif
+        {"swe", TERRITORY_SWE, 0x10000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AF)
+        {"swede", TERRITORY_SWE, 0x00000001},
+#endif
+        {"sweden", TERRITORY_SWE, 0x01000080},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ID)
+        {"swedia", TERRITORY_SWE, 0x00004000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PL)
+        {"swietego tomasza i ksiazeca, wyspy", TERRITORY_STP, 0x00200000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ID)
+        {"swiss", TERRITORY_CHE, 0x00004000},
+#endif
+        {"swiss confederation", TERRITORY_CHE, 0x00000080},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AF)
+        {"switserland", TERRITORY_CHE, 0x00000001},
+#endif
+        {"switzerland", TERRITORY_CHE, 0x01000080},
+        {"swz", TERRITORY_SWZ, 0x10000000},
+        {"sxm", TERRITORY_SXM, 0x10000000},
+        {"syc", TERRITORY_SYC, 0x10000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PL)
+        {"syczuan", TERRITORY_CN_SC, 0x00200000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DA) || defined(MAPCODE_SUPPORT_LANGUAGE_SV)
+        {"sydafrika", TERRITORY_ZAF, 0x00800020},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_SV)
+        {"sydgeorgien och sydsandwichoarna", TERRITORY_SGS, 0x00800000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DA) || defined(MAPCODE_SUPPORT_LANGUAGE_SV)
+        {"sydkorea", TERRITORY_KOR, 0x00800020},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_SV)
+        {"sydsandwichoarna", TERRITORY_SGS, 0x00800000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DA)
+        {"sydsandwichøerne", TERRITORY_SGS, 0x00000020},
+        {"sydsudan", TERRITORY_SSD, 0x00000020},
+#endif
+        {"syr", TERRITORY_SYR, 0x10000000},
+        {"syria", TERRITORY_SYR, 0x09280080},
+        {"syrian arab republic", TERRITORY_SYR, 0x00000080},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CS) || defined(MAPCODE_SUPPORT_LANGUAGE_FR) || defined(MAPCODE_SUPPORT_LANGUAGE_NL)
+        {"syrie", TERRITORY_SYR, 0x00040410},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DA) || defined(MAPCODE_SUPPORT_LANGUAGE_DE) || defined(MAPCODE_SUPPORT_LANGUAGE_SV)
+        {"syrien", TERRITORY_SYR, 0x00800060},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FI)
+        {"syyria", TERRITORY_SYR, 0x00000200},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PL)
+        {"szanghaj", TERRITORY_CN_SH, 0x00200000},
+        {"szwajcaria", TERRITORY_CHE, 0x00200000},
+        {"szwecja", TERRITORY_SWE, 0x00200000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_NO)
+        {"sør-afrika", TERRITORY_ZAF, 0x00080000},
+        {"sør-carolina", TERRITORY_US_SC, 0x00080000},
+        {"sør-dakota", TERRITORY_US_SD, 0x00080000},
+        {"sør-georgia og sør-sandwichøyene", TERRITORY_SGS, 0x00080000},
+        {"sør-korea", TERRITORY_KOR, 0x00080000},
+        {"sør-sandwichøyene", TERRITORY_SGS, 0x00080000},
+        {"sør-sudan", TERRITORY_SSD, 0x00080000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"sırbistan", TERRITORY_SRB, 0x02000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PL)
+        {"słowacja", TERRITORY_SVK, 0x00200000},
+        {"słowenia", TERRITORY_SVN, 0x00200000},
+#endif
+        {"taaf", TERRITORY_ATF, 0x08000000},
+        {"tabasco", TERRITORY_MX_TAB, 0x099ce7f1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"tabasko", TERRITORY_MX_TAB, 0x02000000},
+        {"tacikistan", TERRITORY_TJK, 0x02000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AF) || defined(MAPCODE_SUPPORT_LANGUAGE_FR)
+        {"tadjikistan", TERRITORY_TJK, 0x00000401},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DE)
+        {"tadschikistan", TERRITORY_TJK, 0x00000040},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DA) || defined(MAPCODE_SUPPORT_LANGUAGE_NO)
+        {"tadsjikistan", TERRITORY_TJK, 0x00080020},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CS) || defined(MAPCODE_SUPPORT_LANGUAGE_FI) || defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"tadzikistan", TERRITORY_TJK, 0x00002210},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_NL) || defined(MAPCODE_SUPPORT_LANGUAGE_SV)
+        {"tadzjikistan", TERRITORY_TJK, 0x00840000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PL)
+        {"tadzykistan", TERRITORY_TJK, 0x00200000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ES) || defined(MAPCODE_SUPPORT_LANGUAGE_IT) || defined(MAPCODE_SUPPORT_LANGUAGE_PT)
+        {"tailandia", TERRITORY_THA, 0x00108100},
+#endif
+        {"taiwan", TERRITORY_TWN, 0x019cc7e1},
+        {"tajikistan", TERRITORY_TJK, 0x0100c080},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PT)
+        {"tajiquistao", TERRITORY_TJK, 0x00100000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"tajland", TERRITORY_THA, 0x00002000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PL)
+        {"tajlandia", TERRITORY_THA, 0x00200000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"tajvan", TERRITORY_TWN, 0x00002000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PL)
+        {"tajwan", TERRITORY_TWN, 0x00200000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FI)
+        {"taka-baikalian aluepiiri", TERRITORY_RU_ZAB, 0x00000200},
+#endif
+        {"tamaulipas", TERRITORY_MX_TAM, 0x0bbce7f1},
+        {"tambov oblast", TERRITORY_RU_TT, 0x019cc0f1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"tambov oblastı", TERRITORY_RU_TT, 0x02000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FI)
+        {"tambovin alue", TERRITORY_RU_TT, 0x00000200},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"tambovska oblast", TERRITORY_RU_TT, 0x00002000},
+#endif
+        {"tamil nadu", TERRITORY_IN_TN, 0x03bce5f1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FI)
+        {"tamil nadun", TERRITORY_IN_TN, 0x00000200},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ID)
+        {"tanah penggembalaan", TERRITORY_GRL, 0x00004000},
+#endif
+        {"tanezroft tutrimt", TERRITORY_ESH, 0x08000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DE) || defined(MAPCODE_SUPPORT_LANGUAGE_FI)
+        {"tansania", TERRITORY_TZA, 0x00000240},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FI)
+        {"tanska", TERRITORY_DNK, 0x00000200},
+#endif
+        {"tanzania", TERRITORY_TZA, 0x09bcc1a0},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AF) || defined(MAPCODE_SUPPORT_LANGUAGE_CS) || defined(MAPCODE_SUPPORT_LANGUAGE_FR)
+        {"tanzanie", TERRITORY_TZA, 0x00000411},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"tanzanija", TERRITORY_TZA, 0x00002000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"tanzanya", TERRITORY_TZA, 0x02000000},
+#endif
+        {"tasmania", TERRITORY_AU_TAS, 0x0938c380},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AF) || defined(MAPCODE_SUPPORT_LANGUAGE_CS) || defined(MAPCODE_SUPPORT_LANGUAGE_FR) || defined(MAPCODE_SUPPORT_LANGUAGE_NL)
+        {"tasmanie", TERRITORY_AU_TAS, 0x00040411},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DA) || defined(MAPCODE_SUPPORT_LANGUAGE_DE) || defined(MAPCODE_SUPPORT_LANGUAGE_SV)
+        {"tasmanien", TERRITORY_AU_TAS, 0x00800060},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"tasmanija", TERRITORY_AU_TAS, 0x00002000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"tataristan cumhuriyeti", TERRITORY_RU_TA, 0x02000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_SV)
+        {"tatarstan", TERRITORY_RU_TA, 0x00800000},
+#endif
+        {"tatarstan republic", TERRITORY_RU_TA, 0x01000080},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AF) || defined(MAPCODE_SUPPORT_LANGUAGE_NL)
+        {"tatarstan republiek", TERRITORY_RU_TA, 0x00040001},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DA)
+        {"tatarstan republik", TERRITORY_RU_TA, 0x00000020},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"tatarstan republika", TERRITORY_RU_TA, 0x00002000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_NO)
+        {"tatarstan republikk", TERRITORY_RU_TA, 0x00080000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CS)
+        {"tatarstan republiky", TERRITORY_RU_TA, 0x00000010},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FI)
+        {"tatarstanin tasavalta", TERRITORY_RU_TA, 0x00000200},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ES)
+        {"tayikistan", TERRITORY_TJK, 0x00000100},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"tayland", TERRITORY_THA, 0x02000000},
+        {"tayvan", TERRITORY_TWN, 0x02000000},
+        {"tazmanya", TERRITORY_AU_TAS, 0x02000000},
+#endif
+        {"tca", TERRITORY_TCA, 0x10000000},
+        {"tcd", TERRITORY_TCD, 0x10000000},
+        {"tchad", TERRITORY_TCD, 0x08800400},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CS)
+        {"tchaj-wan", TERRITORY_TWN, 0x00000010},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FR)
+        {"tchoukotka", TERRITORY_RU_CHU, 0x00000400},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR) || defined(MAPCODE_SUPPORT_LANGUAGE_PL)
+        {"teksas", TERRITORY_US_TX, 0x00202000},
+#endif
+        {"telangana", TERRITORY_IN_TG, 0x03bce7f1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ES)
+        {"tennesse", TERRITORY_US_TN, 0x00000100},
+#endif
+        {"tennessee", TERRITORY_US_TN, 0x0bbce6f1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_IT) || defined(MAPCODE_SUPPORT_LANGUAGE_PT)
+        {"terra", TERRITORY_AAA, 0x00108000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PT)
+        {"terra nova", TERRITORY_CA_NL, 0x00100000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ES) || defined(MAPCODE_SUPPORT_LANGUAGE_IT)
+        {"terranova", TERRITORY_CA_NL, 0x00008100},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FR)
+        {"terre", TERRITORY_AAA, 0x00000400},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_IT)
+        {"terre australi e antartiche francesi", TERRITORY_ATF, 0x00008000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FR)
+        {"terre-neuve", TERRITORY_CA_NL, 0x00000400},
+#endif
+        {"terre-neuve-et-labrador", TERRITORY_CA_NL, 0x08000000},
+        {"terres australes et antarctiques francaises", TERRITORY_ATF, 0x08000400},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FR)
+        {"territoire britannique de l`ocean indien", TERRITORY_IOT, 0x00000400},
+        {"territoire de la baie de jervis", TERRITORY_AU_JBT, 0x00000400},
+        {"territoire de la capitale australienne", TERRITORY_AU_ACT, 0x00000400},
+        {"territoire du nord", TERRITORY_AU_NT, 0x00000400},
+#endif
+        {"territoires du nord-ouest", TERRITORY_CA_NT, 0x08000400},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FR)
+        {"territoires palestiniens", TERRITORY_PSE, 0x00000400},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_IT)
+        {"territori del nord", TERRITORY_AU_NT, 0x00008000},
+        {"territori del nordovest", TERRITORY_CA_NT, 0x00008000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ES)
+        {"territorio britanico del oceano indico", TERRITORY_IOT, 0x00000100},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PT)
+        {"territorio britanico do oceano indico", TERRITORY_IOT, 0x00100000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_IT)
+        {"territorio britannico dell`oceano indiano", TERRITORY_IOT, 0x00008000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PT)
+        {"territorio capital da australia", TERRITORY_AU_ACT, 0x00100000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ES) || defined(MAPCODE_SUPPORT_LANGUAGE_PT)
+        {"territorio de jervis bay", TERRITORY_AU_JBT, 0x00100100},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ES)
+        {"territorio de la capital australiana", TERRITORY_AU_ACT, 0x00000100},
+        {"territorio del norte", TERRITORY_AU_NT, 0x00000100},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PT)
+        {"territorio do norte", TERRITORY_AU_NT, 0x00100000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_IT)
+        {"territorio palestinese", TERRITORY_PSE, 0x00008000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ES) || defined(MAPCODE_SUPPORT_LANGUAGE_PT)
+        {"territorio palestino", TERRITORY_PSE, 0x00100100},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ES)
+        {"territorios del noroeste", TERRITORY_CA_NT, 0x00000100},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PT)
+        {"territorios do noroeste", TERRITORY_CA_NT, 0x00100000},
+        {"territorios franceses do sul e antarctico", TERRITORY_ATF, 0x00100000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PL)
+        {"terytorium jervis bay", TERRITORY_AU_JBT, 0x00200000},
+#endif
+        {"texas", TERRITORY_US_TX, 0x0b9cc7f1},
+        {"tgo", TERRITORY_TGO, 0x10000000},
+        {"tha", TERRITORY_THA, 0x10000000},
+        {"thailand", TERRITORY_THA, 0x018c40f1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FR)
+        {"thailande", TERRITORY_THA, 0x00000400},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FI)
+        {"thaimaa", TERRITORY_THA, 0x00000200},
+#endif
+        {"the falklands", TERRITORY_FLK, 0x00000080},
+        {"the gambia", TERRITORY_GMB, 0x08000080},
+        {"the marshall islands", TERRITORY_MHL, 0x08000000},
+        {"the netherlands", TERRITORY_NLD, 0x00000080},
+        {"tianjin", TERRITORY_CN_TJ, 0x03bce7f1},
+        {"tibet", TERRITORY_CN_XZ, 0x039ce5f1},
+        {"tibet", TERRITORY_CN_XJ, 0x08000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ES)
+        {"tierra", TERRITORY_AAA, 0x00000100},
+        {"tierra verde", TERRITORY_GRL, 0x00000100},
+        {"tierras australes y antarticas francesas", TERRITORY_ATF, 0x00000100},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FI)
+        {"tiibet", TERRITORY_CN_XZ, 0x00000200},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_IT)
+        {"timor est", TERRITORY_TLS, 0x00008000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PT)
+        {"timor leste", TERRITORY_TLS, 0x00100000},
+#endif
+        {"timor lorosa'e", TERRITORY_TLS, 0x08000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ES) || defined(MAPCODE_SUPPORT_LANGUAGE_FR)
+        {"timor oriental", TERRITORY_TLS, 0x00000500},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ID)
+        {"timor timur", TERRITORY_TLS, 0x00004000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PL)
+        {"timor wschodni", TERRITORY_TLS, 0x00200000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_SW)
+        {"timor ya mashariki", TERRITORY_TLS, 0x01000000},
+#endif
+        {"timor-leste", TERRITORY_TLS, 0x08000080},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_SV)
+        {"tjeckien", TERRITORY_CZE, 0x00800000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DA)
+        {"tjekkiet", TERRITORY_CZE, 0x00000020},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_SV)
+        {"tjeljabinsk", TERRITORY_RU_CH, 0x00800000},
+        {"tjetjenien", TERRITORY_RU_CE, 0x00800000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DA)
+        {"tjetjenske republik", TERRITORY_RU_CE, 0x00000020},
+#endif
+        {"tjk", TERRITORY_TJK, 0x10000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DA)
+        {"tjukotka okrug", TERRITORY_RU_CHU, 0x00000020},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FI)
+        {"tjumenin alue", TERRITORY_RU_TYU, 0x00000200},
+#endif
+        {"tkl", TERRITORY_TKL, 0x10000000},
+        {"tkm", TERRITORY_TKM, 0x10000000},
+        {"tlaxcala", TERRITORY_MX_TLA, 0x0bbce7f1},
+        {"tls", TERRITORY_TLS, 0x10000000},
+        {"tobago", TERRITORY_TTO, 0x039ce7f1},
+        {"tocantins", TERRITORY_BR_TO, 0x0bbce7f1},
+        {"togo", TERRITORY_TGO, 0x0bbce7f1},
+        {"togolese republic", TERRITORY_TGO, 0x00000080},
+        {"tokelau", TERRITORY_TKL, 0x0bbce7f1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_IT)
+        {"tomsk", TERRITORY_RU_TOM, 0x00008000},
+#endif
+        {"tomsk oblast", TERRITORY_RU_TOM, 0x039c41f1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"tomska oblast", TERRITORY_RU_TOM, 0x00002000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FI)
+        {"tomskin alue", TERRITORY_RU_TOM, 0x00000200},
+#endif
+        {"ton", TERRITORY_TON, 0x10000000},
+        {"tonga", TERRITORY_TON, 0x0bbce7f1},
+        {"trinidad", TERRITORY_TTO, 0x00000080},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CS)
+        {"trinidad a tobago", TERRITORY_TTO, 0x00000010},
+#endif
+        {"trinidad and tobago", TERRITORY_TTO, 0x08000080},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ID)
+        {"trinidad dan tobago", TERRITORY_TTO, 0x00004000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_IT) || defined(MAPCODE_SUPPORT_LANGUAGE_PT)
+        {"trinidad e tobago", TERRITORY_TTO, 0x00108000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AF) || defined(MAPCODE_SUPPORT_LANGUAGE_NL)
+        {"trinidad en tobago", TERRITORY_TTO, 0x00040001},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"trinidad i tobago", TERRITORY_TTO, 0x00002000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FI)
+        {"trinidad ja tobago", TERRITORY_TTO, 0x00000200},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_SW)
+        {"trinidad na tobago", TERRITORY_TTO, 0x01000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_SV)
+        {"trinidad och tobago", TERRITORY_TTO, 0x00800000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DA) || defined(MAPCODE_SUPPORT_LANGUAGE_NO)
+        {"trinidad og tobago", TERRITORY_TTO, 0x00080020},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DE)
+        {"trinidad und tobago", TERRITORY_TTO, 0x00000040},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"trinidad ve tobago", TERRITORY_TTO, 0x02000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ES)
+        {"trinidad y tobago", TERRITORY_TTO, 0x00000100},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FR)
+        {"trinite-et-tobago", TERRITORY_TTO, 0x00000400},
+#endif
+        {"tripura", TERRITORY_IN_TR, 0x03bce7f0},
+        {"tristan da cunha", TERRITORY_SHN, 0x038ce7f1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PL)
+        {"tristan da cunha, wyspy", TERRITORY_SHN, 0x00200000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PT)
+        {"tristao da cunha", TERRITORY_SHN, 0x00100000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PL)
+        {"trynidad i tobago", TERRITORY_TTO, 0x00200000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DE)
+        {"tschad", TERRITORY_TCD, 0x00000040},
+        {"tschechische republik", TERRITORY_CZE, 0x00000040},
+        {"tschetschenische republik", TERRITORY_RU_CE, 0x00000040},
+        {"tschukotka okrug", TERRITORY_RU_CHU, 0x00000040},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FI)
+        {"tsekin tasavalta", TERRITORY_CZE, 0x00000200},
+        {"tseljabinskin alue", TERRITORY_RU_CH, 0x00000200},
+        {"tsetsenian tasavallassa", TERRITORY_RU_CE, 0x00000200},
+#endif
+        {"tsinghai", TERRITORY_CN_QH, 0x00000080},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_NL)
+        {"tsjaad", TERRITORY_TCD, 0x00040000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_NO)
+        {"tsjad", TERRITORY_TCD, 0x00080000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_NL)
+        {"tsjechische republiek", TERRITORY_CZE, 0x00040000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AF)
+        {"tsjeggiese republiek", TERRITORY_CZE, 0x00000001},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_NO)
+        {"tsjekkia", TERRITORY_CZE, 0x00080000},
+        {"tsjeljabinsk oblast", TERRITORY_RU_CH, 0x00080000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AF) || defined(MAPCODE_SUPPORT_LANGUAGE_NL)
+        {"tsjetsjeense republiek", TERRITORY_RU_CE, 0x00040001},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_NO)
+        {"tsjetsjenia", TERRITORY_RU_CE, 0x00080000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FI)
+        {"tsuvassi tasavalta", TERRITORY_RU_CU, 0x00000200},
+#endif
+        {"tto", TERRITORY_TTO, 0x10000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_IT) || defined(MAPCODE_SUPPORT_LANGUAGE_SV)
+        {"tula", TERRITORY_RU_TUL, 0x00808000},
+#endif
+        {"tula oblast", TERRITORY_RU_TUL, 0x033c61f1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FI)
+        {"tulan alue", TERRITORY_RU_TUL, 0x00000200},
+#endif
+        {"tun", TERRITORY_TUN, 0x10000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_NL)
+        {"tunesie", TERRITORY_TUN, 0x00040000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DA) || defined(MAPCODE_SUPPORT_LANGUAGE_DE)
+        {"tunesien", TERRITORY_TUN, 0x00000060},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ES)
+        {"tunez", TERRITORY_TUN, 0x00000100},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PL)
+        {"tunezja", TERRITORY_TUN, 0x00200000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"tunis", TERRITORY_TUN, 0x00002000},
+#endif
+        {"tunisia", TERRITORY_TUN, 0x0118c280},
+        {"tunisian republic", TERRITORY_TUN, 0x00000080},
+        {"tunisie", TERRITORY_TUN, 0x08000401},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_SV)
+        {"tunisien", TERRITORY_TUN, 0x00800000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CS)
+        {"tunisko", TERRITORY_TUN, 0x00000010},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"tunus", TERRITORY_TUN, 0x02000000},
+#endif
+        {"tur", TERRITORY_TUR, 0x10000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_IT)
+        {"turchia", TERRITORY_TUR, 0x00008000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PL)
+        {"turcja", TERRITORY_TUR, 0x00200000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PT)
+        {"turcomenistao", TERRITORY_TKM, 0x00100000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CS)
+        {"turecko", TERRITORY_TUR, 0x00000010},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DE)
+        {"turkei", TERRITORY_TUR, 0x00000040},
+#endif
+        {"turkey", TERRITORY_TUR, 0x00000080},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ID)
+        {"turki", TERRITORY_TUR, 0x00004000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_SV)
+        {"turkiet", TERRITORY_TUR, 0x00800000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_NL)
+        {"turkije", TERRITORY_TUR, 0x00040000},
+#endif
+        {"turkiye", TERRITORY_TUR, 0x0a000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FI)
+        {"turkki", TERRITORY_TUR, 0x00000200},
+#endif
+        {"turkmenistan", TERRITORY_TKM, 0x0bace7f1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CS)
+        {"turks a caicos", TERRITORY_TCA, 0x00000010},
+#endif
+        {"turks and caicos islands", TERRITORY_TCA, 0x08000080},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_IT)
+        {"turks e caicos", TERRITORY_TCA, 0x00008000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AF)
+        {"turks en caicos eilande", TERRITORY_TCA, 0x00000001},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PL)
+        {"turks i caicos", TERRITORY_TCA, 0x00200000},
+#endif
+        {"turks islands", TERRITORY_TCA, 0x00000080},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_SW)
+        {"turks na caicos", TERRITORY_TCA, 0x01000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"turks ve caicos adaları", TERRITORY_TCA, 0x02000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FI)
+        {"turks- ja caicossaaret", TERRITORY_TCA, 0x00000200},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_SV)
+        {"turks- och caicosoarna", TERRITORY_TCA, 0x00800000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_NO)
+        {"turks- og caicosøyene", TERRITORY_TCA, 0x00080000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DE)
+        {"turks- und caicosinseln", TERRITORY_TCA, 0x00000040},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_NL)
+        {"turks-en caicoseilanden", TERRITORY_TCA, 0x00040000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DA)
+        {"turks-og caicosøerne", TERRITORY_TCA, 0x00000020},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AF)
+        {"turkye", TERRITORY_TUR, 0x00000001},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ES) || defined(MAPCODE_SUPPORT_LANGUAGE_PT)
+        {"turquia", TERRITORY_TUR, 0x00100100},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FR)
+        {"turquie", TERRITORY_TUR, 0x00000400},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"turska", TERRITORY_TUR, 0x00002000},
+#endif
+        {"tuv", TERRITORY_TUV, 0x10000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"tuva cumhuriyeti", TERRITORY_RU_TY, 0x02000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_SW)
+        {"tuva jamhuri", TERRITORY_RU_TY, 0x01000000},
+#endif
+        {"tuva republic", TERRITORY_RU_TY, 0x00184190},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AF) || defined(MAPCODE_SUPPORT_LANGUAGE_NL)
+        {"tuva republiek", TERRITORY_RU_TY, 0x00040001},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DA) || defined(MAPCODE_SUPPORT_LANGUAGE_DE)
+        {"tuva republik", TERRITORY_RU_TY, 0x00000060},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"tuva republika", TERRITORY_RU_TY, 0x00002000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_SV)
+        {"tuva republiken", TERRITORY_RU_TY, 0x00800000},
+#endif
+        {"tuvalu", TERRITORY_TUV, 0x0bbce7f1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FI)
+        {"tuvan tasavalta", TERRITORY_RU_TY, 0x00000200},
+#endif
+        {"tver oblast", TERRITORY_RU_TVE, 0x039ce0a1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FI)
+        {"tverin alue", TERRITORY_RU_TVE, 0x00000200},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CS)
+        {"tverska oblast", TERRITORY_RU_TVE, 0x00000010},
+#endif
+        {"twn", TERRITORY_TWN, 0x10000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PL)
+        {"tybet", TERRITORY_CN_XZ, 0x00200000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_NO)
+        {"tyrkia", TERRITORY_TUR, 0x00080000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DA)
+        {"tyrkiet", TERRITORY_TUR, 0x00000020},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DA) || defined(MAPCODE_SUPPORT_LANGUAGE_NO) || defined(MAPCODE_SUPPORT_LANGUAGE_SV)
+        {"tyskland", TERRITORY_DEU, 0x00880020},
+#endif
+        {"tyumen oblast", TERRITORY_RU_TYU, 0x039ce1f1},
+        {"tza", TERRITORY_TZA, 0x10000000},
+        {"uae", TERRITORY_ARE, 0x08000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_SW)
+        {"ubelgiji", TERRITORY_BEL, 0x01000000},
+#endif
+        {"uburundi", TERRITORY_BDI, 0x08000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_IT)
+        {"ucraina", TERRITORY_UKR, 0x00008000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ES) || defined(MAPCODE_SUPPORT_LANGUAGE_PT)
+        {"ucrania", TERRITORY_UKR, 0x00100100},
+#endif
+        {"udmurt republic", TERRITORY_RU_UD, 0x038c40b0},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AF)
+        {"udmurt republiek", TERRITORY_RU_UD, 0x00000001},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FI)
+        {"udmurtian", TERRITORY_RU_UD, 0x00000200},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"udmurtska republika", TERRITORY_RU_UD, 0x00002000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_SW)
+        {"ufaransa", TERRITORY_FRA, 0x01000000},
+#endif
+        {"uga", TERRITORY_UGA, 0x10000000},
+        {"uganda", TERRITORY_UGA, 0x0bb8e3f1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_SW)
+        {"ugiriki", TERRITORY_GRC, 0x01000000},
+        {"uholanzi", TERRITORY_NLD, 0x01000000},
+        {"uingereza", TERRITORY_GBR, 0x01000000},
+        {"uingereza katika bahari hindi", TERRITORY_IOT, 0x01000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"ujedinjeni arapski emirati", TERRITORY_ARE, 0x00002000},
+        {"ujedinjeno kraljevstvo", TERRITORY_GBR, 0x00002000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_SW)
+        {"ujerumani", TERRITORY_DEU, 0x01000000},
+#endif
+        {"ukr", TERRITORY_UKR, 0x10000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FI) || defined(MAPCODE_SUPPORT_LANGUAGE_ID) || defined(MAPCODE_SUPPORT_LANGUAGE_NO) || defined(MAPCODE_SUPPORT_LANGUAGE_PL) || defined(MAPCODE_SUPPORT_LANGUAGE_SV)
+        {"ukraina", TERRITORY_UKR, 0x00a84200},
+#endif
+        {"ukraine", TERRITORY_UKR, 0x010004e0},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CS) || defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"ukrajina", TERRITORY_UKR, 0x00002010},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"ukrayna", TERRITORY_UKR, 0x02000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_SV)
+        {"uljanovsk oblast", TERRITORY_RU_ULY, 0x00800000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"uljanovska oblast", TERRITORY_RU_ULY, 0x00002000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FI)
+        {"uljanovskin alue", TERRITORY_RU_ULY, 0x00000200},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DE)
+        {"uljanowsk", TERRITORY_RU_ULY, 0x00000040},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"uluslararası", TERRITORY_AAA, 0x02000000},
+#endif
+        {"ulyanovsk oblast", TERRITORY_RU_ULY, 0x031cc1b1},
+        {"umbuso weswatini", TERRITORY_SWZ, 0x08000000},
+        {"umi", TERRITORY_UMI, 0x10000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"umman", TERRITORY_OMN, 0x02000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_SW)
+        {"umoja wa falme za kiarabu", TERRITORY_ARE, 0x01000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DA) || defined(MAPCODE_SUPPORT_LANGUAGE_DE) || defined(MAPCODE_SUPPORT_LANGUAGE_NO)
+        {"ungarn", TERRITORY_HUN, 0x00080060},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_SV)
+        {"ungern", TERRITORY_HUN, 0x00800000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_IT)
+        {"ungheria", TERRITORY_HUN, 0x00008000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ID)
+        {"uni emirat arab", TERRITORY_ARE, 0x00004000},
+#endif
+        {"united arab emirates", TERRITORY_ARE, 0x00000080},
+        {"united kingdom", TERRITORY_GBR, 0x08000080},
+        {"united kingdom of great britain and northern ireland", TERRITORY_GBR, 0x00000080},
+        {"united mexican states", TERRITORY_MEX, 0x08000080},
+        {"united states", TERRITORY_USA, 0x08000000},
+        {"united states minor outlying islands", TERRITORY_UMI, 0x080400e0},
+        {"united states of america", TERRITORY_USA, 0x01000090},
+        {"united states virgin islands", TERRITORY_VIR, 0x08000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FI)
+        {"unkari", TERRITORY_HUN, 0x00000200},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"urdun", TERRITORY_JOR, 0x02000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_SW)
+        {"ureno", TERRITORY_PRT, 0x01000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CS)
+        {"urisa", TERRITORY_IN_OR, 0x00000010},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PT)
+        {"uruguai", TERRITORY_URY, 0x00100000},
+#endif
+        {"uruguay", TERRITORY_URY, 0x0b8cc7f1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"urugvaj", TERRITORY_URY, 0x00002000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PL)
+        {"urugwaj", TERRITORY_URY, 0x00200000},
+#endif
+        {"ury", TERRITORY_URY, 0x10000000},
+        {"us virgin islands", TERRITORY_VIR, 0x0000c0a0},
+        {"us-ak", TERRITORY_US_AK, 0x10000000},
+        {"us-al", TERRITORY_US_AL, 0x10000000},
+        {"us-ar", TERRITORY_US_AR, 0x10000000},
+        {"us-az", TERRITORY_US_AZ, 0x10000000},
+        {"us-ca", TERRITORY_US_CA, 0x10000000},
+        {"us-co", TERRITORY_US_CO, 0x10000000},
+        {"us-ct", TERRITORY_US_CT, 0x10000000},
+        {"us-dc", TERRITORY_US_DC, 0x10000000},
+        {"us-de", TERRITORY_US_DE, 0x10000000},
+        {"us-fl", TERRITORY_US_FL, 0x10000000},
+        {"us-ga", TERRITORY_US_GA, 0x10000000},
+        {"us-hi", TERRITORY_US_HI, 0x10000000},
+        {"us-ia", TERRITORY_US_IA, 0x10000000},
+        {"us-id", TERRITORY_US_ID, 0x10000000},
+        {"us-il", TERRITORY_US_IL, 0x10000000},
+        {"us-in", TERRITORY_US_IN, 0x10000000},
+        {"us-ks", TERRITORY_US_KS, 0x10000000},
+        {"us-ky", TERRITORY_US_KY, 0x10000000},
+        {"us-la", TERRITORY_US_LA, 0x10000000},
+        {"us-ma", TERRITORY_US_MA, 0x10000000},
+        {"us-md", TERRITORY_US_MD, 0x10000000},
+        {"us-me", TERRITORY_US_ME, 0x10000000},
+        {"us-mi", TERRITORY_US_MI, 0x10000000},
+        {"us-mn", TERRITORY_US_MN, 0x10000000},
+        {"us-mo", TERRITORY_US_MO, 0x10000000},
+        {"us-ms", TERRITORY_US_MS, 0x10000000},
+        {"us-mt", TERRITORY_US_MT, 0x10000000},
+        {"us-nc", TERRITORY_US_NC, 0x10000000},
+        {"us-nd", TERRITORY_US_ND, 0x10000000},
+        {"us-ne", TERRITORY_US_NE, 0x10000000},
+        {"us-nh", TERRITORY_US_NH, 0x10000000},
+        {"us-nj", TERRITORY_US_NJ, 0x10000000},
+        {"us-nm", TERRITORY_US_NM, 0x10000000},
+        {"us-nv", TERRITORY_US_NV, 0x10000000},
+        {"us-ny", TERRITORY_US_NY, 0x10000000},
+        {"us-oh", TERRITORY_US_OH, 0x10000000},
+        {"us-ok", TERRITORY_US_OK, 0x10000000},
+        {"us-or", TERRITORY_US_OR, 0x10000000},
+        {"us-pa", TERRITORY_US_PA, 0x10000000},
+        {"us-ri", TERRITORY_US_RI, 0x10000000},
+        {"us-sc", TERRITORY_US_SC, 0x10000000},
+        {"us-sd", TERRITORY_US_SD, 0x10000000},
+        {"us-tn", TERRITORY_US_TN, 0x10000000},
+        {"us-tx", TERRITORY_US_TX, 0x10000000},
+        {"us-ut", TERRITORY_US_UT, 0x10000000},
+        {"us-va", TERRITORY_US_VA, 0x10000000},
+        {"us-vt", TERRITORY_US_VT, 0x10000000},
+        {"us-wa", TERRITORY_US_WA, 0x10000000},
+        {"us-wi", TERRITORY_US_WI, 0x10000000},
+        {"us-wv", TERRITORY_US_WV, 0x10000000},
+        {"us-wy", TERRITORY_US_WY, 0x10000000},
+        {"usa", TERRITORY_USA, 0x1088c7f0},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_NO)
+        {"usas ytre smaøyer", TERRITORY_UMI, 0x00080000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DA) || defined(MAPCODE_SUPPORT_LANGUAGE_DE) || defined(MAPCODE_SUPPORT_LANGUAGE_NO)
+        {"usbekistan", TERRITORY_UZB, 0x00080060},
+#endif
+        {"usmoi", TERRITORY_UMI, 0x08000000},
+        {"utah", TERRITORY_US_UT, 0x0bbce7f1},
+        {"uttar pradesh", TERRITORY_IN_UP, 0x0bbce7f1},
+        {"uttarakhand", TERRITORY_IN_UT, 0x01bce7f1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"uttarkand", TERRITORY_IN_UT, 0x02000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_SW)
+        {"uturuki", TERRITORY_TUR, 0x01000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FI)
+        {"uusi meksiko", TERRITORY_US_NM, 0x00000200},
+        {"uusi seelanti", TERRITORY_NZL, 0x00000200},
+        {"uusi-caledonia", TERRITORY_NCL, 0x00000200},
+#endif
+        {"uvea mo futuna", TERRITORY_WLF, 0x08000000},
+        {"uzb", TERRITORY_UZB, 0x10000000},
+        {"uzbekistan", TERRITORY_UZB, 0x01a0e390},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PT)
+        {"uzbequistao", TERRITORY_UZB, 0x00100000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"vajoming", TERRITORY_US_WY, 0x00002000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FI)
+        {"valko-venaja", TERRITORY_BLR, 0x00000200},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CS)
+        {"vanocni ostrov", TERRITORY_CXR, 0x00000010},
+#endif
+        {"vanuatu", TERRITORY_VUT, 0x0bbce7f1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_SV)
+        {"varlden", TERRITORY_AAA, 0x00800000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"vasington", TERRITORY_US_WA, 0x00002000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_SV)
+        {"vastbengalen", TERRITORY_IN_WB, 0x00800000},
+        {"vastra australien", TERRITORY_AU_WA, 0x00800000},
+        {"vastra virginia", TERRITORY_US_WV, 0x00800000},
+        {"vastsahara", TERRITORY_ESH, 0x00800000},
+#endif
+        {"vat", TERRITORY_VAT, 0x10000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_NL)
+        {"vaticaanstad", TERRITORY_VAT, 0x00040000},
+#endif
+        {"vatican", TERRITORY_VAT, 0x00000480},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ID) || defined(MAPCODE_SUPPORT_LANGUAGE_SW)
+        {"vatican city", TERRITORY_VAT, 0x01004000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ES) || defined(MAPCODE_SUPPORT_LANGUAGE_IT) || defined(MAPCODE_SUPPORT_LANGUAGE_PT)
+        {"vaticano", TERRITORY_VAT, 0x00108100},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FI)
+        {"vatikaani", TERRITORY_VAT, 0x00000200},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AF)
+        {"vatikaanstad", TERRITORY_VAT, 0x00000001},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CS) || defined(MAPCODE_SUPPORT_LANGUAGE_HR) || defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"vatikan", TERRITORY_VAT, 0x02002010},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DE)
+        {"vatikanstadt", TERRITORY_VAT, 0x00000040},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DA) || defined(MAPCODE_SUPPORT_LANGUAGE_NO) || defined(MAPCODE_SUPPORT_LANGUAGE_SV)
+        {"vatikanstaten", TERRITORY_VAT, 0x00880020},
+#endif
+        {"vct", TERRITORY_VCT, 0x10000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"velika britanija", TERRITORY_GBR, 0x00002000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CS)
+        {"velka britanie", TERRITORY_GBR, 0x00000010},
+#endif
+        {"ven", TERRITORY_VEN, 0x10000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FI)
+        {"venaja", TERRITORY_RUS, 0x00000200},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"venecuela", TERRITORY_VEN, 0x00002000},
+#endif
+        {"venezuela", TERRITORY_VEN, 0x0b9cc7f1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_SV)
+        {"vera", TERRITORY_MX_VER, 0x00800000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AF)
+        {"vera cruz", TERRITORY_MX_VER, 0x00000001},
+#endif
+        {"veracruz", TERRITORY_MX_VER, 0x0b3ce7f0},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_NO)
+        {"verden", TERRITORY_AAA, 0x00080000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DA)
+        {"verdenen", TERRITORY_AAA, 0x00000020},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DE)
+        {"vereinigte arabische emirate", TERRITORY_ARE, 0x00000040},
+        {"vereinigte staaten von amerika", TERRITORY_USA, 0x00000040},
+        {"vereinigtes konigreich", TERRITORY_GBR, 0x00000040},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_NL)
+        {"verenigd koninkrijk", TERRITORY_GBR, 0x00040000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AF)
+        {"verenigde arabiese emirate", TERRITORY_ARE, 0x00000001},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_NL)
+        {"verenigde arabische emiraten", TERRITORY_ARE, 0x00040000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AF)
+        {"verenigde koninkryk", TERRITORY_GBR, 0x00000001},
+        {"verenigde state minor afgelee eilande", TERRITORY_UMI, 0x00000001},
+        {"verenigde state van amerika", TERRITORY_USA, 0x00000001},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_NL)
+        {"verenigde staten", TERRITORY_USA, 0x00040000},
+#endif
+        {"vermont", TERRITORY_US_VT, 0x0bbce7f1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_NO)
+        {"vest-bengal", TERRITORY_IN_WB, 0x00080000},
+        {"vest-sahara", TERRITORY_ESH, 0x00080000},
+        {"vest-virginia", TERRITORY_US_WV, 0x00080000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DA)
+        {"vestbengalen", TERRITORY_IN_WB, 0x00000020},
+#endif
+        {"vgb", TERRITORY_VGB, 0x10000000},
+        {"victoria", TERRITORY_AU_VIC, 0x0b9c47f1},
+        {"viet nam", TERRITORY_VNM, 0x08000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PT)
+        {"vietna", TERRITORY_VNM, 0x00100000},
+#endif
+        {"vietnam", TERRITORY_VNM, 0x038cc7f1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"vijetnam", TERRITORY_VNM, 0x00002000},
+        {"viktorija", TERRITORY_AU_VIC, 0x00002000},
+#endif
+        {"vir", TERRITORY_VIR, 0x10000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"virdzinija", TERRITORY_US_VA, 0x00002000},
+#endif
+        {"virgin islands", TERRITORY_VGB, 0x08000000},
+        {"virgin islands of the united states", TERRITORY_VIR, 0x00000080},
+        {"virgin islands, british", TERRITORY_VGB, 0x010000a1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AF)
+        {"virgin islands, us", TERRITORY_VIR, 0x00000001},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DA)
+        {"virgin islands, usa", TERRITORY_VIR, 0x00000020},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DE)
+        {"virgin-inseln, usa", TERRITORY_VIR, 0x00000040},
+#endif
+        {"virginia", TERRITORY_US_VA, 0x0b9cc3f1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ES)
+        {"virginia occidental", TERRITORY_US_WV, 0x00000100},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_IT)
+        {"virginia occidentale", TERRITORY_US_WV, 0x00008000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PT)
+        {"virginia ocidental", TERRITORY_US_WV, 0x00100000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FR)
+        {"virginie", TERRITORY_US_VA, 0x00000400},
+        {"virginie-occidentale", TERRITORY_US_WV, 0x00000400},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FI)
+        {"viro", TERRITORY_EST, 0x00000200},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_SW)
+        {"visiwa cayman", TERRITORY_CYM, 0x01000000},
+        {"visiwa cook", TERRITORY_COK, 0x01000000},
+        {"visiwa vya falkland", TERRITORY_FLK, 0x01000000},
+        {"visiwa vya faroe", TERRITORY_FRO, 0x01000000},
+        {"visiwa vya mariana ya kaskazini", TERRITORY_MNP, 0x01000000},
+        {"visiwa vya marshall", TERRITORY_MHL, 0x01000000},
+        {"visiwa vya pitcairn", TERRITORY_PCN, 0x01000000},
+        {"visiwa vya solomon", TERRITORY_SLB, 0x01000000},
+        {"visiwa vya south sandwich", TERRITORY_SGS, 0x01000000},
+        {"visiwa vya virgin vya marekani", TERRITORY_VIR, 0x01000000},
+        {"visiwa vya virgin, marekani", TERRITORY_VIR, 0x01000000},
+#endif
+        {"viti", TERRITORY_FJI, 0x08000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_SV)
+        {"vitryssland", TERRITORY_BLR, 0x00800000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_IT)
+        {"vittoria", TERRITORY_AU_VIC, 0x00008000},
+#endif
+        {"vladimir oblast", TERRITORY_RU_VLA, 0x039ce1f1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FI)
+        {"vladimirin alue", TERRITORY_RU_VLA, 0x00000200},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CS)
+        {"vnitrni mongolsko", TERRITORY_CN_NM, 0x00000010},
+#endif
+        {"vnm", TERRITORY_VNM, 0x10000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"volgograd", TERRITORY_RU_VGG, 0x02000000},
+#endif
+        {"volgograd oblast", TERRITORY_RU_VGG, 0x019c60e1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FI)
+        {"volgogradin alue", TERRITORY_RU_VGG, 0x00000200},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CS)
+        {"volgogradska oblast", TERRITORY_RU_VGG, 0x00000010},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DE)
+        {"vologda", TERRITORY_RU_VLG, 0x00000040},
+#endif
+        {"vologda oblast", TERRITORY_RU_VLG, 0x039ce0b1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FI)
+        {"vologdan alue", TERRITORY_RU_VLG, 0x00000200},
+#endif
+        {"voronezh oblast", TERRITORY_RU_VOR, 0x031cc0f1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FI)
+        {"voronezin alue", TERRITORY_RU_VOR, 0x00000200},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_SV)
+        {"voronezj oblast", TERRITORY_RU_VOR, 0x00800000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"voronjeska oblast", TERRITORY_RU_VOR, 0x00002000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_NL)
+        {"vs", TERRITORY_USA, 0x00040000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AF)
+        {"vsa", TERRITORY_USA, 0x00000001},
+#endif
+        {"vut", TERRITORY_VUT, 0x10000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CS)
+        {"vychodni timor", TERRITORY_TLS, 0x00000010},
+#endif
+        {"wai‘tu kubuli", TERRITORY_DMA, 0x08000000},
+        {"wallis", TERRITORY_WLF, 0x00000080},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CS)
+        {"wallis a futuna", TERRITORY_WLF, 0x00000010},
+#endif
+        {"wallis and futuna", TERRITORY_WLF, 0x00000080},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ID)
+        {"wallis dan futuna", TERRITORY_WLF, 0x00004000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_IT) || defined(MAPCODE_SUPPORT_LANGUAGE_PT)
+        {"wallis e futuna", TERRITORY_WLF, 0x00108000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AF) || defined(MAPCODE_SUPPORT_LANGUAGE_NL)
+        {"wallis en futuna", TERRITORY_WLF, 0x00040001},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FR)
+        {"wallis et futuna", TERRITORY_WLF, 0x00000400},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR) || defined(MAPCODE_SUPPORT_LANGUAGE_PL)
+        {"wallis i futuna", TERRITORY_WLF, 0x00202000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FI)
+        {"wallis ja futuna", TERRITORY_WLF, 0x00000200},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_SW)
+        {"wallis na futuna", TERRITORY_WLF, 0x01000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_SV)
+        {"wallis och futuna", TERRITORY_WLF, 0x00800000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DE)
+        {"wallis und futuna", TERRITORY_WLF, 0x00000040},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"wallis ve futuna", TERRITORY_WLF, 0x02000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ES)
+        {"wallis y futuna", TERRITORY_WLF, 0x00000100},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_NO)
+        {"wallis- og futunaøyene", TERRITORY_WLF, 0x00080000},
+#endif
+        {"wallis-et-futuna", TERRITORY_WLF, 0x08000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DA)
+        {"wallis-og futuna", TERRITORY_WLF, 0x00000020},
+#endif
+        {"washington", TERRITORY_US_WA, 0x0b9cc7f1},
+        {"washington, d.c.", TERRITORY_US_DC, 0x00000090},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PL)
+        {"waszyngton", TERRITORY_US_WA, 0x00200000},
+        {"watykan", TERRITORY_VAT, 0x00200000},
+        {"wegry", TERRITORY_HUN, 0x00200000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DE)
+        {"weihnachtsinsel", TERRITORY_CXR, 0x00000040},
+        {"weißrussland", TERRITORY_BLR, 0x00000040},
+        {"weltweit", TERRITORY_AAA, 0x00000040},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PL)
+        {"wenezuela", TERRITORY_VEN, 0x00200000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_NL)
+        {"wereldwijd", TERRITORY_AAA, 0x00040000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AF)
+        {"wereldwyd", TERRITORY_AAA, 0x00000001},
+        {"wes-australie", TERRITORY_AU_WA, 0x00000001},
+        {"wes-bengal", TERRITORY_IN_WB, 0x00000001},
+        {"wes-sahara", TERRITORY_ESH, 0x00000001},
+#endif
+        {"west bengal", TERRITORY_IN_WB, 0x09008090},
+        {"west congo", TERRITORY_COG, 0x00000080},
+        {"west virginia", TERRITORY_US_WV, 0x0b8460f1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_NL)
+        {"west-australie", TERRITORY_AU_WA, 0x00040000},
+        {"west-bengalen", TERRITORY_IN_WB, 0x00040000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DE)
+        {"westbengalen", TERRITORY_IN_WB, 0x00000040},
+#endif
+        {"western australia", TERRITORY_AU_WA, 0x080822e0},
+        {"western sahara", TERRITORY_ESH, 0x010400e0},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PL)
+        {"wielka brytania", TERRITORY_GBR, 0x00200000},
+        {"wietnam", TERRITORY_VNM, 0x00200000},
+        {"wiktoria", TERRITORY_AU_VIC, 0x00200000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_SW)
+        {"wilaya ya columbia", TERRITORY_US_DC, 0x01000000},
+        {"wilaya ya kaskazini", TERRITORY_AU_NT, 0x01000000},
+        {"wilaya ya shirikisho", TERRITORY_MX_DIF, 0x01000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ID)
+        {"wilayah ibu kota australia", TERRITORY_AU_ACT, 0x00004000},
+        {"wilayah palestina", TERRITORY_PSE, 0x00004000},
+        {"wilayah utara", TERRITORY_AU_NT, 0x00004000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PL)
+        {"wirginia", TERRITORY_US_VA, 0x00200000},
+        {"wirginia zachodnia", TERRITORY_US_WV, 0x00200000},
+#endif
+        {"wisconsin", TERRITORY_US_WI, 0x0bbce7f1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AF) || defined(MAPCODE_SUPPORT_LANGUAGE_NL)
+        {"wit-rusland", TERRITORY_BLR, 0x00040001},
+#endif
+        {"wlf", TERRITORY_WLF, 0x10000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PL)
+        {"wniebowstapienia, wyspy", TERRITORY_SHN, 0x00200000},
+#endif
+        {"worldwide", TERRITORY_AAA, 0x00200080},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PL)
+        {"wołogzianski", TERRITORY_RU_VLG, 0x00200000},
+#endif
+        {"wsm", TERRITORY_WSM, 0x10000000},
+        {"wuliwya", TERRITORY_BOL, 0x08000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PL)
+        {"wybrzeze kosci słoniowej", TERRITORY_CIV, 0x00200000},
+#endif
+        {"wyoming", TERRITORY_US_WY, 0x0bbcc7f1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PL)
+        {"wyspa bouveta", TERRITORY_BVT, 0x00200000},
+        {"wyspa bozego narodzenia", TERRITORY_CXR, 0x00200000},
+        {"wyspa clippertona", TERRITORY_CPT, 0x00200000},
+        {"wyspa ksiecia edwarda", TERRITORY_CA_PE, 0x00200000},
+        {"wyspa man", TERRITORY_IMN, 0x00200000},
+        {"wyspa swietej heleny, wniebowstapienia i tristan da cunha", TERRITORY_SHN, 0x00200000},
+        {"wyspy alandzkie", TERRITORY_ALA, 0x00200000},
+        {"wyspy cooka", TERRITORY_COK, 0x00200000},
+        {"wyspy dziewicze stanow zjednoczonych", TERRITORY_VIR, 0x00200000},
+        {"wyspy dziewicze, brytyjskie", TERRITORY_VGB, 0x00200000},
+        {"wyspy heard i mcdonalda", TERRITORY_HMD, 0x00200000},
+        {"wyspy kokosowe", TERRITORY_CCK, 0x00200000},
+        {"wyspy marshalla", TERRITORY_MHL, 0x00200000},
+        {"wyspy owcze", TERRITORY_FRO, 0x00200000},
+        {"wyspy salomona", TERRITORY_SLB, 0x00200000},
+        {"wyspy swietego tomasza i ksiazeca", TERRITORY_STP, 0x00200000},
+        {"włochy", TERRITORY_ITA, 0x00200000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PT)
+        {"xangai", TERRITORY_CN_SH, 0x00100000},
+#endif
+        {"xianggang", TERRITORY_HKG, 0x00000080},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_NL)
+        {"xinjiang oeigoerse", TERRITORY_CN_XJ, 0x00040000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DE)
+        {"xinjiang uiguren", TERRITORY_CN_XJ, 0x00000040},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PL)
+        {"xinjiang ujgur", TERRITORY_CN_XJ, 0x00200000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"xinjiang ujgurski", TERRITORY_CN_XJ, 0x00002000},
+#endif
+        {"xinjiang uyghur", TERRITORY_CN_XJ, 0x0198c1b1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FI)
+        {"xinjiangin uiguurien", TERRITORY_CN_XJ, 0x00000200},
+#endif
+        {"xizang", TERRITORY_CN_XZ, 0x03bce7f0},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"yahudi ozerk oblastı", TERRITORY_RU_YEV, 0x02000000},
+        {"yakutia cumhuriyeti", TERRITORY_RU_SA, 0x02000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_IT)
+        {"yakutia repubblica", TERRITORY_RU_SA, 0x00008000},
+#endif
+        {"yakutia republic", TERRITORY_RU_SA, 0x010440e0},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AF)
+        {"yakutia republiek", TERRITORY_RU_SA, 0x00000001},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"yakutia republika", TERRITORY_RU_SA, 0x00002000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_SV)
+        {"yakutia republiken", TERRITORY_RU_SA, 0x00800000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_NO)
+        {"yakutia republikk", TERRITORY_RU_SA, 0x00080000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FI)
+        {"yakutia tasavalta", TERRITORY_RU_SA, 0x00000200},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"yakutistan", TERRITORY_RU_SA, 0x02000000},
+#endif
+        {"yamalo-nenets", TERRITORY_RU_YAN, 0x03bce1a1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ID)
+        {"yaman", TERRITORY_YEM, 0x00004000},
+#endif
+        {"yanzhao", TERRITORY_CN_HE, 0x00000080},
+        {"yaroslavl oblast", TERRITORY_RU_YAR, 0x039ce1a1},
+        {"yem", TERRITORY_YEM, 0x10000000},
+        {"yemen", TERRITORY_YEM, 0x0b0085a0},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"yeni brunswick", TERRITORY_CA_NB, 0x02000000},
+        {"yeni guney galler", TERRITORY_AU_NSW, 0x02000000},
+        {"yeni kaledonya", TERRITORY_NCL, 0x02000000},
+        {"yeni zelanda", TERRITORY_NZL, 0x02000000},
+        {"yesil burun adaları", TERRITORY_CPV, 0x02000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_FI)
+        {"yhdistyneet arabiemiirikunnat", TERRITORY_ARE, 0x00000200},
+        {"yhdysvallat", TERRITORY_USA, 0x00000200},
+        {"yhdysvaltain neitsytsaaret", TERRITORY_VIR, 0x00000200},
+        {"yhdysvaltain tyynenmeren erillissaaret", TERRITORY_UMI, 0x00000200},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AF)
+        {"ysland", TERRITORY_ISL, 0x00000001},
+#endif
+        {"yucatan", TERRITORY_MX_YUC, 0x0bace7f1},
+        {"yukon", TERRITORY_CA_YT, 0x0bbce7f1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"yukselis", TERRITORY_SHN, 0x02000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ID)
+        {"yunani", TERRITORY_GRC, 0x00004000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"yunanistan", TERRITORY_GRC, 0x02000000},
+#endif
+        {"yunnan", TERRITORY_CN_YN, 0x03bce7f1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"zabajkalski kraj", TERRITORY_RU_ZAB, 0x00002000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CS)
+        {"zabajkalsky kraj", TERRITORY_RU_ZAB, 0x00000010},
+#endif
+        {"zabaykalsky krai", TERRITORY_RU_ZAB, 0x039c81e1},
+        {"zacatecas", TERRITORY_MX_ZAC, 0x0bbce7f1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PL)
+        {"zachodnia australia", TERRITORY_AU_WA, 0x00200000},
+#endif
+        {"zaf", TERRITORY_ZAF, 0x10000000},
+        {"zambia", TERRITORY_ZMB, 0x09bcc1a0},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AF) || defined(MAPCODE_SUPPORT_LANGUAGE_CS) || defined(MAPCODE_SUPPORT_LANGUAGE_FR)
+        {"zambie", TERRITORY_ZMB, 0x00000411},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"zambija", TERRITORY_ZMB, 0x00002000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"zambiya", TERRITORY_ZMB, 0x02000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"zapadna australija", TERRITORY_AU_WA, 0x00002000},
+        {"zapadna sahara", TERRITORY_ESH, 0x00002000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CS)
+        {"zapadni australie", TERRITORY_AU_WA, 0x00000010},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"zapadni bengal", TERRITORY_IN_WB, 0x00002000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CS)
+        {"zapadni sahara", TERRITORY_ESH, 0x00000010},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"zelenortska republika", TERRITORY_CPV, 0x00002000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CS)
+        {"zeme", TERRITORY_AAA, 0x00000010},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"zemlja", TERRITORY_AAA, 0x00002000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DE)
+        {"zentralafrikanische republik", TERRITORY_CAF, 0x00000040},
+#endif
+        {"zhejiang", TERRITORY_CN_ZJ, 0x03bce7f1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR)
+        {"zidovska autonomna oblast", TERRITORY_RU_YEV, 0x00002000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CS)
+        {"zidovska autonomni oblast", TERRITORY_RU_YEV, 0x00000010},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PL)
+        {"zielonego przyladka", TERRITORY_CPV, 0x00200000},
+        {"ziemia", TERRITORY_AAA, 0x00200000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_ES) || defined(MAPCODE_SUPPORT_LANGUAGE_PT)
+        {"zimbabue", TERRITORY_ZWE, 0x00100100},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HR) || defined(MAPCODE_SUPPORT_LANGUAGE_TR)
+        {"zimbabve", TERRITORY_ZWE, 0x02002000},
+#endif
+        {"zimbabwe", TERRITORY_ZWE, 0x09acc6b1},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PL)
+        {"zjednoczone emiraty arabskie", TERRITORY_ARE, 0x00200000},
+#endif
+        {"zmb", TERRITORY_ZMB, 0x10000000},
+        {"zuid-afrika", TERRITORY_ZAF, 0x08040000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_NL)
+        {"zuid-georgie en de zuidelijke sandwicheilanden", TERRITORY_SGS, 0x00040000},
+        {"zuid-korea", TERRITORY_KOR, 0x00040000},
+        {"zuid-sandwicheilanden", TERRITORY_SGS, 0x00040000},
+        {"zuid-soedan", TERRITORY_SSD, 0x00040000},
+#endif
+        {"zwe", TERRITORY_ZWE, 0x10000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_NL)
+        {"zweden", TERRITORY_SWE, 0x00040000},
+        {"zwitserland", TERRITORY_CHE, 0x00040000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PL)
+        {"zydowski obwod autonomiczny", TERRITORY_RU_YEV, 0x00200000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DE)
+        {"zypern", TERRITORY_CYP, 0x00000040},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DA)
+        {"ækvatorial guinea", TERRITORY_GNQ, 0x00000020},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_NO)
+        {"øst-timor", TERRITORY_TLS, 0x00080000},
+        {"østerrike", TERRITORY_AUT, 0x00080000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_DA)
+        {"østrig", TERRITORY_AUT, 0x00000020},
+        {"østtimor", TERRITORY_TLS, 0x00000020},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_PL)
+        {"łotwa", TERRITORY_LVA, 0x00200000},
+#endif
+        {"ελλαδα", TERRITORY_GRC, 0x08000000},
+        {"κυπροσ", TERRITORY_CYP, 0x08000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"аб`яднаныя арабскія эміраты", TERRITORY_ARE, 0x00000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"австралия", TERRITORY_AUS, 0x00400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"австраліиська столична територія", TERRITORY_AU_ACT, 0x04000000},
+        {"австралія", TERRITORY_AUS, 0x04000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"австрия", TERRITORY_AUT, 0x00400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"австрія", TERRITORY_AUT, 0x04000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"агае", TERRITORY_US_OH, 0x00000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE) || defined(MAPCODE_SUPPORT_LANGUAGE_RU) || defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"агуаскальентес", TERRITORY_MX_AGU, 0x04400004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"аева", TERRITORY_US_IA, 0x00000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE) || defined(MAPCODE_SUPPORT_LANGUAGE_RU) || defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"азербаиджан", TERRITORY_AZE, 0x04400004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"аидаха", TERRITORY_US_ID, 0x00000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU) || defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"аидахо", TERRITORY_US_ID, 0x04400000},
+        {"аиова", TERRITORY_US_IA, 0x04400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"аклахома", TERRITORY_US_OK, 0x00000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"акри", TERRITORY_BR_AC, 0x00400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"акры", TERRITORY_BR_AC, 0x00000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"акрі", TERRITORY_BR_AC, 0x04000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE) || defined(MAPCODE_SUPPORT_LANGUAGE_RU) || defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"алабама", TERRITORY_US_AL, 0x04400004},
+        {"алагоас", TERRITORY_BR_AL, 0x04400004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"аландские острова", TERRITORY_ALA, 0x00400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"аландскія астравы", TERRITORY_ALA, 0x00000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"аландські острови", TERRITORY_ALA, 0x04000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"албания", TERRITORY_ALB, 0x00400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE) || defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"албанія", TERRITORY_ALB, 0x04000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU) || defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"алжир", TERRITORY_DZA, 0x04400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"алжыр", TERRITORY_DZA, 0x00000004},
+#endif
+        {"алтаи республика", TERRITORY_RU_AL, 0x08000000},
+        {"алтаискии краи", TERRITORY_RU_ALT, 0x08400000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"алтаискі краи", TERRITORY_RU_ALT, 0x00000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"алтаиськии краи", TERRITORY_RU_ALT, 0x04000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE) || defined(MAPCODE_SUPPORT_LANGUAGE_RU) || defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"альберта", TERRITORY_CA_AB, 0x04400004},
+        {"аляска", TERRITORY_US_AK, 0x04400004},
+        {"амазонас", TERRITORY_BR_AM, 0x04400004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"аман", TERRITORY_OMN, 0x00000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE) || defined(MAPCODE_SUPPORT_LANGUAGE_RU) || defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"амапа", TERRITORY_BR_AP, 0x04400004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU) || defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"америка", TERRITORY_USA, 0x04400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"американские виргинские острова", TERRITORY_VIR, 0x00400000},
+        {"американское самоа", TERRITORY_ASM, 0x00400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"американське самоа", TERRITORY_ASM, 0x04000000},
+        {"американські віргінські острови", TERRITORY_VIR, 0x04000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"амерыка", TERRITORY_USA, 0x00000004},
+        {"амерыканскае самоа", TERRITORY_ASM, 0x00000004},
+        {"амерыканскія віргінскія астравы", TERRITORY_VIR, 0x00000004},
+        {"амурская вобласць", TERRITORY_RU_AMU, 0x00000004},
+#endif
+        {"амурская область", TERRITORY_RU_AMU, 0x08400000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"амурська область", TERRITORY_RU_AMU, 0x04000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"ангилья", TERRITORY_AIA, 0x00400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE) || defined(MAPCODE_SUPPORT_LANGUAGE_RU) || defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"ангола", TERRITORY_AGO, 0x04400004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE) || defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"ангілья", TERRITORY_AIA, 0x04000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"андаманские и никобарские", TERRITORY_IN_AN, 0x00400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"андаманскія і никобарские", TERRITORY_IN_AN, 0x00000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"андаманські і нікобарські", TERRITORY_IN_AN, 0x04000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"андора", TERRITORY_AND, 0x00000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU) || defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"андорра", TERRITORY_AND, 0x04400000},
+        {"андхра-прадеш", TERRITORY_IN_AP, 0x04400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"андхра-прадэш", TERRITORY_IN_AP, 0x00000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU) || defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"антарктида", TERRITORY_ATA, 0x04400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"антарктыда", TERRITORY_ATA, 0x00000004},
+        {"антарые", TERRITORY_CA_ON, 0x00000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"антигуа и барбуда", TERRITORY_ATG, 0x00400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"антигуа і барбуда", TERRITORY_ATG, 0x04000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"антыгуа і барбуда", TERRITORY_ATG, 0x00000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE) || defined(MAPCODE_SUPPORT_LANGUAGE_RU) || defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"аньхои", TERRITORY_CN_AH, 0x04400004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU) || defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"аргентина", TERRITORY_ARG, 0x04400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"аргенціна", TERRITORY_ARG, 0x00000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"аризона", TERRITORY_US_AZ, 0x00400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE) || defined(MAPCODE_SUPPORT_LANGUAGE_RU) || defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"арканзас", TERRITORY_US_AR, 0x04400004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"арлоуская вобласць", TERRITORY_RU_ORL, 0x00000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"армения", TERRITORY_ARM, 0x00400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"арменія", TERRITORY_ARM, 0x00000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE) || defined(MAPCODE_SUPPORT_LANGUAGE_RU) || defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"аруба", TERRITORY_ABW, 0x04400004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU) || defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"аруначал-прадеш", TERRITORY_IN_AR, 0x04400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"аруначал-прадэш", TERRITORY_IN_AR, 0x00000004},
+        {"архангельская вобласць", TERRITORY_RU_ARK, 0x00000004},
+#endif
+        {"архангельская область", TERRITORY_RU_ARK, 0x08400000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"архангельська область", TERRITORY_RU_ARK, 0x04000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"арызона", TERRITORY_US_AZ, 0x00000004},
+        {"арыса", TERRITORY_IN_OR, 0x00000004},
+        {"арэгон", TERRITORY_US_OR, 0x00000004},
+        {"арэнбургская вобласць", TERRITORY_RU_ORE, 0x00000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"арізона", TERRITORY_US_AZ, 0x04000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"асам", TERRITORY_IN_AS, 0x00000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU) || defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"ассам", TERRITORY_IN_AS, 0x04400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"астравы тэркс і каикас", TERRITORY_TCA, 0x00000004},
+        {"астраханская вобласць", TERRITORY_RU_AST, 0x00000004},
+#endif
+        {"астраханская область", TERRITORY_RU_AST, 0x08400000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"астраханська область", TERRITORY_RU_AST, 0x04000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"аустраліиская сталічная тэрыторыя", TERRITORY_AU_ACT, 0x00000004},
+        {"аустралія", TERRITORY_AUS, 0x00000004},
+        {"аустрыя", TERRITORY_AUT, 0x00000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"афганистан", TERRITORY_AFG, 0x00400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE) || defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"афганістан", TERRITORY_AFG, 0x04000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"багамские о-ва", TERRITORY_BHS, 0x00400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"багамскія а-вы", TERRITORY_BHS, 0x00000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"багамські о-ви", TERRITORY_BHS, 0x04000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE) || defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"баия", TERRITORY_BR_BA, 0x00400004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"балгарыя", TERRITORY_BGR, 0x00000004},
+        {"балівія", TERRITORY_BOL, 0x00000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU) || defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"бангладеш", TERRITORY_BGD, 0x04400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"бангладэш", TERRITORY_BGD, 0x00000004},
+        {"барбадас", TERRITORY_BRB, 0x00000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU) || defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"барбадос", TERRITORY_BRB, 0x04400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE) || defined(MAPCODE_SUPPORT_LANGUAGE_RU) || defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"барбуда", TERRITORY_ATG, 0x04400004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"батсвана", TERRITORY_BWA, 0x00000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU) || defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"бахреин", TERRITORY_BHR, 0x04400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"бахрэин", TERRITORY_BHR, 0x00000004},
+#endif
+        {"башҡортостан республикаһы", TERRITORY_RU_BA, 0x08000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"баія", TERRITORY_BR_BA, 0x04000000},
+#endif
+        {"беларусь", TERRITORY_BLR, 0x08400004},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"белгародская вобласць", TERRITORY_RU_BE, 0x00000004},
+#endif
+        {"белгородская область", TERRITORY_RU_BE, 0x08400000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"белиз", TERRITORY_BLZ, 0x00400000},
+        {"бельгия", TERRITORY_BEL, 0x00400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE) || defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"бельгія", TERRITORY_BEL, 0x04000004},
+        {"беліз", TERRITORY_BLZ, 0x04000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"бенин", TERRITORY_BEN, 0x00400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE) || defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"бенін", TERRITORY_BEN, 0x04000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"бераг слановаи косці", TERRITORY_CIV, 0x00000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"берег слоновоі кістки", TERRITORY_CIV, 0x04000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"бермудские острова", TERRITORY_BMU, 0x00400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"бермудські острови", TERRITORY_BMU, 0x04000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"бермуды", TERRITORY_BMU, 0x00400000},
+        {"бирма", TERRITORY_MMR, 0x00400000},
+        {"бихар", TERRITORY_IN_BR, 0x00400000},
+        {"болгария", TERRITORY_BGR, 0x00400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"болгарія", TERRITORY_BGR, 0x04000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"боливия", TERRITORY_BOL, 0x00400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"болівія", TERRITORY_BOL, 0x04000000},
+        {"бонаире, сент-естатіус і саба", TERRITORY_BES, 0x04000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"бонаире, сент-эстатиус и саба", TERRITORY_BES, 0x00400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"бонаире, сэнт-эстатиус і саба", TERRITORY_BES, 0x00000004},
+#endif
+        {"босна и херцеговина", TERRITORY_BIH, 0x08000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"босния и герцеговина", TERRITORY_BIH, 0x00400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"боснія і герцагавіна", TERRITORY_BIH, 0x00000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"боснія і герцеговина", TERRITORY_BIH, 0x04000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU) || defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"ботсвана", TERRITORY_BWA, 0x04400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"бразилия", TERRITORY_BRA, 0x00400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"бразилія", TERRITORY_BRA, 0x04000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"бразілія", TERRITORY_BRA, 0x00000004},
+        {"бранская вобласць", TERRITORY_RU_BRY, 0x00000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"британская колумбия", TERRITORY_CA_BC, 0x00400000},
+        {"британская территория индииского океана", TERRITORY_IOT, 0x00400000},
+        {"британские виргинские острова", TERRITORY_VGB, 0x00400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"британська колумбія", TERRITORY_CA_BC, 0x04000000},
+        {"британська територія в індіиському океані", TERRITORY_IOT, 0x04000000},
+        {"британські віргінські острови", TERRITORY_VGB, 0x04000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE) || defined(MAPCODE_SUPPORT_LANGUAGE_RU) || defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"брунеи", TERRITORY_BRN, 0x04400004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"брытанская калумбія", TERRITORY_CA_BC, 0x00000004},
+        {"брытанская тэрыторыя у індыискім акіяне", TERRITORY_IOT, 0x00000004},
+        {"брытанскія віргінскія астравы", TERRITORY_VGB, 0x00000004},
+#endif
+        {"брянская область", TERRITORY_RU_BRY, 0x08400000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"брянська область", TERRITORY_RU_BRY, 0x04000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"буркина-фасо", TERRITORY_BFA, 0x00400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE) || defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"буркіна-фасо", TERRITORY_BFA, 0x04000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"бурундзі", TERRITORY_BDI, 0x00000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"бурунди", TERRITORY_BDI, 0x00400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"бурунді", TERRITORY_BDI, 0x04000000},
+#endif
+        {"буряад улас", TERRITORY_RU_BU, 0x08000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE) || defined(MAPCODE_SUPPORT_LANGUAGE_RU) || defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"бутан", TERRITORY_BTN, 0x04400004},
+#endif
+        {"българия", TERRITORY_BGR, 0x08000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"бэрмудзкія выспы", TERRITORY_BMU, 0x00000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"бєлгородська область", TERRITORY_RU_BE, 0x04000000},
+        {"білорусь", TERRITORY_BLR, 0x04000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE) || defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"бірма", TERRITORY_MMR, 0x04000004},
+        {"біхар", TERRITORY_IN_BR, 0x04000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"в`етнам", TERRITORY_VNM, 0x00000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"в`єтнам", TERRITORY_VNM, 0x04000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"ваемінг", TERRITORY_US_WY, 0x00000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"ваиоминг", TERRITORY_US_WY, 0x00400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"ваиомінг", TERRITORY_US_WY, 0x04000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"валагодская вобласць", TERRITORY_RU_VLG, 0x00000004},
+        {"валгаградская вобласць", TERRITORY_RU_VGG, 0x00000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE) || defined(MAPCODE_SUPPORT_LANGUAGE_RU) || defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"вануату", TERRITORY_VUT, 0x04400004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"варонежская вобласць", TERRITORY_RU_VOR, 0x00000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU) || defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"вашингтон", TERRITORY_US_WA, 0x04400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"вашынгтон", TERRITORY_US_WA, 0x00000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"великобритания", TERRITORY_GBR, 0x00400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"великобританія", TERRITORY_GBR, 0x04000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"венгрия", TERRITORY_HUN, 0x00400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"венгрыя", TERRITORY_HUN, 0x00000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"венесуела", TERRITORY_VEN, 0x04000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE) || defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"венесуэла", TERRITORY_VEN, 0x00400004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE) || defined(MAPCODE_SUPPORT_LANGUAGE_RU) || defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"веракрус", TERRITORY_MX_VER, 0x04400004},
+        {"вермонт", TERRITORY_US_VT, 0x04400004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"виктория", TERRITORY_AU_VIC, 0x00400000},
+        {"виргиния", TERRITORY_US_VA, 0x00400000},
+        {"виргинские острова, британские", TERRITORY_VGB, 0x00400000},
+        {"виргинские острова, сша", TERRITORY_VIR, 0x00400000},
+        {"висконсин", TERRITORY_US_WI, 0x00400000},
+#endif
+        {"владимирская область", TERRITORY_RU_VLA, 0x08400000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"внутренняя монголия", TERRITORY_CN_NM, 0x00400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"внутрішня монголія", TERRITORY_CN_NM, 0x04000000},
+        {"возз`єднання", TERRITORY_REU, 0x04000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"вознесение", TERRITORY_SHN, 0x00400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"вознесіння", TERRITORY_SHN, 0x04000000},
+#endif
+        {"волгоградская область", TERRITORY_RU_VGG, 0x08400000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"волгоградська область", TERRITORY_RU_VGG, 0x04000000},
+#endif
+        {"вологодская область", TERRITORY_RU_VLG, 0x08400000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"вологодська область", TERRITORY_RU_VLG, 0x04000000},
+        {"володимирська область", TERRITORY_RU_VLA, 0x04000000},
+#endif
+        {"воронежская область", TERRITORY_RU_VOR, 0x0c400000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"воссоединение", TERRITORY_REU, 0x00400000},
+        {"восточныи тимор", TERRITORY_TLS, 0x00400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"вострау буве", TERRITORY_BVT, 0x00000004},
+        {"вострау каляд", TERRITORY_CXR, 0x00000004},
+        {"вострау кліпертан", TERRITORY_CPT, 0x00000004},
+        {"вострау мэн", TERRITORY_IMN, 0x00000004},
+        {"вострау прынца эдуарда", TERRITORY_CA_PE, 0x00000004},
+        {"вострау херд і выспы макдональд", TERRITORY_HMD, 0x00000004},
+        {"выспы кука", TERRITORY_COK, 0x00000004},
+        {"выспы фіджы", TERRITORY_FJI, 0x00000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"вьетнам", TERRITORY_VNM, 0x00400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"вялікабрытанія", TERRITORY_GBR, 0x00000004},
+        {"вікторыя", TERRITORY_AU_VIC, 0x00000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"вікторія", TERRITORY_AU_VIC, 0x04000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"віргінскія выспы, брытанскія", TERRITORY_VGB, 0x00000004},
+        {"віргінскія выспы, зша", TERRITORY_VIR, 0x00000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"віргінські острови, британські", TERRITORY_VGB, 0x04000000},
+        {"віргінські острови, сша", TERRITORY_VIR, 0x04000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE) || defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"віргінія", TERRITORY_US_VA, 0x04000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"вірменія", TERRITORY_ARM, 0x04000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE) || defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"вісконсін", TERRITORY_US_WI, 0x04000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE) || defined(MAPCODE_SUPPORT_LANGUAGE_RU) || defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"габон", TERRITORY_GAB, 0x04400004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"гаваии", TERRITORY_US_HI, 0x00400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE) || defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"гаваі", TERRITORY_US_HI, 0x04000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU) || defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"гаиана", TERRITORY_GUY, 0x04400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"гаити", TERRITORY_HTI, 0x00400000},
+        {"гамбия", TERRITORY_GMB, 0x00400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE) || defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"гамбія", TERRITORY_GMB, 0x04000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE) || defined(MAPCODE_SUPPORT_LANGUAGE_RU) || defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"гана", TERRITORY_GHA, 0x04400004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"гандурас", TERRITORY_HND, 0x00000004},
+        {"ганконг", TERRITORY_HKG, 0x00000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE) || defined(MAPCODE_SUPPORT_LANGUAGE_RU) || defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"ганьсу", TERRITORY_CN_GS, 0x04400004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"гаяна", TERRITORY_GUY, 0x00000004},
+        {"гаяс", TERRITORY_BR_GO, 0x00000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"гаіті", TERRITORY_HTI, 0x04000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"гаіці", TERRITORY_HTI, 0x00000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU) || defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"гваделупа", TERRITORY_GLP, 0x04400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"гвадэлупа", TERRITORY_GLP, 0x00000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU) || defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"гватемала", TERRITORY_GTM, 0x04400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"гватэмала", TERRITORY_GTM, 0x00000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"гвинея", TERRITORY_GIN, 0x00400000},
+        {"гвинея-бисау", TERRITORY_GNB, 0x00400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE) || defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"гвінея", TERRITORY_GIN, 0x04000004},
+        {"гвінея-бісау", TERRITORY_GNB, 0x04000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"германия", TERRITORY_DEU, 0x00400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"германія", TERRITORY_DEU, 0x00000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"гернси", TERRITORY_GGY, 0x00400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE) || defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"гернсі", TERRITORY_GGY, 0x04000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU) || defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"герреро", TERRITORY_MX_GRO, 0x04400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"герэра", TERRITORY_MX_GRO, 0x00000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"гибралтар", TERRITORY_GIB, 0x00400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE) || defined(MAPCODE_SUPPORT_LANGUAGE_RU) || defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"гоа", TERRITORY_IN_GA, 0x04400004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU) || defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"гондурас", TERRITORY_HND, 0x04400000},
+        {"гонконг", TERRITORY_HKG, 0x04400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"горад ватыкан", TERRITORY_VAT, 0x00000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"город ватикан", TERRITORY_VAT, 0x00400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU) || defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"гояс", TERRITORY_BR_GO, 0x04400000},
+        {"гренада", TERRITORY_GRD, 0x04400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"гренадины", TERRITORY_VCT, 0x00400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"гренадіни", TERRITORY_VCT, 0x04000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"гренландия", TERRITORY_GRL, 0x00400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"гренландія", TERRITORY_GRL, 0x04000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"греция", TERRITORY_GRC, 0x00400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"греція", TERRITORY_GRC, 0x04000000},
+#endif
+        {"грузия", TERRITORY_GEO, 0x08400000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"грузия", TERRITORY_US_GA, 0x00400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE) || defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"грузія", TERRITORY_GEO, 0x04000004},
+        {"грузія", TERRITORY_US_GA, 0x04000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"грэнада", TERRITORY_GRD, 0x00000004},
+        {"грэнадыны", TERRITORY_VCT, 0x00000004},
+        {"грэнландыя", TERRITORY_GRL, 0x00000004},
+        {"грэцыя", TERRITORY_GRC, 0x00000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE) || defined(MAPCODE_SUPPORT_LANGUAGE_RU) || defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"гуам", TERRITORY_GUM, 0x04400004},
+        {"гуанахуато", TERRITORY_MX_GUA, 0x04400004},
+        {"гуандун", TERRITORY_CN_GD, 0x04400004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"гуанси-чжуанскии", TERRITORY_CN_GX, 0x00400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"гуансі-чжуанскі", TERRITORY_CN_GX, 0x00000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"гуансі-чжуанськии", TERRITORY_CN_GX, 0x04000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE) || defined(MAPCODE_SUPPORT_LANGUAGE_RU) || defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"гуджарат", TERRITORY_IN_GJ, 0x04400004},
+        {"гуичжоу", TERRITORY_CN_GZ, 0x04400004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE) || defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"гібралтар", TERRITORY_GIB, 0x04000004},
+#endif
+        {"гӏалгӏаи мохк", TERRITORY_RU_IN, 0x08000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"дадра и нагархавели", TERRITORY_IN_DN, 0x00400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"дадра і нагархавели", TERRITORY_IN_DN, 0x00000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"дадра і нагархавелі", TERRITORY_IN_DN, 0x04000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"даман и диу", TERRITORY_IN_DD, 0x00400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"даман і дзі", TERRITORY_IN_DD, 0x00000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"даман і діу", TERRITORY_IN_DD, 0x04000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"дамініка", TERRITORY_DMA, 0x00000004},
+        {"дамініканская рэспубліка", TERRITORY_DOM, 0x00000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"дания", TERRITORY_DNK, 0x00400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE) || defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"данія", TERRITORY_DNK, 0x04000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"делавер", TERRITORY_US_DE, 0x04000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"делавэр", TERRITORY_US_DE, 0x00400000},
+        {"дели", TERRITORY_IN_DL, 0x00400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"делі", TERRITORY_IN_DL, 0x04000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"джамму и кашмир", TERRITORY_IN_JK, 0x00400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"джамму і кашмір", TERRITORY_IN_JK, 0x04000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"джаму і кашмір", TERRITORY_IN_JK, 0x00000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE) || defined(MAPCODE_SUPPORT_LANGUAGE_RU) || defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"джаркханд", TERRITORY_IN_JH, 0x04400004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"джерси", TERRITORY_JEY, 0x00400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"джерсі", TERRITORY_JEY, 0x04000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"джибути", TERRITORY_DJI, 0x00400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"джыбуці", TERRITORY_DJI, 0x00000004},
+        {"джэрсі", TERRITORY_JEY, 0x00000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"джібуті", TERRITORY_DJI, 0x04000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"доминика", TERRITORY_DMA, 0x00400000},
+        {"доминиканская республика", TERRITORY_DOM, 0x00400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"домініка", TERRITORY_DMA, 0x04000000},
+        {"домініканська республіка", TERRITORY_DOM, 0x04000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE) || defined(MAPCODE_SUPPORT_LANGUAGE_RU) || defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"дуранго", TERRITORY_MX_DUR, 0x04400004},
+#endif
+        {"дыгэ республик", TERRITORY_RU_AD, 0x08000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"дэлавэр", TERRITORY_US_DE, 0x00000004},
+        {"дэлі", TERRITORY_IN_DL, 0x00000004},
+#endif
+        {"евреиская автономная область", TERRITORY_RU_YEV, 0x08400000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"египет", TERRITORY_EGY, 0x00400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"егіпет", TERRITORY_EGY, 0x00000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"еквадор", TERRITORY_ECU, 0x04000000},
+        {"екваторіальна гвінея", TERRITORY_GNQ, 0x04000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"емен", TERRITORY_YEM, 0x00000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"еритрея", TERRITORY_ERI, 0x04000000},
+        {"еспіріту-санту", TERRITORY_BR_ES, 0x04000000},
+        {"естонія", TERRITORY_EST, 0x04000000},
+        {"ефіопія", TERRITORY_ETH, 0x04000000},
+#endif
+        {"забаикальскии краи", TERRITORY_RU_ZAB, 0x08400000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"забаикальскі краи", TERRITORY_RU_ZAB, 0x00000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"забаикальськии краи", TERRITORY_RU_ZAB, 0x04000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"замбия", TERRITORY_ZMB, 0x00400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE) || defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"замбія", TERRITORY_ZMB, 0x04000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"западная австралия", TERRITORY_AU_WA, 0x00400000},
+        {"западная бенгалия", TERRITORY_IN_WB, 0x00400000},
+        {"западная виргиния", TERRITORY_US_WV, 0x00400000},
+        {"западная сахара", TERRITORY_ESH, 0x00400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"заходняя аустралія", TERRITORY_AU_WA, 0x00000004},
+        {"заходняя бенгалія", TERRITORY_IN_WB, 0x00000004},
+        {"заходняя вірджынія", TERRITORY_US_WV, 0x00000004},
+        {"заходняя сахара", TERRITORY_ESH, 0x00000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"західна австралія", TERRITORY_AU_WA, 0x04000000},
+        {"західна бенгалія", TERRITORY_IN_WB, 0x04000000},
+        {"західна віргінія", TERRITORY_US_WV, 0x04000000},
+        {"західна сахара", TERRITORY_ESH, 0x04000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU) || defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"земля", TERRITORY_AAA, 0x04400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"зимбабве", TERRITORY_ZWE, 0x00400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"злучанае каралеуства", TERRITORY_GBR, 0x00000004},
+        {"злучаныя штаты амерыкі", TERRITORY_USA, 0x00000004},
+        {"зша", TERRITORY_USA, 0x00000004},
+        {"зша знешнія малыя выспы", TERRITORY_UMI, 0x00000004},
+        {"зямля", TERRITORY_AAA, 0x00000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"зімбабве", TERRITORY_ZWE, 0x04000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"зімбабвэ", TERRITORY_ZWE, 0x00000004},
+#endif
+        {"ивановская область", TERRITORY_RU_IVA, 0x08400000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"идальго", TERRITORY_MX_HID, 0x00400000},
+        {"иемен", TERRITORY_YEM, 0x00400000},
+        {"израиль", TERRITORY_ISR, 0x00400000},
+        {"иллиноис", TERRITORY_US_IL, 0x00400000},
+        {"индиана", TERRITORY_US_IN, 0x00400000},
+        {"индия", TERRITORY_IND, 0x00400000},
+        {"индонезия", TERRITORY_IDN, 0x00400000},
+        {"иордания", TERRITORY_JOR, 0x00400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"иорданія", TERRITORY_JOR, 0x04000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"ирак", TERRITORY_IRQ, 0x00400000},
+#endif
+        {"иркутская область", TERRITORY_RU_IRK, 0x08400000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"ирландия", TERRITORY_IRL, 0x00400000},
+        {"ирландия, северная", TERRITORY_GBR, 0x00400000},
+        {"исландия", TERRITORY_ISL, 0x00400000},
+        {"испания", TERRITORY_ESP, 0x00400000},
+        {"италия", TERRITORY_ITA, 0x00400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"каба-вэрдэ", TERRITORY_CPV, 0x00000004},
+        {"кабардзіна-балкарыя рэспубліка", TERRITORY_RU_KB, 0x00000004},
+#endif
+        {"кабардино-балкарская республика", TERRITORY_RU_KB, 0x08400000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"кабардино-балкарська республіка", TERRITORY_RU_KB, 0x04000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU) || defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"кабо-верде", TERRITORY_CPV, 0x04400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE) || defined(MAPCODE_SUPPORT_LANGUAGE_RU) || defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"казахстан", TERRITORY_KAZ, 0x04400004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"каикас", TERRITORY_TCA, 0x00000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU) || defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"каикос", TERRITORY_TCA, 0x04400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"каиманавы выспы", TERRITORY_CYM, 0x00000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"каимановы острова", TERRITORY_CYM, 0x00400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"каиманові острови", TERRITORY_CYM, 0x04000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"какосавыя астравы", TERRITORY_CCK, 0x00000004},
+        {"каларада", TERRITORY_US_CO, 0x00000004},
+#endif
+        {"калининградская область", TERRITORY_RU_KGD, 0x08400000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"калифорния", TERRITORY_US_CA, 0x00400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"калужская вобласць", TERRITORY_RU_KLU, 0x00000004},
+#endif
+        {"калужская область", TERRITORY_RU_KLU, 0x08400000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"калузька область", TERRITORY_RU_KLU, 0x04000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"калумбія", TERRITORY_COL, 0x00000004},
+        {"калінінградская вобласць", TERRITORY_RU_KGD, 0x00000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"калінінградська область", TERRITORY_RU_KGD, 0x04000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE) || defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"каліфорнія", TERRITORY_US_CA, 0x04000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE) || defined(MAPCODE_SUPPORT_LANGUAGE_RU) || defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"камбоджа", TERRITORY_KHM, 0x04400004},
+        {"камерун", TERRITORY_CMR, 0x04400004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"каморскія выспы", TERRITORY_COM, 0x00000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE) || defined(MAPCODE_SUPPORT_LANGUAGE_RU) || defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"кампече", TERRITORY_MX_CAM, 0x04400004},
+#endif
+        {"камчатскии краи", TERRITORY_RU_KAM, 0x08400000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"камчатськии краи", TERRITORY_RU_KAM, 0x04000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"камчацкі краи", TERRITORY_RU_KAM, 0x00000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE) || defined(MAPCODE_SUPPORT_LANGUAGE_RU) || defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"канада", TERRITORY_CAN, 0x04400004},
+        {"канзас", TERRITORY_US_KS, 0x04400004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"канэктыкут", TERRITORY_US_CT, 0x00000004},
+        {"карачаева-чаркеская рэспубліка", TERRITORY_RU_KC, 0x00000004},
+#endif
+        {"карачаево-черкесская республика", TERRITORY_RU_KC, 0x08400000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"карачаєво-черкеська республіка", TERRITORY_RU_KC, 0x04000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE) || defined(MAPCODE_SUPPORT_LANGUAGE_RU) || defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"карнатака", TERRITORY_IN_KA, 0x04400004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"кастрамская вобласць", TERRITORY_RU_KOS, 0x00000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE) || defined(MAPCODE_SUPPORT_LANGUAGE_RU) || defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"катар", TERRITORY_QAT, 0x04400004},
+        {"квебек", TERRITORY_CA_QC, 0x04400004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"квинсленд", TERRITORY_AU_QLD, 0x00400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE) || defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"квінсленд", TERRITORY_AU_QLD, 0x04000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"кемерауская вобласць", TERRITORY_RU_KEM, 0x00000004},
+#endif
+        {"кемеровская область", TERRITORY_RU_KEM, 0x08400000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"кемеровська область", TERRITORY_RU_KEM, 0x04000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"кения", TERRITORY_KEN, 0x00400000},
+        {"кентукки", TERRITORY_US_KY, 0x00400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"кентуккі", TERRITORY_US_KY, 0x04000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"кентукі", TERRITORY_US_KY, 0x00000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE) || defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"кенія", TERRITORY_KEN, 0x04000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE) || defined(MAPCODE_SUPPORT_LANGUAGE_RU) || defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"керала", TERRITORY_IN_KL, 0x04400004},
+        {"керетаро", TERRITORY_MX_QUE, 0x04400004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"килинг острова", TERRITORY_CCK, 0x00400000},
+        {"кинтана-роо", TERRITORY_MX_ROO, 0x00400000},
+        {"кипр", TERRITORY_CYP, 0x00400000},
+#endif
+        {"киргизия", TERRITORY_KGZ, 0x08400000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"киргизія", TERRITORY_KGZ, 0x04000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"кирибати", TERRITORY_KIR, 0x00400000},
+#endif
+        {"кировская область", TERRITORY_RU_KI, 0x08400000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU) || defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"китаи", TERRITORY_CHN, 0x04400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE) || defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"коахуила", TERRITORY_MX_COA, 0x00400004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"коахуіла", TERRITORY_MX_COA, 0x04000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"кокосовые острова", TERRITORY_CCK, 0x00400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"кокосові острови", TERRITORY_CCK, 0x04000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE) || defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"колима", TERRITORY_MX_CL, 0x00400004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU) || defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"колорадо", TERRITORY_US_CO, 0x04400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"колумбия", TERRITORY_COL, 0x00400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"колумбія", TERRITORY_COL, 0x04000000},
+        {"коліма", TERRITORY_MX_CL, 0x04000000},
+#endif
+        {"коми республика", TERRITORY_RU_KO, 0x08000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"коморские острова", TERRITORY_COM, 0x00400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"коморські острови", TERRITORY_COM, 0x04000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"конга-бразавіль", TERRITORY_COG, 0x00000004},
+        {"конга-кіншаса", TERRITORY_COD, 0x00000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"конго-браззавиль", TERRITORY_COG, 0x00400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"конго-браззавіль", TERRITORY_COG, 0x04000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"конго-киншаса", TERRITORY_COD, 0x00400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"конго-кіншаса", TERRITORY_COD, 0x04000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU) || defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"коннектикут", TERRITORY_US_CT, 0x04400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"коста-рика", TERRITORY_CRI, 0x00400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"коста-рыка", TERRITORY_CRI, 0x00000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"коста-ріка", TERRITORY_CRI, 0x04000000},
+#endif
+        {"костромская область", TERRITORY_RU_KOS, 0x08400000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"костромська область", TERRITORY_RU_KOS, 0x04000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"кот-д`ивуар", TERRITORY_CIV, 0x00400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"краснадарскі краи", TERRITORY_RU_KDA, 0x00000004},
+        {"краснаярскі краи", TERRITORY_RU_KYA, 0x00000004},
+#endif
+        {"краснодарскии краи", TERRITORY_RU_KDA, 0x08400000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"краснодарськии краи", TERRITORY_RU_KDA, 0x04000000},
+#endif
+        {"красноярскии краи", TERRITORY_RU_KYA, 0x08400000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"красноярськии краи", TERRITORY_RU_KYA, 0x04000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE) || defined(MAPCODE_SUPPORT_LANGUAGE_RU) || defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"куба", TERRITORY_CUB, 0x04400004},
+        {"кувеит", TERRITORY_KWT, 0x04400004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"курганская вобласць", TERRITORY_RU_KGN, 0x00000004},
+#endif
+        {"курганская область", TERRITORY_RU_KGN, 0x08400000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"курганська область", TERRITORY_RU_KGN, 0x04000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"курская вобласць", TERRITORY_RU_KRS, 0x00000004},
+#endif
+        {"курская область", TERRITORY_RU_KRS, 0x08400000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"курська область", TERRITORY_RU_KRS, 0x04000000},
+#endif
+        {"къабарты-малкъар республика", TERRITORY_RU_KB, 0x08000000},
+        {"къарачаи-черкес республика", TERRITORY_RU_KC, 0x08000000},
+        {"къэбэрдеи-балъкъэр республикэ", TERRITORY_RU_KB, 0x08000000},
+        {"къэрэшеи-шэрджэс республикэ", TERRITORY_RU_KC, 0x08000000},
+        {"кыргызстан", TERRITORY_KGZ, 0x08000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"кілінг выспы", TERRITORY_CCK, 0x00000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"кілінг острова", TERRITORY_CCK, 0x04000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"кінта-рга", TERRITORY_MX_ROO, 0x00000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"кінтана-роо", TERRITORY_MX_ROO, 0x04000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE) || defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"кіпр", TERRITORY_CYP, 0x04000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"кірауская вобласць", TERRITORY_RU_KI, 0x00000004},
+        {"кіргізія", TERRITORY_KGZ, 0x00000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"кіровська область", TERRITORY_RU_KI, 0x04000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"кірыбаці", TERRITORY_KIR, 0x00000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"кірібаті", TERRITORY_KIR, 0x04000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"кітаи", TERRITORY_CHN, 0x00000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE) || defined(MAPCODE_SUPPORT_LANGUAGE_RU) || defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"лакшадвип", TERRITORY_IN_LD, 0x04400004},
+        {"лаос", TERRITORY_LAO, 0x04400004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"латвия", TERRITORY_LVA, 0x00400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE) || defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"латвія", TERRITORY_LVA, 0x04000004},
+#endif
+        {"ленинградская область", TERRITORY_RU_LEN, 0x08400000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"ленінградская вобласць", TERRITORY_RU_LEN, 0x00000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"ленінградська область", TERRITORY_RU_LEN, 0x04000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"лесота", TERRITORY_LSO, 0x00000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU) || defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"лесото", TERRITORY_LSO, 0x04400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"либерия", TERRITORY_LBR, 0x00400000},
+        {"ливан", TERRITORY_LBN, 0x00400000},
+        {"ливия", TERRITORY_LBY, 0x00400000},
+        {"ликер кюрасо", TERRITORY_CUW, 0x00400000},
+#endif
+        {"липецкая область", TERRITORY_RU_LIP, 0x08400000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"липецька область", TERRITORY_RU_LIP, 0x04000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU) || defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"литва", TERRITORY_LTU, 0x04400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"лихтенштеин", TERRITORY_LIE, 0x00400000},
+        {"луизиана", TERRITORY_US_LA, 0x00400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"луізіана", TERRITORY_US_LA, 0x04000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"луізіяна", TERRITORY_US_LA, 0x00000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE) || defined(MAPCODE_SUPPORT_LANGUAGE_RU) || defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"люксембург", TERRITORY_LUX, 0x04400004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"ляанін", TERRITORY_CN_LN, 0x00000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"ляонин", TERRITORY_CN_LN, 0x00400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"ляонін", TERRITORY_CN_LN, 0x04000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"ліберыя", TERRITORY_LBR, 0x00000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"ліберія", TERRITORY_LBR, 0x04000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE) || defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"ліван", TERRITORY_LBN, 0x04000004},
+        {"лівія", TERRITORY_LBY, 0x04000004},
+        {"лікер кюрасо", TERRITORY_CUW, 0x04000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"ліпецкая вобласць", TERRITORY_RU_LIP, 0x00000004},
+        {"літва", TERRITORY_LTU, 0x00000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"ліхтенштеин", TERRITORY_LIE, 0x04000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"ліхтэнштэин", TERRITORY_LIE, 0x00000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE) || defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"м`янма", TERRITORY_MMR, 0x04000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"маврикии", TERRITORY_MUS, 0x00400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"маврикіи", TERRITORY_MUS, 0x04000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"мавритания", TERRITORY_MRT, 0x00400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"мавританія", TERRITORY_MRT, 0x04000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"магаданская вобласць", TERRITORY_RU_MAG, 0x00000004},
+#endif
+        {"магаданская область", TERRITORY_RU_MAG, 0x08400000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"магаданська область", TERRITORY_RU_MAG, 0x04000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE) || defined(MAPCODE_SUPPORT_LANGUAGE_RU) || defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"мадагаскар", TERRITORY_MDG, 0x04400004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"мадх`я-прадэш", TERRITORY_IN_MP, 0x00000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU) || defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"мадхья-прадеш", TERRITORY_IN_MP, 0x04400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"маета", TERRITORY_MYT, 0x00000004},
+        {"мазамбік", TERRITORY_MOZ, 0x00000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU) || defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"маиотта", TERRITORY_MYT, 0x04400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE) || defined(MAPCODE_SUPPORT_LANGUAGE_RU) || defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"макао", TERRITORY_MAC, 0x04400004},
+        {"макдональд", TERRITORY_HMD, 0x04400004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"македония", TERRITORY_MKD, 0x00400000},
+#endif
+        {"македонија", TERRITORY_MKD, 0x08000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE) || defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"македонія", TERRITORY_MKD, 0x04000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"малави", TERRITORY_MWI, 0x00400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE) || defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"малаві", TERRITORY_MWI, 0x04000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"малаизия", TERRITORY_MYS, 0x00400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE) || defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"малаизія", TERRITORY_MYS, 0x04000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"малдова", TERRITORY_MDA, 0x00000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"мали", TERRITORY_MLI, 0x00400000},
+        {"мальдивы", TERRITORY_MDV, 0x00400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"мальдывы", TERRITORY_MDV, 0x00000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"мальдіви", TERRITORY_MDV, 0x04000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE) || defined(MAPCODE_SUPPORT_LANGUAGE_RU) || defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"мальта", TERRITORY_MLT, 0x04400004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE) || defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"малі", TERRITORY_MLI, 0x04000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"манака", TERRITORY_MCO, 0x00000004},
+        {"манголія", TERRITORY_MNG, 0x00000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"манипур", TERRITORY_IN_MN, 0x00400000},
+        {"манитоба", TERRITORY_CA_MB, 0x00400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"мансерат", TERRITORY_MSR, 0x00000004},
+        {"мантана", TERRITORY_US_MT, 0x00000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE) || defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"маніпур", TERRITORY_IN_MN, 0x04000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"манітоба", TERRITORY_CA_MB, 0x04000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"манітобы", TERRITORY_CA_MB, 0x00000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE) || defined(MAPCODE_SUPPORT_LANGUAGE_RU) || defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"мараньян", TERRITORY_BR_MA, 0x04400004},
+#endif
+        {"марии эл республик", TERRITORY_RU_ME, 0x08000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"марока", TERRITORY_MAR, 0x00000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU) || defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"марокко", TERRITORY_MAR, 0x04400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"мартиника", TERRITORY_MTQ, 0x00400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"мартинюк", TERRITORY_MTQ, 0x04000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"марцініка", TERRITORY_MTQ, 0x00000004},
+        {"маршалавы выспы", TERRITORY_MHL, 0x00000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"маршалловы острова", TERRITORY_MHL, 0x00400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"маршаллові острови", TERRITORY_MHL, 0x04000000},
+#endif
+        {"мары эл республик", TERRITORY_RU_ME, 0x08000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"масачусэтс", TERRITORY_US_MA, 0x00000004},
+        {"масква", TERRITORY_RU_MOW, 0x00000004},
+        {"маскоуская вобласць", TERRITORY_RU_MOS, 0x00000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU) || defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"массачусетс", TERRITORY_US_MA, 0x04400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE) || defined(MAPCODE_SUPPORT_LANGUAGE_RU) || defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"мату-гросу", TERRITORY_BR_MT, 0x04400004},
+        {"мату-гросу-ду-сул", TERRITORY_BR_MS, 0x04400004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"маурыкіи", TERRITORY_MUS, 0x00000004},
+        {"маурытанія", TERRITORY_MRT, 0x00000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE) || defined(MAPCODE_SUPPORT_LANGUAGE_RU) || defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"махараштра", TERRITORY_IN_MH, 0x04400004},
+        {"мегхалая", TERRITORY_IN_ML, 0x04400004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"международныи", TERRITORY_AAA, 0x00400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU) || defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"мексика", TERRITORY_MEX, 0x04400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"мексіка", TERRITORY_MEX, 0x00000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"мен", TERRITORY_US_ME, 0x04000000},
+        {"меріленд", TERRITORY_US_MD, 0x04000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE) || defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"мизорам", TERRITORY_IN_MZ, 0x00400004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"микелон", TERRITORY_SPM, 0x00400000},
+        {"микронезия", TERRITORY_FSM, 0x00400000},
+        {"минас-жераис", TERRITORY_BR_MG, 0x00400000},
+        {"миннесота", TERRITORY_US_MN, 0x00400000},
+        {"мир", TERRITORY_AAA, 0x00400000},
+        {"миссисипи", TERRITORY_US_MS, 0x00400000},
+        {"миссури", TERRITORY_US_MO, 0x00400000},
+        {"мичиган", TERRITORY_US_MI, 0x00400000},
+        {"мичоакан", TERRITORY_MX_MIC, 0x00400000},
+        {"мозамбик", TERRITORY_MOZ, 0x00400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"мозамбік", TERRITORY_MOZ, 0x04000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU) || defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"молдова", TERRITORY_MDA, 0x04400000},
+        {"монако", TERRITORY_MCO, 0x04400000},
+#endif
+        {"монгол улс", TERRITORY_MNG, 0x08000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"монголия", TERRITORY_MNG, 0x00400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"монголія", TERRITORY_MNG, 0x04000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU) || defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"монсеррат", TERRITORY_MSR, 0x04400000},
+        {"монтана", TERRITORY_US_MT, 0x04400000},
+#endif
+        {"мордовия республикась", TERRITORY_RU_MO, 0x08000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE) || defined(MAPCODE_SUPPORT_LANGUAGE_RU) || defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"морелос", TERRITORY_MX_MOR, 0x04400004},
+#endif
+        {"москва", TERRITORY_RU_MOW, 0x0c400000},
+        {"московская область", TERRITORY_RU_MOS, 0x08400000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"московська область", TERRITORY_RU_MOS, 0x04000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"мурманская вобласць", TERRITORY_RU_MUR, 0x00000004},
+#endif
+        {"мурманская область", TERRITORY_RU_MUR, 0x08400000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"мурманська область", TERRITORY_RU_MUR, 0x04000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"мьянма", TERRITORY_MMR, 0x00400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE) || defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"мэн", TERRITORY_US_ME, 0x00400004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"мэриленд", TERRITORY_US_MD, 0x00400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"мэрыленд", TERRITORY_US_MD, 0x00000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"міжнароднии", TERRITORY_AAA, 0x04000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"міжнародны", TERRITORY_AAA, 0x00000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"мізорам", TERRITORY_IN_MZ, 0x04000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"міквэлон", TERRITORY_SPM, 0x00000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"мікелон", TERRITORY_SPM, 0x04000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"мікранезія", TERRITORY_FSM, 0x00000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"мікронезія", TERRITORY_FSM, 0x04000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE) || defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"мінас-жераис", TERRITORY_BR_MG, 0x04000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"мінесота", TERRITORY_US_MN, 0x00000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"міннесота", TERRITORY_US_MN, 0x04000000},
+        {"міссурі", TERRITORY_US_MO, 0x04000000},
+        {"міссісіпі", TERRITORY_US_MS, 0x04000000},
+        {"місто ватикан", TERRITORY_VAT, 0x04000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"місуры", TERRITORY_US_MO, 0x00000004},
+        {"місісіпі", TERRITORY_US_MS, 0x00000004},
+        {"мічаакан", TERRITORY_MX_MIC, 0x00000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"мічиган", TERRITORY_US_MI, 0x04000000},
+        {"мічоакан", TERRITORY_MX_MIC, 0x04000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"мічыган", TERRITORY_US_MI, 0x00000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE) || defined(MAPCODE_SUPPORT_LANGUAGE_RU) || defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"нагаленд", TERRITORY_IN_NL, 0x04400004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"намибия", TERRITORY_NAM, 0x00400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE) || defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"намібія", TERRITORY_NAM, 0x04000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"нарвегія", TERRITORY_NOR, 0x00000004},
+        {"наугародская вобласць", TERRITORY_RU_NGR, 0x00000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE) || defined(MAPCODE_SUPPORT_LANGUAGE_RU) || defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"науру", TERRITORY_NRU, 0x04400004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE) || defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"наярит", TERRITORY_MX_NAY, 0x00400004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"наяріт", TERRITORY_MX_NAY, 0x04000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE) || defined(MAPCODE_SUPPORT_LANGUAGE_RU) || defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"небраска", TERRITORY_US_NE, 0x04400004},
+        {"невада", TERRITORY_US_NV, 0x04400004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"невис", TERRITORY_KNA, 0x00400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"невіс", TERRITORY_KNA, 0x04000000},
+#endif
+        {"ненецие автономнои ӈокрук", TERRITORY_RU_NEN, 0x08000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"ненецкая аутаномная акруга", TERRITORY_RU_NEN, 0x00000004},
+#endif
+        {"ненецкии автономныи округ", TERRITORY_RU_NEN, 0x08400000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"ненецькии автономнии округ", TERRITORY_RU_NEN, 0x04000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE) || defined(MAPCODE_SUPPORT_LANGUAGE_RU) || defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"непал", TERRITORY_NPL, 0x04400004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"нигер", TERRITORY_NER, 0x00400000},
+        {"нигерия", TERRITORY_NGA, 0x00400000},
+        {"нидерланды", TERRITORY_NLD, 0x00400000},
+#endif
+        {"нижегородская область", TERRITORY_RU_NIZ, 0x08400000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"нижегородська область", TERRITORY_RU_NIZ, 0x04000000},
+        {"нижня каліфорнія", TERRITORY_MX_BCN, 0x04000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"нижняя калифорния", TERRITORY_MX_BCN, 0x00400000},
+        {"никарагуа", TERRITORY_NIC, 0x00400000},
+        {"нинся-хуэискии", TERRITORY_CN_NX, 0x00400000},
+        {"ниуэ", TERRITORY_NIU, 0x00400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"нова зеландія", TERRITORY_NZL, 0x04000000},
+        {"нова каледонія", TERRITORY_NCL, 0x04000000},
+        {"нова шотландія", TERRITORY_CA_NS, 0x04000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"новасібірская вобласць", TERRITORY_RU_NVS, 0x00000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"новая зеландия", TERRITORY_NZL, 0x00400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"новая зеландыя", TERRITORY_NZL, 0x00000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"новая каледония", TERRITORY_NCL, 0x00400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"новая каледонія", TERRITORY_NCL, 0x00000004},
+        {"новая шатландыя", TERRITORY_CA_NS, 0x00000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"новая шотландия", TERRITORY_CA_NS, 0x00400000},
+#endif
+        {"новгородская область", TERRITORY_RU_NGR, 0x08400000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"новгородська область", TERRITORY_RU_NGR, 0x04000000},
+        {"новии південнии уельс", TERRITORY_AU_NSW, 0x04000000},
+#endif
+        {"новосибирская область", TERRITORY_RU_NVS, 0x08400000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"новосибірська область", TERRITORY_RU_NVS, 0x04000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"новы паудневы уэльс", TERRITORY_AU_NSW, 0x00000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"новыи брансвик", TERRITORY_CA_NB, 0x00400000},
+        {"новыи южныи уэльс", TERRITORY_AU_NSW, 0x00400000},
+        {"норвегия", TERRITORY_NOR, 0x00400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"норвегія", TERRITORY_NOR, 0x04000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"норфолк и филип-аиленд", TERRITORY_NFK, 0x00400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"норфолк і філіп-аиленд", TERRITORY_NFK, 0x04000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"норфолк і філіп-аилэнд", TERRITORY_NFK, 0x00000004},
+#endif
+        {"нохчиин республика", TERRITORY_RU_CE, 0x08000000},
+        {"нохчиичоь", TERRITORY_RU_CE, 0x08000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"нуево-леон", TERRITORY_MX_NLE, 0x04000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE) || defined(MAPCODE_SUPPORT_LANGUAGE_RU) || defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"нунавут", TERRITORY_CA_NU, 0x04400004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE) || defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"нуэво-леон", TERRITORY_MX_NLE, 0x00400004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"нью джерсі", TERRITORY_US_NJ, 0x04000000},
+        {"нью-брансвік", TERRITORY_CA_NB, 0x04000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"нью-брансуік", TERRITORY_CA_NB, 0x00000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU) || defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"нью-гемпшир", TERRITORY_US_NH, 0x04400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"нью-гэмпшыр", TERRITORY_US_NH, 0x00000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"нью-джерси", TERRITORY_US_NJ, 0x00400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"нью-джэрсі", TERRITORY_US_NJ, 0x00000004},
+        {"нью-ерк", TERRITORY_US_NY, 0x00000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU) || defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"нью-иорк", TERRITORY_US_NY, 0x04400000},
+        {"нью-мексико", TERRITORY_US_NM, 0x04400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"нью-мексіка", TERRITORY_US_NM, 0x00000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE) || defined(MAPCODE_SUPPORT_LANGUAGE_RU) || defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"ньюфаундленд", TERRITORY_CA_NL, 0x04400004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"нэвіс", TERRITORY_KNA, 0x00000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE) || defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"нігер", TERRITORY_NER, 0x04000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"нігерыя", TERRITORY_NGA, 0x00000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"нігерія", TERRITORY_NGA, 0x04000000},
+        {"нідерланди", TERRITORY_NLD, 0x04000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"нідэрланды", TERRITORY_NLD, 0x00000004},
+        {"ніжагародская вобласць", TERRITORY_RU_NIZ, 0x00000004},
+        {"ніжняя каліфорнія", TERRITORY_MX_BCN, 0x00000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE) || defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"нікарагуа", TERRITORY_NIC, 0x04000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"німеччина", TERRITORY_DEU, 0x04000000},
+        {"нінся-хуеиськии", TERRITORY_CN_NX, 0x04000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"нінся-хуэискии", TERRITORY_CN_NX, 0x00000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE) || defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"ніуе", TERRITORY_NIU, 0x04000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE) || defined(MAPCODE_SUPPORT_LANGUAGE_RU) || defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"оахака", TERRITORY_MX_OAX, 0x04400004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"об`єднані арабські емірати", TERRITORY_ARE, 0x04000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"объединенные арабские эмираты", TERRITORY_ARE, 0x00400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU) || defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"огаио", TERRITORY_US_OH, 0x04400000},
+        {"оклахома", TERRITORY_US_OK, 0x04400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"округ колумбия", TERRITORY_US_DC, 0x00400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU) || defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"оман", TERRITORY_OMN, 0x04400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"омская вобласць", TERRITORY_RU_OMS, 0x00000004},
+#endif
+        {"омская область", TERRITORY_RU_OMS, 0x08400000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"омська область", TERRITORY_RU_OMS, 0x04000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"онтарио", TERRITORY_CA_ON, 0x00400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"онтаріо", TERRITORY_CA_ON, 0x04000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU) || defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"орегон", TERRITORY_US_OR, 0x04400000},
+#endif
+        {"оренбургская область", TERRITORY_RU_ORE, 0x08400000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"оренбурзька область", TERRITORY_RU_ORE, 0x04000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"орисса", TERRITORY_IN_OR, 0x00400000},
+#endif
+        {"орловская область", TERRITORY_RU_ORL, 0x08400000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"орловська область", TERRITORY_RU_ORL, 0x04000000},
+        {"орісса", TERRITORY_IN_OR, 0x04000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"остров буве", TERRITORY_BVT, 0x00400000},
+        {"остров клиппертон", TERRITORY_CPT, 0x00400000},
+        {"остров мэн", TERRITORY_IMN, 0x00400000},
+        {"остров принца эдуарда", TERRITORY_CA_PE, 0x00400000},
+        {"остров рождества", TERRITORY_CXR, 0x00400000},
+        {"остров херд и острова макдональд", TERRITORY_HMD, 0x00400000},
+        {"острова кука", TERRITORY_COK, 0x00400000},
+        {"острова теркс и каикос", TERRITORY_TCA, 0x00400000},
+        {"острова фиджи", TERRITORY_FJI, 0x00400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"острови кука", TERRITORY_COK, 0x04000000},
+        {"острови теркс і каикос", TERRITORY_TCA, 0x04000000},
+        {"острів буве", TERRITORY_BVT, 0x04000000},
+        {"острів клиппертон", TERRITORY_CPT, 0x04000000},
+        {"острів мен", TERRITORY_IMN, 0x04000000},
+        {"острів принца едуарда", TERRITORY_CA_PE, 0x04000000},
+        {"острів різдва", TERRITORY_CXR, 0x04000000},
+        {"острів херд і острови макдональд", TERRITORY_HMD, 0x04000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU) || defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"пакистан", TERRITORY_PAK, 0x04400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"пакістан", TERRITORY_PAK, 0x00000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE) || defined(MAPCODE_SUPPORT_LANGUAGE_RU) || defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"палау", TERRITORY_PLW, 0x04400004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"палестинські територіі", TERRITORY_PSE, 0x04000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"палестынскія тэрыторыі", TERRITORY_PSE, 0x00000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE) || defined(MAPCODE_SUPPORT_LANGUAGE_RU) || defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"панама", TERRITORY_PAN, 0x04400004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"папуа - новая гвинея", TERRITORY_PNG, 0x00400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"папуа-нова гвінея", TERRITORY_PNG, 0x04000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"папуа-новая гвінея", TERRITORY_PNG, 0x00000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE) || defined(MAPCODE_SUPPORT_LANGUAGE_RU) || defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"пара", TERRITORY_BR_PA, 0x04400004},
+        {"парагваи", TERRITORY_PRY, 0x04400004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE) || defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"параибы", TERRITORY_BR_PB, 0x00400004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE) || defined(MAPCODE_SUPPORT_LANGUAGE_RU) || defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"парана", TERRITORY_BR_PR, 0x04400004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"параіба", TERRITORY_BR_PB, 0x04000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"партугалія", TERRITORY_PRT, 0x00000004},
+        {"паудневая аустралія", TERRITORY_AU_SA, 0x00000004},
+        {"паудневая афрыка", TERRITORY_WLF, 0x00000004},
+        {"паудневая афрыка", TERRITORY_ZAF, 0x00000004},
+        {"паудневая дакота", TERRITORY_US_SD, 0x00000004},
+        {"паудневая джорджыя і паудневыя сандвічавы астравы", TERRITORY_SGS, 0x00000004},
+        {"паудневая караліна", TERRITORY_US_SC, 0x00000004},
+        {"паудневая карэя", TERRITORY_KOR, 0x00000004},
+        {"паудневая ніжняя каліфорнія", TERRITORY_MX_BCS, 0x00000004},
+        {"паудневы судан", TERRITORY_SSD, 0x00000004},
+        {"паудневыя сэндвічавыя выспы", TERRITORY_SGS, 0x00000004},
+        {"пауночна-заходнія тэрыторыі", TERRITORY_CA_NT, 0x00000004},
+        {"пауночная асеція-аланія", TERRITORY_RU_SE, 0x00000004},
+        {"пауночная дакота", TERRITORY_US_ND, 0x00000004},
+        {"пауночная караліна", TERRITORY_US_NC, 0x00000004},
+        {"пауночная карэя", TERRITORY_PRK, 0x00000004},
+        {"пауночная тэрыторыя", TERRITORY_AU_NT, 0x00000004},
+        {"пауночная ірландыя", TERRITORY_GBR, 0x00000004},
+        {"пауночныя марыянскія астравы", TERRITORY_MNP, 0x00000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"пекин", TERRITORY_CN_BJ, 0x00400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE) || defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"пекін", TERRITORY_CN_BJ, 0x04000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE) || defined(MAPCODE_SUPPORT_LANGUAGE_RU) || defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"пенджаб", TERRITORY_IN_PB, 0x04400004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"пензенская вобласць", TERRITORY_RU_PNZ, 0x00000004},
+#endif
+        {"пензенская область", TERRITORY_RU_PNZ, 0x08400000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"пензенська область", TERRITORY_RU_PNZ, 0x04000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"пенсильвания", TERRITORY_US_PA, 0x00400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"пенсільванія", TERRITORY_US_PA, 0x04000000},
+#endif
+        {"пермскии краи", TERRITORY_RU_PM, 0x08400000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"пермскі краи", TERRITORY_RU_PM, 0x00000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"пермськии краи", TERRITORY_RU_PM, 0x04000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE) || defined(MAPCODE_SUPPORT_LANGUAGE_RU) || defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"пернамбуку", TERRITORY_BR_PE, 0x04400004},
+        {"перу", TERRITORY_PER, 0x04400004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE) || defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"пиауи", TERRITORY_BR_PI, 0x00400004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"питкэрн", TERRITORY_PCN, 0x00400000},
+#endif
+        {"подмосковье", TERRITORY_RU_MOS, 0x08000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"польша", TERRITORY_POL, 0x00400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"польшча", TERRITORY_POL, 0x00000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"польща", TERRITORY_POL, 0x04000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE) || defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"пондичерри", TERRITORY_IN_PY, 0x00400004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"пондічеррі", TERRITORY_IN_PY, 0x04000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"португалия", TERRITORY_PRT, 0x00400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"португалія", TERRITORY_PRT, 0x04000000},
+#endif
+        {"приморскии краи", TERRITORY_RU_PO, 0x08400000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"приморськии краи", TERRITORY_RU_PO, 0x04000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"принсипи", TERRITORY_STP, 0x00400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"прыморскі краи", TERRITORY_RU_PO, 0x00000004},
+        {"прынсэп", TERRITORY_STP, 0x00000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"прінсіпі", TERRITORY_STP, 0x04000000},
+#endif
+        {"псковская область", TERRITORY_RU_PSK, 0x08400000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"псковська область", TERRITORY_RU_PSK, 0x04000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"пскоуская вобласць", TERRITORY_RU_PSK, 0x00000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"пуебла", TERRITORY_MX_PUE, 0x04000000},
+        {"пуерто ріко", TERRITORY_PRI, 0x04000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE) || defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"пуэбла", TERRITORY_MX_PUE, 0x00400004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"пуэрта-рыка", TERRITORY_PRI, 0x00000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"пуэрто-рико", TERRITORY_PRI, 0x00400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"пэнсыльванія", TERRITORY_US_PA, 0x00000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"піауі", TERRITORY_BR_PI, 0x04000000},
+        {"південна австралія", TERRITORY_AU_SA, 0x04000000},
+        {"південна африка", TERRITORY_WLF, 0x04000000},
+        {"південна африка", TERRITORY_ZAF, 0x04000000},
+        {"південна дакота", TERRITORY_US_SD, 0x04000000},
+        {"південна джорджія та південні сандвічеві острови", TERRITORY_SGS, 0x04000000},
+        {"південна кароліна", TERRITORY_US_SC, 0x04000000},
+        {"південна корея", TERRITORY_KOR, 0x04000000},
+        {"південна нижня каліфорнія", TERRITORY_MX_BCS, 0x04000000},
+        {"південнии судан", TERRITORY_SSD, 0x04000000},
+        {"південні сандвічеві острови", TERRITORY_SGS, 0x04000000},
+        {"північна дакота", TERRITORY_US_ND, 0x04000000},
+        {"північна кароліна", TERRITORY_US_NC, 0x04000000},
+        {"північна корея", TERRITORY_PRK, 0x04000000},
+        {"північна осетія-аланія", TERRITORY_RU_SE, 0x04000000},
+        {"північна територія", TERRITORY_AU_NT, 0x04000000},
+        {"північна ірландія", TERRITORY_GBR, 0x04000000},
+        {"північно-західні територіі", TERRITORY_CA_NT, 0x04000000},
+        {"північні маріанські острови", TERRITORY_MNP, 0x04000000},
+        {"піткерн", TERRITORY_PCN, 0x04000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"піткэрн", TERRITORY_PCN, 0x00000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE) || defined(MAPCODE_SUPPORT_LANGUAGE_RU) || defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"раджастхан", TERRITORY_IN_RJ, 0x04400004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"разанская вобласьць", TERRITORY_RU_RYA, 0x00000004},
+        {"растоуская вобласць", TERRITORY_RU_ROS, 0x00000004},
+        {"расія", TERRITORY_RUS, 0x00000004},
+#endif
+        {"республика адыгея", TERRITORY_RU_AD, 0x08400000},
+        {"республика алтаи", TERRITORY_RU_AL, 0x08400000},
+        {"республика башкортостан", TERRITORY_RU_BA, 0x08400000},
+        {"республика бурятия", TERRITORY_RU_BU, 0x08400000},
+        {"республика дагестан", TERRITORY_RU_DA, 0x08400000},
+        {"республика ингушетия", TERRITORY_RU_IN, 0x08400000},
+        {"республика калмыкия", TERRITORY_RU_KL, 0x08400000},
+        {"республика карелия", TERRITORY_RU_KR, 0x08400000},
+        {"республика коми", TERRITORY_RU_KO, 0x08400000},
+        {"республика марии эл", TERRITORY_RU_ME, 0x08400000},
+        {"республика мордовия", TERRITORY_RU_MO, 0x08400000},
+        {"республика саха", TERRITORY_RU_SA, 0x08400000},
+        {"республика северная осетия - алания", TERRITORY_RU_SE, 0x08000000},
+        {"республика татарстан", TERRITORY_RU_TA, 0x08400000},
+        {"республика тыва", TERRITORY_RU_TY, 0x08400000},
+        {"республика хакасия", TERRITORY_RU_KK, 0x08400000},
+        {"республикӕ цӕгат ирыстон", TERRITORY_RU_SE, 0x08000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"республіка адигея", TERRITORY_RU_AD, 0x04000000},
+        {"республіка алтаи", TERRITORY_RU_AL, 0x04000000},
+        {"республіка башкортостан", TERRITORY_RU_BA, 0x04000000},
+        {"республіка бурятія", TERRITORY_RU_BU, 0x04000000},
+        {"республіка дагестан", TERRITORY_RU_DA, 0x04000000},
+        {"республіка калмикія", TERRITORY_RU_KL, 0x04000000},
+        {"республіка карелія", TERRITORY_RU_KR, 0x04000000},
+        {"республіка комі", TERRITORY_RU_KO, 0x04000000},
+        {"республіка маріи ел", TERRITORY_RU_ME, 0x04000000},
+        {"республіка мордовія", TERRITORY_RU_MO, 0x04000000},
+        {"республіка саха", TERRITORY_RU_SA, 0x04000000},
+        {"республіка татарстан", TERRITORY_RU_TA, 0x04000000},
+        {"республіка тива", TERRITORY_RU_TY, 0x04000000},
+        {"республіка хакасія", TERRITORY_RU_KK, 0x04000000},
+        {"республіка інгушетія", TERRITORY_RU_IN, 0x04000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"рио де жанеиро", TERRITORY_BR_RJ, 0x00400000},
+        {"рио-гранде-ду-норти", TERRITORY_BR_RN, 0x00400000},
+        {"рио-гранде-ду-сул", TERRITORY_BR_RS, 0x00400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU) || defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"род-аиленд", TERRITORY_US_RI, 0x04400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"род-аилэнд", TERRITORY_US_RI, 0x00000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE) || defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"рондония", TERRITORY_BR_RO, 0x00400004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"рондонія", TERRITORY_BR_RO, 0x04000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE) || defined(MAPCODE_SUPPORT_LANGUAGE_RU) || defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"рораима", TERRITORY_BR_RR, 0x04400004},
+#endif
+        {"россия", TERRITORY_RUS, 0x08400000},
+        {"ростовская область", TERRITORY_RU_ROS, 0x08400000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"ростовська область", TERRITORY_RU_ROS, 0x04000000},
+        {"росія", TERRITORY_RUS, 0x04000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE) || defined(MAPCODE_SUPPORT_LANGUAGE_RU) || defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"руанда", TERRITORY_RWA, 0x04400004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"румунія", TERRITORY_ROU, 0x04000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"румыния", TERRITORY_ROU, 0x00400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"румынія", TERRITORY_ROU, 0x00000004},
+        {"рыа-грандэ-ду-норте", TERRITORY_BR_RN, 0x00000004},
+        {"рыа-грандэ-ду-сул", TERRITORY_BR_RS, 0x00000004},
+        {"рыа-дэ-жанеира", TERRITORY_BR_RJ, 0x00000004},
+        {"рэспубліка адыгея", TERRITORY_RU_AD, 0x00000004},
+        {"рэспубліка алтаи", TERRITORY_RU_AL, 0x00000004},
+        {"рэспубліка башкартастан", TERRITORY_RU_BA, 0x00000004},
+        {"рэспубліка бурація", TERRITORY_RU_BU, 0x00000004},
+        {"рэспубліка дагестан", TERRITORY_RU_DA, 0x00000004},
+        {"рэспубліка калмыкія", TERRITORY_RU_KL, 0x00000004},
+        {"рэспубліка карэлія", TERRITORY_RU_KR, 0x00000004},
+        {"рэспубліка комі", TERRITORY_RU_KO, 0x00000004},
+        {"рэспубліка мардовія", TERRITORY_RU_MO, 0x00000004},
+        {"рэспубліка марыи эл", TERRITORY_RU_ME, 0x00000004},
+        {"рэспубліка саха", TERRITORY_RU_SA, 0x00000004},
+        {"рэспубліка татарстан", TERRITORY_RU_TA, 0x00000004},
+        {"рэспубліка тыва", TERRITORY_RU_TY, 0x00000004},
+        {"рэспубліка хакасія", TERRITORY_RU_KK, 0x00000004},
+        {"рэспубліка інгушэція", TERRITORY_RU_IN, 0x00000004},
+#endif
+        {"рязанская область", TERRITORY_RU_RYA, 0x08400000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"рязанська область", TERRITORY_RU_RYA, 0x04000000},
+        {"ріо-гранде-ду-норті", TERRITORY_BR_RN, 0x04000000},
+        {"ріо-гранде-ду-сул", TERRITORY_BR_RS, 0x04000000},
+        {"ріо-де-жанеиро", TERRITORY_BR_RJ, 0x04000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE) || defined(MAPCODE_SUPPORT_LANGUAGE_RU) || defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"саба", TERRITORY_BES, 0x04400004},
+        {"сакатекас", TERRITORY_MX_ZAC, 0x04400004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"саламонавы выспы", TERRITORY_SLB, 0x00000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE) || defined(MAPCODE_SUPPORT_LANGUAGE_RU) || defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"сальвадор", TERRITORY_SLV, 0x04400004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"самалі", TERRITORY_SOM, 0x00000004},
+        {"самарская вобласць", TERRITORY_RU_SAM, 0x00000004},
+#endif
+        {"самарская область", TERRITORY_RU_SAM, 0x08400000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"самарська область", TERRITORY_RU_SAM, 0x04000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE) || defined(MAPCODE_SUPPORT_LANGUAGE_RU) || defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"самоа", TERRITORY_WSM, 0x04400004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"самоа, американское", TERRITORY_ASM, 0x00400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"самоа, американське", TERRITORY_ASM, 0x04000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"самоа, амерыканскае", TERRITORY_ASM, 0x00000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"сан - луис-потоси", TERRITORY_MX_SLP, 0x00400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"сан - луіс-потоси", TERRITORY_MX_SLP, 0x00000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"сан - луіс-потосі", TERRITORY_MX_SLP, 0x04000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"сан - марино", TERRITORY_SMR, 0x00400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"сан - марына", TERRITORY_SMR, 0x00000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"сан - маріно", TERRITORY_SMR, 0x04000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE) || defined(MAPCODE_SUPPORT_LANGUAGE_RU) || defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"сан-паулу", TERRITORY_BR_SP, 0x04400004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"сан-томе и принсипи", TERRITORY_STP, 0x00400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"сан-томе і прынсэп", TERRITORY_STP, 0x00000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"сан-томе і прінсіпі", TERRITORY_STP, 0x04000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"санкт-люсия", TERRITORY_LCA, 0x00400000},
+#endif
+        {"санкт-петербург", TERRITORY_RU_SPE, 0x0c400000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"санкт-пецярбург", TERRITORY_RU_SPE, 0x00000004},
+        {"санора", TERRITORY_MX_SON, 0x00000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"санта-катарина", TERRITORY_BR_SC, 0x00400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"санта-катарына", TERRITORY_BR_SC, 0x00000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"санта-катаріна", TERRITORY_BR_SC, 0x04000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"саратауская вобласць", TERRITORY_RU_SAR, 0x00000004},
+#endif
+        {"саратовская область", TERRITORY_RU_SAR, 0x08400000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"саратовська область", TERRITORY_RU_SAR, 0x04000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE) || defined(MAPCODE_SUPPORT_LANGUAGE_RU) || defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"саскачеван", TERRITORY_CA_SK, 0x04400004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"саудауская аравія", TERRITORY_SAU, 0x00000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"саудовская аравия", TERRITORY_SAU, 0x00400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"саудівська аравія", TERRITORY_SAU, 0x04000000},
+#endif
+        {"саха өрөспүүбүлүкэтэ", TERRITORY_RU_SA, 0x08000000},
+        {"сахалинская область", TERRITORY_RU_SAK, 0x08400000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"сахалінская вобласць", TERRITORY_RU_SAK, 0x00000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"сахалінська область", TERRITORY_RU_SAK, 0x04000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE) || defined(MAPCODE_SUPPORT_LANGUAGE_RU) || defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"сахрави", TERRITORY_ESH, 0x04400004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"свазиленд", TERRITORY_SWZ, 0x00400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE) || defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"свазіленд", TERRITORY_SWZ, 0x04000004},
+#endif
+        {"свердловская область", TERRITORY_RU_SVE, 0x08400000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"свердловська область", TERRITORY_RU_SVE, 0x04000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"свет", TERRITORY_AAA, 0x00000004},
+        {"свярдлоуская вобласць", TERRITORY_RU_SVE, 0x00000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"святеишии престол", TERRITORY_VAT, 0x00400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"святии престол", TERRITORY_VAT, 0x04000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"святои алены, ушэсця і трыстан-да-кунья", TERRITORY_SHN, 0x00000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"святои елены, вознесения и тристан-да-кунья", TERRITORY_SHN, 0x00400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"святоі єлени, вознесіння і трістан-да-кунья", TERRITORY_SHN, 0x04000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"святы пасад", TERRITORY_VAT, 0x00000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"світ", TERRITORY_AAA, 0x04000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE) || defined(MAPCODE_SUPPORT_LANGUAGE_RU) || defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"сеара", TERRITORY_BR_CE, 0x04400004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"северная дакота", TERRITORY_US_ND, 0x00400000},
+        {"северная ирландия", TERRITORY_GBR, 0x00400000},
+        {"северная каролина", TERRITORY_US_NC, 0x00400000},
+        {"северная корея", TERRITORY_PRK, 0x00400000},
+        {"северная осетия-алания", TERRITORY_RU_SE, 0x00400000},
+        {"северная территория", TERRITORY_AU_NT, 0x00400000},
+        {"северные марианские острова", TERRITORY_MNP, 0x00400000},
+        {"северо-западные территории", TERRITORY_CA_NT, 0x00400000},
+        {"сеишельские острова", TERRITORY_SYC, 0x00400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"сеишельські острови", TERRITORY_SYC, 0x04000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"сеишэльскія выспы", TERRITORY_SYC, 0x00000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"сен-бартельми", TERRITORY_BLM, 0x00400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"сен-бартельмі", TERRITORY_BLM, 0x04000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"сен-бартэльмі", TERRITORY_BLM, 0x00000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU) || defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"сен-мартен", TERRITORY_MAF, 0x04400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"сен-мартэн", TERRITORY_MAF, 0x00000004},
+        {"сен-п`ер і міквэлон", TERRITORY_SPM, 0x00000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"сен-п`єр і мікелон", TERRITORY_SPM, 0x04000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"сен-пьер и микелон", TERRITORY_SPM, 0x00400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE) || defined(MAPCODE_SUPPORT_LANGUAGE_RU) || defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"сенегал", TERRITORY_SEN, 0x04400004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"сент-винсент и гренадины", TERRITORY_VCT, 0x00400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"сент-вінсент і гренадіни", TERRITORY_VCT, 0x04000000},
+        {"сент-естатіус", TERRITORY_BES, 0x04000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"сент-китс и невис", TERRITORY_KNA, 0x00400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"сент-кітс і невіс", TERRITORY_KNA, 0x04000000},
+        {"сент-люсія", TERRITORY_LCA, 0x04000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"сент-эстатиус", TERRITORY_BES, 0x00400000},
+        {"сербия", TERRITORY_SRB, 0x00400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE) || defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"сербія", TERRITORY_SRB, 0x04000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE) || defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"сержипи", TERRITORY_BR_SE, 0x00400004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"сержіпі", TERRITORY_BR_SE, 0x04000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE) || defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"сикким", TERRITORY_IN_SK, 0x00400004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"синалоа", TERRITORY_MX_SIN, 0x00400000},
+        {"сингапур", TERRITORY_SGP, 0x00400000},
+        {"синт-маартен", TERRITORY_SXM, 0x00400000},
+        {"синьцзян-уигурскии", TERRITORY_CN_XJ, 0x00400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"синьцзян-уигурськии", TERRITORY_CN_XJ, 0x04000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"сирия", TERRITORY_SYR, 0x00400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"сирія", TERRITORY_SYR, 0x04000000},
+        {"сичуань", TERRITORY_CN_SC, 0x04000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"славакія", TERRITORY_SVK, 0x00000004},
+        {"славенія", TERRITORY_SVN, 0x00000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"словакия", TERRITORY_SVK, 0x00400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"словаччина", TERRITORY_SVK, 0x04000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"словения", TERRITORY_SVN, 0x00400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"словенія", TERRITORY_SVN, 0x04000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"смаленская вобласць", TERRITORY_RU_SMO, 0x00000004},
+#endif
+        {"смоленская область", TERRITORY_RU_SMO, 0x08400000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"смоленська область", TERRITORY_RU_SMO, 0x04000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"соединенное королевство", TERRITORY_GBR, 0x00400000},
+        {"соединенные штаты америки", TERRITORY_USA, 0x00400000},
+        {"соломоновы острова", TERRITORY_SLB, 0x00400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"соломонові острови", TERRITORY_SLB, 0x04000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"сомали", TERRITORY_SOM, 0x00400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"сомалі", TERRITORY_SOM, 0x04000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU) || defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"сонора", TERRITORY_MX_SON, 0x04400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"сполучене королівство", TERRITORY_GBR, 0x04000000},
+        {"сполучені штати америки", TERRITORY_USA, 0x04000000},
+#endif
+        {"србија", TERRITORY_SRB, 0x08000000},
+        {"ставропольскии краи", TERRITORY_RU_STA, 0x08400000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"ставропольськии краи", TERRITORY_RU_STA, 0x04000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"стаурапольскі краи", TERRITORY_RU_STA, 0x00000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE) || defined(MAPCODE_SUPPORT_LANGUAGE_RU) || defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"судан", TERRITORY_SDN, 0x04400004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU) || defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"суринам", TERRITORY_SUR, 0x04400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"сурынам", TERRITORY_SUR, 0x00000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"східнии тимор", TERRITORY_TLS, 0x04000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU) || defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"сша", TERRITORY_USA, 0x04400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"сша внешние малые острова", TERRITORY_UMI, 0x00400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"сша зовнішні малі острови", TERRITORY_UMI, 0x04000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE) || defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"сычуань", TERRITORY_CN_SC, 0x00400004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"сьера-леонэ", TERRITORY_SLE, 0x00000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"сьерра-леоне", TERRITORY_SLE, 0x00400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"сьєрра-леоне", TERRITORY_SLE, 0x04000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"сэнт-вінсэнт і грэнадыны", TERRITORY_VCT, 0x00000004},
+        {"сэнт-кітс і нэвіс", TERRITORY_KNA, 0x00000004},
+        {"сэнт-люсія", TERRITORY_LCA, 0x00000004},
+        {"сэнт-эстатиус", TERRITORY_BES, 0x00000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"сіккім", TERRITORY_IN_SK, 0x04000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE) || defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"сіналоа", TERRITORY_MX_SIN, 0x04000004},
+        {"сінгапур", TERRITORY_SGP, 0x04000004},
+        {"сінт-маартен", TERRITORY_SXM, 0x04000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"сіньцзян-уигурскі", TERRITORY_CN_XJ, 0x00000004},
+        {"сірыя", TERRITORY_SYR, 0x00000004},
+        {"табага", TERRITORY_TTO, 0x00000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE) || defined(MAPCODE_SUPPORT_LANGUAGE_RU) || defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"табаско", TERRITORY_MX_TAB, 0x04400004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"таго", TERRITORY_TGO, 0x00000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU) || defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"таджикистан", TERRITORY_TJK, 0x04400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"таджыкістан", TERRITORY_TJK, 0x00000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE) || defined(MAPCODE_SUPPORT_LANGUAGE_RU) || defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"таивань", TERRITORY_TWN, 0x04400004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE) || defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"таиланд", TERRITORY_THA, 0x00400004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"такелау", TERRITORY_TKL, 0x00000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE) || defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"тамаулипас", TERRITORY_MX_TAM, 0x00400004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"тамауліпас", TERRITORY_MX_TAM, 0x04000000},
+#endif
+        {"тамбовская область", TERRITORY_RU_TT, 0x08400000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"тамбовська область", TERRITORY_RU_TT, 0x04000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"тамбоуская вобласць", TERRITORY_RU_TT, 0x00000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"тамилнад", TERRITORY_IN_TN, 0x00400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE) || defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"тамілнад", TERRITORY_IN_TN, 0x04000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"тангіиская", TERRITORY_TON, 0x00000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"танзания", TERRITORY_TZA, 0x00400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE) || defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"танзанія", TERRITORY_TZA, 0x04000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"тасмания", TERRITORY_AU_TAS, 0x00400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE) || defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"тасманія", TERRITORY_AU_TAS, 0x04000004},
+#endif
+        {"татарстан республикасы", TERRITORY_RU_TA, 0x08000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"таіланд", TERRITORY_THA, 0x04000000},
+#endif
+        {"тверская область", TERRITORY_RU_TVE, 0x08400000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"тверська область", TERRITORY_RU_TVE, 0x04000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE) || defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"телингана", TERRITORY_IN_TG, 0x00400004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"телінгани", TERRITORY_IN_TG, 0x04000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"теннесси", TERRITORY_US_TN, 0x00400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"теннессі", TERRITORY_US_TN, 0x04000000},
+        {"територія джервіс-беи", TERRITORY_AU_JBT, 0x04000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"территории палестины", TERRITORY_PSE, 0x00400000},
+        {"территория джервис-беи", TERRITORY_AU_JBT, 0x00400000},
+        {"территория столицы австралии", TERRITORY_AU_ACT, 0x00400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU) || defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"техас", TERRITORY_US_TX, 0x04400000},
+        {"тибет", TERRITORY_CN_XZ, 0x04400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"тибетскии автономныи раион", TERRITORY_CN_XZ, 0x00400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"тибетськии автономнии раион", TERRITORY_CN_XZ, 0x04000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE) || defined(MAPCODE_SUPPORT_LANGUAGE_RU) || defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"тлашкала", TERRITORY_MX_TLA, 0x04400004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU) || defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"тобаго", TERRITORY_TTO, 0x04400000},
+        {"того", TERRITORY_TGO, 0x04400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE) || defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"токантинс", TERRITORY_BR_TO, 0x00400004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"токантінс", TERRITORY_BR_TO, 0x04000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU) || defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"токелау", TERRITORY_TKL, 0x04400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"томская вобласць", TERRITORY_RU_TOM, 0x00000004},
+#endif
+        {"томская область", TERRITORY_RU_TOM, 0x08400000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"томська область", TERRITORY_RU_TOM, 0x04000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU) || defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"тонга", TERRITORY_TON, 0x04400000},
+#endif
+        {"тоҷикистон", TERRITORY_TJK, 0x08000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"тринидад и тобаго", TERRITORY_TTO, 0x00400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"тринідад і тобаго", TERRITORY_TTO, 0x04000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE) || defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"трипура", TERRITORY_IN_TR, 0x00400004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"тристан-да-кунья", TERRITORY_SHN, 0x00400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"трынідад і табага", TERRITORY_TTO, 0x00000004},
+        {"трыстан-да-кунья", TERRITORY_SHN, 0x00000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"тріпура", TERRITORY_IN_TR, 0x04000000},
+        {"трістан-да-кунья", TERRITORY_SHN, 0x04000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE) || defined(MAPCODE_SUPPORT_LANGUAGE_RU) || defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"тувалу", TERRITORY_TUV, 0x04400004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"тульская вобласць", TERRITORY_RU_TUL, 0x00000004},
+#endif
+        {"тульская область", TERRITORY_RU_TUL, 0x08400000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"тульська область", TERRITORY_RU_TUL, 0x04000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"тунис", TERRITORY_TUN, 0x00400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE) || defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"туніс", TERRITORY_TUN, 0x04000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"туреччина", TERRITORY_TUR, 0x04000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"туркменистан", TERRITORY_TKM, 0x00400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE) || defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"туркменістан", TERRITORY_TKM, 0x04000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"турция", TERRITORY_TUR, 0x00400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"турцыя", TERRITORY_TUR, 0x00000004},
+        {"тыбет", TERRITORY_CN_XZ, 0x00000004},
+        {"тыбецкі аутаномны раен", TERRITORY_CN_XZ, 0x00000004},
+#endif
+        {"тыва республика", TERRITORY_RU_TY, 0x08000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"тэнэсі", TERRITORY_US_TN, 0x00000004},
+        {"тэрыторыя джэрвіс-бі", TERRITORY_AU_JBT, 0x00000004},
+        {"тэхас", TERRITORY_US_TX, 0x00000004},
+#endif
+        {"тюменская область", TERRITORY_RU_TYU, 0x08400000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"тюменська область", TERRITORY_RU_TYU, 0x04000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"тяньцзинь", TERRITORY_CN_TJ, 0x00400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"тяньцзінь", TERRITORY_CN_TJ, 0x04000000},
+#endif
+        {"түркменистан", TERRITORY_TKM, 0x08000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE) || defined(MAPCODE_SUPPORT_LANGUAGE_RU) || defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"уганда", TERRITORY_UGA, 0x04400004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"угорщина", TERRITORY_HUN, 0x04000000},
+#endif
+        {"удмурт элькун", TERRITORY_RU_UD, 0x08000000},
+        {"удмуртская республика", TERRITORY_RU_UD, 0x08400000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"удмуртська республіка", TERRITORY_RU_UD, 0x04000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"удмурцкая рэспубліка", TERRITORY_RU_UD, 0x00000004},
+        {"уз`яднанне", TERRITORY_REU, 0x00000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU) || defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"узбекистан", TERRITORY_UZB, 0x04400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"узбекістан", TERRITORY_UZB, 0x00000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"украина", TERRITORY_UKR, 0x00400000},
+#endif
+        {"украіна", TERRITORY_UKR, 0x0c000004},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"уладзімірская вобласьць", TERRITORY_RU_VLA, 0x00000004},
+        {"ульянауская вобласць", TERRITORY_RU_ULY, 0x00000004},
+#endif
+        {"ульяновская область", TERRITORY_RU_ULY, 0x08400000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"ульяновська область", TERRITORY_RU_ULY, 0x04000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"унутраная манголія", TERRITORY_CN_NM, 0x00000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"уоллис и футуна", TERRITORY_WLF, 0x00400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"уолліс і футуна", TERRITORY_WLF, 0x04000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"уоліс і футуна", TERRITORY_WLF, 0x00000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE) || defined(MAPCODE_SUPPORT_LANGUAGE_RU) || defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"уругваи", TERRITORY_URY, 0x04400004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"усходні тымор", TERRITORY_TLS, 0x00000004},
+        {"утар-прадэш", TERRITORY_IN_UP, 0x00000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU) || defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"уттар-прадеш", TERRITORY_IN_UP, 0x04400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE) || defined(MAPCODE_SUPPORT_LANGUAGE_RU) || defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"уттаракханд", TERRITORY_IN_UT, 0x04400004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"ушэсце", TERRITORY_SHN, 0x00000004},
+        {"фалклендскія астравы", TERRITORY_FLK, 0x00000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"фарерские острова", TERRITORY_FRO, 0x00400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"фарерські острови", TERRITORY_FRO, 0x04000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"фарэрскія выспы", TERRITORY_FRO, 0x00000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"федеральнии округ", TERRITORY_MX_DIF, 0x04000000},
+        {"федеральнии округ", TERRITORY_BR_DF, 0x04000000},
+        {"федеральнии округ колумбія", TERRITORY_US_DC, 0x04000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"федеральныи округ", TERRITORY_BR_DF, 0x00400000},
+        {"федеральныи раион", TERRITORY_MX_DIF, 0x00400000},
+        {"федеративные штаты микронезии", TERRITORY_FSM, 0x00400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"федеративні штати мікронезіі", TERRITORY_FSM, 0x04000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"федэральная акруга", TERRITORY_MX_DIF, 0x00000004},
+        {"федэральная акруга", TERRITORY_BR_DF, 0x00000004},
+        {"федэральная акруга калумбія", TERRITORY_US_DC, 0x00000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"фиджи", TERRITORY_FJI, 0x00400000},
+        {"филип-аиленд", TERRITORY_NFK, 0x00400000},
+        {"филиппины", TERRITORY_PHL, 0x00400000},
+        {"финляндия", TERRITORY_FIN, 0x00400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"фларыда", TERRITORY_US_FL, 0x00000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU) || defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"флорида", TERRITORY_US_FL, 0x04400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"фолклендские острова", TERRITORY_FLK, 0x00400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"фолклендські острови", TERRITORY_FLK, 0x04000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"франция", TERRITORY_FRA, 0x00400000},
+        {"французская гвиана", TERRITORY_GUF, 0x00400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"французская гвіяна", TERRITORY_GUF, 0x00000004},
+        {"французская палінезія", TERRITORY_PYF, 0x00000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"французская полинезия", TERRITORY_PYF, 0x00400000},
+        {"французские южные и антарктические земли", TERRITORY_ATF, 0x00400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"французскія паудневыя і антарктычных зямлі", TERRITORY_ATF, 0x00000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"французька гвіана", TERRITORY_GUF, 0x04000000},
+        {"французька полінезія", TERRITORY_PYF, 0x04000000},
+        {"французькі південні та антарктичні землі", TERRITORY_ATF, 0x04000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"францыя", TERRITORY_FRA, 0x00000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"франція", TERRITORY_FRA, 0x04000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE) || defined(MAPCODE_SUPPORT_LANGUAGE_RU) || defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"фуцзянь", TERRITORY_CN_FJ, 0x04400004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"фэдэратыуныя штаты мікранэзіі", TERRITORY_FSM, 0x00000004},
+        {"фіджы", TERRITORY_FJI, 0x00000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"фіджі", TERRITORY_FJI, 0x04000000},
+        {"філіп-аиленд", TERRITORY_NFK, 0x04000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"філіп-аилэнд", TERRITORY_NFK, 0x00000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"філіппіни", TERRITORY_PHL, 0x04000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"філіпіны", TERRITORY_PHL, 0x00000004},
+        {"фінляндыя", TERRITORY_FIN, 0x00000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"фінляндія", TERRITORY_FIN, 0x04000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"хабараускі краи", TERRITORY_RU_KHA, 0x00000004},
+#endif
+        {"хабаровскии краи", TERRITORY_RU_KHA, 0x08400000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"хабаровськии краи", TERRITORY_RU_KHA, 0x04000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE) || defined(MAPCODE_SUPPORT_LANGUAGE_RU) || defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"хаинань", TERRITORY_CN_HI, 0x04400004},
+#endif
+        {"хакас республиказы", TERRITORY_RU_KK, 0x08000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE) || defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"халиско", TERRITORY_MX_JAL, 0x00400004},
+#endif
+        {"хальмг", TERRITORY_RU_KL, 0x08000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"халіско", TERRITORY_MX_JAL, 0x04000000},
+        {"ханти-мансіиськии", TERRITORY_RU_KM, 0x04000000},
+#endif
+        {"ханты-мансиискии", TERRITORY_RU_KM, 0x08400000},
+        {"ханты-мансиискии автономныи округ - югра", TERRITORY_RU_KM, 0x08000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"ханты-мансіиская", TERRITORY_RU_KM, 0x00000004},
+        {"хар`яна", TERRITORY_IN_HR, 0x00000004},
+        {"харватыя", TERRITORY_HRV, 0x00000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU) || defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"харьяна", TERRITORY_IN_HR, 0x04400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"хебеи", TERRITORY_CN_HE, 0x04000000},
+        {"хеилунцзян", TERRITORY_CN_HL, 0x04000000},
+        {"хенань", TERRITORY_CN_HA, 0x04000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"химачал-прадеш", TERRITORY_IN_HP, 0x00400000},
+        {"хорватия", TERRITORY_HRV, 0x00400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"хорватія", TERRITORY_HRV, 0x04000000},
+        {"хубеи", TERRITORY_CN_HB, 0x04000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE) || defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"хубэи", TERRITORY_CN_HB, 0x00400004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE) || defined(MAPCODE_SUPPORT_LANGUAGE_RU) || defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"хунань", TERRITORY_CN_HN, 0x04400004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE) || defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"хэбэи", TERRITORY_CN_HE, 0x00400004},
+        {"хэилунцзян", TERRITORY_CN_HL, 0x00400004},
+        {"хэнань", TERRITORY_CN_HA, 0x00400004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"хімачал-прадеш", TERRITORY_IN_HP, 0x04000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"хімачал-прадэш", TERRITORY_IN_HP, 0x00000004},
+        {"цвярская вобласць", TERRITORY_RU_TVE, 0x00000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"центрально-африканская республика", TERRITORY_CAF, 0x00400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"центрально-африканська республіка", TERRITORY_CAF, 0x04000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"цзилинь", TERRITORY_CN_JL, 0x00400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU) || defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"цзянси", TERRITORY_CN_JX, 0x04400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE) || defined(MAPCODE_SUPPORT_LANGUAGE_RU) || defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"цзянсу", TERRITORY_CN_JS, 0x04400004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"цзянсу", TERRITORY_CN_JX, 0x00000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE) || defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"цзілінь", TERRITORY_CN_JL, 0x04000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU) || defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"цинхаи", TERRITORY_CN_QH, 0x04400000},
+#endif
+        {"црна гора", TERRITORY_MNE, 0x08000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"цынхаи", TERRITORY_CN_QH, 0x00000004},
+        {"цэнтральна-афрыканская рэспубліка", TERRITORY_CAF, 0x00000004},
+        {"цюменская вобласць", TERRITORY_RU_TYU, 0x00000004},
+        {"цяньцзінь", TERRITORY_CN_TJ, 0x00000004},
+        {"ч`япас", TERRITORY_MX_CHP, 0x00000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE) || defined(MAPCODE_SUPPORT_LANGUAGE_RU) || defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"чад", TERRITORY_TCD, 0x04400004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"чандигарх", TERRITORY_IN_CH, 0x00400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"чандыгарх", TERRITORY_IN_CH, 0x00000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"чандігарх", TERRITORY_IN_CH, 0x04000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"чарнагорыя", TERRITORY_MNE, 0x00000004},
+        {"чачэнская рэспубліка", TERRITORY_RU_CE, 0x00000004},
+#endif
+        {"челябинская область", TERRITORY_RU_CH, 0x08400000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"челябінська область", TERRITORY_RU_CH, 0x04000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"черногория", TERRITORY_MNE, 0x00400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"чеська республіка", TERRITORY_CZE, 0x04000000},
+#endif
+        {"чеченская республика", TERRITORY_RU_CE, 0x08400000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"чеченська республіка", TERRITORY_RU_CE, 0x04000000},
+#endif
+        {"чечня", TERRITORY_RU_CE, 0x08000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"чешская республика", TERRITORY_CZE, 0x00400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"чжецзян", TERRITORY_CN_ZJ, 0x04000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE) || defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"чжэцзян", TERRITORY_CN_ZJ, 0x00400004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"чили", TERRITORY_CHL, 0x00400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"чилі", TERRITORY_CHL, 0x04000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU) || defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"чихуахуа", TERRITORY_MX_CHH, 0x04400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"чорногорія", TERRITORY_MNE, 0x04000000},
+        {"чуваська республіка", TERRITORY_RU_CU, 0x04000000},
+#endif
+        {"чувашия", TERRITORY_RU_CU, 0x08000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"чувашская республика", TERRITORY_RU_CU, 0x00400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"чувашская рэспубліка", TERRITORY_RU_CU, 0x00000004},
+#endif
+        {"чукоткакэн автономныкэн округ", TERRITORY_RU_CHU, 0x08000000},
+        {"чукотскии автономныи округ", TERRITORY_RU_CHU, 0x08000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"чукотскии округ", TERRITORY_RU_CHU, 0x00400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"чукотськии округ", TERRITORY_RU_CHU, 0x04000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"чукоцкая акруга", TERRITORY_RU_CHU, 0x00000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU) || defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"чунцин", TERRITORY_CN_CQ, 0x04400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"чунцын", TERRITORY_CN_CQ, 0x00000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"чхаттисгарх", TERRITORY_IN_CT, 0x00400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"чхаттысгарха", TERRITORY_IN_CT, 0x00000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"чхаттісгарх", TERRITORY_IN_CT, 0x04000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"чылі", TERRITORY_CHL, 0x00000004},
+        {"чыхуахуа", TERRITORY_MX_CHH, 0x00000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU) || defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"чьяпас", TERRITORY_MX_CHP, 0x04400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"чэлябінская вобласць", TERRITORY_RU_CH, 0x00000004},
+        {"чэская рэспубліка", TERRITORY_CZE, 0x00000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE) || defined(MAPCODE_SUPPORT_LANGUAGE_RU) || defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"шанхаи", TERRITORY_CN_SH, 0x04400004},
+        {"шаньдун", TERRITORY_CN_SD, 0x04400004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"шаньси", TERRITORY_CN_SX, 0x00400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE) || defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"шаньсі", TERRITORY_CN_SX, 0x04000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"шатландыя", TERRITORY_GBR, 0x00000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"швеицария", TERRITORY_CHE, 0x00400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"швеицарыя", TERRITORY_CHE, 0x00000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"швеицарія", TERRITORY_CHE, 0x04000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"швеция", TERRITORY_SWE, 0x00400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"швецыя", TERRITORY_SWE, 0x00000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"швеція", TERRITORY_SWE, 0x04000000},
+        {"шеньсі", TERRITORY_CN_SN, 0x04000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"шотландия", TERRITORY_GBR, 0x00400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"шотландія", TERRITORY_GBR, 0x04000000},
+#endif
+        {"шпицберген и ян-маиен", TERRITORY_SJM, 0x08400000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"шпіцберген і ян-маєн", TERRITORY_SJM, 0x04000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"шпіцбэрген і ян-маиен", TERRITORY_SJM, 0x00000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"шри ланка", TERRITORY_LKA, 0x00400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"шры ланка", TERRITORY_LKA, 0x00000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"шрі ланка", TERRITORY_LKA, 0x04000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU) || defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"штат мексика", TERRITORY_MX_MX, 0x04400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"штат мексіка", TERRITORY_MX_MX, 0x00000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"шэньси", TERRITORY_CN_SN, 0x00400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"шэньсі", TERRITORY_CN_SN, 0x00000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE) || defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"эквадор", TERRITORY_ECU, 0x00400004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"экватарыяльная гвінея", TERRITORY_GNQ, 0x00000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"экваториальная гвинея", TERRITORY_GNQ, 0x00400000},
+        {"эритрея", TERRITORY_ERI, 0x00400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"эрытрэя", TERRITORY_ERI, 0x00000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"эспириту-санту", TERRITORY_BR_ES, 0x00400000},
+        {"эстония", TERRITORY_EST, 0x00400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"эстонія", TERRITORY_EST, 0x00000004},
+        {"эсьпірыту-санта", TERRITORY_BR_ES, 0x00000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"эфиопия", TERRITORY_ETH, 0x00400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"эфіопія", TERRITORY_ETH, 0x00000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"южная австралия", TERRITORY_AU_SA, 0x00400000},
+        {"южная африка", TERRITORY_WLF, 0x00400000},
+        {"южная африка", TERRITORY_ZAF, 0x00400000},
+        {"южная дакота", TERRITORY_US_SD, 0x00400000},
+        {"южная джорджия и южные сандвичевы острова", TERRITORY_SGS, 0x00400000},
+        {"южная каролина", TERRITORY_US_SC, 0x00400000},
+        {"южная корея", TERRITORY_KOR, 0x00400000},
+        {"южная нижняя калифорния", TERRITORY_MX_BCS, 0x00400000},
+        {"южные сандвичевы острова", TERRITORY_SGS, 0x00400000},
+        {"южныи судан", TERRITORY_SSD, 0x00400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE) || defined(MAPCODE_SUPPORT_LANGUAGE_RU) || defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"юкатан", TERRITORY_MX_YUC, 0x04400004},
+        {"юкон", TERRITORY_CA_YT, 0x04400004},
+        {"юньнань", TERRITORY_CN_YN, 0x04400004},
+        {"юта", TERRITORY_US_UT, 0x04400004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"я побежал", TERRITORY_IRN, 0x00400000},
+#endif
+        {"якутия", TERRITORY_RU_SA, 0x08400000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"якутія", TERRITORY_RU_SA, 0x04000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"якуція", TERRITORY_RU_SA, 0x00000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE) || defined(MAPCODE_SUPPORT_LANGUAGE_RU) || defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"ямаика", TERRITORY_JAM, 0x04400004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"ямала-ненецкая", TERRITORY_RU_YAN, 0x00000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"ямало-ненецкии", TERRITORY_RU_YAN, 0x00400000},
+#endif
+        {"ямало-ненецкии автономныи округ", TERRITORY_RU_YAN, 0x08000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"ямало-ненецькии", TERRITORY_RU_YAN, 0x04000000},
+#endif
+        {"ямалы-ненецие автономнои ӈокрук", TERRITORY_RU_YAN, 0x08000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE) || defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"ян-маиен", TERRITORY_SJM, 0x00400004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"ян-маєн", TERRITORY_SJM, 0x04000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_RU)
+        {"япония", TERRITORY_JPN, 0x00400000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE) || defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"японія", TERRITORY_JPN, 0x04000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"яраслауская вобласць", TERRITORY_RU_YAR, 0x00000004},
+#endif
+        {"ярославская область", TERRITORY_RU_YAR, 0x08400000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"ярославська область", TERRITORY_RU_YAR, 0x04000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"яурэиская аутаномная вобласць", TERRITORY_RU_YEV, 0x00000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"євреиська автономна область", TERRITORY_RU_YEV, 0x04000000},
+        {"єгипет", TERRITORY_EGY, 0x04000000},
+        {"ємен", TERRITORY_YEM, 0x04000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"іарданія", TERRITORY_JOR, 0x00000004},
+        {"іванауская вобласць", TERRITORY_RU_IVA, 0x00000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"івановська область", TERRITORY_RU_IVA, 0x04000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"ідальга", TERRITORY_MX_HID, 0x00000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"ідальго", TERRITORY_MX_HID, 0x04000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE) || defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"ізраіль", TERRITORY_ISR, 0x04000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"ілліноис", TERRITORY_US_IL, 0x04000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"іліноис", TERRITORY_US_IL, 0x00000004},
+        {"інданезія", TERRITORY_IDN, 0x00000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"індонезія", TERRITORY_IDN, 0x04000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"індыя", TERRITORY_IND, 0x00000004},
+        {"індыяна", TERRITORY_US_IN, 0x00000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"індіана", TERRITORY_US_IN, 0x04000000},
+        {"індія", TERRITORY_IND, 0x04000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE) || defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"ірак", TERRITORY_IRQ, 0x04000004},
+        {"іран", TERRITORY_IRN, 0x04000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"іркутська область", TERRITORY_RU_IRK, 0x04000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"іркуцкая вобласць", TERRITORY_RU_IRK, 0x00000004},
+        {"ірландыя", TERRITORY_IRL, 0x00000004},
+        {"ірландыя, пауночная", TERRITORY_GBR, 0x00000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"ірландія", TERRITORY_IRL, 0x04000000},
+        {"ірландія, північна", TERRITORY_GBR, 0x04000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE)
+        {"ісландыя", TERRITORY_ISL, 0x00000004},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"ісландія", TERRITORY_ISL, 0x04000000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_BE) || defined(MAPCODE_SUPPORT_LANGUAGE_UK)
+        {"іспанія", TERRITORY_ESP, 0x04000004},
+        {"італія", TERRITORY_ITA, 0x04000004},
+#endif
+        {"қазақстан", TERRITORY_KAZ, 0x08000000},
+        {"հայաստան", TERRITORY_ARM, 0x08000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HE)
+        {"אגואסקליינטס", TERRITORY_MX_AGU, 0x00000800},
+        {"אדיגיה הרפובליקה", TERRITORY_RU_AD, 0x00000800},
+        {"אואחאקה", TERRITORY_MX_OAX, 0x00000800},
+        {"אוגנדה", TERRITORY_UGA, 0x00000800},
+        {"אודמורט הרפובליקה", TERRITORY_RU_UD, 0x00000800},
+        {"אודסה", TERRITORY_IN_OR, 0x00000800},
+        {"אוהיו", TERRITORY_US_OH, 0x00000800},
+        {"אוזבקיסטן", TERRITORY_UZB, 0x00000800},
+        {"אוטר פראדש", TERRITORY_IN_UP, 0x00000800},
+        {"אוטראקהאנד", TERRITORY_IN_UT, 0x00000800},
+        {"אויגורים שינג`יאנג", TERRITORY_CN_XJ, 0x00000800},
+        {"אונטריו", TERRITORY_CA_ON, 0x00000800},
+        {"אוסטריה", TERRITORY_AUT, 0x00000800},
+        {"אוסטרליה", TERRITORY_AUS, 0x00000800},
+        {"אוקלהומה", TERRITORY_US_OK, 0x00000800},
+        {"אוקראינה", TERRITORY_UKR, 0x00000800},
+        {"אורגון", TERRITORY_US_OR, 0x00000800},
+        {"אורוגוואי", TERRITORY_URY, 0x00000800},
+        {"אוריסה", TERRITORY_IN_OR, 0x00000800},
+        {"אזרבייג`ן", TERRITORY_AZE, 0x00000800},
+        {"אי הנסיך אדוארד", TERRITORY_CA_PE, 0x00000800},
+        {"אי חג המולד", TERRITORY_CXR, 0x00000800},
+        {"אי שלם", TERRITORY_SLB, 0x00000800},
+        {"איווה", TERRITORY_US_IA, 0x00000800},
+        {"איחוד", TERRITORY_REU, 0x00000800},
+        {"איחוד האמירויות הערביות", TERRITORY_ARE, 0x00000800},
+        {"איטי", TERRITORY_HTI, 0x00000800},
+        {"איטליה", TERRITORY_ITA, 0x00000800},
+        {"איי אולנד", TERRITORY_ALA, 0x00000800},
+        {"איי בהאמה", TERRITORY_BHS, 0x00000800},
+        {"איי בובה", TERRITORY_BVT, 0x00000800},
+        {"איי הבתולה הבריטיים", TERRITORY_VGB, 0x00000800},
+        {"איי הבתולה של ארצות הברית", TERRITORY_VIR, 0x00000800},
+        {"איי הבתולה, בריטניה", TERRITORY_VGB, 0x00000800},
+        {"איי טורקס וקאיקוס", TERRITORY_TCA, 0x00000800},
+        {"איי מריאנה הצפוניים", TERRITORY_MNP, 0x00000800},
+        {"איי מרשל", TERRITORY_MHL, 0x00000800},
+        {"איי פוקלנד", TERRITORY_FLK, 0x00000800},
+        {"איי פיג`י", TERRITORY_FJI, 0x00000800},
+        {"איי פיטקרן", TERRITORY_PCN, 0x00000800},
+        {"איי פרו", TERRITORY_FRO, 0x00000800},
+        {"איי קוק", TERRITORY_COK, 0x00000800},
+        {"איי קוקוס", TERRITORY_CCK, 0x00000800},
+        {"איי קיימן", TERRITORY_CYM, 0x00000800},
+        {"איידהו", TERRITORY_US_ID, 0x00000800},
+        {"אילינוי", TERRITORY_US_IL, 0x00000800},
+        {"אינגושטיה הרפובליקה", TERRITORY_RU_IN, 0x00000800},
+        {"אינדונזיה", TERRITORY_IDN, 0x00000800},
+        {"אינדיאנה", TERRITORY_US_IN, 0x00000800},
+        {"אינר מונגוליה", TERRITORY_CN_NM, 0x00000800},
+        {"איסלנד", TERRITORY_ISL, 0x00000800},
+        {"אירלנד", TERRITORY_IRL, 0x00000800},
+        {"אירלנד, צפון", TERRITORY_GBR, 0x00000800},
+        {"אירן", TERRITORY_IRN, 0x00000800},
+        {"אל סלבדור", TERRITORY_SLV, 0x00000800},
+        {"אלאגאוס", TERRITORY_BR_AL, 0x00000800},
+        {"אלבמה", TERRITORY_US_AL, 0x00000800},
+        {"אלבניה", TERRITORY_ALB, 0x00000800},
+        {"אלברטה", TERRITORY_CA_AB, 0x00000800},
+        {"אלג`יריה", TERRITORY_DZA, 0x00000800},
+        {"אלטאי", TERRITORY_RU_AL, 0x00000800},
+        {"אלסקה", TERRITORY_US_AK, 0x00000800},
+        {"אמאפה", TERRITORY_BR_AP, 0x00000800},
+        {"אמזונס", TERRITORY_BR_AM, 0x00000800},
+        {"אנגווילה", TERRITORY_AIA, 0x00000800},
+        {"אנגולה", TERRITORY_AGO, 0x00000800},
+        {"אנדורה", TERRITORY_AND, 0x00000800},
+        {"אנדמן וניקובר", TERRITORY_IN_AN, 0x00000800},
+        {"אנדרה פראדש", TERRITORY_IN_AP, 0x00000800},
+        {"אנהוי", TERRITORY_CN_AH, 0x00000800},
+        {"אנטארקטיקה", TERRITORY_ATA, 0x00000800},
+        {"אנטיגואה וברבודה", TERRITORY_ATG, 0x00000800},
+        {"אסאם", TERRITORY_IN_AS, 0x00000800},
+        {"אסטוניה", TERRITORY_EST, 0x00000800},
+        {"אספיריטו סנטו", TERRITORY_BR_ES, 0x00000800},
+        {"אפגניסטן", TERRITORY_AFG, 0x00000800},
+        {"אקוודור", TERRITORY_ECU, 0x00000800},
+        {"ארגנטינה", TERRITORY_ARG, 0x00000800},
+        {"ארובה", TERRITORY_ABW, 0x00000800},
+        {"ארונצ`אל פראדש", TERRITORY_IN_AR, 0x00000800},
+        {"אריזונה", TERRITORY_US_AZ, 0x00000800},
+        {"אריתריאה", TERRITORY_ERI, 0x00000800},
+        {"ארמניה", TERRITORY_ARM, 0x00000800},
+        {"ארצות הברית", TERRITORY_USA, 0x00000800},
+        {"ארצות הברית האיים המרוחקים הקטנים", TERRITORY_UMI, 0x00000800},
+        {"ארקנסו", TERRITORY_US_AR, 0x00000800},
+        {"אתיופיה", TERRITORY_ETH, 0x00000800},
+        {"באהיה", TERRITORY_BR_BA, 0x00000800},
+        {"באחה קליפורניה", TERRITORY_MX_BCN, 0x00000800},
+        {"באחה קליפורניה הדרומית", TERRITORY_MX_BCS, 0x00000800},
+        {"בהוטן", TERRITORY_BTN, 0x00000800},
+        {"בוטסואנה", TERRITORY_BWA, 0x00000800},
+        {"בולגריה", TERRITORY_BGR, 0x00000800},
+        {"בוליביה", TERRITORY_BOL, 0x00000800},
+        {"בונייר, סנט ואת סבא", TERRITORY_BES, 0x00000800},
+        {"בוסניה והרצגובינה", TERRITORY_BIH, 0x00000800},
+        {"בורונדי", TERRITORY_BDI, 0x00000800},
+        {"בוריאטיה הרפובליקה", TERRITORY_RU_BU, 0x00000800},
+        {"בורמה", TERRITORY_MMR, 0x00000800},
+        {"בורקינה פאסו", TERRITORY_BFA, 0x00000800},
+        {"בחריין", TERRITORY_BHR, 0x00000800},
+        {"ביהאר", TERRITORY_IN_BR, 0x00000800},
+        {"בייג`ינג", TERRITORY_CN_BJ, 0x00000800},
+        {"בלארוס", TERRITORY_BLR, 0x00000800},
+        {"בלגיה", TERRITORY_BEL, 0x00000800},
+        {"בליז", TERRITORY_BLZ, 0x00000800},
+        {"במיצ`ואקאן", TERRITORY_MX_MIC, 0x00000800},
+        {"בנגלדש", TERRITORY_BGD, 0x00000800},
+        {"בנין", TERRITORY_BEN, 0x00000800},
+        {"בססקצ`ואן", TERRITORY_CA_SK, 0x00000800},
+        {"ברבדוס", TERRITORY_BRB, 0x00000800},
+        {"ברוניי", TERRITORY_BRN, 0x00000800},
+        {"ברזיל", TERRITORY_BRA, 0x00000800},
+        {"בריטניה", TERRITORY_GBR, 0x00000800},
+        {"ברמודה", TERRITORY_BMU, 0x00000800},
+        {"ג`אמו וקשמיר", TERRITORY_IN_JK, 0x00000800},
+        {"ג`ג`יאנג", TERRITORY_CN_ZJ, 0x00000800},
+        {"ג`ה", TERRITORY_CN_ZJ, 0x00000800},
+        {"ג`הרקאנד", TERRITORY_IN_JH, 0x00000800},
+        {"ג`ורג`יה הדרומית ואיי סנדוויץ `הדרומיים", TERRITORY_SGS, 0x00000800},
+        {"ג`יאנג", TERRITORY_CN_JX, 0x00000800},
+        {"ג`יאנגסו", TERRITORY_CN_JS, 0x00000800},
+        {"ג`יבוטי", TERRITORY_DJI, 0x00000800},
+        {"ג`ילין", TERRITORY_CN_JL, 0x00000800},
+        {"ג`מייקה", TERRITORY_JAM, 0x00000800},
+        {"ג`רזי", TERRITORY_JEY, 0x00000800},
+        {"גאורגיה", TERRITORY_GEO, 0x00000800},
+        {"גאורגיה", TERRITORY_US_GA, 0x00000800},
+        {"גאנה", TERRITORY_GHA, 0x00000800},
+        {"גאנסו", TERRITORY_CN_GS, 0x00000800},
+        {"גבון", TERRITORY_GAB, 0x00000800},
+        {"גואה", TERRITORY_IN_GA, 0x00000800},
+        {"גואטמלה", TERRITORY_GTM, 0x00000800},
+        {"גואם", TERRITORY_GUM, 0x00000800},
+        {"גואנגדונג", TERRITORY_CN_GD, 0x00000800},
+        {"גואנגשי ג`ואנג", TERRITORY_CN_GX, 0x00000800},
+        {"גואנחואטו", TERRITORY_MX_GUA, 0x00000800},
+        {"גוג`אראט", TERRITORY_IN_GJ, 0x00000800},
+        {"גוואדלופ", TERRITORY_GLP, 0x00000800},
+        {"גוויג", TERRITORY_CN_GZ, 0x00000800},
+        {"גויאש", TERRITORY_BR_GO, 0x00000800},
+        {"גיאנה", TERRITORY_GUY, 0x00000800},
+        {"גיאנה הצרפתית", TERRITORY_GUF, 0x00000800},
+        {"גיברלטר", TERRITORY_GIB, 0x00000800},
+        {"גינאה", TERRITORY_GIN, 0x00000800},
+        {"גינאה ביסאו", TERRITORY_GNB, 0x00000800},
+        {"גיניאה המשוונית", TERRITORY_GNQ, 0x00000800},
+        {"גמביה", TERRITORY_GMB, 0x00000800},
+        {"גרינלנד", TERRITORY_GRL, 0x00000800},
+        {"גרמניה", TERRITORY_DEU, 0x00000800},
+        {"גרנדה", TERRITORY_GRD, 0x00000800},
+        {"גרנזי", TERRITORY_GGY, 0x00000800},
+        {"גררתי", TERRITORY_MX_GRO, 0x00000800},
+        {"דאגסטן הרפובליקה", TERRITORY_RU_DA, 0x00000800},
+        {"דדרה ונגר הבלי", TERRITORY_IN_DN, 0x00000800},
+        {"דומיניקה", TERRITORY_DMA, 0x00000800},
+        {"דורנגו", TERRITORY_MX_DUR, 0x00000800},
+        {"דלאוור", TERRITORY_US_DE, 0x00000800},
+        {"דלהי", TERRITORY_IN_DL, 0x00000800},
+        {"דמאן ודיו", TERRITORY_IN_DD, 0x00000800},
+        {"דנמרק", TERRITORY_DNK, 0x00000800},
+        {"דרום אוסטרליה", TERRITORY_AU_SA, 0x00000800},
+        {"דרום אפריקה", TERRITORY_ZAF, 0x00000800},
+        {"דרום דקוטה", TERRITORY_US_SD, 0x00000800},
+        {"דרום סודן", TERRITORY_SSD, 0x00000800},
+        {"דרום קוריאה", TERRITORY_KOR, 0x00000800},
+        {"דרום קרוליינה", TERRITORY_US_SC, 0x00000800},
+        {"האי מאן", TERRITORY_IMN, 0x00000800},
+        {"האיים המלדיביים", TERRITORY_MDV, 0x00000800},
+        {"האינאן", TERRITORY_CN_HI, 0x00000800},
+        {"האריאנה", TERRITORY_IN_HR, 0x00000800},
+        {"הביי", TERRITORY_CN_HE, 0x00000800},
+        {"הבינלאומי", TERRITORY_AAA, 0x00000800},
+        {"הוביי", TERRITORY_CN_HB, 0x00000800},
+        {"הודו", TERRITORY_IND, 0x00000800},
+        {"הוואי", TERRITORY_US_HI, 0x00000800},
+        {"הוותיקן", TERRITORY_VAT, 0x00000800},
+        {"הולנד", TERRITORY_NLD, 0x00000800},
+        {"הונאן", TERRITORY_CN_HN, 0x00000800},
+        {"הונג קונג", TERRITORY_HKG, 0x00000800},
+        {"הונגריה", TERRITORY_HUN, 0x00000800},
+        {"הונדורס", TERRITORY_HND, 0x00000800},
+        {"הטריטוריה הצפונית", TERRITORY_AU_NT, 0x00000800},
+        {"הטריטוריות הצפון מערביות", TERRITORY_CA_NT, 0x00000800},
+        {"הידאלגו", TERRITORY_MX_HID, 0x00000800},
+        {"היילונג", TERRITORY_CN_HL, 0x00000800},
+        {"הימאצ`אל פראדש", TERRITORY_IN_HP, 0x00000800},
+        {"הכס הקדוש", TERRITORY_VAT, 0x00000800},
+        {"המחוז האוטונומי של הניינץ", TERRITORY_RU_NEN, 0x00000800},
+        {"הממלכה המאוחדת", TERRITORY_GBR, 0x00000800},
+        {"הנאן", TERRITORY_CN_HA, 0x00000800},
+        {"הסהרה המערבית", TERRITORY_ESH, 0x00000800},
+        {"הצ`צ`נים רפובליקה", TERRITORY_RU_CE, 0x00000800},
+        {"הרפובליקה הדומיניקנית", TERRITORY_DOM, 0x00000800},
+        {"הרפובליקה המרכז - אפריקאית", TERRITORY_CAF, 0x00000800},
+        {"הרפובליקה הצ`כית", TERRITORY_CZE, 0x00000800},
+        {"הרפובליקה של בשקיריה", TERRITORY_RU_BA, 0x00000800},
+        {"הרפובליקה של טובה", TERRITORY_RU_TY, 0x00000800},
+        {"השטח הפלסטיני", TERRITORY_PSE, 0x00000800},
+        {"ואיי סנדוויץ` הדרומיים", TERRITORY_SGS, 0x00000800},
+        {"ואליס ופוטונה", TERRITORY_WLF, 0x00000800},
+        {"וברבודה", TERRITORY_ATG, 0x00000800},
+        {"והגרנדינים", TERRITORY_VCT, 0x00000800},
+        {"וושינגטון", TERRITORY_US_WA, 0x00000800},
+        {"וטובגו", TERRITORY_TTO, 0x00000800},
+        {"ויומינג", TERRITORY_US_WY, 0x00000800},
+        {"וייטנאם", TERRITORY_VNM, 0x00000800},
+        {"ויסקונסין", TERRITORY_US_WI, 0x00000800},
+        {"ויקטוריה", TERRITORY_AU_VIC, 0x00000800},
+        {"וירג`יניה", TERRITORY_US_VA, 0x00000800},
+        {"ומיקלון", TERRITORY_SPM, 0x00000800},
+        {"ונואטו", TERRITORY_VUT, 0x00000800},
+        {"ונצואלה", TERRITORY_VEN, 0x00000800},
+        {"ופוטונה", TERRITORY_WLF, 0x00000800},
+        {"וקאיקוס איי", TERRITORY_TCA, 0x00000800},
+        {"וראקרוז", TERRITORY_MX_VER, 0x00000800},
+        {"ורמונט", TERRITORY_US_VT, 0x00000800},
+        {"זאקאטקאס", TERRITORY_MX_ZAC, 0x00000800},
+        {"זימבבואה", TERRITORY_ZWE, 0x00000800},
+        {"זמביה", TERRITORY_ZMB, 0x00000800},
+        {"חאנטי-מנסי", TERRITORY_RU_KM, 0x00000800},
+        {"חבוש רפובליקה", TERRITORY_RU_CU, 0x00000800},
+        {"חוף שנהב", TERRITORY_CIV, 0x00000800},
+        {"חליסקו", TERRITORY_MX_JAL, 0x00000800},
+        {"חקסיה הרפובליקה", TERRITORY_RU_KK, 0x00000800},
+        {"טאמיל נאדו", TERRITORY_IN_TN, 0x00000800},
+        {"טבסקו", TERRITORY_MX_TAB, 0x00000800},
+        {"טג`יקיסטן", TERRITORY_TJK, 0x00000800},
+        {"טובאלו", TERRITORY_TUV, 0x00000800},
+        {"טונגה", TERRITORY_TON, 0x00000800},
+        {"טוקלאו", TERRITORY_TKL, 0x00000800},
+        {"טוקנטינס", TERRITORY_BR_TO, 0x00000800},
+        {"טורקיה", TERRITORY_TUR, 0x00000800},
+        {"טורקמניסטן", TERRITORY_TKM, 0x00000800},
+        {"טטרסטן הרפובליקה", TERRITORY_RU_TA, 0x00000800},
+        {"טיאנג`ין", TERRITORY_CN_TJ, 0x00000800},
+        {"טיבט", TERRITORY_CN_XZ, 0x00000800},
+        {"טייוואן", TERRITORY_TWN, 0x00000800},
+        {"טלאקסקאלה", TERRITORY_MX_TLA, 0x00000800},
+        {"טלנגאנה", TERRITORY_IN_TG, 0x00000800},
+        {"טמאוליפס", TERRITORY_MX_TAM, 0x00000800},
+        {"טנזניה", TERRITORY_TZA, 0x00000800},
+        {"טנסי", TERRITORY_US_TN, 0x00000800},
+        {"טסמניה", TERRITORY_AU_TAS, 0x00000800},
+        {"טקסס", TERRITORY_US_TX, 0x00000800},
+        {"טריטוריה בריטית באוקיינוס ​​ההודי", TERRITORY_IOT, 0x00000800},
+        {"טריטוריית הבירה האוסטרלית", TERRITORY_AU_ACT, 0x00000800},
+        {"טריטוריית מפרץ ג`רביס", TERRITORY_AU_JBT, 0x00000800},
+        {"טרינידד וטובגו", TERRITORY_TTO, 0x00000800},
+        {"טריסטן דה קונה", TERRITORY_SHN, 0x00000800},
+        {"טריפורה", TERRITORY_IN_TR, 0x00000800},
+        {"יאן מאיין", TERRITORY_SJM, 0x00000800},
+        {"יוטה", TERRITORY_US_UT, 0x00000800},
+        {"יון", TERRITORY_GRC, 0x00000800},
+        {"יונאן", TERRITORY_CN_YN, 0x00000800},
+        {"יוקון", TERRITORY_CA_YT, 0x00000800},
+        {"יוקטן", TERRITORY_MX_YUC, 0x00000800},
+        {"ימלו-nenets", TERRITORY_RU_YAN, 0x00000800},
+        {"יפן", TERRITORY_JPN, 0x00000800},
+        {"ירדן", TERRITORY_JOR, 0x00000800},
+#endif
+        {"ישראל", TERRITORY_ISR, 0x08000800},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HE)
+        {"כדור הארץ", TERRITORY_AAA, 0x00000800},
+        {"כווית", TERRITORY_KWT, 0x00000800},
+        {"לאוס", TERRITORY_LAO, 0x00000800},
+        {"לבנון", TERRITORY_LBN, 0x00000800},
+        {"לואיזיאנה", TERRITORY_US_LA, 0x00000800},
+        {"לוב", TERRITORY_LBY, 0x00000800},
+        {"לוקסמבורג", TERRITORY_LUX, 0x00000800},
+        {"לטביה", TERRITORY_LVA, 0x00000800},
+        {"ליאונינג", TERRITORY_CN_LN, 0x00000800},
+        {"ליבריה", TERRITORY_LBR, 0x00000800},
+        {"ליטא", TERRITORY_LTU, 0x00000800},
+        {"ליכטנשטיין", TERRITORY_LIE, 0x00000800},
+        {"לסוטו", TERRITORY_LSO, 0x00000800},
+        {"לקשאדוויפ", TERRITORY_IN_LD, 0x00000800},
+        {"מאגאליה", TERRITORY_IN_ML, 0x00000800},
+        {"מאדהיה פראדש", TERRITORY_IN_MP, 0x00000800},
+        {"מאוריטניה", TERRITORY_MRT, 0x00000800},
+        {"מאוריציוס", TERRITORY_MUS, 0x00000800},
+        {"מאטו גרוסו", TERRITORY_BR_MT, 0x00000800},
+        {"מאטו גרוסו דו סול", TERRITORY_BR_MS, 0x00000800},
+        {"מאלי", TERRITORY_MLI, 0x00000800},
+        {"מארי אל הרפובליקה", TERRITORY_RU_ME, 0x00000800},
+        {"מדגסקר", TERRITORY_MDG, 0x00000800},
+        {"מדינת מקסיקו", TERRITORY_MX_MX, 0x00000800},
+#endif
+        {"מדינת פלסטין", TERRITORY_PSE, 0x08000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HE)
+        {"מהרשטרה", TERRITORY_IN_MH, 0x00000800},
+        {"מוזמביק", TERRITORY_MOZ, 0x00000800},
+        {"מולדובה", TERRITORY_MDA, 0x00000800},
+        {"מונגוליה", TERRITORY_MNG, 0x00000800},
+        {"מונטנגרו", TERRITORY_MNE, 0x00000800},
+        {"מונטנה", TERRITORY_US_MT, 0x00000800},
+        {"מונטסראט", TERRITORY_MSR, 0x00000800},
+        {"מונקו", TERRITORY_MCO, 0x00000800},
+        {"מוסקבה", TERRITORY_RU_MOW, 0x00000800},
+        {"מוקדון", TERRITORY_MKD, 0x00000800},
+        {"מורדוביה הרפובליקה", TERRITORY_RU_MO, 0x00000800},
+        {"מורלוס", TERRITORY_MX_MOR, 0x00000800},
+        {"מזרח טימור", TERRITORY_TLS, 0x00000800},
+        {"מחוז אולייאנובסק", TERRITORY_RU_ULY, 0x00000800},
+        {"מחוז אומסק", TERRITORY_RU_OMS, 0x00000800},
+        {"מחוז אוריול", TERRITORY_RU_ORL, 0x00000800},
+        {"מחוז אורנבורג", TERRITORY_RU_ORE, 0x00000800},
+        {"מחוז איוואנובו", TERRITORY_RU_IVA, 0x00000800},
+        {"מחוז אירקוטסק", TERRITORY_RU_IRK, 0x00000800},
+        {"מחוז אלטאי", TERRITORY_RU_ALT, 0x00000800},
+        {"מחוז אמור", TERRITORY_RU_AMU, 0x00000800},
+        {"מחוז אסטרחן", TERRITORY_RU_AST, 0x00000800},
+        {"מחוז ארכנגלסק", TERRITORY_RU_ARK, 0x00000800},
+        {"מחוז בלגורוד", TERRITORY_RU_BE, 0x00000800},
+        {"מחוז בריאנסק", TERRITORY_RU_BRY, 0x00000800},
+        {"מחוז וולגוגרד", TERRITORY_RU_VGG, 0x00000800},
+        {"מחוז וולוגדה", TERRITORY_RU_VLG, 0x00000800},
+        {"מחוז וורונז `", TERRITORY_RU_VOR, 0x00000800},
+        {"מחוז ולדימיר", TERRITORY_RU_VLA, 0x00000800},
+        {"מחוז חברובסק", TERRITORY_RU_KHA, 0x00000800},
+        {"מחוז טבר", TERRITORY_RU_TVE, 0x00000800},
+        {"מחוז טולה", TERRITORY_RU_TUL, 0x00000800},
+        {"מחוז טומסק", TERRITORY_RU_TOM, 0x00000800},
+        {"מחוז טיומן", TERRITORY_RU_TYU, 0x00000800},
+        {"מחוז טמבוב", TERRITORY_RU_TT, 0x00000800},
+        {"מחוז יהודי אוטונומי", TERRITORY_RU_YEV, 0x00000800},
+        {"מחוז ירוסלבל", TERRITORY_RU_YAR, 0x00000800},
+        {"מחוז ליפצק", TERRITORY_RU_LIP, 0x00000800},
+        {"מחוז לנינגרד", TERRITORY_RU_LEN, 0x00000800},
+        {"מחוז מגדן", TERRITORY_RU_MAG, 0x00000800},
+        {"מחוז מוסקבה", TERRITORY_RU_MOS, 0x00000800},
+        {"מחוז מורמנסק", TERRITORY_RU_MUR, 0x00000800},
+        {"מחוז נובגורוד", TERRITORY_RU_NGR, 0x00000800},
+        {"מחוז נובוסיבירסק", TERRITORY_RU_NVS, 0x00000800},
+        {"מחוז ניז`ני נובגורוד", TERRITORY_RU_NIZ, 0x00000800},
+        {"מחוז סברדלובסק", TERRITORY_RU_SVE, 0x00000800},
+        {"מחוז סחלין", TERRITORY_RU_SAK, 0x00000800},
+        {"מחוז סטברופול", TERRITORY_RU_STA, 0x00000800},
+        {"מחוז סמולנסק", TERRITORY_RU_SMO, 0x00000800},
+        {"מחוז סמרה", TERRITORY_RU_SAM, 0x00000800},
+        {"מחוז סראטוב", TERRITORY_RU_SAR, 0x00000800},
+        {"מחוז עבר הבאיקל", TERRITORY_RU_ZAB, 0x00000800},
+        {"מחוז פדרלי", TERRITORY_MX_DIF, 0x00000800},
+        {"מחוז פדרלי", TERRITORY_BR_DF, 0x00000800},
+        {"מחוז פנזה", TERRITORY_RU_PNZ, 0x00000800},
+        {"מחוז פסקוב", TERRITORY_RU_PSK, 0x00000800},
+        {"מחוז פרימוריה", TERRITORY_RU_PO, 0x00000800},
+        {"מחוז פרם", TERRITORY_RU_PM, 0x00000800},
+        {"מחוז צ`ליאבינסק", TERRITORY_RU_CH, 0x00000800},
+        {"מחוז קולומביה", TERRITORY_US_DC, 0x00000800},
+        {"מחוז קוסטרומה", TERRITORY_RU_KOS, 0x00000800},
+        {"מחוז קורגן", TERRITORY_RU_KGN, 0x00000800},
+        {"מחוז קורסק", TERRITORY_RU_KRS, 0x00000800},
+        {"מחוז קירוב", TERRITORY_RU_KI, 0x00000800},
+        {"מחוז קלוגה", TERRITORY_RU_KLU, 0x00000800},
+        {"מחוז קלינינגרד", TERRITORY_RU_KGD, 0x00000800},
+        {"מחוז קמצ`טקה", TERRITORY_RU_KAM, 0x00000800},
+        {"מחוז קמרובו", TERRITORY_RU_KEM, 0x00000800},
+        {"מחוז קרסנויארסק", TERRITORY_RU_KYA, 0x00000800},
+        {"מחוז רוסטוב", TERRITORY_RU_ROS, 0x00000800},
+        {"מחוז ריאזאן", TERRITORY_RU_RYA, 0x00000800},
+        {"מיאנמר", TERRITORY_MMR, 0x00000800},
+        {"מיוט", TERRITORY_MYT, 0x00000800},
+        {"מיזוראם", TERRITORY_IN_MZ, 0x00000800},
+        {"מיזורי", TERRITORY_US_MO, 0x00000800},
+        {"מיין", TERRITORY_US_ME, 0x00000800},
+        {"מינאס גראיס", TERRITORY_BR_MG, 0x00000800},
+        {"מינסוטה", TERRITORY_US_MN, 0x00000800},
+        {"מיסיסיפי", TERRITORY_US_MS, 0x00000800},
+        {"מיקרונזיה", TERRITORY_FSM, 0x00000800},
+        {"מישיגן", TERRITORY_US_MI, 0x00000800},
+        {"מלאווי", TERRITORY_MWI, 0x00000800},
+        {"מלזיה", TERRITORY_MYS, 0x00000800},
+        {"מלטה", TERRITORY_MLT, 0x00000800},
+        {"מניטובה", TERRITORY_CA_MB, 0x00000800},
+        {"מניפור", TERRITORY_IN_MN, 0x00000800},
+        {"מסצ`וסטס", TERRITORY_US_MA, 0x00000800},
+        {"מערב אוסטרליה", TERRITORY_AU_WA, 0x00000800},
+        {"מערב בנגל", TERRITORY_IN_WB, 0x00000800},
+        {"מערב וירג`יניה", TERRITORY_US_WV, 0x00000800},
+        {"מצרים", TERRITORY_EGY, 0x00000800},
+        {"מקאו", TERRITORY_MAC, 0x00000800},
+        {"מקסיקו", TERRITORY_MEX, 0x00000800},
+        {"מקרקעי דרום צרפתים באנטארקטיקה", TERRITORY_ATF, 0x00000800},
+        {"מרוקו", TERRITORY_MAR, 0x00000800},
+        {"מרטיניק", TERRITORY_MTQ, 0x00000800},
+        {"מרילנד", TERRITORY_US_MD, 0x00000800},
+        {"מרנאו", TERRITORY_BR_MA, 0x00000800},
+        {"נאגאלנד", TERRITORY_IN_NL, 0x00000800},
+        {"נאורו", TERRITORY_NRU, 0x00000800},
+        {"נאיאריט", TERRITORY_MX_NAY, 0x00000800},
+        {"נבדה", TERRITORY_US_NV, 0x00000800},
+        {"נברסקה", TERRITORY_US_NE, 0x00000800},
+        {"נואבו לאון", TERRITORY_MX_NLE, 0x00000800},
+        {"נובה סקוטיה", TERRITORY_CA_NS, 0x00000800},
+        {"נונאווט", TERRITORY_CA_NU, 0x00000800},
+        {"נורווגיה", TERRITORY_NOR, 0x00000800},
+        {"נורפולק ופיליפ איילנד", TERRITORY_NFK, 0x00000800},
+        {"ניגריה", TERRITORY_NGA, 0x00000800},
+        {"ניו - ברונסוויק", TERRITORY_CA_NB, 0x00000800},
+        {"ניו ג`רזי", TERRITORY_US_NJ, 0x00000800},
+        {"ניו המפשייר", TERRITORY_US_NH, 0x00000800},
+        {"ניו זילנד", TERRITORY_NZL, 0x00000800},
+        {"ניו יורק", TERRITORY_US_NY, 0x00000800},
+        {"ניו מקסיקו", TERRITORY_US_NM, 0x00000800},
+        {"ניו סאות` ויילס", TERRITORY_AU_NSW, 0x00000800},
+        {"ניואה", TERRITORY_NIU, 0x00000800},
+        {"ניופאונדלנד", TERRITORY_CA_NL, 0x00000800},
+        {"ניז`ר", TERRITORY_NER, 0x00000800},
+        {"נינגשיה הואי", TERRITORY_CN_NX, 0x00000800},
+        {"ניקרגואה", TERRITORY_NIC, 0x00000800},
+        {"נמיביה", TERRITORY_NAM, 0x00000800},
+        {"נפאל", TERRITORY_NPL, 0x00000800},
+        {"סאו טומה ופרינסיפה", TERRITORY_STP, 0x00000800},
+        {"סאו פאולו", TERRITORY_BR_SP, 0x00000800},
+        {"סבא", TERRITORY_BES, 0x00000800},
+        {"סבאלברד ויאן מאיין", TERRITORY_SJM, 0x00000800},
+        {"סהרה טוענת לבעלות", TERRITORY_ESH, 0x00000800},
+        {"סודן", TERRITORY_SDN, 0x00000800},
+        {"סווזילנד", TERRITORY_SWZ, 0x00000800},
+        {"סומליה", TERRITORY_SOM, 0x00000800},
+        {"סונורה", TERRITORY_MX_SON, 0x00000800},
+        {"סוריה", TERRITORY_SYR, 0x00000800},
+        {"סורינאם", TERRITORY_SUR, 0x00000800},
+        {"סיארה", TERRITORY_BR_CE, 0x00000800},
+        {"סיירה לאונה", TERRITORY_SLE, 0x00000800},
+        {"סיישל", TERRITORY_SYC, 0x00000800},
+        {"סין", TERRITORY_CHN, 0x00000800},
+        {"סינאלואה", TERRITORY_MX_SIN, 0x00000800},
+        {"סינגפור", TERRITORY_SGP, 0x00000800},
+        {"סיקים", TERRITORY_IN_SK, 0x00000800},
+        {"סלובניה", TERRITORY_SVN, 0x00000800},
+        {"סלובקיה", TERRITORY_SVK, 0x00000800},
+        {"סמואה", TERRITORY_WSM, 0x00000800},
+        {"סמואה האמריקאית", TERRITORY_ASM, 0x00000800},
+        {"סמואה, אמריקאי", TERRITORY_ASM, 0x00000800},
+        {"סן לואיס פוטוסי", TERRITORY_MX_SLP, 0x00000800},
+        {"סן מרטן", TERRITORY_SXM, 0x00000800},
+        {"סן מרינו", TERRITORY_SMR, 0x00000800},
+        {"סנגל", TERRITORY_SEN, 0x00000800},
+        {"סנט ברתלמי", TERRITORY_BLM, 0x00000800},
+        {"סנט הלנה, אסנשן וטריסטן דה קונה", TERRITORY_SHN, 0x00000800},
+        {"סנט וינסנט והגרנדינים", TERRITORY_VCT, 0x00000800},
+        {"סנט לוסיה", TERRITORY_LCA, 0x00000800},
+        {"סנט מרטין אין", TERRITORY_MAF, 0x00000800},
+        {"סנט פטרסבורג", TERRITORY_RU_SPE, 0x00000800},
+        {"סנט פייר ומיקלון", TERRITORY_SPM, 0x00000800},
+        {"סנט קיטס ונוויס", TERRITORY_KNA, 0x00000800},
+        {"סנטה קטרינה", TERRITORY_BR_SC, 0x00000800},
+        {"ספרד", TERRITORY_ESP, 0x00000800},
+        {"סצ`ואן", TERRITORY_CN_SC, 0x00000800},
+        {"סקוטלנד", TERRITORY_GBR, 0x00000800},
+        {"סרביה", TERRITORY_SRB, 0x00000800},
+        {"סרגיפה", TERRITORY_BR_SE, 0x00000800},
+        {"סרי לנקה", TERRITORY_LKA, 0x00000800},
+        {"עומאן", TERRITORY_OMN, 0x00000800},
+        {"עיראק", TERRITORY_IRQ, 0x00000800},
+        {"עכו", TERRITORY_BR_AC, 0x00000800},
+        {"ערב הסעודית", TERRITORY_SAU, 0x00000800},
+        {"פאראנה", TERRITORY_BR_PR, 0x00000800},
+        {"פארה", TERRITORY_BR_PA, 0x00000800},
+        {"פואבלה", TERRITORY_MX_PUE, 0x00000800},
+        {"פוארטו ריקו", TERRITORY_PRI, 0x00000800},
+        {"פוג`יאן", TERRITORY_CN_FJ, 0x00000800},
+        {"פולין", TERRITORY_POL, 0x00000800},
+        {"פולינזיה הצרפתית", TERRITORY_PYF, 0x00000800},
+        {"פונג`אב", TERRITORY_IN_PB, 0x00000800},
+        {"פונדיצ`רי", TERRITORY_IN_PY, 0x00000800},
+        {"פורטוגל", TERRITORY_PRT, 0x00000800},
+        {"פיאאוי", TERRITORY_BR_PI, 0x00000800},
+        {"פיג`י", TERRITORY_FJI, 0x00000800},
+        {"פיליפ איילנד", TERRITORY_NFK, 0x00000800},
+        {"פיליפיני", TERRITORY_PHL, 0x00000800},
+        {"פינלנד", TERRITORY_FIN, 0x00000800},
+        {"פלאו", TERRITORY_PLW, 0x00000800},
+        {"פלורידה", TERRITORY_US_FL, 0x00000800},
+        {"פנמה", TERRITORY_PAN, 0x00000800},
+        {"פנסילבניה", TERRITORY_US_PA, 0x00000800},
+        {"פפואה גינאה החדשה", TERRITORY_PNG, 0x00000800},
+        {"פקיסטן", TERRITORY_PAK, 0x00000800},
+        {"פרגוואי", TERRITORY_PRY, 0x00000800},
+        {"פרו", TERRITORY_PER, 0x00000800},
+        {"פרייבה", TERRITORY_BR_PB, 0x00000800},
+        {"פרנמבוקו", TERRITORY_BR_PE, 0x00000800},
+        {"צ`אד", TERRITORY_TCD, 0x00000800},
+        {"צ`אנדיגאר", TERRITORY_IN_CH, 0x00000800},
+        {"צ`האטיסגאר", TERRITORY_IN_CT, 0x00000800},
+        {"צ`ונגצ`ינג", TERRITORY_CN_CQ, 0x00000800},
+        {"צ`וקוטקה אוקרוג", TERRITORY_RU_CHU, 0x00000800},
+        {"צ`יאפס", TERRITORY_MX_CHP, 0x00000800},
+        {"צ`יוואווה", TERRITORY_MX_CHH, 0x00000800},
+        {"צ`ילה", TERRITORY_CHL, 0x00000800},
+        {"צ`ינגהאי", TERRITORY_CN_QH, 0x00000800},
+        {"צפון אוסטיה-אלניה הרפובליקה", TERRITORY_RU_SE, 0x00000800},
+        {"צפון אירלנד", TERRITORY_GBR, 0x00000800},
+        {"צפון דקוטה", TERRITORY_US_ND, 0x00000800},
+        {"צפון קוריאה", TERRITORY_PRK, 0x00000800},
+        {"צפון קרוליינה", TERRITORY_US_NC, 0x00000800},
+        {"צרפת", TERRITORY_FRA, 0x00000800},
+        {"קאראצ`אי-צ`רקסיה", TERRITORY_RU_KC, 0x00000800},
+        {"קברדינו-בלקריה", TERRITORY_RU_KB, 0x00000800},
+        {"קואהווילה", TERRITORY_MX_COA, 0x00000800},
+        {"קובה", TERRITORY_CUB, 0x00000800},
+        {"קוויבק", TERRITORY_CA_QC, 0x00000800},
+        {"קווינטנה רו", TERRITORY_MX_ROO, 0x00000800},
+        {"קווינסלנד", TERRITORY_AU_QLD, 0x00000800},
+        {"קולומביה", TERRITORY_COL, 0x00000800},
+        {"קולומביה הבריטית", TERRITORY_CA_BC, 0x00000800},
+        {"קולורדו", TERRITORY_US_CO, 0x00000800},
+        {"קולימה", TERRITORY_MX_CL, 0x00000800},
+        {"קומורו", TERRITORY_COM, 0x00000800},
+        {"קונגו-ברזוויל", TERRITORY_COG, 0x00000800},
+        {"קונגו-קינשאסה", TERRITORY_COD, 0x00000800},
+        {"קונטיקט", TERRITORY_US_CT, 0x00000800},
+        {"קוסטה ריקה", TERRITORY_CRI, 0x00000800},
+        {"קורסאו", TERRITORY_CUW, 0x00000800},
+        {"קזחסטן", TERRITORY_KAZ, 0x00000800},
+        {"קטאר", TERRITORY_QAT, 0x00000800},
+        {"קייפ ורדה", TERRITORY_CPV, 0x00000800},
+        {"קילינג איי", TERRITORY_CCK, 0x00000800},
+        {"קירגיזסטן", TERRITORY_KGZ, 0x00000800},
+        {"קיריבטי", TERRITORY_KIR, 0x00000800},
+        {"קלדוניה החדשה", TERRITORY_NCL, 0x00000800},
+        {"קליפורניה", TERRITORY_US_CA, 0x00000800},
+        {"קליפרטון", TERRITORY_CPT, 0x00000800},
+        {"קלמיקיה הרפובליקה", TERRITORY_RU_KL, 0x00000800},
+        {"קמבודיה", TERRITORY_KHM, 0x00000800},
+        {"קמפצ`ה", TERRITORY_MX_CAM, 0x00000800},
+        {"קמרון", TERRITORY_CMR, 0x00000800},
+        {"קנדה", TERRITORY_CAN, 0x00000800},
+        {"קנזס", TERRITORY_US_KS, 0x00000800},
+        {"קנטאקי", TERRITORY_US_KY, 0x00000800},
+        {"קנייה", TERRITORY_KEN, 0x00000800},
+        {"קפריסין", TERRITORY_CYP, 0x00000800},
+        {"קראלה", TERRITORY_IN_KL, 0x00000800},
+        {"קרואטיה", TERRITORY_HRV, 0x00000800},
+        {"קרטארו", TERRITORY_MX_QUE, 0x00000800},
+        {"קרליה הרפובליקה", TERRITORY_RU_KR, 0x00000800},
+        {"קרנטקה", TERRITORY_IN_KA, 0x00000800},
+        {"קרסנודר krai", TERRITORY_RU_KDA, 0x00000800},
+        {"רג`סטאן", TERRITORY_IN_RJ, 0x00000800},
+        {"רואנדה", TERRITORY_RWA, 0x00000800},
+        {"רוד איילנד", TERRITORY_US_RI, 0x00000800},
+        {"רומני", TERRITORY_ROU, 0x00000800},
+        {"רונדוניה", TERRITORY_BR_RO, 0x00000800},
+        {"רוסיה", TERRITORY_RUS, 0x00000800},
+        {"רוראימה", TERRITORY_BR_RR, 0x00000800},
+        {"ריו גרנדה דו נורטה", TERRITORY_BR_RN, 0x00000800},
+        {"ריו גרנדה דו סול", TERRITORY_BR_RS, 0x00000800},
+        {"ריו דה ז`נרו", TERRITORY_BR_RJ, 0x00000800},
+        {"רפובליקה יאקוטיה", TERRITORY_RU_SA, 0x00000800},
+        {"רפובליקה קומית", TERRITORY_RU_KO, 0x00000800},
+        {"רפובליקת טוגו", TERRITORY_TGO, 0x00000800},
+        {"רפובליקת סאחה-יקוטיה", TERRITORY_RU_SA, 0x00000800},
+        {"שאאנשי", TERRITORY_CN_SN, 0x00000800},
+        {"שאנדונג", TERRITORY_CN_SD, 0x00000800},
+        {"שאנשי", TERRITORY_CN_SX, 0x00000800},
+        {"שוודיה", TERRITORY_SWE, 0x00000800},
+        {"שווייץ", TERRITORY_CHE, 0x00000800},
+        {"שמעתי איילנד ואיי מקדונלד", TERRITORY_HMD, 0x00000800},
+        {"שנחאי", TERRITORY_CN_SH, 0x00000800},
+        {"תאילנד", TERRITORY_THA, 0x00000800},
+        {"תוניסיה", TERRITORY_TUN, 0x00000800},
+        {"תימן", TERRITORY_YEM, 0x00000800},
+#endif
+        {"اتر پردیش", TERRITORY_IN_UP, 0x08000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AR)
+        {"اثيوبيا", TERRITORY_ETH, 0x00000002},
+        {"اذربيجان", TERRITORY_AZE, 0x00000002},
+        {"اراض فرنسية جنوبية وانتارتيكية", TERRITORY_ATF, 0x00000002},
+        {"ارخانجيلسك اوبلاست", TERRITORY_RU_ARK, 0x00000002},
+        {"اركنساس", TERRITORY_US_AR, 0x00000002},
+        {"ارمينيا", TERRITORY_ARM, 0x00000002},
+        {"اروبا", TERRITORY_ABW, 0x00000002},
+        {"اروناتشال براديش", TERRITORY_IN_AR, 0x00000002},
+#endif
+        {"اريتريا", TERRITORY_ERI, 0x08000002},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AR)
+        {"اريزونا", TERRITORY_US_AZ, 0x00000002},
+        {"اسام", TERRITORY_IN_AS, 0x00000002},
+        {"اسبانيا", TERRITORY_ESP, 0x00000002},
+        {"اسبيريتو سانتو", TERRITORY_BR_ES, 0x00000002},
+        {"استراخان اوبلاست", TERRITORY_RU_AST, 0x00000002},
+        {"استراليا", TERRITORY_AUS, 0x00000002},
+        {"استراليا الغربية", TERRITORY_AU_WA, 0x00000002},
+        {"استونيا", TERRITORY_EST, 0x00000002},
+        {"اسراييل", TERRITORY_ISR, 0x00000002},
+#endif
+        {"اسراييل‎‎", TERRITORY_ISR, 0x08000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AR)
+        {"اسكتلندا", TERRITORY_GBR, 0x00000002},
+        {"اسينشين", TERRITORY_SHN, 0x00000002},
+        {"اغواسكالينتيس", TERRITORY_MX_AGU, 0x00000002},
+#endif
+        {"افغانستان", TERRITORY_AFG, 0x08000002},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AR)
+        {"اقليم العاصمة الاسترالية", TERRITORY_AU_ACT, 0x00000002},
+        {"اقليم المحيط الهندي البريطاني", TERRITORY_IOT, 0x00000002},
+        {"اكري", TERRITORY_BR_AC, 0x00000002},
+        {"اكشادويب", TERRITORY_IN_LD, 0x00000002},
+        {"الاباما", TERRITORY_US_AL, 0x00000002},
+#endif
+        {"الاراضي الفلسطينية", TERRITORY_PSE, 0x08000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AR)
+        {"الارجنتين", TERRITORY_ARG, 0x00000002},
+        {"الاردن", TERRITORY_JOR, 0x00000002},
+#endif
+        {"الاردن‎‎", TERRITORY_JOR, 0x08000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AR)
+        {"الاسكا", TERRITORY_US_AK, 0x00000002},
+        {"الاغواس", TERRITORY_BR_AL, 0x00000002},
+        {"الاقاليم الشمالية الغربية", TERRITORY_CA_NT, 0x00000002},
+        {"الاكوادور", TERRITORY_ECU, 0x00000002},
+#endif
+        {"الامارات العربية المتحدة", TERRITORY_ARE, 0x08000002},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AR)
+        {"الامازون", TERRITORY_BR_AM, 0x00000002},
+        {"الاوبلاست اليهودية الذاتية", TERRITORY_RU_YEV, 0x00000002},
+        {"الاوروغواي", TERRITORY_URY, 0x00000002},
+        {"البانيا", TERRITORY_ALB, 0x00000002},
+        {"البحرين", TERRITORY_BHR, 0x00000002},
+#endif
+        {"البحرين‎", TERRITORY_BHR, 0x08000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AR)
+        {"البرازيل", TERRITORY_BRA, 0x00000002},
+        {"البرتا", TERRITORY_CA_AB, 0x00000002},
+        {"البرتغال", TERRITORY_PRT, 0x00000002},
+        {"البنجاب", TERRITORY_IN_PB, 0x00000002},
+        {"البوسنة والهرسك", TERRITORY_BIH, 0x00000002},
+        {"التاي كراي", TERRITORY_RU_ALT, 0x00000002},
+        {"التبت", TERRITORY_CN_XZ, 0x00000002},
+        {"الجبل الاسود", TERRITORY_MNE, 0x00000002},
+        {"الجزاير", TERRITORY_DZA, 0x00000002},
+#endif
+        {"الجزاير‎‎", TERRITORY_DZA, 0x08000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AR)
+        {"الجزر العذراء البريطانية", TERRITORY_VGB, 0x00000002},
+        {"الجزر الكاريبية الهولندية", TERRITORY_BES, 0x00000002},
+        {"الدنمارك", TERRITORY_DNK, 0x00000002},
+        {"الدولة المكسيك", TERRITORY_MX_MX, 0x00000002},
+        {"الراس الاخضر", TERRITORY_CPV, 0x00000002},
+        {"الس وفوتونا", TERRITORY_WLF, 0x00000002},
+#endif
+        {"السعودية", TERRITORY_SAU, 0x08000002},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AR)
+        {"السلفادور", TERRITORY_SLV, 0x00000002},
+        {"السنغال", TERRITORY_SEN, 0x00000002},
+        {"السودان", TERRITORY_SDN, 0x00000002},
+#endif
+        {"السودان‎‎", TERRITORY_SDN, 0x08000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AR)
+        {"السويد", TERRITORY_SWE, 0x00000002},
+#endif
+        {"الصحراء الغربية", TERRITORY_ESH, 0x08000002},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AR)
+        {"الصومال", TERRITORY_SOM, 0x00000002},
+#endif
+        {"الصومال‎‎", TERRITORY_SOM, 0x08000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AR)
+        {"الصين", TERRITORY_CHN, 0x00000002},
+        {"العراق", TERRITORY_IRQ, 0x00000002},
+#endif
+        {"العراق‎‎", TERRITORY_IRQ, 0x08000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AR)
+        {"الغابون", TERRITORY_GAB, 0x00000002},
+        {"الفاتيكان", TERRITORY_VAT, 0x00000002},
+        {"الفلبين", TERRITORY_PHL, 0x00000002},
+        {"القارة القطبية الجنوبية", TERRITORY_ATA, 0x00000002},
+        {"الكاميرون", TERRITORY_CMR, 0x00000002},
+        {"الكرسي الرسولي", TERRITORY_VAT, 0x00000002},
+        {"الكويت", TERRITORY_KWT, 0x00000002},
+        {"المانيا", TERRITORY_DEU, 0x00000002},
+        {"المجر", TERRITORY_HUN, 0x00000002},
+        {"المغرب", TERRITORY_MAR, 0x00000002},
+#endif
+        {"المغرب‎‎", TERRITORY_MAR, 0x08000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AR)
+        {"المقاطعة الاتحادية", TERRITORY_MX_DIF, 0x00000002},
+        {"المقاطعة الشمالية", TERRITORY_AU_NT, 0x00000002},
+        {"المكسيك", TERRITORY_MEX, 0x00000002},
+        {"المكسيك جديدة", TERRITORY_US_NM, 0x00000002},
+#endif
+        {"المملكة العربية السعودية", TERRITORY_SAU, 0x08000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AR)
+        {"المملكة المتحدة", TERRITORY_GBR, 0x00000002},
+        {"النرويج", TERRITORY_NOR, 0x00000002},
+        {"النمسا", TERRITORY_AUT, 0x00000002},
+        {"النيجر", TERRITORY_NER, 0x00000002},
+        {"الهند", TERRITORY_IND, 0x00000002},
+        {"الهيدلج من نبلاء الاسبان", TERRITORY_MX_HID, 0x00000002},
+        {"الولايات المتحدة الامريكية", TERRITORY_USA, 0x00000002},
+        {"اليابان", TERRITORY_JPN, 0x00000002},
+        {"اليمن", TERRITORY_YEM, 0x00000002},
+#endif
+        {"اليمن‎‎", TERRITORY_YEM, 0x08000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AR)
+        {"الينوي", TERRITORY_US_IL, 0x00000002},
+        {"اليونان", TERRITORY_GRC, 0x00000002},
+        {"امابا", TERRITORY_BR_AP, 0x00000002},
+        {"امريكا", TERRITORY_USA, 0x00000002},
+        {"امور اوبلاست", TERRITORY_RU_AMU, 0x00000002},
+        {"انتيغوا وباربودا", TERRITORY_ATG, 0x00000002},
+        {"اندامان ونيكوبار", TERRITORY_IN_AN, 0x00000002},
+        {"اندورا", TERRITORY_AND, 0x00000002},
+        {"اندونيسيا", TERRITORY_IDN, 0x00000002},
+        {"انديانا", TERRITORY_US_IN, 0x00000002},
+        {"انغولا", TERRITORY_AGO, 0x00000002},
+        {"انغويلا", TERRITORY_AIA, 0x00000002},
+        {"انهوى", TERRITORY_CN_AH, 0x00000002},
+        {"اواكساكا", TERRITORY_MX_OAX, 0x00000002},
+        {"اوتارانتشال", TERRITORY_IN_UT, 0x00000002},
+        {"اوديشا", TERRITORY_IN_OR, 0x00000002},
+        {"اوريسا", TERRITORY_IN_OR, 0x00000002},
+        {"اورينبورغ اوبلاست", TERRITORY_RU_ORE, 0x00000002},
+        {"اوريول اوبلاست", TERRITORY_RU_ORL, 0x00000002},
+        {"اوزبكستان", TERRITORY_UZB, 0x00000002},
+        {"اوغندا", TERRITORY_UGA, 0x00000002},
+        {"اوكرانيا", TERRITORY_UKR, 0x00000002},
+        {"اوكروغ نينيتس الذاتية", TERRITORY_RU_NEN, 0x00000002},
+        {"اوكلاهوما", TERRITORY_US_OK, 0x00000002},
+        {"اولند", TERRITORY_ALA, 0x00000002},
+        {"اوليانوفسك اوبلاست", TERRITORY_RU_ULY, 0x00000002},
+        {"اومسك اوبلاست", TERRITORY_RU_OMS, 0x00000002},
+        {"اونتاريو", TERRITORY_CA_ON, 0x00000002},
+        {"اوهايو", TERRITORY_US_OH, 0x00000002},
+        {"ايداهو", TERRITORY_US_ID, 0x00000002},
+        {"ايران", TERRITORY_IRN, 0x00000002},
+        {"ايركوتسك اوبلاست", TERRITORY_RU_IRK, 0x00000002},
+        {"ايرلندا", TERRITORY_IRL, 0x00000002},
+        {"ايرلندا الشمالية", TERRITORY_GBR, 0x00000002},
+        {"ايسلندا", TERRITORY_ISL, 0x00000002},
+        {"ايطاليا", TERRITORY_ITA, 0x00000002},
+        {"ايفانوفو اوبلاست", TERRITORY_RU_IVA, 0x00000002},
+        {"ايوا", TERRITORY_US_IA, 0x00000002},
+#endif
+        {"ایران", TERRITORY_IRN, 0x08000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AR)
+        {"بابوا غينيا الجديدة", TERRITORY_PNG, 0x00000002},
+        {"باجا كاليفورنيا", TERRITORY_MX_BCN, 0x00000002},
+        {"باجا كاليفورنيا سور", TERRITORY_MX_BCS, 0x00000002},
+        {"بارا", TERRITORY_BR_PA, 0x00000002},
+        {"باراغواي", TERRITORY_PRY, 0x00000002},
+        {"بارانا", TERRITORY_BR_PR, 0x00000002},
+        {"بارايبا", TERRITORY_BR_PB, 0x00000002},
+        {"باربادوس", TERRITORY_BRB, 0x00000002},
+        {"باربودا", TERRITORY_ATG, 0x00000002},
+        {"باكستان", TERRITORY_PAK, 0x00000002},
+        {"بالاو", TERRITORY_PLW, 0x00000002},
+        {"بانزا اوبلاست", TERRITORY_RU_PNZ, 0x00000002},
+        {"باهاماس", TERRITORY_BHS, 0x00000002},
+        {"باهيا", TERRITORY_BR_BA, 0x00000002},
+        {"برمودا", TERRITORY_BMU, 0x00000002},
+        {"بروناي", TERRITORY_BRN, 0x00000002},
+        {"برونزيك جديد", TERRITORY_CA_NB, 0x00000002},
+#endif
+        {"بروني دارالسلام", TERRITORY_BRN, 0x08000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AR)
+        {"بريانسك اوبلاست", TERRITORY_RU_BRY, 0x00000002},
+        {"بريطانيا العظمى", TERRITORY_GBR, 0x00000002},
+        {"بريمورسكي كراي", TERRITORY_RU_PO, 0x00000002},
+        {"برينسيب", TERRITORY_STP, 0x00000002},
+        {"بسكوف اوبلاست", TERRITORY_RU_PSK, 0x00000002},
+        {"بكين", TERRITORY_CN_BJ, 0x00000002},
+        {"بلجيكا", TERRITORY_BEL, 0x00000002},
+        {"بلغاريا", TERRITORY_BGR, 0x00000002},
+        {"بليز", TERRITORY_BLZ, 0x00000002},
+        {"بنغال الغربية", TERRITORY_IN_WB, 0x00000002},
+        {"بنغلاديش", TERRITORY_BGD, 0x00000002},
+        {"بنما", TERRITORY_PAN, 0x00000002},
+        {"بنين", TERRITORY_BEN, 0x00000002},
+        {"بوتان", TERRITORY_BTN, 0x00000002},
+        {"بوتسوانا", TERRITORY_BWA, 0x00000002},
+        {"بودوتشيري", TERRITORY_IN_PY, 0x00000002},
+        {"بورتوريكو", TERRITORY_PRI, 0x00000002},
+        {"بوركينا فاسو", TERRITORY_BFA, 0x00000002},
+        {"بورما", TERRITORY_MMR, 0x00000002},
+        {"بوروندي", TERRITORY_BDI, 0x00000002},
+        {"بولندا", TERRITORY_POL, 0x00000002},
+        {"بوليفيا", TERRITORY_BOL, 0x00000002},
+        {"بولينزيا الفرنسية", TERRITORY_PYF, 0x00000002},
+        {"بويبلا", TERRITORY_MX_PUE, 0x00000002},
+        {"بياوي", TERRITORY_BR_PI, 0x00000002},
+        {"بيرم كراي", TERRITORY_RU_PM, 0x00000002},
+        {"بيرنامبوكو", TERRITORY_BR_PE, 0x00000002},
+        {"بيرو", TERRITORY_PER, 0x00000002},
+#endif
+        {"بيلارث", TERRITORY_BLR, 0x08000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AR)
+        {"بيلاروسيا", TERRITORY_BLR, 0x00000002},
+        {"بيلغورود اوبلاست", TERRITORY_RU_BE, 0x00000002},
+        {"بيهار", TERRITORY_IN_BR, 0x00000002},
+#endif
+        {"بہار", TERRITORY_IN_BR, 0x08000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AR)
+        {"تاباسكو", TERRITORY_MX_TAB, 0x00000002},
+        {"تاماوليباس", TERRITORY_MX_TAM, 0x00000002},
+        {"تامبوف اوبلاست", TERRITORY_RU_TT, 0x00000002},
+        {"تاميل نادو", TERRITORY_IN_TN, 0x00000002},
+        {"تايلاند", TERRITORY_THA, 0x00000002},
+        {"تايوان", TERRITORY_TWN, 0x00000002},
+        {"تركمانستان", TERRITORY_TKM, 0x00000002},
+        {"تركيا", TERRITORY_TUR, 0x00000002},
+        {"تريبورا", TERRITORY_IN_TR, 0x00000002},
+        {"تريستان دا كونا", TERRITORY_SHN, 0x00000002},
+        {"ترينيداد وتوباغو", TERRITORY_TTO, 0x00000002},
+        {"تسمانيا", TERRITORY_AU_TAS, 0x00000002},
+        {"تشاد", TERRITORY_TCD, 0x00000002},
+#endif
+        {"تشاد‎‎", TERRITORY_TCD, 0x08000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AR)
+        {"تشجيانغ", TERRITORY_CN_ZJ, 0x00000002},
+        {"تشهاتيسجاره", TERRITORY_IN_CT, 0x00000002},
+        {"تشوكوتكا اوكروغ", TERRITORY_RU_CHU, 0x00000002},
+        {"تشونغتشينغ", TERRITORY_CN_CQ, 0x00000002},
+        {"تشياباس", TERRITORY_MX_CHP, 0x00000002},
+        {"تشيلي", TERRITORY_CHL, 0x00000002},
+        {"تشيليابينسك اوبلاست", TERRITORY_RU_CH, 0x00000002},
+        {"تشينغهاى", TERRITORY_CN_QH, 0x00000002},
+        {"تشيهواهوا", TERRITORY_MX_CHH, 0x00000002},
+        {"تفير اوبلاست", TERRITORY_RU_TVE, 0x00000002},
+        {"تكساس", TERRITORY_US_TX, 0x00000002},
+        {"تلاكسكالا", TERRITORY_MX_TLA, 0x00000002},
+#endif
+        {"تلنگانہ", TERRITORY_IN_TG, 0x08000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AR)
+        {"تنزانيا", TERRITORY_TZA, 0x00000002},
+        {"توباغو", TERRITORY_TTO, 0x00000002},
+        {"توغو", TERRITORY_TGO, 0x00000002},
+        {"توفالو", TERRITORY_TUV, 0x00000002},
+        {"توكانتينس", TERRITORY_BR_TO, 0x00000002},
+        {"توكلو", TERRITORY_TKL, 0x00000002},
+        {"تولا اوبلاست", TERRITORY_RU_TUL, 0x00000002},
+        {"تونس", TERRITORY_TUN, 0x00000002},
+#endif
+        {"تونس‎‎", TERRITORY_TUN, 0x08000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AR)
+        {"تونغا", TERRITORY_TON, 0x00000002},
+        {"تيانجين", TERRITORY_CN_TJ, 0x00000002},
+        {"تيلانجانا", TERRITORY_IN_TG, 0x00000002},
+        {"تيمور الشرقية", TERRITORY_TLS, 0x00000002},
+        {"تينيسي", TERRITORY_US_TN, 0x00000002},
+        {"تيومين اوبلاست", TERRITORY_RU_TYU, 0x00000002},
+#endif
+        {"تۆركمنيستان", TERRITORY_TKM, 0x08000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AR)
+        {"جامايكا", TERRITORY_JAM, 0x00000002},
+        {"جامو وكشمير", TERRITORY_IN_JK, 0x00000002},
+        {"جان ماين", TERRITORY_SJM, 0x00000002},
+        {"جبل طارق", TERRITORY_GIB, 0x00000002},
+        {"جزر الاند", TERRITORY_ALA, 0x00000002},
+        {"جزر العذراء الامريكية", TERRITORY_VIR, 0x00000002},
+        {"جزر القمر", TERRITORY_COM, 0x00000002},
+#endif
+        {"جزر القمر‎‎", TERRITORY_COM, 0x08000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AR)
+        {"جزر المالديف", TERRITORY_MDV, 0x00000002},
+        {"جزر الولايات المتحدة الصغيرة النايية", TERRITORY_UMI, 0x00000002},
+        {"جزر بيتكيرن", TERRITORY_PCN, 0x00000002},
+        {"جزر توركس وكايكوس", TERRITORY_TCA, 0x00000002},
+        {"جزر سليمان", TERRITORY_SLB, 0x00000002},
+        {"جزر فارو", TERRITORY_FRO, 0x00000002},
+        {"جزر فوكلاند", TERRITORY_FLK, 0x00000002},
+        {"جزر كايمان", TERRITORY_CYM, 0x00000002},
+        {"جزر كوك", TERRITORY_COK, 0x00000002},
+        {"جزر كوكوس", TERRITORY_CCK, 0x00000002},
+        {"جزر مارشال", TERRITORY_MHL, 0x00000002},
+        {"جزر ماريانا الشمالية", TERRITORY_MNP, 0x00000002},
+        {"جزيرة الامير ادوارد", TERRITORY_CA_PE, 0x00000002},
+        {"جزيرة الكريسماس", TERRITORY_CXR, 0x00000002},
+        {"جزيرة بوفيه", TERRITORY_BVT, 0x00000002},
+        {"جزيرة رود", TERRITORY_US_RI, 0x00000002},
+        {"جزيرة كليبرتون", TERRITORY_CPT, 0x00000002},
+        {"جزيرة مان", TERRITORY_IMN, 0x00000002},
+        {"جزيرة نورفولك", TERRITORY_NFK, 0x00000002},
+        {"جزيرة هيرد وجزر ماكدونالد", TERRITORY_HMD, 0x00000002},
+        {"جمهورية اديغيا", TERRITORY_RU_AD, 0x00000002},
+        {"جمهورية افريقيا الوسطى", TERRITORY_CAF, 0x00000002},
+        {"جمهورية الادمرت", TERRITORY_RU_UD, 0x00000002},
+        {"جمهورية التاي", TERRITORY_RU_AL, 0x00000002},
+        {"جمهورية التشفاش", TERRITORY_RU_CU, 0x00000002},
+        {"جمهورية التشيك", TERRITORY_CZE, 0x00000002},
+        {"جمهورية الدومينيكان", TERRITORY_DOM, 0x00000002},
+        {"جمهورية الشيشان", TERRITORY_RU_CE, 0x00000002},
+        {"جمهورية الكونغو", TERRITORY_COG, 0x00000002},
+        {"جمهورية الكونغو الديمقراطية", TERRITORY_COD, 0x00000002},
+        {"جمهورية انغوشيا", TERRITORY_RU_IN, 0x00000002},
+        {"جمهورية ايرلندا", TERRITORY_IRL, 0x00000002},
+        {"جمهورية بشكيريا", TERRITORY_RU_BA, 0x00000002},
+        {"جمهورية بورياتيا", TERRITORY_RU_BU, 0x00000002},
+        {"جمهورية تتارستان", TERRITORY_RU_TA, 0x00000002},
+        {"جمهورية توفا", TERRITORY_RU_TY, 0x00000002},
+        {"جمهورية خاكاسيا", TERRITORY_RU_KK, 0x00000002},
+        {"جمهورية داغستان", TERRITORY_RU_DA, 0x00000002},
+        {"جمهورية ساخا", TERRITORY_RU_SA, 0x00000002},
+        {"جمهورية كاريليا", TERRITORY_RU_KR, 0x00000002},
+        {"جمهورية كالميكيا", TERRITORY_RU_KL, 0x00000002},
+        {"جمهورية كومي", TERRITORY_RU_KO, 0x00000002},
+        {"جمهورية موردوفيا", TERRITORY_RU_MO, 0x00000002},
+#endif
+        {"جموں و کشمی", TERRITORY_IN_JK, 0x08000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AR)
+        {"جنوب استراليا", TERRITORY_AU_SA, 0x00000002},
+        {"جنوب افريقيا", TERRITORY_ZAF, 0x00000002},
+#endif
+        {"جنوب السودان", TERRITORY_SSD, 0x08000002},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AR)
+        {"جنوب جزر ساندويتش", TERRITORY_SGS, 0x00000002},
+        {"جنوب داكوتا", TERRITORY_US_SD, 0x00000002},
+        {"جهارخاند", TERRITORY_IN_JH, 0x00000002},
+        {"جورجيا", TERRITORY_GEO, 0x00000002},
+        {"جورجيا", TERRITORY_US_GA, 0x00000002},
+        {"جورجيا الجنوبية وجزر ساندويتش الجنوبية", TERRITORY_SGS, 0x00000002},
+        {"جيانغسو", TERRITORY_CN_JS, 0x00000002},
+        {"جيانغشى", TERRITORY_CN_JX, 0x00000002},
+        {"جيبوتي", TERRITORY_DJI, 0x00000002},
+#endif
+        {"جيبوتي‎‎", TERRITORY_DJI, 0x08000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AR)
+        {"جيرزي", TERRITORY_JEY, 0x00000002},
+        {"جيرسي", TERRITORY_JEY, 0x00000002},
+        {"جيرفيس خليج الارض", TERRITORY_AU_JBT, 0x00000002},
+        {"جيلين", TERRITORY_CN_JL, 0x00000002},
+        {"خاباروفسك كراي", TERRITORY_RU_KHA, 0x00000002},
+        {"خاليسكو", TERRITORY_MX_JAL, 0x00000002},
+        {"خانتي المنسي", TERRITORY_RU_KM, 0x00000002},
+        {"خبى", TERRITORY_CN_HE, 0x00000002},
+        {"خنان", TERRITORY_CN_HA, 0x00000002},
+        {"دادرا وناغار هافيلي", TERRITORY_IN_DN, 0x00000002},
+        {"دامان وديو", TERRITORY_IN_DD, 0x00000002},
+        {"دلهي", TERRITORY_IN_DL, 0x00000002},
+        {"دورانجو", TERRITORY_MX_DUR, 0x00000002},
+#endif
+        {"دولة الكويت", TERRITORY_KWT, 0x08000000},
+        {"دولة فلسطين", TERRITORY_PSE, 0x08000000},
+        {"دولة ليبيا", TERRITORY_LBY, 0x08000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AR)
+        {"دولي", TERRITORY_AAA, 0x00000002},
+        {"دومينيكا", TERRITORY_DMA, 0x00000002},
+        {"ديستريتو فيديرال", TERRITORY_BR_DF, 0x00000002},
+        {"راجستان", TERRITORY_IN_RJ, 0x00000002},
+        {"رواندا", TERRITORY_RWA, 0x00000002},
+        {"رورايما", TERRITORY_BR_RR, 0x00000002},
+        {"روستوف", TERRITORY_RU_ROS, 0x00000002},
+        {"روسيا", TERRITORY_RUS, 0x00000002},
+        {"رومانيا", TERRITORY_ROU, 0x00000002},
+        {"روندونيا", TERRITORY_BR_RO, 0x00000002},
+        {"ريازان", TERRITORY_RU_RYA, 0x00000002},
+        {"ريو دي جانيرو", TERRITORY_BR_RJ, 0x00000002},
+        {"ريو غراندي دو سول", TERRITORY_BR_RS, 0x00000002},
+        {"ريو غراندي دو نورتي", TERRITORY_BR_RN, 0x00000002},
+        {"زاكاتيكاس", TERRITORY_MX_ZAC, 0x00000002},
+        {"زامبيا", TERRITORY_ZMB, 0x00000002},
+        {"زيزانغ", TERRITORY_CN_XZ, 0x00000002},
+        {"زيمبابوي", TERRITORY_ZWE, 0x00000002},
+        {"ساحل العاج", TERRITORY_CIV, 0x00000002},
+        {"ساخالين اوبلاست", TERRITORY_RU_SAK, 0x00000002},
+        {"ساراتوف اوبلاست", TERRITORY_RU_SAR, 0x00000002},
+        {"ساسكاتشوان", TERRITORY_CA_SK, 0x00000002},
+        {"ساموا", TERRITORY_WSM, 0x00000002},
+        {"ساموا الامريكية", TERRITORY_ASM, 0x00000002},
+        {"سان بارتليمي", TERRITORY_BLM, 0x00000002},
+        {"سان بطرسبورج", TERRITORY_RU_SPE, 0x00000002},
+        {"سان بيير وميكلون", TERRITORY_SPM, 0x00000002},
+        {"سان لويس بوتوسي", TERRITORY_MX_SLP, 0x00000002},
+        {"سان مارينو", TERRITORY_SMR, 0x00000002},
+        {"سانت فنسنت والجرينادين", TERRITORY_VCT, 0x00000002},
+        {"سانت كيتس ونيفيس", TERRITORY_KNA, 0x00000002},
+        {"سانت لوسيا", TERRITORY_LCA, 0x00000002},
+        {"سانت مارتن الفرنسية", TERRITORY_MAF, 0x00000002},
+        {"سانت هيلينا واسينشين وتريستان دا كونا", TERRITORY_SHN, 0x00000002},
+        {"سانتا كاتارينا", TERRITORY_BR_SC, 0x00000002},
+        {"ساو باولو", TERRITORY_BR_SP, 0x00000002},
+        {"ساو تومي وبرينسيب", TERRITORY_STP, 0x00000002},
+        {"ستافروبول كراي", TERRITORY_RU_STA, 0x00000002},
+        {"سريلانكا", TERRITORY_LKA, 0x00000002},
+        {"سفالبارد وجان ماين", TERRITORY_SJM, 0x00000002},
+        {"سفيردلوفسك اوبلاست", TERRITORY_RU_SVE, 0x00000002},
+        {"سلطنة عمان", TERRITORY_OMN, 0x00000002},
+        {"سلوفاكيا", TERRITORY_SVK, 0x00000002},
+        {"سلوفينيا", TERRITORY_SVN, 0x00000002},
+        {"سمارا اوبلاست", TERRITORY_RU_SAM, 0x00000002},
+        {"سمولينسك اوبلاست", TERRITORY_RU_SMO, 0x00000002},
+        {"سنغافورة", TERRITORY_SGP, 0x00000002},
+        {"سوازيلاند", TERRITORY_SWZ, 0x00000002},
+        {"سوريا", TERRITORY_SYR, 0x00000002},
+#endif
+        {"سوريا‎‎", TERRITORY_SYR, 0x08000000},
+        {"سورية", TERRITORY_SYR, 0x08000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AR)
+        {"سورينام", TERRITORY_SUR, 0x00000002},
+        {"سونورا", TERRITORY_MX_SON, 0x00000002},
+        {"سويسرا", TERRITORY_CHE, 0x00000002},
+        {"سيارا", TERRITORY_BR_CE, 0x00000002},
+        {"سيتشوان", TERRITORY_CN_SC, 0x00000002},
+        {"سيراليون", TERRITORY_SLE, 0x00000002},
+        {"سيرجيبي", TERRITORY_BR_SE, 0x00000002},
+        {"سيشل", TERRITORY_SYC, 0x00000002},
+        {"سيكيم", TERRITORY_IN_SK, 0x00000002},
+        {"سينالوا", TERRITORY_MX_SIN, 0x00000002},
+        {"سينت مارتن", TERRITORY_SXM, 0x00000002},
+        {"شاندونغ", TERRITORY_CN_SD, 0x00000002},
+        {"شانديغار", TERRITORY_IN_CH, 0x00000002},
+        {"شانشى", TERRITORY_CN_SX, 0x00000002},
+        {"شمال اوسيتيا-الانيا الجمهورية", TERRITORY_RU_SE, 0x00000002},
+        {"شمال داكوتا", TERRITORY_US_ND, 0x00000002},
+        {"شمال كارولينا", TERRITORY_US_NC, 0x00000002},
+        {"شنشى", TERRITORY_CN_SN, 0x00000002},
+        {"شنغهاي", TERRITORY_CN_SH, 0x00000002},
+        {"شينجيانغ الويغورية", TERRITORY_CN_XJ, 0x00000002},
+        {"صربيا", TERRITORY_SRB, 0x00000002},
+        {"طاجيكستان", TERRITORY_TJK, 0x00000002},
+#endif
+        {"عمان‎‎", TERRITORY_OMN, 0x08000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AR)
+        {"غامبيا", TERRITORY_GMB, 0x00000002},
+        {"غانا", TERRITORY_GHA, 0x00000002},
+        {"غرناطة", TERRITORY_GRD, 0x00000002},
+        {"غرينلاند", TERRITORY_GRL, 0x00000002},
+        {"غوا", TERRITORY_IN_GA, 0x00000002},
+        {"غواتيمالا", TERRITORY_GTM, 0x00000002},
+        {"غوادلوب", TERRITORY_GLP, 0x00000002},
+        {"غوام", TERRITORY_GUM, 0x00000002},
+        {"غواناخواتو", TERRITORY_MX_GUA, 0x00000002},
+        {"غوجارات", TERRITORY_IN_GJ, 0x00000002},
+        {"غوياس", TERRITORY_BR_GO, 0x00000002},
+        {"غويانا الفرنسية", TERRITORY_GUF, 0x00000002},
+        {"غيانا", TERRITORY_GUY, 0x00000002},
+        {"غيرنزي", TERRITORY_GGY, 0x00000002},
+        {"غيريرو", TERRITORY_MX_GRO, 0x00000002},
+        {"غينيا", TERRITORY_GIN, 0x00000002},
+        {"غينيا الاستوايية", TERRITORY_GNQ, 0x00000002},
+        {"غينيا بيساو", TERRITORY_GNB, 0x00000002},
+        {"فانواتو", TERRITORY_VUT, 0x00000002},
+        {"فرجينيا", TERRITORY_US_VA, 0x00000002},
+        {"فرجينيا الغربية", TERRITORY_US_WV, 0x00000002},
+        {"فرنسا", TERRITORY_FRA, 0x00000002},
+        {"فلاديمير اوبلاست", TERRITORY_RU_VLA, 0x00000002},
+        {"فلسطين", TERRITORY_PSE, 0x00000002},
+        {"فلوريدا", TERRITORY_US_FL, 0x00000002},
+        {"فنزويلا", TERRITORY_VEN, 0x00000002},
+        {"فنلندا", TERRITORY_FIN, 0x00000002},
+        {"فوتونا", TERRITORY_WLF, 0x00000002},
+        {"فوجيان", TERRITORY_CN_FJ, 0x00000002},
+        {"فورونيج اوبلاست", TERRITORY_RU_VOR, 0x00000002},
+        {"فولغوغراد اوبلاست", TERRITORY_RU_VGG, 0x00000002},
+        {"فيتنام", TERRITORY_VNM, 0x00000002},
+        {"فيجي", TERRITORY_FJI, 0x00000002},
+        {"فيراكروز", TERRITORY_MX_VER, 0x00000002},
+        {"فيرمونت", TERRITORY_US_VT, 0x00000002},
+        {"فيكتوريا", TERRITORY_AU_VIC, 0x00000002},
+        {"فيليب ايلاند", TERRITORY_NFK, 0x00000002},
+        {"قانسو", TERRITORY_CN_GS, 0x00000002},
+        {"قبردينو بلقاريا", TERRITORY_RU_KB, 0x00000002},
+        {"قبرص", TERRITORY_CYP, 0x00000002},
+        {"قطر", TERRITORY_QAT, 0x00000002},
+#endif
+        {"قطر‎‎", TERRITORY_QAT, 0x08000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AR)
+        {"قوانغدونغ", TERRITORY_CN_GD, 0x00000002},
+        {"قوانغشى لقومية تشوانغ", TERRITORY_CN_GX, 0x00000002},
+        {"قويتشو", TERRITORY_CN_GZ, 0x00000002},
+        {"قيرغيزستان", TERRITORY_KGZ, 0x00000002},
+        {"كارناتاكا", TERRITORY_IN_KA, 0x00000002},
+        {"كارولينا الجنوبية", TERRITORY_US_SC, 0x00000002},
+        {"كازاخستان", TERRITORY_KAZ, 0x00000002},
+        {"كالوغا اوبلاست", TERRITORY_RU_KLU, 0x00000002},
+        {"كاليدونيا الجديدة", TERRITORY_NCL, 0x00000002},
+        {"كاليفورنيا", TERRITORY_US_CA, 0x00000002},
+        {"كالينينغراد اوبلاست", TERRITORY_RU_KGD, 0x00000002},
+        {"كامبيتشي", TERRITORY_MX_CAM, 0x00000002},
+        {"كامتشاتكا كراي", TERRITORY_RU_KAM, 0x00000002},
+        {"كانساس", TERRITORY_US_KS, 0x00000002},
+        {"كراسنودار كراي", TERRITORY_RU_KDA, 0x00000002},
+        {"كراسنويارسك كراي", TERRITORY_RU_KYA, 0x00000002},
+        {"كراشاي-الشركس الجمهورية", TERRITORY_RU_KC, 0x00000002},
+        {"كراي عبر البايكال", TERRITORY_RU_ZAB, 0x00000002},
+        {"كرواتيا", TERRITORY_HRV, 0x00000002},
+        {"كمبوديا", TERRITORY_KHM, 0x00000002},
+        {"كنتاكي", TERRITORY_US_KY, 0x00000002},
+        {"كندا", TERRITORY_CAN, 0x00000002},
+        {"كواهويلا", TERRITORY_MX_COA, 0x00000002},
+        {"كوبا", TERRITORY_CUB, 0x00000002},
+        {"كوراساو", TERRITORY_CUW, 0x00000002},
+        {"كورسك اوبلاست", TERRITORY_RU_KRS, 0x00000002},
+        {"كورغان اوبلاست", TERRITORY_RU_KGN, 0x00000002},
+        {"كوريا الجنوبية", TERRITORY_KOR, 0x00000002},
+        {"كوريا الشمالية", TERRITORY_PRK, 0x00000002},
+        {"كوستاريكا", TERRITORY_CRI, 0x00000002},
+        {"كوستروما اوبلاست", TERRITORY_RU_KOS, 0x00000002},
+        {"كولورادو", TERRITORY_US_CO, 0x00000002},
+        {"كولومبيا", TERRITORY_COL, 0x00000002},
+        {"كولومبيا البريطانية", TERRITORY_CA_BC, 0x00000002},
+        {"كوليما", TERRITORY_MX_CL, 0x00000002},
+        {"كونيتيكت", TERRITORY_US_CT, 0x00000002},
+        {"كويريتارو", TERRITORY_MX_ROO, 0x00000002},
+        {"كوينتانا رو", TERRITORY_MX_QUE, 0x00000002},
+        {"كوينزلاند", TERRITORY_AU_QLD, 0x00000002},
+        {"كيبيك", TERRITORY_CA_QC, 0x00000002},
+        {"كيروف اوبلاست", TERRITORY_RU_KI, 0x00000002},
+        {"كيريباتي", TERRITORY_KIR, 0x00000002},
+        {"كيميروفو اوبلاست", TERRITORY_RU_KEM, 0x00000002},
+        {"كينيا", TERRITORY_KEN, 0x00000002},
+        {"لا ريونيون", TERRITORY_REU, 0x00000002},
+        {"لاتفيا", TERRITORY_LVA, 0x00000002},
+        {"لاوس", TERRITORY_LAO, 0x00000002},
+        {"لبنان", TERRITORY_LBN, 0x00000002},
+#endif
+        {"لبنان‎‎", TERRITORY_LBN, 0x08000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AR)
+        {"لجرينادين", TERRITORY_VCT, 0x00000002},
+        {"لوكسمبورغ", TERRITORY_LUX, 0x00000002},
+        {"لويزيانا", TERRITORY_US_LA, 0x00000002},
+        {"لياونينغ", TERRITORY_CN_LN, 0x00000002},
+        {"ليبيا", TERRITORY_LBY, 0x00000002},
+#endif
+        {"ليبيا‎‎", TERRITORY_LBY, 0x08000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AR)
+        {"ليبيتسك اوبلاست", TERRITORY_RU_LIP, 0x00000002},
+        {"ليبيريا", TERRITORY_LBR, 0x00000002},
+        {"ليتوانيا", TERRITORY_LTU, 0x00000002},
+        {"ليختنشتاين", TERRITORY_LIE, 0x00000002},
+        {"ليسوتو", TERRITORY_LSO, 0x00000002},
+        {"لينينغراد اوبلاست", TERRITORY_RU_LEN, 0x00000002},
+        {"ماتو غروسو", TERRITORY_BR_MT, 0x00000002},
+        {"ماتو غروسو دو سول", TERRITORY_BR_MS, 0x00000002},
+        {"ماجادان اوبلاست", TERRITORY_RU_MAG, 0x00000002},
+        {"ماديا براديش", TERRITORY_IN_MP, 0x00000002},
+        {"مارانهاو", TERRITORY_BR_MA, 0x00000002},
+        {"مارتينيك", TERRITORY_MTQ, 0x00000002},
+        {"ماري جمهورية شركة", TERRITORY_RU_ME, 0x00000002},
+        {"ماريلاند", TERRITORY_US_MD, 0x00000002},
+        {"ماساتشوستس", TERRITORY_US_MA, 0x00000002},
+        {"ماكاو", TERRITORY_MAC, 0x00000002},
+        {"مالاوي", TERRITORY_MWI, 0x00000002},
+        {"مالطا", TERRITORY_MLT, 0x00000002},
+        {"مالي", TERRITORY_MLI, 0x00000002},
+        {"ماليزيا", TERRITORY_MYS, 0x00000002},
+        {"مانيبور", TERRITORY_IN_MN, 0x00000002},
+        {"مانيتوبا", TERRITORY_CA_MB, 0x00000002},
+        {"ماهاراشترا", TERRITORY_IN_MH, 0x00000002},
+        {"مايوت", TERRITORY_MYT, 0x00000002},
+        {"مدغشقر", TERRITORY_MDG, 0x00000002},
+        {"مدينة الفاتيكان", TERRITORY_VAT, 0x00000002},
+        {"مصر", TERRITORY_EGY, 0x00000002},
+#endif
+        {"مصر‎‎", TERRITORY_EGY, 0x08000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AR)
+        {"مقاطعة كولومبيا", TERRITORY_US_DC, 0x00000002},
+        {"مقاطعة نفوفا سكوشيا", TERRITORY_CA_NS, 0x00000002},
+        {"مقدونيا", TERRITORY_MKD, 0x00000002},
+        {"منطقة تومسك", TERRITORY_RU_TOM, 0x00000002},
+        {"منطقة فولوغدا", TERRITORY_RU_VLG, 0x00000002},
+        {"منغوليا", TERRITORY_MNG, 0x00000002},
+        {"منغوليا الداخلية", TERRITORY_CN_NM, 0x00000002},
+        {"مورمانسك اوبلاست", TERRITORY_RU_MUR, 0x00000002},
+#endif
+        {"موريتانيا", TERRITORY_MRT, 0x08000002},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_AR)
+        {"موريشيوس", TERRITORY_MUS, 0x00000002},
+        {"موريلوس", TERRITORY_MX_MOR, 0x00000002},
+        {"موزمبيق", TERRITORY_MOZ, 0x00000002},
+        {"موسكو", TERRITORY_RU_MOW, 0x00000002},
+        {"موسكو اوبلاست", TERRITORY_RU_MOS, 0x00000002},
+        {"مولدافيا", TERRITORY_MDA, 0x00000002},
+        {"موناكو", TERRITORY_MCO, 0x00000002},
+        {"مونتانا", TERRITORY_US_MT, 0x00000002},
+        {"مونتسرات", TERRITORY_MSR, 0x00000002},
+        {"ميانمار", TERRITORY_MMR, 0x00000002},
+        {"ميتشواكان", TERRITORY_MX_MIC, 0x00000002},
+        {"ميزورام", TERRITORY_IN_MZ, 0x00000002},
+        {"ميسوري", TERRITORY_US_MO, 0x00000002},
+        {"ميسيسيبي", TERRITORY_US_MS, 0x00000002},
+        {"ميشيغان", TERRITORY_US_MI, 0x00000002},
+        {"ميغالايا", TERRITORY_IN_ML, 0x00000002},
+        {"ميكرونيزيا", TERRITORY_FSM, 0x00000002},
+        {"ميكلون", TERRITORY_SPM, 0x00000002},
+        {"مين", TERRITORY_US_ME, 0x00000002},
+        {"ميناس جيرايس", TERRITORY_BR_MG, 0x00000002},
+        {"مينيسوتا", TERRITORY_US_MN, 0x00000002},
+        {"ناجالاند", TERRITORY_IN_NL, 0x00000002},
+        {"ناميبيا", TERRITORY_NAM, 0x00000002},
+        {"ناورو", TERRITORY_NRU, 0x00000002},
+        {"ناياريت", TERRITORY_MX_NAY, 0x00000002},
+        {"نبراسكا", TERRITORY_US_NE, 0x00000002},
+        {"نوفغورود اوبلاست", TERRITORY_RU_NGR, 0x00000002},
+        {"نوفوسيبيرسك", TERRITORY_RU_NVS, 0x00000002},
+        {"نونافوت", TERRITORY_CA_NU, 0x00000002},
+        {"نويفو ليون", TERRITORY_MX_NLE, 0x00000002},
+        {"ني المغول", TERRITORY_CN_NM, 0x00000002},
+        {"نيبال", TERRITORY_NPL, 0x00000002},
+        {"نيجني نوفغورود اوبلاست", TERRITORY_RU_NIZ, 0x00000002},
+        {"نيجيريا", TERRITORY_NGA, 0x00000002},
+        {"نيفادا", TERRITORY_US_NV, 0x00000002},
+        {"نيكاراغوا", TERRITORY_NIC, 0x00000002},
+        {"نينغشيا هوى", TERRITORY_CN_NX, 0x00000002},
+        {"نيو جيرسي", TERRITORY_US_NJ, 0x00000002},
+        {"نيو ساوث ويلز", TERRITORY_AU_NSW, 0x00000002},
+        {"نيو هامبشاير", TERRITORY_US_NH, 0x00000002},
+        {"نيوزيلندا", TERRITORY_NZL, 0x00000002},
+        {"نيوفاوندلاند", TERRITORY_CA_NL, 0x00000002},
+        {"نيويورك", TERRITORY_US_NY, 0x00000002},
+        {"نييوي", TERRITORY_NIU, 0x00000002},
+        {"هاريانا", TERRITORY_IN_HR, 0x00000002},
+        {"هاواي", TERRITORY_US_HI, 0x00000002},
+        {"هايتي", TERRITORY_HTI, 0x00000002},
+        {"هاينان", TERRITORY_CN_HI, 0x00000002},
+        {"هندوراس", TERRITORY_HND, 0x00000002},
+        {"هوبى", TERRITORY_CN_HB, 0x00000002},
+        {"هولندا", TERRITORY_NLD, 0x00000002},
+        {"هونان", TERRITORY_CN_HN, 0x00000002},
+        {"هونغ كونغ", TERRITORY_HKG, 0x00000002},
+        {"هيلونغجيانغ", TERRITORY_CN_HL, 0x00000002},
+        {"هيماشال براديش", TERRITORY_IN_HP, 0x00000002},
+        {"واشنطن", TERRITORY_US_WA, 0x00000002},
+        {"وايومنغ", TERRITORY_US_WY, 0x00000002},
+        {"ولايات ميكرونيسيا المتحدة", TERRITORY_FSM, 0x00000002},
+        {"ولاية اندرا براديش", TERRITORY_IN_AP, 0x00000002},
+        {"ولاية اوتار براديش", TERRITORY_IN_UP, 0x00000002},
+        {"ولاية اوريغون", TERRITORY_US_OR, 0x00000002},
+        {"ولاية بنسلفانيا", TERRITORY_US_PA, 0x00000002},
+        {"ولاية ديلاوير", TERRITORY_US_DE, 0x00000002},
+        {"ولاية كيرالا", TERRITORY_IN_KL, 0x00000002},
+        {"ولاية ويسكونسن", TERRITORY_US_WI, 0x00000002},
+        {"ياروسلافل اوبلاست", TERRITORY_RU_YAR, 0x00000002},
+        {"ياقوتيا الجمهورية", TERRITORY_RU_SA, 0x00000002},
+        {"يامالو نينتس", TERRITORY_RU_YAN, 0x00000002},
+        {"يوتا", TERRITORY_US_UT, 0x00000002},
+        {"يوكاتان", TERRITORY_MX_YUC, 0x00000002},
+        {"يوكون", TERRITORY_CA_YT, 0x00000002},
+        {"يونان", TERRITORY_CN_YN, 0x00000002},
+#endif
+        {"پاکستان", TERRITORY_PAK, 0x08000000},
+        {"ދިވެހިރާއްޖޭގެ ޖުމްހޫރިއްޔާ", TERRITORY_MDV, 0x08000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HI)
+        {"अंगोला", TERRITORY_AGO, 0x00001000},
+        {"अंटार्कटिका", TERRITORY_ATA, 0x00001000},
+        {"अंडोरा", TERRITORY_AND, 0x00001000},
+        {"अंतरराष्ट्रीय", TERRITORY_AAA, 0x00001000},
+        {"अक्रे", TERRITORY_BR_AC, 0x00001000},
+#endif
+        {"अण्डमान और निकोबार", TERRITORY_IN_AN, 0x08001000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HI)
+        {"अफ़ग़ानिस्तान", TERRITORY_AFG, 0x00001000},
+        {"अमापा", TERRITORY_BR_AP, 0x00001000},
+        {"अमूर ओब्लास्त", TERRITORY_RU_AMU, 0x00001000},
+        {"अमेरिका", TERRITORY_USA, 0x00001000},
+        {"अमेरिकी समोआ", TERRITORY_ASM, 0x00001000},
+#endif
+        {"अरुणाचल प्रदेश", TERRITORY_IN_AR, 0x08001000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HI)
+        {"अरूबा", TERRITORY_ABW, 0x00001000},
+        {"अर्कांसस", TERRITORY_US_AR, 0x00001000},
+        {"अर्जेंटीना", TERRITORY_ARG, 0x00001000},
+        {"अल साल्वाडोर", TERRITORY_SLV, 0x00001000},
+        {"अलगोआस", TERRITORY_BR_AL, 0x00001000},
+        {"अलबर्टा", TERRITORY_CA_AB, 0x00001000},
+        {"अलबामा", TERRITORY_US_AL, 0x00001000},
+        {"अलास्का", TERRITORY_US_AK, 0x00001000},
+        {"अल्ताई क्राय", TERRITORY_RU_ALT, 0x00001000},
+        {"अल्ताई गणराज्य", TERRITORY_RU_AL, 0x00001000},
+        {"अल्बानिया", TERRITORY_ALB, 0x00001000},
+        {"असम", TERRITORY_IN_AS, 0x00001000},
+#endif
+        {"आंध्र प्रदेश", TERRITORY_IN_AP, 0x08001000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HI)
+        {"आइल ऑफ मैन", TERRITORY_IMN, 0x00001000},
+        {"आइवरी कोस्ट", TERRITORY_CIV, 0x00001000},
+        {"आइसलैंड", TERRITORY_ISL, 0x00001000},
+        {"आग्वसकालिएंटस", TERRITORY_MX_AGU, 0x00001000},
+        {"आज़रबाइजान", TERRITORY_AZE, 0x00001000},
+        {"आयरलैंड", TERRITORY_IRL, 0x00001000},
+        {"आयोवा", TERRITORY_US_IA, 0x00001000},
+        {"आरख़ान्गेल्स्क ओब्लास्त", TERRITORY_RU_ARK, 0x00001000},
+        {"आरोहण", TERRITORY_SHN, 0x00001000},
+        {"आर्मीनिया", TERRITORY_ARM, 0x00001000},
+#endif
+        {"इंडिया", TERRITORY_IND, 0x08000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HI)
+        {"इंडियाना", TERRITORY_US_IN, 0x00001000},
+        {"इंडोनेशिया", TERRITORY_IDN, 0x00001000},
+        {"इक्वाडोर", TERRITORY_ECU, 0x00001000},
+        {"इक्वेटोरियल गिनी", TERRITORY_GNQ, 0x00001000},
+        {"इटली", TERRITORY_ITA, 0x00001000},
+        {"इडाहो", TERRITORY_US_ID, 0x00001000},
+        {"इथियोपिया", TERRITORY_ETH, 0x00001000},
+        {"इनर मंगोलिया", TERRITORY_CN_NM, 0x00001000},
+        {"इन्गुशेतिया गणराज्य", TERRITORY_RU_IN, 0x00001000},
+        {"इराक", TERRITORY_IRQ, 0x00001000},
+        {"इरिट्रिया", TERRITORY_ERI, 0x00001000},
+        {"इर्कुत्स्क oblast", TERRITORY_RU_IRK, 0x00001000},
+        {"इलिनोइस", TERRITORY_US_IL, 0x00001000},
+        {"इवानोवो ओब्लास्ट", TERRITORY_RU_IVA, 0x00001000},
+        {"इसराइल", TERRITORY_ISR, 0x00001000},
+        {"ईरान", TERRITORY_IRN, 0x00001000},
+        {"उजबेकिस्तान", TERRITORY_UZB, 0x00001000},
+        {"उड़ीसा", TERRITORY_IN_OR, 0x00001000},
+        {"उत्तर ओसेतिया-आलानिया गणराज्य", TERRITORY_RU_SE, 0x00001000},
+        {"उत्तर कोरिया", TERRITORY_PRK, 0x00001000},
+        {"उत्तर पश्चिमी क्षेत्र", TERRITORY_CA_NT, 0x00001000},
+#endif
+        {"उत्तर प्रदेश", TERRITORY_IN_UP, 0x08001000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HI)
+        {"उत्तराखंड", TERRITORY_IN_UT, 0x00001000},
+#endif
+        {"उत्तराखण्ड", TERRITORY_IN_UT, 0x08000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HI)
+        {"उत्तरी केरोलिना", TERRITORY_US_NC, 0x00001000},
+        {"उत्तरी क्षेत्र", TERRITORY_AU_NT, 0x00001000},
+        {"उत्तरी मारियाना द्वीप", TERRITORY_MNP, 0x00001000},
+        {"उदमुर्त गणराज्य", TERRITORY_RU_UD, 0x00001000},
+        {"उरुग्वे", TERRITORY_URY, 0x00001000},
+        {"एंगुइला", TERRITORY_AIA, 0x00001000},
+        {"एंटीगुआ और बारबुडा", TERRITORY_ATG, 0x00001000},
+        {"एडिगेया गणराज्य", TERRITORY_RU_AD, 0x00001000},
+        {"एन्हुई", TERRITORY_CN_AH, 0x00001000},
+        {"एमेज़ोनस", TERRITORY_BR_AM, 0x00001000},
+        {"एरिजोना", TERRITORY_US_AZ, 0x00001000},
+        {"एलजीरिया", TERRITORY_DZA, 0x00001000},
+        {"एलैंड द्वीप समूह", TERRITORY_ALA, 0x00001000},
+        {"एस्टोनिया", TERRITORY_EST, 0x00001000},
+        {"एस्पिरिटो सैंटो", TERRITORY_BR_ES, 0x00001000},
+        {"ऑरेनबर्ग ओब्लास्त", TERRITORY_RU_ORE, 0x00001000},
+        {"ऑस्ट्रिया", TERRITORY_AUT, 0x00001000},
+        {"ऑस्ट्रेलिया", TERRITORY_AUS, 0x00001000},
+        {"ऑस्ट्रेलियाई राजधानी क्षेत्र", TERRITORY_AU_ACT, 0x00001000},
+        {"ओंटारियो", TERRITORY_CA_ON, 0x00001000},
+        {"ओकलाहोमा", TERRITORY_US_OK, 0x00001000},
+        {"ओक्साका", TERRITORY_MX_OAX, 0x00001000},
+        {"ओडिशा", TERRITORY_IN_OR, 0x00001000},
+        {"ओमान", TERRITORY_OMN, 0x00001000},
+        {"ओम्स्क ओब्लास्त", TERRITORY_RU_OMS, 0x00001000},
+        {"ओरयोल ओब्लास्त", TERRITORY_RU_ORL, 0x00001000},
+        {"ओरेगन", TERRITORY_US_OR, 0x00001000},
+        {"ओहियो", TERRITORY_US_OH, 0x00001000},
+        {"कंबोडिया", TERRITORY_KHM, 0x00001000},
+        {"कजाखस्तान", TERRITORY_KAZ, 0x00001000},
+        {"कतर", TERRITORY_QAT, 0x00001000},
+        {"कनाडा", TERRITORY_CAN, 0x00001000},
+        {"कनेक्टिकट", TERRITORY_US_CT, 0x00001000},
+        {"कमचातका क्राय", TERRITORY_RU_KAM, 0x00001000},
+        {"कराचय गणराज्य", TERRITORY_RU_KC, 0x00001000},
+        {"करेलिया गणराज्य", TERRITORY_RU_KR, 0x00001000},
+#endif
+        {"कर्नाटक", TERRITORY_IN_KA, 0x08001000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HI)
+        {"कलुगा ओब्लास्त", TERRITORY_RU_KLU, 0x00001000},
+        {"कल्मिकिया गणराज्य", TERRITORY_RU_KL, 0x00001000},
+        {"कांगो किंशासा", TERRITORY_COD, 0x00001000},
+        {"कांगो ब्राज़ाविल", TERRITORY_COG, 0x00001000},
+        {"कान्सास", TERRITORY_US_KS, 0x00001000},
+        {"कामार्डिनो- बल्कार गणराज्य", TERRITORY_RU_KB, 0x00001000},
+        {"किंघाई", TERRITORY_CN_QH, 0x00001000},
+        {"किरगिजस्तान", TERRITORY_KGZ, 0x00001000},
+        {"किरिबाती", TERRITORY_KIR, 0x00001000},
+        {"कीरॉफ़ ओब्लास्त", TERRITORY_RU_KI, 0x00001000},
+        {"कीलिंग द्वीप समूह", TERRITORY_CCK, 0x00001000},
+        {"कुक आइलैंड्स", TERRITORY_COK, 0x00001000},
+        {"कुराकाओ", TERRITORY_CUW, 0x00001000},
+        {"कुर्गन ओब्लास्त", TERRITORY_RU_KGN, 0x00001000},
+        {"कुर्स्काया ओब्लास्ट", TERRITORY_RU_KRS, 0x00001000},
+        {"कुवैत", TERRITORY_KWT, 0x00001000},
+        {"केंटकी", TERRITORY_US_KY, 0x00001000},
+        {"केंद्रीय अफ्रीकन गणराज्य", TERRITORY_CAF, 0x00001000},
+        {"केन्या", TERRITORY_KEN, 0x00001000},
+        {"केप वर्दे", TERRITORY_CPV, 0x00001000},
+        {"केमरोवो ओब्लास्ट", TERRITORY_RU_KEM, 0x00001000},
+        {"केमैन टापू", TERRITORY_CYM, 0x00001000},
+#endif
+        {"केरल", TERRITORY_IN_KL, 0x08001000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HI)
+        {"कैंपेक", TERRITORY_MX_CAM, 0x00001000},
+        {"कैमरून", TERRITORY_CMR, 0x00001000},
+        {"कैलिनिनग्राद ओब्लास्ट", TERRITORY_RU_KGD, 0x00001000},
+        {"कैलिफोर्निया", TERRITORY_US_CA, 0x00001000},
+        {"कॉस्ट्रोम्सकाया ओब्लास्ट", TERRITORY_RU_KOS, 0x00001000},
+        {"कोइकोस आइलैंड्स", TERRITORY_TCA, 0x00001000},
+        {"कोकोस द्वीप", TERRITORY_CCK, 0x00001000},
+        {"कोमी गणराज्य", TERRITORY_RU_KO, 0x00001000},
+        {"कोमोरोस", TERRITORY_COM, 0x00001000},
+        {"कोलम्बिया", TERRITORY_COL, 0x00001000},
+        {"कोलीमा", TERRITORY_MX_CL, 0x00001000},
+        {"कोलोराडो", TERRITORY_US_CO, 0x00001000},
+        {"कोवाविला", TERRITORY_MX_COA, 0x00001000},
+        {"कोस्टा रिका", TERRITORY_CRI, 0x00001000},
+        {"क्यूबा", TERRITORY_CUB, 0x00001000},
+        {"क्यूबेक", TERRITORY_CA_QC, 0x00001000},
+        {"क्यूरेटारो", TERRITORY_MX_QUE, 0x00001000},
+        {"क्रास्नोदार क्राय", TERRITORY_RU_KDA, 0x00001000},
+        {"क्रास्नोयार्स्क क्राय", TERRITORY_RU_KYA, 0x00001000},
+        {"क्रिसमस द्वीप", TERRITORY_CXR, 0x00001000},
+        {"क्रोएशिया", TERRITORY_HRV, 0x00001000},
+        {"क्लिपरटन द्वीप", TERRITORY_CPT, 0x00001000},
+        {"क्विंटाना रू", TERRITORY_MX_ROO, 0x00001000},
+        {"क्वींसलैंड", TERRITORY_AU_QLD, 0x00001000},
+        {"खांटी-मानसी", TERRITORY_RU_KM, 0x00001000},
+        {"खाकासिया गणराज्य", TERRITORY_RU_KK, 0x00001000},
+        {"खाबरोवस्क क्रै", TERRITORY_RU_KHA, 0x00001000},
+        {"गांसु", TERRITORY_CN_GS, 0x00001000},
+        {"गाम्बिया", TERRITORY_GMB, 0x00001000},
+        {"गिनी", TERRITORY_GIN, 0x00001000},
+        {"गिनी - बिसाऊ", TERRITORY_GNB, 0x00001000},
+        {"गुआंग्डोंग", TERRITORY_CN_GD, 0x00001000},
+        {"गुआनाग्वाटो", TERRITORY_MX_GUA, 0x00001000},
+        {"गुआम", TERRITORY_GUM, 0x00001000},
+        {"गुइझोऊ", TERRITORY_CN_GZ, 0x00001000},
+#endif
+        {"गुजरात", TERRITORY_IN_GJ, 0x08001000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HI)
+        {"गुयाना", TERRITORY_GUY, 0x00001000},
+        {"गैबॉन", TERRITORY_GAB, 0x00001000},
+#endif
+        {"गोंय", TERRITORY_IN_GA, 0x08000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HI)
+        {"गोइयास", TERRITORY_BR_GO, 0x00001000},
+        {"गोवा", TERRITORY_IN_GA, 0x00001000},
+        {"ग्युरेरो", TERRITORY_MX_GRO, 0x00001000},
+        {"ग्रीनलैंड", TERRITORY_GRL, 0x00001000},
+        {"ग्रीस", TERRITORY_GRC, 0x00001000},
+        {"ग्रेनेजियन्स", TERRITORY_VCT, 0x00001000},
+        {"ग्रेनेडा", TERRITORY_GRD, 0x00001000},
+        {"ग्वाटेमाला", TERRITORY_GTM, 0x00001000},
+        {"ग्वाडेलोप", TERRITORY_GLP, 0x00001000},
+        {"ग्वेर्नसे", TERRITORY_GGY, 0x00001000},
+        {"घाना", TERRITORY_GHA, 0x00001000},
+#endif
+        {"चंडीगढ़", TERRITORY_IN_CH, 0x08001000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HI)
+        {"चाड", TERRITORY_TCD, 0x00001000},
+        {"चियापास", TERRITORY_MX_CHP, 0x00001000},
+        {"चिली", TERRITORY_CHL, 0x00001000},
+        {"चिहुआहुआ", TERRITORY_MX_CHH, 0x00001000},
+        {"चीन", TERRITORY_CHN, 0x00001000},
+        {"चुकोटका ऑक्रग", TERRITORY_RU_CHU, 0x00001000},
+        {"चूंगचींग", TERRITORY_CN_CQ, 0x00001000},
+        {"चूवाश गणराज्य", TERRITORY_RU_CU, 0x00001000},
+        {"चेक गणराज्य", TERRITORY_CZE, 0x00001000},
+        {"चेचन गणराज्य", TERRITORY_RU_CE, 0x00001000},
+        {"चेल्याबिंस्क ओब्लास्त", TERRITORY_RU_CH, 0x00001000},
+#endif
+        {"छत्तीसगढ़", TERRITORY_IN_CT, 0x08001000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HI)
+        {"जमैका", TERRITORY_JAM, 0x00001000},
+#endif
+        {"जम्मू और कश्मीर", TERRITORY_IN_JK, 0x08001000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HI)
+        {"जर्मनी", TERRITORY_DEU, 0x00001000},
+        {"जर्विस बे टेरिटरी", TERRITORY_AU_JBT, 0x00001000},
+        {"जर्सी", TERRITORY_JEY, 0x00001000},
+        {"जलिस्को", TERRITORY_MX_JAL, 0x00001000},
+        {"ज़बायकाल्स्की क्राय", TERRITORY_RU_ZAB, 0x00001000},
+        {"ज़र्ज़िस्क ओब्लास्त", TERRITORY_RU_NIZ, 0x00001000},
+        {"ज़ाकाटेकस", TERRITORY_MX_ZAC, 0x00001000},
+        {"ज़ुआंग स्वायत्त क्षेत्र", TERRITORY_CN_GX, 0x00001000},
+        {"जापान", TERRITORY_JPN, 0x00001000},
+        {"जाम्बिया", TERRITORY_ZMB, 0x00001000},
+        {"जिबूती", TERRITORY_DJI, 0x00001000},
+        {"जिब्राल्टर", TERRITORY_GIB, 0x00001000},
+        {"जिम्बाब्वे", TERRITORY_ZWE, 0x00001000},
+        {"जियांगसु", TERRITORY_CN_JS, 0x00001000},
+        {"जिला कोलंबिया के", TERRITORY_US_DC, 0x00001000},
+        {"जिलिन", TERRITORY_CN_JL, 0x00001000},
+        {"जैन मायेन", TERRITORY_SJM, 0x00001000},
+        {"जॉर्जिया", TERRITORY_GEO, 0x00001000},
+        {"जॉर्जिया", TERRITORY_US_GA, 0x00001000},
+        {"जॉर्डन", TERRITORY_JOR, 0x00001000},
+        {"झारखंड", TERRITORY_IN_JH, 0x00001000},
+#endif
+        {"झारखण्ड", TERRITORY_IN_JH, 0x08000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HI)
+        {"झिंजियांग उईघुर", TERRITORY_CN_XJ, 0x00001000},
+        {"झेजियांग", TERRITORY_CN_ZJ, 0x00001000},
+        {"टबैस्को", TERRITORY_MX_TAB, 0x00001000},
+        {"टर्की", TERRITORY_TUR, 0x00001000},
+        {"टेक्सास", TERRITORY_US_TX, 0x00001000},
+        {"टेनेसी", TERRITORY_US_TN, 0x00001000},
+        {"टॉम्स्क ओब्लास्त", TERRITORY_RU_TOM, 0x00001000},
+        {"टोंगा", TERRITORY_TON, 0x00001000},
+        {"टोकिण्टिन्स", TERRITORY_BR_TO, 0x00001000},
+        {"टोकेलाऊ", TERRITORY_TKL, 0x00001000},
+        {"टोगो", TERRITORY_TGO, 0x00001000},
+        {"टोबैगो", TERRITORY_TTO, 0x00001000},
+        {"ट्यूनीशिया", TERRITORY_TUN, 0x00001000},
+        {"डिस्ट्रिटो फ़ेडरल", TERRITORY_MX_DIF, 0x00001000},
+        {"डिस्ट्रिटो फेडरल", TERRITORY_BR_DF, 0x00001000},
+        {"डेनमार्क", TERRITORY_DNK, 0x00001000},
+        {"डेलावेयर", TERRITORY_US_DE, 0x00001000},
+        {"डोमिनिकन गणराज्य", TERRITORY_DOM, 0x00001000},
+        {"डोमिनिका", TERRITORY_DMA, 0x00001000},
+        {"तंजानिया", TERRITORY_TZA, 0x00001000},
+#endif
+        {"तमिलनाडु", TERRITORY_IN_TN, 0x08001000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HI)
+        {"तस्मानिया", TERRITORY_AU_TAS, 0x00001000},
+        {"तांबोव ओब्लास्त", TERRITORY_RU_TT, 0x00001000},
+        {"ताइवान", TERRITORY_TWN, 0x00001000},
+        {"ताजिकिस्तान", TERRITORY_TJK, 0x00001000},
+        {"तातारस्तान गणराज्य", TERRITORY_RU_TA, 0x00001000},
+        {"तामाउलिपास", TERRITORY_MX_TAM, 0x00001000},
+        {"तिब्बत", TERRITORY_CN_XZ, 0x00001000},
+        {"तियानजिन", TERRITORY_CN_TJ, 0x00001000},
+        {"तुर्कमेनिस्तान", TERRITORY_TKM, 0x00001000},
+        {"तुर्क्स ऐंड कैकोज़ आइलैंड्स", TERRITORY_TCA, 0x00001000},
+        {"तुला ओब्लास्त", TERRITORY_RU_TUL, 0x00001000},
+        {"तुवा गणराज्य", TERRITORY_RU_TY, 0x00001000},
+        {"तुवालु", TERRITORY_TUV, 0x00001000},
+#endif
+        {"तेलंगाना", TERRITORY_IN_TG, 0x08001000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HI)
+        {"त्रिनिदाद एंड टोबेगो", TERRITORY_TTO, 0x00001000},
+        {"त्रिपुरा", TERRITORY_IN_TR, 0x00001000},
+        {"त्लाक्सकाला", TERRITORY_MX_TLA, 0x00001000},
+        {"त्वेर्स्काया ओब्लास्त", TERRITORY_RU_TVE, 0x00001000},
+        {"थाईलैंड", TERRITORY_THA, 0x00001000},
+        {"दक्षिण अफ्रीका", TERRITORY_ZAF, 0x00001000},
+        {"दक्षिण ऑस्ट्रेलिया", TERRITORY_AU_SA, 0x00001000},
+        {"दक्षिण कैरोलिना", TERRITORY_US_SC, 0x00001000},
+        {"दक्षिण कोरिया", TERRITORY_KOR, 0x00001000},
+        {"दक्षिण जॉर्जिया और साउथ सैंडविच आइलैंड्स", TERRITORY_SGS, 0x00001000},
+        {"दक्षिण डकोटा", TERRITORY_US_SD, 0x00001000},
+        {"दक्षिण सूडान", TERRITORY_SSD, 0x00001000},
+#endif
+        {"दमण आणि दीव", TERRITORY_IN_DD, 0x08000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HI)
+        {"दमन और दीव", TERRITORY_IN_DD, 0x00001000},
+        {"दागिस्तान गणराज्य", TERRITORY_RU_DA, 0x00001000},
+#endif
+        {"दादरा और नगर हवेली", TERRITORY_IN_DN, 0x08001000},
+        {"दिल्ली", TERRITORY_IN_DL, 0x08001000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HI)
+        {"दुरंगो", TERRITORY_MX_DUR, 0x00001000},
+        {"नई ब्रंसविक", TERRITORY_CA_NB, 0x00001000},
+#endif
+        {"नगालैंड", TERRITORY_IN_NL, 0x08000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HI)
+        {"नाइजर", TERRITORY_NER, 0x00001000},
+        {"नाइजीरिया", TERRITORY_NGA, 0x00001000},
+        {"नाउरू", TERRITORY_NRU, 0x00001000},
+        {"नागालैंड", TERRITORY_IN_NL, 0x00001000},
+        {"नामीबिया", TERRITORY_NAM, 0x00001000},
+        {"नायारीट", TERRITORY_MX_NAY, 0x00001000},
+        {"निंगसिया हुई", TERRITORY_CN_NX, 0x00001000},
+        {"निकारागुआ", TERRITORY_NIC, 0x00001000},
+        {"नीदरलैंड", TERRITORY_NLD, 0x00001000},
+        {"नीयू", TERRITORY_NIU, 0x00001000},
+        {"नुएवो लियोन", TERRITORY_MX_NLE, 0x00001000},
+        {"नुनावुत", TERRITORY_CA_NU, 0x00001000},
+        {"नेने स्वायत्त ऑक्रग", TERRITORY_RU_NEN, 0x00001000},
+#endif
+        {"नेपाल", TERRITORY_NPL, 0x08001000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HI)
+        {"नेब्रास्का", TERRITORY_US_NE, 0x00001000},
+        {"नेवादा", TERRITORY_US_NV, 0x00001000},
+        {"नेविस", TERRITORY_KNA, 0x00001000},
+        {"नॉर्थ डकोटा", TERRITORY_US_ND, 0x00001000},
+        {"नॉर्वे", TERRITORY_NOR, 0x00001000},
+        {"नोरफोक द्वीप", TERRITORY_NFK, 0x00001000},
+        {"नोरफोक द्वीप और फिलिप द्वीप", TERRITORY_NFK, 0x00001000},
+        {"नोवगोरोदस्काया ओब्लास्त", TERRITORY_RU_NGR, 0x00001000},
+        {"नोवा स्कोटिया", TERRITORY_CA_NS, 0x00001000},
+        {"नोवोसिबिर्स्क ओब्लास्त", TERRITORY_RU_NVS, 0x00001000},
+        {"न्यू कैलेडोनिया", TERRITORY_NCL, 0x00001000},
+        {"न्यू जर्सी", TERRITORY_US_NJ, 0x00001000},
+        {"न्यू मेक्सिको", TERRITORY_US_NM, 0x00001000},
+        {"न्यू साउथ वेल्स", TERRITORY_AU_NSW, 0x00001000},
+        {"न्यू हैम्पशायर", TERRITORY_US_NH, 0x00001000},
+        {"न्यूजीलैंड", TERRITORY_NZL, 0x00001000},
+        {"न्यूफ़ाउन्डलंड", TERRITORY_CA_NL, 0x00001000},
+        {"न्यूयॉर्क", TERRITORY_US_NY, 0x00001000},
+#endif
+        {"पंजाब", TERRITORY_IN_PB, 0x08001000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HI)
+        {"पनामा", TERRITORY_PAN, 0x00001000},
+        {"परनमबुको", TERRITORY_BR_PE, 0x00001000},
+        {"पर्टो रीको", TERRITORY_PRI, 0x00001000},
+        {"पलाऊ", TERRITORY_PLW, 0x00001000},
+        {"पवित्र देखें", TERRITORY_VAT, 0x00001000},
+        {"पश्चिम बंगाल", TERRITORY_IN_WB, 0x00001000},
+        {"पश्चिम वर्जीनिया", TERRITORY_US_WV, 0x00001000},
+        {"पश्चिमी ऑस्ट्रेलिया", TERRITORY_AU_WA, 0x00001000},
+        {"पश्चिमी सहारा", TERRITORY_ESH, 0x00001000},
+        {"पाकिस्तान", TERRITORY_PAK, 0x00001000},
+        {"पापुआ न्यू गिनी", TERRITORY_PNG, 0x00001000},
+        {"पाराईबा", TERRITORY_BR_PB, 0x00001000},
+        {"पाराना", TERRITORY_BR_PR, 0x00001000},
+        {"पिटकेर्न द्वीप समूह", TERRITORY_PCN, 0x00001000},
+        {"पियाऊ", TERRITORY_BR_PI, 0x00001000},
+#endif
+        {"पुडुचेरी", TERRITORY_IN_PY, 0x08001000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HI)
+        {"पुर्तगाल", TERRITORY_PRT, 0x00001000},
+        {"पूर्वी तिमोर", TERRITORY_TLS, 0x00001000},
+        {"पृथ्वी", TERRITORY_AAA, 0x00001000},
+        {"पेंज़ा ओब्लास्त", TERRITORY_RU_PNZ, 0x00001000},
+        {"पेंसिल्वेनिया", TERRITORY_US_PA, 0x00001000},
+        {"पेरू", TERRITORY_PER, 0x00001000},
+        {"पेर्म क्राय", TERRITORY_RU_PM, 0x00001000},
+        {"पैरा", TERRITORY_BR_PA, 0x00001000},
+        {"पैराग्वे", TERRITORY_PRY, 0x00001000},
+        {"पोलैंड", TERRITORY_POL, 0x00001000},
+        {"प्यूब्ला", TERRITORY_MX_PUE, 0x00001000},
+        {"प्रिंस एडवर्ड द्वीप", TERRITORY_CA_PE, 0x00001000},
+        {"प्रिमोर्स्की क्रै", TERRITORY_RU_PO, 0x00001000},
+        {"प्सकोव ओब्लास्त", TERRITORY_RU_PSK, 0x00001000},
+#endif
+        {"फ़िजी", TERRITORY_FJI, 0x08001000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HI)
+        {"फ़िलिस्तीन राष्ट्र", TERRITORY_PSE, 0x00001000},
+        {"फ़ुज़ियान", TERRITORY_CN_FJ, 0x00001000},
+        {"फ़ैरो आइलैंड्स", TERRITORY_FRO, 0x00001000},
+        {"फ़ॉकलैंड द्वीप समूह", TERRITORY_FLK, 0x00001000},
+        {"फ़्यूचूना", TERRITORY_WLF, 0x00001000},
+        {"फ़्रांस", TERRITORY_FRA, 0x00001000},
+        {"फिजी द्वीप समूह", TERRITORY_FJI, 0x00001000},
+        {"फिनलैंड", TERRITORY_FIN, 0x00001000},
+        {"फिलिप द्वीप", TERRITORY_NFK, 0x00001000},
+        {"फिलीपींस", TERRITORY_PHL, 0x00001000},
+        {"फ्रेंच गयाना", TERRITORY_GUF, 0x00001000},
+        {"फ्रेंच पोलिनेशिया", TERRITORY_PYF, 0x00001000},
+        {"फ्रेंच सदर्न एंड अंटार्कटिक लैंड्स", TERRITORY_ATF, 0x00001000},
+        {"फ्लोरिडा", TERRITORY_US_FL, 0x00001000},
+        {"बरमूडा", TERRITORY_BMU, 0x00001000},
+        {"बर्मा", TERRITORY_MMR, 0x00001000},
+        {"बश्कोर्तोस्तान गणराज्य", TERRITORY_RU_BA, 0x00001000},
+        {"बहरीन", TERRITORY_BHR, 0x00001000},
+        {"बहामा", TERRITORY_BHS, 0x00001000},
+        {"बांग्लादेश", TERRITORY_BGD, 0x00001000},
+        {"बाजा कैलिफोर्निया", TERRITORY_MX_BCN, 0x00001000},
+        {"बाजा कैलिफोर्निया सुर", TERRITORY_MX_BCS, 0x00001000},
+        {"बारबाडोस", TERRITORY_BRB, 0x00001000},
+        {"बारबुडा", TERRITORY_ATG, 0x00001000},
+        {"बाहिया", TERRITORY_BR_BA, 0x00001000},
+#endif
+        {"बिहार", TERRITORY_IN_BR, 0x08001000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HI)
+        {"बीजिंग", TERRITORY_CN_BJ, 0x00001000},
+        {"बुर्किना फासो", TERRITORY_BFA, 0x00001000},
+        {"बुर्यातिया गणराज्य", TERRITORY_RU_BU, 0x00001000},
+        {"बुल्गारिया", TERRITORY_BGR, 0x00001000},
+        {"बुवेत आइलैंड", TERRITORY_BVT, 0x00001000},
+        {"बुस्र्न्दी", TERRITORY_BDI, 0x00001000},
+        {"बेनिन", TERRITORY_BEN, 0x00001000},
+        {"बेलीज", TERRITORY_BLZ, 0x00001000},
+        {"बेलोरूस", TERRITORY_BLR, 0x00001000},
+        {"बेल्गोरोद ओब्लास्त", TERRITORY_RU_BE, 0x00001000},
+        {"बेल्जियम", TERRITORY_BEL, 0x00001000},
+        {"बोत्सवाना", TERRITORY_BWA, 0x00001000},
+        {"बोलीविया", TERRITORY_BOL, 0x00001000},
+        {"बोस्निया और हर्जेगोविना", TERRITORY_BIH, 0x00001000},
+        {"ब्रांस्क ओब्लास्त", TERRITORY_RU_BRY, 0x00001000},
+        {"ब्राज़िल", TERRITORY_BRA, 0x00001000},
+        {"ब्रिटिश कोलंबिया", TERRITORY_CA_BC, 0x00001000},
+        {"ब्रिटिश वर्जिन आइलैंड्स", TERRITORY_VGB, 0x00001000},
+        {"ब्रिटिश हिंद महासागरीय क्षेत्र", TERRITORY_IOT, 0x00001000},
+        {"ब्रुनेई", TERRITORY_BRN, 0x00001000},
+        {"भारत", TERRITORY_IND, 0x00001000},
+        {"भीतरी मंगोलिया", TERRITORY_CN_NM, 0x00001000},
+        {"भूटान", TERRITORY_BTN, 0x00001000},
+        {"मंगोलिया", TERRITORY_MNG, 0x00001000},
+        {"मकाओ", TERRITORY_MAC, 0x00001000},
+        {"मणिपुर", TERRITORY_IN_MN, 0x00001000},
+#endif
+        {"मध्य प्रदेश", TERRITORY_IN_MP, 0x08001000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HI)
+        {"मरमंस्क ओब्लास्त", TERRITORY_RU_MUR, 0x00001000},
+        {"मलावी", TERRITORY_MWI, 0x00001000},
+        {"मलेशिया", TERRITORY_MYS, 0x00001000},
+#endif
+        {"महाराष्ट्र", TERRITORY_IN_MH, 0x08001000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HI)
+        {"माइक्रोनेशिया", TERRITORY_FSM, 0x00001000},
+        {"मागादान ओब्लास्त", TERRITORY_RU_MAG, 0x00001000},
+        {"माटो ग्रोसो", TERRITORY_BR_MT, 0x00001000},
+        {"माटो ग्रोसो डो सुल", TERRITORY_BR_MS, 0x00001000},
+        {"मारी एल गणराज्य", TERRITORY_RU_ME, 0x00001000},
+        {"मारेन्हो", TERRITORY_BR_MA, 0x00001000},
+        {"मार्टीनिक", TERRITORY_MTQ, 0x00001000},
+        {"मार्शल द्वीप", TERRITORY_MHL, 0x00001000},
+        {"मालदीव", TERRITORY_MDV, 0x00001000},
+        {"माली", TERRITORY_MLI, 0x00001000},
+        {"माल्टा", TERRITORY_MLT, 0x00001000},
+        {"मास्को", TERRITORY_RU_MOW, 0x00001000},
+        {"मास्को ओब्लास्त", TERRITORY_RU_AST, 0x00001000},
+        {"मास्को ओब्लास्त", TERRITORY_RU_MOS, 0x00001000},
+        {"मास्को ओब्लास्त", TERRITORY_RU_TYU, 0x00001000},
+        {"मास्को में ओब्लास्त", TERRITORY_RU_ULY, 0x00001000},
+        {"मिकेलॉन", TERRITORY_SPM, 0x00001000},
+        {"मिचोआकेन", TERRITORY_MX_MIC, 0x00001000},
+#endif
+        {"मिजोरम", TERRITORY_IN_MZ, 0x08001000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HI)
+        {"मिना गेरियास", TERRITORY_BR_MG, 0x00001000},
+        {"मिनेसोटा", TERRITORY_US_MN, 0x00001000},
+        {"मिशिगन", TERRITORY_US_MI, 0x00001000},
+        {"मिसिसिपी", TERRITORY_US_MS, 0x00001000},
+        {"मिसौरी", TERRITORY_US_MO, 0x00001000},
+        {"मिस्र", TERRITORY_EGY, 0x00001000},
+        {"मेक्सिको", TERRITORY_MEX, 0x00001000},
+        {"मेक्सिको राज्य", TERRITORY_MX_MX, 0x00001000},
+#endif
+        {"मेघालय", TERRITORY_IN_ML, 0x08001000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HI)
+        {"मेडागास्कर", TERRITORY_MDG, 0x00001000},
+        {"मेन", TERRITORY_US_ME, 0x00001000},
+        {"मैकडोनाल्ड आइलैंड्स", TERRITORY_HMD, 0x00001000},
+        {"मैनिटोबा", TERRITORY_CA_MB, 0x00001000},
+        {"मैयट", TERRITORY_MYT, 0x00001000},
+        {"मैरीलैंड", TERRITORY_US_MD, 0x00001000},
+        {"मैसाचुसेट्स", TERRITORY_US_MA, 0x00001000},
+        {"मैसिडोनिया", TERRITORY_MKD, 0x00001000},
+        {"मॉन्ट्सेराट", TERRITORY_MSR, 0x00001000},
+        {"मॉरिटानिया", TERRITORY_MRT, 0x00001000},
+        {"मॉरीशस", TERRITORY_MUS, 0x00001000},
+        {"मोंटेनेग्रो", TERRITORY_MNE, 0x00001000},
+        {"मोंताना", TERRITORY_US_MT, 0x00001000},
+        {"मोजाम्बिक", TERRITORY_MOZ, 0x00001000},
+        {"मोनाको", TERRITORY_MCO, 0x00001000},
+        {"मोरक्को", TERRITORY_MAR, 0x00001000},
+        {"मोरेलोस", TERRITORY_MX_MOR, 0x00001000},
+        {"मोर्दोविया गणराज्य", TERRITORY_RU_MO, 0x00001000},
+        {"मोल्दोवा", TERRITORY_MDA, 0x00001000},
+        {"म्यांमार", TERRITORY_MMR, 0x00001000},
+        {"यमन", TERRITORY_YEM, 0x00001000},
+        {"यरोस्लाव ओब्लास्त", TERRITORY_RU_YAR, 0x00001000},
+        {"यहूदी स्वायत्त ओब्लास्ट", TERRITORY_RU_YEV, 0x00001000},
+        {"यांग्शी", TERRITORY_CN_JX, 0x00001000},
+        {"याकूतिया गणराज्य", TERRITORY_RU_SA, 0x00001000},
+        {"यामालो", TERRITORY_RU_YAN, 0x00001000},
+        {"युकाटन", TERRITORY_MX_YUC, 0x00001000},
+        {"युकोन", TERRITORY_CA_YT, 0x00001000},
+        {"युगांडा", TERRITORY_UGA, 0x00001000},
+        {"युन्नान", TERRITORY_CN_YN, 0x00001000},
+        {"यूएस माइनर आउटलाइंग द्वीपसमूह", TERRITORY_UMI, 0x00001000},
+        {"यूक्रेन", TERRITORY_UKR, 0x00001000},
+        {"यूटा", TERRITORY_US_UT, 0x00001000},
+        {"यूनाइटेड किंगडम", TERRITORY_GBR, 0x00001000},
+#endif
+        {"राजस्थान", TERRITORY_IN_RJ, 0x08001000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HI)
+        {"रायाज़ान्स्काया ओब्लास्त", TERRITORY_RU_RYA, 0x00001000},
+        {"रियो ग्रांडे डो नॉर्ट", TERRITORY_BR_RN, 0x00001000},
+        {"रियो ग्रांडे डो सुल", TERRITORY_BR_RS, 0x00001000},
+        {"रियो डी जनेरियो", TERRITORY_BR_RJ, 0x00001000},
+        {"रीयूनियन", TERRITORY_REU, 0x00001000},
+        {"रूआण्डा", TERRITORY_RWA, 0x00001000},
+        {"रूस", TERRITORY_RUS, 0x00001000},
+        {"रोड आइलैंड", TERRITORY_US_RI, 0x00001000},
+        {"रोन्डोनिया", TERRITORY_BR_RO, 0x00001000},
+        {"रोमानिया", TERRITORY_ROU, 0x00001000},
+        {"रोरैमा", TERRITORY_BR_RR, 0x00001000},
+        {"रोस्तोव ओब्लास्त", TERRITORY_RU_ROS, 0x00001000},
+#endif
+        {"लक्षद्वीप", TERRITORY_IN_LD, 0x08001000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HI)
+        {"लक्समबर्ग", TERRITORY_LUX, 0x00001000},
+        {"लाइबेरिया", TERRITORY_LBR, 0x00001000},
+        {"लाओस", TERRITORY_LAO, 0x00001000},
+        {"लातविया", TERRITORY_LVA, 0x00001000},
+        {"लिओनिंग", TERRITORY_CN_LN, 0x00001000},
+        {"लिकटेंस्टीन", TERRITORY_LIE, 0x00001000},
+        {"लिथुआनिया", TERRITORY_LTU, 0x00001000},
+        {"लिपेत्स्क ओब्लास्त", TERRITORY_RU_LIP, 0x00001000},
+        {"लीबिया", TERRITORY_LBY, 0x00001000},
+        {"लुइसियाना", TERRITORY_US_LA, 0x00001000},
+        {"लेनिनग्राद ओब्लास्त", TERRITORY_RU_LEN, 0x00001000},
+        {"लेबनान", TERRITORY_LBN, 0x00001000},
+        {"लेसोथो", TERRITORY_LSO, 0x00001000},
+        {"वरमोंट", TERRITORY_US_VT, 0x00001000},
+        {"वर्जिन आइलैंड्स", TERRITORY_VIR, 0x00001000},
+        {"वर्जिन द्वीप समूह, संयुक्त राज्य अमरीका", TERRITORY_VIR, 0x00001000},
+        {"वर्जीनिया", TERRITORY_US_VA, 0x00001000},
+        {"वानुअतु", TERRITORY_VUT, 0x00001000},
+        {"वालिस और फ़्यूचूना", TERRITORY_WLF, 0x00001000},
+        {"विक्टोरिया", TERRITORY_AU_VIC, 0x00001000},
+        {"वियतनाम", TERRITORY_VNM, 0x00001000},
+        {"विस्कॉन्सिन", TERRITORY_US_WI, 0x00001000},
+        {"वेटिकन सिटी", TERRITORY_VAT, 0x00001000},
+        {"वेनेजुएला", TERRITORY_VEN, 0x00001000},
+        {"वेराक्रूज", TERRITORY_MX_VER, 0x00001000},
+        {"वॉशिंगटन", TERRITORY_US_WA, 0x00001000},
+        {"वोरोनिश ओब्लास्त", TERRITORY_RU_VOR, 0x00001000},
+        {"वोलोग्दा ओब्लास्त", TERRITORY_RU_VLG, 0x00001000},
+        {"वोल्गोग्राड ओब्लास्त", TERRITORY_RU_VGG, 0x00001000},
+        {"व्योमिंग", TERRITORY_US_WY, 0x00001000},
+        {"व्लादिमीर ओब्लास्त", TERRITORY_RU_VLA, 0x00001000},
+        {"शंघाई", TERRITORY_CN_SH, 0x00001000},
+        {"शांक्सी", TERRITORY_CN_SX, 0x00001000},
+        {"शानक्सी", TERRITORY_CN_SN, 0x00001000},
+        {"शेडोंग", TERRITORY_CN_SD, 0x00001000},
+        {"श्रीलंका", TERRITORY_LKA, 0x00001000},
+        {"संयुक्त अरब अमीरात", TERRITORY_ARE, 0x00001000},
+        {"सऊदी अरब", TERRITORY_SAU, 0x00001000},
+        {"सखालिन ओब्लास्त", TERRITORY_RU_SAK, 0x00001000},
+        {"सबा", TERRITORY_BES, 0x00001000},
+        {"समारा ओब्लास्त", TERRITORY_RU_SAM, 0x00001000},
+        {"समोआ", TERRITORY_WSM, 0x00001000},
+        {"समोआ, अमेरिकी", TERRITORY_ASM, 0x00001000},
+        {"सर्जिप", TERRITORY_BR_SE, 0x00001000},
+        {"सर्बिया", TERRITORY_SRB, 0x00001000},
+        {"सस्केचेवान", TERRITORY_CA_SK, 0x00001000},
+        {"सांता कैटरीना", TERRITORY_BR_SC, 0x00001000},
+        {"साइप्रस", TERRITORY_CYP, 0x00001000},
+        {"साउथ सैंडविच आइलैंड्स", TERRITORY_SGS, 0x00001000},
+        {"साओ टोम और प्रिंसिपे", TERRITORY_STP, 0x00001000},
+        {"साओ पाउलो", TERRITORY_BR_SP, 0x00001000},
+        {"साखा गणराज्य", TERRITORY_RU_SA, 0x00001000},
+        {"सिंगापुर", TERRITORY_SGP, 0x00001000},
+        {"सिंट मार्टेन", TERRITORY_SXM, 0x00001000},
+        {"सिएरा लियोन", TERRITORY_SLE, 0x00001000},
+#endif
+        {"सिक्किम", TERRITORY_IN_SK, 0x08001000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HI)
+        {"सिचुआन", TERRITORY_CN_SC, 0x00001000},
+        {"सिनालोआ", TERRITORY_MX_SIN, 0x00001000},
+        {"सीरिया", TERRITORY_SYR, 0x00001000},
+        {"सूडान", TERRITORY_SDN, 0x00001000},
+        {"सूरीनाम", TERRITORY_SUR, 0x00001000},
+        {"सेंट किट्स और नेविस", TERRITORY_KNA, 0x00001000},
+        {"सेंट पियरे और मिकेलॉन", TERRITORY_SPM, 0x00001000},
+        {"सेंट पीटर्सबर्ग", TERRITORY_RU_SPE, 0x00001000},
+        {"सेंट बार्थलेमी", TERRITORY_BLM, 0x00001000},
+        {"सेंट मार्टिन", TERRITORY_MAF, 0x00001000},
+        {"सेंट लूसिया", TERRITORY_LCA, 0x00001000},
+        {"सेंट विंसेंट और ग्रेनेडाइंस", TERRITORY_VCT, 0x00001000},
+        {"सेंट हेलेना, उदगम और त्रिस्टान दा कुन्हा", TERRITORY_SHN, 0x00001000},
+        {"सेअरा", TERRITORY_BR_CE, 0x00001000},
+        {"सेनेगल", TERRITORY_SEN, 0x00001000},
+        {"सेराटोव ओब्लास्त", TERRITORY_RU_SAR, 0x00001000},
+        {"सेशेल्स", TERRITORY_SYC, 0x00001000},
+        {"सैन मैरिनो", TERRITORY_SMR, 0x00001000},
+        {"सैन लुइस पोटोसी", TERRITORY_MX_SLP, 0x00001000},
+        {"सोनोरा", TERRITORY_MX_SON, 0x00001000},
+        {"सोमालिया", TERRITORY_SOM, 0x00001000},
+        {"सोलोमन द्वीप", TERRITORY_SLB, 0x00001000},
+        {"स्टावरोपोल क्राय", TERRITORY_RU_STA, 0x00001000},
+        {"स्पेन", TERRITORY_ESP, 0x00001000},
+        {"स्मोलेंस्क ओब्लास्त", TERRITORY_RU_SMO, 0x00001000},
+        {"स्लोवाकिया", TERRITORY_SVK, 0x00001000},
+        {"स्लोवेनिया", TERRITORY_SVN, 0x00001000},
+        {"स्वर्डर्लोव्स्क ओब्लास्त", TERRITORY_RU_SVE, 0x00001000},
+        {"स्वाज़ीलैंड", TERRITORY_SWZ, 0x00001000},
+        {"स्वालबार्ड और जैन मायेन", TERRITORY_SJM, 0x00001000},
+        {"स्विटज़रलैंड", TERRITORY_CHE, 0x00001000},
+        {"स्वीडन", TERRITORY_SWE, 0x00001000},
+        {"हंगरी", TERRITORY_HUN, 0x00001000},
+#endif
+        {"हरियाणा", TERRITORY_IN_HR, 0x08001000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HI)
+        {"हर्ड आइलैंड और मैकडोनाल्ड आइलैंड्स", TERRITORY_HMD, 0x00001000},
+        {"हवाई", TERRITORY_US_HI, 0x00001000},
+        {"हांगकांग", TERRITORY_HKG, 0x00001000},
+        {"हाण्डूरस", TERRITORY_HND, 0x00001000},
+        {"हिडलगो", TERRITORY_MX_HID, 0x00001000},
+#endif
+        {"हिमाचल प्रदेश", TERRITORY_IN_HP, 0x08001000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_HI)
+        {"हुनान", TERRITORY_CN_HN, 0x00001000},
+        {"हुबेई", TERRITORY_CN_HB, 0x00001000},
+        {"हेइलोंगजियांग", TERRITORY_CN_HL, 0x00001000},
+        {"हेनान", TERRITORY_CN_HA, 0x00001000},
+        {"हेबेई", TERRITORY_CN_HE, 0x00001000},
+        {"हैती", TERRITORY_HTI, 0x00001000},
+        {"हैनान", TERRITORY_CN_HI, 0x00001000},
+#endif
+        {"অসম", TERRITORY_IN_AS, 0x08000000},
+        {"আন্দামান ও নিকোবর", TERRITORY_IN_AN, 0x08000000},
+        {"ঝাড়খণ্ড", TERRITORY_IN_JH, 0x08000000},
+        {"ত্রিপুরা", TERRITORY_IN_TR, 0x08000000},
+        {"পশ্চিমবঙ্গ", TERRITORY_IN_WB, 0x08000000},
+        {"বাংলাদেশ", TERRITORY_BGD, 0x08000000},
+        {"ভারত", TERRITORY_IND, 0x08000000},
+        {"মণিপুর", TERRITORY_IN_MN, 0x08000000},
+        {"ਚੰਡੀਗੜ੍ਹ", TERRITORY_IN_CH, 0x08000000},
+        {"ਜੰਮੂ ਅਤੇ ਕਸ਼ਮੀਰ", TERRITORY_IN_JK, 0x08000000},
+        {"ਦਿੱਲੀ '", TERRITORY_IN_DL, 0x08000000},
+        {"ਪੰਜਾਬ", TERRITORY_IN_PB, 0x08000000},
+        {"ਹਰਿਆਣਾ", TERRITORY_IN_HR, 0x08000000},
+        {"ગુજરાત", TERRITORY_IN_GJ, 0x08000000},
+        {"દમણ અને દીવ", TERRITORY_IN_DD, 0x08000000},
+        {"દાદરા અને નગર હવેલી", TERRITORY_IN_DN, 0x08000000},
+        {"ଓଡ଼ିଶା", TERRITORY_IN_OR, 0x08000000},
+        {"இலங்கை", TERRITORY_LKA, 0x08000000},
+        {"சிங்கப்பூர்", TERRITORY_SGP, 0x08000000},
+        {"தமிழ்நாடு", TERRITORY_IN_TN, 0x08000000},
+        {"ఆంధ్ర ప్రదేశ్", TERRITORY_IN_AP, 0x08000000},
+        {"తెలంగాణ", TERRITORY_IN_TG, 0x08000000},
+        {"పుదుచ్చేరి", TERRITORY_IN_PY, 0x08000000},
+        {"ಕರ್ನಾಟಕ", TERRITORY_IN_KA, 0x08000000},
+        {"കേരളം", TERRITORY_IN_KL, 0x08000000},
+        {"പുതുച്ചേരി", TERRITORY_IN_PY, 0x08000000},
+        {"ലക്ഷദ്വീപ്", TERRITORY_IN_LD, 0x08000000},
+        {"ශ්‍රී ලංකා", TERRITORY_LKA, 0x08000000},
+        {"ประเทศไทย", TERRITORY_THA, 0x08000000},
+        {"ລາວ", TERRITORY_LAO, 0x08000000},
+        {"བོད་", TERRITORY_CN_XZ, 0x08000000},
+        {"བོད་", TERRITORY_CN_XJ, 0x08000000},
+        {"འབྲུག་ཡུལ་", TERRITORY_BTN, 0x08000000},
+        {"འབྲུག་རྒྱལ་ཁབ་", TERRITORY_BTN, 0x08000000},
+        {"ပြည်ထောင်စု သမ္မတ မြန်မာနိုင်ငံတော်‌", TERRITORY_MMR, 0x08000000},
+        {"საქართველო", TERRITORY_GEO, 0x08000000},
+        {"ኢትዮጵያ", TERRITORY_ETH, 0x08000000},
+        {"ኤርትሪያ", TERRITORY_ERI, 0x08000000},
+        {"កម្ពុជា", TERRITORY_KHM, 0x08000000},
+        {"ᠮᠤᠩᠭᠤᠯ ᠤᠯᠤᠰ", TERRITORY_MNG, 0x08000000},
+        {"ⴷⵣⴰⵢⴻⵔ", TERRITORY_DZA, 0x08000000},
+        {"ⵍⵎⴰⵖⵔⵉⴱ", TERRITORY_MAR, 0x08000000},
+        {"ⵜⵓⵏⴻⵙ", TERRITORY_TUN, 0x08000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_JA)
+        {"アイオワ州", TERRITORY_US_IA, 0x00010000},
+        {"アイスランド", TERRITORY_ISL, 0x00010000},
+        {"アイダホ州", TERRITORY_US_ID, 0x00010000},
+        {"アイルランド", TERRITORY_IRL, 0x00010000},
+        {"アイルランド、北", TERRITORY_GBR, 0x00010000},
+        {"アクレ州", TERRITORY_BR_AC, 0x00010000},
+        {"アグアスカリエンテス", TERRITORY_MX_AGU, 0x00010000},
+        {"アストラハン州", TERRITORY_RU_AST, 0x00010000},
+        {"アセンション", TERRITORY_SHN, 0x00010000},
+        {"アゼルバイジャン", TERRITORY_AZE, 0x00010000},
+        {"アッサム", TERRITORY_IN_AS, 0x00010000},
+        {"アディゲ共和国共和国", TERRITORY_RU_AD, 0x00010000},
+        {"アフガニスタン", TERRITORY_AFG, 0x00010000},
+        {"アマゾナス", TERRITORY_BR_AM, 0x00010000},
+        {"アマパ", TERRITORY_BR_AP, 0x00010000},
+        {"アムール州", TERRITORY_RU_AMU, 0x00010000},
+        {"アメリカ", TERRITORY_USA, 0x00010000},
+        {"アメリカ合衆国", TERRITORY_USA, 0x00010000},
+        {"アメリカ合衆国外諸島", TERRITORY_UMI, 0x00010000},
+        {"アメリカ領サモア", TERRITORY_ASM, 0x00010000},
+        {"アラゴアス州", TERRITORY_BR_AL, 0x00010000},
+        {"アラスカ州", TERRITORY_US_DC, 0x00010000},
+        {"アラスカ州", TERRITORY_US_AK, 0x00010000},
+        {"アラバマ州", TERRITORY_US_AL, 0x00010000},
+        {"アラブ首長国連邦", TERRITORY_ARE, 0x00010000},
+        {"アリゾナ州", TERRITORY_US_AZ, 0x00010000},
+        {"アルジェリア", TERRITORY_DZA, 0x00010000},
+        {"アルゼンチン", TERRITORY_ARG, 0x00010000},
+        {"アルタイ共和国", TERRITORY_RU_AL, 0x00010000},
+        {"アルタイ地方", TERRITORY_RU_ALT, 0x00010000},
+        {"アルナチャル・パラデシュ", TERRITORY_IN_AR, 0x00010000},
+        {"アルハンゲリスク州", TERRITORY_RU_ARK, 0x00010000},
+        {"アルバ", TERRITORY_ABW, 0x00010000},
+        {"アルバニア", TERRITORY_ALB, 0x00010000},
+        {"アルバータ州", TERRITORY_CA_AB, 0x00010000},
+        {"アルメニア", TERRITORY_ARM, 0x00010000},
+        {"アングィラ", TERRITORY_AIA, 0x00010000},
+        {"アンゴラ", TERRITORY_AGO, 0x00010000},
+        {"アンダマン・ニコバル", TERRITORY_IN_AN, 0x00010000},
+        {"アンティグアバーブーダ", TERRITORY_ATG, 0x00010000},
+        {"アンドラ", TERRITORY_AND, 0x00010000},
+        {"アンドラプラデシ", TERRITORY_IN_AP, 0x00010000},
+        {"アーカンソー州", TERRITORY_US_AR, 0x00010000},
+        {"イエメン", TERRITORY_YEM, 0x00010000},
+        {"イギリス", TERRITORY_GBR, 0x00010000},
+        {"イギリス領インド洋地域", TERRITORY_IOT, 0x00010000},
+        {"イギリス領バージン諸島", TERRITORY_VGB, 0x00010000},
+        {"イスラエル", TERRITORY_ISR, 0x00010000},
+        {"イタリア", TERRITORY_ITA, 0x00010000},
+        {"イダルゴ", TERRITORY_MX_HID, 0x00010000},
+        {"イラク", TERRITORY_IRQ, 0x00010000},
+        {"イラン", TERRITORY_IRN, 0x00010000},
+        {"イリノイ州", TERRITORY_US_IL, 0x00010000},
+        {"イルクーツク州", TERRITORY_RU_IRK, 0x00010000},
+        {"イングーシ共和国", TERRITORY_RU_IN, 0x00010000},
+        {"インターナショナル", TERRITORY_AAA, 0x00010000},
+        {"インディアナ州", TERRITORY_US_IN, 0x00010000},
+        {"インド", TERRITORY_IND, 0x00010000},
+        {"インドネシア", TERRITORY_IDN, 0x00010000},
+        {"イヴァノヴォ州", TERRITORY_RU_IVA, 0x00010000},
+        {"ウィスコンシン州", TERRITORY_US_WI, 0x00010000},
+        {"ウェストバージニア州", TERRITORY_US_WV, 0x00010000},
+        {"ウォリス・フツナ", TERRITORY_WLF, 0x00010000},
+        {"ウガンダ", TERRITORY_UGA, 0x00010000},
+        {"ウクライナ", TERRITORY_UKR, 0x00010000},
+        {"ウズベキスタン", TERRITORY_UZB, 0x00010000},
+        {"ウッタラーカンド州", TERRITORY_IN_UT, 0x00010000},
+        {"ウッタルプラデシ州", TERRITORY_IN_UP, 0x00010000},
+        {"ウドムルト共和国", TERRITORY_RU_UD, 0x00010000},
+        {"ウリヤノフスク州", TERRITORY_RU_ULY, 0x00010000},
+        {"ウルグアイ", TERRITORY_URY, 0x00010000},
+        {"エクアドル", TERRITORY_ECU, 0x00010000},
+        {"エジプト", TERRITORY_EGY, 0x00010000},
+        {"エストニア", TERRITORY_EST, 0x00010000},
+        {"エスピリトサント州", TERRITORY_BR_ES, 0x00010000},
+        {"エチオピア", TERRITORY_ETH, 0x00010000},
+        {"エリトリア", TERRITORY_ERI, 0x00010000},
+        {"エルサルバドル", TERRITORY_SLV, 0x00010000},
+        {"オアハカ", TERRITORY_MX_OAX, 0x00010000},
+        {"オクラホマ州", TERRITORY_US_OK, 0x00010000},
+        {"オハイオ州", TERRITORY_US_OH, 0x00010000},
+        {"オマーン", TERRITORY_OMN, 0x00010000},
+        {"オムスク州", TERRITORY_RU_OMS, 0x00010000},
+        {"オランダ", TERRITORY_NLD, 0x00010000},
+        {"オリッサ", TERRITORY_IN_OR, 0x00010000},
+        {"オリッサ州", TERRITORY_IN_OR, 0x00010000},
+        {"オリョール州", TERRITORY_RU_ORL, 0x00010000},
+        {"オレゴン州", TERRITORY_US_OR, 0x00010000},
+        {"オレンブルク州", TERRITORY_RU_ORE, 0x00010000},
+        {"オンタリオ", TERRITORY_CA_ON, 0x00010000},
+        {"オーストラリア", TERRITORY_AUS, 0x00010000},
+        {"オーストラリア首都特別地域", TERRITORY_AU_ACT, 0x00010000},
+        {"オーストリア", TERRITORY_AUT, 0x00010000},
+        {"オーランド諸島", TERRITORY_ALA, 0x00010000},
+        {"カイコス諸島", TERRITORY_TCA, 0x00010000},
+        {"カザフスタン", TERRITORY_KAZ, 0x00010000},
+        {"カタール", TERRITORY_QAT, 0x00010000},
+        {"カナダ", TERRITORY_CAN, 0x00010000},
+        {"カバルダ・バルカル共和国", TERRITORY_RU_KB, 0x00010000},
+        {"カムチャツカ地方", TERRITORY_RU_KAM, 0x00010000},
+        {"カメルーン", TERRITORY_CMR, 0x00010000},
+        {"カラチャイ-cherkess共和国", TERRITORY_RU_KC, 0x00010000},
+        {"カリフォルニア州", TERRITORY_US_CA, 0x00010000},
+        {"カリーニングラード州", TERRITORY_RU_KGD, 0x00010000},
+        {"カルナタカ", TERRITORY_IN_KA, 0x00010000},
+        {"カルムイク共和国", TERRITORY_RU_KL, 0x00010000},
+        {"カルーガ州", TERRITORY_RU_KLU, 0x00010000},
+        {"カレリア共和国", TERRITORY_RU_KR, 0x00010000},
+        {"カンザス州", TERRITORY_US_KS, 0x00010000},
+        {"カンペチェ", TERRITORY_MX_CAM, 0x00010000},
+        {"カンボジア", TERRITORY_KHM, 0x00010000},
+        {"カーボベルデ", TERRITORY_CPV, 0x00010000},
+        {"ガイアナ", TERRITORY_GUY, 0x00010000},
+        {"ガボン", TERRITORY_GAB, 0x00010000},
+        {"ガンビア", TERRITORY_GMB, 0x00010000},
+        {"ガーナ", TERRITORY_GHA, 0x00010000},
+        {"ガーンジー島", TERRITORY_GGY, 0x00010000},
+        {"キプロス", TERRITORY_CYP, 0x00010000},
+        {"キュラソー", TERRITORY_CUW, 0x00010000},
+        {"キューバ", TERRITORY_CUB, 0x00010000},
+        {"キリバス", TERRITORY_KIR, 0x00010000},
+        {"キルギスタン", TERRITORY_KGZ, 0x00010000},
+        {"キンタナロー州", TERRITORY_MX_ROO, 0x00010000},
+        {"キーリング諸島", TERRITORY_CCK, 0x00010000},
+        {"キーロフ州", TERRITORY_RU_KI, 0x00010000},
+        {"ギニア", TERRITORY_GIN, 0x00010000},
+        {"ギニアビサウ", TERRITORY_GNB, 0x00010000},
+        {"ギリシャ", TERRITORY_GRC, 0x00010000},
+        {"クイーンズランド州", TERRITORY_AU_QLD, 0x00010000},
+        {"クウェート", TERRITORY_KWT, 0x00010000},
+        {"クック諸島", TERRITORY_COK, 0x00010000},
+        {"クラスノダール地方", TERRITORY_RU_KDA, 0x00010000},
+        {"クラスノヤルスク地方", TERRITORY_RU_KYA, 0x00010000},
+        {"クリスマス島", TERRITORY_CXR, 0x00010000},
+        {"クリッパートン島", TERRITORY_CPT, 0x00010000},
+        {"クルガン州", TERRITORY_RU_KGN, 0x00010000},
+        {"クルスク州", TERRITORY_RU_KRS, 0x00010000},
+        {"クロアチア", TERRITORY_HRV, 0x00010000},
+        {"グアテマラ", TERRITORY_GTM, 0x00010000},
+        {"グアドループ島", TERRITORY_GLP, 0x00010000},
+        {"グアナファト", TERRITORY_MX_GUA, 0x00010000},
+        {"グアム", TERRITORY_GUM, 0x00010000},
+        {"グジャラート", TERRITORY_IN_GJ, 0x00010000},
+        {"グリーンランド", TERRITORY_GRL, 0x00010000},
+        {"グレナダ", TERRITORY_GRD, 0x00010000},
+        {"グレナディーン諸島", TERRITORY_VCT, 0x00010000},
+        {"ケイマン諸島", TERRITORY_CYM, 0x00010000},
+        {"ケニア", TERRITORY_KEN, 0x00010000},
+        {"ケベック", TERRITORY_CA_QC, 0x00010000},
+        {"ケメロヴォ州", TERRITORY_RU_KEM, 0x00010000},
+        {"ケララ", TERRITORY_IN_KL, 0x00010000},
+        {"ケレタロ", TERRITORY_MX_QUE, 0x00010000},
+        {"ケンタッキー州", TERRITORY_US_KY, 0x00010000},
+        {"ゲレロ", TERRITORY_MX_GRO, 0x00010000},
+        {"コアウイラ州", TERRITORY_MX_COA, 0x00010000},
+        {"ココス諸島", TERRITORY_CCK, 0x00010000},
+        {"コスタリカ", TERRITORY_CRI, 0x00010000},
+        {"コストロマ州", TERRITORY_RU_KOS, 0x00010000},
+        {"コネティカット州", TERRITORY_US_CT, 0x00010000},
+        {"コミ共和国", TERRITORY_RU_KO, 0x00010000},
+        {"コモロ", TERRITORY_COM, 0x00010000},
+        {"コリマ", TERRITORY_MX_CL, 0x00010000},
+        {"コロラド州", TERRITORY_US_CO, 0x00010000},
+        {"コロンビア", TERRITORY_COL, 0x00010000},
+        {"コンゴ - キンシャサ", TERRITORY_COD, 0x00010000},
+        {"コンゴ - ブラザビル", TERRITORY_COG, 0x00010000},
+        {"コートジボワール", TERRITORY_CIV, 0x00010000},
+        {"ゴア", TERRITORY_IN_GA, 0x00010000},
+        {"ゴイアス州", TERRITORY_BR_GO, 0x00010000},
+        {"サウジアラビア", TERRITORY_SAU, 0x00010000},
+        {"サウスカロライナ州", TERRITORY_US_SC, 0x00010000},
+        {"サウスサンドウィッチ諸島", TERRITORY_SGS, 0x00010000},
+        {"サウスジョージア・サウスサンドウィッチ諸島", TERRITORY_SGS, 0x00010000},
+        {"サウスダコタ州", TERRITORY_US_SD, 0x00010000},
+        {"サカテカス", TERRITORY_MX_ZAC, 0x00010000},
+        {"サスカチュワン州", TERRITORY_CA_SK, 0x00010000},
+        {"サハラ", TERRITORY_ESH, 0x00010000},
+        {"サハリン州", TERRITORY_RU_SAK, 0x00010000},
+        {"サハ共和国", TERRITORY_RU_SA, 0x00010000},
+        {"サバ", TERRITORY_BES, 0x00010000},
+        {"サマラ州", TERRITORY_RU_SAM, 0x00010000},
+        {"サモア", TERRITORY_WSM, 0x00010000},
+        {"サモア、アメリカ", TERRITORY_ASM, 0x00010000},
+        {"サラトフ州", TERRITORY_RU_SAR, 0x00010000},
+        {"サンタカタリナ州", TERRITORY_BR_SC, 0x00010000},
+        {"サントメ・プリンシペ", TERRITORY_STP, 0x00010000},
+        {"サンパウロ", TERRITORY_BR_SP, 0x00010000},
+        {"サンピエール島・ミクロン島", TERRITORY_SPM, 0x00010000},
+        {"サンルイスポトシ", TERRITORY_MX_SLP, 0x00010000},
+        {"サン・バルテルミー島", TERRITORY_BLM, 0x00010000},
+        {"サン・マリノ", TERRITORY_SMR, 0x00010000},
+        {"サン・マルタン", TERRITORY_MAF, 0x00010000},
+        {"ザバイカリエ地方", TERRITORY_RU_ZAB, 0x00010000},
+        {"ザンビア", TERRITORY_ZMB, 0x00010000},
+        {"シエラレオネ", TERRITORY_SLE, 0x00010000},
+        {"シッキム", TERRITORY_IN_SK, 0x00010000},
+        {"シナロア州", TERRITORY_MX_SIN, 0x00010000},
+        {"シリア", TERRITORY_SYR, 0x00010000},
+        {"シンガポール", TERRITORY_SGP, 0x00010000},
+        {"シントマールテン島", TERRITORY_SXM, 0x00010000},
+        {"ジブチ", TERRITORY_DJI, 0x00010000},
+        {"ジブラルタル", TERRITORY_GIB, 0x00010000},
+        {"ジャマイカ", TERRITORY_JAM, 0x00010000},
+        {"ジャム・カシミール", TERRITORY_IN_JK, 0x00010000},
+        {"ジャージー", TERRITORY_JEY, 0x00010000},
+        {"ジャービス湾特別地域", TERRITORY_AU_JBT, 0x00010000},
+        {"ジャールカンド州", TERRITORY_IN_JH, 0x00010000},
+        {"ジョージア", TERRITORY_GEO, 0x00010000},
+        {"ジョージア", TERRITORY_US_GA, 0x00010000},
+        {"ジンバブエ", TERRITORY_ZWE, 0x00010000},
+        {"スイス", TERRITORY_CHE, 0x00010000},
+        {"スウェーデン", TERRITORY_SWE, 0x00010000},
+        {"スコットランド", TERRITORY_GBR, 0x00010000},
+        {"スタヴロポリ地方", TERRITORY_RU_STA, 0x00010000},
+        {"スバールバル諸島とヤンマイエン島", TERRITORY_SJM, 0x00010000},
+        {"スペイン", TERRITORY_ESP, 0x00010000},
+        {"スモレンスク州", TERRITORY_RU_SMO, 0x00010000},
+        {"スリナム", TERRITORY_SUR, 0x00010000},
+        {"スリランカ", TERRITORY_LKA, 0x00010000},
+        {"スロバキア", TERRITORY_SVK, 0x00010000},
+        {"スロベニア", TERRITORY_SVN, 0x00010000},
+        {"スワジランド", TERRITORY_SWZ, 0x00010000},
+        {"スヴェルドロフスク州", TERRITORY_RU_SVE, 0x00010000},
+        {"スーダン", TERRITORY_SDN, 0x00010000},
+        {"セアラ州", TERRITORY_BR_CE, 0x00010000},
+        {"セイシェル", TERRITORY_SYC, 0x00010000},
+        {"セネガル", TERRITORY_SEN, 0x00010000},
+        {"セルジペ州", TERRITORY_BR_SE, 0x00010000},
+        {"セルビア", TERRITORY_SRB, 0x00010000},
+        {"セントクリストファー・ネイビス", TERRITORY_KNA, 0x00010000},
+        {"セントビンセント・グレナディーン", TERRITORY_VCT, 0x00010000},
+        {"セントピーターズバーグ", TERRITORY_RU_SPE, 0x00010000},
+        {"セントヘレナ、アセンションおよびトリスタン・ダ・クーニャ", TERRITORY_SHN, 0x00010000},
+        {"セントユースタティウス", TERRITORY_BES, 0x00010000},
+        {"セントルシア", TERRITORY_LCA, 0x00010000},
+        {"ソノラ州", TERRITORY_MX_SON, 0x00010000},
+        {"ソマリア", TERRITORY_SOM, 0x00010000},
+        {"ソロモン諸島", TERRITORY_SLB, 0x00010000},
+        {"タイ", TERRITORY_THA, 0x00010000},
+        {"タジキスタン", TERRITORY_TJK, 0x00010000},
+        {"タスマニア州", TERRITORY_AU_TAS, 0x00010000},
+        {"タタルスタン共和国", TERRITORY_RU_TA, 0x00010000},
+        {"タバスコ", TERRITORY_MX_TAB, 0x00010000},
+        {"タマウリパス州", TERRITORY_MX_TAM, 0x00010000},
+        {"タミル・ナードゥ州", TERRITORY_IN_TN, 0x00010000},
+        {"タンザニア", TERRITORY_TZA, 0x00010000},
+        {"タンボフ州", TERRITORY_RU_TT, 0x00010000},
+        {"タークス・カイコス諸島", TERRITORY_TCA, 0x00010000},
+        {"ダゲスタン共和国", TERRITORY_RU_DA, 0x00010000},
+        {"ダマンディウ", TERRITORY_IN_DD, 0x00010000},
+        {"ダードラーとナガルハベリ", TERRITORY_IN_DN, 0x00010000},
+        {"チアパス州", TERRITORY_MX_CHP, 0x00010000},
+        {"チェコ共和国", TERRITORY_CZE, 0x00010000},
+        {"チェチェン共和国", TERRITORY_RU_CE, 0x00010000},
+        {"チェリャビンスク州", TERRITORY_RU_CH, 0x00010000},
+        {"チベット", TERRITORY_CN_XZ, 0x00010000},
+        {"チャッティースガル州", TERRITORY_IN_CT, 0x00010000},
+        {"チャド", TERRITORY_TCD, 0x00010000},
+        {"チャンディーガル", TERRITORY_IN_CH, 0x00010000},
+        {"チュクチ管区", TERRITORY_RU_CHU, 0x00010000},
+        {"チュニジア", TERRITORY_TUN, 0x00010000},
+        {"チュメニ州", TERRITORY_RU_TYU, 0x00010000},
+        {"チュヴァシュ共和国", TERRITORY_RU_CU, 0x00010000},
+        {"チリ", TERRITORY_CHL, 0x00010000},
+        {"チワワ", TERRITORY_MX_CHH, 0x00010000},
+        {"ツバル", TERRITORY_TUV, 0x00010000},
+        {"テキサス州", TERRITORY_US_TX, 0x00010000},
+        {"テネシー州", TERRITORY_US_TN, 0x00010000},
+        {"テランガーナ州", TERRITORY_IN_TG, 0x00010000},
+        {"デラウェア州", TERRITORY_US_DE, 0x00010000},
+        {"デリー", TERRITORY_IN_DL, 0x00010000},
+        {"デンマーク", TERRITORY_DNK, 0x00010000},
+        {"トゥヴァ共和国", TERRITORY_RU_TY, 0x00010000},
+        {"トゥーラ州", TERRITORY_RU_TUL, 0x00010000},
+        {"トカンチンス", TERRITORY_BR_TO, 0x00010000},
+        {"トケラウ諸島", TERRITORY_TKL, 0x00010000},
+        {"トバゴ", TERRITORY_TTO, 0x00010000},
+        {"トムスク州", TERRITORY_RU_TOM, 0x00010000},
+        {"トラスカラ", TERRITORY_MX_TLA, 0x00010000},
+        {"トリスタン・ダ・クーニャ", TERRITORY_SHN, 0x00010000},
+        {"トリニダード・トバゴ", TERRITORY_TTO, 0x00010000},
+        {"トリプラ", TERRITORY_IN_TR, 0x00010000},
+        {"トルクメニスタン", TERRITORY_TKM, 0x00010000},
+        {"トルコ", TERRITORY_TUR, 0x00010000},
+        {"トンガ", TERRITORY_TON, 0x00010000},
+        {"トヴェリ州", TERRITORY_RU_TVE, 0x00010000},
+        {"トーゴ", TERRITORY_TGO, 0x00010000},
+        {"ドイツ", TERRITORY_DEU, 0x00010000},
+        {"ドゥランゴ", TERRITORY_MX_DUR, 0x00010000},
+        {"ドミニカ", TERRITORY_DMA, 0x00010000},
+        {"ドミニカ共和国", TERRITORY_DOM, 0x00010000},
+        {"ナイジェリア", TERRITORY_NGA, 0x00010000},
+        {"ナウル", TERRITORY_NRU, 0x00010000},
+        {"ナガランド", TERRITORY_IN_NL, 0x00010000},
+        {"ナミビア", TERRITORY_NAM, 0x00010000},
+        {"ナヤリット", TERRITORY_MX_NAY, 0x00010000},
+        {"ニウエ", TERRITORY_NIU, 0x00010000},
+        {"ニカラグア", TERRITORY_NIC, 0x00010000},
+        {"ニジェール", TERRITORY_NER, 0x00010000},
+        {"ニジニ・ノヴゴロド州", TERRITORY_RU_NIZ, 0x00010000},
+        {"ニューカレドニア", TERRITORY_NCL, 0x00010000},
+        {"ニューサウスウェールズ州", TERRITORY_AU_NSW, 0x00010000},
+        {"ニュージャージー州", TERRITORY_US_NJ, 0x00010000},
+        {"ニュージーランド", TERRITORY_NZL, 0x00010000},
+        {"ニューハンプシャー州", TERRITORY_US_NH, 0x00010000},
+        {"ニューファンドランド島", TERRITORY_CA_NL, 0x00010000},
+        {"ニューブランズウィック", TERRITORY_CA_NB, 0x00010000},
+        {"ニューメキシコ州", TERRITORY_US_NM, 0x00010000},
+        {"ニューヨーク州", TERRITORY_US_NY, 0x00010000},
+        {"ヌエボレオン州", TERRITORY_MX_NLE, 0x00010000},
+        {"ヌナブト", TERRITORY_CA_NU, 0x00010000},
+        {"ネネツ自治管区", TERRITORY_RU_NEN, 0x00010000},
+        {"ネバダ州", TERRITORY_US_NV, 0x00010000},
+        {"ネパール", TERRITORY_NPL, 0x00010000},
+        {"ネビス島", TERRITORY_KNA, 0x00010000},
+        {"ネブラスカ州", TERRITORY_US_NE, 0x00010000},
+        {"ノバスコシア州", TERRITORY_CA_NS, 0x00010000},
+        {"ノルウェー", TERRITORY_NOR, 0x00010000},
+        {"ノヴォシビルスク州", TERRITORY_RU_NVS, 0x00010000},
+        {"ノヴゴロド州", TERRITORY_RU_NGR, 0x00010000},
+        {"ノーザン・テリトリー", TERRITORY_AU_NT, 0x00010000},
+        {"ノースウェスト準州", TERRITORY_CA_NT, 0x00010000},
+        {"ノースカロライナ州", TERRITORY_US_NC, 0x00010000},
+        {"ノースダコタ州", TERRITORY_US_ND, 0x00010000},
+        {"ノーフォークとフィリップ島", TERRITORY_NFK, 0x00010000},
+        {"ハイチ", TERRITORY_HTI, 0x00010000},
+        {"ハカス共和国共和国", TERRITORY_RU_KK, 0x00010000},
+        {"ハバロフスク地方", TERRITORY_RU_KHA, 0x00010000},
+        {"ハリスコ州", TERRITORY_MX_JAL, 0x00010000},
+        {"ハリヤナ州", TERRITORY_IN_HR, 0x00010000},
+        {"ハワイ州", TERRITORY_US_HI, 0x00010000},
+        {"ハンガリー", TERRITORY_HUN, 0x00010000},
+        {"ハンティ・マンシ", TERRITORY_RU_KM, 0x00010000},
+        {"ハード島とマクドナルド諸島", TERRITORY_HMD, 0x00010000},
+        {"バイア州", TERRITORY_BR_BA, 0x00010000},
+        {"バシコルトスタン共和国", TERRITORY_RU_BA, 0x00010000},
+        {"バチカン市国", TERRITORY_VAT, 0x00010000},
+        {"バヌアツ", TERRITORY_VUT, 0x00010000},
+        {"バハカリフォルニア", TERRITORY_MX_BCN, 0x00010000},
+        {"バハマ", TERRITORY_BHS, 0x00010000},
+        {"バハ・カリフォルニア・スル州", TERRITORY_MX_BCS, 0x00010000},
+        {"バミューダ", TERRITORY_BMU, 0x00010000},
+        {"バルバドス", TERRITORY_BRB, 0x00010000},
+        {"バングラデシュ", TERRITORY_BGD, 0x00010000},
+        {"バージニア州", TERRITORY_US_VA, 0x00010000},
+        {"バーブーダ", TERRITORY_ATG, 0x00010000},
+        {"バーモント州", TERRITORY_US_VT, 0x00010000},
+        {"バーレーン", TERRITORY_BHR, 0x00010000},
+        {"パキスタン", TERRITORY_PAK, 0x00010000},
+        {"パナマ", TERRITORY_PAN, 0x00010000},
+        {"パプアニューギニア", TERRITORY_PNG, 0x00010000},
+        {"パラ", TERRITORY_BR_PA, 0x00010000},
+        {"パライバ州", TERRITORY_BR_PB, 0x00010000},
+        {"パラオ", TERRITORY_PLW, 0x00010000},
+        {"パラグアイ", TERRITORY_PRY, 0x00010000},
+        {"パラナ", TERRITORY_BR_PR, 0x00010000},
+        {"パレスチナ領土", TERRITORY_PSE, 0x00010000},
+        {"パンジャブ", TERRITORY_IN_PB, 0x00010000},
+        {"ヒマチャル・プラデシュ", TERRITORY_IN_HP, 0x00010000},
+        {"ビクトリア", TERRITORY_AU_VIC, 0x00010000},
+        {"ビハール州", TERRITORY_IN_BR, 0x00010000},
+        {"ビルマ", TERRITORY_MMR, 0x00010000},
+        {"ピアウイ", TERRITORY_BR_PI, 0x00010000},
+        {"ピトケアン諸島", TERRITORY_PCN, 0x00010000},
+        {"フィジー", TERRITORY_FJI, 0x00010000},
+        {"フィリップアイランド", TERRITORY_NFK, 0x00010000},
+        {"フィリピン", TERRITORY_PHL, 0x00010000},
+        {"フィンランド", TERRITORY_FIN, 0x00010000},
+        {"フェロー諸島", TERRITORY_FRO, 0x00010000},
+        {"フォークランド諸島", TERRITORY_FLK, 0x00010000},
+        {"フツナ", TERRITORY_WLF, 0x00010000},
+        {"フランス", TERRITORY_FRA, 0x00010000},
+        {"フランス領ポリネシア", TERRITORY_PYF, 0x00010000},
+        {"フランス領南方・南極地域", TERRITORY_ATF, 0x00010000},
+        {"フロリダ州", TERRITORY_US_FL, 0x00010000},
+        {"ブラジル", TERRITORY_BRA, 0x00010000},
+        {"ブリティッシュコロンビア", TERRITORY_CA_BC, 0x00010000},
+        {"ブリャンスク州", TERRITORY_RU_BRY, 0x00010000},
+        {"ブリヤート共和国", TERRITORY_RU_BU, 0x00010000},
+        {"ブルガリア", TERRITORY_BGR, 0x00010000},
+        {"ブルキナファソ", TERRITORY_BFA, 0x00010000},
+        {"ブルネイ", TERRITORY_BRN, 0x00010000},
+        {"ブルンジ", TERRITORY_BDI, 0x00010000},
+        {"ブータン", TERRITORY_BTN, 0x00010000},
+        {"ブーヴェ島", TERRITORY_BVT, 0x00010000},
+        {"プエブラ", TERRITORY_MX_PUE, 0x00010000},
+        {"プエルトリコ", TERRITORY_PRI, 0x00010000},
+        {"プスコフ州", TERRITORY_RU_PSK, 0x00010000},
+        {"プリンシペ", TERRITORY_STP, 0x00010000},
+        {"プリンスエドワードアイランド", TERRITORY_CA_PE, 0x00010000},
+        {"ベトナム", TERRITORY_VNM, 0x00010000},
+        {"ベニン", TERRITORY_BEN, 0x00010000},
+        {"ベネズエラ", TERRITORY_VEN, 0x00010000},
+        {"ベラクルス州", TERRITORY_MX_VER, 0x00010000},
+        {"ベラルーシ", TERRITORY_BLR, 0x00010000},
+        {"ベリーズ", TERRITORY_BLZ, 0x00010000},
+        {"ベルギー", TERRITORY_BEL, 0x00010000},
+        {"ベルゴロド州", TERRITORY_RU_BE, 0x00010000},
+        {"ペルナンブコ州", TERRITORY_BR_PE, 0x00010000},
+        {"ペルミ地方", TERRITORY_RU_PM, 0x00010000},
+        {"ペルー", TERRITORY_PER, 0x00010000},
+        {"ペンザ州", TERRITORY_RU_PNZ, 0x00010000},
+        {"ペンシルベニア州", TERRITORY_US_PA, 0x00010000},
+        {"ホンジュラス", TERRITORY_HND, 0x00010000},
+        {"ボスニア・ヘルツェゴビナ", TERRITORY_BIH, 0x00010000},
+        {"ボツワナ", TERRITORY_BWA, 0x00010000},
+        {"ボネール、セントeustatuisとサバ", TERRITORY_BES, 0x00010000},
+        {"ボリビア", TERRITORY_BOL, 0x00010000},
+        {"ポルトガル", TERRITORY_PRT, 0x00010000},
+        {"ポンディシェリ", TERRITORY_IN_PY, 0x00010000},
+        {"ポーランド", TERRITORY_POL, 0x00010000},
+        {"マカオ", TERRITORY_MAC, 0x00010000},
+        {"マガダン州", TERRITORY_RU_MAG, 0x00010000},
+        {"マクドナルド諸島", TERRITORY_HMD, 0x00010000},
+        {"マケドニア", TERRITORY_MKD, 0x00010000},
+        {"マサチューセッツ州", TERRITORY_US_MA, 0x00010000},
+        {"マダガスカル", TERRITORY_MDG, 0x00010000},
+        {"マット・グロッソ・ド・スル", TERRITORY_BR_MS, 0x00010000},
+        {"マディヤプラデシュ州", TERRITORY_IN_MP, 0x00010000},
+        {"マトグロッソ州", TERRITORY_BR_MT, 0x00010000},
+        {"マニトバ州", TERRITORY_CA_MB, 0x00010000},
+        {"マニプール", TERRITORY_IN_MN, 0x00010000},
+        {"マハラシュトラ", TERRITORY_IN_MH, 0x00010000},
+        {"マヨット島", TERRITORY_MYT, 0x00010000},
+        {"マラウイ", TERRITORY_MWI, 0x00010000},
+        {"マラニャン州", TERRITORY_BR_MA, 0x00010000},
+        {"マリ", TERRITORY_MLI, 0x00010000},
+        {"マリ・エル共和国共和国", TERRITORY_RU_ME, 0x00010000},
+        {"マルタ", TERRITORY_MLT, 0x00010000},
+        {"マルティニーク島", TERRITORY_MTQ, 0x00010000},
+        {"マレーシア", TERRITORY_MYS, 0x00010000},
+        {"マン島", TERRITORY_IMN, 0x00010000},
+        {"マーシャル諸島", TERRITORY_MHL, 0x00010000},
+        {"ミクロネシア", TERRITORY_FSM, 0x00010000},
+        {"ミクロネシア連邦", TERRITORY_FSM, 0x00010000},
+        {"ミクロン島", TERRITORY_SPM, 0x00010000},
+        {"ミシガン州", TERRITORY_US_MI, 0x00010000},
+        {"ミシシッピ州", TERRITORY_US_MS, 0x00010000},
+        {"ミズーリ州", TERRITORY_US_MO, 0x00010000},
+        {"ミゾラム", TERRITORY_IN_MZ, 0x00010000},
+        {"ミチョアカン州", TERRITORY_MX_MIC, 0x00010000},
+        {"ミナスジェライス州", TERRITORY_BR_MG, 0x00010000},
+        {"ミネソタ州", TERRITORY_US_MN, 0x00010000},
+        {"ミャンマー", TERRITORY_MMR, 0x00010000},
+        {"ムルマンスク州", TERRITORY_RU_MUR, 0x00010000},
+        {"メイン州", TERRITORY_US_ME, 0x00010000},
+        {"メガラヤ州", TERRITORY_IN_ML, 0x00010000},
+        {"メキシコ", TERRITORY_MEX, 0x00010000},
+        {"メキシコ州", TERRITORY_MX_MX, 0x00010000},
+        {"メリーランド州", TERRITORY_US_MD, 0x00010000},
+        {"モザンビーク", TERRITORY_MOZ, 0x00010000},
+        {"モスクワ", TERRITORY_RU_MOW, 0x00010000},
+        {"モスクワ州", TERRITORY_RU_MOS, 0x00010000},
+        {"モナコ", TERRITORY_MCO, 0x00010000},
+        {"モルディブ", TERRITORY_MDV, 0x00010000},
+        {"モルドバ", TERRITORY_MDA, 0x00010000},
+        {"モルドヴィア共和国", TERRITORY_RU_MO, 0x00010000},
+        {"モレロス州", TERRITORY_MX_MOR, 0x00010000},
+        {"モロッコ", TERRITORY_MAR, 0x00010000},
+        {"モンゴル", TERRITORY_MNG, 0x00010000},
+        {"モンタナ州", TERRITORY_US_MT, 0x00010000},
+        {"モンテネグロ", TERRITORY_MNE, 0x00010000},
+        {"モントセラト", TERRITORY_MSR, 0x00010000},
+        {"モーリシャス", TERRITORY_MUS, 0x00010000},
+        {"モーリタニア", TERRITORY_MRT, 0x00010000},
+        {"ヤクート共和国", TERRITORY_RU_SA, 0x00010000},
+        {"ヤマロ・ネネツ自治管区", TERRITORY_RU_YAN, 0x00010000},
+        {"ヤロスラヴリ州", TERRITORY_RU_YAR, 0x00010000},
+        {"ヤンマイエン島", TERRITORY_SJM, 0x00010000},
+        {"ユカタン州", TERRITORY_MX_YUC, 0x00010000},
+        {"ユタ州", TERRITORY_US_UT, 0x00010000},
+        {"ユダヤ自治州", TERRITORY_RU_YEV, 0x00010000},
+        {"ユーコン州", TERRITORY_CA_YT, 0x00010000},
+        {"ヨルダン", TERRITORY_JOR, 0x00010000},
+        {"ラオス", TERRITORY_LAO, 0x00010000},
+        {"ラクシャドウィープ", TERRITORY_IN_LD, 0x00010000},
+        {"ラジャスタン", TERRITORY_IN_RJ, 0x00010000},
+        {"ラトビア", TERRITORY_LVA, 0x00010000},
+        {"リオグランデ・ド・スル", TERRITORY_BR_RS, 0x00010000},
+        {"リオデジャネイロ", TERRITORY_BR_RJ, 0x00010000},
+        {"リオ・グランデ・ド・ノルテ", TERRITORY_BR_RN, 0x00010000},
+        {"リトアニア", TERRITORY_LTU, 0x00010000},
+        {"リヒテンシュタイン", TERRITORY_LIE, 0x00010000},
+        {"リビア", TERRITORY_LBY, 0x00010000},
+        {"リベリア", TERRITORY_LBR, 0x00010000},
+        {"リペツク州", TERRITORY_RU_LIP, 0x00010000},
+        {"リャザン州", TERRITORY_RU_RYA, 0x00010000},
+        {"ルイジアナ州", TERRITORY_US_LA, 0x00010000},
+        {"ルクセンブルク", TERRITORY_LUX, 0x00010000},
+        {"ルワンダ", TERRITORY_RWA, 0x00010000},
+        {"ルーマニア", TERRITORY_ROU, 0x00010000},
+        {"レソト", TERRITORY_LSO, 0x00010000},
+        {"レニングラード州", TERRITORY_RU_LEN, 0x00010000},
+        {"レバノン", TERRITORY_LBN, 0x00010000},
+        {"ロシア", TERRITORY_RUS, 0x00010000},
+        {"ロストフ州", TERRITORY_RU_ROS, 0x00010000},
+        {"ロライマ", TERRITORY_BR_RR, 0x00010000},
+        {"ロンドニア", TERRITORY_BR_RO, 0x00010000},
+        {"ロードアイランド州", TERRITORY_US_RI, 0x00010000},
+        {"ワイオミング州", TERRITORY_US_WY, 0x00010000},
+        {"ワシントン州", TERRITORY_US_WA, 0x00010000},
+        {"ヴォルゴグラード州", TERRITORY_RU_VGG, 0x00010000},
+        {"ヴォログダ州", TERRITORY_RU_VLG, 0x00010000},
+        {"ヴォロネジ州", TERRITORY_RU_VOR, 0x00010000},
+        {"ヴラジーミル州", TERRITORY_RU_VLA, 0x00010000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CN) || defined(MAPCODE_SUPPORT_LANGUAGE_JA)
+        {"上海", TERRITORY_CN_SH, 0x00010008},
+#endif
+        {"上海市", TERRITORY_CN_SH, 0x08000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CN)
+        {"下加利福尼亚州", TERRITORY_MX_BCN, 0x00000008},
+        {"下诺夫哥罗德州", TERRITORY_RU_NIZ, 0x00000008},
+        {"不丹", TERRITORY_BTN, 0x00000008},
+        {"不列颠哥伦比亚省", TERRITORY_CA_BC, 0x00000008},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CN) || defined(MAPCODE_SUPPORT_LANGUAGE_JA)
+        {"世界", TERRITORY_AAA, 0x00010008},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CN)
+        {"东帝汶", TERRITORY_TLS, 0x00000008},
+#endif
+        {"中华人民共和国", TERRITORY_CHN, 0x08000000},
+        {"中华民国", TERRITORY_TWN, 0x08000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CN) || defined(MAPCODE_SUPPORT_LANGUAGE_JA)
+        {"中国", TERRITORY_CHN, 0x00010008},
+#endif
+        {"中國", TERRITORY_CHN, 0x08000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_JA)
+        {"中央アフリカ共和国", TERRITORY_CAF, 0x00010000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CN)
+        {"中央邦", TERRITORY_IN_MP, 0x00000008},
+#endif
+        {"中華民國", TERRITORY_TWN, 0x08000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CN)
+        {"中非共和国", TERRITORY_CAF, 0x00000008},
+        {"丹麦", TERRITORY_DNK, 0x00000008},
+        {"乌克兰", TERRITORY_UKR, 0x00000008},
+        {"乌兹别克斯坦", TERRITORY_UZB, 0x00000008},
+        {"乌干达", TERRITORY_UGA, 0x00000008},
+        {"乌德穆尔特共和国", TERRITORY_RU_UD, 0x00000008},
+        {"乌拉圭", TERRITORY_URY, 0x00000008},
+        {"乌里扬诺夫斯克州", TERRITORY_RU_ULY, 0x00000008},
+        {"乍得", TERRITORY_TCD, 0x00000008},
+        {"也门", TERRITORY_YEM, 0x00000008},
+        {"云南", TERRITORY_CN_YN, 0x00000008},
+#endif
+        {"云南省", TERRITORY_CN_YN, 0x08000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CN)
+        {"亚利桑那州", TERRITORY_US_AZ, 0x00000008},
+        {"亚拉巴马州", TERRITORY_US_AL, 0x00000008},
+        {"亚美尼亚", TERRITORY_ARM, 0x00000008},
+        {"亚马孙州", TERRITORY_BR_AM, 0x00000008},
+        {"亚马尔-涅涅茨自治区", TERRITORY_RU_YAN, 0x00000008},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_JA)
+        {"仏領ギアナ", TERRITORY_GUF, 0x00010000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CN)
+        {"以色列", TERRITORY_ISR, 0x00000008},
+        {"伊万诺沃州", TERRITORY_RU_IVA, 0x00000008},
+        {"伊利诺伊州", TERRITORY_US_IL, 0x00000008},
+        {"伊尔库茨克州", TERRITORY_RU_IRK, 0x00000008},
+        {"伊拉克", TERRITORY_IRQ, 0x00000008},
+        {"伊朗", TERRITORY_IRN, 0x00000008},
+        {"伊达尔戈", TERRITORY_MX_HID, 0x00000008},
+        {"伏尔加格勒州", TERRITORY_RU_VGG, 0x00000008},
+        {"伯利兹", TERRITORY_BLZ, 0x00000008},
+        {"伯南布哥州", TERRITORY_BR_PE, 0x00000008},
+        {"佛得角", TERRITORY_CPV, 0x00000008},
+        {"佛罗里达州", TERRITORY_US_FL, 0x00000008},
+        {"佛蒙特州", TERRITORY_US_VT, 0x00000008},
+        {"俄亥俄州", TERRITORY_US_OH, 0x00000008},
+        {"俄勒冈州", TERRITORY_US_OR, 0x00000008},
+        {"俄国", TERRITORY_RUS, 0x00000008},
+        {"保加利亚", TERRITORY_BGR, 0x00000008},
+        {"克利珀顿岛", TERRITORY_CPT, 0x00000008},
+        {"克拉斯诺亚尔斯克边疆区", TERRITORY_RU_KYA, 0x00000008},
+        {"克拉斯诺达尔边疆区", TERRITORY_RU_KDA, 0x00000008},
+        {"克罗地亚", TERRITORY_HRV, 0x00000008},
+        {"克雷塔罗", TERRITORY_MX_QUE, 0x00000008},
+        {"关岛", TERRITORY_GUM, 0x00000008},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_JA)
+        {"内モンゴル", TERRITORY_CN_NM, 0x00010000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CN)
+        {"内华达州", TERRITORY_US_NV, 0x00000008},
+        {"内布拉斯加州", TERRITORY_US_NE, 0x00000008},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CN) || defined(MAPCODE_SUPPORT_LANGUAGE_JA)
+        {"内蒙古", TERRITORY_CN_NM, 0x00010008},
+#endif
+        {"内蒙古自治区", TERRITORY_CN_NM, 0x08000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CN)
+        {"冈比亚", TERRITORY_GMB, 0x00000008},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_JA)
+        {"再会", TERRITORY_REU, 0x00010000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CN)
+        {"冰岛", TERRITORY_ISL, 0x00000008},
+        {"几内亚", TERRITORY_GIN, 0x00000008},
+        {"几内亚比绍", TERRITORY_GNB, 0x00000008},
+        {"凯科斯群岛", TERRITORY_TCA, 0x00000008},
+        {"列宁格勒州", TERRITORY_RU_LEN, 0x00000008},
+        {"列支敦士登", TERRITORY_LIE, 0x00000008},
+        {"刚果 - 布拉柴维尔", TERRITORY_COG, 0x00000008},
+        {"刚果 - 金沙萨", TERRITORY_COD, 0x00000008},
+        {"利佩茨克州", TERRITORY_RU_LIP, 0x00000008},
+        {"利比亚", TERRITORY_LBY, 0x00000008},
+        {"利比里亚", TERRITORY_LBR, 0x00000008},
+        {"别尔哥罗德州", TERRITORY_RU_BE, 0x00000008},
+        {"加利福尼亚州", TERRITORY_US_CA, 0x00000008},
+        {"加拿大", TERRITORY_CAN, 0x00000008},
+        {"加纳", TERRITORY_GHA, 0x00000008},
+        {"加蓬", TERRITORY_GAB, 0x00000008},
+        {"加里宁格勒州", TERRITORY_RU_KGD, 0x00000008},
+        {"努纳武特", TERRITORY_CA_NU, 0x00000008},
+        {"匈牙利", TERRITORY_HUN, 0x00000008},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_JA)
+        {"北アイルランド", TERRITORY_GBR, 0x00010000},
+        {"北オセチア共和国共和国", TERRITORY_RU_SE, 0x00010000},
+        {"北マリアナ諸島", TERRITORY_MNP, 0x00010000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CN) || defined(MAPCODE_SUPPORT_LANGUAGE_JA)
+        {"北京", TERRITORY_CN_BJ, 0x00010008},
+#endif
+        {"北京市", TERRITORY_CN_BJ, 0x08000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CN)
+        {"北卡罗来纳州", TERRITORY_US_NC, 0x00000008},
+        {"北奥塞梯 - 阿拉尼亚共和国", TERRITORY_RU_SE, 0x00000008},
+        {"北方邦", TERRITORY_IN_UP, 0x00000008},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_JA)
+        {"北朝鮮", TERRITORY_PRK, 0x00010000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CN)
+        {"北朝鲜", TERRITORY_PRK, 0x00000008},
+        {"北爱尔兰", TERRITORY_GBR, 0x00000008},
+        {"北达科他州", TERRITORY_US_ND, 0x00000008},
+        {"北里奥格兰德州", TERRITORY_BR_RN, 0x00000008},
+        {"北阿坎德邦", TERRITORY_IN_UT, 0x00000008},
+        {"北领地", TERRITORY_AU_NT, 0x00000008},
+        {"北马里亚那群岛", TERRITORY_MNP, 0x00000008},
+        {"华盛顿州", TERRITORY_US_WA, 0x00000008},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_JA)
+        {"南アフリカ", TERRITORY_ZAF, 0x00010000},
+        {"南オーストラリア州", TERRITORY_AU_SA, 0x00010000},
+        {"南スーダン", TERRITORY_SSD, 0x00010000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CN)
+        {"南下加利福尼亚州", TERRITORY_MX_BCS, 0x00000008},
+        {"南乔治亚和南桑威奇群岛", TERRITORY_SGS, 0x00000008},
+        {"南卡罗来纳州", TERRITORY_US_SC, 0x00000008},
+        {"南极洲", TERRITORY_ATA, 0x00000008},
+        {"南桑威奇群岛", TERRITORY_SGS, 0x00000008},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_JA)
+        {"南極大陸", TERRITORY_ATA, 0x00010000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CN)
+        {"南澳大利亚", TERRITORY_AU_SA, 0x00000008},
+        {"南苏丹", TERRITORY_SSD, 0x00000008},
+        {"南达科他州", TERRITORY_US_SD, 0x00000008},
+        {"南里奥格兰德州", TERRITORY_BR_RS, 0x00000008},
+        {"南非", TERRITORY_ZAF, 0x00000008},
+        {"南马托格罗索州", TERRITORY_BR_MS, 0x00000008},
+        {"博内尔岛，圣尤斯图斯和萨巴", TERRITORY_BES, 0x00000008},
+        {"博茨瓦纳", TERRITORY_BWA, 0x00000008},
+        {"卡卢加州", TERRITORY_RU_KLU, 0x00000008},
+        {"卡塔尔", TERRITORY_QAT, 0x00000008},
+        {"卡尔梅克共和国", TERRITORY_RU_KL, 0x00000008},
+        {"卡巴尔达 - 巴尔卡共和国", TERRITORY_RU_KB, 0x00000008},
+        {"卡拉恰伊-切尔克斯共和国", TERRITORY_RU_KC, 0x00000008},
+        {"卡累利阿共和国", TERRITORY_RU_KR, 0x00000008},
+        {"卡纳塔克", TERRITORY_IN_KA, 0x00000008},
+        {"卢旺达", TERRITORY_RWA, 0x00000008},
+        {"卢森堡", TERRITORY_LUX, 0x00000008},
+        {"印古什共和国", TERRITORY_RU_IN, 0x00000008},
+        {"印度", TERRITORY_IND, 0x00000008},
+        {"印度尼西亚", TERRITORY_IDN, 0x00000008},
+        {"印第安纳州", TERRITORY_US_IN, 0x00000008},
+        {"危地马拉", TERRITORY_GTM, 0x00000008},
+        {"厄瓜多尔", TERRITORY_ECU, 0x00000008},
+        {"厄立特里亚", TERRITORY_ERI, 0x00000008},
+        {"叙利亚", TERRITORY_SYR, 0x00000008},
+        {"古吉拉特", TERRITORY_IN_GJ, 0x00000008},
+        {"古巴", TERRITORY_CUB, 0x00000008},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CN) || defined(MAPCODE_SUPPORT_LANGUAGE_JA)
+        {"台湾", TERRITORY_TWN, 0x00010008},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CN)
+        {"吉尔吉斯斯坦", TERRITORY_KGZ, 0x00000008},
+        {"吉布提", TERRITORY_DJI, 0x00000008},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CN) || defined(MAPCODE_SUPPORT_LANGUAGE_JA)
+        {"吉林", TERRITORY_CN_JL, 0x00010008},
+#endif
+        {"吉林省", TERRITORY_CN_JL, 0x08000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CN)
+        {"哈利斯科", TERRITORY_MX_JAL, 0x00000008},
+        {"哈卡斯共和国", TERRITORY_RU_KK, 0x00000008},
+        {"哈巴罗夫斯克边疆区", TERRITORY_RU_KHA, 0x00000008},
+        {"哈萨克斯坦", TERRITORY_KAZ, 0x00000008},
+        {"哈里亚纳", TERRITORY_IN_HR, 0x00000008},
+        {"哥伦比亚", TERRITORY_COL, 0x00000008},
+        {"哥斯达黎加", TERRITORY_CRI, 0x00000008},
+        {"喀拉拉", TERRITORY_IN_KL, 0x00000008},
+        {"喀麦隆", TERRITORY_CMR, 0x00000008},
+        {"喜马偕尔邦", TERRITORY_IN_HP, 0x00000008},
+        {"四川", TERRITORY_CN_SC, 0x00000008},
+#endif
+        {"四川省", TERRITORY_CN_SC, 0x08010000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CN)
+        {"团圆", TERRITORY_REU, 0x00000008},
+        {"国际", TERRITORY_AAA, 0x00000008},
+        {"图拉州", TERRITORY_RU_TUL, 0x00000008},
+        {"图瓦共和国", TERRITORY_RU_TY, 0x00000008},
+        {"图瓦卢", TERRITORY_TUV, 0x00000008},
+        {"土库曼斯坦", TERRITORY_TKM, 0x00000008},
+        {"土耳其", TERRITORY_TUR, 0x00000008},
+        {"圣保罗州", TERRITORY_BR_SP, 0x00000008},
+        {"圣卡塔琳娜州", TERRITORY_BR_SC, 0x00000008},
+        {"圣卢西亚", TERRITORY_LCA, 0x00000008},
+        {"圣埃斯皮里图州", TERRITORY_BR_ES, 0x00000008},
+        {"圣基茨和尼维斯", TERRITORY_KNA, 0x00000008},
+        {"圣多美和普林西比", TERRITORY_STP, 0x00000008},
+        {"圣巴泰勒米", TERRITORY_BLM, 0x00000008},
+        {"圣彼得堡", TERRITORY_RU_SPE, 0x00000008},
+        {"圣文森特和格林纳丁斯", TERRITORY_VCT, 0x00000008},
+        {"圣皮埃尔和密克隆", TERRITORY_SPM, 0x00000008},
+        {"圣诞岛", TERRITORY_CXR, 0x00000008},
+        {"圣赫勒拿，阿森松和特里斯坦达库尼亚", TERRITORY_SHN, 0x00000008},
+        {"圣路易斯波托西", TERRITORY_MX_SLP, 0x00000008},
+        {"圣马丁", TERRITORY_SXM, 0x00000008},
+        {"圣马丁", TERRITORY_MAF, 0x00000008},
+        {"圣马力诺", TERRITORY_SMR, 0x00000008},
+        {"圭亚那", TERRITORY_GUY, 0x00000008},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CN) || defined(MAPCODE_SUPPORT_LANGUAGE_JA)
+        {"地球", TERRITORY_AAA, 0x00010008},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CN)
+        {"坎佩切", TERRITORY_MX_CAM, 0x00000008},
+        {"坦桑尼亚", TERRITORY_TZA, 0x00000008},
+        {"坦波夫州", TERRITORY_RU_TT, 0x00000008},
+        {"埃及", TERRITORY_EGY, 0x00000008},
+        {"埃塞俄比亚", TERRITORY_ETH, 0x00000008},
+        {"基林群岛", TERRITORY_CCK, 0x00000008},
+        {"基洛夫州", TERRITORY_RU_KI, 0x00000008},
+        {"基里巴斯", TERRITORY_KIR, 0x00000008},
+        {"堪察加边疆区", TERRITORY_RU_KAM, 0x00000008},
+        {"堪萨斯州", TERRITORY_US_KS, 0x00000008},
+        {"塔吉克斯坦", TERRITORY_TJK, 0x00000008},
+        {"塔巴斯科", TERRITORY_MX_TAB, 0x00000008},
+        {"塔斯马尼亚", TERRITORY_AU_TAS, 0x00000008},
+        {"塔毛利帕斯州", TERRITORY_MX_TAM, 0x00000008},
+        {"塞内加尔", TERRITORY_SEN, 0x00000008},
+        {"塞尔希培州", TERRITORY_BR_SE, 0x00000008},
+        {"塞尔维亚", TERRITORY_SRB, 0x00000008},
+        {"塞拉利昂", TERRITORY_SLE, 0x00000008},
+        {"塞浦路斯", TERRITORY_CYP, 0x00000008},
+        {"塞舌尔", TERRITORY_SYC, 0x00000008},
+        {"塞阿拉州", TERRITORY_BR_CE, 0x00000008},
+        {"墨西哥", TERRITORY_MEX, 0x00000008},
+        {"墨西哥州", TERRITORY_MX_MX, 0x00000008},
+        {"夏威夷州", TERRITORY_US_HI, 0x00000008},
+        {"外貝加爾邊疆區", TERRITORY_RU_ZAB, 0x00000008},
+        {"多哥", TERRITORY_TGO, 0x00000008},
+        {"多巴哥", TERRITORY_TTO, 0x00000008},
+        {"多明尼加共和国", TERRITORY_DOM, 0x00000008},
+        {"多米尼加", TERRITORY_DMA, 0x00000008},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CN) || defined(MAPCODE_SUPPORT_LANGUAGE_JA)
+        {"天津", TERRITORY_CN_TJ, 0x00010008},
+#endif
+        {"天津市", TERRITORY_CN_TJ, 0x08000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CN)
+        {"奇瓦瓦", TERRITORY_MX_CHH, 0x00000008},
+        {"奔萨州", TERRITORY_RU_PNZ, 0x00000008},
+        {"奥伦堡州", TERRITORY_RU_ORE, 0x00000008},
+        {"奥兰群岛", TERRITORY_ALA, 0x00000008},
+        {"奥地利", TERRITORY_AUT, 0x00000008},
+        {"奥廖尔州", TERRITORY_RU_ORL, 0x00000008},
+        {"奥里萨", TERRITORY_IN_OR, 0x00000008},
+        {"奧克拉荷馬州", TERRITORY_US_OK, 0x00000008},
+        {"委内瑞拉", TERRITORY_VEN, 0x00000008},
+        {"威斯康星州", TERRITORY_US_WI, 0x00000008},
+        {"孟加拉国", TERRITORY_BGD, 0x00000008},
+#endif
+        {"宁夏", TERRITORY_CN_NX, 0x08000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CN)
+        {"宁夏回族", TERRITORY_CN_NX, 0x00000008},
+#endif
+        {"宁夏回族自治区", TERRITORY_CN_NX, 0x08000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CN)
+        {"安哥拉", TERRITORY_AGO, 0x00000008},
+        {"安圭拉", TERRITORY_AIA, 0x00000008},
+        {"安大略", TERRITORY_CA_ON, 0x00000008},
+        {"安德拉邦", TERRITORY_IN_AP, 0x00000008},
+        {"安徽", TERRITORY_CN_AH, 0x00000008},
+#endif
+        {"安徽省", TERRITORY_CN_AH, 0x08010000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CN)
+        {"安提瓜和巴布达", TERRITORY_ATG, 0x00000008},
+        {"安达曼和尼科巴", TERRITORY_IN_AN, 0x00000008},
+        {"安道尔", TERRITORY_AND, 0x00000008},
+        {"宾夕法尼亚州", TERRITORY_US_PA, 0x00000008},
+        {"密克罗尼西亚", TERRITORY_FSM, 0x00000008},
+        {"密克罗尼西亚联邦", TERRITORY_FSM, 0x00000008},
+        {"密苏里州", TERRITORY_US_MO, 0x00000008},
+        {"密西根州", TERRITORY_US_MI, 0x00000008},
+        {"密西西比州", TERRITORY_US_MS, 0x00000008},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_JA)
+        {"寧夏ホイ", TERRITORY_CN_NX, 0x00010000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CN)
+        {"尤卡坦", TERRITORY_MX_YUC, 0x00000008},
+        {"尼加拉瓜", TERRITORY_NIC, 0x00000008},
+        {"尼日利亚", TERRITORY_NGA, 0x00000008},
+        {"尼日尔", TERRITORY_NER, 0x00000008},
+        {"尼泊尔", TERRITORY_NPL, 0x00000008},
+        {"尼维斯", TERRITORY_KNA, 0x00000008},
+        {"山东", TERRITORY_CN_SD, 0x00000008},
+#endif
+        {"山东省", TERRITORY_CN_SD, 0x08000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_JA)
+        {"山東省", TERRITORY_CN_SD, 0x00010000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CN) || defined(MAPCODE_SUPPORT_LANGUAGE_JA)
+        {"山西", TERRITORY_CN_SX, 0x00010008},
+#endif
+        {"山西省", TERRITORY_CN_SX, 0x08000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CN)
+        {"巴什科尔托斯坦共和国", TERRITORY_RU_BA, 0x00000008},
+        {"巴伊亚州", TERRITORY_BR_BA, 0x00000008},
+        {"巴勒斯坦领土", TERRITORY_PSE, 0x00000008},
+        {"巴哈马", TERRITORY_BHS, 0x00000008},
+        {"巴基斯坦", TERRITORY_PAK, 0x00000008},
+        {"巴巴多斯", TERRITORY_BRB, 0x00000008},
+        {"巴布亚新几内亚", TERRITORY_PNG, 0x00000008},
+        {"巴布达", TERRITORY_ATG, 0x00000008},
+        {"巴拉圭", TERRITORY_PRY, 0x00000008},
+        {"巴拉那州", TERRITORY_BR_PR, 0x00000008},
+        {"巴拿马", TERRITORY_PAN, 0x00000008},
+        {"巴林", TERRITORY_BHR, 0x00000008},
+        {"巴西", TERRITORY_BRA, 0x00000008},
+        {"布基纳法索", TERRITORY_BFA, 0x00000008},
+        {"布良斯克州", TERRITORY_RU_BRY, 0x00000008},
+        {"布里亚特共和国", TERRITORY_RU_BU, 0x00000008},
+        {"布隆迪", TERRITORY_BDI, 0x00000008},
+        {"布韦岛", TERRITORY_BVT, 0x00000008},
+        {"希腊", TERRITORY_GRC, 0x00000008},
+        {"帕劳", TERRITORY_PLW, 0x00000008},
+        {"帕拉伊巴州", TERRITORY_BR_PB, 0x00000008},
+        {"帕拉州", TERRITORY_BR_PA, 0x00000008},
+#endif
+        {"广东省", TERRITORY_CN_GD, 0x08000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CN)
+        {"广西壮族", TERRITORY_CN_GX, 0x00000008},
+#endif
+        {"广西壮族自治区", TERRITORY_CN_GX, 0x08000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_JA)
+        {"広東", TERRITORY_CN_GD, 0x00010000},
+        {"広西チワン族自治区", TERRITORY_CN_GX, 0x00010000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CN)
+        {"库克岛", TERRITORY_COK, 0x00000008},
+        {"库尔干州", TERRITORY_RU_KGN, 0x00000008},
+        {"库尔斯克州", TERRITORY_RU_KRS, 0x00000008},
+        {"库拉索", TERRITORY_CUW, 0x00000008},
+        {"康涅狄格州", TERRITORY_US_CT, 0x00000008},
+        {"开曼群岛", TERRITORY_CYM, 0x00000008},
+        {"弗吉尼亚州", TERRITORY_US_VA, 0x00000008},
+        {"弗拉基米尔州", TERRITORY_RU_VLA, 0x00000008},
+        {"彼尔姆边疆区", TERRITORY_RU_PM, 0x00000008},
+        {"得克萨斯州", TERRITORY_US_TX, 0x00000008},
+        {"德国", TERRITORY_DEU, 0x00000008},
+        {"德里", TERRITORY_IN_DL, 0x00000008},
+        {"怀俄明州", TERRITORY_US_WY, 0x00000008},
+        {"恰帕斯", TERRITORY_MX_CHP, 0x00000008},
+        {"恰蒂斯加尔邦", TERRITORY_IN_CT, 0x00000008},
+        {"意大利", TERRITORY_ITA, 0x00000008},
+        {"愛荷華州", TERRITORY_US_IA, 0x00000008},
+        {"戈亚斯州", TERRITORY_BR_GO, 0x00000008},
+        {"所罗门群岛", TERRITORY_SLB, 0x00000008},
+        {"托克劳", TERRITORY_TKL, 0x00000008},
+        {"托坎廷斯州", TERRITORY_BR_TO, 0x00000008},
+        {"托木斯克州", TERRITORY_RU_TOM, 0x00000008},
+        {"拉克沙群島", TERRITORY_IN_LD, 0x00000008},
+        {"拉脱维亚", TERRITORY_LVA, 0x00000008},
+        {"拉贾斯坦邦", TERRITORY_IN_RJ, 0x00000008},
+        {"挪威", TERRITORY_NOR, 0x00000008},
+        {"捷克共和国", TERRITORY_CZE, 0x00000008},
+        {"摩尔多瓦", TERRITORY_MDA, 0x00000008},
+        {"摩尔曼斯克州", TERRITORY_RU_MUR, 0x00000008},
+        {"摩洛哥", TERRITORY_MAR, 0x00000008},
+        {"摩纳哥", TERRITORY_MCO, 0x00000008},
+        {"教廷", TERRITORY_VAT, 0x00000008},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_JA)
+        {"教皇庁", TERRITORY_VAT, 0x00010000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CN)
+        {"文莱", TERRITORY_BRN, 0x00000008},
+        {"斐济", TERRITORY_FJI, 0x00000008},
+        {"斯塔夫罗波尔边疆区", TERRITORY_RU_STA, 0x00000008},
+        {"斯威士兰", TERRITORY_SWZ, 0x00000008},
+        {"斯摩棱斯克州", TERRITORY_RU_SMO, 0x00000008},
+        {"斯洛伐克", TERRITORY_SVK, 0x00000008},
+        {"斯洛文尼亚", TERRITORY_SVN, 0x00000008},
+        {"斯瓦尔巴和杨梅", TERRITORY_SJM, 0x00000008},
+        {"斯維爾德洛夫斯克州", TERRITORY_RU_SVE, 0x00000008},
+        {"斯里兰卡", TERRITORY_LKA, 0x00000008},
+        {"新不伦瑞克", TERRITORY_CA_NB, 0x00000008},
+#endif
+        {"新加坡", TERRITORY_SGP, 0x08000008},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CN)
+        {"新南威尔士州", TERRITORY_AU_NSW, 0x00000008},
+        {"新喀里多尼亚", TERRITORY_NCL, 0x00000008},
+        {"新墨西哥州", TERRITORY_US_NM, 0x00000008},
+        {"新斯科舍省", TERRITORY_CA_NS, 0x00000008},
+        {"新泽西州", TERRITORY_US_NJ, 0x00000008},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_JA)
+        {"新疆ウイグル", TERRITORY_CN_XJ, 0x00010000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CN)
+        {"新疆维吾尔族", TERRITORY_CN_XJ, 0x00000008},
+#endif
+        {"新疆维吾尔自治区", TERRITORY_CN_XZ, 0x08000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CN)
+        {"新罕布什尔州", TERRITORY_US_NH, 0x00000008},
+        {"新莱昂", TERRITORY_MX_NLE, 0x00000008},
+        {"新西伯利亚州", TERRITORY_RU_NVS, 0x00000008},
+        {"新西兰", TERRITORY_NZL, 0x00000008},
+        {"旁遮普", TERRITORY_IN_PB, 0x00000008},
+#endif
+        {"日本", TERRITORY_JPN, 0x08010008},
+        {"日本国", TERRITORY_JPN, 0x08000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CN)
+        {"昆士兰", TERRITORY_AU_QLD, 0x00000008},
+        {"昌迪加尔", TERRITORY_IN_CH, 0x00000008},
+        {"明尼苏达州", TERRITORY_US_MN, 0x00000008},
+        {"普埃布拉", TERRITORY_MX_PUE, 0x00000008},
+        {"普斯科夫州", TERRITORY_RU_PSK, 0x00000008},
+        {"智利", TERRITORY_CHL, 0x00000008},
+        {"曼尼普尔", TERRITORY_IN_MN, 0x00000008},
+        {"朗多尼亚州", TERRITORY_BR_RO, 0x00000008},
+        {"本地治里", TERRITORY_IN_PY, 0x00000008},
+        {"杜兰戈", TERRITORY_MX_DUR, 0x00000008},
+        {"杰维斯湾领地", TERRITORY_AU_JBT, 0x00000008},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_JA)
+        {"東ティモール", TERRITORY_TLS, 0x00010000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CN)
+        {"果阿", TERRITORY_IN_GA, 0x00000008},
+        {"查谟和克什米尔", TERRITORY_IN_JK, 0x00000008},
+        {"柬埔寨", TERRITORY_KHM, 0x00000008},
+        {"根西岛", TERRITORY_GGY, 0x00000008},
+        {"格林纳丁斯", TERRITORY_VCT, 0x00000008},
+        {"格林纳达", TERRITORY_GRD, 0x00000008},
+        {"格陵兰", TERRITORY_GRL, 0x00000008},
+        {"格雷罗", TERRITORY_MX_GRO, 0x00000008},
+        {"格鲁吉亚", TERRITORY_GEO, 0x00000008},
+        {"格鲁吉亚", TERRITORY_US_GA, 0x00000008},
+        {"梁赞州", TERRITORY_RU_RYA, 0x00000008},
+        {"梅加拉亚邦", TERRITORY_IN_ML, 0x00000008},
+        {"梵蒂冈城", TERRITORY_VAT, 0x00000008},
+        {"楚瓦什共和国", TERRITORY_RU_CU, 0x00000008},
+        {"楚科奇自治区", TERRITORY_RU_CHU, 0x00000008},
+        {"比利时", TERRITORY_BEL, 0x00000008},
+        {"比哈尔邦", TERRITORY_IN_BR, 0x00000008},
+        {"毛里塔尼亚", TERRITORY_MRT, 0x00000008},
+        {"毛里求斯", TERRITORY_MUS, 0x00000008},
+        {"汉特曼西", TERRITORY_RU_KM, 0x00000008},
+        {"江苏", TERRITORY_CN_JS, 0x00000008},
+#endif
+        {"江苏省", TERRITORY_CN_JS, 0x08000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_JA)
+        {"江蘇省", TERRITORY_CN_JS, 0x00010000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CN)
+        {"江西", TERRITORY_CN_JX, 0x00000008},
+#endif
+        {"江西省", TERRITORY_CN_JX, 0x08010000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CN)
+        {"汤加", TERRITORY_TON, 0x00000008},
+        {"沃洛格达州", TERRITORY_RU_VLG, 0x00000008},
+        {"沃罗涅日州", TERRITORY_RU_VOR, 0x00000008},
+        {"沙特阿拉伯", TERRITORY_SAU, 0x00000008},
+        {"河北", TERRITORY_CN_HE, 0x00000008},
+#endif
+        {"河北省", TERRITORY_CN_HE, 0x08010000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CN)
+        {"河南", TERRITORY_CN_HA, 0x00000008},
+#endif
+        {"河南省", TERRITORY_CN_HA, 0x08010000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_JA)
+        {"沿海州", TERRITORY_RU_PO, 0x00010000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CN)
+        {"法国", TERRITORY_FRA, 0x00000008},
+        {"法国南部和南极土地", TERRITORY_ATF, 0x00000008},
+        {"法属圭亚那", TERRITORY_GUF, 0x00000008},
+        {"法属波利尼西亚", TERRITORY_PYF, 0x00000008},
+        {"法罗群岛", TERRITORY_FRO, 0x00000008},
+        {"波兰", TERRITORY_POL, 0x00000008},
+        {"波多黎各", TERRITORY_PRI, 0x00000008},
+        {"波斯尼亚和黑塞哥维那", TERRITORY_BIH, 0x00000008},
+        {"泰国", TERRITORY_THA, 0x00000008},
+        {"泰米尔纳德邦", TERRITORY_IN_TN, 0x00000008},
+        {"泽西岛", TERRITORY_JEY, 0x00000008},
+        {"津巴布韦", TERRITORY_ZWE, 0x00000008},
+        {"洪都拉斯", TERRITORY_HND, 0x00000008},
+        {"浙江", TERRITORY_CN_ZJ, 0x00000008},
+#endif
+        {"浙江省", TERRITORY_CN_ZJ, 0x08010000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CN) || defined(MAPCODE_SUPPORT_LANGUAGE_JA)
+        {"海南", TERRITORY_CN_HI, 0x00010008},
+#endif
+        {"海南省", TERRITORY_CN_HI, 0x08000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CN)
+        {"海地", TERRITORY_HTI, 0x00000008},
+        {"涅涅茨自治区", TERRITORY_RU_NEN, 0x00000008},
+        {"湖北", TERRITORY_CN_HB, 0x00000008},
+#endif
+        {"湖北省", TERRITORY_CN_HB, 0x08010000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CN)
+        {"湖南", TERRITORY_CN_HN, 0x00000008},
+#endif
+        {"湖南省", TERRITORY_CN_HN, 0x08010000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CN)
+        {"滨海边疆区", TERRITORY_RU_PO, 0x00000008},
+        {"澳大利亚", TERRITORY_AUS, 0x00000008},
+        {"澳大利亚首都特区", TERRITORY_AU_ACT, 0x00000008},
+#endif
+        {"澳門", TERRITORY_MAC, 0x08000000},
+        {"澳门", TERRITORY_MAC, 0x08000008},
+        {"澳门特别行政区", TERRITORY_MAC, 0x08000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CN)
+        {"爱尔兰", TERRITORY_IRL, 0x00000008},
+        {"爱尔兰，北方", TERRITORY_GBR, 0x00000008},
+        {"爱德华王子岛", TERRITORY_CA_PE, 0x00000008},
+        {"爱沙尼亚", TERRITORY_EST, 0x00000008},
+        {"爱达荷州", TERRITORY_US_ID, 0x00000008},
+        {"牙买加", TERRITORY_JAM, 0x00000008},
+        {"特伦甘纳邦", TERRITORY_IN_TG, 0x00000008},
+        {"特克斯和凯科斯群岛", TERRITORY_TCA, 0x00000008},
+        {"特拉华州", TERRITORY_US_DE, 0x00000008},
+        {"特拉斯卡拉", TERRITORY_MX_TLA, 0x00000008},
+        {"特立尼达和多巴哥", TERRITORY_TTO, 0x00000008},
+        {"特维尔州", TERRITORY_RU_TVE, 0x00000008},
+        {"特里斯坦达库尼亚", TERRITORY_SHN, 0x00000008},
+        {"特里普拉邦", TERRITORY_IN_TR, 0x00000008},
+        {"犹他州", TERRITORY_US_UT, 0x00000008},
+        {"犹太自治州", TERRITORY_RU_YEV, 0x00000008},
+        {"玻利维亚", TERRITORY_BOL, 0x00000008},
+        {"瑙鲁", TERRITORY_NRU, 0x00000008},
+        {"瑞典", TERRITORY_SWE, 0x00000008},
+        {"瑞士", TERRITORY_CHE, 0x00000008},
+        {"瓜德罗普", TERRITORY_GLP, 0x00000008},
+        {"瓜纳华托", TERRITORY_MX_GUA, 0x00000008},
+        {"瓦利斯和富图纳", TERRITORY_WLF, 0x00000008},
+        {"瓦努阿图", TERRITORY_VUT, 0x00000008},
+        {"瓦哈卡", TERRITORY_MX_OAX, 0x00000008},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_JA)
+        {"甘粛省", TERRITORY_CN_GS, 0x00010000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CN)
+        {"甘肃", TERRITORY_CN_GS, 0x00000008},
+#endif
+        {"甘肃省", TERRITORY_CN_GS, 0x08000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CN)
+        {"田纳西州", TERRITORY_US_TN, 0x00000008},
+        {"白俄罗斯", TERRITORY_BLR, 0x00000008},
+        {"百慕大", TERRITORY_BMU, 0x00000008},
+        {"皮奥伊州", TERRITORY_BR_PI, 0x00000008},
+        {"皮特凯恩群岛", TERRITORY_PCN, 0x00000008},
+        {"直布罗陀", TERRITORY_GIB, 0x00000008},
+        {"福克兰群岛", TERRITORY_FLK, 0x00000008},
+        {"福建", TERRITORY_CN_FJ, 0x00000008},
+#endif
+        {"福建省", TERRITORY_CN_FJ, 0x08010000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CN)
+        {"秋明州", TERRITORY_RU_TYU, 0x00000008},
+        {"科利马", TERRITORY_MX_CL, 0x00000008},
+        {"科威特", TERRITORY_KWT, 0x00000008},
+        {"科摩罗", TERRITORY_COM, 0x00000008},
+        {"科斯特罗马州", TERRITORY_RU_KOS, 0x00000008},
+        {"科科斯群岛", TERRITORY_CCK, 0x00000008},
+        {"科米共和国", TERRITORY_RU_KO, 0x00000008},
+        {"科罗拉多州", TERRITORY_US_CO, 0x00000008},
+        {"科阿韦拉", TERRITORY_MX_COA, 0x00000008},
+        {"科麦罗沃州", TERRITORY_RU_KEM, 0x00000008},
+        {"秘鲁", TERRITORY_PER, 0x00000008},
+        {"突尼斯", TERRITORY_TUN, 0x00000008},
+        {"立陶宛", TERRITORY_LTU, 0x00000008},
+        {"米佐拉姆邦", TERRITORY_IN_MZ, 0x00000008},
+        {"米却肯", TERRITORY_MX_MIC, 0x00000008},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_JA)
+        {"米国", TERRITORY_USA, 0x00010000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CN)
+        {"米纳斯吉拉斯州", TERRITORY_BR_MG, 0x00000008},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_JA)
+        {"米領バージン諸島", TERRITORY_VIR, 0x00010000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CN)
+        {"粤", TERRITORY_CN_GD, 0x00000008},
+        {"索诺拉", TERRITORY_MX_SON, 0x00000008},
+        {"索马里", TERRITORY_SOM, 0x00000008},
+        {"约旦", TERRITORY_JOR, 0x00000008},
+        {"纳亚里特", TERRITORY_MX_NAY, 0x00000008},
+        {"纳加兰", TERRITORY_IN_NL, 0x00000008},
+        {"纳米比亚", TERRITORY_NAM, 0x00000008},
+        {"纽埃", TERRITORY_NIU, 0x00000008},
+        {"纽约州", TERRITORY_US_NY, 0x00000008},
+        {"纽芬兰", TERRITORY_CA_NL, 0x00000008},
+        {"维多利亚", TERRITORY_AU_VIC, 0x00000008},
+        {"维尔京群岛，英国", TERRITORY_VGB, 0x00000008},
+        {"缅因州", TERRITORY_US_ME, 0x00000008},
+        {"缅甸", TERRITORY_MMR, 0x00000008},
+        {"罗得岛州", TERRITORY_US_RI, 0x00000008},
+        {"罗斯托夫州", TERRITORY_RU_ROS, 0x00000008},
+        {"罗赖马州", TERRITORY_BR_RR, 0x00000008},
+        {"罗马尼亚", TERRITORY_ROU, 0x00000008},
+        {"美利坚合众国", TERRITORY_USA, 0x00000008},
+        {"美国", TERRITORY_USA, 0x00000008},
+        {"美國本土外小島嶼", TERRITORY_UMI, 0x00000008},
+        {"美属维尔京群岛", TERRITORY_VIR, 0x00000008},
+        {"美属萨摩亚", TERRITORY_ASM, 0x00000008},
+        {"老挝", TERRITORY_LAO, 0x00000008},
+        {"联邦区", TERRITORY_MX_DIF, 0x00000008},
+        {"联邦区", TERRITORY_BR_DF, 0x00000008},
+        {"肯塔基州", TERRITORY_US_KY, 0x00000008},
+        {"肯尼亚", TERRITORY_KEN, 0x00000008},
+        {"育空", TERRITORY_CA_YT, 0x00000008},
+        {"艾伯塔省", TERRITORY_CA_AB, 0x00000008},
+        {"芬兰", TERRITORY_FIN, 0x00000008},
+        {"苏丹", TERRITORY_SDN, 0x00000008},
+        {"苏格兰", TERRITORY_GBR, 0x00000008},
+        {"苏里南", TERRITORY_SUR, 0x00000008},
+        {"英国", TERRITORY_GBR, 0x00000008},
+        {"英属印度洋领地", TERRITORY_IOT, 0x00000008},
+        {"英属维尔京群岛", TERRITORY_VGB, 0x00000008},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_JA)
+        {"英領バージン諸島", TERRITORY_VGB, 0x00010000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CN)
+        {"荷兰", TERRITORY_NLD, 0x00000008},
+        {"莫尔多维亚共和国", TERRITORY_RU_MO, 0x00000008},
+        {"莫斯科州", TERRITORY_RU_MOW, 0x00000008},
+        {"莫斯科州", TERRITORY_RU_MOS, 0x00000008},
+        {"莫桑比克", TERRITORY_MOZ, 0x00000008},
+        {"莫雷洛斯", TERRITORY_MX_MOR, 0x00000008},
+        {"莱索托", TERRITORY_LSO, 0x00000008},
+        {"華盛頓哥倫比亞特區", TERRITORY_US_DC, 0x00000008},
+        {"菲利普岛", TERRITORY_NFK, 0x00000008},
+        {"菲律宾", TERRITORY_PHL, 0x00000008},
+        {"萨卡特卡斯", TERRITORY_MX_ZAC, 0x00000008},
+        {"萨哈共和国", TERRITORY_RU_SA, 0x00000008},
+        {"萨哈林州", TERRITORY_RU_SAK, 0x00000008},
+        {"萨尔瓦多", TERRITORY_SLV, 0x00000008},
+        {"萨巴", TERRITORY_BES, 0x00000008},
+        {"萨拉托夫州", TERRITORY_RU_SAR, 0x00000008},
+        {"萨摩亚", TERRITORY_WSM, 0x00000008},
+        {"萨摩亚，美国", TERRITORY_ASM, 0x00000008},
+        {"萨斯喀彻温", TERRITORY_CA_SK, 0x00000008},
+        {"萨马拉州", TERRITORY_RU_SAM, 0x00000008},
+        {"葡萄牙", TERRITORY_PRT, 0x00000008},
+        {"蒙古", TERRITORY_MNG, 0x00000008},
+        {"蒙大拿州", TERRITORY_US_MT, 0x00000008},
+        {"蒙特塞拉特", TERRITORY_MSR, 0x00000008},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_JA)
+        {"西オーストラリア州", TERRITORY_AU_WA, 0x00010000},
+        {"西サハラ", TERRITORY_ESH, 0x00010000},
+        {"西ベンガル", TERRITORY_IN_WB, 0x00010000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CN)
+        {"西北地区", TERRITORY_CA_NT, 0x00000008},
+        {"西孟加拉邦", TERRITORY_IN_WB, 0x00000008},
+        {"西弗吉尼亚州", TERRITORY_US_WV, 0x00000008},
+        {"西撒哈拉", TERRITORY_ESH, 0x00000008},
+        {"西澳大利亚", TERRITORY_AU_WA, 0x00000008},
+        {"西班牙", TERRITORY_ESP, 0x00000008},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_JA)
+        {"西蔵", TERRITORY_CN_XZ, 0x00010000},
+#endif
+        {"西藏", TERRITORY_CN_XZ, 0x08000008},
+        {"西藏", TERRITORY_CN_XJ, 0x08000000},
+        {"西藏自治区", TERRITORY_CN_XJ, 0x08000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CN)
+        {"诺夫哥罗德州", TERRITORY_RU_NGR, 0x00000008},
+        {"诺福克岛和菲利普岛", TERRITORY_NFK, 0x00000008},
+        {"象牙海岸", TERRITORY_CIV, 0x00000008},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_JA)
+        {"貴州省", TERRITORY_CN_GZ, 0x00010000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CN)
+        {"贝宁", TERRITORY_BEN, 0x00000008},
+        {"贵州", TERRITORY_CN_GZ, 0x00000008},
+#endif
+        {"贵州省", TERRITORY_CN_GZ, 0x08000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CN)
+        {"贾坎德", TERRITORY_IN_JH, 0x00000008},
+        {"赞比亚", TERRITORY_ZMB, 0x00000008},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_JA)
+        {"赤道ギニア", TERRITORY_GNQ, 0x00010000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CN)
+        {"赤道几内亚", TERRITORY_GNQ, 0x00000008},
+        {"赫德岛和麦克唐纳群岛", TERRITORY_HMD, 0x00000008},
+        {"越南", TERRITORY_VNM, 0x00000008},
+        {"路易斯安那州", TERRITORY_US_LA, 0x00000008},
+        {"车臣共和国", TERRITORY_RU_CE, 0x00000008},
+        {"车里雅宾斯克州", TERRITORY_RU_CH, 0x00000008},
+        {"辽宁", TERRITORY_CN_LN, 0x00000008},
+#endif
+        {"辽宁省", TERRITORY_CN_LN, 0x08000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CN)
+        {"达吉斯坦共和国", TERRITORY_RU_DA, 0x00000008},
+        {"达德拉-纳加尔哈维利", TERRITORY_IN_DN, 0x00000008},
+        {"达曼-第乌", TERRITORY_IN_DD, 0x00000008},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_JA)
+        {"連邦区", TERRITORY_MX_DIF, 0x00010000},
+        {"連邦区", TERRITORY_BR_DF, 0x00010000},
+        {"遼寧", TERRITORY_CN_LN, 0x00010000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CN)
+        {"鄂木斯克州", TERRITORY_RU_OMS, 0x00000008},
+        {"里约热内卢州", TERRITORY_BR_RJ, 0x00000008},
+        {"重庆", TERRITORY_CN_CQ, 0x00000008},
+#endif
+        {"重庆市", TERRITORY_CN_CQ, 0x08000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_JA)
+        {"重慶市", TERRITORY_CN_CQ, 0x00010000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CN)
+        {"金塔纳罗奥", TERRITORY_MX_ROO, 0x00000008},
+        {"锡那罗亚", TERRITORY_MX_SIN, 0x00000008},
+        {"锡金", TERRITORY_IN_SK, 0x00000008},
+        {"阿克里州", TERRITORY_BR_AC, 0x00000008},
+        {"阿塞拜疆", TERRITORY_AZE, 0x00000008},
+        {"阿富汗", TERRITORY_AFG, 0x00000008},
+        {"阿尔及利亚", TERRITORY_DZA, 0x00000008},
+        {"阿尔巴尼亚", TERRITORY_ALB, 0x00000008},
+        {"阿尔汉格尔斯克州", TERRITORY_RU_ARK, 0x00000008},
+        {"阿尔泰共和国", TERRITORY_RU_AL, 0x00000008},
+        {"阿尔泰边疆区", TERRITORY_RU_ALT, 0x00000008},
+        {"阿拉伯联合酋长国", TERRITORY_ARE, 0x00000008},
+        {"阿拉戈斯州", TERRITORY_BR_AL, 0x00000008},
+        {"阿拉斯加州", TERRITORY_US_AK, 0x00000008},
+        {"阿斯特拉罕州", TERRITORY_RU_AST, 0x00000008},
+        {"阿曼", TERRITORY_OMN, 0x00000008},
+        {"阿根廷", TERRITORY_ARG, 0x00000008},
+        {"阿森松", TERRITORY_SHN, 0x00000008},
+        {"阿瓜斯卡连特斯", TERRITORY_MX_AGU, 0x00000008},
+        {"阿穆尔州", TERRITORY_RU_AMU, 0x00000008},
+        {"阿肯色州", TERRITORY_US_AR, 0x00000008},
+        {"阿萨姆邦", TERRITORY_IN_AS, 0x00000008},
+        {"阿迪格共和国", TERRITORY_RU_AD, 0x00000008},
+        {"阿马帕州", TERRITORY_BR_AP, 0x00000008},
+        {"阿鲁巴", TERRITORY_ABW, 0x00000008},
+        {"阿鲁纳恰尔邦", TERRITORY_IN_AR, 0x00000008},
+        {"陕西", TERRITORY_CN_SN, 0x00000008},
+#endif
+        {"陕西省", TERRITORY_CN_SN, 0x08000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_JA)
+        {"陝西", TERRITORY_CN_SN, 0x00010000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CN)
+        {"雅库特共和国", TERRITORY_RU_SA, 0x00000008},
+        {"雅罗斯拉夫尔州", TERRITORY_RU_YAR, 0x00000008},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_JA)
+        {"雲南", TERRITORY_CN_YN, 0x00010000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CN) || defined(MAPCODE_SUPPORT_LANGUAGE_JA)
+        {"青海", TERRITORY_CN_QH, 0x00010008},
+#endif
+        {"青海省", TERRITORY_CN_QH, 0x08000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CN)
+        {"鞑靼斯坦共和国", TERRITORY_RU_TA, 0x00000008},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_JA)
+        {"韓国", TERRITORY_KOR, 0x00010000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CN)
+        {"韦拉克鲁斯", TERRITORY_MX_VER, 0x00000008},
+        {"韩国", TERRITORY_KOR, 0x00000008},
+#endif
+        {"香港", TERRITORY_HKG, 0x08010008},
+        {"香港特别行政区", TERRITORY_HKG, 0x08000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CN)
+        {"马其顿", TERRITORY_MKD, 0x00000008},
+        {"马加丹州", TERRITORY_RU_MAG, 0x00000008},
+        {"马哈拉施特拉", TERRITORY_IN_MH, 0x00000008},
+        {"马尔代夫", TERRITORY_MDV, 0x00000008},
+        {"马尼托巴", TERRITORY_CA_MB, 0x00000008},
+        {"马恩岛", TERRITORY_IMN, 0x00000008},
+        {"马托格罗索州", TERRITORY_BR_MT, 0x00000008},
+        {"马拉尼昂州", TERRITORY_BR_MA, 0x00000008},
+        {"马拉维", TERRITORY_MWI, 0x00000008},
+        {"马提尼克", TERRITORY_MTQ, 0x00000008},
+#endif
+        {"马来西亚", TERRITORY_MYS, 0x08000008},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_CN)
+        {"马约特", TERRITORY_MYT, 0x00000008},
+        {"马绍尔群岛", TERRITORY_MHL, 0x00000008},
+        {"马耳他", TERRITORY_MLT, 0x00000008},
+        {"马萨诸塞州", TERRITORY_US_MA, 0x00000008},
+        {"马达加斯加", TERRITORY_MDG, 0x00000008},
+        {"马里", TERRITORY_MLI, 0x00000008},
+        {"马里兰州", TERRITORY_US_MD, 0x00000008},
+        {"马里埃尔共和国", TERRITORY_RU_ME, 0x00000008},
+        {"魁北克", TERRITORY_CA_QC, 0x00000008},
+        {"麦克唐纳群岛", TERRITORY_HMD, 0x00000008},
+        {"黎巴嫩", TERRITORY_LBN, 0x00000008},
+        {"黑山", TERRITORY_MNE, 0x00000008},
+        {"黑龙江", TERRITORY_CN_HL, 0x00000008},
+#endif
+        {"黑龙江省", TERRITORY_CN_HL, 0x08000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_JA)
+        {"黒竜江省", TERRITORY_CN_HL, 0x00010000},
+#endif
+#if defined(MAPCODE_SUPPORT_LANGUAGE_KO)
+        {"가나", TERRITORY_GHA, 0x00020000},
+        {"가봉", TERRITORY_GAB, 0x00020000},
+        {"가이아나", TERRITORY_GUY, 0x00020000},
+        {"간쑤", TERRITORY_CN_GS, 0x00020000},
+        {"감비아", TERRITORY_GMB, 0x00020000},
+        {"강소", TERRITORY_CN_JS, 0x00020000},
+        {"건지 섬", TERRITORY_GGY, 0x00020000},
+        {"게레로", TERRITORY_MX_GRO, 0x00020000},
+        {"고아", TERRITORY_IN_GA, 0x00020000},
+        {"고이 아스", TERRITORY_BR_GO, 0x00020000},
+        {"과 나후 아토", TERRITORY_MX_GUA, 0x00020000},
+        {"과들루프", TERRITORY_GLP, 0x00020000},
+        {"과테말라", TERRITORY_GTM, 0x00020000},
+        {"괌", TERRITORY_GUM, 0x00020000},
+        {"광동", TERRITORY_CN_GD, 0x00020000},
+        {"광시 좡어", TERRITORY_CN_GX, 0x00020000},
+        {"교황청", TERRITORY_VAT, 0x00020000},
+        {"구이 저우", TERRITORY_CN_GZ, 0x00020000},
+        {"구자라트", TERRITORY_IN_GJ, 0x00020000},
+        {"국제", TERRITORY_AAA, 0x00020000},
+        {"그레나다", TERRITORY_GRD, 0x00020000},
+        {"그레나딘", TERRITORY_VCT, 0x00020000},
+        {"그리스", TERRITORY_GRC, 0x00020000},
+        {"그린란드", TERRITORY_GRL, 0x00020000},
+        {"기니", TERRITORY_GIN, 0x00020000},
+        {"기니비사우", TERRITORY_GNB, 0x00020000},
+        {"길림", TERRITORY_CN_JL, 0x00020000},
+        {"나갈 랜드", TERRITORY_IN_NL, 0x00020000},
+        {"나미비아", TERRITORY_NAM, 0x00020000},
+        {"나야 릿", TERRITORY_MX_NAY, 0x00020000},
+        {"나우루", TERRITORY_NRU, 0x00020000},
+        {"나이지리아", TERRITORY_NGA, 0x00020000},
+        {"남극", TERRITORY_ATA, 0x00020000},
+        {"남수단", TERRITORY_SSD, 0x00020000},
+        {"남아프리카 공화국", TERRITORY_ZAF, 0x00020000},
+        {"내몽골", TERRITORY_CN_NM, 0x00020000},
+        {"네 네츠 자치구", TERRITORY_RU_NEN, 0x00020000},
+        {"네덜란드", TERRITORY_NLD, 0x00020000},
+        {"네바다", TERRITORY_US_NV, 0x00020000},
+        {"네브래스카", TERRITORY_US_NE, 0x00020000},
+        {"네비스", TERRITORY_KNA, 0x00020000},
+        {"네이 몽골", TERRITORY_CN_NM, 0x00020000},
+        {"네팔", TERRITORY_NPL, 0x00020000},
+        {"노던 테리토리", TERRITORY_AU_NT, 0x00020000},
+        {"노라", TERRITORY_MX_SON, 0x00020000},
+        {"노르웨이", TERRITORY_NOR, 0x00020000},
+        {"노바 스코샤", TERRITORY_CA_NS, 0x00020000},
+        {"노보시비르스크 주", TERRITORY_RU_NVS, 0x00020000},
+        {"노브 고로드 주", TERRITORY_RU_NGR, 0x00020000},
+        {"노스 웨스트 준주", TERRITORY_CA_NT, 0x00020000},
+        {"노스다코타", TERRITORY_US_ND, 0x00020000},
+        {"노스캐롤라이나", TERRITORY_US_NC, 0x00020000},
+        {"노퍽 섬", TERRITORY_NFK, 0x00020000},
+        {"누나 부트 준주", TERRITORY_CA_NU, 0x00020000},
+        {"누벨칼레도니", TERRITORY_NCL, 0x00020000},
+        {"누에 보 레온", TERRITORY_MX_NLE, 0x00020000},
+        {"뉴 브런 즈윅", TERRITORY_CA_NB, 0x00020000},
+        {"뉴 사우스 웨일즈", TERRITORY_AU_NSW, 0x00020000},
+        {"뉴 칼레도니아", TERRITORY_NCL, 0x00020000},
+        {"뉴 펀들 랜드", TERRITORY_CA_NL, 0x00020000},
+        {"뉴멕시코", TERRITORY_US_NM, 0x00020000},
+        {"뉴욕", TERRITORY_US_NY, 0x00020000},
+        {"뉴저지", TERRITORY_US_NJ, 0x00020000},
+        {"뉴질랜드", TERRITORY_NZL, 0x00020000},
+        {"뉴햄프셔", TERRITORY_US_NH, 0x00020000},
+        {"니우에", TERRITORY_NIU, 0x00020000},
+        {"니제르", TERRITORY_NER, 0x00020000},
+        {"니즈니 노브 고로드 주", TERRITORY_RU_NIZ, 0x00020000},
+        {"니카라과", TERRITORY_NIC, 0x00020000},
+        {"닝샤 후이족", TERRITORY_CN_NX, 0x00020000},
+        {"다 드라 나가르 하 벨리", TERRITORY_IN_DN, 0x00020000},
+        {"다게 스탄 공화국", TERRITORY_RU_DA, 0x00020000},
+        {"다만 디우", TERRITORY_IN_DD, 0x00020000},
+#endif
+        {"대한민국", TERRITORY_KOR, 0x08020000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_KO)
+        {"덴마크", TERRITORY_DNK, 0x00020000},
+        {"델라웨어", TERRITORY_US_DE, 0x00020000},
+        {"델리", TERRITORY_IN_DL, 0x00020000},
+        {"도미니카 공화국", TERRITORY_DOM, 0x00020000},
+        {"도미니카 연방", TERRITORY_DMA, 0x00020000},
+        {"독일", TERRITORY_DEU, 0x00020000},
+        {"동티모르", TERRITORY_TLS, 0x00020000},
+        {"두 랑고", TERRITORY_MX_DUR, 0x00020000},
+        {"디스트 리토 페데 랄", TERRITORY_BR_DF, 0x00020000},
+        {"라오스", TERRITORY_LAO, 0x00020000},
+        {"라이베리아", TERRITORY_LBR, 0x00020000},
+        {"라자스탄", TERRITORY_IN_RJ, 0x00020000},
+        {"라트비아", TERRITORY_LVA, 0x00020000},
+        {"락 샤드 윕", TERRITORY_IN_LD, 0x00020000},
+        {"랴오닝", TERRITORY_CN_LN, 0x00020000},
+        {"랴잔 주", TERRITORY_RU_RYA, 0x00020000},
+        {"러시아", TERRITORY_RUS, 0x00020000},
+        {"레닌 그라드 주", TERRITORY_RU_LEN, 0x00020000},
+        {"레바논", TERRITORY_LBN, 0x00020000},
+        {"레소토", TERRITORY_LSO, 0x00020000},
+        {"레위니옹", TERRITORY_REU, 0x00020000},
+        {"로드아일랜드", TERRITORY_US_RI, 0x00020000},
+        {"로라 이마", TERRITORY_BR_RR, 0x00020000},
+        {"로스토프 주", TERRITORY_RU_ROS, 0x00020000},
+        {"론도", TERRITORY_BR_RO, 0x00020000},
+        {"루마니아", TERRITORY_ROU, 0x00020000},
+        {"루이지애나", TERRITORY_US_LA, 0x00020000},
+        {"룩셈부르크", TERRITORY_LUX, 0x00020000},
+        {"르완다", TERRITORY_RWA, 0x00020000},
+        {"리비아", TERRITORY_LBY, 0x00020000},
+        {"리오 그란데 노르 테", TERRITORY_BR_RN, 0x00020000},
+        {"리오 그란데도 술을", TERRITORY_BR_RS, 0x00020000},
+        {"리오 데 자네이로", TERRITORY_BR_RJ, 0x00020000},
+        {"리투아니아", TERRITORY_LTU, 0x00020000},
+        {"리페 츠크 주", TERRITORY_RU_LIP, 0x00020000},
+        {"리히텐슈타인", TERRITORY_LIE, 0x00020000},
+        {"마가 단 주", TERRITORY_RU_MAG, 0x00020000},
+        {"마니 푸르", TERRITORY_IN_MN, 0x00020000},
+        {"마다가스카르", TERRITORY_MDG, 0x00020000},
+        {"마디 아 프라데시", TERRITORY_IN_MP, 0x00020000},
+        {"마라 냐웅", TERRITORY_BR_MA, 0x00020000},
+        {"마르티니크", TERRITORY_MTQ, 0x00020000},
+        {"마리 엘 공화국", TERRITORY_RU_ME, 0x00020000},
+        {"마셜 제도", TERRITORY_MHL, 0x00020000},
+        {"마요트", TERRITORY_MYT, 0x00020000},
+        {"마카오", TERRITORY_MAC, 0x00020000},
+        {"마케도니아 공화국", TERRITORY_MKD, 0x00020000},
+        {"마투 그로 수", TERRITORY_BR_MT, 0x00020000},
+        {"마투 그로 수두 술 주", TERRITORY_BR_MS, 0x00020000},
+        {"마하라 슈트라", TERRITORY_IN_MH, 0x00020000},
+        {"말라위", TERRITORY_MWI, 0x00020000},
+        {"말레이시아", TERRITORY_MYS, 0x00020000},
+        {"말리", TERRITORY_MLI, 0x00020000},
+        {"매니토바", TERRITORY_CA_MB, 0x00020000},
+        {"매사추세츠", TERRITORY_US_MA, 0x00020000},
+        {"맨 섬", TERRITORY_IMN, 0x00020000},
+        {"메갈 라야", TERRITORY_IN_ML, 0x00020000},
+        {"메릴랜드", TERRITORY_US_MD, 0x00020000},
+        {"메인", TERRITORY_US_ME, 0x00020000},
+        {"멕시코", TERRITORY_MEX, 0x00020000},
+        {"멕시코 주", TERRITORY_MX_MX, 0x00020000},
+        {"모나코", TERRITORY_MCO, 0x00020000},
+        {"모렐 로스", TERRITORY_MX_MOR, 0x00020000},
+        {"모로코", TERRITORY_MAR, 0x00020000},
+        {"모르도 바 공화국", TERRITORY_RU_MO, 0x00020000},
+        {"모리셔스", TERRITORY_MUS, 0x00020000},
+        {"모리타니", TERRITORY_MRT, 0x00020000},
+        {"모스크바", TERRITORY_RU_MOW, 0x00020000},
+        {"모스크바 주", TERRITORY_RU_MOS, 0x00020000},
+        {"모잠비크", TERRITORY_MOZ, 0x00020000},
+        {"몬태나", TERRITORY_US_MT, 0x00020000},
+        {"몬테네그로", TERRITORY_MNE, 0x00020000},
+        {"몬트세랫", TERRITORY_MSR, 0x00020000},
+        {"몰도바", TERRITORY_MDA, 0x00020000},
+        {"몰디브", TERRITORY_MDV, 0x00020000},
+        {"몰타", TERRITORY_MLT, 0x00020000},
+        {"몽골", TERRITORY_MNG, 0x00020000},
+        {"무르만스크 주", TERRITORY_RU_MUR, 0x00020000},
+        {"미국", TERRITORY_USA, 0x00020000},
+        {"미국령 군소 제도", TERRITORY_UMI, 0x00020000},
+        {"미국령 버진아일랜드", TERRITORY_VIR, 0x00020000},
+        {"미나스 제 라이스", TERRITORY_BR_MG, 0x00020000},
+        {"미네소타", TERRITORY_US_MN, 0x00020000},
+        {"미시간", TERRITORY_US_MI, 0x00020000},
+        {"미시시피", TERRITORY_US_MS, 0x00020000},
+        {"미얀마", TERRITORY_MMR, 0x00020000},
+        {"미조람", TERRITORY_IN_MZ, 0x00020000},
+        {"미주리", TERRITORY_US_MO, 0x00020000},
+        {"미초 아깐", TERRITORY_MX_MIC, 0x00020000},
+        {"미크로네시아 연방", TERRITORY_FSM, 0x00020000},
+        {"바누아투", TERRITORY_VUT, 0x00020000},
+        {"바레인", TERRITORY_BHR, 0x00020000},
+        {"바베이도스", TERRITORY_BRB, 0x00020000},
+        {"바부 다", TERRITORY_ATG, 0x00020000},
+        {"바시 키르 공화국", TERRITORY_RU_BA, 0x00020000},
+        {"바이아", TERRITORY_BR_BA, 0x00020000},
+        {"바티칸 시국", TERRITORY_VAT, 0x00020000},
+        {"바하 칼리 포르 니아 수르", TERRITORY_MX_BCS, 0x00020000},
+        {"바하 캘리포니아", TERRITORY_MX_BCN, 0x00020000},
+        {"바하마", TERRITORY_BHS, 0x00020000},
+        {"방글라데시", TERRITORY_BGD, 0x00020000},
+        {"버마", TERRITORY_MMR, 0x00020000},
+        {"버몬트", TERRITORY_US_VT, 0x00020000},
+        {"버뮤다", TERRITORY_BMU, 0x00020000},
+        {"버지니아", TERRITORY_US_VA, 0x00020000},
+        {"버진아일랜드 미국령", TERRITORY_VIR, 0x00020000},
+        {"버진아일랜드 영국령", TERRITORY_VGB, 0x00020000},
+        {"베냉", TERRITORY_BEN, 0x00020000},
+        {"베네수엘라", TERRITORY_VEN, 0x00020000},
+        {"베라 크루즈", TERRITORY_MX_VER, 0x00020000},
+        {"베이징", TERRITORY_CN_BJ, 0x00020000},
+        {"베트남", TERRITORY_VNM, 0x00020000},
+        {"벨고로드 주", TERRITORY_RU_BE, 0x00020000},
+        {"벨기에", TERRITORY_BEL, 0x00020000},
+        {"벨라루스", TERRITORY_BLR, 0x00020000},
+        {"벨리즈", TERRITORY_BLZ, 0x00020000},
+        {"보 로네시 주", TERRITORY_RU_VOR, 0x00020000},
+        {"보네르, 세인트 유스 타티 우스 및 사바", TERRITORY_BES, 0x00020000},
+        {"보스니아 헤르체고비나", TERRITORY_BIH, 0x00020000},
+        {"보츠와나", TERRITORY_BWA, 0x00020000},
+        {"복건", TERRITORY_CN_FJ, 0x00020000},
+        {"볼 로그 다 주", TERRITORY_RU_VLG, 0x00020000},
+        {"볼고그라드 주", TERRITORY_RU_VGG, 0x00020000},
+        {"볼리비아", TERRITORY_BOL, 0x00020000},
+        {"부랴 트 공화국", TERRITORY_RU_BU, 0x00020000},
+        {"부룬디", TERRITORY_BDI, 0x00020000},
+        {"부르키나파소", TERRITORY_BFA, 0x00020000},
+        {"부베 섬", TERRITORY_BVT, 0x00020000},
+        {"부탄", TERRITORY_BTN, 0x00020000},
+        {"북 아일랜드", TERRITORY_GBR, 0x00020000},
+        {"북마리아나 제도", TERRITORY_MNP, 0x00020000},
+        {"불가리아", TERRITORY_BGR, 0x00020000},
+        {"브라질", TERRITORY_BRA, 0x00020000},
+        {"브랸 스크 주", TERRITORY_RU_BRY, 0x00020000},
+        {"브루나이", TERRITORY_BRN, 0x00020000},
+        {"브리티시 컬럼비아", TERRITORY_CA_BC, 0x00020000},
+        {"블라디미르 주", TERRITORY_RU_VLA, 0x00020000},
+        {"비하르", TERRITORY_IN_BR, 0x00020000},
+        {"빅토리아", TERRITORY_AU_VIC, 0x00020000},
+        {"사 카테 카스", TERRITORY_MX_ZAC, 0x00020000},
+        {"사라 토프 주", TERRITORY_RU_SAR, 0x00020000},
+        {"사마라 주", TERRITORY_RU_SAM, 0x00020000},
+        {"사모아", TERRITORY_WSM, 0x00020000},
+        {"사바", TERRITORY_BES, 0x00020000},
+        {"사우디아라비아", TERRITORY_SAU, 0x00020000},
+        {"사우스 샌드위치 제도", TERRITORY_SGS, 0x00020000},
+        {"사우스 오스트레일리아", TERRITORY_AU_SA, 0x00020000},
+        {"사우스다코타", TERRITORY_US_SD, 0x00020000},
+        {"사우스조지아 및 사우스 샌드위치 제도", TERRITORY_SGS, 0x00020000},
+        {"사우스캐롤라이나", TERRITORY_US_SC, 0x00020000},
+        {"사하 공화국", TERRITORY_RU_SA, 0x00020000},
+        {"사할린 주", TERRITORY_RU_SAK, 0x00020000},
+        {"산 루이스 포토", TERRITORY_MX_SLP, 0x00020000},
+        {"산동", TERRITORY_CN_SD, 0x00020000},
+        {"산마리노", TERRITORY_SMR, 0x00020000},
+        {"산서", TERRITORY_CN_SX, 0x00020000},
+        {"산시", TERRITORY_CN_SN, 0x00020000},
+        {"산타 카타리나", TERRITORY_BR_SC, 0x00020000},
+        {"상 파울로", TERRITORY_BR_SP, 0x00020000},
+        {"상투메 프린시페", TERRITORY_STP, 0x00020000},
+        {"상트 페테르부르크", TERRITORY_RU_SPE, 0x00020000},
+        {"상하이", TERRITORY_CN_SH, 0x00020000},
+        {"생바르텔레미", TERRITORY_BLM, 0x00020000},
+        {"생피에르 미클롱", TERRITORY_SPM, 0x00020000},
+        {"서부 사하라", TERRITORY_ESH, 0x00020000},
+        {"서스 캐처 원", TERRITORY_CA_SK, 0x00020000},
+        {"서장", TERRITORY_CN_XZ, 0x00020000},
+        {"세 베로 오 세티 야 공화국 공화국", TERRITORY_RU_SE, 0x00020000},
+        {"세계", TERRITORY_AAA, 0x00020000},
+        {"세네갈", TERRITORY_SEN, 0x00020000},
+        {"세르 지페", TERRITORY_BR_SE, 0x00020000},
+        {"세르비아", TERRITORY_SRB, 0x00020000},
+        {"세이셸", TERRITORY_SYC, 0x00020000},
+        {"세인트 마틴", TERRITORY_MAF, 0x00020000},
+        {"세인트 유스 타티 우스", TERRITORY_BES, 0x00020000},
+        {"세인트루시아", TERRITORY_LCA, 0x00020000},
+        {"세인트빈센트 그레나딘", TERRITORY_VCT, 0x00020000},
+        {"세인트키츠 네비스", TERRITORY_KNA, 0x00020000},
+        {"세인트헬레나, 승천과 트리스탄 다 쿠냐", TERRITORY_SHN, 0x00020000},
+        {"소말리아", TERRITORY_SOM, 0x00020000},
+        {"솔로몬 제도", TERRITORY_SLB, 0x00020000},
+        {"수단", TERRITORY_SDN, 0x00020000},
+        {"수리남", TERRITORY_SUR, 0x00020000},
+        {"스 베르들 롭 스크 주", TERRITORY_RU_SVE, 0x00020000},
+        {"스리랑카", TERRITORY_LKA, 0x00020000},
+        {"스몰 렌 스크 주", TERRITORY_RU_SMO, 0x00020000},
+        {"스발바르 얀마옌", TERRITORY_SJM, 0x00020000},
+        {"스와질란드", TERRITORY_SWZ, 0x00020000},
+        {"스웨덴", TERRITORY_SWE, 0x00020000},
+        {"스위스", TERRITORY_CHE, 0x00020000},
+        {"스코틀랜드", TERRITORY_GBR, 0x00020000},
+        {"스타 브로 폴 크라이", TERRITORY_RU_STA, 0x00020000},
+        {"스페인", TERRITORY_ESP, 0x00020000},
+        {"슬로바키아", TERRITORY_SVK, 0x00020000},
+        {"슬로베니아", TERRITORY_SVN, 0x00020000},
+        {"승천", TERRITORY_SHN, 0x00020000},
+        {"시날로아", TERRITORY_MX_SIN, 0x00020000},
+        {"시리아", TERRITORY_SYR, 0x00020000},
+        {"시에라리온", TERRITORY_SLE, 0x00020000},
+        {"시킴", TERRITORY_IN_SK, 0x00020000},
+        {"신장 위구르어", TERRITORY_CN_XJ, 0x00020000},
+        {"신트마르턴", TERRITORY_SXM, 0x00020000},
+        {"싱가포르", TERRITORY_SGP, 0x00020000},
+        {"쓰촨", TERRITORY_CN_SC, 0x00020000},
+        {"아과 스 칼리 엔 테스", TERRITORY_MX_AGU, 0x00020000},
+        {"아디 게야 공화국", TERRITORY_RU_AD, 0x00020000},
+        {"아라", TERRITORY_BR_CE, 0x00020000},
+        {"아랍에미리트", TERRITORY_ARE, 0x00020000},
+        {"아루나 찰 프라데시", TERRITORY_IN_AR, 0x00020000},
+        {"아루바", TERRITORY_ABW, 0x00020000},
+        {"아르 한 겔 스크 주", TERRITORY_RU_ARK, 0x00020000},
+        {"아르메니아", TERRITORY_ARM, 0x00020000},
+        {"아르헨티나", TERRITORY_ARG, 0x00020000},
+        {"아마 조나스", TERRITORY_BR_AM, 0x00020000},
+        {"아마 파", TERRITORY_BR_AP, 0x00020000},
+        {"아메리칸사모아", TERRITORY_ASM, 0x00020000},
+        {"아무르 주", TERRITORY_RU_AMU, 0x00020000},
+        {"아삼", TERRITORY_IN_AS, 0x00020000},
+        {"아스트라한 주", TERRITORY_RU_AST, 0x00020000},
+        {"아이다호", TERRITORY_US_ID, 0x00020000},
+        {"아이슬란드", TERRITORY_ISL, 0x00020000},
+        {"아이오와", TERRITORY_US_IA, 0x00020000},
+        {"아이티", TERRITORY_HTI, 0x00020000},
+        {"아일랜드", TERRITORY_IRL, 0x00020000},
+        {"아일랜드, 북", TERRITORY_GBR, 0x00020000},
+        {"아제르바이잔", TERRITORY_AZE, 0x00020000},
+        {"아칸소", TERRITORY_US_AR, 0x00020000},
+        {"아크리 주", TERRITORY_BR_AC, 0x00020000},
+        {"아프가니스탄", TERRITORY_AFG, 0x00020000},
+        {"안다만 니코 바르", TERRITORY_IN_AN, 0x00020000},
+        {"안도라", TERRITORY_AND, 0x00020000},
+        {"안드라 프라데시", TERRITORY_IN_AP, 0x00020000},
+        {"안후이", TERRITORY_CN_AH, 0x00020000},
+        {"알라고 아스", TERRITORY_BR_AL, 0x00020000},
+        {"알래스카", TERRITORY_US_AK, 0x00020000},
+        {"알바니아", TERRITORY_ALB, 0x00020000},
+        {"알제리", TERRITORY_DZA, 0x00020000},
+        {"알타이 공화국", TERRITORY_RU_AL, 0x00020000},
+        {"알타이 크라이", TERRITORY_RU_ALT, 0x00020000},
+        {"앙골라", TERRITORY_AGO, 0x00020000},
+        {"애리조나", TERRITORY_US_AZ, 0x00020000},
+        {"앤티가 바부 다", TERRITORY_ATG, 0x00020000},
+        {"앨라배마", TERRITORY_US_AL, 0x00020000},
+        {"앨버타", TERRITORY_CA_AB, 0x00020000},
+        {"앵귈라", TERRITORY_AIA, 0x00020000},
+        {"야로 슬라 블 주", TERRITORY_RU_YAR, 0x00020000},
+        {"야말로 - 네 네츠", TERRITORY_RU_YAN, 0x00020000},
+        {"야쿠 티아 공화국", TERRITORY_RU_SA, 0x00020000},
+        {"얀마옌", TERRITORY_SJM, 0x00020000},
+        {"에리트레아", TERRITORY_ERI, 0x00020000},
+        {"에스토니아", TERRITORY_EST, 0x00020000},
+        {"에스피 리토 산토", TERRITORY_BR_ES, 0x00020000},
+        {"에콰도르", TERRITORY_ECU, 0x00020000},
+        {"에티오피아", TERRITORY_ETH, 0x00020000},
+        {"엘살바도르", TERRITORY_SLV, 0x00020000},
+        {"연방 지구", TERRITORY_MX_DIF, 0x00020000},
+        {"영국", TERRITORY_GBR, 0x00020000},
+        {"영국령 버진아일랜드", TERRITORY_VGB, 0x00020000},
+        {"영국령 인도양 지역", TERRITORY_IOT, 0x00020000},
+        {"예멘", TERRITORY_YEM, 0x00020000},
+        {"오렌 부르크 주", TERRITORY_RU_ORE, 0x00020000},
+        {"오룔 주", TERRITORY_RU_ORL, 0x00020000},
+        {"오리", TERRITORY_IN_OR, 0x00020000},
+        {"오리건", TERRITORY_US_OR, 0x00020000},
+        {"오리사 주", TERRITORY_IN_OR, 0x00020000},
+        {"오만", TERRITORY_OMN, 0x00020000},
+        {"오스트레일리아", TERRITORY_AUS, 0x00020000},
+        {"오스트리아", TERRITORY_AUT, 0x00020000},
+        {"오악 사카", TERRITORY_MX_OAX, 0x00020000},
+        {"오클라호마", TERRITORY_US_OK, 0x00020000},
+        {"오하이오", TERRITORY_US_OH, 0x00020000},
+        {"온두라스", TERRITORY_HND, 0x00020000},
+        {"온타리오", TERRITORY_CA_ON, 0x00020000},
+        {"올란드 제도", TERRITORY_ALA, 0x00020000},
+        {"옴 스크 주", TERRITORY_RU_OMS, 0x00020000},
+        {"와이오밍", TERRITORY_US_WY, 0x00020000},
+        {"요르단", TERRITORY_JOR, 0x00020000},
+        {"우간다", TERRITORY_UGA, 0x00020000},
+        {"우드 무 르트 공화국", TERRITORY_RU_UD, 0x00020000},
+        {"우루과이", TERRITORY_URY, 0x00020000},
+        {"우즈베키스탄", TERRITORY_UZB, 0x00020000},
+        {"우크라이나", TERRITORY_UKR, 0x00020000},
+        {"우타 라칸", TERRITORY_IN_UT, 0x00020000},
+        {"우타르 프라데시", TERRITORY_IN_UP, 0x00020000},
+        {"운남", TERRITORY_CN_YN, 0x00020000},
+        {"울리 야놉 스크 주", TERRITORY_RU_ULY, 0x00020000},
+        {"워싱턴", TERRITORY_US_WA, 0x00020000},
+        {"워싱턴 d.c.", TERRITORY_US_DC, 0x00020000},
+        {"월리스 푸투나", TERRITORY_WLF, 0x00020000},
+        {"웨스턴 오스트레일리아", TERRITORY_AU_WA, 0x00020000},
+        {"웨스트 벵갈", TERRITORY_IN_WB, 0x00020000},
+        {"웨스트버지니아", TERRITORY_US_WV, 0x00020000},
+        {"위스콘신", TERRITORY_US_WI, 0x00020000},
+        {"유대인 자치주", TERRITORY_RU_YEV, 0x00020000},
+        {"유카탄", TERRITORY_MX_YUC, 0x00020000},
+        {"유콘", TERRITORY_CA_YT, 0x00020000},
+        {"유타", TERRITORY_US_UT, 0x00020000},
+        {"이달고 주", TERRITORY_MX_HID, 0x00020000},
+        {"이라크", TERRITORY_IRQ, 0x00020000},
+        {"이란", TERRITORY_IRN, 0x00020000},
+        {"이르쿠츠크 주", TERRITORY_RU_IRK, 0x00020000},
+        {"이바노 보 주", TERRITORY_RU_IVA, 0x00020000},
+        {"이스라엘", TERRITORY_ISR, 0x00020000},
+        {"이집트", TERRITORY_EGY, 0x00020000},
+        {"이탈리아", TERRITORY_ITA, 0x00020000},
+        {"인도", TERRITORY_IND, 0x00020000},
+        {"인도네시아", TERRITORY_IDN, 0x00020000},
+        {"인디애나", TERRITORY_US_IN, 0x00020000},
+        {"일리노이", TERRITORY_US_IL, 0x00020000},
+        {"일본", TERRITORY_JPN, 0x00020000},
+        {"잉 구세 티아 공화국", TERRITORY_RU_IN, 0x00020000},
+        {"자메이카", TERRITORY_JAM, 0x00020000},
+        {"잠비아", TERRITORY_ZMB, 0x00020000},
+        {"장시", TERRITORY_CN_JX, 0x00020000},
+        {"저비스 베이 준주", TERRITORY_AU_JBT, 0x00020000},
+        {"저지 섬", TERRITORY_JEY, 0x00020000},
+        {"적도 기니", TERRITORY_GNQ, 0x00020000},
+        {"절강", TERRITORY_CN_ZJ, 0x00020000},
+#endif
+        {"조선 민주주의 인민 공화국", TERRITORY_PRK, 0x08000000},
+#if defined(MAPCODE_SUPPORT_LANGUAGE_KO)
+        {"조선민주주의인민공화국", TERRITORY_PRK, 0x00020000},
+        {"조지아", TERRITORY_GEO, 0x00020000},
+        {"조지아", TERRITORY_US_GA, 0x00020000},
+        {"중국", TERRITORY_CHN, 0x00020000},
+        {"중앙아프리카 공화국", TERRITORY_CAF, 0x00020000},
+        {"즈 하르 한드", TERRITORY_IN_JH, 0x00020000},
+        {"지구", TERRITORY_AAA, 0x00020000},
+        {"지부티", TERRITORY_DJI, 0x00020000},
+        {"지브롤터", TERRITORY_GIB, 0x00020000},
+        {"짐바브웨", TERRITORY_ZWE, 0x00020000},
+        {"차 티스 가르", TERRITORY_IN_CT, 0x00020000},
+        {"차드", TERRITORY_TCD, 0x00020000},
+        {"찬디 가르", TERRITORY_IN_CH, 0x00020000},
+        {"천진", TERRITORY_CN_TJ, 0x00020000},
+        {"체첸어 공화국", TERRITORY_RU_CE, 0x00020000},
+        {"체코", TERRITORY_CZE, 0x00020000},
+        {"첼 랴빈 스크 주", TERRITORY_RU_CH, 0x00020000},
+        {"추 코트 카 자치구", TERRITORY_RU_CHU, 0x00020000},
+        {"추바슈어 공화국", TERRITORY_RU_CU, 0x00020000},
+        {"충칭", TERRITORY_CN_CQ, 0x00020000},
+        {"치아파스", TERRITORY_MX_CHP, 0x00020000},
+        {"치와와", TERRITORY_MX_CHH, 0x00020000},
+        {"치타 지역", TERRITORY_RU_ZAB, 0x00020000},
+        {"칠레", TERRITORY_CHL, 0x00020000},
+        {"칭하이", TERRITORY_CN_QH, 0x00020000},
+        {"카 바르 디노 발 카르 공화국", TERRITORY_RU_KB, 0x00020000},
+        {"카라 차 예보 체르 케스 카야 공화국", TERRITORY_RU_KC, 0x00020000},
+        {"카렐 리야 공화국", TERRITORY_RU_KR, 0x00020000},
+        {"카르 나 타카", TERRITORY_IN_KA, 0x00020000},
+        {"카메룬", TERRITORY_CMR, 0x00020000},
+        {"카보베르데", TERRITORY_CPV, 0x00020000},
+        {"카슈미르", TERRITORY_IN_JK, 0x00020000},
+        {"카자흐스탄", TERRITORY_KAZ, 0x00020000},
+        {"카타르", TERRITORY_QAT, 0x00020000},
+        {"칼 미크 공화국", TERRITORY_RU_KL, 0x00020000},
+        {"칼루가 주", TERRITORY_RU_KLU, 0x00020000},
+        {"칼리닌그라드 주", TERRITORY_RU_KGD, 0x00020000},
+        {"캄 페체", TERRITORY_MX_CAM, 0x00020000},
+        {"캄보디아", TERRITORY_KHM, 0x00020000},
+        {"캄차카 지방", TERRITORY_RU_KAM, 0x00020000},
+        {"캐나다", TERRITORY_CAN, 0x00020000},
+        {"캔자스", TERRITORY_US_KS, 0x00020000},
+        {"캘리포니아", TERRITORY_US_CA, 0x00020000},
+        {"케 랄라", TERRITORY_IN_KL, 0x00020000},
+        {"케 레타로", TERRITORY_MX_QUE, 0x00020000},
+        {"케냐", TERRITORY_KEN, 0x00020000},
+        {"케메 로보 주", TERRITORY_RU_KEM, 0x00020000},
+        {"케이맨 제도", TERRITORY_CYM, 0x00020000},
+        {"켄터키", TERRITORY_US_KY, 0x00020000},
+        {"코네티컷", TERRITORY_US_CT, 0x00020000},
+        {"코모로", TERRITORY_COM, 0x00020000},
+        {"코미 공화국", TERRITORY_RU_KO, 0x00020000},
+        {"코스타리카", TERRITORY_CRI, 0x00020000},
+        {"코스트 로마 주", TERRITORY_RU_KOS, 0x00020000},
+        {"코아 우일", TERRITORY_MX_COA, 0x00020000},
+        {"코코스 제도", TERRITORY_CCK, 0x00020000},
+        {"코트디부아르", TERRITORY_CIV, 0x00020000},
+        {"콜로라도", TERRITORY_US_CO, 0x00020000},
+        {"콜롬비아", TERRITORY_COL, 0x00020000},
+        {"콜리 마", TERRITORY_MX_CL, 0x00020000},
+        {"콩고 공화국", TERRITORY_COG, 0x00020000},
+        {"콩고 민주 공화국", TERRITORY_COD, 0x00020000},
+        {"쿠 르간 주", TERRITORY_RU_KGN, 0x00020000},
+        {"쿠라 카오", TERRITORY_CUW, 0x00020000},
+        {"쿠르스크 주", TERRITORY_RU_KRS, 0x00020000},
+        {"쿠바", TERRITORY_CUB, 0x00020000},
+        {"쿠웨이트", TERRITORY_KWT, 0x00020000},
+        {"쿡 제도", TERRITORY_COK, 0x00020000},
+        {"퀘벡", TERRITORY_CA_QC, 0x00020000},
+        {"퀸즐랜드", TERRITORY_AU_QLD, 0x00020000},
+        {"크라 스노 다르 크라이", TERRITORY_RU_KDA, 0x00020000},
+        {"크라스 노야 르 스크 크라이", TERRITORY_RU_KYA, 0x00020000},
+        {"크로아티아", TERRITORY_HRV, 0x00020000},
+        {"크리스마스 섬", TERRITORY_CXR, 0x00020000},
+        {"클리퍼 턴 섬", TERRITORY_CPT, 0x00020000},
+        {"키로프 주", TERRITORY_RU_KI, 0x00020000},
+        {"키르기스스탄", TERRITORY_KGZ, 0x00020000},
+        {"키리바시", TERRITORY_KIR, 0x00020000},
+        {"키프로스", TERRITORY_CYP, 0x00020000},
+        {"킨 타나로", TERRITORY_MX_ROO, 0x00020000},
+        {"킬링 제도", TERRITORY_CCK, 0x00020000},
+        {"타마 울리 파스", TERRITORY_MX_TAM, 0x00020000},
+        {"타밀 나두", TERRITORY_IN_TN, 0x00020000},
+        {"타바스코", TERRITORY_MX_TAB, 0x00020000},
+        {"타이완", TERRITORY_TWN, 0x00020000},
+        {"타지키스탄", TERRITORY_TJK, 0x00020000},
+        {"타타르 공화국", TERRITORY_RU_TA, 0x00020000},
+        {"탄자니아", TERRITORY_TZA, 0x00020000},
+        {"탐 보프 주", TERRITORY_RU_TT, 0x00020000},
+        {"태국", TERRITORY_THA, 0x00020000},
+        {"태즈 메이 니아", TERRITORY_AU_TAS, 0x00020000},
+        {"터크스 케이커스 제도", TERRITORY_TCA, 0x00020000},
+        {"터키", TERRITORY_TUR, 0x00020000},
+        {"테네시", TERRITORY_US_TN, 0x00020000},
+        {"텍사스", TERRITORY_US_TX, 0x00020000},
+        {"텔랑 가나 주", TERRITORY_IN_TG, 0x00020000},
+        {"토고", TERRITORY_TGO, 0x00020000},
+        {"토칸 틴스", TERRITORY_BR_TO, 0x00020000},
+        {"토켈라우", TERRITORY_TKL, 0x00020000},
+        {"톰 스크 주", TERRITORY_RU_TOM, 0x00020000},
+        {"통가", TERRITORY_TON, 0x00020000},
+        {"투르크메니스탄", TERRITORY_TKM, 0x00020000},
+        {"투바 공화국", TERRITORY_RU_TY, 0x00020000},
+        {"투발루", TERRITORY_TUV, 0x00020000},
+        {"툴라 주", TERRITORY_RU_TUL, 0x00020000},
+        {"튀니지", TERRITORY_TUN, 0x00020000},
+        {"튜멘 주", TERRITORY_RU_TYU, 0x00020000},
+        {"트 베리 주", TERRITORY_RU_TVE, 0x00020000},
+        {"트리 푸라", TERRITORY_IN_TR, 0x00020000},
+        {"트리니다드 토바고", TERRITORY_TTO, 0x00020000},
+        {"트리스탄 다 쿠냐", TERRITORY_SHN, 0x00020000},
+        {"틀 락스 칼라", TERRITORY_MX_TLA, 0x00020000},
+        {"티베트", TERRITORY_CN_XZ, 0x00020000},
+        {"파나마", TERRITORY_PAN, 0x00020000},
+        {"파라", TERRITORY_BR_PA, 0x00020000},
+        {"파라과이", TERRITORY_PRY, 0x00020000},
+        {"파라나", TERRITORY_BR_PR, 0x00020000},
+        {"파라이", TERRITORY_BR_PB, 0x00020000},
+        {"파키스탄", TERRITORY_PAK, 0x00020000},
+        {"파푸아뉴기니", TERRITORY_PNG, 0x00020000},
+        {"팔라우", TERRITORY_PLW, 0x00020000},
+        {"팔레스타인 자치", TERRITORY_PSE, 0x00020000},
+        {"펀 자브", TERRITORY_IN_PB, 0x00020000},
+        {"페로 제도", TERRITORY_FRO, 0x00020000},
+        {"페루", TERRITORY_PER, 0x00020000},
+        {"페르 남부 쿠", TERRITORY_BR_PE, 0x00020000},
+        {"페름 지방", TERRITORY_RU_PM, 0x00020000},
+        {"펜실베이니아", TERRITORY_US_PA, 0x00020000},
+        {"펜자 주", TERRITORY_RU_PNZ, 0x00020000},
+        {"포르투갈", TERRITORY_PRT, 0x00020000},
+        {"포클랜드 제도", TERRITORY_FLK, 0x00020000},
+        {"폰디 체리", TERRITORY_IN_PY, 0x00020000},
+        {"폴란드", TERRITORY_POL, 0x00020000},
+        {"푸두 체리", TERRITORY_IN_PY, 0x00020000},
+        {"푸에르토리코", TERRITORY_PRI, 0x00020000},
+        {"푸에블라", TERRITORY_MX_PUE, 0x00020000},
+        {"푸투나", TERRITORY_WLF, 0x00020000},
+        {"프 스코프 주", TERRITORY_RU_PSK, 0x00020000},
+        {"프랑스", TERRITORY_FRA, 0x00020000},
+        {"프랑스령 기아나", TERRITORY_GUF, 0x00020000},
+        {"프랑스령 남방 및 남극", TERRITORY_ATF, 0x00020000},
+        {"프랑스령 폴리네시아", TERRITORY_PYF, 0x00020000},
+        {"프리 모르 스키 크라이", TERRITORY_RU_PO, 0x00020000},
+        {"프린스 에드워드 아일랜드", TERRITORY_CA_PE, 0x00020000},
+        {"프린시페", TERRITORY_STP, 0x00020000},
+        {"플로리다", TERRITORY_US_FL, 0x00020000},
+        {"피아 우이", TERRITORY_BR_PI, 0x00020000},
+        {"피지", TERRITORY_FJI, 0x00020000},
+        {"핀란드", TERRITORY_FIN, 0x00020000},
+        {"필리핀", TERRITORY_PHL, 0x00020000},
+        {"필립 섬", TERRITORY_NFK, 0x00020000},
+        {"핏케언 제도", TERRITORY_PCN, 0x00020000},
+        {"하 카스 공화국", TERRITORY_RU_KK, 0x00020000},
+        {"하리 아나", TERRITORY_IN_HR, 0x00020000},
+        {"하바롭스크 지방", TERRITORY_RU_KHA, 0x00020000},
+        {"하와이", TERRITORY_US_HI, 0x00020000},
+        {"하이난", TERRITORY_CN_HI, 0x00020000},
+        {"한티 mansi", TERRITORY_RU_KM, 0x00020000},
+        {"할리 스코", TERRITORY_MX_JAL, 0x00020000},
+        {"허난", TERRITORY_CN_HA, 0x00020000},
+        {"허드 맥도널드 제도", TERRITORY_HMD, 0x00020000},
+        {"허베이", TERRITORY_CN_HE, 0x00020000},
+        {"헝가리", TERRITORY_HUN, 0x00020000},
+        {"헤이룽장", TERRITORY_CN_HL, 0x00020000},
+        {"호남", TERRITORY_CN_HN, 0x00020000},
+        {"호북", TERRITORY_CN_HB, 0x00020000},
+        {"호주 수도 특별 자치구", TERRITORY_AU_ACT, 0x00020000},
+        {"홍콩", TERRITORY_HKG, 0x00020000},
+        {"히 마찰 프라데시", TERRITORY_IN_HP, 0x00020000},
+#endif
+};
+
+#define NR_TERRITORY_NAME_RECS ((int) (sizeof(TERRITORY_NAME_INDEX) / sizeof(TERRITORY_NAME_INDEX[0])))
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // __INTERNAL_TERRITORY_NAME_INDEX_H__
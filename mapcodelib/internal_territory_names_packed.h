@@ -0,0 +1,8719 @@
+/*
+ * Copyright (C) 2014-2019 Stichting Mapcode Foundation (http://www.mapcode.com)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __INTERNAL_TERRITORY_NAMES_PACKED_H__
+#define __INTERNAL_TERRITORY_NAMES_PACKED_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// *** GENERATED FILE (tools/generate_territory_name_index.py), DO NOT CHANGE OR PRETTIFY ***
+
+#define TERRITORY_NAMES_LOCAL 27 // locale number of the local names; others are LOCALE_REGISTRY[i]
+#define NR_TERRITORY_NAME_LOCALES 28
+#define MAX_TERRITORY_NAMES_PAIR_DEPTH 10
+
+typedef struct {
+    unsigned short offset;      // in the unpacked names of the locale
+    unsigned char length;       // in bytes
+    signed char alphabet;       // alphabet of the first non-roman character (or ALPHABET_ROMAN)
+} TerritoryNameAlternative;
+
+typedef struct {
+    char *names;                // unpacked on first use: the '|'-separated names of every territory,
+                                // each followed by a 0 (NULL if the language is not supported)
+    int namesSize;
+    const unsigned char *packed;
+    int packedSize;
+    const unsigned char (*pairs)[2]; // the pair of codes code c stands for, or {c, c} for a byte
+    const unsigned short *alternativesStart; // first alternative of every territory index (and the end)
+    const TerritoryNameAlternative *alternatives;
+} PackedTerritoryNames;
+
+#ifdef MAPCODE_SUPPORT_LANGUAGE_AF // Afrikaans
+
+// 6756 bytes, packed to 3415
+static const unsigned char TERRITORY_NAMES_PACKED_AF[3415] = {
+        86, 38, 204, 92, 116, 43, 124, 72, 101, 143, 155, 28, 168, 111, 34, 61, 16, 151, 30, 71, 142, 114, 10, 214,
+        146, 111, 107, 34, 172, 0, 67, 111, 99, 48, 244, 115, 124, 75, 101, 34, 136, 243, 83, 192, 229, 7, 179, 34,
+        176, 121, 49, 97, 50, 117, 146, 117, 118, 10, 117, 61, 151, 172, 23, 156, 227, 97, 7, 116, 8, 23, 192, 45,
+        77, 7, 116, 5, 49, 15, 102, 47, 107, 64, 80, 104, 143, 126, 244, 124, 80, 104, 143, 126, 245, 80, 42, 99,
+        97, 60, 110, 162, 160, 118, 94, 245, 66, 9, 109, 117, 100, 198, 145, 194, 189, 100, 22, 196, 14, 196, 97, 57,
+        188, 98, 22, 100, 23, 57, 77, 7, 5, 30, 62, 9, 110, 196, 121, 134, 110, 103, 117, 143, 108, 135, 16, 116,
+        115, 9, 26, 11, 74, 9, 196, 121, 251, 114, 138, 109, 3, 245, 87, 10, 108, 24, 64, 70, 242, 63, 157, 70,
+        242, 63, 198, 145, 194, 249, 130, 230, 249, 244, 115, 202, 66, 145, 24, 104, 219, 22, 209, 116, 8, 213, 101, 5,
+        134, 241, 98, 135, 7, 115, 237, 108, 45, 174, 248, 204, 206, 83, 27, 111, 157, 83, 27, 111, 97, 202, 248, 204,
+        92, 12, 67, 111, 111, 107, 32, 174, 83, 192, 45, 80, 105, 9, 114, 28, 53, 77, 105, 113, 117, 34, 16, 124,
+        77, 105, 113, 117, 34, 16, 49, 105, 117, 12, 83, 192, 139, 42, 116, 115, 64, 149, 118, 24, 124, 149, 118, 24,
+        128, 97, 97, 158, 92, 174, 66, 16, 97, 60, 101, 202, 168, 130, 215, 38, 117, 24, 64, 83, 140, 157, 83, 140,
+        157, 168, 130, 215, 38, 105, 127, 61, 10, 100, 105, 118, 39, 23, 192, 32, 72, 34, 8, 97, 202, 65, 115, 99,
+        8, 115, 105, 16, 64, 84, 114, 138, 57, 100, 201, 63, 104, 157, 72, 176, 34, 118, 97, 7, 116, 124, 84, 114,
+        138, 57, 100, 201, 63, 104, 135, 10, 116, 2, 148, 8, 43, 2, 248, 204, 206, 77, 97, 152, 100, 101, 45, 101,
+        230, 249, 244, 115, 202, 85, 83, 61, 153, 144, 116, 12, 83, 118, 10, 98, 7, 100, 64, 74, 57, 77, 153, 8,
+        124, 74, 57, 77, 153, 8, 23, 116, 32, 86, 5, 99, 222, 64, 100, 22, 32, 148, 8, 43, 5, 177, 148, 8,
+        43, 5, 39, 0, 188, 104, 159, 244, 64, 77, 99, 68, 16, 10, 100, 130, 230, 77, 99, 68, 16, 10, 100, 243,
+        66, 7, 98, 43, 48, 134, 110, 116, 155, 117, 41, 53, 66, 7, 98, 117, 100, 157, 66, 7, 98, 117, 100, 2,
+        67, 117, 26, 99, 97, 111, 23, 101, 121, 209, 34, 108, 164, 10, 172, 49, 216, 227, 7, 105, 1, 41, 69, 93,
+        205, 100, 15, 114, 2, 62, 27, 0, 69, 46, 227, 185, 192, 32, 76, 117, 99, 54, 77, 52, 114, 16, 39, 21,
+        124, 188, 102, 154, 9, 101, 9, 193, 168, 38, 28, 118, 57, 77, 52, 114, 16, 39, 225, 136, 191, 111, 9, 146,
+        137, 2, 68, 95, 5, 55, 198, 141, 26, 5, 128, 60, 142, 38, 29, 84, 50, 107, 115, 64, 67, 97, 55, 48,
+        130, 230, 67, 97, 55, 48, 243, 83, 97, 91, 84, 95, 195, 169, 64, 80, 114, 5, 99, 126, 177, 80, 114, 5,
+        99, 126, 12, 72, 137, 139, 137, 61, 7, 116, 5, 105, 113, 117, 12, 70, 7, 111, 20, 114, 174, 62, 43, 34,
+        160, 112, 12, 67, 95, 15, 12, 77, 97, 50, 42, 105, 127, 0, 82, 101, 63, 105, 16, 219, 117, 120, 176, 98,
+        50, 103, 23, 27, 111, 2, 217, 188, 15, 103, 21, 64, 100, 22, 32, 217, 83, 6, 119, 231, 130, 230, 217, 83,
+        6, 119, 231, 243, 70, 114, 92, 45, 80, 47, 5, 39, 25, 75, 97, 191, 32, 190, 100, 12, 84, 114, 5, 125,
+        43, 64, 84, 111, 98, 152, 111, 124, 84, 111, 98, 152, 30, 66, 114, 63, 101, 29, 70, 114, 206, 182, 34, 52,
+        28, 53, 205, 214, 107, 116, 22, 194, 188, 98, 22, 100, 164, 117, 9, 116, 91, 82, 55, 30, 67, 126, 114, 127,
+        219, 142, 1, 16, 184, 27, 97, 55, 2, 71, 199, 25, 75, 38, 7, 218, 10, 107, 13, 45, 174, 86, 1, 117,
+        38, 117, 61, 16, 116, 8, 210, 114, 30, 66, 141, 27, 221, 79, 48, 45, 84, 158, 15, 23, 119, 97, 122, 46,
+        128, 117, 119, 208, 11, 70, 125, 106, 105, 45, 174, 149, 197, 67, 10, 154, 16, 54, 83, 108, 240, 8, 25, 132,
+        26, 34, 250, 10, 39, 116, 121, 110, 194, 103, 101, 98, 22, 100, 12, 69, 108, 32, 83, 10, 118, 43, 15, 162,
+        34, 239, 12, 68, 106, 142, 111, 94, 29, 77, 151, 154, 16, 25, 82, 119, 6, 2, 72, 97, 42, 29, 66, 50,
+        63, 100, 29, 69, 107, 119, 38, 15, 105, 97, 10, 45, 62, 5, 101, 12, 167, 98, 1, 225, 47, 95, 16, 243,
+        233, 109, 8, 25, 76, 39, 144, 104, 30, 66, 34, 103, 25, 77, 47, 100, 97, 119, 25, 62, 5, 101, 101, 229,
+        226, 172, 146, 208, 119, 51, 66, 104, 111, 94, 185, 119, 42, 115, 9, 13, 49, 154, 9, 58, 68, 8, 176, 7,
+        107, 12, 69, 213, 58, 68, 95, 5, 204, 206, 40, 23, 108, 240, 133, 121, 12, 67, 203, 41, 82, 55, 198, 48,
+        110, 21, 64, 72, 9, 122, 210, 96, 5, 254, 114, 111, 3, 25, 84, 111, 103, 30, 76, 94, 58, 76, 42, 172,
+        12, 83, 114, 105, 32, 76, 1, 107, 2, 188, 15, 103, 54, 73, 9, 13, 23, 105, 9, 26, 32, 76, 101, 16,
+        164, 1, 27, 2, 84, 115, 106, 210, 103, 22, 194, 59, 70, 114, 206, 62, 105, 163, 190, 8, 155, 193, 65, 26,
+        98, 22, 194, 69, 109, 105, 26, 116, 12, 79, 203, 8, 212, 107, 134, 122, 9, 98, 208, 106, 185, 9, 119, 25,
+        74, 15, 100, 51, 80, 15, 116, 117, 103, 10, 183, 137, 7, 121, 12, 217, 75, 15, 101, 2, 89, 115, 58, 62,
+        38, 176, 10, 254, 117, 98, 198, 117, 108, 103, 7, 121, 12, 76, 142, 9, 25, 72, 16, 100, 50, 3, 162, 8,
+        5, 0, 69, 145, 114, 101, 135, 10, 97, 119, 29, 78, 216, 45, 75, 15, 101, 220, 55, 7, 152, 117, 2, 148,
+        33, 101, 58, 84, 43, 106, 52, 138, 51, 66, 129, 108, 43, 39, 106, 49, 31, 10, 146, 63, 24, 225, 50, 5,
+        27, 12, 85, 241, 103, 117, 153, 128, 199, 211, 106, 2, 83, 60, 225, 8, 210, 10, 128, 121, 114, 103, 121, 122,
+        213, 51, 87, 42, 45, 82, 127, 58, 62, 121, 163, 76, 97, 48, 0, 82, 111, 176, 8, 25, 71, 104, 163, 85,
+        103, 6, 2, 190, 8, 155, 193, 75, 16, 5, 107, 212, 107, 124, 83, 107, 144, 13, 124, 148, 111, 144, 229, 145,
+        116, 1, 106, 177, 78, 216, 45, 73, 9, 13, 124, 73, 9, 13, 202, 78, 216, 0, 62, 5, 101, 12, 69, 99,
+        117, 43, 15, 0, 87, 39, 45, 83, 141, 7, 157, 83, 141, 26, 119, 29, 71, 140, 111, 8, 49, 22, 117, 45,
+        83, 101, 101, 58, 66, 50, 107, 5, 41, 70, 3, 30, 70, 143, 126, 112, 121, 110, 12, 73, 116, 223, 79, 109,
+        51, 80, 47, 12, 73, 118, 159, 107, 127, 49, 159, 119, 101, 20, 61, 10, 101, 24, 25, 86, 21, 116, 110, 27,
+        218, 5, 58, 40, 32, 118, 57, 100, 22, 139, 137, 30, 68, 117, 42, 115, 58, 74, 191, 51, 90, 158, 98, 140,
+        119, 164, 7, 152, 117, 153, 0, 73, 26, 107, 61, 7, 111, 107, 107, 30, 79, 39, 98, 101, 107, 138, 185, 119,
+        154, 164, 191, 111, 101, 97, 45, 78, 22, 117, 45, 62, 5, 101, 12, 75, 27, 9, 111, 8, 146, 50, 107, 109,
+        8, 138, 185, 112, 1, 106, 12, 84, 238, 46, 184, 176, 8, 218, 114, 1, 107, 212, 107, 134, 65, 13, 45, 174,
+        75, 8, 54, 66, 144, 115, 119, 1, 135, 43, 152, 3, 107, 7, 0, 79, 101, 107, 26, 195, 175, 110, 12, 217,
+        83, 111, 154, 185, 222, 26, 10, 45, 65, 102, 114, 204, 206, 40, 23, 95, 223, 65, 102, 103, 104, 1, 138, 51,
+        77, 121, 1, 109, 7, 124, 66, 60, 109, 2, 90, 199, 25, 131, 143, 29, 84, 50, 107, 121, 164, 133, 138, 51,
+        77, 48, 199, 33, 49, 27, 142, 25, 86, 8, 101, 122, 117, 34, 220, 155, 9, 25, 84, 1, 122, 1, 25, 69,
+        103, 126, 116, 12, 77, 97, 50, 42, 1, 25, 66, 47, 105, 118, 54, 69, 179, 105, 111, 112, 25, 234, 95, 98,
+        54, 217, 65, 102, 114, 52, 135, 10, 29, 205, 103, 47, 220, 155, 9, 251, 43, 250, 9, 117, 61, 137, 47, 25,
+        73, 114, 51, 76, 142, 225, 111, 154, 51, 189, 100, 16, 39, 25, 70, 154, 9, 10, 28, 68, 138, 114, 52, 146,
+        108, 97, 120, 99, 10, 135, 15, 34, 48, 134, 103, 117, 3, 99, 224, 222, 39, 0, 234, 158, 2, 81, 117, 9,
+        94, 7, 30, 72, 125, 10, 103, 30, 77, 101, 120, 52, 30, 84, 140, 3, 99, 30, 78, 153, 7, 105, 11, 62,
+        1, 97, 106, 117, 38, 30, 80, 117, 101, 4, 2, 89, 117, 99, 38, 51, 81, 117, 156, 1, 41, 82, 111, 111,
+        23, 5, 10, 111, 2, 67, 27, 112, 101, 209, 12, 77, 231, 111, 151, 185, 57, 76, 117, 24, 200, 144, 48, 29,
+        62, 9, 114, 9, 30, 78, 117, 101, 118, 91, 76, 101, 16, 162, 97, 106, 201, 224, 102, 15, 110, 54, 190, 201,
+        241, 122, 251, 105, 191, 3, 162, 97, 106, 201, 224, 102, 15, 110, 178, 83, 50, 0, 90, 151, 38, 101, 99, 3,
+        184, 10, 24, 99, 30, 84, 27, 172, 108, 126, 221, 79, 97, 120, 151, 2, 68, 50, 129, 30, 67, 111, 141, 117,
+        143, 2, 83, 16, 15, 2, 131, 105, 104, 117, 141, 117, 2, 148, 111, 8, 13, 23, 97, 111, 154, 105, 45, 65,
+        26, 98, 25, 75, 137, 111, 45, 75, 5, 115, 104, 3, 2, 167, 103, 9, 25, 75, 97, 122, 133, 213, 51, 233,
+        103, 222, 5, 25, 68, 27, 57, 53, 68, 105, 117, 0, 68, 43, 26, 64, 78, 152, 7, 32, 72, 97, 118, 34,
+        29, 131, 6, 155, 7, 104, 134, 110, 100, 27, 57, 6, 32, 78, 55, 111, 98, 7, 219, 133, 115, 104, 43, 119,
+        101, 31, 0, 68, 34, 104, 29, 77, 210, 237, 153, 220, 152, 10, 6, 61, 1, 126, 50, 0, 62, 106, 7, 97,
+        11, 77, 239, 15, 27, 23, 52, 107, 158, 250, 63, 106, 140, 219, 43, 24, 109, 42, 104, 134, 114, 63, 151, 237,
+        200, 246, 134, 115, 115, 27, 162, 105, 104, 7, 0, 85, 116, 214, 133, 104, 6, 0, 71, 111, 254, 9, 10, 2,
+        84, 27, 143, 32, 78, 43, 117, 183, 158, 151, 237, 200, 246, 184, 27, 109, 117, 64, 75, 3, 106, 109, 60, 251,
+        104, 38, 116, 24, 103, 7, 104, 184, 104, 7, 107, 104, 6, 128, 7, 110, 38, 133, 2, 82, 97, 106, 3, 179,
+        51, 79, 100, 24, 104, 157, 79, 114, 226, 2, 62, 106, 7, 97, 11, 87, 39, 229, 8, 103, 10, 61, 43, 104,
+        121, 41, 80, 246, 146, 34, 129, 163, 205, 100, 104, 26, 200, 246, 61, 141, 7, 3, 104, 116, 114, 2, 85, 116,
+        214, 200, 246, 250, 117, 100, 117, 209, 9, 212, 49, 101, 197, 83, 160, 179, 32, 87, 10, 39, 134, 215, 114, 224,
+        57, 67, 191, 42, 10, 32, 84, 9, 145, 15, 121, 184, 9, 118, 24, 32, 66, 153, 32, 84, 9, 145, 15, 121,
+        49, 15, 179, 9, 110, 32, 84, 9, 145, 15, 121, 23, 117, 125, 45, 65, 215, 114, 223, 84, 3, 109, 1, 25,
+        86, 55, 116, 15, 54, 87, 39, 45, 65, 215, 114, 223, 81, 117, 101, 8, 115, 58, 68, 138, 145, 91, 70, 154,
+        9, 10, 23, 9, 103, 126, 12, 167, 152, 111, 221, 82, 105, 91, 193, 74, 1, 101, 60, 30, 69, 115, 112, 60,
+        42, 91, 83, 253, 30, 82, 105, 91, 148, 6, 28, 100, 91, 78, 15, 116, 164, 7, 97, 142, 2, 83, 253, 201,
+        38, 7, 5, 2, 80, 9, 110, 199, 117, 99, 30, 187, 191, 195, 161, 0, 67, 101, 7, 2, 65, 99, 114, 164,
+        7, 163, 82, 15, 97, 158, 2, 82, 16, 100, 195, 180, 110, 54, 83, 97, 91, 80, 172, 108, 30, 80, 105, 172,
+        195, 173, 146, 111, 99, 253, 5, 115, 0, 82, 105, 91, 148, 6, 28, 100, 91, 150, 108, 61, 7, 1, 238, 30,
+        71, 111, 105, 3, 61, 38, 91, 148, 48, 115, 91, 100, 91, 150, 108, 162, 141, 54, 77, 5, 3, 32, 71, 9,
+        97, 24, 61, 38, 91, 148, 48, 115, 30, 80, 7, 2, 187, 97, 122, 16, 221, 68, 138, 114, 52, 32, 118, 57,
+        234, 117, 109, 98, 54, 82, 104, 111, 193, 132, 58, 68, 34, 97, 119, 7, 12, 67, 16, 110, 101, 99, 116, 55,
+        117, 11, 149, 197, 74, 9, 196, 121, 49, 101, 197, 72, 27, 112, 115, 104, 60, 12, 190, 109, 16, 11, 77, 3,
+        115, 151, 104, 127, 94, 116, 115, 183, 97, 119, 208, 29, 77, 7, 121, 58, 87, 39, 116, 32, 249, 54, 182, 32,
+        67, 7, 47, 5, 135, 97, 5, 12, 189, 100, 105, 163, 75, 222, 117, 99, 107, 121, 146, 8, 110, 39, 196, 12,
+        249, 54, 79, 104, 105, 30, 80, 8, 110, 115, 121, 108, 118, 1, 54, 77, 226, 226, 126, 112, 29, 76, 160, 24,
+        105, 163, 167, 140, 27, 2, 233, 107, 92, 3, 49, 216, 45, 67, 7, 47, 5, 255, 197, 89, 15, 107, 0, 73,
+        240, 2, 73, 108, 108, 5, 111, 24, 0, 188, 15, 103, 54, 87, 24, 99, 16, 115, 5, 218, 108, 15, 125, 135,
+        226, 111, 50, 29, 79, 107, 108, 141, 95, 220, 15, 179, 32, 68, 133, 144, 2, 87, 3, 104, 136, 116, 16, 23,
+        160, 179, 32, 68, 133, 144, 255, 98, 114, 3, 107, 254, 92, 221, 73, 100, 141, 30, 85, 116, 141, 61, 5, 110,
+        39, 144, 135, 231, 155, 51, 87, 121, 95, 136, 0, 79, 114, 210, 16, 0, 234, 15, 43, 30, 149, 118, 43, 2,
+        233, 239, 16, 255, 197, 77, 101, 120, 55, 30, 77, 16, 116, 163, 75, 224, 102, 15, 110, 25, 84, 101, 120, 3,
+        134, 108, 3, 107, 198, 145, 24, 104, 32, 234, 117, 109, 98, 54, 167, 98, 9, 116, 2, 79, 110, 214, 105, 30,
+        81, 117, 101, 98, 101, 99, 23, 3, 107, 38, 209, 101, 119, 51, 77, 1, 42, 111, 98, 255, 119, 102, 111, 63,
+        100, 13, 49, 101, 197, 66, 114, 63, 115, 119, 55, 107, 49, 96, 41, 83, 99, 144, 54, 80, 114, 5, 99, 28,
+        69, 100, 119, 7, 100, 245, 89, 117, 107, 16, 49, 15, 179, 119, 39, 116, 32, 84, 9, 145, 15, 22, 115, 49,
+        63, 97, 118, 117, 11, 189, 100, 25, 65, 215, 114, 223, 66, 114, 3, 143, 25, 86, 83, 65, 124, 190, 8, 155,
+        193, 168, 38, 28, 118, 57, 248, 52, 157, 248, 52, 135, 101, 120, 52, 30, 77, 48, 107, 160, 23, 192, 200, 94,
+        9, 115, 98, 50, 103, 128, 10, 5, 136, 166, 19, 189, 103, 111, 39, 106, 94, 21, 186, 65, 100, 121, 103, 101,
+        41, 40, 49, 216, 45, 79, 115, 115, 94, 21, 45, 167, 1, 247, 75, 140, 7, 100, 5, 111, 229, 10, 107, 7,
+        32, 37, 55, 128, 7, 151, 104, 153, 45, 131, 9, 107, 39, 115, 186, 84, 115, 106, 94, 115, 106, 101, 8, 194,
+        59, 131, 117, 118, 3, 104, 186, 73, 118, 1, 96, 111, 19, 76, 126, 94, 123, 79, 212, 47, 19, 84, 117, 108,
+        207, 66, 34, 103, 15, 211, 19, 86, 108, 43, 158, 60, 19, 75, 111, 9, 123, 75, 10, 117, 103, 207, 84, 199,
+        236, 66, 212, 1, 123, 89, 7, 48, 108, 97, 118, 108, 19, 82, 121, 97, 122, 252, 65, 213, 26, 107, 104, 252,
+        77, 48, 107, 160, 19, 83, 109, 47, 8, 123, 168, 57, 59, 86, 15, 16, 101, 122, 104, 19, 78, 240, 103, 15,
+        211, 19, 80, 56, 236, 75, 203, 114, 95, 207, 168, 97, 118, 114, 111, 112, 47, 181, 75, 114, 3, 110, 211, 7,
+        181, 75, 10, 109, 121, 107, 247, 84, 118, 9, 19, 76, 8, 136, 166, 19, 82, 203, 236, 86, 47, 103, 111, 103,
+        166, 19, 86, 47, 111, 103, 100, 207, 77, 111, 9, 109, 1, 123, 75, 7, 34, 21, 32, 40, 49, 8, 94, 115,
+        32, 160, 116, 16, 95, 101, 14, 107, 241, 103, 128, 95, 105, 186, 233, 107, 104, 129, 34, 123, 77, 15, 100, 96,
+        178, 40, 49, 239, 106, 110, 105, 32, 78, 240, 103, 15, 211, 19, 80, 8, 122, 207, 75, 60, 236, 77, 7, 105,
+        130, 108, 186, 79, 114, 8, 98, 50, 103, 19, 85, 108, 121, 1, 96, 123, 80, 9, 109, 181, 66, 3, 104, 107,
+        15, 116, 203, 57, 59, 85, 100, 109, 50, 116, 186, 84, 38, 7, 213, 57, 40, 23, 27, 7, 207, 83, 7, 38,
+        236, 89, 27, 10, 111, 45, 78, 8, 94, 115, 128, 104, 253, 121, 45, 77, 92, 105, 23, 118, 9, 100, 108, 96,
+        123, 84, 121, 117, 109, 8, 19, 75, 50, 103, 252, 131, 34, 121, 140, 5, 123, 66, 50, 121, 38, 247, 90, 140,
+        153, 107, 10, 56, 121, 181, 73, 114, 107, 242, 123, 78, 96, 48, 142, 60, 123, 84, 95, 123, 79, 109, 123, 75,
+        104, 133, 3, 115, 247, 75, 176, 9, 96, 111, 19, 167, 116, 208, 186, 167, 116, 208, 181, 84, 117, 118, 41, 59,
+        75, 114, 3, 110, 111, 121, 7, 56, 181, 77, 152, 43, 252, 131, 117, 107, 144, 107, 97, 14, 107, 241, 103, 128,
+        27, 209, 38, 107, 41, 75, 26, 105, 23, 133, 237, 5, 19, 80, 114, 158, 15, 56, 121, 181, 74, 111, 211, 196,
+        14, 242, 16, 95, 101, 19, 75, 104, 140, 7, 96, 56, 181, 79, 203, 34, 52, 101, 19, 83, 133, 104, 41, 40,
+        124, 89, 133, 242, 247, 75, 1, 43, 2, 82, 127, 13, 23, 106, 129, 238, 29, 84, 105, 1, 106, 5, 162, 101,
+        105, 106, 136, 183, 97, 5, 1, 49, 136, 120, 178, 72, 117, 29, 131, 137, 113, 136, 0, 90, 104, 101, 106, 105,
+        129, 184, 105, 129, 115, 117, 218, 117, 106, 105, 51, 205, 104, 117, 29, 76, 105, 97, 16, 136, 23, 104, 6, 137,
+        23, 104, 1, 120, 29, 77, 112, 117, 109, 10, 129, 2, 72, 8, 51, 62, 239, 104, 160, 128, 119, 97, 90, 117,
+        108, 117, 45, 78, 38, 10, 183, 117, 98, 101, 29, 74, 143, 5, 183, 101, 98, 101, 105, 23, 238, 1, 120, 29,
+        149, 105, 227, 137, 47, 124, 189, 110, 9, 227, 137, 47, 54, 72, 101, 143, 63, 107, 105, 129, 183, 63, 51, 62,
+        129, 120, 105, 32, 90, 104, 117, 129, 23, 231, 117, 51, 89, 63, 110, 51, 84, 142, 94, 124, 84, 142, 101, 11,
+        71, 92, 117, 0, 81, 136, 238, 29, 88, 5, 106, 105, 129, 32, 85, 121, 103, 104, 50, 23, 106, 5, 2, 190,
+        8, 155, 193, 168, 38, 28, 77, 5, 15, 32, 97, 102, 103, 34, 101, 20, 32, 174, 67, 108, 126, 112, 9, 116,
+        16, 245, 205, 214, 107, 116, 52, 2, 189, 116, 9, 110, 38, 105, 16, 10, 124, 87, 195, 170, 114, 34, 100, 119,
+        121, 100, 124, 65, 7, 100, 12,
+};
+
+static const unsigned char TERRITORY_NAMES_PAIRS_AF[256][2] = {
+        {0, 0}, {97, 110}, {97, 0}, {97, 115}, {98, 108}, {105, 110}, {1, 100}, {97, 114}, {101, 110}, {101, 114}, {97, 108}, {116, 0},
+        {101, 0}, {108, 6}, {32, 79}, {111, 114}, {111, 110}, {3, 11}, {4, 17}, {14, 18}, {195, 171}, {105, 20}, {105, 101}, {0, 83},
+        {105, 115}, {21, 0}, {114, 97}, {97, 109}, {101, 32}, {105, 0}, {111, 0}, {101, 112}, {32, 32}, {22, 107}, {101, 108}, {31, 117},
+        {35, 4}, {82, 36}, {97, 116}, {101, 115}, {37, 33}, {97, 32}, {105, 116}, {97, 100}, {44, 44}, {45, 45}, {105, 13}, {111, 108},
+        {111, 115}, {0, 78}, {117, 114}, {1, 0}, {105, 107}, {8, 32}, {105, 2}, {105, 99}, {115, 107}, {1, 32}, {13, 0}, {40, 0},
+        {105, 114}, {0, 77}, {71, 117}, {117, 110}, {32, 53}, {65, 65}, {66, 66}, {67, 67}, {68, 68}, {69, 69}, {70, 70}, {71, 71},
+        {72, 72}, {73, 73}, {74, 74}, {75, 75}, {76, 76}, {77, 77}, {78, 78}, {79, 79}, {80, 80}, {81, 81}, {82, 82}, {83, 83},
+        {84, 84}, {85, 85}, {86, 86}, {87, 87}, {88, 88}, {89, 89}, {90, 90}, {111, 32}, {1, 115}, {46, 12}, {101, 116}, {111, 109},
+        {111, 118}, {97, 97}, {98, 98}, {99, 99}, {100, 100}, {101, 101}, {102, 102}, {103, 103}, {104, 104}, {105, 105}, {106, 106}, {107, 107},
+        {108, 108}, {109, 109}, {110, 110}, {111, 111}, {112, 112}, {113, 113}, {114, 114}, {115, 115}, {116, 116}, {117, 117}, {118, 118}, {119, 119},
+        {120, 120}, {121, 121}, {122, 122}, {56, 19}, {124, 124}, {105, 100}, {105, 112}, {117, 115}, {0, 75}, {1, 103}, {32, 69}, {67, 104},
+        {73, 115}, {97, 107}, {0, 65}, {2, 77}, {5, 103}, {16, 103}, {24, 116}, {32, 75}, {97, 98}, {97, 104}, {105, 98}, {105, 108},
+        {111, 116}, {114, 42}, {0, 84}, {32, 132}, {71, 114}, {78, 101}, {83, 117}, {97, 99}, {97, 103}, {97, 121}, {101, 100}, {105, 103},
+        {5, 116}, {97, 124}, {105, 109}, {111, 15}, {111, 117}, {161, 161}, {0, 66}, {1, 2}, {12, 80}, {26, 29}, {26, 100}, {65, 108},
+        {83, 116}, {169, 169}, {170, 170}, {171, 171}, {97, 117}, {173, 173}, {101, 93}, {175, 175}, {101, 109}, {101, 124}, {105, 41}, {116, 104},
+        {180, 180}, {139, 165}, {150, 125}, {0, 72}, {0, 74}, {1, 23}, {32, 59}, {65, 109}, {71, 101}, {73, 110}, {86, 9}, {97, 112},
+        {97, 156}, {100, 28}, {115, 28}, {195, 195}, {115, 101}, {119, 32}, {2, 66}, {27, 98}, {32, 80}, {41, 67}, {44, 32}, {48, 116},
+        {52, 97}, {65, 110}, {92, 28}, {97, 19}, {97, 105}, {99, 104}, {101, 103}, {111, 100}, {114, 121}, {115, 116}, {116, 7}, {127, 116},
+        {159, 100}, {182, 45}, {0, 70}, {0, 76}, {2, 78}, {3, 0}, {8, 116}, {10, 25}, {10, 105}, {21, 23}, {24, 115}, {32, 77},
+        {39, 104}, {45, 66}, {46, 177}, {55, 104}, {60, 103}, {65, 114}, {67, 47}, {86, 232}, {96, 19}, {104, 10}, {104, 97}, {105, 122},
+        {111, 119}, {114, 117}, {117, 116}, {130, 93}, {147, 13}, {147, 58}, {166, 228}, {178, 59}, {187, 9}, {235, 5}, {0, 80}, {0, 131},
+        {1, 19}, {1, 116}, {2, 75}, {2, 149},
+};
+
+static const unsigned short TERRITORY_NAME_ALTERNATIVES_START_AF[_TERRITORY_MAX - _TERRITORY_MIN] = {
+        0, 2, 3, 4, 5, 7, 8, 9, 10, 11, 12, 13, 15, 16, 17, 18,
+        19, 20, 21, 22, 23, 24, 25, 27, 29, 30, 31, 32, 34, 35, 37, 38,
+        40, 41, 44, 45, 48, 49, 50, 52, 53, 55, 57, 59, 60, 62, 63, 64,
+        65, 66, 67, 68, 69, 70, 72, 73, 74, 75, 76, 77, 79, 81, 82, 83,
+        84, 85, 86, 87, 88, 89, 90, 92, 93, 94, 96, 97, 98, 99, 100, 101,
+        102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117,
+        118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132, 133,
+        134, 135, 136, 137, 138, 139, 140, 141, 142, 143, 144, 145, 146, 147, 148, 149,
+        150, 151, 152, 153, 154, 155, 156, 157, 158, 159, 160, 161, 162, 163, 164, 165,
+        166, 167, 168, 169, 170, 171, 172, 173, 174, 175, 176, 177, 178, 179, 180, 181,
+        182, 183, 184, 185, 186, 187, 188, 193, 194, 195, 197, 198, 199, 200, 201, 202,
+        203, 204, 205, 206, 207, 208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218,
+        219, 220, 221, 222, 223, 224, 225, 226, 227, 228, 229, 230, 231, 232, 233, 234,
+        236, 237, 238, 239, 240, 241, 242, 243, 244, 245, 246, 247, 248, 249, 250, 251,
+        252, 253, 254, 255, 256, 257, 258, 259, 260, 261, 262, 263, 264, 265, 266, 267,
+        268, 269, 270, 271, 272, 273, 274, 275, 276, 277, 278, 279, 280, 281, 282, 283,
+        284, 285, 286, 287, 288, 289, 290, 291, 292, 293, 294, 295, 296, 297, 298, 299,
+        300, 301, 302, 303, 304, 305, 306, 307, 308, 309, 310, 311, 312, 313, 314, 315,
+        316, 317, 318, 319, 320, 321, 322, 323, 324, 325, 326, 328, 329, 330, 331, 332,
+        333, 334, 335, 336, 337, 338, 339, 340, 341, 342, 343, 344, 345, 346, 347, 348,
+        349, 350, 351, 352, 353, 354, 355, 356, 357, 358, 359, 360, 361, 362, 363, 364,
+        365, 366, 367, 368, 369, 370, 371, 372, 373, 374, 375, 376, 377, 378, 379, 380,
+        381, 382, 383, 384, 385, 386, 387, 388, 389, 390, 391, 392, 393, 394, 395, 396,
+        397, 398, 399, 400, 401, 402, 403, 404, 405, 406, 407, 408, 409, 410, 411, 412,
+        413, 414, 415, 416, 417, 418, 419, 420, 421, 422, 423, 424, 425, 426, 427, 428,
+        429, 430, 431, 432, 433, 434, 435, 436, 437, 438, 439, 442, 443, 444, 445, 446,
+        447, 448, 449, 450, 451, 452, 453, 454, 455, 456, 457, 458, 459, 460, 461, 462,
+        463, 464, 465, 466, 467, 468, 469, 470, 471, 472, 473, 474, 475, 476, 477, 478,
+        479, 480, 481, 482, 483, 484, 485, 486, 487, 488, 489, 490, 491, 492, 493, 494,
+        495, 496, 497, 498, 499, 500, 501, 502, 503, 504, 505, 506, 507, 508, 509, 510,
+        511, 512, 513, 514, 515, 516, 517, 518, 519, 520, 521, 522, 523, 524, 525, 527,
+        528, 529, 530, 531, 532, 533, 534, 535, 536, 537, 538, 539, 540, 541, 542, 543,
+        544, 545, 546, 547, 548, 549, 550, 552, 553, 554, 555, 556, 557, 559, 560, 561,
+        562, 563, 564, 565, 566, 569,
+};
+
+static const TerritoryNameAlternative TERRITORY_NAME_ALTERNATIVES_AF[569] = {
+        {0, 12, 0}, {13, 13, 0}, {27, 6, 0}, {34, 9, 0}, {44, 7, 0}, {52, 13, 0}, {66, 15, 0}, {82, 16, 0},
+        {99, 5, 0}, {105, 6, 0}, {112, 5, 0}, {118, 12, 0}, {131, 12, 0}, {144, 24, 0}, {169, 13, 0}, {183, 8, 0},
+        {192, 13, 0}, {206, 7, 0}, {214, 28, 0}, {243, 10, 0}, {254, 8, 0}, {263, 8, 0}, {272, 10, 0}, {283, 6, 0},
+        {290, 16, 0}, {307, 16, 0}, {324, 6, 0}, {331, 21, 0}, {353, 23, 0}, {377, 13, 0}, {391, 5, 0}, {397, 16, 0},
+        {414, 17, 0}, {432, 18, 0}, {451, 12, 0}, {464, 24, 0}, {489, 8, 0}, {498, 4, 0}, {503, 20, 0}, {524, 5, 0},
+        {530, 15, 0}, {546, 29, 0}, {576, 4, 0}, {581, 12, 0}, {594, 8, 0}, {603, 43, 0}, {647, 10, 0}, {658, 16, 0},
+        {675, 5, 0}, {681, 7, 0}, {689, 26, 0}, {716, 18, 0}, {735, 7, 0}, {743, 21, 0}, {765, 9, 0}, {775, 27, 0},
+        {803, 10, 0}, {814, 33, 0}, {848, 16, 0}, {865, 8, 0}, {874, 18, 0}, {893, 7, 0}, {901, 7, 0}, {909, 9, 0},
+        {919, 5, 0}, {925, 21, 0}, {947, 7, 0}, {955, 4, 0}, {960, 10, 0}, {971, 11, 0}, {983, 11, 0}, {995, 34, 0},
+        {1030, 9, 0}, {1040, 5, 0}, {1046, 8, 0}, {1055, 7, 0}, {1063, 8, 0}, {1072, 23, 0}, {1096, 14, 0}, {1111, 21, 0},
+        {1133, 8, 0}, {1142, 9, 0}, {1152, 10, 0}, {1163, 14, 0}, {1178, 10, 0}, {1189, 6, 0}, {1196, 9, 0}, {1206, 7, 0},
+        {1214, 9, 0}, {1224, 5, 0}, {1230, 42, 0}, {1273, 21, 0}, {1295, 16, 0}, {1312, 10, 0}, {1323, 18, 0}, {1342, 6, 0},
+        {1349, 6, 0}, {1356, 39, 0}, {1396, 11, 0}, {1408, 6, 0}, {1415, 7, 0}, {1423, 7, 0}, {1431, 7, 0}, {1439, 5, 0},
+        {1445, 16, 0}, {1462, 7, 0}, {1470, 10, 0}, {1481, 7, 0}, {1489, 9, 0}, {1499, 9, 0}, {1509, 6, 0}, {1516, 13, 0},
+        {1530, 13, 0}, {1544, 9, 0}, {1554, 6, 0}, {1561, 18, 0}, {1580, 11, 0}, {1592, 6, 0}, {1599, 8, 0}, {1608, 10, 0},
+        {1619, 6, 0}, {1626, 5, 0}, {1632, 7, 0}, {1640, 18, 0}, {1659, 8, 0}, {1668, 15, 0}, {1684, 8, 0}, {1693, 7, 0},
+        {1701, 7, 0}, {1709, 9, 0}, {1719, 13, 0}, {1733, 6, 0}, {1740, 7, 0}, {1748, 11, 0}, {1760, 9, 0}, {1770, 9, 0},
+        {1780, 7, 0}, {1788, 22, 0}, {1811, 8, 0}, {1820, 10, 0}, {1831, 22, 0}, {1854, 8, 0}, {1863, 4, 0}, {1868, 7, 0},
+        {1876, 6, 0}, {1883, 9, 0}, {1893, 7, 0}, {1901, 7, 0}, {1909, 12, 0}, {1922, 6, 0}, {1929, 20, 0}, {1950, 13, 0},
+        {1964, 26, 0}, {1991, 9, 0}, {2001, 10, 0}, {2012, 7, 0}, {2020, 6, 0}, {2027, 8, 0}, {2036, 8, 0}, {2045, 10, 0},
+        {2056, 6, 0}, {2063, 9, 0}, {2073, 4, 0}, {2078, 8, 0}, {2087, 8, 0}, {2096, 8, 0}, {2105, 5, 0}, {2111, 7, 0},
+        {2119, 6, 0}, {2126, 11, 0}, {2138, 9, 0}, {2148, 10, 0}, {2159, 11, 0}, {2171, 10, 0}, {2182, 5, 0}, {2188, 8, 0},
+        {2197, 8, 0}, {2206, 7, 0}, {2214, 8, 0}, {2223, 6, 0}, {2230, 7, 0}, {2238, 10, 0}, {2249, 11, 0}, {2261, 6, 0},
+        {2268, 4, 0}, {2273, 9, 0}, {2283, 5, 0}, {2289, 6, 0}, {2296, 19, 0}, {2316, 8, 0}, {2325, 15, 0}, {2341, 13, 0},
+        {2355, 14, 0}, {2370, 6, 0}, {2377, 7, 0}, {2385, 10, 0}, {2396, 7, 0}, {2404, 6, 0}, {2411, 12, 0}, {2424, 12, 0},
+        {2437, 9, 0}, {2447, 7, 0}, {2455, 4, 0}, {2460, 4, 0}, {2465, 8, 0}, {2474, 8, 0}, {2483, 9, 0}, {2493, 8, 0},
+        {2502, 7, 0}, {2510, 23, 0}, {2534, 9, 0}, {2544, 5, 0}, {2550, 8, 0}, {2559, 8, 0}, {2568, 4, 0}, {2573, 7, 0},
+        {2581, 11, 0}, {2593, 5, 0}, {2599, 18, 0}, {2618, 8, 0}, {2627, 12, 0}, {2640, 6, 0}, {2647, 8, 0}, {2656, 5, 0},
+        {2662, 8, 0}, {2671, 14, 0}, {2686, 5, 0}, {2692, 8, 0}, {2701, 10, 0}, {2712, 9, 0}, {2722, 11, 0}, {2734, 29, 0},
+        {2764, 8, 0}, {2773, 11, 0}, {2785, 7, 0}, {2793, 5, 0}, {2799, 7, 0}, {2807, 5, 0}, {2813, 6, 0}, {2820, 8, 0},
+        {2829, 9, 0}, {2839, 8, 0}, {2848, 9, 0}, {2858, 8, 0}, {2867, 9, 0}, {2877, 6, 0}, {2884, 11, 0}, {2896, 7, 0},
+        {2904, 9, 0}, {2914, 8, 0}, {2923, 11, 0}, {2935, 4, 0}, {2940, 6, 0}, {2947, 5, 0}, {2953, 4, 0}, {2958, 4, 0},
+        {2963, 9, 0}, {2973, 4, 0}, {2978, 6, 0}, {2985, 6, 0}, {2992, 10, 0}, {3003, 16, 0}, {3020, 8, 0}, {3029, 7, 0},
+        {3037, 14, 0}, {3052, 6, 0}, {3059, 9, 0}, {3069, 7, 0}, {3077, 6, 0}, {3084, 7, 0}, {3092, 7, 0}, {3100, 10, 0},
+        {3111, 6, 0}, {3118, 7, 0}, {3126, 12, 0}, {3139, 7, 0}, {3147, 8, 0}, {3156, 9, 0}, {3166, 15, 0}, {3182, 8, 0},
+        {3191, 10, 0}, {3202, 15, 0}, {3218, 9, 0}, {3228, 7, 0}, {3236, 19, 0}, {3256, 9, 0}, {3266, 7, 0}, {3274, 10, 0},
+        {3285, 6, 0}, {3292, 7, 0}, {3300, 8, 0}, {3309, 6, 0}, {3316, 9, 0}, {3326, 9, 0}, {3336, 14, 0}, {3351, 14, 0},
+        {3366, 8, 0}, {3375, 9, 0}, {3385, 11, 0}, {3397, 12, 0}, {3410, 21, 0}, {3432, 10, 0}, {3443, 19, 0}, {3463, 11, 0},
+        {3475, 5, 0}, {3481, 9, 0}, {3491, 8, 0}, {3500, 7, 0}, {3508, 7, 0}, {3516, 7, 0}, {3524, 6, 0}, {3531, 6, 0},
+        {3538, 9, 0}, {3548, 17, 0}, {3566, 5, 0}, {3572, 5, 0}, {3578, 11, 0}, {3590, 3, 0}, {3594, 6, 0}, {3601, 10, 0},
+        {3612, 16, 0}, {3629, 16, 0}, {3646, 12, 0}, {3659, 9, 0}, {3669, 9, 0}, {3679, 9, 0}, {3689, 6, 0}, {3696, 6, 0},
+        {3703, 7, 0}, {3711, 10, 0}, {3722, 14, 0}, {3737, 9, 0}, {3747, 14, 0}, {3762, 11, 0}, {3774, 13, 0}, {3788, 10, 0},
+        {3799, 15, 0}, {3815, 28, 0}, {3844, 20, 0}, {3865, 18, 0}, {3884, 15, 0}, {3900, 9, 0}, {3910, 8, 0}, {3919, 14, 0},
+        {3934, 10, 0}, {3945, 16, 0}, {3962, 7, 0}, {3970, 7, 0}, {3978, 14, 0}, {3993, 14, 0}, {4008, 19, 0}, {4028, 7, 0},
+        {4036, 14, 0}, {4051, 10, 0}, {4062, 6, 0}, {4069, 5, 0}, {4075, 4, 0}, {4080, 6, 0}, {4087, 7, 0}, {4095, 9, 0},
+        {4105, 9, 0}, {4115, 6, 0}, {4122, 9, 0}, {4132, 17, 0}, {4150, 8, 0}, {4159, 5, 0}, {4165, 18, 0}, {4184, 5, 0},
+        {4190, 12, 0}, {4203, 11, 0}, {4215, 4, 0}, {4220, 8, 0}, {4229, 20, 0}, {4250, 12, 0}, {4263, 8, 0}, {4272, 11, 0},
+        {4284, 10, 0}, {4295, 13, 0}, {4309, 7, 0}, {4317, 13, 0}, {4331, 6, 0}, {4338, 8, 0}, {4347, 13, 0}, {4361, 13, 0},
+        {4375, 5, 0}, {4381, 7, 0}, {4389, 8, 0}, {4398, 9, 0}, {4408, 8, 0}, {4417, 4, 0}, {4422, 12, 0}, {4435, 11, 0},
+        {4447, 9, 0}, {4457, 7, 0}, {4465, 8, 0}, {4474, 14, 0}, {4489, 8, 0}, {4498, 4, 0}, {4503, 8, 0}, {4512, 7, 0},
+        {4520, 9, 0}, {4530, 7, 0}, {4538, 8, 0}, {4547, 8, 0}, {4556, 12, 0}, {4569, 10, 0}, {4580, 12, 0}, {4593, 8, 0},
+        {4602, 6, 0}, {4609, 5, 0}, {4615, 4, 0}, {4620, 9, 0}, {4630, 8, 0}, {4639, 7, 0}, {4647, 6, 0}, {4654, 8, 0},
+        {4663, 6, 0}, {4670, 7, 0}, {4678, 10, 0}, {4689, 7, 0}, {4697, 11, 0}, {4709, 5, 0}, {4715, 6, 0}, {4722, 16, 0},
+        {4739, 7, 0}, {4747, 7, 0}, {4755, 6, 0}, {4762, 12, 0}, {4775, 8, 0}, {4784, 12, 0}, {4797, 13, 0}, {4811, 11, 0},
+        {4823, 20, 0}, {4844, 5, 0}, {4850, 21, 0}, {4872, 7, 0}, {4880, 6, 0}, {4887, 10, 0}, {4898, 9, 0}, {4908, 3, 0},
+        {4912, 27, 0}, {4940, 7, 0}, {4948, 6, 0}, {4955, 6, 0}, {4962, 16, 0}, {4979, 18, 0}, {4998, 22, 0}, {5021, 16, 0},
+        {5038, 31, 0}, {5070, 25, 0}, {5096, 27, 0}, {5124, 22, 0}, {5147, 17, 0}, {5165, 14, 0}, {5180, 14, 0}, {5195, 12, 0},
+        {5208, 11, 0}, {5220, 15, 0}, {5236, 15, 0}, {5252, 13, 0}, {5266, 13, 0}, {5280, 13, 0}, {5294, 14, 0}, {5309, 16, 0},
+        {5326, 13, 0}, {5340, 16, 0}, {5357, 13, 0}, {5371, 15, 0}, {5387, 14, 0}, {5402, 15, 0}, {5418, 15, 0}, {5434, 12, 0},
+        {5447, 15, 0}, {5463, 14, 0}, {5478, 14, 0}, {5493, 18, 0}, {5512, 11, 0}, {5524, 16, 0}, {5541, 13, 0}, {5555, 16, 0},
+        {5572, 14, 0}, {5587, 16, 0}, {5604, 18, 0}, {5623, 21, 0}, {5645, 14, 0}, {5660, 18, 0}, {5679, 18, 0}, {5698, 22, 0},
+        {5721, 12, 0}, {5734, 12, 0}, {5747, 17, 0}, {5765, 15, 0}, {5781, 16, 0}, {5798, 9, 0}, {5808, 23, 0}, {5832, 16, 0},
+        {5849, 19, 0}, {5869, 13, 0}, {5883, 14, 0}, {5898, 13, 0}, {5912, 12, 0}, {5925, 17, 0}, {5943, 13, 0}, {5957, 13, 0},
+        {5971, 18, 0}, {5990, 18, 0}, {6009, 16, 0}, {6026, 14, 0}, {6041, 18, 0}, {6060, 12, 0}, {6073, 11, 0}, {6085, 19, 0},
+        {6105, 15, 0}, {6121, 15, 0}, {6137, 10, 0}, {6148, 14, 0}, {6163, 16, 0}, {6180, 14, 0}, {6195, 14, 0}, {6210, 14, 0},
+        {6225, 15, 0}, {6241, 14, 0}, {6256, 22, 0}, {6279, 15, 0}, {6295, 16, 0}, {6312, 15, 0}, {6328, 17, 0}, {6346, 6, 0},
+        {6353, 7, 0}, {6361, 8, 0}, {6370, 7, 0}, {6378, 7, 0}, {6386, 6, 0}, {6393, 11, 0}, {6405, 9, 0}, {6415, 8, 0},
+        {6424, 7, 0}, {6432, 6, 0}, {6439, 5, 0}, {6445, 8, 0}, {6454, 8, 0}, {6463, 6, 0}, {6470, 10, 0}, {6481, 5, 0},
+        {6487, 7, 0}, {6495, 13, 0}, {6509, 5, 0}, {6515, 5, 0}, {6521, 5, 0}, {6527, 7, 0}, {6535, 10, 0}, {6546, 14, 0},
+        {6561, 11, 0}, {6573, 5, 0}, {6579, 14, 0}, {6594, 7, 0}, {6602, 6, 0}, {6609, 5, 0}, {6615, 5, 0}, {6621, 5, 0},
+        {6627, 7, 0}, {6635, 15, 0}, {6651, 5, 0}, {6657, 38, 0}, {6696, 17, 0}, {6714, 10, 0}, {6725, 13, 0}, {6739, 10, 0},
+        {6750, 5, 0},
+};
+
+static char TERRITORY_NAMES_UNPACKED_AF[6756];
+
+static const PackedTerritoryNames PACKED_TERRITORY_NAMES_AF = {
+        TERRITORY_NAMES_UNPACKED_AF, 6756, TERRITORY_NAMES_PACKED_AF, 3415, TERRITORY_NAMES_PAIRS_AF,
+        TERRITORY_NAME_ALTERNATIVES_START_AF, TERRITORY_NAME_ALTERNATIVES_AF};
+
+#else
+
+static const PackedTerritoryNames PACKED_TERRITORY_NAMES_AF = {NULL, 0, NULL, 0, NULL, NULL, NULL};
+
+#endif // MAPCODE_SUPPORT_LANGUAGE_AF
+
+#ifdef MAPCODE_SUPPORT_LANGUAGE_AR // Arabic
+
+// 11617 bytes, packed to 2966
+static const unsigned char TERRITORY_NAMES_PACKED_AR[2966] = {
+        12, 20, 70, 50, 14, 124, 9, 15, 23, 95, 20, 70, 50, 14, 124, 12, 11, 6, 8, 2, 19, 6, 8, 53,
+        206, 31, 89, 3, 29, 13, 5, 32, 79, 34, 52, 49, 81, 5, 3, 87, 60, 81, 77, 102, 84, 221, 241, 2,
+        61, 1, 18, 3, 49, 67, 12, 3, 37, 89, 157, 41, 253, 94, 221, 4, 201, 94, 221, 4, 19, 152, 114, 21,
+        141, 128, 4, 18, 20, 53, 11, 124, 20, 65, 66, 32, 1, 65, 75, 87, 84, 62, 11, 35, 4, 141, 51, 84,
+        67, 238, 40, 6, 9, 3, 56, 83, 52, 241, 192, 112, 191, 19, 26, 4, 117, 19, 109, 191, 14, 2, 102, 94,
+        34, 23, 3, 74, 35, 4, 39, 239, 98, 91, 24, 37, 31, 10, 8, 48, 10, 29, 35, 39, 2, 124, 30, 35,
+        8, 2, 141, 95, 11, 6, 72, 9, 85, 197, 32, 67, 69, 218, 124, 20, 69, 218, 36, 202, 214, 231, 226, 161,
+        19, 109, 191, 14, 21, 96, 16, 174, 10, 4, 33, 10, 235, 44, 6, 28, 1, 87, 94, 34, 33, 12, 41, 64,
+        55, 193, 188, 50, 21, 87, 60, 81, 102, 84, 2, 35, 32, 78, 50, 5, 31, 124, 9, 50, 5, 31, 120, 2,
+        91, 201, 60, 62, 8, 32, 31, 2, 20, 72, 87, 60, 1, 73, 14, 36, 202, 19, 11, 34, 66, 21, 19, 26,
+        53, 146, 21, 87, 19, 108, 117, 20, 201, 32, 26, 65, 215, 219, 25, 8, 23, 33, 23, 32, 69, 6, 2, 93,
+        32, 56, 60, 218, 124, 25, 8, 23, 33, 23, 124, 10, 6, 2, 93, 32, 56, 60, 31, 144, 12, 79, 237, 6,
+        4, 203, 51, 87, 214, 231, 226, 161, 193, 188, 50, 21, 37, 113, 69, 41, 20, 12, 13, 34, 15, 219, 255, 94,
+        235, 124, 255, 94, 235, 201, 32, 20, 114, 208, 219, 12, 30, 187, 90, 23, 124, 5, 30, 187, 90, 23, 141, 128,
+        26, 35, 15, 219, 202, 94, 89, 248, 12, 15, 40, 34, 13, 90, 77, 44, 208, 151, 55, 32, 28, 34, 13, 3,
+        56, 124, 13, 34, 13, 3, 56, 225, 85, 157, 41, 101, 5, 40, 12, 157, 87, 94, 34, 80, 1, 19, 232, 44,
+        146, 18, 237, 55, 9, 141, 51, 94, 14, 201, 32, 5, 77, 250, 50, 243, 125, 17, 124, 92, 249, 94, 50, 243,
+        72, 82, 9, 211, 190, 41, 98, 1, 252, 51, 49, 118, 1, 147, 78, 23, 50, 1, 36, 13, 112, 187, 47, 35,
+        66, 70, 2, 87, 32, 10, 18, 148, 32, 81, 1, 50, 77, 223, 71, 10, 78, 205, 28, 187, 8, 66, 124, 109,
+        23, 8, 66, 97, 118, 60, 118, 37, 221, 23, 50, 87, 32, 20, 34, 3, 74, 55, 15, 5, 28, 87, 19, 52,
+        188, 37, 18, 101, 2, 77, 0, 24, 32, 6, 204, 204, 96, 81, 8, 9, 13, 18, 22, 41, 64, 55, 29, 251,
+        82, 154, 126, 3, 202, 32, 8, 75, 3, 198, 19, 154, 21, 124, 154, 32, 202, 32, 8, 75, 3, 198, 40, 53,
+        23, 39, 82, 152, 114, 21, 36, 6, 25, 8, 193, 104, 216, 182, 6, 49, 187, 2, 56, 15, 32, 69, 28, 158,
+        3, 124, 10, 28, 158, 207, 243, 113, 44, 226, 182, 32, 152, 114, 126, 154, 126, 3, 25, 208, 221, 50, 21, 40,
+        18, 10, 18, 50, 3, 121, 109, 156, 96, 13, 4, 14, 29, 64, 1, 50, 237, 200, 17, 121, 79, 6, 87, 32,
+        20, 81, 209, 76, 14, 55, 10, 3, 36, 30, 13, 5, 193, 8, 86, 40, 1, 26, 64, 85, 49, 73, 18, 19,
+        33, 6, 52, 21, 41, 55, 39, 65, 75, 36, 11, 3, 62, 76, 123, 2, 47, 149, 248, 82, 30, 117, 190, 41,
+        5, 67, 194, 83, 8, 226, 166, 65, 76, 5, 8, 79, 23, 197, 5, 20, 90, 18, 40, 5, 125, 29, 66, 69,
+        206, 52, 248, 17, 106, 107, 56, 97, 1, 62, 2, 40, 18, 31, 117, 74, 23, 82, 1, 27, 55, 216, 166, 21,
+        44, 5, 13, 116, 87, 32, 8, 241, 14, 44, 6, 9, 194, 96, 72, 69, 207, 5, 30, 50, 144, 53, 56, 20,
+        17, 74, 194, 84, 72, 157, 49, 113, 107, 40, 69, 14, 41, 3, 72, 48, 97, 53, 100, 36, 15, 4, 247, 11,
+        83, 27, 31, 17, 140, 15, 78, 23, 50, 14, 41, 5, 67, 89, 212, 3, 27, 34, 50, 1, 36, 13, 77, 4,
+        128, 3, 12, 26, 6, 54, 47, 6, 55, 10, 213, 122, 3, 0, 24, 10, 20, 17, 96, 62, 107, 17, 41, 6,
+        65, 14, 11, 1, 29, 251, 17, 63, 38, 35, 164, 124, 25, 35, 164, 41, 35, 149, 31, 40, 4, 9, 1, 140,
+        189, 50, 74, 3, 80, 1, 19, 152, 114, 21, 36, 216, 165, 247, 70, 214, 6, 150, 192, 211, 190, 36, 4, 9,
+        8, 160, 231, 6, 13, 123, 14, 7, 181, 6, 13, 17, 222, 6, 15, 4, 36, 109, 10, 22, 12, 155, 30, 6,
+        225, 82, 154, 21, 7, 162, 72, 164, 74, 55, 10, 73, 12, 145, 28, 1, 40, 5, 22, 34, 17, 96, 66, 35,
+        17, 97, 146, 18, 85, 40, 4, 23, 83, 6, 62, 6, 250, 12, 1, 91, 225, 82, 232, 61, 50, 34, 158, 55,
+        36, 204, 14, 7, 183, 159, 50, 93, 40, 98, 24, 15, 101, 61, 66, 12, 49, 31, 8, 41, 18, 23, 64, 222,
+        18, 122, 55, 2, 47, 9, 13, 86, 17, 41, 18, 17, 197, 98, 12, 121, 35, 22, 125, 93, 40, 2, 24, 6,
+        77, 17, 74, 80, 234, 24, 77, 106, 78, 116, 74, 14, 160, 122, 100, 155, 9, 5, 11, 95, 9, 211, 190, 124,
+        1, 54, 10, 164, 124, 109, 191, 14, 82, 88, 216, 184, 9, 105, 124, 1, 35, 164, 19, 232, 74, 194, 36, 216,
+        165, 11, 55, 15, 18, 36, 156, 112, 226, 161, 19, 230, 36, 22, 143, 31, 120, 240, 65, 100, 40, 18, 11, 215,
+        32, 20, 85, 3, 36, 20, 5, 13, 23, 83, 191, 12, 17, 41, 5, 79, 4, 128, 88, 246, 40, 53, 100, 223,
+        112, 5, 214, 159, 36, 4, 6, 3, 123, 37, 12, 125, 17, 76, 62, 4, 64, 76, 4, 164, 140, 11, 118, 3,
+        44, 5, 9, 116, 36, 17, 13, 14, 244, 73, 13, 143, 91, 40, 34, 158, 55, 2, 36, 88, 48, 52, 155, 110,
+        13, 44, 240, 13, 11, 93, 197, 91, 15, 40, 143, 55, 32, 22, 23, 82, 30, 117, 190, 36, 11, 64, 35, 31,
+        49, 242, 246, 93, 83, 245, 116, 49, 1, 65, 75, 36, 73, 4, 76, 6, 114, 160, 53, 146, 124, 202, 32, 216,
+        162, 209, 47, 194, 40, 69, 8, 107, 144, 15, 22, 33, 52, 6, 44, 81, 6, 116, 254, 19, 8, 86, 14, 63,
+        38, 152, 2, 52, 82, 77, 79, 105, 36, 156, 78, 12, 44, 20, 22, 14, 93, 37, 80, 247, 124, 13, 18, 9,
+        1, 244, 200, 17, 111, 65, 2, 49, 242, 17, 40, 89, 93, 37, 240, 9, 13, 2, 52, 61, 64, 66, 17, 76,
+        4, 39, 91, 24, 61, 123, 35, 213, 4, 39, 116, 37, 156, 6, 37, 18, 62, 116, 40, 53, 2, 20, 17, 83,
+        216, 171, 2, 28, 212, 53, 78, 13, 17, 254, 38, 152, 2, 52, 250, 149, 44, 98, 92, 36, 4, 123, 6, 111,
+        90, 40, 35, 3, 37, 98, 53, 17, 83, 35, 14, 96, 66, 17, 197, 86, 14, 83, 146, 31, 72, 17, 155, 52,
+        203, 88, 95, 70, 112, 90, 21, 49, 24, 11, 54, 12, 144, 18, 65, 77, 0, 158, 55, 54, 12, 253, 72, 47,
+        53, 73, 145, 3, 253, 14, 1, 32, 6, 3, 36, 26, 2, 15, 5, 30, 94, 4, 32, 4, 13, 24, 216, 161,
+        193, 245, 14, 36, 15, 53, 95, 9, 148, 50, 49, 143, 1, 227, 61, 1, 17, 6, 62, 74, 107, 1, 104, 55,
+        10, 207, 3, 66, 24, 0, 2, 81, 70, 14, 47, 3, 35, 62, 34, 3, 41, 23, 12, 55, 47, 200, 198, 206,
+        198, 55, 11, 14, 102, 32, 5, 3, 72, 84, 69, 77, 2, 74, 35, 35, 3, 61, 91, 20, 71, 5, 204, 40,
+        159, 1, 60, 149, 252, 4, 17, 76, 35, 89, 6, 240, 111, 17, 13, 85, 40, 159, 1, 60, 149, 252, 4, 17,
+        32, 8, 18, 244, 89, 70, 50, 85, 210, 149, 227, 49, 64, 1, 53, 66, 85, 44, 55, 148, 89, 1, 147, 18,
+        14, 30, 3, 47, 55, 26, 91, 24, 41, 31, 18, 1, 111, 238, 55, 26, 55, 74, 187, 209, 197, 88, 86, 21,
+        140, 11, 118, 3, 19, 15, 73, 52, 48, 79, 21, 36, 153, 1, 216, 166, 6, 47, 1, 39, 1, 104, 93, 222,
+        6, 30, 208, 23, 147, 64, 14, 32, 86, 2, 3, 147, 90, 48, 32, 31, 158, 34, 32, 26, 1, 20, 65, 2,
+        115, 75, 151, 34, 0, 14, 56, 246, 32, 31, 50, 28, 34, 0, 89, 33, 90, 3, 66, 147, 5, 26, 206, 151,
+        12, 1, 17, 61, 159, 12, 75, 37, 14, 66, 18, 49, 6, 66, 18, 144, 125, 18, 64, 41, 50, 73, 36, 13,
+        4, 30, 143, 97, 34, 80, 234, 34, 31, 70, 33, 12, 233, 44, 8, 64, 40, 238, 34, 44, 69, 34, 14, 189,
+        12, 74, 55, 142, 21, 60, 35, 12, 1, 49, 64, 65, 32, 4, 90, 3, 97, 73, 1, 33, 12, 233, 29, 64,
+        71, 81, 33, 9, 35, 111, 26, 70, 72, 30, 34, 26, 29, 26, 34, 104, 75, 47, 34, 4, 70, 89, 234, 48,
+        30, 93, 44, 86, 101, 1, 124, 25, 18, 72, 237, 3, 30, 34, 70, 40, 98, 12, 19, 230, 37, 90, 17, 233,
+        49, 65, 14, 255, 1, 142, 126, 75, 48, 233, 37, 1, 26, 34, 1, 33, 10, 48, 142, 126, 1, 69, 34, 233,
+        40, 86, 69, 33, 35, 2, 120, 71, 8, 157, 216, 171, 219, 65, 39, 83, 52, 241, 214, 1, 156, 9, 95, 25,
+        196, 12, 21, 29, 35, 20, 72, 32, 104, 5, 123, 193, 6, 216, 182, 155, 52, 203, 88, 95, 232, 254, 32, 1,
+        196, 12, 213, 8, 9, 116, 76, 50, 10, 18, 17, 44, 196, 12, 82, 230, 47, 3, 23, 39, 209, 147, 2, 196,
+        62, 71, 20, 2, 15, 35, 12, 41, 35, 30, 66, 239, 24, 22, 55, 8, 106, 2, 71, 117, 32, 255, 35, 3,
+        83, 245, 35, 62, 71, 8, 14, 10, 3, 106, 2, 71, 110, 75, 205, 15, 71, 4, 18, 10, 2, 40, 34, 1,
+        66, 1, 201, 1, 60, 70, 34, 215, 40, 35, 4, 200, 81, 3, 44, 9, 143, 1, 41, 17, 48, 44, 11, 6,
+        2, 40, 34, 14, 1, 106, 18, 1, 73, 1, 106, 31, 248, 17, 223, 71, 13, 1, 53, 207, 17, 91, 49, 81,
+        14, 10, 23, 8, 106, 2, 71, 110, 75, 205, 15, 71, 8, 53, 37, 34, 14, 26, 157, 74, 3, 17, 8, 37,
+        70, 71, 110, 77, 71, 15, 71, 8, 53, 40, 1, 26, 250, 23, 85, 32, 30, 35, 1, 72, 37, 70, 71, 110,
+        77, 207, 34, 1, 222, 9, 1, 39, 31, 37, 52, 203, 88, 51, 60, 53, 78, 13, 17, 141, 128, 6, 86, 142,
+        126, 117, 24, 3, 35, 47, 31, 62, 50, 10, 120, 71, 30, 35, 8, 2, 120, 71, 26, 200, 33, 1, 35, 76,
+        35, 9, 31, 10, 37, 85, 70, 33, 3, 27, 8, 97, 1, 55, 206, 34, 65, 75, 76, 6, 30, 23, 82, 230,
+        47, 34, 53, 215, 19, 154, 21, 37, 23, 83, 146, 80, 145, 208, 89, 2, 49, 23, 72, 2, 76, 6, 30, 194,
+        44, 3, 26, 113, 3, 142, 21, 84, 114, 5, 20, 116, 37, 72, 72, 66, 2, 96, 3, 125, 80, 160, 24, 13,
+        64, 160, 242, 114, 85, 115, 108, 60, 34, 53, 215, 120, 91, 18, 11, 44, 2, 55, 83, 5, 23, 91, 29, 251,
+        17, 142, 126, 91, 54, 31, 8, 4, 76, 5, 18, 2, 56, 37, 72, 18, 239, 81, 24, 26, 78, 1, 115, 108,
+        32, 56, 11, 69, 234, 55, 33, 4, 79, 4, 254, 32, 56, 11, 69, 1, 61, 13, 48, 54, 145, 14, 8, 85,
+        0, 113, 56, 26, 3, 0, 2, 69, 144, 23, 72, 69, 144, 101, 151, 14, 0, 55, 2, 78, 98, 142, 21, 38,
+        18, 151, 31, 47, 53, 18, 90, 3, 120, 20, 1, 56, 44, 6, 125, 218, 155, 148, 50, 32, 30, 117, 190, 37,
+        31, 10, 14, 145, 149, 252, 4, 213, 148, 85, 44, 24, 54, 145, 53, 78, 13, 82, 109, 191, 14, 21, 44, 5,
+        109, 10, 160, 31, 10, 34, 2, 3, 47, 66, 50, 223, 54, 70, 33, 107, 37, 14, 62, 28, 1, 120, 67, 1,
+        31, 15, 209, 40, 243, 39, 50, 32, 30, 117, 15, 37, 52, 203, 88, 128, 4, 20, 67, 1, 32, 227, 33, 17,
+        141, 95, 25, 9, 35, 32, 216, 165, 15, 3, 34, 15, 0, 2, 81, 31, 36, 1, 52, 12, 73, 19, 232, 19,
+        230, 61, 218, 20, 69, 36, 26, 146, 44, 196, 12, 17, 36, 13, 48, 39, 65, 36, 92, 249, 192, 211, 15, 95,
+        25, 188, 50, 21, 124, 25, 188, 50, 1, 155, 148, 50, 37, 3, 227, 102, 84, 79, 6, 245, 251, 47, 12, 23,
+        195, 127, 46, 199, 216, 165, 98, 3, 33, 17, 63, 38, 15, 151, 17, 115, 108, 38, 77, 62, 17, 45, 25, 5,
+        14, 82, 30, 59, 121, 109, 15, 23, 71, 13, 5, 52, 34, 212, 48, 33, 113, 45, 12, 33, 6, 148, 19, 30,
+        59, 140, 33, 101, 14, 140, 189, 20, 1, 33, 83, 2, 20, 14, 67, 3, 46, 96, 66, 62, 103, 44, 18, 2,
+        53, 46, 49, 92, 224, 65, 22, 18, 86, 46, 76, 24, 15, 73, 35, 46, 225, 103, 47, 12, 122, 236, 49, 200,
+        67, 224, 6, 80, 103, 0, 17, 6, 77, 24, 20, 5, 46, 106, 17, 39, 14, 44, 27, 48, 104, 14, 46, 37,
+        3, 227, 46, 41, 9, 53, 23, 103, 199, 56, 22, 93, 76, 18, 31, 123, 46, 61, 67, 22, 18, 86, 224, 54,
+        67, 46, 47, 3, 196, 78, 236, 41, 10, 1, 152, 28, 53, 139, 47, 48, 8, 4, 86, 34, 139, 63, 60, 12,
+        9, 50, 213, 20, 35, 46, 96, 23, 195, 127, 46, 106, 3, 27, 67, 76, 53, 22, 122, 127, 46, 37, 4, 79,
+        52, 128, 20, 53, 122, 56, 37, 18, 246, 103, 63, 60, 34, 65, 17, 44, 81, 6, 122, 32, 4, 23, 62, 8,
+        19, 231, 70, 21, 63, 60, 78, 239, 6, 104, 14, 30, 65, 103, 63, 94, 18, 15, 67, 17, 61, 123, 4, 205,
+        4, 67, 22, 18, 86, 224, 14, 39, 236, 47, 35, 67, 46, 37, 34, 205, 30, 59, 32, 33, 242, 51, 44, 18,
+        23, 13, 18, 22, 46, 44, 53, 80, 67, 103, 40, 35, 9, 139, 63, 84, 33, 11, 35, 17, 140, 25, 15, 188,
+        10, 199, 10, 10, 34, 93, 41, 247, 236, 41, 34, 70, 67, 46, 0, 17, 108, 71, 4, 253, 8, 210, 14, 10,
+        2, 192, 114, 2, 41, 20, 35, 15, 5, 67, 103, 49, 2, 78, 23, 46, 225, 22, 14, 46, 111, 65, 17, 13,
+        23, 103, 63, 84, 18, 249, 212, 119, 32, 88, 109, 19, 13, 1, 50, 12, 83, 35, 11, 69, 103, 61, 67, 77,
+        66, 35, 54, 37, 4, 79, 52, 128, 10, 78, 54, 44, 78, 103, 199, 104, 89, 85, 212, 73, 35, 67, 3, 46,
+        140, 10, 113, 36, 10, 113, 139, 199, 10, 67, 145, 48, 8, 4, 3, 17, 6, 54, 139, 37, 159, 90, 14, 46,
+        111, 81, 69, 11, 1, 38, 81, 6, 122, 47, 64, 189, 70, 11, 1, 139, 223, 104, 12, 23, 224, 6, 73, 18,
+        54, 2, 139, 222, 43, 19, 238, 86, 21, 19, 231, 70, 21, 210, 143, 34, 67, 54, 139, 44, 9, 18, 46, 199,
+        8, 1, 104, 1, 124, 17, 52, 69, 82, 30, 59, 47, 100, 106, 77, 17, 115, 98, 26, 113, 49, 80, 30, 23,
+        40, 11, 23, 97, 235, 14, 61, 195, 33, 17, 32, 26, 3, 105, 111, 118, 189, 195, 111, 30, 228, 29, 228, 8,
+        3, 76, 3, 30, 80, 0, 14, 26, 3, 105, 96, 17, 31, 195, 115, 75, 118, 115, 14, 33, 105, 29, 228, 33,
+        105, 210, 4, 14, 121, 3, 198, 3, 121, 107, 22, 15, 118, 97, 28, 105, 29, 65, 23, 210, 13, 105, 115, 4,
+        33, 105, 120, 192, 22, 53, 124, 9, 98, 53, 82, 56, 104, 5, 21, 97, 65, 118, 30, 228, 97, 31, 14, 121,
+        107, 22, 33, 105, 32, 5, 52, 78, 126, 189, 107, 22, 41, 198, 107, 0, 204, 14, 244, 125, 14, 22, 124, 12,
+        10, 13, 10, 121, 14, 8, 3, 111, 195, 26, 1, 105, 115, 23, 30, 228, 19, 3, 151, 57, 36, 156, 23, 87,
+        19, 92, 249, 192, 211, 15, 95, 156, 22, 35, 95, 4, 1, 216, 166, 21, 141, 51, 60, 5, 66, 6, 10, 31,
+        36, 52, 34, 95, 52, 79, 150, 19, 154, 21, 147, 53, 2, 0,
+};
+
+static const unsigned char TERRITORY_NAMES_PAIRS_AR[256][2] = {
+        {0, 0}, {216, 167}, {217, 138}, {217, 136}, {217, 134}, {217, 132}, {216, 177}, {0, 216}, {216, 179}, {217, 133}, {216, 170}, {217, 131},
+        {1, 5}, {216, 168}, {1, 4}, {216, 175}, {2, 216}, {2, 1}, {3, 6}, {32, 12}, {217, 129}, {16, 169}, {216, 186}, {2, 4},
+        {5, 1}, {216, 163}, {217, 135}, {8, 10}, {3, 13}, {7, 172}, {216, 172}, {3, 4}, {32, 32}, {216, 180}, {1, 6}, {2, 6},
+        {0, 12}, {0, 9}, {32, 25}, {216, 178}, {7, 168}, {7, 179}, {24, 27}, {28, 42}, {7, 163}, {45, 45}, {38, 43}, {0, 11},
+        {6, 1}, {7, 170}, {2, 11}, {216, 169}, {217, 130}, {3, 5}, {8, 11}, {3, 1}, {15, 1}, {18, 21}, {9, 26}, {58, 57},
+        {32, 11}, {0, 4}, {2, 10}, {29, 59}, {1, 9}, {2, 5}, {2, 13}, {3, 20}, {29, 39}, {3, 10}, {1, 10}, {3, 32},
+        {2, 8}, {2, 9}, {7, 186}, {14, 15}, {0, 20}, {3, 8}, {3, 9}, {216, 183}, {2, 14}, {3, 11}, {17, 19}, {7, 165},
+        {32, 13}, {1, 8}, {3, 15}, {68, 6}, {216, 185}, {1, 11}, {1, 15}, {3, 2}, {3, 24}, {27, 14}, {32, 9}, {51, 19},
+        {0, 5}, {0, 26}, {4, 22}, {4, 28}, {4, 56}, {16, 180}, {41, 14}, {54, 46}, {216, 174}, {217, 137}, {0, 6}, {3, 14},
+        {9, 12}, {13, 6}, {22, 6}, {49, 33}, {216, 173}, {1, 2}, {4, 8}, {7, 180}, {14, 17}, {15, 2}, {31, 22}, {48, 2},
+        {61, 2}, {0, 52}, {3, 22}, {16, 172}, {124, 124}, {16, 178}, {21, 32}, {48, 15}, {51, 32}, {129, 129}, {130, 130}, {131, 131},
+        {132, 132}, {133, 133}, {134, 134}, {135, 135}, {136, 136}, {137, 137}, {138, 138}, {60, 119}, {63, 19}, {68, 35}, {0, 92}, {1, 13},
+        {1, 37}, {1, 47}, {4, 15}, {7, 175}, {11, 8}, {12, 2}, {13, 21}, {16, 186}, {20, 6}, {30, 39}, {30, 99}, {36, 9},
+        {216, 181}, {1, 3}, {1, 22}, {1, 30}, {1, 44}, {161, 161}, {162, 162}, {163, 163}, {5, 100}, {165, 165}, {166, 166}, {167, 167},
+        {168, 168}, {169, 169}, {170, 170}, {171, 171}, {172, 172}, {173, 173}, {174, 174}, {175, 175}, {176, 176}, {177, 177}, {178, 178}, {179, 179},
+        {180, 180}, {181, 181}, {182, 182}, {183, 183}, {184, 184}, {185, 185}, {186, 186}, {6, 23}, {9, 6}, {10, 33}, {15, 51}, {16, 183},
+        {19, 9}, {19, 25}, {23, 17}, {23, 22}, {27, 6}, {36, 8}, {62, 33}, {63, 32}, {64, 13}, {102, 10}, {153, 6}, {1, 79},
+        {2, 31}, {2, 32}, {2, 37}, {3, 40}, {4, 10}, {5, 75}, {7, 174}, {10, 112}, {17, 47}, {17, 49}, {19, 88}, {23, 1},
+        {216, 216}, {217, 217}, {31, 1}, {32, 3}, {33, 108}, {34, 10}, {36, 25}, {41, 1}, {46, 40}, {47, 18}, {48, 216}, {54, 3},
+        {80, 22}, {84, 127}, {110, 150}, {216, 176}, {220, 21}, {229, 101}, {1, 0}, {1, 23}, {1, 46}, {1, 74}, {2, 26}, {2, 44},
+        {3, 39}, {5, 73}, {6, 11}, {6, 31}, {7, 178}, {8, 13}, {9, 14}, {9, 34}, {15, 31}, {17, 10}, {17, 37}, {18, 30},
+        {20, 18}, {23, 10}, {29, 99}, {30, 14},
+};
+
+static const unsigned short TERRITORY_NAME_ALTERNATIVES_START_AR[_TERRITORY_MAX - _TERRITORY_MIN] = {
+        0, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 15, 16, 17, 18,
+        19, 20, 21, 22, 23, 25, 26, 28, 29, 30, 31, 32, 33, 34, 36, 37,
+        38, 39, 40, 41, 44, 45, 46, 47, 48, 50, 52, 53, 54, 56, 57, 58,
+        59, 60, 61, 62, 63, 64, 66, 67, 68, 69, 70, 71, 72, 74, 75, 76,
+        77, 78, 79, 80, 81, 82, 83, 85, 86, 87, 89, 90, 91, 92, 93, 94,
+        95, 96, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110,
+        111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126,
+        127, 128, 129, 130, 131, 132, 133, 134, 135, 136, 137, 138, 139, 140, 142, 143,
+        144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159,
+        160, 161, 162, 163, 164, 165, 166, 167, 168, 169, 170, 171, 172, 173, 174, 175,
+        176, 177, 178, 179, 180, 181, 182, 186, 187, 188, 189, 190, 191, 192, 193, 194,
+        195, 196, 197, 198, 199, 200, 201, 202, 203, 204, 205, 206, 207, 208, 209, 210,
+        211, 212, 213, 214, 215, 216, 217, 219, 220, 221, 222, 223, 224, 225, 226, 227,
+        229, 230, 231, 232, 233, 234, 235, 236, 237, 238, 239, 240, 241, 242, 243, 244,
+        245, 246, 247, 248, 249, 250, 251, 252, 253, 254, 255, 256, 257, 258, 259, 260,
+        261, 262, 263, 264, 265, 266, 267, 268, 269, 270, 271, 272, 273, 274, 275, 276,
+        277, 278, 279, 280, 281, 282, 283, 284, 285, 286, 287, 288, 289, 290, 291, 292,
+        293, 294, 295, 296, 297, 298, 299, 300, 301, 302, 303, 304, 305, 306, 307, 308,
+        309, 310, 311, 312, 313, 314, 315, 316, 317, 318, 319, 321, 322, 323, 324, 325,
+        326, 327, 328, 329, 330, 331, 332, 333, 334, 335, 336, 337, 338, 339, 340, 341,
+        342, 343, 344, 345, 346, 347, 348, 349, 350, 351, 352, 353, 354, 355, 356, 357,
+        358, 359, 360, 361, 362, 363, 364, 365, 366, 367, 368, 369, 370, 371, 372, 373,
+        374, 375, 376, 377, 378, 379, 380, 381, 382, 383, 384, 385, 386, 387, 388, 389,
+        390, 391, 392, 393, 394, 395, 396, 397, 398, 399, 400, 401, 402, 403, 404, 405,
+        406, 407, 408, 409, 410, 411, 412, 413, 414, 415, 416, 417, 418, 419, 420, 421,
+        422, 423, 424, 425, 426, 427, 428, 429, 430, 431, 432, 434, 435, 436, 437, 438,
+        439, 440, 441, 442, 443, 444, 445, 446, 447, 448, 449, 450, 451, 452, 453, 454,
+        455, 456, 457, 458, 459, 460, 461, 462, 463, 464, 465, 466, 467, 468, 469, 470,
+        471, 472, 473, 474, 475, 476, 477, 478, 479, 480, 481, 482, 483, 484, 485, 486,
+        487, 488, 489, 490, 491, 492, 493, 494, 495, 496, 497, 498, 499, 500, 501, 502,
+        503, 504, 505, 506, 507, 508, 509, 510, 511, 512, 513, 514, 515, 516, 517, 519,
+        520, 521, 522, 523, 524, 525, 526, 527, 528, 529, 530, 531, 532, 533, 534, 535,
+        536, 537, 538, 539, 540, 541, 542, 544, 545, 546, 547, 548, 549, 551, 552, 553,
+        554, 555, 556, 557, 558, 559,
+};
+
+static const TerritoryNameAlternative TERRITORY_NAME_ALTERNATIVES_AR[559] = {
+        {0, 18, 14}, {19, 29, 14}, {49, 27, 14}, {77, 12, 14}, {90, 15, 14}, {106, 10, 14}, {117, 17, 14}, {135, 23, 14},
+        {159, 10, 14}, {170, 12, 14}, {183, 10, 14}, {194, 19, 14}, {214, 36, 14}, {251, 25, 14}, {277, 23, 14}, {301, 21, 14},
+        {323, 21, 14}, {345, 12, 14}, {358, 55, 14}, {414, 19, 14}, {434, 12, 14}, {447, 14, 14}, {462, 16, 14}, {479, 10, 14},
+        {490, 10, 14}, {501, 29, 14}, {531, 21, 14}, {553, 12, 14}, {566, 46, 14}, {613, 20, 14}, {634, 10, 14}, {645, 19, 14},
+        {665, 29, 14}, {695, 13, 14}, {709, 30, 14}, {740, 12, 14}, {753, 10, 14}, {764, 30, 14}, {795, 19, 14}, {815, 48, 14},
+        {864, 23, 14}, {888, 69, 14}, {958, 14, 14}, {973, 28, 14}, {1002, 10, 14}, {1013, 12, 14}, {1026, 40, 14}, {1067, 10, 14},
+        {1078, 34, 14}, {1113, 15, 14}, {1129, 42, 14}, {1172, 18, 14}, {1191, 47, 14}, {1239, 16, 14}, {1256, 31, 14}, {1288, 14, 14},
+        {1303, 14, 14}, {1318, 8, 14}, {1327, 10, 14}, {1338, 38, 14}, {1377, 12, 14}, {1390, 8, 14}, {1399, 17, 14}, {1417, 19, 14},
+        {1437, 20, 14}, {1458, 48, 14}, {1507, 16, 14}, {1524, 10, 14}, {1535, 16, 14}, {1552, 14, 14}, {1567, 16, 14}, {1584, 32, 14},
+        {1617, 32, 14}, {1650, 14, 14}, {1665, 17, 14}, {1683, 16, 14}, {1700, 15, 14}, {1716, 14, 14}, {1731, 17, 14}, {1749, 16, 14},
+        {1766, 19, 14}, {1786, 18, 14}, {1805, 10, 14}, {1816, 72, 14}, {1889, 32, 14}, {1922, 33, 14}, {1956, 23, 14}, {1980, 31, 14},
+        {2012, 12, 14}, {2025, 12, 14}, {2038, 57, 14}, {2096, 18, 14}, {2115, 8, 14}, {2124, 10, 14}, {2135, 14, 14}, {2150, 12, 14},
+        {2163, 6, 14}, {2170, 21, 14}, {2192, 14, 14}, {2207, 23, 14}, {2231, 14, 14}, {2246, 25, 14}, {2272, 18, 14}, {2291, 12, 14},
+        {2304, 8, 14}, {2313, 33, 14}, {2347, 16, 14}, {2364, 14, 14}, {2379, 12, 14}, {2392, 18, 14}, {2411, 8, 14}, {2420, 12, 14},
+        {2433, 14, 14}, {2448, 12, 14}, {2461, 10, 14}, {2472, 14, 14}, {2487, 31, 14}, {2519, 14, 14}, {2534, 19, 14}, {2554, 14, 14},
+        {2569, 12, 14}, {2582, 12, 14}, {2595, 16, 14}, {2612, 21, 14}, {2634, 12, 14}, {2647, 10, 14}, {2658, 12, 14}, {2671, 12, 14},
+        {2684, 16, 14}, {2701, 14, 14}, {2716, 37, 14}, {2754, 16, 14}, {2771, 18, 14}, {2790, 29, 14}, {2820, 14, 14}, {2835, 8, 14},
+        {2844, 12, 14}, {2857, 16, 14}, {2874, 16, 14}, {2891, 12, 14}, {2904, 29, 14}, {2934, 14, 14}, {2949, 16, 14}, {2966, 8, 14},
+        {2975, 27, 14}, {3003, 29, 14}, {3033, 46, 14}, {3080, 12, 14}, {3093, 16, 14}, {3110, 10, 14}, {3121, 12, 14}, {3134, 16, 14},
+        {3151, 10, 14}, {3162, 27, 14}, {3190, 14, 14}, {3205, 18, 14}, {3224, 8, 14}, {3233, 14, 14}, {3248, 14, 14}, {3263, 14, 14},
+        {3278, 8, 14}, {3287, 14, 14}, {3302, 12, 14}, {3315, 27, 14}, {3343, 18, 14}, {3362, 14, 14}, {3377, 18, 14}, {3396, 16, 14},
+        {3413, 10, 14}, {3424, 8, 14}, {3433, 14, 14}, {3448, 20, 14}, {3469, 14, 14}, {3484, 10, 14}, {3495, 14, 14}, {3510, 20, 14},
+        {3531, 18, 14}, {3550, 10, 14}, {3561, 8, 14}, {3570, 14, 14}, {3585, 8, 14}, {3594, 12, 14}, {3607, 29, 14}, {3637, 16, 14},
+        {3654, 29, 14}, {3684, 31, 14}, {3716, 10, 14}, {3727, 18, 14}, {3746, 29, 14}, {3776, 14, 14}, {3791, 18, 14}, {3810, 23, 14},
+        {3834, 14, 14}, {3849, 14, 14}, {3864, 19, 14}, {3884, 12, 14}, {3897, 19, 14}, {3917, 14, 14}, {3932, 14, 14}, {3947, 12, 14},
+        {3960, 12, 14}, {3973, 29, 14}, {4003, 14, 14}, {4018, 14, 14}, {4033, 16, 14}, {4050, 16, 14}, {4067, 12, 14}, {4080, 12, 14},
+        {4093, 18, 14}, {4112, 12, 14}, {4125, 36, 14}, {4162, 18, 14}, {4181, 20, 14}, {4202, 14, 14}, {4217, 14, 14}, {4232, 10, 14},
+        {4243, 10, 14}, {4254, 10, 14}, {4265, 17, 14}, {4283, 10, 14}, {4294, 16, 14}, {4311, 12, 14}, {4324, 16, 14}, {4341, 23, 14},
+        {4365, 42, 14}, {4408, 14, 14}, {4423, 18, 14}, {4442, 14, 14}, {4457, 10, 14}, {4468, 12, 14}, {4481, 10, 14}, {4492, 10, 14},
+        {4503, 14, 14}, {4518, 14, 14}, {4533, 14, 14}, {4548, 14, 14}, {4563, 14, 14}, {4578, 14, 14}, {4593, 6, 14}, {4600, 18, 14},
+        {4619, 14, 14}, {4634, 14, 14}, {4649, 16, 14}, {4666, 23, 14}, {4690, 8, 14}, {4699, 12, 14}, {4712, 12, 14}, {4725, 8, 14},
+        {4734, 8, 14}, {4743, 14, 14}, {4758, 10, 14}, {4769, 10, 14}, {4780, 14, 14}, {4795, 18, 14}, {4814, 35, 14}, {4850, 18, 14},
+        {4869, 14, 14}, {4884, 26, 14}, {4911, 12, 14}, {4924, 21, 14}, {4946, 45, 14}, {4992, 27, 14}, {5020, 14, 14}, {5035, 14, 14},
+        {5050, 20, 14}, {5071, 12, 14}, {5084, 14, 14}, {5099, 18, 14}, {5118, 14, 14}, {5133, 16, 14}, {5150, 18, 14}, {5169, 28, 14},
+        {5198, 12, 14}, {5211, 19, 14}, {5231, 29, 14}, {5261, 16, 14}, {5278, 14, 14}, {5293, 36, 14}, {5330, 18, 14}, {5349, 14, 14},
+        {5364, 20, 14}, {5385, 16, 14}, {5402, 14, 14}, {5417, 16, 14}, {5434, 12, 14}, {5447, 18, 14}, {5466, 16, 14}, {5483, 16, 14},
+        {5500, 52, 14}, {5553, 14, 14}, {5568, 18, 14}, {5587, 18, 14}, {5606, 19, 14}, {5626, 36, 14}, {5663, 16, 14}, {5680, 31, 14},
+        {5712, 16, 14}, {5729, 8, 14}, {5738, 16, 14}, {5755, 16, 14}, {5772, 14, 14}, {5787, 14, 14}, {5802, 14, 14}, {5817, 10, 14},
+        {5828, 14, 14}, {5843, 14, 14}, {5858, 31, 14}, {5890, 8, 14}, {5899, 10, 14}, {5910, 22, 14}, {5933, 6, 14}, {5940, 23, 14},
+        {5964, 19, 14}, {5984, 27, 14}, {6012, 21, 14}, {6034, 22, 14}, {6057, 16, 14}, {6074, 18, 14}, {6093, 14, 14}, {6108, 12, 14},
+        {6121, 12, 14}, {6134, 14, 14}, {6149, 25, 14}, {6175, 23, 14}, {6199, 18, 14}, {6218, 34, 14}, {6253, 20, 14}, {6274, 34, 14},
+        {6309, 18, 14}, {6328, 24, 14}, {6353, 46, 14}, {6400, 32, 14}, {6433, 33, 14}, {6467, 25, 14}, {6493, 14, 14}, {6508, 16, 14},
+        {6525, 31, 14}, {6557, 18, 14}, {6576, 31, 14}, {6608, 14, 14}, {6623, 14, 14}, {6638, 24, 14}, {6663, 27, 14}, {6691, 35, 14},
+        {6727, 14, 14}, {6742, 27, 14}, {6770, 20, 14}, {6791, 10, 14}, {6802, 10, 14}, {6813, 8, 14}, {6822, 12, 14}, {6835, 14, 14},
+        {6850, 16, 14}, {6867, 17, 14}, {6885, 10, 14}, {6896, 18, 14}, {6915, 31, 14}, {6947, 16, 14}, {6964, 10, 14}, {6975, 31, 14},
+        {7007, 10, 14}, {7018, 23, 14}, {7042, 19, 14}, {7062, 8, 14}, {7071, 16, 14}, {7088, 29, 14}, {7118, 17, 14}, {7136, 25, 14},
+        {7162, 16, 14}, {7179, 17, 14}, {7197, 23, 14}, {7221, 14, 14}, {7236, 20, 14}, {7257, 10, 14}, {7268, 16, 14}, {7285, 29, 14},
+        {7315, 33, 14}, {7349, 6, 14}, {7356, 14, 14}, {7371, 12, 14}, {7384, 12, 14}, {7397, 14, 14}, {7412, 12, 14}, {7425, 29, 14},
+        {7455, 16, 14}, {7472, 16, 14}, {7489, 14, 14}, {7504, 14, 14}, {7519, 25, 14}, {7545, 14, 14}, {7560, 8, 14}, {7569, 12, 14},
+        {7582, 12, 14}, {7595, 27, 14}, {7623, 14, 14}, {7638, 12, 14}, {7651, 18, 14}, {7670, 21, 14}, {7692, 12, 14}, {7705, 21, 14},
+        {7727, 14, 14}, {7742, 12, 14}, {7755, 12, 14}, {7768, 8, 14}, {7777, 16, 14}, {7794, 14, 14}, {7809, 14, 14}, {7824, 25, 14},
+        {7850, 16, 14}, {7867, 12, 14}, {7880, 14, 14}, {7895, 25, 14}, {7921, 14, 14}, {7936, 20, 14}, {7957, 10, 14}, {7968, 12, 14},
+        {7981, 37, 14}, {8019, 12, 14}, {8032, 16, 14}, {8049, 10, 14}, {8060, 20, 14}, {8081, 16, 14}, {8098, 24, 14}, {8123, 23, 14},
+        {8147, 36, 14}, {8184, 36, 14}, {8221, 10, 14}, {8232, 48, 14}, {8281, 14, 14}, {8296, 10, 14}, {8307, 16, 14}, {8324, 16, 14},
+        {8341, 50, 14}, {8392, 12, 14}, {8405, 14, 14}, {8420, 10, 14}, {8431, 23, 14}, {8455, 37, 14}, {8493, 29, 14}, {8523, 27, 14},
+        {8551, 55, 14}, {8607, 29, 14}, {8637, 44, 14}, {8682, 29, 14}, {8712, 29, 14}, {8742, 31, 14}, {8774, 29, 14}, {8804, 27, 14},
+        {8832, 23, 14}, {8856, 31, 14}, {8888, 31, 14}, {8920, 25, 14}, {8946, 27, 14}, {8974, 27, 14}, {9002, 29, 14}, {9032, 33, 14},
+        {9066, 12, 14}, {9079, 31, 14}, {9111, 25, 14}, {9137, 31, 14}, {9169, 29, 14}, {9199, 29, 14}, {9229, 31, 14}, {9261, 25, 14},
+        {9287, 31, 14}, {9319, 27, 14}, {9347, 27, 14}, {9375, 31, 14}, {9407, 23, 14}, {9431, 33, 14}, {9465, 12, 14}, {9478, 33, 14},
+        {9512, 25, 14}, {9538, 31, 14}, {9570, 29, 14}, {9600, 40, 14}, {9641, 23, 14}, {9665, 35, 14}, {9701, 31, 14}, {9733, 42, 14},
+        {9776, 25, 14}, {9802, 25, 14}, {9828, 32, 14}, {9861, 33, 14}, {9895, 35, 14}, {9931, 17, 14}, {9949, 29, 14}, {9979, 29, 14},
+        {10009, 31, 14}, {10041, 25, 14}, {10067, 29, 14}, {10097, 23, 14}, {10121, 23, 14}, {10145, 35, 14}, {10181, 27, 14}, {10209, 27, 14},
+        {10237, 37, 14}, {10275, 31, 14}, {10307, 32, 14}, {10340, 31, 14}, {10372, 22, 14}, {10395, 21, 14}, {10417, 25, 14}, {10443, 29, 14},
+        {10473, 31, 14}, {10505, 25, 14}, {10531, 19, 14}, {10551, 23, 14}, {10575, 31, 14}, {10607, 29, 14}, {10637, 29, 14}, {10667, 27, 14},
+        {10695, 29, 14}, {10725, 27, 14}, {10753, 50, 14}, {10804, 27, 14}, {10832, 23, 14}, {10856, 23, 14}, {10880, 33, 14}, {10914, 8, 14},
+        {10923, 10, 14}, {10934, 12, 14}, {10947, 14, 14}, {10962, 8, 14}, {10971, 12, 14}, {10984, 21, 14}, {11006, 20, 14}, {11027, 14, 14},
+        {11042, 14, 14}, {11057, 12, 14}, {11070, 10, 14}, {11081, 16, 14}, {11098, 14, 14}, {11113, 10, 14}, {11124, 14, 14}, {11139, 8, 14},
+        {11148, 12, 14}, {11161, 18, 14}, {11180, 8, 14}, {11189, 10, 14}, {11200, 6, 14}, {11207, 8, 14}, {11216, 17, 14}, {11234, 31, 14},
+        {11266, 22, 14}, {11289, 10, 14}, {11300, 40, 14}, {11341, 14, 14}, {11356, 10, 14}, {11367, 12, 14}, {11380, 10, 14}, {11391, 10, 14},
+        {11402, 16, 14}, {11419, 35, 14}, {11455, 10, 14}, {11466, 68, 14}, {11535, 27, 14}, {11563, 44, 14}, {11608, 8, 14},
+};
+
+static char TERRITORY_NAMES_UNPACKED_AR[11617];
+
+static const PackedTerritoryNames PACKED_TERRITORY_NAMES_AR = {
+        TERRITORY_NAMES_UNPACKED_AR, 11617, TERRITORY_NAMES_PACKED_AR, 2966, TERRITORY_NAMES_PAIRS_AR,
+        TERRITORY_NAME_ALTERNATIVES_START_AR, TERRITORY_NAME_ALTERNATIVES_AR};
+
+#else
+
+static const PackedTerritoryNames PACKED_TERRITORY_NAMES_AR = {NULL, 0, NULL, 0, NULL, NULL, NULL};
+
+#endif // MAPCODE_SUPPORT_LANGUAGE_AR
+
+#ifdef MAPCODE_SUPPORT_LANGUAGE_BE // Belarussian
+
+// 13193 bytes, packed to 3748
+static const unsigned char TERRITORY_NAMES_PACKED_BE[3748] = {
+        208, 147, 10, 211, 13, 146, 61, 11, 9, 17, 58, 161, 29, 12, 235, 13, 159, 27, 72, 74, 17, 73, 138, 5,
+        21, 7, 34, 237, 112, 73, 233, 46, 91, 73, 228, 249, 12, 244, 58, 154, 200, 50, 36, 117, 69, 57, 35, 145,
+        31, 236, 114, 40, 5, 99, 4, 131, 125, 112, 15, 29, 34, 15, 74, 73, 6, 190, 69, 50, 238, 156, 1, 31,
+        18, 57, 69, 57, 35, 156, 31, 18, 71, 99, 106, 121, 250, 9, 90, 164, 200, 201, 35, 144, 66, 14, 71, 20,
+        58, 164, 200, 201, 35, 144, 66, 14, 71, 20, 111, 5, 18, 9, 95, 3, 2, 43, 171, 46, 13, 145, 15, 29,
+        16, 198, 95, 40, 15, 20, 56, 9, 62, 117, 198, 108, 17, 25, 153, 236, 108, 10, 42, 12, 32, 98, 13, 134,
+        216, 11, 66, 25, 5, 40, 32, 73, 62, 3, 16, 69, 17, 32, 45, 13, 156, 31, 194, 138, 76, 3, 217, 63,
+        3, 36, 5, 114, 26, 156, 17, 8, 76, 61, 214, 65, 95, 217, 2, 43, 171, 46, 32, 9, 34, 12, 20, 2,
+        163, 250, 193, 90, 164, 15, 18, 102, 197, 226, 144, 121, 206, 239, 108, 17, 97, 13, 146, 113, 36, 50, 97, 244,
+        58, 146, 113, 36, 50, 97, 117, 44, 13, 177, 108, 17, 25, 38, 155, 5, 87, 18, 71, 92, 236, 66, 3, 63,
+        125, 21, 118, 31, 92, 34, 249, 117, 63, 40, 16, 206, 17, 25, 6, 181, 13, 161, 59, 10, 197, 161, 59, 10,
+        1, 44, 32, 59, 16, 206, 17, 25, 6, 181, 2, 109, 13, 154, 15, 9, 220, 57, 35, 159, 96, 76, 90, 156,
+        53, 29, 218, 67, 58, 156, 53, 29, 218, 67, 99, 5, 15, 16, 69, 71, 238, 154, 5, 18, 8, 90, 157, 19,
+        29, 193, 58, 157, 19, 29, 193, 91, 82, 40, 17, 249, 117, 198, 67, 82, 7, 16, 44, 13, 161, 71, 238, 173,
+        60, 61, 68, 15, 8, 90, 161, 105, 197, 161, 105, 197, 161, 71, 238, 173, 60, 61, 68, 15, 8, 74, 119, 20,
+        11, 29, 11, 69, 29, 12, 18, 10, 66, 13, 144, 14, 57, 11, 44, 13, 163, 92, 19, 8, 28, 12, 90, 162,
+        42, 60, 17, 45, 20, 85, 154, 102, 23, 12, 58, 163, 92, 19, 8, 28, 16, 58, 162, 42, 60, 17, 45, 20,
+        85, 154, 102, 23, 26, 156, 119, 18, 138, 7, 71, 72, 137, 40, 16, 206, 17, 97, 13, 146, 113, 36, 50, 97,
+        244, 58, 146, 113, 36, 50, 97, 117, 44, 13, 151, 208, 168, 208, 144, 74, 4, 145, 18, 22, 168, 37, 5, 28,
+        21, 95, 36, 57, 90, 175, 3, 35, 156, 82, 57, 58, 175, 3, 35, 156, 82, 57, 69, 71, 238, 146, 50, 8,
+        71, 18, 90, 147, 7, 71, 72, 194, 11, 58, 147, 7, 71, 72, 194, 11, 2, 146, 10, 171, 46, 13, 165, 76,
+        20, 90, 109, 13, 156, 73, 20, 67, 119, 20, 58, 156, 73, 20, 67, 119, 20, 198, 31, 21, 72, 27, 63, 3,
+        235, 36, 15, 1, 90, 145, 31, 21, 15, 20, 197, 145, 31, 21, 15, 20, 22, 187, 53, 101, 7, 13, 154, 196,
+        7, 27, 10, 69, 16, 66, 92, 19, 114, 97, 117, 111, 34, 46, 2, 225, 243, 156, 31, 100, 3, 97, 244, 63,
+        216, 106, 138, 15, 59, 2, 43, 171, 46, 13, 156, 71, 69, 71, 238, 155, 196, 8, 38, 156, 53, 203, 16, 56,
+        62, 58, 164, 19, 20, 95, 61, 11, 98, 3, 243, 168, 18, 61, 11, 13, 156, 53, 203, 19, 56, 5, 5, 69,
+        50, 36, 6, 191, 89, 112, 254, 5, 66, 25, 24, 214, 59, 50, 53, 239, 88, 7, 19, 66, 3, 91, 5, 42,
+        21, 4, 134, 5, 63, 60, 224, 13, 162, 95, 9, 8, 90, 154, 82, 9, 27, 58, 154, 82, 9, 27, 69, 17,
+        35, 162, 229, 16, 90, 159, 42, 3, 8, 19, 37, 58, 159, 42, 3, 8, 19, 37, 122, 17, 9, 67, 36, 74,
+        31, 28, 50, 53, 22, 164, 31, 95, 97, 117, 122, 29, 72, 218, 15, 37, 152, 59, 106, 97, 117, 74, 46, 206,
+        5, 66, 0, 98, 56, 96, 12, 81, 17, 3, 16, 246, 196, 9, 8, 16, 40, 21, 89, 36, 69, 59, 10, 22,
+        226, 148, 65, 106, 219, 100, 90, 120, 243, 161, 83, 29, 5, 70, 249, 244, 58, 120, 243, 161, 71, 20, 29, 5,
+        70, 249, 12, 117, 192, 203, 28, 15, 56, 41, 159, 34, 50, 16, 56, 223, 105, 85, 146, 95, 20, 19, 112, 42,
+        3, 5, 20, 72, 90, 162, 105, 94, 197, 162, 105, 94, 239, 7, 102, 16, 66, 192, 203, 28, 15, 56, 97, 13,
+        120, 100, 32, 123, 17, 237, 9, 235, 172, 11, 87, 13, 183, 12, 40, 14, 5, 111, 15, 95, 18, 85, 160, 11,
+        9, 152, 201, 7, 246, 5, 29, 127, 175, 40, 82, 9, 138, 59, 21, 223, 61, 31, 192, 34, 9, 14, 57, 20,
+        97, 244, 2, 146, 17, 15, 61, 15, 227, 31, 3, 94, 10, 207, 145, 94, 59, 97, 32, 1, 45, 29, 11, 0,
+        15, 8, 87, 230, 86, 162, 11, 40, 106, 69, 29, 6, 183, 200, 57, 20, 91, 15, 29, 16, 66, 18, 192, 5,
+        219, 11, 124, 29, 11, 103, 13, 164, 5, 219, 11, 99, 205, 30, 154, 34, 16, 20, 67, 38, 161, 14, 202, 57,
+        38, 134, 56, 7, 4, 150, 14, 39, 191, 34, 16, 60, 194, 97, 32, 236, 108, 10, 42, 5, 69, 119, 29, 72,
+        106, 198, 233, 5, 56, 214, 65, 11, 21, 15, 28, 5, 74, 73, 16, 20, 67, 38, 160, 15, 83, 138, 4, 150,
+        28, 5, 198, 89, 102, 20, 56, 5, 0, 19, 9, 29, 61, 31, 100, 114, 3, 30, 147, 29, 50, 16, 26, 144,
+        14, 21, 195, 161, 34, 59, 67, 249, 117, 63, 7, 40, 57, 38, 155, 16, 8, 10, 18, 239, 16, 114, 36, 38,
+        156, 34, 20, 205, 138, 29, 50, 16, 12, 35, 145, 193, 4, 131, 112, 82, 29, 255, 145, 15, 18, 127, 168, 29,
+        16, 66, 28, 31, 107, 157, 5, 20, 95, 126, 11, 214, 195, 173, 60, 67, 38, 148, 59, 50, 53, 17, 41, 80,
+        220, 14, 202, 73, 223, 10, 60, 85, 160, 11, 9, 239, 228, 3, 62, 90, 147, 76, 28, 94, 202, 50, 22, 165,
+        31, 29, 61, 107, 162, 94, 10, 246, 61, 29, 38, 155, 5, 18, 29, 22, 168, 42, 13, 155, 17, 9, 138, 125,
+        56, 38, 134, 7, 126, 107, 161, 23, 76, 85, 155, 16, 67, 19, 2, 191, 17, 59, 22, 167, 19, 41, 80, 22,
+        164, 203, 28, 15, 56, 41, 147, 29, 62, 3, 137, 21, 96, 12, 81, 17, 243, 144, 54, 177, 97, 13, 173, 40,
+        113, 61, 11, 63, 98, 60, 207, 144, 56, 76, 21, 82, 219, 17, 69, 76, 21, 38, 134, 31, 20, 195, 159, 31,
+        18, 15, 36, 34, 38, 146, 57, 36, 207, 226, 154, 31, 19, 26, 134, 8, 126, 107, 147, 29, 61, 19, 40, 34,
+        22, 186, 15, 21, 239, 34, 36, 31, 107, 155, 5, 21, 16, 207, 147, 83, 89, 27, 198, 57, 50, 2, 173, 108,
+        7, 19, 26, 156, 34, 202, 5, 2, 225, 30, 154, 31, 19, 26, 157, 53, 31, 94, 15, 138, 7, 19, 28, 107,
+        162, 72, 65, 11, 9, 5, 60, 127, 145, 254, 14, 72, 19, 92, 99, 16, 37, 34, 112, 102, 193, 69, 15, 42,
+        3, 59, 2, 163, 125, 36, 29, 82, 91, 59, 21, 10, 219, 220, 5, 207, 161, 57, 16, 36, 34, 91, 113, 36,
+        5, 56, 38, 145, 233, 31, 15, 8, 39, 147, 24, 3, 22, 155, 6, 190, 8, 2, 160, 15, 40, 194, 38, 147,
+        17, 22, 163, 36, 83, 22, 151, 14, 15, 70, 17, 6, 181, 13, 154, 31, 34, 16, 98, 60, 29, 197, 168, 61,
+        126, 100, 58, 146, 12, 14, 53, 105, 108, 17, 62, 58, 225, 30, 134, 7, 126, 100, 58, 134, 7, 126, 100, 44,
+        13, 225, 24, 122, 29, 50, 16, 26, 173, 9, 29, 72, 106, 2, 151, 88, 230, 252, 161, 88, 31, 1, 124, 8,
+        88, 54, 178, 68, 122, 105, 67, 99, 205, 30, 151, 16, 126, 107, 145, 89, 9, 50, 85, 164, 27, 10, 192, 200,
+        201, 50, 11, 245, 18, 34, 38, 144, 40, 17, 111, 10, 114, 92, 70, 239, 16, 54, 179, 13, 161, 14, 17, 205,
+        82, 13, 154, 228, 28, 5, 99, 31, 29, 16, 36, 38, 156, 34, 82, 56, 38, 146, 96, 16, 18, 3, 59, 192,
+        50, 14, 116, 20, 107, 154, 67, 36, 85, 145, 54, 183, 202, 200, 39, 147, 76, 40, 195, 175, 37, 67, 38, 151,
+        5, 40, 21, 105, 29, 19, 111, 31, 94, 29, 82, 245, 54, 186, 74, 31, 10, 9, 22, 163, 56, 21, 232, 5,
+        60, 127, 168, 29, 234, 107, 159, 6, 191, 15, 85, 157, 205, 30, 147, 29, 50, 16, 26, 154, 59, 76, 102, 112,
+        89, 9, 40, 57, 5, 60, 127, 134, 55, 195, 162, 82, 126, 2, 149, 40, 57, 192, 203, 28, 107, 144, 126, 97,
+        244, 91, 57, 38, 145, 61, 8, 29, 17, 118, 72, 94, 241, 31, 2, 163, 9, 7, 4, 150, 3, 22, 191, 46,
+        115, 11, 13, 161, 15, 20, 127, 166, 71, 18, 7, 119, 3, 85, 144, 121, 206, 17, 41, 80, 220, 59, 222, 63,
+        121, 36, 17, 5, 60, 17, 74, 96, 116, 40, 197, 145, 113, 40, 22, 151, 59, 21, 62, 0, 70, 11, 14, 5,
+        112, 89, 28, 107, 159, 73, 5, 60, 17, 74, 6, 183, 59, 21, 53, 99, 59, 5, 21, 38, 146, 57, 16, 8,
+        15, 218, 240, 5, 36, 16, 207, 162, 17, 56, 195, 149, 36, 201, 16, 18, 74, 46, 108, 195, 145, 222, 29, 38,
+        173, 121, 5, 10, 37, 223, 34, 15, 40, 21, 38, 226, 144, 121, 206, 118, 222, 63, 3, 36, 250, 240, 5, 36,
+        76, 227, 72, 111, 76, 15, 74, 254, 250, 38, 134, 7, 127, 155, 5, 29, 38, 161, 15, 20, 127, 134, 216, 17,
+        16, 56, 62, 0, 121, 16, 20, 95, 119, 3, 153, 73, 125, 36, 22, 162, 14, 248, 9, 34, 118, 106, 233, 228,
+        63, 36, 15, 241, 119, 57, 18, 16, 8, 91, 250, 68, 40, 152, 76, 16, 237, 10, 245, 20, 119, 36, 1, 0,
+        92, 18, 61, 13, 156, 232, 8, 53, 1, 0, 18, 105, 241, 10, 99, 24, 7, 68, 18, 122, 15, 17, 88, 15,
+        61, 10, 111, 15, 19, 33, 22, 174, 9, 61, 17, 91, 50, 18, 85, 160, 208, 147, 208, 144, 69, 50, 34, 10,
+        152, 59, 37, 16, 70, 16, 74, 5, 70, 1, 73, 17, 69, 17, 32, 45, 13, 155, 15, 193, 35, 159, 10, 18,
+        228, 68, 122, 76, 95, 240, 15, 19, 29, 10, 35, 155, 16, 67, 2, 189, 5, 65, 3, 252, 154, 222, 121, 106,
+        3, 38, 146, 16, 54, 186, 125, 8, 227, 96, 12, 37, 27, 2, 226, 157, 5, 65, 3, 252, 154, 222, 121, 106,
+        3, 38, 161, 73, 61, 232, 27, 215, 34, 68, 25, 10, 112, 59, 4, 131, 14, 68, 37, 27, 2, 158, 88, 73,
+        22, 148, 89, 254, 10, 91, 10, 88, 15, 68, 14, 220, 17, 106, 1, 0, 70, 11, 87, 15, 88, 15, 138, 7,
+        71, 126, 107, 161, 46, 20, 46, 41, 144, 54, 178, 223, 67, 36, 85, 154, 50, 92, 27, 137, 14, 65, 11, 7,
+        91, 6, 183, 88, 60, 17, 63, 7, 36, 57, 28, 50, 22, 148, 59, 17, 90, 180, 56, 5, 214, 72, 7, 1,
+        90, 157, 94, 31, 87, 202, 233, 68, 227, 83, 11, 36, 31, 87, 63, 216, 59, 17, 97, 90, 157, 68, 9, 10,
+        21, 31, 25, 68, 16, 246, 73, 92, 72, 29, 68, 37, 214, 218, 5, 74, 16, 36, 87, 34, 24, 99, 94, 34,
+        57, 20, 74, 17, 201, 89, 112, 7, 68, 37, 89, 118, 68, 56, 10, 54, 188, 69, 68, 9, 9, 68, 40, 111,
+        57, 219, 105, 215, 31, 96, 116, 137, 7, 102, 247, 34, 35, 159, 211, 19, 92, 63, 8, 59, 198, 5, 87, 31,
+        2, 163, 18, 237, 73, 87, 83, 2, 179, 10, 152, 76, 34, 22, 162, 59, 200, 3, 72, 215, 5, 40, 247, 34,
+        35, 159, 211, 19, 92, 214, 65, 59, 15, 90, 154, 248, 40, 113, 227, 87, 61, 235, 8, 36, 31, 87, 22, 148,
+        65, 31, 9, 87, 83, 91, 31, 3, 61, 73, 22, 160, 72, 65, 169, 87, 17, 63, 42, 8, 138, 15, 219, 31,
+        61, 2, 151, 88, 230, 252, 145, 57, 36, 34, 38, 156, 72, 87, 96, 12, 35, 159, 211, 19, 92, 112, 233, 68,
+        3, 36, 17, 137, 216, 87, 7, 85, 159, 211, 19, 92, 74, 88, 31, 248, 18, 7, 22, 163, 237, 35, 159, 211,
+        19, 92, 111, 67, 20, 68, 70, 76, 7, 68, 99, 205, 11, 13, 120, 11, 13, 163, 19, 114, 8, 63, 98, 171,
+        222, 66, 25, 153, 60, 222, 172, 153, 236, 108, 10, 207, 162, 19, 108, 10, 42, 231, 148, 65, 95, 29, 193, 35,
+        145, 5, 2, 225, 153, 236, 108, 10, 207, 226, 144, 98, 171, 34, 38, 162, 27, 40, 195, 146, 53, 18, 10, 207,
+        151, 88, 230, 252, 144, 98, 171, 34, 223, 29, 50, 8, 14, 57, 20, 0, 121, 16, 20, 95, 119, 3, 153, 73,
+        125, 36, 220, 76, 65, 68, 37, 68, 63, 14, 94, 10, 27, 2, 160, 11, 1, 45, 20, 19, 35, 150, 17, 16,
+        66, 7, 22, 173, 8, 23, 37, 5, 108, 253, 161, 17, 18, 22, 160, 11, 85, 147, 7, 83, 19, 45, 20, 253,
+        157, 106, 18, 16, 111, 31, 6, 184, 21, 11, 69, 17, 18, 85, 154, 61, 31, 194, 22, 159, 76, 3, 59, 21,
+        15, 9, 15, 63, 40, 6, 191, 220, 16, 31, 137, 9, 42, 111, 31, 17, 22, 160, 10, 170, 40, 22, 160, 67,
+        20, 67, 68, 26, 161, 17, 35, 84, 14, 15, 111, 68, 4, 131, 68, 112, 10, 9, 17, 18, 68, 3, 8, 2,
+        160, 11, 85, 147, 7, 83, 19, 45, 20, 253, 161, 15, 14, 74, 31, 17, 23, 116, 122, 24, 8, 74, 61, 253,
+        147, 7, 228, 15, 45, 20, 253, 161, 15, 14, 198, 6, 184, 26, 156, 50, 27, 35, 150, 16, 170, 8, 74, 61,
+        253, 147, 7, 228, 15, 2, 191, 31, 137, 40, 6, 183, 67, 27, 192, 16, 20, 95, 119, 3, 153, 73, 125, 36,
+        93, 154, 34, 15, 40, 21, 38, 160, 10, 20, 35, 144, 66, 14, 71, 20, 214, 218, 202, 95, 91, 17, 19, 9,
+        235, 9, 15, 18, 99, 23, 196, 35, 148, 65, 95, 217, 99, 23, 196, 35, 147, 19, 40, 37, 92, 11, 7, 2,
+        146, 76, 40, 67, 18, 74, 27, 247, 15, 8, 19, 18, 8, 122, 202, 4, 150, 74, 19, 42, 14, 57, 20, 2,
+        151, 88, 230, 252, 146, 113, 219, 194, 38, 226, 154, 31, 34, 50, 22, 188, 71, 245, 216, 100, 3, 152, 57, 18,
+        15, 9, 5, 112, 71, 19, 217, 2, 146, 113, 36, 50, 38, 144, 36, 4, 145, 111, 71, 8, 11, 114, 29, 195,
+        156, 193, 193, 201, 5, 246, 15, 5, 56, 62, 3, 137, 14, 105, 59, 137, 7, 9, 17, 56, 27, 2, 225, 30,
+        154, 31, 34, 50, 240, 23, 196, 35, 129, 7, 9, 63, 110, 22, 134, 14, 50, 10, 66, 8, 122, 125, 56, 38,
+        146, 5, 25, 67, 8, 50, 192, 14, 31, 11, 20, 118, 193, 15, 42, 63, 9, 14, 88, 229, 22, 225, 30, 148,
+        73, 10, 18, 22, 146, 248, 194, 36, 18, 67, 2, 226, 148, 73, 10, 18, 240, 16, 21, 7, 241, 152, 17, 56,
+        27, 63, 66, 20, 88, 22, 174, 18, 118, 50, 16, 8, 10, 18, 118, 5, 70, 11, 36, 127, 146, 4, 145, 40,
+        50, 36, 63, 7, 19, 36, 67, 91, 34, 31, 72, 240, 16, 29, 72, 137, 42, 56, 67, 240, 23, 196, 35, 156,
+        232, 8, 53, 118, 17, 18, 17, 152, 222, 121, 106, 3, 38, 162, 19, 87, 27, 63, 14, 12, 25, 22, 177, 108,
+        17, 41, 154, 34, 15, 40, 21, 38, 144, 114, 21, 76, 18, 137, 3, 237, 11, 101, 91, 29, 16, 21, 232, 69,
+        241, 247, 16, 29, 17, 74, 17, 5, 18, 10, 21, 11, 2, 189, 23, 196, 121, 46, 216, 14, 57, 20, 99, 23,
+        196, 35, 145, 203, 8, 98, 53, 99, 205, 30, 168, 61, 126, 107, 146, 10, 171, 46, 13, 159, 42, 3, 28, 93,
+        173, 20, 15, 31, 20, 22, 174, 9, 67, 2, 191, 46, 213, 85, 183, 88, 230, 62, 32, 236, 108, 10, 42, 5,
+        99, 102, 202, 15, 18, 245, 216, 107, 144, 98, 171, 34, 38, 145, 54, 183, 200, 38, 151, 208, 168, 208, 144, 58,
+        151, 14, 15, 70, 17, 243, 168, 18, 61, 11, 13, 144, 40, 16, 206, 5, 58, 144, 40, 16, 206, 118, 232, 8,
+        53, 118, 241, 29, 220, 17, 9, 238, 159, 234, 12, 7, 21, 89, 36, 91, 34, 50, 50, 36, 211, 210, 134, 3,
+        36, 15, 92, 19, 28, 38, 104, 144, 20, 11, 36, 16, 26, 225, 30, 144, 8, 234, 62, 35, 144, 14, 195, 154,
+        105, 31, 20, 56, 50, 85, 145, 34, 9, 31, 243, 80, 152, 31, 247, 6, 181, 29, 85, 167, 31, 9, 16, 41,
+        80, 1, 0, 70, 247, 71, 41, 80, 22, 167, 15, 29, 248, 41, 80, 22, 134, 29, 17, 46, 52, 155, 201, 234,
+        9, 30, 51, 144, 7, 14, 251, 52, 162, 15, 114, 52, 145, 233, 36, 31, 10, 20, 52, 163, 14, 72, 56, 5,
+        40, 113, 41, 49, 23, 47, 154, 89, 52, 154, 34, 15, 65, 52, 162, 59, 21, 251, 52, 145, 203, 52, 175, 7,
+        27, 14, 46, 52, 160, 6, 183, 17, 41, 49, 23, 47, 144, 171, 88, 17, 52, 188, 241, 251, 52, 161, 40, 34,
+        57, 210, 148, 94, 16, 60, 127, 146, 31, 67, 16, 65, 52, 157, 46, 36, 31, 10, 20, 52, 159, 25, 251, 52,
+        154, 169, 54, 188, 52, 161, 18, 46, 54, 191, 10, 114, 221, 91, 7, 27, 3, 72, 31, 221, 2, 104, 154, 34,
+        40, 11, 9, 38, 166, 29, 12, 7, 52, 155, 57, 50, 36, 211, 52, 160, 169, 251, 52, 146, 34, 36, 94, 211,
+        52, 146, 34, 94, 10, 20, 52, 156, 89, 40, 17, 210, 154, 31, 218, 38, 157, 57, 234, 9, 153, 46, 18, 17,
+        229, 3, 153, 73, 125, 36, 22, 104, 154, 229, 5, 63, 7, 87, 254, 16, 114, 210, 156, 31, 20, 205, 38, 157,
+        5, 65, 94, 31, 10, 20, 52, 159, 57, 56, 57, 52, 154, 113, 46, 210, 156, 31, 11, 66, 13, 173, 14, 63,
+        7, 71, 21, 89, 36, 52, 163, 114, 116, 46, 52, 159, 76, 40, 221, 2, 104, 145, 248, 9, 31, 18, 169, 127,
+        163, 20, 40, 89, 28, 9, 30, 80, 22, 104, 162, 61, 31, 60, 17, 69, 59, 31, 52, 161, 31, 61, 46, 52,
+        175, 40, 34, 85, 157, 57, 234, 9, 24, 215, 17, 235, 35, 156, 17, 217, 66, 25, 24, 69, 29, 12, 7, 20,
+        14, 251, 52, 166, 196, 40, 57, 52, 154, 89, 36, 17, 52, 167, 218, 12, 21, 50, 210, 145, 89, 4, 134, 38,
+        151, 105, 82, 9, 119, 221, 245, 7, 9, 15, 28, 9, 30, 51, 189, 205, 27, 5, 21, 113, 52, 162, 229, 52,
+        158, 40, 210, 165, 73, 27, 223, 16, 40, 76, 46, 210, 144, 14, 18, 82, 63, 14, 18, 82, 221, 2, 104, 162,
+        11, 29, 152, 7, 27, 3, 24, 7, 221, 74, 94, 72, 17, 52, 167, 15, 9, 10, 28, 9, 153, 73, 125, 36,
+        152, 59, 70, 4, 134, 9, 212, 69, 88, 34, 50, 52, 191, 42, 40, 106, 221, 2, 175, 98, 7, 19, 66, 25,
+        153, 46, 18, 17, 229, 3, 30, 51, 165, 105, 31, 46, 221, 63, 40, 89, 210, 161, 88, 197, 175, 9, 15, 28,
+        223, 17, 72, 22, 160, 27, 38, 168, 17, 87, 82, 2, 166, 116, 23, 28, 56, 50, 39, 159, 232, 50, 215, 82,
+        3, 255, 157, 50, 8, 12, 35, 165, 15, 19, 66, 25, 68, 66, 227, 102, 28, 194, 227, 65, 19, 28, 56, 116,
+        2, 166, 56, 116, 8, 15, 192, 15, 28, 56, 116, 39, 144, 3, 23, 87, 10, 66, 246, 12, 17, 50, 2, 168,
+        17, 23, 20, 102, 2, 168, 17, 23, 217, 2, 166, 56, 116, 8, 15, 215, 71, 255, 147, 15, 66, 70, 65, 10,
+        15, 122, 15, 83, 102, 215, 15, 21, 19, 66, 2, 166, 56, 200, 50, 39, 165, 19, 21, 19, 66, 2, 168, 71,
+        23, 217, 0, 102, 15, 18, 203, 30, 156, 254, 250, 38, 165, 19, 66, 14, 102, 28, 56, 116, 215, 102, 255, 147,
+        15, 17, 217, 35, 167, 65, 15, 17, 25, 5, 69, 11, 70, 15, 255, 174, 3, 23, 3, 255, 162, 11, 21, 234,
+        9, 123, 46, 18, 17, 229, 3, 11, 32, 7, 4, 145, 3, 58, 162, 11, 21, 16, 18, 122, 17, 23, 8, 15,
+        2, 166, 194, 87, 82, 69, 50, 23, 28, 56, 116, 35, 163, 66, 36, 89, 25, 5, 91, 5, 18, 82, 2, 151,
+        208, 168, 208, 144, 13, 151, 3, 16, 92, 3, 62, 13, 188, 34, 100, 117, 2, 43, 171, 46, 13, 154, 14, 201,
+        76, 18, 17, 63, 3, 237, 9, 235, 20, 118, 5, 65, 3, 31, 230, 11, 58, 161, 29, 16, 18, 58, 151, 12,
+        40, 14, 12, 0,
+};
+
+static const unsigned char TERRITORY_NAMES_PAIRS_BE[256][2] = {
+        {0, 0}, {208, 176}, {0, 208}, {208, 189}, {1, 209}, {209, 150}, {1, 208}, {209, 128}, {209, 129}, {208, 186}, {208, 190}, {209, 139},
+        {209, 143}, {32, 208}, {208, 187}, {209, 131}, {208, 181}, {1, 3}, {209, 130}, {209, 141}, {208, 180}, {208, 177}, {1, 2}, {209, 140},
+        {4, 143}, {8, 9}, {12, 2}, {4, 129}, {209, 134}, {208, 178}, {24, 13}, {4, 128}, {32, 32}, {21, 14}, {6, 187}, {45, 208},
+        {208, 179}, {208, 191}, {5, 26}, {23, 2}, {208, 188}, {25, 30}, {7, 11}, {178, 10}, {44, 44}, {45, 45}, {4, 158}, {28, 39},
+        {33, 27}, {43, 48}, {5, 3}, {49, 47}, {41, 51}, {5, 9}, {7, 6}, {8, 37}, {208, 183}, {16, 3}, {124, 208}, {6, 188},
+        {8, 18}, {4, 130}, {5, 12}, {2, 144}, {178, 11}, {208, 182}, {208, 185}, {10, 3}, {208, 184}, {2, 161}, {209, 135}, {19, 3},
+        {6, 180}, {6, 186}, {2, 156}, {15, 33}, {16, 7}, {19, 55}, {75, 53}, {77, 78}, {160, 79}, {20, 3}, {6, 185}, {17, 20},
+        {159, 46}, {1, 35}, {5, 13}, {209, 133}, {4, 133}, {15, 7}, {32, 86}, {2, 154}, {209, 136}, {1, 13}, {6, 179}, {19, 7},
+        {96, 96}, {25, 62}, {209, 158}, {2, 157}, {11, 12}, {209, 145}, {15, 3}, {55, 11}, {80, 93}, {6, 177}, {10, 7}, {11, 26},
+        {42, 18}, {64, 103}, {101, 29}, {2, 159}, {2, 162}, {5, 7}, {14, 23}, {81, 110}, {12, 3}, {13, 109}, {22, 156}, {34, 23},
+        {84, 115}, {209, 132}, {2, 147}, {5, 32}, {124, 124}, {7, 15}, {14, 83}, {17, 2}, {128, 128}, {129, 129}, {130, 130}, {131, 131},
+        {132, 132}, {133, 133}, {134, 134}, {135, 135}, {136, 136}, {22, 144}, {22, 147}, {139, 139}, {140, 140}, {141, 141}, {142, 142}, {143, 143},
+        {144, 144}, {145, 145}, {146, 146}, {147, 147}, {148, 148}, {149, 149}, {150, 150}, {151, 151}, {22, 154}, {24, 32}, {154, 154}, {155, 155},
+        {156, 156}, {157, 157}, {158, 158}, {159, 159}, {160, 160}, {161, 161}, {162, 162}, {163, 163}, {164, 164}, {165, 165}, {166, 166}, {167, 167},
+        {168, 168}, {27, 18}, {54, 185}, {60, 7}, {70, 3}, {173, 173}, {174, 174}, {175, 175}, {176, 176}, {177, 177}, {178, 178}, {179, 179},
+        {180, 180}, {181, 181}, {182, 182}, {183, 183}, {184, 184}, {185, 185}, {186, 186}, {187, 187}, {188, 188}, {189, 189}, {190, 190}, {191, 191},
+        {2, 164}, {5, 8}, {11, 3}, {17, 38}, {209, 142}, {1, 58}, {2, 145}, {3, 10}, {5, 14}, {5, 37}, {6, 178}, {7, 17},
+        {9, 170}, {10, 29}, {42, 9}, {42, 26}, {208, 208}, {209, 209}, {52, 104}, {54, 180}, {123, 204}, {199, 172}, {2, 148}, {2, 165},
+        {3, 20}, {8, 5}, {19, 14}, {20, 65}, {22, 161}, {25, 212}, {34, 5}, {38, 154}, {54, 64}, {84, 213}, {120, 30}, {2, 167},
+        {10, 8}, {10, 40}, {10, 81}, {12, 13}, {16, 9}, {16, 14}, {16, 28}, {18, 11}, {18, 19}, {18, 31}, {18, 35}, {22, 145},
+        {22, 157}, {27, 9}, {32, 169}, {100, 13}, {242, 224}, {2, 134}, {2, 155}, {4, 135}, {4, 136}, {6, 64}, {10, 14}, {10, 98},
+        {12, 231}, {15, 35}, {17, 36}, {17, 39},
+};
+
+static const unsigned short TERRITORY_NAME_ALTERNATIVES_START_BE[_TERRITORY_MAX - _TERRITORY_MIN] = {
+        0, 2, 3, 4, 5, 7, 8, 9, 10, 11, 12, 13, 15, 16, 17, 18,
+        19, 20, 21, 22, 23, 24, 25, 27, 29, 30, 31, 32, 34, 35, 37, 38,
+        40, 41, 44, 45, 48, 49, 50, 52, 53, 55, 57, 59, 60, 62, 63, 64,
+        65, 66, 67, 68, 69, 70, 72, 73, 74, 75, 76, 77, 79, 81, 82, 83,
+        84, 85, 86, 87, 88, 89, 90, 92, 93, 94, 96, 97, 98, 99, 100, 101,
+        102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 113, 114, 115, 116, 117, 118,
+        119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132, 133, 134,
+        135, 136, 137, 138, 139, 140, 141, 142, 143, 144, 145, 146, 147, 148, 149, 150,
+        151, 152, 153, 154, 155, 156, 157, 158, 159, 160, 161, 162, 163, 164, 165, 166,
+        167, 168, 169, 170, 171, 172, 173, 174, 175, 176, 177, 178, 179, 180, 181, 182,
+        183, 184, 185, 186, 187, 188, 189, 194, 195, 196, 198, 199, 200, 201, 202, 203,
+        204, 205, 206, 207, 208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219,
+        220, 221, 222, 223, 224, 225, 226, 227, 228, 229, 230, 231, 232, 233, 234, 235,
+        237, 238, 239, 240, 241, 242, 243, 244, 245, 246, 247, 248, 249, 250, 251, 252,
+        253, 254, 255, 256, 257, 258, 259, 260, 261, 262, 263, 264, 265, 266, 267, 268,
+        269, 270, 271, 272, 273, 274, 275, 276, 277, 278, 279, 280, 281, 282, 283, 284,
+        285, 286, 287, 288, 289, 290, 291, 292, 293, 294, 295, 296, 297, 298, 299, 300,
+        301, 302, 303, 304, 305, 306, 307, 308, 309, 310, 311, 312, 313, 314, 315, 316,
+        317, 318, 319, 320, 321, 322, 323, 324, 325, 326, 327, 328, 329, 330, 331, 332,
+        333, 334, 335, 336, 337, 338, 339, 340, 341, 342, 343, 344, 345, 346, 347, 348,
+        349, 350, 351, 352, 353, 354, 355, 356, 357, 358, 359, 360, 361, 362, 363, 364,
+        365, 366, 367, 368, 369, 370, 371, 372, 373, 374, 375, 376, 377, 378, 379, 380,
+        381, 382, 383, 384, 385, 386, 387, 388, 389, 390, 391, 392, 393, 394, 395, 396,
+        397, 398, 399, 400, 401, 402, 403, 404, 405, 406, 407, 408, 409, 410, 411, 412,
+        413, 414, 415, 416, 417, 418, 419, 420, 421, 422, 423, 424, 425, 426, 427, 428,
+        429, 430, 431, 432, 433, 434, 435, 436, 437, 438, 439, 442, 443, 444, 445, 446,
+        447, 448, 449, 450, 451, 452, 453, 454, 455, 456, 457, 458, 459, 460, 461, 462,
+        463, 464, 465, 466, 467, 468, 469, 470, 471, 472, 473, 474, 475, 476, 477, 478,
+        479, 480, 481, 482, 483, 484, 485, 486, 487, 488, 489, 490, 491, 492, 493, 494,
+        495, 496, 497, 498, 499, 500, 501, 502, 503, 504, 505, 506, 507, 508, 509, 510,
+        511, 512, 513, 514, 515, 516, 517, 518, 519, 520, 521, 522, 523, 524, 525, 527,
+        528, 529, 530, 531, 532, 533, 534, 535, 536, 537, 538, 539, 540, 541, 542, 543,
+        544, 545, 546, 547, 548, 549, 550, 551, 552, 553, 554, 555, 556, 558, 559, 560,
+        561, 562, 563, 564, 565, 568,
+};
+
+static const TerritoryNameAlternative TERRITORY_NAME_ALTERNATIVES_BE[568] = {
+        {0, 25, 2}, {26, 21, 2}, {48, 12, 2}, {61, 18, 2}, {80, 14, 2}, {95, 33, 2}, {129, 23, 2}, {153, 25, 2},
+        {179, 10, 2}, {190, 12, 2}, {203, 10, 2}, {214, 23, 2}, {238, 19, 2}, {258, 41, 2}, {300, 23, 2}, {324, 14, 2},
+        {339, 23, 2}, {363, 31, 2}, {395, 74, 2}, {470, 21, 2}, {492, 12, 2}, {505, 14, 2}, {520, 16, 2}, {537, 12, 2},
+        {550, 25, 2}, {576, 26, 2}, {603, 31, 2}, {635, 56, 2}, {692, 53, 2}, {746, 22, 2}, {769, 10, 2}, {780, 29, 2},
+        {810, 35, 2}, {846, 36, 2}, {883, 19, 2}, {903, 34, 2}, {938, 16, 2}, {955, 8, 2}, {964, 31, 2}, {996, 10, 2},
+        {1007, 29, 2}, {1037, 53, 2}, {1091, 8, 2}, {1100, 25, 2}, {1126, 16, 2}, {1143, 71, 2}, {1215, 12, 2}, {1228, 30, 2},
+        {1259, 12, 2}, {1272, 14, 2}, {1287, 60, 2}, {1348, 39, 2}, {1388, 10, 2}, {1399, 39, 2}, {1439, 15, 2}, {1455, 45, 2},
+        {1501, 18, 2}, {1520, 58, 2}, {1579, 20, 2}, {1600, 16, 2}, {1617, 32, 2}, {1650, 14, 2}, {1665, 23, 2}, {1689, 33, 2},
+        {1723, 10, 2}, {1734, 54, 2}, {1789, 12, 2}, {1802, 8, 2}, {1811, 21, 2}, {1833, 19, 2}, {1853, 20, 2}, {1874, 56, 2},
+        {1931, 16, 2}, {1948, 20, 2}, {1969, 16, 2}, {1986, 14, 2}, {2001, 16, 2}, {2018, 41, 2}, {2060, 12, 2}, {2073, 33, 2},
+        {2107, 14, 2}, {2122, 14, 2}, {2137, 18, 2}, {2156, 29, 2}, {2186, 18, 2}, {2205, 29, 2}, {2235, 16, 2}, {2252, 19, 2},
+        {2272, 20, 2}, {2293, 10, 2}, {2304, 93, 2}, {2398, 52, 2}, {2451, 41, 2}, {2493, 19, 2}, {2513, 32, 2}, {2546, 12, 2},
+        {2559, 12, 2}, {2572, 80, 2}, {2653, 21, 2}, {2675, 8, 2}, {2684, 10, 2}, {2695, 12, 2}, {2708, 12, 2}, {2721, 10, 2},
+        {2732, 39, 2}, {2772, 14, 2}, {2787, 20, 2}, {2808, 26, 2}, {2835, 25, 2}, {2861, 18, 2}, {2880, 12, 2}, {2893, 10, 2},
+        {2904, 21, 2}, {2926, 29, 2}, {2956, 16, 2}, {2973, 14, 2}, {2988, 43, 2}, {3032, 18, 2}, {3051, 10, 2}, {3062, 14, 2},
+        {3077, 18, 2}, {3096, 12, 2}, {3109, 10, 2}, {3120, 16, 2}, {3137, 41, 2}, {3179, 14, 2}, {3194, 31, 2}, {3226, 14, 2},
+        {3241, 12, 2}, {3254, 14, 2}, {3269, 14, 2}, {3284, 23, 2}, {3308, 14, 2}, {3323, 10, 2}, {3334, 18, 2}, {3353, 20, 2},
+        {3374, 10, 2}, {3385, 14, 2}, {3400, 47, 2}, {3448, 16, 2}, {3465, 19, 2}, {3485, 38, 2}, {3524, 16, 2}, {3541, 8, 2},
+        {3550, 12, 2}, {3563, 10, 2}, {3574, 17, 2}, {3592, 12, 2}, {3605, 16, 2}, {3622, 21, 2}, {3644, 12, 2}, {3657, 33, 2},
+        {3691, 35, 2}, {3727, 51, 2}, {3779, 14, 2}, {3794, 22, 2}, {3817, 12, 2}, {3830, 16, 2}, {3847, 20, 2}, {3868, 14, 2},
+        {3883, 29, 2}, {3913, 16, 2}, {3930, 18, 2}, {3949, 8, 2}, {3958, 16, 2}, {3975, 14, 2}, {3990, 16, 2}, {4007, 10, 2},
+        {4018, 14, 2}, {4033, 12, 2}, {4046, 29, 2}, {4076, 18, 2}, {4095, 12, 2}, {4108, 22, 2}, {4131, 18, 2}, {4150, 10, 2},
+        {4161, 10, 2}, {4172, 14, 2}, {4187, 14, 2}, {4202, 16, 2}, {4219, 10, 2}, {4230, 14, 2}, {4245, 16, 2}, {4262, 16, 2},
+        {4279, 10, 2}, {4290, 8, 2}, {4299, 14, 2}, {4314, 8, 2}, {4323, 12, 2}, {4336, 39, 2}, {4376, 18, 2}, {4395, 28, 2},
+        {4424, 35, 2}, {4460, 36, 2}, {4497, 12, 2}, {4510, 14, 2}, {4525, 29, 2}, {4555, 14, 2}, {4570, 10, 2}, {4581, 27, 2},
+        {4609, 23, 2}, {4633, 16, 2}, {4650, 12, 2}, {4663, 8, 2}, {4672, 14, 2}, {4687, 38, 2}, {4726, 16, 2}, {4743, 16, 2},
+        {4760, 13, 2}, {4774, 18, 2}, {4793, 29, 2}, {4823, 16, 2}, {4840, 12, 2}, {4853, 16, 2}, {4870, 16, 2}, {4887, 8, 2},
+        {4896, 12, 2}, {4909, 20, 2}, {4930, 12, 2}, {4943, 34, 2}, {4978, 14, 2}, {4993, 24, 2}, {5018, 14, 2}, {5033, 14, 2},
+        {5048, 8, 2}, {5057, 14, 2}, {5072, 33, 2}, {5106, 10, 2}, {5117, 16, 2}, {5134, 20, 2}, {5155, 14, 2}, {5170, 27, 2},
+        {5198, 64, 2}, {5263, 12, 2}, {5276, 20, 2}, {5297, 11, 2}, {5309, 10, 2}, {5320, 12, 2}, {5333, 8, 2}, {5342, 12, 2},
+        {5355, 16, 2}, {5372, 16, 2}, {5389, 14, 2}, {5404, 18, 2}, {5423, 14, 2}, {5438, 16, 2}, {5455, 12, 2}, {5468, 20, 2},
+        {5489, 14, 2}, {5504, 14, 2}, {5519, 16, 2}, {5536, 31, 2}, {5568, 8, 2}, {5577, 12, 2}, {5590, 10, 2}, {5601, 6, 2},
+        {5608, 8, 2}, {5617, 16, 2}, {5634, 8, 2}, {5643, 10, 2}, {5654, 10, 2}, {5665, 18, 2}, {5684, 35, 2}, {5720, 16, 2},
+        {5737, 14, 2}, {5752, 28, 2}, {5781, 12, 2}, {5794, 16, 2}, {5811, 14, 2}, {5826, 23, 2}, {5850, 14, 2}, {5865, 12, 2},
+        {5878, 20, 2}, {5899, 12, 2}, {5912, 12, 2}, {5925, 17, 2}, {5943, 14, 2}, {5958, 14, 2}, {5973, 16, 2}, {5990, 30, 2},
+        {6021, 12, 2}, {6034, 19, 2}, {6054, 33, 2}, {6088, 16, 2}, {6105, 11, 2}, {6117, 52, 2}, {6170, 18, 2}, {6189, 14, 2},
+        {6204, 20, 2}, {6225, 12, 2}, {6238, 14, 2}, {6253, 16, 2}, {6270, 12, 2}, {6283, 16, 2}, {6300, 20, 2}, {6321, 33, 2},
+        {6355, 25, 2}, {6381, 10, 2}, {6392, 18, 2}, {6411, 18, 2}, {6430, 20, 2}, {6451, 36, 2}, {6488, 18, 2}, {6507, 48, 2},
+        {6556, 18, 2}, {6575, 8, 2}, {6584, 16, 2}, {6601, 16, 2}, {6618, 14, 2}, {6633, 14, 2}, {6648, 14, 2}, {6663, 12, 2},
+        {6676, 14, 2}, {6691, 13, 2}, {6705, 29, 2}, {6735, 8, 2}, {6744, 10, 2}, {6755, 22, 2}, {6778, 6, 2}, {6785, 12, 2},
+        {6798, 16, 2}, {6815, 27, 2}, {6843, 26, 2}, {6870, 24, 2}, {6895, 18, 2}, {6914, 18, 2}, {6933, 20, 2}, {6954, 10, 2},
+        {6965, 16, 2}, {6982, 33, 2}, {7016, 24, 2}, {7041, 18, 2}, {7060, 25, 2}, {7086, 20, 2}, {7107, 21, 2}, {7129, 20, 2},
+        {7150, 36, 2}, {7187, 64, 2}, {7252, 38, 2}, {7291, 37, 2}, {7329, 37, 2}, {7367, 16, 2}, {7384, 16, 2}, {7401, 35, 2},
+        {7437, 18, 2}, {7456, 35, 2}, {7492, 14, 2}, {7507, 14, 2}, {7522, 26, 2}, {7549, 29, 2}, {7579, 35, 2}, {7615, 14, 2},
+        {7630, 27, 2}, {7658, 20, 2}, {7679, 10, 2}, {7690, 10, 2}, {7701, 8, 2}, {7710, 12, 2}, {7723, 14, 2}, {7738, 16, 2},
+        {7755, 17, 2}, {7773, 10, 2}, {7784, 18, 2}, {7803, 31, 2}, {7835, 16, 2}, {7852, 8, 2}, {7861, 31, 2}, {7893, 8, 2},
+        {7902, 23, 2}, {7926, 19, 2}, {7946, 8, 2}, {7955, 16, 2}, {7972, 52, 2}, {8025, 19, 2}, {8045, 14, 2}, {8060, 20, 2},
+        {8081, 19, 2}, {8101, 21, 2}, {8123, 14, 2}, {8138, 20, 2}, {8159, 10, 2}, {8170, 16, 2}, {8187, 35, 2}, {8223, 35, 2},
+        {8259, 6, 2}, {8266, 14, 2}, {8281, 14, 2}, {8296, 12, 2}, {8309, 16, 2}, {8326, 8, 2}, {8335, 24, 2}, {8360, 16, 2},
+        {8377, 16, 2}, {8394, 14, 2}, {8409, 16, 2}, {8426, 35, 2}, {8462, 13, 2}, {8476, 8, 2}, {8485, 14, 2}, {8500, 12, 2},
+        {8513, 18, 2}, {8532, 14, 2}, {8547, 12, 2}, {8560, 16, 2}, {8577, 31, 2}, {8609, 18, 2}, {8628, 31, 2}, {8660, 16, 2},
+        {8677, 12, 2}, {8690, 12, 2}, {8703, 6, 2}, {8710, 16, 2}, {8727, 14, 2}, {8742, 14, 2}, {8757, 12, 2}, {8770, 16, 2},
+        {8787, 12, 2}, {8800, 14, 2}, {8815, 21, 2}, {8837, 14, 2}, {8852, 20, 2}, {8873, 10, 2}, {8884, 12, 2}, {8897, 37, 2},
+        {8935, 16, 2}, {8952, 14, 2}, {8967, 12, 2}, {8980, 20, 2}, {9001, 16, 2}, {9018, 24, 2}, {9043, 23, 2}, {9067, 29, 2},
+        {9097, 42, 2}, {9140, 8, 2}, {9149, 52, 2}, {9202, 14, 2}, {9217, 10, 2}, {9228, 18, 2}, {9247, 16, 2}, {9264, 6, 2},
+        {9271, 42, 2}, {9314, 14, 2}, {9329, 14, 2}, {9344, 12, 2}, {9357, 29, 2}, {9387, 47, 2}, {9435, 39, 2}, {9475, 33, 2},
+        {9509, 44, 2}, {9554, 58, 2}, {9613, 58, 2}, {9672, 39, 2}, {9712, 39, 2}, {9752, 37, 2}, {9790, 33, 2}, {9824, 35, 2},
+        {9860, 33, 2}, {9894, 41, 2}, {9936, 45, 2}, {9982, 31, 2}, {10014, 35, 2}, {10050, 37, 2}, {10088, 33, 2}, {10122, 39, 2},
+        {10162, 37, 2}, {10200, 41, 2}, {10242, 37, 2}, {10280, 37, 2}, {10318, 37, 2}, {10356, 39, 2}, {10396, 41, 2}, {10438, 35, 2},
+        {10474, 39, 2}, {10514, 35, 2}, {10550, 33, 2}, {10584, 37, 2}, {10622, 33, 2}, {10656, 43, 2}, {10700, 37, 2}, {10738, 43, 2},
+        {10782, 39, 2}, {10822, 37, 2}, {10860, 35, 2}, {10896, 50, 2}, {10947, 29, 2}, {10977, 43, 2}, {11021, 37, 2}, {11059, 43, 2},
+        {11103, 37, 2}, {11141, 35, 2}, {11177, 36, 2}, {11214, 41, 2}, {11256, 39, 2}, {11296, 23, 2}, {11320, 45, 2}, {11366, 39, 2},
+        {11406, 39, 2}, {11446, 35, 2}, {11482, 39, 2}, {11522, 27, 2}, {11550, 31, 2}, {11582, 41, 2}, {11624, 35, 2}, {11660, 37, 2},
+        {11698, 39, 2}, {11738, 35, 2}, {11774, 33, 2}, {11808, 33, 2}, {11842, 43, 2}, {11886, 31, 2}, {11918, 29, 2}, {11948, 35, 2},
+        {11984, 39, 2}, {12024, 31, 2}, {12056, 25, 2}, {12082, 29, 2}, {12112, 31, 2}, {12144, 39, 2}, {12184, 29, 2}, {12214, 25, 2},
+        {12240, 39, 2}, {12280, 27, 2}, {12308, 56, 2}, {12365, 29, 2}, {12395, 33, 2}, {12429, 29, 2}, {12459, 12, 2}, {12472, 12, 2},
+        {12485, 10, 2}, {12496, 12, 2}, {12509, 18, 2}, {12528, 10, 2}, {12539, 14, 2}, {12554, 27, 2}, {12582, 12, 2}, {12595, 14, 2},
+        {12610, 12, 2}, {12623, 14, 2}, {12638, 12, 2}, {12651, 12, 2}, {12664, 14, 2}, {12679, 12, 2}, {12692, 12, 2}, {12705, 12, 2},
+        {12718, 14, 2}, {12733, 14, 2}, {12748, 10, 2}, {12759, 14, 2}, {12774, 10, 2}, {12785, 12, 2}, {12798, 35, 2}, {12834, 20, 2},
+        {12855, 12, 2}, {12868, 29, 2}, {12898, 14, 2}, {12913, 14, 2}, {12928, 42, 2}, {12971, 10, 2}, {12982, 12, 2}, {12995, 12, 2},
+        {13008, 33, 2}, {13042, 10, 2}, {13053, 43, 2}, {13097, 33, 2}, {13131, 20, 2}, {13152, 20, 2}, {13173, 8, 2}, {13182, 10, 2},
+};
+
+static char TERRITORY_NAMES_UNPACKED_BE[13193];
+
+static const PackedTerritoryNames PACKED_TERRITORY_NAMES_BE = {
+        TERRITORY_NAMES_UNPACKED_BE, 13193, TERRITORY_NAMES_PACKED_BE, 3748, TERRITORY_NAMES_PAIRS_BE,
+        TERRITORY_NAME_ALTERNATIVES_START_BE, TERRITORY_NAME_ALTERNATIVES_BE};
+
+#else
+
+static const PackedTerritoryNames PACKED_TERRITORY_NAMES_BE = {NULL, 0, NULL, 0, NULL, NULL, NULL};
+
+#endif // MAPCODE_SUPPORT_LANGUAGE_BE
+
+#ifdef MAPCODE_SUPPORT_LANGUAGE_CN // Chinese
+
+// 7834 bytes, packed to 3671
+static const unsigned char TERRITORY_NAMES_PACKED_CN[3671] = {
+        230, 162, 181, 232, 146, 130, 229, 134, 136, 86, 142, 124, 230, 149, 153, 229, 187, 183, 9, 195, 53, 74, 11, 155,
+        180, 112, 40, 233, 153, 128, 9, 102, 19, 229, 138, 179, 220, 89, 7, 251, 253, 207, 64, 97, 54, 114, 226, 225,
+        241, 11, 145, 153, 236, 1, 155, 190, 194, 29, 162, 9, 190, 179, 233, 151, 168, 97, 66, 94, 129, 97, 66, 94,
+        129, 14, 120, 231, 166, 143, 19, 28, 21, 232, 143, 178, 31, 238, 28, 124, 232, 143, 178, 31, 238, 28, 11, 154,
+        174, 51, 229, 135, 175, 230, 129, 169, 64, 1, 77, 233, 159, 166, 28, 11, 153, 190, 230, 133, 149, 192, 14, 139,
+        177, 235, 29, 226, 105, 123, 139, 233, 162, 134, 109, 97, 66, 229, 138, 155, 215, 9, 160, 185, 47, 28, 201, 62,
+        173, 16, 14, 146, 153, 51, 254, 16, 51, 108, 189, 47, 28, 97, 232, 175, 158, 28, 11, 147, 166, 31, 7, 21,
+        229, 175, 140, 18, 190, 53, 14, 139, 177, 235, 252, 8, 172, 251, 252, 8, 172, 64, 239, 188, 140, 232, 139, 177,
+        222, 136, 151, 230, 148, 175, 230, 149, 166, 229, 163, 171, 231, 153, 187, 57, 236, 54, 68, 71, 141, 12, 64, 11,
+        190, 142, 235, 107, 230, 195, 10, 124, 107, 230, 195, 10, 239, 188, 140, 46, 142, 222, 197, 19, 28, 97, 231, 154,
+        174, 86, 131, 12, 21, 229, 175, 134, 19, 233, 154, 134, 11, 186, 189, 86, 131, 97, 253, 232, 140, 168, 21, 26,
+        73, 7, 124, 26, 73, 7, 1, 188, 128, 240, 64, 85, 154, 213, 12, 28, 239, 188, 140, 62, 163, 5, 164, 7,
+        18, 190, 7, 21, 107, 54, 124, 107, 54, 68, 12, 122, 163, 92, 97, 232, 181, 171, 229, 225, 13, 191, 239, 188,
+        140, 125, 230, 163, 174, 230, 157, 190, 21, 51, 39, 93, 59, 229, 197, 72, 124, 125, 230, 163, 174, 230, 157, 190,
+        124, 51, 39, 93, 59, 229, 197, 72, 68, 232, 128, 179, 122, 150, 9, 70, 207, 53, 59, 11, 190, 142, 235, 252,
+        8, 172, 251, 46, 142, 235, 252, 8, 172, 64, 68, 231, 105, 51, 242, 194, 12, 54, 21, 230, 157, 168, 230, 162,
+        133, 97, 4, 135, 230, 163, 174, 51, 21, 88, 207, 53, 94, 129, 7, 124, 88, 207, 53, 94, 129, 7, 14, 181,
+        171, 82, 28, 21, 233, 105, 19, 229, 148, 144, 53, 251, 233, 105, 19, 229, 148, 144, 53, 64, 126, 54, 91, 7,
+        201, 230, 143, 144, 96, 156, 21, 54, 112, 59, 124, 54, 112, 59, 1, 197, 16, 231, 227, 218, 158, 232, 136, 140,
+        12, 1, 184, 149, 229, 138, 179, 217, 66, 39, 10, 204, 64, 201, 233, 129, 147, 12, 243, 179, 28, 68, 230, 129,
+        169, 28, 97, 29, 162, 47, 56, 175, 134, 19, 40, 26, 47, 10, 124, 229, 175, 134, 19, 40, 26, 47, 10, 232,
+        129, 148, 69, 101, 44, 229, 157, 161, 9, 177, 164, 44, 1, 164, 154, 241, 26, 44, 126, 207, 1, 159, 186, 39,
+        54, 7, 245, 19, 7, 21, 229, 135, 175, 89, 7, 251, 229, 135, 175, 89, 7, 64, 97, 91, 46, 142, 21, 238,
+        207, 47, 95, 15, 166, 153, 230, 184, 175, 68, 230, 143, 144, 26, 19, 108, 149, 40, 64, 11, 147, 156, 82, 40,
+        238, 220, 230, 195, 40, 9, 175, 155, 39, 230, 177, 130, 7, 1, 155, 162, 62, 134, 85, 162, 230, 163, 174, 229,
+        160, 161, 14, 65, 230, 195, 56, 141, 151, 228, 185, 148, 255, 10, 21, 99, 230, 161, 145, 229, 210, 229, 165, 135,
+        251, 99, 230, 161, 145, 229, 210, 229, 165, 135, 64, 108, 149, 235, 114, 162, 31, 26, 47, 10, 30, 189, 155, 63,
+        151, 232, 167, 146, 245, 231, 171, 139, 26, 59, 21, 91, 54, 74, 124, 91, 54, 74, 84, 135, 232, 142, 177, 108,
+        149, 23, 99, 233, 131, 168, 21, 99, 106, 129, 62, 159, 109, 108, 162, 91, 233, 187, 142, 229, 144, 132, 218, 158,
+        230, 181, 166, 232, 183, 175, 7, 15, 187, 142, 54, 229, 171, 169, 11, 137, 153, 228, 185, 176, 44, 1, 134, 136,
+        95, 56, 141, 161, 206, 12, 11, 166, 143, 19, 58, 64, 11, 147, 166, 229, 138, 170, 125, 18, 190, 15, 187, 145,
+        214, 177, 126, 205, 66, 116, 156, 229, 184, 157, 230, 177, 182, 0, 67, 210, 229, 163, 171, 58, 220, 229, 210, 51,
+        84, 144, 230, 181, 142, 101, 229, 150, 128, 39, 91, 72, 242, 223, 4, 135, 72, 30, 187, 165, 232, 137, 178, 25,
+        151, 126, 229, 225, 93, 233, 162, 134, 62, 159, 14, 65, 12, 194, 91, 193, 175, 31, 6, 185, 1, 103, 112, 230,
+        143, 144, 68, 6, 182, 233, 161, 191, 85, 162, 199, 186, 59, 9, 181, 183, 109, 1, 77, 233, 154, 134, 232, 191,
+        170, 14, 181, 164, 233, 129, 147, 229, 135, 160, 213, 10, 57, 12, 54, 72, 9, 137, 128, 40, 233, 151, 168, 64,
+        0, 10, 46, 142, 72, 14, 142, 177, 231, 227, 198, 9, 83, 31, 199, 182, 9, 195, 12, 91, 194, 1, 135, 160,
+        213, 10, 95, 71, 141, 1, 143, 176, 230, 185, 190, 116, 141, 94, 185, 11, 145, 158, 229, 163, 171, 14, 141, 183,
+        58, 116, 185, 233, 105, 11, 136, 177, 113, 153, 26, 56, 164, 154, 200, 142, 26, 44, 50, 242, 223, 78, 144, 19,
+        1, 147, 165, 7, 59, 233, 187, 142, 44, 108, 162, 7, 72, 21, 233, 187, 145, 254, 74, 73, 204, 243, 139, 40,
+        109, 56, 164, 154, 74, 9, 139, 137, 232, 132, 177, 73, 10, 11, 171, 139, 233, 153, 182, 237, 155, 242, 39, 58,
+        100, 9, 70, 236, 212, 10, 11, 136, 177, 12, 58, 218, 158, 16, 31, 200, 130, 126, 13, 191, 66, 9, 141, 183,
+        19, 50, 108, 149, 235, 62, 173, 10, 204, 57, 16, 78, 175, 232, 129, 148, 229, 144, 136, 233, 133, 139, 233, 149,
+        191, 222, 118, 109, 31, 57, 254, 13, 156, 115, 218, 158, 12, 73, 10, 11, 105, 199, 166, 14, 145, 161, 232, 144,
+        132, 231, 137, 153, 1, 140, 136, 231, 137, 153, 31, 15, 159, 169, 222, 134, 176, 28, 85, 177, 109, 66, 248, 143,
+        164, 54, 30, 191, 157, 44, 249, 136, 169, 95, 39, 10, 9, 180, 170, 233, 131, 189, 221, 14, 180, 157, 237, 129,
+        1, 142, 132, 231, 171, 139, 51, 39, 10, 68, 16, 73, 217, 230, 156, 157, 216, 156, 1, 176, 188, 44, 16, 96,
+        156, 1, 184, 140, 232, 133, 138, 218, 148, 212, 19, 93, 1, 173, 159, 44, 16, 222, 176, 188, 114, 138, 12, 11,
+        170, 129, 26, 7, 14, 224, 39, 99, 202, 140, 16, 62, 173, 9, 159, 172, 86, 148, 229, 175, 168, 1, 143, 153,
+        249, 161, 158, 213, 44, 12, 1, 103, 12, 212, 7, 93, 11, 153, 189, 228, 234, 40, 7, 1, 156, 173, 10, 204,
+        14, 128, 129, 230, 140, 157, 11, 34, 66, 26, 56, 37, 53, 202, 140, 229, 185, 178, 59, 14, 139, 177, 23, 124,
+        232, 224, 88, 58, 124, 232, 139, 177, 23, 124, 250, 231, 136, 177, 12, 58, 124, 231, 136, 177, 12, 58, 239, 188,
+        140, 250, 4, 185, 1, 135, 160, 213, 56, 142, 132, 96, 156, 91, 12, 247, 230, 146, 146, 205, 248, 37, 232, 147,
+        172, 101, 47, 58, 1, 77, 253, 53, 114, 149, 231, 227, 14, 143, 178, 63, 139, 237, 190, 9, 132, 143, 192, 31,
+        57, 240, 108, 162, 58, 14, 177, 161, 231, 137, 153, 230, 181, 183, 27, 184, 9, 140, 170, 229, 210, 68, 230, 157,
+        165, 47, 10, 14, 182, 138, 99, 14, 138, 172, 58, 1, 136, 154, 106, 156, 32, 45, 32, 112, 16, 230, 159, 180,
+        252, 1, 190, 183, 23, 9, 151, 165, 230, 156, 172, 9, 180, 165, 54, 112, 233, 159, 166, 126, 16, 62, 173, 193,
+        138, 16, 19, 9, 195, 223, 74, 202, 140, 6, 185, 25, 171, 19, 93, 11, 145, 158, 6, 184, 126, 112, 10, 4,
+        226, 135, 160, 213, 56, 150, 128, 233, 105, 233, 154, 134, 1, 156, 159, 229, 197, 240, 93, 247, 231, 143, 173, 231,
+        137, 153, 108, 176, 23, 202, 159, 233, 151, 168, 108, 149, 222, 118, 58, 64, 14, 130, 175, 26, 56, 141, 154, 232,
+        140, 168, 194, 53, 68, 59, 44, 7, 44, 202, 140, 19, 58, 85, 151, 232, 224, 94, 185, 116, 173, 233, 157, 158,
+        50, 11, 227, 66, 39, 57, 229, 175, 140, 230, 177, 151, 11, 188, 133, 231, 148, 184, 14, 181, 158, 95, 10, 9,
+        153, 186, 31, 1, 156, 159, 232, 128, 179, 6, 182, 126, 253, 93, 14, 142, 171, 230, 161, 145, 95, 19, 11, 43,
+        241, 95, 56, 167, 148, 213, 231, 145, 158, 248, 176, 188, 199, 165, 249, 76, 230, 161, 145, 26, 56, 159, 131, 229,
+        143, 138, 9, 175, 155, 39, 206, 72, 11, 142, 187, 31, 73, 56, 159, 131, 254, 228, 234, 95, 56, 147, 165, 78,
+        166, 95, 56, 141, 151, 233, 157, 158, 68, 39, 201, 74, 248, 176, 188, 199, 165, 12, 202, 141, 63, 151, 11, 167,
+        152, 236, 14, 146, 153, 229, 143, 164, 193, 138, 230, 156, 151, 1, 136, 169, 95, 10, 14, 224, 94, 185, 85, 226,
+        105, 26, 47, 10, 14, 129, 148, 69, 81, 245, 221, 100, 16, 14, 142, 171, 233, 155, 183, 223, 7, 57, 96, 156,
+        7, 100, 232, 191, 158, 51, 7, 220, 31, 66, 243, 139, 233, 155, 183, 206, 40, 193, 138, 59, 12, 230, 136, 136,
+        1, 162, 168, 47, 74, 17, 161, 148, 54, 244, 11, 43, 10, 39, 51, 11, 147, 156, 53, 29, 142, 198, 9, 196,
+        86, 131, 112, 248, 176, 164, 100, 229, 76, 15, 135, 145, 206, 53, 40, 229, 118, 15, 148, 161, 204, 40, 56, 157,
+        142, 228, 189, 169, 25, 135, 11, 121, 29, 180, 232, 130, 175, 97, 232, 183, 175, 200, 147, 7, 114, 162, 198, 47,
+        9, 70, 233, 155, 183, 40, 101, 232, 142, 177, 200, 130, 116, 139, 44, 31, 231, 166, 143, 72, 3, 15, 159, 166,
+        16, 19, 236, 7, 9, 129, 226, 184, 149, 7, 85, 151, 94, 139, 44, 31, 231, 166, 143, 72, 90, 65, 100, 51,
+        100, 7, 1, 147, 136, 31, 244, 218, 148, 230, 175, 155, 31, 229, 184, 149, 7, 80, 147, 166, 205, 100, 9, 157,
+        156, 58, 230, 136, 136, 220, 125, 233, 159, 166, 16, 11, 227, 215, 248, 165, 135, 194, 194, 9, 70, 233, 153, 181,
+        58, 9, 178, 153, 51, 125, 16, 78, 175, 1, 136, 154, 106, 156, 32, 45, 32, 35, 145, 113, 153, 107, 57, 246,
+        143, 138, 249, 147, 136, 107, 19, 93, 57, 230, 160, 185, 229, 187, 183, 14, 190, 190, 240, 45, 231, 172, 172, 228,
+        185, 140, 14, 190, 190, 82, 16, 45, 53, 44, 12, 205, 73, 31, 9, 152, 140, 232, 191, 170, 44, 12, 201, 59,
+        240, 21, 26, 89, 54, 9, 139, 137, 19, 113, 153, 60, 229, 179, 182, 1, 190, 183, 39, 9, 162, 133, 44, 16,
+        10, 69, 11, 43, 44, 58, 9, 209, 26, 238, 12, 245, 39, 238, 16, 69, 11, 121, 228, 189, 144, 16, 229, 167,
+        134, 69, 15, 148, 161, 35, 145, 9, 151, 129, 233, 129, 174, 238, 1, 147, 136, 39, 10, 53, 57, 236, 53, 230,
+        129, 176, 12, 69, 57, 107, 229, 167, 134, 69, 9, 83, 205, 12, 69, 217, 125, 229, 157, 142, 82, 69, 9, 158,
+        156, 125, 1, 150, 128, 16, 16, 108, 176, 241, 12, 53, 82, 69, 1, 150, 156, 66, 229, 129, 149, 12, 69, 9,
+        159, 165, 232, 176, 159, 21, 19, 122, 128, 241, 12, 9, 129, 176, 232, 146, 130, 7, 44, 12, 69, 14, 180, 190,
+        229, 157, 142, 82, 85, 161, 53, 206, 19, 9, 139, 137, 232, 180, 190, 93, 69, 1, 118, 39, 107, 1, 143, 164,
+        212, 16, 51, 247, 229, 173, 159, 44, 16, 69, 116, 173, 22, 174, 69, 245, 78, 166, 231, 148, 152, 53, 69, 201,
+        82, 16, 69, 68, 205, 16, 4, 189, 51, 16, 217, 4, 185, 69, 9, 156, 172, 109, 255, 39, 101, 99, 229, 210,
+        246, 163, 171, 79, 190, 179, 192, 31, 10, 233, 166, 150, 233, 131, 189, 51, 81, 9, 157, 176, 73, 7, 230, 185,
+        190, 233, 162, 134, 109, 217, 233, 162, 134, 109, 85, 151, 230, 190, 179, 192, 249, 161, 148, 7, 66, 72, 11, 187,
+        180, 91, 31, 10, 247, 230, 190, 179, 192, 31, 10, 9, 152, 134, 229, 163, 171, 58, 14, 129, 148, 69, 81, 218,
+        158, 246, 184, 140, 86, 185, 219, 16, 230, 136, 136, 7, 3, 15, 135, 140, 231, 105, 231, 131, 173, 213, 29, 162,
+        17, 75, 86, 131, 7, 231, 154, 174, 39, 18, 190, 17, 117, 39, 229, 118, 88, 58, 82, 17, 184, 149, 16, 78,
+        138, 54, 17, 75, 100, 206, 231, 144, 179, 229, 168, 156, 3, 193, 175, 99, 112, 74, 219, 66, 229, 184, 149, 17,
+        161, 158, 125, 16, 219, 19, 39, 17, 104, 16, 204, 80, 34, 232, 181, 150, 66, 79, 156, 151, 91, 72, 17, 75,
+        228, 191, 157, 40, 80, 154, 174, 229, 118, 78, 138, 79, 102, 229, 157, 142, 229, 187, 183, 7, 127, 151, 39, 229,
+        118, 88, 58, 82, 3, 68, 16, 26, 200, 130, 79, 136, 136, 10, 7, 127, 151, 66, 198, 88, 40, 231, 227, 17,
+        104, 78, 138, 10, 80, 121, 53, 67, 103, 221, 3, 68, 198, 88, 40, 231, 227, 17, 184, 149, 16, 3, 0, 10,
+        66, 229, 173, 153, 90, 143, 175, 231, 155, 155, 233, 160, 147, 74, 229, 128, 171, 95, 8, 158, 51, 29, 128, 11,
+        34, 63, 151, 28, 80, 36, 16, 29, 142, 17, 186, 183, 230, 182, 133, 231, 139, 132, 88, 3, 101, 114, 189, 47,
+        3, 101, 231, 189, 149, 112, 122, 128, 12, 3, 30, 189, 155, 232, 146, 153, 51, 3, 68, 107, 232, 175, 184, 254,
+        17, 164, 143, 229, 210, 22, 183, 3, 68, 39, 58, 90, 33, 229, 188, 151, 212, 72, 127, 151, 100, 40, 230, 157,
+        165, 53, 80, 188, 133, 18, 160, 127, 176, 231, 172, 172, 229, 119, 53, 90, 130, 175, 206, 253, 80, 148, 176, 53,
+        47, 17, 188, 151, 212, 72, 3, 30, 234, 8, 165, 228, 234, 17, 174, 190, 22, 149, 114, 149, 72, 17, 175, 134,
+        47, 47, 95, 90, 183, 175, 200, 147, 67, 119, 204, 3, 0, 10, 16, 54, 66, 219, 232, 130, 175, 232, 137, 178,
+        17, 117, 100, 40, 230, 157, 165, 53, 80, 186, 189, 231, 105, 79, 132, 155, 232, 141, 183, 232, 143, 175, 3, 193,
+        138, 31, 215, 78, 138, 79, 70, 236, 212, 56, 210, 67, 186, 183, 200, 159, 3, 30, 189, 155, 40, 39, 59, 17,
+        175, 134, 232, 224, 39, 17, 165, 167, 19, 16, 232, 141, 183, 233, 166, 172, 17, 117, 59, 89, 122, 150, 127, 142,
+        231, 155, 155, 233, 161, 191, 127, 151, 59, 89, 122, 150, 17, 110, 112, 221, 44, 17, 160, 170, 107, 7, 80, 136,
+        177, 59, 232, 141, 183, 80, 138, 185, 122, 150, 79, 152, 142, 26, 232, 224, 59, 17, 175, 134, 47, 230, 160, 185,
+        79, 128, 128, 228, 234, 200, 142, 3, 30, 234, 229, 225, 229, 134, 136, 80, 55, 40, 16, 91, 17, 110, 29, 142,
+        59, 3, 0, 10, 31, 230, 161, 145, 204, 3, 101, 229, 162, 168, 47, 74, 90, 146, 153, 192, 13, 191, 17, 37,
+        31, 231, 166, 143, 72, 17, 190, 151, 19, 107, 7, 219, 221, 44, 3, 116, 141, 25, 151, 233, 162, 160, 74, 78,
+        166, 95, 10, 231, 156, 129, 14, 137, 190, 78, 175, 206, 231, 156, 129, 201, 192, 231, 149, 165, 15, 173, 129, 250,
+        19, 14, 65, 67, 150, 128, 229, 189, 187, 230, 184, 169, 68, 26, 198, 54, 11, 186, 189, 232, 138, 172, 58, 101,
+        94, 141, 78, 166, 231, 145, 158, 19, 101, 244, 232, 136, 141, 231, 156, 129, 11, 136, 177, 82, 29, 142, 231, 142,
+        139, 229, 173, 144, 28, 14, 130, 178, 231, 169, 186, 247, 250, 109, 81, 1, 138, 170, 53, 230, 173, 166, 51, 85,
+        226, 105, 9, 190, 179, 192, 249, 104, 47, 11, 190, 142, 23, 124, 46, 142, 31, 229, 157, 154, 229, 144, 136, 78,
+        151, 222, 162, 168, 47, 74, 14, 142, 171, 244, 17, 75, 229, 189, 188, 63, 151, 229, 160, 161, 1, 37, 39, 237,
+        129, 88, 229, 225, 127, 226, 143, 164, 122, 128, 50, 57, 232, 191, 170, 88, 50, 217, 229, 118, 254, 230, 162, 175,
+        32, 45, 32, 125, 16, 72, 50, 85, 161, 54, 12, 59, 32, 45, 32, 54, 12, 100, 50, 85, 161, 16, 230, 129,
+        176, 78, 138, 45, 25, 135, 12, 19, 7, 50, 14, 189, 166, 232, 135, 163, 50, 9, 165, 154, 194, 122, 128, 50,
+        193, 138, 94, 135, 215, 113, 131, 17, 136, 169, 228, 189, 169, 232, 140, 168, 19, 17, 118, 229, 187, 150, 12, 17,
+        155, 190, 16, 17, 136, 171, 12, 74, 40, 82, 17, 188, 151, 16, 253, 241, 12, 17, 197, 12, 98, 127, 161, 29,
+        162, 44, 17, 76, 114, 162, 92, 17, 77, 232, 137, 175, 98, 3, 15, 155, 133, 40, 7, 16, 92, 12, 79, 162,
+        129, 232, 181, 158, 219, 7, 51, 16, 231, 189, 149, 90, 142, 171, 244, 3, 242, 230, 195, 230, 163, 177, 98, 90,
+        190, 190, 212, 93, 50, 9, 178, 131, 40, 230, 182, 133, 199, 165, 90, 120, 92, 74, 40, 82, 79, 196, 244, 92,
+        80, 55, 7, 51, 40, 66, 3, 0, 67, 161, 148, 92, 40, 114, 162, 12, 211, 243, 139, 221, 215, 59, 12, 211,
+        85, 161, 12, 230, 162, 133, 19, 50, 245, 252, 17, 136, 151, 237, 129, 88, 229, 225, 80, 34, 7, 198, 92, 3,
+        193, 143, 12, 44, 88, 229, 225, 79, 178, 131, 223, 88, 59, 79, 195, 12, 240, 98, 127, 161, 231, 180, 175, 31,
+        125, 50, 9, 182, 133, 230, 182, 133, 232, 140, 168, 232, 135, 170, 255, 81, 220, 241, 50, 57, 12, 230, 177, 137,
+        88, 12, 98, 90, 142, 171, 12, 91, 73, 10, 50, 116, 139, 215, 92, 74, 40, 82, 17, 165, 148, 107, 17, 159,
+        186, 223, 92, 3, 68, 39, 86, 131, 12, 50, 1, 118, 78, 166, 229, 160, 161, 3, 202, 140, 39, 230, 137, 172,
+        215, 92, 98, 17, 189, 188, 246, 167, 134, 211, 126, 122, 128, 89, 12, 198, 93, 50, 202, 140, 82, 231, 169, 134,
+        12, 51, 50, 15, 158, 145, 233, 157, 188, 93, 50, 14, 65, 66, 16, 90, 65, 16, 198, 92, 3, 0, 10, 66,
+        12, 45, 230, 182, 133, 230, 182, 133, 232, 140, 168, 232, 135, 170, 255, 81, 9, 177, 137, 51, 240, 47, 242, 231,
+        182, 173, 231, 136, 190, 82, 223, 92, 98, 80, 167, 139, 200, 142, 17, 197, 246, 185, 178, 90, 189, 166, 39, 233,
+        155, 133, 237, 190, 98, 17, 77, 39, 10, 51, 50, 1, 164, 150, 232, 178, 157, 44, 231, 136, 190, 42, 138, 115,
+        29, 128, 193, 138, 246, 197, 232, 140, 168, 19, 3, 101, 47, 78, 175, 31, 10, 79, 102, 230, 156, 168, 98, 3,
+        15, 132, 130, 230, 156, 168, 98, 17, 147, 136, 100, 7, 50, 220, 233, 105, 40, 113, 131, 219, 12, 114, 176, 50,
+        57, 12, 114, 176, 211, 1, 155, 190, 194, 50, 243, 139, 221, 215, 10, 12, 98, 211, 68, 44, 94, 185, 79, 165,
+        154, 89, 229, 165, 135, 232, 135, 170, 255, 81, 1, 160, 170, 229, 175, 159, 44, 211, 14, 65, 205, 207, 79, 187,
+        168, 230, 181, 183, 211, 11, 138, 185, 22, 170, 232, 135, 170, 255, 17, 147, 136, 54, 40, 92, 98, 211, 57, 231,
+        169, 134, 12, 90, 65, 205, 50, 124, 233, 155, 133, 229, 197, 51, 50, 1, 37, 13, 191, 192, 30, 234, 23, 116,
+        138, 230, 181, 183, 1, 164, 169, 123, 165, 217, 8, 172, 9, 181, 183, 99, 1, 174, 129, 22, 143, 18, 158, 199,
+        143, 15, 135, 141, 229, 186, 134, 9, 181, 153, 230, 177, 159, 9, 177, 159, 232, 224, 11, 166, 143, 229, 187, 186,
+        201, 63, 189, 14, 190, 189, 237, 129, 1, 177, 177, 94, 156, 1, 177, 177, 47, 9, 177, 159, 47, 9, 178, 179,
+        99, 14, 180, 181, 80, 178, 164, 9, 185, 150, 250, 1, 103, 207, 9, 178, 179, 250, 15, 153, 149, 47, 1, 110,
+        232, 146, 153, 229, 143, 164, 15, 187, 145, 233, 190, 153, 230, 177, 159, 9, 185, 150, 99, 1, 185, 191, 47, 229,
+        163, 174, 199, 143, 1, 155, 155, 2, 157, 0, 8, 145, 99, 247, 232, 151, 143, 11, 148, 152, 232, 130, 131, 15,
+        157, 146, 230, 181, 183, 101, 115, 73, 229, 144, 190, 12, 199, 143, 116, 173, 23, 11, 190, 142, 62, 139, 230, 156,
+        172, 62, 159, 22, 150, 5, 143, 229, 179, 182, 229, 182, 188, 243, 139, 31, 231, 143, 128, 233, 161, 191, 28, 85,
+        151, 106, 129, 123, 178, 1, 155, 189, 233, 153, 133, 124, 109, 231, 144, 131, 124, 94, 150, 231, 149, 140, 0,
+};
+
+static const unsigned char TERRITORY_NAMES_PAIRS_CN[256][2] = {
+        {0, 0}, {0, 229}, {229, 183}, {2, 158}, {230, 150}, {229, 176}, {229, 133}, {4, 175}, {228, 186}, {0, 230}, {8, 154}, {0, 231},
+        {5, 148}, {230, 139}, {0, 232}, {0, 233}, {13, 137}, {3, 1}, {229, 155}, {6, 139}, {146, 140}, {229, 20}, {229, 164}, {18, 189},
+        {169, 172}, {229, 136}, {5, 188}, {229, 178}, {27, 155}, {229, 141}, {0, 228}, {25, 169}, {32, 32}, {165, 191}, {189, 151}, {233, 135},
+        {137, 185}, {138, 160}, {152, 191}, {35, 140}, {231, 34}, {232, 190}, {233, 130}, {186, 179}, {229, 37}, {45, 45}, {231, 190}, {232, 33},
+        {6, 177}, {21, 23}, {48, 49}, {231, 36}, {229, 147}, {231, 43}, {2, 180}, {167, 145}, {10, 1}, {15, 38}, {6, 176}, {41, 190},
+        {46, 164}, {229, 140}, {229, 156}, {229, 190}, {60, 28}, {144, 168}, {233, 24}, {7, 229}, {15, 24}, {42, 166}, {160, 188}, {231, 187},
+        {26, 10}, {71, 180}, {52, 165}, {156, 163}, {157, 166}, {184, 131}, {228, 188}, {3, 9}, {3, 11}, {61, 186}, {63, 183}, {175, 148},
+        {0, 4}, {1, 141}, {229, 159}, {229, 161}, {230, 70}, {231, 55}, {3, 14}, {22, 154}, {22, 171}, {67, 76}, {228, 184}, {230, 83},
+        {231, 147}, {1, 75}, {7, 19}, {29, 151}, {29, 161}, {84, 176}, {137, 152}, {144, 137}, {183, 180}, {186, 166}, {230, 158}, {232, 65},
+        {9, 179}, {62, 176}, {134, 133}, {150, 134}, {229, 77}, {230, 178}, {230, 179}, {231, 111}, {30, 184}, {140, 151}, {165, 165}, {174, 137},
+        {175, 186}, {177, 179}, {228, 187}, {230, 180}, {124, 124}, {233, 38}, {1, 104}, {17, 141}, {128, 128}, {129, 129}, {130, 130}, {131, 131},
+        {132, 132}, {133, 133}, {134, 134}, {135, 135}, {136, 136}, {137, 137}, {138, 138}, {139, 139}, {140, 140}, {141, 141}, {142, 142}, {143, 143},
+        {144, 144}, {145, 145}, {146, 146}, {147, 147}, {148, 148}, {149, 149}, {150, 150}, {151, 151}, {152, 152}, {153, 153}, {154, 154}, {155, 155},
+        {156, 156}, {157, 157}, {158, 158}, {159, 159}, {160, 160}, {161, 161}, {162, 162}, {163, 163}, {164, 164}, {165, 165}, {166, 166}, {167, 167},
+        {168, 168}, {169, 169}, {170, 170}, {171, 171}, {172, 172}, {173, 173}, {174, 174}, {175, 175}, {176, 176}, {177, 177}, {178, 178}, {179, 179},
+        {180, 180}, {181, 181}, {182, 182}, {183, 183}, {184, 184}, {185, 185}, {186, 186}, {187, 187}, {188, 188}, {189, 189}, {190, 190}, {191, 191},
+        {22, 167}, {30, 188}, {96, 166}, {145, 169}, {153, 174}, {186, 147}, {230, 102}, {230, 151}, {230, 152}, {1, 119}, {30, 185}, {41, 185},
+        {42, 163}, {52, 136}, {87, 148}, {106, 151}, {115, 81}, {155, 188}, {168, 129}, {203, 208}, {229, 103}, {229, 110}, {229, 177}, {232, 120},
+        {233, 178}, {1, 117}, {1, 161}, {3, 57}, {11, 55}, {16, 7}, {23, 1}, {123, 155}, {139, 143}, {139, 146}, {176, 229}, {180, 162},
+        {228, 228}, {229, 229}, {230, 230}, {231, 231}, {232, 232}, {233, 233}, {191, 132}, {214, 158}, {216, 129}, {229, 174}, {230, 196}, {239, 239},
+        {230, 209}, {231, 121}, {0, 7}, {1, 133}, {7, 89}, {11, 36}, {12, 229}, {14, 33}, {16, 1}, {31, 56}, {61, 151}, {64, 124},
+        {73, 12}, {86, 186}, {87, 158}, {113, 187},
+};
+
+static const unsigned short TERRITORY_NAME_ALTERNATIVES_START_CN[_TERRITORY_MAX - _TERRITORY_MIN] = {
+        0, 2, 3, 4, 5, 7, 8, 9, 10, 11, 12, 13, 15, 16, 17, 18,
+        19, 20, 21, 22, 23, 24, 25, 26, 28, 29, 30, 31, 33, 34, 35, 36,
+        38, 39, 41, 42, 45, 46, 47, 49, 50, 51, 53, 55, 56, 58, 59, 60,
+        61, 62, 63, 64, 65, 66, 68, 69, 70, 71, 72, 73, 75, 76, 77, 78,
+        79, 80, 81, 82, 83, 84, 85, 87, 88, 89, 91, 92, 93, 94, 95, 96,
+        97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112,
+        113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128,
+        129, 130, 131, 132, 133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143, 144,
+        145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159, 160,
+        161, 162, 163, 164, 165, 166, 167, 168, 169, 170, 171, 172, 173, 174, 175, 176,
+        177, 178, 179, 180, 181, 182, 183, 188, 189, 190, 191, 192, 193, 194, 195, 196,
+        197, 198, 199, 200, 201, 202, 203, 204, 205, 206, 207, 208, 209, 210, 211, 212,
+        213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223, 224, 225, 226, 227, 228,
+        229, 230, 231, 232, 233, 234, 235, 236, 237, 238, 239, 240, 241, 242, 243, 244,
+        245, 246, 247, 248, 249, 250, 251, 252, 253, 254, 255, 256, 257, 258, 259, 260,
+        261, 262, 263, 264, 265, 266, 267, 268, 269, 270, 271, 272, 273, 274, 275, 276,
+        277, 278, 279, 280, 281, 282, 283, 284, 285, 286, 287, 288, 289, 290, 291, 292,
+        293, 294, 295, 296, 297, 298, 299, 300, 301, 302, 303, 304, 305, 306, 307, 308,
+        309, 310, 311, 312, 313, 314, 315, 316, 317, 318, 319, 320, 321, 322, 323, 324,
+        325, 326, 327, 328, 329, 330, 331, 332, 333, 334, 335, 336, 337, 338, 339, 340,
+        341, 342, 343, 344, 345, 346, 347, 348, 349, 350, 351, 352, 353, 354, 355, 356,
+        357, 358, 359, 360, 361, 362, 363, 364, 365, 366, 367, 368, 369, 370, 371, 372,
+        373, 374, 375, 376, 377, 378, 379, 380, 381, 382, 383, 384, 385, 386, 387, 388,
+        389, 390, 391, 392, 393, 394, 395, 396, 397, 398, 399, 400, 401, 402, 403, 404,
+        405, 406, 407, 408, 409, 410, 411, 412, 413, 414, 415, 416, 417, 418, 419, 420,
+        421, 422, 423, 424, 425, 426, 427, 428, 429, 430, 431, 433, 434, 435, 436, 437,
+        438, 439, 440, 441, 442, 443, 444, 445, 446, 447, 448, 449, 450, 451, 452, 453,
+        454, 455, 456, 457, 458, 459, 460, 461, 462, 463, 464, 465, 466, 467, 468, 469,
+        470, 471, 472, 473, 474, 475, 476, 477, 478, 479, 480, 481, 482, 483, 484, 485,
+        486, 487, 488, 489, 490, 491, 492, 493, 494, 495, 496, 497, 498, 499, 500, 501,
+        502, 503, 504, 505, 506, 507, 508, 509, 510, 511, 512, 513, 514, 515, 516, 518,
+        519, 520, 521, 522, 523, 524, 525, 526, 527, 528, 529, 530, 531, 532, 533, 534,
+        535, 536, 537, 538, 539, 540, 541, 542, 543, 544, 545, 546, 547, 548, 549, 550,
+        551, 552, 553, 554, 555, 558,
+};
+
+static const TerritoryNameAlternative TERRITORY_NAME_ALTERNATIVES_CN[558] = {
+        {0, 12, 20}, {13, 6, 20}, {20, 9, 20}, {30, 12, 20}, {43, 9, 20}, {53, 15, 20}, {69, 12, 20}, {82, 15, 20},
+        {98, 6, 20}, {105, 9, 20}, {115, 6, 20}, {122, 9, 20}, {132, 9, 20}, {142, 27, 20}, {170, 12, 20}, {183, 18, 20},
+        {202, 9, 20}, {212, 9, 20}, {222, 21, 20}, {244, 12, 20}, {257, 9, 20}, {267, 9, 20}, {277, 15, 20}, {293, 9, 20},
+        {303, 9, 20}, {313, 21, 20}, {335, 21, 20}, {357, 24, 20}, {382, 15, 20}, {398, 9, 20}, {408, 15, 20}, {424, 15, 20},
+        {440, 18, 20}, {459, 9, 20}, {469, 24, 20}, {494, 6, 20}, {501, 21, 20}, {523, 9, 20}, {533, 12, 20}, {546, 39, 20},
+        {586, 6, 20}, {593, 12, 20}, {606, 51, 20}, {658, 9, 20}, {668, 24, 20}, {693, 9, 20}, {703, 12, 20}, {716, 21, 20},
+        {738, 21, 20}, {760, 9, 20}, {770, 21, 20}, {792, 30, 20}, {823, 15, 20}, {839, 30, 20}, {870, 18, 20}, {889, 12, 20},
+        {902, 21, 20}, {924, 9, 20}, {934, 9, 20}, {944, 9, 20}, {954, 6, 20}, {961, 21, 20}, {983, 9, 20}, {993, 6, 20},
+        {1000, 9, 20}, {1010, 12, 20}, {1023, 18, 20}, {1042, 24, 20}, {1067, 9, 20}, {1077, 6, 20}, {1084, 12, 20}, {1097, 6, 20},
+        {1104, 12, 20}, {1117, 27, 20}, {1145, 15, 20}, {1161, 24, 20}, {1186, 6, 20}, {1193, 12, 20}, {1206, 12, 20}, {1219, 12, 20},
+        {1232, 9, 20}, {1242, 12, 20}, {1255, 6, 20}, {1262, 9, 20}, {1272, 9, 20}, {1282, 33, 20}, {1316, 18, 20}, {1335, 21, 20},
+        {1357, 9, 20}, {1367, 24, 20}, {1392, 9, 20}, {1402, 6, 20}, {1409, 27, 20}, {1437, 12, 20}, {1450, 12, 20}, {1463, 9, 20},
+        {1473, 9, 20}, {1483, 9, 20}, {1493, 9, 20}, {1503, 15, 20}, {1519, 12, 20}, {1532, 6, 20}, {1539, 9, 20}, {1549, 9, 20},
+        {1559, 12, 20}, {1572, 9, 20}, {1582, 6, 20}, {1589, 18, 20}, {1608, 15, 20}, {1624, 9, 20}, {1634, 18, 20}, {1653, 12, 20},
+        {1666, 9, 20}, {1676, 9, 20}, {1686, 9, 20}, {1696, 9, 20}, {1706, 6, 20}, {1713, 9, 20}, {1723, 15, 20}, {1739, 15, 20},
+        {1755, 15, 20}, {1771, 12, 20}, {1784, 9, 20}, {1794, 9, 20}, {1804, 12, 20}, {1817, 15, 20}, {1833, 6, 20}, {1840, 6, 20},
+        {1847, 6, 20}, {1854, 6, 20}, {1861, 6, 20}, {1868, 12, 20}, {1881, 21, 20}, {1903, 12, 20}, {1916, 15, 20}, {1932, 30, 20},
+        {1963, 12, 20}, {1976, 6, 20}, {1983, 12, 20}, {1996, 9, 20}, {2006, 12, 20}, {2019, 12, 20}, {2032, 9, 20}, {2042, 12, 20},
+        {2055, 9, 20}, {2065, 15, 20}, {2081, 15, 20}, {2097, 24, 20}, {2122, 9, 20}, {2132, 12, 20}, {2145, 12, 20}, {2158, 6, 20},
+        {2165, 9, 20}, {2175, 9, 20}, {2185, 6, 20}, {2192, 6, 20}, {2199, 12, 20}, {2212, 6, 20}, {2219, 12, 20}, {2232, 12, 20},
+        {2245, 12, 20}, {2258, 6, 20}, {2265, 15, 20}, {2281, 9, 20}, {2291, 9, 20}, {2301, 12, 20}, {2314, 6, 20}, {2321, 15, 20},
+        {2337, 12, 20}, {2350, 9, 20}, {2360, 9, 20}, {2370, 9, 20}, {2380, 9, 20}, {2390, 9, 20}, {2400, 9, 20}, {2410, 12, 20},
+        {2423, 18, 20}, {2442, 12, 20}, {2455, 9, 20}, {2465, 6, 20}, {2472, 12, 20}, {2485, 6, 20}, {2492, 9, 20}, {2502, 6, 20},
+        {2509, 9, 20}, {2519, 6, 20}, {2526, 12, 20}, {2539, 18, 20}, {2558, 9, 20}, {2568, 12, 20}, {2581, 12, 20}, {2594, 6, 20},
+        {2601, 9, 20}, {2611, 15, 20}, {2627, 9, 20}, {2637, 9, 20}, {2647, 6, 20}, {2654, 6, 20}, {2661, 12, 20}, {2674, 6, 20},
+        {2681, 12, 20}, {2694, 6, 20}, {2701, 6, 20}, {2708, 24, 20}, {2733, 6, 20}, {2740, 6, 7}, {2747, 12, 20}, {2760, 9, 20},
+        {2770, 9, 20}, {2780, 9, 20}, {2790, 18, 20}, {2809, 6, 20}, {2816, 21, 20}, {2838, 9, 20}, {2848, 15, 20}, {2864, 9, 20},
+        {2874, 6, 20}, {2881, 6, 20}, {2888, 6, 20}, {2895, 12, 20}, {2908, 9, 20}, {2918, 12, 20}, {2931, 15, 20}, {2947, 9, 20},
+        {2957, 9, 20}, {2967, 15, 20}, {2983, 9, 20}, {2993, 9, 20}, {3003, 6, 20}, {3010, 9, 20}, {3020, 6, 20}, {3027, 9, 20},
+        {3037, 12, 20}, {3050, 12, 20}, {3063, 12, 20}, {3076, 12, 20}, {3089, 12, 20}, {3102, 12, 20}, {3115, 6, 20}, {3122, 15, 20},
+        {3138, 12, 20}, {3151, 15, 20}, {3167, 12, 20}, {3180, 6, 20}, {3187, 6, 20}, {3194, 9, 20}, {3204, 9, 20}, {3214, 6, 20},
+        {3221, 6, 20}, {3228, 6, 20}, {3235, 6, 20}, {3242, 9, 20}, {3252, 6, 20}, {3259, 15, 20}, {3275, 9, 20}, {3285, 15, 20},
+        {3301, 12, 20}, {3314, 21, 20}, {3336, 9, 20}, {3346, 12, 20}, {3359, 12, 20}, {3372, 12, 20}, {3385, 12, 20}, {3398, 12, 20},
+        {3411, 12, 20}, {3424, 12, 20}, {3437, 9, 20}, {3447, 15, 20}, {3463, 12, 20}, {3476, 9, 20}, {3486, 9, 20}, {3496, 21, 20},
+        {3518, 9, 20}, {3528, 9, 20}, {3538, 21, 20}, {3560, 15, 20}, {3576, 9, 20}, {3586, 24, 20}, {3611, 15, 20}, {3627, 12, 20},
+        {3640, 18, 20}, {3659, 9, 20}, {3669, 9, 20}, {3679, 12, 20}, {3692, 9, 20}, {3702, 9, 20}, {3712, 9, 20}, {3722, 15, 20},
+        {3738, 18, 20}, {3757, 15, 20}, {3773, 15, 20}, {3789, 9, 20}, {3799, 13, 20}, {3813, 28, 20}, {3842, 12, 20}, {3855, 21, 20},
+        {3877, 15, 20}, {3893, 6, 20}, {3900, 15, 20}, {3916, 9, 20}, {3926, 12, 20}, {3939, 15, 20}, {3955, 15, 20}, {3971, 6, 20},
+        {3978, 9, 7}, {3988, 12, 20}, {4001, 18, 20}, {4020, 12, 20}, {4033, 12, 20}, {4046, 15, 20}, {4062, 6, 20}, {4069, 9, 20},
+        {4079, 18, 20}, {4098, 15, 20}, {4114, 21, 20}, {4136, 18, 20}, {4155, 9, 20}, {4165, 12, 20}, {4178, 15, 20}, {4194, 9, 20},
+        {4204, 12, 20}, {4217, 15, 20}, {4233, 9, 20}, {4243, 15, 20}, {4259, 12, 20}, {4272, 18, 20}, {4291, 9, 20}, {4301, 12, 20},
+        {4314, 18, 20}, {4333, 24, 20}, {4358, 18, 20}, {4377, 9, 20}, {4387, 15, 20}, {4403, 15, 20}, {4419, 12, 20}, {4432, 15, 20},
+        {4448, 9, 20}, {4458, 9, 20}, {4468, 15, 20}, {4484, 15, 20}, {4500, 18, 20}, {4519, 21, 20}, {4541, 21, 20}, {4563, 15, 20},
+        {4579, 18, 20}, {4598, 15, 20}, {4614, 12, 20}, {4627, 12, 20}, {4640, 12, 20}, {4653, 12, 20}, {4666, 12, 20}, {4679, 15, 20},
+        {4695, 12, 20}, {4708, 12, 20}, {4721, 15, 20}, {4737, 21, 20}, {4759, 15, 20}, {4775, 12, 20}, {4788, 21, 20}, {4810, 12, 20},
+        {4823, 21, 20}, {4845, 18, 20}, {4864, 9, 20}, {4874, 12, 20}, {4887, 27, 20}, {4915, 12, 20}, {4928, 12, 20}, {4941, 15, 20},
+        {4957, 12, 20}, {4970, 18, 20}, {4989, 12, 20}, {5002, 15, 20}, {5018, 12, 20}, {5031, 12, 20}, {5044, 18, 20}, {5063, 18, 20},
+        {5082, 9, 20}, {5092, 15, 20}, {5108, 12, 20}, {5121, 12, 20}, {5134, 15, 20}, {5150, 12, 20}, {5163, 18, 20}, {5182, 15, 20},
+        {5198, 18, 20}, {5217, 15, 20}, {5233, 12, 20}, {5246, 18, 20}, {5265, 9, 20}, {5275, 12, 20}, {5288, 15, 20}, {5304, 12, 20},
+        {5317, 15, 20}, {5333, 15, 20}, {5349, 12, 20}, {5362, 18, 20}, {5381, 15, 20}, {5397, 12, 20}, {5410, 15, 20}, {5426, 18, 20},
+        {5445, 12, 20}, {5458, 12, 20}, {5471, 9, 20}, {5481, 15, 20}, {5497, 12, 20}, {5510, 12, 20}, {5523, 12, 20}, {5536, 15, 20},
+        {5552, 12, 20}, {5565, 15, 20}, {5581, 15, 20}, {5597, 12, 20}, {5610, 18, 20}, {5629, 15, 20}, {5645, 15, 20}, {5661, 24, 20},
+        {5686, 12, 20}, {5699, 9, 20}, {5709, 9, 20}, {5719, 15, 20}, {5735, 12, 20}, {5748, 9, 20}, {5758, 15, 20}, {5774, 15, 20},
+        {5790, 18, 20}, {5809, 6, 20}, {5816, 12, 20}, {5829, 12, 20}, {5842, 6, 20}, {5849, 12, 20}, {5862, 6, 20}, {5869, 6, 20},
+        {5876, 18, 20}, {5895, 9, 20}, {5905, 12, 20}, {5918, 12, 20}, {5931, 18, 20}, {5950, 18, 20}, {5969, 18, 20}, {5988, 36, 20},
+        {6025, 33, 20}, {6059, 34, 20}, {6094, 15, 20}, {6110, 18, 20}, {6129, 15, 20}, {6145, 15, 20}, {6161, 12, 20}, {6174, 9, 20},
+        {6184, 18, 20}, {6203, 18, 20}, {6222, 15, 20}, {6238, 12, 20}, {6251, 12, 20}, {6264, 15, 20}, {6280, 21, 20}, {6302, 9, 20},
+        {6312, 18, 20}, {6331, 12, 20}, {6344, 18, 20}, {6363, 21, 20}, {6385, 15, 20}, {6401, 18, 20}, {6420, 15, 20}, {6436, 18, 20},
+        {6455, 27, 20}, {6483, 27, 20}, {6511, 21, 20}, {6533, 12, 20}, {6546, 15, 20}, {6562, 15, 20}, {6578, 18, 20}, {6597, 15, 20},
+        {6613, 18, 20}, {6632, 21, 20}, {6654, 18, 20}, {6673, 15, 20}, {6689, 24, 20}, {6714, 24, 20}, {6739, 21, 20}, {6761, 9, 20},
+        {6771, 12, 20}, {6784, 21, 20}, {6806, 12, 20}, {6819, 24, 20}, {6844, 18, 20}, {6863, 30, 20}, {6894, 24, 20}, {6919, 21, 20},
+        {6941, 12, 20}, {6954, 15, 20}, {6970, 28, 20}, {6999, 12, 20}, {7012, 27, 20}, {7040, 9, 20}, {7050, 12, 20}, {7063, 21, 20},
+        {7085, 21, 20}, {7107, 21, 20}, {7129, 18, 20}, {7148, 18, 20}, {7167, 15, 20}, {7183, 15, 20}, {7199, 18, 20}, {7218, 15, 20},
+        {7234, 18, 20}, {7253, 18, 20}, {7272, 15, 20}, {7288, 33, 20}, {7322, 12, 20}, {7335, 18, 20}, {7354, 18, 20}, {7373, 12, 20},
+        {7386, 15, 20}, {7402, 15, 20}, {7418, 27, 20}, {7446, 12, 20}, {7459, 15, 20}, {7475, 18, 20}, {7494, 9, 20}, {7504, 6, 20},
+        {7511, 6, 20}, {7518, 6, 20}, {7525, 6, 20}, {7532, 6, 20}, {7539, 12, 20}, {7552, 6, 20}, {7559, 6, 20}, {7566, 6, 20},
+        {7573, 6, 20}, {7580, 6, 20}, {7587, 6, 20}, {7594, 6, 20}, {7601, 6, 20}, {7608, 6, 20}, {7615, 6, 20}, {7622, 6, 20},
+        {7629, 3, 20}, {7633, 6, 20}, {7640, 6, 20}, {7647, 6, 20}, {7654, 6, 20}, {7661, 9, 20}, {7671, 9, 20}, {7681, 6, 20},
+        {7688, 12, 20}, {7701, 6, 20}, {7708, 6, 20}, {7715, 6, 20}, {7722, 6, 20}, {7729, 6, 20}, {7736, 18, 20}, {7755, 6, 20},
+        {7762, 24, 20}, {7787, 15, 20}, {7803, 9, 20}, {7813, 6, 20}, {7820, 6, 20}, {7827, 6, 20},
+};
+
+static char TERRITORY_NAMES_UNPACKED_CN[7834];
+
+static const PackedTerritoryNames PACKED_TERRITORY_NAMES_CN = {
+        TERRITORY_NAMES_UNPACKED_CN, 7834, TERRITORY_NAMES_PACKED_CN, 3671, TERRITORY_NAMES_PAIRS_CN,
+        TERRITORY_NAME_ALTERNATIVES_START_CN, TERRITORY_NAME_ALTERNATIVES_CN};
+
+#else
+
+static const PackedTerritoryNames PACKED_TERRITORY_NAMES_CN = {NULL, 0, NULL, 0, NULL, NULL, NULL};
+
+#endif // MAPCODE_SUPPORT_LANGUAGE_CN
+
+#ifdef MAPCODE_SUPPORT_LANGUAGE_CS // Czech
+
+// 6893 bytes, packed to 3583
+static const unsigned char TERRITORY_NAMES_PACKED_CS[3583] = {
+        86, 33, 49, 38, 124, 83, 238, 142, 3, 54, 165, 56, 13, 132, 8, 71, 166, 114, 18, 236, 183, 111, 107, 47,
+        163, 200, 111, 107, 177, 10, 24, 227, 124, 75, 101, 47, 127, 225, 126, 40, 83, 97, 242, 45, 250, 116, 104, 47,
+        148, 25, 78, 97, 48, 117, 183, 117, 118, 18, 117, 56, 132, 163, 57, 242, 187, 97, 7, 116, 22, 57, 97, 242,
+        45, 77, 7, 116, 9, 241, 20, 102, 54, 107, 61, 80, 104, 176, 167, 225, 126, 124, 80, 104, 176, 167, 225, 126,
+        168, 50, 99, 97, 133, 110, 151, 198, 118, 192, 197, 175, 118, 52, 151, 11, 109, 117, 100, 25, 66, 180, 231, 9,
+        100, 204, 111, 111, 99, 101, 38, 231, 239, 122, 148, 15, 57, 1, 187, 7, 9, 8, 62, 244, 115, 101, 25, 206,
+        103, 117, 176, 108, 91, 13, 116, 115, 245, 33, 0, 74, 11, 115, 101, 25, 86, 38, 111, 217, 34, 52, 0, 87,
+        18, 108, 95, 61, 70, 214, 64, 164, 70, 214, 64, 199, 151, 180, 231, 252, 22, 94, 227, 124, 66, 180, 231, 252,
+        22, 254, 76, 223, 116, 22, 135, 116, 101, 106, 110, 26, 65, 235, 98, 91, 7, 115, 104, 18, 108, 220, 130, 230,
+        11, 204, 55, 83, 29, 111, 164, 83, 29, 111, 97, 226, 230, 11, 105, 217, 123, 67, 111, 111, 107, 220, 130, 83,
+        97, 242, 45, 80, 105, 245, 101, 61, 77, 105, 113, 117, 47, 13, 124, 77, 105, 113, 117, 47, 13, 241, 105, 117,
+        12, 83, 238, 142, 75, 114, 121, 135, 116, 111, 102, 61, 78, 149, 95, 124, 78, 149, 105, 40, 75, 146, 109, 1,
+        254, 66, 13, 97, 133, 101, 226, 253, 32, 69, 117, 3, 33, 117, 95, 61, 83, 144, 164, 83, 144, 164, 253, 32,
+        69, 117, 3, 33, 105, 117, 40, 77, 18, 174, 105, 118, 25, 83, 238, 55, 72, 47, 22, 97, 226, 65, 115, 99,
+        22, 115, 105, 13, 61, 84, 114, 105, 3, 1, 32, 100, 247, 64, 104, 164, 65, 115, 99, 22, 115, 105, 13, 124,
+        84, 114, 105, 3, 1, 32, 100, 247, 64, 104, 91, 18, 116, 2, 188, 22, 31, 154, 109, 11, 204, 24, 32, 252,
+        22, 94, 227, 124, 252, 22, 94, 227, 226, 85, 83, 65, 56, 210, 150, 116, 12, 83, 118, 18, 98, 7, 100, 61,
+        74, 1, 187, 210, 22, 124, 74, 1, 187, 210, 22, 57, 238, 142, 86, 9, 99, 22, 99, 61, 188, 22, 31, 9,
+        121, 124, 188, 22, 31, 9, 25, 72, 101, 7, 100, 197, 175, 118, 52, 61, 77, 99, 68, 13, 18, 100, 220, 227,
+        124, 77, 99, 68, 13, 18, 100, 130, 250, 98, 31, 111, 40, 206, 116, 105, 103, 117, 19, 19, 250, 98, 117, 100,
+        164, 250, 98, 117, 100, 2, 67, 48, 132, 97, 8, 83, 101, 121, 99, 104, 47, 25, 80, 18, 163, 57, 240, 77,
+        7, 105, 1, 25, 206, 100, 20, 114, 2, 62, 29, 0, 191, 108, 101, 27, 102, 187, 123, 115, 238, 55, 76, 237,
+        30, 77, 49, 114, 13, 24, 115, 212, 124, 70, 174, 11, 33, 105, 118, 41, 3, 5, 116, 121, 187, 49, 114, 13,
+        24, 115, 30, 83, 127, 208, 20, 12, 84, 128, 2, 68, 134, 9, 49, 219, 145, 228, 110, 200, 133, 166, 33, 36,
+        84, 48, 107, 115, 61, 67, 97, 21, 177, 124, 67, 97, 21, 111, 40, 83, 97, 60, 84, 134, 101, 61, 80, 114,
+        9, 99, 167, 101, 124, 80, 114, 9, 99, 167, 12, 72, 128, 107, 128, 56, 7, 116, 9, 49, 182, 97, 11, 254,
+        62, 31, 47, 198, 112, 12, 75, 134, 20, 25, 77, 97, 48, 50, 105, 117, 40, 83, 104, 108, 174, 5, 34, 0,
+        76, 237, 148, 98, 48, 248, 29, 111, 2, 181, 71, 101, 20, 103, 212, 61, 181, 83, 39, 119, 223, 220, 227, 124,
+        181, 83, 39, 119, 223, 220, 130, 70, 114, 1, 99, 198, 122, 171, 80, 54, 121, 110, 24, 115, 30, 75, 208, 118,
+        11, 100, 25, 84, 114, 9, 105, 100, 31, 61, 84, 111, 98, 159, 111, 124, 84, 111, 98, 159, 8, 66, 114, 64,
+        101, 106, 182, 114, 1, 99, 198, 122, 171, 106, 105, 139, 19, 1, 236, 107, 116, 204, 55, 239, 122, 148, 15, 168,
+        222, 20, 49, 8, 75, 121, 112, 114, 0, 76, 166, 1, 13, 0, 74, 29, 97, 21, 2, 71, 224, 30, 75, 33,
+        7, 182, 18, 107, 126, 25, 86, 1, 117, 33, 117, 0, 196, 140, 244, 55, 72, 20, 219, 145, 29, 254, 86, 96,
+        99, 104, 194, 41, 84, 193, 20, 57, 118, 97, 122, 105, 106, 26, 75, 117, 118, 146, 116, 182, 105, 100, 53, 105,
+        130, 157, 55, 75, 18, 174, 13, 30, 83, 108, 10, 9, 26, 73, 122, 58, 47, 168, 18, 101, 3, 9, 171, 239,
+        122, 148, 15, 0, 69, 108, 32, 83, 18, 118, 31, 20, 151, 47, 234, 12, 68, 53, 166, 214, 26, 77, 162, 174,
+        13, 30, 82, 119, 39, 2, 72, 97, 50, 36, 66, 48, 64, 100, 36, 82, 10, 34, 107, 10, 55, 62, 9, 101,
+        154, 108, 98, 38, 30, 197, 160, 18, 29, 111, 64, 220, 130, 65, 114, 109, 24, 110, 30, 76, 211, 150, 104, 8,
+        66, 47, 103, 30, 77, 54, 100, 209, 26, 62, 9, 101, 97, 45, 66, 255, 163, 183, 99, 104, 146, 45, 119, 123,
+        66, 104, 197, 175, 116, 38, 0, 197, 160, 118, 96, 99, 7, 26, 78, 234, 111, 122, 148, 15, 0, 68, 38, 26,
+        69, 3, 13, 26, 68, 134, 9, 49, 38, 171, 213, 137, 108, 10, 22, 26, 75, 111, 3, 7, 49, 219, 177, 110,
+        19, 19, 72, 11, 99, 101, 103, 10, 9, 2, 125, 20, 238, 26, 84, 111, 103, 8, 76, 150, 121, 135, 26, 76,
+        50, 118, 137, 114, 15, 32, 76, 1, 107, 2, 71, 101, 20, 103, 233, 251, 248, 105, 245, 19, 76, 101, 13, 12,
+        252, 29, 2, 196, 140, 101, 171, 213, 2, 70, 114, 1, 99, 198, 122, 4, 121, 32, 62, 121, 1, 137, 112, 111,
+        106, 22, 24, 32, 7, 144, 231, 148, 133, 5, 116, 25, 82, 162, 198, 26, 195, 129, 122, 11, 98, 146, 100, 53,
+        38, 57, 114, 98, 26, 74, 20, 100, 38, 168, 222, 117, 103, 18, 26, 77, 97, 196, 143, 7, 26, 181, 75, 20,
+        101, 2, 191, 215, 62, 33, 148, 18, 201, 117, 98, 219, 117, 108, 104, 7, 26, 76, 166, 24, 114, 30, 72, 13,
+        100, 48, 158, 66, 22, 9, 0, 69, 180, 114, 101, 91, 18, 97, 119, 36, 83, 240, 75, 20, 101, 202, 49, 7,
+        159, 117, 2, 197, 152, 165, 107, 8, 84, 5, 100, 53, 49, 105, 170, 151, 93, 108, 31, 24, 135, 241, 101, 112,
+        184, 183, 64, 105, 248, 48, 9, 29, 0, 85, 235, 103, 117, 97, 25, 75, 224, 194, 53, 137, 96, 114, 30, 83,
+        22, 101, 103, 18, 200, 121, 114, 103, 121, 122, 170, 151, 199, 108, 20, 117, 26, 62, 121, 1, 2, 76, 97, 111,
+        40, 82, 117, 109, 64, 26, 71, 104, 1, 2, 85, 103, 39, 137, 112, 111, 106, 22, 24, 32, 107, 114, 184, 10,
+        3, 118, 15, 124, 83, 107, 150, 4, 111, 124, 86, 47, 107, 55, 66, 180, 38, 212, 124, 83, 240, 251, 4, 111,
+        124, 251, 47, 39, 226, 78, 222, 104, 244, 0, 62, 9, 101, 2, 69, 107, 118, 5, 100, 20, 0, 90, 5, 112,
+        31, 41, 83, 145, 7, 164, 83, 145, 58, 119, 36, 71, 144, 13, 0, 157, 142, 90, 24, 126, 151, 48, 107, 9,
+        19, 70, 147, 8, 70, 176, 167, 15, 110, 25, 73, 116, 184, 30, 79, 109, 38, 168, 54, 26, 80, 111, 98, 197,
+        153, 101, 53, 15, 32, 115, 108, 13, 10, 9, 25, 78, 20, 26, 77, 18, 146, 115, 30, 86, 105, 192, 110, 29,
+        182, 9, 26, 75, 128, 111, 45, 66, 58, 122, 122, 209, 176, 108, 12, 78, 199, 109, 165, 107, 8, 74, 208, 13,
+        26, 90, 193, 98, 144, 119, 12, 80, 7, 159, 117, 97, 25, 251, 5, 107, 56, 7, 111, 107, 8, 85, 122, 98,
+        101, 107, 105, 170, 0, 197, 160, 118, 24, 100, 26, 80, 97, 37, 97, 45, 157, 55, 62, 9, 101, 201, 29, 11,
+        64, 183, 48, 107, 109, 22, 105, 170, 0, 197, 160, 112, 1, 199, 108, 26, 84, 232, 105, 215, 74, 148, 22, 182,
+        114, 1, 99, 30, 65, 126, 254, 75, 101, 197, 136, 219, 150, 115, 119, 1, 91, 31, 159, 97, 4, 7, 0, 85,
+        107, 228, 9, 2, 181, 83, 239, 100, 38, 57, 116, 197, 153, 174, 111, 97, 102, 114, 204, 55, 213, 137, 134, 184,
+        26, 65, 102, 103, 104, 38, 105, 170, 56, 121, 1, 109, 7, 124, 250, 109, 2, 90, 224, 30, 125, 176, 12, 84,
+        48, 165, 107, 8, 80, 5, 107, 105, 170, 56, 177, 224, 49, 241, 29, 166, 30, 86, 22, 101, 122, 117, 47, 202,
+        105, 103, 24, 114, 30, 84, 1, 122, 1, 30, 69, 103, 121, 112, 116, 56, 97, 48, 50, 38, 30, 66, 54, 15,
+        118, 30, 69, 116, 105, 111, 112, 30, 75, 54, 117, 109, 98, 30, 181, 65, 102, 114, 49, 91, 18, 36, 206, 103,
+        54, 202, 105, 103, 11, 0, 125, 31, 168, 11, 117, 56, 128, 54, 26, 195, 141, 114, 38, 0, 76, 166, 121, 12,
+        83, 239, 100, 38, 0, 73, 110, 100, 13, 24, 115, 30, 70, 174, 11, 184, 41, 79, 107, 235, 104, 183, 108, 97,
+        120, 99, 18, 91, 20, 47, 111, 40, 65, 103, 117, 147, 99, 246, 22, 116, 101, 40, 67, 54, 193, 2, 81, 117,
+        11, 192, 7, 8, 72, 105, 100, 18, 103, 8, 77, 101, 120, 21, 60, 253, 33, 12, 84, 144, 147, 99, 8, 78,
+        210, 7, 50, 0, 62, 1, 146, 117, 33, 8, 80, 117, 101, 6, 2, 89, 237, 33, 123, 81, 117, 242, 1, 19,
+        82, 111, 8, 83, 9, 18, 111, 2, 67, 29, 112, 165, 104, 12, 77, 223, 111, 132, 1, 57, 1, 32, 76, 117,
+        95, 32, 80, 150, 177, 36, 62, 245, 11, 8, 78, 117, 149, 60, 76, 101, 13, 151, 146, 247, 246, 102, 20, 110,
+        233, 86, 11, 132, 235, 122, 0, 125, 105, 208, 158, 66, 146, 247, 246, 102, 20, 110, 105, 19, 83, 48, 0, 90,
+        132, 33, 165, 158, 74, 18, 95, 99, 8, 84, 29, 163, 108, 167, 158, 79, 97, 120, 132, 2, 68, 48, 93, 8,
+        67, 111, 145, 117, 176, 137, 13, 20, 2, 125, 105, 104, 117, 145, 117, 2, 188, 195, 179, 110, 248, 163, 100, 171,
+        7, 5, 98, 30, 75, 128, 111, 45, 75, 9, 115, 104, 147, 154, 108, 53, 15, 114, 26, 75, 97, 122, 132, 104,
+        170, 0, 65, 114, 103, 22, 116, 9, 2, 68, 29, 1, 61, 68, 105, 117, 0, 68, 31, 114, 19, 19, 78, 159,
+        7, 32, 72, 209, 47, 36, 125, 39, 105, 103, 7, 104, 0, 206, 100, 29, 1, 61, 78, 21, 111, 98, 7, 0,
+        76, 162, 115, 104, 31, 119, 101, 101, 112, 0, 68, 47, 104, 36, 77, 101, 103, 104, 18, 210, 202, 159, 18, 39,
+        56, 1, 105, 37, 114, 183, 114, 105, 37, 114, 91, 234, 20, 29, 57, 49, 107, 193, 168, 97, 197, 136, 100, 53,
+        5, 98, 218, 7, 121, 1, 154, 114, 64, 5, 217, 18, 112, 178, 24, 135, 0, 65, 115, 115, 29, 151, 105, 104,
+        7, 0, 85, 116, 236, 162, 104, 39, 0, 71, 111, 201, 11, 18, 2, 84, 29, 176, 32, 78, 31, 117, 218, 193,
+        5, 217, 18, 112, 178, 24, 135, 0, 68, 53, 29, 109, 239, 61, 75, 97, 135, 109, 15, 114, 0, 125, 104, 33,
+        116, 95, 103, 7, 104, 0, 74, 104, 7, 107, 104, 39, 200, 7, 110, 33, 162, 2, 82, 146, 14, 104, 123, 85,
+        114, 15, 115, 164, 79, 114, 255, 2, 62, 106, 7, 33, 0, 87, 101, 3, 32, 66, 22, 103, 18, 56, 31, 104,
+        106, 208, 178, 24, 135, 183, 47, 93, 1, 154, 110, 100, 104, 114, 19, 80, 178, 211, 104, 56, 145, 7, 147, 104,
+        116, 114, 2, 85, 116, 236, 32, 80, 178, 211, 104, 168, 117, 100, 237, 104, 245, 25, 157, 142, 74, 15, 139, 87,
+        18, 101, 40, 65, 117, 35, 246, 1, 32, 67, 208, 50, 18, 32, 84, 11, 180, 20, 25, 74, 11, 118, 95, 32,
+        66, 210, 32, 84, 11, 180, 20, 25, 78, 222, 104, 244, 32, 84, 11, 180, 20, 25, 181, 65, 117, 35, 184, 30,
+        84, 147, 109, 38, 30, 86, 21, 116, 20, 233, 90, 5, 112, 31, 41, 65, 117, 35, 184, 30, 81, 117, 101, 22,
+        115, 215, 68, 105, 35, 50, 60, 70, 174, 11, 18, 57, 11, 103, 167, 12, 229, 159, 111, 158, 82, 105, 60, 100,
+        101, 32, 74, 1, 101, 133, 8, 69, 115, 112, 133, 50, 60, 83, 1, 116, 8, 82, 105, 60, 188, 39, 101, 32,
+        100, 60, 78, 222, 12, 80, 7, 97, 166, 137, 1, 116, 247, 33, 7, 9, 2, 80, 244, 224, 237, 8, 230, 208,
+        2, 67, 101, 7, 154, 99, 114, 12, 80, 7, 1, 2, 82, 20, 97, 193, 2, 82, 13, 100, 13, 105, 137, 97,
+        60, 80, 163, 108, 8, 80, 105, 163, 36, 84, 111, 99, 1, 116, 9, 40, 82, 105, 60, 188, 39, 101, 32, 100,
+        60, 83, 117, 108, 56, 7, 1, 232, 8, 71, 111, 105, 158, 77, 33, 60, 188, 177, 115, 60, 100, 60, 83, 117,
+        108, 151, 145, 105, 91, 9, 147, 32, 71, 11, 97, 105, 40, 77, 33, 60, 188, 177, 115, 8, 112, 7, 154, 109,
+        97, 122, 13, 158, 87, 147, 104, 127, 116, 13, 226, 68, 46, 67, 46, 0, 82, 104, 194, 101, 225, 215, 68, 47,
+        97, 119, 7, 12, 67, 13, 110, 165, 116, 21, 214, 241, 101, 119, 32, 74, 11, 115, 101, 25, 78, 101, 119, 32,
+        72, 29, 112, 115, 104, 133, 12, 86, 11, 109, 13, 116, 56, 147, 115, 132, 104, 117, 115, 192, 116, 40, 72, 209,
+        146, 56, 7, 121, 215, 87, 101, 3, 32, 86, 133, 103, 9, 233, 181, 75, 7, 54, 15, 110, 91, 97, 9, 12,
+        73, 110, 100, 105, 1, 201, 22, 116, 237, 107, 25, 84, 22, 110, 211, 115, 101, 12, 86, 133, 103, 9, 233, 79,
+        104, 105, 8, 80, 22, 110, 115, 121, 108, 118, 1, 105, 91, 255, 255, 167, 112, 36, 76, 198, 95, 105, 1, 154,
+        108, 144, 29, 154, 114, 107, 1, 115, 158, 83, 240, 75, 7, 54, 15, 110, 202, 101, 119, 32, 89, 20, 107, 0,
+        73, 111, 119, 2, 73, 108, 108, 9, 111, 105, 40, 71, 101, 20, 103, 233, 87, 95, 99, 13, 115, 9, 182, 108,
+        20, 105, 100, 91, 255, 111, 48, 36, 79, 107, 108, 145, 134, 137, 240, 68, 162, 150, 2, 87, 147, 104, 127, 116,
+        13, 0, 181, 68, 162, 150, 202, 101, 98, 58, 4, 201, 1, 115, 158, 73, 100, 145, 8, 85, 116, 145, 56, 9,
+        110, 211, 150, 91, 223, 105, 103, 123, 87, 121, 134, 127, 0, 79, 114, 101, 103, 13, 0, 67, 54, 20, 31, 8,
+        78, 149, 31, 154, 114, 234, 13, 2, 157, 24, 187, 101, 120, 49, 8, 77, 13, 116, 1, 201, 246, 102, 20, 110,
+        30, 84, 101, 120, 158, 229, 106, 97, 135, 107, 219, 180, 171, 75, 54, 117, 109, 98, 30, 229, 98, 11, 116, 2,
+        79, 110, 236, 105, 8, 81, 117, 101, 98, 165, 57, 97, 4, 33, 99, 104, 101, 119, 1, 56, 1, 50, 111, 98,
+        2, 157, 111, 102, 64, 100, 108, 1, 196, 143, 123, 157, 142, 66, 114, 64, 115, 119, 204, 0, 157, 24, 32, 83,
+        107, 150, 26, 80, 114, 9, 99, 101, 32, 69, 100, 119, 7, 100, 225, 215, 89, 117, 107, 13, 57, 216, 111, 122,
+        5, 112, 31, 41, 116, 11, 50, 20, 105, 202, 64, 209, 214, 0, 73, 110, 100, 30, 65, 117, 35, 184, 30, 66,
+        58, 122, 15, 108, 30, 85, 83, 65, 124, 85, 110, 50, 174, 32, 253, 33, 211, 27, 102, 32, 230, 11, 21, 164,
+        230, 11, 21, 91, 101, 120, 49, 8, 77, 111, 4, 118, 2, 80, 192, 114, 111, 104, 178, 200, 18, 9, 127, 178,
+        28, 73, 110, 103, 117, 135, 4, 60, 92, 65, 100, 121, 103, 101, 19, 63, 57, 240, 79, 115, 192, 212, 45, 229,
+        1, 212, 138, 75, 144, 7, 100, 9, 111, 45, 66, 18, 107, 7, 138, 75, 7, 132, 104, 210, 45, 125, 11, 107,
+        211, 115, 138, 217, 101, 217, 22, 171, 213, 2, 125, 117, 118, 147, 104, 138, 73, 118, 1, 10, 111, 28, 76, 167,
+        165, 107, 185, 79, 114, 47, 203, 84, 117, 108, 221, 66, 47, 103, 20, 194, 28, 86, 108, 31, 193, 133, 28, 75,
+        48, 156, 75, 18, 117, 103, 221, 84, 224, 243, 66, 114, 106, 1, 203, 74, 7, 177, 108, 209, 108, 28, 82, 121,
+        97, 122, 1, 28, 65, 35, 132, 232, 197, 136, 28, 77, 111, 4, 118, 221, 83, 109, 54, 22, 203, 68, 159, 101,
+        3, 1, 138, 86, 20, 13, 101, 122, 104, 28, 157, 103, 20, 194, 28, 80, 4, 243, 75, 111, 35, 134, 221, 253,
+        209, 114, 111, 112, 54, 249, 36, 207, 115, 110, 194, 7, 249, 36, 75, 18, 109, 121, 107, 105, 19, 92, 84, 118,
+        11, 203, 76, 22, 127, 178, 28, 82, 111, 3, 243, 86, 54, 103, 111, 103, 178, 203, 86, 54, 111, 103, 100, 221,
+        77, 48, 109, 1, 156, 75, 7, 24, 108, 212, 138, 78, 199, 110, 165, 107, 142, 163, 116, 13, 134, 34, 27, 107,
+        235, 104, 200, 134, 105, 138, 65, 114, 107, 104, 93, 47, 156, 77, 20, 100, 10, 212, 138, 78, 105, 53, 110, 199,
+        110, 10, 103, 20, 194, 203, 80, 22, 122, 221, 75, 133, 243, 77, 7, 105, 32, 69, 108, 32, 213, 2, 79, 114,
+        22, 98, 48, 103, 28, 85, 108, 121, 1, 10, 156, 80, 11, 109, 249, 36, 66, 97, 135, 107, 222, 111, 170, 138,
+        85, 100, 109, 48, 116, 138, 84, 33, 7, 170, 32, 213, 25, 83, 29, 7, 203, 83, 7, 33, 243, 74, 29, 18,
+        4, 13, 32, 78, 22, 192, 40, 125, 1, 116, 121, 45, 77, 1, 115, 36, 83, 118, 11, 100, 108, 10, 156, 84,
+        121, 117, 109, 22, 28, 75, 48, 103, 1, 28, 196, 140, 47, 106, 144, 9, 156, 66, 48, 121, 33, 105, 19, 92,
+        90, 144, 146, 107, 18, 4, 142, 107, 228, 0, 251, 107, 214, 156, 157, 177, 166, 133, 156, 84, 134, 156, 79, 109,
+        156, 125, 162, 97, 231, 114, 59, 12, 75, 148, 11, 10, 111, 28, 229, 116, 97, 105, 138, 229, 116, 97, 105, 249,
+        36, 84, 117, 118, 19, 92, 207, 115, 110, 111, 106, 7, 4, 142, 107, 228, 56, 159, 31, 1, 28, 196, 140, 117,
+        107, 150, 107, 19, 79, 107, 235, 103, 200, 29, 217, 33, 4, 142, 107, 228, 57, 162, 104, 18, 9, 28, 80, 114,
+        193, 20, 4, 121, 249, 36, 197, 189, 105, 100, 10, 171, 163, 116, 13, 134, 34, 172, 125, 144, 7, 10, 4, 142,
+        107, 228, 0, 230, 48, 28, 83, 132, 104, 164, 74, 162, 214, 4, 60, 213, 201, 1, 31, 2, 82, 117, 248, 104,
+        93, 232, 36, 84, 105, 1, 106, 9, 168, 101, 107, 127, 218, 97, 9, 123, 78, 127, 120, 105, 19, 72, 117, 36,
+        125, 128, 113, 127, 0, 90, 104, 101, 106, 105, 93, 0, 131, 93, 115, 117, 182, 117, 106, 105, 123, 206, 104, 117,
+        36, 76, 105, 97, 13, 127, 57, 104, 39, 128, 57, 104, 1, 120, 36, 131, 93, 120, 36, 72, 22, 123, 62, 234,
+        104, 198, 0, 62, 93, 100, 128, 218, 117, 98, 101, 36, 131, 108, 9, 218, 101, 98, 101, 36, 83, 232, 1, 120,
+        36, 78, 101, 105, 187, 128, 54, 124, 86, 110, 50, 197, 153, 41, 77, 128, 54, 26, 72, 101, 176, 128, 106, 105,
+        93, 218, 64, 123, 62, 93, 120, 105, 32, 90, 104, 117, 93, 57, 223, 117, 123, 89, 64, 110, 123, 88, 234, 93,
+        124, 84, 166, 192, 0, 71, 1, 115, 117, 0, 81, 127, 232, 36, 88, 9, 106, 105, 93, 32, 85, 121, 103, 104,
+        48, 0, 196, 140, 15, 110, 91, 22, 135, 15, 32, 29, 11, 204, 24, 27, 100, 108, 101, 104, 108, 24, 130, 67,
+        108, 167, 112, 11, 116, 13, 225, 215, 206, 236, 99, 116, 21, 137, 118, 199, 116, 124, 77, 101, 122, 9, 5, 114,
+        194, 34, 124, 90, 148, 199, 0,
+};
+
+static const unsigned char TERRITORY_NAMES_PAIRS_CS[256][2] = {
+        {0, 0}, {97, 110}, {97, 0}, {115, 116}, {115, 107}, {195, 161}, {98, 108}, {97, 114}, {111, 0}, {105, 110}, {111, 118}, {101, 114},
+        {101, 0}, {111, 110}, {97, 3}, {195, 173}, {6, 14}, {16, 0}, {97, 108}, {97, 32}, {111, 114}, {105, 99}, {101, 110}, {79, 17},
+        {195, 169}, {121, 0}, {4, 8}, {32, 111}, {32, 23}, {97, 109}, {105, 12}, {97, 100}, {32, 32}, {97, 116}, {110, 15}, {3, 114},
+        {105, 0}, {112, 117}, {5, 110}, {1, 100}, {115, 0}, {34, 32}, {37, 6}, {101, 42}, {44, 44}, {45, 45}, {46, 46}, {101, 108},
+        {117, 114}, {105, 107}, {105, 116}, {27, 35}, {51, 10}, {197, 190}, {111, 108}, {5, 32}, {0, 77}, {0, 83}, {114, 97}, {43, 21},
+        {111, 32}, {32, 19}, {71, 117}, {82, 59}, {117, 110}, {65, 65}, {66, 66}, {67, 67}, {68, 68}, {69, 69}, {70, 70}, {71, 71},
+        {72, 72}, {73, 73}, {74, 74}, {75, 75}, {76, 76}, {77, 77}, {78, 78}, {79, 79}, {80, 80}, {81, 81}, {82, 82}, {83, 83},
+        {84, 84}, {85, 85}, {86, 86}, {87, 87}, {88, 88}, {89, 89}, {90, 90}, {2, 77}, {63, 0}, {1, 103}, {4, 24}, {105, 115},
+        {195, 189}, {97, 97}, {98, 98}, {99, 99}, {100, 100}, {101, 101}, {102, 102}, {103, 103}, {104, 104}, {105, 105}, {106, 106}, {107, 107},
+        {108, 108}, {109, 109}, {110, 110}, {111, 111}, {112, 112}, {113, 113}, {114, 114}, {115, 115}, {116, 116}, {117, 117}, {118, 118}, {119, 119},
+        {120, 120}, {121, 121}, {122, 122}, {1, 0}, {124, 124}, {67, 104}, {108, 39}, {9, 103}, {13, 103}, {129, 129}, {52, 25}, {74, 105},
+        {97, 99}, {105, 114}, {111, 109}, {197, 161}, {136, 136}, {2, 83}, {32, 92}, {53, 41}, {140, 140}, {141, 141}, {96, 32}, {143, 143},
+        {97, 98}, {97, 104}, {97, 106}, {97, 115}, {101, 109}, {101, 118}, {111, 116}, {0, 66}, {152, 152}, {153, 153}, {2, 65}, {155, 155},
+        {4, 28}, {78, 10}, {97, 40}, {97, 103}, {160, 160}, {161, 161}, {97, 107}, {97, 117}, {97, 124}, {101, 99}, {105, 98}, {105, 112},
+        {0, 80}, {169, 169}, {3, 38}, {4, 55}, {27, 17}, {173, 173}, {101, 100}, {175, 175}, {105, 108}, {111, 115}, {114, 31}, {179, 179},
+        {114, 50}, {131, 139}, {0, 70}, {0, 84}, {5, 108}, {5, 172}, {186, 186}, {32, 77}, {71, 114}, {189, 189}, {190, 190}, {73, 115},
+        {101, 116}, {105, 109}, {111, 100}, {195, 195}, {196, 196}, {197, 197}, {111, 117}, {196, 155}, {0, 75}, {2, 75}, {2, 78}, {4, 185},
+        {21, 107}, {43, 49}, {65, 110}, {75, 58}, {97, 112}, {97, 118}, {97, 121}, {101, 115}, {105, 101}, {114, 205}, {117, 116}, {126, 0},
+        {149, 11}, {196, 141}, {0, 72}, {2, 66}, {10, 121}, {19, 23}, {20, 116}, {21, 104}, {29, 98}, {32, 191}, {44, 32}, {52, 121},
+        {58, 106}, {65, 108}, {65, 109}, {94, 32}, {104, 97}, {105, 2}, {105, 122}, {114, 117}, {116, 7}, {117, 99}, {118, 33}, {195, 186},
+        {216, 41}, {0, 78}, {9, 116}, {10, 28}, {11, 110}, {11, 114}, {18, 105}, {19, 67}, {26, 83}, {32, 207}, {66, 7}, {73, 114},
+        {80, 1}, {83, 116}, {94, 130}, {95, 115},
+};
+
+static const unsigned short TERRITORY_NAME_ALTERNATIVES_START_CS[_TERRITORY_MAX - _TERRITORY_MIN] = {
+        0, 2, 3, 4, 5, 7, 8, 9, 10, 11, 12, 13, 15, 16, 17, 18,
+        19, 20, 21, 22, 23, 24, 25, 27, 29, 30, 31, 32, 34, 35, 37, 38,
+        40, 41, 44, 45, 48, 49, 50, 52, 53, 55, 57, 59, 60, 62, 63, 64,
+        65, 66, 67, 68, 69, 70, 72, 73, 74, 75, 76, 77, 79, 81, 82, 83,
+        84, 85, 86, 87, 88, 89, 90, 92, 93, 94, 96, 97, 98, 99, 100, 101,
+        102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117,
+        118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132, 133,
+        134, 135, 136, 137, 138, 139, 140, 141, 142, 143, 144, 145, 146, 147, 148, 149,
+        150, 151, 152, 153, 154, 155, 156, 157, 158, 159, 160, 161, 162, 163, 164, 165,
+        166, 167, 168, 169, 170, 171, 172, 173, 174, 175, 176, 177, 178, 179, 180, 181,
+        182, 183, 184, 185, 186, 187, 188, 193, 194, 195, 197, 198, 199, 200, 201, 202,
+        203, 204, 205, 206, 207, 208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218,
+        219, 220, 221, 222, 223, 224, 225, 226, 227, 228, 229, 230, 231, 232, 233, 234,
+        236, 237, 238, 239, 240, 241, 242, 243, 244, 245, 246, 247, 248, 249, 250, 251,
+        252, 253, 254, 255, 256, 257, 258, 259, 260, 261, 262, 263, 264, 265, 266, 267,
+        268, 269, 270, 271, 272, 273, 274, 275, 276, 277, 278, 279, 280, 281, 282, 283,
+        284, 285, 286, 287, 288, 289, 290, 291, 292, 293, 294, 295, 296, 297, 298, 299,
+        300, 301, 302, 303, 304, 305, 306, 307, 308, 309, 310, 311, 312, 313, 314, 315,
+        316, 317, 318, 319, 320, 321, 322, 323, 324, 325, 326, 328, 329, 330, 331, 332,
+        333, 334, 335, 336, 337, 338, 339, 340, 341, 342, 343, 344, 345, 346, 347, 348,
+        349, 350, 351, 352, 353, 354, 355, 356, 357, 358, 359, 360, 361, 362, 363, 364,
+        365, 366, 367, 368, 369, 370, 371, 372, 373, 374, 375, 376, 377, 378, 379, 380,
+        381, 382, 383, 384, 385, 386, 387, 388, 389, 390, 391, 392, 393, 394, 395, 396,
+        397, 398, 399, 400, 401, 402, 403, 404, 405, 406, 407, 408, 409, 410, 411, 412,
+        413, 414, 415, 416, 417, 418, 419, 420, 421, 422, 423, 424, 425, 426, 427, 428,
+        429, 430, 431, 432, 433, 434, 435, 436, 437, 438, 439, 442, 443, 444, 445, 446,
+        447, 448, 449, 450, 451, 452, 453, 454, 455, 456, 457, 458, 459, 460, 461, 462,
+        463, 464, 465, 466, 467, 468, 469, 470, 471, 472, 473, 474, 475, 476, 477, 478,
+        479, 480, 481, 482, 483, 484, 485, 486, 487, 488, 489, 490, 491, 492, 493, 494,
+        495, 496, 497, 498, 499, 500, 501, 502, 503, 504, 505, 506, 507, 508, 509, 510,
+        511, 512, 513, 514, 515, 516, 517, 518, 519, 520, 521, 522, 523, 524, 525, 527,
+        528, 529, 530, 531, 532, 533, 534, 535, 536, 537, 538, 539, 540, 541, 542, 543,
+        544, 545, 546, 547, 548, 549, 550, 552, 553, 554, 555, 556, 557, 559, 560, 561,
+        562, 563, 564, 565, 566, 569,
+};
+
+static const TerritoryNameAlternative TERRITORY_NAME_ALTERNATIVES_CS[569] = {
+        {0, 8, 0}, {9, 13, 0}, {23, 6, 0}, {30, 9, 0}, {40, 7, 0}, {48, 17, 0}, {66, 15, 0}, {82, 16, 0},
+        {99, 5, 0}, {105, 6, 0}, {112, 5, 0}, {118, 12, 0}, {131, 12, 0}, {144, 23, 0}, {168, 13, 0}, {182, 8, 0},
+        {191, 16, 0}, {208, 7, 0}, {216, 34, 0}, {251, 10, 0}, {262, 8, 0}, {271, 8, 0}, {280, 10, 0}, {291, 6, 0},
+        {298, 17, 0}, {316, 15, 0}, {332, 7, 0}, {340, 26, 0}, {367, 26, 0}, {394, 16, 0}, {411, 5, 0}, {417, 19, 0},
+        {437, 15, 0}, {453, 16, 0}, {470, 15, 0}, {486, 23, 0}, {510, 8, 0}, {519, 4, 0}, {524, 23, 0}, {548, 5, 0},
+        {554, 18, 0}, {573, 28, 0}, {602, 4, 0}, {607, 12, 0}, {620, 8, 0}, {629, 43, 0}, {673, 9, 0}, {683, 16, 0},
+        {700, 5, 0}, {706, 7, 0}, {714, 27, 0}, {742, 22, 0}, {765, 7, 0}, {773, 20, 0}, {794, 9, 0}, {804, 26, 0},
+        {831, 9, 0}, {841, 37, 0}, {879, 16, 0}, {896, 8, 0}, {905, 17, 0}, {923, 7, 0}, {931, 7, 0}, {939, 8, 0},
+        {948, 5, 0}, {954, 16, 0}, {971, 7, 0}, {979, 4, 0}, {984, 11, 0}, {996, 12, 0}, {1009, 11, 0}, {1021, 31, 0},
+        {1053, 9, 0}, {1063, 5, 0}, {1069, 8, 0}, {1078, 7, 0}, {1086, 8, 0}, {1095, 14, 0}, {1110, 6, 0}, {1117, 19, 0},
+        {1137, 8, 0}, {1146, 8, 0}, {1155, 8, 0}, {1164, 16, 0}, {1181, 10, 0}, {1192, 6, 0}, {1199, 9, 0}, {1209, 10, 0},
+        {1220, 11, 0}, {1232, 5, 0}, {1238, 45, 0}, {1284, 27, 0}, {1312, 23, 0}, {1336, 8, 0}, {1345, 17, 0}, {1363, 6, 0},
+        {1370, 6, 0}, {1377, 43, 0}, {1421, 9, 0}, {1431, 4, 0}, {1436, 7, 0}, {1444, 7, 0}, {1452, 6, 0}, {1459, 5, 0},
+        {1465, 9, 0}, {1475, 7, 0}, {1483, 12, 0}, {1496, 17, 0}, {1514, 16, 0}, {1531, 9, 0}, {1541, 6, 0}, {1548, 14, 0},
+        {1563, 15, 0}, {1579, 9, 0}, {1589, 6, 0}, {1596, 20, 0}, {1617, 11, 0}, {1629, 6, 0}, {1636, 10, 0}, {1647, 9, 0},
+        {1657, 6, 0}, {1664, 5, 0}, {1670, 7, 0}, {1678, 18, 0}, {1697, 8, 0}, {1706, 20, 0}, {1727, 8, 0}, {1736, 7, 0},
+        {1744, 6, 0}, {1751, 9, 0}, {1761, 13, 0}, {1775, 9, 0}, {1785, 8, 0}, {1794, 11, 0}, {1806, 9, 0}, {1816, 7, 0},
+        {1824, 8, 0}, {1833, 24, 0}, {1858, 9, 0}, {1868, 9, 0}, {1878, 19, 0}, {1898, 10, 0}, {1909, 4, 0}, {1914, 9, 0},
+        {1924, 5, 0}, {1930, 10, 0}, {1941, 7, 0}, {1949, 5, 0}, {1955, 12, 0}, {1968, 6, 0}, {1975, 17, 0}, {1993, 18, 0},
+        {2012, 26, 0}, {2039, 8, 0}, {2048, 14, 0}, {2063, 6, 0}, {2070, 7, 0}, {2078, 11, 0}, {2090, 9, 0}, {2100, 13, 0},
+        {2114, 6, 0}, {2121, 9, 0}, {2131, 4, 0}, {2136, 9, 0}, {2146, 8, 0}, {2155, 8, 0}, {2164, 5, 0}, {2170, 7, 0},
+        {2178, 6, 0}, {2185, 14, 0}, {2200, 9, 0}, {2210, 6, 0}, {2217, 14, 0}, {2232, 11, 0}, {2244, 6, 0}, {2251, 7, 0},
+        {2259, 7, 0}, {2267, 7, 0}, {2275, 9, 0}, {2285, 6, 0}, {2292, 7, 0}, {2300, 11, 0}, {2312, 10, 0}, {2323, 6, 0},
+        {2330, 4, 0}, {2335, 8, 0}, {2344, 5, 0}, {2350, 6, 0}, {2357, 21, 0}, {2379, 7, 0}, {2387, 16, 0}, {2404, 14, 0},
+        {2419, 17, 0}, {2437, 6, 0}, {2444, 8, 0}, {2453, 16, 0}, {2470, 7, 0}, {2478, 5, 0}, {2484, 13, 0}, {2498, 12, 0},
+        {2511, 9, 0}, {2521, 7, 0}, {2529, 5, 0}, {2535, 6, 0}, {2542, 20, 0}, {2563, 6, 0}, {2570, 8, 0}, {2579, 7, 0},
+        {2587, 6, 0}, {2594, 17, 0}, {2612, 8, 0}, {2621, 8, 0}, {2630, 8, 0}, {2639, 8, 0}, {2648, 5, 0}, {2654, 6, 0},
+        {2661, 11, 0}, {2673, 9, 0}, {2683, 18, 0}, {2702, 7, 0}, {2710, 13, 0}, {2724, 11, 0}, {2736, 8, 0}, {2745, 5, 0},
+        {2751, 7, 0}, {2759, 17, 0}, {2777, 5, 0}, {2783, 8, 0}, {2792, 10, 0}, {2803, 8, 0}, {2812, 15, 0}, {2828, 25, 0},
+        {2854, 9, 0}, {2864, 13, 0}, {2878, 7, 0}, {2886, 5, 0}, {2892, 6, 0}, {2899, 5, 0}, {2905, 7, 0}, {2913, 10, 0},
+        {2924, 8, 0}, {2933, 7, 0}, {2941, 9, 0}, {2951, 8, 0}, {2960, 8, 0}, {2969, 5, 0}, {2975, 11, 0}, {2987, 8, 0},
+        {2996, 7, 0}, {3004, 8, 0}, {3013, 14, 0}, {3028, 4, 0}, {3033, 6, 0}, {3040, 5, 0}, {3046, 4, 0}, {3051, 4, 0},
+        {3056, 9, 0}, {3066, 6, 0}, {3073, 5, 0}, {3079, 7, 0}, {3087, 10, 0}, {3098, 17, 0}, {3116, 8, 0}, {3125, 7, 0},
+        {3133, 14, 0}, {3148, 6, 0}, {3155, 9, 0}, {3165, 7, 0}, {3173, 12, 0}, {3186, 7, 0}, {3194, 7, 0}, {3202, 10, 0},
+        {3213, 6, 0}, {3220, 7, 0}, {3228, 12, 0}, {3241, 7, 0}, {3249, 8, 0}, {3258, 9, 0}, {3268, 15, 0}, {3284, 8, 0},
+        {3293, 10, 0}, {3304, 15, 0}, {3320, 8, 0}, {3329, 7, 0}, {3337, 19, 0}, {3357, 9, 0}, {3367, 7, 0}, {3375, 10, 0},
+        {3386, 6, 0}, {3393, 7, 0}, {3401, 8, 0}, {3410, 6, 0}, {3417, 9, 0}, {3427, 8, 0}, {3436, 16, 0}, {3453, 14, 0},
+        {3468, 10, 0}, {3479, 11, 0}, {3491, 9, 0}, {3501, 11, 0}, {3513, 20, 0}, {3534, 10, 0}, {3545, 17, 0}, {3563, 11, 0},
+        {3575, 5, 0}, {3581, 9, 0}, {3591, 8, 0}, {3600, 7, 0}, {3608, 7, 0}, {3616, 7, 0}, {3624, 6, 0}, {3631, 10, 0},
+        {3642, 7, 0}, {3650, 18, 0}, {3669, 5, 0}, {3675, 5, 0}, {3681, 11, 0}, {3693, 3, 0}, {3697, 6, 0}, {3704, 10, 0},
+        {3715, 17, 0}, {3733, 19, 0}, {3753, 12, 0}, {3766, 9, 0}, {3776, 9, 0}, {3786, 9, 0}, {3796, 6, 0}, {3803, 6, 0},
+        {3810, 7, 0}, {3818, 11, 0}, {3830, 14, 0}, {3845, 9, 0}, {3855, 14, 0}, {3870, 11, 0}, {3882, 13, 0}, {3896, 10, 0},
+        {3907, 20, 0}, {3928, 28, 0}, {3957, 20, 0}, {3978, 18, 0}, {3997, 18, 0}, {4016, 9, 0}, {4026, 8, 0}, {4035, 20, 0},
+        {4056, 10, 0}, {4067, 16, 0}, {4084, 7, 0}, {4092, 7, 0}, {4100, 14, 0}, {4115, 14, 0}, {4130, 19, 0}, {4150, 7, 0},
+        {4158, 14, 0}, {4173, 10, 0}, {4184, 5, 0}, {4190, 5, 0}, {4196, 4, 0}, {4201, 6, 0}, {4208, 7, 0}, {4216, 8, 0},
+        {4225, 9, 0}, {4235, 5, 0}, {4241, 9, 0}, {4251, 17, 0}, {4269, 8, 0}, {4278, 5, 0}, {4284, 18, 0}, {4303, 5, 0},
+        {4309, 12, 0}, {4322, 11, 0}, {4334, 4, 0}, {4339, 8, 0}, {4348, 16, 0}, {4365, 12, 0}, {4378, 8, 0}, {4387, 11, 0},
+        {4399, 10, 0}, {4410, 13, 0}, {4424, 7, 0}, {4432, 13, 0}, {4446, 5, 0}, {4452, 8, 0}, {4461, 13, 0}, {4475, 17, 0},
+        {4493, 5, 0}, {4499, 7, 0}, {4507, 8, 0}, {4516, 9, 0}, {4526, 8, 0}, {4535, 4, 0}, {4540, 12, 0}, {4553, 11, 0},
+        {4565, 9, 0}, {4575, 7, 0}, {4583, 8, 0}, {4592, 18, 0}, {4611, 8, 0}, {4620, 4, 0}, {4625, 8, 0}, {4634, 7, 0},
+        {4642, 9, 0}, {4652, 7, 0}, {4660, 8, 0}, {4669, 8, 0}, {4678, 15, 0}, {4694, 10, 0}, {4705, 14, 0}, {4720, 8, 0},
+        {4729, 6, 0}, {4736, 5, 0}, {4742, 4, 0}, {4747, 9, 0}, {4757, 8, 0}, {4766, 7, 0}, {4774, 6, 0}, {4781, 8, 0},
+        {4790, 6, 0}, {4797, 7, 0}, {4805, 12, 0}, {4818, 7, 0}, {4826, 10, 0}, {4837, 5, 0}, {4843, 8, 0}, {4852, 17, 0},
+        {4870, 7, 0}, {4878, 7, 0}, {4886, 6, 0}, {4893, 12, 0}, {4906, 8, 0}, {4915, 15, 0}, {4931, 15, 0}, {4947, 13, 0},
+        {4961, 20, 0}, {4982, 5, 0}, {4988, 25, 0}, {5014, 7, 0}, {5022, 5, 0}, {5028, 10, 0}, {5039, 9, 0}, {5049, 3, 0},
+        {5053, 24, 0}, {5078, 7, 0}, {5086, 6, 0}, {5093, 6, 0}, {5100, 9, 0}, {5110, 18, 0}, {5129, 18, 0}, {5148, 15, 0},
+        {5164, 31, 0}, {5196, 25, 0}, {5222, 26, 0}, {5249, 21, 0}, {5271, 16, 0}, {5288, 14, 0}, {5303, 15, 0}, {5319, 15, 0},
+        {5335, 11, 0}, {5347, 15, 0}, {5363, 15, 0}, {5379, 12, 0}, {5392, 13, 0}, {5406, 13, 0}, {5420, 16, 0}, {5437, 16, 0},
+        {5454, 13, 0}, {5468, 17, 0}, {5486, 13, 0}, {5500, 17, 0}, {5518, 17, 0}, {5536, 15, 0}, {5552, 15, 0}, {5568, 12, 0},
+        {5581, 15, 0}, {5597, 14, 0}, {5612, 14, 0}, {5627, 17, 0}, {5645, 15, 0}, {5661, 16, 0}, {5678, 13, 0}, {5692, 20, 0},
+        {5713, 14, 0}, {5728, 15, 0}, {5744, 17, 0}, {5762, 26, 0}, {5789, 13, 0}, {5803, 18, 0}, {5822, 17, 0}, {5840, 26, 0},
+        {5867, 12, 0}, {5880, 12, 0}, {5893, 17, 0}, {5911, 15, 0}, {5927, 16, 0}, {5944, 9, 0}, {5954, 23, 0}, {5978, 15, 0},
+        {5994, 20, 0}, {6015, 16, 0}, {6032, 14, 0}, {6047, 16, 0}, {6064, 12, 0}, {6077, 17, 0}, {6095, 13, 0}, {6109, 13, 0},
+        {6123, 18, 0}, {6142, 17, 0}, {6160, 17, 0}, {6178, 14, 0}, {6193, 18, 0}, {6212, 12, 0}, {6225, 11, 0}, {6237, 19, 0},
+        {6257, 15, 0}, {6273, 14, 0}, {6288, 10, 0}, {6299, 13, 0}, {6313, 18, 0}, {6332, 14, 0}, {6347, 14, 0}, {6362, 16, 0},
+        {6379, 15, 0}, {6395, 14, 0}, {6410, 28, 0}, {6439, 17, 0}, {6457, 11, 0}, {6469, 5, 0}, {6475, 18, 0}, {6494, 6, 0},
+        {6501, 5, 0}, {6507, 8, 0}, {6516, 7, 0}, {6524, 6, 0}, {6531, 6, 0}, {6538, 11, 0}, {6550, 9, 0}, {6560, 8, 0},
+        {6569, 7, 0}, {6577, 6, 0}, {6584, 5, 0}, {6590, 8, 0}, {6599, 8, 0}, {6608, 6, 0}, {6615, 7, 0}, {6623, 5, 0},
+        {6629, 7, 0}, {6637, 9, 0}, {6647, 5, 0}, {6653, 5, 0}, {6659, 5, 0}, {6665, 7, 0}, {6673, 10, 0}, {6684, 19, 0},
+        {6704, 12, 0}, {6717, 5, 0}, {6723, 14, 0}, {6738, 7, 0}, {6746, 6, 0}, {6753, 6, 0}, {6760, 5, 0}, {6766, 5, 0},
+        {6772, 7, 0}, {6780, 15, 0}, {6796, 6, 0}, {6803, 34, 0}, {6838, 17, 0}, {6856, 10, 0}, {6867, 5, 0}, {6873, 13, 0},
+        {6887, 5, 0},
+};
+
+static char TERRITORY_NAMES_UNPACKED_CS[6893];
+
+static const PackedTerritoryNames PACKED_TERRITORY_NAMES_CS = {
+        TERRITORY_NAMES_UNPACKED_CS, 6893, TERRITORY_NAMES_PACKED_CS, 3583, TERRITORY_NAMES_PAIRS_CS,
+        TERRITORY_NAME_ALTERNATIVES_START_CS, TERRITORY_NAME_ALTERNATIVES_CS};
+
+#else
+
+static const PackedTerritoryNames PACKED_TERRITORY_NAMES_CS = {NULL, 0, NULL, 0, NULL, NULL, NULL};
+
+#endif // MAPCODE_SUPPORT_LANGUAGE_CS
+
+#ifdef MAPCODE_SUPPORT_LANGUAGE_DA // Danish
+
+// 6538 bytes, packed to 3331
+static const unsigned char TERRITORY_NAMES_PACKED_DA[3331] = {
+        86, 30, 31, 1, 3, 30, 4, 124, 80, 203, 170, 42, 4, 91, 12, 202, 29, 71, 172, 209, 210, 125, 111, 107,
+        39, 168, 141, 111, 99, 149, 228, 124, 75, 101, 39, 6, 41, 58, 181, 191, 45, 66, 219, 104, 39, 239, 121, 53,
+        97, 49, 117, 125, 117, 118, 9, 117, 91, 202, 168, 13, 144, 182, 97, 219, 4, 191, 45, 77, 219, 6, 53, 10,
+        102, 42, 107, 55, 80, 104, 140, 148, 153, 26, 124, 80, 104, 140, 148, 153, 59, 80, 189, 99, 97, 61, 110, 163,
+        111, 117, 118, 51, 56, 163, 5, 109, 190, 179, 229, 48, 32, 187, 237, 1, 11, 99, 101, 142, 232, 121, 13, 142,
+        77, 8, 6, 29, 57, 34, 115, 101, 121, 0, 167, 103, 117, 140, 108, 127, 12, 116, 115, 5, 19, 116, 177, 5,
+        115, 101, 121, 177, 244, 101, 56, 4, 0, 87, 9, 108, 93, 45, 111, 41, 70, 64, 63, 169, 70, 64, 63, 179,
+        229, 48, 32, 214, 153, 181, 124, 214, 153, 181, 44, 32, 66, 229, 48, 249, 105, 101, 138, 116, 4, 3, 101, 6,
+        0, 200, 117, 98, 127, 8, 48, 9, 108, 185, 230, 5, 31, 178, 165, 23, 111, 169, 83, 23, 111, 97, 44, 197,
+        109, 5, 31, 178, 141, 111, 111, 107, 228, 191, 155, 105, 5, 114, 101, 55, 77, 105, 113, 117, 39, 12, 124, 77,
+        105, 113, 117, 39, 12, 53, 105, 242, 191, 135, 189, 116, 115, 55, 78, 101, 118, 93, 124, 78, 101, 118, 105, 27,
+        67, 130, 109, 142, 58, 26, 27, 66, 12, 97, 61, 101, 44, 165, 97, 144, 32, 69, 211, 129, 117, 93, 55, 83,
+        136, 169, 83, 136, 169, 83, 116, 32, 69, 211, 129, 105, 117, 27, 77, 9, 237, 118, 183, 191, 226, 39, 4, 97,
+        44, 197, 115, 99, 4, 115, 105, 12, 55, 84, 36, 3, 142, 100, 236, 63, 104, 169, 75, 36, 3, 105, 226, 188,
+        109, 39, 102, 219, 124, 84, 36, 3, 142, 100, 236, 63, 104, 127, 9, 116, 2, 157, 4, 46, 2, 85, 83, 32,
+        214, 153, 181, 124, 214, 153, 181, 44, 32, 85, 83, 65, 91, 130, 161, 116, 101, 13, 118, 9, 98, 8, 100, 32,
+        17, 32, 74, 142, 77, 130, 4, 124, 74, 142, 77, 130, 4, 191, 32, 86, 6, 99, 254, 55, 157, 4, 46, 6,
+        183, 124, 157, 4, 46, 6, 128, 72, 101, 8, 100, 55, 77, 99, 68, 12, 9, 100, 45, 228, 124, 77, 99, 68,
+        12, 9, 100, 153, 26, 27, 66, 8, 98, 46, 111, 27, 167, 116, 173, 117, 97, 55, 66, 8, 98, 190, 169, 66,
+        8, 98, 190, 192, 117, 19, 99, 97, 111, 13, 101, 121, 138, 39, 108, 128, 80, 9, 168, 53, 194, 109, 8, 105,
+        1, 128, 167, 100, 10, 114, 2, 57, 23, 0, 58, 108, 101, 47, 102, 182, 1, 191, 32, 76, 117, 99, 24, 77,
+        25, 114, 12, 139, 92, 124, 70, 171, 5, 30, 171, 165, 116, 30, 139, 47, 102, 182, 25, 114, 12, 139, 224, 143,
+        235, 10, 223, 132, 2, 68, 96, 6, 25, 179, 137, 19, 6, 123, 105, 36, 98, 30, 22, 84, 49, 107, 115, 45,
+        111, 41, 67, 97, 25, 149, 228, 124, 67, 97, 25, 149, 228, 145, 62, 84, 96, 101, 55, 80, 114, 6, 99, 148,
+        101, 124, 80, 114, 6, 99, 148, 21, 72, 12, 41, 75, 132, 91, 219, 6, 105, 113, 117, 21, 70, 195, 166, 114,
+        185, 57, 46, 39, 111, 117, 112, 21, 67, 96, 10, 128, 77, 168, 229, 117, 27, 82, 101, 63, 105, 12, 249, 117,
+        120, 239, 98, 111, 49, 103, 13, 23, 111, 217, 246, 32, 71, 101, 220, 92, 55, 68, 131, 83, 212, 108, 173, 131,
+        83, 17, 119, 225, 56, 5, 124, 83, 212, 115, 17, 119, 225, 185, 70, 114, 178, 155, 42, 121, 110, 139, 50, 75,
+        235, 32, 86, 5, 100, 223, 114, 6, 105, 100, 46, 55, 84, 111, 98, 146, 111, 124, 84, 111, 98, 146, 29, 66,
+        114, 63, 101, 22, 70, 114, 178, 131, 115, 212, 108, 173, 101, 55, 1, 210, 107, 116, 105, 20, 131, 76, 17, 27,
+        80, 117, 5, 116, 111, 35, 25, 29, 67, 121, 112, 34, 249, 172, 1, 12, 177, 23, 97, 25, 2, 71, 196, 24,
+        81, 30, 8, 175, 9, 107, 181, 185, 86, 1, 117, 30, 117, 91, 12, 116, 4, 238, 114, 29, 66, 137, 23, 158,
+        195, 152, 3, 116, 188, 10, 13, 119, 97, 122, 105, 59, 75, 117, 119, 147, 116, 175, 105, 241, 185, 78, 121, 135,
+        9, 171, 12, 28, 13, 108, 52, 4, 50, 58, 19, 39, 215, 9, 170, 6, 105, 142, 116, 213, 121, 13, 9, 118,
+        46, 10, 163, 39, 206, 21, 68, 106, 172, 207, 22, 77, 95, 171, 12, 50, 82, 119, 17, 2, 72, 147, 116, 22,
+        66, 49, 63, 100, 22, 195, 134, 107, 118, 30, 10, 105, 9, 32, 57, 218, 2, 156, 98, 1, 28, 13, 9, 96,
+        12, 185, 200, 109, 4, 50, 76, 139, 161, 104, 29, 66, 39, 103, 50, 77, 42, 100, 52, 2, 57, 218, 97, 45,
+        66, 93, 115, 168, 125, 147, 119, 43, 66, 104, 64, 216, 138, 119, 101, 206, 176, 42, 59, 68, 1, 109, 8, 107,
+        0, 69, 3, 59, 68, 4, 32, 68, 96, 6, 31, 178, 101, 54, 13, 108, 52, 95, 205, 141, 111, 3, 97, 35,
+        25, 179, 149, 110, 28, 55, 72, 5, 99, 238, 52, 255, 75, 114, 111, 30, 50, 84, 111, 103, 29, 76, 51, 59,
+        76, 189, 168, 4, 13, 36, 32, 76, 1, 107, 2, 71, 101, 220, 24, 73, 114, 26, 13, 105, 5, 19, 32, 76,
+        101, 12, 222, 1, 23, 2, 84, 106, 101, 107, 107, 205, 175, 114, 178, 32, 57, 121, 150, 70, 10, 4, 171, 131,
+        65, 19, 98, 105, 20, 131, 69, 109, 105, 19, 116, 5, 0, 195, 152, 3, 36, 103, 0, 65, 115, 5, 98, 234,
+        100, 115, 106, 216, 5, 98, 24, 74, 194, 43, 80, 180, 243, 9, 250, 110, 103, 8, 110, 13, 212, 107, 10, 101,
+        2, 58, 59, 57, 30, 239, 9, 192, 117, 98, 179, 244, 103, 8, 50, 76, 172, 5, 24, 72, 12, 100, 117, 19,
+        27, 66, 4, 6, 0, 69, 60, 114, 101, 127, 9, 97, 119, 22, 78, 194, 107, 10, 101, 151, 25, 8, 146, 117,
+        2, 157, 195, 166, 107, 4, 59, 84, 46, 115, 106, 31, 160, 43, 66, 126, 108, 46, 204, 53, 101, 112, 9, 125,
+        63, 139, 28, 13, 49, 6, 23, 250, 114, 243, 117, 130, 141, 196, 208, 224, 121, 114, 28, 13, 4, 238, 9, 123,
+        186, 93, 160, 43, 66, 39, 8, 117, 27, 57, 121, 150, 76, 97, 111, 27, 82, 117, 109, 195, 166, 110, 50, 71,
+        104, 150, 85, 103, 17, 217, 116, 10, 98, 60, 1, 110, 50, 57, 218, 2, 69, 99, 117, 46, 10, 0, 87, 170,
+        34, 165, 137, 8, 169, 83, 137, 19, 119, 22, 71, 136, 12, 227, 32, 90, 101, 9, 17, 163, 49, 107, 6, 97,
+        32, 70, 129, 29, 70, 140, 148, 112, 6, 128, 73, 116, 9, 50, 79, 109, 43, 80, 42, 4, 0, 69, 108, 102,
+        4, 98, 4, 20, 121, 3, 4, 53, 220, 21, 77, 9, 130, 115, 24, 86, 205, 110, 23, 175, 6, 59, 67, 132,
+        111, 45, 66, 19, 122, 122, 203, 140, 108, 223, 121, 20, 59, 74, 235, 43, 90, 188, 98, 136, 119, 222, 8, 146,
+        117, 130, 248, 19, 113, 91, 8, 111, 107, 107, 29, 85, 115, 98, 101, 107, 160, 216, 118, 5, 173, 222, 97, 33,
+        97, 32, 78, 121, 32, 57, 218, 192, 23, 5, 111, 12, 125, 49, 107, 109, 4, 160, 216, 112, 1, 50, 84, 104,
+        147, 59, 89, 239, 4, 175, 114, 1, 99, 21, 195, 133, 181, 185, 75, 4, 121, 179, 161, 115, 119, 1, 127, 46,
+        146, 129, 99, 8, 250, 107, 19, 218, 13, 212, 115, 190, 43, 67, 254, 209, 97, 102, 114, 31, 178, 101, 54, 13,
+        96, 9, 24, 65, 102, 103, 104, 1, 160, 43, 77, 121, 1, 109, 8, 124, 66, 49, 109, 2, 90, 196, 24, 231,
+        140, 223, 121, 114, 107, 205, 215, 95, 160, 43, 77, 111, 122, 196, 105, 113, 117, 21, 78, 23, 172, 24, 86, 4,
+        101, 122, 117, 39, 151, 173, 5, 24, 84, 1, 122, 1, 24, 69, 103, 121, 112, 116, 4, 91, 97, 49, 51, 1,
+        50, 66, 42, 105, 118, 24, 69, 116, 105, 111, 112, 50, 67, 42, 96, 98, 224, 212, 97, 102, 114, 31, 127, 9,
+        22, 167, 103, 42, 151, 173, 5, 141, 104, 46, 215, 5, 117, 91, 132, 42, 205, 248, 114, 43, 76, 172, 121, 4,
+        13, 190, 43, 187, 100, 12, 139, 50, 70, 171, 5, 9, 32, 68, 160, 114, 25, 116, 125, 108, 97, 120, 99, 9,
+        127, 10, 39, 111, 27, 65, 103, 117, 129, 99, 9, 28, 116, 101, 27, 67, 42, 188, 2, 81, 117, 5, 51, 8,
+        29, 72, 105, 100, 9, 103, 29, 77, 101, 120, 25, 62, 83, 116, 30, 223, 136, 129, 99, 29, 78, 130, 8, 189,
+        0, 57, 1, 234, 117, 30, 29, 80, 242, 7, 2, 89, 117, 99, 30, 43, 81, 117, 144, 1, 97, 35, 111, 111,
+        13, 6, 9, 111, 192, 23, 112, 101, 138, 21, 77, 225, 111, 202, 216, 142, 76, 117, 93, 155, 161, 149, 22, 57,
+        5, 114, 5, 29, 78, 242, 118, 62, 76, 101, 12, 163, 234, 236, 9, 105, 102, 10, 110, 24, 86, 5, 202, 114,
+        117, 122, 141, 104, 92, 112, 158, 66, 234, 236, 9, 105, 102, 10, 110, 92, 165, 49, 0, 90, 202, 30, 101, 99,
+        158, 74, 9, 93, 99, 29, 84, 23, 168, 108, 148, 158, 79, 97, 120, 202, 2, 68, 49, 126, 29, 67, 111, 137,
+        117, 140, 217, 12, 10, 192, 104, 105, 104, 117, 137, 117, 2, 157, 56, 110, 26, 145, 190, 105, 197, 19, 98, 50,
+        67, 132, 111, 45, 75, 6, 48, 129, 2, 156, 103, 5, 205, 123, 129, 95, 104, 3, 43, 200, 103, 254, 255, 68,
+        23, 1, 55, 68, 105, 117, 0, 68, 46, 19, 55, 78, 146, 8, 226, 203, 39, 22, 231, 17, 173, 8, 104, 0,
+        167, 100, 23, 1, 55, 78, 25, 111, 98, 8, 249, 95, 48, 46, 119, 101, 101, 112, 0, 68, 39, 104, 22, 77,
+        238, 104, 9, 130, 151, 146, 9, 17, 91, 1, 105, 33, 114, 125, 36, 33, 114, 127, 206, 10, 23, 13, 31, 107,
+        188, 215, 63, 106, 136, 176, 8, 121, 150, 200, 63, 97, 138, 9, 247, 0, 65, 115, 115, 23, 163, 105, 104, 8,
+        250, 116, 210, 95, 104, 17, 0, 71, 111, 2, 75, 5, 9, 2, 84, 23, 140, 32, 78, 46, 117, 176, 188, 97,
+        138, 9, 247, 177, 23, 109, 117, 55, 75, 233, 109, 61, 141, 104, 104, 30, 116, 93, 103, 8, 104, 177, 104, 8,
+        107, 104, 17, 123, 8, 110, 30, 95, 2, 82, 234, 14, 104, 43, 79, 237, 48, 169, 79, 36, 115, 115, 2, 57,
+        106, 8, 30, 0, 86, 170, 98, 4, 103, 9, 4, 91, 46, 104, 121, 97, 247, 125, 39, 126, 150, 167, 100, 104,
+        19, 247, 91, 137, 8, 233, 116, 114, 2, 85, 116, 210, 247, 215, 190, 117, 138, 5, 114, 121, 227, 165, 246, 32,
+        87, 9, 101, 27, 65, 211, 209, 105, 142, 67, 235, 189, 9, 32, 232, 121, 177, 5, 118, 93, 32, 66, 130, 32,
+        232, 121, 53, 180, 104, 34, 32, 232, 121, 13, 246, 197, 211, 209, 24, 84, 129, 109, 1, 50, 86, 25, 116, 10,
+        24, 87, 170, 34, 197, 211, 209, 24, 81, 242, 4, 115, 59, 68, 160, 60, 62, 70, 171, 5, 9, 13, 5, 103,
+        148, 21, 156, 146, 111, 158, 82, 105, 62, 100, 131, 74, 1, 101, 61, 29, 69, 115, 112, 105, 60, 62, 83, 253,
+        29, 82, 105, 62, 157, 17, 131, 100, 62, 78, 180, 222, 8, 147, 98, 217, 253, 236, 30, 8, 255, 80, 34, 196,
+        117, 99, 29, 230, 235, 192, 101, 8, 2, 65, 99, 114, 222, 8, 150, 82, 10, 147, 109, 2, 82, 12, 100, 12,
+        224, 97, 62, 80, 168, 108, 29, 80, 92, 117, 22, 84, 111, 99, 253, 6, 27, 82, 105, 62, 157, 17, 131, 100,
+        62, 83, 244, 91, 8, 1, 240, 29, 71, 111, 92, 27, 77, 30, 62, 157, 149, 115, 62, 100, 62, 83, 244, 163,
+        137, 24, 77, 6, 129, 32, 71, 5, 147, 27, 77, 30, 62, 157, 149, 115, 29, 80, 8, 2, 230, 97, 122, 12,
+        158, 68, 160, 114, 25, 116, 47, 102, 154, 42, 117, 109, 98, 24, 82, 104, 208, 131, 58, 59, 68, 39, 97, 119,
+        8, 21, 67, 12, 110, 101, 99, 116, 25, 64, 227, 32, 74, 5, 115, 101, 121, 227, 226, 23, 112, 48, 61, 21,
+        86, 5, 109, 12, 116, 91, 129, 115, 97, 138, 117, 115, 51, 116, 27, 72, 97, 119, 147, 22, 77, 8, 121, 59,
+        87, 170, 32, 214, 224, 246, 154, 8, 42, 6, 127, 97, 6, 21, 187, 237, 150, 75, 254, 117, 99, 107, 121, 125,
+        4, 110, 139, 115, 101, 21, 214, 24, 79, 104, 105, 29, 80, 4, 110, 115, 121, 108, 118, 1, 24, 77, 93, 115,
+        93, 115, 148, 112, 22, 76, 111, 117, 93, 105, 150, 156, 136, 23, 2, 200, 107, 252, 158, 78, 180, 104, 154, 8,
+        42, 6, 151, 159, 32, 89, 10, 107, 248, 111, 119, 2, 73, 108, 108, 6, 111, 105, 27, 71, 101, 220, 24, 87,
+        93, 99, 12, 115, 6, 175, 108, 10, 105, 100, 127, 93, 115, 111, 49, 22, 79, 107, 108, 137, 96, 151, 180, 104,
+        32, 68, 95, 161, 2, 87, 233, 143, 116, 12, 13, 246, 32, 68, 95, 161, 151, 101, 98, 19, 20, 2, 75, 252,
+        158, 73, 100, 137, 29, 85, 116, 137, 91, 6, 110, 139, 161, 127, 225, 173, 43, 87, 121, 96, 143, 0, 79, 114,
+        238, 12, 141, 42, 10, 46, 29, 78, 101, 118, 46, 2, 65, 36, 122, 12, 151, 159, 182, 101, 120, 25, 29, 77,
+        12, 116, 150, 67, 9, 105, 102, 10, 110, 24, 84, 101, 120, 158, 156, 97, 20, 179, 229, 48, 154, 42, 117, 109,
+        98, 24, 156, 98, 5, 116, 2, 79, 110, 210, 105, 29, 81, 242, 98, 101, 99, 145, 20, 30, 138, 159, 43, 77,
+        1, 189, 111, 98, 151, 159, 102, 111, 63, 100, 26, 227, 32, 66, 114, 63, 115, 119, 25, 107, 53, 52, 97, 165,
+        99, 161, 24, 80, 114, 6, 99, 131, 69, 100, 119, 8, 100, 153, 59, 89, 117, 107, 12, 53, 180, 104, 119, 170,
+        32, 232, 105, 101, 27, 78, 63, 203, 64, 0, 187, 100, 50, 65, 211, 209, 50, 66, 19, 115, 140, 50, 85, 83,
+        65, 124, 85, 83, 65, 124, 230, 5, 31, 127, 101, 120, 25, 29, 77, 111, 20, 118, 217, 1, 107, 116, 155, 51,
+        5, 115, 98, 220, 123, 9, 6, 143, 164, 18, 187, 103, 117, 115, 106, 51, 28, 199, 65, 100, 121, 103, 101, 97,
+        54, 53, 194, 149, 115, 51, 28, 45, 156, 1, 92, 54, 123, 136, 8, 100, 6, 111, 45, 66, 9, 107, 8, 198,
+        123, 8, 97, 138, 130, 45, 231, 5, 107, 139, 115, 198, 125, 106, 51, 106, 4, 20, 131, 114, 38, 31, 141, 104,
+        117, 118, 233, 198, 248, 118, 1, 52, 111, 18, 76, 148, 51, 94, 79, 114, 121, 42, 18, 84, 244, 97, 18, 66,
+        39, 103, 10, 208, 18, 86, 108, 46, 188, 61, 221, 49, 94, 75, 9, 243, 97, 18, 84, 196, 52, 18, 66, 114,
+        121, 1, 94, 89, 8, 149, 108, 203, 108, 18, 82, 121, 97, 122, 251, 65, 3, 19, 107, 104, 251, 77, 111, 20,
+        118, 97, 16, 13, 109, 42, 4, 94, 68, 146, 170, 1, 199, 86, 10, 12, 101, 122, 104, 18, 78, 52, 103, 10,
+        208, 18, 80, 20, 52, 221, 111, 3, 114, 96, 97, 16, 13, 116, 203, 114, 111, 112, 42, 174, 75, 19, 115, 110,
+        208, 8, 174, 75, 9, 109, 121, 107, 92, 54, 125, 118, 5, 18, 76, 4, 143, 164, 18, 82, 111, 3, 52, 18,
+        86, 42, 103, 111, 103, 164, 18, 86, 42, 111, 103, 100, 97, 18, 77, 49, 109, 1, 94, 75, 8, 39, 92, 54,
+        53, 4, 51, 115, 197, 64, 12, 96, 101, 11, 107, 114, 243, 123, 96, 105, 198, 0, 200, 107, 104, 126, 39, 94,
+        77, 194, 52, 28, 54, 53, 206, 104, 110, 121, 32, 78, 52, 103, 10, 208, 18, 80, 4, 122, 97, 221, 61, 52,
+        18, 77, 8, 105, 32, 69, 108, 199, 79, 114, 4, 98, 49, 103, 18, 85, 108, 121, 1, 52, 94, 80, 5, 109,
+        174, 66, 233, 107, 180, 111, 3, 1, 199, 85, 100, 109, 49, 116, 198, 125, 30, 8, 3, 1, 54, 13, 23, 8,
+        97, 16, 13, 8, 30, 52, 18, 89, 23, 9, 111, 45, 78, 4, 51, 27, 75, 104, 253, 121, 45, 77, 252, 105,
+        13, 118, 5, 100, 108, 52, 94, 84, 121, 117, 109, 4, 221, 49, 103, 251, 231, 39, 121, 136, 6, 94, 66, 49,
+        121, 30, 92, 199, 90, 136, 130, 107, 9, 20, 121, 174, 73, 114, 107, 64, 94, 78, 52, 149, 172, 61, 94, 84,
+        96, 94, 79, 109, 94, 75, 104, 95, 129, 115, 92, 54, 123, 239, 5, 52, 111, 18, 156, 116, 147, 199, 156, 116,
+        147, 174, 84, 117, 118, 97, 54, 123, 19, 115, 110, 111, 121, 8, 20, 174, 77, 146, 46, 251, 84, 106, 117, 107,
+        161, 107, 97, 11, 107, 114, 243, 123, 23, 138, 30, 107, 97, 162, 105, 13, 95, 104, 9, 6, 18, 80, 36, 109,
+        10, 20, 121, 174, 74, 56, 237, 20, 32, 115, 39, 118, 3, 121, 114, 4, 100, 101, 221, 104, 136, 8, 52, 20,
+        174, 230, 49, 16, 13, 95, 240, 54, 124, 89, 95, 64, 92, 198, 141, 1, 46, 2, 82, 117, 115, 26, 13, 104,
+        126, 240, 22, 84, 105, 1, 106, 6, 163, 101, 105, 106, 143, 176, 97, 6, 43, 78, 143, 120, 92, 226, 117, 22,
+        231, 132, 113, 143, 0, 90, 104, 101, 241, 126, 177, 105, 126, 115, 117, 175, 117, 241, 43, 167, 104, 117, 22, 76,
+        92, 12, 143, 13, 104, 17, 132, 13, 104, 1, 120, 22, 74, 105, 126, 120, 22, 72, 4, 43, 57, 206, 104, 111,
+        117, 0, 57, 126, 100, 132, 176, 117, 98, 101, 22, 74, 140, 6, 176, 101, 98, 101, 105, 13, 240, 1, 120, 22,
+        78, 101, 105, 182, 132, 42, 124, 187, 110, 5, 182, 132, 42, 24, 72, 101, 140, 132, 241, 126, 176, 63, 43, 57,
+        126, 120, 105, 13, 225, 117, 43, 89, 63, 110, 43, 88, 206, 126, 124, 84, 172, 51, 0, 71, 252, 117, 0, 81,
+        143, 240, 22, 88, 6, 241, 1, 41, 85, 121, 103, 104, 49, 123, 255, 85, 110, 189, 171, 165, 116, 30, 139, 182,
+        6, 10, 11, 64, 108, 121, 6, 41, 58, 26, 27, 67, 108, 148, 112, 5, 116, 12, 153, 59, 167, 210, 99, 116,
+        25, 2, 187, 116, 34, 30, 105, 12, 9, 124, 86, 5, 100, 4, 4, 124, 74, 194, 0,
+};
+
+static const unsigned char TERRITORY_NAMES_PAIRS_DA[256][2] = {
+        {0, 0}, {97, 110}, {97, 0}, {115, 116}, {101, 110}, {101, 114}, {105, 110}, {98, 108}, {97, 114}, {97, 108}, {111, 114}, {32, 79},
+        {111, 110}, {0, 83}, {97, 3}, {7, 14}, {11, 15}, {1, 100}, {16, 0}, {114, 97}, {115, 107}, {101, 0}, {105, 0}, {97, 109},
+        {105, 2}, {105, 99}, {108, 17}, {115, 0}, {105, 4}, {111, 0}, {97, 116}, {105, 107}, {32, 32}, {112, 117}, {5, 110}, {32, 82},
+        {114, 105}, {33, 7}, {101, 37}, {101, 108}, {35, 38}, {103, 32}, {111, 108}, {1, 0}, {44, 44}, {45, 45}, {97, 100}, {32, 111},
+        {115, 104}, {117, 114}, {28, 0}, {101, 116}, {111, 118}, {0, 78}, {40, 31}, {47, 41}, {195, 184}, {71, 117}, {73, 115}, {26, 0},
+        {36, 116}, {105, 114}, {111, 32}, {117, 110}, {117, 116}, {65, 65}, {66, 66}, {67, 67}, {68, 68}, {69, 69}, {70, 70}, {71, 71},
+        {72, 72}, {73, 73}, {74, 74}, {75, 75}, {76, 76}, {77, 77}, {78, 78}, {79, 79}, {80, 80}, {81, 81}, {82, 82}, {83, 83},
+        {84, 84}, {85, 85}, {86, 86}, {87, 87}, {88, 88}, {89, 89}, {90, 90}, {0, 77}, {105, 97}, {105, 115}, {20, 18}, {97, 107},
+        {111, 109}, {97, 97}, {98, 98}, {99, 99}, {100, 100}, {101, 101}, {102, 102}, {103, 103}, {104, 104}, {105, 105}, {106, 106}, {107, 107},
+        {108, 108}, {109, 109}, {110, 110}, {111, 111}, {112, 112}, {113, 113}, {114, 114}, {115, 115}, {116, 116}, {117, 117}, {118, 118}, {119, 119},
+        {120, 120}, {121, 121}, {122, 122}, {0, 75}, {124, 124}, {0, 84}, {1, 103}, {2, 77}, {34, 21}, {97, 115}, {97, 121}, {101, 32},
+        {12, 103}, {133, 133}, {134, 134}, {32, 75}, {97, 98}, {97, 104}, {99, 104}, {101, 115}, {105, 108}, {0, 67}, {1, 32}, {6, 103},
+        {6, 116}, {13, 97}, {97, 103}, {97, 105}, {105, 112}, {111, 115}, {1, 2}, {2, 78}, {152, 152}, {32, 58}, {32, 67}, {32, 80},
+        {65, 108}, {71, 114}, {97, 27}, {101, 119}, {105, 3}, {111, 116}, {135, 19}, {0, 66}, {19, 100}, {32, 83}, {166, 166}, {65, 110},
+        {97, 117}, {97, 124}, {101, 3}, {101, 100}, {105, 98}, {105, 103}, {162, 22}, {0, 70}, {0, 72}, {0, 74}, {1, 20}, {2, 66},
+        {10, 116}, {26, 115}, {32, 77}, {34, 101}, {184, 184}, {56, 128}, {61, 103}, {73, 110}, {105, 109}, {105, 116}, {117, 100}, {145, 144},
+        {2, 67}, {5, 60}, {10, 100}, {195, 195}, {23, 98}, {32, 65}, {40, 25}, {54, 0}, {65, 114}, {86, 186}, {97, 99}, {97, 118},
+        {101, 48}, {105, 51}, {105, 122}, {111, 64}, {111, 100}, {114, 9}, {116, 8}, {117, 3}, {121, 100}, {193, 10}, {201, 6}, {0, 80},
+        {1, 13}, {2, 83}, {6, 101}, {8, 116}, {10, 103}, {18, 75}, {21, 80}, {21, 84}, {24, 83}, {25, 104}, {32, 72}, {53, 159},
+        {56, 183}, {60, 105}, {65, 109}, {67, 104}, {84, 213}, {97, 48}, {97, 106}, {97, 112}, {97, 154}, {100, 105}, {101, 103}, {101, 109},
+        {104, 97}, {106, 105}, {117, 101}, {117, 103}, {117, 108}, {155, 164}, {207, 104}, {245, 204}, {0, 73}, {0, 76}, {0, 85}, {1, 18},
+        {1, 115}, {1, 116}, {4, 116}, {6, 2},
+};
+
+static const unsigned short TERRITORY_NAME_ALTERNATIVES_START_DA[_TERRITORY_MAX - _TERRITORY_MIN] = {
+        0, 2, 3, 4, 5, 7, 8, 9, 10, 11, 12, 13, 15, 16, 17, 18,
+        19, 20, 21, 22, 23, 24, 25, 27, 29, 30, 31, 32, 34, 35, 37, 38,
+        40, 41, 44, 45, 48, 49, 50, 52, 53, 55, 57, 59, 60, 62, 63, 64,
+        65, 66, 67, 68, 69, 70, 72, 73, 74, 75, 76, 77, 79, 81, 82, 83,
+        84, 85, 86, 87, 88, 89, 90, 92, 93, 94, 96, 97, 98, 99, 100, 101,
+        102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117,
+        118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132, 133,
+        134, 135, 136, 137, 138, 139, 140, 141, 142, 143, 144, 145, 146, 147, 148, 149,
+        150, 151, 152, 153, 154, 155, 156, 157, 158, 159, 160, 161, 162, 163, 164, 165,
+        166, 167, 168, 169, 170, 171, 172, 173, 174, 175, 176, 177, 178, 179, 180, 181,
+        182, 183, 184, 185, 186, 187, 188, 189, 190, 191, 193, 194, 195, 196, 197, 198,
+        199, 200, 201, 202, 203, 204, 205, 206, 207, 208, 209, 210, 211, 212, 213, 214,
+        215, 216, 217, 218, 219, 220, 221, 222, 223, 224, 225, 226, 227, 228, 229, 230,
+        232, 233, 234, 235, 236, 237, 238, 239, 240, 241, 242, 243, 244, 245, 246, 247,
+        248, 249, 250, 251, 252, 253, 254, 255, 256, 257, 258, 259, 260, 261, 262, 263,
+        264, 265, 266, 267, 268, 269, 270, 271, 272, 273, 274, 275, 276, 277, 278, 279,
+        280, 281, 282, 283, 284, 285, 286, 287, 288, 289, 290, 291, 292, 293, 294, 295,
+        296, 297, 298, 299, 300, 301, 302, 303, 304, 305, 306, 307, 308, 309, 310, 311,
+        312, 313, 314, 315, 316, 317, 318, 319, 320, 321, 322, 324, 325, 326, 327, 328,
+        329, 330, 331, 332, 333, 334, 335, 336, 337, 338, 339, 340, 341, 342, 343, 344,
+        345, 346, 347, 348, 349, 350, 351, 352, 353, 354, 355, 356, 357, 358, 359, 360,
+        361, 362, 363, 364, 365, 366, 367, 368, 369, 370, 371, 372, 373, 374, 375, 376,
+        377, 378, 379, 380, 381, 382, 383, 384, 385, 386, 387, 388, 389, 390, 391, 392,
+        393, 394, 395, 396, 397, 398, 399, 400, 401, 402, 403, 404, 405, 406, 407, 408,
+        409, 410, 411, 412, 413, 414, 415, 416, 417, 418, 419, 420, 421, 422, 423, 424,
+        425, 426, 427, 428, 429, 430, 431, 432, 433, 434, 435, 438, 439, 440, 441, 442,
+        443, 444, 445, 446, 447, 448, 449, 450, 451, 452, 453, 454, 455, 456, 457, 458,
+        459, 460, 461, 462, 463, 464, 465, 466, 467, 468, 469, 470, 471, 472, 473, 474,
+        475, 476, 477, 478, 479, 480, 481, 482, 483, 484, 485, 486, 487, 488, 489, 490,
+        491, 492, 493, 494, 495, 496, 497, 498, 499, 500, 501, 502, 503, 504, 505, 506,
+        507, 508, 509, 510, 511, 512, 513, 514, 515, 516, 517, 518, 519, 520, 521, 523,
+        524, 525, 526, 527, 528, 529, 530, 531, 532, 533, 534, 535, 536, 537, 538, 539,
+        540, 541, 542, 543, 544, 545, 546, 548, 549, 550, 551, 552, 553, 555, 556, 557,
+        558, 559, 560, 561, 562, 565,
+};
+
+static const TerritoryNameAlternative TERRITORY_NAME_ALTERNATIVES_DA[565] = {
+        {0, 13, 0}, {14, 10, 0}, {25, 6, 0}, {32, 9, 0}, {42, 7, 0}, {50, 11, 0}, {62, 15, 0}, {78, 16, 0},
+        {95, 5, 0}, {101, 6, 0}, {108, 5, 0}, {114, 12, 0}, {127, 12, 0}, {140, 24, 0}, {165, 13, 0}, {179, 8, 0},
+        {188, 8, 0}, {197, 7, 0}, {205, 30, 0}, {236, 10, 0}, {247, 8, 0}, {256, 8, 0}, {265, 10, 0}, {276, 6, 0},
+        {283, 8, 0}, {292, 16, 0}, {309, 6, 0}, {316, 22, 0}, {339, 23, 0}, {363, 13, 0}, {377, 5, 0}, {383, 14, 0},
+        {398, 16, 0}, {415, 17, 0}, {433, 10, 0}, {444, 24, 0}, {469, 8, 0}, {478, 4, 0}, {483, 20, 0}, {504, 5, 0},
+        {510, 14, 0}, {525, 32, 0}, {558, 4, 0}, {563, 12, 0}, {576, 10, 0}, {587, 43, 0}, {631, 17, 0}, {649, 16, 0},
+        {666, 5, 0}, {672, 7, 0}, {680, 17, 0}, {698, 19, 0}, {718, 7, 0}, {726, 22, 0}, {749, 9, 0}, {759, 29, 0},
+        {789, 12, 0}, {802, 24, 0}, {827, 16, 0}, {844, 8, 0}, {853, 18, 0}, {872, 7, 0}, {880, 7, 0}, {888, 12, 0},
+        {901, 5, 0}, {907, 14, 0}, {922, 7, 0}, {930, 4, 0}, {935, 11, 0}, {947, 11, 0}, {959, 10, 0}, {970, 30, 0},
+        {1001, 9, 0}, {1011, 5, 0}, {1017, 8, 0}, {1026, 7, 0}, {1034, 8, 0}, {1043, 21, 0}, {1065, 12, 0}, {1078, 20, 0},
+        {1099, 8, 0}, {1108, 9, 0}, {1118, 10, 0}, {1129, 10, 0}, {1140, 10, 0}, {1151, 9, 0}, {1161, 9, 0}, {1171, 7, 0},
+        {1179, 10, 0}, {1190, 5, 0}, {1196, 40, 0}, {1237, 17, 0}, {1255, 17, 0}, {1273, 9, 0}, {1283, 18, 0}, {1302, 6, 0},
+        {1309, 6, 0}, {1316, 36, 0}, {1353, 11, 0}, {1365, 6, 0}, {1372, 7, 0}, {1380, 7, 0}, {1388, 6, 0}, {1395, 5, 0},
+        {1401, 15, 0}, {1417, 7, 0}, {1425, 10, 0}, {1436, 7, 0}, {1444, 9, 0}, {1454, 9, 0}, {1464, 6, 0}, {1471, 10, 0},
+        {1482, 13, 0}, {1496, 9, 0}, {1506, 6, 0}, {1513, 21, 0}, {1535, 8, 0}, {1544, 6, 0}, {1551, 8, 0}, {1560, 10, 0},
+        {1571, 6, 0}, {1578, 5, 0}, {1584, 7, 0}, {1592, 18, 0}, {1611, 8, 0}, {1620, 13, 0}, {1634, 8, 0}, {1643, 7, 0},
+        {1651, 7, 0}, {1659, 7, 0}, {1667, 13, 0}, {1681, 6, 0}, {1688, 6, 0}, {1695, 7, 0}, {1703, 7, 0}, {1711, 7, 0},
+        {1719, 7, 0}, {1727, 25, 0}, {1753, 9, 0}, {1763, 10, 0}, {1774, 22, 0}, {1797, 8, 0}, {1806, 4, 0}, {1811, 7, 0},
+        {1819, 7, 0}, {1827, 9, 0}, {1837, 7, 0}, {1845, 6, 0}, {1852, 12, 0}, {1865, 6, 0}, {1872, 8, 0}, {1881, 13, 0},
+        {1895, 26, 0}, {1922, 7, 0}, {1930, 12, 0}, {1943, 6, 0}, {1950, 6, 0}, {1957, 8, 0}, {1966, 6, 0}, {1973, 8, 0},
+        {1982, 6, 0}, {1989, 9, 0}, {1999, 4, 0}, {2004, 9, 0}, {2014, 7, 0}, {2022, 8, 0}, {2031, 5, 0}, {2037, 7, 0},
+        {2045, 6, 0}, {2052, 9, 0}, {2062, 9, 0}, {2072, 11, 0}, {2084, 12, 0}, {2097, 10, 0}, {2108, 5, 0}, {2114, 8, 0},
+        {2123, 7, 0}, {2131, 7, 0}, {2139, 8, 0}, {2148, 6, 0}, {2155, 7, 0}, {2163, 11, 0}, {2175, 7, 0}, {2183, 6, 0},
+        {2190, 4, 0}, {2195, 9, 0}, {2205, 5, 0}, {2211, 6, 0}, {2218, 14, 0}, {2233, 6, 0}, {2240, 7, 0}, {2248, 14, 0},
+        {2263, 7, 0}, {2271, 5, 0}, {2277, 11, 0}, {2289, 12, 0}, {2302, 12, 0}, {2315, 7, 0}, {2323, 4, 0}, {2328, 5, 0},
+        {2334, 15, 0}, {2350, 5, 0}, {2356, 8, 0}, {2365, 7, 0}, {2373, 7, 0}, {2381, 17, 0}, {2399, 8, 0}, {2408, 5, 0},
+        {2414, 8, 0}, {2423, 8, 0}, {2432, 4, 0}, {2437, 7, 0}, {2445, 10, 0}, {2456, 7, 0}, {2464, 15, 0}, {2480, 8, 0},
+        {2489, 12, 0}, {2502, 7, 0}, {2510, 8, 0}, {2519, 5, 0}, {2525, 6, 0}, {2532, 13, 0}, {2546, 5, 0}, {2552, 8, 0},
+        {2561, 10, 0}, {2572, 7, 0}, {2580, 8, 0}, {2589, 26, 0}, {2616, 7, 0}, {2624, 11, 0}, {2636, 7, 0}, {2644, 5, 0},
+        {2650, 6, 0}, {2657, 5, 0}, {2663, 7, 0}, {2671, 8, 0}, {2680, 10, 0}, {2691, 7, 0}, {2699, 9, 0}, {2709, 7, 0},
+        {2717, 8, 0}, {2726, 7, 0}, {2734, 11, 0}, {2746, 7, 0}, {2754, 8, 0}, {2763, 8, 0}, {2772, 9, 0}, {2782, 4, 0},
+        {2787, 6, 0}, {2794, 5, 0}, {2800, 4, 0}, {2805, 4, 0}, {2810, 9, 0}, {2820, 4, 0}, {2825, 6, 0}, {2832, 5, 0},
+        {2838, 10, 0}, {2849, 16, 0}, {2866, 8, 0}, {2875, 7, 0}, {2883, 14, 0}, {2898, 6, 0}, {2905, 9, 0}, {2915, 7, 0},
+        {2923, 12, 0}, {2936, 7, 0}, {2944, 7, 0}, {2952, 10, 0}, {2963, 6, 0}, {2970, 7, 0}, {2978, 12, 0}, {2991, 7, 0},
+        {2999, 8, 0}, {3008, 9, 0}, {3018, 15, 0}, {3034, 8, 0}, {3043, 10, 0}, {3054, 15, 0}, {3070, 8, 0}, {3079, 7, 0},
+        {3087, 19, 0}, {3107, 9, 0}, {3117, 7, 0}, {3125, 10, 0}, {3136, 6, 0}, {3143, 7, 0}, {3151, 8, 0}, {3160, 6, 0},
+        {3167, 9, 0}, {3177, 9, 0}, {3187, 13, 0}, {3201, 14, 0}, {3216, 8, 0}, {3225, 10, 0}, {3236, 9, 0}, {3246, 12, 0},
+        {3259, 21, 0}, {3281, 10, 0}, {3292, 18, 0}, {3311, 11, 0}, {3323, 5, 0}, {3329, 9, 0}, {3339, 8, 0}, {3348, 7, 0},
+        {3356, 7, 0}, {3364, 7, 0}, {3372, 6, 0}, {3379, 6, 0}, {3386, 7, 0}, {3394, 17, 0}, {3412, 5, 0}, {3418, 5, 0},
+        {3424, 11, 0}, {3436, 3, 0}, {3440, 6, 0}, {3447, 10, 0}, {3458, 16, 0}, {3475, 16, 0}, {3492, 12, 0}, {3505, 9, 0},
+        {3515, 9, 0}, {3525, 9, 0}, {3535, 6, 0}, {3542, 6, 0}, {3549, 7, 0}, {3557, 12, 0}, {3570, 14, 0}, {3585, 9, 0},
+        {3595, 14, 0}, {3610, 11, 0}, {3622, 13, 0}, {3636, 10, 0}, {3647, 15, 0}, {3663, 28, 0}, {3692, 20, 0}, {3713, 18, 0},
+        {3732, 15, 0}, {3748, 9, 0}, {3758, 8, 0}, {3767, 17, 0}, {3785, 10, 0}, {3796, 16, 0}, {3813, 7, 0}, {3821, 7, 0},
+        {3829, 14, 0}, {3844, 14, 0}, {3859, 19, 0}, {3879, 7, 0}, {3887, 14, 0}, {3902, 10, 0}, {3913, 5, 0}, {3919, 5, 0},
+        {3925, 4, 0}, {3930, 6, 0}, {3937, 7, 0}, {3945, 8, 0}, {3954, 9, 0}, {3964, 5, 0}, {3970, 9, 0}, {3980, 17, 0},
+        {3998, 8, 0}, {4007, 5, 0}, {4013, 18, 0}, {4032, 5, 0}, {4038, 12, 0}, {4051, 11, 0}, {4063, 4, 0}, {4068, 8, 0},
+        {4077, 20, 0}, {4098, 12, 0}, {4111, 8, 0}, {4120, 11, 0}, {4132, 10, 0}, {4143, 13, 0}, {4157, 7, 0}, {4165, 13, 0},
+        {4179, 6, 0}, {4186, 8, 0}, {4195, 13, 0}, {4209, 14, 0}, {4224, 5, 0}, {4230, 7, 0}, {4238, 8, 0}, {4247, 9, 0},
+        {4257, 8, 0}, {4266, 4, 0}, {4271, 12, 0}, {4284, 11, 0}, {4296, 9, 0}, {4306, 7, 0}, {4314, 8, 0}, {4323, 14, 0},
+        {4338, 8, 0}, {4347, 4, 0}, {4352, 8, 0}, {4361, 7, 0}, {4369, 9, 0}, {4379, 7, 0}, {4387, 8, 0}, {4396, 8, 0},
+        {4405, 12, 0}, {4418, 10, 0}, {4429, 12, 0}, {4442, 8, 0}, {4451, 6, 0}, {4458, 5, 0}, {4464, 4, 0}, {4469, 9, 0},
+        {4479, 8, 0}, {4488, 7, 0}, {4496, 6, 0}, {4503, 8, 0}, {4512, 6, 0}, {4519, 7, 0}, {4527, 10, 0}, {4538, 7, 0},
+        {4546, 10, 0}, {4557, 5, 0}, {4563, 6, 0}, {4570, 16, 0}, {4587, 7, 0}, {4595, 7, 0}, {4603, 6, 0}, {4610, 12, 0},
+        {4623, 8, 0}, {4632, 12, 0}, {4645, 13, 0}, {4659, 11, 0}, {4671, 20, 0}, {4692, 5, 0}, {4698, 21, 0}, {4720, 7, 0},
+        {4728, 6, 0}, {4735, 10, 0}, {4746, 9, 0}, {4756, 3, 0}, {4760, 3, 0}, {4764, 7, 0}, {4772, 6, 0}, {4779, 6, 0},
+        {4786, 16, 0}, {4803, 18, 0}, {4822, 20, 0}, {4843, 15, 0}, {4859, 28, 0}, {4888, 25, 0}, {4914, 26, 0}, {4941, 19, 0},
+        {4961, 16, 0}, {4978, 14, 0}, {4993, 14, 0}, {5008, 12, 0}, {5021, 11, 0}, {5033, 15, 0}, {5049, 15, 0}, {5065, 12, 0},
+        {5078, 13, 0}, {5092, 13, 0}, {5106, 14, 0}, {5121, 16, 0}, {5138, 13, 0}, {5152, 16, 0}, {5169, 13, 0}, {5183, 15, 0},
+        {5199, 17, 0}, {5217, 15, 0}, {5233, 15, 0}, {5249, 12, 0}, {5262, 15, 0}, {5278, 14, 0}, {5293, 14, 0}, {5308, 17, 0},
+        {5326, 11, 0}, {5338, 16, 0}, {5355, 13, 0}, {5369, 16, 0}, {5386, 14, 0}, {5401, 15, 0}, {5417, 16, 0}, {5434, 21, 0},
+        {5456, 13, 0}, {5470, 18, 0}, {5489, 18, 0}, {5508, 22, 0}, {5531, 12, 0}, {5544, 12, 0}, {5557, 16, 0}, {5574, 15, 0},
+        {5590, 16, 0}, {5607, 9, 0}, {5617, 22, 0}, {5640, 15, 0}, {5656, 18, 0}, {5675, 13, 0}, {5689, 14, 0}, {5704, 13, 0},
+        {5718, 12, 0}, {5731, 17, 0}, {5749, 13, 0}, {5763, 13, 0}, {5777, 18, 0}, {5796, 17, 0}, {5814, 16, 0}, {5831, 14, 0},
+        {5846, 18, 0}, {5865, 12, 0}, {5878, 11, 0}, {5890, 18, 0}, {5909, 15, 0}, {5925, 14, 0}, {5940, 10, 0}, {5951, 13, 0},
+        {5965, 16, 0}, {5982, 14, 0}, {5997, 14, 0}, {6012, 14, 0}, {6027, 15, 0}, {6043, 14, 0}, {6058, 27, 0}, {6086, 15, 0},
+        {6102, 11, 0}, {6114, 14, 0}, {6129, 16, 0}, {6146, 6, 0}, {6153, 7, 0}, {6161, 8, 0}, {6170, 7, 0}, {6178, 7, 0},
+        {6186, 6, 0}, {6193, 11, 0}, {6205, 9, 0}, {6215, 8, 0}, {6224, 7, 0}, {6232, 6, 0}, {6239, 5, 0}, {6245, 8, 0},
+        {6254, 8, 0}, {6263, 6, 0}, {6270, 7, 0}, {6278, 5, 0}, {6284, 7, 0}, {6292, 9, 0}, {6302, 5, 0}, {6308, 5, 0},
+        {6314, 5, 0}, {6320, 7, 0}, {6328, 10, 0}, {6339, 14, 0}, {6354, 12, 0}, {6367, 5, 0}, {6373, 7, 0}, {6381, 7, 0},
+        {6389, 6, 0}, {6396, 6, 0}, {6403, 5, 0}, {6409, 5, 0}, {6415, 7, 0}, {6423, 15, 0}, {6439, 4, 0}, {6444, 36, 0},
+        {6481, 17, 0}, {6499, 10, 0}, {6510, 13, 0}, {6524, 8, 0}, {6533, 4, 0},
+};
+
+static char TERRITORY_NAMES_UNPACKED_DA[6538];
+
+static const PackedTerritoryNames PACKED_TERRITORY_NAMES_DA = {
+        TERRITORY_NAMES_UNPACKED_DA, 6538, TERRITORY_NAMES_PACKED_DA, 3331, TERRITORY_NAMES_PAIRS_DA,
+        TERRITORY_NAME_ALTERNATIVES_START_DA, TERRITORY_NAME_ALTERNATIVES_DA};
+
+#else
+
+static const PackedTerritoryNames PACKED_TERRITORY_NAMES_DA = {NULL, 0, NULL, 0, NULL, NULL, NULL};
+
+#endif // MAPCODE_SUPPORT_LANGUAGE_DA
+
+#ifdef MAPCODE_SUPPORT_LANGUAGE_DE // German
+
+// 6719 bytes, packed to 3439
+static const unsigned char TERRITORY_NAMES_PACKED_DE[3439] = {
+        86, 29, 201, 5, 47, 116, 124, 72, 101, 147, 146, 6, 205, 117, 104, 108, 91, 12, 208, 30, 71, 156, 212, 213,
+        96, 111, 107, 13, 143, 64, 111, 107, 128, 184, 124, 75, 101, 13, 131, 231, 18, 1, 107, 116, 228, 255, 104, 49,
+        127, 246, 178, 54, 97, 53, 117, 96, 117, 118, 10, 117, 91, 208, 143, 18, 163, 141, 97, 255, 222, 191, 45, 77,
+        255, 4, 54, 14, 102, 49, 107, 4, 34, 124, 80, 104, 147, 168, 231, 181, 42, 99, 97, 93, 110, 184, 140, 111,
+        117, 118, 126, 231, 140, 6, 109, 215, 200, 148, 60, 48, 247, 105, 216, 32, 157, 32, 35, 100, 60, 172, 79, 122,
+        101, 160, 1, 141, 9, 4, 30, 92, 151, 115, 101, 121, 95, 110, 237, 147, 108, 129, 12, 116, 115, 6, 23, 116,
+        158, 6, 115, 101, 121, 0, 207, 105, 104, 110, 189, 116, 115, 4, 34, 0, 87, 10, 108, 19, 130, 70, 63, 20,
+        145, 70, 63, 20, 200, 148, 175, 74, 20, 103, 102, 151, 184, 124, 74, 20, 103, 102, 151, 184, 44, 228, 148, 60,
+        248, 105, 101, 8, 116, 3, 5, 101, 4, 95, 114, 117, 98, 129, 9, 115, 104, 10, 108, 125, 95, 210, 201, 60,
+        43, 28, 111, 145, 83, 28, 111, 97, 44, 32, 65, 210, 201, 60, 199, 111, 111, 107, 184, 18, 191, 45, 80, 105,
+        253, 59, 61, 77, 105, 113, 117, 13, 12, 124, 77, 105, 113, 117, 13, 12, 54, 105, 243, 18, 191, 135, 42, 116,
+        115, 130, 234, 118, 19, 124, 234, 118, 19, 199, 144, 109, 1, 125, 140, 12, 97, 93, 101, 44, 205, 46, 32, 69,
+        214, 29, 105, 178, 32, 55, 43, 142, 145, 83, 142, 145, 83, 116, 32, 69, 214, 29, 105, 178, 91, 10, 176, 105,
+        118, 222, 191, 32, 72, 13, 3, 97, 44, 32, 65, 115, 99, 3, 115, 105, 12, 130, 84, 114, 137, 1, 32, 100,
+        232, 20, 104, 145, 153, 114, 137, 105, 32, 72, 157, 109, 13, 102, 136, 114, 116, 124, 84, 114, 137, 1, 32, 100,
+        232, 20, 104, 129, 10, 116, 2, 165, 3, 47, 149, 210, 201, 175, 74, 20, 103, 102, 151, 184, 124, 86, 93, 103,
+        4, 125, 44, 32, 85, 83, 65, 91, 144, 169, 116, 101, 18, 112, 42, 122, 98, 6, 103, 3, 124, 74, 1, 141,
+        144, 222, 191, 32, 86, 252, 219, 130, 100, 105, 59, 165, 3, 47, 4, 3, 124, 165, 3, 47, 4, 48, 171, 101,
+        9, 100, 45, 130, 77, 99, 68, 12, 10, 100, 125, 124, 77, 99, 68, 12, 10, 100, 125, 140, 9, 98, 47, 128,
+        95, 110, 116, 146, 117, 58, 61, 66, 9, 98, 215, 145, 66, 9, 98, 215, 2, 67, 117, 23, 195, 167, 97, 111,
+        18, 101, 121, 8, 13, 108, 11, 80, 10, 143, 54, 179, 114, 100, 108, 155, 59, 77, 9, 239, 11, 65, 110, 100,
+        14, 114, 2, 92, 28, 0, 233, 108, 59, 111, 102, 141, 160, 191, 32, 76, 117, 99, 37, 77, 62, 114, 12, 48,
+        105, 145, 70, 179, 100, 6, 105, 254, 101, 205, 97, 29, 172, 118, 12, 141, 22, 114, 12, 48, 202, 131, 97, 33,
+        114, 96, 134, 2, 68, 127, 4, 62, 200, 136, 23, 4, 64, 93, 156, 29, 25, 84, 53, 107, 115, 45, 130, 67,
+        97, 62, 128, 184, 124, 67, 97, 62, 128, 125, 18, 97, 138, 84, 127, 59, 61, 80, 114, 252, 168, 101, 124, 80,
+        114, 252, 168, 41, 72, 134, 135, 134, 91, 255, 4, 105, 113, 117, 41, 70, 246, 114, 179, 6, 125, 250, 47, 13,
+        111, 117, 112, 41, 75, 127, 14, 11, 77, 97, 53, 42, 105, 178, 0, 36, 20, 105, 12, 248, 117, 120, 101, 109,
+        98, 53, 103, 18, 28, 111, 218, 198, 103, 101, 14, 103, 105, 3, 130, 100, 105, 101, 43, 198, 108, 155, 3, 43,
+        27, 119, 155, 125, 124, 83, 242, 104, 43, 27, 119, 155, 125, 180, 114, 1, 122, 179, 115, 60, 45, 80, 49, 121,
+        110, 48, 225, 235, 32, 206, 100, 41, 84, 114, 4, 105, 100, 47, 130, 84, 111, 98, 154, 111, 124, 84, 111, 98,
+        154, 30, 66, 114, 20, 101, 25, 70, 114, 1, 122, 179, 115, 60, 43, 198, 45, 130, 65, 110, 213, 107, 116, 19,
+        103, 101, 98, 105, 126, 229, 117, 254, 138, 82, 62, 30, 90, 121, 112, 151, 248, 156, 1, 12, 158, 28, 97, 22,
+        2, 71, 203, 37, 75, 29, 9, 180, 10, 107, 56, 125, 0, 86, 1, 117, 29, 117, 91, 12, 116, 3, 192, 114,
+        30, 66, 136, 28, 227, 79, 5, 116, 157, 14, 18, 119, 31, 105, 56, 64, 117, 119, 97, 42, 180, 105, 100, 94,
+        105, 125, 54, 101, 117, 107, 10, 176, 12, 202, 108, 196, 3, 26, 233, 23, 13, 181, 10, 246, 5, 4, 3, 115,
+        175, 65, 63, 12, 127, 105, 192, 101, 98, 105, 126, 41, 69, 108, 43, 10, 118, 47, 14, 140, 13, 194, 41, 68,
+        94, 156, 63, 25, 77, 97, 122, 176, 12, 26, 82, 117, 27, 2, 72, 97, 42, 25, 66, 53, 55, 25, 195, 132,
+        113, 117, 29, 14, 105, 10, 45, 92, 220, 149, 108, 98, 1, 202, 10, 127, 12, 125, 95, 114, 109, 3, 26, 76,
+        48, 169, 104, 30, 66, 13, 103, 26, 77, 49, 100, 209, 26, 92, 220, 97, 45, 66, 223, 143, 96, 190, 119, 38,
+        66, 104, 63, 160, 8, 119, 101, 194, 54, 105, 176, 6, 56, 41, 68, 246, 110, 101, 109, 9, 107, 0, 69, 5,
+        187, 68, 127, 4, 201, 175, 51, 18, 108, 196, 166, 101, 25, 67, 111, 5, 58, 82, 62, 200, 128, 110, 105, 3,
+        130, 72, 6, 122, 192, 196, 4, 183, 114, 111, 29, 26, 84, 111, 103, 30, 76, 126, 116, 187, 76, 42, 143, 222,
+        114, 105, 32, 76, 1, 107, 2, 71, 101, 14, 103, 26, 73, 114, 56, 18, 105, 6, 23, 32, 76, 101, 12, 229,
+        1, 28, 2, 84, 94, 101, 8, 175, 51, 180, 114, 1, 122, 179, 115, 60, 45, 92, 144, 1, 2, 206, 101, 4,
+        146, 116, 59, 65, 23, 98, 175, 69, 109, 105, 23, 116, 41, 195, 150, 5, 253, 101, 155, 95, 115, 6, 98, 190,
+        100, 94, 160, 6, 98, 37, 74, 14, 100, 38, 80, 185, 117, 103, 10, 249, 110, 103, 9, 110, 18, 198, 107, 14,
+        101, 2, 233, 187, 92, 29, 101, 109, 10, 183, 117, 98, 200, 117, 108, 103, 9, 26, 76, 156, 6, 37, 72, 12,
+        100, 117, 23, 115, 140, 3, 4, 0, 69, 148, 114, 101, 129, 10, 209, 25, 78, 14, 100, 107, 14, 101, 162, 62,
+        9, 154, 117, 2, 165, 105, 101, 8, 3, 56, 96, 47, 94, 22, 137, 38, 66, 123, 108, 47, 48, 8, 54, 101,
+        112, 10, 96, 20, 48, 202, 53, 4, 28, 249, 114, 117, 237, 144, 64, 203, 211, 94, 218, 121, 114, 202, 3, 192,
+        10, 64, 93, 103, 19, 137, 38, 207, 105, 195, 159, 114, 178, 115, 187, 92, 121, 1, 2, 76, 97, 128, 0, 82,
+        216, 246, 110, 26, 71, 238, 2, 85, 103, 27, 2, 206, 101, 4, 146, 116, 48, 135, 179, 110, 146, 114, 101, 155,
+        250, 220, 2, 69, 99, 117, 47, 14, 0, 207, 5, 151, 43, 136, 9, 145, 83, 136, 23, 119, 25, 71, 142, 20,
+        54, 101, 178, 101, 13, 27, 140, 53, 107, 4, 58, 70, 31, 226, 104, 147, 168, 112, 4, 11, 73, 116, 10, 26,
+        79, 109, 38, 80, 49, 11, 69, 108, 102, 3, 236, 4, 107, 170, 5, 41, 78, 14, 119, 192, 11, 77, 10, 144,
+        115, 37, 86, 105, 126, 110, 28, 180, 4, 110, 56, 64, 134, 111, 45, 66, 23, 122, 122, 97, 118, 147, 108, 41,
+        68, 101, 63, 94, 56, 158, 235, 160, 157, 98, 142, 119, 229, 9, 154, 117, 144, 0, 73, 23, 107, 91, 9, 111,
+        107, 107, 30, 85, 115, 236, 107, 137, 160, 8, 119, 176, 11, 80, 97, 33, 97, 45, 234, 117, 237, 220, 183, 28,
+        6, 20, 96, 53, 107, 109, 3, 137, 160, 112, 1, 26, 84, 104, 190, 56, 158, 101, 109, 11, 70, 114, 1, 107,
+        114, 101, 155, 0, 195, 133, 56, 125, 124, 65, 10, 27, 125, 64, 3, 37, 66, 169, 115, 119, 1, 129, 47, 154,
+        31, 107, 9, 249, 107, 23, 220, 18, 198, 45, 83, 215, 38, 90, 219, 212, 97, 102, 114, 201, 175, 51, 18, 127,
+        10, 37, 65, 102, 103, 238, 137, 38, 77, 121, 1, 109, 9, 124, 66, 93, 109, 218, 203, 37, 153, 147, 41, 84,
+        170, 114, 107, 101, 25, 80, 166, 137, 38, 77, 128, 203, 22, 54, 28, 156, 37, 86, 3, 101, 122, 117, 13, 162,
+        146, 6, 37, 84, 217, 1, 37, 195, 132, 103, 121, 112, 116, 11, 77, 97, 53, 126, 1, 26, 66, 49, 105, 118,
+        26, 195, 132, 116, 104, 105, 111, 112, 225, 49, 216, 98, 202, 198, 97, 102, 114, 22, 129, 10, 25, 65, 110, 103,
+        49, 162, 146, 6, 96, 94, 47, 181, 6, 117, 91, 134, 49, 101, 25, 73, 114, 38, 76, 156, 121, 222, 215, 38,
+        35, 100, 12, 48, 26, 70, 176, 6, 10, 32, 68, 137, 114, 62, 116, 96, 108, 97, 120, 99, 10, 129, 14, 13,
+        128, 95, 237, 31, 99, 10, 105, 219, 48, 199, 49, 157, 2, 81, 117, 6, 126, 9, 30, 72, 105, 100, 10, 103,
+        30, 77, 101, 120, 62, 111, 205, 29, 41, 84, 142, 31, 99, 30, 78, 144, 9, 42, 250, 1, 97, 106, 117, 29,
+        226, 243, 7, 2, 89, 117, 99, 29, 38, 81, 117, 163, 1, 58, 82, 111, 111, 18, 4, 10, 111, 2, 67, 28,
+        112, 101, 8, 41, 77, 155, 111, 208, 160, 1, 32, 76, 117, 19, 204, 169, 128, 25, 92, 253, 6, 30, 78, 243,
+        118, 138, 76, 101, 12, 140, 97, 106, 232, 10, 105, 102, 14, 110, 37, 206, 208, 114, 117, 122, 0, 153, 105, 235,
+        31, 140, 97, 106, 232, 10, 105, 102, 14, 110, 105, 97, 43, 53, 0, 90, 208, 29, 101, 99, 31, 158, 10, 19,
+        99, 30, 84, 28, 143, 108, 168, 227, 79, 97, 120, 208, 2, 68, 53, 123, 30, 67, 111, 136, 117, 147, 218, 12,
+        14, 2, 153, 105, 104, 117, 136, 117, 2, 165, 179, 110, 56, 18, 143, 100, 105, 45, 65, 23, 98, 225, 134, 111,
+        45, 75, 4, 115, 104, 31, 149, 108, 103, 6, 225, 31, 189, 5, 38, 65, 114, 103, 219, 4, 26, 68, 28, 1,
+        130, 68, 105, 117, 0, 68, 47, 23, 130, 78, 154, 9, 32, 72, 97, 118, 13, 25, 153, 27, 146, 9, 104, 95,
+        110, 100, 28, 1, 3, 45, 61, 78, 22, 111, 98, 9, 11, 76, 166, 115, 104, 47, 119, 101, 101, 112, 0, 68,
+        13, 104, 25, 77, 192, 104, 10, 144, 162, 154, 10, 27, 91, 1, 105, 33, 114, 96, 114, 105, 33, 114, 129, 194,
+        14, 28, 18, 22, 107, 157, 181, 20, 106, 142, 171, 9, 121, 1, 149, 114, 20, 189, 10, 204, 244, 95, 115, 115,
+        28, 140, 105, 104, 9, 249, 116, 213, 166, 104, 27, 0, 71, 111, 183, 6, 10, 2, 84, 28, 147, 32, 78, 47,
+        117, 171, 157, 189, 10, 204, 244, 158, 28, 109, 117, 130, 75, 31, 8, 109, 93, 0, 153, 104, 29, 116, 19, 103,
+        9, 104, 158, 104, 9, 107, 104, 27, 64, 9, 110, 29, 166, 251, 97, 106, 15, 104, 38, 79, 100, 19, 104, 145,
+        79, 114, 223, 2, 92, 106, 9, 29, 0, 207, 5, 98, 3, 103, 10, 11, 77, 47, 104, 121, 58, 80, 244, 96,
+        13, 123, 1, 149, 110, 100, 104, 23, 204, 244, 91, 136, 9, 31, 104, 116, 114, 2, 85, 116, 213, 204, 244, 181,
+        215, 117, 8, 253, 121, 54, 177, 43, 242, 193, 87, 10, 48, 95, 214, 212, 239, 32, 67, 235, 42, 10, 247, 121,
+        158, 6, 118, 19, 228, 144, 247, 121, 54, 185, 104, 151, 247, 121, 18, 242, 193, 65, 214, 212, 37, 84, 31, 109,
+        1, 26, 86, 62, 116, 14, 37, 207, 5, 151, 32, 65, 214, 212, 37, 81, 243, 3, 115, 187, 68, 137, 148, 138,
+        70, 176, 6, 10, 18, 6, 103, 168, 41, 65, 108, 154, 111, 227, 82, 105, 138, 100, 59, 74, 1, 101, 93, 30,
+        69, 115, 112, 93, 42, 111, 43, 1, 116, 30, 82, 105, 138, 165, 27, 59, 100, 138, 78, 185, 229, 9, 97, 156,
+        218, 1, 116, 232, 29, 9, 4, 2, 80, 151, 203, 117, 99, 30, 65, 109, 235, 195, 161, 199, 101, 9, 149, 99,
+        114, 229, 9, 1, 251, 14, 97, 157, 251, 12, 100, 12, 37, 83, 97, 138, 80, 143, 108, 226, 105, 143, 25, 84,
+        111, 99, 1, 116, 4, 115, 0, 82, 105, 138, 165, 27, 59, 100, 111, 43, 117, 108, 91, 9, 1, 104, 97, 30,
+        71, 111, 105, 31, 91, 29, 138, 165, 128, 115, 138, 100, 111, 43, 117, 108, 140, 136, 37, 77, 4, 31, 32, 71,
+        6, 97, 19, 91, 29, 138, 165, 128, 115, 226, 9, 149, 109, 97, 122, 12, 227, 68, 137, 114, 62, 116, 32, 111,
+        102, 32, 67, 49, 216, 98, 37, 82, 104, 211, 59, 233, 187, 68, 13, 209, 9, 41, 67, 12, 110, 101, 99, 116,
+        62, 63, 54, 177, 32, 74, 6, 115, 101, 121, 54, 177, 32, 72, 28, 112, 115, 104, 93, 41, 206, 109, 12, 116,
+        91, 31, 115, 189, 178, 126, 116, 115, 171, 209, 190, 25, 77, 9, 121, 187, 207, 5, 32, 86, 93, 103, 4, 37,
+        83, 242, 193, 67, 9, 49, 4, 129, 97, 4, 41, 35, 100, 239, 183, 219, 117, 99, 107, 121, 96, 3, 110, 48,
+        115, 101, 41, 86, 93, 103, 4, 37, 79, 104, 105, 226, 3, 110, 115, 121, 108, 118, 1, 37, 77, 223, 223, 168,
+        112, 25, 76, 111, 117, 19, 239, 149, 108, 142, 28, 149, 114, 107, 217, 31, 54, 185, 193, 67, 9, 49, 4, 162,
+        177, 32, 89, 14, 107, 0, 73, 196, 2, 73, 108, 108, 4, 111, 19, 0, 71, 101, 14, 103, 37, 87, 19, 99,
+        12, 115, 4, 180, 108, 14, 105, 100, 129, 223, 111, 53, 25, 79, 107, 108, 136, 127, 162, 185, 193, 68, 166, 169,
+        2, 87, 31, 104, 131, 116, 12, 18, 242, 193, 68, 166, 169, 162, 101, 98, 23, 52, 183, 217, 227, 73, 100, 136,
+        30, 85, 116, 136, 91, 4, 110, 48, 169, 129, 155, 146, 38, 87, 121, 127, 131, 0, 79, 114, 192, 12, 199, 49,
+        14, 47, 30, 234, 118, 47, 149, 114, 194, 12, 162, 177, 141, 101, 120, 62, 30, 77, 12, 116, 1, 183, 10, 105,
+        102, 14, 110, 26, 84, 101, 120, 31, 95, 108, 31, 107, 200, 148, 19, 193, 67, 49, 216, 98, 37, 65, 108, 98,
+        254, 2, 79, 110, 213, 105, 30, 81, 243, 236, 99, 18, 31, 107, 29, 8, 177, 38, 77, 1, 42, 111, 98, 162,
+        177, 102, 111, 55, 56, 54, 177, 228, 114, 20, 115, 119, 62, 107, 54, 139, 97, 43, 99, 169, 37, 80, 114, 252,
+        59, 69, 100, 119, 9, 100, 231, 0, 89, 117, 107, 12, 54, 185, 104, 119, 101, 5, 247, 105, 48, 54, 20, 97,
+        118, 63, 0, 35, 100, 26, 65, 214, 212, 26, 66, 23, 115, 147, 26, 85, 83, 65, 124, 206, 101, 4, 146, 116,
+        101, 205, 97, 29, 172, 118, 12, 32, 65, 210, 22, 145, 65, 210, 22, 129, 101, 120, 22, 30, 77, 111, 52, 143,
+        18, 191, 204, 126, 6, 115, 98, 53, 103, 64, 10, 4, 131, 173, 24, 35, 237, 94, 126, 105, 172, 51, 95, 100,
+        121, 103, 101, 58, 51, 54, 14, 100, 128, 115, 126, 105, 3, 45, 65, 108, 1, 240, 40, 62, 64, 142, 9, 100,
+        4, 111, 45, 66, 10, 107, 9, 225, 9, 29, 94, 190, 45, 84, 94, 6, 107, 48, 115, 105, 172, 51, 96, 94,
+        126, 94, 3, 175, 51, 0, 51, 174, 94, 117, 119, 31, 8, 26, 73, 118, 1, 139, 111, 24, 76, 168, 126, 152,
+        79, 114, 106, 49, 24, 84, 117, 108, 97, 24, 66, 13, 103, 14, 211, 24, 86, 108, 47, 157, 93, 224, 53, 152,
+        75, 10, 117, 103, 2, 84, 203, 139, 24, 66, 114, 106, 1, 52, 0, 17, 32, 74, 9, 128, 108, 209, 108, 0,
+        82, 121, 97, 122, 1, 24, 65, 5, 23, 107, 238, 24, 17, 141, 111, 52, 143, 18, 109, 49, 3, 152, 51, 32,
+        68, 154, 101, 5, 38, 86, 14, 12, 101, 122, 104, 24, 78, 139, 103, 14, 211, 24, 80, 52, 139, 224, 111, 5,
+        114, 127, 97, 21, 18, 116, 209, 114, 111, 112, 49, 64, 23, 115, 110, 211, 9, 197, 75, 10, 109, 121, 107, 240,
+        51, 0, 17, 174, 119, 6, 248, 3, 131, 173, 24, 82, 111, 5, 139, 24, 86, 49, 103, 111, 103, 173, 24, 86,
+        49, 111, 103, 100, 129, 53, 109, 1, 152, 51, 135, 9, 13, 26, 78, 3, 122, 11, 51, 135, 127, 25, 65, 114,
+        8, 123, 13, 152, 77, 14, 100, 139, 240, 40, 62, 54, 194, 104, 110, 121, 32, 78, 139, 103, 14, 211, 24, 80,
+        3, 122, 97, 224, 93, 139, 24, 51, 141, 9, 105, 32, 69, 108, 0, 79, 114, 3, 98, 53, 103, 24, 85, 108,
+        106, 1, 196, 52, 181, 6, 109, 197, 51, 228, 31, 8, 107, 185, 111, 5, 38, 51, 32, 85, 100, 109, 53, 116,
+        26, 51, 174, 29, 9, 5, 160, 28, 9, 97, 21, 18, 9, 29, 139, 24, 74, 28, 10, 45, 78, 3, 122, 11,
+        75, 238, 116, 121, 45, 77, 217, 25, 17, 43, 119, 6, 100, 108, 196, 52, 96, 121, 216, 3, 224, 53, 103, 38,
+        153, 13, 121, 142, 4, 152, 66, 53, 106, 29, 105, 172, 51, 0, 90, 142, 144, 107, 10, 52, 121, 197, 73, 114,
+        107, 63, 152, 78, 139, 128, 156, 93, 152, 84, 127, 152, 79, 109, 152, 153, 166, 31, 115, 105, 172, 51, 64, 101,
+        210, 196, 30, 65, 108, 116, 190, 32, 51, 95, 108, 116, 190, 197, 84, 117, 118, 58, 51, 64, 23, 115, 110, 111,
+        121, 9, 52, 197, 77, 154, 47, 1, 24, 84, 94, 117, 107, 169, 107, 58, 79, 107, 114, 117, 103, 64, 28, 8,
+        29, 107, 58, 75, 23, 105, 18, 189, 10, 4, 24, 80, 114, 157, 14, 52, 121, 197, 74, 198, 60, 172, 65, 63,
+        12, 127, 3, 224, 104, 142, 9, 139, 52, 197, 65, 109, 53, 24, 51, 43, 189, 145, 89, 166, 63, 240, 40, 62,
+        64, 1, 47, 251, 178, 115, 56, 18, 104, 123, 104, 97, 25, 84, 239, 106, 4, 181, 101, 107, 131, 171, 97, 4,
+        38, 78, 131, 120, 240, 72, 117, 25, 153, 134, 113, 131, 0, 90, 104, 101, 106, 241, 158, 241, 115, 117, 180, 117,
+        106, 105, 38, 65, 110, 104, 117, 25, 76, 105, 97, 12, 131, 18, 104, 27, 134, 18, 238, 120, 25, 74, 241, 120,
+        25, 72, 3, 38, 92, 194, 104, 111, 117, 250, 123, 100, 134, 171, 117, 236, 25, 74, 147, 4, 171, 101, 236, 105,
+        18, 104, 97, 1, 120, 25, 234, 105, 141, 134, 49, 124, 35, 110, 6, 141, 134, 49, 37, 72, 101, 147, 134, 106,
+        241, 171, 20, 38, 92, 123, 120, 105, 32, 90, 104, 117, 123, 18, 155, 117, 38, 89, 20, 110, 38, 88, 194, 123,
+        124, 84, 156, 126, 0, 71, 217, 117, 0, 81, 131, 104, 97, 25, 88, 4, 106, 241, 32, 85, 146, 53, 11, 153,
+        4, 2, 85, 110, 42, 176, 205, 29, 48, 141, 4, 14, 32, 79, 63, 108, 121, 131, 32, 233, 56, 115, 199, 108,
+        168, 112, 254, 12, 231, 95, 110, 213, 107, 116, 19, 0, 35, 116, 151, 29, 105, 12, 10, 124, 87, 13, 116, 119,
+        101, 42, 124, 69, 114, 100, 41,
+};
+
+static const unsigned char TERRITORY_NAMES_PAIRS_DE[256][2] = {
+        {0, 0}, {97, 110}, {97, 0}, {101, 110}, {105, 110}, {115, 116}, {101, 114}, {98, 108}, {99, 104}, {97, 114}, {97, 108}, {3, 0},
+        {111, 110}, {101, 108}, {111, 114}, {97, 5}, {7, 15}, {79, 16}, {0, 83}, {105, 115}, {117, 110}, {32, 17}, {105, 107}, {114, 97},
+        {21, 0}, {105, 0}, {105, 11}, {1, 100}, {97, 109}, {97, 116}, {111, 0}, {97, 115}, {32, 32}, {112, 117}, {115, 13}, {73, 110},
+        {82, 101}, {105, 2}, {1, 0}, {33, 7}, {36, 39}, {101, 0}, {105, 116}, {32, 83}, {44, 44}, {45, 45}, {46, 46}, {97, 100},
+        {101, 115}, {111, 108}, {34, 110}, {40, 22}, {115, 107}, {117, 114}, {0, 78}, {20, 100}, {108, 27}, {45, 35}, {97, 32}, {101, 32},
+        {19, 8}, {55, 32}, {105, 99}, {117, 116}, {0, 75}, {65, 65}, {66, 66}, {67, 67}, {68, 68}, {69, 69}, {70, 70}, {71, 71},
+        {72, 72}, {73, 73}, {74, 74}, {75, 75}, {76, 76}, {77, 77}, {78, 78}, {79, 79}, {80, 80}, {81, 81}, {82, 82}, {83, 83},
+        {84, 84}, {85, 85}, {86, 86}, {87, 87}, {88, 88}, {89, 89}, {90, 90}, {0, 77}, {71, 117}, {105, 114}, {115, 8}, {0, 65},
+        {0, 84}, {97, 97}, {98, 98}, {99, 99}, {100, 100}, {101, 101}, {102, 102}, {103, 103}, {104, 104}, {105, 105}, {106, 106}, {107, 107},
+        {108, 108}, {109, 109}, {110, 110}, {111, 111}, {112, 112}, {113, 113}, {114, 114}, {115, 115}, {116, 116}, {117, 117}, {118, 118}, {119, 119},
+        {120, 120}, {121, 121}, {122, 122}, {1, 103}, {124, 124}, {57, 50}, {101, 116}, {111, 109}, {111, 115}, {2, 77}, {32, 61}, {4, 103},
+        {132, 132}, {133, 133}, {12, 103}, {32, 75}, {97, 104}, {105, 5}, {111, 32}, {111, 118}, {0, 66}, {32, 77}, {97, 98}, {97, 117},
+        {97, 121}, {97, 124}, {105, 103}, {105, 108}, {114, 42}, {2, 65}, {150, 150}, {6, 110}, {52, 24}, {67, 104}, {97, 103}, {105, 8},
+        {105, 98}, {105, 109}, {0, 74}, {159, 159}, {1, 18}, {161, 161}, {2, 78}, {4, 116}, {164, 164}, {71, 114}, {97, 107}, {167, 167},
+        {105, 112}, {111, 116}, {195, 188}, {0, 72}, {3, 32}, {23, 100}, {32, 84}, {60, 59}, {101, 100}, {101, 119}, {117, 115}, {195, 182},
+        {0, 70}, {0, 80}, {182, 182}, {2, 75}, {4, 50}, {14, 116}, {23, 25}, {56, 0}, {188, 188}, {97, 8}, {97, 105}, {97, 163},
+        {101, 103}, {104, 32}, {105, 122}, {195, 195}, {111, 119}, {135, 186}, {170, 100}, {0, 67}, {2, 66}, {22, 1}, {26, 83}, {28, 98},
+        {32, 80}, {43, 116}, {86, 6}, {87, 101}, {97, 99}, {97, 119}, {109, 6}, {111, 100}, {114, 10}, {116, 9}, {117, 5}, {117, 100},
+        {117, 109}, {1, 115}, {2, 83}, {3, 116}, {4, 101}, {6, 148}, {11, 83}, {19, 115}, {24, 75}, {26, 75}, {30, 80}, {31, 0},
+        {32, 66}, {41, 80}, {48, 104}, {57, 34}, {58, 67}, {73, 115}, {78, 101}, {97, 112}, {98, 101}, {103, 117}, {104, 1}, {105, 1},
+        {105, 58}, {105, 123}, {111, 63}, {117, 101}, {173, 230}, {174, 221}, {195, 164}, {245, 14}, {0, 76}, {0, 85}, {0, 92}, {2, 82},
+        {4, 99}, {6, 114}, {6, 116}, {9, 116},
+};
+
+static const unsigned short TERRITORY_NAME_ALTERNATIVES_START_DE[_TERRITORY_MAX - _TERRITORY_MIN] = {
+        0, 2, 3, 4, 5, 7, 8, 9, 10, 11, 12, 13, 15, 16, 17, 18,
+        19, 20, 21, 22, 23, 24, 25, 27, 29, 30, 31, 32, 34, 35, 37, 38,
+        40, 41, 44, 45, 48, 49, 50, 52, 53, 55, 57, 59, 60, 62, 63, 64,
+        65, 66, 67, 68, 69, 70, 72, 73, 74, 75, 76, 77, 79, 81, 82, 83,
+        84, 85, 86, 87, 88, 89, 90, 92, 93, 94, 96, 97, 98, 99, 100, 101,
+        102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117,
+        118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132, 133,
+        134, 135, 136, 137, 138, 139, 140, 141, 142, 143, 144, 145, 146, 147, 148, 149,
+        150, 151, 152, 153, 154, 155, 156, 157, 158, 159, 160, 161, 162, 163, 164, 165,
+        166, 167, 168, 169, 170, 171, 172, 173, 174, 175, 176, 177, 178, 179, 180, 181,
+        182, 183, 184, 185, 186, 187, 188, 189, 190, 191, 193, 194, 195, 196, 197, 198,
+        199, 200, 201, 202, 203, 204, 205, 206, 207, 208, 209, 210, 211, 212, 213, 214,
+        215, 216, 217, 218, 219, 220, 221, 223, 224, 225, 226, 227, 228, 229, 230, 231,
+        233, 234, 235, 236, 237, 238, 239, 240, 241, 242, 243, 244, 245, 246, 247, 248,
+        249, 250, 251, 252, 253, 254, 255, 256, 257, 258, 259, 260, 261, 262, 263, 264,
+        265, 266, 267, 268, 269, 270, 271, 272, 273, 274, 275, 276, 277, 278, 279, 280,
+        281, 282, 283, 284, 285, 286, 287, 288, 289, 290, 291, 292, 293, 294, 295, 296,
+        297, 298, 299, 300, 301, 302, 303, 304, 305, 306, 307, 308, 309, 310, 311, 312,
+        313, 314, 315, 316, 317, 318, 319, 320, 321, 322, 323, 325, 326, 327, 328, 329,
+        330, 331, 332, 333, 334, 335, 336, 337, 338, 339, 340, 341, 342, 343, 344, 345,
+        346, 347, 348, 349, 350, 351, 352, 353, 354, 355, 356, 357, 358, 359, 360, 361,
+        362, 363, 364, 365, 366, 367, 368, 369, 370, 371, 372, 373, 374, 375, 376, 377,
+        378, 379, 380, 381, 382, 383, 384, 385, 386, 387, 388, 389, 390, 391, 392, 393,
+        394, 395, 396, 397, 398, 399, 400, 401, 402, 403, 404, 405, 406, 407, 408, 409,
+        410, 411, 412, 413, 414, 415, 416, 417, 418, 419, 420, 421, 422, 423, 424, 425,
+        426, 427, 428, 429, 430, 431, 432, 433, 434, 435, 436, 439, 440, 441, 442, 443,
+        444, 445, 446, 447, 448, 449, 450, 451, 452, 453, 454, 455, 456, 457, 458, 459,
+        460, 461, 462, 463, 464, 465, 466, 467, 468, 469, 470, 471, 472, 473, 474, 475,
+        476, 477, 478, 479, 480, 481, 482, 483, 484, 485, 486, 487, 488, 489, 490, 491,
+        492, 493, 494, 495, 496, 497, 498, 499, 500, 501, 502, 503, 504, 505, 506, 507,
+        508, 509, 510, 511, 512, 513, 514, 515, 516, 517, 518, 519, 520, 521, 522, 524,
+        525, 526, 527, 528, 529, 530, 531, 532, 533, 534, 535, 536, 537, 538, 539, 540,
+        541, 542, 543, 544, 545, 546, 547, 549, 550, 551, 552, 553, 554, 556, 557, 558,
+        559, 560, 561, 562, 563, 566,
+};
+
+static const TerritoryNameAlternative TERRITORY_NAME_ALTERNATIVES_DE[566] = {
+        {0, 12, 0}, {13, 14, 0}, {28, 6, 0}, {35, 9, 0}, {45, 7, 0}, {53, 11, 0}, {65, 13, 0}, {79, 19, 0},
+        {99, 5, 0}, {105, 6, 0}, {112, 5, 0}, {118, 12, 0}, {131, 12, 0}, {144, 12, 0}, {157, 12, 0}, {170, 14, 0},
+        {185, 12, 0}, {198, 7, 0}, {206, 41, 0}, {248, 10, 0}, {259, 8, 0}, {268, 8, 0}, {277, 10, 0}, {288, 6, 0},
+        {295, 15, 0}, {311, 17, 0}, {329, 6, 0}, {336, 24, 0}, {361, 24, 0}, {386, 13, 0}, {400, 5, 0}, {406, 15, 0},
+        {422, 18, 0}, {441, 19, 0}, {461, 10, 0}, {472, 25, 0}, {498, 8, 0}, {507, 4, 0}, {512, 21, 0}, {534, 5, 0},
+        {540, 13, 0}, {554, 31, 0}, {586, 4, 0}, {591, 12, 0}, {604, 9, 0}, {614, 44, 0}, {659, 19, 0}, {679, 16, 0},
+        {696, 5, 0}, {702, 7, 0}, {710, 28, 0}, {739, 18, 0}, {758, 7, 0}, {766, 11, 0}, {778, 9, 0}, {788, 32, 0},
+        {821, 10, 0}, {832, 26, 0}, {859, 15, 0}, {875, 8, 0}, {884, 19, 0}, {904, 7, 0}, {912, 8, 0}, {921, 10, 0},
+        {932, 5, 0}, {938, 19, 0}, {958, 7, 0}, {966, 4, 0}, {971, 11, 0}, {983, 11, 0}, {995, 10, 0}, {1006, 35, 0},
+        {1042, 8, 0}, {1051, 5, 0}, {1057, 8, 0}, {1066, 7, 0}, {1074, 8, 0}, {1083, 23, 0}, {1107, 13, 0}, {1121, 21, 0},
+        {1143, 8, 0}, {1152, 9, 0}, {1162, 10, 0}, {1173, 15, 0}, {1189, 10, 0}, {1200, 7, 0}, {1208, 9, 0}, {1218, 7, 0},
+        {1226, 9, 0}, {1236, 5, 0}, {1242, 47, 0}, {1290, 21, 0}, {1312, 23, 0}, {1336, 9, 0}, {1346, 19, 0}, {1366, 6, 0},
+        {1373, 6, 0}, {1380, 39, 0}, {1420, 11, 0}, {1432, 6, 0}, {1439, 7, 0}, {1447, 7, 0}, {1455, 6, 0}, {1462, 5, 0},
+        {1468, 15, 0}, {1484, 7, 0}, {1492, 10, 0}, {1503, 7, 0}, {1511, 8, 0}, {1520, 9, 0}, {1530, 6, 0}, {1537, 14, 0},
+        {1552, 13, 0}, {1566, 9, 0}, {1576, 6, 0}, {1583, 34, 0}, {1618, 11, 0}, {1630, 6, 0}, {1637, 9, 0}, {1647, 10, 0},
+        {1658, 6, 0}, {1665, 5, 0}, {1671, 7, 0}, {1679, 18, 0}, {1698, 8, 0}, {1707, 14, 0}, {1722, 8, 0}, {1731, 7, 0},
+        {1739, 7, 0}, {1747, 9, 0}, {1757, 13, 0}, {1771, 6, 0}, {1778, 6, 0}, {1785, 7, 0}, {1793, 11, 0}, {1805, 9, 0},
+        {1815, 7, 0}, {1823, 23, 0}, {1847, 8, 0}, {1856, 10, 0}, {1867, 23, 0}, {1891, 8, 0}, {1900, 4, 0}, {1905, 8, 0},
+        {1914, 7, 0}, {1922, 9, 0}, {1932, 8, 0}, {1941, 6, 0}, {1948, 12, 0}, {1961, 6, 0}, {1968, 21, 0}, {1990, 20, 0},
+        {2011, 28, 0}, {2040, 11, 0}, {2052, 13, 0}, {2066, 6, 0}, {2073, 6, 0}, {2080, 8, 0}, {2089, 6, 0}, {2096, 9, 0},
+        {2106, 6, 0}, {2113, 9, 0}, {2123, 4, 0}, {2128, 9, 0}, {2138, 7, 0}, {2146, 8, 0}, {2155, 5, 0}, {2161, 7, 0},
+        {2169, 6, 0}, {2176, 9, 0}, {2186, 9, 0}, {2196, 12, 0}, {2209, 13, 0}, {2223, 11, 0}, {2235, 5, 0}, {2241, 8, 0},
+        {2250, 7, 0}, {2258, 7, 0}, {2266, 10, 0}, {2277, 6, 0}, {2284, 7, 0}, {2292, 11, 0}, {2304, 13, 0}, {2318, 6, 0},
+        {2325, 4, 0}, {2330, 9, 0}, {2340, 5, 0}, {2346, 6, 0}, {2353, 23, 0}, {2377, 6, 0}, {2384, 7, 0}, {2392, 14, 0},
+        {2407, 7, 0}, {2415, 5, 0}, {2421, 10, 0}, {2432, 12, 0}, {2445, 11, 0}, {2457, 7, 0}, {2465, 4, 0}, {2470, 5, 0},
+        {2476, 15, 0}, {2492, 8, 0}, {2501, 8, 0}, {2510, 7, 0}, {2518, 8, 0}, {2527, 17, 0}, {2545, 11, 0}, {2557, 5, 0},
+        {2563, 8, 0}, {2572, 8, 0}, {2581, 4, 0}, {2586, 7, 0}, {2594, 10, 0}, {2605, 8, 0}, {2614, 15, 0}, {2630, 7, 0},
+        {2638, 12, 0}, {2651, 7, 0}, {2659, 8, 0}, {2668, 5, 0}, {2674, 10, 0}, {2685, 13, 0}, {2699, 13, 0}, {2713, 5, 0},
+        {2719, 8, 0}, {2728, 10, 0}, {2739, 7, 0}, {2747, 10, 0}, {2758, 28, 0}, {2787, 7, 0}, {2795, 11, 0}, {2807, 7, 0},
+        {2815, 5, 0}, {2821, 6, 0}, {2828, 5, 0}, {2834, 7, 0}, {2842, 8, 0}, {2851, 8, 0}, {2860, 7, 0}, {2868, 9, 0},
+        {2878, 7, 0}, {2886, 8, 0}, {2895, 8, 0}, {2904, 11, 0}, {2916, 8, 0}, {2925, 10, 0}, {2936, 9, 0}, {2946, 10, 0},
+        {2957, 4, 0}, {2962, 6, 0}, {2969, 5, 0}, {2975, 6, 0}, {2982, 4, 0}, {2987, 8, 0}, {2996, 4, 0}, {3001, 6, 0},
+        {3008, 5, 0}, {3014, 10, 0}, {3025, 16, 0}, {3042, 8, 0}, {3051, 7, 0}, {3059, 14, 0}, {3074, 6, 0}, {3081, 9, 0},
+        {3091, 7, 0}, {3099, 12, 0}, {3112, 7, 0}, {3120, 7, 0}, {3128, 10, 0}, {3139, 6, 0}, {3146, 7, 0}, {3154, 12, 0},
+        {3167, 7, 0}, {3175, 8, 0}, {3184, 9, 0}, {3194, 15, 0}, {3210, 8, 0}, {3219, 10, 0}, {3230, 15, 0}, {3246, 8, 0},
+        {3255, 7, 0}, {3263, 19, 0}, {3283, 9, 0}, {3293, 7, 0}, {3301, 10, 0}, {3312, 6, 0}, {3319, 7, 0}, {3327, 8, 0},
+        {3336, 6, 0}, {3343, 9, 0}, {3353, 9, 0}, {3363, 13, 0}, {3377, 14, 0}, {3392, 8, 0}, {3401, 10, 0}, {3412, 11, 0},
+        {3424, 13, 0}, {3438, 22, 0}, {3461, 10, 0}, {3472, 23, 0}, {3496, 11, 0}, {3508, 5, 0}, {3514, 9, 0}, {3524, 8, 0},
+        {3533, 7, 0}, {3541, 7, 0}, {3549, 7, 0}, {3557, 6, 0}, {3564, 6, 0}, {3571, 7, 0}, {3579, 17, 0}, {3597, 5, 0},
+        {3603, 5, 0}, {3609, 11, 0}, {3621, 3, 0}, {3625, 6, 0}, {3632, 10, 0}, {3643, 16, 0}, {3660, 18, 0}, {3679, 12, 0},
+        {3692, 9, 0}, {3702, 9, 0}, {3712, 9, 0}, {3722, 6, 0}, {3729, 6, 0}, {3736, 7, 0}, {3744, 12, 0}, {3757, 14, 0},
+        {3772, 9, 0}, {3782, 14, 0}, {3797, 11, 0}, {3809, 13, 0}, {3823, 10, 0}, {3834, 15, 0}, {3850, 28, 0}, {3879, 20, 0},
+        {3900, 18, 0}, {3919, 15, 0}, {3935, 9, 0}, {3945, 8, 0}, {3954, 17, 0}, {3972, 10, 0}, {3983, 16, 0}, {4000, 7, 0},
+        {4008, 7, 0}, {4016, 14, 0}, {4031, 14, 0}, {4046, 19, 0}, {4066, 7, 0}, {4074, 14, 0}, {4089, 10, 0}, {4100, 6, 0},
+        {4107, 5, 0}, {4113, 4, 0}, {4118, 6, 0}, {4125, 7, 0}, {4133, 8, 0}, {4142, 9, 0}, {4152, 5, 0}, {4158, 9, 0},
+        {4168, 17, 0}, {4186, 8, 0}, {4195, 5, 0}, {4201, 18, 0}, {4220, 5, 0}, {4226, 12, 0}, {4239, 11, 0}, {4251, 4, 0},
+        {4256, 8, 0}, {4265, 20, 0}, {4286, 12, 0}, {4299, 8, 0}, {4308, 11, 0}, {4320, 10, 0}, {4331, 13, 0}, {4345, 7, 0},
+        {4353, 13, 0}, {4367, 6, 0}, {4374, 8, 0}, {4383, 13, 0}, {4397, 14, 0}, {4412, 5, 0}, {4418, 7, 0}, {4426, 8, 0},
+        {4435, 9, 0}, {4445, 8, 0}, {4454, 4, 0}, {4459, 12, 0}, {4472, 11, 0}, {4484, 9, 0}, {4494, 7, 0}, {4502, 8, 0},
+        {4511, 14, 0}, {4526, 8, 0}, {4535, 4, 0}, {4540, 8, 0}, {4549, 7, 0}, {4557, 9, 0}, {4567, 7, 0}, {4575, 8, 0},
+        {4584, 8, 0}, {4593, 12, 0}, {4606, 10, 0}, {4617, 12, 0}, {4630, 8, 0}, {4639, 6, 0}, {4646, 5, 0}, {4652, 4, 0},
+        {4657, 9, 0}, {4667, 8, 0}, {4676, 7, 0}, {4684, 6, 0}, {4691, 8, 0}, {4700, 6, 0}, {4707, 7, 0}, {4715, 10, 0},
+        {4726, 7, 0}, {4734, 11, 0}, {4746, 5, 0}, {4752, 6, 0}, {4759, 16, 0}, {4776, 7, 0}, {4784, 7, 0}, {4792, 6, 0},
+        {4799, 12, 0}, {4812, 8, 0}, {4821, 12, 0}, {4834, 13, 0}, {4848, 11, 0}, {4860, 19, 0}, {4880, 5, 0}, {4886, 21, 0},
+        {4908, 7, 0}, {4916, 6, 0}, {4923, 10, 0}, {4934, 9, 0}, {4944, 3, 0}, {4948, 30, 0}, {4979, 7, 0}, {4987, 6, 0},
+        {4994, 6, 0}, {5001, 16, 0}, {5018, 18, 0}, {5037, 21, 0}, {5059, 15, 0}, {5075, 28, 0}, {5104, 19, 0}, {5124, 33, 0},
+        {5158, 25, 0}, {5184, 22, 0}, {5207, 14, 0}, {5222, 14, 0}, {5237, 12, 0}, {5250, 11, 0}, {5262, 15, 0}, {5278, 15, 0},
+        {5294, 12, 0}, {5307, 6, 0}, {5314, 13, 0}, {5328, 7, 0}, {5336, 16, 0}, {5353, 13, 0}, {5367, 16, 0}, {5384, 13, 0},
+        {5398, 15, 0}, {5414, 17, 0}, {5432, 15, 0}, {5448, 15, 0}, {5464, 12, 0}, {5477, 15, 0}, {5493, 9, 0}, {5503, 14, 0},
+        {5518, 17, 0}, {5536, 11, 0}, {5548, 16, 0}, {5565, 13, 0}, {5579, 16, 0}, {5596, 7, 0}, {5604, 15, 0}, {5620, 17, 0},
+        {5638, 6, 0}, {5645, 13, 0}, {5659, 18, 0}, {5678, 17, 0}, {5696, 22, 0}, {5719, 12, 0}, {5732, 12, 0}, {5745, 16, 0},
+        {5762, 15, 0}, {5778, 9, 0}, {5788, 9, 0}, {5798, 23, 0}, {5822, 18, 0}, {5841, 18, 0}, {5860, 13, 0}, {5874, 14, 0},
+        {5889, 12, 0}, {5902, 12, 0}, {5915, 17, 0}, {5933, 13, 0}, {5947, 6, 0}, {5954, 18, 0}, {5973, 18, 0}, {5992, 16, 0},
+        {6009, 14, 0}, {6024, 18, 0}, {6043, 12, 0}, {6056, 11, 0}, {6068, 19, 0}, {6088, 8, 0}, {6097, 14, 0}, {6112, 10, 0},
+        {6123, 13, 0}, {6137, 16, 0}, {6154, 14, 0}, {6169, 16, 0}, {6186, 14, 0}, {6201, 15, 0}, {6217, 14, 0}, {6232, 27, 0},
+        {6260, 15, 0}, {6276, 11, 0}, {6288, 14, 0}, {6303, 16, 0}, {6320, 6, 0}, {6327, 8, 0}, {6336, 8, 0}, {6345, 7, 0},
+        {6353, 6, 0}, {6360, 6, 0}, {6367, 11, 0}, {6379, 9, 0}, {6389, 8, 0}, {6398, 7, 0}, {6406, 6, 0}, {6413, 5, 0},
+        {6419, 8, 0}, {6428, 8, 0}, {6437, 6, 0}, {6444, 7, 0}, {6452, 5, 0}, {6458, 7, 0}, {6466, 9, 0}, {6476, 5, 0},
+        {6482, 5, 0}, {6488, 5, 0}, {6494, 7, 0}, {6502, 10, 0}, {6513, 14, 0}, {6528, 12, 0}, {6541, 5, 0}, {6547, 14, 0},
+        {6562, 7, 0}, {6570, 6, 0}, {6577, 6, 0}, {6584, 5, 0}, {6590, 5, 0}, {6596, 7, 0}, {6604, 16, 0}, {6621, 5, 0},
+        {6627, 36, 0}, {6664, 16, 0}, {6681, 9, 0}, {6691, 13, 0}, {6705, 8, 0}, {6714, 4, 0},
+};
+
+static char TERRITORY_NAMES_UNPACKED_DE[6719];
+
+static const PackedTerritoryNames PACKED_TERRITORY_NAMES_DE = {
+        TERRITORY_NAMES_UNPACKED_DE, 6719, TERRITORY_NAMES_PACKED_DE, 3439, TERRITORY_NAMES_PAIRS_DE,
+        TERRITORY_NAME_ALTERNATIVES_START_DE, TERRITORY_NAME_ALTERNATIVES_DE};
+
+#else
+
+static const PackedTerritoryNames PACKED_TERRITORY_NAMES_DE = {NULL, 0, NULL, 0, NULL, NULL, NULL};
+
+#endif // MAPCODE_SUPPORT_LANGUAGE_DE
+
+#ifdef MAPCODE_SUPPORT_LANGUAGE_EN
+
+// 7887 bytes, packed to 3882
+static const unsigned char TERRITORY_NAMES_PACKED_EN[3882] = {
+        86, 34, 7, 237, 72, 51, 121, 48, 101, 49, 77, 10, 180, 42, 71, 181, 226, 227, 170, 111, 107, 43, 200, 0,
+        67, 204, 143, 230, 75, 101, 43, 123, 139, 83, 147, 45, 66, 9, 35, 43, 173, 160, 78, 97, 56, 117, 170, 117,
+        118, 12, 117, 135, 180, 200, 124, 65, 62, 17, 29, 3, 116, 136, 97, 9, 116, 17, 245, 136, 9, 116, 3, 0,
+        132, 102, 51, 107, 60, 80, 104, 158, 168, 36, 124, 80, 104, 158, 168, 36, 124, 132, 102, 51, 107, 36, 233, 31,
+        99, 97, 55, 110, 230, 80, 31, 99, 97, 55, 110, 44, 192, 17, 100, 214, 10, 44, 191, 117, 99, 105, 101, 53,
+        15, 17, 111, 139, 66, 52, 118, 156, 36, 184, 8, 109, 228, 247, 62, 214, 30, 115, 108, 167, 197, 249, 30, 224,
+        64, 15, 99, 101, 213, 84, 232, 121, 29, 1, 136, 9, 3, 42, 93, 150, 115, 101, 160, 152, 202, 158, 108, 144,
+        10, 116, 115, 8, 189, 0, 74, 214, 101, 160, 131, 114, 157, 109, 58, 36, 0, 87, 12, 108, 50, 60, 70, 169,
+        129, 38, 70, 169, 129, 38, 87, 12, 108, 105, 16, 197, 249, 32, 209, 230, 209, 151, 44, 32, 197, 50, 203, 76,
+        105, 101, 95, 116, 17, 6, 101, 3, 0, 179, 117, 98, 144, 9, 115, 104, 12, 108, 139, 219, 241, 1, 48, 37,
+        111, 247, 37, 111, 97, 44, 138, 109, 241, 59, 67, 111, 111, 107, 139, 83, 147, 145, 105, 8, 205, 60, 77, 105,
+        113, 117, 43, 10, 124, 77, 105, 113, 117, 43, 10, 175, 147, 145, 105, 8, 114, 49, 78, 105, 117, 101, 245, 92,
+        31, 116, 115, 60, 61, 118, 50, 124, 61, 118, 50, 175, 147, 92, 31, 116, 16, 67, 142, 109, 213, 105, 33, 16,
+        66, 10, 97, 55, 101, 44, 194, 32, 69, 206, 58, 117, 50, 53, 48, 126, 38, 66, 10, 97, 55, 149, 83, 126,
+        247, 116, 32, 69, 206, 58, 105, 117, 16, 77, 12, 100, 105, 118, 167, 83, 147, 192, 43, 17, 97, 44, 138, 115,
+        99, 17, 115, 222, 60, 84, 114, 157, 213, 100, 97, 57, 129, 104, 247, 147, 192, 43, 17, 38, 65, 115, 99, 17,
+        115, 222, 176, 114, 157, 213, 100, 97, 57, 129, 104, 144, 12, 116, 2, 153, 17, 54, 2, 209, 151, 134, 32, 35,
+        148, 208, 231, 47, 124, 85, 83, 32, 209, 230, 219, 241, 213, 209, 139, 77, 142, 159, 116, 149, 77, 97, 187, 29,
+        118, 12, 98, 216, 60, 74, 1, 136, 142, 17, 175, 118, 12, 98, 216, 124, 74, 1, 136, 142, 17, 175, 112, 31,
+        115, 98, 8, 103, 17, 245, 32, 86, 239, 188, 60, 35, 148, 153, 17, 54, 3, 47, 175, 147, 32, 86, 239, 188,
+        124, 153, 17, 54, 3, 167, 72, 101, 216, 36, 60, 77, 99, 68, 10, 12, 100, 230, 72, 101, 216, 36, 124, 77,
+        99, 68, 10, 12, 100, 139, 66, 9, 98, 54, 111, 16, 152, 116, 105, 202, 97, 60, 66, 9, 98, 228, 38, 152,
+        116, 105, 202, 38, 66, 9, 98, 228, 177, 117, 24, 99, 97, 111, 29, 101, 121, 95, 43, 108, 167, 80, 12, 200,
+        0, 161, 150, 136, 9, 64, 97, 139, 152, 100, 11, 114, 2, 93, 37, 212, 115, 108, 101, 134, 136, 1, 110, 124,
+        77, 1, 110, 245, 32, 76, 117, 99, 14, 77, 7, 114, 10, 47, 174, 70, 96, 8, 34, 96, 231, 47, 134, 136,
+        7, 114, 10, 47, 178, 123, 97, 112, 11, 49, 84, 125, 2, 68, 62, 3, 7, 238, 155, 24, 3, 185, 55, 181,
+        34, 40, 84, 250, 115, 53, 57, 97, 7, 143, 151, 176, 250, 115, 230, 67, 97, 7, 143, 139, 83, 97, 128, 84,
+        62, 101, 60, 80, 114, 239, 168, 149, 83, 97, 128, 84, 62, 149, 80, 114, 239, 168, 49, 72, 125, 92, 125, 124,
+        88, 218, 103, 162, 135, 9, 116, 3, 105, 113, 117, 49, 70, 9, 111, 101, 139, 93, 54, 43, 52, 112, 49, 67,
+        62, 11, 111, 16, 77, 97, 56, 31, 105, 117, 16, 23, 129, 222, 0, 76, 117, 120, 173, 98, 52, 114, 103, 29,
+        37, 111, 2, 83, 140, 32, 71, 101, 11, 103, 127, 60, 35, 101, 48, 140, 48, 5, 119, 240, 151, 175, 140, 32,
+        71, 101, 11, 103, 174, 83, 140, 48, 5, 119, 240, 139, 70, 114, 17, 95, 145, 51, 121, 110, 47, 14, 67, 97,
+        112, 148, 253, 100, 149, 67, 126, 128, 253, 100, 149, 243, 57, 126, 128, 253, 100, 49, 84, 114, 3, 105, 100, 54,
+        60, 84, 111, 98, 154, 111, 176, 114, 3, 105, 100, 54, 176, 111, 98, 154, 42, 66, 114, 129, 101, 40, 70, 114,
+        17, 95, 48, 140, 150, 60, 152, 227, 99, 116, 7, 32, 76, 5, 16, 80, 117, 8, 116, 128, 82, 7, 42, 67,
+        121, 112, 114, 117, 16, 252, 98, 1, 10, 124, 252, 98, 1, 47, 101, 41, 74, 37, 97, 7, 2, 71, 193, 174,
+        84, 104, 148, 71, 193, 14, 81, 34, 9, 210, 12, 107, 13, 151, 176, 104, 148, 70, 12, 107, 13, 16, 86, 1,
+        117, 34, 117, 135, 10, 116, 17, 101, 103, 114, 42, 66, 155, 37, 164, 84, 182, 11, 45, 76, 166, 149, 69, 18,
+        246, 182, 11, 29, 119, 97, 122, 105, 13, 185, 117, 119, 97, 31, 210, 105, 106, 40, 146, 57, 12, 96, 10, 178,
+        108, 63, 17, 14, 73, 115, 24, 43, 233, 12, 166, 3, 64, 32, 116, 232, 105, 47, 175, 116, 34, 101, 134, 145,
+        12, 166, 3, 49, 69, 108, 48, 12, 118, 54, 11, 184, 43, 223, 49, 68, 106, 181, 52, 116, 40, 77, 180, 96,
+        10, 174, 70, 89, 82, 79, 77, 124, 70, 11, 109, 8, 32, 89, 117, 103, 143, 108, 201, 28, 134, 136, 180, 96,
+        10, 14, 82, 119, 5, 2, 72, 97, 31, 40, 66, 56, 129, 100, 40, 69, 113, 117, 34, 11, 105, 12, 32, 255,
+        2, 171, 98, 1, 178, 51, 62, 10, 139, 179, 109, 17, 14, 76, 47, 111, 35, 42, 66, 43, 103, 105, 117, 109,
+        135, 51, 100, 63, 2, 255, 97, 45, 66, 217, 200, 170, 165, 119, 237, 243, 57, 104, 3, 238, 104, 169, 236, 119,
+        31, 122, 8, 13, 175, 119, 217, 57, 10, 102, 96, 8, 34, 222, 0, 61, 35, 8, 13, 115, 176, 104, 148, 61,
+        35, 8, 13, 16, 68, 17, 109, 9, 107, 0, 69, 6, 10, 14, 68, 62, 3, 7, 1, 244, 108, 63, 137, 174,
+        83, 108, 63, 137, 41, 67, 111, 6, 97, 32, 82, 7, 238, 143, 110, 127, 60, 72, 8, 122, 101, 103, 63, 3,
+        177, 114, 111, 34, 14, 84, 111, 103, 111, 176, 111, 103, 51, 47, 101, 41, 76, 34, 118, 14, 76, 31, 104, 117,
+        1, 178, 114, 105, 32, 76, 1, 107, 2, 71, 101, 11, 103, 14, 73, 205, 13, 29, 105, 8, 24, 32, 252, 10,
+        49, 80, 1, 37, 177, 122, 101, 95, 41, 70, 114, 17, 95, 32, 93, 64, 38, 93, 64, 2, 208, 138, 24, 98,
+        32, 69, 109, 105, 189, 47, 124, 69, 109, 105, 189, 167, 65, 206, 114, 14, 65, 122, 8, 98, 165, 106, 236, 8,
+        98, 14, 74, 11, 100, 59, 80, 11, 116, 117, 103, 12, 124, 80, 11, 116, 117, 202, 47, 101, 41, 72, 129, 103,
+        9, 121, 29, 140, 92, 187, 38, 243, 92, 187, 38, 75, 187, 97, 44, 48, 140, 212, 99, 101, 242, 93, 34, 173,
+        12, 177, 117, 98, 238, 117, 108, 103, 9, 14, 76, 181, 8, 14, 72, 10, 100, 117, 24, 16, 66, 17, 3, 0,
+        69, 133, 205, 144, 12, 97, 119, 40, 161, 92, 187, 38, 68, 173, 204, 189, 7, 145, 101, 111, 112, 108, 101, 39,
+        115, 28, 134, 92, 187, 38, 75, 187, 97, 44, 32, 161, 0, 78, 7, 9, 154, 117, 2, 153, 101, 101, 99, 149,
+        72, 43, 108, 17, 7, 28, 124, 72, 43, 108, 164, 84, 97, 106, 105, 107, 157, 59, 66, 162, 108, 54, 47, 203,
+        61, 112, 12, 170, 129, 50, 174, 84, 129, 50, 64, 244, 56, 3, 37, 49, 85, 114, 117, 202, 142, 0, 67, 193,
+        225, 178, 121, 114, 174, 83, 121, 114, 64, 138, 24, 98, 244, 17, 101, 103, 12, 185, 121, 114, 103, 121, 122, 6,
+        237, 75, 121, 114, 103, 121, 122, 41, 66, 43, 9, 117, 16, 93, 121, 234, 76, 97, 143, 124, 76, 97, 128, 80,
+        101, 111, 112, 108, 101, 39, 115, 191, 173, 204, 189, 7, 41, 82, 62, 235, 71, 104, 234, 85, 103, 5, 2, 208,
+        92, 123, 100, 62, 175, 99, 159, 13, 124, 153, 101, 34, 32, 197, 94, 124, 69, 110, 103, 13, 124, 161, 150, 30,
+        205, 13, 124, 73, 205, 13, 44, 32, 161, 150, 124, 197, 94, 124, 208, 92, 123, 100, 62, 134, 32, 153, 101, 34,
+        32, 197, 94, 60, 161, 150, 30, 205, 242, 255, 38, 255, 97, 45, 67, 10, 137, 114, 160, 69, 99, 117, 54, 11,
+        0, 254, 150, 48, 155, 9, 247, 155, 24, 119, 105, 138, 24, 98, 191, 173, 204, 189, 7, 41, 71, 126, 10, 124,
+        71, 126, 10, 47, 101, 41, 229, 90, 101, 12, 5, 184, 250, 3, 97, 32, 70, 58, 248, 104, 158, 168, 112, 3,
+        167, 73, 116, 12, 121, 124, 73, 116, 12, 64, 41, 79, 109, 59, 80, 111, 13, 212, 118, 11, 121, 57, 111, 18,
+        124, 67, 159, 148, 100, 39, 73, 118, 111, 55, 149, 243, 57, 159, 148, 100, 39, 73, 118, 111, 55, 49, 132, 119,
+        142, 135, 12, 142, 115, 14, 86, 105, 156, 110, 37, 210, 3, 242, 67, 125, 111, 45, 66, 24, 122, 122, 201, 158,
+        108, 149, 254, 57, 125, 111, 124, 243, 32, 35, 101, 57, 125, 42, 71, 8, 109, 1, 160, 74, 97, 112, 59, 90,
+        182, 98, 126, 119, 49, 80, 9, 154, 117, 142, 212, 24, 113, 135, 11, 204, 99, 42, 85, 122, 98, 101, 107, 157,
+        236, 119, 96, 17, 233, 97, 19, 97, 32, 229, 255, 177, 37, 8, 111, 10, 170, 250, 109, 17, 157, 236, 112, 94,
+        170, 104, 165, 242, 89, 173, 17, 210, 114, 1, 99, 149, 70, 114, 17, 95, 41, 65, 12, 5, 139, 75, 17, 121,
+        238, 159, 115, 119, 1, 144, 54, 154, 58, 99, 9, 0, 85, 107, 24, 186, 29, 140, 48, 228, 59, 67, 188, 226,
+        138, 102, 114, 7, 1, 244, 62, 12, 14, 65, 102, 103, 104, 1, 157, 59, 77, 121, 1, 109, 9, 124, 66, 56,
+        109, 2, 90, 193, 14, 131, 158, 49, 84, 250, 101, 160, 80, 137, 157, 59, 77, 111, 122, 193, 105, 113, 117, 49,
+        78, 37, 181, 14, 86, 17, 101, 122, 117, 43, 2, 78, 105, 103, 8, 14, 84, 1, 122, 235, 69, 103, 121, 112,
+        116, 135, 97, 56, 31, 235, 66, 51, 105, 118, 14, 69, 35, 105, 111, 112, 14, 67, 51, 62, 98, 178, 140, 138,
+        102, 114, 7, 144, 12, 40, 152, 103, 51, 2, 78, 105, 103, 8, 0, 131, 54, 233, 8, 117, 135, 125, 51, 14,
+        73, 114, 237, 80, 214, 14, 76, 181, 121, 2, 83, 228, 59, 73, 224, 10, 47, 14, 70, 96, 8, 12, 191, 157,
+        114, 7, 116, 170, 108, 97, 120, 99, 12, 144, 11, 43, 111, 16, 65, 202, 58, 99, 12, 105, 188, 167, 67, 51,
+        182, 2, 81, 117, 8, 156, 9, 42, 72, 105, 100, 12, 103, 42, 77, 101, 120, 7, 111, 231, 49, 84, 126, 58,
+        99, 42, 78, 142, 9, 31, 0, 93, 1, 97, 106, 117, 34, 248, 117, 101, 4, 2, 89, 117, 99, 34, 59, 81,
+        117, 3, 116, 1, 97, 32, 82, 111, 111, 29, 3, 12, 111, 177, 37, 112, 101, 95, 49, 77, 240, 111, 180, 236,
+        213, 76, 117, 50, 145, 159, 143, 40, 93, 8, 114, 8, 42, 78, 117, 101, 118, 128, 252, 10, 124, 229, 252, 10,
+        184, 97, 106, 97, 57, 12, 105, 102, 11, 110, 14, 253, 180, 114, 117, 122, 0, 131, 127, 112, 164, 66, 97, 106,
+        97, 57, 12, 105, 102, 11, 110, 127, 48, 56, 0, 90, 180, 34, 101, 99, 164, 74, 12, 50, 99, 42, 84, 37,
+        200, 108, 168, 164, 79, 97, 120, 180, 2, 68, 56, 162, 42, 67, 111, 155, 117, 158, 2, 83, 10, 11, 2, 131,
+        105, 104, 117, 155, 117, 2, 153, 101, 17, 13, 29, 200, 100, 105, 138, 24, 98, 14, 67, 125, 111, 45, 75, 3,
+        115, 104, 58, 38, 68, 173, 204, 189, 7, 28, 134, 32, 35, 101, 57, 125, 111, 124, 69, 18, 57, 125, 42, 171,
+        103, 8, 14, 75, 97, 122, 137, 104, 6, 59, 179, 103, 188, 3, 38, 179, 103, 188, 186, 41, 68, 37, 1, 60,
+        68, 105, 117, 0, 68, 54, 24, 60, 78, 154, 9, 192, 201, 43, 105, 124, 68, 54, 24, 124, 78, 154, 9, 192,
+        201, 43, 40, 131, 5, 105, 103, 9, 203, 152, 100, 37, 1, 60, 78, 7, 111, 98, 9, 124, 152, 100, 37, 237,
+        78, 7, 111, 98, 9, 0, 76, 137, 115, 104, 54, 119, 101, 101, 112, 0, 68, 43, 104, 40, 77, 101, 103, 104,
+        12, 142, 2, 78, 154, 12, 5, 135, 1, 105, 19, 114, 170, 114, 105, 19, 114, 144, 223, 11, 37, 29, 105, 107,
+        107, 182, 233, 129, 106, 126, 211, 9, 121, 234, 179, 129, 97, 95, 12, 145, 163, 47, 203, 65, 115, 115, 37, 184,
+        105, 104, 9, 0, 85, 116, 227, 137, 104, 5, 0, 71, 111, 2, 75, 8, 12, 2, 84, 37, 158, 32, 78, 54,
+        117, 211, 182, 97, 95, 12, 145, 163, 47, 203, 74, 37, 109, 117, 60, 75, 196, 109, 55, 124, 74, 37, 109, 117,
+        124, 75, 196, 109, 55, 0, 131, 104, 34, 116, 50, 103, 9, 203, 74, 104, 9, 107, 104, 5, 185, 9, 110, 34,
+        137, 2, 82, 97, 106, 18, 104, 59, 79, 100, 249, 38, 79, 114, 217, 2, 93, 106, 9, 34, 0, 254, 32, 66,
+        17, 103, 12, 135, 54, 104, 121, 97, 145, 163, 47, 104, 170, 43, 162, 234, 152, 100, 104, 24, 145, 163, 47, 104,
+        135, 155, 9, 196, 116, 114, 2, 85, 116, 227, 145, 163, 47, 203, 80, 228, 117, 95, 8, 114, 160, 146, 48, 140,
+        32, 87, 12, 167, 65, 206, 226, 64, 57, 97, 112, 31, 12, 246, 232, 160, 74, 8, 118, 50, 32, 66, 142, 246,
+        232, 160, 161, 150, 246, 232, 121, 29, 140, 138, 206, 226, 14, 84, 58, 109, 235, 86, 7, 116, 11, 14, 254, 150,
+        138, 206, 226, 14, 81, 117, 101, 17, 33, 0, 68, 157, 133, 128, 70, 96, 8, 12, 29, 8, 103, 168, 49, 171,
+        154, 111, 164, 82, 105, 128, 100, 148, 74, 1, 101, 55, 42, 69, 115, 112, 55, 31, 111, 48, 1, 116, 42, 82,
+        105, 128, 153, 5, 148, 100, 128, 132, 116, 49, 80, 9, 165, 98, 2, 83, 1, 116, 97, 57, 34, 9, 3, 2,
+        80, 150, 193, 117, 99, 42, 219, 97, 112, 177, 101, 9, 2, 65, 99, 114, 49, 80, 9, 234, 82, 11, 165, 109,
+        2, 82, 10, 100, 10, 178, 97, 128, 80, 200, 108, 248, 127, 117, 40, 84, 204, 1, 116, 3, 16, 82, 105, 128,
+        153, 5, 148, 100, 111, 48, 117, 108, 135, 9, 1, 221, 42, 71, 111, 127, 16, 77, 34, 128, 153, 143, 115, 128,
+        100, 111, 48, 117, 108, 184, 155, 14, 77, 3, 58, 32, 71, 8, 165, 16, 77, 34, 128, 153, 143, 115, 248, 9,
+        2, 219, 97, 122, 10, 164, 68, 157, 114, 7, 116, 134, 57, 51, 117, 109, 98, 174, 87, 196, 123, 116, 10, 44,
+        191, 46, 67, 46, 0, 82, 104, 225, 101, 36, 0, 68, 43, 97, 119, 9, 49, 67, 10, 110, 101, 99, 116, 7,
+        169, 0, 229, 74, 214, 101, 160, 146, 192, 37, 112, 115, 104, 55, 49, 253, 109, 10, 116, 135, 58, 115, 97, 95,
+        117, 115, 156, 116, 16, 72, 97, 119, 165, 40, 77, 9, 121, 242, 254, 32, 209, 178, 140, 57, 9, 51, 3, 144,
+        94, 49, 73, 224, 64, 2, 75, 188, 117, 99, 107, 160, 84, 17, 110, 47, 115, 101, 49, 209, 14, 79, 104, 105,
+        248, 17, 110, 115, 121, 108, 118, 235, 77, 217, 217, 168, 112, 40, 76, 52, 50, 64, 2, 171, 126, 37, 2, 179,
+        107, 1, 115, 164, 161, 57, 9, 51, 3, 2, 229, 89, 11, 107, 212, 111, 119, 2, 73, 108, 108, 3, 111, 105,
+        16, 71, 101, 11, 103, 14, 87, 50, 99, 10, 115, 3, 210, 108, 11, 105, 100, 144, 217, 52, 114, 40, 79, 107,
+        108, 155, 62, 2, 161, 191, 137, 159, 2, 87, 196, 123, 116, 10, 29, 140, 191, 137, 159, 2, 61, 98, 24, 91,
+        2, 75, 1, 115, 164, 73, 100, 155, 42, 85, 116, 155, 135, 3, 110, 47, 159, 144, 240, 105, 103, 59, 87, 121,
+        62, 123, 0, 79, 205, 103, 10, 0, 67, 51, 11, 54, 42, 61, 118, 54, 2, 179, 223, 10, 2, 146, 136, 101,
+        120, 7, 42, 77, 10, 116, 1, 177, 12, 105, 102, 11, 110, 14, 84, 101, 120, 164, 171, 58, 107, 2, 197, 249,
+        57, 51, 117, 109, 98, 14, 171, 98, 8, 116, 2, 79, 110, 227, 105, 42, 81, 117, 101, 98, 101, 99, 29, 58,
+        107, 34, 95, 101, 119, 59, 77, 1, 31, 111, 98, 2, 146, 102, 52, 224, 13, 60, 76, 126, 163, 11, 124, 146,
+        102, 52, 224, 13, 124, 76, 126, 163, 11, 0, 229, 66, 114, 129, 115, 119, 7, 107, 0, 78, 63, 97, 48, 99,
+        159, 14, 80, 114, 239, 148, 69, 100, 119, 216, 36, 0, 89, 117, 107, 10, 0, 161, 119, 166, 246, 232, 105, 167,
+        78, 129, 201, 169, 212, 224, 14, 65, 206, 226, 14, 66, 24, 122, 158, 0, 85, 83, 65, 124, 208, 231, 47, 134,
+        138, 109, 241, 38, 219, 241, 144, 101, 120, 7, 111, 124, 208, 136, 101, 120, 7, 1, 231, 167, 77, 143, 99, 111,
+        119, 245, 145, 156, 214, 98, 56, 103, 185, 12, 3, 123, 163, 22, 73, 110, 202, 115, 104, 156, 14, 65, 100, 121,
+        103, 101, 97, 41, 161, 15, 115, 115, 156, 127, 45, 171, 1, 207, 75, 126, 216, 3, 111, 45, 66, 12, 107, 9,
+        41, 75, 9, 97, 95, 142, 45, 131, 8, 107, 47, 115, 41, 131, 101, 95, 17, 28, 124, 131, 101, 95, 110, 121,
+        38, 73, 95, 107, 8, 14, 131, 117, 118, 196, 41, 73, 118, 1, 63, 111, 22, 76, 168, 156, 141, 79, 114, 121,
+        51, 22, 84, 117, 108, 220, 66, 43, 103, 11, 225, 22, 86, 108, 54, 182, 55, 22, 75, 56, 141, 75, 12, 117,
+        103, 220, 84, 193, 251, 66, 114, 121, 1, 141, 89, 9, 143, 108, 201, 108, 22, 82, 121, 97, 122, 1, 22, 65,
+        6, 24, 107, 104, 1, 22, 77, 143, 99, 111, 119, 22, 83, 109, 51, 17, 141, 68, 154, 166, 1, 41, 86, 11,
+        10, 101, 122, 104, 22, 78, 63, 103, 11, 225, 22, 80, 91, 251, 75, 111, 6, 114, 62, 220, 83, 116, 201, 114,
+        111, 112, 51, 183, 75, 24, 115, 110, 225, 9, 183, 75, 12, 109, 121, 107, 207, 84, 118, 8, 22, 76, 17, 123,
+        163, 22, 82, 111, 6, 251, 86, 51, 103, 111, 103, 163, 22, 86, 51, 111, 103, 100, 220, 77, 56, 109, 1, 141,
+        75, 9, 43, 207, 78, 17, 156, 115, 138, 169, 10, 62, 52, 115, 15, 107, 114, 117, 103, 185, 62, 105, 41, 179,
+        107, 104, 162, 43, 141, 77, 11, 100, 63, 207, 78, 223, 104, 110, 121, 32, 78, 63, 103, 11, 225, 22, 80, 17,
+        122, 220, 75, 55, 251, 77, 9, 105, 32, 69, 108, 41, 79, 114, 17, 98, 56, 103, 22, 85, 108, 121, 1, 63,
+        141, 80, 8, 109, 183, 66, 196, 107, 11, 116, 111, 6, 1, 41, 85, 100, 109, 56, 116, 41, 84, 34, 9, 6,
+        1, 244, 37, 9, 220, 83, 9, 34, 251, 89, 37, 12, 111, 45, 78, 17, 156, 16, 75, 104, 1, 116, 121, 45,
+        77, 1, 115, 105, 29, 118, 8, 100, 108, 63, 141, 84, 121, 117, 109, 17, 22, 75, 56, 103, 1, 22, 131, 43,
+        121, 126, 3, 141, 66, 56, 121, 34, 207, 90, 126, 142, 107, 12, 91, 121, 183, 73, 114, 107, 169, 141, 78, 63,
+        143, 181, 55, 141, 84, 62, 141, 79, 109, 141, 75, 104, 137, 58, 115, 207, 75, 173, 8, 63, 111, 22, 171, 116,
+        165, 41, 171, 116, 165, 183, 84, 117, 118, 97, 41, 75, 24, 115, 110, 111, 121, 9, 91, 183, 77, 154, 54, 1,
+        22, 131, 117, 107, 159, 107, 97, 15, 107, 114, 117, 103, 185, 37, 95, 34, 107, 97, 172, 105, 29, 137, 104, 12,
+        3, 22, 80, 114, 182, 11, 91, 121, 183, 74, 101, 119, 249, 138, 169, 10, 62, 52, 115, 22, 75, 104, 126, 9,
+        63, 91, 183, 219, 56, 22, 83, 137, 221, 28, 124, 89, 137, 169, 207, 67, 1, 54, 2, 82, 117, 115, 115, 174,
+        82, 117, 115, 115, 64, 32, 70, 96, 8, 34, 222, 29, 104, 162, 221, 40, 84, 64, 106, 3, 184, 101, 105, 106,
+        123, 211, 94, 59, 78, 123, 120, 127, 192, 117, 40, 131, 125, 113, 123, 0, 90, 104, 101, 106, 218, 0, 74, 218,
+        115, 117, 210, 117, 106, 105, 59, 152, 104, 117, 40, 76, 127, 10, 123, 29, 104, 5, 125, 29, 104, 1, 120, 40,
+        74, 218, 120, 40, 72, 17, 59, 93, 223, 104, 52, 0, 93, 162, 100, 125, 211, 117, 98, 101, 40, 74, 158, 3,
+        211, 101, 98, 101, 105, 124, 89, 1, 122, 221, 111, 29, 221, 1, 120, 40, 61, 105, 136, 125, 51, 124, 73, 110,
+        110, 8, 136, 125, 51, 14, 72, 101, 158, 125, 106, 218, 211, 129, 59, 93, 162, 120, 105, 32, 90, 104, 117, 162,
+        29, 240, 117, 59, 89, 129, 110, 59, 88, 223, 162, 176, 181, 156, 0, 71, 1, 115, 117, 0, 81, 123, 104, 165,
+        176, 115, 123, 221, 40, 88, 3, 106, 218, 32, 85, 121, 103, 104, 56, 0, 131, 3, 2, 208, 231, 47, 136, 3,
+        11, 15, 169, 108, 121, 123, 139, 67, 108, 168, 112, 8, 116, 10, 36, 0, 152, 227, 99, 116, 7, 2, 73, 110,
+        116, 150, 34, 222, 12, 124, 87, 11, 108, 100, 119, 105, 100, 149, 69, 9, 35, 0,
+};
+
+static const unsigned char TERRITORY_NAMES_PAIRS_EN[256][2] = {
+        {0, 0}, {97, 110}, {97, 0}, {105, 110}, {98, 108}, {1, 100}, {115, 116}, {105, 99}, {101, 114}, {97, 114}, {111, 110}, {111, 114},
+        {97, 108}, {108, 5}, {105, 2}, {32, 79}, {115, 0}, {101, 110}, {97, 6}, {112, 117}, {4, 18}, {15, 20}, {21, 0}, {82, 101},
+        {114, 97}, {4, 7}, {19, 25}, {23, 26}, {32, 27}, {0, 83}, {32, 73}, {105, 116}, {32, 32}, {115, 13}, {97, 116}, {116, 104},
+        {30, 33}, {97, 109}, {97, 124}, {39, 39}, {105, 0}, {28, 0}, {111, 0}, {101, 108}, {44, 44}, {45, 45}, {46, 46}, {101, 115},
+        {32, 83}, {101, 0}, {105, 115}, {111, 108}, {111, 117}, {32, 5}, {97, 100}, {105, 114}, {117, 114}, {32, 67}, {97, 115}, {1, 0},
+        {53, 32}, {78, 101}, {111, 109}, {111, 118}, {105, 1}, {65, 65}, {66, 66}, {67, 67}, {68, 68}, {69, 69}, {70, 70}, {71, 71},
+        {72, 72}, {73, 73}, {74, 74}, {75, 75}, {76, 76}, {77, 77}, {78, 78}, {79, 79}, {80, 80}, {81, 81}, {82, 82}, {83, 83},
+        {84, 84}, {85, 85}, {86, 86}, {87, 87}, {88, 88}, {89, 89}, {90, 90}, {115, 107}, {32, 75}, {71, 117}, {97, 3}, {99, 104},
+        {101, 100}, {97, 97}, {98, 98}, {99, 99}, {100, 100}, {101, 101}, {102, 102}, {103, 103}, {104, 104}, {105, 105}, {106, 106}, {107, 107},
+        {108, 108}, {109, 109}, {110, 110}, {111, 111}, {112, 112}, {113, 113}, {114, 114}, {115, 115}, {116, 116}, {117, 117}, {118, 118}, {119, 119},
+        {120, 120}, {121, 121}, {122, 122}, {3, 103}, {124, 124}, {10, 103}, {97, 98}, {105, 97}, {111, 32}, {117, 110}, {32, 111}, {67, 104},
+        {78, 11}, {114, 31}, {130, 102}, {0, 77}, {32, 77}, {97, 107}, {32, 65}, {36, 16}, {52, 35}, {91, 22}, {97, 121}, {111, 115},
+        {2, 77}, {32, 80}, {61, 119}, {94, 116}, {101, 32}, {101, 124}, {8, 110}, {36, 115}, {65, 110}, {71, 114}, {97, 103}, {97, 104},
+        {101, 116}, {105, 6}, {105, 108}, {111, 116}, {121, 0}, {132, 35}, {1, 103}, {24, 100}, {97, 16}, {97, 105}, {101, 6}, {101, 16},
+        {105, 112}, {117, 116}, {0, 84}, {65, 108}, {92, 24}, {101, 109}, {105, 38}, {124, 83}, {124, 84}, {2, 67}, {14, 83}, {65, 114},
+        {97, 99}, {105, 98}, {105, 109}, {172, 40}, {0, 66}, {0, 75}, {3, 101}, {11, 101}, {17, 116}, {24, 116}, {31, 96}, {32, 68},
+        {32, 72}, {37, 98}, {48, 116}, {55, 103}, {58, 104}, {66, 133}, {85, 110}, {86, 195}, {97, 117}, {97, 118}, {103, 117}, {104, 0},
+        {111, 99}, {114, 101}, {117, 6}, {127, 41}, {198, 190}, {199, 3}, {0, 70}, {0, 72}, {0, 73}, {1, 32}, {8, 115}, {8, 133},
+        {9, 100}, {50, 115}, {64, 103}, {65, 109}, {97, 22}, {104, 97}, {105, 10}, {105, 122}, {110, 100}, {111, 100}, {114, 12}, {116, 9},
+        {117, 100}, {146, 32}, {151, 124}, {194, 34}, {215, 11}, {0, 80}, {1, 2}, {1, 14}, {1, 29}, {1, 124}, {2, 66}, {3, 99},
+        {7, 104}, {8, 7}, {13, 0}, {27, 134}, {28, 29}, {29, 147}, {32, 84}, {38, 83}, {42, 80}, {50, 104}, {56, 107}, {63, 22},
+        {76, 101}, {86, 8}, {87, 166}, {93, 186},
+};
+
+static const unsigned short TERRITORY_NAME_ALTERNATIVES_START_EN[_TERRITORY_MAX - _TERRITORY_MIN] = {
+        0, 2, 3, 4, 5, 7, 8, 9, 10, 12, 13, 14, 17, 19, 20, 22,
+        23, 24, 25, 26, 27, 28, 29, 32, 34, 35, 36, 37, 39, 40, 43, 44,
+        47, 48, 52, 53, 57, 58, 59, 62, 64, 68, 71, 74, 75, 78, 79, 80,
+        81, 82, 83, 84, 86, 87, 89, 90, 91, 92, 93, 94, 97, 100, 102, 103,
+        104, 105, 106, 107, 108, 109, 110, 113, 114, 117, 120, 121, 122, 123, 124, 126,
+        127, 129, 130, 132, 133, 134, 135, 137, 138, 139, 140, 141, 142, 143, 145, 146,
+        147, 148, 151, 152, 153, 154, 155, 156, 157, 158, 159, 160, 161, 162, 164, 165,
+        167, 169, 170, 171, 172, 174, 175, 176, 177, 179, 180, 181, 182, 183, 184, 185,
+        186, 187, 189, 191, 192, 193, 194, 195, 197, 198, 201, 202, 203, 204, 205, 206,
+        207, 208, 209, 210, 213, 214, 217, 218, 219, 220, 222, 223, 224, 225, 227, 228,
+        230, 231, 232, 234, 235, 236, 237, 245, 247, 248, 250, 252, 253, 254, 255, 257,
+        258, 259, 262, 263, 264, 265, 266, 269, 270, 271, 272, 273, 274, 275, 276, 277,
+        278, 279, 280, 281, 282, 283, 285, 286, 287, 288, 289, 290, 291, 292, 293, 294,
+        296, 297, 298, 299, 300, 301, 302, 303, 304, 305, 306, 307, 308, 309, 310, 311,
+        312, 313, 314, 315, 316, 317, 319, 320, 321, 322, 323, 324, 325, 326, 327, 328,
+        329, 330, 331, 332, 333, 334, 335, 336, 337, 338, 339, 340, 341, 343, 344, 345,
+        346, 347, 348, 349, 350, 351, 352, 353, 354, 355, 356, 357, 360, 361, 362, 364,
+        365, 368, 369, 372, 373, 374, 375, 376, 377, 378, 379, 380, 381, 382, 383, 384,
+        385, 386, 387, 388, 389, 390, 393, 394, 395, 396, 397, 399, 400, 401, 402, 403,
+        404, 405, 406, 407, 408, 409, 410, 411, 412, 413, 414, 415, 416, 417, 418, 419,
+        420, 421, 422, 423, 424, 425, 426, 427, 428, 429, 430, 431, 432, 433, 434, 435,
+        436, 437, 438, 439, 440, 441, 442, 443, 445, 446, 447, 448, 449, 450, 451, 452,
+        453, 454, 455, 456, 457, 458, 459, 460, 461, 462, 463, 464, 465, 466, 467, 468,
+        469, 470, 471, 472, 473, 474, 475, 476, 477, 478, 479, 480, 481, 482, 483, 484,
+        485, 486, 487, 488, 489, 490, 491, 492, 493, 494, 495, 496, 497, 498, 499, 500,
+        501, 504, 505, 506, 507, 508, 509, 510, 511, 512, 513, 516, 518, 519, 520, 521,
+        522, 523, 524, 525, 526, 529, 530, 531, 532, 533, 534, 535, 536, 537, 538, 539,
+        540, 541, 542, 543, 544, 545, 546, 547, 548, 549, 550, 551, 552, 553, 554, 555,
+        556, 557, 558, 559, 560, 561, 562, 563, 564, 565, 566, 567, 568, 569, 570, 571,
+        572, 573, 574, 575, 576, 577, 578, 579, 580, 581, 582, 583, 584, 585, 586, 587,
+        588, 589, 590, 591, 592, 593, 594, 595, 596, 597, 598, 599, 600, 601, 602, 604,
+        605, 607, 608, 609, 610, 611, 612, 613, 614, 615, 616, 617, 618, 619, 620, 621,
+        622, 623, 624, 625, 626, 628, 629, 631, 632, 633, 634, 635, 636, 638, 639, 641,
+        642, 643, 644, 645, 646, 649,
+};
+
+static const TerritoryNameAlternative TERRITORY_NAME_ALTERNATIVES_EN[649] = {
+        {0, 7, 0}, {8, 8, 0}, {17, 6, 0}, {24, 9, 0}, {34, 7, 0}, {42, 13, 0}, {56, 15, 0}, {72, 16, 0},
+        {89, 5, 0}, {95, 6, 0}, {102, 5, 0}, {108, 5, 0}, {114, 12, 0}, {127, 12, 0}, {140, 25, 0}, {166, 13, 0},
+        {180, 14, 0}, {195, 16, 0}, {212, 43, 0}, {256, 13, 0}, {270, 7, 0}, {278, 12, 0}, {291, 30, 0}, {322, 10, 0},
+        {333, 8, 0}, {342, 8, 0}, {351, 10, 0}, {362, 6, 0}, {369, 16, 0}, {386, 17, 0}, {404, 6, 0}, {411, 6, 0},
+        {418, 22, 0}, {441, 23, 0}, {465, 13, 0}, {479, 5, 0}, {485, 16, 0}, {502, 14, 0}, {517, 15, 0}, {533, 12, 0},
+        {546, 25, 0}, {572, 8, 0}, {581, 12, 0}, {594, 4, 0}, {599, 21, 0}, {621, 5, 0}, {627, 11, 0}, {639, 14, 0},
+        {654, 30, 0}, {685, 7, 0}, {693, 4, 0}, {698, 12, 0}, {711, 8, 0}, {720, 44, 0}, {765, 12, 0}, {778, 9, 0},
+        {788, 16, 0}, {805, 5, 0}, {811, 7, 0}, {819, 35, 0}, {855, 17, 0}, {873, 23, 0}, {897, 7, 0}, {905, 5, 0},
+        {911, 22, 0}, {934, 8, 0}, {943, 9, 0}, {953, 11, 0}, {965, 32, 0}, {998, 13, 0}, {1012, 10, 0}, {1023, 33, 0},
+        {1057, 12, 0}, {1070, 16, 0}, {1087, 8, 0}, {1096, 19, 0}, {1116, 7, 0}, {1124, 7, 0}, {1132, 7, 0}, {1140, 10, 0},
+        {1151, 5, 0}, {1157, 24, 0}, {1182, 7, 0}, {1190, 4, 0}, {1195, 12, 0}, {1208, 4, 0}, {1213, 11, 0}, {1225, 10, 0},
+        {1236, 30, 0}, {1267, 9, 0}, {1277, 5, 0}, {1283, 8, 0}, {1292, 7, 0}, {1300, 8, 0}, {1309, 24, 0}, {1334, 13, 0},
+        {1348, 14, 0}, {1363, 21, 0}, {1385, 8, 0}, {1394, 8, 0}, {1403, 9, 0}, {1413, 9, 0}, {1423, 10, 0}, {1434, 13, 0},
+        {1448, 10, 0}, {1459, 7, 0}, {1467, 9, 0}, {1477, 7, 0}, {1485, 10, 0}, {1496, 5, 0}, {1502, 44, 0}, {1547, 13, 0},
+        {1561, 22, 0}, {1584, 16, 0}, {1601, 10, 0}, {1612, 10, 0}, {1623, 22, 0}, {1646, 19, 0}, {1666, 8, 0}, {1675, 6, 0},
+        {1682, 6, 0}, {1689, 35, 0}, {1725, 11, 0}, {1737, 6, 0}, {1744, 7, 0}, {1752, 17, 0}, {1770, 7, 0}, {1778, 6, 0},
+        {1785, 10, 0}, {1796, 5, 0}, {1802, 16, 0}, {1819, 13, 0}, {1833, 7, 0}, {1841, 10, 0}, {1852, 7, 0}, {1860, 11, 0},
+        {1872, 10, 0}, {1883, 9, 0}, {1893, 6, 0}, {1900, 4, 0}, {1905, 13, 0}, {1919, 8, 0}, {1928, 6, 0}, {1935, 23, 0},
+        {1959, 18, 0}, {1978, 11, 0}, {1990, 6, 0}, {1997, 8, 0}, {2006, 9, 0}, {2016, 5, 0}, {2022, 37, 0}, {2060, 6, 0},
+        {2067, 5, 0}, {2073, 7, 0}, {2081, 17, 0}, {2099, 7, 0}, {2107, 15, 0}, {2123, 7, 0}, {2131, 7, 0}, {2139, 7, 0},
+        {2147, 7, 0}, {2155, 13, 0}, {2169, 6, 0}, {2176, 17, 0}, {2194, 6, 0}, {2201, 11, 0}, {2213, 19, 0}, {2233, 11, 0},
+        {2245, 15, 0}, {2261, 7, 0}, {2269, 7, 0}, {2277, 18, 0}, {2296, 8, 0}, {2305, 15, 0}, {2321, 10, 0}, {2332, 22, 0},
+        {2355, 7, 0}, {2363, 4, 0}, {2368, 17, 0}, {2386, 6, 0}, {2393, 9, 0}, {2403, 9, 0}, {2413, 7, 0}, {2421, 7, 0},
+        {2429, 12, 0}, {2442, 6, 0}, {2449, 14, 0}, {2464, 13, 0}, {2478, 6, 0}, {2485, 20, 0}, {2506, 8, 0}, {2515, 7, 0},
+        {2523, 10, 0}, {2534, 6, 0}, {2541, 6, 0}, {2548, 8, 0}, {2557, 19, 0}, {2577, 7, 0}, {2585, 11, 0}, {2597, 17, 0},
+        {2615, 12, 0}, {2628, 7, 0}, {2636, 9, 0}, {2646, 4, 0}, {2651, 8, 0}, {2660, 7, 0}, {2668, 8, 0}, {2677, 5, 0},
+        {2683, 7, 0}, {2691, 6, 0}, {2698, 11, 0}, {2710, 37, 0}, {2748, 12, 0}, {2761, 9, 0}, {2771, 6, 0}, {2778, 17, 0},
+        {2796, 6, 0}, {2803, 10, 0}, {2814, 10, 0}, {2825, 5, 0}, {2831, 7, 0}, {2839, 17, 0}, {2857, 8, 0}, {2866, 7, 0},
+        {2874, 8, 0}, {2883, 5, 0}, {2889, 20, 0}, {2910, 7, 0}, {2918, 10, 0}, {2929, 15, 0}, {2945, 7, 0}, {2953, 6, 0},
+        {2960, 4, 0}, {2965, 32, 0}, {2998, 7, 0}, {3006, 5, 0}, {3012, 6, 0}, {3019, 14, 0}, {3034, 8, 0}, {3043, 13, 0},
+        {3057, 7, 0}, {3065, 16, 0}, {3082, 17, 0}, {3100, 7, 0}, {3108, 52, 0}, {3161, 6, 0}, {3168, 14, 0}, {3183, 7, 0},
+        {3191, 14, 0}, {3206, 32, 0}, {3239, 5, 0}, {3245, 17, 0}, {3263, 11, 0}, {3275, 12, 0}, {3288, 11, 0}, {3300, 5, 0},
+        {3306, 16, 0}, {3323, 4, 0}, {3328, 6, 0}, {3335, 11, 0}, {3347, 13, 0}, {3361, 25, 0}, {3387, 6, 0}, {3394, 8, 0},
+        {3403, 7, 0}, {3411, 7, 0}, {3419, 17, 0}, {3437, 10, 0}, {3448, 21, 0}, {3470, 7, 0}, {3478, 5, 0}, {3484, 8, 0},
+        {3493, 8, 0}, {3502, 4, 0}, {3507, 7, 0}, {3515, 10, 0}, {3526, 6, 0}, {3533, 16, 0}, {3550, 8, 0}, {3559, 12, 0},
+        {3572, 5, 0}, {3578, 8, 0}, {3587, 5, 0}, {3593, 6, 0}, {3600, 15, 0}, {3616, 14, 0}, {3631, 5, 0}, {3637, 8, 0},
+        {3646, 10, 0}, {3657, 7, 0}, {3665, 11, 0}, {3677, 24, 0}, {3702, 7, 0}, {3710, 11, 0}, {3722, 7, 0}, {3730, 5, 0},
+        {3736, 6, 0}, {3743, 5, 0}, {3749, 6, 0}, {3756, 8, 0}, {3765, 10, 0}, {3776, 7, 0}, {3784, 9, 0}, {3794, 7, 0},
+        {3802, 8, 0}, {3811, 5, 0}, {3817, 10, 0}, {3828, 7, 0}, {3836, 8, 0}, {3845, 8, 0}, {3854, 12, 0}, {3867, 4, 0},
+        {3872, 6, 0}, {3879, 5, 0}, {3885, 4, 0}, {3890, 4, 0}, {3895, 8, 0}, {3904, 4, 0}, {3909, 6, 0}, {3916, 5, 0},
+        {3922, 5, 0}, {3928, 9, 0}, {3938, 16, 0}, {3955, 8, 0}, {3964, 7, 0}, {3972, 14, 0}, {3987, 6, 0}, {3994, 9, 0},
+        {4004, 7, 0}, {4012, 12, 0}, {4025, 7, 0}, {4033, 7, 0}, {4041, 10, 0}, {4052, 6, 0}, {4059, 7, 0}, {4067, 12, 0},
+        {4080, 7, 0}, {4088, 8, 0}, {4097, 9, 0}, {4107, 15, 0}, {4123, 8, 0}, {4132, 10, 0}, {4143, 8, 0}, {4152, 15, 0},
+        {4168, 8, 0}, {4177, 7, 0}, {4185, 19, 0}, {4205, 9, 0}, {4215, 7, 0}, {4223, 10, 0}, {4234, 6, 0}, {4241, 7, 0},
+        {4249, 8, 0}, {4258, 6, 0}, {4265, 9, 0}, {4275, 9, 0}, {4285, 12, 0}, {4298, 14, 0}, {4313, 32, 0}, {4346, 10, 0},
+        {4357, 7, 0}, {4365, 10, 0}, {4376, 9, 0}, {4386, 18, 0}, {4405, 13, 0}, {4419, 22, 0}, {4442, 5, 0}, {4448, 12, 0},
+        {4461, 10, 0}, {4472, 19, 0}, {4492, 7, 0}, {4500, 7, 0}, {4508, 11, 0}, {4520, 5, 0}, {4526, 9, 0}, {4536, 8, 0},
+        {4545, 7, 0}, {4553, 7, 0}, {4561, 7, 0}, {4569, 6, 0}, {4576, 6, 0}, {4583, 7, 0}, {4591, 17, 0}, {4609, 5, 0},
+        {4615, 5, 0}, {4621, 11, 0}, {4633, 3, 0}, {4637, 6, 0}, {4644, 10, 0}, {4655, 16, 0}, {4672, 17, 0}, {4690, 5, 0},
+        {4696, 7, 0}, {4704, 12, 0}, {4717, 9, 0}, {4727, 9, 0}, {4737, 9, 0}, {4747, 6, 0}, {4754, 6, 0}, {4761, 7, 0},
+        {4769, 11, 0}, {4781, 14, 0}, {4796, 9, 0}, {4806, 14, 0}, {4821, 11, 0}, {4833, 13, 0}, {4847, 10, 0}, {4858, 15, 0},
+        {4874, 28, 0}, {4903, 20, 0}, {4924, 18, 0}, {4943, 15, 0}, {4959, 8, 0}, {4968, 8, 0}, {4977, 17, 0}, {4995, 10, 0},
+        {5006, 16, 0}, {5023, 7, 0}, {5031, 7, 0}, {5039, 14, 0}, {5054, 14, 0}, {5069, 19, 0}, {5089, 7, 0}, {5097, 14, 0},
+        {5112, 10, 0}, {5123, 5, 0}, {5129, 5, 0}, {5135, 4, 0}, {5140, 6, 0}, {5147, 7, 0}, {5155, 8, 0}, {5164, 9, 0},
+        {5174, 5, 0}, {5180, 9, 0}, {5190, 17, 0}, {5208, 8, 0}, {5217, 5, 0}, {5223, 18, 0}, {5242, 5, 0}, {5248, 12, 0},
+        {5261, 11, 0}, {5273, 4, 0}, {5278, 8, 0}, {5287, 20, 0}, {5308, 16, 0}, {5325, 12, 0}, {5338, 8, 0}, {5347, 11, 0},
+        {5359, 10, 0}, {5370, 13, 0}, {5384, 7, 0}, {5392, 13, 0}, {5406, 6, 0}, {5413, 8, 0}, {5422, 13, 0}, {5436, 14, 0},
+        {5451, 5, 0}, {5457, 7, 0}, {5465, 8, 0}, {5474, 9, 0}, {5484, 8, 0}, {5493, 4, 0}, {5498, 12, 0}, {5511, 11, 0},
+        {5523, 9, 0}, {5533, 7, 0}, {5541, 8, 0}, {5550, 14, 0}, {5565, 8, 0}, {5574, 4, 0}, {5579, 8, 0}, {5588, 7, 0},
+        {5596, 9, 0}, {5606, 7, 0}, {5614, 8, 0}, {5623, 8, 0}, {5632, 12, 0}, {5645, 10, 0}, {5656, 12, 0}, {5669, 8, 0},
+        {5678, 6, 0}, {5685, 5, 0}, {5691, 4, 0}, {5696, 9, 0}, {5706, 8, 0}, {5715, 7, 0}, {5723, 6, 0}, {5730, 8, 0},
+        {5739, 6, 0}, {5746, 7, 0}, {5754, 10, 0}, {5765, 7, 0}, {5773, 10, 0}, {5784, 5, 0}, {5790, 6, 0}, {5797, 16, 0},
+        {5814, 7, 0}, {5822, 7, 0}, {5830, 6, 0}, {5837, 12, 0}, {5850, 8, 0}, {5859, 25, 0}, {5885, 12, 0}, {5898, 8, 0},
+        {5907, 13, 0}, {5921, 11, 0}, {5933, 20, 0}, {5954, 5, 0}, {5960, 21, 0}, {5982, 7, 0}, {5990, 5, 0}, {5996, 9, 0},
+        {6006, 6, 0}, {6013, 3, 0}, {6017, 24, 0}, {6042, 7, 0}, {6050, 6, 0}, {6057, 21, 0}, {6079, 6, 0}, {6086, 16, 0},
+        {6103, 18, 0}, {6122, 10, 0}, {6133, 15, 0}, {6149, 29, 0}, {6179, 25, 0}, {6205, 26, 0}, {6232, 16, 0}, {6249, 8, 0},
+        {6258, 8, 0}, {6267, 16, 0}, {6284, 14, 0}, {6299, 14, 0}, {6314, 12, 0}, {6327, 11, 0}, {6339, 15, 0}, {6355, 15, 0},
+        {6371, 12, 0}, {6384, 13, 0}, {6398, 13, 0}, {6412, 14, 0}, {6427, 16, 0}, {6444, 13, 0}, {6458, 16, 0}, {6475, 13, 0},
+        {6489, 15, 0}, {6505, 17, 0}, {6523, 15, 0}, {6539, 15, 0}, {6555, 12, 0}, {6568, 15, 0}, {6584, 14, 0}, {6599, 14, 0},
+        {6614, 17, 0}, {6632, 11, 0}, {6644, 16, 0}, {6661, 13, 0}, {6675, 16, 0}, {6692, 14, 0}, {6707, 15, 0}, {6723, 16, 0},
+        {6740, 23, 0}, {6764, 13, 0}, {6778, 18, 0}, {6797, 17, 0}, {6815, 22, 0}, {6838, 12, 0}, {6851, 12, 0}, {6864, 16, 0},
+        {6881, 15, 0}, {6897, 16, 0}, {6914, 9, 0}, {6924, 22, 0}, {6947, 15, 0}, {6963, 18, 0}, {6982, 13, 0}, {6996, 14, 0},
+        {7011, 13, 0}, {7025, 12, 0}, {7038, 17, 0}, {7056, 13, 0}, {7070, 13, 0}, {7084, 18, 0}, {7103, 17, 0}, {7121, 16, 0},
+        {7138, 14, 0}, {7153, 18, 0}, {7172, 12, 0}, {7185, 11, 0}, {7197, 18, 0}, {7216, 15, 0}, {7232, 14, 0}, {7247, 10, 0},
+        {7258, 13, 0}, {7272, 16, 0}, {7289, 14, 0}, {7304, 14, 0}, {7319, 14, 0}, {7334, 15, 0}, {7350, 14, 0}, {7365, 24, 0},
+        {7390, 15, 0}, {7406, 11, 0}, {7418, 14, 0}, {7433, 16, 0}, {7450, 6, 0}, {7457, 6, 0}, {7464, 18, 0}, {7483, 8, 0},
+        {7492, 7, 0}, {7500, 7, 0}, {7508, 6, 0}, {7515, 11, 0}, {7527, 9, 0}, {7537, 8, 0}, {7546, 7, 0}, {7554, 6, 0},
+        {7561, 5, 0}, {7567, 8, 0}, {7576, 8, 0}, {7585, 6, 0}, {7592, 7, 0}, {7600, 5, 0}, {7606, 7, 0}, {7614, 9, 0},
+        {7624, 5, 0}, {7630, 5, 0}, {7636, 5, 0}, {7642, 7, 0}, {7650, 7, 0}, {7658, 10, 0}, {7669, 14, 0}, {7684, 12, 0},
+        {7697, 5, 0}, {7703, 14, 0}, {7718, 7, 0}, {7726, 6, 0}, {7733, 6, 0}, {7740, 5, 0}, {7746, 5, 0}, {7752, 7, 0},
+        {7760, 8, 0}, {7769, 15, 0}, {7785, 5, 0}, {7791, 36, 0}, {7828, 17, 0}, {7846, 10, 0}, {7857, 13, 0}, {7871, 9, 0},
+        {7881, 5, 0},
+};
+
+static char TERRITORY_NAMES_UNPACKED_EN[7887];
+
+static const PackedTerritoryNames PACKED_TERRITORY_NAMES_EN = {
+        TERRITORY_NAMES_UNPACKED_EN, 7887, TERRITORY_NAMES_PACKED_EN, 3882, TERRITORY_NAMES_PAIRS_EN,
+        TERRITORY_NAME_ALTERNATIVES_START_EN, TERRITORY_NAME_ALTERNATIVES_EN};
+
+#else
+
+static const PackedTerritoryNames PACKED_TERRITORY_NAMES_EN = {NULL, 0, NULL, 0, NULL, NULL, NULL};
+
+#endif // MAPCODE_SUPPORT_LANGUAGE_EN
+
+#ifdef MAPCODE_SUPPORT_LANGUAGE_ES // Spanish
+
+// 7051 bytes, packed to 3469
+static const unsigned char TERRITORY_NAMES_PACKED_ES[3469] = {
+        86, 43, 234, 111, 124, 67, 105, 155, 28, 32, 58, 86, 43, 234, 111, 124, 83, 185, 5, 83, 101, 4, 63, 224,
+        131, 17, 71, 190, 181, 116, 11, 52, 111, 107, 53, 188, 192, 242, 99, 41, 124, 51, 75, 101, 53, 152, 238, 66,
+        11, 116, 54, 133, 166, 0, 78, 97, 23, 117, 52, 117, 118, 8, 117, 63, 131, 188, 57, 12, 116, 32, 77, 97,
+        11, 116, 20, 238, 215, 116, 62, 26, 140, 102, 54, 107, 139, 80, 104, 135, 108, 132, 32, 27, 50, 124, 105, 22,
+        42, 80, 104, 135, 108, 132, 124, 105, 22, 42, 140, 102, 54, 107, 192, 80, 40, 99, 97, 126, 26, 27, 5, 66,
+        111, 117, 118, 143, 192, 66, 14, 109, 155, 3, 124, 66, 14, 109, 155, 3, 227, 37, 187, 40, 237, 10, 37, 58,
+        245, 166, 2, 37, 195, 141, 201, 235, 83, 95, 215, 12, 17, 125, 14, 110, 60, 101, 121, 144, 110, 219, 135, 137,
+        18, 116, 115, 128, 43, 0, 74, 14, 115, 101, 121, 0, 27, 42, 78, 200, 178, 28, 0, 87, 8, 108, 96, 139,
+        70, 164, 134, 148, 70, 164, 134, 207, 86, 62, 114, 103, 20, 239, 187, 40, 237, 10, 127, 76, 105, 189, 104, 116,
+        20, 21, 101, 12, 144, 223, 98, 207, 215, 154, 8, 108, 57, 29, 111, 5, 241, 14, 234, 207, 242, 111, 107, 238,
+        80, 101, 100, 114, 37, 49, 77, 105, 222, 53, 224, 124, 77, 105, 222, 53, 203, 78, 105, 117, 35, 83, 95, 67,
+        114, 150, 136, 98, 8, 139, 78, 105, 101, 118, 60, 124, 216, 118, 96, 192, 67, 97, 180, 59, 66, 18, 97, 126,
+        101, 44, 32, 83, 116, 32, 69, 182, 43, 117, 96, 139, 83, 146, 148, 83, 146, 148, 83, 95, 69, 182, 97, 222,
+        105, 17, 77, 8, 100, 105, 118, 3, 57, 185, 5, 72, 53, 20, 97, 44, 32, 65, 115, 99, 20, 115, 105, 224,
+        139, 84, 114, 150, 237, 32, 100, 171, 134, 104, 148, 65, 115, 99, 20, 115, 105, 224, 124, 84, 114, 150, 95, 100,
+        171, 134, 104, 137, 8, 116, 1, 174, 2, 28, 207, 86, 62, 114, 103, 20, 60, 19, 69, 69, 46, 85, 85, 63,
+        142, 191, 116, 35, 83, 118, 8, 98, 11, 100, 139, 74, 95, 77, 142, 20, 124, 74, 95, 77, 142, 20, 238, 86,
+        10, 210, 101, 139, 108, 30, 174, 2, 28, 12, 3, 124, 174, 2, 28, 12, 127, 51, 72, 101, 11, 100, 139, 77,
+        99, 68, 18, 8, 100, 124, 51, 77, 99, 68, 18, 8, 100, 184, 11, 98, 28, 41, 144, 163, 105, 219, 5, 49,
+        66, 11, 98, 155, 148, 66, 11, 98, 155, 156, 23, 249, 97, 17, 83, 101, 121, 99, 104, 53, 108, 60, 206, 8,
+        188, 192, 215, 220, 30, 194, 35, 65, 201, 13, 114, 1, 125, 29, 0, 27, 42, 77, 2, 57, 185, 5, 76, 254,
+        62, 137, 10, 114, 18, 60, 105, 148, 243, 28, 212, 70, 101, 4, 114, 28, 41, 19, 77, 10, 114, 18, 60, 7,
+        83, 152, 199, 23, 52, 145, 1, 68, 133, 12, 10, 1, 66, 153, 114, 101, 12, 168, 126, 190, 43, 25, 51, 84,
+        23, 99, 30, 49, 67, 97, 10, 41, 124, 51, 67, 97, 10, 41, 57, 185, 37, 84, 133, 166, 139, 80, 114, 62,
+        110, 99, 132, 101, 124, 80, 114, 62, 110, 99, 132, 35, 72, 145, 32, 75, 145, 63, 11, 116, 12, 10, 207, 70,
+        11, 111, 35, 125, 28, 8, 117, 112, 35, 67, 133, 13, 3, 63, 97, 23, 10, 105, 17, 34, 134, 105, 203, 76,
+        117, 120, 218, 98, 23, 103, 17, 83, 29, 111, 1, 71, 101, 13, 103, 149, 172, 139, 108, 30, 51, 83, 50, 119,
+        236, 32, 172, 124, 51, 83, 50, 119, 236, 32, 172, 206, 54, 12, 60, 149, 102, 114, 2, 99, 166, 115, 229, 146,
+        37, 86, 14, 4, 52, 114, 12, 178, 28, 139, 84, 111, 98, 162, 111, 124, 84, 111, 98, 162, 17, 187, 134, 101,
+        25, 84, 105, 128, 30, 228, 60, 139, 65, 163, 24, 114, 116, 10, 30, 70, 114, 2, 99, 60, 127, 80, 117, 14,
+        116, 37, 82, 235, 130, 132, 114, 35, 76, 62, 98, 2, 17, 74, 29, 97, 10, 1, 71, 211, 7, 75, 43, 11,
+        192, 77, 8, 118, 12, 127, 86, 2, 117, 43, 117, 63, 18, 116, 20, 250, 114, 17, 66, 153, 29, 3, 52, 180,
+        13, 32, 246, 105, 210, 8, 57, 119, 249, 135, 50, 7, 75, 117, 119, 97, 40, 192, 70, 105, 106, 25, 165, 171,
+        8, 101, 100, 209, 69, 22, 91, 20, 7, 73, 115, 61, 53, 227, 37, 80, 8, 101, 21, 12, 17, 69, 36, 83,
+        8, 118, 28, 13, 184, 53, 10, 35, 68, 106, 190, 111, 164, 25, 109, 131, 101, 100, 209, 82, 117, 50, 1, 72,
+        97, 40, 62, 184, 23, 134, 100, 25, 125, 12, 101, 5, 69, 99, 117, 43, 193, 8, 144, 108, 98, 151, 51, 83,
+        8, 133, 203, 65, 114, 109, 20, 7, 76, 60, 191, 17, 66, 166, 108, 103, 10, 137, 54, 100, 200, 7, 125, 12,
+        101, 97, 45, 66, 96, 115, 188, 52, 97, 105, 119, 59, 66, 164, 59, 83, 117, 221, 1, 80, 97, 62, 115, 239,
+        66, 198, 41, 230, 12, 29, 11, 99, 1, 243, 209, 48, 5, 68, 133, 12, 234, 1, 69, 22, 91, 97, 222, 7,
+        242, 21, 5, 82, 10, 1, 66, 41, 110, 149, 49, 72, 14, 122, 250, 91, 12, 156, 114, 111, 131, 7, 84, 111,
+        103, 17, 76, 143, 209, 76, 40, 117, 151, 83, 114, 105, 32, 76, 2, 107, 1, 71, 101, 13, 103, 7, 244, 252,
+        232, 105, 128, 5, 76, 101, 18, 1, 80, 2, 29, 24, 0, 48, 5, 130, 189, 1, 125, 142, 2, 5, 102, 114,
+        2, 99, 166, 115, 0, 69, 109, 126, 43, 212, 195, 129, 61, 98, 239, 85, 110, 178, 41, 144, 182, 114, 7, 65,
+        122, 14, 98, 97, 105, 121, 59, 83, 14, 98, 7, 74, 13, 100, 59, 80, 13, 116, 117, 103, 8, 167, 134, 103,
+        114, 62, 156, 13, 101, 5, 172, 0, 27, 50, 7, 125, 43, 218, 8, 156, 117, 98, 1, 66, 117, 108, 103, 11,
+        7, 76, 190, 14, 7, 72, 18, 100, 23, 127, 66, 20, 12, 0, 69, 114, 40, 114, 101, 1, 109, 8, 97, 119,
+        25, 67, 13, 101, 5, 194, 35, 78, 10, 11, 162, 117, 1, 174, 189, 7, 84, 142, 105, 107, 225, 66, 138, 108,
+        97, 208, 0, 216, 112, 8, 52, 31, 110, 101, 122, 57, 23, 12, 29, 35, 85, 223, 219, 142, 229, 211, 111, 121,
+        232, 126, 7, 83, 20, 250, 8, 168, 126, 219, 225, 66, 105, 53, 13, 223, 115, 7, 125, 142, 2, 1, 76, 97,
+        41, 0, 82, 117, 109, 151, 71, 104, 2, 1, 85, 103, 50, 1, 34, 12, 37, 85, 110, 178, 111, 124, 69, 115,
+        99, 111, 217, 148, 174, 95, 187, 143, 97, 195, 177, 148, 244, 252, 5, 194, 101, 124, 244, 252, 97, 44, 32, 183,
+        35, 125, 12, 101, 1, 69, 99, 117, 28, 13, 57, 153, 11, 5, 245, 217, 4, 163, 8, 124, 83, 153, 11, 188,
+        25, 71, 146, 203, 226, 90, 53, 50, 1, 66, 23, 107, 12, 5, 70, 3, 17, 70, 135, 132, 12, 127, 73, 116,
+        8, 7, 79, 109, 59, 80, 54, 209, 242, 21, 42, 215, 102, 135, 0, 140, 94, 103, 137, 8, 3, 7, 86, 105,
+        143, 110, 29, 0, 70, 12, 252, 7, 67, 145, 111, 45, 66, 61, 122, 122, 200, 135, 108, 35, 196, 218, 151, 74,
+        199, 203, 90, 180, 98, 146, 117, 35, 80, 11, 162, 117, 142, 0, 73, 61, 107, 63, 11, 114, 94, 99, 41, 0,
+        85, 122, 98, 101, 107, 225, 83, 94, 99, 7, 80, 199, 31, 5, 226, 125, 12, 101, 156, 29, 14, 31, 26, 84,
+        23, 107, 109, 20, 225, 69, 115, 112, 97, 195, 177, 233, 97, 135, 50, 7, 89, 218, 20, 0, 70, 114, 2, 99,
+        7, 51, 196, 50, 168, 20, 7, 66, 191, 115, 119, 2, 137, 28, 162, 3, 99, 11, 0, 85, 99, 114, 151, 83,
+        155, 237, 32, 172, 0, 48, 171, 210, 114, 111, 97, 102, 114, 234, 232, 133, 8, 7, 65, 102, 103, 2, 225, 77,
+        121, 2, 109, 11, 124, 66, 126, 109, 151, 90, 211, 7, 130, 135, 35, 84, 23, 222, 62, 1, 80, 176, 225, 77,
+        111, 122, 211, 105, 222, 35, 78, 29, 190, 7, 86, 20, 101, 122, 117, 53, 1, 78, 105, 103, 14, 7, 84, 2,
+        122, 151, 69, 103, 132, 116, 17, 77, 97, 23, 40, 151, 66, 54, 105, 118, 7, 69, 116, 105, 111, 112, 62, 156,
+        54, 133, 98, 7, 83, 155, 24, 102, 114, 10, 137, 8, 62, 144, 110, 103, 54, 1, 78, 62, 103, 14, 0, 130,
+        28, 206, 14, 31, 63, 145, 54, 7, 244, 59, 76, 190, 7, 83, 155, 59, 73, 201, 18, 60, 7, 68, 150, 114,
+        40, 37, 70, 101, 4, 181, 52, 108, 97, 120, 99, 8, 137, 13, 53, 41, 144, 219, 3, 99, 8, 105, 210, 60,
+        229, 54, 180, 1, 81, 117, 14, 143, 11, 17, 72, 178, 8, 103, 17, 243, 28, 253, 77, 166, 120, 235, 84, 146,
+        3, 99, 17, 78, 142, 11, 40, 0, 125, 2, 198, 117, 43, 17, 80, 94, 6, 1, 89, 254, 43, 59, 81, 117,
+        12, 116, 2, 5, 82, 111, 17, 83, 12, 8, 111, 156, 29, 112, 189, 104, 35, 77, 236, 111, 131, 59, 83, 95,
+        76, 117, 96, 32, 80, 191, 41, 62, 0, 125, 128, 14, 17, 165, 37, 76, 101, 18, 184, 198, 171, 8, 105, 102,
+        13, 110, 7, 86, 14, 131, 223, 122, 0, 130, 105, 199, 127, 66, 198, 171, 8, 105, 102, 13, 110, 149, 160, 0,
+        90, 131, 43, 189, 127, 74, 8, 96, 99, 17, 84, 29, 188, 108, 132, 127, 79, 97, 120, 131, 1, 68, 23, 138,
+        17, 242, 153, 117, 135, 232, 18, 13, 1, 130, 105, 104, 117, 153, 117, 233, 105, 128, 5, 86, 14, 4, 144, 61,
+        98, 149, 83, 97, 155, 40, 156, 145, 111, 45, 75, 12, 154, 3, 170, 114, 103, 53, 7, 75, 249, 198, 21, 59,
+        65, 114, 103, 210, 12, 1, 68, 29, 95, 49, 68, 105, 117, 230, 28, 114, 5, 49, 78, 162, 11, 32, 72, 200,
+        53, 25, 130, 50, 105, 103, 11, 104, 144, 201, 29, 95, 49, 78, 10, 111, 98, 11, 0, 76, 176, 154, 28, 119,
+        101, 101, 112, 124, 76, 97, 113, 94, 100, 105, 118, 127, 68, 53, 104, 25, 77, 250, 104, 8, 142, 1, 78, 162,
+        8, 50, 63, 2, 132, 23, 52, 114, 132, 23, 137, 221, 13, 29, 57, 105, 107, 107, 180, 206, 134, 106, 146, 167,
+        11, 121, 2, 170, 114, 134, 255, 8, 32, 247, 144, 115, 115, 29, 184, 105, 104, 11, 0, 85, 116, 116, 11, 176,
+        104, 50, 0, 71, 111, 1, 75, 14, 8, 233, 29, 105, 36, 78, 28, 117, 167, 180, 255, 8, 32, 247, 0, 74,
+        29, 109, 117, 139, 67, 255, 218, 126, 1, 130, 104, 43, 116, 96, 103, 11, 104, 0, 74, 104, 11, 107, 104, 50,
+        168, 11, 110, 43, 176, 1, 82, 198, 15, 104, 157, 79, 100, 96, 104, 148, 246, 96, 115, 1, 125, 106, 11, 43,
+        184, 20, 103, 8, 5, 245, 217, 4, 163, 8, 63, 28, 104, 121, 5, 247, 52, 53, 138, 2, 170, 201, 104, 114,
+        5, 247, 63, 153, 11, 3, 104, 116, 114, 1, 85, 116, 116, 11, 32, 247, 206, 155, 254, 104, 128, 121, 0, 226,
+        71, 8, 239, 172, 227, 253, 108, 171, 199, 40, 8, 32, 228, 220, 148, 228, 105, 95, 67, 199, 40, 8, 32, 84,
+        202, 13, 121, 227, 253, 74, 14, 118, 96, 32, 66, 142, 227, 37, 194, 35, 228, 149, 172, 52, 3, 109, 151, 86,
+        10, 116, 13, 7, 228, 149, 245, 217, 4, 163, 8, 0, 81, 94, 20, 22, 50, 230, 150, 114, 40, 37, 70, 101,
+        4, 181, 57, 14, 103, 132, 35, 196, 162, 111, 127, 82, 105, 253, 74, 2, 101, 126, 17, 69, 115, 112, 126, 40,
+        37, 83, 185, 17, 82, 105, 37, 174, 2, 9, 100, 37, 183, 35, 80, 11, 97, 190, 232, 185, 171, 43, 11, 12,
+        1, 80, 14, 110, 211, 254, 17, 241, 199, 24, 229, 101, 11, 170, 99, 114, 35, 80, 11, 2, 24, 0, 82, 13,
+        97, 180, 1, 82, 18, 100, 209, 83, 97, 37, 80, 188, 108, 17, 80, 105, 188, 25, 84, 111, 99, 185, 12, 115,
+        0, 82, 105, 37, 174, 2, 9, 100, 37, 83, 117, 108, 63, 11, 97, 195, 177, 203, 71, 111, 105, 3, 63, 43,
+        37, 174, 41, 115, 37, 100, 37, 83, 117, 108, 184, 153, 7, 77, 12, 30, 71, 14, 97, 96, 63, 43, 37, 174,
+        41, 115, 17, 80, 11, 131, 170, 109, 249, 18, 127, 68, 150, 114, 40, 253, 67, 54, 117, 109, 98, 7, 82, 104,
+        111, 9, 27, 50, 230, 53, 97, 119, 11, 35, 67, 18, 110, 189, 116, 10, 164, 0, 216, 119, 32, 74, 14, 115,
+        101, 121, 0, 226, 72, 29, 112, 154, 126, 35, 86, 14, 109, 18, 116, 63, 3, 115, 255, 117, 115, 143, 116, 115,
+        167, 97, 119, 97, 25, 215, 121, 252, 0, 86, 126, 103, 12, 149, 245, 217, 4, 163, 8, 229, 11, 54, 12, 5,
+        172, 63, 97, 12, 35, 73, 201, 220, 1, 75, 210, 254, 107, 121, 52, 20, 110, 60, 115, 35, 86, 126, 103, 12,
+        7, 79, 104, 105, 17, 80, 20, 115, 135, 118, 151, 77, 96, 96, 132, 62, 0, 76, 117, 96, 220, 170, 108, 146,
+        29, 170, 114, 107, 2, 115, 127, 67, 11, 54, 12, 5, 194, 35, 226, 89, 13, 107, 0, 73, 111, 119, 1, 73,
+        108, 108, 12, 111, 96, 0, 71, 101, 13, 103, 7, 87, 96, 99, 18, 115, 12, 0, 70, 108, 13, 178, 137, 96,
+        23, 25, 79, 107, 108, 153, 133, 1, 68, 176, 191, 5, 194, 35, 87, 3, 104, 152, 116, 18, 230, 176, 191, 5,
+        172, 0, 216, 98, 114, 3, 107, 1, 75, 2, 115, 127, 73, 100, 153, 17, 85, 116, 153, 63, 12, 110, 60, 191,
+        137, 236, 105, 103, 157, 87, 121, 133, 152, 0, 246, 250, 203, 67, 54, 13, 28, 17, 216, 118, 28, 170, 114, 221,
+        18, 1, 165, 37, 77, 101, 120, 235, 77, 18, 116, 2, 156, 8, 105, 102, 13, 110, 7, 84, 101, 120, 127, 196,
+        3, 107, 156, 54, 117, 109, 98, 149, 187, 40, 237, 10, 170, 108, 98, 14, 116, 1, 79, 163, 11, 105, 17, 81,
+        94, 98, 189, 57, 3, 107, 43, 99, 104, 101, 119, 2, 63, 2, 40, 111, 98, 233, 128, 2, 91, 1, 165, 37,
+        187, 134, 115, 119, 10, 107, 0, 226, 69, 115, 99, 111, 99, 7, 27, 5, 58, 80, 114, 62, 110, 99, 132, 101,
+        32, 69, 100, 117, 11, 100, 17, 89, 117, 107, 18, 227, 212, 58, 140, 111, 101, 21, 35, 78, 134, 200, 164, 0,
+        73, 201, 7, 228, 7, 187, 3, 135, 0, 85, 83, 65, 124, 243, 28, 212, 85, 110, 178, 41, 19, 241, 166, 114,
+        10, 148, 241, 166, 114, 10, 137, 166, 106, 235, 77, 41, 99, 31, 238, 80, 143, 14, 115, 98, 23, 103, 17, 75,
+        8, 12, 152, 114, 28, 158, 92, 73, 110, 219, 154, 143, 7, 92, 65, 100, 121, 103, 101, 1, 92, 79, 115, 143,
+        149, 194, 101, 45, 196, 151, 92, 75, 146, 11, 100, 12, 111, 45, 66, 8, 107, 11, 0, 48, 5, 75, 11, 255,
+        142, 45, 130, 14, 107, 60, 115, 0, 48, 5, 130, 189, 104, 20, 1, 92, 130, 117, 118, 3, 104, 205, 73, 118,
+        2, 91, 17, 56, 76, 132, 143, 93, 0, 246, 121, 111, 36, 64, 52, 117, 108, 5, 123, 66, 53, 103, 13, 111,
+        100, 158, 86, 108, 28, 180, 126, 158, 56, 75, 23, 93, 168, 8, 117, 103, 5, 123, 56, 84, 211, 91, 0, 197,
+        187, 121, 2, 93, 0, 89, 11, 111, 22, 200, 36, 123, 82, 121, 249, 95, 123, 56, 65, 21, 61, 107, 104, 157,
+        197, 77, 41, 99, 31, 0, 197, 83, 109, 54, 20, 93, 231, 68, 162, 94, 21, 59, 56, 86, 13, 18, 101, 122,
+        104, 205, 78, 91, 103, 13, 111, 100, 205, 80, 93, 91, 168, 111, 21, 114, 133, 5, 64, 57, 116, 200, 114, 111,
+        112, 111, 36, 204, 75, 114, 3, 110, 111, 100, 11, 32, 204, 92, 75, 8, 109, 121, 107, 7, 197, 84, 118, 14,
+        0, 197, 76, 20, 152, 114, 28, 17, 56, 82, 111, 21, 91, 205, 86, 54, 103, 111, 103, 114, 28, 17, 56, 86,
+        54, 111, 103, 100, 137, 23, 109, 2, 248, 92, 67, 11, 53, 7, 78, 20, 143, 115, 32, 65, 164, 224, 133, 5,
+        79, 107, 223, 103, 231, 75, 133, 25, 65, 114, 107, 104, 138, 53, 248, 92, 77, 13, 100, 91, 7, 56, 78, 221,
+        104, 110, 49, 78, 91, 103, 13, 111, 100, 206, 20, 122, 5, 123, 56, 75, 126, 91, 63, 11, 105, 32, 69, 36,
+        39, 117, 38, 0, 246, 20, 98, 23, 103, 158, 85, 108, 121, 2, 91, 248, 80, 14, 109, 32, 204, 92, 66, 3,
+        104, 107, 13, 116, 111, 21, 59, 92, 85, 100, 109, 23, 116, 231, 84, 43, 11, 21, 59, 83, 29, 11, 5, 123,
+        56, 83, 11, 43, 91, 0, 89, 29, 8, 111, 45, 78, 20, 143, 115, 168, 104, 185, 121, 45, 77, 2, 115, 25,
+        56, 83, 118, 14, 100, 108, 91, 93, 52, 121, 117, 109, 20, 158, 197, 75, 23, 103, 157, 130, 53, 121, 146, 12,
+        248, 92, 66, 23, 105, 43, 7, 90, 146, 142, 107, 8, 93, 49, 204, 56, 244, 107, 164, 93, 205, 78, 91, 41,
+        190, 126, 93, 52, 133, 248, 197, 79, 109, 93, 231, 75, 104, 176, 3, 115, 7, 56, 75, 218, 14, 91, 17, 92,
+        196, 116, 97, 25, 175, 105, 19, 196, 116, 97, 25, 84, 117, 118, 5, 39, 117, 38, 168, 114, 3, 110, 111, 121,
+        11, 93, 32, 204, 56, 77, 162, 28, 157, 130, 117, 107, 191, 107, 5, 79, 107, 223, 103, 168, 29, 99, 104, 43,
+        107, 5, 204, 56, 83, 198, 8, 62, 26, 80, 114, 180, 13, 93, 49, 204, 64, 32, 97, 164, 224, 133, 37, 106,
+        155, 62, 17, 175, 105, 19, 74, 146, 24, 114, 91, 93, 205, 241, 23, 231, 83, 176, 104, 148, 92, 89, 176, 164,
+        7, 67, 2, 28, 24, 0, 82, 117, 115, 7, 76, 108, 101, 118, 11, 32, 5, 108, 5, 102, 117, 14, 122, 233,
+        220, 106, 12, 184, 101, 105, 106, 152, 167, 97, 12, 157, 78, 152, 120, 149, 72, 117, 25, 130, 145, 113, 152, 0,
+        90, 104, 101, 106, 251, 0, 74, 251, 115, 117, 0, 70, 117, 106, 220, 144, 110, 104, 117, 25, 76, 105, 97, 18,
+        152, 57, 104, 50, 145, 57, 104, 2, 120, 25, 74, 251, 120, 25, 72, 20, 157, 125, 221, 104, 111, 117, 0, 112,
+        114, 91, 12, 217, 42, 125, 138, 100, 145, 167, 117, 98, 101, 25, 74, 135, 12, 167, 101, 98, 101, 25, 83, 104,
+        97, 2, 120, 25, 216, 105, 32, 77, 145, 54, 124, 77, 145, 54, 149, 73, 163, 14, 105, 13, 167, 101, 135, 145,
+        106, 251, 167, 134, 157, 125, 138, 120, 105, 32, 90, 104, 117, 138, 57, 236, 117, 157, 89, 134, 110, 157, 88, 221,
+        138, 124, 84, 62, 98, 143, 0, 71, 2, 115, 117, 0, 81, 152, 104, 97, 25, 88, 12, 106, 251, 32, 85, 121,
+        103, 104, 23, 0, 130, 12, 207, 109, 20, 13, 239, 8, 101, 106, 28, 3, 19, 108, 212, 243, 28, 212, 85, 110,
+        178, 41, 0, 27, 171, 108, 132, 112, 14, 116, 18, 144, 163, 24, 114, 116, 178, 1, 73, 163, 14, 110, 131, 105,
+        18, 8, 124, 77, 134, 100, 105, 8, 124, 84, 105, 128, 1,
+};
+
+static const unsigned char TERRITORY_NAMES_PAIRS_ES[256][2] = {
+        {0, 0}, {97, 0}, {97, 110}, {97, 115}, {100, 101}, {97, 32}, {98, 108}, {105, 1}, {97, 108}, {4, 32}, {105, 99}, {97, 114},
+        {105, 110}, {111, 114}, {101, 114}, {3, 116}, {6, 15}, {111, 0}, {111, 110}, {32, 9}, {101, 110}, {115, 116}, {115, 108}, {117, 114},
+        {195, 161}, {105, 0}, {110, 0}, {73, 22}, {97, 100}, {97, 109}, {3, 32}, {195, 186}, {32, 32}, {16, 19}, {82, 101}, {101, 0},
+        {108, 32}, {111, 32}, {6, 10}, {34, 112}, {105, 116}, {111, 115}, {5, 9}, {97, 116}, {44, 44}, {45, 45}, {46, 46}, {31, 38},
+        {39, 47}, {121, 32}, {2, 100}, {27, 30}, {0, 84}, {101, 108}, {111, 108}, {147, 33}, {195, 55}, {0, 83}, {4, 36}, {24, 26},
+        {101, 115}, {114, 97}, {195, 173}, {0, 77}, {79, 16}, {65, 65}, {66, 66}, {67, 67}, {68, 68}, {69, 69}, {70, 70}, {71, 71},
+        {72, 72}, {73, 73}, {74, 74}, {75, 75}, {76, 76}, {77, 77}, {78, 78}, {79, 79}, {80, 80}, {81, 81}, {82, 82}, {83, 83},
+        {84, 84}, {85, 85}, {86, 86}, {87, 87}, {88, 88}, {89, 89}, {90, 90}, {111, 118}, {48, 42}, {115, 107}, {117, 101}, {2, 32},
+        {105, 115}, {97, 97}, {98, 98}, {99, 99}, {100, 100}, {101, 101}, {102, 102}, {103, 103}, {104, 104}, {105, 105}, {106, 106}, {107, 107},
+        {108, 108}, {109, 109}, {110, 110}, {111, 111}, {112, 112}, {113, 113}, {114, 114}, {115, 115}, {116, 116}, {117, 117}, {118, 118}, {119, 119},
+        {120, 120}, {121, 121}, {122, 122}, {64, 0}, {124, 124}, {71, 117}, {105, 114}, {3, 0}, {14, 114}, {129, 129}, {67, 104}, {97, 99},
+        {105, 112}, {111, 109}, {117, 110}, {105, 108}, {195, 179}, {1, 77}, {2, 103}, {32, 49}, {78, 13}, {141, 141}, {97, 121}, {101, 116},
+        {0, 65}, {18, 103}, {97, 98}, {147, 147}, {97, 124}, {105, 5}, {105, 21}, {2, 7}, {12, 103}, {97, 104}, {115, 104}, {117, 100},
+        {1, 67}, {2, 0}, {32, 123}, {78, 94}, {83, 23}, {161, 161}, {97, 103}, {110, 116}, {117, 116}, {159, 118}, {195, 169}, {0, 72},
+        {0, 75}, {169, 169}, {1, 65}, {5, 67}, {58, 160}, {173, 173}, {71, 114}, {75, 61}, {97, 107}, {177, 177}, {105, 100}, {179, 179},
+        {105, 109}, {114, 8}, {117, 21}, {140, 116}, {0, 66}, {2, 116}, {186, 186}, {66, 114}, {97, 117}, {101, 99}, {105, 98}, {111, 116},
+        {0, 51}, {13, 105}, {58, 183}, {195, 195}, {65, 108}, {79, 33}, {97, 106}, {97, 112}, {97, 118}, {110, 100}, {128, 40}, {136, 26},
+        {175, 25}, {0, 56}, {0, 80}, {1, 51}, {4, 154}, {18, 7}, {20, 116}, {29, 98}, {41, 32}, {52, 202}, {65, 182}, {77, 11},
+        {78, 101}, {99, 105}, {101, 109}, {103, 117}, {105, 2}, {105, 122}, {113, 117}, {114, 117}, {136, 110}, {150, 59}, {165, 5}, {213, 193},
+        {214, 181}, {0, 67}, {0, 68}, {0, 92}, {1, 83}, {1, 84}, {10, 2}, {10, 17}, {10, 104}, {24, 110}, {57, 95}, {60, 32},
+        {61, 208}, {65, 109}, {67, 111}, {69, 21}, {73, 114}, {79, 99}, {79, 114}, {80, 240}, {93, 158}, {97, 122}, {101, 103}, {105, 138},
+        {108, 50}, {111, 19}, {117, 99}, {131, 104},
+};
+
+static const unsigned short TERRITORY_NAME_ALTERNATIVES_START_ES[_TERRITORY_MAX - _TERRITORY_MIN] = {
+        0, 3, 4, 5, 6, 8, 9, 10, 11, 12, 13, 14, 17, 18, 19, 21,
+        22, 23, 24, 25, 26, 27, 28, 30, 31, 32, 33, 34, 35, 36, 38, 39,
+        41, 42, 45, 46, 49, 50, 51, 52, 53, 55, 57, 59, 60, 62, 63, 64,
+        65, 66, 67, 68, 69, 70, 72, 73, 74, 75, 76, 77, 79, 81, 82, 83,
+        84, 85, 86, 87, 88, 89, 90, 92, 93, 94, 96, 97, 98, 99, 100, 101,
+        102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117,
+        118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132, 133,
+        134, 135, 136, 137, 138, 139, 140, 141, 142, 143, 144, 145, 146, 147, 148, 149,
+        150, 151, 152, 153, 154, 155, 156, 157, 158, 159, 160, 161, 162, 163, 164, 165,
+        166, 167, 168, 169, 170, 171, 172, 173, 174, 175, 176, 177, 178, 179, 180, 181,
+        182, 183, 184, 185, 186, 187, 188, 193, 194, 195, 197, 198, 199, 200, 201, 202,
+        203, 204, 205, 206, 207, 208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218,
+        219, 220, 221, 222, 223, 224, 225, 226, 227, 228, 229, 230, 231, 232, 233, 234,
+        236, 237, 238, 239, 240, 241, 242, 243, 244, 245, 246, 247, 248, 249, 250, 251,
+        252, 253, 254, 255, 256, 257, 258, 259, 260, 261, 262, 263, 264, 265, 266, 267,
+        268, 269, 270, 271, 272, 273, 274, 275, 276, 277, 278, 279, 280, 281, 282, 283,
+        284, 285, 286, 287, 288, 289, 290, 291, 292, 293, 294, 295, 296, 297, 298, 299,
+        300, 301, 302, 303, 305, 306, 307, 308, 309, 310, 311, 312, 313, 314, 315, 316,
+        317, 318, 319, 320, 321, 322, 323, 324, 325, 326, 327, 329, 330, 331, 332, 333,
+        334, 335, 336, 337, 338, 340, 341, 342, 343, 344, 345, 346, 347, 348, 349, 350,
+        351, 352, 353, 354, 355, 356, 357, 358, 359, 360, 361, 362, 363, 364, 365, 366,
+        367, 368, 369, 370, 371, 372, 373, 374, 375, 376, 377, 378, 379, 380, 381, 382,
+        383, 384, 385, 386, 387, 388, 389, 390, 391, 392, 393, 394, 395, 396, 397, 398,
+        399, 400, 401, 402, 403, 404, 405, 406, 407, 408, 409, 410, 411, 412, 413, 414,
+        415, 416, 417, 418, 419, 420, 421, 422, 423, 424, 425, 426, 427, 428, 429, 430,
+        431, 432, 433, 434, 435, 436, 437, 438, 439, 440, 441, 444, 445, 446, 447, 448,
+        449, 450, 451, 452, 453, 454, 455, 456, 457, 458, 459, 460, 461, 462, 463, 464,
+        465, 466, 467, 468, 469, 470, 471, 472, 473, 474, 475, 476, 477, 478, 479, 480,
+        481, 482, 483, 484, 485, 486, 487, 488, 489, 490, 491, 492, 493, 494, 495, 496,
+        497, 498, 499, 500, 501, 502, 503, 504, 505, 506, 507, 508, 509, 510, 511, 512,
+        513, 514, 515, 516, 517, 518, 519, 520, 521, 522, 523, 524, 525, 526, 527, 529,
+        530, 531, 532, 533, 534, 535, 536, 537, 538, 539, 540, 541, 542, 543, 544, 545,
+        546, 547, 548, 549, 550, 551, 552, 554, 555, 556, 557, 558, 559, 561, 562, 563,
+        564, 565, 566, 567, 568, 571,
+};
+
+static const TerritoryNameAlternative TERRITORY_NAME_ALTERNATIVES_ES[571] = {
+        {0, 8, 0}, {9, 19, 0}, {29, 10, 0}, {40, 7, 0}, {48, 9, 0}, {58, 7, 0}, {66, 11, 0}, {78, 13, 0},
+        {92, 14, 0}, {107, 5, 0}, {113, 6, 0}, {120, 5, 0}, {126, 12, 0}, {139, 11, 0}, {151, 24, 0}, {176, 15, 0},
+        {192, 15, 0}, {208, 14, 0}, {223, 11, 0}, {235, 14, 0}, {250, 8, 0}, {259, 41, 0}, {301, 10, 0}, {312, 9, 0},
+        {322, 7, 0}, {330, 10, 0}, {341, 6, 0}, {348, 15, 0}, {364, 15, 0}, {380, 6, 0}, {387, 27, 0}, {415, 13, 0},
+        {429, 5, 0}, {435, 14, 0}, {450, 15, 0}, {466, 10, 0}, {477, 21, 0}, {499, 9, 0}, {509, 4, 0}, {514, 23, 0},
+        {538, 5, 0}, {544, 13, 0}, {558, 28, 0}, {587, 4, 0}, {592, 13, 0}, {606, 8, 0}, {615, 44, 0}, {660, 10, 0},
+        {671, 16, 0}, {688, 5, 0}, {694, 7, 0}, {702, 24, 0}, {727, 7, 0}, {735, 20, 0}, {756, 9, 0}, {766, 28, 0},
+        {795, 10, 0}, {806, 22, 0}, {829, 14, 0}, {844, 8, 0}, {853, 17, 0}, {871, 7, 0}, {879, 7, 0}, {887, 10, 0},
+        {898, 5, 0}, {904, 24, 0}, {929, 7, 0}, {937, 4, 0}, {942, 11, 0}, {954, 12, 0}, {967, 10, 0}, {978, 31, 0},
+        {1010, 8, 0}, {1019, 5, 0}, {1025, 8, 0}, {1034, 7, 0}, {1042, 8, 0}, {1051, 21, 0}, {1073, 12, 0}, {1086, 23, 0},
+        {1110, 9, 0}, {1120, 9, 0}, {1130, 9, 0}, {1140, 11, 0}, {1152, 9, 0}, {1162, 7, 0}, {1170, 8, 0}, {1179, 8, 0},
+        {1188, 10, 0}, {1199, 5, 0}, {1205, 44, 0}, {1250, 22, 0}, {1273, 18, 0}, {1292, 10, 0}, {1303, 17, 0}, {1321, 6, 0},
+        {1328, 6, 0}, {1335, 41, 0}, {1377, 11, 0}, {1389, 6, 0}, {1396, 7, 0}, {1404, 7, 0}, {1412, 6, 0}, {1419, 5, 0},
+        {1425, 14, 0}, {1440, 7, 0}, {1448, 10, 0}, {1459, 7, 0}, {1467, 14, 0}, {1482, 11, 0}, {1494, 6, 0}, {1501, 10, 0},
+        {1512, 15, 0}, {1528, 9, 0}, {1538, 6, 0}, {1545, 20, 0}, {1566, 11, 0}, {1578, 6, 0}, {1585, 8, 0}, {1594, 9, 0},
+        {1604, 6, 0}, {1611, 6, 0}, {1618, 7, 0}, {1626, 17, 0}, {1644, 7, 0}, {1652, 14, 0}, {1667, 7, 0}, {1675, 6, 0},
+        {1682, 8, 0}, {1691, 8, 0}, {1700, 13, 0}, {1714, 7, 0}, {1722, 6, 0}, {1729, 5, 0}, {1735, 13, 0}, {1749, 9, 0},
+        {1759, 7, 0}, {1767, 21, 0}, {1789, 10, 0}, {1800, 10, 0}, {1811, 20, 0}, {1832, 7, 0}, {1840, 4, 0}, {1845, 7, 0},
+        {1853, 8, 0}, {1862, 9, 0}, {1872, 7, 0}, {1880, 7, 0}, {1888, 12, 0}, {1901, 7, 0}, {1909, 16, 0}, {1926, 16, 0},
+        {1943, 23, 0}, {1967, 7, 0}, {1975, 11, 0}, {1987, 6, 0}, {1994, 7, 0}, {2002, 8, 0}, {2011, 8, 0}, {2020, 13, 0},
+        {2034, 8, 0}, {2043, 9, 0}, {2053, 4, 0}, {2058, 8, 0}, {2067, 7, 0}, {2075, 8, 0}, {2084, 5, 0}, {2090, 7, 0},
+        {2098, 6, 0}, {2105, 15, 0}, {2121, 9, 0}, {2131, 6, 0}, {2138, 11, 0}, {2150, 10, 0}, {2161, 5, 0}, {2167, 6, 0},
+        {2174, 8, 0}, {2183, 7, 0}, {2191, 7, 0}, {2199, 5, 0}, {2205, 7, 0}, {2213, 11, 0}, {2225, 11, 0}, {2237, 7, 0},
+        {2245, 4, 0}, {2250, 7, 0}, {2258, 5, 0}, {2264, 6, 0}, {2271, 11, 0}, {2283, 7, 0}, {2291, 13, 0}, {2305, 17, 0},
+        {2323, 14, 0}, {2338, 6, 0}, {2345, 7, 0}, {2353, 17, 0}, {2371, 8, 0}, {2380, 6, 0}, {2387, 13, 0}, {2401, 12, 0},
+        {2414, 9, 0}, {2424, 6, 0}, {2431, 5, 0}, {2437, 7, 0}, {2445, 15, 0}, {2461, 7, 0}, {2469, 7, 0}, {2477, 7, 0},
+        {2485, 9, 0}, {2495, 17, 0}, {2513, 8, 0}, {2522, 6, 0}, {2529, 8, 0}, {2538, 8, 0}, {2547, 4, 0}, {2552, 9, 0},
+        {2562, 11, 0}, {2574, 6, 0}, {2581, 19, 0}, {2601, 8, 0}, {2610, 13, 0}, {2624, 7, 0}, {2632, 9, 0}, {2642, 5, 0},
+        {2648, 7, 0}, {2656, 11, 0}, {2668, 5, 0}, {2674, 8, 0}, {2683, 10, 0}, {2694, 7, 0}, {2702, 14, 0}, {2717, 25, 0},
+        {2743, 7, 0}, {2751, 11, 0}, {2763, 7, 0}, {2771, 8, 0}, {2780, 6, 0}, {2787, 5, 0}, {2793, 8, 0}, {2802, 9, 0},
+        {2812, 10, 0}, {2823, 7, 0}, {2831, 9, 0}, {2841, 7, 0}, {2849, 8, 0}, {2858, 6, 0}, {2865, 10, 0}, {2876, 7, 0},
+        {2884, 8, 0}, {2893, 8, 0}, {2902, 10, 0}, {2913, 5, 0}, {2919, 6, 0}, {2926, 6, 0}, {2933, 4, 0}, {2938, 5, 0},
+        {2944, 8, 0}, {2953, 5, 0}, {2959, 5, 0}, {2965, 6, 0}, {2972, 9, 0}, {2982, 16, 0}, {2999, 8, 0}, {3008, 7, 0},
+        {3016, 14, 0}, {3031, 6, 0}, {3038, 9, 0}, {3048, 7, 0}, {3056, 17, 0}, {3074, 7, 0}, {3082, 7, 0}, {3090, 10, 0},
+        {3101, 6, 0}, {3108, 8, 0}, {3117, 12, 0}, {3130, 7, 0}, {3138, 8, 0}, {3147, 10, 0}, {3158, 16, 0}, {3175, 8, 0},
+        {3184, 10, 0}, {3195, 15, 0}, {3211, 8, 0}, {3220, 7, 0}, {3228, 19, 0}, {3248, 9, 0}, {3258, 7, 0}, {3266, 10, 0},
+        {3277, 6, 0}, {3284, 7, 0}, {3292, 8, 0}, {3301, 6, 0}, {3308, 9, 0}, {3318, 12, 0}, {3331, 14, 0}, {3346, 14, 0},
+        {3361, 7, 0}, {3369, 10, 0}, {3380, 9, 0}, {3390, 11, 0}, {3402, 20, 0}, {3423, 10, 0}, {3434, 17, 0}, {3452, 11, 0},
+        {3464, 10, 0}, {3475, 5, 0}, {3481, 9, 0}, {3491, 8, 0}, {3500, 7, 0}, {3508, 7, 0}, {3516, 7, 0}, {3524, 6, 0},
+        {3531, 6, 0}, {3538, 7, 0}, {3546, 17, 0}, {3564, 5, 0}, {3570, 5, 0}, {3576, 11, 0}, {3588, 3, 0}, {3592, 6, 0},
+        {3599, 10, 0}, {3610, 16, 0}, {3627, 17, 0}, {3645, 12, 0}, {3658, 9, 0}, {3668, 9, 0}, {3678, 9, 0}, {3688, 6, 0},
+        {3695, 6, 0}, {3702, 7, 0}, {3710, 18, 0}, {3729, 14, 0}, {3744, 9, 0}, {3754, 14, 0}, {3769, 11, 0}, {3781, 13, 0},
+        {3795, 10, 0}, {3806, 19, 0}, {3826, 36, 0}, {3863, 28, 0}, {3892, 24, 0}, {3917, 20, 0}, {3938, 17, 0}, {3956, 8, 0},
+        {3965, 8, 0}, {3974, 20, 0}, {3995, 10, 0}, {4006, 16, 0}, {4023, 7, 0}, {4031, 7, 0}, {4039, 14, 0}, {4054, 14, 0},
+        {4069, 19, 0}, {4089, 7, 0}, {4097, 14, 0}, {4112, 10, 0}, {4123, 6, 0}, {4130, 5, 0}, {4136, 4, 0}, {4141, 7, 0},
+        {4149, 7, 0}, {4157, 8, 0}, {4166, 9, 0}, {4176, 5, 0}, {4182, 9, 0}, {4192, 17, 0}, {4210, 9, 0}, {4220, 5, 0},
+        {4226, 18, 0}, {4245, 5, 0}, {4251, 12, 0}, {4264, 11, 0}, {4276, 6, 0}, {4283, 8, 0}, {4292, 20, 0}, {4313, 12, 0},
+        {4326, 8, 0}, {4335, 11, 0}, {4347, 10, 0}, {4358, 15, 0}, {4374, 7, 0}, {4382, 13, 0}, {4396, 5, 0}, {4402, 8, 0},
+        {4411, 19, 0}, {4431, 16, 0}, {4448, 5, 0}, {4454, 7, 0}, {4462, 8, 0}, {4471, 8, 0}, {4480, 8, 0}, {4489, 4, 0},
+        {4494, 11, 0}, {4506, 9, 0}, {4516, 8, 0}, {4525, 7, 0}, {4533, 8, 0}, {4542, 18, 0}, {4561, 10, 0}, {4572, 4, 0},
+        {4577, 8, 0}, {4586, 7, 0}, {4594, 9, 0}, {4604, 7, 0}, {4612, 6, 0}, {4619, 8, 0}, {4628, 16, 0}, {4645, 10, 0},
+        {4656, 14, 0}, {4671, 8, 0}, {4680, 6, 0}, {4687, 5, 0}, {4693, 4, 0}, {4698, 9, 0}, {4708, 8, 0}, {4717, 7, 0},
+        {4725, 7, 0}, {4733, 8, 0}, {4742, 6, 0}, {4749, 7, 0}, {4757, 12, 0}, {4770, 7, 0}, {4778, 10, 0}, {4789, 5, 0},
+        {4795, 6, 0}, {4802, 19, 0}, {4822, 7, 0}, {4830, 7, 0}, {4838, 6, 0}, {4845, 12, 0}, {4858, 8, 0}, {4867, 9, 0},
+        {4877, 15, 0}, {4893, 13, 0}, {4907, 26, 0}, {4934, 5, 0}, {4940, 24, 0}, {4965, 7, 0}, {4973, 5, 0}, {4979, 9, 0},
+        {4989, 6, 0}, {4996, 3, 0}, {5000, 26, 0}, {5027, 8, 0}, {5036, 7, 0}, {5044, 6, 0}, {5051, 15, 0}, {5067, 18, 0},
+        {5086, 24, 0}, {5111, 20, 0}, {5132, 37, 0}, {5170, 30, 0}, {5201, 28, 0}, {5230, 19, 0}, {5250, 21, 0}, {5272, 18, 0},
+        {5291, 18, 0}, {5310, 12, 0}, {5323, 11, 0}, {5335, 15, 0}, {5351, 15, 0}, {5367, 16, 0}, {5384, 13, 0}, {5398, 17, 0},
+        {5416, 17, 0}, {5434, 16, 0}, {5451, 13, 0}, {5465, 20, 0}, {5486, 16, 0}, {5503, 18, 0}, {5522, 24, 0}, {5547, 19, 0},
+        {5567, 19, 0}, {5587, 16, 0}, {5604, 15, 0}, {5620, 14, 0}, {5635, 14, 0}, {5650, 22, 0}, {5673, 14, 0}, {5688, 20, 0},
+        {5709, 17, 0}, {5727, 21, 0}, {5749, 18, 0}, {5768, 15, 0}, {5784, 21, 0}, {5806, 22, 0}, {5829, 18, 0}, {5848, 18, 0},
+        {5867, 22, 0}, {5890, 26, 0}, {5917, 12, 0}, {5930, 16, 0}, {5947, 16, 0}, {5964, 15, 0}, {5980, 16, 0}, {5997, 9, 0},
+        {6007, 28, 0}, {6036, 20, 0}, {6057, 24, 0}, {6082, 13, 0}, {6096, 18, 0}, {6115, 13, 0}, {6129, 12, 0}, {6142, 21, 0},
+        {6164, 13, 0}, {6178, 16, 0}, {6195, 18, 0}, {6214, 22, 0}, {6237, 16, 0}, {6254, 18, 0}, {6273, 22, 0}, {6296, 12, 0},
+        {6309, 14, 0}, {6324, 23, 0}, {6348, 19, 0}, {6368, 19, 0}, {6388, 13, 0}, {6402, 13, 0}, {6416, 16, 0}, {6433, 18, 0},
+        {6452, 14, 0}, {6467, 14, 0}, {6482, 19, 0}, {6502, 14, 0}, {6517, 23, 0}, {6541, 18, 0}, {6560, 15, 0}, {6576, 19, 0},
+        {6596, 21, 0}, {6618, 7, 0}, {6626, 5, 0}, {6632, 18, 0}, {6651, 7, 0}, {6659, 7, 0}, {6667, 6, 0}, {6674, 11, 0},
+        {6686, 9, 0}, {6696, 8, 0}, {6705, 7, 0}, {6713, 6, 0}, {6720, 5, 0}, {6726, 8, 0}, {6735, 8, 0}, {6744, 6, 0},
+        {6751, 7, 0}, {6759, 5, 0}, {6765, 7, 0}, {6773, 22, 0}, {6796, 5, 0}, {6802, 5, 0}, {6808, 5, 0}, {6814, 7, 0},
+        {6822, 10, 0}, {6833, 17, 0}, {6851, 12, 0}, {6864, 5, 0}, {6870, 14, 0}, {6885, 7, 0}, {6893, 6, 0}, {6900, 6, 0},
+        {6907, 6, 0}, {6914, 5, 0}, {6920, 7, 0}, {6928, 15, 0}, {6944, 5, 0}, {6950, 44, 0}, {6995, 15, 0}, {7011, 10, 0},
+        {7022, 13, 0}, {7036, 7, 0}, {7044, 6, 0},
+};
+
+static char TERRITORY_NAMES_UNPACKED_ES[7051];
+
+static const PackedTerritoryNames PACKED_TERRITORY_NAMES_ES = {
+        TERRITORY_NAMES_UNPACKED_ES, 7051, TERRITORY_NAMES_PACKED_ES, 3469, TERRITORY_NAMES_PAIRS_ES,
+        TERRITORY_NAME_ALTERNATIVES_START_ES, TERRITORY_NAME_ALTERNATIVES_ES};
+
+#else
+
+static const PackedTerritoryNames PACKED_TERRITORY_NAMES_ES = {NULL, 0, NULL, 0, NULL, NULL, NULL};
+
+#endif // MAPCODE_SUPPORT_LANGUAGE_ES
+
+#ifdef MAPCODE_SUPPORT_LANGUAGE_FI // Finnish
+
+// 6708 bytes, packed to 3429
+static const unsigned char TERRITORY_NAMES_PACKED_FI[3429] = {
+        86, 27, 55, 97, 2, 105, 124, 80, 121, 104, 24, 32, 91, 117, 4, 46, 12, 150, 22, 71, 142, 114, 3, 116,
+        5, 138, 111, 107, 31, 170, 180, 111, 111, 107, 52, 56, 124, 75, 101, 31, 134, 207, 115, 192, 116, 191, 5, 116,
+        104, 31, 171, 121, 181, 97, 30, 117, 138, 117, 28, 117, 46, 150, 97, 22, 83, 4, 160, 77, 97, 5, 116, 11,
+        192, 116, 45, 226, 116, 57, 78, 17, 102, 39, 107, 95, 80, 104, 59, 130, 207, 124, 80, 104, 59, 130, 207, 147,
+        20, 99, 97, 38, 110, 56, 145, 111, 117, 118, 19, 96, 110, 42, 14, 66, 13, 109, 203, 183, 131, 116, 59, 24,
+        186, 32, 73, 200, 105, 29, 28, 116, 23, 13, 11, 16, 83, 29, 226, 4, 22, 71, 249, 110, 115, 101, 121, 132,
+        110, 196, 59, 108, 125, 255, 115, 13, 114, 27, 146, 13, 115, 101, 121, 146, 111, 237, 117, 42, 14, 87, 3, 108,
+        15, 95, 70, 123, 40, 135, 70, 123, 40, 183, 131, 116, 59, 24, 15, 19, 32, 58, 20, 115, 121, 116, 56, 124,
+        66, 131, 116, 59, 24, 15, 19, 32, 58, 20, 115, 121, 116, 56, 162, 105, 101, 194, 116, 11, 137, 101, 57, 224,
+        117, 98, 125, 5, 115, 104, 3, 108, 4, 56, 132, 109, 13, 55, 29, 83, 23, 111, 135, 83, 23, 111, 97, 44,
+        32, 23, 13, 193, 3, 93, 11, 209, 111, 111, 107, 32, 56, 192, 116, 45, 80, 105, 13, 114, 101, 95, 77, 105,
+        113, 6, 108, 12, 124, 77, 105, 113, 6, 108, 12, 181, 105, 6, 192, 160, 75, 20, 116, 115, 95, 58, 118, 15,
+        124, 58, 118, 15, 209, 141, 109, 2, 56, 145, 12, 97, 38, 101, 44, 32, 83, 160, 69, 174, 27, 117, 15, 95,
+        83, 129, 135, 83, 129, 135, 83, 160, 69, 174, 27, 105, 117, 115, 46, 3, 230, 105, 105, 118, 20, 192, 160, 72,
+        31, 11, 97, 44, 32, 65, 115, 99, 11, 63, 12, 95, 84, 114, 91, 29, 100, 18, 67, 40, 104, 135, 65, 115,
+        99, 11, 63, 12, 124, 84, 114, 91, 29, 100, 18, 67, 40, 104, 125, 3, 34, 156, 11, 26, 244, 104, 100, 121,
+        115, 28, 116, 93, 32, 58, 20, 115, 121, 116, 56, 46, 141, 136, 116, 54, 72, 117, 130, 112, 117, 118, 117, 17,
+        19, 95, 74, 29, 77, 141, 11, 124, 74, 29, 77, 141, 11, 192, 160, 86, 247, 254, 95, 156, 11, 26, 199, 20,
+        124, 156, 11, 26, 199, 20, 178, 101, 5, 100, 95, 77, 99, 68, 12, 3, 100, 207, 115, 124, 77, 99, 68, 12,
+        3, 100, 45, 56, 145, 5, 98, 26, 52, 132, 200, 105, 196, 18, 43, 66, 5, 98, 203, 135, 66, 5, 98, 203,
+        1, 67, 30, 150, 97, 22, 83, 101, 121, 194, 31, 108, 20, 147, 3, 170, 147, 240, 226, 105, 97, 2, 20, 132,
+        236, 17, 114, 1, 92, 23, 46, 2, 42, 219, 93, 160, 76, 117, 99, 8, 77, 55, 114, 12, 51, 217, 134, 157,
+        17, 54, 84, 127, 1, 68, 62, 4, 48, 183, 94, 114, 97, 57, 75, 38, 142, 27, 14, 84, 30, 107, 115, 45,
+        95, 67, 97, 48, 52, 56, 124, 67, 97, 48, 52, 56, 47, 97, 60, 84, 62, 101, 95, 149, 247, 130, 101, 124,
+        149, 247, 130, 54, 72, 127, 107, 127, 46, 5, 116, 4, 105, 113, 6, 242, 24, 114, 56, 212, 26, 31, 111, 117,
+        112, 54, 75, 62, 17, 20, 46, 97, 30, 20, 105, 117, 115, 146, 24, 108, 108, 101, 11, 110, 24, 107, 171, 186,
+        162, 117, 120, 171, 98, 30, 103, 47, 23, 111, 1, 205, 71, 101, 17, 103, 158, 43, 175, 15, 19, 32, 83, 41,
+        119, 221, 56, 124, 83, 41, 119, 221, 56, 211, 214, 29, 80, 39, 121, 110, 51, 252, 157, 32, 86, 13, 100, 54,
+        84, 114, 4, 105, 100, 26, 95, 84, 111, 98, 140, 111, 124, 84, 111, 98, 140, 22, 66, 114, 40, 101, 14, 82,
+        214, 29, 19, 153, 15, 19, 10, 19, 147, 249, 116, 60, 82, 48, 22, 75, 121, 112, 114, 52, 162, 142, 2, 12,
+        146, 23, 97, 55, 1, 71, 187, 8, 81, 27, 5, 242, 3, 107, 144, 4, 56, 0, 86, 2, 117, 27, 117, 46,
+        255, 11, 231, 114, 22, 66, 94, 23, 1, 73, 116, 24, 45, 84, 143, 17, 47, 119, 97, 122, 143, 97, 133, 117,
+        119, 97, 20, 242, 105, 106, 14, 85, 117, 222, 67, 3, 230, 12, 217, 108, 49, 11, 8, 148, 114, 97, 31, 147,
+        3, 51, 116, 199, 3, 97, 15, 9, 19, 0, 69, 108, 32, 83, 3, 118, 26, 17, 145, 31, 235, 54, 68, 106,
+        142, 111, 123, 14, 77, 61, 230, 12, 8, 82, 117, 41, 1, 72, 97, 20, 14, 66, 30, 40, 100, 14, 80, 24,
+        105, 118, 24, 200, 35, 97, 106, 29, 92, 248, 139, 108, 98, 165, 83, 3, 62, 12, 56, 132, 114, 109, 11, 8,
+        76, 51, 136, 104, 22, 66, 31, 103, 8, 77, 39, 100, 49, 1, 92, 248, 97, 191, 15, 33, 117, 138, 228, 119,
+        25, 66, 104, 123, 25, 83, 118, 101, 20, 115, 14, 72, 39, 172, 105, 124, 223, 2, 107, 62, 97, 27, 138, 214,
+        1, 86, 38, 22, 68, 62, 4, 55, 97, 2, 186, 32, 53, 83, 108, 49, 61, 8, 67, 52, 116, 18, 82, 48,
+        183, 52, 110, 158, 43, 72, 13, 116, 115, 231, 49, 4, 133, 114, 111, 27, 8, 84, 111, 103, 22, 76, 27, 118,
+        8, 76, 105, 19, 116, 117, 163, 114, 105, 32, 76, 2, 107, 1, 71, 101, 17, 103, 8, 225, 172, 219, 105, 13,
+        114, 18, 76, 101, 12, 54, 80, 2, 23, 213, 151, 232, 167, 53, 82, 214, 29, 92, 141, 2, 244, 104, 100, 91,
+        121, 110, 101, 19, 32, 224, 129, 105, 171, 159, 55, 40, 110, 27, 179, 116, 24, 28, 34, 65, 122, 13, 98, 228,
+        100, 197, 190, 25, 83, 13, 98, 8, 74, 17, 100, 165, 80, 220, 117, 103, 3, 14, 85, 110, 107, 5, 14, 205,
+        75, 17, 101, 1, 148, 172, 14, 92, 27, 171, 3, 133, 117, 117, 98, 183, 237, 103, 5, 8, 76, 142, 13, 8,
+        72, 12, 100, 30, 7, 145, 11, 57, 69, 131, 114, 101, 125, 3, 97, 119, 14, 80, 240, 75, 17, 101, 184, 48,
+        5, 140, 117, 133, 114, 101, 193, 213, 26, 197, 190, 55, 227, 66, 64, 108, 206, 0, 58, 112, 3, 138, 40, 15,
+        217, 30, 4, 23, 54, 85, 114, 117, 196, 141, 180, 187, 201, 122, 163, 121, 121, 114, 217, 11, 231, 3, 180, 38,
+        103, 15, 253, 3, 107, 111, 45, 86, 11, 24, 106, 24, 212, 121, 2, 1, 76, 97, 52, 211, 62, 165, 71, 104,
+        2, 1, 85, 103, 41, 1, 148, 111, 191, 131, 2, 110, 105, 135, 83, 107, 136, 172, 105, 124, 80, 240, 225, 172,
+        105, 124, 225, 172, 105, 44, 32, 80, 208, 212, 248, 1, 69, 99, 117, 26, 17, 162, 24, 110, 222, 83, 94, 5,
+        135, 76, 24, 110, 222, 83, 94, 5, 25, 71, 129, 12, 0, 85, 117, 63, 32, 83, 101, 31, 126, 14, 66, 30,
+        107, 4, 18, 70, 7, 22, 70, 59, 130, 112, 199, 20, 179, 116, 216, 79, 109, 25, 80, 117, 39, 184, 17, 115,
+        40, 108, 117, 30, 2, 110, 193, 22, 78, 17, 106, 125, 3, 51, 253, 105, 19, 110, 23, 47, 117, 62, 14, 75,
+        127, 12, 47, 61, 115, 1, 74, 157, 2, 14, 90, 143, 98, 129, 119, 54, 80, 5, 140, 117, 141, 179, 114, 61,
+        46, 5, 111, 107, 107, 22, 85, 122, 98, 232, 227, 82, 117, 136, 115, 14, 80, 157, 117, 97, 45, 85, 117, 222,
+        92, 248, 133, 23, 13, 40, 138, 30, 107, 109, 11, 227, 69, 115, 112, 2, 106, 213, 233, 143, 97, 1, 74, 171,
+        11, 211, 214, 139, 104, 118, 11, 2, 109, 97, 133, 11, 8, 66, 136, 115, 119, 2, 125, 26, 140, 251, 5, 0,
+        85, 107, 114, 93, 1, 205, 83, 203, 25, 75, 101, 36, 105, 45, 65, 102, 114, 55, 152, 83, 62, 216, 65, 102,
+        103, 2, 227, 77, 121, 2, 109, 5, 124, 66, 30, 109, 163, 187, 8, 154, 59, 54, 84, 30, 107, 107, 14, 80,
+        61, 227, 77, 52, 187, 55, 181, 23, 142, 253, 11, 101, 122, 6, 108, 184, 105, 103, 13, 8, 84, 215, 165, 69,
+        103, 121, 112, 116, 14, 77, 97, 30, 20, 165, 66, 39, 105, 118, 8, 155, 105, 111, 112, 252, 39, 117, 109, 98,
+        8, 205, 65, 102, 114, 193, 125, 3, 14, 65, 110, 103, 39, 184, 105, 103, 13, 0, 154, 26, 147, 13, 117, 46,
+        127, 39, 8, 225, 25, 76, 142, 121, 163, 203, 25, 73, 236, 12, 51, 8, 70, 230, 13, 246, 68, 91, 114, 48,
+        116, 138, 108, 97, 120, 99, 3, 125, 17, 31, 52, 132, 196, 7, 99, 166, 254, 51, 209, 39, 143, 1, 81, 249,
+        19, 5, 22, 72, 105, 100, 3, 103, 22, 77, 101, 120, 48, 60, 83, 116, 27, 54, 84, 129, 7, 99, 22, 78,
+        141, 5, 20, 212, 2, 97, 106, 117, 27, 22, 80, 6, 98, 108, 244, 117, 99, 27, 25, 81, 117, 4, 116, 2,
+        18, 82, 111, 22, 83, 4, 3, 111, 1, 67, 23, 112, 101, 194, 101, 46, 221, 111, 150, 25, 83, 29, 76, 117,
+        15, 32, 80, 136, 52, 14, 71, 249, 114, 13, 22, 78, 6, 118, 60, 76, 101, 12, 145, 97, 43, 67, 166, 102,
+        17, 110, 253, 13, 150, 114, 117, 122, 0, 154, 105, 157, 7, 145, 97, 43, 67, 166, 102, 17, 110, 158, 83, 30,
+        0, 90, 150, 27, 101, 99, 7, 146, 3, 15, 99, 22, 84, 23, 170, 108, 130, 7, 0, 79, 97, 120, 150, 1,
+        68, 30, 64, 22, 67, 111, 94, 117, 59, 163, 12, 17, 1, 154, 105, 104, 117, 94, 117, 1, 156, 195, 182, 110,
+        172, 219, 170, 100, 105, 45, 224, 129, 252, 127, 111, 45, 75, 4, 115, 104, 7, 139, 108, 103, 13, 252, 97, 122,
+        61, 137, 25, 224, 103, 254, 199, 1, 68, 23, 29, 43, 68, 105, 117, 210, 26, 114, 18, 43, 78, 140, 5, 32,
+        72, 229, 31, 14, 154, 41, 105, 103, 5, 104, 132, 236, 23, 29, 43, 78, 48, 111, 98, 5, 162, 61, 115, 104,
+        26, 119, 101, 101, 112, 210, 31, 104, 14, 77, 231, 104, 3, 141, 184, 140, 3, 41, 46, 2, 130, 30, 138, 114,
+        130, 30, 125, 235, 17, 23, 47, 193, 143, 147, 40, 106, 129, 178, 5, 121, 2, 139, 114, 40, 150, 104, 246, 238,
+        132, 115, 115, 23, 145, 105, 104, 5, 0, 85, 116, 116, 5, 61, 104, 41, 0, 71, 111, 133, 13, 3, 213, 23,
+        59, 32, 78, 26, 40, 178, 143, 150, 104, 246, 238, 146, 23, 109, 40, 95, 75, 250, 109, 38, 57, 154, 104, 27,
+        116, 15, 103, 5, 104, 146, 104, 5, 107, 104, 41, 180, 5, 110, 27, 61, 1, 82, 97, 106, 7, 116, 104, 25,
+        79, 100, 15, 104, 135, 79, 114, 15, 115, 1, 92, 106, 5, 27, 57, 76, 24, 110, 63, 191, 11, 103, 3, 46,
+        26, 104, 121, 18, 238, 138, 31, 64, 2, 139, 236, 104, 114, 18, 238, 46, 94, 5, 250, 116, 114, 1, 85, 116,
+        116, 5, 32, 238, 147, 203, 117, 194, 13, 114, 121, 243, 83, 111, 123, 104, 32, 87, 3, 51, 132, 239, 166, 29,
+        112, 24, 24, 107, 170, 112, 40, 107, 20, 241, 105, 111, 124, 65, 239, 166, 29, 67, 157, 20, 246, 84, 241, 121,
+        146, 13, 118, 15, 32, 66, 141, 32, 84, 241, 121, 181, 220, 104, 13, 110, 32, 84, 241, 121, 47, 111, 123, 104,
+        32, 65, 239, 216, 84, 7, 109, 165, 86, 48, 116, 17, 8, 87, 51, 116, 13, 110, 32, 65, 239, 216, 81, 6,
+        11, 115, 144, 210, 91, 131, 60, 70, 230, 13, 3, 47, 13, 103, 130, 54, 223, 140, 111, 7, 211, 105, 60, 100,
+        101, 32, 74, 2, 101, 38, 22, 69, 115, 112, 38, 20, 60, 83, 126, 22, 82, 105, 60, 156, 41, 101, 32, 100,
+        60, 78, 220, 54, 80, 5, 97, 142, 163, 126, 18, 67, 27, 5, 4, 1, 80, 13, 110, 187, 117, 99, 22, 65,
+        109, 157, 1, 67, 101, 5, 139, 99, 114, 54, 80, 5, 2, 1, 82, 17, 97, 143, 1, 82, 12, 100, 12, 217,
+        97, 60, 80, 170, 108, 22, 80, 105, 170, 14, 84, 111, 99, 126, 4, 115, 211, 105, 60, 156, 41, 101, 32, 100,
+        60, 83, 237, 46, 5, 2, 233, 22, 71, 111, 105, 7, 46, 27, 60, 156, 52, 115, 60, 100, 60, 83, 237, 145,
+        94, 8, 77, 4, 7, 32, 71, 13, 97, 15, 46, 27, 60, 156, 52, 115, 22, 80, 5, 139, 109, 97, 122, 12,
+        7, 210, 91, 114, 48, 160, 111, 102, 32, 67, 39, 117, 109, 98, 8, 82, 104, 201, 101, 207, 210, 31, 97, 119,
+        5, 54, 67, 12, 110, 101, 99, 116, 48, 123, 243, 74, 13, 115, 101, 121, 243, 72, 23, 112, 115, 104, 38, 54,
+        86, 13, 109, 255, 46, 7, 33, 194, 117, 115, 19, 116, 115, 178, 229, 228, 106, 14, 226, 121, 144, 162, 24, 110,
+        222, 86, 38, 103, 4, 8, 205, 67, 5, 39, 4, 125, 93, 54, 73, 236, 105, 2, 133, 254, 117, 99, 107, 121,
+        138, 11, 110, 51, 115, 101, 54, 86, 38, 103, 4, 8, 79, 104, 105, 22, 80, 11, 110, 115, 121, 108, 118, 165,
+        77, 15, 115, 15, 63, 112, 112, 14, 76, 111, 117, 15, 105, 2, 139, 108, 129, 23, 139, 114, 107, 215, 7, 147,
+        240, 67, 5, 39, 4, 1, 204, 89, 17, 107, 179, 111, 119, 1, 73, 108, 108, 4, 173, 0, 71, 101, 17, 103,
+        8, 87, 15, 99, 12, 115, 57, 70, 108, 17, 105, 100, 125, 15, 115, 111, 30, 14, 79, 107, 108, 94, 62, 184,
+        220, 104, 32, 68, 61, 111, 34, 87, 250, 134, 116, 12, 47, 111, 123, 104, 32, 68, 61, 136, 135, 205, 68, 61,
+        111, 34, 58, 98, 114, 251, 133, 215, 7, 179, 100, 94, 22, 85, 116, 94, 46, 4, 110, 51, 111, 34, 77, 221,
+        105, 103, 25, 87, 121, 62, 134, 0, 79, 114, 231, 12, 209, 39, 17, 26, 22, 58, 118, 26, 139, 114, 235, 12,
+        1, 85, 117, 63, 32, 77, 232, 115, 55, 111, 124, 204, 77, 101, 120, 48, 22, 77, 255, 2, 133, 166, 102, 17,
+        110, 8, 84, 101, 120, 7, 132, 108, 251, 183, 131, 116, 59, 24, 186, 32, 75, 39, 117, 109, 98, 8, 223, 98,
+        13, 34, 79, 200, 5, 105, 22, 81, 6, 98, 101, 99, 47, 251, 27, 194, 101, 119, 25, 77, 2, 20, 111, 98,
+        1, 169, 102, 111, 40, 100, 144, 243, 66, 114, 40, 115, 119, 48, 107, 181, 49, 18, 83, 99, 136, 8, 149, 247,
+        101, 32, 69, 100, 119, 5, 100, 207, 0, 89, 117, 107, 12, 162, 117, 136, 101, 91, 241, 105, 136, 181, 40, 229,
+        123, 179, 200, 8, 65, 239, 216, 66, 114, 7, 59, 8, 85, 83, 65, 124, 89, 104, 100, 121, 115, 28, 108, 27,
+        124, 65, 109, 13, 193, 125, 232, 115, 55, 22, 77, 111, 36, 49, 1, 80, 105, 19, 5, 14, 75, 3, 4, 134,
+        114, 26, 21, 73, 110, 196, 151, 105, 152, 65, 100, 121, 103, 101, 158, 53, 80, 240, 79, 115, 115, 19, 105, 97,
+        45, 223, 2, 158, 53, 75, 129, 5, 100, 105, 191, 3, 107, 5, 105, 152, 75, 5, 27, 151, 228, 45, 84, 151,
+        13, 107, 51, 115, 20, 32, 53, 84, 151, 19, 151, 11, 105, 29, 50, 108, 7, 115, 213, 151, 117, 118, 7, 63,
+        32, 53, 73, 118, 2, 49, 12, 16, 76, 130, 19, 128, 79, 114, 106, 39, 21, 84, 237, 185, 66, 31, 103, 17,
+        201, 21, 86, 108, 26, 143, 38, 21, 75, 30, 128, 75, 3, 117, 103, 185, 84, 187, 49, 21, 66, 114, 106, 2,
+        128, 74, 5, 52, 108, 229, 108, 21, 82, 106, 97, 122, 245, 65, 137, 114, 94, 245, 77, 111, 36, 49, 25, 83,
+        109, 39, 11, 128, 68, 140, 51, 116, 2, 167, 53, 86, 17, 12, 101, 197, 190, 21, 78, 49, 103, 17, 201, 21,
+        80, 105, 104, 107, 49, 185, 75, 52, 116, 114, 62, 52, 115, 163, 116, 229, 114, 111, 112, 39, 4, 177, 75, 114,
+        7, 110, 201, 5, 57, 75, 3, 109, 121, 107, 158, 53, 84, 118, 13, 21, 76, 11, 134, 114, 26, 57, 82, 52,
+        116, 49, 21, 86, 39, 103, 111, 103, 114, 26, 21, 86, 39, 111, 103, 100, 185, 77, 30, 109, 2, 128, 75, 5,
+        106, 3, 152, 78, 11, 19, 63, 7, 115, 133, 62, 57, 224, 107, 64, 31, 4, 46, 17, 100, 118, 152, 78, 105,
+        197, 190, 110, 105, 32, 78, 49, 103, 17, 201, 21, 80, 11, 122, 185, 75, 38, 49, 21, 226, 167, 50, 108, 25,
+        79, 114, 11, 98, 30, 103, 21, 85, 108, 106, 2, 49, 128, 80, 13, 109, 32, 75, 114, 97, 14, 66, 250, 107,
+        220, 52, 116, 2, 167, 53, 85, 100, 109, 30, 116, 105, 25, 84, 27, 5, 137, 2, 167, 53, 83, 23, 5, 185,
+        83, 5, 27, 49, 21, 74, 23, 3, 167, 78, 11, 19, 63, 25, 72, 126, 105, 45, 77, 215, 219, 118, 13, 100,
+        108, 49, 128, 84, 106, 117, 109, 11, 21, 75, 30, 103, 245, 84, 151, 31, 106, 129, 4, 128, 66, 30, 106, 27,
+        105, 152, 84, 61, 97, 191, 97, 55, 166, 2, 177, 225, 107, 123, 128, 78, 49, 52, 142, 38, 128, 84, 62, 128,
+        79, 109, 128, 72, 61, 7, 63, 152, 75, 171, 13, 49, 12, 16, 223, 116, 228, 32, 82, 101, 112, 117, 98, 108,
+        48, 132, 108, 116, 93, 177, 84, 117, 118, 152, 75, 114, 7, 110, 111, 106, 5, 36, 4, 177, 77, 140, 26, 245,
+        154, 117, 107, 136, 107, 29, 79, 107, 114, 117, 103, 57, 75, 23, 116, 151, 27, 107, 2, 177, 83, 94, 3, 4,
+        21, 149, 143, 17, 36, 121, 177, 74, 117, 123, 3, 97, 91, 11, 32, 97, 123, 12, 62, 186, 16, 72, 129, 5,
+        49, 36, 4, 177, 65, 109, 30, 21, 83, 94, 29, 84, 37, 108, 7, 33, 124, 89, 61, 123, 158, 84, 37, 34,
+        75, 2, 26, 1, 86, 11, 24, 106, 24, 47, 104, 64, 233, 14, 84, 105, 2, 106, 57, 80, 232, 134, 178, 93,
+        25, 78, 134, 120, 158, 72, 117, 14, 154, 127, 113, 134, 0, 90, 104, 101, 106, 234, 146, 234, 115, 117, 242, 117,
+        106, 105, 25, 65, 110, 104, 117, 14, 76, 105, 97, 12, 134, 4, 47, 104, 41, 127, 47, 104, 2, 120, 14, 74,
+        234, 120, 14, 72, 11, 25, 92, 235, 104, 111, 40, 212, 64, 100, 127, 178, 117, 98, 101, 57, 74, 59, 57, 72,
+        101, 98, 101, 219, 233, 2, 120, 57, 58, 105, 32, 77, 127, 39, 124, 73, 110, 110, 13, 32, 77, 127, 39, 8,
+        72, 101, 59, 127, 106, 234, 57, 72, 40, 25, 92, 64, 120, 105, 32, 90, 104, 117, 64, 47, 221, 117, 25, 89,
+        40, 110, 25, 88, 235, 64, 124, 84, 105, 142, 19, 0, 71, 215, 40, 0, 81, 134, 233, 14, 88, 4, 106, 234,
+        167, 117, 105, 196, 30, 105, 11, 180, 199, 244, 104, 100, 121, 115, 28, 116, 93, 32, 84, 121, 121, 110, 11, 109,
+        13, 11, 32, 13, 59, 108, 15, 56, 209, 108, 130, 112, 13, 116, 12, 4, 42, 14, 65, 200, 5, 107, 116, 15,
+        180, 2, 33, 4, 118, 24, 108, 186, 124, 77, 97, 97, 59, 109, 135, 77, 97, 157, 3, 108, 22,
+};
+
+static const unsigned char TERRITORY_NAMES_PAIRS_FI[256][2] = {
+        {0, 0}, {97, 0}, {97, 110}, {97, 108}, {105, 110}, {97, 114}, {117, 101}, {97, 115}, {105, 1}, {3, 6}, {32, 9}, {101, 110},
+        {111, 110}, {101, 114}, {105, 0}, {105, 115}, {10, 0}, {111, 114}, {97, 32}, {101, 116}, {105, 116}, {4, 16}, {111, 0}, {97, 109},
+        {195, 164}, {2, 0}, {97, 100}, {97, 116}, {118, 3}, {2, 32}, {117, 114}, {101, 108}, {32, 32}, {115, 97}, {116, 1}, {7, 97},
+        {115, 107}, {35, 28}, {105, 114}, {111, 108}, {117, 110}, {2, 100}, {33, 5}, {106, 18}, {44, 44}, {45, 45}, {0, 77}, {0, 83},
+        {105, 99}, {111, 118}, {116, 37}, {101, 115}, {111, 115}, {50, 34}, {101, 0}, {105, 107}, {42, 19}, {4, 0}, {78, 101}, {105, 108},
+        {111, 32}, {97, 107}, {111, 109}, {115, 105}, {2, 103}, {65, 65}, {66, 66}, {67, 67}, {68, 68}, {69, 69}, {70, 70}, {71, 71},
+        {72, 72}, {73, 73}, {74, 74}, {75, 75}, {76, 76}, {77, 77}, {78, 78}, {79, 79}, {80, 80}, {81, 81}, {82, 82}, {83, 83},
+        {84, 84}, {85, 85}, {86, 86}, {87, 87}, {88, 88}, {89, 89}, {90, 90}, {15, 116}, {71, 117}, {97, 4}, {97, 104}, {32, 43},
+        {96, 96}, {97, 97}, {98, 98}, {99, 99}, {100, 100}, {101, 101}, {102, 102}, {103, 103}, {104, 104}, {105, 105}, {106, 106}, {107, 107},
+        {108, 108}, {109, 109}, {110, 110}, {111, 111}, {112, 112}, {113, 113}, {114, 114}, {115, 115}, {116, 116}, {117, 117}, {118, 118}, {119, 119},
+        {120, 120}, {121, 121}, {122, 122}, {117, 116}, {124, 124}, {1, 77}, {2, 116}, {12, 103}, {36, 21}, {97, 98}, {105, 112}, {114, 20},
+        {0, 65}, {1, 75}, {4, 103}, {97, 124}, {111, 116}, {115, 116}, {0, 84}, {1, 65}, {97, 103}, {97, 121}, {105, 98}, {105, 109},
+        {108, 41}, {0, 66}, {0, 74}, {0, 80}, {73, 115}, {80, 114}, {97, 99}, {197, 161}, {29, 53}, {31, 24}, {67, 104}, {69, 116},
+        {71, 114}, {97, 112}, {105, 18}, {105, 38}, {116, 32}, {161, 161}, {0, 76}, {1, 83}, {164, 164}, {2, 8}, {3, 105}, {4, 32},
+        {10, 112}, {58, 119}, {97, 117}, {101, 109}, {108, 126}, {111, 15}, {117, 137}, {155, 153}, {159, 14}, {168, 176}, {0, 72}, {0, 73},
+        {0, 75}, {0, 78}, {182, 182}, {1, 66}, {1, 78}, {2, 16}, {4, 11}, {23, 98}, {26, 51}, {32, 148}, {190, 190}, {45, 66},
+        {47, 93}, {55, 107}, {99, 104}, {195, 195}, {103, 117}, {197, 197}, {104, 106}, {105, 4}, {110, 116}, {111, 100}, {111, 198}, {117, 100},
+        {169, 32}, {175, 45}, {188, 104}, {189, 144}, {202, 173}, {0, 67}, {0, 68}, {0, 82}, {0, 92}, {1, 84}, {2, 36}, {2, 115},
+        {3, 8}, {8, 83}, {13, 131}, {14, 83}, {17, 116}, {48, 104}, {63, 45}, {65, 108}, {65, 114}, {73, 114}, {77, 5}, {91, 25},
+        {97, 105}, {97, 118}, {101, 100}, {101, 103}, {101, 107}, {104, 97}, {105, 64}, {105, 122}, {110, 100}, {117, 108}, {149, 206}, {174, 114},
+        {208, 45}, {218, 17}, {0, 70}, {0, 204}, {1, 89}, {2, 21}, {3, 32}, {4, 99}, {4, 101}, {6, 114}, {7, 104}, {7, 107},
+        {8, 75}, {8, 86}, {11, 116}, {12, 116},
+};
+
+static const unsigned short TERRITORY_NAME_ALTERNATIVES_START_FI[_TERRITORY_MAX - _TERRITORY_MIN] = {
+        0, 2, 3, 4, 5, 7, 8, 9, 10, 11, 12, 13, 15, 16, 17, 18,
+        19, 20, 21, 22, 23, 24, 25, 27, 29, 30, 31, 32, 34, 35, 37, 38,
+        40, 41, 44, 45, 48, 49, 50, 51, 52, 54, 56, 58, 59, 61, 62, 63,
+        64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 77, 79, 80, 81,
+        82, 83, 84, 85, 86, 87, 88, 90, 91, 92, 94, 95, 96, 97, 98, 99,
+        100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115,
+        116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131,
+        132, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143, 144, 145, 146, 147, 148,
+        149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159, 160, 161, 162, 163, 164,
+        165, 166, 167, 168, 169, 170, 171, 172, 173, 174, 175, 176, 177, 178, 179, 180,
+        181, 182, 183, 184, 185, 186, 187, 191, 192, 193, 195, 196, 197, 198, 199, 200,
+        201, 202, 203, 204, 205, 206, 207, 208, 209, 210, 211, 212, 213, 214, 215, 216,
+        217, 218, 219, 220, 221, 222, 223, 224, 225, 226, 227, 228, 229, 230, 231, 232,
+        234, 235, 236, 237, 238, 239, 240, 241, 242, 243, 244, 245, 246, 247, 248, 249,
+        250, 251, 252, 253, 254, 255, 256, 257, 258, 259, 260, 261, 262, 263, 264, 265,
+        266, 267, 268, 269, 270, 271, 272, 273, 274, 275, 276, 277, 278, 279, 280, 281,
+        282, 283, 284, 285, 286, 287, 288, 289, 290, 291, 292, 293, 294, 295, 296, 297,
+        298, 299, 300, 301, 302, 303, 304, 305, 306, 307, 308, 309, 310, 311, 312, 313,
+        314, 315, 316, 317, 318, 319, 320, 321, 322, 323, 324, 326, 327, 328, 329, 330,
+        331, 332, 333, 334, 335, 337, 338, 339, 340, 341, 342, 343, 344, 345, 346, 347,
+        348, 349, 350, 351, 352, 353, 354, 355, 356, 357, 358, 359, 360, 361, 362, 363,
+        364, 365, 366, 367, 368, 369, 370, 371, 372, 373, 374, 375, 376, 377, 378, 379,
+        380, 381, 382, 383, 384, 385, 386, 387, 388, 389, 390, 391, 392, 393, 394, 395,
+        396, 397, 398, 399, 400, 401, 402, 403, 404, 405, 407, 408, 409, 410, 411, 412,
+        413, 414, 415, 416, 417, 418, 420, 421, 422, 423, 424, 425, 426, 427, 428, 429,
+        430, 431, 432, 433, 434, 435, 436, 437, 438, 439, 440, 443, 444, 445, 446, 447,
+        448, 449, 450, 451, 452, 453, 454, 455, 456, 457, 458, 459, 460, 461, 462, 463,
+        464, 465, 466, 467, 468, 469, 470, 471, 472, 473, 474, 475, 476, 477, 478, 479,
+        480, 481, 482, 483, 484, 485, 486, 487, 488, 489, 490, 491, 492, 493, 494, 495,
+        496, 497, 498, 499, 500, 501, 502, 503, 504, 505, 506, 507, 508, 509, 510, 511,
+        512, 513, 514, 515, 516, 517, 518, 519, 520, 521, 522, 523, 524, 525, 526, 528,
+        529, 530, 531, 532, 533, 534, 535, 536, 537, 538, 539, 540, 541, 542, 543, 544,
+        545, 546, 547, 548, 549, 550, 551, 553, 554, 555, 556, 557, 558, 560, 561, 562,
+        563, 564, 565, 566, 567, 570,
+};
+
+static const TerritoryNameAlternative TERRITORY_NAME_ALTERNATIVES_FI[570] = {
+        {0, 9, 0}, {10, 12, 0}, {23, 6, 0}, {30, 9, 0}, {40, 7, 0}, {48, 12, 0}, {61, 15, 0}, {77, 16, 0},
+        {94, 5, 0}, {100, 6, 0}, {107, 5, 0}, {113, 12, 0}, {126, 12, 0}, {139, 24, 0}, {164, 13, 0}, {178, 14, 0},
+        {193, 13, 0}, {207, 7, 0}, {215, 36, 0}, {252, 10, 0}, {263, 8, 0}, {272, 8, 0}, {281, 10, 0}, {292, 6, 0},
+        {299, 10, 0}, {310, 16, 0}, {327, 6, 0}, {334, 27, 0}, {362, 27, 0}, {390, 13, 0}, {404, 5, 0}, {410, 16, 0},
+        {427, 14, 0}, {442, 21, 0}, {464, 11, 0}, {476, 24, 0}, {501, 8, 0}, {510, 4, 0}, {515, 20, 0}, {536, 5, 0},
+        {542, 12, 0}, {555, 29, 0}, {585, 4, 0}, {590, 12, 0}, {603, 10, 0}, {614, 43, 0}, {658, 9, 0}, {668, 16, 0},
+        {685, 5, 0}, {691, 7, 0}, {699, 26, 0}, {726, 7, 0}, {734, 25, 0}, {760, 9, 0}, {770, 28, 0}, {799, 11, 0},
+        {811, 25, 0}, {837, 15, 0}, {853, 8, 0}, {862, 18, 0}, {881, 7, 0}, {889, 7, 0}, {897, 10, 0}, {908, 5, 0},
+        {914, 17, 0}, {932, 7, 0}, {940, 4, 0}, {945, 8, 0}, {954, 11, 0}, {966, 10, 0}, {977, 9, 0}, {987, 5, 0},
+        {993, 8, 0}, {1002, 7, 0}, {1010, 8, 0}, {1019, 22, 0}, {1042, 12, 0}, {1055, 20, 0}, {1076, 8, 0}, {1085, 8, 0},
+        {1094, 10, 0}, {1105, 10, 0}, {1116, 10, 0}, {1127, 7, 0}, {1135, 9, 0}, {1145, 18, 0}, {1164, 9, 0}, {1174, 5, 0},
+        {1180, 43, 0}, {1224, 14, 0}, {1239, 17, 0}, {1257, 9, 0}, {1267, 18, 0}, {1286, 6, 0}, {1293, 6, 0}, {1300, 25, 0},
+        {1326, 11, 0}, {1338, 6, 0}, {1345, 7, 0}, {1353, 7, 0}, {1361, 6, 0}, {1368, 5, 0}, {1374, 16, 0}, {1391, 7, 0},
+        {1399, 10, 0}, {1410, 6, 0}, {1417, 10, 0}, {1428, 8, 0}, {1437, 6, 0}, {1444, 4, 0}, {1449, 14, 0}, {1464, 8, 0},
+        {1473, 6, 0}, {1480, 20, 0}, {1501, 11, 0}, {1513, 6, 0}, {1520, 8, 0}, {1529, 9, 0}, {1539, 6, 0}, {1546, 5, 0},
+        {1552, 7, 0}, {1560, 23, 0}, {1584, 7, 0}, {1592, 13, 0}, {1606, 7, 0}, {1614, 7, 0}, {1622, 6, 0}, {1629, 7, 0},
+        {1637, 13, 0}, {1651, 6, 0}, {1658, 6, 0}, {1665, 7, 0}, {1673, 8, 0}, {1682, 10, 0}, {1693, 6, 0}, {1700, 4, 0},
+        {1705, 24, 0}, {1730, 8, 0}, {1739, 10, 0}, {1750, 22, 0}, {1773, 7, 0}, {1781, 4, 0}, {1786, 6, 0}, {1793, 7, 0},
+        {1801, 9, 0}, {1811, 7, 0}, {1819, 7, 0}, {1827, 12, 0}, {1840, 6, 0}, {1847, 17, 0}, {1865, 15, 0}, {1881, 29, 0},
+        {1911, 9, 0}, {1921, 12, 0}, {1934, 6, 0}, {1941, 8, 0}, {1950, 9, 0}, {1960, 6, 0}, {1967, 12, 0}, {1980, 7, 0},
+        {1988, 9, 0}, {1998, 5, 0}, {2004, 8, 0}, {2013, 7, 0}, {2021, 8, 0}, {2030, 5, 0}, {2036, 7, 0}, {2044, 6, 0},
+        {2051, 13, 0}, {2065, 9, 0}, {2075, 7, 0}, {2083, 12, 0}, {2096, 10, 0}, {2107, 5, 0}, {2113, 7, 0}, {2121, 8, 0},
+        {2130, 7, 0}, {2138, 8, 0}, {2147, 6, 0}, {2154, 7, 0}, {2162, 8, 0}, {2171, 14, 0}, {2186, 6, 0}, {2193, 4, 0},
+        {2198, 7, 0}, {2206, 5, 0}, {2212, 6, 0}, {2219, 13, 0}, {2233, 9, 0}, {2243, 15, 0}, {2259, 16, 0}, {2276, 6, 0},
+        {2283, 7, 0}, {2291, 13, 0}, {2305, 14, 0}, {2320, 5, 0}, {2326, 13, 0}, {2340, 12, 0}, {2353, 11, 0}, {2365, 6, 0},
+        {2372, 4, 0}, {2377, 5, 0}, {2383, 17, 0}, {2401, 5, 0}, {2407, 7, 0}, {2415, 7, 0}, {2423, 5, 0}, {2429, 6, 0},
+        {2436, 5, 0}, {2442, 6, 0}, {2449, 8, 0}, {2458, 8, 0}, {2467, 4, 0}, {2472, 7, 0}, {2480, 10, 0}, {2491, 6, 0},
+        {2498, 17, 0}, {2516, 7, 0}, {2524, 12, 0}, {2537, 7, 0}, {2545, 7, 0}, {2553, 5, 0}, {2559, 6, 0}, {2566, 10, 0},
+        {2577, 5, 0}, {2583, 8, 0}, {2592, 10, 0}, {2603, 7, 0}, {2611, 12, 0}, {2624, 23, 0}, {2648, 7, 0}, {2656, 10, 0},
+        {2667, 7, 0}, {2675, 5, 0}, {2681, 6, 0}, {2688, 5, 0}, {2694, 6, 0}, {2701, 8, 0}, {2710, 8, 0}, {2719, 7, 0},
+        {2727, 9, 0}, {2737, 7, 0}, {2745, 8, 0}, {2754, 6, 0}, {2761, 10, 0}, {2772, 7, 0}, {2780, 7, 0}, {2788, 8, 0},
+        {2797, 14, 0}, {2812, 4, 0}, {2817, 6, 0}, {2824, 5, 0}, {2830, 4, 0}, {2835, 4, 0}, {2840, 8, 0}, {2849, 4, 0},
+        {2854, 5, 0}, {2860, 5, 0}, {2866, 9, 0}, {2876, 16, 0}, {2893, 8, 0}, {2902, 7, 0}, {2910, 14, 0}, {2925, 6, 0},
+        {2932, 9, 0}, {2942, 7, 0}, {2950, 12, 0}, {2963, 7, 0}, {2971, 7, 0}, {2979, 10, 0}, {2990, 6, 0}, {2997, 7, 0},
+        {3005, 12, 0}, {3018, 7, 0}, {3026, 8, 0}, {3035, 9, 0}, {3045, 15, 0}, {3061, 8, 0}, {3070, 10, 0}, {3081, 15, 0},
+        {3097, 8, 0}, {3106, 7, 0}, {3114, 19, 0}, {3134, 9, 0}, {3144, 7, 0}, {3152, 10, 0}, {3163, 6, 0}, {3170, 7, 0},
+        {3178, 8, 0}, {3187, 6, 0}, {3194, 9, 0}, {3204, 10, 0}, {3215, 12, 0}, {3228, 14, 0}, {3243, 7, 0}, {3251, 9, 0},
+        {3261, 10, 0}, {3272, 12, 0}, {3285, 21, 0}, {3307, 10, 0}, {3318, 18, 0}, {3337, 11, 0}, {3349, 5, 0}, {3355, 9, 0},
+        {3365, 8, 0}, {3374, 7, 0}, {3382, 7, 0}, {3390, 7, 0}, {3398, 6, 0}, {3405, 6, 0}, {3412, 7, 0}, {3420, 17, 0},
+        {3438, 5, 0}, {3444, 5, 0}, {3450, 11, 0}, {3462, 3, 0}, {3466, 6, 0}, {3473, 11, 0}, {3485, 16, 0}, {3502, 19, 0},
+        {3522, 12, 0}, {3535, 9, 0}, {3545, 9, 0}, {3555, 9, 0}, {3565, 6, 0}, {3572, 6, 0}, {3579, 9, 0}, {3589, 13, 0},
+        {3603, 14, 0}, {3618, 9, 0}, {3628, 14, 0}, {3643, 11, 0}, {3655, 13, 0}, {3669, 10, 0}, {3680, 15, 0}, {3696, 34, 0},
+        {3731, 28, 0}, {3760, 20, 0}, {3781, 18, 0}, {3800, 15, 0}, {3816, 8, 0}, {3825, 8, 0}, {3834, 17, 0}, {3852, 10, 0},
+        {3863, 16, 0}, {3880, 7, 0}, {3888, 7, 0}, {3896, 14, 0}, {3911, 14, 0}, {3926, 19, 0}, {3946, 7, 0}, {3954, 14, 0},
+        {3969, 10, 0}, {3980, 5, 0}, {3986, 5, 0}, {3992, 4, 0}, {3997, 6, 0}, {4004, 7, 0}, {4012, 8, 0}, {4021, 9, 0},
+        {4031, 5, 0}, {4037, 9, 0}, {4047, 17, 0}, {4065, 8, 0}, {4074, 5, 0}, {4080, 18, 0}, {4099, 5, 0}, {4105, 12, 0},
+        {4118, 11, 0}, {4130, 4, 0}, {4135, 8, 0}, {4144, 20, 0}, {4165, 12, 0}, {4178, 8, 0}, {4187, 11, 0}, {4199, 10, 0},
+        {4210, 13, 0}, {4224, 7, 0}, {4232, 13, 0}, {4246, 7, 0}, {4254, 8, 0}, {4263, 15, 0}, {4279, 15, 0}, {4295, 5, 0},
+        {4301, 7, 0}, {4309, 8, 0}, {4318, 9, 0}, {4328, 8, 0}, {4337, 4, 0}, {4342, 12, 0}, {4355, 11, 0}, {4367, 9, 0},
+        {4377, 7, 0}, {4385, 8, 0}, {4394, 16, 0}, {4411, 8, 0}, {4420, 4, 0}, {4425, 8, 0}, {4434, 7, 0}, {4442, 9, 0},
+        {4452, 7, 0}, {4460, 8, 0}, {4469, 8, 0}, {4478, 12, 0}, {4491, 10, 0}, {4502, 12, 0}, {4515, 13, 0}, {4529, 8, 0},
+        {4538, 6, 0}, {4545, 5, 0}, {4551, 4, 0}, {4556, 9, 0}, {4566, 8, 0}, {4575, 7, 0}, {4583, 6, 0}, {4590, 8, 0},
+        {4599, 6, 0}, {4606, 7, 0}, {4614, 12, 0}, {4627, 10, 0}, {4638, 7, 0}, {4646, 10, 0}, {4657, 5, 0}, {4663, 6, 0},
+        {4670, 22, 0}, {4693, 7, 0}, {4701, 7, 0}, {4709, 6, 0}, {4716, 12, 0}, {4729, 8, 0}, {4738, 12, 0}, {4751, 13, 0},
+        {4765, 11, 0}, {4777, 20, 0}, {4798, 5, 0}, {4804, 18, 0}, {4823, 7, 0}, {4831, 5, 0}, {4837, 9, 0}, {4847, 8, 0},
+        {4856, 3, 0}, {4860, 11, 0}, {4872, 8, 0}, {4881, 7, 0}, {4889, 7, 0}, {4897, 7, 0}, {4905, 18, 0}, {4924, 19, 0},
+        {4944, 17, 0}, {4962, 32, 0}, {4995, 27, 0}, {5023, 31, 0}, {5055, 25, 0}, {5081, 19, 0}, {5101, 13, 0}, {5115, 14, 0},
+        {5130, 12, 0}, {5143, 10, 0}, {5154, 15, 0}, {5170, 15, 0}, {5186, 12, 0}, {5199, 12, 0}, {5212, 13, 0}, {5226, 14, 0},
+        {5241, 16, 0}, {5258, 13, 0}, {5272, 15, 0}, {5288, 8, 0}, {5297, 15, 0}, {5313, 20, 0}, {5334, 15, 0}, {5350, 15, 0},
+        {5366, 13, 0}, {5380, 11, 0}, {5392, 21, 0}, {5414, 11, 0}, {5426, 18, 0}, {5445, 11, 0}, {5457, 11, 0}, {5469, 13, 0},
+        {5483, 16, 0}, {5500, 13, 0}, {5514, 15, 0}, {5530, 18, 0}, {5549, 11, 0}, {5561, 5, 0}, {5567, 10, 0}, {5578, 17, 0},
+        {5596, 22, 0}, {5619, 11, 0}, {5631, 12, 0}, {5644, 16, 0}, {5661, 15, 0}, {5677, 16, 0}, {5694, 9, 0}, {5704, 25, 0},
+        {5730, 9, 0}, {5740, 21, 0}, {5762, 12, 0}, {5775, 14, 0}, {5790, 17, 0}, {5808, 11, 0}, {5820, 17, 0}, {5838, 13, 0},
+        {5852, 13, 0}, {5866, 19, 0}, {5886, 19, 0}, {5906, 24, 0}, {5931, 14, 0}, {5946, 18, 0}, {5965, 12, 0}, {5978, 11, 0},
+        {5990, 19, 0}, {6010, 14, 0}, {6025, 14, 0}, {6040, 16, 0}, {6057, 15, 0}, {6073, 23, 0}, {6097, 14, 0}, {6112, 17, 0},
+        {6130, 21, 0}, {6152, 14, 0}, {6167, 19, 0}, {6187, 29, 0}, {6217, 21, 0}, {6239, 11, 0}, {6251, 18, 0}, {6270, 17, 0},
+        {6288, 6, 0}, {6295, 8, 0}, {6304, 8, 0}, {6313, 7, 0}, {6321, 6, 0}, {6328, 6, 0}, {6335, 11, 0}, {6347, 9, 0},
+        {6357, 8, 0}, {6366, 7, 0}, {6374, 6, 0}, {6381, 5, 0}, {6387, 10, 0}, {6398, 8, 0}, {6407, 6, 0}, {6414, 7, 0},
+        {6422, 5, 0}, {6428, 8, 0}, {6437, 9, 0}, {6447, 6, 0}, {6454, 5, 0}, {6460, 5, 0}, {6466, 8, 0}, {6475, 10, 0},
+        {6486, 14, 0}, {6501, 14, 0}, {6516, 5, 0}, {6522, 14, 0}, {6537, 7, 0}, {6545, 6, 0}, {6552, 6, 0}, {6559, 6, 0},
+        {6566, 6, 0}, {6573, 7, 0}, {6581, 20, 0}, {6602, 5, 0}, {6608, 38, 0}, {6647, 17, 0}, {6665, 9, 0}, {6675, 15, 0},
+        {6691, 7, 0}, {6699, 8, 0},
+};
+
+static char TERRITORY_NAMES_UNPACKED_FI[6708];
+
+static const PackedTerritoryNames PACKED_TERRITORY_NAMES_FI = {
+        TERRITORY_NAMES_UNPACKED_FI, 6708, TERRITORY_NAMES_PACKED_FI, 3429, TERRITORY_NAMES_PAIRS_FI,
+        TERRITORY_NAME_ALTERNATIVES_START_FI, TERRITORY_NAME_ALTERNATIVES_FI};
+
+#else
+
+static const PackedTerritoryNames PACKED_TERRITORY_NAMES_FI = {NULL, 0, NULL, 0, NULL, NULL, NULL};
+
+#endif // MAPCODE_SUPPORT_LANGUAGE_FI
+
+#ifdef MAPCODE_SUPPORT_LANGUAGE_FR // French
+
+// 7201 bytes, packed to 3602
+static const unsigned char TERRITORY_NAMES_PACKED_FR[3602] = {
+        86, 36, 126, 2, 124, 67, 198, 4, 134, 86, 36, 126, 2, 124, 83, 174, 83, 105, 189, 103, 146, 14, 186, 37,
+        71, 197, 200, 216, 59, 111, 107, 49, 62, 243, 67, 239, 127, 124, 60, 75, 101, 49, 157, 203, 66, 12, 116, 104,
+        246, 209, 121, 191, 62, 114, 117, 59, 117, 118, 11, 117, 125, 186, 97, 37, 83, 174, 204, 116, 6, 124, 82, 111,
+        121, 62, 109, 23, 33, 80, 187, 115, 45, 66, 5, 203, 204, 116, 6, 0, 165, 102, 57, 107, 229, 80, 104, 143,
+        108, 170, 32, 73, 115, 212, 124, 80, 104, 143, 108, 170, 32, 73, 115, 238, 60, 80, 198, 99, 97, 54, 110, 0,
+        39, 3, 66, 159, 41, 201, 21, 109, 117, 100, 10, 59, 242, 3, 98, 148, 2, 110, 28, 55, 108, 96, 239, 4,
+        2, 32, 73, 213, 105, 27, 203, 204, 6, 219, 21, 110, 10, 101, 121, 145, 110, 103, 117, 143, 108, 224, 14, 116,
+        115, 21, 26, 116, 0, 74, 21, 115, 101, 121, 0, 39, 3, 184, 22, 58, 109, 156, 87, 11, 108, 25, 229, 70,
+        117, 116, 129, 207, 70, 117, 116, 129, 8, 60, 86, 105, 21, 103, 33, 98, 148, 2, 110, 28, 193, 76, 105, 101,
+        35, 116, 27, 58, 101, 6, 145, 114, 117, 98, 8, 60, 204, 115, 104, 11, 108, 53, 34, 111, 150, 34, 192, 99,
+        61, 193, 60, 67, 111, 111, 107, 203, 80, 105, 251, 43, 149, 77, 28, 49, 14, 124, 77, 28, 49, 14, 191, 105,
+        19, 4, 203, 184, 22, 58, 111, 112, 104, 43, 149, 78, 105, 4, 118, 189, 115, 124, 78, 105, 4, 118, 189, 115,
+        243, 67, 140, 109, 222, 201, 14, 97, 54, 101, 44, 32, 83, 174, 69, 117, 58, 196, 3, 194, 83, 166, 207, 83,
+        166, 207, 83, 116, 32, 69, 117, 58, 196, 146, 11, 100, 105, 118, 10, 53, 139, 43, 72, 246, 189, 110, 101, 44,
+        32, 65, 115, 99, 27, 115, 210, 229, 84, 22, 58, 2, 7, 150, 67, 129, 104, 207, 65, 115, 99, 27, 115, 210,
+        124, 84, 22, 58, 2, 7, 150, 67, 129, 104, 224, 11, 116, 1, 185, 27, 63, 1, 60, 86, 105, 21, 103, 33,
+        34, 192, 99, 61, 10, 125, 187, 199, 116, 221, 118, 11, 98, 12, 100, 229, 74, 2, 32, 77, 187, 27, 124, 74,
+        2, 32, 77, 187, 27, 203, 86, 6, 99, 162, 182, 108, 10, 45, 185, 27, 63, 6, 10, 124, 185, 27, 63, 6,
+        193, 39, 3, 72, 101, 12, 100, 182, 77, 186, 68, 14, 11, 100, 124, 60, 77, 186, 68, 14, 11, 29, 66, 12,
+        98, 63, 1, 65, 110, 116, 237, 117, 97, 182, 66, 12, 98, 117, 100, 207, 66, 12, 98, 117, 100, 8, 67, 117,
+        26, 195, 167, 97, 37, 83, 101, 121, 35, 231, 193, 80, 11, 97, 127, 243, 204, 105, 2, 110, 10, 134, 165, 29,
+        65, 213, 30, 114, 1, 92, 34, 0, 39, 55, 77, 31, 83, 139, 43, 76, 117, 99, 13, 77, 126, 114, 14, 4,
+        115, 105, 101, 124, 176, 116, 36, 115, 32, 102, 245, 247, 4, 115, 16, 77, 126, 114, 14, 4, 215, 83, 157, 206,
+        158, 59, 135, 8, 68, 64, 6, 28, 1, 66, 151, 114, 101, 42, 110, 0, 75, 105, 22, 98, 36, 46, 60, 84,
+        172, 20, 10, 182, 67, 140, 20, 10, 124, 67, 140, 20, 10, 53, 97, 144, 84, 64, 4, 182, 80, 114, 6, 99,
+        170, 101, 124, 80, 114, 6, 99, 170, 1, 72, 135, 32, 75, 135, 125, 12, 116, 6, 28, 1, 60, 70, 247, 111,
+        4, 219, 63, 49, 19, 112, 154, 64, 30, 193, 39, 3, 77, 62, 22, 99, 1, 40, 129, 210, 0, 76, 117, 120,
+        209, 98, 158, 103, 53, 34, 111, 8, 71, 4, 30, 103, 105, 136, 94, 100, 182, 108, 33, 60, 83, 93, 119, 234,
+        134, 94, 100, 124, 60, 83, 93, 119, 234, 134, 205, 80, 57, 121, 110, 4, 115, 105, 3, 102, 114, 2, 195, 167,
+        97, 25, 154, 206, 45, 86, 21, 116, 59, 114, 6, 198, 4, 182, 84, 111, 98, 141, 111, 124, 84, 111, 98, 141,
+        37, 66, 114, 129, 101, 46, 84, 251, 33, 62, 58, 200, 33, 194, 2, 216, 208, 28, 33, 102, 114, 2, 195, 167,
+        97, 25, 193, 80, 117, 21, 116, 144, 82, 126, 37, 184, 121, 112, 114, 1, 76, 197, 31, 74, 34, 140, 20, 1,
+        71, 230, 13, 81, 36, 12, 243, 70, 11, 107, 238, 86, 2, 117, 36, 117, 125, 14, 116, 177, 4, 103, 114, 37,
+        66, 151, 34, 5, 59, 211, 30, 32, 111, 22, 162, 11, 53, 119, 97, 122, 143, 147, 75, 111, 119, 101, 42, 116,
+        243, 70, 236, 106, 46, 78, 159, 231, 43, 67, 11, 245, 14, 13, 83, 108, 91, 177, 13, 73, 115, 26, 195, 171,
+        108, 59, 242, 33, 112, 11, 10, 116, 6, 105, 27, 115, 53, 11, 118, 63, 30, 201, 49, 105, 122, 1, 68, 106,
+        197, 19, 116, 46, 77, 186, 245, 111, 249, 82, 119, 93, 8, 72, 140, 116, 46, 66, 172, 129, 100, 46, 92, 6,
+        4, 3, 4, 20, 36, 111, 22, 11, 244, 98, 155, 60, 83, 11, 64, 14, 145, 114, 109, 177, 13, 76, 10, 199,
+        104, 37, 66, 49, 103, 28, 146, 57, 100, 233, 13, 92, 6, 4, 43, 66, 252, 62, 59, 97, 105, 119, 31, 66,
+        104, 19, 116, 31, 94, 252, 220, 187, 115, 45, 66, 156, 68, 2, 209, 12, 56, 69, 58, 14, 13, 52, 23, 64,
+        6, 126, 61, 221, 108, 91, 97, 20, 13, 67, 111, 58, 150, 82, 126, 8, 66, 127, 110, 235, 72, 21, 122, 4,
+        103, 91, 6, 154, 114, 111, 36, 13, 84, 111, 103, 37, 76, 41, 217, 13, 76, 198, 117, 155, 83, 22, 32, 76,
+        2, 107, 8, 71, 4, 30, 103, 13, 73, 114, 212, 221, 105, 21, 26, 32, 76, 101, 14, 220, 2, 34, 8, 52,
+        3, 116, 35, 189, 20, 1, 92, 121, 2, 3, 102, 114, 2, 195, 167, 97, 25, 1, 176, 109, 105, 26, 116, 115,
+        32, 65, 26, 98, 33, 85, 110, 25, 145, 117, 116, 22, 35, 1, 65, 122, 21, 98, 140, 100, 106, 31, 83, 21,
+        98, 13, 74, 30, 100, 155, 80, 30, 116, 117, 103, 11, 190, 135, 114, 13, 67, 30, 4, 136, 205, 73, 115, 212,
+        1, 92, 36, 209, 11, 8, 67, 117, 98, 8, 66, 117, 108, 103, 12, 13, 76, 197, 192, 8, 72, 14, 100, 172,
+        156, 66, 177, 6, 0, 176, 114, 121, 116, 104, 114, 4, 146, 11, 97, 119, 46, 67, 30, 4, 136, 165, 29, 78,
+        126, 12, 141, 117, 8, 185, 189, 99, 1, 84, 63, 106, 105, 107, 240, 66, 123, 108, 63, 225, 191, 4, 112, 11,
+        59, 129, 25, 13, 94, 114, 6, 34, 1, 85, 114, 117, 103, 117, 187, 0, 67, 230, 111, 100, 103, 221, 121, 114,
+        13, 83, 177, 4, 103, 11, 0, 75, 54, 103, 104, 105, 122, 240, 66, 246, 12, 117, 115, 219, 121, 202, 76, 97,
+        127, 0, 82, 19, 109, 155, 71, 104, 202, 79, 117, 103, 93, 250, 111, 121, 62, 109, 43, 85, 110, 46, 92, 6,
+        4, 1, 176, 20, 36, 101, 172, 53, 151, 12, 150, 239, 99, 236, 162, 11, 124, 83, 151, 26, 19, 46, 71, 166,
+        14, 191, 159, 231, 43, 90, 4, 212, 1, 66, 172, 107, 6, 150, 70, 5, 255, 104, 143, 170, 112, 6, 193, 73,
+        116, 11, 13, 79, 109, 31, 80, 57, 111, 103, 110, 154, 195, 180, 116, 43, 100, 96, 73, 118, 214, 1, 165, 118,
+        189, 103, 146, 11, 97, 25, 13, 86, 105, 41, 110, 34, 0, 70, 6, 212, 154, 135, 111, 45, 66, 26, 122, 122,
+        233, 143, 108, 244, 108, 209, 141, 110, 1, 74, 206, 14, 0, 90, 211, 98, 166, 119, 220, 12, 141, 117, 187, 0,
+        73, 26, 56, 204, 239, 0, 79, 117, 122, 98, 4, 107, 240, 94, 189, 100, 220, 206, 19, 5, 235, 78, 159, 231,
+        43, 92, 6, 4, 154, 34, 21, 19, 110, 59, 172, 107, 109, 177, 240, 69, 115, 112, 141, 110, 1, 84, 104, 140,
+        212, 1, 89, 4, 109, 27, 0, 70, 114, 2, 99, 1, 195, 133, 212, 32, 39, 10, 124, 65, 11, 147, 75, 27,
+        121, 8, 66, 199, 115, 119, 202, 77, 63, 141, 5, 99, 12, 0, 85, 107, 26, 249, 94, 100, 45, 83, 19, 100,
+        31, 52, 3, 99, 162, 26, 102, 22, 99, 61, 221, 64, 11, 13, 65, 102, 103, 104, 2, 240, 77, 121, 2, 109,
+        12, 124, 66, 54, 109, 155, 90, 230, 13, 184, 143, 46, 84, 172, 20, 13, 80, 152, 240, 77, 111, 122, 230, 28,
+        1, 78, 34, 197, 13, 86, 27, 101, 122, 117, 49, 8, 78, 237, 192, 8, 84, 2, 122, 155, 176, 103, 121, 112,
+        116, 146, 62, 148, 155, 66, 57, 105, 118, 13, 176, 116, 104, 105, 111, 112, 13, 67, 57, 64, 98, 13, 65, 102,
+        22, 20, 136, 205, 77, 11, 46, 65, 110, 103, 57, 8, 78, 237, 21, 59, 35, 97, 29, 80, 247, 19, 125, 135,
+        57, 13, 73, 114, 31, 76, 197, 121, 221, 19, 100, 31, 73, 213, 14, 4, 215, 68, 160, 22, 208, 32, 102, 245,
+        4, 200, 59, 108, 97, 120, 99, 11, 224, 30, 49, 127, 145, 103, 117, 5, 99, 11, 105, 162, 193, 67, 57, 211,
+        8, 81, 117, 21, 4, 216, 37, 72, 236, 11, 103, 37, 176, 116, 36, 16, 77, 101, 120, 126, 37, 84, 166, 5,
+        99, 37, 78, 187, 12, 198, 219, 2, 97, 106, 117, 36, 255, 117, 101, 9, 8, 89, 117, 99, 36, 241, 110, 0,
+        81, 117, 6, 116, 2, 150, 82, 111, 37, 83, 6, 11, 111, 8, 67, 34, 112, 101, 35, 146, 234, 111, 186, 241,
+        110, 53, 2, 32, 76, 117, 25, 254, 199, 127, 195, 173, 219, 251, 21, 37, 78, 117, 101, 118, 144, 76, 101, 195,
+        179, 110, 201, 5, 115, 43, 67, 11, 105, 102, 30, 110, 13, 86, 21, 186, 114, 117, 122, 0, 184, 105, 206, 156,
+        66, 5, 115, 43, 67, 11, 105, 102, 30, 110, 105, 136, 205, 90, 186, 36, 101, 99, 156, 74, 11, 25, 99, 37,
+        84, 34, 62, 108, 170, 156, 79, 97, 120, 186, 8, 68, 172, 123, 37, 67, 111, 151, 117, 143, 8, 83, 14, 30,
+        8, 184, 105, 104, 117, 151, 117, 8, 185, 111, 27, 238, 65, 26, 98, 105, 3, 83, 97, 19, 100, 198, 154, 135,
+        111, 45, 75, 6, 115, 104, 5, 8, 183, 103, 247, 13, 75, 97, 122, 152, 104, 58, 31, 65, 114, 103, 162, 249,
+        68, 34, 2, 229, 68, 105, 117, 0, 68, 63, 26, 229, 78, 141, 12, 32, 72, 233, 49, 46, 184, 93, 237, 12,
+        104, 145, 213, 34, 2, 182, 78, 126, 111, 98, 12, 0, 76, 152, 115, 104, 63, 119, 101, 101, 112, 0, 68, 49,
+        104, 46, 77, 101, 103, 104, 11, 187, 8, 78, 141, 11, 147, 77, 2, 105, 47, 114, 59, 22, 47, 114, 224, 105,
+        122, 111, 26, 109, 53, 105, 107, 107, 211, 0, 80, 27, 100, 106, 166, 190, 12, 121, 202, 65, 114, 129, 196, 11,
+        254, 228, 225, 145, 115, 115, 34, 201, 105, 104, 12, 0, 85, 116, 216, 152, 104, 147, 71, 111, 8, 75, 21, 11,
+        8, 84, 34, 143, 32, 78, 63, 117, 190, 211, 196, 11, 254, 228, 225, 0, 74, 34, 109, 117, 182, 67, 196, 209,
+        54, 154, 104, 104, 36, 116, 25, 103, 12, 104, 0, 74, 104, 12, 107, 104, 147, 75, 12, 110, 36, 152, 250, 97,
+        106, 15, 104, 31, 79, 100, 25, 104, 207, 79, 22, 115, 115, 8, 92, 106, 12, 36, 201, 27, 103, 11, 43, 239,
+        99, 236, 162, 11, 125, 63, 104, 121, 150, 80, 228, 225, 59, 49, 123, 202, 65, 213, 104, 26, 254, 228, 225, 125,
+        151, 12, 5, 104, 116, 114, 8, 85, 116, 216, 254, 228, 225, 0, 80, 14, 100, 234, 247, 121, 191, 159, 231, 43,
+        71, 11, 108, 10, 134, 205, 84, 242, 55, 108, 150, 99, 206, 198, 11, 3, 62, 58, 200, 105, 27, 110, 1, 84,
+        242, 55, 108, 150, 98, 97, 105, 55, 74, 21, 118, 25, 59, 242, 136, 165, 29, 65, 117, 58, 200, 105, 3, 77,
+        192, 100, 210, 11, 1, 84, 5, 109, 155, 86, 126, 116, 111, 22, 8, 65, 117, 58, 200, 235, 79, 99, 99, 236,
+        162, 11, 1, 81, 117, 101, 27, 115, 238, 68, 160, 22, 208, 32, 102, 245, 4, 200, 53, 21, 103, 170, 244, 141,
+        111, 156, 82, 105, 111, 16, 74, 2, 101, 54, 37, 69, 115, 112, 195, 173, 148, 144, 83, 2, 116, 37, 82, 105,
+        144, 185, 93, 23, 144, 165, 116, 220, 12, 97, 195, 173, 98, 8, 83, 2, 116, 150, 67, 36, 12, 6, 8, 80,
+        21, 110, 230, 19, 99, 145, 109, 206, 241, 0, 67, 101, 12, 241, 145, 99, 114, 220, 12, 2, 241, 0, 82, 111,
+        26, 211, 250, 14, 100, 195, 180, 110, 105, 8, 83, 195, 163, 144, 80, 62, 108, 255, 105, 62, 195, 173, 59, 239,
+        2, 116, 6, 115, 0, 82, 105, 144, 185, 93, 23, 144, 94, 108, 125, 12, 2, 104, 195, 163, 37, 71, 111, 105,
+        241, 115, 125, 36, 144, 185, 127, 115, 111, 7, 144, 94, 108, 201, 151, 105, 224, 6, 5, 32, 71, 21, 97, 25,
+        125, 36, 144, 185, 127, 115, 255, 12, 8, 65, 109, 97, 122, 14, 156, 68, 160, 22, 208, 16, 67, 57, 117, 109,
+        98, 105, 250, 104, 111, 100, 3, 73, 115, 238, 68, 49, 97, 119, 12, 154, 14, 110, 101, 208, 126, 117, 116, 191,
+        101, 119, 32, 74, 21, 115, 101, 121, 191, 101, 119, 32, 72, 34, 112, 115, 104, 54, 1, 86, 21, 109, 14, 116,
+        125, 5, 115, 196, 117, 115, 41, 116, 115, 190, 97, 119, 140, 125, 12, 121, 238, 86, 54, 103, 6, 235, 79, 99,
+        99, 236, 162, 11, 154, 12, 57, 6, 136, 205, 77, 61, 1, 73, 213, 105, 202, 75, 162, 117, 99, 107, 121, 59,
+        27, 110, 10, 115, 101, 1, 86, 54, 103, 6, 13, 79, 104, 105, 255, 27, 110, 115, 121, 108, 118, 155, 77, 252,
+        252, 170, 112, 46, 76, 19, 25, 105, 2, 244, 166, 34, 8, 65, 114, 107, 222, 156, 67, 12, 57, 6, 136, 165,
+        29, 78, 101, 119, 32, 89, 30, 56, 73, 111, 119, 8, 73, 108, 108, 6, 111, 25, 0, 71, 4, 30, 103, 13,
+        87, 25, 99, 14, 115, 6, 0, 70, 108, 111, 22, 100, 146, 252, 19, 22, 0, 79, 107, 108, 151, 64, 8, 68,
+        152, 199, 97, 134, 165, 29, 87, 5, 104, 157, 217, 0, 68, 152, 199, 97, 134, 205, 78, 101, 98, 114, 5, 107,
+        8, 75, 222, 156, 73, 100, 151, 37, 85, 116, 151, 125, 6, 110, 10, 199, 224, 234, 237, 31, 87, 121, 64, 157,
+        0, 79, 114, 101, 103, 14, 0, 67, 57, 111, 228, 37, 78, 101, 118, 63, 8, 65, 22, 122, 14, 8, 78, 159,
+        101, 62, 45, 77, 101, 120, 28, 146, 14, 116, 202, 67, 11, 105, 102, 30, 110, 13, 84, 101, 120, 5, 145, 108,
+        5, 107, 8, 67, 57, 64, 98, 235, 66, 148, 2, 110, 28, 244, 98, 21, 116, 8, 79, 110, 216, 105, 37, 81,
+        117, 4, 98, 101, 99, 53, 5, 107, 36, 35, 101, 119, 31, 77, 2, 198, 111, 98, 8, 84, 251, 43, 78, 101,
+        117, 118, 1, 78, 159, 101, 62, 45, 66, 114, 129, 115, 119, 126, 56, 78, 159, 231, 43, 176, 99, 127, 115, 1,
+        39, 43, 100, 117, 45, 80, 114, 6, 99, 43, 69, 100, 119, 12, 29, 89, 117, 107, 14, 59, 242, 10, 134, 165,
+        100, 45, 79, 117, 10, 116, 191, 129, 233, 117, 116, 0, 73, 213, 1, 65, 117, 58, 200, 13, 66, 114, 4, 115,
+        143, 0, 85, 83, 65, 124, 176, 116, 36, 115, 45, 85, 110, 25, 7, 96, 65, 109, 192, 20, 101, 124, 65, 109,
+        192, 20, 146, 101, 120, 28, 146, 127, 99, 19, 203, 80, 248, 21, 115, 98, 158, 103, 132, 75, 11, 6, 157, 26,
+        29, 73, 110, 103, 19, 35, 13, 52, 23, 131, 65, 100, 121, 103, 117, 4, 1, 52, 23, 131, 79, 115, 115, 248,
+        105, 136, 165, 100, 45, 183, 155, 75, 166, 12, 100, 6, 111, 45, 66, 11, 107, 12, 13, 138, 75, 12, 36, 35,
+        140, 4, 118, 111, 45, 84, 35, 21, 107, 10, 215, 52, 3, 116, 35, 248, 35, 189, 110, 1, 138, 84, 35, 159,
+        196, 13, 181, 73, 118, 2, 91, 37, 24, 76, 170, 41, 95, 181, 79, 114, 49, 132, 84, 19, 108, 223, 66, 49,
+        103, 30, 111, 253, 86, 108, 63, 211, 54, 132, 75, 158, 232, 75, 11, 117, 103, 223, 84, 230, 91, 132, 66, 22,
+        2, 232, 73, 12, 127, 108, 233, 108, 132, 82, 105, 97, 122, 31, 181, 65, 58, 26, 107, 104, 31, 24, 77, 127,
+        99, 19, 132, 83, 109, 57, 27, 95, 52, 136, 68, 141, 117, 10, 116, 31, 24, 86, 30, 14, 101, 106, 132, 78,
+        91, 103, 30, 111, 253, 80, 115, 107, 91, 132, 75, 111, 58, 114, 64, 8, 218, 83, 116, 233, 114, 111, 112, 57,
+        0, 218, 75, 114, 5, 110, 111, 100, 12, 0, 138, 75, 11, 109, 19, 107, 13, 24, 84, 118, 21, 132, 76, 177,
+        157, 26, 253, 82, 111, 58, 91, 132, 86, 57, 103, 111, 103, 26, 253, 86, 57, 111, 103, 100, 223, 77, 158, 109,
+        2, 95, 138, 67, 12, 246, 13, 68, 160, 22, 208, 32, 62, 217, 64, 55, 78, 177, 248, 215, 52, 23, 33, 75,
+        64, 25, 0, 181, 65, 114, 107, 104, 123, 49, 95, 138, 77, 30, 100, 91, 13, 24, 78, 105, 106, 110, 105, 32,
+        78, 91, 103, 30, 111, 253, 80, 27, 122, 223, 75, 54, 91, 0, 52, 23, 33, 204, 25, 0, 181, 79, 114, 27,
+        98, 158, 103, 0, 181, 79, 117, 108, 105, 2, 91, 95, 218, 80, 21, 109, 0, 138, 66, 196, 107, 54, 13, 79,
+        117, 100, 109, 158, 116, 13, 52, 136, 84, 36, 12, 58, 31, 24, 83, 34, 12, 223, 83, 12, 36, 91, 0, 73,
+        34, 11, 111, 45, 78, 177, 248, 215, 75, 104, 2, 116, 121, 115, 45, 77, 222, 25, 132, 83, 118, 21, 100, 108,
+        91, 232, 84, 105, 19, 109, 27, 132, 75, 158, 103, 31, 24, 84, 35, 49, 105, 166, 6, 95, 138, 66, 19, 22,
+        36, 13, 218, 84, 114, 222, 98, 140, 107, 11, 13, 181, 73, 114, 107, 19, 116, 232, 78, 91, 127, 115, 197, 54,
+        232, 84, 64, 95, 181, 79, 109, 95, 138, 75, 104, 152, 5, 215, 24, 75, 209, 21, 91, 37, 138, 108, 131, 183,
+        116, 140, 0, 218, 108, 131, 183, 116, 140, 0, 138, 84, 159, 8, 218, 75, 114, 5, 110, 111, 42, 12, 232, 77,
+        141, 63, 31, 84, 35, 19, 107, 199, 107, 8, 188, 134, 75, 34, 116, 35, 36, 107, 223, 83, 152, 104, 11, 249,
+        188, 134, 164, 46, 18, 32, 62, 217, 64, 3, 106, 117, 105, 102, 0, 218, 75, 104, 166, 12, 91, 95, 181, 65,
+        109, 158, 0, 138, 83, 152, 104, 207, 138, 89, 152, 19, 116, 13, 67, 2, 63, 250, 117, 115, 215, 83, 104, 123,
+        104, 97, 46, 84, 105, 2, 106, 6, 0, 80, 4, 107, 6, 190, 61, 31, 72, 117, 105, 134, 78, 157, 120, 105,
+        8, 184, 135, 113, 157, 0, 90, 104, 101, 106, 105, 123, 0, 74, 105, 123, 115, 117, 0, 70, 117, 106, 105, 31,
+        65, 110, 104, 117, 46, 76, 105, 97, 14, 157, 53, 104, 93, 135, 53, 104, 2, 120, 46, 74, 105, 123, 120, 46,
+        72, 27, 31, 92, 105, 122, 104, 19, 219, 123, 100, 135, 190, 117, 98, 101, 46, 74, 143, 6, 190, 101, 98, 101,
+        46, 83, 104, 97, 2, 120, 46, 77, 135, 57, 235, 6, 116, 192, 101, 172, 1, 72, 101, 143, 135, 106, 105, 123,
+        190, 129, 31, 40, 103, 210, 32, 62, 217, 64, 3, 90, 104, 117, 123, 134, 92, 123, 120, 46, 83, 234, 117, 31,
+        89, 129, 110, 31, 88, 105, 122, 123, 124, 84, 197, 41, 0, 71, 222, 117, 0, 81, 157, 104, 97, 46, 40, 103,
+        210, 32, 62, 217, 64, 3, 19, 42, 103, 104, 158, 136, 88, 6, 106, 105, 123, 0, 184, 249, 60, 109, 6, 101,
+        172, 33, 246, 111, 237, 110, 4, 10, 7, 33, 176, 116, 36, 115, 45, 85, 110, 25, 0, 39, 55, 67, 108, 170,
+        112, 21, 217, 145, 110, 216, 208, 28, 1, 73, 110, 116, 21, 110, 36, 210, 11, 124, 77, 14, 100, 101, 124, 84,
+        251, 1,
+};
+
+static const unsigned char TERRITORY_NAMES_PAIRS_FR[256][2] = {
+        {0, 0}, {101, 0}, {97, 110}, {101, 32}, {195, 169}, {97, 115}, {105, 110}, {32, 100}, {97, 0}, {98, 108}, {101, 115}, {97, 108},
+        {97, 114}, {105, 1}, {111, 110}, {5, 116}, {7, 3}, {9, 15}, {79, 17}, {111, 117}, {113, 117}, {101, 114}, {114, 105}, {3, 100},
+        {18, 16}, {105, 115}, {114, 97}, {101, 110}, {105, 20}, {100, 0}, {111, 114}, {2, 0}, {32, 32}, {10, 32}, {97, 109}, {99, 104},
+        {97, 116}, {111, 0}, {142, 108}, {195, 38}, {82, 4}, {101, 116}, {195, 175}, {101, 45}, {44, 44}, {45, 45}, {105, 0}, {112, 117},
+        {117, 32}, {101, 108}, {9, 28}, {40, 47}, {51, 50}, {0, 83}, {105, 114}, {23, 3}, {107, 0}, {111, 108}, {115, 116}, {0, 84},
+        {39, 33}, {97, 6}, {97, 117}, {97, 100}, {111, 109}, {65, 65}, {66, 66}, {67, 67}, {68, 68}, {69, 69}, {70, 70}, {71, 71},
+        {72, 72}, {73, 73}, {74, 74}, {75, 75}, {76, 76}, {77, 77}, {78, 78}, {79, 79}, {80, 80}, {81, 81}, {82, 82}, {83, 83},
+        {84, 84}, {85, 85}, {86, 86}, {87, 87}, {88, 88}, {89, 89}, {90, 90}, {111, 118}, {71, 117}, {2, 100}, {83, 117}, {115, 56},
+        {96, 96}, {97, 97}, {98, 98}, {99, 99}, {100, 100}, {101, 101}, {102, 102}, {103, 103}, {104, 104}, {105, 105}, {106, 106}, {107, 107},
+        {108, 108}, {109, 109}, {110, 110}, {111, 111}, {112, 112}, {113, 113}, {114, 114}, {115, 115}, {116, 116}, {117, 117}, {118, 118}, {119, 119},
+        {120, 120}, {121, 121}, {122, 122}, {2, 103}, {124, 124}, {0, 77}, {105, 99}, {111, 115}, {128, 128}, {117, 110}, {128, 153}, {226, 130},
+        {0, 24}, {133, 133}, {7, 48}, {14, 103}, {23, 48}, {137, 137}, {52, 55}, {61, 116}, {97, 42}, {97, 103}, {142, 142}, {105, 108},
+        {111, 32}, {0, 65}, {1, 77}, {2, 29}, {22, 116}, {41, 45}, {97, 32}, {97, 104}, {97, 107}, {153, 153}, {1, 67}, {2, 13},
+        {5, 0}, {6, 103}, {19, 114}, {19, 118}, {25, 116}, {161, 161}, {27, 116}, {163, 163}, {75, 26}, {78, 30}, {97, 98}, {167, 167},
+        {168, 168}, {169, 169}, {105, 112}, {171, 171}, {117, 114}, {173, 173}, {139, 45}, {175, 175}, {195, 137}, {4, 110}, {7, 131}, {179, 179},
+        {180, 180}, {18, 178}, {45, 149}, {65, 108}, {67, 104}, {71, 114}, {97, 99}, {97, 121}, {164, 42}, {195, 168}, {0, 72}, {0, 78},
+        {4, 22}, {10, 0}, {41, 32}, {195, 195}, {97, 35}, {105, 98}, {105, 116}, {111, 116}, {114, 11}, {0, 66}, {2, 8}, {53, 174},
+        {77, 12}, {94, 29}, {97, 112}, {97, 124}, {99, 116}, {101, 109}, {105, 14}, {105, 109}, {108, 93}, {110, 100}, {111, 54}, {115, 13},
+        {116, 12}, {116, 14}, {188, 16}, {0, 92}, {1, 80}, {1, 83}, {2, 115}, {8, 24}, {8, 77}, {10, 104}, {226, 226}, {21, 148},
+        {26, 100}, {32, 194}, {34, 98}, {49, 108}, {95, 24}, {97, 118}, {105, 35}, {105, 43}, {105, 100}, {105, 103}, {108, 147}, {111, 99},
+        {160, 31}, {195, 161}, {227, 214}, {0, 60}, {1, 183}, {4, 100}, {4, 108}, {4, 114}, {4, 116}, {6, 1}, {8, 82}, {21, 114},
+        {25, 115}, {29, 24}, {32, 80}, {37, 80},
+};
+
+static const unsigned short TERRITORY_NAME_ALTERNATIVES_START_FR[_TERRITORY_MAX - _TERRITORY_MIN] = {
+        0, 3, 4, 5, 6, 8, 9, 10, 11, 12, 14, 15, 17, 18, 19, 20,
+        21, 22, 23, 24, 25, 26, 27, 29, 30, 31, 32, 33, 34, 35, 37, 38,
+        40, 41, 44, 45, 48, 49, 50, 51, 52, 54, 56, 58, 59, 61, 62, 63,
+        64, 65, 66, 67, 68, 69, 71, 72, 73, 74, 75, 76, 78, 80, 81, 82,
+        83, 84, 85, 86, 87, 88, 89, 91, 92, 93, 95, 96, 97, 98, 99, 100,
+        101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116,
+        117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132,
+        133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143, 144, 145, 146, 147, 148,
+        149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159, 160, 161, 162, 163, 164,
+        165, 166, 167, 168, 169, 170, 171, 172, 173, 174, 175, 176, 177, 178, 179, 180,
+        181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 192, 193, 194, 195, 196, 197,
+        198, 199, 200, 201, 202, 203, 204, 205, 206, 207, 208, 209, 210, 211, 212, 213,
+        214, 215, 216, 217, 218, 219, 220, 222, 223, 224, 225, 226, 227, 228, 229, 230,
+        232, 233, 234, 235, 236, 237, 238, 239, 240, 241, 242, 243, 244, 245, 246, 247,
+        248, 249, 250, 251, 252, 253, 254, 255, 256, 257, 258, 259, 260, 261, 262, 263,
+        264, 265, 266, 267, 268, 269, 270, 271, 272, 273, 274, 275, 276, 277, 278, 279,
+        280, 281, 282, 283, 284, 285, 286, 287, 288, 289, 290, 291, 292, 293, 294, 295,
+        296, 297, 298, 299, 300, 301, 302, 303, 304, 305, 306, 307, 308, 309, 310, 311,
+        312, 313, 314, 315, 316, 317, 318, 319, 320, 321, 322, 324, 325, 326, 327, 328,
+        329, 330, 331, 332, 333, 334, 335, 336, 337, 338, 339, 340, 341, 342, 343, 344,
+        345, 346, 347, 348, 349, 350, 351, 352, 353, 354, 355, 356, 357, 358, 359, 360,
+        361, 362, 363, 364, 365, 366, 367, 368, 369, 370, 371, 372, 373, 374, 375, 376,
+        377, 378, 379, 380, 381, 382, 383, 384, 385, 386, 387, 388, 389, 390, 391, 392,
+        393, 394, 395, 396, 397, 398, 399, 400, 401, 402, 403, 404, 405, 406, 407, 408,
+        409, 410, 411, 412, 413, 414, 415, 416, 417, 418, 419, 420, 421, 422, 423, 424,
+        425, 426, 427, 428, 429, 430, 431, 432, 433, 434, 435, 438, 439, 440, 441, 442,
+        443, 444, 445, 446, 447, 448, 449, 450, 451, 452, 453, 454, 455, 456, 457, 458,
+        459, 460, 461, 462, 463, 464, 465, 466, 467, 468, 469, 470, 471, 472, 473, 474,
+        475, 476, 477, 478, 479, 480, 481, 482, 483, 484, 485, 486, 487, 488, 489, 490,
+        491, 492, 493, 494, 495, 496, 497, 498, 499, 500, 501, 502, 503, 504, 505, 506,
+        507, 508, 509, 510, 511, 512, 513, 514, 515, 516, 517, 518, 519, 520, 521, 523,
+        524, 525, 526, 527, 528, 529, 530, 531, 532, 533, 534, 535, 536, 537, 538, 539,
+        540, 541, 542, 543, 544, 545, 546, 547, 548, 549, 550, 551, 552, 554, 555, 556,
+        557, 558, 559, 560, 561, 564,
+};
+
+static const TerritoryNameAlternative TERRITORY_NAME_ALTERNATIVES_FR[564] = {
+        {0, 7, 0}, {8, 16, 0}, {25, 12, 0}, {38, 6, 0}, {45, 9, 0}, {55, 7, 0}, {63, 11, 0}, {75, 13, 0},
+        {89, 17, 0}, {107, 5, 0}, {113, 6, 0}, {120, 5, 0}, {126, 12, 0}, {139, 20, 0}, {160, 12, 0}, {173, 25, 0},
+        {199, 14, 0}, {214, 14, 0}, {229, 11, 0}, {241, 8, 0}, {250, 41, 0}, {292, 11, 0}, {304, 9, 0}, {314, 8, 0},
+        {323, 10, 0}, {334, 6, 0}, {341, 14, 0}, {356, 16, 0}, {373, 6, 0}, {380, 26, 0}, {407, 13, 0}, {421, 5, 0},
+        {427, 14, 0}, {442, 18, 0}, {461, 10, 0}, {472, 24, 0}, {497, 8, 0}, {506, 6, 0}, {513, 28, 0}, {542, 8, 0},
+        {551, 14, 0}, {566, 31, 0}, {598, 4, 0}, {603, 11, 0}, {615, 8, 0}, {624, 46, 0}, {671, 9, 0}, {681, 16, 0},
+        {698, 5, 0}, {704, 7, 0}, {712, 26, 0}, {739, 7, 0}, {747, 21, 0}, {769, 9, 0}, {779, 31, 0}, {811, 10, 0},
+        {822, 23, 0}, {846, 15, 0}, {862, 7, 0}, {870, 18, 0}, {889, 7, 0}, {897, 8, 0}, {906, 10, 0}, {917, 6, 0},
+        {924, 23, 0}, {948, 7, 0}, {956, 4, 0}, {961, 11, 0}, {973, 12, 0}, {986, 11, 0}, {998, 32, 0}, {1031, 9, 0},
+        {1041, 5, 0}, {1047, 9, 0}, {1057, 8, 0}, {1066, 8, 0}, {1075, 25, 0}, {1101, 8, 0}, {1110, 21, 0}, {1132, 8, 0},
+        {1141, 9, 0}, {1151, 10, 0}, {1162, 13, 0}, {1176, 10, 0}, {1187, 7, 0}, {1195, 12, 0}, {1208, 8, 0}, {1217, 10, 0},
+        {1228, 5, 0}, {1234, 44, 0}, {1279, 21, 0}, {1301, 21, 0}, {1323, 8, 0}, {1332, 18, 0}, {1351, 6, 0}, {1358, 6, 0},
+        {1365, 44, 0}, {1410, 11, 0}, {1422, 6, 0}, {1429, 5, 0}, {1435, 9, 0}, {1445, 6, 0}, {1452, 5, 0}, {1458, 14, 0},
+        {1473, 7, 0}, {1481, 12, 0}, {1494, 7, 0}, {1502, 14, 0}, {1517, 9, 0}, {1527, 7, 0}, {1535, 11, 0}, {1547, 19, 0},
+        {1567, 9, 0}, {1577, 7, 0}, {1585, 24, 0}, {1610, 8, 0}, {1619, 6, 0}, {1626, 8, 0}, {1635, 10, 0}, {1646, 6, 0},
+        {1653, 6, 0}, {1660, 7, 0}, {1668, 20, 0}, {1689, 7, 0}, {1697, 13, 0}, {1711, 8, 0}, {1720, 7, 0}, {1728, 8, 0},
+        {1737, 8, 0}, {1746, 14, 0}, {1761, 6, 0}, {1768, 7, 0}, {1776, 6, 0}, {1783, 8, 0}, {1792, 8, 0}, {1801, 7, 0},
+        {1809, 23, 0}, {1833, 9, 0}, {1843, 10, 0}, {1854, 19, 0}, {1874, 7, 0}, {1882, 4, 0}, {1887, 8, 0}, {1896, 8, 0},
+        {1905, 9, 0}, {1915, 8, 0}, {1924, 7, 0}, {1932, 12, 0}, {1945, 6, 0}, {1952, 20, 0}, {1973, 17, 0}, {1991, 20, 0},
+        {2012, 8, 0}, {2021, 12, 0}, {2034, 6, 0}, {2041, 8, 0}, {2050, 8, 0}, {2059, 7, 0}, {2067, 13, 0}, {2081, 7, 0},
+        {2089, 9, 0}, {2099, 4, 0}, {2104, 8, 0}, {2113, 8, 0}, {2122, 8, 0}, {2131, 6, 0}, {2138, 10, 0}, {2149, 6, 0},
+        {2156, 14, 0}, {2171, 9, 0}, {2181, 6, 0}, {2188, 11, 0}, {2200, 10, 0}, {2211, 6, 0}, {2218, 7, 0}, {2226, 8, 0},
+        {2235, 7, 0}, {2243, 8, 0}, {2252, 5, 0}, {2258, 9, 0}, {2268, 12, 0}, {2281, 8, 0}, {2290, 6, 0}, {2297, 4, 0},
+        {2302, 8, 0}, {2311, 5, 0}, {2317, 7, 0}, {2325, 11, 0}, {2337, 7, 0}, {2345, 9, 0}, {2355, 17, 0}, {2373, 8, 0},
+        {2382, 5, 0}, {2388, 17, 0}, {2406, 12, 0}, {2419, 11, 0}, {2431, 6, 0}, {2438, 4, 0}, {2443, 7, 0}, {2451, 14, 0},
+        {2466, 8, 0}, {2475, 8, 0}, {2484, 7, 0}, {2492, 8, 0}, {2501, 17, 0}, {2519, 9, 0}, {2529, 5, 0}, {2535, 8, 0},
+        {2544, 8, 0}, {2553, 4, 0}, {2558, 5, 0}, {2564, 12, 0}, {2577, 6, 0}, {2584, 26, 0}, {2611, 8, 0}, {2620, 13, 0},
+        {2634, 7, 0}, {2642, 10, 0}, {2653, 6, 0}, {2660, 6, 0}, {2667, 12, 0}, {2680, 6, 0}, {2687, 5, 0}, {2693, 8, 0},
+        {2702, 10, 0}, {2713, 7, 0}, {2721, 10, 0}, {2732, 26, 0}, {2759, 7, 0}, {2767, 11, 0}, {2779, 7, 0}, {2787, 8, 0},
+        {2796, 6, 0}, {2803, 5, 0}, {2809, 7, 0}, {2817, 8, 0}, {2826, 10, 0}, {2837, 7, 0}, {2845, 9, 0}, {2855, 8, 0},
+        {2864, 8, 0}, {2873, 7, 0}, {2881, 10, 0}, {2892, 7, 0}, {2900, 9, 0}, {2910, 8, 0}, {2919, 14, 0}, {2934, 4, 0},
+        {2939, 6, 0}, {2946, 5, 0}, {2952, 5, 0}, {2958, 6, 0}, {2965, 8, 0}, {2974, 4, 0}, {2979, 5, 0}, {2985, 6, 0},
+        {2992, 10, 0}, {3003, 18, 0}, {3022, 8, 0}, {3031, 7, 0}, {3039, 14, 0}, {3054, 6, 0}, {3061, 10, 0}, {3072, 7, 0},
+        {3080, 15, 0}, {3096, 7, 0}, {3104, 7, 0}, {3112, 10, 0}, {3123, 6, 0}, {3130, 8, 0}, {3139, 12, 0}, {3152, 7, 0},
+        {3160, 8, 0}, {3169, 10, 0}, {3180, 16, 0}, {3197, 8, 0}, {3206, 11, 0}, {3218, 16, 0}, {3235, 8, 0}, {3244, 7, 0},
+        {3252, 23, 0}, {3276, 9, 0}, {3286, 7, 0}, {3294, 10, 0}, {3305, 6, 0}, {3312, 7, 0}, {3320, 8, 0}, {3329, 6, 0},
+        {3336, 9, 0}, {3346, 9, 0}, {3356, 15, 0}, {3372, 14, 0}, {3387, 8, 0}, {3396, 10, 0}, {3407, 9, 0}, {3417, 12, 0},
+        {3430, 21, 0}, {3452, 10, 0}, {3463, 18, 0}, {3482, 11, 0}, {3494, 5, 0}, {3500, 9, 0}, {3510, 8, 0}, {3519, 7, 0},
+        {3527, 7, 0}, {3535, 7, 0}, {3543, 6, 0}, {3550, 7, 0}, {3558, 7, 0}, {3566, 17, 0}, {3584, 5, 0}, {3590, 5, 0},
+        {3596, 11, 0}, {3608, 3, 0}, {3612, 6, 0}, {3619, 10, 0}, {3630, 16, 0}, {3647, 18, 0}, {3666, 12, 0}, {3679, 9, 0},
+        {3689, 9, 0}, {3699, 9, 0}, {3709, 6, 0}, {3716, 6, 0}, {3723, 7, 0}, {3731, 18, 0}, {3750, 14, 0}, {3765, 9, 0},
+        {3775, 14, 0}, {3790, 11, 0}, {3802, 13, 0}, {3816, 11, 0}, {3828, 22, 0}, {3851, 38, 0}, {3890, 31, 0}, {3922, 18, 0},
+        {3941, 22, 0}, {3964, 8, 0}, {3973, 8, 0}, {3982, 21, 0}, {4004, 10, 0}, {4015, 18, 0}, {4034, 7, 0}, {4042, 7, 0},
+        {4050, 14, 0}, {4065, 15, 0}, {4081, 19, 0}, {4101, 8, 0}, {4110, 14, 0}, {4125, 10, 0}, {4136, 6, 0}, {4143, 6, 0},
+        {4150, 4, 0}, {4155, 7, 0}, {4163, 7, 0}, {4171, 9, 0}, {4181, 10, 0}, {4192, 6, 0}, {4199, 9, 0}, {4209, 17, 0},
+        {4227, 9, 0}, {4237, 6, 0}, {4244, 18, 0}, {4263, 5, 0}, {4269, 12, 0}, {4282, 11, 0}, {4294, 4, 0}, {4299, 8, 0},
+        {4308, 20, 0}, {4329, 12, 0}, {4342, 8, 0}, {4351, 11, 0}, {4363, 10, 0}, {4374, 13, 0}, {4388, 7, 0}, {4396, 13, 0},
+        {4410, 6, 0}, {4417, 8, 0}, {4426, 20, 0}, {4447, 15, 0}, {4463, 5, 0}, {4469, 7, 0}, {4477, 8, 0}, {4486, 9, 0},
+        {4496, 8, 0}, {4505, 4, 0}, {4510, 12, 0}, {4523, 11, 0}, {4535, 9, 0}, {4545, 7, 0}, {4553, 8, 0}, {4562, 16, 0},
+        {4579, 8, 0}, {4588, 4, 0}, {4593, 8, 0}, {4602, 8, 0}, {4611, 9, 0}, {4621, 7, 0}, {4629, 8, 0}, {4638, 8, 0},
+        {4647, 14, 0}, {4662, 10, 0}, {4673, 13, 0}, {4687, 8, 0}, {4696, 6, 0}, {4703, 5, 0}, {4709, 4, 0}, {4714, 9, 0},
+        {4724, 8, 0}, {4733, 7, 0}, {4741, 6, 0}, {4748, 8, 0}, {4757, 6, 0}, {4764, 7, 0}, {4772, 15, 0}, {4788, 7, 0},
+        {4796, 10, 0}, {4807, 5, 0}, {4813, 6, 0}, {4820, 20, 0}, {4841, 7, 0}, {4849, 7, 0}, {4857, 7, 0}, {4865, 12, 0},
+        {4878, 8, 0}, {4887, 11, 0}, {4899, 17, 0}, {4917, 16, 0}, {4934, 21, 0}, {4956, 5, 0}, {4962, 25, 0}, {4988, 7, 0},
+        {4996, 4, 0}, {5001, 9, 0}, {5011, 7, 0}, {5019, 3, 0}, {5023, 23, 0}, {5047, 9, 0}, {5057, 7, 0}, {5065, 6, 0},
+        {5072, 18, 0}, {5091, 21, 0}, {5113, 9, 0}, {5123, 24, -1}, {5148, 39, -1}, {5188, 18, 0}, {5207, 41, 0}, {5249, 24, 0},
+        {5274, 26, 0}, {5301, 18, -1}, {5320, 17, 0}, {5338, 15, -1}, {5354, 15, 0}, {5370, 18, 0}, {5389, 18, 0}, {5408, 16, 0},
+        {5425, 16, 0}, {5442, 16, 0}, {5459, 17, 0}, {5477, 19, 0}, {5497, 16, 0}, {5514, 20, -1}, {5535, 16, 0}, {5552, 18, 0},
+        {5571, 24, 0}, {5596, 17, 0}, {5614, 18, 0}, {5633, 15, 0}, {5649, 18, 0}, {5668, 18, 0}, {5687, 18, 0}, {5706, 24, 0},
+        {5731, 14, 0}, {5746, 20, 0}, {5767, 16, 0}, {5784, 19, 0}, {5804, 17, 0}, {5822, 19, 0}, {5842, 23, 0}, {5866, 31, 0},
+        {5898, 21, 0}, {5920, 22, -1}, {5943, 23, 0}, {5967, 24, 0}, {5992, 15, 0}, {6008, 15, 0}, {6024, 21, 0}, {6046, 20, -1},
+        {6067, 21, -1}, {6089, 13, 0}, {6103, 24, 0}, {6128, 10, 0}, {6139, 24, 0}, {6164, 16, 0}, {6181, 17, 0}, {6199, 17, 0},
+        {6217, 14, 0}, {6232, 20, 0}, {6253, 17, 0}, {6271, 17, 0}, {6289, 22, 0}, {6312, 24, 0}, {6337, 23, 0}, {6361, 19, -1},
+        {6381, 22, 0}, {6404, 15, 0}, {6420, 15, -1}, {6436, 24, 0}, {6461, 18, 0}, {6480, 25, -1}, {6506, 19, -1}, {6526, 20, 0},
+        {6547, 21, 0}, {6569, 17, 0}, {6587, 10, 0}, {6598, 19, 0}, {6618, 19, 0}, {6638, 13, 0}, {6652, 20, 0}, {6673, 19, 0},
+        {6693, 16, -1}, {6710, 20, 0}, {6731, 23, 0}, {6755, 6, 0}, {6762, 6, 0}, {6769, 8, 0}, {6778, 7, 0}, {6786, 6, 0},
+        {6793, 6, 0}, {6800, 14, 0}, {6815, 9, 0}, {6825, 8, 0}, {6834, 7, 0}, {6842, 6, 0}, {6849, 5, 0}, {6855, 8, 0},
+        {6864, 8, 0}, {6873, 6, 0}, {6880, 7, 0}, {6888, 5, 0}, {6894, 7, 0}, {6902, 9, 0}, {6912, 5, 0}, {6918, 5, 0},
+        {6924, 5, 0}, {6930, 7, 0}, {6938, 20, 0}, {6959, 12, 0}, {6972, 5, 0}, {6978, 34, 0}, {7013, 7, 0}, {7021, 6, 0},
+        {7028, 6, 0}, {7035, 5, 0}, {7041, 5, 0}, {7047, 7, 0}, {7055, 39, 0}, {7095, 5, 0}, {7101, 42, 0}, {7144, 18, 0},
+        {7163, 11, 0}, {7175, 13, 0}, {7189, 5, 0}, {7195, 5, 0},
+};
+
+static char TERRITORY_NAMES_UNPACKED_FR[7201];
+
+static const PackedTerritoryNames PACKED_TERRITORY_NAMES_FR = {
+        TERRITORY_NAMES_UNPACKED_FR, 7201, TERRITORY_NAMES_PACKED_FR, 3602, TERRITORY_NAMES_PAIRS_FR,
+        TERRITORY_NAME_ALTERNATIVES_START_FR, TERRITORY_NAME_ALTERNATIVES_FR};
+
+#else
+
+static const PackedTerritoryNames PACKED_TERRITORY_NAMES_FR = {NULL, 0, NULL, 0, NULL, NULL, NULL};
+
+#endif // MAPCODE_SUPPORT_LANGUAGE_FR
+
+#ifdef MAPCODE_SUPPORT_LANGUAGE_HE // Hebrew
+
+// 10692 bytes, packed to 3293
+static const unsigned char TERRITORY_NAMES_PACKED_HE[3293] = {
+        6, 1, 127, 26, 215, 159, 124, 6, 215, 155, 63, 24, 49, 37, 4, 169, 107, 38, 167, 31, 146, 122, 192, 48,
+        7, 211, 76, 11, 240, 118, 167, 76, 95, 124, 49, 77, 111, 53, 235, 113, 141, 14, 170, 11, 71, 36, 160, 8,
+        18, 31, 152, 25, 91, 31, 221, 8, 31, 15, 120, 158, 14, 29, 27, 113, 10, 158, 195, 5, 159, 53, 187, 160,
+        18, 54, 40, 49, 32, 217, 77, 79, 53, 224, 50, 124, 54, 77, 79, 53, 224, 50, 118, 164, 5, 223, 14, 159,
+        118, 145, 25, 194, 14, 158, 61, 12, 152, 130, 18, 16, 141, 130, 62, 141, 8, 76, 33, 160, 95, 32, 226, 128,
+        139, 226, 128, 139, 6, 6, 61, 36, 15, 120, 158, 7, 46, 31, 146, 14, 9, 150, 135, 89, 83, 77, 123, 38,
+        29, 161, 117, 152, 210, 14, 150, 135, 55, 151, 41, 24, 71, 40, 37, 0, 28, 11, 108, 32, 217, 60, 51, 239,
+        217, 60, 51, 70, 234, 174, 93, 40, 109, 35, 130, 202, 124, 8, 234, 174, 93, 40, 6, 44, 141, 86, 199, 34,
+        156, 5, 155, 48, 19, 169, 48, 33, 131, 7, 25, 70, 84, 158, 14, 207, 3, 15, 158, 28, 109, 198, 219, 8,
+        62, 124, 92, 158, 28, 6, 44, 32, 198, 219, 8, 2, 118, 167, 76, 3, 113, 193, 33, 168, 32, 90, 26, 11,
+        4, 159, 124, 90, 26, 11, 137, 132, 28, 12, 113, 10, 167, 5, 29, 161, 32, 51, 83, 108, 118, 167, 33, 13,
+        27, 145, 51, 33, 168, 44, 10, 113, 32, 28, 93, 10, 15, 145, 8, 124, 92, 145, 8, 85, 8, 202, 24, 71,
+        11, 37, 122, 202, 3, 113, 24, 11, 39, 6, 44, 32, 17, 80, 169, 215, 159, 32, 60, 86, 125, 120, 147, 230,
+        51, 239, 48, 86, 125, 120, 147, 230, 51, 123, 11, 48, 220, 244, 70, 234, 174, 93, 40, 69, 207, 53, 14, 166,
+        127, 174, 7, 62, 107, 2, 60, 3, 15, 145, 91, 35, 142, 201, 42, 215, 120, 158, 8, 33, 159, 124, 42, 215,
+        120, 158, 8, 33, 27, 113, 201, 43, 113, 32, 216, 41, 244, 46, 138, 124, 216, 41, 244, 46, 138, 3, 169, 81,
+        162, 93, 2, 53, 224, 50, 32, 28, 84, 221, 37, 38, 156, 37, 136, 99, 37, 95, 20, 248, 189, 28, 218, 25,
+        99, 61, 239, 25, 99, 61, 98, 18, 63, 8, 31, 161, 33, 207, 212, 11, 240, 118, 158, 7, 229, 109, 215, 133,
+        51, 202, 20, 50, 18, 220, 28, 215, 157, 85, 8, 55, 158, 172, 113, 10, 156, 95, 225, 26, 7, 38, 150, 34,
+        161, 111, 54, 18, 211, 100, 12, 147, 90, 46, 26, 194, 215, 151, 7, 33, 27, 167, 64, 122, 48, 2, 118, 152,
+        247, 63, 32, 76, 8, 26, 95, 124, 76, 8, 26, 95, 53, 235, 161, 8, 73, 152, 90, 218, 217, 7, 43, 161,
+        79, 12, 148, 100, 10, 167, 100, 107, 195, 46, 26, 118, 164, 7, 31, 146, 177, 37, 11, 217, 94, 90, 18, 249,
+        8, 18, 5, 166, 2, 95, 20, 5, 151, 61, 3, 156, 76, 92, 13, 145, 173, 3, 15, 158, 28, 12, 59, 173,
+        96, 88, 37, 251, 62, 32, 28, 84, 80, 147, 83, 5, 165, 32, 96, 6, 37, 251, 202, 124, 28, 84, 80, 147,
+        83, 5, 165, 96, 24, 37, 251, 202, 212, 40, 43, 150, 88, 215, 166, 57, 93, 62, 94, 33, 164, 32, 18, 37,
+        12, 152, 7, 46, 5, 147, 37, 32, 60, 25, 41, 1, 124, 60, 25, 41, 31, 145, 7, 51, 235, 221, 196, 215,
+        162, 55, 205, 10, 166, 57, 93, 138, 141, 245, 152, 8, 196, 48, 26, 243, 28, 195, 1, 32, 219, 31, 167, 102,
+        54, 7, 67, 108, 67, 187, 156, 35, 39, 137, 59, 71, 2, 26, 220, 81, 145, 227, 48, 140, 118, 164, 76, 242,
+        0, 51, 28, 48, 249, 38, 152, 89, 7, 1, 118, 145, 6, 198, 12, 13, 150, 14, 151, 10, 152, 191, 18, 178,
+        1, 21, 77, 119, 155, 83, 62, 118, 164, 5, 59, 2, 124, 54, 5, 59, 36, 167, 11, 37, 51, 88, 215, 151,
+        37, 82, 12, 161, 11, 25, 39, 197, 5, 169, 7, 91, 85, 82, 215, 29, 151, 24, 54, 11, 92, 152, 46, 135,
+        11, 10, 161, 241, 37, 18, 136, 11, 190, 210, 122, 60, 36, 158, 253, 49, 37, 112, 103, 168, 28, 50, 70, 238,
+        36, 145, 18, 250, 36, 146, 46, 42, 109, 81, 169, 1, 51, 62, 20, 241, 39, 171, 55, 207, 215, 157, 20, 102,
+        7, 134, 71, 214, 182, 39, 204, 12, 156, 63, 60, 31, 145, 11, 41, 225, 40, 37, 25, 220, 46, 8, 69, 145,
+        108, 8, 31, 152, 234, 177, 103, 145, 6, 4, 29, 27, 169, 83, 33, 165, 85, 40, 119, 147, 19, 158, 196, 20,
+        92, 152, 51, 34, 148, 66, 109, 37, 90, 46, 26, 39, 62, 178, 11, 25, 49, 227, 213, 218, 219, 194, 4, 15,
+        160, 16, 32, 216, 14, 166, 41, 25, 46, 98, 7, 28, 48, 34, 168, 54, 58, 93, 10, 152, 186, 31, 156, 215,
+        29, 145, 34, 156, 238, 8, 178, 7, 55, 156, 19, 167, 220, 8, 173, 171, 64, 11, 119, 161, 33, 168, 69, 156,
+        8, 51, 243, 19, 158, 12, 148, 66, 109, 208, 215, 155, 62, 126, 229, 109, 215, 166, 57, 93, 62, 20, 5, 151,
+        61, 24, 198, 64, 1, 2, 127, 24, 215, 206, 2, 127, 20, 112, 63, 134, 48, 134, 7, 214, 181, 121, 70, 209,
+        99, 33, 59, 103, 161, 99, 197, 2, 102, 142, 214, 181, 103, 164, 233, 112, 195, 253, 41, 68, 11, 85, 100, 7,
+        34, 205, 10, 167, 18, 42, 70, 67, 108, 11, 102, 119, 146, 28, 215, 29, 158, 11, 98, 25, 194, 40, 41, 7,
+        34, 156, 122, 7, 34, 148, 250, 18, 63, 136, 39, 5, 131, 7, 62, 7, 42, 123, 11, 8, 83, 36, 232, 120,
+        167, 18, 42, 12, 160, 26, 14, 146, 28, 6, 0, 121, 1, 68, 103, 29, 59, 26, 237, 27, 145, 89, 11, 37,
+        82, 3, 9, 164, 91, 3, 170, 51, 108, 34, 161, 18, 46, 17, 157, 20, 18, 186, 177, 36, 167, 81, 145, 61,
+        34, 161, 253, 7, 121, 12, 80, 146, 11, 94, 64, 41, 190, 92, 29, 27, 145, 11, 8, 65, 161, 126, 229, 12,
+        156, 8, 95, 236, 179, 160, 36, 146, 17, 160, 70, 186, 50, 194, 86, 199, 16, 124, 104, 60, 242, 124, 6, 81,
+        158, 11, 215, 155, 109, 71, 8, 4, 151, 37, 93, 124, 215, 232, 159, 53, 64, 242, 124, 8, 64, 242, 44, 10,
+        133, 137, 146, 46, 8, 70, 49, 1, 61, 18, 85, 63, 6, 7, 109, 81, 206, 62, 124, 63, 6, 7, 69, 152,
+        4, 162, 19, 170, 10, 156, 35, 215, 162, 11, 127, 126, 35, 137, 132, 73, 150, 77, 119, 145, 247, 46, 69, 164,
+        17, 161, 200, 77, 79, 46, 135, 67, 238, 102, 11, 204, 12, 162, 90, 172, 164, 233, 112, 11, 67, 187, 151, 4,
+        163, 10, 169, 39, 6, 35, 3, 160, 18, 1, 186, 225, 11, 209, 197, 1, 33, 199, 17, 157, 212, 43, 156, 50,
+        94, 100, 1, 45, 35, 14, 150, 83, 77, 126, 214, 182, 14, 158, 68, 39, 204, 6, 0, 79, 103, 150, 5, 13,
+        145, 35, 28, 243, 14, 146, 177, 36, 162, 67, 64, 102, 222, 107, 68, 7, 112, 49, 112, 20, 21, 35, 49, 237,
+        27, 169, 1, 61, 34, 164, 54, 28, 69, 146, 46, 8, 109, 215, 151, 37, 82, 98, 71, 65, 27, 152, 247, 81,
+        160, 237, 27, 161, 134, 54, 68, 7, 102, 37, 3, 170, 8, 77, 119, 170, 214, 181, 191, 68, 103, 166, 68, 7,
+        134, 54, 102, 93, 20, 234, 53, 40, 50, 94, 39, 2, 34, 145, 4, 29, 161, 28, 39, 12, 13, 147, 41, 104,
+        7, 20, 76, 7, 8, 46, 12, 205, 10, 161, 61, 103, 148, 66, 109, 71, 14, 155, 209, 32, 45, 32, 17, 164,
+        219, 8, 62, 178, 90, 11, 171, 54, 41, 39, 237, 27, 158, 42, 19, 158, 7, 124, 35, 18, 71, 12, 150, 81,
+        145, 34, 52, 77, 12, 152, 247, 34, 164, 49, 237, 27, 158, 21, 81, 145, 26, 3, 9, 158, 122, 197, 38, 166,
+        28, 11, 12, 160, 189, 7, 34, 152, 19, 150, 39, 225, 67, 215, 166, 134, 7, 102, 2, 67, 215, 157, 107, 8,
+        18, 5, 199, 34, 145, 40, 122, 171, 214, 182, 93, 67, 2, 112, 54, 233, 204, 98, 40, 179, 145, 34, 205, 32,
+        17, 164, 219, 123, 91, 135, 89, 40, 12, 160, 190, 96, 7, 3, 52, 246, 212, 7, 249, 100, 40, 171, 67, 64,
+        68, 103, 156, 25, 178, 61, 215, 131, 67, 43, 147, 112, 39, 214, 181, 209, 204, 87, 164, 37, 192, 36, 152, 11,
+        222, 104, 91, 123, 18, 11, 95, 20, 41, 28, 104, 11, 33, 9, 29, 161, 94, 40, 191, 98, 195, 140, 31, 148,
+        5, 147, 91, 41, 31, 13, 147, 43, 170, 10, 221, 63, 26, 31, 152, 68, 35, 233, 102, 104, 112, 3, 160, 8,
+        42, 130, 126, 28, 19, 151, 28, 48, 200, 28, 35, 11, 6, 0, 2, 76, 215, 29, 27, 167, 83, 43, 199, 218,
+        7, 31, 161, 46, 91, 28, 98, 81, 164, 208, 194, 71, 5, 52, 28, 49, 172, 15, 120, 156, 28, 108, 193, 60,
+        95, 36, 146, 7, 14, 170, 36, 160, 28, 35, 73, 156, 8, 137, 145, 17, 151, 230, 11, 254, 39, 197, 18, 222,
+        7, 21, 3, 52, 42, 54, 63, 136, 17, 151, 230, 11, 254, 39, 88, 37, 251, 62, 3, 150, 222, 17, 223, 17,
+        161, 3, 151, 11, 5, 47, 31, 29, 158, 8, 40, 79, 63, 20, 28, 215, 151, 222, 12, 147, 18, 89, 31, 167,
+        28, 6, 83, 77, 12, 161, 51, 18, 12, 52, 2, 177, 1, 216, 126, 7, 43, 156, 119, 206, 24, 92, 162, 61,
+        62, 94, 100, 1, 45, 49, 43, 169, 17, 161, 70, 11, 228, 64, 227, 209, 215, 151, 92, 29, 131, 14, 146, 248,
+        46, 12, 147, 71, 17, 159, 32, 61, 2, 31, 147, 37, 7, 218, 100, 7, 174, 11, 36, 52, 17, 129, 189, 140,
+        20, 50, 81, 159, 32, 51, 26, 25, 7, 3, 156, 49, 82, 246, 83, 79, 3, 147, 11, 6, 36, 158, 17, 146,
+        91, 34, 160, 17, 146, 91, 119, 13, 160, 254, 211, 7, 254, 123, 190, 18, 17, 157, 178, 26, 138, 212, 38, 59,
+        17, 145, 85, 140, 229, 70, 7, 38, 52, 91, 193, 117, 147, 82, 20, 63, 17, 157, 136, 16, 140, 20, 60, 117,
+        167, 6, 17, 129, 126, 28, 98, 7, 91, 12, 152, 198, 77, 10, 160, 246, 31, 148, 191, 17, 52, 91, 193, 117,
+        147, 82, 210, 198, 1, 32, 76, 82, 71, 64, 3, 52, 6, 17, 152, 5, 15, 146, 140, 210, 6, 196, 17, 129,
+        94, 14, 9, 223, 12, 168, 228, 92, 152, 17, 131, 61, 63, 239, 8, 18, 108, 220, 4, 59, 8, 117, 152, 3,
+        13, 206, 141, 89, 11, 107, 246, 6, 16, 193, 117, 147, 82, 211, 11, 89, 17, 160, 70, 50, 7, 69, 164, 117,
+        147, 82, 107, 6, 14, 169, 48, 7, 70, 60, 7, 193, 117, 147, 82, 212, 250, 5, 52, 7, 36, 132, 73, 161,
+        8, 127, 96, 201, 224, 63, 211, 130, 18, 33, 170, 174, 64, 109, 8, 213, 192, 62, 211, 130, 18, 33, 170, 10,
+        13, 164, 14, 165, 10, 59, 99, 108, 85, 48, 130, 18, 88, 215, 133, 51, 62, 3, 205, 53, 213, 192, 34, 29,
+        15, 13, 160, 197, 1, 26, 48, 18, 34, 13, 206, 53, 213, 192, 227, 83, 43, 161, 242, 72, 164, 37, 192, 36,
+        161, 14, 146, 79, 70, 11, 17, 146, 8, 95, 236, 2, 73, 147, 69, 150, 96, 39, 7, 1, 20, 92, 164, 64,
+        238, 73, 113, 31, 168, 2, 73, 146, 244, 69, 147, 73, 160, 18, 48, 243, 7, 33, 145, 12, 113, 230, 48, 7,
+        46, 243, 14, 9, 13, 145, 76, 1, 20, 71, 17, 164, 12, 161, 42, 7, 12, 162, 215, 155, 200, 8, 117, 160,
+        12, 168, 18, 8, 191, 12, 168, 250, 51, 34, 161, 8, 73, 164, 8, 40, 200, 42, 240, 36, 152, 76, 248, 43,
+        161, 236, 2, 73, 146, 244, 69, 147, 73, 161, 40, 107, 14, 160, 8, 31, 146, 1, 42, 82, 107, 17, 152, 73,
+        146, 65, 161, 73, 147, 73, 161, 40, 136, 8, 6, 225, 46, 17, 161, 10, 146, 7, 8, 108, 107, 17, 152, 73,
+        146, 65, 161, 200, 140, 70, 81, 150, 38, 161, 231, 40, 179, 145, 34, 168, 61, 53, 224, 119, 147, 11, 240, 18,
+        94, 38, 152, 26, 48, 3, 132, 73, 59, 14, 150, 36, 132, 1, 24, 81, 164, 82, 33, 168, 0, 18, 71, 38,
+        152, 3, 13, 15, 52, 4, 125, 161, 85, 177, 36, 158, 7, 77, 119, 13, 206, 201, 64, 228, 46, 34, 205, 10,
+        167, 7, 40, 33, 160, 123, 33, 131, 43, 147, 229, 98, 248, 222, 36, 152, 19, 161, 2, 0, 1, 64, 228, 46,
+        171, 216, 2, 200, 19, 161, 77, 35, 39, 225, 108, 108, 79, 36, 156, 28, 190, 229, 70, 241, 71, 70, 196, 19,
+        161, 31, 232, 120, 167, 7, 40, 33, 160, 12, 132, 1, 32, 2, 247, 20, 2, 1, 216, 20, 77, 46, 1, 36,
+        146, 8, 173, 197, 1, 5, 47, 38, 161, 187, 164, 11, 18, 5, 147, 123, 190, 18, 135, 76, 11, 6, 90, 12,
+        232, 120, 147, 49, 60, 6, 0, 1, 4, 169, 111, 48, 137, 205, 10, 147, 49, 60, 12, 9, 145, 14, 47, 98,
+        19, 150, 63, 20, 33, 147, 6, 1, 0, 2, 60, 123, 43, 161, 60, 123, 5, 169, 189, 215, 159, 0, 1, 2,
+        90, 111, 20, 173, 137, 167, 40, 18, 37, 31, 9, 145, 37, 70, 86, 150, 51, 12, 132, 73, 221, 63, 26, 249,
+        38, 199, 98, 11, 254, 39, 34, 223, 92, 161, 20, 11, 104, 98, 40, 179, 145, 88, 35, 130, 62, 20, 241, 195,
+        70, 38, 152, 7, 2, 31, 167, 83, 122, 49, 136, 92, 47, 208, 28, 103, 13, 160, 238, 25, 12, 132, 217, 8,
+        250, 11, 119, 132, 1, 32, 45, 141, 7, 38, 161, 83, 26, 3, 160, 25, 69, 47, 60, 171, 2, 24, 19, 161,
+        5, 154, 32, 246, 28, 142, 0, 2, 76, 137, 148, 48, 130, 18, 2, 127, 24, 215, 232, 120, 13, 206, 2, 127,
+        3, 160, 51, 240, 60, 85, 112, 37, 253, 20, 112, 92, 152, 134, 7, 102, 11, 204, 194, 233, 134, 7, 68, 209,
+        67, 77, 20, 102, 14, 166, 112, 93, 24, 102, 35, 233, 134, 7, 67, 62, 3, 221, 63, 26, 249, 4, 47, 35,
+        12, 113, 193, 48, 14, 15, 145, 173, 231, 11, 46, 111, 142, 20, 111, 4, 169, 48, 175, 70, 37, 189, 175, 12,
+        232, 159, 53, 213, 16, 45, 91, 39, 175, 98, 35, 142, 46, 1, 45, 35, 11, 49, 7, 227, 8, 117, 52, 8,
+        2, 45, 208, 196, 63, 34, 148, 208, 208, 39, 138, 32, 252, 151, 35, 4, 169, 32, 252, 23, 53, 2, 177, 39,
+        25, 31, 30, 156, 79, 215, 166, 49, 106, 53, 18, 2, 40, 72, 152, 40, 87, 145, 11, 41, 18, 61, 255, 40,
+        37, 191, 64, 231, 18, 104, 231, 11, 186, 87, 29, 13, 145, 25, 72, 145, 7, 42, 19, 47, 255, 64, 95, 241,
+        11, 255, 7, 42, 209, 172, 23, 32, 17, 143, 14, 151, 103, 30, 158, 4, 47, 35, 87, 15, 158, 40, 19, 47,
+        3, 147, 17, 146, 92, 29, 159, 24, 252, 23, 201, 18, 38, 150, 32, 96, 72, 160, 25, 41, 18, 61, 72, 164,
+        104, 25, 231, 213, 251, 87, 125, 145, 65, 164, 40, 94, 14, 15, 160, 61, 7, 32, 75, 114, 97, 105, 94, 11,
+        71, 26, 175, 87, 29, 145, 7, 72, 156, 39, 111, 142, 255, 65, 143, 25, 106, 201, 40, 41, 186, 142, 106, 201,
+        40, 186, 37, 87, 158, 18, 81, 9, 47, 94, 192, 175, 12, 148, 215, 23, 24, 8, 60, 51, 90, 55, 207, 24,
+        39, 33, 9, 165, 236, 54, 58, 230, 90, 62, 106, 53, 14, 155, 89, 11, 104, 107, 18, 37, 25, 175, 87, 160,
+        190, 96, 39, 55, 160, 25, 41, 18, 61, 72, 164, 19, 150, 87, 167, 64, 25, 107, 140, 2, 53, 11, 24, 252,
+        23, 53, 18, 19, 145, 173, 106, 53, 40, 33, 144, 39, 25, 104, 72, 164, 14, 157, 85, 66, 69, 207, 141, 82,
+        49, 64, 171, 61, 71, 18, 48, 24, 252, 29, 152, 14, 125, 159, 24, 66, 87, 15, 158, 7, 87, 161, 117, 152,
+        25, 0, 191, 11, 1, 45, 78, 101, 110, 101, 116, 115, 3, 151, 245, 152, 2, 45, 81, 9, 161, 36, 30, 15,
+        145, 142, 11, 25, 104, 72, 152, 2, 179, 27, 30, 167, 173, 103, 30, 52, 11, 42, 35, 43, 47, 136, 18, 42,
+        48, 175, 87, 162, 35, 7, 174, 8, 26, 11, 106, 53, 64, 49, 4, 29, 47, 72, 160, 25, 95, 122, 64, 104,
+        72, 152, 179, 47, 106, 53, 179, 47, 3, 151, 49, 63, 175, 87, 167, 71, 7, 25, 1, 20, 11, 48, 8, 36,
+        23, 53, 11, 48, 8, 36, 148, 66, 69, 207, 10, 152, 25, 87, 167, 14, 15, 160, 1, 42, 14, 47, 72, 13,
+        146, 37, 103, 52, 76, 4, 223, 6, 53, 76, 65, 146, 231, 81, 52, 215, 223, 87, 15, 151, 11, 187, 30, 164,
+        86, 158, 18, 34, 23, 32, 16, 61, 2, 53, 60, 51, 90, 36, 30, 151, 35, 7, 25, 104, 255, 198, 18, 236,
+        54, 58, 93, 10, 161, 17, 151, 6, 45, 26, 60, 16, 124, 66, 218, 42, 49, 60, 227, 50, 12, 168, 253, 63,
+        204, 12, 169, 19, 151, 8, 36, 152, 42, 19, 59, 187, 145, 33, 59, 111, 85, 8, 46, 172, 160, 111, 82, 88,
+        28, 36, 52, 100, 208, 111, 210, 239, 228, 228, 42, 89, 210, 42, 89, 63, 200, 4, 59, 42, 215, 131, 39, 6,
+        1, 36, 156, 42, 51, 111, 3, 169, 17, 129, 100, 3, 169, 245, 169, 36, 59, 42, 89, 85, 39, 172, 146, 83,
+        189, 126, 28, 89, 37, 100, 85, 25, 235, 59, 77, 187, 148, 35, 235, 169, 8, 245, 169, 135, 46, 7, 10, 158,
+        100, 40, 34, 148, 224, 100, 85, 51, 172, 146, 28, 89, 82, 55, 59, 28, 89, 3, 15, 52, 28, 215, 159, 0,
+        2, 51, 172, 152, 122, 48, 126, 245, 161, 31, 52, 111, 6, 8, 135, 1, 189, 18, 138, 10, 169, 43, 59, 42,
+        89, 178, 5, 131, 14, 166, 127, 174, 7, 62, 24, 8, 202, 24, 71, 65, 151, 49, 138, 24, 49, 215, 199, 138,
+        94, 11, 79, 195, 4, 131, 248, 8, 196, 48, 26, 12, 148, 35, 43, 156, 8, 90, 2, 124, 215, 155, 37, 18,
+        24, 8, 14, 165, 0,
+};
+
+static const unsigned char TERRITORY_NAMES_PAIRS_HE[256][2] = {
+        {0, 0}, {215, 149}, {215, 153}, {0, 215}, {1, 215}, {2, 215}, {215, 148}, {215, 168}, {215, 144}, {160, 215}, {32, 215}, {215, 156},
+        {6, 3}, {158, 215}, {7, 215}, {161, 215}, {5, 148}, {8, 215}, {4, 168}, {215, 9}, {3, 144}, {4, 150}, {13, 151}, {22, 21},
+        {32, 6}, {4, 145}, {5, 167}, {159, 3}, {4, 144}, {152, 215}, {23, 10}, {1, 3}, {32, 32}, {2, 5}, {16, 3}, {215, 145},
+        {2, 3}, {215, 147}, {4, 9}, {215, 160}, {4, 156}, {215, 146}, {5, 144}, {5, 9}, {44, 44}, {45, 45}, {5, 160}, {15, 167},
+        {215, 152}, {215, 167}, {19, 147}, {4, 160}, {166, 96}, {32, 8}, {215, 164}, {2, 10}, {11, 26}, {14, 164}, {25, 56}, {146, 96},
+        {4, 152}, {4, 147}, {5, 170}, {215, 161}, {5, 168}, {7, 4}, {57, 58}, {214, 180}, {214, 184}, {6, 10}, {12, 144}, {215, 158},
+        {3, 30}, {1, 10}, {1, 214}, {75, 75}, {4, 167}, {5, 156}, {78, 78}, {5, 164}, {15, 9}, {215, 13}, {215, 169}, {1, 1},
+        {2, 55}, {3, 148}, {7, 5}, {12, 30}, {16, 24}, {19, 146}, {4, 158}, {8, 11}, {215, 15}, {215, 170}, {3, 167}, {4, 161},
+        {96, 96}, {97, 97}, {12, 167}, {14, 145}, {38, 146}, {101, 101}, {214, 183}, {215, 27}, {215, 47}, {105, 105}, {3, 23}, {3, 158},
+        {5, 161}, {6, 24}, {110, 110}, {43, 146}, {74, 185}, {80, 152}, {114, 114}, {115, 115}, {116, 116}, {7, 17}, {20, 84}, {50, 3},
+        {159, 10}, {2, 68}, {5, 145}, {12, 158}, {124, 124}, {15, 29}, {3, 146}, {4, 170}, {128, 128}, {9, 147}, {86, 152}, {159, 20},
+        {160, 2}, {166, 54}, {214, 176}, {2, 20}, {3, 145}, {4, 27}, {5, 157}, {139, 139}, {8, 7}, {10, 145}, {14, 147}, {15, 152},
+        {144, 144}, {145, 145}, {146, 146}, {147, 147}, {148, 148}, {149, 149}, {150, 150}, {151, 151}, {152, 152}, {153, 153}, {154, 154}, {155, 155},
+        {156, 156}, {157, 157}, {158, 158}, {159, 159}, {160, 160}, {161, 161}, {162, 162}, {163, 163}, {164, 164}, {165, 165}, {166, 166}, {167, 167},
+        {168, 168}, {169, 169}, {170, 170}, {16, 20}, {17, 27}, {18, 41}, {24, 35}, {88, 66}, {176, 176}, {1, 28}, {3, 161}, {4, 13},
+        {180, 180}, {181, 181}, {182, 182}, {183, 183}, {184, 184}, {185, 185}, {4, 146}, {5, 27}, {188, 188}, {5, 146}, {5, 150}, {5, 158},
+        {7, 11}, {10, 164}, {12, 145}, {14, 152}, {14, 167}, {16, 0}, {17, 158}, {29, 160}, {31, 164}, {32, 1}, {33, 157}, {65, 157},
+        {67, 121}, {147, 203}, {162, 99}, {169, 11}, {215, 52}, {215, 150}, {3, 59}, {3, 152}, {3, 164}, {4, 143}, {214, 214}, {215, 215},
+        {4, 148}, {4, 164}, {6, 32}, {7, 26}, {12, 146}, {13, 167}, {17, 167}, {29, 167}, {33, 156}, {34, 158}, {226, 226}, {34, 167},
+        {41, 96}, {42, 39}, {69, 167}, {72, 167}, {133, 4}, {214, 188}, {2, 2}, {2, 36}, {3, 168}, {5, 125}, {5, 152}, {6, 124},
+        {8, 1}, {11, 35}, {11, 50}, {12, 164}, {14, 129}, {17, 9}, {17, 147}, {18, 49}, {19, 152}, {31, 158}, {38, 147}, {65, 158},
+        {66, 12}, {74, 188}, {79, 18}, {106, 32},
+};
+
+static const unsigned short TERRITORY_NAME_ALTERNATIVES_START_HE[_TERRITORY_MAX - _TERRITORY_MIN] = {
+        0, 2, 3, 4, 5, 7, 8, 9, 10, 11, 12, 13, 15, 16, 17, 18,
+        19, 20, 21, 22, 23, 24, 25, 27, 29, 30, 31, 32, 34, 35, 37, 38,
+        39, 40, 42, 43, 45, 46, 47, 48, 49, 51, 53, 54, 55, 57, 58, 59,
+        60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 73, 74, 75, 76,
+        77, 78, 79, 80, 81, 82, 83, 85, 86, 87, 89, 90, 91, 92, 93, 94,
+        95, 96, 97, 98, 99, 100, 101, 102, 103, 104, 106, 107, 108, 109, 110, 111,
+        112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127,
+        128, 129, 130, 131, 132, 133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143,
+        144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159,
+        160, 161, 162, 163, 164, 165, 166, 167, 168, 169, 170, 171, 172, 173, 174, 175,
+        176, 177, 178, 179, 180, 181, 182, 187, 188, 189, 191, 192, 193, 194, 195, 196,
+        197, 198, 199, 200, 201, 202, 203, 204, 205, 206, 207, 208, 209, 210, 211, 212,
+        213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223, 224, 225, 226, 227, 228,
+        230, 231, 232, 233, 234, 235, 236, 237, 238, 239, 240, 241, 242, 243, 244, 245,
+        246, 247, 248, 249, 250, 251, 252, 253, 254, 255, 256, 257, 258, 259, 260, 261,
+        262, 263, 264, 265, 266, 267, 268, 269, 270, 271, 272, 273, 274, 275, 276, 277,
+        278, 279, 280, 281, 282, 283, 284, 285, 286, 287, 288, 289, 290, 291, 292, 293,
+        294, 295, 296, 297, 298, 299, 300, 301, 302, 303, 304, 305, 306, 307, 308, 309,
+        310, 311, 312, 313, 314, 315, 316, 317, 318, 319, 320, 322, 323, 324, 325, 326,
+        327, 328, 329, 330, 331, 332, 333, 334, 335, 336, 337, 338, 339, 340, 341, 342,
+        343, 344, 345, 346, 347, 348, 349, 350, 351, 352, 353, 354, 355, 356, 357, 358,
+        359, 360, 361, 362, 363, 364, 365, 366, 367, 368, 369, 370, 371, 372, 373, 374,
+        375, 376, 377, 378, 379, 380, 381, 382, 383, 384, 385, 386, 387, 388, 389, 390,
+        391, 392, 393, 394, 395, 396, 397, 398, 399, 400, 401, 402, 403, 404, 405, 406,
+        407, 408, 409, 410, 411, 412, 413, 414, 415, 416, 417, 418, 419, 420, 421, 422,
+        423, 424, 425, 426, 427, 428, 429, 430, 431, 432, 433, 434, 435, 436, 437, 438,
+        439, 440, 441, 442, 443, 444, 445, 446, 447, 448, 449, 450, 451, 452, 453, 454,
+        455, 456, 457, 458, 459, 460, 461, 462, 463, 464, 465, 466, 467, 468, 469, 470,
+        471, 472, 473, 474, 475, 476, 477, 478, 479, 480, 481, 482, 483, 484, 485, 486,
+        487, 488, 489, 490, 491, 492, 493, 494, 495, 496, 497, 498, 499, 500, 501, 502,
+        503, 504, 505, 506, 507, 508, 509, 510, 511, 512, 513, 514, 515, 516, 517, 519,
+        520, 521, 522, 523, 524, 525, 526, 527, 529, 530, 531, 532, 533, 534, 535, 536,
+        537, 538, 539, 540, 541, 542, 543, 544, 545, 546, 547, 548, 549, 550, 551, 552,
+        553, 554, 555, 556, 557, 559,
+};
+
+static const TerritoryNameAlternative TERRITORY_NAME_ALTERNATIVES_HE[559] = {
+        {0, 14, 3}, {15, 17, 3}, {33, 10, 3}, {44, 14, 3}, {59, 12, 3}, {72, 17, 3}, {90, 19, 3}, {110, 19, 3},
+        {130, 10, 3}, {141, 12, 3}, {154, 8, 3}, {163, 13, 3}, {177, 24, 3}, {202, 40, 3}, {243, 23, 3}, {267, 19, 3},
+        {287, 15, 3}, {303, 12, 3}, {316, 65, 3}, {382, 15, 3}, {398, 10, 3}, {409, 16, 3}, {426, 16, 3}, {443, 9, 3},
+        {453, 20, 3}, {474, 25, 3}, {500, 14, 3}, {515, 36, 3}, {552, 35, 3}, {588, 20, 3}, {609, 10, 3}, {620, 15, 3},
+        {636, 29, 3}, {666, 26, 3}, {693, 13, 3}, {707, 30, 3}, {738, 14, 3}, {753, 10, 3}, {764, 28, 3}, {793, 17, 3},
+        {811, 34, 3}, {846, 6, 3}, {853, 29, 3}, {883, 56, 3}, {940, 26, 3}, {967, 8, 3}, {976, 10, 3}, {987, 46, 3},
+        {1034, 8, 3}, {1043, 34, 3}, {1078, 17, 3}, {1096, 40, 3}, {1137, 20, 3}, {1158, 47, 3}, {1206, 12, 3}, {1219, 31, 3},
+        {1251, 14, 3}, {1266, 12, 3}, {1279, 10, 3}, {1290, 8, 3}, {1299, 36, 3}, {1336, 12, 3}, {1349, 8, 3}, {1358, 13, 3},
+        {1372, 17, 3}, {1390, 18, 3}, {1409, 14, 3}, {1424, 10, 3}, {1435, 16, 3}, {1452, 12, 3}, {1465, 14, 3}, {1480, 32, 3},
+        {1513, 21, 3}, {1535, 34, 3}, {1570, 17, 3}, {1588, 14, 3}, {1603, 13, 3}, {1617, 16, 3}, {1634, 12, 3}, {1647, 18, 3},
+        {1666, 10, 3}, {1677, 18, 3}, {1696, 10, 3}, {1707, 71, 3}, {1779, 41, 3}, {1821, 31, 3}, {1853, 17, 3}, {1871, 27, 3},
+        {1899, 12, 3}, {1912, 12, 3}, {1925, 57, 3}, {1983, 21, 3}, {2005, 20, 3}, {2026, 10, 3}, {2037, 13, 3}, {2051, 10, 3},
+        {2062, 8, 3}, {2071, 19, 3}, {2091, 12, 3}, {2104, 16, 3}, {2121, 17, 3}, {2139, 19, 3}, {2159, 16, 3}, {2176, 10, 3},
+        {2187, 16, 3}, {2204, 9, 3}, {2214, 25, 3}, {2240, 14, 3}, {2255, 10, 3}, {2266, 25, 3}, {2292, 17, 3}, {2310, 8, 3},
+        {2319, 13, 3}, {2333, 16, 3}, {2350, 12, 3}, {2363, 8, 3}, {2372, 14, 3}, {2387, 29, 3}, {2417, 12, 3}, {2430, 11, 3},
+        {2442, 22, 3}, {2465, 10, 3}, {2476, 10, 3}, {2487, 14, 3}, {2502, 21, 3}, {2524, 14, 3}, {2539, 10, 3}, {2550, 12, 3},
+        {2563, 10, 3}, {2574, 10, 3}, {2585, 14, 3}, {2600, 41, 3}, {2642, 14, 3}, {2657, 19, 3}, {2677, 33, 3}, {2711, 14, 3},
+        {2726, 25, 3}, {2752, 10, 3}, {2763, 8, 3}, {2772, 15, 3}, {2788, 14, 3}, {2803, 12, 3}, {2816, 21, 3}, {2838, 8, 3},
+        {2847, 30, 3}, {2878, 25, 3}, {2904, 44, 3}, {2949, 24, 3}, {2974, 17, 3}, {2992, 10, 3}, {3003, 12, 3}, {3016, 22, 3},
+        {3039, 14, 3}, {3054, 21, 3}, {3076, 16, 3}, {3093, 14, 3}, {3108, 8, 3}, {3117, 14, 3}, {3132, 12, 3}, {3145, 14, 3},
+        {3160, 8, 3}, {3169, 16, 3}, {3186, 12, 3}, {3199, 21, 3}, {3221, 16, 3}, {3238, 10, 3}, {3249, 17, 3}, {3267, 12, 3},
+        {3280, 8, 3}, {3289, 14, 3}, {3304, 14, 3}, {3319, 18, 3}, {3338, 14, 3}, {3353, 14, 3}, {3368, 8, 3}, {3377, 18, 3},
+        {3396, 12, 3}, {3409, 10, 3}, {3420, 8, 3}, {3429, 10, 3}, {3440, 8, 3}, {3449, 12, 3}, {3462, 14, 3}, {3477, 14, 3},
+        {3492, 27, 3}, {3520, 21, 3}, {3542, 22, 3}, {3565, 10, 3}, {3576, 14, 3}, {3591, 25, 3}, {3617, 32, 3}, {3650, 8, 3},
+        {3659, 17, 3}, {3677, 23, 3}, {3701, 16, 3}, {3718, 20, 3}, {3739, 10, 3}, {3750, 16, 3}, {3767, 15, 3}, {3783, 16, 3},
+        {3800, 10, 3}, {3811, 14, 3}, {3826, 12, 3}, {3839, 25, 3}, {3865, 20, 3}, {3886, 6, 3}, {3893, 16, 3}, {3910, 14, 3},
+        {3925, 14, 3}, {3940, 16, 3}, {3957, 18, 3}, {3976, 12, 3}, {3989, 32, 3}, {4022, 10, 3}, {4033, 20, 3}, {4054, 14, 3},
+        {4069, 12, 3}, {4082, 12, 3}, {4095, 14, 3}, {4110, 17, 3}, {4128, 10, 3}, {4139, 16, 3}, {4156, 12, 3}, {4169, 16, 3},
+        {4186, 17, 3}, {4204, 48, 3}, {4253, 12, 3}, {4266, 16, 3}, {4283, 12, 3}, {4296, 10, 3}, {4307, 10, 3}, {4318, 9, 3},
+        {4328, 12, 3}, {4341, 12, 3}, {4354, 14, 3}, {4369, 12, 3}, {4382, 14, 3}, {4397, 12, 3}, {4410, 12, 3}, {4423, 18, 3},
+        {4442, 18, 3}, {4461, 14, 3}, {4476, 26, 3}, {4503, 16, 3}, {4520, 21, 3}, {4542, 8, 3}, {4551, 12, 3}, {4564, 9, 3},
+        {4574, 7, 3}, {4582, 6, 3}, {4589, 16, 3}, {4606, 12, 3}, {4619, 6, 3}, {4626, 8, 3}, {4635, 28, 3}, {4664, 19, 3},
+        {4684, 18, 3}, {4703, 12, 3}, {4716, 24, 3}, {4741, 12, 3}, {4754, 12, 3}, {4767, 14, 3}, {4782, 23, 3}, {4806, 18, 3},
+        {4825, 14, 3}, {4840, 18, 3}, {4859, 12, 3}, {4872, 10, 3}, {4883, 21, 3}, {4905, 16, 3}, {4922, 11, 3}, {4934, 19, 3},
+        {4954, 28, 3}, {4983, 10, 3}, {4994, 19, 3}, {5014, 27, 3}, {5042, 14, 3}, {5057, 11, 3}, {5069, 42, 3}, {5112, 16, 3},
+        {5129, 12, 3}, {5142, 16, 3}, {5159, 14, 3}, {5174, 12, 3}, {5187, 18, 3}, {5206, 12, 3}, {5219, 17, 3}, {5237, 14, 3},
+        {5252, 21, 3}, {5274, 25, 3}, {5300, 15, 3}, {5316, 12, 3}, {5329, 16, 3}, {5346, 17, 3}, {5364, 26, 3}, {5391, 17, 3},
+        {5409, 25, 3}, {5435, 18, 3}, {5454, 8, 3}, {5463, 14, 3}, {5478, 14, 3}, {5493, 12, 3}, {5506, 14, 3}, {5521, 14, 3},
+        {5536, 10, 3}, {5547, 13, 3}, {5561, 14, 3}, {5576, 26, 3}, {5603, 8, 3}, {5612, 10, 3}, {5623, 20, 3}, {5644, 8, 3},
+        {5653, 10, 3}, {5664, 19, 3}, {5684, 26, 3}, {5711, 22, 3}, {5734, 19, 3}, {5754, 15, 3}, {5770, 12, 3}, {5783, 13, 3},
+        {5797, 10, 3}, {5808, 12, 3}, {5821, 15, 3}, {5837, 17, 3}, {5855, 23, 3}, {5879, 14, 3}, {5894, 21, 3}, {5916, 14, 3},
+        {5931, 19, 3}, {5951, 17, 3}, {5969, 27, 3}, {5997, 48, 3}, {6046, 39, 3}, {6086, 33, 3}, {6120, 25, 3}, {6146, 12, 3},
+        {6159, 16, 3}, {6176, 25, 3}, {6202, 18, 3}, {6221, 19, 3}, {6241, 12, 3}, {6254, 14, 3}, {6269, 21, 3}, {6291, 25, 3},
+        {6317, 33, 3}, {6351, 12, 3}, {6364, 21, 3}, {6386, 16, 3}, {6403, 10, 3}, {6414, 10, 3}, {6425, 6, 3}, {6432, 12, 3},
+        {6445, 14, 3}, {6460, 16, 3}, {6477, 17, 3}, {6495, 12, 3}, {6508, 16, 3}, {6525, 29, 3}, {6555, 10, 3}, {6566, 10, 3},
+        {6577, 31, 3}, {6609, 10, 3}, {6620, 21, 3}, {6642, 19, 3}, {6662, 8, 3}, {6671, 12, 3}, {6684, 25, 3}, {6710, 19, 3},
+        {6730, 12, 3}, {6743, 14, 3}, {6758, 16, 3}, {6775, 21, 3}, {6797, 12, 3}, {6810, 15, 3}, {6826, 10, 3}, {6837, 12, 3},
+        {6850, 26, 3}, {6877, 25, 3}, {6903, 8, 3}, {6912, 16, 3}, {6929, 12, 3}, {6942, 8, 3}, {6951, 17, 3}, {6969, 10, 3},
+        {6980, 18, 3}, {6999, 16, 3}, {7016, 18, 3}, {7035, 10, 3}, {7046, 12, 3}, {7059, 25, 3}, {7085, 15, 3}, {7101, 10, 3},
+        {7112, 14, 3}, {7127, 14, 3}, {7142, 18, 3}, {7161, 14, 3}, {7176, 12, 3}, {7189, 16, 3}, {7206, 19, 3}, {7226, 18, 3},
+        {7245, 19, 3}, {7265, 12, 3}, {7278, 8, 3}, {7287, 12, 3}, {7300, 8, 3}, {7309, 14, 3}, {7324, 12, 3}, {7337, 14, 3},
+        {7352, 12, 3}, {7365, 14, 3}, {7380, 8, 3}, {7389, 14, 3}, {7404, 19, 3}, {7424, 12, 3}, {7437, 18, 3}, {7456, 8, 3},
+        {7465, 10, 3}, {7476, 31, 3}, {7508, 12, 3}, {7521, 14, 3}, {7536, 12, 3}, {7549, 17, 3}, {7567, 14, 3}, {7582, 22, 3},
+        {7605, 27, 3}, {7633, 21, 3}, {7655, 28, 3}, {7684, 10, 3}, {7695, 46, 3}, {7742, 14, 3}, {7757, 12, 3}, {7770, 26, 3},
+        {7797, 18, 3}, {7816, 33, 3}, {7850, 12, 3}, {7863, 12, 3}, {7876, 23, 3}, {7900, 27, 3}, {7928, 37, 3}, {7966, 31, 3},
+        {7998, 51, 3}, {8050, 27, 3}, {8078, 29, 3}, {8108, 31, 3}, {8140, 25, 3}, {8166, 27, 3}, {8194, 19, 3}, {8214, 21, 3},
+        {8236, 17, 3}, {8254, 23, 3}, {8278, 23, 3}, {8302, 19, 3}, {8322, 19, 3}, {8342, 19, 3}, {8362, 23, 3}, {8386, 23, 3},
+        {8410, 21, 3}, {8432, 21, 3}, {8454, 21, 3}, {8476, 23, 3}, {8500, 31, 3}, {8532, 23, 3}, {8556, 25, 3}, {8582, 19, 3},
+        {8602, 25, 3}, {8628, 25, 3}, {8654, 19, 3}, {8674, 33, 3}, {8708, 15, 3}, {8724, 23, 3}, {8748, 21, 3}, {8770, 25, 3},
+        {8796, 23, 3}, {8820, 23, 3}, {8844, 29, 3}, {8874, 47, 3}, {8922, 27, 3}, {8950, 25, 3}, {8976, 35, 3}, {9012, 37, 3},
+        {9050, 17, 3}, {9068, 19, 3}, {9088, 32, 3}, {9121, 25, 3}, {9147, 31, 3}, {9179, 15, 3}, {9195, 38, 3}, {9234, 33, 3},
+        {9268, 31, 3}, {9300, 17, 3}, {9318, 21, 3}, {9340, 15, 3}, {9356, 19, 3}, {9376, 27, 3}, {9404, 19, 3}, {9424, 19, 3},
+        {9444, 28, 3}, {9473, 35, 3}, {9509, 28, 3}, {9538, 25, 3}, {9564, 31, 3}, {9596, 19, 3}, {9616, 19, 3}, {9636, 29, 3},
+        {9666, 21, 3}, {9688, 10, 3}, {9699, 19, 3}, {9719, 32, 3}, {9752, 29, 3}, {9782, 17, 3}, {9800, 28, 3}, {9829, 22, 3},
+        {9852, 19, 3}, {9872, 25, 3}, {9898, 36, 3}, {9935, 23, 3}, {9959, 17, 3}, {9977, 38, 3}, {10016, 31, 3}, {10048, 8, 3},
+        {10057, 16, 3}, {10074, 10, 3}, {10085, 15, 3}, {10101, 15, 3}, {10117, 12, 3}, {10130, 23, 3}, {10154, 18, 3}, {10173, 5, 3},
+        {10179, 14, 3}, {10194, 15, 3}, {10210, 13, 3}, {10224, 10, 3}, {10235, 16, 3}, {10252, 14, 3}, {10267, 10, 3}, {10278, 11, 3},
+        {10290, 8, 3}, {10299, 10, 3}, {10310, 18, 3}, {10329, 10, 3}, {10340, 11, 3}, {10352, 8, 3}, {10361, 12, 3}, {10374, 25, 3},
+        {10400, 14, 3}, {10415, 10, 3}, {10426, 26, 3}, {10453, 11, 3}, {10465, 10, 3}, {10476, 8, 3}, {10485, 10, 3}, {10496, 15, 3},
+        {10512, 34, 3}, {10547, 6, 3}, {10554, 62, 3}, {10617, 16, 3}, {10634, 20, 3}, {10655, 18, 3}, {10674, 17, 3},
+};
+
+static char TERRITORY_NAMES_UNPACKED_HE[10692];
+
+static const PackedTerritoryNames PACKED_TERRITORY_NAMES_HE = {
+        TERRITORY_NAMES_UNPACKED_HE, 10692, TERRITORY_NAMES_PACKED_HE, 3293, TERRITORY_NAMES_PAIRS_HE,
+        TERRITORY_NAME_ALTERNATIVES_START_HE, TERRITORY_NAME_ALTERNATIVES_HE};
+
+#else
+
+static const PackedTerritoryNames PACKED_TERRITORY_NAMES_HE = {NULL, 0, NULL, 0, NULL, NULL, NULL};
+
+#endif // MAPCODE_SUPPORT_LANGUAGE_HE
+
+#ifdef MAPCODE_SUPPORT_LANGUAGE_HI // Hindi
+
+// 17916 bytes, packed to 3666
+static const unsigned char TERRITORY_NAMES_PACKED_HI[3666] = {
+        146, 15, 159, 62, 37, 77, 107, 17, 102, 170, 146, 9, 164, 21, 76, 15, 150, 15, 130, 50, 96, 234, 73, 156,
+        9, 200, 72, 111, 205, 159, 16, 149, 15, 27, 138, 42, 16, 149, 237, 94, 124, 49, 26, 178, 90, 151, 94, 77,
+        245, 225, 10, 172, 53, 5, 165, 41, 15, 174, 63, 168, 233, 11, 95, 194, 30, 181, 72, 22, 50, 49, 7, 147,
+        61, 90, 159, 169, 53, 111, 66, 225, 169, 53, 111, 57, 113, 78, 1, 171, 16, 149, 94, 118, 171, 114, 196, 94,
+        124, 37, 78, 1, 171, 16, 149, 94, 102, 171, 114, 196, 94, 103, 107, 49, 51, 239, 94, 77, 245, 158, 30, 181,
+        206, 123, 158, 11, 221, 161, 18, 200, 107, 254, 10, 185, 90, 166, 169, 228, 253, 250, 11, 26, 175, 58, 112, 206,
+        21, 61, 220, 169, 25, 11, 57, 73, 151, 52, 51, 239, 81, 51, 6, 143, 125, 30, 92, 117, 82, 37, 111, 55,
+        51, 47, 159, 201, 28, 184, 17, 42, 21, 203, 33, 81, 94, 6, 181, 72, 203, 118, 132, 207, 154, 46, 168, 3,
+        102, 132, 207, 154, 46, 168, 18, 200, 107, 254, 10, 181, 180, 57, 210, 249, 62, 211, 87, 84, 126, 153, 11, 46,
+        172, 117, 53, 5, 182, 41, 94, 153, 33, 109, 62, 17, 77, 33, 16, 134, 124, 81, 33, 16, 134, 44, 215, 33,
+        109, 62, 17, 42, 241, 210, 225, 204, 20, 11, 51, 118, 174, 62, 83, 82, 37, 124, 33, 62, 83, 82, 37, 113,
+        26, 175, 95, 225, 58, 107, 55, 118, 168, 15, 181, 203, 124, 37, 15, 181, 203, 42, 15, 174, 220, 10, 159, 252,
+        95, 61, 24, 117, 72, 142, 26, 181, 225, 10, 185, 83, 66, 3, 44, 10, 137, 142, 187, 33, 118, 164, 21, 9,
+        84, 31, 76, 3, 58, 30, 168, 5, 185, 3, 102, 134, 11, 16, 185, 1, 163, 50, 72, 111, 18, 120, 66, 216,
+        18, 181, 180, 57, 210, 102, 181, 180, 57, 94, 77, 245, 44, 77, 23, 175, 241, 100, 10, 176, 7, 64, 215, 33,
+        11, 26, 149, 117, 25, 1, 175, 211, 6, 218, 72, 24, 53, 193, 118, 156, 220, 169, 75, 66, 102, 156, 220, 169,
+        75, 66, 225, 10, 181, 90, 184, 186, 118, 120, 66, 216, 202, 14, 184, 102, 120, 66, 15, 156, 20, 37, 55, 195,
+        28, 161, 123, 118, 174, 25, 49, 247, 96, 72, 193, 210, 124, 33, 25, 49, 247, 96, 72, 193, 210, 158, 53, 24,
+        213, 16, 121, 143, 23, 159, 26, 151, 198, 118, 172, 53, 24, 30, 161, 3, 124, 24, 53, 24, 30, 161, 217, 22,
+        47, 149, 7, 147, 61, 177, 83, 55, 103, 1, 27, 138, 6, 227, 11, 17, 169, 53, 20, 31, 3, 94, 153, 48,
+        78, 18, 151, 198, 33, 6, 110, 10, 145, 1, 171, 169, 220, 225, 10, 178, 46, 184, 29, 174, 202, 149, 21, 96,
+        177, 240, 90, 151, 252, 22, 205, 159, 236, 151, 18, 161, 179, 57, 62, 18, 172, 228, 11, 126, 42, 9, 176, 9,
+        172, 7, 164, 63, 164, 219, 149, 55, 10, 144, 48, 58, 25, 49, 16, 106, 210, 124, 49, 16, 13, 149, 237, 210,
+        61, 7, 147, 10, 159, 179, 118, 170, 21, 90, 184, 196, 51, 195, 209, 49, 209, 50, 53, 111, 126, 62, 6, 132,
+        25, 11, 104, 119, 55, 232, 52, 213, 83, 16, 170, 42, 179, 78, 237, 50, 82, 11, 26, 182, 81, 6, 176, 26,
+        175, 46, 168, 20, 37, 249, 49, 55, 33, 24, 28, 151, 61, 33, 16, 134, 6, 246, 10, 156, 82, 180, 105, 101,
+        11, 77, 233, 1, 165, 77, 60, 146, 9, 154, 210, 124, 81, 233, 1, 165, 77, 60, 146, 9, 154, 210, 6, 171,
+        21, 87, 154, 204, 80, 57, 177, 29, 149, 15, 170, 10, 181, 28, 166, 51, 194, 21, 57, 9, 166, 251, 10, 143,
+        48, 10, 159, 16, 172, 15, 151, 12, 102, 159, 16, 172, 25, 187, 73, 200, 30, 168, 15, 136, 6, 171, 21, 87,
+        154, 77, 142, 239, 10, 143, 48, 215, 23, 159, 53, 230, 211, 62, 10, 178, 60, 55, 103, 28, 159, 104, 176, 26,
+        149, 12, 61, 202, 170, 21, 81, 249, 15, 172, 37, 93, 156, 33, 25, 49, 18, 151, 122, 231, 29, 149, 86, 205,
+        132, 82, 49, 199, 94, 77, 245, 6, 181, 31, 30, 133, 86, 22, 50, 236, 159, 66, 15, 120, 73, 172, 228, 122,
+        18, 170, 95, 28, 181, 17, 10, 164, 160, 78, 6, 218, 7, 106, 26, 178, 60, 42, 30, 181, 25, 86, 6, 171,
+        9, 156, 17, 94, 77, 245, 102, 132, 9, 156, 63, 168, 242, 58, 25, 41, 216, 96, 29, 19, 178, 88, 66, 29,
+        13, 184, 47, 92, 6, 132, 114, 235, 126, 10, 176, 7, 183, 111, 21, 153, 41, 77, 72, 52, 213, 78, 158, 83,
+        26, 156, 201, 9, 172, 46, 164, 17, 50, 25, 81, 9, 161, 96, 29, 176, 46, 71, 163, 193, 18, 185, 25, 86,
+        63, 172, 30, 19, 176, 5, 168, 5, 166, 63, 13, 149, 52, 15, 159, 78, 20, 41, 10, 151, 57, 63, 133, 41,
+        231, 31, 240, 80, 179, 37, 94, 6, 134, 28, 174, 126, 29, 178, 15, 184, 16, 165, 73, 172, 83, 5, 156, 20,
+        33, 50, 80, 5, 166, 88, 18, 151, 57, 17, 32, 45, 10, 172, 203, 7, 138, 194, 202, 181, 93, 173, 46, 159,
+        93, 218, 107, 1, 106, 11, 199, 113, 26, 166, 11, 199, 6, 161, 66, 33, 53, 230, 6, 143, 1, 84, 96, 29,
+        161, 179, 57, 62, 37, 99, 19, 178, 88, 234, 29, 149, 16, 84, 229, 176, 62, 18, 172, 16, 19, 168, 105, 118,
+        185, 180, 15, 151, 88, 57, 217, 21, 16, 143, 189, 29, 159, 16, 151, 73, 27, 164, 146, 29, 178, 9, 165, 198,
+        37, 29, 182, 21, 26, 178, 23, 149, 18, 156, 82, 180, 29, 71, 175, 11, 199, 61, 9, 143, 11, 229, 178, 20,
+        96, 103, 37, 122, 18, 154, 197, 99, 171, 21, 87, 154, 65, 175, 31, 18, 184, 23, 175, 241, 100, 215, 11, 24,
+        215, 33, 17, 47, 164, 6, 145, 248, 29, 71, 106, 11, 24, 202, 156, 31, 61, 28, 172, 29, 156, 82, 28, 161,
+        37, 103, 219, 164, 187, 72, 195, 125, 11, 63, 246, 58, 78, 29, 71, 13, 184, 199, 232, 52, 7, 159, 15, 174,
+        72, 217, 207, 172, 18, 172, 30, 178, 5, 151, 53, 29, 27, 13, 172, 109, 29, 185, 7, 163, 193, 95, 11, 81,
+        158, 66, 57, 6, 135, 11, 107, 21, 29, 174, 1, 27, 181, 63, 227, 11, 58, 78, 29, 168, 62, 53, 250, 198,
+        6, 120, 26, 121, 164, 7, 156, 62, 235, 93, 172, 209, 35, 166, 177, 113, 15, 170, 72, 6, 159, 207, 168, 26,
+        182, 240, 95, 11, 126, 122, 6, 137, 11, 30, 151, 52, 51, 42, 23, 172, 16, 161, 240, 17, 11, 240, 66, 15,
+        151, 41, 42, 9, 176, 187, 9, 156, 1, 34, 93, 172, 83, 78, 46, 121, 151, 30, 175, 31, 18, 27, 147, 81,
+        6, 176, 179, 31, 29, 152, 31, 18, 175, 30, 151, 74, 161, 18, 175, 46, 168, 202, 159, 216, 58, 90, 54, 161,
+        33, 232, 57, 63, 13, 149, 52, 213, 78, 103, 189, 5, 154, 160, 17, 77, 228, 53, 18, 151, 25, 24, 82, 37,
+        113, 207, 156, 26, 178, 60, 158, 219, 149, 57, 229, 171, 253, 73, 171, 114, 85, 17, 23, 121, 13, 159, 41, 63,
+        147, 33, 93, 170, 80, 60, 6, 71, 13, 181, 11, 17, 58, 16, 84, 113, 82, 28, 181, 51, 50, 41, 177, 29,
+        181, 20, 86, 37, 122, 6, 171, 57, 199, 42, 209, 104, 200, 7, 106, 7, 181, 114, 201, 28, 174, 37, 63, 156,
+        252, 93, 156, 160, 231, 7, 172, 52, 51, 103, 25, 47, 151, 52, 51, 6, 135, 47, 149, 50, 78, 49, 230, 73,
+        137, 1, 156, 24, 197, 235, 93, 218, 26, 161, 37, 103, 252, 198, 10, 168, 242, 10, 151, 57, 17, 42, 25, 33,
+        11, 46, 168, 194, 219, 149, 33, 66, 235, 93, 19, 170, 66, 6, 165, 212, 199, 6, 175, 33, 37, 6, 132, 21,
+        74, 121, 143, 199, 94, 77, 245, 42, 66, 36, 18, 172, 16, 164, 55, 146, 31, 117, 216, 250, 7, 56, 205, 175,
+        46, 149, 21, 66, 6, 246, 77, 46, 161, 31, 42, 87, 166, 21, 26, 175, 215, 1, 171, 21, 26, 149, 37, 70,
+        61, 179, 72, 29, 133, 1, 132, 1, 54, 188, 31, 235, 31, 50, 36, 74, 174, 53, 124, 24, 28, 174, 18, 156,
+        122, 231, 29, 154, 114, 63, 159, 28, 149, 63, 170, 234, 235, 31, 50, 16, 156, 122, 231, 62, 113, 122, 17, 24,
+        29, 181, 66, 15, 156, 30, 143, 41, 238, 202, 156, 17, 11, 29, 164, 23, 156, 31, 29, 174, 9, 19, 176, 50,
+        82, 11, 107, 31, 29, 172, 80, 26, 181, 29, 13, 165, 20, 16, 170, 29, 149, 80, 33, 231, 29, 246, 215, 1,
+        171, 21, 26, 149, 117, 72, 63, 133, 125, 80, 238, 202, 156, 205, 154, 213, 103, 109, 95, 50, 125, 80, 29, 136,
+        11, 93, 178, 17, 24, 240, 46, 161, 93, 13, 14, 161, 96, 177, 29, 161, 9, 226, 107, 104, 132, 216, 11, 41,
+        194, 35, 149, 55, 49, 72, 117, 78, 83, 16, 121, 71, 151, 52, 81, 49, 72, 9, 143, 23, 159, 81, 42, 80,
+        26, 174, 217, 242, 11, 15, 159, 53, 73, 185, 9, 161, 41, 187, 12, 50, 197, 55, 62, 104, 176, 7, 64, 6,
+        159, 24, 25, 1, 56, 73, 168, 75, 53, 26, 159, 232, 198, 37, 250, 52, 7, 159, 73, 170, 207, 172, 5, 178,
+        18, 175, 241, 7, 159, 37, 42, 52, 90, 159, 31, 229, 176, 95, 61, 57, 72, 16, 134, 42, 25, 23, 170, 197,
+        50, 9, 154, 16, 134, 49, 66, 61, 220, 10, 178, 30, 13, 184, 204, 255, 237, 63, 151, 36, 22, 11, 109, 73,
+        168, 30, 143, 146, 104, 178, 20, 96, 158, 7, 156, 3, 58, 25, 41, 9, 171, 12, 239, 29, 181, 51, 47, 149,
+        21, 46, 156, 6, 154, 20, 252, 7, 121, 172, 7, 156, 3, 58, 25, 41, 9, 171, 12, 239, 105, 77, 22, 205,
+        106, 234, 7, 159, 197, 81, 201, 41, 9, 56, 73, 164, 122, 233, 41, 196, 7, 121, 147, 49, 55, 234, 18, 166,
+        22, 11, 125, 12, 42, 88, 7, 181, 114, 18, 184, 96, 78, 18, 154, 9, 185, 30, 71, 185, 198, 6, 120, 126,
+        199, 61, 1, 138, 142, 17, 215, 11, 24, 42, 209, 12, 58, 90, 182, 253, 18, 143, 41, 1, 156, 17, 11, 29,
+        149, 1, 156, 7, 150, 1, 34, 93, 133, 180, 186, 126, 18, 166, 33, 37, 101, 11, 76, 26, 181, 6, 166, 251,
+        11, 3, 118, 168, 187, 91, 185, 146, 83, 63, 154, 48, 26, 54, 162, 59, 153, 1, 163, 193, 33, 31, 118, 168,
+        62, 16, 172, 53, 249, 222, 142, 89, 6, 166, 114, 5, 178, 17, 50, 15, 152, 72, 1, 175, 113, 250, 72, 60,
+        50, 1, 163, 196, 22, 11, 194, 21, 196, 22, 11, 117, 9, 156, 78, 33, 61, 62, 230, 160, 103, 23, 156, 7,
+        172, 195, 11, 20, 7, 163, 18, 133, 11, 30, 163, 7, 154, 41, 204, 21, 142, 177, 153, 81, 33, 158, 9, 185,
+        53, 6, 227, 47, 150, 48, 232, 88, 217, 109, 41, 194, 33, 114, 37, 213, 22, 195, 160, 7, 154, 41, 204, 21,
+        142, 177, 201, 33, 5, 174, 95, 101, 11, 58, 189, 5, 174, 17, 205, 155, 127, 26, 184, 1, 54, 162, 59, 6,
+        157, 53, 1, 150, 48, 42, 239, 7, 159, 49, 6, 176, 7, 156, 1, 19, 165, 93, 147, 247, 254, 3, 102, 137,
+        247, 59, 26, 184, 18, 151, 30, 156, 47, 164, 103, 189, 5, 154, 160, 10, 172, 125, 72, 50, 1, 167, 36, 204,
+        21, 142, 177, 194, 83, 125, 31, 18, 134, 23, 167, 21, 204, 21, 142, 177, 50, 228, 53, 7, 183, 111, 21, 6,
+        227, 91, 170, 21, 142, 177, 103, 30, 161, 30, 154, 109, 63, 168, 242, 77, 233, 1, 165, 10, 181, 83, 55, 6,
+        145, 248, 83, 20, 212, 10, 176, 7, 156, 1, 167, 31, 17, 58, 112, 206, 21, 201, 28, 181, 203, 10, 172, 51,
+        10, 159, 109, 107, 11, 63, 227, 11, 17, 58, 112, 206, 21, 6, 246, 10, 145, 248, 83, 29, 164, 1, 19, 174,
+        31, 29, 181, 62, 111, 78, 29, 170, 189, 5, 154, 160, 17, 10, 145, 248, 83, 29, 149, 52, 17, 23, 184, 199,
+        6, 161, 9, 226, 107, 104, 171, 216, 11, 41, 61, 180, 196, 153, 41, 187, 16, 71, 121, 176, 20, 104, 161, 17,
+        10, 156, 37, 109, 20, 73, 143, 1, 19, 170, 9, 176, 107, 12, 77, 25, 23, 159, 73, 176, 20, 104, 120, 74,
+        161, 51, 10, 161, 104, 168, 82, 28, 159, 103, 53, 212, 24, 18, 184, 74, 164, 3, 58, 25, 211, 11, 126, 18,
+        170, 11, 37, 33, 24, 241, 73, 133, 33, 252, 18, 184, 15, 133, 11, 18, 133, 49, 21, 51, 103, 53, 31, 18,
+        176, 78, 25, 33, 18, 176, 96, 193, 96, 240, 7, 147, 204, 233, 41, 73, 170, 20, 7, 138, 6, 159, 16, 149,
+        214, 111, 57, 55, 6, 176, 20, 104, 120, 74, 161, 51, 10, 161, 12, 77, 30, 178, 50, 53, 66, 5, 185, 73,
+        151, 16, 13, 175, 253, 223, 159, 104, 120, 237, 104, 161, 12, 77, 30, 178, 158, 7, 185, 29, 174, 57, 229, 151,
+        109, 20, 253, 223, 159, 104, 120, 237, 73, 170, 25, 11, 18, 143, 33, 15, 106, 96, 81, 201, 114, 3, 58, 80,
+        23, 172, 105, 58, 51, 6, 176, 16, 161, 123, 6, 161, 15, 27, 181, 15, 175, 11, 42, 37, 197, 111, 62, 211,
+        113, 242, 10, 156, 28, 184, 63, 168, 242, 10, 185, 25, 33, 5, 170, 189, 75, 205, 181, 11, 33, 236, 159, 50,
+        25, 81, 7, 154, 30, 184, 15, 159, 55, 195, 146, 212, 50, 25, 11, 26, 178, 60, 103, 189, 5, 154, 160, 10,
+        181, 180, 126, 29, 246, 58, 25, 11, 80, 57, 117, 66, 6, 13, 14, 161, 20, 31, 217, 186, 49, 63, 159, 66,
+        15, 184, 63, 181, 180, 126, 29, 147, 228, 20, 73, 170, 87, 184, 114, 52, 66, 29, 174, 203, 203, 196, 63, 178,
+        30, 13, 184, 20, 31, 18, 133, 41, 24, 122, 18, 133, 28, 149, 74, 184, 81, 6, 227, 11, 17, 58, 109, 80,
+        57, 238, 207, 175, 82, 28, 149, 6, 71, 175, 88, 18, 92, 57, 16, 13, 121, 156, 82, 180, 29, 181, 9, 56,
+        82, 37, 55, 57, 6, 171, 5, 178, 78, 9, 161, 117, 203, 2, 140, 11, 63, 147, 49, 1, 27, 185, 179, 238,
+        82, 28, 165, 10, 161, 49, 255, 18, 181, 82, 189, 90, 54, 159, 37, 6, 246, 10, 161, 49, 255, 238, 15, 200,
+        7, 56, 217, 31, 55, 7, 121, 13, 161, 7, 185, 73, 175, 46, 159, 117, 57, 15, 184, 255, 117, 254, 9, 151,
+        37, 6, 181, 36, 179, 90, 151, 6, 147, 11, 15, 151, 37, 42, 80, 12, 47, 161, 73, 168, 15, 181, 251, 18,
+        143, 11, 9, 156, 96, 238, 242, 169, 197, 55, 62, 12, 50, 236, 164, 31, 217, 25, 41, 9, 171, 12, 239, 29,
+        159, 197, 55, 7, 121, 133, 1, 27, 56, 18, 200, 107, 254, 58, 80, 23, 172, 29, 133, 41, 24, 28, 159, 18,
+        147, 23, 159, 53, 20, 12, 42, 207, 172, 197, 61, 1, 56, 15, 154, 15, 181, 31, 50, 220, 107, 16, 172, 238,
+        207, 132, 233, 37, 193, 41, 48, 113, 1, 136, 10, 200, 23, 184, 146, 62, 113, 88, 229, 56, 255, 29, 170, 21,
+        90, 184, 10, 143, 247, 146, 28, 161, 94, 6, 175, 241, 96, 6, 227, 91, 170, 189, 5, 154, 160, 17, 58, 112,
+        206, 21, 113, 30, 168, 7, 181, 30, 164, 6, 173, 53, 86, 6, 145, 248, 83, 29, 200, 7, 106, 114, 153, 33,
+        109, 62, 3, 102, 133, 33, 109, 62, 3, 102, 133, 33, 109, 62, 117, 197, 55, 62, 12, 223, 56, 12, 225, 204,
+        26, 159, 28, 184, 24, 28, 151, 42, 25, 41, 57, 57, 1, 120, 251, 40, 84, 6, 13, 168, 5, 151, 30, 182,
+        206, 105, 99, 143, 247, 9, 151, 15, 175, 3, 99, 227, 11, 38, 81, 206, 105, 45, 1, 71, 27, 168, 105, 70,
+        42, 122, 53, 193, 57, 12, 45, 10, 172, 41, 230, 53, 70, 42, 47, 154, 1, 175, 99, 154, 15, 154, 37, 99,
+        154, 46, 181, 7, 182, 99, 13, 181, 31, 88, 12, 40, 84, 249, 196, 206, 192, 67, 147, 11, 1, 175, 80, 67,
+        164, 30, 178, 3, 67, 172, 83, 5, 151, 78, 16, 166, 67, 181, 35, 166, 160, 17, 11, 43, 42, 219, 56, 75,
+        3, 40, 84, 42, 41, 30, 151, 3, 67, 164, 74, 172, 88, 67, 200, 74, 56, 67, 175, 11, 16, 19, 27, 181,
+        67, 176, 75, 7, 106, 31, 192, 75, 3, 43, 223, 56, 12, 43, 223, 56, 12, 67, 19, 174, 80, 87, 56, 67,
+        166, 250, 235, 31, 99, 181, 78, 96, 254, 67, 168, 88, 187, 78, 16, 166, 1, 56, 75, 3, 67, 170, 55, 49,
+        88, 43, 42, 82, 248, 179, 55, 49, 75, 3, 40, 84, 6, 84, 7, 181, 11, 16, 170, 80, 244, 42, 21, 7,
+        19, 168, 16, 166, 53, 244, 42, 41, 5, 174, 62, 105, 99, 164, 52, 51, 28, 56, 75, 3, 67, 178, 66, 57,
+        1, 120, 251, 67, 176, 16, 34, 88, 67, 181, 80, 5, 151, 16, 120, 213, 67, 181, 80, 16, 151, 5, 166, 3,
+        43, 50, 11, 33, 23, 56, 43, 42, 11, 83, 105, 99, 168, 66, 51, 10, 218, 75, 127, 10, 145, 49, 21, 187,
+        42, 179, 17, 99, 134, 11, 1, 150, 59, 31, 5, 151, 83, 192, 43, 50, 12, 28, 166, 88, 105, 99, 106, 28,
+        106, 9, 56, 67, 170, 87, 106, 3, 43, 42, 17, 11, 82, 1, 132, 43, 50, 53, 17, 10, 143, 41, 99, 145,
+        11, 66, 24, 28, 151, 43, 223, 56, 104, 174, 15, 130, 67, 170, 51, 28, 174, 244, 158, 189, 230, 12, 28, 164,
+        16, 34, 31, 99, 137, 142, 33, 219, 164, 99, 164, 7, 164, 53, 1, 34, 31, 70, 61, 33, 53, 3, 43, 61,
+        51, 47, 159, 88, 67, 175, 122, 72, 73, 150, 74, 159, 17, 45, 33, 31, 81, 63, 218, 28, 161, 28, 178, 88,
+        192, 43, 223, 56, 12, 43, 42, 219, 151, 37, 67, 154, 83, 36, 7, 172, 90, 56, 67, 172, 219, 175, 7, 164,
+        105, 99, 106, 24, 75, 49, 72, 192, 17, 244, 6, 135, 28, 149, 30, 164, 192, 32, 79, 98, 108, 97, 115, 116,
+        113, 88, 237, 9, 172, 9, 176, 192, 67, 159, 82, 33, 192, 67, 147, 33, 192, 67, 150, 234, 253, 105, 70, 42,
+        15, 174, 11, 88, 12, 40, 84, 153, 41, 100, 212, 99, 133, 41, 100, 212, 244, 194, 30, 181, 3, 70, 42, 21,
+        7, 19, 168, 16, 175, 53, 192, 244, 223, 151, 251, 31, 67, 154, 241, 255, 49, 229, 145, 49, 21, 187, 42, 33,
+        1, 154, 7, 164, 49, 3, 244, 61, 1, 150, 72, 57, 67, 170, 21, 160, 12, 28, 56, 17, 208, 25, 6, 175,
+        228, 46, 166, 17, 10, 218, 75, 127, 40, 84, 6, 150, 7, 172, 11, 88, 1, 56, 208, 25, 153, 33, 95, 11,
+        43, 61, 7, 150, 3, 70, 102, 175, 234, 46, 164, 105, 70, 42, 37, 213, 18, 176, 46, 121, 182, 23, 152, 212,
+        194, 20, 31, 1, 156, 57, 158, 26, 156, 90, 151, 195, 220, 93, 168, 90, 54, 184, 105, 10, 185, 30, 136, 6,
+        154, 46, 14, 54, 154, 17, 125, 6, 157, 15, 156, 20, 209, 201, 20, 74, 54, 184, 22, 6, 132, 30, 106, 20,
+        93, 143, 37, 5, 185, 30, 136, 249, 9, 147, 37, 90, 151, 6, 182, 216, 236, 151, 6, 182, 74, 149, 55, 63,
+        175, 209, 5, 182, 63, 185, 66, 93, 151, 30, 13, 157, 16, 138, 232, 198, 125, 193, 236, 151, 195, 22, 24, 15,
+        136, 201, 114, 57, 195, 15, 172, 15, 136, 6, 182, 31, 49, 55, 63, 173, 26, 164, 11, 17, 169, 125, 80, 105,
+        102, 13, 168, 91, 174, 125, 80, 29, 185, 15, 92, 236, 54, 156, 20, 209, 195, 30, 168, 93, 106, 198, 125, 10,
+        218, 75, 127, 58, 112, 206, 21, 61, 9, 154, 198, 37, 6, 175, 30, 168, 5, 168, 93, 164, 9, 172, 231, 86,
+        232, 74, 184, 22, 42, 90, 152, 212, 6, 157, 90, 156, 20, 209, 10, 137, 1, 136, 1, 152, 22, 205, 154, 126,
+        6, 175, 46, 143, 81, 169, 202, 168, 91, 71, 137, 211, 1, 27, 13, 14, 151, 94, 81, 245, 42, 5, 178, 196,
+        11, 211, 37, 94, 153, 23, 159, 53, 230, 211, 62, 18, 133, 23, 164, 11, 47, 183, 111, 21, 26, 175, 102, 133,
+        23, 164, 11, 47, 183, 111, 21, 26, 175, 102, 170, 2, 131, 1, 165, 52, 17, 0,
+};
+
+static const unsigned char TERRITORY_NAMES_PAIRS_HI[256][2] = {
+        {0, 0}, {224, 164}, {224, 165}, {1, 190}, {2, 141}, {4, 1}, {0, 1}, {3, 1}, {1, 191}, {8, 1}, {32, 1}, {1, 176},
+        {2, 139}, {135, 1}, {130, 1}, {2, 13}, {12, 1}, {2, 128}, {3, 6}, {184, 5}, {9, 175}, {5, 176}, {2, 129}, {1, 14},
+        {1, 172}, {2, 136}, {17, 1}, {178, 7}, {11, 5}, {20, 18}, {22, 1}, {7, 168}, {32, 32}, {1, 174}, {19, 164}, {5, 27},
+        {5, 175}, {1, 168}, {10, 147}, {24, 35}, {38, 39}, {1, 178}, {6, 149}, {40, 34}, {44, 44}, {45, 45}, {2, 14}, {11, 7},
+        {23, 161}, {1, 149}, {6, 174}, {2, 135}, {5, 181}, {7, 176}, {151, 1}, {5, 184}, {19, 149}, {9, 168}, {10, 149}, {1, 188},
+        {25, 48}, {6, 184}, {9, 149}, {17, 6}, {156, 36}, {10, 54}, {15, 168}, {43, 6}, {47, 64}, {65, 163}, {69, 68}, {134, 1},
+        {7, 178}, {12, 6}, {7, 14}, {7, 175}, {10, 166}, {10, 184}, {12, 11}, {79, 79}, {16, 178}, {1, 184}, {2, 137}, {15, 178},
+        {19, 159}, {26, 170}, {1, 164}, {15, 14}, {16, 181}, {52, 85}, {9, 14}, {11, 10}, {13, 178}, {31, 6}, {76, 89}, {2, 130},
+        {16, 168}, {97, 97}, {98, 98}, {70, 6}, {5, 164}, {10, 148}, {124, 1}, {6, 170}, {12, 10}, {20, 3}, {156, 59}, {9, 159},
+        {108, 108}, {51, 11}, {71, 92}, {5, 159}, {5, 183}, {6, 168}, {9, 178}, {115, 115}, {116, 116}, {18, 174}, {101, 91}, {110, 60},
+        {151, 21}, {184, 6}, {7, 174}, {10, 119}, {124, 124}, {23, 151}, {26, 168}, {86, 100}, {128, 128}, {129, 129}, {130, 130}, {131, 131},
+        {171, 59}, {133, 133}, {134, 134}, {135, 135}, {136, 136}, {137, 137}, {138, 138}, {139, 139}, {140, 140}, {141, 141}, {1, 166}, {143, 143},
+        {144, 144}, {145, 145}, {1, 181}, {147, 147}, {148, 148}, {149, 149}, {150, 150}, {151, 151}, {152, 152}, {6, 133}, {154, 154}, {155, 155},
+        {156, 156}, {157, 157}, {6, 172}, {159, 159}, {9, 174}, {161, 161}, {162, 162}, {163, 163}, {164, 164}, {165, 165}, {166, 166}, {167, 167},
+        {168, 168}, {10, 174}, {170, 170}, {171, 171}, {172, 172}, {173, 173}, {174, 174}, {175, 175}, {176, 176}, {15, 182}, {178, 178}, {16, 174},
+        {28, 156}, {181, 181}, {182, 182}, {183, 183}, {184, 184}, {185, 185}, {87, 159}, {1, 151}, {188, 188}, {1, 182}, {190, 190}, {191, 191},
+        {5, 56}, {5, 161}, {6, 164}, {6, 185}, {9, 170}, {15, 149}, {30, 134}, {41, 60}, {172, 21}, {6, 156}, {7, 13}, {9, 184},
+        {10, 170}, {11, 6}, {15, 164}, {36, 46}, {58, 21}, {74, 151}, {123, 55}, {1, 159}, {7, 136}, {7, 161}, {9, 163}, {10, 133},
+        {15, 161}, {18, 149}, {19, 181}, {22, 28}, {25, 37}, {33, 46}, {49, 112}, {50, 7}, {224, 224}, {61, 186}, {84, 21}, {137, 127},
+        {1, 185}, {3, 10}, {5, 149}, {5, 172}, {6, 151}, {7, 137}, {7, 149}, {9, 34}, {16, 14}, {16, 184}, {18, 168}, {28, 168},
+        {29, 184}, {30, 149}, {36, 95}, {166, 222}, {208, 75}, {221, 185}, {243, 214}, {1, 161}, {1, 226}, {6, 178}, {7, 151}, {7, 166},
+        {7, 170}, {7, 184}, {9, 182}, {16, 159},
+};
+
+static const unsigned short TERRITORY_NAME_ALTERNATIVES_START_HI[_TERRITORY_MAX - _TERRITORY_MIN] = {
+        0, 2, 3, 4, 5, 7, 8, 9, 10, 11, 12, 13, 16, 17, 18, 19,
+        20, 21, 22, 23, 24, 25, 26, 28, 29, 30, 31, 32, 34, 35, 37, 38,
+        40, 41, 42, 43, 45, 46, 47, 49, 50, 52, 54, 56, 57, 59, 60, 61,
+        62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 75, 76, 77, 78,
+        79, 80, 81, 82, 83, 84, 85, 87, 88, 89, 91, 92, 93, 94, 95, 96,
+        97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 108, 109, 110, 111, 112, 113,
+        114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129,
+        130, 131, 132, 133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143, 144, 145,
+        146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159, 160, 161,
+        162, 163, 164, 165, 166, 167, 168, 169, 170, 171, 172, 173, 174, 175, 176, 177,
+        178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191, 192, 193,
+        194, 195, 196, 197, 198, 199, 200, 201, 202, 203, 204, 205, 206, 207, 208, 209,
+        210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223, 224, 225,
+        227, 228, 229, 230, 231, 232, 233, 234, 235, 236, 237, 238, 239, 240, 241, 242,
+        243, 244, 245, 246, 247, 248, 249, 250, 251, 252, 253, 254, 255, 256, 257, 258,
+        259, 260, 261, 262, 263, 264, 265, 266, 267, 268, 269, 270, 271, 272, 273, 274,
+        275, 276, 277, 278, 279, 280, 281, 282, 283, 284, 285, 286, 287, 288, 289, 290,
+        291, 292, 293, 294, 295, 296, 297, 298, 299, 300, 301, 302, 303, 304, 305, 306,
+        307, 308, 309, 310, 311, 312, 313, 314, 315, 316, 317, 319, 320, 321, 322, 323,
+        324, 325, 326, 327, 328, 329, 330, 331, 332, 333, 334, 335, 336, 337, 338, 339,
+        340, 341, 342, 343, 344, 345, 346, 347, 348, 349, 350, 351, 352, 353, 354, 355,
+        356, 357, 358, 359, 360, 361, 362, 363, 364, 365, 366, 367, 368, 369, 370, 371,
+        372, 373, 374, 375, 376, 377, 378, 379, 380, 381, 382, 383, 384, 385, 386, 387,
+        388, 389, 390, 391, 392, 393, 394, 395, 396, 397, 398, 399, 400, 401, 402, 403,
+        404, 405, 406, 407, 408, 409, 410, 411, 412, 413, 414, 415, 416, 417, 418, 419,
+        420, 421, 422, 423, 424, 425, 426, 427, 428, 429, 430, 433, 434, 435, 436, 437,
+        438, 439, 440, 441, 442, 443, 444, 445, 446, 447, 448, 449, 450, 451, 452, 453,
+        454, 455, 456, 457, 458, 459, 460, 461, 462, 463, 464, 465, 466, 467, 468, 469,
+        470, 471, 472, 473, 474, 475, 476, 477, 478, 479, 480, 481, 482, 483, 484, 485,
+        486, 487, 488, 489, 490, 491, 492, 493, 494, 495, 496, 497, 498, 499, 500, 501,
+        502, 503, 504, 505, 506, 507, 508, 509, 510, 511, 512, 513, 514, 515, 516, 518,
+        519, 520, 521, 522, 523, 524, 525, 526, 527, 528, 529, 530, 531, 532, 533, 534,
+        535, 536, 537, 538, 539, 540, 541, 543, 544, 545, 546, 547, 548, 549, 550, 551,
+        552, 553, 554, 555, 556, 559,
+};
+
+static const TerritoryNameAlternative TERRITORY_NAME_ALTERNATIVES_HI[559] = {
+        {0, 31, 4}, {32, 34, 4}, {67, 18, 4}, {86, 30, 4}, {117, 21, 4}, {139, 31, 4}, {171, 47, 4}, {219, 40, 4},
+        {260, 15, 4}, {276, 18, 4}, {295, 12, 4}, {308, 34, 4}, {343, 34, 4}, {378, 73, 4}, {452, 34, 4}, {487, 31, 4},
+        {519, 53, 4}, {573, 34, 4}, {608, 18, 4}, {627, 84, 4}, {712, 28, 4}, {741, 27, 4}, {769, 21, 4}, {791, 33, 4},
+        {825, 15, 4}, {841, 37, 4}, {879, 50, 4}, {930, 27, 4}, {958, 65, 4}, {1024, 33, 4}, {1058, 15, 4}, {1074, 34, 4},
+        {1109, 34, 4}, {1144, 35, 4}, {1180, 34, 4}, {1215, 57, 4}, {1273, 21, 4}, {1295, 12, 4}, {1308, 51, 4}, {1360, 15, 4},
+        {1376, 28, 4}, {1405, 9, 4}, {1415, 18, 4}, {1434, 106, 4}, {1541, 15, 4}, {1557, 18, 4}, {1576, 24, 4}, {1601, 43, 4},
+        {1645, 105, 4}, {1751, 12, 4}, {1764, 63, 4}, {1828, 25, 4}, {1854, 75, 4}, {1930, 36, 4}, {1967, 94, 4}, {2062, 55, 4},
+        {2118, 24, 4}, {2143, 50, 4}, {2194, 21, 4}, {2216, 21, 4}, {2238, 21, 4}, {2260, 12, 4}, {2273, 59, 4}, {2333, 18, 4},
+        {2352, 12, 4}, {2365, 26, 4}, {2392, 31, 4}, {2424, 39, 4}, {2464, 24, 4}, {2489, 15, 4}, {2505, 24, 4}, {2530, 15, 4},
+        {2546, 24, 4}, {2571, 75, 4}, {2647, 43, 4}, {2691, 54, 4}, {2746, 24, 4}, {2771, 27, 4}, {2799, 40, 4}, {2840, 27, 4},
+        {2868, 21, 4}, {2890, 18, 4}, {2909, 24, 4}, {2934, 27, 4}, {2962, 12, 4}, {2975, 110, 4}, {3086, 59, 4}, {3146, 49, 4},
+        {3196, 25, 4}, {3222, 56, 4}, {3279, 18, 4}, {3298, 21, 4}, {3320, 94, 4}, {3415, 28, 4}, {3444, 21, 4}, {3466, 18, 4},
+        {3485, 15, 4}, {3501, 24, 4}, {3526, 9, 4}, {3536, 53, 4}, {3590, 21, 4}, {3612, 33, 4}, {3646, 15, 4}, {3662, 34, 4},
+        {3697, 33, 4}, {3731, 15, 4}, {3747, 41, 4}, {3789, 15, 4}, {3805, 43, 4}, {3849, 30, 4}, {3880, 18, 4}, {3899, 52, 4},
+        {3952, 34, 4}, {3987, 15, 4}, {4003, 18, 4}, {4022, 30, 4}, {4053, 21, 4}, {4075, 12, 4}, {4088, 30, 4}, {4119, 46, 4},
+        {4166, 27, 4}, {4194, 34, 4}, {4229, 27, 4}, {4257, 18, 4}, {4276, 24, 4}, {4301, 24, 4}, {4326, 30, 4}, {4357, 18, 4},
+        {4376, 15, 4}, {4392, 36, 4}, {4429, 24, 4}, {4454, 24, 4}, {4479, 27, 4}, {4507, 46, 4}, {4554, 30, 4}, {4585, 31, 4},
+        {4617, 65, 4}, {4683, 27, 4}, {4711, 12, 4}, {4724, 21, 4}, {4746, 27, 4}, {4774, 24, 4}, {4799, 24, 4}, {4824, 21, 4},
+        {4846, 31, 4}, {4878, 15, 4}, {4894, 31, 4}, {4926, 34, 4}, {4961, 50, 4}, {5012, 27, 4}, {5040, 30, 4}, {5071, 21, 4},
+        {5093, 18, 4}, {5112, 24, 4}, {5137, 15, 4}, {5153, 37, 4}, {5191, 21, 4}, {5213, 30, 4}, {5244, 18, 4}, {5263, 30, 4},
+        {5294, 27, 4}, {5322, 24, 4}, {5347, 15, 4}, {5363, 27, 4}, {5391, 15, 4}, {5407, 34, 4}, {5442, 27, 4}, {5470, 15, 4},
+        {5486, 33, 4}, {5520, 30, 4}, {5551, 15, 4}, {5567, 30, 4}, {5598, 21, 4}, {5620, 21, 4}, {5642, 24, 4}, {5667, 18, 4},
+        {5686, 18, 4}, {5705, 33, 4}, {5739, 21, 4}, {5761, 18, 4}, {5780, 12, 4}, {5793, 24, 4}, {5818, 12, 4}, {5831, 21, 4},
+        {5853, 43, 4}, {5897, 12, 4}, {5910, 24, 4}, {5935, 37, 4}, {5973, 15, 4}, {5989, 30, 4}, {6020, 37, 4}, {6058, 24, 4},
+        {6083, 12, 4}, {6096, 12, 4}, {6109, 18, 4}, {6128, 31, 4}, {6160, 18, 4}, {6179, 21, 4}, {6201, 21, 4}, {6223, 21, 4},
+        {6245, 46, 4}, {6292, 18, 4}, {6311, 15, 4}, {6327, 30, 4}, {6358, 24, 4}, {6383, 12, 4}, {6396, 21, 4}, {6418, 33, 4},
+        {6452, 18, 4}, {6471, 41, 4}, {6513, 18, 4}, {6532, 42, 4}, {6575, 15, 4}, {6591, 21, 4}, {6613, 9, 4}, {6623, 21, 4},
+        {6645, 44, 4}, {6690, 18, 4}, {6709, 27, 4}, {6737, 30, 4}, {6768, 21, 4}, {6790, 34, 4}, {6825, 68, 4}, {6894, 24, 4},
+        {6919, 39, 4}, {6959, 24, 4}, {6984, 15, 4}, {7000, 24, 4}, {7025, 12, 4}, {7038, 15, 4}, {7054, 27, 4}, {7082, 27, 4},
+        {7110, 24, 4}, {7135, 27, 4}, {7163, 27, 4}, {7191, 24, 4}, {7216, 15, 4}, {7232, 30, 4}, {7263, 24, 4}, {7288, 27, 4},
+        {7316, 27, 4}, {7344, 40, 4}, {7385, 12, 4}, {7398, 18, 4}, {7417, 15, 4}, {7433, 9, 4}, {7443, 12, 4}, {7456, 24, 4},
+        {7481, 12, 4}, {7494, 18, 4}, {7513, 15, 4}, {7529, 30, 4}, {7560, 49, 4}, {7610, 33, 4}, {7644, 21, 4}, {7666, 39, 4},
+        {7706, 18, 4}, {7725, 30, 4}, {7756, 18, 4}, {7775, 40, 4}, {7816, 21, 4}, {7838, 21, 4}, {7860, 33, 4}, {7894, 24, 4},
+        {7919, 18, 4}, {7938, 34, 4}, {7973, 21, 4}, {7995, 18, 4}, {8014, 24, 4}, {8039, 41, 4}, {8081, 24, 4}, {8106, 31, 4},
+        {8138, 49, 4}, {8188, 27, 4}, {8216, 21, 4}, {8238, 59, 4}, {8298, 27, 4}, {8326, 21, 4}, {8348, 30, 4}, {8379, 21, 4},
+        {8401, 18, 4}, {8420, 24, 4}, {8445, 18, 4}, {8464, 24, 4}, {8489, 27, 4}, {8517, 22, 4}, {8540, 37, 4}, {8578, 24, 4},
+        {8603, 27, 4}, {8631, 30, 4}, {8662, 26, 4}, {8689, 48, 4}, {8738, 21, 4}, {8760, 50, 4}, {8811, 27, 4}, {8839, 18, 4},
+        {8858, 18, 4}, {8877, 24, 4}, {8902, 18, 4}, {8921, 24, 4}, {8946, 18, 4}, {8965, 21, 4}, {8987, 15, 4}, {9003, 21, 4},
+        {9025, 40, 4}, {9066, 9, 4}, {9076, 15, 4}, {9092, 27, 4}, {9120, 12, 4}, {9133, 12, 4}, {9146, 24, 4}, {9171, 37, 4},
+        {9209, 41, 4}, {9251, 27, 4}, {9279, 18, 4}, {9298, 21, 4}, {9320, 24, 4}, {9345, 15, 4}, {9361, 18, 4}, {9380, 18, 4},
+        {9399, 34, 4}, {9434, 31, 4}, {9466, 24, 4}, {9491, 34, 4}, {9526, 30, 4}, {9557, 34, 4}, {9592, 24, 4}, {9617, 41, 4},
+        {9659, 80, 4}, {9740, 47, 4}, {9788, 40, 4}, {9829, 52, 4}, {9882, 27, 4}, {9910, 30, 4}, {9941, 55, 4}, {9997, 30, 4},
+        {10028, 46, 4}, {10075, 18, 4}, {10094, 18, 4}, {10113, 41, 4}, {10155, 43, 4}, {10199, 57, 4}, {10257, 21, 4}, {10279, 37, 4},
+        {10317, 24, 4}, {10342, 15, 4}, {10358, 15, 4}, {10374, 15, 4}, {10390, 18, 4}, {10409, 18, 4}, {10428, 30, 4}, {10459, 25, 4},
+        {10485, 15, 4}, {10501, 33, 4}, {10535, 51, 4}, {10587, 24, 4}, {10612, 18, 4}, {10631, 48, 4}, {10680, 18, 4}, {10699, 34, 4},
+        {10734, 31, 4}, {10766, 12, 4}, {10779, 24, 4}, {10804, 44, 4}, {10849, 28, 4}, {10878, 24, 4}, {10903, 27, 4}, {10931, 28, 4},
+        {10960, 40, 4}, {11001, 18, 4}, {11020, 33, 4}, {11054, 12, 4}, {11067, 24, 4}, {11092, 46, 4}, {11139, 43, 4}, {11183, 9, 4},
+        {11193, 24, 4}, {11218, 18, 4}, {11237, 18, 4}, {11256, 27, 4}, {11284, 15, 4}, {11300, 39, 4}, {11340, 24, 4}, {11365, 27, 4},
+        {11393, 18, 4}, {11412, 24, 4}, {11437, 43, 4}, {11481, 27, 4}, {11509, 15, 4}, {11525, 21, 4}, {11547, 24, 4}, {11572, 33, 4},
+        {11606, 24, 4}, {11631, 18, 4}, {11650, 24, 4}, {11675, 31, 4}, {11707, 24, 4}, {11732, 34, 4}, {11767, 30, 4}, {11798, 21, 4},
+        {11820, 15, 4}, {11836, 12, 4}, {11849, 24, 4}, {11874, 18, 4}, {11893, 24, 4}, {11918, 15, 4}, {11934, 24, 4}, {11959, 18, 4},
+        {11978, 21, 4}, {12000, 37, 4}, {12038, 21, 4}, {12060, 36, 4}, {12097, 21, 4}, {12119, 21, 4}, {12141, 46, 4}, {12188, 21, 4},
+        {12210, 24, 4}, {12235, 21, 4}, {12257, 30, 4}, {12288, 24, 4}, {12313, 42, 4}, {12356, 31, 4}, {12388, 37, 4}, {12426, 53, 4},
+        {12480, 15, 4}, {12496, 59, 4}, {12556, 21, 4}, {12578, 12, 4}, {12591, 33, 4}, {12625, 24, 4}, {12650, 21, 4}, {12672, 21, 4},
+        {12694, 21, 4}, {12716, 24, 4}, {12741, 18, 4}, {12760, 43, 4}, {12804, 61, 4}, {12866, 55, 4}, {12922, 43, 4}, {12966, 81, 4},
+        {13048, 72, 4}, {13121, 37, 4}, {13159, 34, 4}, {13194, 37, 4}, {13232, 46, 4}, {13279, 52, 4}, {13332, 40, 4}, {13373, 37, 4},
+        {13411, 52, 4}, {13464, 52, 4}, {13517, 55, 4}, {13573, 40, 4}, {13614, 43, 4}, {13658, 49, 4}, {13708, 49, 4}, {13758, 70, 4},
+        {13829, 43, 4}, {13873, 43, 4}, {13917, 55, 4}, {13973, 49, 4}, {14023, 46, 4}, {14070, 67, 4}, {14138, 43, 4}, {14182, 70, 4},
+        {14253, 46, 4}, {14300, 49, 4}, {14350, 49, 4}, {14400, 61, 4}, {14462, 55, 4}, {14518, 46, 4}, {14565, 58, 4}, {14624, 49, 4},
+        {14674, 46, 4}, {14721, 43, 4}, {14765, 53, 4}, {14819, 34, 4}, {14854, 67, 4}, {14922, 52, 4}, {14975, 55, 4}, {15031, 43, 4},
+        {15075, 43, 4}, {15119, 41, 4}, {15161, 49, 4}, {15211, 53, 4}, {15265, 31, 4}, {15297, 64, 4}, {15362, 43, 4}, {15406, 52, 4},
+        {15459, 40, 4}, {15500, 46, 4}, {15547, 18, 4}, {15566, 31, 4}, {15598, 70, 4}, {15669, 43, 4}, {15713, 43, 4}, {15757, 61, 4},
+        {15819, 52, 4}, {15872, 55, 4}, {15928, 37, 4}, {15966, 64, 4}, {16031, 46, 4}, {16078, 43, 4}, {16122, 46, 4}, {16169, 46, 4},
+        {16216, 40, 4}, {16257, 34, 4}, {16292, 34, 4}, {16327, 61, 4}, {16389, 46, 4}, {16436, 37, 4}, {16474, 37, 4}, {16512, 43, 4},
+        {16556, 49, 4}, {16606, 65, 4}, {16672, 40, 4}, {16713, 37, 4}, {16751, 34, 4}, {16786, 46, 4}, {16833, 15, 4}, {16849, 9, 4},
+        {16859, 15, 4}, {16875, 24, 4}, {16900, 18, 4}, {16919, 15, 4}, {16935, 34, 4}, {16970, 24, 4}, {16995, 24, 4}, {17020, 24, 4},
+        {17045, 27, 4}, {17073, 18, 4}, {17092, 21, 4}, {17114, 18, 4}, {17133, 21, 4}, {17155, 21, 4}, {17177, 15, 4}, {17193, 18, 4},
+        {17212, 30, 4}, {17243, 15, 4}, {17259, 15, 4}, {17275, 15, 4}, {17291, 21, 4}, {17313, 40, 4}, {17354, 34, 4}, {17389, 39, 4},
+        {17429, 15, 4}, {17445, 65, 4}, {17511, 18, 4}, {17530, 21, 4}, {17552, 18, 4}, {17571, 15, 4}, {17587, 18, 4}, {17606, 43, 4},
+        {17650, 9, 4}, {17660, 81, 4}, {17742, 40, 4}, {17783, 33, 4}, {17817, 39, 4}, {17857, 39, 4}, {17897, 18, 4},
+};
+
+static char TERRITORY_NAMES_UNPACKED_HI[17916];
+
+static const PackedTerritoryNames PACKED_TERRITORY_NAMES_HI = {
+        TERRITORY_NAMES_UNPACKED_HI, 17916, TERRITORY_NAMES_PACKED_HI, 3666, TERRITORY_NAMES_PAIRS_HI,
+        TERRITORY_NAME_ALTERNATIVES_START_HI, TERRITORY_NAME_ALTERNATIVES_HI};
+
+#else
+
+static const PackedTerritoryNames PACKED_TERRITORY_NAMES_HI = {NULL, 0, NULL, 0, NULL, NULL, NULL};
+
+#endif // MAPCODE_SUPPORT_LANGUAGE_HI
+
+#ifdef MAPCODE_SUPPORT_LANGUAGE_HR // Croatian
+
+// 6972 bytes, packed to 3525
+static const unsigned char TERRITORY_NAMES_PACKED_HR[3525] = {
+        86, 51, 19, 2, 124, 83, 136, 3, 83, 12, 108, 95, 91, 18, 94, 37, 71, 170, 114, 11, 221, 152, 253, 36,
+        181, 62, 253, 150, 207, 149, 252, 75, 101, 36, 142, 32, 149, 188, 171, 66, 10, 12, 108, 96, 125, 64, 97, 38,
+        117, 152, 117, 118, 11, 117, 55, 94, 97, 111, 239, 213, 116, 9, 32, 78, 76, 68, 239, 213, 116, 9, 164, 143,
+        32, 70, 82, 65, 64, 23, 102, 49, 107, 129, 70, 133, 126, 164, 53, 252, 70, 133, 126, 164, 143, 139, 218, 99,
+        97, 60, 110, 32, 149, 15, 66, 111, 117, 118, 101, 12, 118, 32, 111, 143, 138, 13, 109, 203, 15, 245, 162, 193,
+        100, 8, 6, 111, 111, 99, 101, 162, 116, 175, 224, 26, 63, 213, 9, 37, 176, 235, 115, 101, 121, 127, 110, 103,
+        117, 133, 108, 91, 18, 116, 115, 13, 114, 51, 151, 13, 115, 101, 121, 138, 111, 41, 105, 196, 135, 147, 111, 143,
+        0, 87, 11, 108, 61, 129, 70, 134, 58, 131, 70, 134, 58, 1, 245, 162, 68, 93, 105, 52, 162, 198, 252, 68,
+        93, 105, 52, 162, 198, 105, 208, 245, 2, 6, 15, 76, 105, 104, 116, 21, 137, 116, 35, 110, 127, 114, 117, 98,
+        91, 10, 137, 11, 207, 198, 15, 210, 175, 165, 3, 83, 25, 111, 131, 83, 25, 111, 97, 208, 210, 175, 165, 1,
+        67, 111, 253, 207, 149, 188, 171, 80, 47, 10, 129, 77, 19, 36, 18, 124, 77, 19, 36, 18, 64, 105, 222, 239,
+        75, 50, 4, 111, 102, 23, 129, 78, 101, 118, 61, 124, 78, 101, 118, 61, 62, 35, 109, 162, 198, 188, 146, 229,
+        107, 10, 126, 43, 149, 5, 66, 18, 97, 60, 101, 129, 83, 171, 69, 117, 4, 182, 8, 101, 124, 66, 18, 97,
+        60, 101, 124, 83, 171, 69, 117, 4, 182, 8, 101, 55, 11, 100, 105, 118, 188, 136, 3, 72, 36, 21, 3, 111,
+        143, 208, 65, 115, 99, 21, 115, 105, 18, 129, 84, 50, 232, 100, 231, 58, 104, 131, 65, 115, 99, 21, 115, 105,
+        18, 124, 84, 50, 232, 100, 231, 58, 104, 91, 11, 116, 1, 144, 21, 24, 174, 65, 68, 32, 68, 93, 105, 52,
+        162, 149, 252, 68, 93, 105, 52, 162, 149, 105, 208, 83, 65, 68, 55, 199, 202, 116, 101, 26, 118, 11, 98, 10,
+        100, 129, 74, 63, 77, 199, 21, 124, 74, 63, 77, 199, 21, 239, 86, 9, 99, 236, 129, 144, 21, 24, 9, 252,
+        144, 21, 24, 9, 15, 246, 32, 72, 101, 10, 100, 129, 111, 12, 52, 48, 32, 77, 99, 68, 18, 11, 100, 124,
+        79, 12, 52, 48, 32, 77, 99, 68, 18, 11, 100, 138, 10, 98, 24, 150, 127, 110, 116, 217, 118, 229, 66, 10,
+        98, 203, 131, 66, 10, 98, 203, 1, 67, 38, 97, 195, 167, 97, 111, 26, 125, 137, 36, 15, 80, 11, 181, 26,
+        179, 147, 213, 8, 162, 149, 15, 65, 110, 100, 23, 1, 176, 25, 0, 246, 32, 77, 2, 26, 136, 3, 76, 254,
+        20, 77, 19, 114, 18, 168, 8, 131, 83, 57, 168, 110, 156, 68, 114, 41, 57, 156, 77, 19, 114, 18, 168, 8,
+        101, 26, 142, 97, 27, 114, 152, 128, 1, 68, 96, 9, 29, 66, 123, 114, 101, 9, 62, 105, 50, 98, 51, 15,
+        198, 5, 84, 38, 107, 115, 129, 67, 97, 95, 150, 124, 246, 5, 67, 97, 95, 150, 239, 84, 96, 229, 178, 9,
+        99, 126, 124, 178, 9, 99, 126, 172, 128, 32, 75, 128, 55, 10, 116, 9, 105, 113, 222, 158, 10, 43, 198, 15,
+        177, 24, 11, 117, 112, 101, 62, 96, 23, 15, 77, 97, 38, 95, 8, 117, 115, 227, 195, 169, 58, 105, 18, 164,
+        143, 0, 76, 117, 107, 115, 215, 98, 38, 103, 26, 25, 111, 1, 194, 54, 71, 101, 23, 103, 8, 229, 111, 12,
+        52, 48, 32, 194, 147, 83, 42, 119, 95, 104, 158, 114, 2, 99, 117, 28, 80, 49, 9, 168, 20, 90, 36, 21,
+        237, 240, 84, 114, 9, 250, 24, 129, 84, 111, 98, 155, 111, 124, 84, 111, 98, 155, 37, 244, 58, 125, 158, 114,
+        2, 99, 117, 43, 106, 157, 147, 5, 2, 221, 107, 116, 105, 165, 5, 116, 175, 224, 15, 80, 23, 154, 19, 37,
+        67, 126, 10, 0, 76, 170, 2, 18, 151, 25, 35, 107, 1, 71, 206, 20, 75, 51, 10, 158, 11, 107, 184, 43,
+        149, 15, 86, 2, 117, 51, 117, 0, 67, 114, 54, 71, 23, 1, 66, 123, 25, 15, 73, 4, 111, 52, 147, 84,
+        201, 23, 26, 118, 182, 15, 75, 117, 118, 35, 116, 158, 250, 41, 15, 78, 30, 3, 75, 11, 247, 18, 20, 83,
+        108, 30, 21, 20, 73, 122, 114, 97, 36, 139, 11, 101, 4, 9, 174, 11, 118, 24, 23, 138, 36, 251, 101, 226,
+        41, 170, 134, 15, 77, 94, 247, 18, 20, 82, 117, 42, 1, 72, 97, 218, 15, 66, 38, 58, 100, 15, 69, 107,
+        118, 97, 224, 11, 54, 177, 9, 125, 159, 108, 98, 228, 83, 11, 96, 18, 43, 198, 15, 243, 109, 21, 20, 76,
+        132, 111, 12, 138, 36, 103, 20, 77, 49, 100, 57, 20, 177, 9, 125, 3, 66, 61, 97, 37, 84, 35, 118, 39,
+        66, 134, 2, 124, 212, 11, 93, 9, 3, 66, 134, 39, 204, 118, 95, 10, 59, 78, 251, 111, 122, 215, 6, 131,
+        72, 49, 42, 20, 68, 2, 59, 69, 4, 18, 20, 68, 96, 9, 19, 2, 240, 83, 108, 30, 97, 165, 205, 111,
+        4, 10, 29, 66, 150, 54, 5, 72, 13, 99, 101, 103, 30, 9, 1, 72, 114, 118, 51, 59, 84, 111, 103, 37,
+        76, 101, 234, 20, 76, 218, 118, 1, 204, 114, 5, 76, 2, 107, 1, 144, 117, 122, 20, 211, 59, 83, 8, 13,
+        3, 76, 101, 18, 101, 139, 2, 25, 1, 196, 140, 101, 137, 107, 163, 70, 114, 2, 99, 117, 28, 177, 35, 2,
+        1, 85, 48, 100, 233, 21, 5, 243, 180, 43, 69, 109, 60, 51, 15, 191, 20, 65, 122, 13, 98, 125, 100, 41,
+        2, 26, 114, 98, 20, 74, 23, 100, 39, 80, 237, 223, 11, 55, 97, 196, 145, 10, 59, 194, 54, 75, 23, 125,
+        1, 73, 115, 184, 0, 177, 51, 215, 11, 205, 117, 98, 1, 66, 223, 10, 59, 76, 170, 13, 20, 72, 18, 100,
+        38, 46, 138, 21, 9, 0, 69, 209, 114, 125, 91, 11, 57, 188, 179, 54, 75, 23, 125, 173, 19, 10, 155, 118,
+        1, 144, 165, 1, 84, 24, 41, 19, 219, 66, 92, 108, 24, 101, 137, 64, 101, 112, 11, 152, 58, 61, 26, 38,
+        9, 25, 0, 85, 114, 223, 118, 35, 62, 206, 220, 41, 174, 60, 20, 83, 21, 101, 103, 11, 62, 60, 103, 219,
+        66, 106, 36, 23, 117, 115, 20, 177, 35, 2, 1, 76, 97, 150, 227, 255, 58, 106, 59, 71, 2, 1, 85, 103,
+        42, 1, 85, 48, 100, 233, 21, 148, 212, 11, 93, 4, 118, 111, 124, 86, 36, 19, 3, 245, 2, 8, 131, 204,
+        107, 202, 6, 131, 83, 179, 54, 211, 6, 131, 211, 6, 97, 208, 83, 179, 110, 1, 177, 9, 125, 1, 69, 107,
+        118, 24, 23, 0, 90, 180, 24, 54, 83, 123, 10, 1, 71, 146, 18, 64, 207, 90, 36, 42, 138, 38, 107, 9,
+        3, 70, 46, 37, 70, 133, 126, 9, 15, 73, 116, 11, 20, 79, 109, 39, 80, 49, 106, 59, 79, 98, 11, 3,
+        66, 106, 36, 253, 111, 4, 15, 78, 23, 118, 101, 137, 107, 91, 11, 168, 20, 86, 8, 47, 110, 25, 158, 9,
+        59, 75, 128, 111, 45, 244, 182, 122, 57, 133, 108, 101, 64, 48, 109, 97, 165, 1, 74, 180, 39, 90, 201, 98,
+        146, 118, 101, 139, 10, 155, 118, 35, 0, 211, 94, 55, 10, 253, 37, 85, 122, 98, 200, 219, 204, 118, 247, 59,
+        80, 97, 27, 3, 78, 30, 3, 177, 9, 125, 205, 25, 13, 58, 152, 38, 107, 109, 21, 219, 204, 112, 2, 106,
+        49, 59, 84, 35, 184, 151, 215, 21, 158, 114, 2, 99, 117, 59, 65, 184, 43, 149, 15, 75, 21, 20, 66, 111,
+        99, 118, 2, 91, 24, 155, 97, 6, 10, 0, 85, 225, 9, 1, 194, 147, 83, 203, 2, 26, 114, 247, 110, 106,
+        111, 97, 102, 50, 165, 163, 83, 96, 11, 20, 65, 102, 103, 2, 219, 77, 105, 2, 109, 10, 124, 66, 38, 109,
+        1, 90, 206, 20, 196, 140, 133, 101, 152, 38, 59, 80, 94, 219, 77, 111, 122, 206, 19, 64, 25, 170, 20, 86,
+        21, 214, 117, 36, 173, 217, 13, 20, 84, 2, 122, 228, 69, 103, 126, 51, 55, 97, 38, 218, 228, 66, 49, 105,
+        118, 20, 69, 116, 105, 111, 112, 20, 75, 49, 255, 98, 20, 194, 54, 65, 102, 114, 29, 77, 11, 15, 65, 110,
+        103, 49, 173, 217, 13, 0, 196, 140, 24, 139, 13, 117, 55, 128, 49, 20, 211, 39, 76, 170, 20, 83, 203, 39,
+        193, 100, 18, 168, 20, 83, 57, 168, 54, 22, 84, 108, 97, 120, 99, 11, 91, 23, 36, 150, 127, 103, 117, 46,
+        99, 187, 236, 132, 0, 67, 49, 201, 1, 81, 117, 13, 47, 10, 37, 72, 250, 11, 103, 37, 68, 114, 41, 57,
+        3, 77, 200, 115, 19, 111, 124, 77, 200, 115, 19, 111, 208, 68, 114, 41, 57, 1, 84, 146, 46, 99, 37, 78,
+        199, 10, 218, 0, 176, 2, 35, 117, 97, 12, 139, 222, 7, 1, 89, 254, 51, 39, 81, 117, 9, 116, 2, 3,
+        82, 111, 111, 26, 9, 11, 111, 1, 67, 25, 112, 214, 104, 101, 55, 95, 104, 111, 166, 2, 26, 63, 76, 117,
+        61, 32, 80, 111, 12, 115, 15, 176, 13, 114, 13, 37, 78, 222, 118, 148, 76, 101, 18, 138, 35, 231, 187, 102,
+        23, 110, 105, 1, 86, 13, 166, 114, 117, 122, 0, 192, 105, 180, 46, 138, 35, 231, 187, 102, 23, 110, 105, 3,
+        83, 38, 0, 90, 166, 51, 214, 46, 151, 11, 61, 99, 37, 84, 25, 181, 108, 126, 46, 0, 79, 97, 120, 166,
+        1, 68, 38, 92, 37, 67, 111, 123, 117, 133, 174, 18, 23, 1, 192, 105, 248, 123, 117, 1, 144, 21, 184, 26,
+        181, 100, 8, 28, 243, 146, 20, 75, 128, 111, 45, 75, 9, 115, 104, 46, 159, 108, 41, 60, 62, 182, 123, 186,
+        243, 103, 236, 9, 1, 68, 25, 63, 42, 32, 68, 105, 117, 226, 24, 114, 229, 78, 155, 10, 32, 72, 57, 36,
+        15, 192, 42, 217, 10, 104, 127, 110, 100, 25, 63, 42, 32, 78, 95, 111, 98, 10, 0, 76, 94, 115, 104, 24,
+        119, 101, 101, 112, 226, 36, 104, 15, 77, 101, 103, 104, 11, 199, 173, 155, 11, 42, 55, 2, 105, 27, 114, 152,
+        50, 27, 114, 91, 251, 23, 25, 26, 19, 107, 201, 139, 58, 106, 146, 172, 10, 121, 2, 159, 114, 58, 166, 104,
+        11, 32, 178, 238, 104, 127, 115, 115, 25, 138, 105, 104, 10, 0, 85, 116, 221, 94, 104, 42, 0, 71, 111, 205,
+        13, 11, 1, 84, 25, 133, 32, 78, 24, 117, 172, 201, 166, 104, 11, 32, 178, 238, 104, 151, 25, 109, 117, 129,
+        75, 97, 137, 109, 60, 124, 75, 97, 137, 109, 60, 0, 192, 104, 51, 116, 61, 103, 10, 104, 151, 104, 10, 107,
+        104, 42, 62, 10, 110, 51, 94, 1, 82, 35, 14, 104, 39, 79, 50, 115, 115, 131, 79, 50, 115, 115, 1, 176,
+        106, 10, 51, 0, 90, 180, 24, 147, 66, 21, 103, 11, 55, 24, 104, 121, 3, 178, 238, 104, 152, 36, 92, 2,
+        159, 110, 100, 104, 114, 3, 178, 238, 104, 55, 123, 10, 46, 104, 116, 114, 1, 85, 116, 221, 32, 178, 238, 104,
+        139, 203, 254, 104, 13, 114, 121, 64, 207, 194, 147, 87, 11, 132, 124, 78, 216, 32, 83, 111, 134, 104, 32, 87,
+        11, 132, 127, 185, 187, 63, 67, 180, 218, 11, 32, 84, 13, 50, 154, 121, 124, 191, 11, 43, 71, 108, 57, 147,
+        84, 175, 224, 151, 13, 118, 61, 32, 66, 199, 32, 116, 175, 224, 26, 179, 147, 116, 175, 224, 124, 78, 237, 104,
+        235, 32, 84, 13, 50, 154, 121, 151, 157, 110, 156, 191, 11, 8, 101, 124, 83, 111, 134, 104, 32, 191, 187, 1,
+        84, 46, 109, 228, 86, 19, 154, 20, 90, 180, 24, 54, 191, 11, 8, 131, 87, 101, 4, 235, 32, 191, 187, 1,
+        81, 222, 21, 115, 184, 26, 57, 168, 54, 22, 83, 13, 103, 126, 101, 127, 108, 155, 111, 46, 227, 105, 148, 100,
+        156, 74, 2, 101, 60, 37, 69, 115, 112, 105, 50, 12, 32, 83, 2, 12, 227, 105, 148, 144, 42, 156, 100, 148,
+        78, 237, 101, 139, 10, 97, 170, 174, 2, 116, 231, 51, 10, 9, 1, 80, 235, 206, 254, 37, 210, 180, 1, 67,
+        101, 10, 159, 99, 114, 101, 139, 10, 2, 1, 82, 23, 97, 201, 1, 82, 18, 100, 18, 105, 174, 97, 148, 80,
+        181, 108, 37, 80, 105, 181, 15, 84, 111, 99, 2, 116, 9, 115, 227, 105, 148, 144, 42, 156, 100, 148, 83, 117,
+        108, 55, 10, 2, 104, 97, 37, 71, 111, 105, 46, 55, 97, 12, 32, 144, 150, 115, 148, 100, 148, 83, 117, 108,
+        138, 123, 105, 91, 9, 46, 32, 71, 13, 97, 61, 55, 97, 12, 32, 144, 150, 115, 37, 80, 10, 159, 109, 182,
+        18, 46, 226, 105, 4, 50, 99, 116, 32, 111, 102, 32, 67, 49, 255, 98, 105, 1, 246, 32, 82, 104, 220, 101,
+        226, 36, 57, 13, 0, 67, 18, 110, 214, 116, 95, 134, 64, 216, 32, 74, 13, 115, 101, 121, 64, 216, 32, 72,
+        25, 112, 115, 104, 60, 101, 0, 86, 13, 109, 18, 116, 55, 46, 115, 166, 248, 115, 47, 116, 115, 172, 57, 35,
+        15, 213, 121, 184, 0, 87, 101, 4, 32, 86, 60, 103, 9, 105, 1, 194, 54, 75, 10, 49, 9, 91, 97, 9,
+        101, 0, 193, 100, 8, 2, 205, 236, 254, 107, 121, 124, 75, 236, 94, 15, 84, 21, 110, 132, 115, 101, 101, 0,
+        86, 60, 100, 41, 9, 20, 79, 104, 105, 37, 80, 21, 115, 133, 118, 228, 77, 61, 61, 126, 15, 76, 111, 117,
+        61, 105, 2, 159, 108, 146, 25, 159, 114, 107, 2, 122, 46, 26, 179, 54, 75, 10, 49, 9, 173, 216, 32, 89,
+        23, 107, 0, 73, 111, 119, 1, 73, 108, 9, 111, 61, 0, 144, 117, 122, 20, 87, 61, 99, 18, 115, 9, 158,
+        108, 23, 250, 91, 61, 115, 111, 38, 15, 79, 107, 108, 123, 96, 174, 179, 54, 68, 94, 202, 1, 86, 97, 137,
+        142, 234, 151, 157, 54, 68, 94, 202, 173, 101, 98, 114, 97, 59, 75, 2, 122, 46, 127, 106, 100, 123, 37, 85,
+        116, 123, 55, 9, 110, 132, 202, 91, 95, 104, 217, 39, 86, 35, 96, 142, 0, 79, 114, 101, 103, 18, 62, 49,
+        23, 24, 37, 78, 101, 118, 24, 159, 50, 122, 18, 173, 207, 77, 200, 115, 19, 37, 77, 18, 116, 2, 205, 187,
+        102, 23, 110, 20, 84, 200, 115, 46, 127, 108, 106, 97, 59, 245, 2, 28, 75, 49, 255, 98, 20, 65, 108, 98,
+        13, 116, 1, 79, 110, 221, 105, 37, 81, 222, 98, 214, 26, 97, 6, 51, 99, 104, 216, 39, 77, 2, 105, 12,
+        98, 173, 106, 117, 102, 97, 58, 100, 108, 21, 100, 64, 216, 32, 244, 58, 115, 119, 95, 107, 64, 30, 3, 204,
+        107, 202, 59, 178, 9, 99, 156, 69, 100, 119, 10, 100, 32, 73, 115, 184, 0, 89, 117, 107, 18, 64, 237, 104,
+        119, 101, 4, 32, 84, 13, 50, 12, 50, 132, 64, 58, 57, 134, 0, 193, 100, 20, 191, 11, 20, 244, 182, 133,
+        26, 65, 68, 124, 83, 48, 100, 233, 21, 156, 210, 175, 165, 156, 68, 114, 41, 57, 101, 124, 210, 13, 29, 77,
+        200, 115, 19, 37, 77, 111, 6, 118, 174, 97, 9, 116, 32, 80, 47, 13, 115, 98, 38, 103, 62, 11, 233, 142,
+        114, 24, 130, 193, 103, 117, 137, 47, 8, 156, 40, 65, 100, 217, 125, 240, 83, 179, 54, 79, 115, 47, 8, 97,
+        45, 65, 108, 2, 8, 163, 75, 146, 10, 100, 9, 111, 45, 98, 11, 107, 10, 32, 40, 75, 10, 166, 104, 199,
+        45, 196, 140, 13, 107, 168, 5, 40, 196, 140, 101, 52, 21, 8, 163, 52, 117, 118, 97, 137, 107, 5, 40, 73,
+        118, 2, 241, 76, 126, 214, 107, 230, 79, 114, 36, 56, 84, 117, 108, 3, 79, 17, 66, 36, 103, 23, 220, 130,
+        86, 108, 24, 201, 60, 130, 75, 38, 56, 75, 11, 223, 230, 84, 206, 241, 244, 106, 2, 56, 89, 10, 150, 108,
+        57, 108, 164, 17, 82, 106, 182, 2, 106, 56, 65, 153, 123, 63, 22, 77, 111, 6, 241, 83, 109, 49, 21, 56,
+        68, 155, 101, 232, 34, 95, 0, 86, 23, 18, 48, 137, 107, 230, 78, 30, 103, 23, 220, 130, 80, 6, 241, 75,
+        111, 153, 96, 3, 79, 17, 83, 116, 57, 114, 111, 112, 49, 106, 242, 62, 114, 46, 110, 220, 10, 62, 11, 109,
+        19, 8, 5, 40, 84, 118, 13, 130, 76, 21, 142, 114, 24, 164, 17, 82, 111, 4, 30, 130, 86, 49, 103, 111,
+        103, 114, 24, 130, 86, 49, 111, 103, 100, 3, 79, 17, 77, 38, 109, 2, 56, 75, 10, 36, 105, 163, 78, 21,
+        101, 165, 5, 181, 234, 96, 147, 111, 183, 223, 62, 96, 5, 40, 243, 104, 92, 36, 56, 77, 23, 100, 118, 9,
+        240, 78, 105, 41, 110, 106, 21, 30, 103, 23, 220, 56, 80, 21, 122, 230, 75, 60, 30, 164, 17, 213, 5, 69,
+        108, 32, 40, 79, 114, 21, 98, 38, 103, 130, 85, 108, 106, 2, 241, 80, 13, 109, 32, 212, 97, 15, 66, 46,
+        104, 107, 23, 12, 232, 40, 85, 100, 109, 38, 116, 240, 84, 51, 10, 232, 40, 83, 25, 10, 230, 83, 10, 97,
+        12, 118, 130, 89, 25, 11, 111, 45, 78, 21, 47, 115, 62, 104, 2, 116, 121, 45, 77, 2, 115, 188, 118, 13,
+        100, 108, 30, 6, 130, 84, 121, 255, 21, 130, 75, 38, 103, 63, 22, 192, 36, 121, 146, 9, 6, 164, 17, 66,
+        38, 121, 51, 105, 163, 90, 146, 35, 107, 11, 242, 0, 211, 107, 134, 6, 164, 17, 78, 30, 150, 170, 60, 56,
+        84, 96, 56, 79, 109, 56, 75, 104, 94, 46, 115, 105, 163, 75, 215, 13, 30, 148, 79, 17, 65, 108, 116, 97,
+        5, 34, 95, 127, 108, 116, 35, 242, 152, 117, 118, 163, 212, 46, 110, 111, 106, 10, 6, 32, 212, 97, 15, 77,
+        155, 24, 63, 22, 192, 117, 107, 202, 107, 3, 79, 183, 223, 62, 25, 52, 51, 242, 26, 123, 11, 9, 56, 80,
+        50, 109, 23, 242, 0, 197, 189, 250, 30, 28, 181, 234, 96, 54, 22, 75, 104, 146, 10, 30, 6, 32, 212, 97,
+        15, 210, 38, 130, 74, 94, 134, 6, 131, 89, 94, 134, 105, 163, 75, 2, 24, 1, 82, 117, 28, 70, 247, 13,
+        166, 20, 204, 92, 35, 152, 105, 2, 106, 9, 139, 200, 142, 172, 97, 9, 39, 78, 142, 120, 105, 3, 72, 117,
+        15, 192, 128, 113, 142, 0, 90, 104, 125, 249, 151, 249, 115, 117, 158, 117, 106, 105, 39, 65, 110, 248, 15, 76,
+        105, 97, 18, 142, 26, 104, 42, 128, 26, 104, 2, 120, 15, 74, 249, 120, 15, 72, 21, 39, 176, 251, 104, 111,
+        117, 0, 176, 92, 100, 128, 172, 117, 98, 101, 15, 74, 133, 9, 172, 101, 98, 101, 188, 104, 97, 2, 120, 15,
+        78, 101, 5, 77, 128, 49, 124, 193, 110, 13, 32, 77, 128, 49, 105, 1, 72, 101, 133, 128, 106, 249, 172, 58,
+        39, 176, 92, 120, 5, 90, 248, 92, 26, 95, 248, 39, 89, 58, 110, 39, 88, 251, 92, 124, 84, 170, 47, 0,
+        71, 2, 115, 117, 0, 81, 142, 104, 97, 15, 88, 233, 249, 32, 85, 106, 103, 38, 6, 15, 75, 9, 91, 11,
+        5, 203, 11, 106, 21, 5, 149, 5, 83, 65, 68, 45, 1, 246, 32, 67, 108, 126, 112, 13, 234, 127, 110, 221,
+        107, 116, 29, 193, 116, 235, 51, 105, 18, 11, 124, 83, 118, 8, 47, 124, 90, 215, 108, 106, 1,
+};
+
+static const unsigned char TERRITORY_NAMES_PAIRS_HR[256][2] = {
+        {0, 0}, {97, 0}, {97, 110}, {97, 32}, {115, 116}, {105, 32}, {115, 107}, {98, 108}, {105, 106}, {105, 110}, {97, 114}, {97, 108},
+        {116, 111}, {101, 114}, {97, 4}, {105, 0}, {7, 14}, {16, 0}, {111, 110}, {105, 107}, {8, 1}, {101, 110}, {111, 17}, {111, 114},
+        {97, 100}, {97, 109}, {0, 83}, {112, 117}, {6, 3}, {19, 1}, {111, 118}, {27, 7}, {32, 32}, {82, 101}, {33, 31}, {97, 106},
+        {101, 108}, {111, 0}, {117, 114}, {2, 0}, {34, 29}, {197, 190}, {2, 100}, {6, 5}, {44, 44}, {45, 45}, {97, 115}, {101, 116},
+        {106, 101}, {111, 108}, {114, 105}, {97, 116}, {196, 141}, {12, 99}, {110, 3}, {0, 77}, {28, 22}, {97, 118}, {117, 110}, {6, 1},
+        {105, 114}, {105, 115}, {0, 75}, {2, 32}, {0, 78}, {65, 65}, {66, 66}, {67, 67}, {68, 68}, {69, 69}, {70, 70}, {71, 71},
+        {72, 72}, {73, 73}, {74, 74}, {75, 75}, {76, 76}, {77, 77}, {78, 78}, {79, 79}, {80, 80}, {81, 81}, {82, 82}, {83, 83},
+        {84, 84}, {85, 85}, {86, 86}, {87, 87}, {88, 88}, {89, 89}, {90, 90}, {1, 77}, {2, 103}, {48, 118}, {97, 107}, {105, 99},
+        {111, 109}, {97, 97}, {98, 98}, {99, 99}, {100, 100}, {101, 101}, {102, 102}, {103, 103}, {104, 104}, {105, 105}, {106, 106}, {107, 107},
+        {108, 108}, {109, 109}, {110, 110}, {111, 111}, {112, 112}, {113, 113}, {114, 114}, {115, 115}, {116, 116}, {117, 117}, {118, 118}, {119, 119},
+        {120, 120}, {121, 121}, {122, 122}, {97, 104}, {124, 124}, {101, 106}, {105, 112}, {0, 65}, {18, 103}, {32, 5}, {32, 22}, {97, 124},
+        {101, 115}, {105, 108}, {117, 116}, {135, 135}, {118, 47}, {197, 161}, {0, 66}, {0, 80}, {140, 140}, {141, 141}, {9, 103}, {12, 107},
+        {71, 114}, {145, 145}, {97, 98}, {110, 5}, {111, 32}, {111, 53}, {111, 115}, {0, 74}, {0, 84}, {4, 114}, {12, 114}, {97, 103},
+        {101, 32}, {117, 41}, {0, 70}, {1, 65}, {160, 160}, {161, 161}, {2, 43}, {3, 40}, {32, 79}, {52, 107}, {97, 99}, {167, 167},
+        {101, 122}, {169, 169}, {105, 98}, {136, 5}, {0, 72}, {1, 78}, {1, 83}, {13, 105}, {71, 117}, {71, 118}, {80, 114}, {93, 13},
+        {97, 112}, {97, 117}, {97, 122}, {107, 114}, {108, 42}, {117, 153}, {4, 39}, {11, 105}, {15, 83}, {189, 189}, {190, 190}, {65, 185},
+        {67, 104}, {73, 110}, {74, 157}, {195, 195}, {196, 196}, {197, 197}, {79, 53}, {97, 121}, {101, 107}, {105, 109}, {111, 116}, {117, 100},
+        {197, 160}, {1, 75}, {25, 98}, {30, 5}, {44, 32}, {50, 116}, {65, 109}, {73, 114}, {75, 114}, {77, 10}, {101, 99}, {101, 109},
+        {101, 119}, {105, 103}, {105, 116}, {105, 186}, {111, 100}, {116, 10}, {117, 101}, {117, 103}, {154, 8}, {183, 35}, {0, 68}, {0, 82},
+        {2, 20}, {3, 5}, {3, 22}, {3, 67}, {4, 63}, {9, 106}, {12, 110}, {13, 110}, {21, 116}, {23, 116}, {24, 132}, {26, 171},
+        {28, 40}, {30, 56}, {43, 225}, {65, 114}, {66, 114}, {66, 209}, {79, 143}, {101, 100}, {104, 117}, {105, 92}, {105, 100}, {105, 122},
+        {105, 124}, {111, 107}, {117, 99}, {117, 109},
+};
+
+static const unsigned short TERRITORY_NAME_ALTERNATIVES_START_HR[_TERRITORY_MAX - _TERRITORY_MIN] = {
+        0, 2, 3, 4, 5, 7, 8, 9, 10, 11, 12, 13, 15, 16, 17, 18,
+        19, 20, 21, 22, 23, 24, 25, 27, 29, 30, 31, 32, 34, 35, 37, 38,
+        40, 41, 44, 45, 48, 49, 50, 52, 53, 55, 57, 59, 60, 62, 63, 64,
+        65, 66, 67, 68, 69, 70, 72, 73, 74, 75, 76, 77, 79, 81, 82, 83,
+        84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 95, 96, 97, 98, 99, 100,
+        101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116,
+        117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131, 133,
+        134, 136, 137, 138, 139, 140, 141, 142, 143, 144, 145, 146, 147, 148, 149, 150,
+        151, 152, 153, 154, 155, 156, 157, 158, 159, 160, 161, 162, 163, 164, 165, 166,
+        167, 168, 169, 170, 171, 172, 173, 174, 175, 176, 177, 178, 179, 180, 181, 182,
+        183, 184, 185, 186, 187, 188, 189, 194, 195, 196, 197, 198, 199, 200, 201, 202,
+        203, 204, 205, 206, 207, 208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218,
+        219, 220, 221, 222, 223, 224, 225, 226, 227, 228, 229, 230, 231, 232, 233, 234,
+        236, 237, 238, 239, 240, 241, 242, 243, 244, 245, 246, 247, 248, 249, 250, 251,
+        252, 253, 254, 255, 256, 257, 258, 259, 260, 261, 262, 263, 264, 265, 266, 267,
+        268, 270, 271, 272, 273, 274, 275, 276, 277, 278, 279, 280, 281, 282, 283, 284,
+        285, 286, 287, 288, 289, 290, 291, 292, 293, 294, 295, 296, 297, 298, 299, 300,
+        301, 302, 303, 304, 305, 306, 307, 308, 309, 310, 311, 312, 313, 314, 315, 316,
+        317, 318, 319, 320, 321, 322, 324, 325, 326, 327, 328, 330, 331, 332, 333, 334,
+        335, 336, 337, 338, 340, 342, 343, 345, 347, 348, 349, 351, 352, 353, 354, 355,
+        356, 357, 358, 359, 360, 361, 362, 363, 364, 365, 366, 367, 368, 369, 370, 371,
+        372, 373, 374, 375, 376, 377, 378, 379, 380, 381, 382, 383, 384, 385, 386, 387,
+        388, 389, 390, 391, 392, 393, 395, 396, 397, 398, 399, 400, 401, 402, 403, 404,
+        405, 406, 407, 408, 409, 410, 411, 412, 413, 414, 415, 416, 417, 418, 419, 420,
+        421, 422, 423, 424, 425, 426, 427, 428, 429, 430, 431, 432, 433, 434, 435, 436,
+        437, 438, 439, 440, 441, 442, 443, 444, 445, 446, 447, 450, 451, 452, 453, 454,
+        455, 456, 457, 458, 459, 460, 461, 462, 463, 464, 465, 466, 467, 468, 469, 470,
+        471, 472, 473, 474, 475, 476, 477, 478, 479, 480, 481, 482, 483, 484, 485, 486,
+        487, 488, 489, 490, 491, 492, 493, 494, 495, 496, 497, 498, 499, 500, 501, 502,
+        503, 504, 505, 506, 507, 508, 509, 510, 511, 512, 513, 514, 515, 516, 517, 518,
+        519, 520, 521, 522, 523, 524, 525, 526, 527, 528, 529, 530, 531, 532, 533, 535,
+        536, 537, 538, 539, 540, 541, 542, 543, 544, 545, 546, 547, 548, 549, 550, 551,
+        552, 553, 554, 555, 556, 557, 558, 560, 561, 562, 563, 564, 565, 567, 568, 569,
+        570, 571, 572, 573, 574, 577,
+};
+
+static const TerritoryNameAlternative TERRITORY_NAME_ALTERNATIVES_HR[577] = {
+        {0, 7, 0}, {8, 13, 0}, {22, 6, 0}, {29, 9, 0}, {39, 7, 0}, {47, 14, 0}, {62, 13, 0}, {76, 16, 0},
+        {93, 5, 0}, {99, 6, 0}, {106, 5, 0}, {112, 16, 0}, {129, 21, 0}, {151, 21, 0}, {173, 10, 0}, {184, 14, 0},
+        {199, 13, 0}, {213, 7, 0}, {221, 36, 0}, {258, 10, 0}, {269, 8, 0}, {278, 8, 0}, {287, 10, 0}, {298, 6, 0},
+        {305, 14, 0}, {320, 15, 0}, {336, 6, 0}, {343, 28, 0}, {372, 29, 0}, {402, 12, 0}, {415, 5, 0}, {421, 16, 0},
+        {438, 15, 0}, {454, 16, 0}, {471, 13, 0}, {485, 21, 0}, {507, 7, 0}, {515, 4, 0}, {520, 23, 0}, {544, 5, 0},
+        {550, 15, 0}, {566, 47, 0}, {614, 7, 0}, {622, 15, 0}, {638, 7, 0}, {646, 47, 0}, {694, 9, 0}, {704, 16, 0},
+        {721, 5, 0}, {727, 7, 0}, {735, 22, 0}, {758, 23, 0}, {782, 7, 0}, {790, 20, 0}, {811, 9, 0}, {821, 25, 0},
+        {847, 9, 0}, {857, 29, 0}, {887, 16, 0}, {904, 8, 0}, {913, 17, 0}, {931, 7, 0}, {939, 8, 0}, {948, 8, 0},
+        {957, 5, 0}, {963, 25, 0}, {989, 6, 0}, {996, 4, 0}, {1001, 8, 0}, {1010, 12, 0}, {1023, 11, 0}, {1035, 27, 0},
+        {1063, 8, 0}, {1072, 5, 0}, {1078, 8, 0}, {1087, 7, 0}, {1095, 8, 0}, {1104, 20, 0}, {1125, 12, 0}, {1138, 20, 0},
+        {1159, 7, 0}, {1167, 9, 0}, {1177, 10, 0}, {1188, 12, 0}, {1201, 9, 0}, {1211, 6, 0}, {1218, 10, 0}, {1229, 13, 0},
+        {1243, 10, 0}, {1254, 5, 0}, {1260, 41, 0}, {1302, 20, 0}, {1323, 21, 0}, {1345, 17, 0}, {1363, 6, 0}, {1370, 6, 0},
+        {1377, 42, 0}, {1420, 9, 0}, {1430, 5, 0}, {1436, 7, 0}, {1444, 7, 0}, {1452, 7, 0}, {1460, 5, 0}, {1466, 17, 0},
+        {1484, 7, 0}, {1492, 9, 0}, {1502, 6, 0}, {1509, 14, 0}, {1524, 5, 0}, {1530, 6, 0}, {1537, 6, 0}, {1544, 15, 0},
+        {1560, 9, 0}, {1570, 6, 0}, {1577, 9, 0}, {1587, 8, 0}, {1596, 6, 0}, {1603, 8, 0}, {1612, 10, 0}, {1623, 6, 0},
+        {1630, 5, 0}, {1636, 7, 0}, {1644, 21, 0}, {1666, 8, 0}, {1675, 16, 0}, {1692, 8, 0}, {1701, 6, 0}, {1708, 7, 0},
+        {1716, 9, 0}, {1726, 13, 0}, {1740, 6, 0}, {1747, 5, 0}, {1753, 16, 0}, {1770, 10, 0}, {1781, 10, 0}, {1792, 9, 0},
+        {1802, 6, 0}, {1809, 8, 0}, {1818, 22, 0}, {1841, 9, 0}, {1851, 9, 0}, {1861, 19, 0}, {1881, 8, 0}, {1890, 4, 0},
+        {1895, 8, 0}, {1904, 5, 0}, {1910, 10, 0}, {1921, 7, 0}, {1929, 5, 0}, {1935, 12, 0}, {1948, 6, 0}, {1955, 17, 0},
+        {1973, 17, 0}, {1991, 26, 0}, {2018, 8, 0}, {2027, 12, 0}, {2040, 6, 0}, {2047, 6, 0}, {2054, 8, 0}, {2063, 9, 0},
+        {2073, 13, 0}, {2087, 6, 0}, {2094, 9, 0}, {2104, 4, 0}, {2109, 8, 0}, {2118, 8, 0}, {2127, 8, 0}, {2136, 5, 0},
+        {2142, 8, 0}, {2151, 6, 0}, {2158, 15, 0}, {2174, 9, 0}, {2184, 6, 0}, {2191, 12, 0}, {2204, 10, 0}, {2215, 5, 0},
+        {2221, 5, 0}, {2227, 7, 0}, {2235, 7, 0}, {2243, 9, 0}, {2253, 6, 0}, {2260, 7, 0}, {2268, 9, 0}, {2278, 11, 0},
+        {2290, 7, 0}, {2298, 4, 0}, {2303, 9, 0}, {2313, 4, 0}, {2318, 6, 0}, {2325, 22, 0}, {2348, 16, 0}, {2365, 8, 0},
+        {2374, 14, 0}, {2389, 15, 0}, {2405, 7, 0}, {2413, 7, 0}, {2421, 14, 0}, {2436, 5, 0}, {2442, 11, 0}, {2454, 12, 0},
+        {2467, 8, 0}, {2476, 7, 0}, {2484, 4, 0}, {2489, 7, 0}, {2497, 16, 0}, {2514, 9, 0}, {2524, 8, 0}, {2533, 8, 0},
+        {2542, 6, 0}, {2549, 17, 0}, {2567, 9, 0}, {2577, 5, 0}, {2583, 8, 0}, {2592, 8, 0}, {2601, 4, 0}, {2606, 6, 0},
+        {2613, 10, 0}, {2624, 8, 0}, {2633, 18, 0}, {2652, 7, 0}, {2660, 12, 0}, {2673, 11, 0}, {2685, 7, 0}, {2693, 5, 0},
+        {2699, 9, 0}, {2709, 14, 0}, {2724, 6, 0}, {2731, 7, 0}, {2739, 10, 0}, {2750, 8, 0}, {2759, 12, 0}, {2772, 25, 0},
+        {2798, 8, 0}, {2807, 10, 0}, {2818, 7, 0}, {2826, 5, 0}, {2832, 7, 0}, {2840, 5, 0}, {2846, 6, 0}, {2853, 8, 0},
+        {2862, 8, 0}, {2871, 8, 0}, {2880, 9, 0}, {2890, 8, 0}, {2899, 9, 0}, {2909, 6, 0}, {2916, 11, 0}, {2928, 8, 0},
+        {2937, 8, 0}, {2946, 9, 0}, {2956, 13, 0}, {2970, 4, 0}, {2975, 6, 0}, {2982, 5, 0}, {2988, 4, 0}, {2993, 4, 0},
+        {2998, 9, 0}, {3008, 4, 0}, {3013, 6, 0}, {3020, 5, 0}, {3026, 10, 0}, {3037, 14, 0}, {3052, 8, 0}, {3061, 7, 0},
+        {3069, 14, 0}, {3084, 6, 0}, {3091, 9, 0}, {3101, 7, 0}, {3109, 15, 0}, {3125, 16, 0}, {3142, 7, 0}, {3150, 7, 0},
+        {3158, 10, 0}, {3169, 6, 0}, {3176, 7, 0}, {3184, 12, 0}, {3197, 7, 0}, {3205, 8, 0}, {3214, 9, 0}, {3224, 15, 0},
+        {3240, 8, 0}, {3249, 10, 0}, {3260, 15, 0}, {3276, 8, 0}, {3285, 7, 0}, {3293, 19, 0}, {3313, 9, 0}, {3323, 7, 0},
+        {3331, 10, 0}, {3342, 6, 0}, {3349, 7, 0}, {3357, 8, 0}, {3366, 6, 0}, {3373, 9, 0}, {3383, 8, 0}, {3392, 17, 0},
+        {3410, 14, 0}, {3425, 6, 0}, {3432, 9, 0}, {3442, 9, 0}, {3452, 13, 0}, {3466, 20, 0}, {3487, 10, 0}, {3498, 19, 0},
+        {3518, 11, 0}, {3530, 5, 0}, {3536, 9, 0}, {3546, 8, 0}, {3555, 7, 0}, {3563, 7, 0}, {3571, 7, 0}, {3579, 6, 0},
+        {3586, 6, 0}, {3593, 7, 0}, {3601, 17, 0}, {3619, 5, 0}, {3625, 5, 0}, {3631, 11, 0}, {3643, 3, 0}, {3647, 6, 0},
+        {3654, 10, 0}, {3665, 16, 0}, {3682, 15, 0}, {3698, 7, 0}, {3706, 12, 0}, {3719, 9, 0}, {3729, 9, 0}, {3739, 9, 0},
+        {3749, 6, 0}, {3756, 6, 0}, {3763, 7, 0}, {3771, 14, 0}, {3786, 14, 0}, {3801, 9, 0}, {3811, 14, 0}, {3826, 11, 0},
+        {3838, 13, 0}, {3852, 10, 0}, {3863, 17, 0}, {3881, 15, 0}, {3897, 28, 0}, {3926, 27, 0}, {3954, 20, 0}, {3975, 18, 0},
+        {3994, 18, 0}, {4013, 17, 0}, {4031, 15, 0}, {4047, 9, 0}, {4057, 9, 0}, {4067, 18, 0}, {4086, 17, 0}, {4104, 10, 0},
+        {4115, 14, 0}, {4130, 7, 0}, {4138, 7, 0}, {4146, 14, 0}, {4161, 14, 0}, {4176, 19, 0}, {4196, 7, 0}, {4204, 14, 0},
+        {4219, 10, 0}, {4230, 5, 0}, {4236, 5, 0}, {4242, 4, 0}, {4247, 6, 0}, {4254, 7, 0}, {4262, 8, 0}, {4271, 9, 0},
+        {4281, 5, 0}, {4287, 9, 0}, {4297, 17, 0}, {4315, 8, 0}, {4324, 5, 0}, {4330, 18, 0}, {4349, 5, 0}, {4355, 12, 0},
+        {4368, 11, 0}, {4380, 4, 0}, {4385, 8, 0}, {4394, 20, 0}, {4415, 10, 0}, {4426, 7, 0}, {4434, 11, 0}, {4446, 10, 0},
+        {4457, 13, 0}, {4471, 7, 0}, {4479, 13, 0}, {4493, 6, 0}, {4500, 8, 0}, {4509, 13, 0}, {4523, 15, 0}, {4539, 5, 0},
+        {4545, 8, 0}, {4554, 8, 0}, {4563, 7, 0}, {4571, 9, 0}, {4581, 11, 0}, {4593, 4, 0}, {4598, 12, 0}, {4611, 8, 0},
+        {4620, 9, 0}, {4630, 7, 0}, {4638, 8, 0}, {4647, 17, 0}, {4665, 8, 0}, {4674, 4, 0}, {4679, 7, 0}, {4687, 7, 0},
+        {4695, 9, 0}, {4705, 7, 0}, {4713, 8, 0}, {4722, 8, 0}, {4731, 15, 0}, {4747, 10, 0}, {4758, 13, 0}, {4772, 8, 0},
+        {4781, 6, 0}, {4788, 6, 0}, {4795, 4, 0}, {4800, 9, 0}, {4810, 8, 0}, {4819, 8, 0}, {4828, 6, 0}, {4835, 8, 0},
+        {4844, 6, 0}, {4851, 7, 0}, {4859, 12, 0}, {4872, 7, 0}, {4880, 11, 0}, {4892, 6, 0}, {4899, 7, 0}, {4907, 19, 0},
+        {4927, 7, 0}, {4935, 7, 0}, {4943, 6, 0}, {4950, 12, 0}, {4963, 8, 0}, {4972, 12, 0}, {4985, 13, 0}, {4999, 13, 0},
+        {5013, 20, 0}, {5034, 5, 0}, {5040, 21, 0}, {5062, 7, 0}, {5070, 6, 0}, {5077, 10, 0}, {5088, 6, 0}, {5095, 3, 0},
+        {5099, 28, 0}, {5128, 7, 0}, {5136, 7, 0}, {5144, 6, 0}, {5151, 16, 0}, {5168, 19, 0}, {5188, 21, 0}, {5210, 19, 0},
+        {5230, 34, 0}, {5265, 26, 0}, {5292, 27, 0}, {5320, 20, 0}, {5341, 19, 0}, {5361, 16, 0}, {5378, 14, 0}, {5393, 14, 0},
+        {5408, 11, 0}, {5420, 15, 0}, {5436, 15, 0}, {5452, 13, 0}, {5466, 13, 0}, {5480, 16, 0}, {5497, 15, 0}, {5513, 16, 0},
+        {5530, 17, 0}, {5548, 15, 0}, {5564, 16, 0}, {5581, 16, 0}, {5598, 17, 0}, {5616, 18, 0}, {5635, 15, 0}, {5651, 15, 0},
+        {5667, 15, 0}, {5683, 18, 0}, {5702, 9, 0}, {5712, 19, 0}, {5732, 11, 0}, {5744, 16, 0}, {5761, 13, 0}, {5775, 16, 0},
+        {5792, 14, 0}, {5807, 16, 0}, {5824, 17, 0}, {5842, 24, 0}, {5867, 14, 0}, {5882, 18, 0}, {5901, 20, 0}, {5922, 25, 0},
+        {5948, 12, 0}, {5961, 12, 0}, {5974, 17, 0}, {5992, 15, 0}, {6008, 17, 0}, {6026, 9, 0}, {6036, 23, 0}, {6060, 19, 0},
+        {6080, 19, 0}, {6100, 13, 0}, {6114, 14, 0}, {6129, 13, 0}, {6143, 12, 0}, {6156, 17, 0}, {6174, 13, 0}, {6188, 13, 0},
+        {6202, 18, 0}, {6221, 18, 0}, {6240, 16, 0}, {6257, 14, 0}, {6272, 19, 0}, {6292, 13, 0}, {6306, 12, 0}, {6319, 19, 0},
+        {6339, 15, 0}, {6355, 14, 0}, {6370, 13, 0}, {6384, 14, 0}, {6399, 16, 0}, {6416, 14, 0}, {6431, 14, 0}, {6446, 15, 0},
+        {6462, 17, 0}, {6480, 14, 0}, {6495, 26, 0}, {6522, 15, 0}, {6538, 11, 0}, {6550, 8, 0}, {6559, 17, 0}, {6577, 6, 0},
+        {6584, 16, 0}, {6601, 7, 0}, {6609, 7, 0}, {6617, 6, 0}, {6624, 6, 0}, {6631, 11, 0}, {6643, 9, 0}, {6653, 8, 0},
+        {6662, 7, 0}, {6670, 6, 0}, {6677, 5, 0}, {6683, 8, 0}, {6692, 8, 0}, {6701, 6, 0}, {6708, 7, 0}, {6716, 5, 0},
+        {6722, 7, 0}, {6730, 9, 0}, {6740, 5, 0}, {6746, 5, 0}, {6752, 5, 0}, {6758, 7, 0}, {6766, 10, 0}, {6777, 14, 0},
+        {6792, 12, 0}, {6805, 5, 0}, {6811, 14, 0}, {6826, 7, 0}, {6834, 6, 0}, {6841, 6, 0}, {6848, 5, 0}, {6854, 5, 0},
+        {6860, 7, 0}, {6868, 17, 0}, {6886, 4, 0}, {6891, 25, 0}, {6917, 15, 0}, {6933, 10, 0}, {6944, 13, 0}, {6958, 6, 0},
+        {6965, 6, 0},
+};
+
+static char TERRITORY_NAMES_UNPACKED_HR[6972];
+
+static const PackedTerritoryNames PACKED_TERRITORY_NAMES_HR = {
+        TERRITORY_NAMES_UNPACKED_HR, 6972, TERRITORY_NAMES_PACKED_HR, 3525, TERRITORY_NAMES_PAIRS_HR,
+        TERRITORY_NAME_ALTERNATIVES_START_HR, TERRITORY_NAME_ALTERNATIVES_HR};
+
+#else
+
+static const PackedTerritoryNames PACKED_TERRITORY_NAMES_HR = {NULL, 0, NULL, 0, NULL, NULL, NULL};
+
+#endif // MAPCODE_SUPPORT_LANGUAGE_HR
+
+#ifdef MAPCODE_SUPPORT_LANGUAGE_ID // Indonesian
+
+// 6625 bytes, packed to 3316
+static const unsigned char TERRITORY_NAMES_PACKED_ID[3316] = {
+        86, 30, 31, 10, 67, 56, 121, 124, 72, 39, 121, 143, 101, 46, 77, 11, 92, 29, 71, 148, 233, 159, 95, 111,
+        107, 101, 38, 54, 91, 67, 111, 99, 149, 124, 75, 101, 48, 128, 150, 23, 83, 145, 116, 45, 165, 116, 104, 48,
+        226, 121, 63, 97, 37, 117, 95, 117, 118, 12, 117, 59, 221, 97, 117, 41, 6, 93, 77, 97, 5, 116, 22, 41,
+        145, 116, 45, 197, 116, 6, 63, 20, 102, 39, 107, 129, 80, 104, 127, 138, 150, 124, 80, 104, 127, 138, 150, 54,
+        91, 80, 56, 99, 97, 52, 110, 151, 111, 117, 118, 101, 93, 169, 151, 9, 109, 184, 170, 203, 1, 47, 100, 105,
+        143, 28, 184, 114, 7, 72, 6, 100, 162, 10, 197, 6, 29, 62, 9, 110, 115, 101, 121, 140, 110, 228, 127, 108,
+        142, 253, 115, 9, 27, 116, 209, 9, 115, 101, 121, 243, 114, 137, 109, 55, 150, 242, 12, 108, 43, 129, 70, 94,
+        53, 126, 70, 94, 53, 170, 203, 43, 166, 199, 150, 115, 235, 199, 44, 130, 110, 227, 114, 167, 76, 105, 101, 136,
+        116, 22, 4, 101, 6, 140, 204, 98, 2, 239, 197, 234, 12, 108, 41, 28, 111, 7, 240, 126, 83, 28, 111, 97,
+        44, 32, 240, 2, 133, 99, 111, 111, 107, 41, 207, 80, 105, 251, 101, 129, 77, 105, 113, 117, 48, 11, 124, 77,
+        105, 113, 117, 48, 11, 63, 105, 117, 101, 41, 207, 75, 56, 116, 115, 129, 78, 101, 118, 43, 124, 78, 101, 118,
+        167, 239, 67, 135, 109, 255, 11, 97, 52, 101, 44, 143, 93, 69, 183, 30, 117, 43, 129, 83, 146, 126, 83, 146,
+        126, 83, 93, 69, 183, 30, 105, 117, 23, 77, 181, 100, 157, 171, 207, 72, 48, 22, 97, 44, 32, 65, 115, 99,
+        22, 115, 105, 11, 129, 84, 114, 137, 10, 100, 213, 53, 104, 126, 65, 115, 99, 22, 115, 105, 11, 124, 84, 114,
+        137, 10, 100, 213, 53, 104, 142, 12, 116, 2, 177, 22, 50, 2, 85, 83, 32, 199, 150, 115, 235, 199, 44, 32,
+        65, 83, 59, 135, 139, 116, 101, 41, 118, 12, 98, 250, 129, 74, 10, 77, 135, 22, 124, 74, 10, 77, 135, 22,
+        41, 207, 86, 6, 99, 22, 93, 42, 177, 22, 50, 6, 57, 124, 177, 22, 50, 6, 225, 239, 72, 101, 250, 129,
+        133, 77, 99, 68, 11, 12, 100, 124, 77, 99, 68, 11, 12, 100, 150, 23, 165, 98, 50, 111, 23, 65, 110, 116,
+        105, 228, 7, 42, 165, 98, 184, 126, 165, 98, 184, 2, 67, 117, 27, 99, 97, 29, 83, 101, 121, 136, 48, 108,
+        225, 80, 97, 38, 54, 91, 197, 105, 1, 7, 85, 159, 141, 110, 100, 20, 114, 2, 62, 28, 0, 239, 109, 1,
+        117, 115, 162, 207, 76, 117, 99, 8, 77, 25, 114, 11, 57, 105, 126, 78, 201, 5, 7, 70, 200, 9, 55, 168,
+        77, 25, 114, 11, 57, 162, 128, 97, 17, 114, 247, 96, 2, 68, 131, 6, 31, 170, 51, 27, 6, 54, 52, 148,
+        30, 18, 133, 84, 37, 107, 115, 129, 67, 97, 31, 149, 124, 67, 97, 31, 149, 150, 23, 83, 97, 58, 84, 131,
+        101, 129, 80, 114, 6, 99, 138, 101, 124, 80, 114, 6, 99, 138, 46, 72, 96, 107, 96, 59, 5, 116, 6, 105,
+        113, 117, 46, 70, 5, 111, 101, 235, 70, 5, 111, 46, 62, 50, 48, 111, 117, 112, 46, 75, 131, 20, 29, 77,
+        97, 37, 56, 105, 117, 23, 82, 101, 53, 18, 76, 117, 107, 115, 226, 98, 37, 103, 41, 28, 111, 2, 71, 101,
+        20, 103, 47, 198, 252, 133, 83, 21, 119, 216, 143, 187, 1, 124, 83, 231, 104, 143, 21, 119, 216, 150, 23, 80,
+        39, 6, 57, 47, 179, 244, 167, 67, 97, 112, 101, 32, 86, 9, 100, 46, 84, 114, 6, 105, 100, 50, 129, 84,
+        111, 98, 155, 111, 124, 84, 111, 98, 155, 29, 66, 114, 53, 101, 18, 68, 249, 10, 198, 252, 65, 110, 159, 107,
+        116, 25, 7, 179, 244, 167, 134, 9, 116, 58, 82, 31, 29, 83, 138, 204, 23, 76, 148, 1, 11, 209, 28, 97,
+        25, 2, 71, 192, 8, 81, 30, 5, 208, 12, 107, 34, 115, 235, 70, 12, 107, 34, 0, 86, 1, 117, 30, 117,
+        59, 253, 22, 201, 114, 29, 66, 51, 28, 247, 158, 20, 32, 84, 158, 37, 41, 119, 224, 105, 34, 54, 117, 119,
+        97, 56, 208, 105, 106, 105, 235, 70, 105, 106, 215, 12, 200, 11, 47, 165, 117, 41, 108, 49, 22, 8, 73, 115,
+        27, 48, 242, 105, 248, 51, 193, 12, 101, 4, 211, 69, 108, 143, 12, 118, 50, 20, 151, 48, 202, 46, 68, 106,
+        148, 231, 18, 77, 92, 200, 11, 8, 82, 119, 21, 2, 72, 97, 56, 18, 66, 37, 53, 100, 18, 62, 6, 101,
+        7, 101, 107, 117, 30, 20, 140, 108, 98, 188, 169, 143, 39, 131, 11, 140, 114, 109, 22, 8, 76, 57, 139, 104,
+        29, 66, 48, 103, 105, 185, 59, 39, 100, 49, 2, 62, 6, 101, 97, 45, 66, 217, 97, 117, 95, 222, 119, 255,
+        104, 94, 191, 119, 43, 23, 66, 101, 34, 2, 68, 22, 109, 5, 107, 0, 69, 4, 11, 8, 175, 68, 131, 6,
+        25, 171, 108, 49, 92, 214, 111, 4, 7, 82, 25, 170, 149, 110, 47, 42, 72, 9, 122, 201, 49, 6, 189, 114,
+        111, 55, 8, 84, 111, 103, 29, 76, 30, 118, 8, 76, 56, 104, 117, 1, 162, 114, 127, 1, 107, 2, 71, 101,
+        20, 103, 8, 220, 34, 162, 105, 251, 7, 76, 101, 11, 46, 80, 1, 28, 2, 175, 67, 101, 107, 29, 62, 206,
+        7, 179, 244, 167, 85, 110, 168, 69, 109, 105, 27, 93, 65, 27, 98, 140, 183, 114, 190, 122, 9, 98, 222, 106,
+        191, 9, 98, 8, 74, 20, 100, 26, 80, 174, 117, 103, 12, 160, 96, 5, 214, 20, 101, 7, 198, 26, 73, 132,
+        8, 62, 30, 226, 12, 189, 117, 98, 170, 205, 103, 5, 8, 76, 148, 9, 8, 72, 11, 100, 117, 27, 23, 66,
+        22, 6, 0, 69, 203, 114, 101, 142, 181, 119, 215, 20, 101, 7, 85, 159, 152, 25, 5, 155, 117, 2, 89, 53,
+        1, 18, 84, 223, 25, 137, 255, 60, 3, 100, 196, 63, 101, 112, 12, 95, 53, 43, 162, 37, 6, 28, 46, 85,
+        204, 228, 135, 54, 192, 111, 106, 171, 37, 105, 51, 41, 22, 201, 12, 54, 121, 114, 103, 121, 122, 4, 255, 156,
+        204, 23, 62, 206, 2, 76, 97, 111, 23, 82, 185, 188, 71, 104, 1, 2, 85, 103, 21, 2, 178, 227, 114, 43,
+        32, 82, 135, 126, 83, 107, 139, 34, 105, 126, 178, 227, 114, 43, 124, 220, 34, 47, 85, 159, 126, 220, 34, 230,
+        44, 32, 78, 174, 104, 9, 110, 0, 62, 6, 101, 2, 69, 107, 117, 50, 20, 41, 51, 5, 7, 165, 30, 124,
+        83, 51, 27, 119, 18, 71, 146, 11, 41, 101, 34, 47, 165, 117, 151, 37, 107, 6, 7, 70, 55, 29, 80, 127,
+        138, 211, 73, 116, 12, 8, 79, 109, 26, 80, 111, 34, 8, 80, 210, 97, 168, 71, 50, 128, 63, 20, 119, 135,
+        59, 181, 121, 115, 8, 86, 105, 147, 110, 28, 208, 6, 34, 214, 96, 111, 45, 66, 27, 122, 122, 97, 118, 127,
+        108, 46, 74, 9, 109, 26, 74, 101, 112, 60, 0, 90, 158, 98, 146, 119, 46, 80, 5, 155, 117, 97, 18, 73,
+        27, 107, 59, 5, 111, 107, 29, 85, 122, 98, 101, 107, 137, 191, 119, 200, 8, 80, 97, 17, 7, 78, 117, 182,
+        215, 28, 9, 53, 95, 37, 107, 109, 22, 137, 191, 112, 1, 121, 39, 95, 104, 222, 34, 0, 89, 28, 26, 179,
+        244, 167, 133, 65, 12, 21, 54, 22, 121, 170, 139, 115, 119, 1, 142, 50, 155, 97, 40, 5, 0, 85, 107, 27,
+        6, 171, 117, 42, 198, 26, 175, 65, 102, 114, 25, 7, 84, 22, 103, 51, 41, 131, 12, 190, 102, 103, 1, 137,
+        26, 77, 206, 109, 5, 124, 66, 37, 109, 2, 90, 192, 8, 125, 127, 18, 84, 37, 107, 18, 80, 92, 137, 26,
+        77, 111, 122, 192, 25, 63, 28, 148, 8, 86, 22, 101, 122, 117, 48, 152, 105, 103, 9, 8, 84, 1, 122, 188,
+        77, 57, 52, 59, 97, 37, 56, 188, 66, 39, 105, 118, 8, 69, 116, 105, 111, 112, 214, 39, 185, 98, 190, 102,
+        114, 25, 7, 198, 26, 77, 12, 18, 65, 110, 103, 39, 152, 105, 103, 9, 243, 50, 0, 179, 117, 59, 96, 39,
+        8, 220, 26, 76, 148, 121, 171, 184, 26, 178, 100, 11, 57, 8, 68, 137, 114, 25, 32, 70, 200, 9, 12, 95,
+        3, 120, 99, 12, 142, 20, 48, 111, 23, 65, 228, 55, 99, 254, 22, 116, 225, 67, 39, 158, 2, 81, 117, 9,
+        147, 5, 29, 72, 105, 100, 12, 103, 29, 77, 101, 120, 31, 58, 83, 116, 30, 46, 84, 146, 55, 99, 29, 78,
+        135, 5, 56, 0, 62, 1, 223, 117, 30, 29, 134, 101, 33, 2, 89, 117, 99, 30, 26, 81, 117, 6, 116, 1,
+        7, 82, 111, 29, 83, 6, 12, 111, 2, 67, 28, 112, 101, 136, 46, 77, 216, 111, 221, 191, 10, 76, 117, 43,
+        193, 139, 149, 18, 62, 251, 9, 29, 78, 117, 101, 118, 58, 76, 101, 11, 151, 223, 213, 254, 102, 20, 110, 8,
+        86, 9, 221, 204, 122, 243, 230, 112, 154, 66, 223, 213, 254, 102, 20, 110, 47, 83, 37, 0, 90, 221, 30, 101,
+        99, 154, 74, 12, 43, 99, 29, 84, 28, 97, 205, 138, 154, 79, 97, 120, 221, 2, 68, 37, 60, 29, 67, 111,
+        51, 117, 127, 171, 11, 20, 2, 125, 105, 104, 117, 51, 117, 247, 1, 51, 32, 112, 22, 227, 226, 98, 181, 26,
+        65, 27, 98, 143, 97, 184, 215, 96, 111, 45, 75, 6, 234, 55, 141, 108, 106, 224, 97, 52, 54, 224, 92, 104,
+        4, 26, 65, 114, 103, 22, 116, 211, 68, 28, 252, 68, 105, 117, 241, 50, 114, 7, 42, 78, 155, 5, 32, 72,
+        97, 118, 48, 18, 125, 21, 105, 103, 5, 104, 140, 110, 100, 28, 252, 78, 31, 111, 98, 5, 0, 76, 92, 234,
+        50, 119, 101, 101, 112, 241, 48, 104, 18, 77, 201, 104, 181, 121, 152, 155, 12, 21, 59, 1, 105, 17, 114, 95,
+        114, 105, 17, 114, 142, 202, 20, 28, 41, 25, 107, 158, 0, 80, 53, 106, 146, 160, 5, 206, 141, 114, 53, 97,
+        136, 12, 193, 238, 140, 115, 115, 28, 151, 105, 104, 5, 0, 85, 116, 159, 92, 104, 21, 0, 71, 111, 189, 9,
+        12, 247, 28, 127, 32, 78, 50, 117, 160, 158, 97, 136, 12, 193, 238, 209, 28, 109, 117, 129, 75, 55, 104, 109,
+        52, 243, 104, 30, 116, 43, 103, 5, 104, 209, 104, 5, 107, 104, 21, 54, 5, 110, 30, 92, 246, 223, 97, 4,
+        104, 26, 79, 100, 43, 104, 126, 79, 114, 217, 2, 62, 106, 249, 151, 22, 227, 181, 32, 98, 249, 59, 50, 104,
+        121, 7, 80, 238, 95, 48, 60, 1, 141, 110, 100, 104, 114, 7, 80, 238, 59, 51, 5, 55, 104, 116, 114, 2,
+        85, 116, 159, 193, 238, 0, 134, 100, 117, 136, 251, 121, 63, 157, 143, 231, 166, 87, 12, 225, 87, 105, 248, 51,
+        130, 98, 117, 153, 139, 7, 65, 183, 233, 8, 74, 9, 118, 43, 32, 66, 135, 32, 87, 105, 248, 51, 242, 105,
+        248, 51, 32, 94, 5, 141, 183, 233, 47, 198, 26, 84, 55, 109, 188, 86, 31, 116, 20, 190, 183, 233, 47, 165,
+        30, 0, 81, 117, 101, 22, 132, 241, 137, 203, 58, 102, 200, 9, 12, 41, 9, 103, 138, 46, 65, 3, 103, 111,
+        154, 82, 105, 58, 100, 101, 32, 74, 1, 101, 52, 29, 69, 115, 112, 52, 56, 58, 83, 210, 29, 82, 105, 58,
+        177, 21, 101, 32, 100, 58, 78, 174, 46, 80, 5, 97, 148, 171, 210, 213, 30, 5, 211, 179, 110, 192, 117, 99,
+        29, 176, 97, 112, 195, 161, 0, 67, 101, 5, 141, 99, 114, 46, 80, 5, 1, 246, 20, 97, 158, 246, 11, 100,
+        195, 180, 110, 162, 97, 58, 80, 97, 205, 29, 80, 230, 117, 195, 173, 95, 111, 99, 210, 6, 23, 82, 105, 58,
+        177, 21, 101, 32, 100, 58, 83, 205, 59, 5, 1, 104, 97, 29, 71, 111, 105, 154, 77, 30, 58, 177, 149, 115,
+        58, 100, 58, 83, 205, 151, 51, 8, 77, 6, 55, 32, 71, 9, 97, 167, 77, 30, 58, 177, 149, 115, 29, 80,
+        5, 141, 109, 224, 11, 154, 68, 137, 114, 31, 93, 111, 102, 32, 67, 39, 185, 98, 8, 82, 104, 232, 101, 150,
+        241, 156, 119, 5, 46, 67, 11, 110, 101, 99, 116, 31, 94, 63, 237, 74, 9, 115, 101, 121, 63, 237, 72, 28,
+        112, 234, 52, 46, 86, 9, 109, 253, 59, 55, 115, 97, 136, 117, 115, 147, 116, 23, 72, 97, 119, 222, 18, 197,
+        121, 34, 242, 101, 4, 32, 199, 162, 231, 166, 67, 5, 39, 6, 142, 145, 46, 178, 100, 105, 1, 189, 22, 116,
+        117, 99, 107, 121, 95, 22, 110, 57, 115, 101, 46, 199, 8, 79, 104, 105, 29, 80, 22, 110, 115, 121, 108, 118,
+        188, 77, 217, 217, 138, 112, 18, 76, 111, 117, 43, 105, 1, 141, 3, 98, 28, 141, 114, 107, 245, 154, 78, 174,
+        166, 67, 5, 39, 6, 152, 237, 89, 20, 107, 0, 73, 111, 119, 2, 73, 108, 108, 6, 111, 167, 71, 101, 20,
+        103, 8, 87, 43, 99, 11, 115, 6, 208, 108, 20, 105, 100, 142, 217, 111, 37, 18, 79, 107, 3, 104, 131, 152,
+        174, 166, 68, 92, 139, 2, 87, 55, 104, 128, 116, 11, 41, 231, 166, 68, 92, 139, 152, 101, 98, 27, 40, 189,
+        245, 154, 73, 100, 51, 29, 85, 116, 51, 59, 6, 110, 57, 139, 142, 216, 105, 103, 26, 87, 121, 131, 128, 0,
+        79, 114, 201, 11, 0, 67, 39, 20, 50, 29, 78, 101, 118, 50, 141, 114, 202, 11, 152, 237, 77, 101, 120, 31,
+        29, 77, 253, 1, 2, 67, 254, 102, 20, 110, 8, 84, 101, 120, 154, 65, 3, 40, 170, 203, 43, 166, 67, 39,
+        185, 98, 190, 108, 98, 9, 116, 2, 79, 110, 159, 105, 29, 81, 117, 101, 98, 101, 99, 41, 97, 40, 30, 136,
+        157, 26, 77, 1, 56, 111, 98, 152, 157, 102, 111, 53, 100, 34, 63, 237, 66, 114, 53, 115, 119, 31, 107, 63,
+        49, 7, 83, 99, 139, 8, 169, 193, 60, 9, 10, 69, 100, 119, 250, 0, 89, 117, 107, 11, 63, 174, 104, 119,
+        101, 4, 32, 84, 9, 203, 20, 105, 225, 78, 53, 97, 118, 94, 0, 178, 100, 190, 183, 233, 8, 66, 27, 122,
+        127, 0, 85, 83, 65, 124, 240, 7, 83, 172, 30, 124, 240, 142, 101, 120, 31, 29, 77, 111, 40, 111, 119, 41,
+        207, 80, 147, 9, 115, 98, 37, 103, 54, 12, 6, 128, 164, 24, 178, 228, 234, 147, 218, 140, 100, 121, 103, 101,
+        7, 61, 0, 79, 115, 115, 147, 230, 45, 65, 108, 1, 47, 175, 94, 5, 189, 146, 250, 6, 111, 45, 66, 12,
+        107, 5, 32, 144, 54, 5, 97, 136, 135, 45, 125, 9, 107, 57, 115, 32, 236, 175, 125, 101, 136, 110, 121, 2,
+        125, 117, 118, 55, 166, 236, 73, 118, 1, 49, 111, 24, 76, 138, 147, 123, 79, 114, 121, 39, 24, 84, 117, 3,
+        24, 66, 48, 103, 20, 232, 24, 86, 3, 100, 158, 52, 24, 75, 37, 123, 75, 12, 117, 103, 212, 84, 192, 219,
+        66, 114, 206, 123, 89, 5, 149, 3, 118, 108, 24, 82, 121, 224, 10, 16, 65, 4, 27, 107, 104, 10, 16, 77,
+        149, 99, 111, 119, 24, 83, 109, 39, 22, 123, 68, 155, 101, 4, 10, 61, 0, 86, 20, 11, 101, 122, 104, 24,
+        78, 49, 103, 20, 232, 24, 80, 40, 219, 75, 111, 4, 114, 131, 212, 83, 116, 97, 118, 114, 111, 112, 39, 186,
+        75, 27, 115, 110, 232, 5, 186, 75, 12, 109, 121, 107, 218, 95, 118, 9, 24, 76, 22, 128, 164, 24, 82, 111,
+        4, 219, 86, 39, 103, 111, 103, 164, 24, 86, 39, 111, 103, 100, 212, 77, 37, 109, 1, 123, 75, 5, 48, 218,
+        63, 22, 147, 115, 214, 131, 168, 144, 140, 114, 107, 104, 60, 48, 123, 77, 20, 100, 49, 218, 63, 202, 104, 110,
+        121, 32, 78, 49, 103, 20, 232, 24, 80, 22, 122, 212, 75, 52, 219, 197, 168, 69, 108, 32, 236, 79, 114, 22,
+        98, 37, 103, 24, 85, 108, 206, 49, 123, 179, 109, 186, 66, 55, 104, 107, 174, 111, 4, 10, 236, 85, 100, 109,
+        37, 93, 236, 175, 84, 30, 5, 4, 191, 28, 5, 212, 83, 249, 219, 89, 28, 12, 111, 45, 78, 22, 147, 23,
+        75, 104, 210, 121, 45, 77, 245, 18, 83, 118, 9, 100, 108, 49, 123, 84, 121, 185, 22, 24, 75, 37, 103, 10,
+        16, 125, 48, 121, 146, 6, 123, 66, 37, 121, 30, 47, 144, 54, 27, 168, 90, 146, 135, 107, 12, 40, 121, 0,
+        220, 107, 94, 123, 78, 49, 149, 148, 52, 123, 84, 131, 123, 79, 109, 123, 75, 104, 92, 55, 115, 218, 54, 226,
+        9, 49, 111, 24, 175, 65, 108, 116, 97, 18, 65, 108, 116, 222, 186, 84, 117, 118, 7, 144, 54, 27, 115, 110,
+        111, 121, 5, 40, 186, 77, 155, 97, 42, 16, 125, 117, 107, 139, 107, 7, 79, 107, 204, 103, 54, 28, 136, 30,
+        107, 7, 75, 163, 83, 92, 104, 12, 6, 24, 80, 114, 158, 20, 40, 121, 186, 15, 32, 79, 116, 11, 131, 32,
+        89, 51, 184, 215, 104, 146, 5, 49, 40, 186, 176, 37, 24, 61, 143, 92, 104, 126, 89, 92, 94, 47, 144, 54,
+        1, 50, 246, 117, 115, 8, 77, 22, 99, 205, 25, 95, 105, 1, 106, 6, 151, 101, 105, 106, 128, 160, 145, 26,
+        78, 128, 120, 47, 72, 117, 18, 125, 96, 113, 128, 0, 90, 104, 101, 106, 229, 209, 229, 115, 117, 208, 117, 106,
+        105, 26, 65, 110, 104, 117, 18, 76, 230, 11, 128, 41, 104, 21, 96, 41, 104, 1, 120, 18, 74, 229, 120, 18,
+        72, 22, 26, 62, 202, 104, 111, 117, 0, 62, 60, 100, 96, 160, 117, 98, 101, 18, 74, 127, 6, 160, 101, 98,
+        101, 18, 83, 104, 97, 1, 120, 18, 78, 101, 168, 77, 96, 39, 124, 77, 96, 39, 47, 68, 181, 109, 160, 101,
+        127, 96, 106, 229, 160, 53, 26, 62, 60, 120, 168, 90, 104, 117, 60, 41, 216, 117, 26, 89, 53, 110, 26, 88,
+        202, 60, 124, 84, 148, 147, 0, 71, 245, 117, 0, 81, 128, 104, 97, 18, 88, 6, 106, 229, 32, 85, 121, 103,
+        104, 37, 0, 67, 211, 133, 84, 9, 108, 117, 5, 153, 101, 99, 127, 32, 240, 7, 83, 172, 30, 0, 239, 67,
+        108, 138, 112, 9, 116, 11, 140, 110, 159, 116, 25, 2, 178, 116, 9, 110, 55, 105, 11, 12, 124, 68, 53, 105,
+        126, 66, 185, 18,
+};
+
+static const unsigned char TERRITORY_NAMES_PAIRS_ID[256][2] = {
+        {0, 0}, {97, 110}, {97, 0}, {108, 97}, {115, 116}, {97, 114}, {105, 110}, {97, 32}, {105, 2}, {101, 114}, {1, 32}, {111, 110},
+        {97, 108}, {3, 4}, {79, 98}, {14, 13}, {15, 0}, {112, 117}, {105, 0}, {101, 17}, {111, 114}, {1, 100}, {101, 110}, {115, 0},
+        {32, 16}, {105, 107}, {1, 0}, {114, 97}, {97, 109}, {111, 0}, {97, 116}, {105, 99}, {32, 32}, {98, 108}, {108, 21}, {19, 33},
+        {82, 35}, {117, 114}, {3, 117}, {111, 108}, {115, 107}, {0, 83}, {100, 10}, {105, 115}, {44, 44}, {45, 45}, {101, 0}, {105, 7},
+        {101, 108}, {111, 118}, {97, 100}, {97, 104}, {105, 114}, {117, 110}, {0, 75}, {97, 115}, {105, 116}, {101, 115}, {111, 32}, {0, 77},
+        {1, 103}, {36, 25}, {71, 117}, {0, 78}, {19, 38}, {65, 65}, {66, 66}, {67, 67}, {68, 68}, {69, 69}, {70, 70}, {71, 71},
+        {72, 72}, {73, 73}, {74, 74}, {75, 75}, {76, 76}, {77, 77}, {78, 78}, {79, 79}, {80, 80}, {81, 81}, {82, 82}, {83, 83},
+        {84, 84}, {85, 85}, {86, 86}, {87, 87}, {88, 88}, {89, 89}, {90, 90}, {64, 10}, {97, 107}, {116, 32}, {117, 116}, {0, 84},
+        {11, 103}, {97, 97}, {98, 98}, {99, 99}, {100, 100}, {101, 101}, {102, 102}, {103, 103}, {104, 104}, {105, 105}, {106, 106}, {107, 107},
+        {108, 108}, {109, 109}, {110, 110}, {111, 111}, {112, 112}, {113, 113}, {114, 114}, {115, 115}, {116, 116}, {117, 117}, {118, 118}, {119, 119},
+        {120, 120}, {121, 121}, {122, 122}, {40, 24}, {124, 124}, {67, 104}, {97, 124}, {105, 108}, {6, 103}, {32, 42}, {32, 73}, {111, 109},
+        {115, 34}, {75, 91}, {80, 117}, {97, 121}, {99, 104}, {105, 4}, {105, 112}, {111, 116}, {0, 65}, {2, 65}, {2, 77}, {32, 83},
+        {36, 31}, {97, 6}, {97, 98}, {101, 116}, {105, 98}, {111, 115}, {130, 132}, {0, 66}, {2, 78}, {32, 75}, {97, 23}, {97, 103},
+        {101, 3}, {101, 119}, {105, 109}, {116, 5}, {0, 72}, {161, 161}, {8, 83}, {27, 18}, {27, 100}, {66, 5}, {104, 32}, {105, 23},
+        {105, 32}, {134, 38}, {2, 66}, {2, 83}, {9, 25}, {173, 173}, {20, 116}, {61, 32}, {65, 109}, {71, 114}, {73, 110}, {80, 9},
+        {180, 180}, {97, 3}, {103, 6}, {117, 4}, {117, 100}, {117, 109}, {153, 163}, {156, 116}, {1, 8}, {2, 75}, {8, 65}, {26, 83},
+        {28, 98}, {32, 80}, {52, 182}, {195, 195}, {57, 104}, {77, 5}, {83, 187}, {86, 194}, {101, 100}, {101, 103}, {105, 122}, {114, 56},
+        {114, 117}, {117, 108}, {121, 1}, {145, 93}, {0, 70}, {0, 74}, {1, 116}, {6, 2}, {7, 16}, {7, 67}, {8, 75}, {18, 75},
+        {31, 104}, {43, 115}, {47, 61}, {49, 24}, {73, 114}, {97, 99}, {97, 105}, {97, 106}, {97, 122}, {101, 23}, {101, 109}, {103, 103},
+        {103, 117}, {105, 60}, {105, 97}, {111, 94}, {111, 100}, {114, 12}, {115, 104}, {124, 133}, {144, 0}, {157, 32}, {164, 196}, {169, 32},
+        {176, 172}, {0, 68}, {0, 87}, {0, 125}, {1, 99}, {1, 115}, {2, 82}, {2, 84}, {3, 121}, {5, 30}, {5, 100}, {9, 114},
+        {10, 42}, {11, 116}, {12, 105}, {26, 66},
+};
+
+static const unsigned short TERRITORY_NAME_ALTERNATIVES_START_ID[_TERRITORY_MAX - _TERRITORY_MIN] = {
+        0, 2, 3, 4, 5, 7, 8, 9, 10, 11, 12, 13, 15, 16, 17, 18,
+        19, 20, 21, 22, 23, 24, 25, 27, 29, 30, 31, 32, 34, 35, 37, 38,
+        40, 41, 44, 45, 48, 49, 50, 52, 53, 55, 57, 59, 60, 62, 63, 64,
+        65, 66, 67, 68, 69, 70, 72, 73, 74, 75, 76, 77, 79, 81, 82, 83,
+        85, 86, 87, 88, 89, 90, 91, 93, 94, 95, 97, 98, 99, 100, 101, 102,
+        103, 104, 105, 107, 108, 109, 110, 111, 112, 113, 115, 116, 117, 118, 119, 120,
+        121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132, 133, 134, 135, 136,
+        137, 138, 139, 140, 141, 142, 143, 144, 145, 146, 147, 148, 149, 150, 151, 152,
+        153, 154, 155, 156, 157, 158, 159, 160, 161, 162, 163, 164, 165, 166, 167, 168,
+        169, 170, 171, 172, 173, 174, 175, 176, 177, 178, 179, 180, 181, 182, 183, 184,
+        185, 186, 187, 188, 189, 190, 191, 196, 197, 198, 200, 201, 202, 203, 204, 205,
+        206, 207, 208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221,
+        222, 223, 224, 225, 226, 227, 228, 229, 230, 231, 232, 233, 234, 235, 236, 237,
+        239, 240, 241, 242, 243, 244, 245, 246, 247, 248, 249, 250, 251, 252, 253, 254,
+        255, 256, 257, 258, 259, 260, 261, 262, 263, 264, 265, 266, 267, 268, 269, 270,
+        271, 272, 273, 274, 275, 276, 277, 278, 279, 280, 281, 282, 283, 284, 285, 286,
+        287, 288, 289, 290, 291, 292, 293, 294, 295, 296, 297, 298, 299, 300, 301, 302,
+        303, 304, 305, 306, 307, 308, 309, 310, 311, 312, 313, 314, 315, 316, 317, 318,
+        319, 320, 321, 322, 323, 324, 325, 326, 327, 328, 329, 331, 332, 333, 334, 335,
+        336, 337, 338, 339, 340, 341, 342, 343, 344, 345, 346, 347, 348, 349, 350, 351,
+        352, 353, 354, 355, 356, 357, 358, 359, 360, 361, 362, 363, 364, 365, 366, 367,
+        368, 369, 370, 371, 372, 373, 374, 375, 376, 377, 378, 379, 380, 381, 382, 383,
+        384, 385, 386, 387, 388, 389, 390, 391, 392, 393, 394, 395, 396, 397, 398, 399,
+        400, 401, 402, 403, 404, 405, 406, 407, 408, 409, 410, 411, 412, 413, 414, 415,
+        416, 417, 418, 419, 420, 421, 422, 423, 424, 425, 426, 427, 428, 429, 430, 431,
+        432, 433, 434, 435, 436, 437, 438, 439, 440, 441, 442, 445, 446, 447, 448, 449,
+        450, 451, 452, 453, 454, 455, 456, 457, 458, 459, 460, 461, 462, 463, 464, 465,
+        466, 467, 468, 469, 470, 471, 472, 473, 474, 475, 476, 477, 478, 479, 480, 481,
+        482, 483, 484, 485, 486, 487, 488, 489, 490, 491, 492, 493, 494, 495, 496, 497,
+        498, 499, 500, 501, 502, 503, 504, 505, 506, 507, 508, 509, 510, 511, 512, 513,
+        514, 515, 516, 517, 518, 519, 520, 521, 522, 523, 524, 525, 526, 527, 528, 530,
+        531, 532, 533, 534, 535, 536, 537, 538, 539, 540, 541, 542, 543, 544, 545, 546,
+        547, 548, 549, 550, 551, 552, 553, 555, 556, 557, 558, 559, 560, 562, 563, 564,
+        565, 566, 567, 568, 569, 572,
+};
+
+static const TerritoryNameAlternative TERRITORY_NAME_ALTERNATIVES_ID[572] = {
+        {0, 12, 0}, {13, 8, 0}, {22, 6, 0}, {29, 9, 0}, {39, 7, 0}, {47, 15, 0}, {63, 15, 0}, {79, 16, 0},
+        {96, 5, 0}, {102, 6, 0}, {109, 5, 0}, {115, 12, 0}, {128, 12, 0}, {141, 25, 0}, {167, 13, 0}, {181, 18, 0},
+        {200, 12, 0}, {213, 7, 0}, {221, 26, 0}, {248, 10, 0}, {259, 8, 0}, {268, 8, 0}, {277, 10, 0}, {288, 6, 0},
+        {295, 16, 0}, {312, 17, 0}, {330, 6, 0}, {337, 22, 0}, {360, 25, 0}, {386, 13, 0}, {400, 5, 0}, {406, 14, 0},
+        {421, 13, 0}, {435, 14, 0}, {450, 14, 0}, {465, 25, 0}, {491, 8, 0}, {500, 4, 0}, {505, 21, 0}, {527, 5, 0},
+        {533, 12, 0}, {546, 30, 0}, {577, 4, 0}, {582, 12, 0}, {595, 8, 0}, {604, 44, 0}, {649, 9, 0}, {659, 16, 0},
+        {676, 5, 0}, {682, 7, 0}, {690, 17, 0}, {708, 20, 0}, {729, 7, 0}, {737, 22, 0}, {760, 9, 0}, {770, 28, 0},
+        {799, 10, 0}, {810, 34, 0}, {845, 16, 0}, {862, 8, 0}, {871, 19, 0}, {891, 7, 0}, {899, 7, 0}, {907, 10, 0},
+        {918, 5, 0}, {924, 23, 0}, {948, 7, 0}, {956, 4, 0}, {961, 13, 0}, {975, 11, 0}, {987, 10, 0}, {998, 26, 0},
+        {1025, 9, 0}, {1035, 5, 0}, {1041, 8, 0}, {1050, 7, 0}, {1058, 8, 0}, {1067, 26, 0}, {1094, 14, 0}, {1109, 21, 0},
+        {1131, 8, 0}, {1140, 8, 0}, {1149, 10, 0}, {1160, 5, 0}, {1166, 15, 0}, {1182, 10, 0}, {1193, 6, 0}, {1200, 9, 0},
+        {1210, 5, 0}, {1216, 10, 0}, {1227, 5, 0}, {1233, 46, 0}, {1280, 22, 0}, {1303, 18, 0}, {1322, 10, 0}, {1333, 19, 0},
+        {1353, 6, 0}, {1360, 6, 0}, {1367, 39, 0}, {1407, 11, 0}, {1419, 6, 0}, {1426, 7, 0}, {1434, 7, 0}, {1442, 6, 0},
+        {1449, 5, 0}, {1455, 9, 0}, {1465, 18, 0}, {1484, 7, 0}, {1492, 10, 0}, {1503, 6, 0}, {1510, 11, 0}, {1522, 9, 0},
+        {1532, 6, 0}, {1539, 4, 0}, {1544, 14, 0}, {1559, 14, 0}, {1574, 8, 0}, {1583, 6, 0}, {1590, 17, 0}, {1608, 11, 0},
+        {1620, 6, 0}, {1627, 8, 0}, {1636, 9, 0}, {1646, 6, 0}, {1653, 5, 0}, {1659, 7, 0}, {1667, 14, 0}, {1682, 7, 0},
+        {1690, 13, 0}, {1704, 7, 0}, {1712, 7, 0}, {1720, 7, 0}, {1728, 7, 0}, {1736, 13, 0}, {1750, 6, 0}, {1757, 6, 0},
+        {1764, 5, 0}, {1770, 7, 0}, {1778, 7, 0}, {1786, 7, 0}, {1794, 17, 0}, {1812, 8, 0}, {1821, 10, 0}, {1832, 22, 0},
+        {1855, 7, 0}, {1863, 4, 0}, {1868, 6, 0}, {1875, 9, 0}, {1885, 8, 0}, {1894, 7, 0}, {1902, 8, 0}, {1911, 12, 0},
+        {1924, 6, 0}, {1931, 13, 0}, {1945, 15, 0}, {1961, 15, 0}, {1977, 7, 0}, {1985, 10, 0}, {1996, 6, 0}, {2003, 6, 0},
+        {2010, 8, 0}, {2019, 8, 0}, {2028, 13, 0}, {2042, 8, 0}, {2051, 9, 0}, {2061, 4, 0}, {2066, 8, 0}, {2075, 7, 0},
+        {2083, 8, 0}, {2092, 5, 0}, {2098, 7, 0}, {2106, 6, 0}, {2113, 11, 0}, {2125, 9, 0}, {2135, 6, 0}, {2142, 10, 0},
+        {2153, 10, 0}, {2164, 5, 0}, {2170, 7, 0}, {2178, 8, 0}, {2187, 7, 0}, {2195, 7, 0}, {2203, 6, 0}, {2210, 7, 0},
+        {2218, 10, 0}, {2229, 7, 0}, {2237, 6, 0}, {2244, 4, 0}, {2249, 7, 0}, {2257, 5, 0}, {2263, 6, 0}, {2270, 12, 0},
+        {2283, 10, 0}, {2294, 7, 0}, {2302, 14, 0}, {2317, 18, 0}, {2336, 6, 0}, {2343, 7, 0}, {2351, 12, 0}, {2364, 7, 0},
+        {2372, 5, 0}, {2378, 13, 0}, {2392, 12, 0}, {2405, 8, 0}, {2414, 6, 0}, {2421, 4, 0}, {2426, 8, 0}, {2435, 13, 0},
+        {2449, 6, 0}, {2456, 8, 0}, {2465, 7, 0}, {2473, 9, 0}, {2483, 17, 0}, {2501, 6, 0}, {2508, 6, 0}, {2515, 8, 0},
+        {2524, 8, 0}, {2533, 4, 0}, {2538, 6, 0}, {2545, 10, 0}, {2556, 6, 0}, {2563, 12, 0}, {2576, 7, 0}, {2584, 12, 0},
+        {2597, 7, 0}, {2605, 8, 0}, {2614, 5, 0}, {2620, 8, 0}, {2629, 16, 0}, {2646, 5, 0}, {2652, 8, 0}, {2661, 10, 0},
+        {2672, 7, 0}, {2680, 13, 0}, {2694, 22, 0}, {2717, 7, 0}, {2725, 10, 0}, {2736, 7, 0}, {2744, 5, 0}, {2750, 6, 0},
+        {2757, 5, 0}, {2763, 5, 0}, {2769, 8, 0}, {2778, 8, 0}, {2787, 7, 0}, {2795, 9, 0}, {2805, 7, 0}, {2813, 8, 0},
+        {2822, 5, 0}, {2828, 10, 0}, {2839, 7, 0}, {2847, 7, 0}, {2855, 8, 0}, {2864, 14, 0}, {2879, 4, 0}, {2884, 6, 0},
+        {2891, 5, 0}, {2897, 4, 0}, {2902, 4, 0}, {2907, 8, 0}, {2916, 4, 0}, {2921, 5, 0}, {2927, 5, 0}, {2933, 9, 0},
+        {2943, 15, 0}, {2959, 8, 0}, {2968, 7, 0}, {2976, 14, 0}, {2991, 6, 0}, {2998, 9, 0}, {3008, 7, 0}, {3016, 12, 0},
+        {3029, 7, 0}, {3037, 7, 0}, {3045, 10, 0}, {3056, 6, 0}, {3063, 7, 0}, {3071, 12, 0}, {3084, 7, 0}, {3092, 8, 0},
+        {3101, 9, 0}, {3111, 15, 0}, {3127, 8, 0}, {3136, 10, 0}, {3147, 15, 0}, {3163, 8, 0}, {3172, 7, 0}, {3180, 19, 0},
+        {3200, 9, 0}, {3210, 7, 0}, {3218, 10, 0}, {3229, 6, 0}, {3236, 7, 0}, {3244, 8, 0}, {3253, 6, 0}, {3260, 9, 0},
+        {3270, 19, 0}, {3290, 10, 0}, {3301, 14, 0}, {3316, 8, 0}, {3325, 10, 0}, {3336, 9, 0}, {3346, 13, 0}, {3360, 22, 0},
+        {3383, 10, 0}, {3394, 19, 0}, {3414, 11, 0}, {3426, 5, 0}, {3432, 9, 0}, {3442, 8, 0}, {3451, 7, 0}, {3459, 7, 0},
+        {3467, 7, 0}, {3475, 6, 0}, {3482, 6, 0}, {3489, 7, 0}, {3497, 17, 0}, {3515, 5, 0}, {3521, 5, 0}, {3527, 11, 0},
+        {3539, 3, 0}, {3543, 6, 0}, {3550, 10, 0}, {3561, 16, 0}, {3578, 17, 0}, {3596, 12, 0}, {3609, 9, 0}, {3619, 9, 0},
+        {3629, 9, 0}, {3639, 6, 0}, {3646, 6, 0}, {3653, 7, 0}, {3661, 14, 0}, {3676, 14, 0}, {3691, 9, 0}, {3701, 14, 0},
+        {3716, 11, 0}, {3728, 13, 0}, {3742, 10, 0}, {3753, 15, 0}, {3769, 26, 0}, {3796, 18, 0}, {3815, 13, 0}, {3829, 17, 0},
+        {3847, 8, 0}, {3856, 8, 0}, {3865, 15, 0}, {3881, 10, 0}, {3892, 16, 0}, {3909, 7, 0}, {3917, 7, 0}, {3925, 14, 0},
+        {3940, 14, 0}, {3955, 19, 0}, {3975, 7, 0}, {3983, 14, 0}, {3998, 10, 0}, {4009, 6, 0}, {4016, 5, 0}, {4022, 4, 0},
+        {4027, 6, 0}, {4034, 7, 0}, {4042, 9, 0}, {4052, 9, 0}, {4062, 6, 0}, {4069, 9, 0}, {4079, 17, 0}, {4097, 8, 0},
+        {4106, 5, 0}, {4112, 18, 0}, {4131, 5, 0}, {4137, 12, 0}, {4150, 11, 0}, {4162, 4, 0}, {4167, 8, 0}, {4176, 20, 0},
+        {4197, 12, 0}, {4210, 8, 0}, {4219, 11, 0}, {4231, 10, 0}, {4242, 13, 0}, {4256, 7, 0}, {4264, 13, 0}, {4278, 6, 0},
+        {4285, 8, 0}, {4294, 13, 0}, {4308, 14, 0}, {4323, 5, 0}, {4329, 7, 0}, {4337, 8, 0}, {4346, 9, 0}, {4356, 8, 0},
+        {4365, 4, 0}, {4370, 12, 0}, {4383, 11, 0}, {4395, 9, 0}, {4405, 7, 0}, {4413, 8, 0}, {4422, 14, 0}, {4437, 8, 0},
+        {4446, 4, 0}, {4451, 8, 0}, {4460, 7, 0}, {4468, 9, 0}, {4478, 7, 0}, {4486, 8, 0}, {4495, 8, 0}, {4504, 12, 0},
+        {4517, 10, 0}, {4528, 12, 0}, {4541, 8, 0}, {4550, 6, 0}, {4557, 5, 0}, {4563, 4, 0}, {4568, 9, 0}, {4578, 8, 0},
+        {4587, 7, 0}, {4595, 6, 0}, {4602, 8, 0}, {4611, 6, 0}, {4618, 7, 0}, {4626, 10, 0}, {4637, 7, 0}, {4645, 10, 0},
+        {4656, 5, 0}, {4662, 6, 0}, {4669, 16, 0}, {4686, 7, 0}, {4694, 7, 0}, {4702, 6, 0}, {4709, 12, 0}, {4722, 8, 0},
+        {4731, 12, 0}, {4744, 13, 0}, {4758, 11, 0}, {4770, 21, 0}, {4792, 5, 0}, {4798, 21, 0}, {4820, 7, 0}, {4828, 5, 0},
+        {4834, 9, 0}, {4844, 6, 0}, {4851, 3, 0}, {4855, 15, 0}, {4871, 7, 0}, {4879, 6, 0}, {4886, 6, 0}, {4893, 16, 0},
+        {4910, 18, 0}, {4929, 19, 0}, {4949, 15, 0}, {4965, 29, 0}, {4995, 25, 0}, {5021, 26, 0}, {5048, 17, 0}, {5066, 16, 0},
+        {5083, 14, 0}, {5098, 14, 0}, {5113, 12, 0}, {5126, 11, 0}, {5138, 15, 0}, {5154, 15, 0}, {5170, 12, 0}, {5183, 13, 0},
+        {5197, 13, 0}, {5211, 14, 0}, {5226, 16, 0}, {5243, 13, 0}, {5257, 16, 0}, {5274, 13, 0}, {5288, 15, 0}, {5304, 17, 0},
+        {5322, 15, 0}, {5338, 15, 0}, {5354, 12, 0}, {5367, 15, 0}, {5383, 14, 0}, {5398, 14, 0}, {5413, 17, 0}, {5431, 11, 0},
+        {5443, 16, 0}, {5460, 13, 0}, {5474, 16, 0}, {5491, 14, 0}, {5506, 15, 0}, {5522, 16, 0}, {5539, 8, 0}, {5548, 13, 0},
+        {5562, 18, 0}, {5581, 17, 0}, {5599, 22, 0}, {5622, 12, 0}, {5635, 12, 0}, {5648, 16, 0}, {5665, 15, 0}, {5681, 16, 0},
+        {5698, 9, 0}, {5708, 22, 0}, {5731, 15, 0}, {5747, 18, 0}, {5766, 13, 0}, {5780, 14, 0}, {5795, 13, 0}, {5809, 12, 0},
+        {5822, 17, 0}, {5840, 13, 0}, {5854, 13, 0}, {5868, 18, 0}, {5887, 17, 0}, {5905, 16, 0}, {5922, 14, 0}, {5937, 18, 0},
+        {5956, 12, 0}, {5969, 11, 0}, {5981, 18, 0}, {6000, 15, 0}, {6016, 14, 0}, {6031, 10, 0}, {6042, 13, 0}, {6056, 16, 0},
+        {6073, 14, 0}, {6088, 14, 0}, {6103, 14, 0}, {6118, 15, 0}, {6134, 14, 0}, {6149, 20, 0}, {6170, 15, 0}, {6186, 11, 0},
+        {6198, 14, 0}, {6213, 16, 0}, {6230, 6, 0}, {6237, 5, 0}, {6243, 8, 0}, {6252, 7, 0}, {6260, 7, 0}, {6268, 6, 0},
+        {6275, 11, 0}, {6287, 9, 0}, {6297, 8, 0}, {6306, 7, 0}, {6314, 6, 0}, {6321, 5, 0}, {6327, 8, 0}, {6336, 8, 0},
+        {6345, 6, 0}, {6352, 7, 0}, {6360, 5, 0}, {6366, 7, 0}, {6374, 9, 0}, {6384, 5, 0}, {6390, 5, 0}, {6396, 5, 0},
+        {6402, 7, 0}, {6410, 10, 0}, {6421, 14, 0}, {6436, 12, 0}, {6449, 5, 0}, {6455, 14, 0}, {6470, 7, 0}, {6478, 6, 0},
+        {6485, 6, 0}, {6492, 5, 0}, {6498, 5, 0}, {6504, 7, 0}, {6512, 15, 0}, {6528, 4, 0}, {6533, 39, 0}, {6573, 16, 0},
+        {6590, 9, 0}, {6600, 13, 0}, {6614, 5, 0}, {6620, 4, 0},
+};
+
+static char TERRITORY_NAMES_UNPACKED_ID[6625];
+
+static const PackedTerritoryNames PACKED_TERRITORY_NAMES_ID = {
+        TERRITORY_NAMES_UNPACKED_ID, 6625, TERRITORY_NAMES_PACKED_ID, 3316, TERRITORY_NAMES_PAIRS_ID,
+        TERRITORY_NAME_ALTERNATIVES_START_ID, TERRITORY_NAME_ALTERNATIVES_ID};
+
+#else
+
+static const PackedTerritoryNames PACKED_TERRITORY_NAMES_ID = {NULL, 0, NULL, 0, NULL, NULL, NULL};
+
+#endif // MAPCODE_SUPPORT_LANGUAGE_ID
+
+#ifdef MAPCODE_SUPPORT_LANGUAGE_IT // Italian
+
+// 6749 bytes, packed to 3388
+static const unsigned char TERRITORY_NAMES_PACKED_IT[3388] = {
+        86, 33, 11, 2, 242, 67, 29, 116, 195, 160, 32, 48, 86, 33, 11, 2, 242, 227, 3, 83, 202, 21, 77, 12,
+        158, 17, 71, 151, 131, 116, 92, 1, 84, 111, 107, 15, 180, 187, 67, 111, 99, 95, 124, 55, 75, 101, 15, 147,
+        223, 174, 45, 66, 190, 104, 15, 101, 109, 121, 123, 97, 52, 117, 134, 117, 118, 9, 117, 58, 158, 180, 62, 174,
+        32, 77, 97, 190, 22, 223, 174, 45, 77, 190, 6, 123, 13, 102, 16, 107, 136, 80, 104, 131, 108, 132, 32, 219,
+        124, 80, 104, 131, 108, 132, 32, 219, 187, 80, 29, 99, 97, 64, 110, 0, 46, 3, 66, 111, 117, 118, 94, 161,
+        10, 109, 57, 1, 247, 236, 166, 29, 2, 110, 11, 39, 42, 108, 96, 79, 99, 101, 2, 39, 177, 100, 105, 2,
+        17, 83, 126, 226, 6, 17, 59, 217, 205, 121, 125, 110, 103, 117, 131, 108, 143, 12, 116, 115, 10, 24, 116, 189,
+        10, 205, 121, 0, 46, 3, 63, 78, 33, 216, 87, 9, 108, 50, 136, 70, 152, 61, 142, 70, 152, 61, 1, 55,
+        229, 234, 25, 166, 29, 2, 110, 175, 21, 76, 105, 101, 93, 116, 22, 4, 101, 6, 125, 243, 98, 1, 55, 226,
+        115, 104, 9, 108, 62, 31, 111, 3, 224, 10, 11, 2, 21, 55, 67, 111, 111, 107, 223, 174, 220, 105, 92, 14,
+        14, 77, 105, 113, 117, 15, 12, 124, 77, 105, 113, 117, 15, 12, 123, 105, 117, 21, 83, 97, 174, 32, 75, 29,
+        116, 115, 136, 78, 101, 118, 50, 124, 78, 101, 118, 50, 187, 67, 130, 109, 27, 66, 12, 97, 64, 101, 44, 32,
+        179, 32, 69, 117, 4, 33, 117, 50, 136, 83, 139, 142, 83, 139, 142, 179, 32, 69, 117, 4, 33, 105, 184, 58,
+        9, 100, 105, 118, 21, 227, 96, 69, 108, 22, 97, 44, 32, 65, 115, 99, 22, 115, 203, 14, 14, 84, 114, 105,
+        4, 126, 100, 163, 61, 104, 142, 65, 115, 99, 22, 115, 203, 101, 124, 84, 114, 105, 4, 126, 100, 163, 61, 104,
+        143, 9, 116, 1, 150, 22, 51, 1, 85, 83, 32, 86, 64, 234, 32, 219, 115, 124, 55, 229, 234, 105, 44, 32,
+        85, 83, 65, 58, 130, 170, 116, 21, 83, 118, 9, 98, 255, 136, 74, 126, 77, 130, 22, 124, 74, 126, 77, 130,
+        22, 223, 174, 32, 86, 254, 156, 136, 150, 22, 51, 215, 124, 150, 22, 51, 6, 21, 55, 72, 101, 255, 136, 77,
+        99, 68, 12, 9, 100, 124, 55, 77, 99, 68, 12, 9, 100, 161, 8, 98, 51, 95, 125, 110, 116, 204, 117, 3,
+        14, 66, 8, 98, 57, 142, 66, 8, 98, 57, 135, 117, 24, 99, 97, 17, 83, 101, 121, 93, 15, 108, 43, 208,
+        9, 180, 187, 226, 105, 2, 110, 14, 115, 230, 156, 114, 203, 9, 23, 65, 110, 100, 13, 114, 209, 31, 0, 46,
+        3, 63, 77, 27, 227, 3, 76, 117, 99, 5, 77, 11, 114, 12, 43, 105, 142, 179, 33, 25, 70, 202, 10, 33,
+        25, 63, 77, 11, 114, 12, 43, 173, 147, 199, 13, 21, 84, 128, 210, 60, 6, 192, 66, 140, 24, 6, 153, 64,
+        151, 33, 23, 84, 52, 107, 115, 136, 67, 97, 11, 95, 124, 67, 97, 11, 95, 223, 39, 84, 60, 14, 14, 80,
+        114, 254, 132, 101, 124, 80, 114, 254, 132, 21, 72, 128, 32, 75, 128, 58, 190, 6, 192, 55, 70, 8, 111, 21,
+        59, 97, 42, 111, 117, 112, 21, 67, 60, 13, 21, 77, 97, 52, 29, 105, 184, 0, 37, 61, 203, 0, 76, 184,
+        205, 109, 98, 52, 103, 17, 83, 31, 111, 1, 71, 101, 13, 103, 105, 245, 136, 50, 16, 14, 83, 28, 119, 175,
+        32, 48, 138, 124, 55, 83, 28, 119, 175, 32, 77, 10, 169, 203, 9, 23, 80, 16, 6, 43, 168, 233, 251, 43,
+        21, 67, 199, 39, 229, 100, 21, 84, 114, 6, 169, 51, 136, 84, 239, 129, 242, 84, 239, 129, 17, 166, 61, 101,
+        23, 167, 14, 180, 146, 9, 25, 14, 162, 190, 175, 14, 233, 251, 43, 23, 80, 117, 10, 116, 39, 82, 218, 67,
+        132, 114, 17, 76, 151, 2, 17, 71, 105, 31, 97, 192, 71, 194, 5, 81, 33, 8, 187, 70, 9, 107, 56, 250,
+        2, 117, 33, 117, 58, 12, 116, 22, 181, 114, 17, 66, 140, 31, 34, 134, 159, 13, 32, 69, 4, 62, 119, 200,
+        105, 56, 153, 117, 119, 97, 29, 187, 70, 204, 23, 78, 183, 163, 9, 202, 12, 173, 108, 38, 22, 5, 30, 24,
+        15, 21, 247, 236, 80, 9, 101, 4, 6, 43, 21, 69, 108, 32, 83, 9, 118, 51, 13, 161, 15, 182, 21, 68,
+        106, 151, 111, 152, 23, 77, 158, 202, 12, 5, 82, 117, 28, 1, 72, 97, 29, 23, 66, 52, 61, 100, 23, 59,
+        215, 3, 69, 113, 117, 33, 13, 105, 216, 176, 98, 144, 55, 83, 9, 60, 12, 21, 198, 109, 22, 5, 76, 43,
+        170, 17, 66, 15, 103, 235, 77, 16, 100, 38, 209, 215, 97, 45, 66, 222, 180, 134, 97, 105, 119, 27, 66, 104,
+        152, 27, 83, 118, 182, 122, 10, 1, 79, 56, 210, 2, 159, 8, 99, 1, 69, 4, 12, 5, 53, 68, 60, 6,
+        11, 154, 83, 108, 38, 158, 93, 213, 111, 4, 3, 82, 192, 66, 95, 110, 105, 97, 45, 69, 114, 122, 181, 38,
+        6, 135, 114, 111, 200, 214, 241, 17, 76, 230, 12, 5, 76, 29, 117, 144, 83, 114, 25, 76, 2, 107, 1, 71,
+        101, 13, 103, 5, 225, 56, 1, 83, 105, 92, 3, 76, 101, 12, 21, 80, 2, 31, 1, 53, 67, 201, 209, 105,
+        2, 3, 233, 251, 43, 21, 69, 109, 105, 24, 116, 25, 65, 24, 98, 25, 228, 29, 23, 65, 244, 253, 122, 10,
+        98, 97, 105, 106, 27, 83, 10, 98, 5, 71, 105, 148, 144, 80, 13, 116, 241, 9, 108, 17, 228, 103, 104, 10,
+        213, 13, 101, 245, 0, 219, 209, 33, 101, 109, 9, 135, 117, 98, 1, 66, 117, 108, 103, 8, 5, 76, 151, 10,
+        5, 72, 12, 100, 117, 24, 115, 161, 22, 6, 0, 76, 96, 69, 114, 29, 114, 101, 143, 9, 97, 119, 23, 67,
+        13, 101, 127, 110, 148, 123, 11, 8, 129, 117, 1, 150, 201, 214, 97, 106, 105, 107, 238, 66, 91, 108, 51, 197,
+        123, 101, 112, 9, 134, 61, 50, 173, 52, 6, 31, 21, 85, 243, 103, 117, 130, 206, 194, 241, 173, 64, 173, 22,
+        181, 9, 153, 121, 114, 103, 121, 122, 145, 66, 105, 15, 13, 184, 115, 5, 59, 121, 154, 76, 97, 95, 0, 82,
+        60, 144, 71, 104, 154, 85, 103, 28, 1, 37, 103, 110, 39, 228, 29, 242, 83, 99, 111, 122, 105, 142, 150, 126,
+        166, 94, 129, 110, 142, 225, 56, 127, 178, 124, 225, 56, 97, 44, 32, 48, 178, 0, 59, 215, 1, 69, 99, 117,
+        51, 13, 62, 140, 8, 3, 111, 99, 99, 169, 156, 9, 101, 124, 83, 140, 8, 97, 119, 23, 71, 139, 12, 123,
+        183, 3, 90, 15, 28, 1, 66, 52, 107, 6, 3, 70, 34, 17, 70, 131, 132, 112, 6, 21, 73, 116, 9, 5,
+        79, 109, 27, 80, 16, 12, 213, 111, 4, 3, 100, 96, 65, 118, 13, 235, 78, 13, 118, 181, 5, 77, 9, 130,
+        115, 5, 86, 105, 94, 110, 31, 248, 6, 56, 213, 128, 111, 45, 66, 24, 122, 122, 231, 131, 108, 21, 71, 10,
+        109, 144, 71, 105, 199, 112, 12, 21, 90, 159, 98, 139, 119, 21, 80, 8, 129, 117, 130, 249, 24, 113, 58, 8,
+        111, 99, 99, 17, 85, 122, 98, 101, 107, 238, 83, 118, 101, 122, 5, 80, 97, 35, 3, 78, 183, 3, 59, 215,
+        135, 31, 10, 61, 134, 52, 107, 109, 22, 238, 83, 112, 129, 110, 1, 84, 97, 105, 56, 5, 89, 101, 109, 22,
+        248, 114, 251, 5, 55, 195, 133, 56, 153, 22, 5, 66, 170, 115, 119, 2, 143, 51, 129, 34, 99, 8, 0, 85,
+        99, 24, 6, 1, 138, 126, 48, 138, 186, 67, 156, 24, 233, 11, 154, 83, 60, 9, 5, 97, 102, 103, 104, 2,
+        238, 77, 121, 2, 109, 8, 124, 66, 64, 109, 144, 90, 194, 5, 157, 131, 21, 84, 52, 93, 5, 80, 141, 238,
+        77, 111, 122, 194, 218, 78, 31, 151, 5, 86, 22, 101, 122, 117, 15, 211, 204, 10, 214, 2, 122, 144, 69, 103,
+        29, 116, 17, 77, 97, 52, 29, 144, 66, 16, 105, 118, 5, 69, 116, 105, 111, 112, 213, 16, 60, 98, 5, 138,
+        32, 65, 233, 11, 143, 9, 23, 65, 110, 103, 16, 211, 204, 10, 0, 157, 51, 208, 10, 195, 185, 58, 128, 16,
+        5, 225, 27, 76, 151, 5, 138, 27, 177, 100, 12, 43, 5, 68, 105, 146, 230, 39, 70, 202, 10, 216, 84, 108,
+        97, 120, 99, 9, 143, 13, 15, 95, 125, 103, 117, 34, 99, 191, 156, 43, 206, 16, 159, 1, 81, 117, 10, 94,
+        8, 17, 72, 169, 9, 103, 17, 179, 33, 39, 48, 77, 43, 115, 218, 84, 139, 34, 99, 17, 78, 130, 8, 29,
+        0, 59, 2, 97, 106, 117, 33, 17, 80, 117, 101, 7, 1, 89, 117, 99, 33, 27, 81, 117, 174, 2, 3, 82,
+        111, 17, 83, 6, 9, 111, 135, 31, 112, 101, 93, 21, 77, 175, 111, 158, 27, 83, 126, 76, 117, 50, 220, 170,
+        95, 23, 59, 92, 10, 17, 78, 117, 101, 118, 39, 76, 101, 12, 161, 34, 115, 163, 191, 102, 13, 110, 5, 229,
+        158, 243, 122, 0, 157, 105, 199, 34, 161, 34, 115, 163, 191, 102, 13, 110, 105, 245, 0, 90, 158, 33, 201, 34,
+        189, 9, 50, 99, 17, 84, 31, 180, 108, 132, 34, 0, 79, 97, 120, 158, 210, 52, 91, 17, 67, 111, 140, 117,
+        131, 1, 83, 12, 13, 135, 104, 105, 104, 117, 140, 117, 1, 150, 111, 22, 56, 253, 24, 98, 168, 83, 97, 57,
+        29, 135, 128, 111, 45, 75, 6, 115, 104, 34, 1, 176, 103, 10, 5, 75, 200, 141, 104, 145, 198, 103, 156, 6,
+        210, 31, 126, 28, 32, 68, 105, 117, 207, 51, 114, 3, 14, 78, 129, 8, 32, 72, 231, 15, 23, 157, 28, 204,
+        8, 104, 125, 110, 100, 31, 2, 14, 14, 78, 11, 239, 8, 0, 76, 141, 115, 104, 51, 119, 101, 101, 112, 124,
+        76, 158, 99, 51, 105, 118, 21, 68, 15, 104, 23, 77, 181, 104, 9, 130, 211, 129, 9, 28, 58, 2, 105, 35,
+        114, 134, 114, 105, 35, 114, 143, 182, 13, 31, 62, 105, 107, 107, 159, 208, 61, 106, 139, 188, 8, 121, 154, 198,
+        61, 97, 93, 9, 220, 246, 125, 115, 115, 31, 161, 105, 104, 8, 0, 85, 116, 116, 8, 141, 104, 28, 0, 71,
+        111, 1, 75, 10, 9, 1, 84, 31, 131, 32, 78, 51, 117, 188, 159, 97, 93, 9, 220, 246, 189, 31, 109, 117,
+        136, 75, 221, 109, 64, 0, 157, 104, 33, 116, 50, 103, 8, 104, 189, 104, 8, 107, 104, 28, 153, 8, 110, 33,
+        141, 1, 82, 97, 106, 18, 104, 27, 79, 100, 50, 104, 142, 79, 114, 222, 209, 106, 8, 33, 0, 87, 101, 4,
+        32, 66, 22, 103, 9, 58, 51, 104, 121, 3, 80, 246, 134, 15, 91, 154, 65, 110, 100, 104, 114, 3, 80, 246,
+        58, 140, 8, 221, 116, 114, 1, 85, 116, 116, 8, 220, 246, 208, 57, 117, 93, 92, 121, 123, 183, 39, 71, 9,
+        108, 43, 32, 48, 138, 125, 244, 191, 126, 67, 199, 29, 9, 32, 247, 121, 189, 10, 118, 50, 32, 66, 130, 32,
+        247, 235, 247, 25, 48, 178, 125, 244, 191, 127, 115, 57, 134, 34, 109, 144, 86, 29, 116, 13, 253, 244, 9, 168,
+        79, 99, 99, 169, 156, 216, 81, 117, 101, 22, 115, 56, 207, 105, 146, 29, 39, 70, 202, 10, 9, 62, 10, 103,
+        132, 21, 176, 129, 111, 34, 0, 82, 236, 100, 14, 74, 2, 101, 64, 17, 69, 115, 112, 64, 29, 39, 227, 17,
+        82, 236, 150, 28, 14, 100, 39, 78, 13, 116, 21, 80, 8, 97, 151, 1, 227, 163, 33, 8, 6, 1, 80, 217,
+        194, 117, 99, 17, 224, 199, 135, 101, 8, 1, 65, 99, 114, 21, 80, 8, 154, 82, 13, 97, 159, 1, 82, 12,
+        100, 12, 173, 126, 80, 97, 16, 17, 80, 105, 180, 23, 84, 111, 99, 162, 6, 115, 0, 82, 236, 150, 28, 14,
+        100, 39, 83, 117, 108, 58, 8, 2, 104, 97, 17, 71, 111, 105, 34, 58, 33, 39, 150, 95, 115, 39, 100, 39,
+        83, 117, 108, 161, 140, 5, 77, 6, 34, 32, 71, 10, 97, 50, 58, 33, 39, 150, 95, 115, 17, 80, 8, 195,
+        160, 125, 109, 200, 12, 34, 207, 105, 146, 230, 39, 42, 108, 163, 16, 60, 98, 5, 82, 104, 240, 14, 219, 207,
+        15, 97, 119, 8, 21, 67, 12, 110, 201, 116, 11, 152, 123, 232, 32, 74, 10, 205, 121, 123, 232, 32, 72, 31,
+        112, 115, 104, 64, 21, 229, 109, 12, 116, 58, 34, 115, 97, 93, 184, 230, 115, 188, 97, 119, 97, 105, 23, 226,
+        121, 56, 250, 64, 234, 168, 79, 99, 99, 169, 156, 216, 67, 8, 16, 6, 245, 58, 97, 6, 21, 177, 100, 105,
+        154, 75, 156, 117, 99, 107, 121, 134, 22, 110, 43, 205, 21, 86, 64, 234, 5, 79, 104, 235, 80, 22, 110, 115,
+        121, 108, 118, 144, 77, 222, 222, 132, 112, 23, 76, 111, 117, 50, 105, 154, 176, 139, 31, 1, 198, 107, 252, 34,
+        206, 8, 16, 6, 127, 178, 123, 232, 32, 89, 13, 107, 249, 111, 119, 1, 73, 108, 108, 6, 111, 50, 0, 71,
+        101, 13, 103, 5, 87, 50, 99, 12, 115, 6, 248, 108, 13, 169, 143, 222, 111, 52, 23, 79, 107, 108, 140, 60,
+        210, 141, 170, 127, 178, 0, 87, 221, 147, 116, 12, 207, 141, 170, 245, 123, 101, 98, 24, 54, 1, 75, 252, 34,
+        249, 100, 140, 17, 85, 116, 140, 58, 6, 110, 43, 170, 143, 175, 204, 27, 87, 121, 60, 147, 0, 79, 114, 181,
+        12, 206, 16, 13, 51, 17, 78, 101, 118, 51, 1, 198, 182, 12, 211, 183, 39, 77, 43, 115, 218, 77, 12, 116,
+        2, 135, 191, 102, 13, 110, 214, 101, 120, 34, 125, 108, 34, 107, 1, 166, 29, 50, 104, 32, 67, 16, 117, 109,
+        98, 5, 176, 98, 10, 116, 1, 79, 110, 116, 8, 235, 81, 117, 101, 98, 201, 62, 34, 107, 33, 93, 232, 27,
+        77, 2, 29, 239, 1, 167, 2, 38, 211, 232, 32, 166, 61, 115, 119, 11, 107, 124, 78, 183, 39, 166, 61, 115,
+        119, 11, 107, 123, 183, 3, 83, 99, 111, 122, 5, 46, 127, 80, 114, 254, 132, 14, 69, 100, 111, 255, 17, 89,
+        117, 107, 12, 134, 92, 193, 25, 48, 178, 38, 101, 4, 123, 61, 231, 152, 0, 177, 100, 253, 244, 9, 5, 66,
+        24, 115, 131, 21, 85, 83, 65, 124, 179, 33, 25, 228, 29, 25, 100, 96, 224, 10, 11, 142, 224, 10, 11, 143,
+        43, 115, 218, 77, 95, 99, 1, 83, 126, 80, 105, 94, 114, 239, 52, 103, 17, 75, 9, 6, 147, 164, 186, 177,
+        103, 184, 99, 101, 122, 5, 53, 65, 100, 121, 103, 101, 1, 79, 115, 205, 122, 105, 127, 178, 45, 176, 2, 168,
+        49, 1, 75, 139, 255, 6, 111, 45, 66, 9, 107, 8, 32, 41, 40, 153, 8, 97, 93, 130, 45, 157, 10, 107,
+        43, 115, 32, 41, 40, 186, 99, 201, 22, 135, 104, 117, 118, 221, 32, 41, 40, 249, 118, 2, 38, 111, 36, 76,
+        132, 94, 165, 79, 114, 121, 16, 36, 84, 117, 108, 1, 172, 66, 15, 103, 13, 240, 250, 108, 51, 159, 64, 36,
+        75, 52, 165, 75, 9, 117, 103, 212, 84, 194, 38, 36, 166, 121, 2, 165, 89, 8, 95, 108, 231, 108, 36, 82,
+        121, 200, 2, 36, 172, 65, 4, 24, 93, 27, 77, 95, 99, 111, 119, 36, 83, 109, 16, 22, 54, 186, 48, 68,
+        129, 104, 101, 145, 86, 13, 12, 101, 122, 104, 36, 78, 38, 103, 13, 240, 36, 80, 54, 38, 153, 111, 146, 60,
+        212, 137, 106, 32, 63, 179, 231, 114, 111, 112, 16, 149, 0, 137, 115, 110, 240, 8, 196, 53, 75, 9, 109, 121,
+        107, 214, 118, 10, 36, 76, 22, 147, 164, 36, 82, 111, 4, 38, 36, 172, 86, 16, 103, 241, 164, 250, 16, 241,
+        100, 212, 77, 52, 109, 2, 165, 53, 67, 8, 15, 5, 79, 107, 243, 103, 32, 97, 152, 12, 60, 3, 78, 22,
+        94, 115, 186, 63, 75, 60, 23, 198, 107, 104, 91, 15, 165, 53, 77, 148, 38, 5, 78, 182, 104, 110, 121, 32,
+        78, 38, 103, 13, 240, 36, 80, 22, 122, 212, 75, 64, 38, 36, 226, 25, 69, 108, 32, 41, 40, 0, 79, 114,
+        22, 98, 52, 103, 36, 85, 108, 121, 2, 38, 165, 80, 10, 109, 196, 53, 66, 221, 107, 13, 116, 111, 145, 53,
+        63, 85, 100, 109, 52, 116, 5, 53, 84, 33, 8, 145, 83, 31, 8, 212, 172, 83, 8, 33, 38, 0, 89, 31,
+        9, 111, 45, 78, 22, 94, 115, 153, 104, 162, 121, 45, 77, 252, 23, 83, 118, 10, 100, 108, 38, 165, 84, 121,
+        117, 109, 22, 36, 75, 52, 103, 2, 36, 157, 15, 121, 139, 6, 165, 53, 66, 52, 121, 33, 5, 90, 139, 130,
+        107, 9, 54, 121, 196, 172, 225, 107, 152, 54, 0, 172, 78, 38, 95, 151, 64, 54, 134, 60, 54, 0, 172, 79,
+        109, 54, 186, 75, 104, 141, 34, 115, 5, 172, 75, 101, 109, 10, 38, 17, 53, 42, 108, 96, 176, 116, 97, 106,
+        125, 108, 116, 97, 25, 171, 53, 84, 117, 118, 1, 137, 115, 110, 111, 121, 8, 54, 196, 77, 129, 51, 2, 36,
+        157, 117, 107, 170, 107, 3, 79, 107, 243, 103, 153, 31, 93, 33, 107, 3, 171, 83, 141, 104, 9, 6, 36, 80,
+        114, 159, 13, 54, 121, 196, 155, 97, 152, 12, 60, 3, 101, 98, 24, 192, 75, 104, 139, 8, 38, 54, 196, 26,
+        53, 63, 83, 141, 104, 142, 89, 141, 152, 168, 49, 135, 2, 51, 1, 82, 184, 115, 173, 104, 91, 104, 97, 23,
+        84, 105, 2, 106, 6, 208, 101, 93, 6, 17, 72, 97, 6, 27, 78, 147, 120, 168, 72, 117, 23, 157, 128, 113,
+        147, 0, 90, 104, 101, 106, 237, 189, 237, 115, 117, 248, 117, 106, 105, 27, 65, 110, 104, 117, 23, 76, 105, 97,
+        12, 147, 62, 104, 28, 128, 62, 104, 2, 120, 23, 74, 237, 120, 23, 72, 22, 27, 59, 182, 104, 111, 117, 0,
+        59, 91, 100, 128, 188, 117, 98, 101, 23, 74, 131, 6, 188, 101, 98, 101, 23, 83, 104, 97, 2, 120, 23, 78,
+        101, 25, 77, 128, 16, 124, 77, 128, 16, 168, 177, 116, 217, 1, 72, 101, 131, 128, 106, 237, 188, 61, 27, 59,
+        91, 120, 25, 90, 104, 117, 91, 62, 175, 117, 27, 89, 61, 110, 27, 88, 182, 91, 124, 84, 151, 94, 0, 71,
+        252, 117, 0, 81, 147, 104, 97, 23, 88, 6, 106, 237, 32, 85, 121, 103, 104, 52, 206, 6, 1, 55, 109, 6,
+        13, 25, 101, 4, 217, 14, 100, 181, 108, 25, 179, 33, 25, 228, 29, 25, 100, 96, 224, 10, 192, 46, 163, 108,
+        132, 112, 10, 116, 12, 125, 110, 116, 190, 169, 21, 177, 116, 217, 200, 203, 9, 101, 124, 73, 108, 32, 109, 12,
+        100, 242, 167, 1,
+};
+
+static const unsigned char TERRITORY_NAMES_PAIRS_IT[256][2] = {
+        {0, 0}, {97, 0}, {97, 110}, {97, 32}, {115, 116}, {105, 1}, {105, 110}, {98, 108}, {97, 114}, {97, 108}, {101, 114}, {105, 99},
+        {111, 110}, {111, 114}, {101, 32}, {101, 108}, {111, 108}, {111, 0}, {97, 4}, {7, 18}, {79, 19}, {101, 0}, {101, 110}, {105, 0},
+        {114, 97}, {105, 32}, {20, 0}, {2, 0}, {2, 100}, {105, 116}, {73, 115}, {97, 109}, {32, 32}, {97, 116}, {97, 115}, {112, 117},
+        {32, 26}, {82, 101}, {111, 118}, {111, 32}, {7, 11}, {37, 35}, {100, 15}, {101, 115}, {44, 44}, {45, 45}, {30, 16}, {41, 98},
+        {42, 32}, {47, 40}, {105, 115}, {97, 100}, {117, 114}, {49, 3}, {115, 107}, {46, 14}, {108, 28}, {117, 100}, {0, 77}, {71, 117},
+        {111, 109}, {117, 110}, {0, 83}, {100, 25}, {105, 114}, {65, 65}, {66, 66}, {67, 67}, {68, 68}, {69, 69}, {70, 70}, {71, 71},
+        {72, 72}, {73, 73}, {74, 74}, {75, 75}, {76, 76}, {77, 77}, {78, 78}, {79, 79}, {80, 80}, {81, 81}, {82, 82}, {83, 83},
+        {84, 84}, {85, 85}, {86, 86}, {87, 87}, {88, 88}, {89, 89}, {90, 90}, {2, 103}, {10, 114}, {99, 104}, {101, 116}, {111, 115},
+        {96, 96}, {97, 97}, {98, 98}, {99, 99}, {100, 100}, {101, 101}, {102, 102}, {103, 103}, {104, 104}, {105, 105}, {106, 106}, {107, 107},
+        {108, 108}, {109, 109}, {110, 110}, {111, 111}, {112, 112}, {113, 113}, {114, 114}, {115, 115}, {116, 116}, {117, 117}, {118, 118}, {119, 119},
+        {120, 120}, {121, 121}, {122, 122}, {0, 78}, {124, 124}, {0, 65}, {2, 32}, {3, 48}, {12, 103}, {97, 103}, {97, 121}, {105, 108},
+        {105, 112}, {133, 133}, {0, 84}, {1, 67}, {32, 14}, {75, 24}, {83, 57}, {97, 98}, {97, 104}, {97, 107}, {97, 124}, {1, 77},
+        {2, 5}, {4, 27}, {4, 114}, {6, 103}, {13, 100}, {32, 96}, {71, 114}, {105, 98}, {117, 116}, {0, 75}, {2, 1}, {20, 149},
+        {22, 116}, {67, 104}, {97, 99}, {105, 109}, {160, 160}, {0, 66}, {2, 116}, {3, 67}, {24, 100}, {54, 36}, {66, 114}, {84, 92},
+        {105, 3}, {105, 100}, {111, 116}, {137, 23}, {155, 63}, {5, 83}, {6, 116}, {11, 104}, {65, 108}, {73, 110}, {78, 148}, {83, 116},
+        {97, 117}, {101, 103}, {105, 122}, {117, 38}, {117, 115}, {185, 185}, {0, 53}, {0, 55}, {0, 72}, {0, 74}, {8, 116}, {9, 105},
+        {11, 1}, {29, 13}, {31, 98}, {195, 195}, {32, 171}, {43, 104}, {65, 114}, {97, 112}, {97, 122}, {101, 99}, {101, 100}, {105, 12},
+        {105, 103}, {115, 101}, {0, 67}, {0, 68}, {0, 80}, {1, 59}, {1, 68}, {1, 78}, {3, 26}, {5, 67}, {5, 84}, {6, 101},
+        {9, 21}, {10, 110}, {11, 17}, {30, 56}, {32, 80}, {34, 104}, {50, 115}, {62, 97}, {65, 109}, {73, 114}, {77, 8}, {83, 162},
+        {85, 110}, {86, 10}, {94, 116}, {97, 118}, {101, 119}, {102, 114}, {103, 6}, {105, 17}, {105, 39}, {105, 91}, {105, 145}, {111, 98},
+        {111, 100}, {111, 103}, {111, 124}, {114, 117}, {117, 146}, {127, 138}, {164, 197}, {167, 193}, {0, 70}, {0, 73}, {0, 86}, {2, 99},
+        {2, 115}, {5, 65}, {6, 99}, {8, 100},
+};
+
+static const unsigned short TERRITORY_NAME_ALTERNATIVES_START_IT[_TERRITORY_MAX - _TERRITORY_MIN] = {
+        0, 3, 4, 5, 6, 8, 9, 10, 11, 12, 13, 14, 16, 17, 18, 19,
+        20, 21, 22, 23, 24, 25, 26, 28, 29, 30, 31, 32, 33, 34, 36, 37,
+        39, 40, 43, 44, 47, 48, 49, 51, 52, 54, 56, 58, 59, 61, 62, 63,
+        64, 65, 66, 67, 68, 69, 71, 72, 73, 74, 75, 76, 78, 80, 81, 82,
+        83, 84, 85, 86, 87, 88, 89, 91, 92, 93, 95, 96, 97, 98, 99, 100,
+        101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116,
+        117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132,
+        133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143, 144, 145, 146, 147, 148,
+        149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159, 160, 161, 162, 163, 164,
+        165, 166, 167, 168, 169, 170, 171, 172, 173, 174, 175, 176, 177, 178, 179, 180,
+        181, 182, 183, 184, 185, 186, 187, 192, 193, 194, 196, 197, 198, 199, 200, 201,
+        202, 203, 204, 205, 206, 207, 208, 209, 210, 211, 212, 213, 214, 215, 216, 217,
+        218, 219, 220, 221, 222, 223, 224, 225, 226, 227, 228, 229, 230, 231, 232, 233,
+        235, 236, 237, 238, 239, 240, 241, 242, 243, 244, 245, 246, 247, 248, 249, 250,
+        251, 252, 253, 254, 255, 256, 257, 258, 259, 260, 261, 262, 263, 264, 265, 266,
+        267, 268, 269, 270, 271, 272, 273, 274, 275, 276, 277, 278, 279, 280, 281, 282,
+        283, 284, 285, 286, 287, 288, 289, 290, 291, 292, 293, 294, 295, 296, 297, 298,
+        299, 300, 301, 302, 304, 305, 306, 307, 308, 309, 310, 311, 312, 313, 314, 315,
+        316, 317, 318, 319, 320, 321, 322, 323, 324, 325, 326, 328, 329, 330, 331, 332,
+        333, 334, 335, 336, 337, 338, 339, 340, 341, 342, 343, 344, 345, 346, 347, 348,
+        349, 350, 351, 352, 353, 354, 355, 356, 357, 358, 359, 360, 361, 362, 363, 364,
+        365, 366, 367, 368, 369, 370, 371, 372, 373, 374, 375, 376, 377, 378, 379, 380,
+        381, 382, 383, 384, 385, 386, 387, 388, 389, 390, 391, 392, 393, 394, 395, 396,
+        397, 398, 399, 400, 401, 402, 403, 404, 405, 406, 407, 408, 409, 410, 411, 412,
+        413, 414, 415, 416, 417, 418, 419, 420, 421, 422, 423, 424, 425, 426, 427, 428,
+        429, 430, 432, 433, 434, 435, 436, 437, 438, 439, 440, 443, 444, 445, 446, 447,
+        448, 449, 450, 451, 452, 453, 454, 455, 456, 457, 458, 459, 460, 461, 462, 463,
+        464, 465, 466, 467, 468, 469, 470, 471, 472, 473, 474, 475, 476, 477, 478, 479,
+        480, 481, 482, 483, 484, 485, 486, 487, 488, 489, 490, 491, 492, 493, 494, 495,
+        496, 497, 498, 499, 500, 501, 502, 503, 504, 505, 506, 507, 508, 509, 510, 511,
+        512, 513, 514, 515, 516, 517, 518, 519, 520, 521, 522, 523, 524, 525, 526, 528,
+        529, 530, 531, 532, 533, 534, 535, 536, 537, 538, 539, 540, 541, 542, 543, 544,
+        545, 546, 547, 548, 549, 550, 551, 553, 554, 555, 556, 557, 558, 560, 561, 562,
+        563, 564, 565, 566, 567, 570,
+};
+
+static const TerritoryNameAlternative TERRITORY_NAME_ALTERNATIVES_IT[570] = {
+        {0, 8, 0}, {9, 19, 0}, {29, 10, 0}, {40, 6, 0}, {47, 10, 0}, {58, 7, 0}, {66, 11, 0}, {78, 13, 0},
+        {92, 16, 0}, {109, 5, 0}, {115, 6, 0}, {122, 5, 0}, {128, 12, 0}, {141, 12, 0}, {154, 24, 0}, {179, 14, 0},
+        {194, 14, 0}, {209, 12, 0}, {222, 7, 0}, {230, 41, 0}, {272, 10, 0}, {283, 8, 0}, {292, 8, 0}, {301, 10, 0},
+        {312, 6, 0}, {319, 15, 0}, {335, 15, 0}, {351, 6, 0}, {358, 25, 0}, {384, 13, 0}, {398, 5, 0}, {404, 14, 0},
+        {419, 15, 0}, {435, 10, 0}, {446, 23, 0}, {470, 8, 0}, {479, 4, 0}, {484, 19, 0}, {504, 5, 0}, {510, 12, 0},
+        {523, 28, 0}, {552, 4, 0}, {557, 12, 0}, {570, 7, 0}, {578, 41, 0}, {620, 10, 0}, {631, 16, 0}, {648, 5, 0},
+        {654, 7, 0}, {662, 17, 0}, {680, 18, 0}, {699, 7, 0}, {707, 20, 0}, {728, 9, 0}, {738, 25, 0}, {764, 9, 0},
+        {774, 22, 0}, {797, 14, 0}, {812, 8, 0}, {821, 17, 0}, {839, 7, 0}, {847, 7, 0}, {855, 10, 0}, {866, 5, 0},
+        {872, 29, 0}, {902, 7, 0}, {910, 4, 0}, {915, 12, 0}, {928, 11, 0}, {940, 10, 0}, {951, 28, 0}, {980, 9, 0},
+        {990, 5, 0}, {996, 8, 0}, {1005, 7, 0}, {1013, 8, 0}, {1022, 14, 0}, {1037, 6, 0}, {1044, 19, 0}, {1064, 8, 0},
+        {1073, 9, 0}, {1083, 9, 0}, {1093, 11, 0}, {1105, 10, 0}, {1116, 6, 0}, {1123, 9, 0}, {1133, 7, 0}, {1141, 11, 0},
+        {1153, 5, 0}, {1159, 40, 0}, {1200, 26, 0}, {1227, 18, 0}, {1246, 10, 0}, {1257, 17, 0}, {1275, 6, 0}, {1282, 6, 0},
+        {1289, 36, 0}, {1326, 11, 0}, {1338, 5, 0}, {1344, 6, 0}, {1351, 8, 0}, {1360, 6, 0}, {1367, 5, 0}, {1373, 14, 0},
+        {1388, 7, 0}, {1396, 10, 0}, {1407, 7, 0}, {1415, 9, 0}, {1425, 9, 0}, {1435, 6, 0}, {1442, 10, 0}, {1453, 15, 0},
+        {1469, 8, 0}, {1478, 7, 0}, {1486, 22, 0}, {1509, 11, 0}, {1521, 6, 0}, {1528, 8, 0}, {1537, 9, 0}, {1547, 6, 0},
+        {1554, 5, 0}, {1560, 7, 0}, {1568, 18, 0}, {1587, 7, 0}, {1595, 14, 0}, {1610, 7, 0}, {1618, 6, 0}, {1625, 6, 0},
+        {1632, 7, 0}, {1640, 13, 0}, {1654, 6, 0}, {1661, 6, 0}, {1668, 8, 0}, {1677, 6, 0}, {1684, 9, 0}, {1694, 7, 0},
+        {1702, 21, 0}, {1724, 10, 0}, {1735, 10, 0}, {1746, 17, 0}, {1764, 7, 0}, {1772, 4, 0}, {1777, 8, 0}, {1786, 8, 0},
+        {1795, 9, 0}, {1805, 7, 0}, {1813, 7, 0}, {1821, 12, 0}, {1834, 6, 0}, {1841, 15, 0}, {1857, 15, 0}, {1873, 19, 0},
+        {1893, 7, 0}, {1901, 10, 0}, {1912, 6, 0}, {1919, 9, 0}, {1929, 10, 0}, {1940, 8, 0}, {1949, 13, 0}, {1963, 7, 0},
+        {1971, 9, 0}, {1981, 4, 0}, {1986, 8, 0}, {1995, 7, 0}, {2003, 8, 0}, {2012, 5, 0}, {2018, 9, 0}, {2028, 6, 0},
+        {2035, 14, 0}, {2050, 9, 0}, {2060, 6, 0}, {2067, 10, 0}, {2078, 10, 0}, {2089, 5, 0}, {2095, 7, 0}, {2103, 8, 0},
+        {2112, 7, 0}, {2120, 8, 0}, {2129, 5, 0}, {2135, 7, 0}, {2143, 10, 0}, {2154, 11, 0}, {2166, 6, 0}, {2173, 4, 0},
+        {2178, 7, 0}, {2186, 5, 0}, {2192, 6, 0}, {2199, 11, 0}, {2211, 6, 0}, {2218, 13, 0}, {2232, 16, 0}, {2249, 17, 0},
+        {2267, 6, 0}, {2274, 7, 0}, {2282, 18, 0}, {2301, 8, 0}, {2310, 5, 0}, {2316, 13, 0}, {2330, 12, 0}, {2343, 9, 0},
+        {2353, 6, 0}, {2360, 4, 0}, {2365, 7, 0}, {2373, 14, 0}, {2388, 8, 0}, {2397, 8, 0}, {2406, 7, 0}, {2414, 9, 0},
+        {2424, 17, 0}, {2442, 8, 0}, {2451, 8, 0}, {2460, 8, 0}, {2469, 8, 0}, {2478, 4, 0}, {2483, 7, 0}, {2491, 10, 0},
+        {2502, 6, 0}, {2509, 18, 0}, {2528, 7, 0}, {2536, 12, 0}, {2549, 6, 0}, {2556, 9, 0}, {2566, 5, 0}, {2572, 7, 0},
+        {2580, 12, 0}, {2593, 5, 0}, {2599, 8, 0}, {2608, 10, 0}, {2619, 7, 0}, {2627, 13, 0}, {2641, 24, 0}, {2666, 7, 0},
+        {2674, 11, 0}, {2686, 7, 0}, {2694, 8, 0}, {2703, 6, 0}, {2710, 5, 0}, {2716, 7, 0}, {2724, 8, 0}, {2733, 9, 0},
+        {2743, 7, 0}, {2751, 9, 0}, {2761, 7, 0}, {2769, 8, 0}, {2778, 6, 0}, {2785, 10, 0}, {2796, 7, 0}, {2804, 7, 0},
+        {2812, 8, 0}, {2821, 10, 0}, {2832, 4, 0}, {2837, 6, 0}, {2844, 5, 0}, {2850, 4, 0}, {2855, 5, 0}, {2861, 8, 0},
+        {2870, 4, 0}, {2875, 5, 0}, {2881, 5, 0}, {2887, 9, 0}, {2897, 18, 0}, {2916, 8, 0}, {2925, 7, 0}, {2933, 14, 0},
+        {2948, 6, 0}, {2955, 9, 0}, {2965, 7, 0}, {2973, 17, 0}, {2991, 7, 0}, {2999, 7, 0}, {3007, 10, 0}, {3018, 6, 0},
+        {3025, 7, 0}, {3033, 12, 0}, {3046, 7, 0}, {3054, 8, 0}, {3063, 9, 0}, {3073, 15, 0}, {3089, 8, 0}, {3098, 10, 0},
+        {3109, 16, 0}, {3126, 8, 0}, {3135, 7, 0}, {3143, 24, 0}, {3168, 9, 0}, {3178, 7, 0}, {3186, 10, 0}, {3197, 6, 0},
+        {3204, 7, 0}, {3212, 8, 0}, {3221, 6, 0}, {3228, 9, 0}, {3238, 11, 0}, {3250, 14, 0}, {3265, 14, 0}, {3280, 7, 0},
+        {3288, 10, 0}, {3299, 9, 0}, {3309, 13, 0}, {3323, 20, 0}, {3344, 10, 0}, {3355, 18, 0}, {3374, 11, 0}, {3386, 9, 0},
+        {3396, 5, 0}, {3402, 9, 0}, {3412, 8, 0}, {3421, 7, 0}, {3429, 7, 0}, {3437, 7, 0}, {3445, 6, 0}, {3452, 6, 0},
+        {3459, 7, 0}, {3467, 17, 0}, {3485, 5, 0}, {3491, 5, 0}, {3497, 11, 0}, {3509, 3, 0}, {3513, 6, 0}, {3520, 10, 0},
+        {3531, 16, 0}, {3548, 15, 0}, {3564, 12, 0}, {3577, 9, 0}, {3587, 9, 0}, {3597, 9, 0}, {3607, 6, 0}, {3614, 6, 0},
+        {3621, 7, 0}, {3629, 11, 0}, {3641, 14, 0}, {3656, 9, 0}, {3666, 14, 0}, {3681, 11, 0}, {3693, 13, 0}, {3707, 10, 0},
+        {3718, 20, 0}, {3739, 28, 0}, {3768, 21, 0}, {3790, 18, 0}, {3809, 17, 0}, {3827, 8, 0}, {3836, 8, 0}, {3845, 21, 0},
+        {3867, 10, 0}, {3878, 16, 0}, {3895, 7, 0}, {3903, 7, 0}, {3911, 14, 0}, {3926, 14, 0}, {3941, 19, 0}, {3961, 7, 0},
+        {3969, 14, 0}, {3984, 10, 0}, {3995, 5, 0}, {4001, 5, 0}, {4007, 4, 0}, {4012, 6, 0}, {4019, 7, 0}, {4027, 8, 0},
+        {4036, 9, 0}, {4046, 5, 0}, {4052, 9, 0}, {4062, 17, 0}, {4080, 8, 0}, {4089, 5, 0}, {4095, 18, 0}, {4114, 5, 0},
+        {4120, 12, 0}, {4133, 11, 0}, {4145, 5, 0}, {4151, 8, 0}, {4160, 24, 0}, {4185, 12, 0}, {4198, 8, 0}, {4207, 11, 0},
+        {4219, 10, 0}, {4230, 13, 0}, {4244, 7, 0}, {4252, 13, 0}, {4266, 6, 0}, {4273, 8, 0}, {4282, 20, 0}, {4303, 16, 0},
+        {4320, 5, 0}, {4326, 7, 0}, {4334, 8, 0}, {4343, 9, 0}, {4353, 8, 0}, {4362, 4, 0}, {4367, 12, 0}, {4380, 11, 0},
+        {4392, 9, 0}, {4402, 7, 0}, {4410, 8, 0}, {4419, 17, 0}, {4437, 8, 0}, {4446, 4, 0}, {4451, 8, 0}, {4460, 7, 0},
+        {4468, 9, 0}, {4478, 7, 0}, {4486, 8, 0}, {4495, 8, 0}, {4504, 15, 0}, {4520, 10, 0}, {4531, 14, 0}, {4546, 8, 0},
+        {4555, 6, 0}, {4562, 5, 0}, {4568, 4, 0}, {4573, 9, 0}, {4583, 8, 0}, {4592, 7, 0}, {4600, 6, 0}, {4607, 8, 0},
+        {4616, 6, 0}, {4623, 7, 0}, {4631, 13, 0}, {4645, 7, 0}, {4653, 10, 0}, {4664, 5, 0}, {4670, 6, 0}, {4677, 16, 0},
+        {4694, 7, 0}, {4702, 7, 0}, {4710, 6, 0}, {4717, 12, 0}, {4730, 8, 0}, {4739, 9, 0}, {4749, 13, 0}, {4763, 15, 0},
+        {4779, 12, 0}, {4792, 26, 0}, {4819, 5, 0}, {4825, 23, 0}, {4849, 7, 0}, {4857, 5, 0}, {4863, 9, 0}, {4873, 7, 0},
+        {4881, 3, 0}, {4885, 21, 0}, {4907, 7, 0}, {4915, 7, 0}, {4923, 5, 0}, {4929, 15, 0}, {4945, 11, 0}, {4957, 21, 0},
+        {4979, 17, 0}, {4997, 34, 0}, {5032, 25, 0}, {5058, 26, 0}, {5085, 17, 0}, {5103, 16, 0}, {5120, 14, 0}, {5135, 14, 0},
+        {5150, 12, 0}, {5163, 4, 0}, {5168, 19, 0}, {5188, 15, 0}, {5204, 12, 0}, {5217, 13, 0}, {5231, 13, 0}, {5245, 14, 0},
+        {5260, 16, 0}, {5277, 13, 0}, {5291, 20, 0}, {5312, 13, 0}, {5326, 8, 0}, {5335, 24, 0}, {5360, 15, 0}, {5376, 15, 0},
+        {5392, 5, 0}, {5398, 15, 0}, {5414, 19, 0}, {5434, 14, 0}, {5449, 19, 0}, {5469, 11, 0}, {5481, 16, 0}, {5498, 13, 0},
+        {5512, 20, 0}, {5533, 14, 0}, {5548, 15, 0}, {5564, 18, 0}, {5583, 21, 0}, {5605, 18, 0}, {5624, 18, 0}, {5643, 19, 0},
+        {5663, 22, 0}, {5686, 12, 0}, {5699, 12, 0}, {5712, 16, 0}, {5729, 15, 0}, {5745, 16, 0}, {5762, 9, 0}, {5772, 24, 0},
+        {5797, 22, 0}, {5820, 20, 0}, {5841, 13, 0}, {5855, 18, 0}, {5874, 13, 0}, {5888, 12, 0}, {5901, 17, 0}, {5919, 13, 0},
+        {5933, 13, 0}, {5947, 18, 0}, {5966, 19, 0}, {5986, 16, 0}, {6003, 18, 0}, {6022, 22, 0}, {6045, 5, 0}, {6051, 15, 0},
+        {6067, 20, 0}, {6088, 19, 0}, {6108, 21, 0}, {6130, 10, 0}, {6141, 15, 0}, {6157, 16, 0}, {6174, 14, 0}, {6189, 14, 0},
+        {6204, 14, 0}, {6219, 15, 0}, {6235, 14, 0}, {6250, 24, 0}, {6275, 15, 0}, {6291, 6, 0}, {6298, 19, 0}, {6318, 18, 0},
+        {6337, 6, 0}, {6344, 6, 0}, {6351, 8, 0}, {6360, 7, 0}, {6368, 7, 0}, {6376, 6, 0}, {6383, 11, 0}, {6395, 9, 0},
+        {6405, 8, 0}, {6414, 7, 0}, {6422, 6, 0}, {6429, 5, 0}, {6435, 8, 0}, {6444, 8, 0}, {6453, 6, 0}, {6460, 7, 0},
+        {6468, 5, 0}, {6474, 7, 0}, {6482, 9, 0}, {6492, 5, 0}, {6498, 5, 0}, {6504, 5, 0}, {6510, 7, 0}, {6518, 10, 0},
+        {6529, 16, 0}, {6546, 12, 0}, {6559, 5, 0}, {6565, 14, 0}, {6580, 7, 0}, {6588, 6, 0}, {6595, 6, 0}, {6602, 5, 0},
+        {6608, 5, 0}, {6614, 7, 0}, {6622, 15, 0}, {6638, 4, 0}, {6643, 48, 0}, {6692, 16, 0}, {6709, 9, 0}, {6719, 14, 0},
+        {6734, 8, 0}, {6743, 5, 0},
+};
+
+static char TERRITORY_NAMES_UNPACKED_IT[6749];
+
+static const PackedTerritoryNames PACKED_TERRITORY_NAMES_IT = {
+        TERRITORY_NAMES_UNPACKED_IT, 6749, TERRITORY_NAMES_PACKED_IT, 3388, TERRITORY_NAMES_PAIRS_IT,
+        TERRITORY_NAME_ALTERNATIVES_START_IT, TERRITORY_NAME_ALTERNATIVES_IT};
+
+#else
+
+static const PackedTerritoryNames PACKED_TERRITORY_NAMES_IT = {NULL, 0, NULL, 0, NULL, NULL, NULL};
+
+#endif // MAPCODE_SUPPORT_LANGUAGE_IT
+
+#ifdef MAPCODE_SUPPORT_LANGUAGE_JA // Japanese
+
+// 10730 bytes, packed to 3432
+static const unsigned char TERRITORY_NAMES_PACKED_JA[3432] = {
+        26, 58, 28, 5, 229, 184, 130, 31, 124, 230, 149, 153, 231, 154, 135, 229, 186, 129, 108, 21, 65, 203, 113, 12,
+        9, 55, 62, 136, 2, 177, 12, 50, 53, 215, 65, 10, 53, 124, 86, 6, 13, 225, 53, 127, 222, 26, 73, 134,
+        73, 159, 6, 23, 3, 138, 50, 62, 132, 26, 62, 158, 28, 70, 4, 183, 79, 35, 6, 73, 134, 217, 127, 222,
+        35, 9, 55, 87, 142, 33, 149, 95, 218, 226, 168, 57, 40, 250, 93, 23, 124, 57, 40, 250, 93, 220, 63, 3,
+        148, 19, 2, 177, 11, 205, 240, 33, 180, 56, 23, 238, 100, 49, 33, 128, 109, 126, 248, 123, 17, 39, 230, 180,
+        139, 90, 229, 159, 159, 127, 222, 35, 13, 112, 4, 172, 6, 5, 27, 6, 23, 59, 225, 40, 12, 108, 79, 202,
+        12, 19, 203, 36, 88, 6, 242, 248, 35, 10, 23, 241, 95, 248, 38, 57, 111, 21, 124, 57, 111, 21, 0, 232,
+        139, 177, 123, 26, 88, 205, 124, 17, 126, 248, 123, 26, 88, 205, 3, 170, 1, 146, 125, 193, 49, 55, 17, 5,
+        59, 244, 96, 6, 20, 36, 9, 53, 59, 102, 206, 123, 66, 200, 11, 124, 66, 200, 11, 227, 128, 129, 11, 102,
+        206, 242, 48, 29, 53, 127, 14, 148, 74, 118, 23, 38, 100, 29, 25, 217, 124, 100, 29, 25, 217, 3, 139, 50,
+        74, 192, 79, 29, 13, 98, 57, 213, 33, 187, 60, 17, 77, 10, 124, 60, 77, 10, 23, 4, 177, 17, 35, 205,
+        3, 156, 60, 118, 227, 128, 129, 202, 79, 69, 117, 115, 116, 97, 116, 117, 105, 115, 226, 168, 66, 26, 124, 66,
+        26, 124, 202, 79, 1, 166, 6, 76, 125, 40, 50, 10, 108, 73, 135, 40, 113, 192, 79, 1, 152, 68, 21, 227,
+        128, 129, 11, 202, 193, 201, 5, 226, 138, 2, 136, 226, 179, 19, 13, 76, 222, 64, 38, 29, 6, 24, 36, 124,
+        11, 202, 193, 201, 5, 124, 19, 13, 76, 222, 64, 38, 29, 6, 24, 36, 96, 9, 55, 214, 68, 21, 64, 0,
+        231, 177, 179, 123, 26, 88, 205, 124, 231, 177, 179, 123, 26, 88, 205, 96, 1, 168, 48, 19, 23, 4, 185, 26,
+        118, 26, 9, 53, 226, 168, 103, 14, 158, 17, 74, 217, 124, 103, 14, 158, 17, 74, 217, 192, 79, 77, 34, 187,
+        79, 38, 72, 68, 21, 99, 40, 6, 5, 124, 72, 68, 21, 99, 40, 6, 205, 3, 143, 195, 23, 226, 168, 35,
+        29, 54, 21, 9, 54, 53, 124, 35, 29, 54, 21, 9, 54, 53, 238, 244, 54, 10, 59, 14, 134, 40, 72, 11,
+        26, 33, 150, 33, 128, 124, 26, 33, 150, 33, 128, 4, 173, 49, 12, 236, 6, 192, 17, 20, 56, 62, 145, 12,
+        70, 61, 140, 151, 35, 13, 245, 53, 59, 39, 12, 214, 11, 94, 96, 217, 192, 79, 9, 20, 71, 159, 29, 25,
+        60, 20, 11, 124, 100, 29, 25, 60, 20, 11, 233, 128, 163, 233, 130, 166, 4, 183, 34, 172, 1, 157, 219, 136,
+        34, 172, 3, 137, 100, 24, 28, 238, 33, 172, 6, 216, 173, 13, 26, 10, 4, 191, 218, 10, 38, 28, 17, 65,
+        10, 53, 124, 28, 17, 65, 10, 53, 127, 79, 102, 38, 93, 13, 193, 1, 154, 124, 93, 13, 193, 1, 154, 110,
+        166, 153, 230, 184, 175, 96, 73, 134, 40, 24, 218, 23, 239, 56, 25, 6, 53, 214, 11, 54, 9, 33, 151, 23,
+        215, 200, 25, 108, 6, 13, 20, 36, 10, 61, 134, 141, 228, 188, 154, 3, 171, 29, 202, 14, 150, 9, 29, 127,
+        200, 37, 181, 50, 18, 184, 201, 88, 11, 38, 66, 50, 18, 181, 39, 50, 40, 48, 58, 53, 124, 66, 50, 18,
+        181, 39, 50, 40, 48, 58, 53, 239, 12, 5, 10, 123, 1, 157, 13, 60, 20, 37, 171, 33, 156, 199, 73, 135,
+        237, 13, 24, 64, 195, 38, 19, 26, 106, 124, 19, 26, 106, 240, 9, 60, 17, 239, 12, 5, 10, 123, 229, 120,
+        198, 38, 229, 120, 230, 165, 181, 90, 229, 159, 159, 3, 151, 74, 9, 19, 13, 65, 4, 173, 93, 25, 10, 3,
+        172, 26, 112, 5, 203, 36, 35, 17, 28, 4, 172, 14, 147, 37, 171, 55, 219, 149, 95, 218, 63, 53, 238, 1,
+        140, 11, 111, 108, 14, 134, 60, 72, 25, 238, 92, 35, 91, 157, 177, 125, 40, 200, 118, 4, 185, 84, 27, 63,
+        242, 50, 56, 243, 239, 40, 27, 6, 3, 196, 6, 28, 68, 54, 119, 185, 25, 199, 119, 164, 10, 12, 74, 62,
+        145, 68, 10, 58, 21, 123, 82, 159, 4, 168, 9, 66, 244, 54, 62, 153, 221, 235, 203, 113, 58, 96, 2, 177,
+        54, 254, 171, 84, 14, 128, 3, 143, 17, 58, 240, 9, 5, 27, 0, 232, 181, 164, 233, 129, 147, 126, 119, 162,
+        244, 119, 189, 25, 200, 205, 59, 73, 161, 254, 172, 236, 19, 3, 153, 9, 126, 6, 108, 9, 54, 26, 4, 174,
+        208, 77, 66, 50, 61, 143, 176, 230, 185, 190, 240, 6, 55, 216, 185, 17, 10, 4, 170, 12, 14, 128, 3, 135,
+        14, 158, 218, 4, 168, 98, 254, 137, 100, 24, 28, 89, 185, 25, 26, 86, 37, 179, 76, 206, 3, 156, 10, 208,
+        38, 1, 152, 73, 132, 56, 106, 77, 21, 242, 25, 11, 58, 71, 136, 6, 106, 3, 169, 19, 77, 71, 170, 19,
+        11, 119, 185, 13, 12, 5, 28, 203, 201, 88, 37, 162, 17, 9, 63, 4, 183, 74, 12, 68, 70, 60, 3, 145,
+        21, 35, 3, 129, 56, 65, 47, 0, 228, 187, 143, 123, 126, 245, 59, 12, 113, 233, 166, 150, 233, 149, 183, 31,
+        233, 128, 163, 233, 130, 166, 4, 170, 6, 98, 249, 162, 2, 188, 244, 17, 27, 36, 5, 192, 73, 147, 71, 168,
+        9, 64, 87, 157, 9, 19, 78, 62, 143, 34, 172, 221, 110, 159, 147, 31, 59, 17, 10, 63, 214, 11, 125, 35,
+        12, 4, 173, 49, 6, 26, 240, 9, 78, 13, 71, 170, 199, 13, 71, 155, 5, 27, 49, 12, 10, 3, 153, 24,
+        216, 168, 13, 19, 13, 71, 158, 12, 50, 17, 61, 140, 151, 230, 156, 157, 233, 174, 174, 3, 139, 28, 12, 72,
+        37, 174, 13, 20, 36, 4, 191, 27, 86, 76, 87, 144, 225, 247, 224, 3, 141, 234, 219, 129, 49, 24, 27, 37,
+        185, 13, 21, 94, 241, 9, 72, 220, 4, 171, 14, 156, 27, 37, 183, 249, 187, 60, 78, 9, 4, 173, 9, 126,
+        76, 87, 153, 12, 9, 6, 20, 4, 172, 17, 245, 3, 169, 70, 10, 3, 171, 33, 158, 119, 172, 6, 21, 241,
+        78, 14, 128, 109, 126, 248, 124, 253, 48, 19, 63, 124, 17, 126, 248, 124, 122, 151, 220, 9, 63, 124, 220, 9,
+        63, 227, 128, 129, 122, 151, 4, 174, 119, 168, 29, 11, 54, 9, 0, 212, 66, 92, 12, 124, 66, 92, 12, 4,
+        172, 1, 156, 87, 196, 88, 6, 63, 240, 9, 86, 21, 57, 213, 236, 239, 40, 13, 1, 148, 5, 109, 55, 249,
+        170, 35, 6, 87, 157, 6, 63, 215, 243, 27, 1, 156, 84, 219, 142, 9, 50, 56, 6, 96, 68, 6, 20, 71,
+        153, 19, 21, 94, 239, 40, 5, 63, 215, 255, 32, 45, 32, 113, 12, 2, 182, 77, 62, 137, 17, 111, 91, 151,
+        165, 230, 156, 172, 203, 14, 144, 113, 74, 3, 145, 12, 72, 220, 109, 12, 29, 108, 25, 48, 65, 241, 235, 199,
+        86, 76, 216, 185, 50, 56, 33, 135, 87, 145, 93, 11, 24, 49, 6, 126, 119, 171, 102, 9, 6, 87, 136, 9,
+        29, 102, 24, 76, 216, 185, 1, 154, 17, 216, 191, 17, 109, 74, 102, 87, 149, 12, 5, 10, 4, 170, 6, 63,
+        53, 4, 177, 254, 156, 111, 84, 21, 96, 64, 78, 194, 9, 241, 29, 246, 21, 61, 120, 10, 33, 128, 5, 0,
+        228, 184, 173, 229, 164, 174, 11, 57, 206, 89, 189, 35, 249, 162, 57, 78, 24, 76, 87, 159, 36, 14, 158, 6,
+        124, 77, 9, 35, 4, 182, 14, 147, 71, 129, 13, 237, 9, 65, 3, 145, 86, 76, 87, 162, 2, 182, 14, 147,
+        218, 3, 138, 100, 77, 71, 153, 60, 235, 74, 12, 3, 138, 17, 27, 56, 249, 191, 34, 182, 119, 168, 27, 93,
+        19, 108, 6, 13, 55, 254, 156, 13, 77, 37, 168, 58, 70, 1, 148, 37, 179, 25, 14, 147, 11, 61, 120, 11,
+        57, 206, 96, 13, 59, 255, 12, 3, 139, 27, 56, 219, 129, 36, 54, 3, 154, 9, 6, 108, 255, 9, 109, 12,
+        87, 170, 77, 37, 185, 33, 128, 5, 109, 39, 60, 20, 11, 110, 128, 163, 233, 130, 166, 122, 186, 237, 12, 194,
+        12, 108, 68, 25, 10, 80, 72, 11, 194, 13, 74, 14, 134, 10, 215, 13, 35, 4, 177, 68, 55, 25, 109, 64,
+        9, 106, 3, 161, 86, 20, 65, 16, 191, 26, 253, 3, 138, 103, 250, 19, 214, 245, 57, 213, 19, 3, 151, 74,
+        113, 12, 3, 166, 28, 55, 5, 16, 173, 34, 191, 21, 25, 6, 16, 183, 21, 25, 11, 252, 14, 154, 58, 56,
+        3, 159, 58, 201, 11, 28, 5, 223, 5, 9, 17, 10, 1, 157, 19, 20, 4, 178, 68, 25, 3, 140, 74, 1,
+        156, 68, 70, 204, 144, 92, 28, 13, 57, 95, 9, 254, 153, 12, 29, 9, 10, 15, 129, 11, 234, 10, 15, 144,
+        92, 38, 28, 13, 57, 95, 9, 208, 38, 10, 9, 223, 28, 125, 28, 10, 3, 143, 13, 253, 16, 191, 35, 50,
+        13, 234, 10, 207, 11, 92, 28, 3, 137, 2, 165, 12, 255, 215, 11, 50, 17, 12, 16, 189, 112, 12, 15, 129,
+        84, 84, 214, 221, 5, 63, 127, 50, 27, 11, 12, 77, 37, 179, 255, 32, 45, 32, 86, 193, 36, 66, 59, 9,
+        27, 56, 249, 171, 2, 182, 57, 76, 5, 59, 9, 2, 188, 14, 129, 87, 128, 35, 251, 40, 50, 3, 128, 195,
+        12, 6, 226, 168, 21, 78, 73, 143, 199, 13, 3, 129, 36, 251, 40, 6, 78, 9, 59, 14, 128, 35, 222, 24,
+        65, 26, 62, 169, 29, 20, 36, 54, 50, 40, 33, 151, 3, 135, 221, 3, 161, 78, 12, 103, 15, 138, 78, 63,
+        96, 24, 93, 219, 136, 13, 93, 12, 3, 159, 2, 190, 12, 94, 4, 183, 48, 86, 94, 3, 145, 5, 27, 36,
+        113, 3, 143, 13, 103, 21, 80, 9, 21, 58, 36, 9, 38, 234, 247, 224, 59, 48, 66, 94, 3, 147, 92, 118,
+        16, 166, 48, 55, 12, 6, 28, 39, 16, 180, 37, 177, 12, 12, 4, 191, 100, 9, 38, 21, 195, 2, 165, 15,
+        146, 35, 58, 36, 9, 38, 93, 247, 224, 203, 36, 94, 38, 28, 20, 100, 219, 129, 36, 48, 125, 40, 6, 18,
+        172, 9, 16, 184, 36, 118, 28, 39, 252, 9, 21, 55, 28, 3, 169, 27, 36, 76, 216, 170, 250, 66, 8, 124,
+        70, 250, 66, 214, 27, 36, 12, 243, 0, 212, 199, 34, 172, 62, 158, 99, 40, 103, 93, 247, 224, 15, 134, 12,
+        34, 172, 6, 21, 80, 39, 12, 93, 247, 20, 96, 92, 12, 224, 19, 12, 241, 48, 55, 73, 151, 247, 20, 15,
+        157, 251, 40, 20, 56, 13, 3, 196, 6, 66, 50, 18, 166, 56, 118, 235, 207, 6, 98, 12, 13, 11, 233, 166,
+        150, 233, 131, 189, 231, 137, 185, 229, 136, 165, 90, 229, 159, 159, 203, 36, 33, 147, 10, 230, 185, 190, 231, 137,
+        185, 229, 136, 165, 90, 229, 159, 159, 3, 142, 6, 2, 182, 222, 125, 13, 19, 221, 61, 120, 70, 6, 98, 12,
+        13, 11, 16, 191, 10, 35, 208, 15, 147, 29, 19, 13, 11, 0, 212, 70, 6, 98, 12, 13, 11, 16, 175, 17,
+        6, 34, 186, 63, 8, 110, 128, 163, 233, 130, 166, 122, 186, 192, 9, 27, 1, 154, 80, 12, 106, 11, 10, 15,
+        170, 70, 99, 27, 36, 60, 17, 25, 4, 168, 10, 1, 148, 13, 19, 66, 79, 15, 170, 70, 38, 72, 12, 251,
+        38, 54, 38, 112, 73, 134, 3, 145, 246, 26, 223, 34, 191, 28, 55, 13, 21, 15, 154, 9, 21, 14, 150, 65,
+        80, 35, 234, 192, 11, 12, 80, 29, 68, 15, 145, 12, 21, 3, 173, 246, 35, 3, 173, 39, 119, 181, 14, 145,
+        50, 25, 3, 148, 11, 50, 17, 237, 28, 14, 129, 5, 10, 3, 170, 70, 72, 12, 251, 38, 54, 38, 10, 62,
+        158, 12, 24, 36, 5, 16, 180, 17, 11, 10, 15, 158, 48, 19, 38, 72, 25, 48, 236, 38, 54, 38, 10, 62,
+        144, 17, 11, 15, 159, 21, 18, 184, 56, 246, 10, 15, 158, 19, 72, 25, 48, 236, 15, 145, 12, 59, 35, 2,
+        190, 21, 10, 59, 12, 194, 15, 173, 195, 220, 63, 15, 135, 12, 50, 56, 11, 16, 179, 60, 125, 40, 28, 48,
+        19, 15, 196, 88, 36, 88, 6, 15, 196, 33, 143, 14, 151, 20, 36, 6, 15, 144, 33, 162, 79, 15, 158, 66,
+        58, 49, 6, 202, 48, 111, 15, 143, 84, 17, 15, 161, 221, 63, 16, 166, 56, 98, 26, 88, 208, 223, 50, 194,
+        25, 246, 21, 15, 161, 17, 5, 16, 164, 251, 40, 245, 16, 177, 34, 191, 48, 86, 6, 15, 134, 60, 20, 6,
+        15, 144, 88, 208, 207, 92, 17, 70, 15, 154, 193, 73, 153, 208, 15, 159, 20, 20, 48, 1, 148, 15, 171, 17,
+        27, 245, 80, 12, 26, 35, 80, 6, 28, 34, 189, 6, 15, 142, 6, 194, 25, 246, 21, 15, 196, 33, 168, 218,
+        80, 17, 70, 84, 16, 164, 13, 112, 17, 16, 184, 201, 88, 37, 166, 40, 253, 193, 204, 149, 25, 13, 64, 15,
+        159, 235, 6, 13, 207, 29, 12, 1, 155, 35, 15, 142, 6, 10, 64, 65, 55, 15, 175, 20, 79, 5, 223, 50,
+        10, 64, 65, 55, 15, 141, 113, 12, 194, 252, 34, 182, 10, 80, 17, 64, 1, 155, 15, 166, 55, 15, 159, 60,
+        236, 55, 15, 159, 20, 78, 204, 175, 17, 70, 100, 225, 207, 68, 106, 5, 16, 179, 25, 12, 54, 15, 141, 26,
+        64, 80, 13, 2, 190, 21, 15, 196, 33, 161, 86, 20, 65, 15, 162, 34, 191, 21, 252, 13, 57, 95, 9, 208,
+        15, 134, 86, 66, 10, 80, 12, 194, 15, 150, 13, 125, 40, 48, 224, 65, 25, 14, 147, 37, 162, 244, 6, 55,
+        207, 34, 191, 13, 70, 4, 177, 199, 48, 29, 127, 194, 58, 49, 84, 204, 158, 24, 19, 26, 15, 196, 33, 149,
+        213, 39, 63, 23, 3, 196, 33, 150, 12, 34, 186, 50, 40, 48, 29, 3, 142, 26, 253, 20, 11, 15, 151, 13,
+        5, 18, 168, 54, 84, 195, 220, 63, 3, 166, 6, 65, 204, 142, 6, 18, 166, 56, 98, 230, 186, 150, 15, 140,
+        21, 113, 19, 109, 39, 4, 170, 6, 98, 12, 13, 71, 150, 12, 27, 9, 59, 102, 206, 124, 231, 177, 179, 31,
+        124, 11, 102, 206, 229, 144, 136, 232, 161, 134, 31, 3, 161, 86, 20, 65, 108, 75, 84, 192, 79, 1, 148, 6,
+        55, 6, 235, 26, 6, 72, 4, 171, 221, 24, 225, 12, 195, 16, 164, 225, 6, 20, 47, 59, 99, 40, 2, 178,
+        47, 47, 61, 140, 151, 70, 202, 58, 11, 47, 89, 171, 26, 9, 64, 38, 26, 9, 28, 9, 89, 171, 12, 58,
+        36, 17, 45, 67, 104, 101, 114, 107, 101, 115, 115, 47, 3, 129, 56, 58, 56, 5, 47, 3, 129, 49, 85, 213,
+        224, 89, 164, 85, 213, 112, 85, 95, 15, 170, 1, 154, 111, 29, 207, 13, 201, 118, 15, 136, 2, 165, 6, 12,
+        15, 153, 9, 106, 25, 54, 15, 180, 12, 27, 33, 159, 9, 16, 175, 9, 75, 252, 9, 6, 78, 16, 191, 14,
+        156, 57, 15, 150, 13, 36, 5, 209, 164, 25, 10, 12, 85, 13, 15, 170, 36, 2, 182, 5, 80, 98, 12, 92,
+        204, 162, 75, 84, 16, 185, 200, 68, 5, 209, 128, 2, 178, 76, 5, 47, 3, 180, 95, 25, 60, 27, 15, 142,
+        85, 106, 25, 54, 15, 151, 253, 57, 16, 179, 98, 25, 35, 16, 185, 55, 85, 25, 1, 157, 13, 210, 242, 12,
+        10, 112, 64, 118, 210, 4, 171, 73, 160, 17, 29, 47, 237, 85, 56, 13, 15, 172, 24, 225, 12, 195, 15, 173,
+        98, 57, 15, 180, 95, 9, 106, 72, 12, 195, 15, 180, 95, 25, 72, 64, 15, 160, 9, 35, 5, 75, 252, 68,
+        13, 11, 47, 3, 141, 60, 111, 232, 135, 170, 230, 178, 187, 231, 174, 161, 122, 186, 215, 100, 47, 59, 73, 143,
+        34, 178, 13, 209, 162, 9, 54, 85, 40, 11, 47, 3, 139, 27, 24, 38, 112, 85, 106, 25, 54, 15, 154, 34,
+        182, 16, 173, 6, 25, 57, 15, 158, 13, 38, 74, 9, 47, 89, 170, 68, 14, 150, 9, 29, 16, 166, 13, 103,
+        112, 57, 209, 154, 73, 159, 210, 238, 20, 65, 9, 19, 76, 5, 89, 166, 54, 94, 9, 19, 89, 191, 55, 9,
+        76, 5, 89, 181, 35, 12, 223, 12, 19, 57, 15, 164, 35, 25, 38, 60, 60, 111, 232, 135, 170, 230, 178, 187,
+        231, 174, 161, 122, 186, 3, 143, 14, 134, 40, 38, 35, 193, 4, 185, 85, 56, 9, 54, 25, 57, 209, 129, 49,
+        102, 24, 16, 175, 9, 78, 204, 129, 56, 13, 36, 77, 5, 209, 150, 13, 103, 243, 89, 182, 26, 17, 28, 13,
+        74, 210, 109, 9, 29, 33, 132, 29, 15, 142, 85, 95, 20, 77, 9, 209, 136, 94, 75, 207, 94, 209, 143, 28,
+        10, 47, 89, 177, 102, 25, 85, 95, 80, 9, 55, 17, 47, 59, 9, 55, 17, 210, 237, 2, 165, 85, 213, 89,
+        175, 12, 10, 112, 103, 9, 75, 210, 96, 78, 64, 204, 129, 49, 29, 58, 231, 174, 161, 122, 186, 4, 171, 94,
+        58, 36, 111, 28, 210, 127, 92, 13, 5, 8, 91, 178, 191, 230, 181, 183, 15, 166, 64, 103, 232, 135, 170, 230,
+        178, 187, 15, 143, 26, 25, 57, 75, 210, 59, 94, 118, 223, 92, 47, 124, 103, 29, 243, 89, 171, 21, 64, 3,
+        173, 20, 11, 0, 228, 184, 138, 230, 181, 183, 61, 164, 169, 230, 180, 165, 61, 140, 151, 228, 186, 172, 91, 181,
+        183, 229, 120, 61, 175, 167, 229, 164, 143, 1, 155, 17, 110, 135, 141, 230, 133, 182, 229, 184, 130, 91, 181, 153,
+        230, 177, 159, 83, 91, 177, 159, 232, 152, 135, 83, 0, 231, 166, 143, 229, 187, 186, 83, 61, 174, 137, 229, 190,
+        189, 83, 110, 129, 188, 229, 175, 167, 61, 177, 177, 230, 157, 177, 83, 61, 177, 177, 212, 91, 177, 159, 212, 83,
+        91, 178, 179, 229, 120, 83, 0, 232, 178, 180, 8, 83, 61, 186, 131, 230, 157, 177, 91, 185, 150, 122, 151, 83,
+        61, 144, 137, 230, 158, 151, 91, 178, 179, 122, 151, 83, 110, 153, 157, 212, 61, 134, 133, 200, 255, 9, 124, 229,
+        134, 133, 232, 146, 153, 229, 143, 164, 110, 187, 146, 231, 171, 156, 230, 177, 159, 83, 91, 185, 150, 229, 120, 83,
+        61, 186, 131, 212, 58, 84, 5, 230, 151, 143, 232, 135, 170, 230, 178, 187, 122, 186, 0, 30, 155, 7, 157, 83,
+        110, 155, 178, 229, 120, 0, 212, 232, 148, 181, 124, 58, 199, 48, 19, 0, 231, 148, 152, 231, 178, 155, 83, 110,
+        157, 146, 230, 181, 183, 91, 150, 176, 231, 150, 134, 50, 17, 72, 9, 0, 228, 184, 173, 31, 59, 102, 206, 229,
+        144, 136, 232, 161, 134, 31, 229, 164, 150, 53, 242, 250, 234, 243, 217, 61, 120, 230, 165, 181, 229, 164, 167, 233,
+        153, 184, 109, 34, 191, 6, 21, 20, 201, 21, 9, 124, 228, 184, 150, 231, 149, 140, 124, 90, 231, 144, 131, 0,
+};
+
+static const unsigned char TERRITORY_NAMES_PAIRS_JA[256][2] = {
+        {0, 0}, {227, 131}, {227, 130}, {0, 1}, {0, 2}, {1, 179}, {1, 188}, {229, 183}, {7, 158}, {1, 171}, {2, 185}, {2, 162},
+        {1, 169}, {1, 170}, {5, 1}, {8, 3}, {8, 4}, {2, 164}, {10, 2}, {1, 136}, {2, 183}, {1, 138}, {179, 182}, {229, 22},
+        {1, 139}, {1, 173}, {1, 144}, {2, 184}, {2, 171}, {2, 175}, {229, 155}, {30, 189}, {32, 32}, {6, 1}, {5, 2}, {1, 158},
+        {1, 163}, {11, 4}, {1, 187}, {14, 137}, {2, 163}, {133, 177}, {41, 229}, {42, 146}, {43, 140}, {45, 45}, {44, 31}, {229, 46},
+        {1, 131}, {1, 165}, {2, 166}, {171, 184}, {51, 23}, {232, 52}, {1, 137}, {2, 191}, {2, 167}, {1, 149}, {1, 129}, {4, 162},
+        {1, 141}, {0, 229}, {9, 3}, {12, 39}, {1, 128}, {2, 179}, {2, 181}, {67, 67}, {1, 172}, {69, 69}, {2, 170}, {11, 3},
+        {2, 176}, {9, 1}, {2, 168}, {18, 175}, {18, 191}, {1, 147}, {2, 172}, {14, 136}, {16, 162}, {156, 129}, {229, 156}, {231, 81},
+        {1, 175}, {1, 180}, {2, 173}, {5, 3}, {6, 27}, {47, 4}, {82, 176}, {0, 230}, {1, 143}, {1, 151}, {1, 160}, {2, 169},
+        {3, 158}, {97, 97}, {10, 19}, {1, 135}, {1, 159}, {101, 101}, {1, 161}, {1, 164}, {104, 104}, {105, 105}, {2, 180}, {107, 107},
+        {3, 162}, {4, 164}, {0, 233}, {1, 132}, {1, 142}, {1, 150}, {114, 114}, {115, 115}, {116, 116}, {117, 117}, {6, 9}, {24, 37},
+        {141, 151}, {160, 152}, {229, 140}, {233, 121}, {124, 124}, {1, 134}, {2, 174}, {4, 181}, {128, 128}, {129, 129}, {130, 130}, {131, 131},
+        {132, 132}, {133, 133}, {134, 134}, {135, 135}, {136, 136}, {137, 137}, {138, 138}, {139, 139}, {140, 140}, {141, 141}, {142, 142}, {143, 143},
+        {144, 144}, {145, 145}, {146, 146}, {147, 147}, {148, 148}, {149, 149}, {150, 150}, {151, 151}, {152, 152}, {153, 153}, {154, 154}, {155, 155},
+        {156, 156}, {157, 157}, {158, 158}, {159, 159}, {160, 160}, {161, 161}, {162, 162}, {163, 163}, {164, 164}, {165, 165}, {166, 166}, {167, 167},
+        {168, 168}, {169, 169}, {170, 170}, {171, 171}, {172, 172}, {173, 173}, {174, 174}, {175, 175}, {176, 176}, {177, 177}, {178, 178}, {179, 179},
+        {180, 180}, {181, 181}, {182, 182}, {183, 183}, {184, 184}, {185, 185}, {186, 186}, {187, 187}, {188, 188}, {189, 189}, {190, 190}, {191, 191},
+        {4, 187}, {5, 20}, {18, 171}, {33, 137}, {139, 49}, {150, 185}, {230, 197}, {1, 153}, {1, 162}, {1, 167}, {2, 187}, {4, 184},
+        {5, 15}, {5, 53}, {13, 28}, {16, 170}, {24, 11}, {75, 15}, {90, 198}, {165, 191}, {232, 211}, {2, 161}, {4, 176}, {4, 179},
+        {5, 4}, {5, 23}, {6, 29}, {6, 62}, {11, 17}, {13, 6}, {14, 187}, {16, 181}, {20, 49}, {34, 176}, {227, 129}, {227, 227},
+        {228, 228}, {229, 229}, {230, 230}, {231, 231}, {232, 232}, {233, 233}, {1, 145}, {2, 186}, {2, 189}, {3, 136}, {3, 144}, {3, 149},
+        {3, 150}, {4, 166}, {4, 175}, {6, 19}, {9, 26}, {11, 21}, {12, 17}, {12, 99}, {13, 10}, {13, 37}, {13, 48}, {14, 135},
+        {16, 171}, {18, 179}, {24, 71}, {34, 180},
+};
+
+static const unsigned short TERRITORY_NAME_ALTERNATIVES_START_JA[_TERRITORY_MAX - _TERRITORY_MIN] = {
+        0, 2, 3, 4, 5, 7, 8, 9, 10, 11, 12, 13, 15, 16, 17, 18,
+        19, 20, 21, 22, 23, 24, 25, 27, 29, 30, 31, 32, 34, 35, 37, 38,
+        40, 41, 44, 45, 48, 49, 50, 52, 53, 55, 57, 59, 60, 62, 63, 64,
+        65, 66, 67, 68, 69, 70, 72, 73, 74, 75, 76, 77, 79, 81, 82, 83,
+        84, 85, 86, 87, 88, 89, 90, 92, 93, 94, 96, 97, 98, 99, 100, 101,
+        102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117,
+        118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132, 133,
+        134, 135, 136, 137, 138, 139, 140, 141, 142, 143, 144, 145, 146, 147, 148, 149,
+        150, 151, 152, 153, 154, 155, 156, 157, 158, 159, 160, 161, 162, 163, 164, 165,
+        166, 167, 168, 169, 170, 171, 172, 173, 174, 175, 176, 177, 178, 179, 180, 181,
+        182, 183, 184, 185, 186, 187, 188, 193, 194, 195, 197, 198, 199, 200, 201, 202,
+        203, 204, 205, 206, 207, 208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218,
+        219, 220, 221, 222, 223, 224, 225, 226, 227, 228, 229, 230, 231, 232, 233, 234,
+        236, 237, 238, 239, 240, 241, 242, 243, 244, 245, 246, 247, 248, 249, 250, 251,
+        252, 253, 254, 255, 256, 257, 258, 259, 260, 261, 262, 263, 264, 265, 266, 267,
+        268, 269, 270, 271, 272, 273, 274, 275, 276, 277, 278, 279, 280, 281, 282, 283,
+        284, 285, 286, 287, 288, 289, 290, 291, 292, 293, 294, 295, 296, 297, 298, 299,
+        300, 301, 302, 303, 304, 305, 306, 307, 308, 309, 310, 311, 312, 313, 314, 315,
+        316, 317, 318, 319, 320, 321, 322, 323, 324, 325, 326, 328, 329, 330, 331, 332,
+        333, 334, 335, 336, 337, 338, 339, 340, 341, 342, 343, 344, 345, 346, 347, 348,
+        349, 350, 351, 352, 353, 354, 355, 356, 357, 358, 359, 360, 361, 362, 363, 364,
+        365, 366, 367, 368, 369, 370, 371, 372, 373, 374, 375, 376, 377, 378, 379, 380,
+        381, 382, 383, 384, 385, 386, 387, 388, 389, 390, 391, 392, 393, 394, 395, 396,
+        397, 398, 399, 400, 401, 402, 403, 404, 405, 406, 407, 408, 409, 410, 411, 412,
+        413, 414, 415, 416, 417, 418, 419, 420, 421, 422, 423, 424, 425, 426, 427, 428,
+        429, 430, 431, 432, 433, 434, 435, 436, 437, 438, 439, 442, 443, 444, 445, 446,
+        447, 448, 449, 450, 451, 452, 453, 454, 455, 456, 457, 458, 459, 460, 461, 462,
+        463, 464, 465, 466, 467, 468, 469, 470, 471, 472, 473, 474, 475, 476, 477, 478,
+        479, 480, 481, 482, 483, 484, 485, 486, 487, 488, 489, 490, 491, 492, 493, 494,
+        495, 496, 497, 498, 499, 500, 501, 502, 503, 504, 505, 506, 507, 508, 509, 510,
+        511, 512, 513, 514, 515, 516, 517, 518, 519, 520, 521, 522, 523, 524, 525, 527,
+        528, 529, 530, 531, 532, 533, 534, 535, 536, 537, 538, 539, 540, 541, 542, 543,
+        544, 545, 546, 547, 548, 549, 550, 552, 553, 554, 555, 556, 557, 559, 560, 561,
+        562, 563, 564, 565, 566, 569,
+};
+
+static const TerritoryNameAlternative TERRITORY_NAME_ALTERNATIVES_JA[569] = {
+        {0, 18, 7}, {19, 9, 20}, {29, 9, 7}, {39, 18, 7}, {58, 18, 7}, {77, 15, 7}, {93, 21, 7}, {115, 30, 7},
+        {146, 9, 7}, {156, 9, 7}, {166, 9, 7}, {176, 27, 7}, {204, 21, 7}, {226, 39, 7}, {266, 30, 7}, {297, 21, 7},
+        {319, 15, 7}, {335, 15, 7}, {351, 33, 7}, {385, 18, 7}, {404, 18, 7}, {423, 15, 7}, {439, 18, 7}, {458, 15, 7},
+        {474, 18, 7}, {493, 24, 7}, {518, 9, 7}, {528, 24, 20}, {553, 33, 7}, {587, 27, 7}, {615, 9, 7}, {625, 21, 7},
+        {647, 24, 7}, {672, 24, 7}, {697, 15, 7}, {713, 39, 7}, {753, 15, 7}, {769, 9, 7}, {779, 45, 7}, {825, 12, 7},
+        {838, 18, 7}, {857, 42, 7}, {900, 6, 7}, {907, 33, 7}, {941, 15, 7}, {957, 84, 7}, {1042, 18, 7}, {1061, 36, 7},
+        {1098, 9, 7}, {1108, 12, 7}, {1121, 24, 20}, {1146, 24, 20}, {1171, 15, 7}, {1187, 48, 7}, {1236, 21, 7}, {1258, 48, 7},
+        {1307, 27, 7}, {1335, 39, 7}, {1375, 24, 7}, {1400, 15, 7}, {1416, 33, 7}, {1450, 15, 7}, {1466, 15, 7}, {1482, 15, 7},
+        {1498, 9, 7}, {1508, 21, 20}, {1530, 12, 7}, {1543, 9, 7}, {1553, 9, 7}, {1563, 18, 7}, {1582, 18, 7}, {1601, 24, 7},
+        {1626, 18, 7}, {1645, 9, 7}, {1655, 12, 7}, {1668, 15, 7}, {1684, 12, 7}, {1697, 33, 7}, {1731, 18, 7}, {1750, 30, 7},
+        {1781, 15, 7}, {1797, 6, 20}, {1804, 24, 7}, {1829, 18, 7}, {1848, 21, 7}, {1870, 9, 7}, {1880, 18, 7}, {1899, 6, 20},
+        {1906, 21, 7}, {1928, 9, 7}, {1938, 63, 7}, {2002, 36, 7}, {2039, 30, 7}, {2070, 18, 7}, {2089, 30, 7}, {2120, 9, 7},
+        {2130, 12, 7}, {2143, 36, 7}, {2180, 18, 7}, {2199, 12, 7}, {2212, 12, 7}, {2225, 15, 7}, {2241, 12, 7}, {2254, 12, 7},
+        {2267, 27, 7}, {2295, 12, 7}, {2308, 18, 7}, {2327, 9, 7}, {2337, 18, 20}, {2356, 18, 7}, {2375, 15, 7}, {2391, 12, 7},
+        {2404, 24, 7}, {2429, 15, 7}, {2445, 15, 7}, {2461, 21, 7}, {2483, 21, 7}, {2505, 12, 7}, {2518, 9, 7}, {2528, 15, 7},
+        {2544, 12, 7}, {2557, 9, 7}, {2567, 12, 7}, {2580, 15, 20}, {2596, 15, 7}, {2612, 18, 7}, {2631, 15, 7}, {2647, 9, 7},
+        {2657, 12, 7}, {2670, 12, 7}, {2683, 18, 7}, {2702, 6, 20}, {2709, 12, 7}, {2722, 9, 7}, {2732, 12, 7}, {2745, 15, 7},
+        {2761, 15, 7}, {2777, 21, 7}, {2799, 15, 7}, {2815, 15, 7}, {2831, 36, 7}, {2868, 15, 7}, {2884, 9, 7}, {2894, 12, 7},
+        {2907, 15, 7}, {2923, 15, 7}, {2939, 15, 7}, {2955, 18, 7}, {2974, 18, 7}, {2993, 9, 7}, {3003, 18, 7}, {3022, 15, 20},
+        {3038, 24, 7}, {3063, 18, 7}, {3082, 24, 7}, {3107, 12, 7}, {3120, 12, 7}, {3133, 15, 7}, {3149, 15, 7}, {3165, 6, 20},
+        {3172, 18, 7}, {3191, 15, 7}, {3207, 12, 7}, {3220, 15, 7}, {3236, 12, 7}, {3249, 18, 7}, {3268, 9, 7}, {3278, 15, 7},
+        {3294, 12, 7}, {3307, 9, 20}, {3317, 15, 7}, {3333, 12, 7}, {3346, 18, 7}, {3365, 21, 7}, {3387, 12, 7}, {3400, 15, 7},
+        {3416, 12, 7}, {3429, 15, 7}, {3445, 15, 7}, {3461, 9, 7}, {3471, 12, 7}, {3484, 18, 7}, {3503, 15, 7}, {3519, 12, 7},
+        {3532, 9, 7}, {3542, 15, 7}, {3558, 9, 7}, {3568, 12, 7}, {3581, 12, 7}, {3594, 21, 7}, {3616, 12, 7}, {3629, 21, 20},
+        {3651, 24, 7}, {3676, 9, 7}, {3686, 15, 7}, {3702, 12, 20}, {3715, 9, 7}, {3725, 9, 7}, {3735, 24, 7}, {3760, 21, 7},
+        {3782, 15, 7}, {3798, 12, 7}, {3811, 12, 7}, {3824, 15, 7}, {3840, 24, 7}, {3865, 15, 7}, {3881, 15, 7}, {3897, 12, 7},
+        {3910, 18, 7}, {3929, 27, 7}, {3957, 9, 7}, {3967, 6, 7}, {3974, 15, 7}, {3990, 15, 7}, {4006, 9, 7}, {4016, 12, 7},
+        {4029, 21, 7}, {4051, 18, 7}, {4070, 27, 7}, {4098, 15, 7}, {4114, 24, 7}, {4139, 12, 7}, {4152, 6, 7}, {4159, 12, 7},
+        {4172, 12, 7}, {4185, 21, 7}, {4207, 9, 7}, {4217, 12, 7}, {4230, 18, 7}, {4249, 15, 7}, {4265, 15, 20}, {4281, 27, 20},
+        {4309, 12, 7}, {4322, 21, 7}, {4344, 15, 7}, {4360, 9, 7}, {4370, 12, 7}, {4383, 6, 7}, {4390, 9, 7}, {4400, 15, 7},
+        {4416, 18, 7}, {4435, 12, 7}, {4448, 15, 7}, {4464, 18, 7}, {4483, 15, 7}, {4499, 12, 7}, {4512, 18, 7}, {4531, 12, 7},
+        {4544, 15, 7}, {4560, 15, 7}, {4576, 15, 20}, {4592, 6, 7}, {4599, 12, 7}, {4612, 15, 7}, {4628, 9, 7}, {4638, 9, 7},
+        {4648, 12, 7}, {4661, 9, 7}, {4671, 9, 7}, {4681, 12, 7}, {4694, 18, 7}, {4713, 9, 20}, {4723, 15, 7}, {4739, 15, 7},
+        {4755, 30, 7}, {4786, 9, 7}, {4796, 12, 7}, {4809, 12, 7}, {4822, 15, 7}, {4838, 12, 7}, {4851, 15, 7}, {4867, 18, 7},
+        {4886, 12, 7}, {4899, 15, 7}, {4915, 21, 7}, {4937, 15, 7}, {4953, 15, 7}, {4969, 21, 7}, {4991, 24, 7}, {5016, 9, 7},
+        {5026, 21, 7}, {5048, 27, 7}, {5076, 18, 7}, {5095, 15, 7}, {5111, 42, 7}, {5154, 15, 7}, {5170, 15, 7}, {5186, 21, 7},
+        {5208, 12, 7}, {5221, 15, 7}, {5237, 18, 7}, {5256, 12, 7}, {5269, 9, 7}, {5279, 21, 7}, {5301, 21, 7}, {5323, 27, 7},
+        {5351, 18, 7}, {5370, 18, 7}, {5389, 18, 7}, {5408, 18, 7}, {5427, 36, 7}, {5464, 24, 7}, {5489, 30, 7}, {5520, 27, 7},
+        {5548, 9, 7}, {5558, 15, 7}, {5574, 15, 7}, {5590, 15, 7}, {5606, 12, 7}, {5619, 12, 7}, {5632, 12, 7}, {5645, 15, 7},
+        {5661, 15, 7}, {5677, 36, 7}, {5714, 12, 7}, {5727, 15, 7}, {5743, 27, 7}, {5771, 6, 7}, {5778, 9, 7}, {5788, 27, 7},
+        {5816, 33, 7}, {5850, 27, 7}, {5878, 30, 7}, {5909, 24, 7}, {5934, 15, 7}, {5950, 18, 7}, {5969, 15, 7}, {5985, 12, 7},
+        {5998, 18, 7}, {6017, 15, 20}, {6033, 30, 7}, {6064, 21, 7}, {6086, 24, 7}, {6111, 21, 7}, {6133, 27, 7}, {6161, 21, 7},
+        {6183, 36, 7}, {6220, 39, 7}, {6260, 30, 7}, {6291, 30, 7}, {6322, 27, 20}, {6350, 18, 7}, {6369, 15, 7}, {6385, 27, 20},
+        {6413, 27, 7}, {6441, 9, 20}, {6451, 15, 7}, {6467, 18, 7}, {6486, 24, 7}, {6511, 27, 7}, {6539, 39, 7}, {6579, 15, 7},
+        {6595, 24, 7}, {6620, 21, 7}, {6642, 9, 7}, {6652, 12, 7}, {6665, 12, 7}, {6678, 9, 7}, {6688, 12, 7}, {6701, 15, 7},
+        {6717, 15, 7}, {6733, 12, 7}, {6746, 18, 7}, {6765, 33, 7}, {6799, 18, 7}, {6818, 15, 7}, {6834, 39, 7}, {6874, 12, 7},
+        {6887, 27, 7}, {6915, 21, 7}, {6937, 6, 7}, {6944, 15, 7}, {6960, 15, 7}, {6976, 27, 7}, {7004, 18, 7}, {7023, 24, 7},
+        {7048, 27, 7}, {7076, 30, 7}, {7107, 18, 7}, {7126, 27, 7}, {7154, 12, 7}, {7167, 21, 7}, {7189, 30, 7}, {7220, 27, 7},
+        {7248, 12, 7}, {7261, 21, 7}, {7283, 21, 7}, {7305, 15, 7}, {7321, 18, 7}, {7340, 15, 7}, {7356, 24, 7}, {7381, 18, 7},
+        {7400, 18, 7}, {7419, 15, 7}, {7435, 21, 7}, {7457, 27, 7}, {7485, 21, 7}, {7507, 15, 7}, {7523, 15, 7}, {7539, 15, 7},
+        {7555, 24, 7}, {7580, 15, 7}, {7596, 15, 7}, {7612, 18, 7}, {7631, 21, 7}, {7653, 18, 7}, {7672, 21, 7}, {7694, 18, 7},
+        {7713, 15, 7}, {7729, 15, 7}, {7745, 9, 7}, {7755, 15, 7}, {7771, 15, 7}, {7787, 21, 7}, {7809, 15, 7}, {7825, 15, 7},
+        {7841, 12, 7}, {7854, 15, 7}, {7870, 24, 7}, {7895, 15, 7}, {7911, 24, 7}, {7936, 15, 7}, {7952, 15, 7}, {7968, 36, 7},
+        {8005, 18, 7}, {8024, 15, 7}, {8040, 12, 7}, {8053, 24, 7}, {8078, 15, 7}, {8094, 33, 7}, {8128, 33, 7}, {8162, 21, 7},
+        {8184, 42, 7}, {8227, 15, 7}, {8243, 27, 7}, {8271, 12, 7}, {8284, 9, 7}, {8294, 21, 7}, {8316, 12, 7}, {8329, 12, 7},
+        {8342, 6, 20}, {8349, 21, 7}, {8371, 12, 7}, {8384, 12, 7}, {8397, 33, 7}, {8431, 30, 7}, {8462, 24, 7}, {8487, 30, 7},
+        {8518, 33, 20}, {8552, 36, 7}, {8589, 33, 7}, {8623, 24, 7}, {8648, 27, 7}, {8676, 21, 7}, {8698, 15, 7}, {8714, 18, 7},
+        {8733, 15, 7}, {8749, 18, 7}, {8768, 21, 7}, {8790, 15, 7}, {8806, 15, 7}, {8822, 15, 7}, {8838, 21, 7}, {8860, 21, 7},
+        {8882, 15, 7}, {8898, 21, 7}, {8920, 15, 7}, {8936, 21, 7}, {8958, 24, 7}, {8983, 18, 7}, {9002, 18, 7}, {9021, 15, 7},
+        {9037, 18, 7}, {9056, 24, 7}, {9081, 27, 7}, {9109, 24, 7}, {9134, 15, 7}, {9150, 24, 7}, {9175, 15, 7}, {9191, 27, 7},
+        {9219, 18, 7}, {9238, 21, 7}, {9260, 21, 7}, {9282, 21, 7}, {9304, 15, 7}, {9320, 27, 7}, {9348, 27, 7}, {9376, 30, 7},
+        {9407, 12, 7}, {9420, 15, 7}, {9436, 33, 7}, {9470, 21, 7}, {9492, 24, 7}, {9517, 15, 7}, {9533, 33, 7}, {9567, 24, 7},
+        {9592, 27, 7}, {9620, 12, 7}, {9633, 15, 7}, {9649, 33, 7}, {9683, 24, 7}, {9708, 30, 7}, {9739, 15, 7}, {9755, 15, 7},
+        {9771, 27, 7}, {9799, 24, 7}, {9824, 24, 7}, {9849, 21, 7}, {9871, 27, 7}, {9899, 15, 7}, {9915, 15, 7}, {9931, 27, 7},
+        {9959, 18, 7}, {9978, 21, 7}, {10000, 18, 7}, {10019, 21, 7}, {10041, 30, 7}, {10072, 15, 7}, {10088, 18, 7}, {10107, 24, 7},
+        {10132, 15, 7}, {10148, 9, 20}, {10158, 18, 7}, {10177, 24, 7}, {10202, 15, 7}, {10218, 15, 7}, {10234, 21, 7}, {10256, 9, 7},
+        {10266, 9, 7}, {10276, 6, 20}, {10283, 6, 20}, {10290, 6, 20}, {10297, 6, 20}, {10304, 12, 20}, {10317, 9, 20}, {10327, 9, 20},
+        {10337, 9, 20}, {10347, 9, 20}, {10357, 9, 20}, {10367, 6, 20}, {10374, 9, 20}, {10384, 6, 20}, {10391, 9, 20}, {10401, 9, 20},
+        {10411, 9, 20}, {10421, 6, 20}, {10428, 9, 20}, {10438, 6, 20}, {10445, 9, 20}, {10455, 6, 20}, {10462, 15, 20}, {10478, 9, 20},
+        {10488, 12, 20}, {10501, 9, 20}, {10511, 27, 20}, {10539, 9, 20}, {10549, 6, 20}, {10556, 6, 20}, {10563, 12, 7}, {10576, 9, 20},
+        {10586, 6, 20}, {10593, 18, 20}, {10612, 6, 20}, {10619, 30, 7}, {10650, 24, 7}, {10675, 12, 20}, {10688, 27, 7}, {10716, 6, 20},
+        {10723, 6, 20},
+};
+
+static char TERRITORY_NAMES_UNPACKED_JA[10730];
+
+static const PackedTerritoryNames PACKED_TERRITORY_NAMES_JA = {
+        TERRITORY_NAMES_UNPACKED_JA, 10730, TERRITORY_NAMES_PACKED_JA, 3432, TERRITORY_NAMES_PAIRS_JA,
+        TERRITORY_NAME_ALTERNATIVES_START_JA, TERRITORY_NAME_ALTERNATIVES_JA};
+
+#else
+
+static const PackedTerritoryNames PACKED_TERRITORY_NAMES_JA = {NULL, 0, NULL, 0, NULL, NULL, NULL};
+
+#endif // MAPCODE_SUPPORT_LANGUAGE_JA
+
+#ifdef MAPCODE_SUPPORT_LANGUAGE_KO // Korean
+
+// 8640 bytes, packed to 3927
+static const unsigned char TERRITORY_NAMES_PACKED_KO[3927] = {
+        62, 92, 111, 184, 2, 139, 156, 25, 124, 21, 144, 47, 169, 236, 178, 173, 253, 53, 91, 1, 167, 35, 118, 43,
+        164, 237, 132, 176, 7, 81, 236, 188, 136, 15, 98, 1, 60, 91, 6, 89, 124, 237, 61, 218, 129, 89, 1, 131,
+        157, 62, 16, 237, 133, 148, 88, 240, 3, 26, 98, 198, 7, 194, 235, 176, 20, 93, 112, 90, 119, 1, 139, 160,
+        33, 94, 16, 237, 132, 180, 222, 254, 8, 30, 237, 139, 180, 224, 237, 141, 189, 248, 124, 237, 5, 217, 189, 248,
+        7, 149, 143, 236, 188, 128, 220, 184, 89, 3, 182, 35, 78, 248, 3, 205, 235, 174, 164, 113, 1, 152, 129, 25,
+        211, 2, 157, 184, 84, 220, 145, 247, 128, 236, 151, 173, 1, 130, 176, 94, 12, 235, 74, 0, 234, 177, 180, 102,
+        248, 190, 181, 83, 136, 15, 99, 172, 33, 236, 80, 38, 171, 1, 160, 128, 102, 248, 7, 29, 12, 6, 94, 192,
+        230, 1, 155, 148, 12, 6, 24, 233, 244, 53, 124, 237, 233, 244, 53, 1, 152, 129, 25, 211, 8, 205, 70, 132,
+        11, 214, 124, 235, 205, 70, 132, 11, 214, 2, 152, 129, 25, 211, 3, 10, 237, 158, 136, 237, 133, 144, 236, 138,
+        136, 69, 101, 65, 198, 62, 112, 236, 133, 156, 89, 65, 235, 197, 12, 111, 184, 236, 61, 235, 170, 168, 40, 191,
+        161, 89, 1, 131, 157, 237, 148, 188, 242, 16, 8, 64, 237, 129, 180, 43, 177, 249, 136, 98, 242, 222, 254, 221,
+        236, 184, 160, 8, 63, 95, 6, 124, 127, 95, 6, 1, 188, 128, 19, 218, 168, 89, 3, 125, 127, 16, 44, 2,
+        80, 254, 2, 156, 160, 6, 24, 131, 128, 92, 2, 58, 6, 8, 176, 143, 2, 61, 62, 124, 236, 61, 62, 124,
+        236, 80, 254, 2, 156, 160, 6, 24, 131, 128, 92, 2, 58, 6, 99, 176, 199, 235, 118, 222, 254, 237, 151, 172,
+        88, 53, 44, 2, 138, 185, 236, 178, 156, 229, 24, 28, 12, 201, 202, 164, 2, 206, 235, 131, 144, 124, 236, 138,
+        185, 236, 178, 156, 124, 33, 12, 201, 202, 164, 2, 206, 235, 131, 144, 99, 176, 69, 0, 103, 88, 53, 113, 208,
+        25, 211, 8, 205, 70, 132, 11, 214, 124, 235, 205, 70, 132, 11, 214, 8, 64, 25, 211, 112, 236, 154, 148, 33,
+        1, 4, 235, 176, 20, 31, 16, 2, 150, 35, 30, 236, 152, 140, 124, 220, 35, 30, 236, 152, 140, 222, 254, 235,
+        185, 136, 236, 132, 188, 33, 32, 103, 88, 53, 235, 148, 152, 124, 103, 88, 53, 235, 148, 152, 7, 151, 136, 109,
+        8, 167, 165, 84, 235, 132, 144, 109, 89, 3, 31, 235, 78, 19, 84, 6, 190, 164, 92, 117, 8, 31, 235, 126,
+        202, 164, 124, 62, 235, 126, 202, 164, 1, 206, 15, 245, 119, 222, 19, 236, 74, 7, 140, 148, 15, 98, 3, 182,
+        129, 94, 12, 11, 53, 89, 190, 136, 84, 15, 0, 234, 180, 140, 3, 167, 168, 248, 222, 254, 198, 54, 100, 64,
+        51, 43, 20, 63, 54, 11, 2, 151, 176, 235, 239, 1, 139, 177, 117, 237, 143, 172, 16, 7, 134, 181, 117, 3,
+        36, 240, 41, 90, 2, 151, 176, 235, 239, 3, 31, 88, 101, 7, 104, 12, 62, 54, 7, 132, 176, 51, 192, 188,
+        128, 19, 236, 187, 164, 6, 89, 1, 131, 129, 244, 235, 197, 24, 59, 217, 176, 54, 237, 123, 124, 135, 217, 176,
+        54, 237, 123, 7, 153, 141, 236, 189, 169, 112, 16, 92, 41, 51, 7, 123, 73, 89, 0, 229, 235, 147, 164, 198,
+        135, 1, 60, 235, 170, 168, 73, 253, 12, 236, 133, 148, 226, 160, 136, 236, 156, 132, 41, 236, 152, 185, 3, 163,
+        169, 236, 133, 136, 235, 126, 16, 51, 1, 61, 235, 170, 168, 40, 212, 6, 236, 161, 176, 102, 11, 8, 176, 143,
+        2, 212, 192, 131, 140, 109, 236, 156, 132, 255, 89, 124, 236, 212, 192, 131, 140, 109, 236, 156, 132, 255, 89, 7,
+        59, 38, 145, 6, 211, 24, 143, 180, 12, 127, 54, 40, 37, 235, 125, 235, 78, 16, 241, 7, 28, 12, 41, 113,
+        109, 24, 81, 62, 120, 3, 118, 198, 53, 19, 7, 59, 38, 145, 6, 211, 8, 193, 235, 239, 8, 176, 143, 8,
+        193, 83, 185, 7, 233, 242, 16, 146, 12, 91, 7, 104, 135, 73, 226, 160, 136, 62, 235, 133, 188, 1, 108, 235,
+        197, 19, 90, 0, 55, 144, 252, 37, 69, 16, 7, 143, 172, 237, 129, 180, 116, 89, 3, 31, 235, 136, 132, 11,
+        244, 99, 172, 237, 231, 127, 103, 73, 3, 31, 207, 94, 3, 143, 153, 92, 235, 170, 168, 228, 4, 243, 128, 236,
+        30, 38, 250, 1, 206, 236, 204, 19, 33, 7, 148, 188, 102, 3, 136, 132, 235, 178, 168, 111, 188, 88, 84, 41,
+        124, 235, 203, 2, 185, 188, 88, 84, 251, 138, 172, 43, 20, 78, 251, 215, 6, 15, 236, 151, 152, 7, 140, 148,
+        88, 6, 69, 101, 246, 255, 1, 151, 152, 236, 130, 180, 62, 84, 16, 3, 178, 168, 12, 236, 238, 1, 167, 35,
+        126, 92, 112, 236, 188, 35, 36, 41, 11, 52, 3, 14, 243, 132, 113, 65, 19, 92, 3, 182, 35, 163, 172, 199,
+        1, 160, 129, 84, 32, 216, 176, 41, 190, 140, 62, 251, 134, 148, 43, 20, 170, 172, 89, 65, 16, 235, 197, 41,
+        100, 160, 136, 236, 134, 140, 146, 3, 178, 168, 216, 176, 242, 99, 176, 84, 62, 0, 216, 176, 41, 95, 236, 212,
+        227, 128, 19, 243, 132, 3, 126, 114, 1, 4, 236, 156, 132, 226, 63, 235, 141, 20, 158, 250, 3, 141, 180, 94,
+        51, 1, 107, 6, 146, 41, 100, 36, 240, 41, 90, 87, 138, 172, 43, 20, 31, 221, 40, 60, 6, 69, 12, 90,
+        3, 125, 6, 41, 11, 24, 151, 164, 16, 236, 178, 180, 120, 95, 53, 7, 29, 73, 11, 92, 11, 7, 81, 120,
+        3, 9, 33, 95, 100, 10, 244, 11, 251, 4, 12, 38, 145, 90, 1, 161, 176, 102, 40, 5, 214, 1, 139, 156,
+        242, 15, 12, 236, 152, 168, 7, 122, 53, 94, 1, 178, 180, 91, 7, 59, 38, 145, 6, 211, 32, 216, 176, 11,
+        53, 65, 38, 141, 242, 240, 12, 33, 1, 57, 200, 12, 40, 5, 236, 160, 156, 16, 62, 19, 236, 158, 148, 222,
+        16, 252, 154, 148, 16, 23, 168, 7, 143, 172, 16, 244, 55, 136, 7, 151, 157, 117, 12, 3, 140, 128, 237, 149,
+        20, 175, 188, 25, 65, 19, 236, 138, 172, 38, 250, 0, 229, 237, 231, 218, 144, 15, 1, 206, 62, 3, 182, 136,
+        117, 12, 100, 9, 19, 235, 78, 12, 40, 152, 168, 235, 145, 144, 15, 226, 78, 235, 131, 137, 1, 107, 12, 33,
+        88, 100, 167, 144, 15, 236, 156, 132, 1, 161, 176, 236, 132, 160, 235, 175, 188, 219, 219, 13, 152, 101, 235, 175,
+        188, 18, 50, 249, 136, 90, 15, 229, 0, 103, 12, 6, 227, 128, 102, 221, 201, 3, 239, 216, 128, 15, 241, 54,
+        3, 63, 237, 140, 148, 7, 138, 128, 41, 102, 1, 232, 12, 235, 193, 1, 58, 198, 229, 19, 1, 186, 132, 235,
+        125, 199, 40, 139, 156, 12, 40, 80, 127, 55, 136, 7, 104, 16, 216, 176, 6, 201, 3, 178, 168, 15, 198, 6,
+        0, 117, 19, 11, 53, 3, 9, 119, 226, 93, 94, 41, 11, 0, 55, 35, 26, 1, 58, 55, 132, 113, 1, 152,
+        129, 25, 124, 6, 91, 237, 139, 35, 158, 66, 124, 235, 182, 129, 223, 214, 124, 11, 214, 44, 8, 182, 129, 0,
+        216, 176, 41, 1, 107, 236, 189, 176, 84, 228, 132, 20, 126, 2, 61, 207, 15, 0, 55, 35, 180, 137, 225, 236,
+        30, 116, 3, 126, 16, 221, 53, 237, 122, 236, 134, 140, 7, 5, 12, 237, 149, 128, 1, 215, 34, 136, 12, 40,
+        57, 218, 140, 7, 143, 180, 38, 250, 1, 60, 33, 199, 235, 126, 11, 16, 224, 16, 236, 204, 19, 3, 167, 144,
+        88, 19, 54, 100, 78, 33, 235, 193, 7, 149, 35, 158, 250, 1, 189, 169, 120, 52, 3, 143, 133, 96, 1, 9,
+        235, 179, 184, 1, 167, 144, 62, 235, 118, 236, 204, 7, 122, 15, 229, 19, 1, 215, 15, 51, 253, 73, 91, 1,
+        58, 236, 238, 235, 78, 221, 201, 1, 4, 236, 204, 235, 141, 180, 7, 122, 237, 233, 11, 235, 203, 216, 176, 41,
+        1, 37, 235, 197, 235, 163, 172, 7, 194, 16, 51, 235, 197, 41, 201, 1, 4, 237, 123, 101, 227, 156, 25, 1,
+        152, 136, 235, 169, 152, 7, 59, 38, 145, 6, 1, 152, 172, 38, 250, 89, 1, 188, 35, 131, 144, 3, 125, 236,
+        184, 160, 243, 35, 26, 112, 113, 117, 6, 90, 228, 58, 51, 209, 53, 3, 193, 236, 232, 23, 168, 1, 164, 145,
+        236, 149, 153, 11, 135, 12, 90, 87, 134, 140, 218, 144, 12, 40, 5, 135, 117, 41, 201, 208, 220, 35, 30, 124,
+        235, 205, 94, 1, 158, 160, 252, 185, 160, 88, 7, 132, 176, 221, 7, 122, 221, 201, 253, 236, 158, 160, 95, 51,
+        3, 26, 240, 95, 100, 78, 127, 236, 232, 236, 151, 152, 15, 3, 26, 19, 102, 12, 11, 227, 132, 236, 108, 251,
+        215, 70, 145, 33, 253, 12, 69, 41, 3, 179, 188, 12, 252, 107, 92, 119, 237, 148, 188, 40, 189, 20, 161, 172,
+        95, 100, 193, 11, 135, 12, 90, 52, 3, 167, 144, 12, 190, 153, 18, 168, 15, 249, 136, 236, 160, 156, 228, 176,
+        168, 109, 7, 123, 198, 99, 189, 18, 168, 1, 215, 38, 128, 3, 10, 252, 232, 23, 168, 1, 157, 184, 84, 127,
+        54, 40, 151, 176, 235, 239, 247, 128, 210, 7, 139, 128, 8, 157, 189, 192, 185, 188, 15, 253, 56, 144, 8, 161,
+        156, 6, 65, 229, 85, 2, 185, 188, 12, 2, 151, 148, 24, 231, 6, 1, 189, 156, 12, 8, 30, 1, 188, 128,
+        8, 160, 136, 34, 35, 161, 156, 1, 215, 23, 172, 120, 72, 169, 149, 54, 91, 121, 131, 35, 31, 6, 91, 3,
+        26, 236, 196, 8, 166, 191, 0, 229, 8, 26, 237, 155, 132, 223, 146, 7, 233, 242, 235, 184, 148, 15, 1, 156,
+        160, 90, 114, 7, 193, 24, 131, 35, 26, 73, 1, 139, 20, 130, 160, 73, 40, 186, 132, 24, 123, 236, 178, 180,
+        208, 236, 180, 136, 223, 234, 185, 144, 1, 130, 176, 8, 93, 19, 6, 24, 143, 172, 146, 0, 234, 178, 140, 88,
+        73, 3, 136, 132, 242, 8, 125, 8, 160, 136, 236, 152, 168, 3, 31, 207, 2, 186, 152, 12, 237, 143, 172, 41,
+        100, 78, 15, 24, 29, 198, 236, 238, 1, 185, 152, 11, 237, 122, 226, 31, 207, 2, 185, 188, 12, 24, 143, 172,
+        16, 202, 136, 11, 2, 232, 228, 61, 245, 237, 231, 245, 6, 7, 149, 160, 12, 85, 91, 227, 35, 30, 2, 154,
+        184, 12, 24, 122, 6, 1, 57, 236, 149, 133, 2, 61, 90, 3, 145, 144, 8, 158, 145, 120, 1, 60, 11, 2,
+        58, 96, 224, 15, 1, 185, 152, 243, 128, 243, 128, 0, 103, 217, 176, 38, 250, 1, 212, 199, 11, 15, 252, 189,
+        169, 120, 8, 175, 188, 219, 87, 149, 140, 236, 160, 156, 12, 1, 37, 236, 108, 237, 157, 144, 201, 65, 16, 237,
+        151, 168, 92, 53, 249, 164, 218, 140, 8, 106, 98, 249, 164, 8, 27, 15, 8, 26, 117, 16, 24, 82, 8, 178,
+        168, 12, 1, 176, 172, 199, 32, 117, 16, 190, 136, 113, 218, 140, 202, 136, 91, 8, 31, 16, 3, 157, 189, 2,
+        131, 164, 109, 2, 156, 149, 3, 141, 184, 12, 3, 197, 55, 136, 8, 9, 236, 196, 3, 26, 55, 136, 8, 158,
+        66, 112, 41, 24, 233, 16, 7, 28, 12, 24, 233, 15, 208, 236, 161, 176, 38, 140, 1, 139, 156, 237, 130, 180,
+        7, 142, 128, 246, 235, 118, 7, 82, 12, 223, 53, 65, 198, 53, 2, 176, 176, 24, 59, 15, 241, 54, 65, 236,
+        130, 188, 3, 79, 207, 228, 58, 69, 8, 9, 111, 184, 0, 120, 40, 188, 128, 8, 158, 132, 15, 227, 35, 176,
+        128, 8, 26, 235, 145, 144, 7, 158, 136, 8, 30, 236, 176, 176, 24, 59, 15, 241, 54, 1, 37, 236, 138, 136,
+        240, 228, 176, 168, 24, 75, 6, 32, 117, 228, 238, 24, 82, 16, 24, 149, 66, 1, 37, 16, 8, 26, 24, 131,
+        128, 90, 3, 9, 236, 108, 201, 1, 57, 12, 236, 61, 22, 124, 119, 12, 0, 210, 236, 108, 15, 33, 1, 204,
+        200, 8, 178, 181, 55, 136, 112, 199, 223, 24, 59, 15, 241, 54, 7, 133, 148, 38, 145, 32, 55, 35, 26, 71,
+        149, 136, 109, 15, 24, 59, 15, 241, 54, 112, 207, 15, 2, 138, 136, 33, 15, 1, 58, 69, 16, 24, 59, 15,
+        241, 54, 7, 233, 235, 145, 144, 2, 178, 180, 12, 124, 237, 143, 176, 199, 2, 178, 180, 12, 225, 2, 212, 192,
+        204, 96, 236, 238, 7, 152, 184, 219, 2, 232, 84, 24, 138, 185, 235, 179, 132, 246, 255, 210, 1, 160, 35, 79,
+        6, 8, 78, 19, 2, 164, 128, 219, 224, 235, 141, 152, 24, 231, 12, 146, 12, 1, 212, 192, 57, 200, 88, 96,
+        12, 11, 227, 156, 236, 238, 8, 197, 19, 202, 136, 100, 185, 133, 146, 12, 40, 204, 6, 237, 132, 180, 2, 57,
+        200, 88, 96, 12, 11, 7, 128, 184, 236, 166, 144, 116, 3, 106, 200, 8, 10, 146, 24, 123, 241, 8, 158, 132,
+        222, 16, 247, 128, 237, 123, 190, 140, 15, 120, 223, 226, 10, 119, 8, 195, 246, 127, 19, 73, 1, 107, 6, 237,
+        148, 188, 8, 10, 146, 2, 130, 176, 146, 3, 10, 119, 32, 103, 38, 35, 195, 8, 74, 16, 24, 231, 7, 122,
+        209, 1, 130, 176, 69, 245, 69, 12, 53, 7, 123, 16, 8, 193, 235, 126, 2, 206, 65, 94, 24, 122, 65, 15,
+        65, 51, 12, 121, 122, 15, 53, 3, 161, 156, 15, 2, 215, 94, 3, 161, 160, 84, 1, 131, 129, 24, 122, 236,
+        154, 184, 73, 7, 148, 188, 11, 2, 58, 19, 7, 81, 111, 184, 24, 139, 180, 226, 10, 119, 32, 103, 38, 35,
+        195, 84, 2, 136, 160, 13, 132, 112, 15, 8, 131, 144, 236, 155, 133, 0, 120, 19, 223, 6, 112, 244, 32, 103,
+        73, 2, 232, 235, 145, 144, 2, 136, 160, 72, 31, 19, 100, 64, 53, 6, 76, 156, 8, 9, 19, 6, 112, 244,
+        32, 103, 73, 2, 232, 7, 122, 15, 65, 94, 2, 161, 176, 53, 6, 1, 155, 140, 39, 177, 237, 132, 180, 32,
+        68, 46, 67, 46, 3, 161, 66, 11, 214, 3, 141, 184, 15, 236, 204, 220, 180, 1, 60, 127, 92, 236, 187, 183,
+        225, 236, 160, 128, 102, 225, 237, 150, 132, 135, 236, 133, 148, 3, 205, 235, 170, 172, 33, 3, 167, 164, 236, 61,
+        236, 182, 148, 236, 80, 236, 184, 160, 7, 82, 243, 128, 19, 3, 197, 217, 180, 116, 1, 204, 200, 235, 205, 102,
+        251, 212, 6, 236, 186, 144, 43, 164, 209, 53, 3, 197, 101, 1, 157, 184, 199, 236, 149, 160, 53, 1, 188, 132,
+        237, 132, 176, 221, 7, 231, 127, 54, 3, 205, 102, 251, 57, 207, 19, 119, 7, 142, 156, 39, 164, 235, 78, 19,
+        41, 100, 64, 54, 54, 237, 148, 188, 3, 93, 19, 102, 236, 149, 160, 53, 190, 168, 15, 235, 176, 176, 94, 65,
+        111, 184, 236, 134, 140, 224, 6, 236, 186, 144, 43, 164, 209, 53, 225, 236, 154, 149, 65, 19, 119, 243, 128, 1,
+        9, 12, 235, 74, 19, 1, 161, 176, 102, 40, 156, 132, 6, 236, 189, 152, 39, 160, 7, 148, 140, 73, 12, 113,
+        208, 219, 12, 1, 57, 237, 129, 180, 15, 237, 152, 184, 94, 224, 6, 113, 91, 69, 1, 155, 140, 39, 177, 237,
+        132, 180, 1, 212, 6, 113, 91, 69, 3, 63, 235, 118, 38, 152, 6, 90, 1, 186, 148, 236, 108, 6, 65, 19,
+        113, 237, 152, 184, 1, 156, 160, 69, 208, 127, 236, 134, 140, 69, 208, 54, 55, 132, 1, 153, 128, 19, 119, 235,
+        176, 141, 1, 57, 12, 234, 177, 180, 1, 189, 20, 161, 156, 15, 84, 3, 63, 62, 113, 190, 160, 12, 236, 161,
+        176, 53, 225, 235, 169, 149, 54, 91, 99, 172, 34, 20, 26, 1, 186, 152, 12, 237, 143, 172, 41, 11, 7, 133,
+        141, 236, 61, 6, 190, 140, 38, 152, 6, 90, 3, 118, 12, 92, 54, 2, 187, 172, 235, 159, 188, 252, 149, 168,
+        235, 205, 69, 1, 152, 168, 69, 12, 119, 7, 128, 152, 235, 178, 161, 1, 132, 156, 192, 186, 144, 236, 178, 152,
+        2, 155, 144, 3, 167, 164, 41, 146, 62, 225, 24, 142, 35, 147, 164, 8, 158, 66, 225, 8, 118, 235, 159, 176,
+        2, 238, 236, 156, 133, 224, 62, 85, 91, 236, 131, 164, 7, 59, 217, 176, 192, 107, 109, 236, 155, 140, 109, 223,
+        214, 1, 156, 160, 236, 189, 152, 224, 192, 204, 200, 2, 164, 128, 219, 3, 136, 132, 53, 8, 126, 33, 2, 164,
+        128, 219, 1, 157, 184, 84, 1, 57, 200, 88, 96, 12, 100, 118, 15, 236, 30, 208, 25, 3, 169, 149, 54, 91,
+        253, 6, 51, 62, 1, 131, 129, 33, 24, 123, 237, 231, 16, 235, 126, 16, 51, 1, 185, 188, 12, 23, 140, 103,
+        15, 109, 71, 158, 137, 32, 210, 236, 80, 24, 75, 11, 52, 65, 199, 32, 234, 178, 140, 236, 196, 87, 80, 8,
+        78, 73, 2, 57, 2, 80, 92, 2, 196, 52, 87, 37, 8, 31, 16, 8, 106, 235, 74, 8, 176, 156, 245, 16,
+        87, 37, 15, 2, 176, 168, 2, 152, 136, 235, 125, 2, 178, 180, 16, 2, 188, 128, 192, 37, 236, 196, 87, 178,
+        180, 236, 178, 184, 220, 180, 87, 182, 148, 62, 236, 138, 136, 220, 180, 87, 215, 62, 235, 74, 8, 125, 72, 10,
+        237, 123, 2, 184, 160, 51, 71, 57, 235, 163, 148, 121, 136, 180, 15, 72, 178, 168, 120, 43, 66, 72, 184, 148,
+        15, 199, 240, 16, 71, 206, 16, 6, 51, 71, 185, 188, 198, 117, 121, 131, 144, 8, 125, 135, 72, 118, 38, 184,
+        213, 71, 196, 73, 2, 138, 172, 15, 8, 184, 148, 72, 158, 180, 236, 158, 148, 22, 65, 200, 15, 237, 149, 156,
+        72, 170, 168, 6, 51, 62, 71, 4, 235, 170, 176, 8, 160, 140, 213, 72, 139, 164, 234, 178, 140, 85, 114, 52,
+        3, 125, 8, 161, 20, 63, 54, 72, 74, 235, 118, 42, 160, 43, 66, 121, 59, 85, 91, 135, 71, 60, 200, 8,
+        161, 20, 30, 71, 4, 69, 8, 118, 73, 24, 143, 180, 24, 29, 209, 7, 29, 15, 85, 235, 74, 202, 164, 16,
+        24, 29, 209, 1, 185, 188, 8, 64, 51, 52, 7, 28, 8, 78, 12, 72, 160, 136, 23, 140, 32, 103, 15, 109,
+        72, 161, 156, 6, 146, 135, 72, 179, 188, 120, 103, 15, 109, 72, 179, 188, 8, 161, 156, 103, 202, 164, 72, 172,
+        180, 16, 218, 140, 6, 51, 71, 37, 56, 144, 8, 10, 236, 196, 52, 3, 63, 8, 63, 236, 184, 160, 246, 255,
+        210, 1, 60, 240, 52, 65, 16, 24, 149, 156, 32, 234, 178, 148, 213, 72, 170, 168, 16, 84, 8, 31, 52, 249,
+        136, 236, 238, 41, 8, 74, 235, 118, 42, 160, 43, 66, 121, 142, 156, 236, 108, 121, 104, 73, 135, 72, 30, 12,
+        2, 151, 152, 87, 57, 56, 140, 8, 126, 16, 51, 71, 154, 184, 12, 2, 196, 235, 134, 137, 213, 121, 123, 217,
+        132, 247, 35, 239, 3, 31, 54, 24, 104, 16, 87, 58, 109, 8, 172, 180, 8, 14, 33, 52, 227, 128, 69, 16,
+        87, 61, 94, 15, 71, 61, 15, 24, 81, 135, 71, 196, 218, 144, 73, 32, 45, 8, 63, 8, 63, 236, 184, 160,
+        7, 149, 156, 92, 32, 77, 97, 110, 115, 105, 1, 4, 8, 78, 16, 235, 147, 164, 8, 161, 173, 213, 121, 138,
+        20, 169, 152, 71, 206, 8, 14, 55, 132, 71, 178, 188, 8, 158, 180, 235, 185, 136, 213, 72, 182, 35, 158, 180,
+        24, 28, 87, 185, 152, 69, 247, 128, 236, 151, 173, 1, 215, 16, 236, 206, 236, 184, 160, 51, 72, 74, 235, 125,
+        39, 20, 79, 16, 6, 51, 121, 134, 176, 213, 71, 152, 180, 213, 121, 82, 245, 6, 87, 188, 35, 197, 8, 161,
+        20, 125, 71, 149, 140, 69, 19, 87, 149, 140, 69, 19, 24, 29, 209, 7, 194, 62, 52, 7, 29, 15, 6, 8,
+        74, 236, 196, 8, 14, 213, 24, 29, 209, 112, 117, 202, 168, 71, 182, 148, 2, 60, 33, 245, 246, 255, 210, 1,
+        186, 132, 236, 176, 168, 90, 247, 35, 239, 1, 61, 237, 149, 160, 217, 176, 121, 59, 12, 8, 170, 168, 16, 85,
+        221, 24, 29, 209, 1, 156, 160, 235, 140, 128, 101, 246, 255, 219, 7, 82, 62, 43, 173, 6, 51, 247, 35, 239,
+        65, 235, 172, 180, 16, 71, 61, 207, 52, 124, 236, 196, 236, 206, 24, 75, 11, 87, 186, 144, 53, 113, 3, 159,
+        172, 54, 40, 131, 129, 207, 19, 1, 178, 156, 70, 132, 3, 78, 19, 70, 149, 7, 82, 19, 235, 130, 156, 249,
+        157, 236, 131, 164, 24, 155, 132, 19, 236, 161, 177, 1, 182, 169, 111, 173, 1, 160, 136, 55, 149, 0, 55, 149,
+        236, 134, 140, 3, 179, 181, 234, 177, 180, 190, 136, 237, 155, 132, 19, 3, 158, 180, 119, 23, 157, 1, 130, 176,
+        235, 143, 153, 1, 130, 176, 236, 132, 156, 1, 158, 165, 54, 7, 151, 136, 235, 130, 156, 0, 210, 19, 76, 128,
+        98, 0, 234, 180, 145, 235, 143, 153, 7, 152, 184, 235, 182, 129, 0, 216, 184, 217, 188, 7, 151, 136, 235, 78,
+        19, 1, 130, 176, 54, 3, 130, 180, 235, 170, 189, 18, 168, 124, 127, 19, 8, 170, 189, 18, 168, 7, 151, 164,
+        19, 235, 163, 189, 236, 158, 165, 7, 152, 184, 235, 193, 0, 234, 180, 145, 54, 2, 162, 161, 220, 180, 1, 147,
+        176, 236, 180, 168, 1, 154, 180, 235, 193, 1, 132, 156, 236, 158, 165, 124, 92, 235, 78, 33, 0, 55, 132, 236,
+        145, 164, 1, 185, 173, 207, 19, 1, 139, 160, 236, 158, 165, 2, 156, 132, 210, 16, 220, 180, 1, 164, 145, 25,
+        208, 25, 211, 32, 21, 176, 236, 134, 140, 89, 7, 129, 180, 12, 237, 141, 188, 24, 132, 180, 248, 3, 193, 83,
+        185, 0, 25, 236, 160, 156, 124, 236, 80, 18, 132, 124, 102, 210, 0,
+};
+
+static const unsigned char TERRITORY_NAMES_PAIRS_KO[256][2] = {
+        {0, 0}, {0, 236}, {32, 236}, {0, 235}, {138, 164}, {149, 132}, {236, 4}, {0, 237}, {32, 235}, {157, 188}, {166, 172}, {236, 5},
+        {235, 10}, {236, 157}, {165, 180}, {235, 9}, {235, 14}, {163, 188}, {234, 179}, {13, 180}, {156, 235}, {234, 181}, {2, 17}, {235, 139},
+        {32, 237}, {21, 173}, {130, 152}, {147, 156}, {138, 184}, {129, 172}, {167, 136}, {176, 148}, {32, 32}, {237, 28}, {237, 131}, {128, 235},
+        {143, 132}, {185, 180}, {235, 158}, {236, 139}, {11, 1}, {23, 136}, {32, 18}, {235, 161}, {44, 44}, {45, 45}, {46, 46}, {237, 153},
+        {47, 148}, {48, 25}, {181, 49}, {237, 29}, {42, 50}, {235, 26}, {39, 156}, {234, 176}, {235, 160}, {152, 164}, {154, 176}, {148, 132},
+        {189, 148}, {130, 172}, {235, 31}, {132, 164}, {175, 184}, {1, 5}, {20, 27}, {67, 67}, {68, 68}, {34, 128}, {236, 167}, {22, 1},
+        {22, 3}, {43, 156}, {133, 184}, {139, 176}, {2, 160}, {77, 77}, {178, 160}, {185, 132}, {132, 184}, {134, 160}, {149, 152}, {234, 183},
+        {235, 36}, {2, 4}, {20, 36}, {52, 1}, {56, 136}, {76, 86}, {236, 37}, {236, 60}, {237, 75}, {163, 168}, {235, 30}, {235, 79},
+        {236, 9}, {97, 97}, {236, 58}, {3, 170}, {11, 3}, {13, 184}, {70, 128}, {83, 184}, {130, 164}, {105, 105}, {148, 148}, {151, 144},
+        {158, 144}, {235, 27}, {110, 110}, {236, 185}, {3, 30}, {23, 164}, {34, 132}, {115, 115}, {38, 66}, {55, 128}, {184, 140}, {236, 57},
+        {18, 160}, {22, 7}, {140, 140}, {142, 152}, {124, 124}, {179, 180}, {182, 128}, {235, 63}, {128, 128}, {129, 129}, {130, 130}, {131, 131},
+        {132, 132}, {133, 133}, {134, 134}, {237, 59}, {136, 136}, {137, 137}, {138, 138}, {139, 139}, {140, 140}, {141, 141}, {142, 142}, {143, 143},
+        {144, 144}, {145, 145}, {237, 81}, {147, 147}, {148, 148}, {149, 149}, {150, 150}, {151, 151}, {152, 152}, {153, 153}, {154, 154}, {155, 155},
+        {156, 156}, {157, 157}, {158, 158}, {159, 159}, {160, 160}, {161, 161}, {162, 162}, {163, 163}, {164, 164}, {165, 165}, {166, 166}, {167, 167},
+        {168, 168}, {169, 169}, {170, 170}, {171, 171}, {172, 172}, {173, 173}, {174, 174}, {175, 175}, {176, 176}, {177, 177}, {178, 178}, {179, 179},
+        {180, 180}, {181, 181}, {182, 182}, {183, 183}, {184, 184}, {185, 185}, {186, 186}, {187, 187}, {188, 188}, {189, 189}, {1, 149}, {191, 191},
+        {6, 2}, {130, 168}, {136, 172}, {141, 176}, {149, 188}, {169, 148}, {235, 93}, {235, 106}, {6, 33}, {6, 114}, {8, 139}, {137, 180},
+        {155, 168}, {178, 132}, {191, 160}, {237, 82}, {3, 64}, {15, 19}, {21, 172}, {56, 185}, {61, 98}, {85, 51}, {96, 116}, {157, 180},
+        {234, 184}, {235, 166}, {235, 167}, {236, 17}, {236, 150}, {237, 104}, {1, 80}, {2, 5}, {3, 74}, {3, 203}, {6, 3}, {7, 131},
+        {16, 1}, {18, 188}, {132, 172}, {133, 140}, {136, 152}, {145, 184}, {234, 234}, {235, 235}, {236, 236}, {237, 237}, {166, 136}, {176, 169},
+        {235, 64}, {235, 195}, {236, 107}, {236, 153}, {237, 194}, {2, 37}, {2, 108}, {2, 167}, {2, 230}, {3, 139}, {35, 27}, {41, 40},
+        {95, 40}, {99, 168}, {101, 33}, {111, 152},
+};
+
+static const unsigned short TERRITORY_NAME_ALTERNATIVES_START_KO[_TERRITORY_MAX - _TERRITORY_MIN] = {
+        0, 2, 3, 4, 5, 7, 8, 9, 10, 11, 12, 13, 15, 16, 17, 18,
+        19, 20, 21, 22, 23, 24, 25, 27, 29, 30, 31, 32, 33, 34, 35, 36,
+        38, 39, 42, 43, 46, 47, 48, 50, 51, 53, 55, 56, 57, 59, 60, 61,
+        62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 76, 77, 78,
+        79, 80, 81, 82, 83, 84, 85, 87, 88, 89, 90, 91, 92, 93, 94, 95,
+        96, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 108, 109, 110, 111, 112,
+        113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128,
+        129, 130, 131, 132, 133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143, 144,
+        145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159, 160,
+        161, 162, 163, 164, 165, 166, 167, 168, 169, 170, 171, 172, 173, 174, 175, 176,
+        177, 178, 179, 180, 181, 182, 183, 187, 188, 189, 190, 191, 192, 193, 194, 195,
+        196, 197, 198, 199, 200, 201, 202, 203, 204, 205, 206, 207, 208, 209, 210, 211,
+        212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223, 224, 225, 226, 227,
+        229, 230, 231, 232, 233, 234, 235, 236, 237, 238, 239, 240, 241, 242, 243, 244,
+        245, 246, 247, 248, 249, 250, 251, 252, 253, 254, 255, 256, 257, 258, 259, 260,
+        261, 262, 263, 264, 265, 266, 267, 268, 269, 270, 271, 272, 273, 274, 275, 276,
+        277, 278, 279, 280, 281, 282, 283, 284, 285, 286, 287, 288, 289, 290, 291, 292,
+        293, 294, 295, 296, 297, 298, 299, 300, 301, 302, 303, 304, 305, 306, 307, 308,
+        309, 310, 311, 312, 313, 314, 315, 316, 317, 318, 319, 321, 322, 323, 324, 325,
+        326, 327, 328, 330, 331, 332, 333, 334, 335, 336, 337, 338, 339, 340, 341, 342,
+        343, 344, 345, 346, 347, 348, 349, 350, 351, 352, 353, 354, 355, 356, 357, 358,
+        359, 360, 361, 362, 363, 364, 365, 366, 367, 368, 369, 370, 371, 372, 373, 374,
+        375, 376, 377, 378, 379, 380, 381, 382, 383, 384, 385, 386, 387, 388, 389, 390,
+        391, 392, 393, 394, 395, 396, 397, 398, 399, 400, 401, 402, 403, 404, 405, 406,
+        407, 408, 409, 410, 411, 412, 413, 414, 415, 416, 417, 418, 419, 420, 421, 422,
+        423, 424, 425, 426, 427, 428, 429, 430, 431, 432, 433, 434, 435, 436, 437, 438,
+        439, 440, 441, 442, 443, 444, 445, 446, 447, 448, 449, 450, 451, 452, 453, 454,
+        455, 456, 457, 458, 459, 460, 461, 462, 463, 464, 465, 466, 467, 468, 469, 470,
+        471, 472, 473, 474, 475, 476, 477, 478, 479, 480, 481, 482, 483, 484, 485, 486,
+        487, 488, 489, 490, 491, 492, 493, 494, 495, 496, 497, 498, 499, 500, 501, 502,
+        503, 504, 505, 506, 507, 508, 509, 510, 511, 512, 513, 514, 515, 516, 517, 519,
+        520, 521, 522, 523, 524, 525, 526, 527, 528, 529, 530, 531, 532, 533, 534, 535,
+        536, 537, 538, 539, 540, 541, 542, 544, 545, 546, 547, 548, 549, 551, 552, 553,
+        554, 555, 556, 557, 558, 561,
+};
+
+static const TerritoryNameAlternative TERRITORY_NAME_ALTERNATIVES_KO[561] = {
+        {0, 16, 15}, {17, 9, -1}, {27, 9, 15}, {37, 12, 15}, {50, 12, 15}, {63, 16, 15}, {80, 13, 15}, {94, 18, 15},
+        {113, 9, -1}, {123, 9, 15}, {133, 9, 15}, {143, 15, 15}, {159, 16, 15}, {176, 10, -1}, {187, 10, 15}, {198, 16, 15},
+        {215, 10, 15}, {226, 9, 15}, {236, 26, 15}, {263, 12, 15}, {276, 10, -1}, {287, 9, 15}, {297, 12, 15}, {310, 10, 15},
+        {321, 19, 15}, {341, 19, 15}, {361, 9, 15}, {371, 28, 15}, {400, 28, 15}, {429, 18, 15}, {448, 9, 15}, {458, 13, 15},
+        {472, 21, 15}, {494, 10, 15}, {505, 22, 15}, {528, 9, -1}, {538, 25, 15}, {564, 9, -1}, {574, 16, 15}, {591, 52, 15},
+        {644, 6, 15}, {651, 30, 15}, {682, 9, 15}, {692, 53, 15}, {746, 6, 15}, {753, 23, 15}, {777, 6, 15}, {784, 12, -1},
+        {797, 28, 15}, {826, 28, 15}, {855, 9, 15}, {865, 22, 15}, {888, 9, 15}, {898, 31, 15}, {930, 12, -1}, {943, 26, 15},
+        {970, 15, 15}, {986, 20, 15}, {1007, 10, 15}, {1018, 13, 15}, {1032, 9, 15}, {1042, 9, 15}, {1052, 22, 15}, {1075, 9, 15},
+        {1085, 3, -1}, {1089, 7, 15}, {1097, 18, 15}, {1116, 25, 15}, {1142, 12, 15}, {1155, 6, 15}, {1162, 19, 15}, {1182, 9, 15},
+        {1192, 12, 15}, {1205, 29, 15}, {1235, 22, 15}, {1258, 12, 15}, {1271, 6, 15}, {1278, 15, 15}, {1294, 13, 15}, {1308, 12, -1},
+        {1321, 9, 15}, {1331, 12, 15}, {1344, 12, 15}, {1357, 15, 15}, {1373, 9, 15}, {1383, 52, 15}, {1436, 29, 15}, {1466, 28, 15},
+        {1495, 15, 15}, {1511, 25, 15}, {1537, 12, 15}, {1550, 30, 15}, {1581, 18, 15}, {1600, 12, 15}, {1613, 9, 15}, {1623, 12, 15},
+        {1636, 9, -1}, {1646, 9, 15}, {1656, 19, 15}, {1676, 12, 15}, {1689, 15, 15}, {1705, 9, 15}, {1715, 12, 15}, {1728, 15, 15},
+        {1744, 12, 15}, {1757, 6, 15}, {1764, 18, -1}, {1783, 19, -1}, {1803, 15, 15}, {1819, 12, 15}, {1832, 22, 15}, {1855, 15, 15},
+        {1871, 9, 15}, {1881, 9, 15}, {1891, 25, 15}, {1917, 9, 15}, {1927, 9, 15}, {1937, 9, 15}, {1947, 13, 15}, {1961, 12, 15},
+        {1974, 16, 15}, {1991, 15, 15}, {2007, 9, 15}, {2017, 9, 15}, {2027, 9, 15}, {2037, 15, -1}, {2053, 9, 15}, {2063, 6, 15},
+        {2070, 9, 15}, {2080, 12, -1}, {2093, 9, 15}, {2103, 15, 15}, {2119, 22, 15}, {2142, 15, 15}, {2158, 15, 15}, {2174, 31, 15},
+        {2206, 15, 15}, {2222, 6, 15}, {2229, 12, 15}, {2242, 15, 15}, {2258, 12, 15}, {2271, 9, 15}, {2281, 12, 15}, {2294, 15, 15},
+        {2310, 9, 15}, {2320, 6, 15}, {2327, 22, 15}, {2350, 18, 15}, {2369, 15, 15}, {2385, 18, 15}, {2404, 12, 15}, {2417, 9, 15},
+        {2427, 12, 15}, {2440, 9, 15}, {2450, 12, 15}, {2463, 15, 15}, {2479, 12, -1}, {2492, 6, 15}, {2499, 12, 15}, {2512, 15, 15},
+        {2528, 12, 15}, {2541, 6, 15}, {2548, 15, 15}, {2564, 9, 15}, {2574, 33, 15}, {2608, 12, -1}, {2621, 9, -1}, {2631, 15, 15},
+        {2647, 15, 15}, {2663, 6, -1}, {2670, 9, 15}, {2680, 9, 15}, {2690, 12, 15}, {2703, 12, 15}, {2716, 9, 15}, {2726, 9, 15},
+        {2736, 18, 15}, {2755, 12, 15}, {2768, 12, -1}, {2781, 9, 15}, {2791, 12, 15}, {2804, 6, -1}, {2811, 9, 15}, {2821, 6, 15},
+        {2828, 15, 15}, {2844, 16, 15}, {2861, 17, 15}, {2879, 6, -1}, {2886, 12, 15}, {2899, 16, 15}, {2916, 6, -1}, {2923, 12, -1},
+        {2936, 18, 15}, {2955, 9, 15}, {2965, 12, 15}, {2978, 6, 15}, {2985, 9, 15}, {2995, 18, 15}, {3014, 12, -1}, {3027, 15, 15},
+        {3043, 9, 15}, {3053, 9, 15}, {3063, 16, 15}, {3080, 6, 15}, {3087, 6, 15}, {3094, 12, 15}, {3107, 12, 15}, {3120, 9, 15},
+        {3130, 9, 15}, {3140, 18, 15}, {3159, 9, 15}, {3169, 18, 15}, {3188, 9, 15}, {3198, 21, 15}, {3220, 9, 15}, {3230, 6, 15},
+        {3237, 6, 15}, {3244, 9, 15}, {3254, 16, 15}, {3271, 6, 15}, {3278, 12, 15}, {3291, 18, 15}, {3310, 15, 15}, {3326, 9, -1},
+        {3336, 28, 15}, {3365, 12, 15}, {3378, 18, 15}, {3397, 9, 15}, {3407, 6, 15}, {3414, 9, 15}, {3424, 6, 15}, {3431, 6, 15},
+        {3438, 12, 15}, {3451, 12, 15}, {3464, 12, -1}, {3477, 15, 15}, {3493, 15, -1}, {3509, 12, 15}, {3522, 9, 15}, {3532, 12, 15},
+        {3545, 12, 15}, {3558, 15, 15}, {3574, 12, 15}, {3587, 25, -1}, {3613, 6, 15}, {3620, 9, 15}, {3630, 9, -1}, {3640, 6, 15},
+        {3647, 6, 15}, {3654, 6, 15}, {3661, 6, 15}, {3668, 9, 15}, {3678, 6, 15}, {3685, 15, 15}, {3701, 13, 15}, {3715, 17, 15},
+        {3733, 13, 15}, {3747, 28, 15}, {3776, 10, 15}, {3787, 13, 15}, {3801, 13, 15}, {3815, 13, 15}, {3829, 12, 15}, {3842, 10, -1},
+        {3853, 17, -1}, {3871, 12, 15}, {3884, 9, 15}, {3894, 13, 15}, {3908, 12, 15}, {3921, 10, 15}, {3932, 13, 15}, {3946, 20, 15},
+        {3967, 9, -1}, {3977, 17, -1}, {3995, 22, 15}, {4018, 16, 15}, {4035, 12, 15}, {4048, 34, 15}, {4083, 17, 15}, {4101, 13, 15},
+        {4115, 20, 15}, {4136, 13, 15}, {4150, 10, 15}, {4161, 13, 15}, {4175, 6, -1}, {4182, 9, 15}, {4192, 12, -1}, {4205, 21, 15},
+        {4227, 23, 15}, {4251, 9, 15}, {4261, 15, 15}, {4277, 15, 15}, {4293, 13, -1}, {4307, 31, -1}, {4339, 13, 15}, {4353, 23, 15},
+        {4377, 14, 15}, {4392, 6, 15}, {4399, 13, 15}, {4413, 13, -1}, {4427, 13, 15}, {4441, 13, 15}, {4455, 9, 15}, {4465, 6, 15},
+        {4472, 10, 15}, {4483, 13, 15}, {4497, 26, 15}, {4524, 6, 15}, {4531, 9, 15}, {4541, 13, 15}, {4555, 6, -1}, {4562, 10, 15},
+        {4573, 13, 15}, {4587, 23, 15}, {4611, 12, 15}, {4624, 17, 15}, {4642, 17, 15}, {4660, 17, 15}, {4678, 12, 15}, {4691, 13, 15},
+        {4705, 6, 15}, {4712, 12, -1}, {4725, 16, 15}, {4742, 23, 15}, {4766, 17, 15}, {4784, 22, 15}, {4807, 19, 15}, {4827, 22, 15},
+        {4850, 13, 15}, {4864, 13, 15}, {4878, 23, -1}, {4902, 30, 15}, {4933, 23, 15}, {4957, 19, -1}, {4977, 31, 15}, {5009, 20, 15},
+        {5030, 12, 15}, {5043, 31, 15}, {5075, 12, 15}, {5088, 27, 15}, {5116, 13, 15}, {5130, 16, 15}, {5147, 23, 15}, {5171, 23, 15},
+        {5195, 27, 15}, {5223, 9, 15}, {5233, 19, 15}, {5253, 17, 15}, {5271, 10, 15}, {5282, 6, 15}, {5289, 13, 15}, {5303, 9, 15},
+        {5313, 13, 15}, {5327, 6, 15}, {5334, 13, 15}, {5348, 13, 15}, {5362, 13, 15}, {5376, 26, 15}, {5403, 13, 15}, {5417, 13, -1},
+        {5431, 28, 15}, {5460, 9, 15}, {5470, 23, 15}, {5494, 17, 15}, {5512, 6, 15}, {5519, 16, 15}, {5536, 14, 15}, {5551, 18, 15},
+        {5570, 12, 15}, {5583, 12, 15}, {5596, 9, -1}, {5606, 12, -1}, {5619, 9, 15}, {5629, 15, 15}, {5645, 9, 15}, {5655, 12, 15},
+        {5668, 21, 15}, {5690, 24, 15}, {5715, 6, 15}, {5722, 12, 15}, {5735, 9, 15}, {5745, 9, 15}, {5755, 12, 15}, {5768, 12, 15},
+        {5781, 18, 15}, {5800, 12, 15}, {5813, 15, 15}, {5829, 12, 15}, {5842, 9, 15}, {5852, 21, -1}, {5874, 6, -1}, {5881, 12, 15},
+        {5894, 12, 15}, {5907, 9, 15}, {5917, 12, 15}, {5930, 12, 15}, {5943, 9, 15}, {5953, 15, 15}, {5969, 15, -1}, {5985, 9, 15},
+        {5995, 18, 15}, {6014, 15, -1}, {6030, 9, 15}, {6040, 12, 15}, {6053, 6, 15}, {6060, 12, 15}, {6073, 9, 15}, {6083, 12, 15},
+        {6096, 9, 15}, {6106, 12, 15}, {6119, 9, -1}, {6129, 12, 15}, {6142, 12, -1}, {6155, 9, 15}, {6165, 15, 15}, {6181, 9, 15},
+        {6191, 12, 15}, {6204, 25, 15}, {6230, 9, 15}, {6240, 12, 15}, {6253, 6, 15}, {6260, 17, 15}, {6278, 12, 15}, {6291, 17, -1},
+        {6309, 17, -1}, {6327, 16, -1}, {6344, 35, 15}, {6380, 6, 15}, {6387, 23, -1}, {6411, 20, -1}, {6432, 6, 15}, {6439, 21, 15},
+        {6461, 9, 15}, {6471, 6, 15}, {6478, 9, 15}, {6488, 12, 15}, {6501, 25, 15}, {6527, 22, 15}, {6550, 27, 15}, {6578, 23, 15},
+        {6602, 45, 15}, {6648, 38, 15}, {6687, 48, 15}, {6736, 19, 15}, {6756, 22, 15}, {6779, 17, 15}, {6797, 17, 15}, {6815, 10, 15},
+        {6826, 10, 15}, {6837, 16, 15}, {6854, 19, 15}, {6874, 16, 15}, {6891, 13, 15}, {6905, 14, 15}, {6920, 17, 15}, {6938, 21, 15},
+        {6960, 10, 15}, {6971, 19, 15}, {6991, 16, 15}, {7008, 21, 15}, {7030, 23, -1}, {7054, 17, 15}, {7072, 20, -1}, {7093, 17, 15},
+        {7111, 20, 15}, {7132, 27, 15}, {7160, 30, 15}, {7191, 20, 15}, {7212, 14, 15}, {7227, 20, 15}, {7248, 16, 15}, {7265, 19, 15},
+        {7285, 18, 15}, {7304, 19, 15}, {7324, 23, 15}, {7348, 20, -1}, {7369, 16, 15}, {7386, 25, 15}, {7412, 23, 15}, {7436, 30, -1},
+        {7467, 10, 15}, {7478, 13, 15}, {7492, 20, 15}, {7513, 20, 15}, {7534, 24, 15}, {7559, 13, 15}, {7573, 23, 15}, {7597, 27, 15},
+        {7625, 19, 15}, {7645, 13, 15}, {7659, 17, 15}, {7677, 22, 15}, {7700, 12, 15}, {7713, 28, 15}, {7742, 10, 15}, {7753, 14, 15},
+        {7768, 21, 15}, {7790, 20, 15}, {7811, 13, 15}, {7825, 19, 15}, {7845, 25, -1}, {7871, 14, 15}, {7886, 14, 15}, {7901, 20, 15},
+        {7922, 17, 15}, {7940, 19, 15}, {7960, 19, 15}, {7980, 16, 15}, {7997, 37, 15}, {8035, 14, 15}, {8050, 24, 15}, {8075, 16, 15},
+        {8092, 13, 15}, {8106, 30, 15}, {8137, 19, 15}, {8157, 22, 15}, {8180, 13, 15}, {8194, 16, 15}, {8211, 23, 15}, {8235, 9, 15},
+        {8245, 9, 15}, {8255, 9, 15}, {8265, 6, 15}, {8272, 9, 15}, {8282, 9, 15}, {8292, 16, -1}, {8309, 6, 15}, {8316, 6, 15},
+        {8323, 6, -1}, {8330, 6, 15}, {8337, 9, 15}, {8347, 9, 15}, {8357, 6, 15}, {8364, 6, 15}, {8371, 6, 15}, {8378, 6, 15},
+        {8385, 13, -1}, {8399, 6, -1}, {8406, 6, 15}, {8413, 6, -1}, {8420, 9, 15}, {8430, 6, 15}, {8437, 9, -1}, {8447, 13, -1},
+        {8461, 12, 15}, {8474, 6, 15}, {8481, 13, -1}, {8495, 6, 15}, {8502, 6, 15}, {8509, 6, 15}, {8516, 9, 15}, {8526, 6, -1},
+        {8533, 9, 15}, {8543, 19, 15}, {8563, 6, 15}, {8570, 23, 15}, {8594, 17, 15}, {8612, 6, -1}, {8619, 6, -1}, {8626, 6, 15},
+        {8633, 6, 15},
+};
+
+static char TERRITORY_NAMES_UNPACKED_KO[8640];
+
+static const PackedTerritoryNames PACKED_TERRITORY_NAMES_KO = {
+        TERRITORY_NAMES_UNPACKED_KO, 8640, TERRITORY_NAMES_PACKED_KO, 3927, TERRITORY_NAMES_PAIRS_KO,
+        TERRITORY_NAME_ALTERNATIVES_START_KO, TERRITORY_NAME_ALTERNATIVES_KO};
+
+#else
+
+static const PackedTerritoryNames PACKED_TERRITORY_NAMES_KO = {NULL, 0, NULL, 0, NULL, NULL, NULL};
+
+#endif // MAPCODE_SUPPORT_LANGUAGE_KO
+
+#ifdef MAPCODE_SUPPORT_LANGUAGE_NL // Dutch
+
+// 6795 bytes, packed to 3464
+static const unsigned char TERRITORY_NAMES_PACKED_NL[3464] = {
+        86, 31, 28, 97, 1, 4, 46, 124, 72, 41, 108, 159, 47, 233, 111, 39, 163, 11, 237, 29, 71, 158, 114, 10,
+        212, 191, 111, 107, 39, 97, 134, 67, 111, 99, 160, 180, 105, 12, 164, 75, 101, 39, 130, 215, 115, 216, 229, 225,
+        104, 39, 172, 152, 78, 97, 53, 134, 84, 117, 118, 10, 134, 64, 99, 97, 117, 19, 137, 32, 64, 225, 3, 216,
+        45, 77, 225, 178, 78, 13, 102, 48, 107, 63, 80, 104, 150, 143, 215, 124, 80, 104, 150, 143, 248, 80, 151, 99,
+        97, 144, 110, 215, 24, 66, 189, 118, 128, 248, 66, 7, 109, 246, 193, 59, 56, 241, 181, 100, 105, 1, 14, 99,
+        101, 153, 234, 121, 19, 153, 77, 9, 6, 29, 61, 196, 245, 152, 169, 103, 117, 150, 108, 136, 11, 116, 115, 7,
+        22, 116, 0, 74, 7, 245, 152, 133, 23, 4, 109, 57, 248, 87, 10, 108, 56, 63, 70, 123, 92, 170, 70, 123,
+        92, 193, 59, 115, 47, 64, 127, 100, 3, 94, 164, 66, 59, 115, 47, 64, 127, 100, 3, 184, 76, 34, 62, 116,
+        3, 4, 101, 178, 65, 211, 98, 136, 9, 115, 104, 10, 108, 180, 105, 12, 51, 231, 7, 208, 97, 135, 155, 25,
+        111, 170, 83, 25, 111, 97, 44, 32, 231, 7, 208, 97, 1, 24, 67, 111, 111, 107, 32, 94, 3, 216, 45, 80,
+        105, 7, 114, 47, 54, 77, 105, 244, 39, 11, 124, 77, 105, 244, 39, 179, 78, 105, 247, 216, 131, 151, 116, 115,
+        63, 126, 118, 56, 124, 126, 118, 105, 24, 67, 206, 109, 153, 184, 66, 11, 97, 144, 101, 44, 155, 137, 180, 213,
+        57, 117, 56, 63, 83, 140, 170, 83, 140, 170, 233, 180, 213, 57, 105, 117, 24, 77, 10, 142, 105, 118, 3, 19,
+        137, 45, 72, 39, 3, 97, 44, 32, 65, 115, 99, 3, 115, 105, 11, 63, 84, 23, 4, 153, 100, 238, 92, 104,
+        170, 72, 172, 39, 118, 97, 225, 124, 84, 23, 4, 153, 100, 238, 92, 104, 136, 10, 116, 2, 156, 3, 46, 146,
+        109, 7, 208, 97, 135, 47, 64, 127, 100, 3, 94, 164, 64, 127, 100, 3, 94, 3, 44, 32, 85, 83, 65, 0,
+        64, 121, 145, 116, 101, 19, 118, 10, 98, 224, 32, 8, 32, 74, 153, 64, 121, 164, 74, 153, 64, 121, 3, 216,
+        32, 86, 255, 221, 63, 240, 156, 3, 46, 6, 55, 124, 156, 3, 46, 223, 24, 72, 101, 224, 180, 105, 12, 63,
+        77, 99, 68, 11, 10, 100, 180, 105, 12, 164, 77, 99, 68, 11, 10, 100, 215, 24, 66, 9, 98, 46, 111, 24,
+        169, 116, 159, 117, 97, 63, 66, 9, 98, 246, 170, 66, 9, 98, 246, 2, 67, 117, 22, 195, 167, 97, 111, 19,
+        101, 121, 62, 39, 108, 51, 80, 10, 97, 134, 202, 104, 196, 168, 9, 105, 1, 97, 215, 24, 169, 100, 13, 114,
+        2, 61, 25, 0, 95, 108, 47, 111, 102, 168, 1, 124, 77, 1, 110, 216, 32, 76, 117, 99, 36, 77, 28, 114,
+        11, 55, 129, 124, 70, 142, 7, 31, 142, 155, 116, 31, 55, 32, 111, 102, 168, 28, 114, 11, 55, 36, 83, 130,
+        204, 13, 26, 84, 125, 2, 68, 96, 6, 28, 193, 147, 114, 101, 178, 75, 105, 23, 98, 31, 27, 84, 53, 107,
+        115, 45, 54, 67, 97, 28, 160, 94, 164, 67, 97, 28, 160, 94, 3, 154, 91, 84, 96, 47, 54, 80, 114, 255,
+        143, 101, 124, 80, 114, 255, 143, 26, 72, 125, 131, 125, 163, 225, 6, 105, 244, 26, 70, 97, 7, 195, 182, 7,
+        0, 61, 46, 39, 189, 112, 26, 67, 96, 13, 51, 64, 117, 59, 105, 117, 24, 82, 101, 92, 105, 179, 76, 117,
+        120, 172, 98, 53, 103, 19, 25, 111, 2, 250, 71, 101, 13, 103, 21, 63, 240, 190, 39, 149, 107, 47, 83, 8,
+        119, 228, 94, 164, 250, 83, 8, 119, 228, 184, 70, 114, 135, 45, 80, 48, 121, 110, 55, 35, 75, 97, 204, 118,
+        7, 100, 35, 84, 114, 6, 148, 46, 63, 84, 111, 98, 127, 111, 124, 84, 111, 98, 127, 29, 66, 114, 92, 101,
+        27, 70, 114, 135, 47, 190, 39, 149, 107, 47, 54, 169, 212, 239, 56, 62, 47, 71, 101, 98, 34, 100, 51, 80,
+        117, 7, 116, 111, 30, 28, 29, 67, 121, 112, 211, 24, 76, 158, 1, 179, 74, 25, 97, 28, 2, 71, 198, 36,
+        81, 31, 9, 0, 70, 10, 107, 12, 32, 184, 86, 1, 117, 31, 134, 77, 11, 116, 3, 186, 114, 29, 66, 147,
+        25, 157, 79, 210, 45, 84, 187, 13, 19, 119, 97, 122, 105, 49, 75, 111, 101, 119, 41, 116, 0, 70, 149, 105,
+        45, 184, 176, 138, 10, 142, 11, 36, 83, 108, 58, 3, 35, 95, 22, 20, 108, 0, 80, 10, 185, 6, 105, 153,
+        116, 217, 152, 69, 108, 155, 10, 118, 46, 13, 0, 66, 39, 209, 26, 68, 106, 158, 243, 27, 64, 99, 142, 11,
+        35, 82, 119, 8, 2, 72, 97, 195, 175, 116, 27, 66, 53, 92, 100, 27, 69, 244, 31, 13, 129, 10, 45, 61,
+        223, 146, 108, 98, 1, 21, 19, 48, 96, 11, 32, 184, 65, 114, 109, 3, 35, 76, 55, 145, 104, 29, 66, 39,
+        103, 35, 77, 48, 100, 205, 35, 61, 223, 101, 229, 56, 115, 97, 134, 84, 97, 105, 119, 42, 66, 104, 123, 42,
+        90, 119, 151, 115, 7, 49, 126, 100, 7, 49, 68, 3, 172, 9, 107, 51, 69, 4, 49, 68, 96, 6, 28, 97,
+        135, 101, 52, 19, 108, 111, 119, 141, 149, 26, 67, 210, 97, 30, 28, 193, 160, 110, 21, 63, 72, 7, 122, 186,
+        58, 222, 75, 114, 111, 31, 35, 84, 111, 103, 29, 76, 128, 49, 76, 151, 189, 119, 3, 19, 23, 32, 76, 1,
+        107, 2, 71, 101, 13, 103, 35, 73, 7, 12, 19, 105, 7, 22, 32, 76, 101, 11, 227, 1, 25, 2, 84, 115,
+        106, 101, 62, 56, 62, 101, 60, 70, 114, 135, 45, 61, 121, 192, 235, 3, 159, 240, 65, 22, 98, 56, 62, 47,
+        69, 109, 105, 22, 116, 51, 79, 210, 3, 23, 106, 107, 0, 65, 122, 7, 98, 41, 100, 122, 106, 1, 19, 7,
+        98, 36, 74, 197, 42, 80, 165, 117, 103, 10, 218, 125, 9, 149, 26, 250, 75, 13, 101, 2, 73, 74, 115, 49,
+        61, 31, 172, 10, 2, 67, 117, 98, 193, 214, 103, 9, 149, 26, 76, 158, 7, 36, 72, 11, 100, 117, 22, 24,
+        66, 3, 178, 69, 59, 114, 101, 136, 10, 97, 119, 27, 232, 197, 45, 75, 13, 101, 254, 28, 9, 127, 117, 2,
+        71, 23, 101, 107, 3, 49, 84, 46, 122, 106, 208, 174, 42, 66, 93, 108, 46, 200, 78, 33, 10, 191, 92, 55,
+        21, 19, 53, 6, 25, 26, 85, 211, 103, 117, 97, 152, 67, 198, 188, 106, 2, 83, 121, 114, 21, 19, 3, 186,
+        10, 219, 144, 103, 209, 35, 87, 151, 45, 82, 117, 115, 49, 61, 121, 192, 76, 97, 111, 24, 82, 111, 172, 3,
+        35, 71, 104, 192, 79, 186, 8, 2, 235, 3, 159, 100, 131, 11, 6, 107, 23, 106, 107, 124, 83, 62, 145, 12,
+        124, 156, 111, 145, 32, 66, 59, 116, 1, 110, 21, 124, 232, 197, 32, 73, 7, 12, 124, 73, 7, 12, 44, 32,
+        232, 197, 0, 61, 223, 26, 69, 99, 117, 46, 13, 0, 87, 185, 196, 155, 147, 9, 170, 83, 147, 22, 119, 27,
+        71, 140, 179, 78, 34, 117, 119, 45, 90, 101, 101, 49, 66, 53, 107, 6, 97, 32, 70, 57, 29, 70, 150, 143,
+        112, 149, 110, 51, 73, 116, 10, 35, 79, 109, 42, 80, 48, 51, 73, 118, 111, 13, 107, 117, 15, 232, 13, 119,
+        186, 51, 77, 10, 41, 115, 35, 86, 34, 116, 110, 25, 0, 70, 6, 49, 67, 125, 111, 229, 22, 122, 122, 205,
+        150, 108, 26, 68, 117, 151, 115, 49, 74, 204, 42, 90, 187, 98, 140, 119, 227, 9, 127, 117, 97, 152, 73, 22,
+        107, 163, 9, 111, 107, 107, 29, 79, 101, 122, 98, 101, 107, 174, 42, 90, 119, 142, 51, 80, 204, 111, 101, 97,
+        45, 78, 34, 117, 119, 45, 61, 223, 2, 75, 25, 7, 111, 51, 84, 53, 107, 109, 3, 174, 1, 19, 112, 1,
+        106, 26, 84, 207, 105, 49, 74, 172, 51, 70, 114, 1, 107, 23, 106, 107, 0, 65, 10, 8, 45, 184, 75, 3,
+        36, 66, 145, 115, 119, 1, 136, 46, 127, 57, 99, 9, 220, 101, 107, 22, 195, 175, 110, 26, 250, 83, 111, 142,
+        42, 67, 221, 22, 10, 45, 65, 102, 23, 107, 97, 135, 101, 52, 19, 96, 10, 35, 65, 102, 103, 104, 1, 174,
+        42, 77, 121, 1, 109, 9, 124, 66, 144, 109, 2, 90, 198, 36, 133, 150, 27, 84, 53, 107, 149, 227, 141, 174,
+        42, 77, 111, 122, 198, 105, 244, 26, 78, 25, 158, 35, 86, 3, 101, 122, 117, 39, 254, 159, 7, 36, 84, 1,
+        122, 1, 36, 69, 103, 121, 112, 116, 26, 64, 117, 59, 1, 35, 66, 48, 105, 118, 36, 69, 116, 104, 105, 111,
+        112, 35, 67, 48, 96, 98, 36, 250, 65, 102, 23, 107, 136, 10, 27, 169, 103, 48, 254, 159, 7, 191, 115, 106,
+        97, 46, 0, 80, 7, 134, 77, 125, 48, 35, 73, 114, 42, 76, 158, 21, 19, 111, 142, 42, 181, 100, 11, 55,
+        35, 70, 142, 7, 10, 32, 68, 174, 23, 239, 191, 108, 97, 120, 99, 10, 136, 13, 39, 111, 24, 65, 103, 117,
+        57, 99, 226, 221, 101, 24, 67, 48, 187, 2, 81, 117, 7, 128, 9, 29, 72, 148, 10, 103, 29, 77, 101, 120,
+        28, 91, 233, 31, 26, 84, 140, 57, 99, 29, 78, 206, 9, 151, 0, 61, 1, 97, 106, 117, 31, 29, 80, 247,
+        5, 2, 89, 117, 99, 31, 42, 81, 117, 137, 1, 97, 30, 111, 111, 19, 6, 10, 111, 2, 67, 25, 112, 101,
+        62, 26, 77, 228, 111, 237, 1, 19, 153, 76, 117, 56, 199, 145, 160, 27, 61, 7, 114, 7, 29, 78, 247, 118,
+        91, 76, 101, 179, 66, 97, 106, 238, 226, 102, 13, 110, 36, 235, 237, 211, 122, 0, 133, 129, 112, 157, 66, 97,
+        106, 238, 226, 102, 13, 110, 129, 155, 53, 0, 90, 237, 31, 101, 99, 157, 74, 10, 56, 99, 29, 84, 25, 97,
+        214, 143, 157, 79, 97, 120, 237, 2, 68, 53, 93, 29, 67, 111, 147, 117, 150, 2, 83, 11, 13, 2, 133, 105,
+        104, 117, 147, 117, 2, 156, 111, 3, 12, 154, 246, 105, 45, 65, 22, 98, 35, 67, 125, 111, 45, 75, 6, 115,
+        104, 57, 146, 108, 103, 7, 149, 26, 75, 97, 122, 236, 4, 42, 65, 114, 103, 221, 6, 35, 68, 25, 1, 63,
+        68, 105, 134, 68, 46, 22, 63, 78, 127, 9, 32, 72, 205, 39, 27, 133, 8, 159, 9, 173, 169, 100, 25, 1,
+        63, 78, 28, 111, 98, 9, 0, 76, 141, 115, 104, 46, 119, 101, 33, 0, 68, 39, 104, 27, 77, 186, 104, 10,
+        206, 254, 127, 10, 8, 163, 1, 143, 53, 191, 23, 112, 53, 136, 209, 13, 25, 19, 208, 107, 187, 0, 80, 92,
+        106, 140, 218, 9, 121, 1, 146, 114, 92, 236, 10, 251, 65, 115, 115, 25, 0, 66, 105, 104, 9, 0, 85, 116,
+        212, 141, 104, 8, 0, 71, 111, 2, 75, 7, 10, 2, 84, 25, 150, 32, 78, 46, 134, 72, 187, 236, 10, 251,
+        74, 25, 109, 117, 63, 75, 57, 106, 109, 144, 0, 133, 104, 31, 116, 56, 103, 9, 173, 74, 104, 9, 107, 104,
+        8, 219, 9, 110, 31, 141, 2, 82, 97, 106, 97, 4, 104, 42, 79, 100, 56, 104, 170, 79, 23, 115, 115, 2,
+        61, 106, 9, 31, 0, 87, 185, 229, 3, 103, 10, 51, 77, 46, 104, 121, 97, 251, 84, 39, 93, 1, 146, 110,
+        100, 104, 22, 251, 64, 104, 9, 57, 104, 116, 114, 2, 85, 116, 212, 251, 80, 246, 117, 62, 7, 114, 152, 176,
+        155, 243, 241, 87, 10, 101, 24, 65, 213, 114, 226, 1, 138, 204, 151, 10, 32, 234, 152, 74, 7, 118, 56, 32,
+        66, 206, 32, 234, 105, 117, 109, 0, 202, 104, 196, 32, 234, 121, 19, 243, 241, 65, 213, 114, 10, 36, 84, 57,
+        109, 1, 35, 86, 28, 116, 13, 36, 87, 185, 45, 65, 213, 114, 10, 35, 81, 247, 3, 115, 49, 68, 174, 59,
+        91, 70, 142, 7, 10, 19, 7, 103, 143, 26, 201, 127, 111, 157, 82, 105, 91, 240, 74, 1, 41, 114, 29, 69,
+        115, 112, 105, 59, 91, 83, 253, 29, 82, 105, 91, 156, 8, 47, 100, 91, 202, 227, 9, 97, 158, 2, 83, 253,
+        238, 31, 9, 222, 80, 196, 198, 117, 99, 29, 231, 204, 195, 161, 0, 67, 101, 9, 146, 99, 114, 227, 9, 192,
+        82, 13, 97, 187, 2, 82, 11, 100, 11, 36, 83, 97, 91, 80, 97, 214, 29, 80, 129, 117, 27, 84, 111, 99,
+        253, 6, 24, 82, 105, 91, 156, 8, 47, 100, 91, 83, 214, 163, 9, 1, 207, 29, 71, 111, 129, 24, 77, 31,
+        91, 156, 160, 115, 91, 100, 91, 83, 214, 0, 66, 147, 36, 77, 6, 57, 32, 71, 7, 97, 105, 24, 77, 31,
+        91, 156, 160, 115, 29, 80, 9, 146, 109, 97, 122, 11, 157, 68, 174, 23, 239, 32, 111, 102, 138, 48, 117, 109,
+        98, 36, 82, 104, 188, 47, 95, 49, 68, 39, 97, 119, 9, 26, 67, 11, 110, 101, 239, 28, 123, 0, 176, 32,
+        74, 7, 245, 152, 176, 32, 72, 25, 112, 115, 104, 144, 26, 235, 109, 11, 116, 163, 57, 115, 236, 117, 115, 128,
+        116, 24, 72, 97, 119, 97, 195, 175, 163, 9, 121, 49, 87, 185, 32, 86, 144, 103, 6, 36, 83, 243, 104, 138,
+        9, 48, 222, 64, 6, 26, 181, 100, 105, 192, 75, 221, 117, 99, 107, 152, 84, 3, 110, 55, 245, 26, 86, 144,
+        103, 6, 36, 79, 104, 105, 29, 80, 3, 110, 115, 121, 108, 118, 1, 36, 77, 56, 115, 56, 115, 143, 112, 27,
+        76, 189, 56, 105, 1, 146, 108, 140, 25, 146, 114, 107, 135, 157, 202, 104, 138, 9, 48, 222, 176, 32, 89, 13,
+        107, 0, 73, 111, 119, 2, 73, 108, 108, 6, 111, 105, 24, 71, 101, 13, 103, 36, 87, 56, 99, 11, 115, 178,
+        70, 108, 13, 148, 136, 56, 115, 189, 23, 220, 107, 108, 147, 96, 2, 202, 241, 68, 141, 145, 2, 87, 57, 104,
+        130, 116, 11, 19, 243, 241, 68, 141, 145, 2, 126, 98, 22, 43, 2, 75, 135, 157, 73, 100, 147, 29, 85, 116,
+        147, 163, 6, 110, 55, 145, 136, 228, 159, 42, 87, 121, 96, 130, 220, 114, 186, 179, 67, 48, 13, 46, 29, 126,
+        118, 46, 146, 23, 122, 11, 2, 176, 168, 101, 120, 28, 29, 77, 11, 116, 192, 67, 226, 102, 13, 110, 35, 84,
+        101, 120, 157, 201, 97, 43, 193, 59, 56, 104, 138, 48, 117, 109, 98, 36, 201, 98, 7, 116, 2, 79, 110, 212,
+        105, 29, 81, 247, 98, 101, 99, 154, 43, 31, 62, 101, 119, 42, 77, 1, 151, 111, 98, 2, 176, 102, 111, 92,
+        100, 49, 176, 32, 66, 114, 92, 115, 119, 28, 107, 0, 78, 58, 97, 155, 99, 145, 36, 80, 114, 255, 47, 69,
+        100, 119, 224, 248, 89, 117, 107, 179, 202, 104, 119, 185, 32, 234, 34, 24, 78, 92, 205, 123, 0, 181, 100, 36,
+        65, 213, 114, 10, 35, 66, 22, 122, 150, 35, 86, 83, 124, 235, 3, 159, 240, 233, 31, 164, 231, 7, 208, 136,
+        101, 120, 28, 29, 77, 111, 43, 189, 19, 137, 45, 80, 128, 7, 115, 98, 53, 103, 219, 10, 6, 130, 166, 18,
+        181, 103, 111, 55, 106, 128, 21, 60, 65, 100, 121, 103, 101, 97, 60, 232, 197, 45, 79, 115, 115, 128, 21, 45,
+        201, 1, 129, 60, 75, 140, 224, 6, 111, 229, 10, 107, 9, 60, 75, 9, 236, 206, 45, 133, 7, 107, 55, 115,
+        60, 84, 115, 106, 128, 115, 106, 101, 3, 245, 60, 133, 117, 118, 57, 104, 60, 73, 118, 1, 58, 111, 18, 76,
+        143, 128, 43, 220, 114, 121, 48, 18, 84, 214, 203, 66, 39, 103, 13, 188, 18, 86, 108, 46, 187, 144, 18, 75,
+        53, 132, 75, 10, 117, 103, 203, 84, 198, 230, 66, 114, 121, 1, 132, 89, 9, 160, 108, 205, 108, 18, 82, 121,
+        97, 122, 252, 65, 4, 22, 107, 104, 252, 77, 111, 43, 189, 18, 83, 109, 48, 3, 132, 68, 127, 185, 1, 60,
+        86, 13, 11, 101, 122, 104, 18, 78, 58, 103, 13, 188, 18, 80, 43, 230, 75, 210, 114, 96, 203, 233, 205, 114,
+        111, 112, 48, 177, 75, 22, 115, 110, 188, 9, 177, 75, 10, 109, 117, 107, 107, 21, 60, 84, 118, 7, 18, 76,
+        3, 130, 166, 18, 82, 210, 230, 86, 48, 103, 111, 103, 166, 18, 86, 48, 111, 103, 100, 203, 77, 53, 109, 1,
+        132, 75, 9, 39, 129, 60, 78, 3, 128, 115, 32, 65, 123, 11, 96, 101, 14, 107, 211, 103, 219, 96, 105, 40,
+        28, 0, 65, 114, 107, 104, 93, 39, 132, 77, 197, 58, 21, 60, 78, 209, 104, 110, 121, 32, 78, 58, 103, 13,
+        188, 18, 80, 3, 122, 203, 75, 144, 230, 82, 38, 50, 168, 9, 105, 180, 108, 220, 114, 3, 98, 53, 103, 18,
+        85, 108, 121, 1, 58, 132, 80, 7, 109, 177, 66, 57, 104, 107, 165, 210, 1, 60, 85, 100, 109, 53, 116, 40,
+        28, 191, 31, 9, 4, 1, 52, 19, 25, 9, 203, 83, 9, 31, 230, 89, 25, 10, 111, 45, 78, 3, 128, 24,
+        75, 104, 253, 121, 45, 77, 135, 105, 19, 118, 7, 100, 108, 58, 132, 84, 121, 117, 109, 3, 18, 75, 53, 103,
+        252, 133, 39, 121, 140, 6, 132, 66, 53, 121, 31, 129, 40, 28, 0, 90, 140, 206, 107, 10, 43, 121, 177, 73,
+        114, 107, 111, 128, 132, 78, 58, 160, 158, 144, 132, 84, 96, 132, 79, 109, 132, 75, 104, 141, 57, 115, 129, 60,
+        75, 172, 7, 58, 111, 18, 201, 116, 97, 105, 60, 201, 116, 97, 105, 177, 84, 117, 118, 97, 60, 75, 22, 115,
+        110, 111, 121, 9, 43, 177, 64, 103, 46, 252, 133, 117, 107, 145, 107, 97, 14, 107, 211, 103, 219, 25, 62, 31,
+        107, 97, 162, 105, 19, 141, 104, 10, 6, 18, 80, 23, 109, 13, 43, 121, 177, 74, 111, 188, 115, 47, 65, 123,
+        11, 96, 101, 18, 75, 104, 140, 9, 58, 43, 177, 231, 53, 18, 83, 141, 207, 52, 124, 89, 141, 123, 129, 40,
+        28, 0, 67, 1, 46, 2, 82, 117, 115, 12, 19, 106, 93, 207, 27, 84, 105, 1, 106, 178, 66, 41, 106, 130,
+        218, 97, 6, 42, 78, 130, 120, 129, 32, 72, 117, 27, 133, 125, 113, 130, 0, 90, 104, 101, 106, 242, 0, 74,
+        242, 115, 134, 70, 117, 106, 105, 42, 169, 104, 117, 27, 76, 129, 11, 130, 19, 104, 8, 125, 19, 104, 1, 120,
+        27, 74, 242, 120, 27, 72, 3, 42, 61, 209, 104, 111, 134, 61, 93, 100, 125, 218, 117, 98, 101, 27, 74, 150,
+        178, 72, 101, 98, 41, 19, 207, 1, 120, 27, 78, 41, 168, 125, 48, 124, 181, 110, 7, 168, 125, 48, 36, 72,
+        41, 108, 125, 106, 242, 218, 92, 42, 61, 93, 120, 105, 32, 90, 104, 117, 93, 19, 228, 117, 42, 89, 92, 110,
+        42, 88, 209, 93, 124, 84, 158, 128, 0, 71, 135, 134, 81, 130, 207, 27, 88, 6, 106, 242, 14, 41, 103, 111,
+        7, 115, 26, 133, 222, 85, 110, 151, 142, 155, 116, 31, 55, 168, 6, 13, 14, 123, 108, 121, 130, 215, 24, 67,
+        108, 143, 112, 7, 116, 11, 248, 169, 212, 239, 28, 2, 181, 116, 196, 31, 105, 11, 97, 10, 124, 87, 7, 39,
+        100, 119, 149, 100, 124, 65, 224, 26,
+};
+
+static const unsigned char TERRITORY_NAMES_PAIRS_NL[256][2] = {
+        {0, 0}, {97, 110}, {97, 0}, {101, 110}, {115, 116}, {98, 108}, {105, 110}, {101, 114}, {1, 100}, {97, 114}, {97, 108}, {111, 110},
+        {108, 8}, {111, 114}, {32, 79}, {4, 0}, {5, 97}, {14, 16}, {17, 15}, {0, 83}, {195, 171}, {105, 20}, {114, 97}, {114, 105},
+        {115, 0}, {97, 109}, {101, 0}, {105, 0}, {105, 99}, {111, 0}, {32, 82}, {97, 116}, {32, 32}, {101, 112}, {105, 101}, {21, 0},
+        {105, 2}, {33, 117}, {37, 5}, {101, 108}, {30, 38}, {101, 105}, {1, 0}, {115, 107}, {44, 44}, {45, 45}, {97, 100}, {101, 32},
+        {111, 108}, {12, 0}, {34, 107}, {3, 0}, {40, 50}, {117, 114}, {3, 32}, {101, 115}, {105, 115}, {97, 115}, {111, 118}, {23, 116},
+        {52, 0}, {71, 117}, {99, 104}, {32, 54}, {77, 97}, {65, 65}, {66, 66}, {67, 67}, {68, 68}, {69, 69}, {70, 70}, {71, 71},
+        {72, 72}, {73, 73}, {74, 74}, {75, 75}, {76, 76}, {77, 77}, {78, 78}, {79, 79}, {80, 80}, {81, 81}, {82, 82}, {83, 83},
+        {84, 84}, {85, 85}, {86, 86}, {87, 87}, {88, 88}, {89, 89}, {90, 90}, {111, 32}, {117, 110}, {1, 103}, {41, 12}, {73, 115},
+        {111, 109}, {97, 97}, {98, 98}, {99, 99}, {100, 100}, {101, 101}, {102, 102}, {103, 103}, {104, 104}, {105, 105}, {106, 106}, {107, 107},
+        {108, 108}, {109, 109}, {110, 110}, {111, 111}, {112, 112}, {113, 113}, {114, 114}, {115, 115}, {116, 116}, {117, 117}, {118, 118}, {119, 119},
+        {120, 120}, {121, 121}, {122, 122}, {117, 116}, {124, 124}, {11, 103}, {78, 101}, {97, 103}, {101, 116}, {105, 97}, {6, 103}, {32, 75},
+        {43, 18}, {67, 104}, {117, 0}, {1, 115}, {2, 77}, {6, 116}, {32, 67}, {32, 95}, {97, 98}, {97, 107}, {101, 100}, {105, 112},
+        {105, 114}, {111, 116}, {2, 65}, {97, 104}, {105, 100}, {105, 106}, {105, 108}, {105, 116}, {121, 0}, {1, 32}, {19, 97}, {32, 83},
+        {71, 114}, {97, 24}, {105, 98}, {105, 103}, {111, 115}, {161, 161}, {131, 22}, {0, 77}, {3, 124}, {13, 116}, {22, 100}, {167, 167},
+        {32, 77}, {65, 110}, {97, 124}, {171, 171}, {101, 109}, {104, 0}, {105, 4}, {175, 175}, {126, 119}, {162, 27}, {6, 0}, {11, 0},
+        {32, 69}, {73, 110}, {182, 182}, {90, 117}, {94, 51}, {101, 4}, {101, 103}, {105, 109}, {111, 100}, {111, 117}, {183, 148}, {0, 84},
+        {1, 2}, {2, 66}, {7, 59}, {195, 195}, {7, 110}, {13, 100}, {25, 98}, {32, 80}, {55, 173}, {65, 108}, {78, 165}, {97, 18},
+        {97, 112}, {97, 118}, {97, 121}, {104, 97}, {105, 107}, {105, 122}, {111, 4}, {114, 117}, {116, 9}, {117, 4}, {117, 108}, {139, 12},
+        {154, 137}, {194, 13}, {0, 72}, {0, 75}, {0, 79}, {3, 116}, {6, 2}, {6, 101}, {9, 100}, {9, 116}, {10, 105}, {26, 80},
+        {28, 104}, {45, 66}, {58, 18}, {65, 109}, {78, 111}, {83, 116}, {84, 217}, {86, 7}, {97, 62}, {97, 99}, {97, 138}, {99, 116},
+        {100, 47}, {104, 32}, {105, 93}, {111, 123}, {113, 117}, {115, 101}, {117, 100}, {117, 101}, {139, 49}, {166, 200}, {190, 45}, {199, 249},
+        {1, 18}, {1, 116}, {2, 78}, {6, 99},
+};
+
+static const unsigned short TERRITORY_NAME_ALTERNATIVES_START_NL[_TERRITORY_MAX - _TERRITORY_MIN] = {
+        0, 2, 3, 4, 5, 7, 8, 9, 10, 11, 12, 13, 15, 16, 17, 18,
+        19, 20, 21, 22, 23, 24, 25, 27, 29, 30, 31, 32, 34, 35, 37, 38,
+        40, 41, 44, 45, 48, 49, 50, 52, 53, 55, 57, 59, 60, 62, 63, 64,
+        65, 66, 67, 68, 70, 71, 73, 74, 75, 76, 77, 78, 80, 82, 83, 84,
+        85, 86, 87, 88, 89, 90, 91, 93, 94, 95, 97, 98, 99, 100, 101, 102,
+        103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118,
+        119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132, 133, 134,
+        135, 136, 137, 138, 139, 140, 141, 142, 143, 144, 145, 146, 147, 148, 149, 150,
+        151, 152, 153, 154, 155, 156, 157, 158, 159, 160, 161, 162, 163, 164, 165, 166,
+        167, 168, 169, 170, 171, 172, 173, 174, 175, 176, 177, 178, 179, 180, 181, 182,
+        183, 184, 185, 186, 187, 188, 189, 194, 195, 196, 198, 199, 200, 201, 202, 203,
+        204, 205, 206, 207, 208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219,
+        220, 221, 222, 223, 224, 225, 226, 227, 228, 229, 230, 231, 232, 233, 234, 235,
+        237, 238, 239, 240, 241, 242, 243, 244, 245, 246, 247, 248, 249, 250, 251, 252,
+        253, 254, 255, 256, 257, 258, 259, 260, 261, 262, 263, 264, 265, 266, 267, 268,
+        269, 270, 271, 272, 273, 274, 275, 276, 277, 278, 279, 280, 281, 282, 283, 284,
+        285, 286, 287, 288, 289, 290, 291, 292, 293, 294, 295, 296, 297, 298, 299, 300,
+        301, 302, 303, 304, 305, 306, 307, 308, 309, 310, 311, 312, 313, 314, 315, 316,
+        317, 318, 319, 320, 321, 322, 323, 324, 325, 326, 327, 329, 330, 331, 332, 333,
+        334, 335, 336, 337, 338, 339, 340, 341, 342, 343, 344, 345, 346, 347, 348, 349,
+        350, 351, 352, 353, 354, 355, 356, 357, 358, 359, 360, 361, 362, 363, 364, 365,
+        366, 367, 368, 369, 370, 371, 372, 373, 374, 375, 376, 377, 378, 379, 380, 381,
+        382, 383, 384, 385, 386, 387, 388, 389, 390, 391, 392, 393, 394, 395, 396, 397,
+        398, 399, 400, 401, 402, 403, 404, 405, 406, 407, 408, 409, 410, 411, 412, 413,
+        414, 415, 416, 417, 418, 419, 420, 421, 422, 423, 424, 425, 426, 427, 428, 429,
+        430, 431, 432, 433, 434, 435, 436, 437, 438, 439, 440, 443, 444, 445, 446, 447,
+        448, 449, 450, 451, 452, 453, 454, 455, 456, 457, 458, 459, 460, 461, 462, 463,
+        464, 465, 466, 467, 468, 469, 470, 471, 472, 473, 474, 475, 476, 477, 478, 479,
+        480, 481, 482, 483, 484, 485, 486, 487, 488, 489, 490, 491, 492, 493, 494, 495,
+        496, 497, 498, 499, 500, 501, 502, 503, 504, 505, 506, 507, 508, 509, 510, 511,
+        512, 513, 514, 515, 516, 517, 518, 519, 520, 521, 522, 523, 524, 525, 526, 528,
+        529, 530, 531, 532, 533, 534, 535, 536, 537, 538, 539, 540, 541, 542, 543, 544,
+        545, 546, 547, 548, 549, 550, 551, 553, 554, 555, 556, 557, 558, 560, 561, 562,
+        563, 564, 565, 566, 567, 570,
+};
+
+static const TerritoryNameAlternative TERRITORY_NAME_ALTERNATIVES_NL[570] = {
+        {0, 12, 0}, {13, 13, 0}, {27, 6, 0}, {34, 9, 0}, {44, 7, 0}, {52, 14, 0}, {67, 15, 0}, {83, 16, 0},
+        {100, 5, 0}, {106, 6, 0}, {113, 5, 0}, {119, 12, 0}, {132, 12, 0}, {145, 24, 0}, {170, 13, 0}, {184, 16, 0},
+        {201, 13, 0}, {215, 7, 0}, {223, 30, 0}, {254, 10, 0}, {265, 8, 0}, {274, 8, 0}, {283, 10, 0}, {294, 6, 0},
+        {301, 16, 0}, {318, 16, 0}, {335, 6, 0}, {342, 22, 0}, {365, 22, 0}, {388, 13, 0}, {402, 5, 0}, {408, 17, 0},
+        {426, 16, 0}, {443, 17, 0}, {461, 13, 0}, {475, 24, 0}, {500, 8, 0}, {509, 4, 0}, {514, 20, 0}, {535, 5, 0},
+        {541, 15, 0}, {557, 31, 0}, {589, 4, 0}, {594, 12, 0}, {607, 9, 0}, {617, 42, 0}, {660, 10, 0}, {671, 16, 0},
+        {688, 5, 0}, {694, 7, 0}, {702, 27, 0}, {730, 20, 0}, {751, 7, 0}, {759, 22, 0}, {782, 9, 0}, {792, 30, 0},
+        {823, 10, 0}, {834, 33, 0}, {868, 16, 0}, {885, 8, 0}, {894, 18, 0}, {913, 7, 0}, {921, 8, 0}, {930, 10, 0},
+        {941, 5, 0}, {947, 24, 0}, {972, 7, 0}, {980, 4, 0}, {985, 11, 0}, {997, 4, 0}, {1002, 11, 0}, {1014, 10, 0},
+        {1025, 30, 0}, {1056, 9, 0}, {1066, 5, 0}, {1072, 8, 0}, {1081, 7, 0}, {1089, 8, 0}, {1098, 23, 0}, {1122, 14, 0},
+        {1137, 20, 0}, {1158, 8, 0}, {1167, 9, 0}, {1177, 10, 0}, {1188, 8, 0}, {1197, 10, 0}, {1208, 7, 0}, {1216, 9, 0},
+        {1226, 7, 0}, {1234, 9, 0}, {1244, 5, 0}, {1250, 47, 0}, {1298, 21, 0}, {1320, 16, 0}, {1337, 11, 0}, {1349, 18, 0},
+        {1368, 6, 0}, {1375, 6, 0}, {1382, 42, 0}, {1425, 11, 0}, {1437, 6, 0}, {1444, 7, 0}, {1452, 7, 0}, {1460, 6, 0},
+        {1467, 5, 0}, {1473, 17, 0}, {1491, 7, 0}, {1499, 10, 0}, {1510, 7, 0}, {1518, 10, 0}, {1529, 9, 0}, {1539, 7, 0},
+        {1547, 13, 0}, {1561, 13, 0}, {1575, 9, 0}, {1585, 7, 0}, {1593, 21, 0}, {1615, 11, 0}, {1627, 6, 0}, {1634, 8, 0},
+        {1643, 10, 0}, {1654, 6, 0}, {1661, 6, 0}, {1668, 7, 0}, {1676, 18, 0}, {1695, 8, 0}, {1704, 16, 0}, {1721, 8, 0},
+        {1730, 7, 0}, {1738, 7, 0}, {1746, 9, 0}, {1756, 13, 0}, {1770, 6, 0}, {1777, 6, 0}, {1784, 11, 0}, {1796, 9, 0},
+        {1806, 10, 0}, {1817, 7, 0}, {1825, 22, 0}, {1848, 9, 0}, {1858, 10, 0}, {1869, 22, 0}, {1892, 8, 0}, {1901, 4, 0},
+        {1906, 7, 0}, {1914, 8, 0}, {1923, 9, 0}, {1933, 8, 0}, {1942, 7, 0}, {1950, 12, 0}, {1963, 6, 0}, {1970, 21, 0},
+        {1992, 12, 0}, {2005, 28, 0}, {2034, 10, 0}, {2045, 12, 0}, {2058, 6, 0}, {2065, 6, 0}, {2072, 8, 0}, {2081, 9, 0},
+        {2091, 10, 0}, {2102, 7, 0}, {2110, 9, 0}, {2120, 4, 0}, {2125, 9, 0}, {2135, 7, 0}, {2143, 8, 0}, {2152, 5, 0},
+        {2158, 7, 0}, {2166, 6, 0}, {2173, 11, 0}, {2185, 9, 0}, {2195, 11, 0}, {2207, 12, 0}, {2220, 10, 0}, {2231, 5, 0},
+        {2237, 8, 0}, {2246, 8, 0}, {2255, 7, 0}, {2263, 8, 0}, {2272, 6, 0}, {2279, 7, 0}, {2287, 9, 0}, {2297, 11, 0},
+        {2309, 6, 0}, {2316, 4, 0}, {2321, 9, 0}, {2331, 5, 0}, {2337, 7, 0}, {2345, 19, 0}, {2365, 9, 0}, {2375, 17, 0},
+        {2393, 13, 0}, {2407, 14, 0}, {2422, 6, 0}, {2429, 7, 0}, {2437, 14, 0}, {2452, 7, 0}, {2460, 5, 0}, {2466, 13, 0},
+        {2480, 12, 0}, {2493, 11, 0}, {2505, 7, 0}, {2513, 4, 0}, {2518, 5, 0}, {2524, 9, 0}, {2534, 9, 0}, {2544, 9, 0},
+        {2554, 7, 0}, {2562, 7, 0}, {2570, 17, 0}, {2588, 9, 0}, {2598, 5, 0}, {2604, 8, 0}, {2613, 8, 0}, {2622, 4, 0},
+        {2627, 7, 0}, {2635, 11, 0}, {2647, 6, 0}, {2654, 19, 0}, {2674, 8, 0}, {2683, 12, 0}, {2696, 6, 0}, {2703, 8, 0},
+        {2712, 5, 0}, {2718, 9, 0}, {2728, 15, 0}, {2744, 5, 0}, {2750, 8, 0}, {2759, 10, 0}, {2770, 9, 0}, {2780, 11, 0},
+        {2792, 29, 0}, {2822, 8, 0}, {2831, 11, 0}, {2843, 7, 0}, {2851, 5, 0}, {2857, 6, 0}, {2864, 5, 0}, {2870, 7, 0},
+        {2878, 8, 0}, {2887, 10, 0}, {2898, 8, 0}, {2907, 9, 0}, {2917, 7, 0}, {2925, 8, 0}, {2934, 6, 0}, {2941, 11, 0},
+        {2953, 7, 0}, {2961, 9, 0}, {2971, 8, 0}, {2980, 11, 0}, {2992, 4, 0}, {2997, 6, 0}, {3004, 5, 0}, {3010, 6, 0},
+        {3017, 4, 0}, {3022, 9, 0}, {3032, 4, 0}, {3037, 6, 0}, {3044, 6, 0}, {3051, 10, 0}, {3062, 16, 0}, {3079, 8, 0},
+        {3088, 7, 0}, {3096, 14, 0}, {3111, 6, 0}, {3118, 9, 0}, {3128, 7, 0}, {3136, 12, 0}, {3149, 7, 0}, {3157, 7, 0},
+        {3165, 10, 0}, {3176, 6, 0}, {3183, 7, 0}, {3191, 12, 0}, {3204, 7, 0}, {3212, 8, 0}, {3221, 9, 0}, {3231, 15, 0},
+        {3247, 8, 0}, {3256, 10, 0}, {3267, 15, 0}, {3283, 8, 0}, {3292, 7, 0}, {3300, 19, 0}, {3320, 9, 0}, {3330, 7, 0},
+        {3338, 10, 0}, {3349, 6, 0}, {3356, 7, 0}, {3364, 8, 0}, {3373, 6, 0}, {3380, 9, 0}, {3390, 9, 0}, {3400, 13, 0},
+        {3414, 14, 0}, {3429, 8, 0}, {3438, 10, 0}, {3449, 11, 0}, {3461, 12, 0}, {3474, 21, 0}, {3496, 10, 0}, {3507, 18, 0},
+        {3526, 11, 0}, {3538, 5, 0}, {3544, 9, 0}, {3554, 8, 0}, {3563, 7, 0}, {3571, 7, 0}, {3579, 7, 0}, {3587, 6, 0},
+        {3594, 6, 0}, {3601, 7, 0}, {3609, 17, 0}, {3627, 5, 0}, {3633, 5, 0}, {3639, 11, 0}, {3651, 3, 0}, {3655, 6, 0},
+        {3662, 10, 0}, {3673, 16, 0}, {3690, 16, 0}, {3707, 12, 0}, {3720, 9, 0}, {3730, 9, 0}, {3740, 9, 0}, {3750, 6, 0},
+        {3757, 6, 0}, {3764, 7, 0}, {3772, 13, 0}, {3786, 14, 0}, {3801, 9, 0}, {3811, 14, 0}, {3826, 11, 0}, {3838, 13, 0},
+        {3852, 10, 0}, {3863, 15, 0}, {3879, 28, 0}, {3908, 22, 0}, {3931, 18, 0}, {3950, 15, 0}, {3966, 9, 0}, {3976, 8, 0},
+        {3985, 15, 0}, {4001, 10, 0}, {4012, 16, 0}, {4029, 7, 0}, {4037, 7, 0}, {4045, 14, 0}, {4060, 14, 0}, {4075, 19, 0},
+        {4095, 7, 0}, {4103, 14, 0}, {4118, 10, 0}, {4129, 6, 0}, {4136, 5, 0}, {4142, 4, 0}, {4147, 6, 0}, {4154, 7, 0},
+        {4162, 8, 0}, {4171, 9, 0}, {4181, 5, 0}, {4187, 9, 0}, {4197, 17, 0}, {4215, 8, 0}, {4224, 5, 0}, {4230, 18, 0},
+        {4249, 5, 0}, {4255, 12, 0}, {4268, 11, 0}, {4280, 4, 0}, {4285, 8, 0}, {4294, 20, 0}, {4315, 12, 0}, {4328, 8, 0},
+        {4337, 11, 0}, {4349, 10, 0}, {4360, 13, 0}, {4374, 7, 0}, {4382, 13, 0}, {4396, 6, 0}, {4403, 8, 0}, {4412, 13, 0},
+        {4426, 14, 0}, {4441, 5, 0}, {4447, 7, 0}, {4455, 8, 0}, {4464, 9, 0}, {4474, 8, 0}, {4483, 4, 0}, {4488, 12, 0},
+        {4501, 11, 0}, {4513, 9, 0}, {4523, 7, 0}, {4531, 8, 0}, {4540, 14, 0}, {4555, 8, 0}, {4564, 4, 0}, {4569, 8, 0},
+        {4578, 7, 0}, {4586, 9, 0}, {4596, 7, 0}, {4604, 8, 0}, {4613, 8, 0}, {4622, 12, 0}, {4635, 10, 0}, {4646, 12, 0},
+        {4659, 8, 0}, {4668, 6, 0}, {4675, 5, 0}, {4681, 4, 0}, {4686, 9, 0}, {4696, 8, 0}, {4705, 7, 0}, {4713, 6, 0},
+        {4720, 8, 0}, {4729, 6, 0}, {4736, 7, 0}, {4744, 10, 0}, {4755, 7, 0}, {4763, 11, 0}, {4775, 5, 0}, {4781, 6, 0},
+        {4788, 16, 0}, {4805, 7, 0}, {4813, 7, 0}, {4821, 6, 0}, {4828, 12, 0}, {4841, 8, 0}, {4850, 12, 0}, {4863, 13, 0},
+        {4877, 11, 0}, {4889, 20, 0}, {4910, 5, 0}, {4916, 21, 0}, {4938, 7, 0}, {4946, 5, 0}, {4952, 10, 0}, {4963, 9, 0},
+        {4973, 2, 0}, {4976, 16, 0}, {4993, 7, 0}, {5001, 6, 0}, {5008, 6, 0}, {5015, 15, 0}, {5031, 18, 0}, {5050, 22, 0},
+        {5073, 16, 0}, {5090, 31, 0}, {5122, 26, 0}, {5149, 27, 0}, {5177, 22, 0}, {5200, 17, 0}, {5218, 14, 0}, {5233, 7, 0},
+        {5241, 12, 0}, {5254, 11, 0}, {5266, 15, 0}, {5282, 15, 0}, {5298, 12, 0}, {5311, 13, 0}, {5325, 13, 0}, {5339, 14, 0},
+        {5354, 16, 0}, {5371, 13, 0}, {5385, 16, 0}, {5402, 13, 0}, {5416, 15, 0}, {5432, 18, 0}, {5451, 15, 0}, {5467, 15, 0},
+        {5483, 12, 0}, {5496, 15, 0}, {5512, 14, 0}, {5527, 14, 0}, {5542, 20, 0}, {5563, 11, 0}, {5575, 16, 0}, {5592, 13, 0},
+        {5606, 16, 0}, {5623, 14, 0}, {5638, 15, 0}, {5654, 17, 0}, {5672, 21, 0}, {5694, 13, 0}, {5708, 18, 0}, {5727, 19, 0},
+        {5747, 22, 0}, {5770, 12, 0}, {5783, 12, 0}, {5796, 17, 0}, {5814, 15, 0}, {5830, 16, 0}, {5847, 9, 0}, {5857, 23, 0},
+        {5881, 15, 0}, {5897, 19, 0}, {5917, 13, 0}, {5931, 14, 0}, {5946, 13, 0}, {5960, 12, 0}, {5973, 17, 0}, {5991, 13, 0},
+        {6005, 13, 0}, {6019, 18, 0}, {6038, 17, 0}, {6056, 16, 0}, {6073, 15, 0}, {6089, 18, 0}, {6108, 12, 0}, {6121, 11, 0},
+        {6133, 19, 0}, {6153, 15, 0}, {6169, 15, 0}, {6185, 10, 0}, {6196, 14, 0}, {6211, 16, 0}, {6228, 14, 0}, {6243, 14, 0},
+        {6258, 14, 0}, {6273, 15, 0}, {6289, 14, 0}, {6304, 22, 0}, {6327, 15, 0}, {6343, 11, 0}, {6355, 15, 0}, {6371, 16, 0},
+        {6388, 6, 0}, {6395, 7, 0}, {6403, 8, 0}, {6412, 7, 0}, {6420, 7, 0}, {6428, 6, 0}, {6435, 11, 0}, {6447, 9, 0},
+        {6457, 8, 0}, {6466, 7, 0}, {6474, 6, 0}, {6481, 5, 0}, {6487, 8, 0}, {6496, 8, 0}, {6505, 6, 0}, {6512, 7, 0},
+        {6520, 5, 0}, {6526, 7, 0}, {6534, 9, 0}, {6544, 5, 0}, {6550, 5, 0}, {6556, 5, 0}, {6562, 7, 0}, {6570, 10, 0},
+        {6581, 14, 0}, {6596, 12, 0}, {6609, 5, 0}, {6615, 14, 0}, {6630, 7, 0}, {6638, 6, 0}, {6645, 6, 0}, {6652, 5, 0},
+        {6658, 5, 0}, {6664, 7, 0}, {6672, 18, 0}, {6691, 5, 0}, {6697, 36, 0}, {6734, 17, 0}, {6752, 10, 0}, {6763, 14, 0},
+        {6778, 10, 0}, {6789, 5, 0},
+};
+
+static char TERRITORY_NAMES_UNPACKED_NL[6795];
+
+static const PackedTerritoryNames PACKED_TERRITORY_NAMES_NL = {
+        TERRITORY_NAMES_UNPACKED_NL, 6795, TERRITORY_NAMES_PACKED_NL, 3464, TERRITORY_NAMES_PAIRS_NL,
+        TERRITORY_NAME_ALTERNATIVES_START_NL, TERRITORY_NAME_ALTERNATIVES_NL};
+
+#else
+
+static const PackedTerritoryNames PACKED_TERRITORY_NAMES_NL = {NULL, 0, NULL, 0, NULL, NULL, NULL};
+
+#endif // MAPCODE_SUPPORT_LANGUAGE_NL
+
+#ifdef MAPCODE_SUPPORT_LANGUAGE_NO // Norwegian
+
+// 6525 bytes, packed to 3348
+static const unsigned char TERRITORY_NAMES_PACKED_NO[3348] = {
+        86, 34, 24, 1, 3, 34, 4, 92, 12, 146, 28, 71, 149, 212, 242, 93, 241, 43, 164, 58, 241, 139, 225, 75,
+        101, 43, 6, 49, 183, 39, 115, 22, 168, 227, 8, 116, 104, 195, 169, 108, 208, 121, 51, 97, 41, 117, 93, 117,
+        118, 9, 117, 92, 146, 97, 111, 22, 125, 32, 77, 97, 8, 116, 250, 168, 45, 234, 116, 6, 51, 11, 102, 46,
+        107, 35, 148, 80, 104, 150, 156, 32, 183, 135, 80, 33, 99, 97, 129, 110, 134, 66, 111, 117, 118, 91, 35, 179,
+        7, 109, 214, 179, 62, 245, 236, 105, 91, 32, 188, 233, 105, 126, 206, 91, 22, 141, 234, 6, 28, 59, 219, 115,
+        101, 121, 177, 110, 103, 117, 150, 108, 123, 12, 116, 115, 7, 19, 116, 193, 7, 115, 101, 121, 0, 145, 114, 128,
+        109, 56, 35, 2, 87, 9, 108, 57, 45, 55, 70, 140, 61, 97, 225, 70, 140, 61, 97, 134, 66, 62, 245, 74,
+        54, 102, 174, 224, 124, 74, 54, 102, 174, 224, 201, 66, 62, 187, 16, 76, 105, 101, 207, 116, 4, 3, 101, 6,
+        177, 174, 98, 123, 8, 115, 239, 108, 134, 202, 253, 32, 83, 27, 111, 243, 27, 111, 97, 201, 202, 253, 0, 67,
+        111, 241, 134, 83, 168, 45, 80, 105, 252, 101, 55, 77, 105, 113, 117, 43, 12, 124, 77, 105, 113, 117, 43, 12,
+        51, 240, 16, 83, 168, 132, 33, 116, 115, 55, 235, 118, 57, 124, 235, 118, 105, 29, 67, 127, 109, 1, 134, 66,
+        12, 97, 129, 101, 201, 83, 125, 32, 69, 213, 34, 240, 115, 55, 83, 137, 243, 137, 243, 125, 32, 69, 213, 34,
+        240, 29, 77, 9, 100, 105, 118, 52, 83, 168, 32, 72, 43, 4, 97, 201, 65, 115, 99, 4, 115, 105, 12, 55,
+        84, 114, 128, 141, 100, 226, 61, 104, 148, 65, 115, 99, 4, 115, 105, 12, 124, 84, 114, 128, 141, 100, 226, 61,
+        104, 123, 9, 116, 2, 162, 4, 42, 142, 109, 253, 53, 74, 54, 102, 174, 224, 124, 74, 54, 102, 174, 224, 201,
+        202, 253, 16, 77, 127, 151, 116, 16, 83, 118, 9, 98, 254, 55, 74, 141, 77, 127, 4, 124, 74, 141, 77, 127,
+        250, 168, 32, 86, 6, 99, 198, 55, 162, 4, 42, 6, 216, 162, 4, 42, 6, 52, 72, 101, 254, 45, 55, 77,
+        99, 68, 12, 9, 100, 225, 77, 99, 68, 12, 9, 100, 134, 66, 8, 98, 42, 111, 29, 65, 110, 116, 209, 117,
+        97, 55, 66, 8, 98, 214, 148, 66, 8, 98, 214, 248, 117, 19, 195, 167, 97, 111, 22, 101, 121, 207, 43, 108,
+        52, 80, 9, 164, 51, 215, 234, 105, 1, 52, 65, 172, 11, 114, 2, 59, 27, 0, 183, 108, 101, 26, 102, 32,
+        77, 197, 168, 32, 76, 117, 99, 10, 77, 24, 114, 12, 96, 105, 97, 102, 20, 100, 7, 56, 106, 12, 250, 143,
+        205, 11, 16, 84, 64, 2, 68, 54, 6, 30, 179, 126, 19, 6, 58, 129, 149, 34, 25, 84, 41, 107, 115, 45,
+        55, 67, 97, 30, 139, 225, 67, 97, 30, 139, 134, 83, 195, 163, 60, 84, 54, 195, 169, 55, 80, 114, 195, 173,
+        110, 99, 156, 101, 124, 80, 114, 195, 173, 110, 99, 156, 16, 72, 64, 107, 64, 92, 8, 116, 6, 105, 113, 117,
+        16, 70, 195, 166, 114, 134, 59, 42, 43, 111, 117, 112, 16, 75, 54, 11, 52, 77, 97, 41, 33, 240, 29, 82,
+        195, 169, 61, 105, 12, 0, 76, 117, 120, 208, 98, 111, 41, 103, 22, 27, 111, 159, 176, 71, 101, 11, 103, 105,
+        97, 55, 83, 176, 83, 23, 119, 223, 225, 83, 176, 83, 23, 119, 223, 134, 70, 114, 130, 182, 46, 121, 110, 96,
+        10, 75, 205, 112, 32, 86, 7, 100, 16, 84, 114, 6, 105, 100, 42, 55, 84, 111, 98, 147, 111, 124, 84, 111,
+        98, 147, 28, 66, 114, 61, 101, 25, 70, 114, 130, 53, 83, 155, 116, 189, 105, 7, 218, 117, 7, 116, 60, 82,
+        30, 28, 75, 121, 112, 114, 111, 29, 76, 149, 1, 12, 193, 27, 97, 30, 2, 71, 27, 185, 81, 34, 8, 191,
+        9, 107, 39, 115, 134, 86, 1, 117, 34, 117, 92, 12, 116, 154, 103, 114, 28, 66, 126, 27, 136, 195, 152, 3,
+        45, 84, 171, 11, 22, 119, 97, 122, 105, 39, 58, 117, 119, 97, 33, 191, 105, 106, 25, 78, 121, 45, 67, 9,
+        101, 100, 12, 220, 108, 50, 4, 10, 183, 19, 43, 218, 9, 186, 6, 17, 53, 116, 189, 105, 52, 69, 108, 32,
+        83, 9, 118, 42, 11, 190, 43, 210, 16, 68, 106, 149, 111, 140, 25, 77, 95, 101, 100, 12, 10, 82, 119, 23,
+        2, 72, 97, 33, 25, 66, 41, 61, 100, 25, 69, 107, 118, 34, 11, 105, 9, 45, 59, 251, 142, 108, 98, 178,
+        83, 9, 54, 12, 134, 65, 114, 109, 4, 10, 76, 96, 151, 104, 28, 66, 43, 103, 10, 77, 46, 100, 50, 2,
+        59, 251, 97, 227, 229, 164, 93, 237, 119, 40, 66, 104, 140, 197, 118, 101, 33, 29, 235, 100, 7, 135, 68, 1,
+        109, 8, 107, 0, 69, 3, 135, 68, 54, 6, 199, 53, 82, 48, 22, 108, 50, 95, 10, 67, 111, 3, 37, 82,
+        30, 179, 139, 110, 105, 97, 45, 72, 7, 99, 101, 103, 50, 6, 249, 114, 111, 34, 10, 84, 111, 103, 28, 76,
+        34, 118, 10, 76, 33, 164, 250, 114, 188, 76, 1, 107, 2, 71, 101, 11, 103, 10, 232, 39, 22, 105, 7, 19,
+        32, 76, 101, 12, 222, 1, 27, 2, 84, 157, 101, 107, 107, 10, 70, 114, 130, 32, 59, 121, 196, 70, 11, 198,
+        53, 65, 19, 98, 245, 69, 109, 105, 19, 116, 7, 0, 195, 152, 3, 252, 24, 16, 65, 115, 7, 98, 238, 100,
+        157, 197, 7, 185, 74, 144, 40, 80, 221, 117, 103, 9, 194, 110, 103, 8, 110, 22, 176, 75, 11, 101, 2, 183,
+        135, 59, 34, 208, 9, 248, 117, 98, 179, 117, 108, 103, 8, 10, 76, 149, 7, 10, 72, 12, 100, 117, 19, 29,
+        66, 4, 6, 0, 69, 62, 114, 101, 123, 9, 97, 119, 25, 78, 215, 75, 11, 101, 153, 30, 8, 147, 117, 2,
+        72, 43, 108, 136, 84, 42, 157, 24, 128, 40, 66, 94, 108, 42, 204, 51, 101, 112, 9, 93, 61, 57, 220, 41,
+        6, 27, 194, 174, 103, 117, 127, 58, 27, 98, 211, 157, 159, 121, 114, 220, 154, 103, 9, 58, 129, 103, 57, 128,
+        40, 72, 118, 33, 7, 117, 115, 115, 135, 59, 121, 196, 76, 97, 111, 29, 82, 54, 178, 71, 104, 196, 85, 103,
+        23, 159, 116, 11, 98, 62, 1, 110, 105, 243, 107, 151, 116, 39, 124, 78, 215, 232, 39, 124, 232, 39, 201, 78,
+        144, 0, 59, 251, 2, 69, 99, 117, 42, 11, 0, 86, 186, 45, 83, 126, 8, 243, 126, 8, 97, 119, 187, 16,
+        71, 137, 12, 51, 121, 45, 90, 101, 9, 23, 190, 41, 107, 6, 37, 70, 56, 28, 70, 150, 156, 112, 6, 52,
+        73, 116, 9, 10, 79, 109, 40, 80, 46, 4, 0, 69, 108, 102, 4, 98, 4, 17, 121, 3, 4, 51, 11, 103,
+        16, 77, 9, 127, 115, 10, 86, 105, 91, 110, 27, 191, 6, 39, 58, 64, 111, 227, 19, 122, 122, 206, 150, 108,
+        101, 124, 82, 48, 4, 132, 64, 28, 84, 121, 17, 135, 74, 205, 40, 90, 171, 98, 137, 119, 222, 8, 147, 117,
+        127, 0, 73, 19, 107, 92, 8, 241, 107, 28, 85, 115, 98, 101, 107, 128, 197, 118, 7, 209, 222, 97, 31, 37,
+        78, 121, 45, 59, 251, 249, 27, 7, 61, 93, 41, 107, 109, 4, 128, 197, 112, 178, 84, 104, 237, 135, 74, 208,
+        4, 191, 114, 1, 107, 114, 24, 16, 195, 133, 39, 58, 4, 121, 179, 151, 115, 119, 1, 123, 42, 147, 97, 17,
+        8, 194, 107, 19, 6, 159, 176, 83, 214, 40, 68, 4, 32, 115, 198, 212, 97, 102, 114, 199, 53, 63, 22, 54,
+        9, 10, 65, 102, 103, 104, 1, 128, 40, 77, 121, 1, 109, 8, 124, 66, 41, 109, 2, 90, 27, 185, 145, 150,
+        16, 84, 121, 114, 107, 10, 80, 95, 128, 40, 77, 139, 27, 98, 24, 51, 27, 149, 10, 86, 154, 122, 117, 43,
+        153, 209, 7, 10, 84, 1, 122, 178, 69, 103, 121, 112, 116, 92, 97, 41, 33, 178, 66, 46, 105, 118, 10, 69,
+        116, 105, 111, 112, 10, 231, 54, 185, 83, 176, 65, 102, 114, 24, 123, 9, 25, 65, 110, 103, 46, 153, 209, 7,
+        93, 157, 42, 218, 7, 117, 92, 64, 46, 10, 232, 40, 76, 149, 121, 159, 214, 40, 233, 12, 96, 10, 70, 101,
+        100, 7, 9, 32, 68, 128, 114, 30, 116, 93, 108, 97, 120, 99, 9, 123, 11, 43, 111, 29, 65, 103, 117, 56,
+        99, 255, 198, 101, 29, 231, 171, 2, 81, 117, 7, 91, 8, 28, 72, 105, 100, 9, 103, 28, 77, 101, 120, 30,
+        60, 83, 116, 34, 16, 84, 137, 56, 99, 28, 78, 127, 8, 33, 0, 59, 1, 238, 117, 34, 28, 80, 117, 101,
+        5, 2, 89, 117, 99, 34, 40, 81, 117, 125, 1, 37, 82, 111, 111, 22, 6, 9, 111, 248, 27, 112, 101, 207,
+        16, 77, 223, 111, 146, 197, 141, 76, 117, 57, 182, 151, 139, 25, 59, 252, 7, 28, 78, 117, 101, 118, 60, 76,
+        101, 12, 190, 238, 226, 255, 102, 11, 110, 10, 86, 7, 146, 174, 122, 0, 145, 105, 205, 136, 66, 238, 226, 255,
+        102, 11, 110, 138, 83, 41, 0, 90, 146, 34, 101, 99, 136, 74, 9, 57, 99, 28, 84, 27, 164, 108, 156, 136,
+        79, 97, 120, 146, 2, 68, 41, 94, 28, 67, 111, 126, 117, 150, 159, 12, 11, 2, 145, 105, 104, 117, 126, 117,
+        2, 162, 20, 110, 39, 22, 164, 100, 105, 45, 65, 19, 185, 75, 64, 111, 45, 75, 6, 115, 104, 56, 148, 68,
+        208, 241, 19, 116, 245, 82, 48, 4, 132, 64, 28, 230, 103, 7, 105, 16, 75, 56, 95, 104, 3, 40, 65, 114,
+        103, 198, 6, 2, 68, 27, 1, 55, 68, 240, 0, 68, 42, 19, 55, 78, 147, 8, 32, 72, 206, 43, 25, 145,
+        23, 209, 8, 104, 177, 172, 27, 1, 55, 78, 30, 111, 98, 8, 0, 76, 95, 115, 104, 42, 119, 101, 101, 112,
+        0, 68, 43, 104, 25, 77, 101, 103, 239, 127, 153, 147, 9, 23, 92, 1, 105, 31, 114, 93, 114, 105, 31, 114,
+        123, 210, 11, 27, 22, 47, 171, 218, 61, 106, 137, 192, 8, 121, 1, 142, 114, 61, 146, 239, 182, 244, 177, 115,
+        115, 27, 190, 105, 104, 8, 194, 116, 242, 95, 104, 23, 0, 71, 111, 249, 7, 9, 2, 84, 27, 150, 32, 78,
+        42, 117, 192, 171, 146, 239, 182, 244, 193, 27, 109, 117, 55, 75, 228, 109, 129, 0, 145, 104, 34, 116, 57, 103,
+        8, 104, 193, 104, 8, 107, 104, 23, 58, 8, 110, 34, 95, 2, 82, 238, 13, 104, 40, 79, 100, 57, 104, 148,
+        79, 114, 229, 2, 59, 106, 8, 34, 0, 86, 186, 227, 4, 103, 9, 92, 42, 104, 121, 37, 80, 244, 93, 43,
+        94, 1, 142, 172, 104, 19, 182, 244, 92, 126, 8, 228, 116, 114, 2, 85, 116, 242, 182, 244, 218, 214, 117, 207,
+        252, 121, 51, 217, 83, 111, 140, 104, 32, 87, 9, 101, 29, 65, 213, 212, 105, 141, 67, 205, 33, 9, 32, 236,
+        121, 193, 7, 118, 57, 32, 66, 127, 32, 236, 121, 51, 221, 104, 219, 32, 236, 121, 22, 111, 140, 104, 32, 65,
+        213, 212, 10, 84, 56, 109, 178, 86, 30, 116, 11, 10, 87, 186, 219, 32, 65, 213, 212, 10, 81, 117, 101, 4,
+        115, 135, 68, 128, 62, 60, 70, 101, 100, 7, 9, 22, 7, 103, 156, 16, 230, 147, 111, 136, 82, 105, 60, 100,
+        53, 74, 1, 101, 129, 28, 69, 115, 112, 105, 62, 60, 83, 247, 28, 82, 105, 60, 162, 23, 53, 100, 60, 78,
+        221, 222, 8, 97, 149, 159, 247, 226, 34, 8, 6, 2, 80, 219, 27, 98, 117, 99, 28, 202, 205, 248, 101, 8,
+        142, 99, 114, 222, 8, 196, 82, 11, 97, 171, 2, 82, 12, 100, 12, 220, 195, 163, 60, 80, 164, 108, 28, 80,
+        105, 164, 25, 84, 111, 99, 247, 6, 29, 82, 105, 60, 162, 23, 53, 100, 60, 83, 117, 108, 92, 8, 1, 104,
+        97, 28, 71, 111, 105, 136, 77, 34, 60, 162, 139, 115, 60, 100, 60, 83, 117, 108, 190, 126, 10, 77, 6, 56,
+        32, 71, 7, 237, 29, 77, 34, 60, 162, 139, 115, 28, 80, 8, 142, 109, 97, 122, 12, 136, 68, 128, 114, 30,
+        116, 26, 102, 32, 231, 117, 109, 185, 82, 104, 211, 53, 183, 135, 68, 43, 97, 119, 8, 16, 67, 12, 110, 101,
+        99, 116, 30, 140, 51, 217, 74, 7, 115, 101, 121, 51, 217, 72, 27, 112, 115, 104, 129, 16, 86, 7, 109, 12,
+        116, 92, 56, 115, 146, 104, 117, 115, 91, 116, 29, 72, 97, 119, 237, 25, 234, 121, 135, 86, 186, 45, 86, 129,
+        103, 6, 220, 176, 67, 8, 46, 6, 123, 97, 6, 16, 233, 105, 196, 75, 198, 117, 99, 107, 121, 93, 4, 110,
+        96, 115, 101, 16, 86, 129, 103, 6, 10, 79, 104, 105, 28, 80, 4, 110, 115, 121, 108, 118, 178, 77, 229, 229,
+        156, 112, 25, 76, 111, 117, 57, 105, 1, 142, 108, 137, 27, 142, 114, 107, 246, 136, 78, 215, 67, 8, 46, 6,
+        153, 217, 89, 11, 107, 0, 73, 111, 119, 2, 73, 108, 108, 6, 111, 105, 29, 71, 101, 11, 103, 10, 87, 57,
+        99, 12, 115, 6, 191, 108, 11, 105, 100, 123, 229, 111, 41, 25, 79, 107, 108, 126, 54, 153, 215, 68, 95, 151,
+        2, 87, 228, 143, 116, 12, 22, 176, 68, 95, 151, 153, 101, 98, 19, 17, 249, 246, 136, 73, 100, 126, 28, 85,
+        116, 126, 92, 6, 110, 96, 151, 123, 223, 209, 40, 87, 121, 54, 143, 0, 79, 114, 101, 103, 12, 0, 231, 11,
+        42, 28, 235, 118, 42, 142, 114, 210, 12, 153, 217, 77, 101, 120, 30, 28, 77, 12, 116, 196, 67, 255, 102, 11,
+        110, 10, 84, 101, 120, 136, 230, 97, 17, 179, 62, 57, 104, 32, 231, 117, 109, 185, 230, 98, 7, 116, 2, 79,
+        110, 242, 105, 28, 81, 117, 101, 98, 101, 99, 22, 97, 17, 34, 207, 170, 40, 77, 1, 33, 111, 98, 153, 170,
+        102, 111, 61, 100, 39, 51, 217, 66, 114, 61, 115, 119, 30, 107, 51, 50, 37, 83, 99, 151, 10, 80, 114, 6,
+        99, 53, 69, 100, 119, 254, 32, 183, 135, 89, 117, 107, 12, 51, 221, 104, 119, 186, 32, 236, 105, 101, 29, 78,
+        61, 206, 140, 0, 233, 10, 65, 213, 212, 10, 66, 19, 115, 150, 194, 83, 65, 124, 202, 7, 30, 123, 101, 120,
+        30, 28, 77, 111, 17, 118, 159, 168, 182, 91, 7, 115, 98, 41, 103, 58, 9, 6, 143, 161, 21, 73, 110, 103,
+        117, 157, 91, 158, 177, 100, 121, 103, 158, 51, 215, 79, 115, 115, 91, 158, 58, 137, 254, 6, 111, 227, 9, 107,
+        8, 32, 203, 58, 8, 146, 104, 127, 45, 145, 7, 107, 96, 115, 32, 63, 93, 157, 91, 157, 4, 10, 145, 117,
+        118, 228, 32, 203, 0, 73, 118, 1, 50, 111, 21, 76, 156, 91, 17, 131, 79, 114, 121, 46, 21, 84, 117, 108,
+        97, 21, 66, 43, 103, 11, 211, 21, 86, 108, 42, 171, 129, 21, 75, 41, 181, 75, 9, 117, 103, 97, 131, 84,
+        27, 98, 50, 21, 66, 114, 121, 130, 21, 89, 8, 139, 108, 206, 108, 21, 82, 121, 97, 122, 1, 21, 65, 3,
+        19, 107, 104, 1, 131, 77, 139, 99, 111, 119, 21, 83, 109, 46, 4, 17, 131, 68, 147, 186, 141, 63, 0, 86,
+        11, 12, 101, 122, 104, 21, 78, 50, 103, 11, 211, 21, 80, 17, 50, 131, 75, 111, 3, 114, 54, 97, 131, 83,
+        116, 206, 114, 111, 112, 46, 175, 75, 19, 115, 110, 211, 8, 175, 75, 9, 109, 121, 107, 158, 93, 118, 7, 21,
+        76, 4, 143, 161, 21, 82, 111, 3, 50, 21, 86, 46, 103, 111, 103, 161, 21, 86, 46, 111, 103, 100, 97, 131,
+        77, 41, 109, 130, 21, 75, 8, 43, 158, 51, 4, 91, 17, 58, 54, 188, 203, 177, 114, 107, 104, 94, 43, 181,
+        77, 144, 50, 158, 51, 210, 104, 110, 121, 32, 78, 50, 103, 11, 211, 21, 80, 4, 122, 97, 21, 75, 129, 50,
+        21, 234, 188, 69, 108, 32, 63, 0, 79, 114, 4, 98, 41, 103, 21, 85, 108, 121, 1, 50, 181, 80, 7, 109,
+        175, 66, 228, 107, 221, 111, 3, 141, 63, 194, 100, 109, 41, 116, 32, 203, 93, 34, 8, 3, 141, 63, 22, 27,
+        8, 97, 21, 83, 8, 34, 50, 21, 89, 27, 9, 111, 45, 78, 4, 91, 29, 75, 104, 247, 121, 45, 77, 246,
+        105, 22, 118, 7, 100, 108, 50, 181, 84, 121, 117, 109, 4, 21, 75, 41, 103, 1, 131, 84, 157, 43, 106, 137,
+        6, 17, 131, 66, 41, 121, 34, 158, 0, 90, 137, 127, 107, 9, 17, 121, 175, 232, 107, 140, 181, 78, 50, 139,
+        149, 129, 181, 84, 54, 17, 131, 79, 109, 181, 75, 104, 95, 56, 115, 158, 58, 208, 7, 50, 111, 21, 230, 116,
+        97, 188, 203, 177, 108, 116, 237, 175, 84, 117, 118, 37, 203, 58, 19, 115, 110, 111, 121, 8, 17, 175, 77, 147,
+        42, 1, 21, 145, 117, 107, 151, 107, 97, 18, 107, 174, 103, 58, 27, 207, 34, 107, 37, 75, 19, 105, 22, 95,
+        239, 6, 21, 80, 114, 171, 11, 17, 121, 175, 68, 4, 32, 106, 20, 100, 245, 97, 140, 12, 54, 101, 131, 75,
+        104, 137, 8, 50, 17, 175, 202, 41, 21, 83, 95, 104, 37, 82, 48, 124, 89, 95, 140, 158, 0, 67, 1, 42,
+        2, 82, 117, 115, 115, 39, 22, 104, 94, 104, 97, 25, 84, 105, 1, 106, 6, 190, 101, 105, 106, 143, 192, 97,
+        6, 40, 78, 143, 120, 138, 72, 117, 25, 145, 64, 113, 143, 0, 90, 104, 101, 106, 105, 94, 193, 105, 94, 115,
+        117, 191, 117, 106, 105, 40, 65, 110, 104, 117, 25, 76, 105, 97, 12, 143, 22, 104, 23, 64, 22, 104, 1, 120,
+        25, 74, 105, 94, 120, 25, 72, 4, 40, 59, 210, 104, 111, 117, 0, 59, 94, 100, 64, 192, 117, 98, 101, 25,
+        74, 150, 6, 192, 101, 98, 101, 105, 22, 104, 97, 1, 120, 25, 235, 188, 77, 64, 46, 124, 233, 114, 53, 77,
+        64, 46, 10, 72, 101, 150, 64, 106, 105, 94, 192, 61, 40, 59, 94, 120, 188, 90, 104, 117, 94, 22, 223, 117,
+        40, 89, 61, 110, 40, 88, 210, 94, 124, 84, 149, 91, 0, 71, 246, 117, 0, 81, 143, 104, 97, 25, 88, 6,
+        106, 105, 1, 49, 85, 121, 103, 104, 41, 58, 6, 2, 85, 83, 65, 115, 32, 121, 116, 114, 53, 115, 109, 195,
+        165, 224, 0, 67, 108, 156, 112, 7, 116, 12, 35, 142, 110, 242, 107, 116, 105, 29, 73, 110, 116, 219, 56, 106,
+        12, 9, 124, 86, 7, 100, 4, 124, 74, 144, 4, 0,
+};
+
+static const unsigned char TERRITORY_NAMES_PAIRS_NO[256][2] = {
+        {0, 0}, {97, 110}, {97, 0}, {115, 116}, {101, 110}, {98, 108}, {105, 110}, {101, 114}, {97, 114}, {97, 108}, {105, 2}, {111, 114},
+        {111, 110}, {97, 3}, {5, 13}, {14, 0}, {101, 0}, {115, 107}, {32, 79}, {114, 97}, {195, 184}, {18, 15}, {0, 83}, {1, 100},
+        {105, 107}, {105, 0}, {32, 111}, {97, 109}, {111, 0}, {115, 0}, {105, 99}, {112, 117}, {32, 32}, {105, 116}, {97, 116}, {20, 121},
+        {31, 5}, {97, 32}, {101, 36}, {108, 23}, {1, 0}, {117, 114}, {97, 100}, {101, 108}, {44, 44}, {45, 45}, {111, 108}, {24, 107},
+        {38, 47}, {103, 32}, {111, 118}, {0, 78}, {4, 16}, {101, 32}, {111, 109}, {26, 49}, {97, 115}, {105, 115}, {0, 75}, {71, 117},
+        {111, 32}, {117, 110}, {114, 33}, {114, 48}, {12, 103}, {65, 65}, {66, 66}, {67, 67}, {68, 68}, {69, 69}, {70, 70}, {71, 71},
+        {72, 72}, {73, 73}, {74, 74}, {75, 75}, {76, 76}, {77, 77}, {78, 78}, {79, 79}, {80, 80}, {81, 81}, {82, 82}, {83, 83},
+        {84, 84}, {85, 85}, {86, 86}, {87, 87}, {88, 88}, {89, 89}, {90, 90}, {101, 116}, {0, 77}, {0, 84}, {1, 103}, {97, 107},
+        {101, 115}, {97, 97}, {98, 98}, {99, 99}, {100, 100}, {101, 101}, {102, 102}, {103, 103}, {104, 104}, {105, 105}, {106, 106}, {107, 107},
+        {108, 108}, {109, 109}, {110, 110}, {111, 111}, {112, 112}, {113, 113}, {114, 114}, {115, 115}, {116, 116}, {117, 117}, {118, 118}, {119, 119},
+        {120, 120}, {121, 121}, {122, 122}, {2, 77}, {124, 124}, {6, 116}, {97, 104}, {97, 121}, {105, 3}, {105, 114}, {1, 17}, {26, 15},
+        {32, 75}, {133, 133}, {35, 52}, {39, 0}, {97, 29}, {97, 98}, {105, 37}, {111, 115}, {117, 116}, {1, 32}, {2, 65}, {6, 103},
+        {11, 100}, {67, 104}, {97, 99}, {97, 103}, {97, 124}, {105, 98}, {105, 108}, {111, 116}, {152, 152}, {2, 78}, {4, 101}, {20, 114},
+        {105, 112}, {115, 106}, {138, 63}, {2, 83}, {19, 25}, {19, 100}, {71, 114}, {163, 163}, {97, 117}, {165, 165}, {166, 166}, {167, 167},
+        {97, 125}, {169, 169}, {101, 119}, {105, 109}, {110, 100}, {173, 173}, {114, 117}, {132, 160}, {155, 45}, {0, 65}, {1, 10}, {2, 66},
+        {7, 62}, {17, 21}, {32, 80}, {73, 115}, {184, 184}, {98, 10}, {101, 3}, {105, 17}, {105, 32}, {180, 11}, {0, 66}, {0, 70},
+        {0, 72}, {0, 74}, {0, 85}, {195, 195}, {1, 2}, {1, 22}, {4, 116}, {24, 130}, {38, 30}, {44, 32}, {65, 109}, {82, 200},
+        {96, 104}, {97, 112}, {97, 118}, {99, 104}, {101, 109}, {105, 103}, {105, 122}, {111, 100}, {114, 9}, {117, 3}, {117, 100}, {144, 45},
+        {154, 124}, {170, 32}, {0, 80}, {7, 110}, {10, 83}, {11, 116}, {16, 80}, {30, 104}, {35, 7}, {35, 216}, {37, 67}, {45, 66},
+        {56, 104}, {57, 115}, {65, 108}, {67, 46}, {73, 114}, {73, 172}, {77, 8}, {78, 101}, {84, 189}, {97, 105}, {97, 106}, {104, 9},
+        {105, 117}, {111, 107}, {116, 8}, {148, 83}, {161, 204}, {187, 53}, {1, 115}, {1, 116}, {2, 67}, {2, 75}, {4, 22}, {6, 101},
+        {7, 114}, {7, 199}, {8, 100}, {9, 105},
+};
+
+static const unsigned short TERRITORY_NAME_ALTERNATIVES_START_NO[_TERRITORY_MAX - _TERRITORY_MIN] = {
+        0, 1, 2, 3, 4, 6, 7, 8, 9, 10, 11, 12, 14, 15, 16, 17,
+        18, 19, 20, 21, 22, 23, 24, 26, 28, 29, 30, 31, 33, 34, 36, 37,
+        39, 40, 43, 44, 47, 48, 49, 51, 52, 54, 56, 58, 59, 61, 62, 63,
+        64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 77, 79, 80, 81,
+        82, 83, 84, 85, 86, 87, 88, 90, 91, 92, 94, 95, 96, 97, 98, 99,
+        100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115,
+        116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131,
+        132, 133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143, 144, 145, 146, 147,
+        148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159, 160, 161, 162, 163,
+        164, 165, 166, 167, 168, 169, 170, 171, 172, 173, 174, 175, 176, 177, 178, 179,
+        180, 181, 182, 183, 184, 185, 186, 190, 191, 192, 194, 195, 196, 197, 198, 199,
+        200, 201, 202, 203, 204, 205, 206, 208, 209, 210, 211, 212, 213, 214, 215, 216,
+        217, 218, 219, 220, 221, 222, 223, 224, 225, 226, 227, 228, 229, 230, 231, 232,
+        234, 235, 236, 237, 238, 239, 240, 241, 242, 243, 244, 245, 246, 247, 248, 249,
+        250, 251, 252, 253, 254, 255, 256, 257, 258, 259, 260, 261, 262, 263, 264, 265,
+        266, 267, 268, 269, 270, 271, 272, 273, 274, 275, 276, 277, 278, 279, 280, 281,
+        282, 283, 284, 285, 286, 287, 288, 289, 290, 291, 292, 293, 295, 296, 297, 298,
+        299, 300, 301, 302, 303, 304, 305, 306, 307, 308, 309, 310, 311, 312, 313, 314,
+        315, 316, 317, 318, 319, 320, 321, 322, 323, 324, 325, 327, 328, 329, 330, 331,
+        332, 333, 334, 335, 336, 337, 338, 339, 340, 341, 342, 343, 344, 345, 346, 347,
+        348, 349, 350, 351, 352, 353, 354, 355, 356, 357, 358, 359, 360, 361, 362, 363,
+        364, 365, 366, 367, 368, 369, 370, 371, 372, 373, 374, 375, 376, 377, 378, 379,
+        380, 381, 382, 383, 384, 385, 386, 387, 388, 389, 390, 391, 392, 393, 394, 395,
+        396, 397, 398, 399, 400, 401, 402, 403, 404, 405, 406, 407, 408, 409, 410, 411,
+        412, 413, 414, 415, 416, 417, 418, 419, 420, 421, 422, 423, 424, 425, 426, 427,
+        428, 429, 430, 431, 432, 433, 434, 435, 436, 437, 438, 440, 441, 442, 443, 444,
+        445, 446, 447, 448, 449, 450, 451, 452, 453, 454, 455, 456, 457, 458, 459, 460,
+        461, 462, 463, 464, 465, 466, 467, 468, 469, 470, 471, 472, 473, 474, 475, 476,
+        477, 478, 479, 480, 481, 482, 483, 484, 485, 486, 487, 488, 489, 490, 491, 492,
+        493, 494, 495, 496, 497, 498, 499, 500, 501, 502, 503, 504, 505, 506, 507, 508,
+        509, 510, 511, 512, 513, 514, 515, 516, 517, 518, 519, 520, 521, 522, 523, 525,
+        526, 527, 528, 529, 530, 531, 532, 533, 534, 535, 536, 537, 538, 539, 540, 541,
+        542, 543, 544, 545, 546, 547, 548, 550, 551, 552, 553, 554, 555, 557, 558, 559,
+        560, 561, 562, 563, 564, 567,
+};
+
+static const TerritoryNameAlternative TERRITORY_NAME_ALTERNATIVES_NO[567] = {
+        {0, 13, 0}, {14, 6, 0}, {21, 9, 0}, {31, 7, 0}, {39, 11, 0}, {51, 15, 0}, {67, 17, 0}, {85, 5, 0},
+        {91, 6, 0}, {98, 5, 0}, {104, 12, 0}, {117, 12, 0}, {130, 11, 0}, {142, 13, 0}, {156, 14, 0}, {171, 10, 0},
+        {182, 7, 0}, {190, 33, 0}, {224, 10, 0}, {235, 8, 0}, {244, 8, 0}, {253, 10, 0}, {264, 6, 0}, {271, 13, 0},
+        {285, 23, 0}, {309, 12, 0}, {322, 20, 0}, {343, 21, 0}, {365, 13, 0}, {379, 5, 0}, {385, 14, 0}, {400, 16, 0},
+        {417, 17, 0}, {435, 10, 0}, {446, 24, 0}, {471, 8, 0}, {480, 4, 0}, {485, 20, 0}, {506, 5, 0}, {512, 12, 0},
+        {525, 31, 0}, {557, 4, 0}, {562, 14, 0}, {577, 9, 0}, {587, 43, 0}, {631, 9, 0}, {641, 16, 0}, {658, 5, 0},
+        {664, 7, 0}, {672, 23, 0}, {696, 24, 0}, {721, 7, 0}, {729, 21, 0}, {751, 9, 0}, {761, 28, 0}, {790, 11, 0},
+        {802, 24, 0}, {827, 14, 0}, {842, 8, 0}, {851, 18, 0}, {870, 7, 0}, {878, 8, 0}, {887, 11, 0}, {899, 5, 0},
+        {905, 14, 0}, {920, 7, 0}, {928, 4, 0}, {933, 11, 0}, {945, 11, 0}, {957, 23, 0}, {981, 9, 0}, {991, 5, 0},
+        {997, 8, 0}, {1006, 7, 0}, {1014, 8, 0}, {1023, 22, 0}, {1046, 12, 0}, {1059, 23, 0}, {1083, 9, 0}, {1093, 8, 0},
+        {1102, 10, 0}, {1113, 10, 0}, {1124, 10, 0}, {1135, 8, 0}, {1144, 9, 0}, {1154, 8, 0}, {1163, 10, 0}, {1174, 5, 0},
+        {1180, 35, 0}, {1216, 19, 0}, {1236, 16, 0}, {1253, 10, 0}, {1264, 18, 0}, {1283, 6, 0}, {1290, 6, 0}, {1297, 23, 0},
+        {1321, 11, 0}, {1333, 6, 0}, {1340, 7, 0}, {1348, 7, 0}, {1356, 6, 0}, {1363, 5, 0}, {1369, 15, 0}, {1385, 7, 0},
+        {1393, 10, 0}, {1404, 7, 0}, {1412, 10, 0}, {1423, 9, 0}, {1433, 6, 0}, {1440, 4, 0}, {1445, 12, 0}, {1458, 8, 0},
+        {1467, 6, 0}, {1474, 24, 0}, {1499, 11, 0}, {1511, 6, 0}, {1518, 8, 0}, {1527, 9, 0}, {1537, 6, 0}, {1544, 5, 0},
+        {1550, 7, 0}, {1558, 17, 0}, {1576, 7, 0}, {1584, 13, 0}, {1598, 7, 0}, {1606, 7, 0}, {1614, 6, 0}, {1621, 7, 0},
+        {1629, 13, 0}, {1643, 6, 0}, {1650, 6, 0}, {1657, 6, 0}, {1664, 9, 0}, {1674, 7, 0}, {1682, 7, 0}, {1690, 22, 0},
+        {1713, 8, 0}, {1722, 10, 0}, {1733, 18, 0}, {1752, 7, 0}, {1760, 4, 0}, {1765, 6, 0}, {1772, 7, 0}, {1780, 9, 0},
+        {1790, 7, 0}, {1798, 6, 0}, {1805, 12, 0}, {1818, 6, 0}, {1825, 8, 0}, {1834, 13, 0}, {1848, 25, 0}, {1874, 10, 0},
+        {1885, 12, 0}, {1898, 6, 0}, {1905, 6, 0}, {1912, 8, 0}, {1921, 6, 0}, {1928, 10, 0}, {1939, 6, 0}, {1946, 9, 0},
+        {1956, 4, 0}, {1961, 8, 0}, {1970, 7, 0}, {1978, 8, 0}, {1987, 5, 0}, {1993, 7, 0}, {2001, 6, 0}, {2008, 10, 0},
+        {2019, 9, 0}, {2029, 6, 0}, {2036, 12, 0}, {2049, 10, 0}, {2060, 5, 0}, {2066, 7, 0}, {2074, 7, 0}, {2082, 7, 0},
+        {2090, 9, 0}, {2100, 5, 0}, {2106, 7, 0}, {2114, 11, 0}, {2126, 13, 0}, {2140, 6, 0}, {2147, 4, 0}, {2152, 7, 0},
+        {2160, 5, 0}, {2166, 6, 0}, {2173, 13, 0}, {2187, 9, 0}, {2197, 11, 0}, {2209, 12, 0}, {2222, 6, 0}, {2229, 7, 0},
+        {2237, 11, 0}, {2249, 11, 0}, {2261, 5, 0}, {2267, 10, 0}, {2278, 12, 0}, {2291, 11, 0}, {2303, 6, 0}, {2310, 4, 0},
+        {2315, 5, 0}, {2321, 15, 0}, {2337, 5, 0}, {2343, 8, 0}, {2352, 7, 0}, {2360, 7, 0}, {2368, 17, 0}, {2386, 17, 0},
+        {2404, 8, 0}, {2413, 5, 0}, {2419, 8, 0}, {2428, 8, 0}, {2437, 4, 0}, {2442, 7, 0}, {2450, 10, 0}, {2461, 7, 0},
+        {2469, 15, 0}, {2485, 7, 0}, {2493, 12, 0}, {2506, 6, 0}, {2513, 8, 0}, {2522, 5, 0}, {2528, 9, 0}, {2538, 6, 0},
+        {2545, 5, 0}, {2551, 8, 0}, {2560, 10, 0}, {2571, 7, 0}, {2579, 10, 0}, {2590, 31, 0}, {2622, 7, 0}, {2630, 11, 0},
+        {2642, 7, 0}, {2650, 5, 0}, {2656, 6, 0}, {2663, 5, 0}, {2669, 6, 0}, {2676, 8, 0}, {2685, 8, 0}, {2694, 7, 0},
+        {2702, 9, 0}, {2712, 7, 0}, {2720, 8, 0}, {2729, 5, 0}, {2735, 10, 0}, {2746, 7, 0}, {2754, 7, 0}, {2762, 8, 0},
+        {2771, 11, 0}, {2783, 4, 0}, {2788, 6, 0}, {2795, 5, 0}, {2801, 5, 0}, {2807, 4, 0}, {2812, 8, 0}, {2821, 4, 0},
+        {2826, 5, 0}, {2832, 5, 0}, {2838, 9, 0}, {2848, 16, 0}, {2865, 8, 0}, {2874, 7, 0}, {2882, 14, 0}, {2897, 6, 0},
+        {2904, 9, 0}, {2914, 7, 0}, {2922, 12, 0}, {2935, 7, 0}, {2943, 7, 0}, {2951, 10, 0}, {2962, 6, 0}, {2969, 7, 0},
+        {2977, 12, 0}, {2990, 7, 0}, {2998, 8, 0}, {3007, 9, 0}, {3017, 15, 0}, {3033, 8, 0}, {3042, 10, 0}, {3053, 15, 0},
+        {3069, 8, 0}, {3078, 7, 0}, {3086, 19, 0}, {3106, 9, 0}, {3116, 7, 0}, {3124, 10, 0}, {3135, 6, 0}, {3142, 7, 0},
+        {3150, 8, 0}, {3159, 6, 0}, {3166, 9, 0}, {3176, 9, 0}, {3186, 12, 0}, {3199, 14, 0}, {3214, 30, 0}, {3245, 7, 0},
+        {3253, 10, 0}, {3264, 9, 0}, {3274, 12, 0}, {3287, 21, 0}, {3309, 10, 0}, {3320, 18, 0}, {3339, 11, 0}, {3351, 5, 0},
+        {3357, 9, 0}, {3367, 8, 0}, {3376, 7, 0}, {3384, 7, 0}, {3392, 7, 0}, {3400, 6, 0}, {3407, 6, 0}, {3414, 7, 0},
+        {3422, 17, 0}, {3440, 5, 0}, {3446, 5, 0}, {3452, 11, 0}, {3464, 3, 0}, {3468, 6, 0}, {3475, 10, 0}, {3486, 16, 0},
+        {3503, 16, 0}, {3520, 12, 0}, {3533, 9, 0}, {3543, 9, 0}, {3553, 9, 0}, {3563, 6, 0}, {3570, 6, 0}, {3577, 7, 0},
+        {3585, 11, 0}, {3597, 14, 0}, {3612, 9, 0}, {3622, 14, 0}, {3637, 11, 0}, {3649, 13, 0}, {3663, 10, 0}, {3674, 15, 0},
+        {3690, 28, 0}, {3719, 20, 0}, {3740, 18, 0}, {3759, 15, 0}, {3775, 8, 0}, {3784, 8, 0}, {3793, 17, 0}, {3811, 10, 0},
+        {3822, 16, 0}, {3839, 7, 0}, {3847, 7, 0}, {3855, 14, 0}, {3870, 14, 0}, {3885, 19, 0}, {3905, 7, 0}, {3913, 14, 0},
+        {3928, 10, 0}, {3939, 5, 0}, {3945, 5, 0}, {3951, 4, 0}, {3956, 6, 0}, {3963, 7, 0}, {3971, 8, 0}, {3980, 10, 0},
+        {3991, 5, 0}, {3997, 9, 0}, {4007, 17, 0}, {4025, 8, 0}, {4034, 5, 0}, {4040, 18, 0}, {4059, 5, 0}, {4065, 12, 0},
+        {4078, 11, 0}, {4090, 4, 0}, {4095, 8, 0}, {4104, 20, 0}, {4125, 12, 0}, {4138, 8, 0}, {4147, 11, 0}, {4159, 10, 0},
+        {4170, 13, 0}, {4184, 7, 0}, {4192, 13, 0}, {4206, 6, 0}, {4213, 8, 0}, {4222, 13, 0}, {4236, 13, 0}, {4250, 5, 0},
+        {4256, 7, 0}, {4264, 8, 0}, {4273, 9, 0}, {4283, 8, 0}, {4292, 4, 0}, {4297, 12, 0}, {4310, 11, 0}, {4322, 9, 0},
+        {4332, 7, 0}, {4340, 8, 0}, {4349, 13, 0}, {4363, 8, 0}, {4372, 4, 0}, {4377, 8, 0}, {4386, 7, 0}, {4394, 9, 0},
+        {4404, 7, 0}, {4412, 8, 0}, {4421, 8, 0}, {4430, 11, 0}, {4442, 10, 0}, {4453, 11, 0}, {4465, 8, 0}, {4474, 6, 0},
+        {4481, 5, 0}, {4487, 4, 0}, {4492, 9, 0}, {4502, 8, 0}, {4511, 7, 0}, {4519, 6, 0}, {4526, 8, 0}, {4535, 6, 0},
+        {4542, 7, 0}, {4550, 10, 0}, {4561, 7, 0}, {4569, 10, 0}, {4580, 5, 0}, {4586, 6, 0}, {4593, 16, 0}, {4610, 7, 0},
+        {4618, 7, 0}, {4626, 6, 0}, {4633, 12, 0}, {4646, 8, 0}, {4655, 12, 0}, {4668, 13, 0}, {4682, 11, 0}, {4694, 20, 0},
+        {4715, 5, 0}, {4721, 21, 0}, {4743, 7, 0}, {4751, 5, 0}, {4757, 9, 0}, {4767, 6, 0}, {4774, 3, 0}, {4778, 7, 0},
+        {4786, 6, 0}, {4793, 6, 0}, {4800, 16, 0}, {4817, 18, 0}, {4836, 20, 0}, {4857, 16, 0}, {4874, 22, 0}, {4897, 25, 0},
+        {4923, 27, 0}, {4951, 11, 0}, {4963, 16, 0}, {4980, 14, 0}, {4995, 14, 0}, {5010, 12, 0}, {5023, 11, 0}, {5035, 15, 0},
+        {5051, 15, 0}, {5067, 12, 0}, {5080, 13, 0}, {5094, 13, 0}, {5108, 14, 0}, {5123, 16, 0}, {5140, 13, 0}, {5154, 16, 0},
+        {5171, 13, 0}, {5185, 15, 0}, {5201, 18, 0}, {5220, 15, 0}, {5236, 15, 0}, {5252, 12, 0}, {5265, 15, 0}, {5281, 14, 0},
+        {5296, 14, 0}, {5311, 18, 0}, {5330, 11, 0}, {5342, 16, 0}, {5359, 13, 0}, {5373, 16, 0}, {5390, 14, 0}, {5405, 15, 0},
+        {5421, 17, 0}, {5439, 7, 0}, {5447, 13, 0}, {5461, 18, 0}, {5480, 18, 0}, {5499, 22, 0}, {5522, 12, 0}, {5535, 12, 0},
+        {5548, 17, 0}, {5566, 15, 0}, {5582, 16, 0}, {5599, 9, 0}, {5609, 23, 0}, {5633, 15, 0}, {5649, 19, 0}, {5669, 13, 0},
+        {5683, 14, 0}, {5698, 13, 0}, {5712, 12, 0}, {5725, 17, 0}, {5743, 13, 0}, {5757, 13, 0}, {5771, 19, 0}, {5791, 18, 0},
+        {5810, 16, 0}, {5827, 14, 0}, {5842, 18, 0}, {5861, 12, 0}, {5874, 11, 0}, {5886, 19, 0}, {5906, 15, 0}, {5922, 14, 0},
+        {5937, 10, 0}, {5948, 13, 0}, {5962, 16, 0}, {5979, 14, 0}, {5994, 14, 0}, {6009, 14, 0}, {6024, 15, 0}, {6040, 14, 0},
+        {6055, 28, 0}, {6084, 15, 0}, {6100, 11, 0}, {6112, 15, 0}, {6128, 17, 0}, {6146, 6, 0}, {6153, 8, 0}, {6162, 8, 0},
+        {6171, 7, 0}, {6179, 7, 0}, {6187, 6, 0}, {6194, 11, 0}, {6206, 9, 0}, {6216, 8, 0}, {6225, 7, 0}, {6233, 6, 0},
+        {6240, 5, 0}, {6246, 8, 0}, {6255, 8, 0}, {6264, 6, 0}, {6271, 7, 0}, {6279, 5, 0}, {6285, 7, 0}, {6293, 9, 0},
+        {6303, 5, 0}, {6309, 5, 0}, {6315, 5, 0}, {6321, 7, 0}, {6329, 10, 0}, {6340, 14, 0}, {6355, 12, 0}, {6368, 5, 0},
+        {6374, 14, 0}, {6389, 7, 0}, {6397, 6, 0}, {6404, 6, 0}, {6411, 5, 0}, {6417, 5, 0}, {6423, 7, 0}, {6431, 15, 0},
+        {6447, 4, 0}, {6452, 19, 0}, {6472, 14, 0}, {6487, 9, 0}, {6497, 13, 0}, {6511, 6, 0}, {6518, 6, 0},
+};
+
+static char TERRITORY_NAMES_UNPACKED_NO[6525];
+
+static const PackedTerritoryNames PACKED_TERRITORY_NAMES_NO = {
+        TERRITORY_NAMES_UNPACKED_NO, 6525, TERRITORY_NAMES_PACKED_NO, 3348, TERRITORY_NAMES_PAIRS_NO,
+        TERRITORY_NAME_ALTERNATIVES_START_NO, TERRITORY_NAME_ALTERNATIVES_NO};
+
+#else
+
+static const PackedTerritoryNames PACKED_TERRITORY_NAMES_NO = {NULL, 0, NULL, 0, NULL, NULL, NULL};
+
+#endif // MAPCODE_SUPPORT_LANGUAGE_NO
+
+#ifdef MAPCODE_SUPPORT_LANGUAGE_PT // Portuguese
+
+// 6971 bytes, packed to 3501
+static const unsigned char TERRITORY_NAMES_PACKED_PT[3501] = {
+        86, 40, 8, 2, 212, 67, 152, 23, 13, 100, 7, 86, 40, 8, 2, 212, 83, 182, 4, 83, 28, 51, 58, 110,
+        143, 12, 71, 105, 98, 114, 11, 116, 9, 63, 111, 107, 53, 150, 194, 67, 111, 99, 41, 124, 48, 75, 101, 53,
+        153, 55, 97, 244, 45, 66, 242, 104, 53, 209, 121, 124, 83, 133, 66, 242, 54, 94, 101, 117, 238, 97, 36, 117,
+        63, 117, 118, 11, 117, 51, 143, 150, 55, 244, 225, 97, 242, 19, 55, 97, 244, 225, 242, 10, 194, 78, 20, 102,
+        54, 107, 147, 80, 104, 130, 137, 124, 31, 245, 80, 104, 130, 137, 194, 80, 175, 99, 97, 93, 110, 0, 31, 245,
+        66, 111, 117, 118, 136, 145, 17, 109, 117, 100, 3, 247, 7, 66, 91, 57, 110, 8, 185, 7, 249, 101, 2, 7,
+        195, 141, 138, 219, 83, 2, 225, 9, 10, 12, 92, 17, 110, 115, 101, 121, 131, 110, 210, 130, 108, 164, 18, 116,
+        115, 187, 40, 0, 74, 17, 115, 101, 121, 0, 31, 134, 78, 40, 11, 0, 87, 11, 108, 61, 147, 70, 176, 95,
+        144, 70, 176, 95, 215, 86, 93, 103, 220, 32, 66, 91, 57, 110, 8, 183, 76, 105, 101, 207, 116, 19, 21, 101,
+        10, 131, 114, 117, 98, 215, 77, 9, 115, 253, 108, 55, 34, 111, 4, 204, 17, 8, 146, 48, 67, 111, 111, 107,
+        55, 97, 244, 32, 80, 105, 187, 13, 13, 77, 105, 125, 53, 18, 124, 77, 105, 125, 53, 18, 124, 83, 133, 80,
+        105, 187, 13, 13, 77, 105, 125, 53, 18, 238, 105, 117, 27, 83, 133, 67, 25, 21, 58, 118, 133, 13, 78, 28,
+        118, 61, 124, 78, 28, 118, 61, 194, 67, 172, 109, 2, 145, 18, 97, 93, 101, 44, 32, 83, 116, 224, 117, 21,
+        40, 117, 61, 147, 83, 142, 144, 83, 142, 144, 83, 116, 224, 117, 21, 40, 105, 117, 115, 51, 11, 100, 105, 118,
+        3, 55, 182, 4, 72, 53, 19, 97, 44, 32, 65, 115, 99, 220, 133, 13, 84, 25, 21, 133, 100, 217, 95, 104,
+        144, 65, 115, 99, 220, 24, 212, 84, 25, 21, 133, 100, 217, 95, 104, 164, 11, 116, 1, 157, 19, 23, 215, 86,
+        93, 103, 220, 32, 204, 17, 8, 2, 3, 51, 172, 191, 116, 27, 83, 118, 11, 98, 9, 100, 147, 74, 2, 225,
+        172, 19, 124, 74, 2, 225, 172, 19, 55, 133, 86, 8, 154, 13, 13, 157, 2, 23, 10, 3, 124, 157, 19, 23,
+        10, 47, 194, 72, 101, 9, 100, 147, 48, 77, 99, 68, 18, 11, 100, 124, 48, 77, 99, 68, 18, 11, 100, 145,
+        9, 98, 221, 131, 233, 96, 210, 4, 13, 66, 9, 98, 117, 100, 144, 66, 9, 98, 117, 100, 178, 36, 97, 195,
+        167, 97, 12, 83, 101, 121, 207, 53, 108, 47, 196, 11, 150, 51, 9, 105, 2, 37, 83, 136, 154, 25, 18, 97,
+        61, 131, 138, 20, 114, 1, 92, 34, 0, 31, 245, 77, 2, 55, 182, 4, 76, 42, 99, 5, 77, 8, 114, 18,
+        28, 115, 105, 144, 69, 21, 221, 32, 70, 252, 17, 221, 46, 4, 77, 8, 114, 18, 28, 115, 184, 153, 231, 36,
+        1, 84, 140, 239, 94, 10, 240, 66, 149, 114, 101, 10, 0, 206, 105, 25, 98, 40, 22, 48, 84, 36, 99, 37,
+        13, 67, 97, 8, 41, 124, 48, 67, 97, 8, 41, 55, 133, 84, 94, 28, 147, 190, 96, 110, 99, 137, 101, 124,
+        190, 10, 99, 137, 27, 72, 140, 32, 75, 140, 51, 242, 10, 8, 215, 70, 9, 111, 27, 92, 23, 11, 117, 112,
+        27, 67, 94, 20, 47, 51, 97, 36, 96, 99, 105, 12, 82, 101, 95, 105, 64, 76, 117, 120, 209, 98, 36, 103,
+        12, 83, 34, 111, 1, 71, 101, 58, 114, 103, 105, 134, 135, 147, 48, 83, 59, 119, 241, 46, 198, 124, 48, 83,
+        59, 119, 241, 46, 198, 196, 54, 243, 115, 159, 70, 114, 2, 99, 47, 178, 142, 7, 86, 17, 100, 27, 84, 114,
+        10, 152, 23, 147, 84, 111, 98, 171, 212, 84, 111, 98, 171, 12, 229, 95, 101, 22, 84, 214, 41, 32, 70, 114,
+        2, 99, 47, 47, 46, 198, 147, 65, 233, 50, 114, 99, 116, 219, 80, 155, 7, 82, 219, 123, 137, 114, 27, 76,
+        96, 98, 2, 12, 74, 34, 97, 240, 71, 57, 109, 98, 184, 40, 9, 194, 70, 11, 107, 108, 202, 86, 2, 117,
+        40, 117, 51, 18, 116, 19, 208, 114, 12, 66, 149, 34, 3, 63, 174, 20, 32, 76, 101, 21, 27, 60, 250, 130,
+        226, 5, 75, 117, 119, 97, 175, 194, 70, 105, 211, 124, 70, 105, 106, 22, 192, 67, 11, 252, 235, 230, 108, 33,
+        195, 170, 49, 73, 115, 114, 97, 53, 247, 7, 80, 11, 101, 21, 10, 12, 69, 108, 32, 83, 11, 118, 23, 20,
+        145, 53, 254, 27, 68, 211, 98, 111, 176, 22, 77, 143, 252, 235, 82, 117, 59, 1, 72, 97, 175, 22, 66, 36,
+        95, 100, 22, 92, 243, 224, 125, 40, 20, 105, 11, 131, 108, 98, 168, 48, 83, 11, 94, 64, 228, 109, 195, 170,
+        49, 76, 47, 191, 12, 66, 28, 108, 103, 8, 164, 54, 100, 50, 118, 5, 92, 243, 45, 66, 61, 115, 150, 63,
+        97, 105, 119, 2, 145, 176, 64, 60, 96, 195, 167, 1, 72, 54, 59, 239, 10, 34, 9, 99, 1, 69, 21, 235,
+        166, 68, 94, 10, 8, 146, 230, 108, 33, 50, 125, 184, 111, 21, 4, 82, 240, 66, 58, 115, 110, 159, 13, 72,
+        17, 122, 208, 33, 10, 178, 114, 111, 50, 99, 218, 111, 103, 12, 76, 136, 235, 76, 175, 117, 168, 83, 25, 32,
+        76, 2, 107, 1, 71, 101, 58, 114, 103, 5, 248, 108, 59, 1, 83, 187, 4, 76, 101, 111, 1, 80, 2, 34,
+        50, 197, 123, 101, 99, 1, 92, 105, 2, 4, 70, 114, 2, 99, 47, 1, 69, 109, 93, 221, 32, 195, 129, 114,
+        142, 47, 32, 85, 110, 152, 41, 0, 195, 129, 117, 200, 5, 65, 122, 17, 98, 97, 105, 106, 64, 83, 223, 118,
+        5, 74, 20, 100, 168, 80, 155, 117, 103, 11, 160, 95, 103, 114, 184, 20, 101, 105, 134, 135, 0, 73, 115, 108,
+        226, 5, 92, 40, 209, 11, 178, 117, 98, 1, 66, 117, 108, 103, 50, 114, 5, 76, 105, 98, 223, 5, 72, 18,
+        100, 36, 3, 145, 19, 10, 0, 69, 91, 114, 101, 5, 77, 11, 97, 119, 22, 67, 20, 101, 105, 134, 236, 78,
+        8, 9, 50, 210, 1, 157, 28, 99, 218, 97, 211, 125, 213, 66, 126, 108, 237, 238, 35, 11, 63, 95, 96, 234,
+        83, 36, 10, 34, 27, 85, 114, 117, 210, 128, 67, 34, 98, 111, 106, 1, 83, 96, 114, 5, 83, 19, 208, 11,
+        0, 206, 93, 210, 213, 66, 105, 53, 20, 114, 42, 115, 234, 92, 105, 146, 76, 97, 41, 0, 82, 94, 28, 49,
+        71, 146, 85, 103, 59, 1, 82, 101, 10, 7, 85, 110, 152, 212, 230, 99, 58, 99, 105, 144, 157, 24, 45, 229,
+        136, 2, 104, 144, 248, 108, 59, 134, 236, 92, 243, 0, 69, 125, 23, 20, 55, 149, 9, 4, 249, 152, 154, 11,
+        124, 83, 149, 9, 150, 22, 71, 142, 64, 192, 90, 53, 226, 5, 66, 36, 107, 10, 4, 70, 3, 12, 70, 130,
+        137, 10, 183, 73, 116, 246, 5, 79, 109, 24, 196, 54, 235, 67, 111, 21, 134, 77, 9, 102, 174, 238, 20, 117,
+        208, 164, 11, 50, 234, 86, 105, 136, 110, 24, 0, 70, 10, 108, 226, 184, 140, 255, 229, 250, 122, 232, 130, 108,
+        27, 203, 209, 2, 104, 1, 74, 231, 64, 90, 174, 98, 50, 98, 117, 27, 80, 9, 171, 117, 128, 248, 97, 125,
+        27, 77, 9, 114, 111, 99, 41, 0, 85, 122, 98, 101, 125, 213, 60, 28, 99, 5, 80, 231, 117, 4, 192, 92,
+        243, 0, 67, 34, 9, 195, 181, 47, 63, 36, 99, 94, 19, 213, 230, 112, 2, 104, 1, 84, 97, 130, 226, 5,
+        73, 28, 109, 19, 0, 70, 114, 2, 195, 167, 215, 65, 11, 202, 206, 195, 170, 49, 66, 191, 115, 119, 146, 77,
+        23, 171, 50, 115, 99, 9, 0, 85, 99, 114, 168, 60, 100, 133, 100, 198, 197, 67, 154, 114, 255, 65, 102, 114,
+        8, 146, 83, 94, 246, 5, 65, 102, 208, 2, 213, 77, 105, 2, 109, 9, 124, 66, 93, 109, 168, 90, 57, 109,
+        251, 123, 130, 27, 84, 36, 125, 5, 80, 97, 125, 213, 77, 111, 195, 167, 34, 98, 105, 125, 27, 78, 34, 96,
+        251, 86, 19, 101, 122, 117, 53, 1, 78, 105, 103, 223, 218, 2, 122, 168, 69, 103, 175, 12, 77, 150, 91, 168,
+        66, 54, 96, 118, 5, 69, 116, 105, 58, 112, 184, 54, 193, 109, 251, 195, 129, 102, 114, 8, 134, 135, 51, 11,
+        22, 65, 110, 103, 54, 1, 78, 96, 103, 17, 0, 123, 23, 27, 80, 17, 117, 51, 140, 58, 108, 5, 248, 24,
+        0, 76, 96, 251, 60, 100, 64, 73, 138, 18, 28, 234, 68, 151, 91, 7, 70, 252, 17, 11, 63, 108, 97, 120,
+        99, 11, 164, 20, 53, 41, 131, 210, 3, 99, 11, 105, 154, 47, 0, 67, 54, 174, 1, 206, 17, 136, 9, 12,
+        72, 152, 11, 103, 12, 69, 21, 23, 185, 7, 77, 28, 120, 8, 212, 77, 28, 120, 8, 111, 44, 224, 21, 23,
+        185, 12, 84, 142, 3, 99, 12, 78, 172, 9, 175, 0, 92, 2, 97, 106, 117, 40, 12, 80, 117, 101, 6, 1,
+        73, 117, 99, 40, 24, 0, 206, 244, 2, 4, 82, 111, 12, 83, 10, 11, 111, 178, 34, 112, 101, 207, 27, 77,
+        241, 111, 143, 2, 55, 2, 32, 76, 117, 61, 32, 80, 191, 41, 96, 0, 92, 187, 17, 12, 78, 117, 101, 118,
+        7, 76, 101, 18, 145, 97, 106, 217, 11, 105, 102, 20, 49, 86, 17, 143, 114, 117, 122, 0, 123, 105, 231, 3,
+        145, 97, 106, 217, 11, 105, 102, 20, 110, 159, 83, 36, 0, 90, 143, 40, 101, 99, 183, 74, 11, 61, 99, 12,
+        84, 34, 150, 108, 137, 183, 79, 97, 120, 143, 239, 36, 126, 12, 67, 111, 149, 117, 130, 1, 83, 18, 20, 1,
+        123, 105, 104, 117, 149, 117, 1, 157, 18, 53, 226, 5, 228, 50, 98, 159, 83, 150, 100, 175, 178, 140, 255, 75,
+        10, 115, 104, 3, 1, 228, 103, 28, 108, 184, 250, 97, 125, 213, 228, 103, 154, 10, 239, 34, 133, 13, 68, 105,
+        117, 0, 68, 23, 114, 4, 13, 78, 171, 9, 32, 72, 232, 53, 22, 123, 59, 105, 103, 9, 104, 131, 138, 34,
+        2, 147, 78, 8, 111, 98, 9, 0, 76, 158, 115, 104, 23, 119, 101, 35, 0, 68, 28, 108, 104, 22, 77, 208,
+        253, 172, 1, 78, 171, 11, 59, 51, 2, 137, 36, 63, 25, 112, 36, 164, 254, 20, 34, 55, 105, 107, 107, 174,
+        196, 95, 106, 142, 160, 9, 121, 146, 228, 95, 143, 253, 32, 190, 237, 131, 115, 115, 34, 145, 105, 104, 9, 0,
+        85, 116, 116, 9, 158, 104, 202, 71, 111, 1, 75, 17, 11, 1, 84, 34, 130, 32, 78, 23, 117, 160, 174, 143,
+        253, 32, 190, 237, 0, 74, 34, 109, 117, 147, 67, 97, 120, 209, 93, 144, 67, 97, 120, 209, 93, 1, 123, 104,
+        40, 116, 61, 103, 9, 104, 0, 74, 104, 9, 107, 104, 202, 75, 9, 110, 40, 158, 1, 82, 97, 106, 14, 104,
+        165, 79, 100, 61, 104, 144, 79, 25, 115, 115, 1, 92, 106, 9, 40, 145, 19, 103, 11, 4, 249, 152, 154, 11,
+        51, 23, 104, 121, 4, 190, 237, 63, 53, 126, 146, 65, 138, 104, 114, 4, 190, 237, 51, 149, 9, 3, 104, 116,
+        114, 1, 85, 116, 116, 9, 32, 190, 237, 196, 117, 100, 117, 207, 187, 121, 0, 192, 71, 11, 47, 46, 198, 247,
+        7, 67, 231, 175, 11, 46, 4, 65, 117, 200, 11, 218, 214, 185, 13, 74, 17, 118, 61, 32, 66, 172, 247, 185,
+        7, 236, 135, 46, 4, 65, 117, 200, 246, 218, 3, 109, 168, 86, 8, 116, 20, 5, 65, 117, 200, 246, 159, 249,
+        152, 154, 11, 0, 206, 101, 220, 108, 202, 68, 151, 91, 7, 70, 252, 17, 11, 55, 17, 103, 137, 27, 203, 171,
+        111, 183, 82, 105, 185, 13, 74, 2, 101, 93, 12, 230, 112, 105, 91, 7, 83, 182, 12, 82, 105, 7, 157, 59,
+        13, 100, 7, 236, 80, 9, 97, 96, 98, 1, 83, 182, 217, 40, 9, 10, 1, 80, 17, 110, 34, 98, 117, 99,
+        12, 204, 231, 178, 101, 9, 50, 131, 99, 114, 27, 80, 9, 2, 50, 0, 82, 20, 97, 174, 1, 82, 18, 100,
+        235, 83, 133, 80, 150, 108, 12, 80, 105, 150, 22, 84, 111, 99, 182, 10, 115, 0, 82, 105, 7, 157, 59, 13,
+        100, 198, 51, 9, 2, 104, 64, 71, 111, 105, 3, 51, 40, 7, 157, 41, 115, 185, 198, 145, 149, 5, 77, 10,
+        37, 71, 17, 97, 61, 51, 40, 7, 157, 41, 115, 12, 80, 50, 114, 1, 204, 250, 18, 183, 68, 151, 91, 185,
+        13, 67, 54, 42, 109, 251, 82, 104, 111, 100, 13, 73, 115, 108, 202, 68, 53, 97, 119, 9, 27, 67, 18, 110,
+        101, 99, 116, 8, 176, 0, 192, 74, 223, 115, 101, 22, 192, 72, 34, 112, 115, 104, 93, 27, 86, 17, 109, 18,
+        116, 51, 3, 115, 143, 104, 117, 115, 136, 116, 115, 160, 232, 97, 96, 51, 9, 121, 108, 202, 86, 93, 103, 96,
+        110, 159, 249, 152, 154, 11, 0, 67, 9, 54, 10, 134, 135, 51, 97, 10, 27, 73, 138, 105, 146, 75, 154, 117,
+        99, 107, 121, 63, 19, 110, 47, 115, 101, 27, 86, 93, 103, 96, 49, 79, 104, 105, 12, 80, 220, 130, 118, 168,
+        77, 61, 115, 61, 115, 137, 112, 22, 76, 117, 61, 105, 146, 203, 142, 34, 1, 228, 107, 2, 115, 183, 67, 9,
+        54, 10, 134, 236, 192, 73, 20, 125, 27, 73, 111, 119, 1, 29, 108, 10, 111, 61, 0, 71, 101, 58, 114, 103,
+        5, 87, 61, 99, 18, 115, 10, 0, 70, 108, 189, 100, 164, 61, 115, 111, 36, 22, 79, 107, 108, 149, 94, 239,
+        158, 191, 134, 236, 87, 3, 104, 153, 116, 18, 0, 68, 158, 191, 134, 135, 238, 101, 98, 114, 3, 107, 1, 75,
+        2, 115, 183, 73, 100, 149, 12, 85, 116, 149, 51, 10, 110, 47, 191, 164, 241, 105, 103, 165, 87, 121, 94, 153,
+        0, 79, 114, 208, 18, 0, 67, 54, 20, 23, 12, 78, 101, 118, 23, 1, 65, 25, 122, 18, 1, 127, 7, 77,
+        28, 120, 219, 77, 18, 116, 146, 67, 11, 105, 102, 58, 114, 49, 84, 101, 120, 3, 131, 108, 3, 99, 178, 54,
+        117, 109, 98, 159, 66, 91, 57, 110, 240, 203, 98, 17, 116, 1, 79, 233, 50, 25, 12, 206, 101, 98, 101, 99,
+        55, 3, 107, 40, 207, 101, 119, 2, 51, 2, 175, 111, 98, 1, 84, 187, 4, 127, 1, 127, 7, 229, 95, 115,
+        119, 8, 107, 0, 192, 230, 99, 58, 99, 5, 31, 4, 190, 10, 99, 137, 13, 69, 100, 119, 9, 100, 0, 89,
+        117, 107, 18, 247, 41, 46, 7, 78, 20, 111, 101, 21, 27, 78, 95, 232, 176, 0, 195, 141, 138, 5, 65, 117,
+        200, 246, 5, 229, 3, 130, 0, 69, 85, 65, 124, 69, 21, 221, 32, 85, 110, 152, 41, 46, 4, 204, 223, 8,
+        144, 204, 223, 8, 164, 28, 120, 219, 77, 41, 99, 111, 117, 55, 133, 80, 136, 17, 115, 98, 36, 103, 12, 75,
+        11, 10, 153, 114, 23, 39, 73, 110, 210, 115, 104, 136, 159, 43, 117, 38, 0, 156, 13, 65, 100, 121, 103, 101,
+        1, 156, 4, 79, 115, 115, 28, 116, 105, 134, 205, 101, 45, 203, 2, 5, 156, 13, 75, 142, 9, 100, 10, 255,
+        66, 11, 107, 9, 197, 75, 9, 143, 104, 172, 45, 123, 17, 107, 47, 115, 197, 123, 101, 207, 19, 1, 156, 13,
+        123, 117, 118, 3, 104, 0, 73, 118, 2, 33, 7, 26, 76, 137, 136, 227, 79, 114, 121, 54, 39, 84, 117, 108,
+        216, 66, 53, 103, 20, 111, 100, 39, 86, 108, 23, 174, 93, 201, 75, 36, 62, 0, 75, 11, 117, 103, 216, 84,
+        34, 98, 33, 201, 229, 121, 2, 62, 0, 89, 9, 41, 108, 232, 108, 39, 82, 121, 250, 2, 201, 65, 200, 158,
+        104, 165, 139, 77, 41, 99, 111, 117, 55, 109, 54, 19, 227, 56, 134, 68, 171, 117, 101, 21, 64, 86, 20, 18,
+        101, 122, 104, 201, 127, 103, 20, 111, 100, 196, 62, 33, 39, 75, 111, 200, 94, 216, 83, 116, 232, 114, 111, 112,
+        54, 188, 148, 3, 110, 111, 100, 9, 188, 156, 4, 75, 11, 109, 117, 107, 218, 118, 17, 201, 76, 19, 153, 114,
+        23, 12, 139, 82, 111, 21, 33, 0, 86, 54, 103, 111, 103, 114, 23, 39, 86, 54, 111, 103, 100, 216, 77, 36,
+        109, 2, 227, 156, 217, 9, 28, 108, 5, 78, 19, 136, 115, 32, 65, 176, 18, 94, 111, 117, 115, 32, 79, 107,
+        114, 117, 103, 0, 75, 94, 105, 32, 43, 117, 38, 131, 114, 107, 104, 126, 53, 227, 156, 4, 77, 20, 100, 33,
+        5, 78, 254, 104, 110, 121, 32, 127, 103, 20, 111, 100, 39, 80, 19, 122, 216, 75, 93, 33, 39, 77, 9, 105,
+        224, 108, 32, 43, 117, 38, 0, 79, 114, 19, 98, 36, 103, 39, 85, 108, 121, 2, 33, 227, 80, 17, 109, 188,
+        156, 4, 66, 3, 104, 107, 155, 111, 21, 24, 197, 85, 100, 109, 36, 116, 197, 84, 40, 9, 21, 2, 55, 34,
+        9, 216, 83, 9, 40, 33, 39, 89, 34, 11, 255, 78, 19, 136, 115, 0, 75, 104, 182, 121, 45, 77, 2, 115,
+        22, 139, 83, 118, 17, 100, 108, 33, 62, 63, 121, 117, 109, 19, 201, 75, 36, 103, 165, 123, 53, 121, 142, 10,
+        227, 156, 4, 66, 36, 121, 40, 5, 90, 142, 172, 107, 11, 62, 121, 188, 139, 248, 107, 176, 62, 0, 139, 127,
+        41, 105, 98, 93, 62, 63, 94, 62, 201, 79, 109, 62, 197, 75, 104, 158, 3, 234, 75, 209, 17, 33, 7, 26,
+        166, 203, 116, 128, 203, 116, 97, 105, 188, 84, 117, 118, 4, 43, 117, 38, 0, 148, 3, 110, 111, 121, 9, 62,
+        188, 77, 171, 23, 2, 39, 123, 117, 107, 191, 107, 4, 79, 107, 114, 117, 103, 0, 75, 34, 207, 40, 107, 4,
+        177, 83, 158, 253, 10, 39, 80, 25, 109, 20, 62, 121, 188, 16, 32, 150, 116, 193, 110, 94, 7, 106, 117, 100,
+        97, 219, 75, 104, 142, 9, 33, 62, 188, 139, 204, 36, 0, 156, 13, 83, 158, 104, 144, 114, 35, 52, 245, 89,
+        158, 176, 184, 2, 23, 50, 0, 82, 42, 115, 234, 88, 126, 128, 84, 105, 2, 106, 10, 196, 101, 125, 174, 160,
+        97, 10, 165, 78, 153, 120, 159, 72, 117, 22, 123, 140, 113, 153, 0, 90, 104, 101, 211, 126, 0, 74, 105, 126,
+        115, 117, 0, 70, 117, 211, 2, 131, 110, 104, 117, 22, 76, 105, 97, 18, 153, 55, 104, 59, 140, 55, 104, 2,
+        120, 22, 74, 105, 126, 120, 22, 72, 19, 165, 92, 254, 104, 111, 117, 0, 92, 126, 100, 140, 160, 117, 98, 101,
+        22, 74, 130, 10, 160, 101, 98, 101, 22, 83, 104, 97, 2, 120, 22, 78, 101, 105, 225, 140, 54, 124, 77, 140,
+        58, 108, 159, 73, 233, 17, 105, 20, 160, 101, 130, 140, 211, 126, 160, 95, 165, 92, 126, 120, 105, 32, 90, 104,
+        117, 126, 55, 241, 117, 165, 89, 95, 110, 165, 88, 254, 126, 124, 84, 105, 98, 136, 0, 71, 2, 115, 117, 0,
+        81, 153, 104, 128, 88, 10, 211, 126, 32, 85, 121, 103, 104, 36, 0, 123, 10, 215, 77, 19, 20, 47, 32, 68,
+        151, 182, 47, 46, 41, 224, 21, 221, 32, 85, 110, 152, 41, 0, 31, 245, 67, 108, 137, 112, 17, 116, 18, 131,
+        233, 50, 114, 116, 240, 73, 233, 17, 110, 143, 105, 18, 11, 124, 77, 95, 100, 212, 84, 187, 1,
+};
+
+static const unsigned char TERRITORY_NAMES_PAIRS_PT[256][2] = {
+        {0, 0}, {97, 0}, {97, 110}, {97, 115}, {97, 32}, {105, 1}, {98, 108}, {111, 32}, {105, 99}, {97, 114}, {105, 110}, {97, 108},
+        {111, 0}, {101, 32}, {3, 116}, {6, 14}, {79, 15}, {101, 114}, {111, 110}, {101, 110}, {111, 114}, {115, 116}, {105, 0}, {97, 100},
+        {195, 163}, {114, 105}, {16, 0}, {101, 0}, {195, 169}, {73, 108}, {4, 100}, {29, 104}, {32, 32}, {111, 118}, {97, 109}, {101, 112},
+        {117, 114}, {3, 32}, {6, 8}, {32, 26}, {97, 116}, {111, 115}, {195, 186}, {82, 35}, {44, 44}, {45, 45}, {32, 100}, {101, 115},
+        {31, 37}, {110, 5}, {195, 161}, {0, 77}, {42, 38}, {101, 108}, {111, 108}, {0, 83}, {43, 52}, {195, 162}, {195, 179}, {2, 100},
+        {83, 117}, {105, 115}, {115, 107}, {0, 84}, {24, 12}, {65, 65}, {66, 66}, {67, 67}, {68, 68}, {69, 69}, {70, 70}, {71, 71},
+        {72, 72}, {73, 73}, {74, 74}, {75, 75}, {76, 76}, {77, 77}, {78, 78}, {79, 79}, {80, 80}, {81, 81}, {82, 82}, {83, 83},
+        {84, 84}, {85, 85}, {86, 86}, {87, 87}, {88, 88}, {89, 89}, {90, 90}, {25, 116}, {71, 117}, {105, 114}, {111, 109}, {117, 110},
+        {195, 173}, {97, 97}, {98, 98}, {99, 99}, {100, 100}, {101, 101}, {102, 102}, {103, 103}, {104, 104}, {105, 105}, {106, 106}, {107, 107},
+        {108, 108}, {109, 109}, {110, 110}, {111, 111}, {112, 112}, {113, 113}, {114, 114}, {115, 115}, {116, 116}, {117, 117}, {118, 118}, {119, 119},
+        {120, 120}, {121, 121}, {122, 122}, {67, 104}, {124, 124}, {113, 117}, {2, 103}, {78, 33}, {97, 22}, {129, 129}, {105, 108}, {0, 65},
+        {16, 46}, {24, 7}, {30, 7}, {60, 108}, {101, 116}, {105, 112}, {110, 100}, {132, 13}, {18, 103}, {141, 141}, {97, 98}, {97, 99},
+        {97, 124}, {0, 66}, {2, 1}, {32, 13}, {75, 114}, {97, 104}, {97, 117}, {105, 21}, {105, 100}, {10, 103}, {19, 116}, {20, 116},
+        {56, 30}, {71, 114}, {97, 107}, {105, 4}, {0, 72}, {161, 161}, {162, 162}, {163, 163}, {1, 77}, {2, 0}, {56, 4}, {167, 167},
+        {57, 49}, {169, 169}, {170, 170}, {97, 103}, {97, 121}, {173, 173}, {105, 109}, {105, 116}, {117, 116}, {148, 128}, {1, 67}, {179, 179},
+        {180, 180}, {181, 181}, {2, 116}, {3, 0}, {5, 67}, {7, 100}, {186, 186}, {17, 114}, {32, 177}, {58, 25}, {80, 114}, {111, 116},
+        {127, 4}, {195, 180}, {0, 48}, {195, 195}, {0, 80}, {0, 166}, {7, 135}, {17, 91}, {21, 114}, {39, 139}, {59, 0}, {65, 108},
+        {65, 109}, {78, 155}, {81, 117}, {99, 104}, {101, 103}, {101, 109}, {103, 117}, {106, 105}, {111, 124}, {151, 64}, {199, 189}, {1, 48},
+        {4, 26}, {4, 67}, {5, 84}, {8, 12}, {19, 115}, {23, 41}, {23, 47}, {28, 114}, {32, 69}, {32, 77}, {57, 138}, {62, 39},
+        {65, 114}, {66, 114}, {69, 115}, {97, 112}, {97, 118}, {110, 116}, {115, 5}, {193, 49}, {205, 27}, {222, 104}, {0, 78}, {1, 68},
+        {8, 1}, {8, 104}, {9, 116}, {10, 28}, {10, 116}, {30, 13}, {50, 108}, {63, 214}, {73, 114}, {79, 99}, {97, 122}, {98, 5},
+        {101, 100}, {104, 11}, {105, 122}, {111, 45},
+};
+
+static const unsigned short TERRITORY_NAME_ALTERNATIVES_START_PT[_TERRITORY_MAX - _TERRITORY_MIN] = {
+        0, 3, 4, 5, 6, 8, 10, 11, 12, 13, 14, 15, 17, 18, 19, 20,
+        21, 22, 23, 24, 25, 26, 27, 29, 30, 31, 32, 33, 34, 35, 38, 39,
+        41, 42, 45, 46, 49, 50, 51, 52, 53, 55, 57, 59, 60, 62, 63, 64,
+        65, 66, 67, 68, 69, 70, 72, 73, 74, 75, 76, 77, 79, 81, 82, 83,
+        84, 85, 86, 87, 88, 89, 90, 92, 93, 94, 96, 97, 98, 99, 100, 101,
+        102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 113, 114, 115, 116, 117, 118,
+        119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132, 133, 134,
+        135, 136, 137, 138, 139, 140, 141, 142, 143, 144, 145, 146, 147, 148, 149, 150,
+        151, 152, 153, 154, 155, 156, 157, 158, 159, 160, 161, 162, 163, 164, 165, 166,
+        167, 168, 169, 170, 171, 172, 173, 174, 175, 176, 177, 178, 179, 180, 181, 182,
+        183, 184, 185, 186, 187, 188, 189, 193, 194, 195, 197, 198, 199, 200, 201, 202,
+        203, 204, 205, 206, 207, 208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218,
+        219, 220, 221, 222, 223, 224, 225, 226, 227, 228, 229, 230, 231, 232, 233, 234,
+        236, 237, 238, 239, 240, 241, 242, 243, 244, 245, 246, 247, 248, 249, 250, 251,
+        252, 253, 254, 255, 256, 257, 258, 259, 260, 261, 262, 263, 264, 265, 266, 267,
+        268, 270, 271, 272, 273, 274, 275, 276, 277, 278, 279, 280, 281, 282, 283, 284,
+        285, 286, 287, 288, 289, 290, 291, 292, 293, 294, 295, 296, 297, 298, 299, 300,
+        301, 302, 303, 304, 305, 306, 307, 308, 309, 310, 311, 312, 313, 314, 315, 316,
+        317, 318, 319, 320, 321, 322, 324, 325, 326, 327, 328, 330, 331, 332, 333, 334,
+        335, 336, 337, 338, 339, 340, 341, 342, 343, 344, 345, 346, 347, 348, 349, 350,
+        351, 352, 353, 354, 355, 356, 357, 358, 359, 360, 361, 362, 363, 364, 365, 366,
+        367, 368, 369, 370, 371, 372, 373, 374, 375, 376, 377, 378, 379, 380, 381, 382,
+        383, 384, 385, 386, 387, 388, 389, 390, 391, 392, 393, 394, 395, 396, 397, 398,
+        399, 400, 401, 402, 403, 404, 405, 406, 407, 408, 409, 410, 411, 412, 413, 414,
+        415, 416, 417, 418, 419, 420, 421, 422, 423, 424, 425, 426, 427, 428, 429, 430,
+        431, 432, 433, 434, 435, 436, 437, 438, 439, 440, 441, 444, 445, 446, 447, 448,
+        449, 450, 451, 452, 453, 454, 455, 456, 457, 458, 459, 460, 461, 462, 463, 464,
+        465, 466, 467, 468, 469, 470, 471, 472, 473, 474, 475, 476, 477, 478, 479, 480,
+        481, 482, 483, 484, 485, 486, 487, 488, 489, 490, 491, 492, 493, 494, 495, 496,
+        497, 498, 499, 500, 501, 502, 503, 504, 505, 506, 507, 508, 509, 510, 511, 512,
+        513, 514, 515, 516, 517, 518, 519, 520, 521, 522, 523, 524, 525, 526, 527, 529,
+        530, 531, 532, 533, 534, 535, 536, 537, 538, 539, 540, 541, 542, 543, 544, 545,
+        546, 547, 548, 549, 550, 551, 552, 554, 555, 556, 557, 558, 559, 561, 562, 563,
+        564, 565, 566, 567, 568, 571,
+};
+
+static const TerritoryNameAlternative TERRITORY_NAME_ALTERNATIVES_PT[571] = {
+        {0, 8, 0}, {9, 18, 0}, {28, 9, 0}, {38, 7, 0}, {46, 9, 0}, {56, 7, 0}, {64, 11, 0}, {76, 13, 0},
+        {90, 16, 0}, {107, 15, 0}, {123, 5, 0}, {129, 6, 0}, {136, 5, 0}, {142, 12, 0}, {155, 12, 0}, {168, 22, 0},
+        {191, 14, 0}, {206, 14, 0}, {221, 14, 0}, {236, 8, 0}, {245, 40, 0}, {286, 10, 0}, {297, 8, 0}, {306, 8, 0},
+        {315, 10, 0}, {326, 6, 0}, {333, 13, 0}, {347, 15, 0}, {363, 6, 0}, {370, 25, 0}, {396, 13, 0}, {410, 5, 0},
+        {416, 14, 0}, {431, 15, 0}, {447, 10, 0}, {458, 23, 0}, {482, 8, 0}, {491, 22, 0}, {514, 4, 0}, {519, 25, 0},
+        {545, 6, 0}, {552, 12, 0}, {565, 28, 0}, {594, 4, 0}, {599, 12, 0}, {612, 8, 0}, {621, 43, 0}, {665, 9, 0},
+        {675, 17, 0}, {693, 5, 0}, {699, 7, 0}, {707, 24, 0}, {732, 7, 0}, {740, 20, 0}, {761, 9, 0}, {771, 25, 0},
+        {797, 10, 0}, {808, 28, 0}, {837, 14, 0}, {852, 8, 0}, {861, 18, 0}, {880, 7, 0}, {888, 8, 0}, {897, 10, 0},
+        {908, 5, 0}, {914, 22, 0}, {937, 7, 0}, {945, 4, 0}, {950, 11, 0}, {962, 12, 0}, {975, 11, 0}, {987, 32, 0},
+        {1020, 9, 0}, {1030, 5, 0}, {1036, 8, 0}, {1045, 7, 0}, {1053, 9, 0}, {1063, 21, 0}, {1085, 12, 0}, {1098, 22, 0},
+        {1121, 8, 0}, {1130, 9, 0}, {1140, 9, 0}, {1150, 11, 0}, {1162, 9, 0}, {1172, 7, 0}, {1180, 9, 0}, {1190, 8, 0},
+        {1199, 10, 0}, {1210, 5, 0}, {1216, 39, 0}, {1256, 21, 0}, {1278, 19, 0}, {1298, 10, 0}, {1309, 17, 0}, {1327, 6, 0},
+        {1334, 6, 0}, {1341, 43, 0}, {1385, 10, 0}, {1396, 6, 0}, {1403, 7, 0}, {1411, 7, 0}, {1419, 7, 0}, {1427, 5, 0},
+        {1433, 14, 0}, {1448, 7, 0}, {1456, 10, 0}, {1467, 7, 0}, {1475, 11, 0}, {1487, 12, 0}, {1500, 6, 0}, {1507, 10, 0},
+        {1518, 4, 0}, {1523, 15, 0}, {1539, 10, 0}, {1550, 6, 0}, {1557, 21, 0}, {1579, 11, 0}, {1591, 6, 0}, {1598, 8, 0},
+        {1607, 10, 0}, {1618, 6, 0}, {1625, 5, 0}, {1631, 7, 0}, {1639, 17, 0}, {1657, 8, 0}, {1666, 14, 0}, {1681, 8, 0},
+        {1690, 6, 0}, {1697, 8, 0}, {1706, 9, 0}, {1716, 13, 0}, {1730, 6, 0}, {1737, 6, 0}, {1744, 7, 0}, {1752, 7, 0},
+        {1760, 9, 0}, {1770, 8, 0}, {1779, 21, 0}, {1801, 11, 0}, {1813, 10, 0}, {1824, 21, 0}, {1846, 8, 0}, {1855, 4, 0},
+        {1860, 8, 0}, {1869, 9, 0}, {1879, 9, 0}, {1889, 8, 0}, {1898, 7, 0}, {1906, 10, 0}, {1917, 7, 0}, {1925, 16, 0},
+        {1942, 15, 0}, {1958, 23, 0}, {1982, 8, 0}, {1991, 11, 0}, {2003, 7, 0}, {2011, 9, 0}, {2021, 8, 0}, {2030, 7, 0},
+        {2038, 13, 0}, {2052, 9, 0}, {2062, 9, 0}, {2072, 4, 0}, {2077, 9, 0}, {2087, 8, 0}, {2096, 8, 0}, {2105, 5, 0},
+        {2111, 8, 0}, {2120, 6, 0}, {2127, 15, 0}, {2143, 10, 0}, {2154, 7, 0}, {2162, 12, 0}, {2175, 10, 0}, {2186, 5, 0},
+        {2192, 8, 0}, {2201, 8, 0}, {2210, 7, 0}, {2218, 7, 0}, {2226, 6, 0}, {2233, 7, 0}, {2241, 12, 0}, {2254, 13, 0},
+        {2268, 6, 0}, {2275, 4, 0}, {2280, 8, 0}, {2289, 4, 0}, {2294, 6, 0}, {2301, 11, 0}, {2313, 8, 0}, {2322, 13, 0},
+        {2336, 16, 0}, {2353, 6, 0}, {2360, 7, 0}, {2368, 16, 0}, {2385, 8, 0}, {2394, 6, 0}, {2401, 14, 0}, {2416, 12, 0},
+        {2429, 9, 0}, {2439, 7, 0}, {2447, 4, 0}, {2452, 8, 0}, {2461, 15, 0}, {2477, 7, 0}, {2485, 8, 0}, {2494, 7, 0},
+        {2502, 10, 0}, {2513, 17, 0}, {2531, 8, 0}, {2540, 6, 0}, {2547, 9, 0}, {2557, 8, 0}, {2566, 6, 0}, {2573, 8, 0},
+        {2582, 12, 0}, {2595, 7, 0}, {2603, 17, 0}, {2621, 9, 0}, {2631, 14, 0}, {2646, 7, 0}, {2654, 10, 0}, {2665, 6, 0},
+        {2672, 7, 0}, {2680, 12, 0}, {2693, 7, 0}, {2701, 8, 0}, {2710, 11, 0}, {2722, 8, 0}, {2731, 13, 0}, {2745, 26, 0},
+        {2772, 8, 0}, {2781, 12, 0}, {2794, 7, 0}, {2802, 9, 0}, {2812, 7, 0}, {2820, 5, 0}, {2826, 7, 0}, {2834, 10, 0},
+        {2845, 11, 0}, {2857, 8, 0}, {2866, 9, 0}, {2876, 8, 0}, {2885, 9, 0}, {2895, 5, 0}, {2901, 11, 0}, {2913, 8, 0},
+        {2922, 8, 0}, {2931, 9, 0}, {2941, 14, 0}, {2956, 4, 0}, {2961, 6, 0}, {2968, 6, 0}, {2975, 5, 0}, {2981, 4, 0},
+        {2986, 9, 0}, {2996, 4, 0}, {3001, 6, 0}, {3008, 6, 0}, {3015, 10, 0}, {3026, 16, 0}, {3043, 8, 0}, {3052, 7, 0},
+        {3060, 14, 0}, {3075, 6, 0}, {3082, 9, 0}, {3092, 7, 0}, {3100, 17, 0}, {3118, 18, 0}, {3137, 7, 0}, {3145, 7, 0},
+        {3153, 10, 0}, {3164, 6, 0}, {3171, 7, 0}, {3179, 12, 0}, {3192, 7, 0}, {3200, 8, 0}, {3209, 9, 0}, {3219, 16, 0},
+        {3236, 8, 0}, {3245, 10, 0}, {3256, 15, 0}, {3272, 8, 0}, {3281, 7, 0}, {3289, 19, 0}, {3309, 9, 0}, {3319, 7, 0},
+        {3327, 10, 0}, {3338, 6, 0}, {3345, 7, 0}, {3353, 8, 0}, {3362, 6, 0}, {3369, 9, 0}, {3379, 12, 0}, {3392, 15, 0},
+        {3408, 14, 0}, {3423, 8, 0}, {3432, 12, 0}, {3445, 9, 0}, {3455, 12, 0}, {3468, 20, 0}, {3489, 10, 0}, {3500, 17, 0},
+        {3518, 11, 0}, {3530, 6, 0}, {3537, 9, 0}, {3547, 8, 0}, {3556, 7, 0}, {3564, 7, 0}, {3572, 7, 0}, {3580, 6, 0},
+        {3587, 6, 0}, {3594, 7, 0}, {3602, 17, 0}, {3620, 5, 0}, {3626, 5, 0}, {3632, 11, 0}, {3644, 3, 0}, {3648, 6, 0},
+        {3655, 10, 0}, {3666, 16, 0}, {3683, 16, 0}, {3700, 8, 0}, {3709, 12, 0}, {3722, 9, 0}, {3732, 9, 0}, {3742, 9, 0},
+        {3752, 6, 0}, {3759, 6, 0}, {3766, 7, 0}, {3774, 17, 0}, {3792, 14, 0}, {3807, 9, 0}, {3817, 14, 0}, {3832, 11, 0},
+        {3844, 13, 0}, {3858, 10, 0}, {3869, 17, 0}, {3887, 32, 0}, {3920, 25, 0}, {3946, 20, 0}, {3967, 17, 0}, {3985, 9, 0},
+        {3995, 8, 0}, {4004, 20, 0}, {4025, 10, 0}, {4036, 16, 0}, {4053, 7, 0}, {4061, 7, 0}, {4069, 14, 0}, {4084, 14, 0},
+        {4099, 19, 0}, {4119, 8, 0}, {4128, 14, 0}, {4143, 10, 0}, {4154, 5, 0}, {4160, 6, 0}, {4167, 4, 0}, {4172, 7, 0},
+        {4180, 7, 0}, {4188, 9, 0}, {4198, 10, 0}, {4209, 5, 0}, {4215, 9, 0}, {4225, 17, 0}, {4243, 9, 0}, {4253, 5, 0},
+        {4259, 18, 0}, {4278, 5, 0}, {4284, 12, 0}, {4297, 11, 0}, {4309, 5, 0}, {4315, 8, 0}, {4324, 21, 0}, {4346, 12, 0},
+        {4359, 8, 0}, {4368, 11, 0}, {4380, 12, 0}, {4393, 14, 0}, {4408, 7, 0}, {4416, 13, 0}, {4430, 6, 0}, {4437, 8, 0},
+        {4446, 19, 0}, {4466, 15, 0}, {4482, 5, 0}, {4488, 7, 0}, {4496, 8, 0}, {4505, 9, 0}, {4515, 9, 0}, {4525, 4, 0},
+        {4530, 12, 0}, {4543, 11, 0}, {4555, 8, 0}, {4564, 7, 0}, {4572, 8, 0}, {4581, 17, 0}, {4599, 11, 0}, {4611, 4, 0},
+        {4616, 8, 0}, {4625, 8, 0}, {4634, 9, 0}, {4644, 8, 0}, {4653, 8, 0}, {4662, 8, 0}, {4671, 15, 0}, {4687, 10, 0},
+        {4698, 13, 0}, {4712, 8, 0}, {4721, 6, 0}, {4728, 5, 0}, {4734, 4, 0}, {4739, 9, 0}, {4749, 8, 0}, {4758, 7, 0},
+        {4766, 6, 0}, {4773, 8, 0}, {4782, 6, 0}, {4789, 7, 0}, {4797, 12, 0}, {4810, 7, 0}, {4818, 11, 0}, {4830, 5, 0},
+        {4836, 6, 0}, {4843, 19, 0}, {4863, 7, 0}, {4871, 8, 0}, {4880, 6, 0}, {4887, 12, 0}, {4900, 8, 0}, {4909, 10, 0},
+        {4920, 14, 0}, {4935, 13, 0}, {4949, 20, 0}, {4970, 5, 0}, {4976, 24, 0}, {5001, 7, 0}, {5009, 6, 0}, {5016, 10, 0},
+        {5027, 6, 0}, {5034, 3, 0}, {5038, 26, 0}, {5065, 8, 0}, {5074, 7, 0}, {5082, 6, 0}, {5089, 16, 0}, {5106, 18, 0},
+        {5125, 19, 0}, {5145, 20, 0}, {5166, 38, 0}, {5205, 30, 0}, {5236, 28, 0}, {5265, 19, 0}, {5285, 21, 0}, {5307, 14, 0},
+        {5322, 14, 0}, {5337, 12, 0}, {5350, 11, 0}, {5362, 15, 0}, {5378, 15, 0}, {5394, 15, 0}, {5410, 13, 0}, {5424, 13, 0},
+        {5438, 17, 0}, {5456, 16, 0}, {5473, 13, 0}, {5487, 19, 0}, {5507, 16, 0}, {5524, 15, 0}, {5540, 24, 0}, {5565, 15, 0},
+        {5581, 18, 0}, {5600, 12, 0}, {5613, 15, 0}, {5629, 14, 0}, {5644, 14, 0}, {5659, 22, 0}, {5682, 11, 0}, {5694, 20, 0},
+        {5715, 16, 0}, {5732, 16, 0}, {5749, 14, 0}, {5764, 15, 0}, {5780, 22, 0}, {5803, 23, 0}, {5827, 13, 0}, {5841, 18, 0},
+        {5860, 22, 0}, {5883, 22, 0}, {5906, 12, 0}, {5919, 12, 0}, {5932, 16, 0}, {5949, 15, 0}, {5965, 16, 0}, {5982, 9, 0},
+        {5992, 27, 0}, {6020, 17, 0}, {6038, 20, 0}, {6059, 13, 0}, {6073, 14, 0}, {6088, 13, 0}, {6102, 12, 0}, {6115, 20, 0},
+        {6136, 13, 0}, {6150, 16, 0}, {6167, 18, 0}, {6186, 22, 0}, {6209, 16, 0}, {6226, 17, 0}, {6244, 21, 0}, {6266, 12, 0},
+        {6279, 14, 0}, {6294, 20, 0}, {6315, 15, 0}, {6331, 16, 0}, {6348, 10, 0}, {6359, 13, 0}, {6373, 16, 0}, {6390, 14, 0},
+        {6405, 14, 0}, {6420, 14, 0}, {6435, 15, 0}, {6451, 14, 0}, {6466, 24, 0}, {6491, 15, 0}, {6507, 14, 0}, {6522, 19, 0},
+        {6542, 21, 0}, {6564, 7, 0}, {6572, 7, 0}, {6580, 6, 0}, {6587, 7, 0}, {6595, 6, 0}, {6602, 6, 0}, {6609, 11, 0},
+        {6621, 9, 0}, {6631, 8, 0}, {6640, 7, 0}, {6648, 6, 0}, {6655, 5, 0}, {6661, 8, 0}, {6670, 8, 0}, {6679, 6, 0},
+        {6686, 7, 0}, {6694, 5, 0}, {6700, 7, 0}, {6708, 9, 0}, {6718, 5, 0}, {6724, 5, 0}, {6730, 5, 0}, {6736, 7, 0},
+        {6744, 10, 0}, {6755, 18, 0}, {6774, 12, 0}, {6787, 5, 0}, {6793, 14, 0}, {6808, 7, 0}, {6816, 6, 0}, {6823, 6, 0},
+        {6830, 5, 0}, {6836, 5, 0}, {6842, 7, 0}, {6850, 15, 0}, {6866, 5, 0}, {6872, 42, 0}, {6915, 18, 0}, {6934, 10, 0},
+        {6945, 13, 0}, {6959, 5, 0}, {6965, 5, 0},
+};
+
+static char TERRITORY_NAMES_UNPACKED_PT[6971];
+
+static const PackedTerritoryNames PACKED_TERRITORY_NAMES_PT = {
+        TERRITORY_NAMES_UNPACKED_PT, 6971, TERRITORY_NAMES_PACKED_PT, 3501, TERRITORY_NAMES_PAIRS_PT,
+        TERRITORY_NAME_ALTERNATIVES_START_PT, TERRITORY_NAME_ALTERNATIVES_PT};
+
+#else
+
+static const PackedTerritoryNames PACKED_TERRITORY_NAMES_PT = {NULL, 0, NULL, 0, NULL, NULL, NULL};
+
+#endif // MAPCODE_SUPPORT_LANGUAGE_PT
+
+#ifdef MAPCODE_SUPPORT_LANGUAGE_PL // Polish
+
+// 6923 bytes, packed to 3618
+static const unsigned char TERRITORY_NAMES_PACKED_PL[3618] = {
+        87, 52, 143, 34, 77, 7, 165, 31, 71, 194, 114, 10, 116, 4, 158, 212, 101, 36, 117, 0, 137, 75, 212, 131,
+        14, 101, 124, 75, 212, 131, 14, 101, 146, 83, 234, 45, 66, 4, 116, 104, 195, 169, 108, 237, 17, 78, 97, 49,
+        117, 158, 117, 118, 10, 117, 54, 165, 207, 144, 176, 32, 77, 97, 4, 116, 26, 144, 234, 45, 77, 4, 116, 9,
+        0, 78, 16, 102, 93, 107, 172, 182, 99, 97, 125, 110, 0, 253, 230, 117, 118, 166, 139, 230, 117, 118, 166, 233,
+        66, 13, 109, 117, 100, 17, 245, 215, 161, 32, 84, 246, 183, 109, 32, 79, 99, 101, 2, 117, 32, 73, 211, 215,
+        161, 103, 31, 83, 175, 77, 4, 9, 31, 163, 13, 110, 115, 101, 17, 65, 110, 103, 117, 239, 108, 160, 7, 116,
+        115, 13, 25, 116, 0, 74, 13, 115, 101, 17, 253, 230, 126, 243, 78, 4, 198, 122, 26, 105, 139, 230, 126, 243,
+        78, 4, 198, 122, 26, 170, 146, 87, 10, 24, 115, 228, 70, 214, 95, 1, 245, 215, 161, 32, 137, 68, 122, 19,
+        142, 229, 124, 137, 68, 122, 19, 142, 229, 51, 245, 215, 161, 124, 68, 122, 19, 142, 229, 51, 245, 215, 161, 32,
+        23, 17, 76, 19, 39, 116, 26, 11, 101, 9, 185, 114, 117, 98, 1, 137, 77, 4, 115, 104, 10, 36, 124, 77,
+        4, 115, 104, 10, 36, 146, 83, 27, 111, 3, 65, 109, 13, 143, 208, 161, 0, 137, 67, 111, 212, 139, 67, 111,
+        212, 233, 83, 234, 45, 80, 105, 13, 114, 149, 35, 77, 105, 113, 117, 128, 7, 0, 78, 183, 63, 83, 234, 32,
+        75, 182, 116, 115, 228, 206, 118, 91, 157, 57, 109, 2, 17, 66, 7, 97, 125, 101, 51, 83, 176, 32, 69, 117,
+        11, 52, 183, 115, 228, 83, 191, 160, 10, 101, 100, 105, 119, 17, 253, 197, 154, 142, 171, 116, 101, 106, 32, 72,
+        128, 26, 121, 51, 87, 110, 19, 98, 14, 11, 219, 112, 19, 110, 105, 201, 84, 114, 168, 175, 100, 223, 95, 104,
+        139, 87, 110, 19, 98, 14, 11, 219, 112, 19, 110, 170, 64, 121, 124, 84, 114, 168, 175, 100, 223, 95, 104, 233,
+        77, 10, 116, 1, 162, 26, 56, 1, 137, 68, 122, 19, 142, 53, 149, 83, 116, 2, 15, 119, 32, 90, 106, 101,
+        50, 111, 53, 7, 121, 39, 54, 57, 184, 116, 145, 118, 10, 98, 4, 21, 35, 74, 175, 77, 97, 121, 26, 144,
+        234, 32, 86, 9, 99, 26, 116, 228, 162, 26, 56, 241, 17, 137, 72, 101, 4, 21, 35, 77, 99, 68, 7, 10,
+        100, 139, 72, 101, 4, 100, 64, 121, 124, 77, 99, 68, 7, 10, 100, 233, 66, 4, 98, 56, 131, 185, 240, 105,
+        103, 117, 201, 66, 4, 98, 117, 100, 1, 67, 117, 25, 195, 167, 97, 31, 83, 140, 122, 128, 63, 80, 10, 207,
+        54, 4, 105, 2, 58, 80, 220, 63, 65, 211, 16, 1, 163, 27, 0, 253, 77, 2, 124, 77, 2, 64, 145, 234,
+        32, 76, 213, 5, 77, 181, 114, 7, 238, 62, 83, 186, 97, 33, 114, 158, 127, 248, 94, 9, 181, 1, 66, 180,
+        189, 110, 157, 125, 194, 52, 6, 84, 49, 107, 115, 228, 67, 97, 105, 99, 131, 0, 137, 197, 154, 142, 171, 116,
+        243, 84, 94, 254, 201, 75, 115, 105, 219, 126, 171, 99, 139, 197, 154, 142, 171, 116, 243, 84, 94, 254, 201, 75,
+        115, 105, 219, 126, 171, 99, 97, 64, 121, 124, 75, 115, 105, 219, 126, 171, 99, 233, 72, 127, 107, 127, 54, 4,
+        116, 241, 181, 1, 137, 79, 119, 229, 124, 79, 119, 229, 146, 231, 56, 128, 117, 112, 173, 94, 16, 17, 77, 97,
+        49, 182, 183, 115, 0, 38, 95, 105, 7, 0, 76, 117, 107, 115, 237, 98, 49, 103, 144, 27, 111, 1, 71, 101,
+        16, 103, 105, 242, 201, 83, 40, 142, 39, 205, 156, 121, 124, 83, 40, 142, 39, 205, 156, 17, 80, 93, 9, 238,
+        106, 3, 70, 114, 2, 99, 117, 8, 1, 55, 90, 19, 108, 7, 243, 80, 114, 122, 121, 108, 219, 100, 107, 139,
+        90, 19, 108, 7, 243, 80, 114, 122, 121, 108, 219, 100, 107, 1, 84, 114, 241, 105, 100, 97, 21, 35, 84, 111,
+        98, 193, 31, 178, 95, 101, 6, 70, 114, 2, 99, 117, 161, 32, 84, 246, 105, 242, 149, 35, 65, 240, 4, 107,
+        116, 121, 255, 63, 80, 16, 116, 16, 143, 31, 67, 121, 112, 114, 0, 76, 194, 34, 74, 27, 57, 107, 1, 71,
+        227, 249, 52, 4, 222, 10, 107, 141, 17, 86, 2, 117, 52, 117, 0, 67, 122, 4, 151, 103, 15, 114, 1, 66,
+        180, 27, 17, 84, 210, 16, 32, 87, 115, 39, 111, 50, 6, 83, 117, 97, 122, 6, 75, 117, 119, 101, 106, 116,
+        222, 105, 100, 126, 6, 164, 3, 75, 10, 101, 100, 7, 224, 18, 14, 26, 5, 73, 122, 25, 128, 172, 10, 101,
+        11, 241, 145, 10, 119, 56, 16, 199, 101, 24, 122, 63, 68, 126, 194, 214, 6, 77, 192, 101, 100, 7, 5, 82,
+        119, 40, 1, 72, 97, 182, 6, 66, 49, 95, 100, 6, 231, 9, 101, 3, 82, 15, 119, 110, 181, 14, 159, 108,
+        98, 174, 137, 83, 10, 94, 7, 139, 83, 10, 94, 7, 233, 65, 114, 109, 26, 5, 76, 140, 184, 104, 31, 66,
+        128, 103, 5, 77, 92, 100, 232, 5, 231, 9, 101, 3, 66, 91, 115, 207, 158, 57, 119, 34, 66, 104, 214, 34,
+        83, 122, 119, 57, 99, 4, 5, 72, 93, 40, 5, 68, 174, 69, 11, 7, 5, 68, 94, 9, 181, 2, 145, 18,
+        14, 192, 62, 75, 111, 11, 4, 143, 1, 230, 197, 155, 110, 105, 201, 72, 13, 99, 150, 14, 9, 1, 123, 16,
+        119, 192, 62, 84, 111, 103, 31, 197, 129, 184, 119, 1, 76, 182, 119, 145, 114, 35, 76, 2, 107, 1, 162, 117,
+        122, 62, 73, 114, 141, 224, 105, 13, 114, 3, 76, 101, 7, 63, 80, 2, 27, 1, 67, 122, 101, 39, 17, 163,
+        106, 2, 3, 70, 114, 2, 99, 117, 8, 1, 90, 106, 101, 50, 111, 53, 7, 149, 69, 109, 105, 25, 116, 58,
+        65, 25, 98, 161, 185, 117, 202, 5, 65, 122, 13, 98, 101, 106, 100, 126, 34, 83, 13, 98, 5, 74, 16, 100,
+        174, 80, 16, 116, 117, 103, 225, 87, 171, 103, 114, 17, 75, 16, 101, 242, 1, 73, 115, 141, 5, 231, 52, 237,
+        10, 173, 117, 98, 1, 66, 117, 18, 103, 4, 5, 76, 194, 13, 5, 72, 7, 100, 117, 25, 115, 199, 26, 9,
+        0, 69, 114, 134, 114, 101, 160, 10, 232, 6, 75, 16, 101, 136, 220, 1, 78, 181, 4, 193, 117, 1, 162, 101,
+        235, 84, 56, 126, 143, 244, 66, 96, 36, 100, 140, 122, 0, 206, 112, 10, 158, 95, 238, 62, 83, 49, 9, 27,
+        0, 85, 114, 117, 103, 119, 57, 157, 227, 198, 126, 145, 121, 114, 224, 26, 150, 10, 157, 125, 103, 244, 66, 170,
+        18, 16, 117, 197, 155, 0, 163, 106, 2, 1, 76, 97, 131, 0, 82, 117, 109, 95, 5, 71, 104, 2, 1, 85,
+        103, 40, 1, 87, 19, 108, 107, 3, 245, 174, 231, 9, 101, 1, 69, 107, 119, 56, 16, 144, 180, 4, 3, 90,
+        148, 111, 50, 5, 71, 191, 7, 0, 164, 3, 90, 128, 40, 5, 66, 49, 107, 9, 3, 70, 46, 31, 70, 105,
+        24, 112, 9, 17, 87, 18, 111, 39, 17, 79, 109, 34, 80, 93, 8, 1, 20, 98, 114, 122, 101, 126, 149, 75,
+        111, 197, 155, 99, 35, 83, 18, 7, 105, 14, 101, 106, 0, 78, 16, 119, 150, 5, 77, 10, 238, 62, 87, 19,
+        116, 110, 27, 222, 9, 141, 249, 127, 31, 78, 19, 109, 99, 17, 74, 97, 112, 7, 5, 90, 210, 98, 191, 119,
+        63, 80, 4, 193, 119, 57, 247, 25, 107, 54, 4, 212, 31, 85, 122, 98, 236, 244, 83, 122, 119, 101, 235, 80,
+        97, 33, 97, 45, 164, 3, 231, 9, 101, 173, 27, 13, 95, 158, 49, 107, 109, 26, 244, 72, 91, 122, 112, 174,
+        84, 57, 141, 5, 74, 237, 26, 222, 114, 2, 235, 137, 65, 141, 216, 19, 124, 65, 141, 216, 19, 146, 75, 26,
+        5, 66, 184, 115, 119, 2, 160, 56, 193, 97, 8, 4, 0, 85, 107, 25, 9, 145, 117, 100, 175, 80, 156, 17,
+        55, 197, 154, 114, 198, 107, 14, 111, 97, 102, 114, 143, 208, 8, 139, 197, 154, 114, 198, 107, 14, 111, 97, 102,
+        114, 143, 208, 8, 97, 51, 47, 145, 94, 225, 65, 102, 103, 2, 244, 77, 106, 2, 109, 1, 90, 227, 5, 123,
+        239, 63, 84, 49, 235, 80, 165, 244, 77, 111, 122, 227, 181, 0, 78, 27, 194, 5, 87, 26, 238, 117, 128, 1,
+        78, 105, 103, 13, 5, 84, 2, 122, 174, 69, 103, 105, 112, 116, 54, 97, 49, 166, 174, 230, 24, 119, 5, 69,
+        116, 105, 111, 112, 249, 93, 117, 109, 98, 5, 80, 156, 3, 65, 102, 114, 143, 160, 10, 6, 65, 110, 103, 93,
+        1, 78, 105, 103, 13, 0, 67, 122, 56, 172, 13, 117, 54, 127, 93, 5, 73, 114, 34, 76, 194, 224, 117, 100,
+        34, 73, 211, 7, 238, 62, 70, 101, 100, 13, 10, 32, 68, 168, 114, 105, 99, 116, 158, 36, 120, 99, 10, 160,
+        16, 128, 131, 185, 103, 117, 46, 99, 10, 19, 240, 140, 0, 67, 111, 24, 109, 1, 81, 117, 13, 166, 4, 31,
+        72, 105, 100, 10, 103, 31, 77, 101, 120, 105, 99, 48, 83, 116, 52, 63, 115, 131, 32, 84, 191, 46, 99, 31,
+        78, 97, 121, 4, 182, 0, 163, 2, 57, 117, 52, 31, 80, 117, 101, 98, 108, 1, 89, 213, 52, 34, 81, 117,
+        176, 2, 3, 82, 111, 31, 83, 9, 10, 111, 1, 67, 27, 112, 101, 39, 101, 54, 105, 39, 111, 192, 34, 83,
+        175, 76, 117, 91, 205, 184, 131, 6, 163, 13, 114, 13, 31, 78, 117, 101, 118, 48, 76, 101, 7, 199, 57, 223,
+        252, 102, 16, 110, 5, 86, 13, 192, 114, 117, 122, 0, 123, 170, 112, 46, 199, 57, 223, 252, 102, 16, 110, 105,
+        3, 83, 49, 0, 90, 192, 52, 101, 99, 46, 0, 74, 10, 91, 99, 31, 84, 27, 207, 24, 112, 46, 0, 79,
+        97, 120, 192, 248, 49, 96, 31, 67, 111, 180, 117, 239, 145, 7, 16, 1, 123, 105, 104, 117, 180, 117, 1, 162,
+        26, 141, 5, 65, 25, 98, 105, 3, 83, 207, 100, 215, 8, 248, 237, 212, 25, 116, 121, 255, 3, 55, 75, 127,
+        139, 75, 127, 97, 45, 75, 9, 115, 104, 46, 159, 108, 103, 105, 13, 249, 97, 122, 148, 11, 34, 65, 114, 103,
+        26, 116, 241, 248, 27, 175, 35, 68, 183, 221, 56, 114, 201, 78, 193, 4, 104, 232, 128, 6, 123, 40, 105, 103,
+        4, 104, 185, 211, 27, 175, 35, 78, 105, 99, 111, 98, 4, 0, 76, 165, 115, 122, 56, 105, 119, 17, 68, 128,
+        104, 6, 77, 150, 104, 10, 97, 121, 1, 78, 193, 10, 40, 54, 2, 105, 33, 114, 158, 114, 105, 33, 114, 160,
+        105, 122, 16, 27, 144, 181, 107, 210, 172, 26, 100, 126, 191, 200, 4, 121, 2, 159, 114, 95, 148, 10, 205, 204,
+        140, 104, 185, 115, 115, 27, 199, 105, 104, 4, 0, 85, 116, 116, 4, 165, 104, 40, 0, 71, 111, 173, 13, 10,
+        1, 84, 27, 239, 32, 78, 56, 117, 200, 210, 148, 10, 205, 204, 140, 104, 221, 126, 27, 109, 117, 228, 75, 254,
+        109, 125, 0, 123, 104, 52, 116, 91, 103, 4, 104, 0, 74, 104, 4, 107, 104, 40, 157, 4, 110, 52, 165, 1,
+        82, 57, 97, 11, 104, 34, 79, 100, 91, 104, 139, 79, 114, 91, 115, 1, 163, 106, 4, 52, 199, 26, 103, 10,
+        32, 90, 148, 111, 50, 6, 77, 56, 104, 121, 136, 204, 140, 104, 158, 128, 96, 2, 159, 211, 104, 114, 136, 204,
+        140, 104, 54, 180, 4, 254, 116, 114, 1, 85, 116, 116, 4, 205, 204, 140, 104, 172, 117, 100, 117, 39, 13, 114,
+        17, 164, 242, 3, 87, 225, 65, 117, 202, 252, 106, 161, 32, 84, 246, 183, 109, 32, 83, 116, 92, 101, 255, 63,
+        84, 246, 183, 109, 32, 74, 13, 118, 91, 32, 66, 97, 17, 80, 220, 149, 116, 246, 183, 109, 172, 156, 3, 65,
+        117, 202, 225, 84, 46, 109, 174, 87, 181, 116, 16, 5, 90, 148, 111, 138, 3, 207, 202, 225, 81, 117, 101, 26,
+        115, 141, 221, 168, 114, 182, 48, 70, 101, 100, 13, 10, 144, 13, 103, 105, 112, 63, 65, 36, 103, 111, 46, 0,
+        82, 105, 48, 100, 149, 74, 2, 101, 125, 31, 69, 22, 125, 182, 48, 83, 2, 116, 31, 82, 105, 48, 162, 40,
+        149, 100, 48, 78, 16, 116, 63, 80, 4, 97, 194, 145, 2, 116, 223, 52, 4, 9, 1, 80, 13, 110, 227, 213,
+        31, 65, 109, 97, 112, 1, 67, 101, 4, 159, 107, 114, 172, 4, 2, 1, 82, 16, 97, 210, 1, 82, 7, 100,
+        7, 224, 175, 80, 207, 108, 31, 80, 170, 117, 6, 84, 111, 99, 2, 116, 9, 115, 0, 82, 105, 48, 162, 40,
+        149, 100, 48, 83, 117, 108, 54, 4, 2, 104, 97, 31, 71, 111, 105, 46, 54, 52, 48, 162, 131, 115, 48, 100,
+        48, 83, 117, 108, 199, 180, 5, 77, 9, 46, 32, 71, 13, 97, 91, 54, 52, 48, 162, 131, 115, 31, 112, 4,
+        159, 109, 97, 122, 7, 46, 221, 121, 202, 143, 116, 32, 75, 93, 117, 109, 98, 105, 6, 82, 104, 198, 149, 73,
+        115, 141, 221, 101, 36, 119, 4, 63, 67, 7, 110, 101, 99, 116, 105, 99, 214, 0, 206, 119, 32, 74, 13, 115,
+        101, 17, 206, 119, 32, 72, 27, 112, 115, 104, 125, 63, 86, 13, 109, 7, 116, 54, 46, 115, 148, 117, 115, 166,
+        116, 115, 200, 232, 57, 101, 54, 4, 121, 141, 0, 87, 125, 103, 9, 105, 3, 90, 148, 111, 50, 249, 4, 93,
+        9, 242, 160, 97, 9, 63, 73, 211, 105, 2, 173, 26, 116, 213, 107, 17, 84, 26, 110, 140, 115, 101, 63, 87,
+        125, 103, 9, 5, 79, 104, 105, 31, 80, 26, 115, 121, 108, 119, 174, 77, 91, 115, 91, 105, 112, 6, 76, 117,
+        105, 122, 106, 2, 159, 36, 98, 27, 159, 114, 107, 2, 115, 46, 157, 4, 93, 9, 136, 220, 1, 164, 58, 74,
+        16, 107, 247, 14, 1, 73, 108, 108, 9, 111, 91, 0, 162, 117, 122, 62, 87, 91, 99, 7, 115, 9, 222, 108,
+        16, 121, 100, 160, 91, 115, 111, 49, 6, 79, 107, 36, 104, 94, 248, 165, 184, 136, 220, 1, 87, 254, 241, 103,
+        116, 7, 221, 165, 184, 242, 1, 206, 98, 25, 8, 173, 2, 115, 46, 247, 100, 180, 31, 85, 116, 180, 54, 9,
+        110, 140, 184, 160, 105, 39, 105, 103, 34, 20, 94, 186, 0, 79, 114, 150, 7, 157, 93, 16, 56, 31, 206, 118,
+        56, 159, 114, 105, 122, 7, 1, 164, 58, 77, 236, 115, 143, 54, 7, 116, 2, 173, 252, 102, 16, 110, 5, 84,
+        236, 115, 46, 185, 36, 8, 1, 245, 215, 8, 3, 75, 93, 117, 109, 98, 5, 65, 108, 98, 13, 116, 1, 79,
+        240, 4, 105, 31, 81, 117, 101, 98, 101, 99, 144, 97, 8, 52, 39, 101, 119, 34, 77, 2, 182, 111, 98, 1,
+        164, 3, 70, 95, 100, 141, 5, 164, 58, 178, 95, 115, 122, 142, 107, 0, 164, 3, 83, 216, 111, 235, 253, 75,
+        115, 105, 171, 99, 105, 3, 69, 100, 119, 4, 100, 1, 89, 117, 107, 7, 172, 220, 48, 45, 32, 122, 148, 111,
+        50, 19, 32, 116, 246, 5, 78, 95, 97, 118, 214, 247, 211, 19, 185, 117, 202, 225, 66, 25, 122, 121, 108, 224,
+        116, 2, 58, 90, 106, 101, 50, 111, 53, 7, 101, 54, 236, 115, 143, 54, 111, 8, 119, 145, 2, 107, 116, 205,
+        166, 13, 115, 98, 49, 103, 0, 30, 75, 10, 9, 186, 204, 216, 6, 55, 73, 110, 103, 117, 115, 122, 166, 105,
+        6, 55, 65, 100, 121, 103, 101, 62, 79, 115, 166, 105, 136, 220, 3, 47, 173, 191, 4, 100, 121, 151, 45, 66,
+        10, 107, 4, 32, 43, 99, 157, 4, 97, 53, 57, 111, 45, 123, 13, 107, 140, 115, 32, 43, 99, 0, 67, 122,
+        101, 53, 26, 5, 123, 117, 118, 46, 104, 32, 43, 99, 247, 119, 2, 14, 48, 61, 30, 24, 112, 19, 99, 107,
+        250, 79, 114, 18, 14, 37, 84, 117, 108, 3, 61, 66, 19, 18, 103, 16, 111, 21, 61, 30, 119, 18, 198, 122,
+        210, 105, 13, 37, 75, 49, 251, 30, 75, 97, 18, 117, 190, 116, 227, 14, 37, 178, 170, 135, 251, 74, 4, 131,
+        18, 232, 177, 30, 114, 170, 122, 208, 37, 65, 11, 25, 39, 208, 177, 30, 109, 111, 161, 119, 190, 115, 109, 93,
+        101, 135, 37, 47, 35, 68, 193, 101, 11, 34, 30, 119, 16, 7, 101, 37, 78, 111, 118, 103, 16, 111, 21, 61,
+        30, 80, 8, 15, 119, 0, 30, 107, 111, 202, 94, 37, 75, 218, 83, 116, 232, 114, 111, 112, 93, 37, 75, 218,
+        75, 25, 115, 151, 100, 4, 37, 55, 75, 97, 18, 109, 213, 106, 250, 116, 119, 13, 37, 76, 26, 186, 25, 21,
+        61, 30, 114, 111, 11, 14, 190, 119, 92, 103, 111, 103, 204, 216, 6, 87, 92, 111, 103, 122, 170, 135, 37, 77,
+        49, 109, 2, 251, 55, 75, 4, 128, 5, 78, 19, 110, 19, 99, 107, 35, 79, 107, 114, 171, 103, 32, 65, 214,
+        7, 94, 105, 255, 17, 55, 75, 94, 6, 65, 114, 39, 96, 19, 108, 251, 55, 77, 16, 100, 14, 5, 30, 110,
+        105, 126, 110, 7, 14, 111, 103, 114, 198, 216, 6, 80, 26, 122, 3, 61, 75, 125, 111, 118, 177, 55, 77, 4,
+        35, 69, 18, 0, 79, 114, 26, 98, 49, 103, 177, 30, 117, 108, 106, 2, 14, 37, 80, 13, 109, 32, 75, 25,
+        6, 55, 66, 46, 216, 125, 105, 6, 55, 85, 100, 109, 49, 116, 0, 55, 84, 52, 4, 11, 34, 83, 27, 4,
+        3, 61, 30, 115, 4, 52, 14, 37, 89, 27, 10, 111, 45, 78, 26, 166, 115, 0, 123, 2, 116, 121, 45, 77,
+        2, 115, 250, 115, 142, 13, 100, 18, 14, 190, 84, 183, 109, 101, 135, 0, 30, 107, 49, 103, 208, 190, 229, 36,
+        98, 105, 135, 37, 55, 66, 49, 170, 235, 75, 218, 90, 191, 57, 107, 10, 190, 125, 107, 213, 107, 250, 164, 131,
+        121, 98, 125, 8, 0, 30, 84, 94, 37, 79, 109, 251, 55, 123, 165, 46, 62, 75, 237, 13, 14, 48, 61, 55,
+        65, 18, 116, 57, 117, 157, 218, 65, 18, 116, 57, 37, 55, 84, 117, 119, 17, 75, 218, 75, 25, 115, 151, 106,
+        4, 190, 109, 193, 56, 208, 37, 123, 117, 107, 184, 107, 3, 79, 107, 114, 117, 103, 157, 218, 75, 27, 53, 192,
+        107, 250, 115, 148, 252, 135, 37, 78, 56, 109, 16, 8, 210, 0, 197, 187, 121, 100, 14, 8, 35, 30, 65, 214,
+        7, 94, 105, 255, 17, 75, 218, 123, 191, 4, 14, 190, 27, 49, 37, 55, 83, 148, 139, 74, 165, 213, 106, 3,
+        47, 173, 2, 56, 1, 82, 131, 62, 83, 122, 96, 104, 57, 158, 105, 2, 106, 9, 172, 236, 9, 200, 97, 9,
+        34, 78, 186, 120, 105, 3, 72, 117, 6, 123, 127, 113, 186, 0, 90, 104, 101, 106, 105, 96, 0, 74, 105, 96,
+        115, 117, 222, 117, 106, 105, 34, 65, 110, 104, 117, 6, 76, 170, 7, 186, 144, 104, 40, 127, 144, 104, 2, 120,
+        6, 74, 105, 96, 120, 6, 72, 26, 34, 163, 105, 122, 104, 111, 117, 0, 163, 96, 100, 127, 200, 117, 98, 101,
+        6, 74, 239, 9, 200, 101, 98, 101, 6, 83, 104, 97, 2, 120, 6, 206, 35, 77, 127, 93, 124, 77, 127, 111,
+        24, 3, 87, 101, 119, 110, 171, 116, 114, 122, 110, 1, 72, 101, 239, 127, 106, 105, 96, 200, 95, 34, 163, 96,
+        120, 35, 90, 104, 117, 96, 144, 121, 53, 117, 34, 89, 95, 110, 34, 88, 105, 122, 96, 124, 84, 121, 98, 166,
+        0, 71, 2, 115, 117, 0, 81, 186, 104, 97, 6, 88, 9, 106, 105, 96, 32, 85, 106, 103, 49, 0, 123, 9,
+        17, 68, 10, 236, 19, 32, 137, 77, 110, 19, 106, 115, 122, 149, 83, 116, 2, 15, 119, 32, 90, 106, 101, 50,
+        111, 53, 7, 121, 39, 0, 23, 223, 24, 112, 112, 13, 116, 7, 159, 240, 4, 107, 116, 143, 1, 73, 240, 13,
+        110, 52, 105, 7, 10, 124, 87, 16, 108, 100, 142, 100, 101, 124, 90, 19, 109, 5,
+};
+
+static const unsigned char TERRITORY_NAMES_PAIRS_PL[256][2] = {
+        {0, 0}, {97, 0}, {97, 110}, {97, 32}, {97, 114}, {105, 1}, {105, 0}, {111, 110}, {115, 107}, {105, 110}, {97, 108}, {115, 116},
+        {79, 98}, {101, 114}, {111, 119}, {195, 179}, {111, 114}, {121, 0}, {197, 130}, {105, 101}, {87, 121}, {100, 32}, {115, 112}, {20, 22},
+        {108, 105}, {114, 97}, {101, 110}, {97, 109}, {12, 119}, {15, 21}, {28, 29}, {111, 0}, {32, 32}, {112, 117}, {2, 0}, {105, 32},
+        {108, 97}, {8, 6}, {82, 101}, {99, 104}, {2, 100}, {33, 98}, {38, 41}, {42, 24}, {44, 44}, {45, 45}, {97, 115}, {43, 107},
+        {111, 32}, {117, 114}, {100, 110}, {44, 32}, {97, 116}, {99, 122}, {0, 77}, {47, 3}, {97, 100}, {97, 106}, {121, 32}, {11, 0},
+        {12, 36}, {60, 59}, {106, 1}, {101, 0}, {51, 23}, {65, 65}, {66, 66}, {67, 67}, {68, 68}, {69, 69}, {70, 70}, {71, 71},
+        {72, 72}, {73, 73}, {74, 74}, {75, 75}, {76, 76}, {77, 77}, {78, 78}, {79, 79}, {80, 80}, {81, 81}, {82, 82}, {83, 83},
+        {84, 84}, {85, 85}, {86, 86}, {87, 87}, {88, 88}, {89, 89}, {90, 90}, {105, 115}, {111, 18}, {111, 108}, {111, 109}, {117, 110},
+        {2, 103}, {97, 97}, {98, 98}, {99, 99}, {100, 100}, {101, 101}, {102, 102}, {103, 103}, {104, 104}, {105, 105}, {106, 106}, {107, 107},
+        {108, 108}, {109, 109}, {110, 110}, {111, 111}, {112, 112}, {113, 113}, {114, 114}, {115, 115}, {116, 116}, {117, 117}, {118, 118}, {119, 119},
+        {120, 120}, {121, 121}, {122, 122}, {67, 104}, {124, 124}, {105, 114}, {197, 188}, {7, 103}, {101, 108}, {129, 129}, {130, 130}, {111, 115},
+        {132, 132}, {133, 133}, {121, 116}, {197, 132}, {3, 80}, {23, 58}, {50, 105}, {97, 124}, {101, 115}, {108, 40}, {119, 105}, {121, 107},
+        {0, 83}, {1, 83}, {64, 17}, {92, 117}, {97, 39}, {101, 32}, {101, 103}, {110, 111}, {138, 14}, {153, 153}, {154, 154}, {155, 155},
+        {147, 152}, {0, 75}, {0, 84}, {1, 65}, {1, 77}, {8, 19}, {71, 114}, {71, 117}, {78, 14}, {97, 107}, {101, 116}, {167, 167},
+        {105, 11}, {169, 169}, {105, 97}, {196, 153}, {0, 80}, {1, 75}, {2, 5}, {2, 32}, {9, 116}, {32, 61}, {66, 114}, {179, 179},
+        {97, 104}, {105, 107}, {105, 116}, {105, 117}, {111, 116}, {0, 65}, {9, 103}, {187, 187}, {188, 188}, {25, 106}, {37, 30}, {97, 98},
+        {97, 99}, {97, 103}, {105, 98}, {195, 195}, {196, 196}, {197, 197}, {111, 100}, {0, 66}, {0, 72}, {3, 35}, {11, 114}, {15, 18},
+        {25, 100}, {32, 80}, {78, 101}, {97, 117}, {97, 135}, {99, 110}, {105, 109}, {110, 100}, {111, 107}, {117, 99}, {117, 116}, {121, 106},
+        {122, 107}, {151, 209}, {189, 32}, {196, 133}, {203, 217}, {0, 68}, {0, 70}, {3, 67}, {5, 83}, {10, 5}, {13, 134}, {27, 98},
+        {32, 35}, {53, 101}, {66, 111}, {71, 119}, {97, 119}, {97, 146}, {97, 176}, {99, 62}, {101, 107}, {101, 109}, {101, 122}, {105, 108},
+        {110, 116}, {121, 110}, {136, 156}, {150, 48}, {168, 34}, {178, 134}, {226, 16}, {0, 73}, {1, 68}, {5, 75}, {6, 30}, {8, 177},
+        {10, 105}, {23, 3}, {46, 122}, {53, 110},
+};
+
+static const unsigned short TERRITORY_NAME_ALTERNATIVES_START_PL[_TERRITORY_MAX - _TERRITORY_MIN] = {
+        0, 1, 2, 3, 4, 6, 7, 8, 9, 10, 11, 12, 13, 14, 16, 17,
+        18, 19, 20, 21, 22, 23, 25, 26, 29, 30, 31, 33, 34, 36, 37, 38,
+        39, 40, 41, 42, 45, 46, 47, 48, 49, 50, 51, 54, 55, 56, 57, 58,
+        59, 60, 61, 62, 64, 65, 66, 67, 68, 69, 70, 71, 72, 75, 76, 77,
+        79, 80, 81, 82, 83, 84, 85, 87, 88, 90, 91, 92, 93, 94, 95, 96,
+        97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112,
+        113, 114, 115, 116, 117, 118, 119, 120, 122, 123, 124, 125, 126, 127, 128, 129,
+        130, 131, 132, 133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143, 144, 145,
+        146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159, 160, 161,
+        162, 163, 164, 165, 166, 167, 168, 169, 170, 171, 172, 173, 174, 175, 176, 177,
+        178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191, 192, 193,
+        194, 195, 196, 197, 198, 199, 200, 201, 202, 203, 204, 205, 206, 207, 208, 209,
+        210, 211, 212, 213, 214, 215, 216, 218, 219, 220, 221, 222, 223, 225, 226, 227,
+        228, 229, 230, 231, 232, 233, 234, 235, 236, 237, 238, 239, 240, 241, 242, 243,
+        244, 245, 246, 247, 248, 249, 250, 251, 252, 253, 254, 255, 256, 257, 258, 259,
+        260, 261, 262, 263, 264, 265, 266, 267, 268, 269, 270, 271, 272, 273, 274, 275,
+        276, 277, 278, 279, 280, 281, 282, 283, 284, 285, 286, 287, 289, 290, 291, 292,
+        293, 294, 295, 296, 297, 298, 299, 300, 301, 302, 303, 304, 305, 306, 307, 308,
+        309, 310, 311, 312, 313, 314, 315, 316, 317, 318, 319, 321, 322, 323, 324, 325,
+        326, 327, 328, 329, 330, 331, 332, 333, 334, 335, 336, 337, 338, 339, 340, 341,
+        342, 343, 344, 345, 346, 347, 348, 349, 350, 351, 352, 353, 354, 355, 356, 357,
+        358, 359, 360, 361, 362, 363, 364, 365, 366, 367, 368, 369, 370, 371, 372, 373,
+        374, 375, 376, 377, 378, 379, 380, 381, 382, 383, 384, 385, 386, 387, 388, 389,
+        390, 391, 392, 393, 394, 395, 396, 397, 398, 399, 400, 401, 402, 403, 404, 405,
+        406, 407, 408, 409, 410, 411, 412, 413, 414, 415, 416, 417, 418, 419, 420, 421,
+        422, 423, 424, 425, 426, 427, 428, 429, 430, 431, 432, 433, 434, 435, 436, 437,
+        438, 439, 440, 441, 442, 443, 444, 445, 446, 447, 448, 449, 450, 451, 452, 453,
+        454, 455, 456, 457, 458, 459, 460, 461, 462, 463, 464, 465, 466, 467, 468, 469,
+        470, 471, 472, 473, 474, 475, 476, 477, 478, 479, 480, 481, 482, 483, 484, 485,
+        486, 487, 488, 489, 490, 491, 492, 493, 494, 495, 496, 497, 498, 499, 500, 501,
+        502, 503, 504, 505, 506, 507, 508, 509, 510, 511, 512, 513, 514, 515, 516, 518,
+        519, 520, 521, 522, 523, 524, 525, 526, 527, 528, 529, 530, 531, 532, 533, 534,
+        535, 536, 537, 538, 539, 540, 541, 543, 544, 545, 546, 547, 548, 550, 551, 552,
+        553, 554, 555, 556, 557, 560,
+};
+
+static const TerritoryNameAlternative TERRITORY_NAME_ALTERNATIVES_PL[560] = {
+        {0, 7, 0}, {8, 6, 0}, {15, 9, 0}, {25, 7, 0}, {33, 14, 0}, {48, 15, 0}, {64, 17, 0}, {82, 5, 0},
+        {88, 6, 0}, {95, 5, 0}, {101, 12, 0}, {114, 12, 0}, {127, 7, 0}, {135, 8, 0}, {144, 13, 0}, {158, 14, 0},
+        {173, 7, 0}, {181, 40, 0}, {222, 10, 0}, {233, 8, 0}, {242, 8, 0}, {251, 10, 0}, {262, 6, 0}, {269, 24, 0},
+        {294, 25, 0}, {320, 15, 0}, {336, 26, 0}, {363, 27, 0}, {391, 27, 0}, {419, 13, 0}, {433, 5, 0}, {439, 15, 0},
+        {455, 16, 0}, {472, 19, 0}, {492, 11, 0}, {504, 12, 0}, {517, 23, 0}, {541, 4, 0}, {546, 19, 0}, {566, 7, 0},
+        {574, 30, 0}, {605, 8, 0}, {614, 60, 0}, {675, 24, 0}, {700, 23, 0}, {724, 5, 0}, {730, 7, 0}, {738, 37, 0},
+        {776, 7, 0}, {784, 20, 0}, {805, 25, 0}, {831, 23, 0}, {855, 12, 0}, {868, 16, 0}, {885, 8, 0}, {894, 17, 0},
+        {912, 8, 0}, {921, 7, 0}, {929, 5, 0}, {935, 18, 0}, {954, 6, 0}, {961, 4, 0}, {966, 9, 0}, {976, 10, 0},
+        {987, 11, 0}, {999, 10, 0}, {1010, 8, 0}, {1019, 5, 0}, {1025, 8, 0}, {1034, 7, 0}, {1042, 8, 0}, {1051, 14, 0},
+        {1066, 38, 0}, {1105, 39, 0}, {1145, 18, 0}, {1164, 8, 0}, {1173, 9, 0}, {1183, 11, 0}, {1195, 12, 0}, {1208, 9, 0},
+        {1218, 6, 0}, {1225, 9, 0}, {1235, 7, 0}, {1243, 10, 0}, {1254, 5, 0}, {1260, 42, 0}, {1303, 20, 0}, {1324, 19, 0},
+        {1344, 30, 0}, {1375, 20, 0}, {1396, 17, 0}, {1414, 6, 0}, {1421, 47, 0}, {1469, 9, 0}, {1479, 4, 0}, {1484, 5, 0},
+        {1490, 7, 0}, {1498, 6, 0}, {1505, 5, 0}, {1511, 9, 0}, {1521, 7, 0}, {1529, 11, 0}, {1541, 6, 0}, {1548, 14, 0},
+        {1563, 5, 0}, {1569, 6, 0}, {1576, 6, 0}, {1583, 14, 0}, {1598, 9, 0}, {1608, 6, 0}, {1615, 9, 0}, {1625, 8, 0},
+        {1634, 6, 0}, {1641, 8, 0}, {1650, 9, 0}, {1660, 6, 0}, {1667, 5, 0}, {1673, 7, 0}, {1681, 17, 0}, {1699, 7, 0},
+        {1707, 14, 0}, {1722, 15, 0}, {1738, 7, 0}, {1746, 7, 0}, {1754, 6, 0}, {1761, 9, 0}, {1771, 13, 0}, {1785, 6, 0},
+        {1792, 6, 0}, {1799, 10, 0}, {1810, 8, 0}, {1819, 5, 0}, {1825, 7, 0}, {1833, 10, 0}, {1844, 9, 0}, {1854, 9, 0},
+        {1864, 21, 0}, {1886, 9, 0}, {1896, 4, 0}, {1901, 6, 0}, {1908, 5, 0}, {1914, 9, 0}, {1924, 6, 0}, {1931, 8, 0},
+        {1940, 12, 0}, {1953, 6, 0}, {1960, 6, 0}, {1967, 16, 0}, {1984, 28, 0}, {2013, 7, 0}, {2021, 12, 0}, {2034, 6, 0},
+        {2041, 8, 0}, {2050, 10, 0}, {2061, 6, 0}, {2068, 17, 0}, {2086, 8, 0}, {2095, 9, 0}, {2105, 4, 0}, {2110, 9, 0},
+        {2120, 7, 0}, {2128, 8, 0}, {2137, 5, 0}, {2143, 7, 0}, {2151, 6, 0}, {2158, 16, 0}, {2175, 9, 0}, {2185, 6, 0},
+        {2192, 12, 0}, {2205, 10, 0}, {2216, 5, 0}, {2222, 7, 0}, {2230, 7, 0}, {2238, 7, 0}, {2246, 9, 0}, {2256, 5, 0},
+        {2262, 7, 0}, {2270, 9, 0}, {2280, 10, 0}, {2291, 6, 0}, {2298, 4, 0}, {2303, 7, 0}, {2311, 5, 0}, {2317, 6, 0},
+        {2324, 15, 0}, {2340, 6, 0}, {2347, 7, 0}, {2355, 16, 0}, {2372, 5, 0}, {2378, 13, 0}, {2392, 12, 0}, {2405, 8, 0},
+        {2414, 7, 0}, {2422, 4, 0}, {2427, 6, 0}, {2434, 27, 0}, {2462, 8, 0}, {2471, 7, 0}, {2479, 7, 0}, {2487, 9, 0},
+        {2497, 5, 0}, {2503, 6, 0}, {2510, 7, 0}, {2518, 8, 0}, {2527, 8, 0}, {2536, 4, 0}, {2541, 6, 0}, {2548, 10, 0},
+        {2559, 7, 0}, {2567, 17, 0}, {2585, 7, 0}, {2593, 12, 0}, {2606, 9, 0}, {2616, 9, 0}, {2626, 5, 0}, {2632, 7, 0},
+        {2640, 15, 0}, {2656, 16, 0}, {2673, 5, 0}, {2679, 8, 0}, {2688, 10, 0}, {2699, 7, 0}, {2707, 17, 0}, {2725, 30, 0},
+        {2756, 31, 0}, {2788, 7, 0}, {2796, 10, 0}, {2807, 6, 0}, {2814, 6, 0}, {2821, 5, 0}, {2827, 6, 0}, {2834, 8, 0},
+        {2843, 8, 0}, {2852, 7, 0}, {2860, 9, 0}, {2870, 7, 0}, {2878, 8, 0}, {2887, 5, 0}, {2893, 10, 0}, {2904, 7, 0},
+        {2912, 7, 0}, {2920, 8, 0}, {2929, 18, 0}, {2948, 4, 0}, {2953, 6, 0}, {2960, 5, 0}, {2966, 4, 0}, {2971, 4, 0},
+        {2976, 8, 0}, {2985, 4, 0}, {2990, 5, 0}, {2996, 5, 0}, {3002, 9, 0}, {3012, 16, 0}, {3029, 8, 0}, {3038, 7, 0},
+        {3046, 14, 0}, {3061, 6, 0}, {3068, 9, 0}, {3078, 7, 0}, {3086, 12, 0}, {3099, 11, 0}, {3111, 7, 0}, {3119, 10, 0},
+        {3130, 6, 0}, {3137, 7, 0}, {3145, 12, 0}, {3158, 7, 0}, {3166, 8, 0}, {3175, 9, 0}, {3185, 15, 0}, {3201, 8, 0},
+        {3210, 10, 0}, {3221, 15, 0}, {3237, 8, 0}, {3246, 7, 0}, {3254, 19, 0}, {3274, 9, 0}, {3284, 7, 0}, {3292, 10, 0},
+        {3303, 6, 0}, {3310, 7, 0}, {3318, 8, 0}, {3327, 6, 0}, {3334, 9, 0}, {3344, 10, 0}, {3355, 16, 0}, {3372, 29, 0},
+        {3402, 14, 0}, {3417, 8, 0}, {3426, 10, 0}, {3437, 9, 0}, {3447, 11, 0}, {3459, 19, 0}, {3479, 10, 0}, {3490, 17, 0},
+        {3508, 10, 0}, {3519, 5, 0}, {3525, 9, 0}, {3535, 8, 0}, {3544, 7, 0}, {3552, 7, 0}, {3560, 7, 0}, {3568, 6, 0},
+        {3575, 8, 0}, {3584, 7, 0}, {3592, 17, 0}, {3610, 5, 0}, {3616, 5, 0}, {3622, 11, 0}, {3634, 3, 0}, {3638, 6, 0},
+        {3645, 10, 0}, {3656, 16, 0}, {3673, 17, 0}, {3691, 12, 0}, {3704, 9, 0}, {3714, 9, 0}, {3724, 9, 0}, {3734, 6, 0},
+        {3741, 6, 0}, {3748, 7, 0}, {3756, 15, 0}, {3772, 14, 0}, {3787, 9, 0}, {3797, 14, 0}, {3812, 11, 0}, {3824, 13, 0},
+        {3838, 10, 0}, {3849, 22, 0}, {3872, 35, 0}, {3908, 21, 0}, {3930, 21, 0}, {3952, 21, 0}, {3974, 8, 0}, {3983, 8, 0},
+        {3992, 19, 0}, {4012, 10, 0}, {4023, 16, 0}, {4040, 7, 0}, {4048, 7, 0}, {4056, 14, 0}, {4071, 14, 0}, {4086, 19, 0},
+        {4106, 7, 0}, {4114, 14, 0}, {4129, 10, 0}, {4140, 5, 0}, {4146, 5, 0}, {4152, 3, 0}, {4156, 6, 0}, {4163, 7, 0},
+        {4171, 8, 0}, {4180, 9, 0}, {4190, 5, 0}, {4196, 9, 0}, {4206, 17, 0}, {4224, 8, 0}, {4233, 5, 0}, {4239, 18, 0},
+        {4258, 5, 0}, {4264, 12, 0}, {4277, 11, 0}, {4289, 4, 0}, {4294, 8, 0}, {4303, 17, 0}, {4321, 12, 0}, {4334, 8, 0},
+        {4343, 11, 0}, {4355, 10, 0}, {4366, 13, 0}, {4380, 7, 0}, {4388, 13, 0}, {4402, 6, 0}, {4409, 8, 0}, {4418, 18, 0},
+        {4437, 20, 0}, {4458, 5, 0}, {4464, 7, 0}, {4472, 8, 0}, {4481, 9, 0}, {4491, 8, 0}, {4500, 4, 0}, {4505, 11, 0},
+        {4517, 9, 0}, {4527, 8, 0}, {4536, 7, 0}, {4544, 8, 0}, {4553, 19, 0}, {4573, 9, 0}, {4583, 4, 0}, {4588, 8, 0},
+        {4597, 6, 0}, {4604, 9, 0}, {4614, 7, 0}, {4622, 8, 0}, {4631, 8, 0}, {4640, 17, 0}, {4658, 10, 0}, {4669, 18, 0},
+        {4688, 8, 0}, {4697, 6, 0}, {4704, 5, 0}, {4710, 4, 0}, {4715, 9, 0}, {4725, 8, 0}, {4734, 7, 0}, {4742, 6, 0},
+        {4749, 8, 0}, {4758, 6, 0}, {4765, 7, 0}, {4773, 11, 0}, {4785, 7, 0}, {4793, 10, 0}, {4804, 6, 0}, {4811, 6, 0},
+        {4818, 18, 0}, {4837, 7, 0}, {4845, 7, 0}, {4853, 6, 0}, {4860, 12, 0}, {4873, 8, 0}, {4882, 15, 0}, {4898, 14, 0},
+        {4913, 12, 0}, {4926, 22, 0}, {4949, 5, 0}, {4955, 32, 0}, {4988, 7, 0}, {4996, 5, 0}, {5002, 9, 0}, {5012, 8, 0},
+        {5021, 17, 0}, {5039, 6, 0}, {5046, 6, 0}, {5053, 16, 0}, {5070, 21, 0}, {5092, 20, 0}, {5113, 17, 0}, {5131, 27, 0},
+        {5159, 25, 0}, {5185, 27, 0}, {5213, 9, 0}, {5223, 16, 0}, {5240, 14, 0}, {5255, 15, 0}, {5271, 16, 0}, {5288, 11, 0},
+        {5300, 17, 0}, {5318, 21, 0}, {5340, 12, 0}, {5353, 15, 0}, {5369, 16, 0}, {5386, 15, 0}, {5402, 16, 0}, {5419, 17, 0},
+        {5437, 17, 0}, {5455, 17, 0}, {5473, 17, 0}, {5491, 18, 0}, {5510, 16, 0}, {5527, 15, 0}, {5543, 13, 0}, {5557, 17, 0},
+        {5575, 17, 0}, {5593, 17, 0}, {5611, 19, 0}, {5631, 14, 0}, {5646, 16, 0}, {5663, 16, 0}, {5680, 20, 0}, {5701, 14, 0},
+        {5716, 15, 0}, {5732, 17, 0}, {5750, 29, 0}, {5780, 14, 0}, {5795, 19, 0}, {5815, 18, 0}, {5834, 24, 0}, {5859, 12, 0},
+        {5872, 12, 0}, {5885, 18, 0}, {5904, 15, 0}, {5920, 17, 0}, {5938, 9, 0}, {5948, 19, 0}, {5968, 16, 0}, {5985, 19, 0},
+        {6005, 13, 0}, {6019, 17, 0}, {6037, 13, 0}, {6051, 12, 0}, {6064, 20, 0}, {6085, 14, 0}, {6100, 17, 0}, {6118, 19, 0},
+        {6138, 18, 0}, {6157, 16, 0}, {6174, 14, 0}, {6189, 18, 0}, {6208, 13, 0}, {6222, 11, 0}, {6234, 18, 0}, {6253, 15, 0},
+        {6269, 17, 0}, {6287, 14, 0}, {6302, 14, 0}, {6317, 17, 0}, {6335, 18, 0}, {6354, 14, 0}, {6369, 14, 0}, {6384, 19, 0},
+        {6404, 10, 0}, {6415, 29, 0}, {6445, 16, 0}, {6462, 14, 0}, {6477, 15, 0}, {6493, 17, 0}, {6511, 6, 0}, {6518, 5, 0},
+        {6524, 8, 0}, {6533, 7, 0}, {6541, 5, 0}, {6547, 6, 0}, {6554, 11, 0}, {6566, 9, 0}, {6576, 8, 0}, {6585, 7, 0},
+        {6593, 6, 0}, {6600, 5, 0}, {6606, 8, 0}, {6615, 8, 0}, {6624, 6, 0}, {6631, 7, 0}, {6639, 5, 0}, {6645, 7, 0},
+        {6653, 9, 0}, {6663, 5, 0}, {6669, 5, 0}, {6675, 5, 0}, {6681, 7, 0}, {6689, 10, 0}, {6700, 20, 0}, {6721, 12, 0},
+        {6734, 5, 0}, {6740, 14, 0}, {6755, 7, 0}, {6763, 6, 0}, {6770, 6, 0}, {6777, 5, 0}, {6783, 5, 0}, {6789, 7, 0},
+        {6797, 14, 0}, {6812, 5, 0}, {6818, 44, 0}, {6863, 17, 0}, {6881, 10, 0}, {6892, 13, 0}, {6906, 9, 0}, {6916, 6, 0},
+};
+
+static char TERRITORY_NAMES_UNPACKED_PL[6923];
+
+static const PackedTerritoryNames PACKED_TERRITORY_NAMES_PL = {
+        TERRITORY_NAMES_UNPACKED_PL, 6923, TERRITORY_NAMES_PACKED_PL, 3618, TERRITORY_NAMES_PAIRS_PL,
+        TERRITORY_NAME_ALTERNATIVES_START_PL, TERRITORY_NAME_ALTERNATIVES_PL};
+
+#else
+
+static const PackedTerritoryNames PACKED_TERRITORY_NAMES_PL = {NULL, 0, NULL, 0, NULL, NULL, NULL};
+
+#endif // MAPCODE_SUPPORT_LANGUAGE_PL
+
+#ifdef MAPCODE_SUPPORT_LANGUAGE_RU // Russian
+
+// 13175 bytes, packed to 3646
+static const unsigned char TERRITORY_NAMES_PACKED_RU[3646] = {
+        208, 147, 52, 212, 17, 146, 70, 76, 16, 58, 161, 25, 12, 9, 196, 80, 83, 17, 201, 8, 19, 72, 71, 41,
+        117, 99, 147, 215, 6, 39, 252, 127, 5, 10, 91, 245, 74, 5, 10, 112, 33, 51, 8, 93, 118, 154, 103, 241,
+        93, 231, 31, 34, 145, 38, 9, 91, 20, 50, 55, 157, 1, 81, 13, 127, 13, 25, 39, 13, 71, 1, 18, 5,
+        60, 27, 9, 34, 156, 1, 38, 9, 31, 60, 31, 34, 156, 38, 9, 31, 119, 52, 202, 72, 10, 95, 164, 103,
+        109, 34, 144, 65, 253, 58, 164, 103, 109, 34, 144, 65, 253, 223, 88, 10, 97, 6, 4, 222, 66, 17, 145, 13,
+        25, 8, 194, 28, 50, 228, 192, 118, 145, 28, 50, 228, 51, 194, 113, 16, 36, 32, 9, 28, 113, 52, 21, 17,
+        152, 250, 83, 49, 15, 179, 5, 73, 10, 8, 16, 231, 16, 32, 45, 17, 156, 38, 27, 99, 147, 28, 4, 238,
+        144, 4, 35, 103, 20, 12, 71, 41, 7, 28, 6, 70, 205, 53, 28, 238, 158, 66, 17, 160, 15, 182, 22, 8,
+        19, 25, 24, 163, 72, 11, 120, 95, 164, 227, 106, 118, 234, 144, 202, 6, 62, 194, 113, 16, 92, 17, 146, 244,
+        27, 192, 118, 146, 244, 27, 192, 1, 44, 17, 145, 113, 16, 92, 247, 3, 61, 9, 31, 80, 9, 196, 4, 107,
+        6, 64, 177, 198, 38, 80, 39, 11, 33, 51, 93, 170, 50, 28, 76, 16, 49, 5, 207, 161, 68, 5, 118, 161,
+        68, 5, 1, 44, 17, 144, 50, 28, 76, 16, 49, 5, 8, 222, 66, 1, 17, 154, 13, 18, 60, 31, 34, 159,
+        20, 28, 95, 156, 76, 91, 41, 58, 156, 76, 91, 41, 119, 3, 13, 97, 60, 216, 34, 154, 88, 7, 95, 157,
+        100, 120, 58, 157, 100, 120, 74, 54, 50, 16, 33, 51, 93, 24, 145, 41, 54, 6, 8, 44, 17, 161, 216, 34,
+        173, 19, 70, 3, 13, 7, 95, 161, 122, 118, 161, 122, 118, 161, 216, 34, 173, 19, 70, 3, 13, 7, 71, 172,
+        22, 3, 25, 51, 60, 25, 12, 9, 15, 185, 17, 149, 11, 31, 51, 44, 17, 146, 15, 183, 4, 63, 31, 21,
+        95, 162, 6, 237, 16, 45, 22, 220, 154, 106, 20, 12, 58, 146, 15, 183, 4, 63, 31, 75, 58, 162, 6, 237,
+        16, 45, 22, 220, 154, 106, 20, 12, 71, 172, 9, 24, 193, 31, 57, 170, 50, 28, 76, 16, 92, 17, 146, 244,
+        27, 192, 118, 146, 244, 27, 192, 1, 44, 17, 161, 208, 168, 208, 144, 71, 54, 137, 9, 24, 168, 59, 3, 90,
+        69, 28, 35, 31, 95, 175, 4, 34, 156, 54, 31, 58, 175, 4, 34, 156, 54, 31, 60, 216, 34, 146, 27, 7,
+        216, 95, 193, 31, 57, 27, 51, 58, 193, 31, 57, 27, 51, 222, 66, 17, 165, 28, 22, 32, 3, 93, 1, 17,
+        156, 117, 22, 41, 172, 22, 58, 156, 117, 22, 41, 172, 22, 194, 38, 69, 57, 112, 107, 4, 9, 29, 179, 13,
+        1, 95, 145, 38, 69, 228, 118, 145, 38, 69, 228, 24, 187, 76, 28, 32, 10, 203, 6, 102, 5, 60, 196, 80,
+        91, 20, 192, 24, 159, 39, 245, 60, 217, 104, 207, 156, 38, 3, 16, 192, 1, 0, 82, 52, 6, 24, 147, 13,
+        68, 222, 66, 17, 156, 97, 4, 60, 16, 10, 9, 34, 155, 203, 7, 23, 156, 76, 6, 41, 8, 87, 21, 58,
+        164, 210, 28, 70, 3, 25, 104, 207, 168, 9, 70, 51, 17, 156, 76, 6, 41, 8, 87, 3, 55, 161, 241, 229,
+        81, 127, 41, 35, 24, 148, 114, 27, 62, 194, 111, 6, 196, 4, 74, 94, 215, 70, 55, 158, 66, 1, 17, 162,
+        28, 10, 7, 95, 154, 54, 10, 112, 58, 154, 54, 10, 112, 60, 16, 34, 162, 114, 8, 95, 201, 27, 7, 109,
+        3, 58, 201, 27, 7, 109, 55, 147, 41, 10, 41, 35, 71, 38, 9, 27, 62, 195, 38, 28, 192, 24, 147, 25,
+        57, 91, 13, 59, 214, 114, 52, 192, 198, 108, 6, 76, 83, 2, 178, 112, 7, 5, 210, 27, 31, 75, 247, 203,
+        10, 7, 240, 69, 81, 35, 60, 68, 5, 24, 234, 148, 53, 52, 22, 53, 21, 95, 126, 104, 207, 161, 82, 25,
+        249, 100, 51, 93, 118, 126, 104, 207, 161, 82, 25, 249, 100, 51, 93, 24, 164, 6, 16, 90, 64, 183, 125, 159,
+        72, 27, 8, 87, 213, 122, 121, 146, 28, 22, 8, 127, 6, 27, 248, 57, 95, 162, 15, 177, 169, 5, 58, 162,
+        15, 177, 169, 99, 145, 6, 106, 196, 195, 6, 16, 90, 64, 183, 92, 17, 126, 104, 8, 95, 144, 4, 252, 10,
+        9, 249, 8, 92, 17, 183, 240, 11, 55, 159, 13, 97, 6, 9, 121, 160, 76, 5, 74, 109, 6, 247, 3, 25,
+        123, 175, 50, 54, 18, 221, 68, 69, 213, 70, 38, 195, 72, 10, 253, 192, 24, 146, 16, 13, 70, 13, 224, 28,
+        4, 15, 179, 52, 23, 145, 169, 68, 92, 73, 45, 25, 24, 146, 5, 19, 5, 101, 232, 17, 162, 242, 52, 60,
+        25, 14, 183, 103, 199, 74, 13, 25, 196, 9, 195, 248, 53, 3, 124, 5, 66, 1, 17, 164, 248, 53, 55, 157,
+        33, 85, 154, 39, 210, 41, 230, 11, 33, 31, 23, 152, 87, 6, 1, 103, 37, 162, 28, 113, 52, 3, 89, 159,
+        39, 8, 19, 27, 51, 60, 172, 25, 57, 52, 194, 91, 29, 183, 205, 53, 215, 227, 55, 156, 117, 210, 41, 23,
+        160, 13, 82, 24, 147, 1, 88, 55, 145, 81, 106, 22, 55, 173, 10, 25, 70, 52, 3, 172, 98, 147, 25, 27,
+        225, 107, 11, 69, 197, 161, 72, 114, 41, 33, 51, 93, 170, 6, 50, 31, 23, 155, 63, 137, 99, 145, 91, 20,
+        35, 23, 156, 72, 22, 33, 24, 147, 25, 27, 225, 34, 145, 120, 245, 127, 54, 25, 16, 37, 145, 227, 123, 168,
+        25, 196, 90, 38, 23, 157, 248, 28, 211, 51, 205, 197, 173, 19, 41, 23, 148, 114, 27, 76, 16, 233, 60, 11,
+        33, 117, 213, 5, 19, 220, 160, 62, 194, 112, 4, 21, 95, 147, 28, 90, 251, 33, 27, 24, 165, 52, 25, 70,
+        23, 162, 15, 179, 99, 155, 70, 25, 23, 155, 88, 25, 24, 168, 6, 89, 155, 16, 18, 2, 193, 64, 183, 23,
+        152, 6, 211, 230, 20, 28, 6, 220, 155, 8, 41, 8, 223, 16, 68, 24, 167, 226, 233, 195, 6, 16, 90, 64,
+        183, 125, 147, 25, 3, 16, 24, 158, 69, 209, 138, 210, 27, 31, 104, 207, 144, 6, 122, 92, 17, 173, 50, 94,
+        70, 51, 107, 25, 56, 23, 144, 87, 28, 69, 54, 22, 53, 16, 60, 28, 69, 23, 152, 52, 22, 197, 159, 52,
+        9, 255, 39, 23, 146, 31, 35, 6, 23, 234, 154, 52, 225, 235, 7, 211, 23, 147, 25, 70, 240, 39, 214, 64,
+        177, 24, 145, 72, 35, 38, 23, 155, 215, 28, 23, 147, 41, 22, 81, 102, 194, 31, 27, 2, 173, 113, 6, 225,
+        71, 39, 108, 55, 161, 217, 98, 154, 52, 225, 119, 62, 6, 169, 13, 24, 193, 8, 90, 23, 162, 57, 53, 76,
+        237, 123, 145, 16, 35, 11, 57, 226, 119, 8, 59, 39, 127, 106, 120, 60, 81, 27, 68, 2, 163, 6, 255, 25,
+        54, 74, 68, 69, 212, 53, 231, 94, 230, 31, 251, 39, 74, 244, 29, 183, 23, 145, 91, 38, 13, 7, 37, 147,
+        54, 16, 24, 155, 1, 112, 2, 160, 13, 50, 51, 4, 23, 147, 16, 24, 163, 35, 82, 231, 5, 210, 27, 31,
+        4, 5, 207, 154, 52, 72, 100, 19, 25, 5, 58, 168, 137, 211, 21, 58, 146, 91, 76, 15, 177, 113, 16, 21,
+        58, 161, 217, 98, 152, 6, 211, 21, 58, 152, 6, 211, 21, 44, 17, 161, 217, 4, 67, 221, 25, 27, 225, 2,
+        173, 10, 25, 57, 52, 2, 151, 229, 57, 98, 161, 111, 38, 1, 124, 7, 111, 6, 108, 55, 147, 122, 41, 119,
+        33, 85, 151, 91, 82, 23, 145, 81, 10, 27, 220, 164, 102, 99, 164, 103, 109, 59, 27, 51, 235, 9, 39, 23,
+        158, 50, 123, 159, 72, 20, 80, 214, 137, 45, 22, 96, 208, 152, 25, 13, 38, 119, 52, 25, 251, 23, 156, 39,
+        54, 87, 23, 146, 20, 206, 4, 68, 195, 27, 11, 116, 22, 213, 41, 35, 121, 145, 6, 14, 183, 87, 108, 103,
+        37, 147, 28, 50, 197, 175, 59, 41, 23, 151, 242, 69, 122, 25, 8, 223, 38, 169, 25, 54, 235, 6, 117, 71,
+        38, 5, 10, 10, 99, 163, 87, 69, 239, 237, 123, 168, 25, 8, 90, 23, 159, 229, 13, 1, 32, 45, 17, 157,
+        33, 85, 147, 25, 27, 225, 74, 68, 28, 106, 127, 81, 10, 50, 31, 237, 123, 152, 7, 59, 197, 162, 1, 103,
+        82, 2, 153, 240, 31, 195, 6, 16, 90, 23, 144, 211, 192, 214, 31, 23, 145, 137, 7, 25, 16, 198, 57, 169,
+        1, 30, 6, 2, 163, 105, 1, 27, 1, 0, 203, 53, 232, 17, 161, 228, 123, 166, 216, 6, 172, 4, 121, 144,
+        202, 6, 76, 16, 233, 60, 114, 39, 55, 144, 202, 35, 16, 237, 16, 71, 20, 116, 50, 118, 145, 94, 50, 24,
+        151, 68, 69, 23, 167, 103, 55, 162, 81, 90, 23, 159, 117, 237, 16, 71, 15, 183, 68, 69, 76, 119, 68, 215,
+        23, 146, 31, 63, 13, 97, 11, 24, 157, 29, 179, 28, 23, 162, 16, 87, 197, 149, 35, 109, 206, 71, 108, 113,
+        197, 145, 72, 3, 25, 23, 173, 202, 3, 15, 191, 213, 72, 13, 50, 69, 23, 234, 144, 202, 6, 62, 71, 39,
+        55, 144, 4, 35, 72, 24, 157, 29, 179, 28, 224, 57, 223, 28, 13, 71, 41, 35, 72, 23, 175, 17, 191, 15,
+        177, 8, 53, 39, 247, 3, 25, 230, 228, 123, 152, 250, 41, 8, 87, 23, 164, 210, 28, 172, 232, 32, 6, 54,
+        41, 127, 11, 246, 18, 11, 198, 52, 91, 112, 107, 35, 13, 1, 30, 11, 20, 216, 63, 74, 72, 242, 214, 28,
+        206, 38, 99, 152, 22, 172, 35, 99, 168, 9, 70, 17, 156, 239, 7, 62, 0, 9, 122, 1, 49, 99, 157, 67,
+        113, 221, 13, 16, 111, 13, 70, 99, 159, 13, 97, 208, 26, 24, 174, 18, 9, 16, 74, 27, 9, 16, 220, 160,
+        5, 5, 60, 27, 39, 5, 214, 68, 59, 8, 101, 8, 71, 249, 5, 117, 16, 60, 16, 32, 45, 17, 155, 13,
+        120, 34, 159, 137, 112, 55, 147, 28, 6, 28, 99, 157, 13, 97, 25, 121, 155, 8, 41, 119, 29, 182, 4, 12,
+        12, 17, 154, 39, 3, 202, 52, 4, 23, 146, 28, 1, 105, 13, 7, 224, 20, 12, 59, 102, 2, 234, 157, 29,
+        182, 4, 12, 12, 17, 154, 39, 3, 202, 52, 4, 230, 1, 18, 9, 8, 18, 7, 236, 39, 3, 49, 99, 162,
+        68, 245, 11, 109, 102, 222, 111, 1, 18, 205, 81, 16, 35, 5, 74, 5, 111, 13, 103, 231, 41, 52, 24, 167,
+        3, 61, 13, 111, 13, 24, 193, 31, 211, 230, 1, 228, 33, 125, 144, 6, 108, 213, 41, 35, 121, 154, 27, 80,
+        102, 170, 11, 53, 94, 74, 14, 183, 111, 19, 16, 107, 6, 35, 216, 27, 24, 148, 68, 16, 95, 148, 3, 13,
+        205, 57, 6, 1, 95, 157, 169, 38, 61, 108, 91, 55, 167, 82, 29, 179, 38, 61, 107, 250, 68, 16, 92, 95,
+        157, 76, 15, 177, 38, 92, 247, 117, 80, 57, 25, 109, 205, 91, 55, 156, 251, 61, 39, 67, 119, 169, 39, 199,
+        71, 16, 109, 81, 127, 6, 109, 81, 198, 29, 183, 52, 68, 60, 76, 10, 242, 223, 199, 53, 122, 236, 38, 20,
+        116, 170, 6, 106, 1, 101, 39, 34, 201, 57, 226, 107, 7, 7, 68, 194, 3, 61, 38, 2, 163, 9, 252, 117,
+        61, 82, 221, 5, 214, 28, 39, 24, 162, 68, 103, 4, 57, 236, 242, 1, 101, 39, 34, 201, 57, 226, 205, 53,
+        68, 50, 13, 95, 154, 246, 50, 94, 224, 61, 70, 9, 120, 35, 38, 61, 205, 53, 38, 10, 61, 82, 74, 38,
+        4, 70, 1, 18, 2, 160, 57, 53, 40, 61, 123, 158, 6, 120, 7, 24, 147, 228, 53, 38, 70, 2, 151, 229,
+        57, 98, 145, 31, 35, 39, 23, 156, 57, 61, 20, 12, 34, 201, 57, 226, 127, 91, 241, 16, 170, 250, 61, 6,
+        220, 201, 57, 226, 71, 111, 38, 246, 9, 6, 24, 163, 9, 252, 34, 201, 57, 226, 223, 41, 22, 249, 28, 6,
+        55, 157, 33, 51, 65, 17, 126, 232, 17, 163, 97, 11, 20, 7, 0, 9, 28, 113, 52, 21, 32, 19, 72, 3,
+        90, 51, 17, 144, 25, 56, 39, 3, 55, 162, 28, 113, 52, 21, 17, 148, 53, 28, 25, 120, 34, 145, 196, 60,
+        217, 4, 67, 32, 9, 28, 113, 52, 23, 234, 144, 25, 56, 39, 23, 162, 102, 50, 197, 146, 76, 9, 52, 23,
+        151, 229, 57, 98, 144, 25, 56, 39, 213, 25, 27, 7, 253, 195, 210, 28, 172, 232, 73, 105, 255, 60, 28, 53,
+        109, 55, 144, 11, 169, 5, 102, 2, 160, 3, 5, 17, 180, 207, 150, 16, 196, 6, 99, 173, 7, 59, 94, 88,
+        254, 161, 16, 9, 13, 2, 160, 3, 121, 193, 82, 8, 45, 22, 254, 157, 52, 9, 55, 159, 38, 1, 215, 51,
+        60, 16, 9, 220, 154, 70, 38, 27, 24, 159, 28, 4, 68, 69, 13, 10, 13, 107, 50, 229, 231, 8, 38, 170,
+        105, 55, 159, 38, 16, 24, 160, 52, 54, 50, 24, 160, 41, 22, 41, 230, 16, 34, 159, 245, 11, 13, 223, 3,
+        245, 55, 162, 5, 10, 16, 9, 27, 7, 2, 160, 3, 121, 193, 82, 8, 45, 22, 254, 161, 13, 11, 71, 38,
+        16, 20, 116, 221, 5, 12, 7, 71, 70, 254, 193, 112, 13, 45, 22, 254, 161, 13, 11, 194, 1, 23, 156, 27,
+        102, 34, 150, 28, 54, 7, 71, 70, 254, 193, 112, 13, 223, 38, 170, 50, 14, 183, 41, 102, 222, 105, 255, 17,
+        154, 72, 13, 50, 69, 23, 160, 212, 34, 144, 65, 253, 205, 91, 108, 97, 6, 74, 41, 4, 239, 9, 76, 227,
+        119, 20, 203, 34, 148, 53, 28, 238, 157, 20, 203, 34, 147, 240, 59, 80, 94, 2, 146, 28, 50, 41, 9, 71,
+        102, 7, 1, 101, 13, 7, 206, 7, 221, 108, 54, 55, 156, 97, 6, 103, 199, 2, 151, 229, 57, 98, 146, 244,
+        27, 23, 234, 154, 38, 72, 27, 198, 97, 4, 235, 250, 3, 16, 214, 216, 13, 10, 10, 55, 162, 31, 4, 63,
+        238, 146, 244, 27, 23, 158, 35, 54, 99, 159, 31, 7, 103, 20, 25, 197, 156, 120, 7, 120, 109, 55, 155, 13,
+        29, 183, 3, 16, 170, 11, 122, 68, 170, 6, 10, 16, 87, 102, 60, 217, 98, 154, 38, 72, 27, 24, 157, 20,
+        203, 34, 153, 52, 10, 107, 65, 33, 24, 152, 11, 11, 27, 15, 185, 7, 2, 193, 64, 183, 23, 146, 3, 49,
+        41, 7, 27, 195, 11, 52, 248, 198, 120, 7, 81, 55, 158, 10, 11, 111, 114, 231, 217, 98, 148, 117, 137, 24,
+        146, 246, 241, 9, 41, 2, 234, 148, 117, 137, 24, 157, 8, 69, 6, 1, 30, 74, 16, 87, 102, 107, 65, 22,
+        111, 99, 174, 9, 198, 27, 4, 63, 137, 198, 249, 29, 179, 123, 146, 54, 114, 241, 222, 6, 251, 41, 74, 72,
+        52, 57, 99, 157, 100, 57, 170, 6, 29, 183, 41, 24, 157, 20, 203, 34, 156, 239, 7, 76, 5, 71, 41, 9,
+        16, 214, 39, 3, 202, 52, 4, 23, 162, 8, 61, 102, 107, 11, 12, 30, 2, 177, 113, 16, 125, 154, 72, 13,
+        50, 69, 21, 0, 172, 69, 28, 9, 24, 158, 4, 252, 3, 5, 74, 25, 8, 69, 239, 60, 1, 30, 101, 100,
+        16, 71, 16, 88, 15, 177, 24, 157, 20, 203, 202, 1, 106, 22, 253, 119, 33, 51, 65, 17, 145, 6, 16, 7,
+        25, 76, 119, 33, 85, 168, 137, 211, 23, 158, 66, 17, 201, 27, 90, 1, 17, 173, 22, 13, 38, 22, 24, 174,
+        10, 41, 60, 217, 121, 183, 229, 57, 104, 8, 32, 9, 28, 113, 52, 3, 55, 157, 106, 108, 227, 235, 250, 23,
+        144, 25, 56, 39, 23, 145, 6, 14, 183, 103, 230, 208, 168, 208, 144, 58, 161, 5, 210, 27, 31, 104, 207, 168,
+        9, 70, 51, 17, 144, 50, 28, 76, 3, 58, 144, 50, 28, 62, 71, 239, 7, 62, 71, 5, 49, 25, 231, 16,
+        10, 9, 34, 159, 206, 28, 69, 81, 35, 74, 39, 27, 241, 6, 57, 243, 152, 4, 35, 13, 80, 206, 23, 115,
+        144, 22, 51, 35, 225, 60, 217, 98, 158, 7, 206, 21, 34, 144, 11, 197, 154, 122, 38, 22, 27, 121, 145, 39,
+        18, 6, 233, 74, 38, 1, 101, 1, 100, 121, 167, 28, 10, 63, 233, 224, 8, 101, 31, 233, 224, 13, 25, 246,
+        233, 235, 25, 16, 171, 155, 109, 8, 90, 18, 12, 47, 158, 6, 11, 171, 162, 13, 11, 20, 48, 145, 91, 35,
+        52, 212, 48, 146, 11, 57, 242, 94, 48, 154, 81, 48, 154, 39, 13, 53, 48, 162, 68, 69, 171, 145, 6, 116,
+        48, 175, 6, 112, 11, 108, 48, 160, 12, 87, 16, 48, 144, 56, 111, 16, 48, 156, 5, 49, 171, 161, 50, 72,
+        31, 243, 148, 169, 8, 19, 123, 146, 52, 41, 8, 53, 48, 157, 33, 35, 52, 212, 48, 159, 49, 171, 154, 5,
+        56, 114, 48, 161, 9, 108, 6, 15, 191, 72, 20, 219, 74, 6, 102, 4, 212, 38, 219, 2, 115, 154, 39, 50,
+        51, 10, 23, 162, 25, 28, 48, 155, 31, 241, 6, 57, 48, 160, 5, 19, 171, 146, 72, 35, 15, 179, 6, 57,
+        48, 146, 72, 15, 179, 212, 48, 156, 81, 50, 16, 243, 154, 38, 91, 23, 157, 31, 8, 90, 10, 83, 32, 108,
+        9, 41, 114, 232, 73, 105, 255, 2, 115, 154, 114, 55, 144, 6, 61, 16, 35, 91, 20, 243, 156, 52, 22, 33,
+        23, 157, 29, 182, 251, 52, 212, 48, 159, 31, 87, 31, 48, 154, 94, 171, 115, 156, 38, 83, 17, 173, 11, 222,
+        6, 31, 69, 81, 35, 48, 163, 11, 20, 116, 171, 159, 28, 50, 219, 2, 115, 145, 246, 10, 52, 9, 5, 19,
+        123, 163, 22, 50, 81, 9, 233, 2, 115, 162, 70, 38, 19, 16, 60, 68, 38, 48, 161, 38, 70, 171, 175, 50,
+        39, 121, 157, 31, 8, 90, 10, 83, 236, 16, 9, 51, 34, 156, 16, 7, 83, 110, 60, 25, 28, 22, 11, 171,
+        162, 203, 50, 31, 48, 154, 81, 35, 16, 48, 167, 91, 12, 69, 27, 243, 145, 81, 12, 9, 23, 151, 122, 54,
+        18, 11, 20, 219, 235, 6, 10, 227, 48, 157, 33, 112, 215, 94, 48, 162, 114, 48, 158, 50, 243, 165, 1, 18,
+        7, 213, 240, 28, 171, 115, 144, 11, 9, 54, 107, 11, 9, 54, 219, 2, 79, 13, 204, 129, 208, 77, 17, 162,
+        51, 25, 1, 204, 129, 74, 6, 102, 4, 5, 12, 6, 219, 71, 169, 57, 16, 48, 167, 13, 10, 137, 110, 73,
+        105, 255, 74, 68, 101, 70, 219, 60, 111, 39, 27, 48, 201, 242, 52, 219, 2, 149, 25, 6, 196, 36, 32, 108,
+        9, 41, 114, 4, 67, 47, 165, 122, 38, 33, 219, 107, 50, 81, 243, 161, 111, 118, 175, 10, 227, 213, 16, 57,
+        24, 160, 112, 7, 23, 168, 16, 61, 54, 127, 116, 20, 90, 87, 27, 37, 159, 239, 27, 236, 54, 4, 16, 37,
+        157, 27, 7, 12, 34, 165, 13, 97, 65, 110, 224, 106, 90, 27, 224, 53, 97, 90, 87, 116, 2, 166, 87, 116,
+        7, 13, 195, 13, 90, 87, 116, 37, 144, 4, 20, 61, 15, 185, 247, 12, 41, 27, 2, 168, 16, 20, 22, 106,
+        2, 168, 16, 20, 238, 166, 87, 116, 238, 165, 97, 4, 16, 37, 147, 64, 185, 101, 53, 5, 13, 221, 13, 82,
+        106, 236, 64, 177, 97, 65, 2, 166, 87, 103, 27, 20, 0, 61, 97, 69, 97, 65, 2, 168, 97, 4, 20, 238,
+        146, 4, 227, 6, 31, 4, 12, 12, 17, 156, 41, 35, 72, 23, 165, 97, 65, 11, 106, 90, 87, 116, 236, 106,
+        16, 37, 147, 13, 16, 7, 3, 34, 167, 53, 13, 16, 110, 60, 51, 101, 13, 16, 37, 174, 4, 20, 4, 16,
+        37, 162, 215, 206, 200, 108, 9, 41, 114, 232, 32, 6, 54, 41, 58, 162, 215, 206, 221, 16, 20, 7, 13, 2,
+        166, 27, 61, 54, 60, 27, 20, 90, 87, 116, 34, 163, 65, 35, 81, 110, 74, 88, 54, 60, 208, 168, 208, 144,
+        17, 146, 4, 226, 4, 75, 17, 188, 39, 51, 8, 93, 24, 158, 66, 17, 154, 11, 109, 59, 28, 9, 41, 107,
+        4, 252, 10, 9, 248, 198, 8, 53, 22, 106, 38, 212, 232, 58, 156, 94, 58, 151, 240, 11, 12, 0,
+};
+
+static const unsigned char TERRITORY_NAMES_PAIRS_RU[256][2] = {
+        {0, 0}, {208, 176}, {0, 208}, {208, 184}, {208, 189}, {208, 190}, {209, 128}, {209, 129}, {208, 181}, {209, 130}, {208, 186}, {208, 187},
+        {209, 143}, {209, 131}, {1, 208}, {5, 208}, {1, 4}, {32, 208}, {10, 1}, {7, 9}, {209, 140}, {3, 12}, {208, 180}, {21, 2},
+        {1, 2}, {208, 178}, {177, 11}, {3, 4}, {8, 6}, {3, 208}, {7, 18}, {8, 4}, {32, 32}, {15, 178}, {45, 208}, {208, 179},
+        {30, 12}, {20, 2}, {1, 6}, {1, 11}, {1, 19}, {5, 4}, {15, 26}, {32, 42}, {44, 44}, {45, 45}, {40, 37}, {43, 46},
+        {36, 47}, {7, 10}, {208, 188}, {209, 139}, {5, 6}, {208, 182}, {14, 185}, {3, 2}, {19, 6}, {14, 180}, {124, 208}, {208, 191},
+        {2, 161}, {209, 133}, {3, 18}, {8, 7}, {13, 208}, {208, 185}, {56, 33}, {1, 12}, {14, 188}, {208, 177}, {1, 9}, {2, 156},
+        {5, 11}, {32, 5}, {2, 154}, {3, 8}, {3, 10}, {26, 62}, {63, 59}, {160, 78}, {209, 136}, {13, 6}, {16, 22}, {29, 185},
+        {64, 77}, {67, 17}, {79, 84}, {208, 183}, {3, 9}, {3, 17}, {209, 134}, {8, 11}, {49, 75}, {73, 66}, {3, 6}, {32, 89},
+        {96, 96}, {209, 141}, {4, 85}, {5, 2}, {8, 25}, {209, 135}, {1, 7}, {3, 11}, {4, 51}, {10, 6}, {13, 4}, {2, 144},
+        {14, 178}, {29, 191}, {49, 83}, {1, 61}, {5, 7}, {6, 88}, {15, 188}, {86, 17}, {12, 4}, {1, 10}, {1, 58}, {2, 157},
+        {3, 7}, {5, 34}, {14, 177}, {16, 2}, {124, 124}, {36, 17}, {174, 53}, {2, 162}, {128, 128}, {129, 129}, {130, 130}, {131, 131},
+        {132, 132}, {133, 133}, {134, 134}, {135, 135}, {136, 136}, {5, 9}, {138, 138}, {139, 139}, {140, 140}, {141, 141}, {142, 142}, {143, 143},
+        {144, 144}, {145, 145}, {146, 146}, {147, 147}, {148, 148}, {149, 149}, {150, 150}, {151, 151}, {152, 152}, {153, 153}, {154, 154}, {155, 155},
+        {156, 156}, {157, 157}, {158, 158}, {159, 159}, {160, 160}, {161, 161}, {162, 162}, {163, 163}, {164, 164}, {165, 165}, {166, 166}, {167, 167},
+        {168, 168}, {14, 179}, {24, 144}, {33, 48}, {39, 20}, {173, 173}, {174, 174}, {175, 175}, {176, 176}, {177, 177}, {178, 178}, {179, 179},
+        {180, 180}, {181, 181}, {182, 182}, {183, 183}, {184, 184}, {185, 185}, {186, 186}, {187, 187}, {188, 188}, {189, 189}, {190, 190}, {191, 191},
+        {92, 93}, {147, 6}, {2, 145}, {2, 164}, {8, 65}, {16, 23}, {24, 156}, {31, 22}, {110, 32}, {159, 6}, {209, 132}, {209, 142},
+        {204, 204}, {2, 148}, {8, 9}, {8, 17}, {208, 208}, {209, 209}, {8, 22}, {11, 82}, {15, 180}, {23, 154}, {24, 154}, {29, 177},
+        {31, 9}, {100, 28}, {105, 54}, {200, 218}, {1, 34}, {2, 147}, {2, 158}, {2, 159}, {2, 167}, {8, 12}, {8, 80}, {13, 9},
+        {13, 22}, {14, 191}, {23, 161}, {24, 161}, {104, 65}, {125, 86}, {126, 98}, {2, 152}, {2, 165}, {3, 19}, {7, 55}, {8, 10},
+        {8, 50}, {27, 35}, {29, 188}, {48, 115}, {94, 35}, {1, 13}, {1, 80}, {2, 155}, {3, 22}, {3, 101}, {4, 22}, {8, 35},
+        {9, 38}, {11, 199}, {13, 34}, {13, 35},
+};
+
+static const unsigned short TERRITORY_NAME_ALTERNATIVES_START_RU[_TERRITORY_MAX - _TERRITORY_MIN] = {
+        0, 2, 3, 4, 5, 7, 8, 9, 10, 11, 12, 13, 15, 16, 17, 19,
+        20, 21, 22, 23, 24, 25, 26, 28, 30, 31, 32, 33, 35, 36, 38, 39,
+        41, 42, 45, 46, 49, 50, 51, 53, 54, 56, 58, 60, 61, 63, 64, 65,
+        66, 67, 68, 69, 70, 71, 73, 74, 75, 76, 77, 78, 80, 82, 83, 84,
+        85, 86, 87, 88, 89, 90, 91, 93, 94, 95, 97, 98, 99, 100, 101, 102,
+        103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 114, 115, 116, 117, 118, 119,
+        120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132, 133, 134, 135,
+        136, 137, 138, 139, 140, 141, 142, 143, 144, 145, 146, 147, 148, 149, 150, 151,
+        152, 153, 154, 155, 156, 157, 158, 159, 160, 161, 162, 163, 164, 165, 166, 167,
+        168, 169, 170, 171, 172, 173, 174, 175, 176, 177, 178, 179, 180, 181, 182, 183,
+        184, 185, 186, 187, 188, 189, 190, 195, 196, 197, 199, 200, 201, 202, 203, 204,
+        205, 206, 207, 208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220,
+        221, 222, 223, 224, 225, 226, 227, 228, 229, 230, 231, 232, 233, 234, 235, 236,
+        238, 239, 240, 241, 242, 243, 244, 245, 246, 247, 248, 249, 250, 251, 252, 253,
+        254, 255, 256, 257, 258, 259, 260, 261, 262, 263, 264, 265, 266, 267, 268, 269,
+        270, 271, 272, 273, 274, 275, 276, 277, 278, 279, 280, 281, 282, 283, 284, 285,
+        286, 287, 288, 289, 290, 291, 292, 293, 294, 295, 296, 297, 298, 299, 300, 301,
+        302, 303, 304, 305, 306, 307, 308, 309, 310, 311, 312, 313, 314, 315, 316, 317,
+        318, 319, 320, 321, 322, 323, 324, 325, 326, 327, 328, 329, 330, 331, 332, 333,
+        334, 335, 336, 337, 338, 339, 340, 341, 342, 343, 344, 345, 346, 347, 348, 349,
+        350, 351, 352, 353, 354, 355, 356, 357, 358, 359, 360, 361, 362, 363, 364, 365,
+        366, 367, 368, 369, 370, 371, 372, 373, 374, 375, 376, 377, 378, 379, 380, 381,
+        382, 383, 384, 385, 386, 387, 388, 389, 390, 391, 392, 393, 394, 395, 396, 397,
+        398, 399, 400, 401, 402, 403, 404, 405, 406, 407, 408, 409, 410, 411, 412, 413,
+        414, 415, 416, 417, 418, 419, 420, 421, 422, 423, 424, 425, 426, 427, 428, 429,
+        430, 431, 432, 433, 434, 435, 436, 437, 438, 439, 440, 443, 444, 445, 446, 447,
+        448, 449, 450, 451, 452, 453, 454, 455, 456, 457, 458, 459, 460, 461, 462, 463,
+        464, 465, 466, 467, 468, 469, 470, 471, 472, 473, 474, 475, 476, 477, 478, 479,
+        480, 481, 482, 483, 484, 485, 486, 487, 488, 489, 490, 491, 492, 493, 494, 495,
+        496, 497, 498, 499, 500, 501, 502, 503, 504, 505, 506, 507, 508, 509, 510, 511,
+        512, 513, 514, 515, 516, 517, 518, 519, 520, 521, 522, 523, 524, 525, 526, 528,
+        529, 530, 531, 532, 533, 534, 535, 536, 537, 538, 539, 540, 541, 542, 543, 544,
+        545, 546, 547, 548, 549, 550, 551, 552, 553, 554, 555, 556, 557, 559, 560, 561,
+        562, 563, 564, 565, 566, 569,
+};
+
+static const TerritoryNameAlternative TERRITORY_NAME_ALTERNATIVES_RU[569] = {
+        {0, 25, 2}, {26, 33, 2}, {60, 12, 2}, {73, 18, 2}, {92, 14, 2}, {107, 33, 2}, {141, 27, 2}, {169, 25, 2},
+        {195, 10, 2}, {206, 12, 2}, {219, 10, 2}, {230, 23, 2}, {254, 19, 2}, {274, 41, 2}, {316, 23, 2}, {340, 14, 2},
+        {355, 21, 2}, {377, 35, 2}, {413, 14, 2}, {428, 75, 2}, {504, 21, 2}, {526, 12, 2}, {539, 14, 2}, {554, 18, 2},
+        {573, 12, 2}, {586, 31, 2}, {618, 28, 2}, {647, 23, 2}, {671, 56, 2}, {728, 57, 2}, {786, 22, 2}, {809, 10, 2},
+        {820, 35, 2}, {856, 35, 2}, {892, 36, 2}, {929, 23, 2}, {953, 33, 2}, {987, 14, 2}, {1002, 8, 2}, {1011, 31, 2},
+        {1043, 10, 2}, {1054, 33, 2}, {1088, 53, 2}, {1142, 8, 2}, {1151, 25, 2}, {1177, 16, 2}, {1194, 79, 2}, {1274, 20, 2},
+        {1295, 30, 2}, {1326, 12, 2}, {1339, 14, 2}, {1354, 60, 2}, {1415, 43, 2}, {1459, 14, 2}, {1474, 39, 2}, {1514, 15, 2},
+        {1530, 45, 2}, {1576, 18, 2}, {1595, 60, 2}, {1656, 20, 2}, {1677, 16, 2}, {1694, 32, 2}, {1727, 14, 2}, {1742, 23, 2},
+        {1766, 37, 2}, {1804, 10, 2}, {1815, 52, 2}, {1868, 14, 2}, {1883, 8, 2}, {1892, 19, 2}, {1912, 21, 2}, {1934, 20, 2},
+        {1955, 56, 2}, {2012, 16, 2}, {2029, 10, 2}, {2040, 16, 2}, {2057, 14, 2}, {2072, 16, 2}, {2089, 41, 2}, {2131, 12, 2},
+        {2144, 35, 2}, {2180, 16, 2}, {2197, 14, 2}, {2212, 18, 2}, {2231, 33, 2}, {2265, 18, 2}, {2284, 33, 2}, {2318, 16, 2},
+        {2335, 26, 2}, {2362, 20, 2}, {2383, 10, 2}, {2394, 77, 2}, {2472, 46, 2}, {2519, 41, 2}, {2561, 19, 2}, {2581, 32, 2},
+        {2614, 12, 2}, {2627, 12, 2}, {2640, 76, 2}, {2717, 21, 2}, {2739, 8, 2}, {2748, 10, 2}, {2759, 12, 2}, {2772, 12, 2},
+        {2785, 10, 2}, {2796, 39, 2}, {2836, 14, 2}, {2851, 20, 2}, {2872, 26, 2}, {2899, 29, 2}, {2929, 18, 2}, {2948, 12, 2},
+        {2961, 10, 2}, {2972, 25, 2}, {2998, 29, 2}, {3028, 16, 2}, {3045, 14, 2}, {3060, 39, 2}, {3100, 18, 2}, {3119, 10, 2},
+        {3130, 14, 2}, {3145, 18, 2}, {3164, 12, 2}, {3177, 10, 2}, {3188, 14, 2}, {3203, 41, 2}, {3245, 14, 2}, {3260, 35, 2},
+        {3296, 14, 2}, {3311, 12, 2}, {3324, 14, 2}, {3339, 14, 2}, {3354, 23, 2}, {3378, 14, 2}, {3393, 10, 2}, {3404, 18, 2},
+        {3423, 20, 2}, {3444, 10, 2}, {3455, 14, 2}, {3470, 47, 2}, {3518, 16, 2}, {3535, 19, 2}, {3555, 38, 2}, {3594, 16, 2},
+        {3611, 8, 2}, {3620, 12, 2}, {3633, 10, 2}, {3644, 17, 2}, {3662, 12, 2}, {3675, 16, 2}, {3692, 23, 2}, {3716, 12, 2},
+        {3729, 35, 2}, {3765, 35, 2}, {3801, 56, 2}, {3858, 14, 2}, {3873, 22, 2}, {3896, 12, 2}, {3909, 16, 2}, {3926, 20, 2},
+        {3947, 14, 2}, {3962, 21, 2}, {3984, 16, 2}, {4001, 18, 2}, {4020, 8, 2}, {4029, 16, 2}, {4046, 14, 2}, {4061, 16, 2},
+        {4078, 10, 2}, {4089, 14, 2}, {4104, 12, 2}, {4117, 27, 2}, {4145, 18, 2}, {4164, 12, 2}, {4177, 22, 2}, {4200, 18, 2},
+        {4219, 10, 2}, {4230, 10, 2}, {4241, 14, 2}, {4256, 14, 2}, {4271, 16, 2}, {4288, 10, 2}, {4299, 14, 2}, {4314, 16, 2},
+        {4331, 16, 2}, {4348, 12, 2}, {4361, 8, 2}, {4370, 14, 2}, {4385, 8, 2}, {4394, 12, 2}, {4407, 45, 2}, {4453, 18, 2},
+        {4472, 28, 2}, {4501, 33, 2}, {4535, 34, 2}, {4570, 12, 2}, {4583, 14, 2}, {4598, 29, 2}, {4628, 14, 2}, {4643, 10, 2},
+        {4654, 27, 2}, {4682, 23, 2}, {4706, 18, 2}, {4725, 12, 2}, {4738, 8, 2}, {4747, 12, 2}, {4760, 20, 2}, {4781, 16, 2},
+        {4798, 16, 2}, {4815, 14, 2}, {4830, 18, 2}, {4849, 31, 2}, {4881, 16, 2}, {4898, 12, 2}, {4911, 16, 2}, {4928, 16, 2},
+        {4945, 8, 2}, {4954, 14, 2}, {4969, 20, 2}, {4990, 12, 2}, {5003, 36, 2}, {5040, 14, 2}, {5055, 24, 2}, {5080, 14, 2},
+        {5095, 14, 2}, {5110, 10, 2}, {5121, 14, 2}, {5136, 33, 2}, {5170, 10, 2}, {5181, 16, 2}, {5198, 20, 2}, {5219, 14, 2},
+        {5234, 21, 2}, {5256, 64, 2}, {5321, 12, 2}, {5334, 20, 2}, {5355, 12, 2}, {5368, 10, 2}, {5379, 12, 2}, {5392, 8, 2},
+        {5401, 12, 2}, {5414, 16, 2}, {5431, 16, 2}, {5448, 14, 2}, {5463, 18, 2}, {5482, 14, 2}, {5497, 16, 2}, {5514, 12, 2},
+        {5527, 20, 2}, {5548, 14, 2}, {5563, 14, 2}, {5578, 16, 2}, {5595, 23, 2}, {5619, 8, 2}, {5628, 12, 2}, {5641, 10, 2},
+        {5652, 6, 2}, {5659, 8, 2}, {5668, 16, 2}, {5685, 17, 2}, {5703, 10, 2}, {5714, 10, 2}, {5725, 18, 2}, {5744, 33, 2},
+        {5778, 16, 2}, {5795, 14, 2}, {5810, 28, 2}, {5839, 12, 2}, {5852, 16, 2}, {5869, 14, 2}, {5884, 23, 2}, {5908, 14, 2},
+        {5923, 12, 2}, {5936, 20, 2}, {5957, 12, 2}, {5970, 12, 2}, {5983, 21, 2}, {6005, 14, 2}, {6020, 14, 2}, {6035, 16, 2},
+        {6052, 30, 2}, {6083, 14, 2}, {6098, 19, 2}, {6118, 33, 2}, {6152, 16, 2}, {6169, 12, 2}, {6182, 44, 2}, {6227, 18, 2},
+        {6246, 14, 2}, {6261, 20, 2}, {6282, 12, 2}, {6295, 14, 2}, {6310, 16, 2}, {6327, 12, 2}, {6340, 16, 2}, {6357, 20, 2},
+        {6378, 33, 2}, {6412, 25, 2}, {6438, 10, 2}, {6449, 18, 2}, {6468, 18, 2}, {6487, 20, 2}, {6508, 36, 2}, {6545, 18, 2},
+        {6564, 48, 2}, {6613, 18, 2}, {6632, 8, 2}, {6641, 16, 2}, {6658, 16, 2}, {6675, 14, 2}, {6690, 14, 2}, {6705, 14, 2},
+        {6720, 12, 2}, {6733, 14, 2}, {6748, 14, 2}, {6763, 29, 2}, {6793, 10, 2}, {6804, 10, 2}, {6815, 22, 2}, {6838, 6, 2},
+        {6845, 12, 2}, {6858, 16, 2}, {6875, 27, 2}, {6903, 28, 2}, {6932, 22, 2}, {6955, 18, 2}, {6974, 18, 2}, {6993, 20, 2},
+        {7014, 12, 2}, {7027, 16, 2}, {7044, 33, 2}, {7078, 25, 2}, {7104, 18, 2}, {7123, 25, 2}, {7149, 20, 2}, {7170, 23, 2},
+        {7194, 20, 2}, {7215, 32, 2}, {7248, 54, 2}, {7303, 42, 2}, {7346, 37, 2}, {7384, 29, 2}, {7414, 16, 2}, {7431, 16, 2},
+        {7448, 35, 2}, {7484, 18, 2}, {7503, 33, 2}, {7537, 14, 2}, {7552, 14, 2}, {7567, 26, 2}, {7594, 27, 2}, {7622, 35, 2},
+        {7658, 14, 2}, {7673, 27, 2}, {7701, 20, 2}, {7722, 10, 2}, {7733, 10, 2}, {7744, 8, 2}, {7753, 12, 2}, {7766, 14, 2},
+        {7781, 16, 2}, {7798, 17, 2}, {7816, 10, 2}, {7827, 18, 2}, {7846, 31, 2}, {7878, 16, 2}, {7895, 8, 2}, {7904, 31, 2},
+        {7936, 8, 2}, {7945, 23, 2}, {7969, 19, 2}, {7989, 8, 2}, {7998, 16, 2}, {8015, 27, 2}, {8043, 19, 2}, {8063, 14, 2},
+        {8078, 22, 2}, {8101, 19, 2}, {8121, 21, 2}, {8143, 14, 2}, {8158, 22, 2}, {8181, 12, 2}, {8194, 16, 2}, {8211, 33, 2},
+        {8245, 27, 2}, {8273, 6, 2}, {8280, 14, 2}, {8295, 16, 2}, {8312, 16, 2}, {8329, 16, 2}, {8346, 10, 2}, {8357, 24, 2},
+        {8382, 18, 2}, {8401, 16, 2}, {8418, 14, 2}, {8433, 16, 2}, {8450, 33, 2}, {8484, 15, 2}, {8500, 10, 2}, {8511, 16, 2},
+        {8528, 12, 2}, {8541, 18, 2}, {8560, 14, 2}, {8575, 14, 2}, {8590, 16, 2}, {8607, 29, 2}, {8637, 18, 2}, {8656, 23, 2},
+        {8680, 16, 2}, {8697, 12, 2}, {8710, 12, 2}, {8723, 6, 2}, {8730, 18, 2}, {8749, 14, 2}, {8764, 16, 2}, {8781, 12, 2},
+        {8794, 16, 2}, {8811, 12, 2}, {8824, 14, 2}, {8839, 21, 2}, {8861, 14, 2}, {8876, 20, 2}, {8897, 10, 2}, {8908, 12, 2},
+        {8921, 37, 2}, {8959, 16, 2}, {8976, 14, 2}, {8991, 12, 2}, {9004, 20, 2}, {9025, 16, 2}, {9042, 24, 2}, {9067, 27, 2},
+        {9095, 29, 2}, {9125, 40, 2}, {9166, 8, 2}, {9175, 50, 2}, {9226, 14, 2}, {9241, 10, 2}, {9252, 18, 2}, {9271, 16, 2},
+        {9288, 6, 2}, {9295, 48, 2}, {9344, 14, 2}, {9359, 14, 2}, {9374, 12, 2}, {9387, 29, 2}, {9417, 45, 2}, {9463, 39, 2},
+        {9503, 33, 2}, {9537, 42, 2}, {9580, 60, 2}, {9641, 60, 2}, {9702, 39, 2}, {9742, 39, 2}, {9782, 35, 2}, {9818, 31, 2},
+        {9850, 33, 2}, {9884, 31, 2}, {9916, 39, 2}, {9956, 39, 2}, {9996, 29, 2}, {10026, 33, 2}, {10060, 35, 2}, {10096, 31, 2},
+        {10128, 37, 2}, {10166, 33, 2}, {10200, 39, 2}, {10240, 35, 2}, {10276, 35, 2}, {10312, 37, 2}, {10350, 37, 2}, {10388, 39, 2},
+        {10428, 33, 2}, {10462, 37, 2}, {10500, 37, 2}, {10538, 35, 2}, {10574, 37, 2}, {10612, 31, 2}, {10644, 41, 2}, {10686, 35, 2},
+        {10722, 41, 2}, {10764, 37, 2}, {10802, 35, 2}, {10838, 35, 2}, {10874, 48, 2}, {10923, 29, 2}, {10953, 41, 2}, {10995, 37, 2},
+        {11033, 41, 2}, {11075, 35, 2}, {11111, 33, 2}, {11145, 36, 2}, {11182, 39, 2}, {11222, 37, 2}, {11260, 25, 2}, {11286, 45, 2},
+        {11332, 41, 2}, {11374, 39, 2}, {11414, 33, 2}, {11448, 37, 2}, {11486, 27, 2}, {11514, 31, 2}, {11546, 39, 2}, {11586, 33, 2},
+        {11620, 35, 2}, {11656, 37, 2}, {11694, 35, 2}, {11730, 35, 2}, {11766, 33, 2}, {11800, 41, 2}, {11842, 29, 2}, {11872, 27, 2},
+        {11900, 35, 2}, {11936, 37, 2}, {11974, 31, 2}, {12006, 27, 2}, {12034, 33, 2}, {12068, 33, 2}, {12102, 37, 2}, {12140, 29, 2},
+        {12170, 29, 2}, {12200, 37, 2}, {12238, 29, 2}, {12268, 54, 2}, {12323, 31, 2}, {12355, 31, 2}, {12387, 29, 2}, {12417, 12, 2},
+        {12430, 12, 2}, {12443, 12, 2}, {12456, 12, 2}, {12469, 18, 2}, {12488, 10, 2}, {12499, 14, 2}, {12514, 27, 2}, {12542, 12, 2},
+        {12555, 14, 2}, {12570, 12, 2}, {12583, 14, 2}, {12598, 12, 2}, {12611, 12, 2}, {12624, 14, 2}, {12639, 12, 2}, {12652, 12, 2},
+        {12665, 12, 2}, {12678, 14, 2}, {12693, 14, 2}, {12708, 10, 2}, {12719, 14, 2}, {12734, 10, 2}, {12745, 12, 2}, {12758, 37, 2},
+        {12796, 20, 2}, {12817, 12, 2}, {12830, 31, 2}, {12862, 14, 2}, {12877, 14, 2}, {12892, 50, 2}, {12943, 10, 2}, {12954, 12, 2},
+        {12967, 12, 2}, {12980, 35, 2}, {13016, 10, 2}, {13027, 47, 2}, {13075, 33, 2}, {13109, 20, 2}, {13130, 26, 2}, {13157, 6, 2},
+        {13164, 10, 2},
+};
+
+static char TERRITORY_NAMES_UNPACKED_RU[13175];
+
+static const PackedTerritoryNames PACKED_TERRITORY_NAMES_RU = {
+        TERRITORY_NAMES_UNPACKED_RU, 13175, TERRITORY_NAMES_PACKED_RU, 3646, TERRITORY_NAMES_PAIRS_RU,
+        TERRITORY_NAME_ALTERNATIVES_START_RU, TERRITORY_NAME_ALTERNATIVES_RU};
+
+#else
+
+static const PackedTerritoryNames PACKED_TERRITORY_NAMES_RU = {NULL, 0, NULL, 0, NULL, NULL, NULL};
+
+#endif // MAPCODE_SUPPORT_LANGUAGE_RU
+
+#ifdef MAPCODE_SUPPORT_LANGUAGE_SV // Swedish
+
+// 6586 bytes, packed to 3416
+static const unsigned char TERRITORY_NAMES_PACKED_SV[3416] = {
+        86, 27, 38, 1, 4, 27, 220, 72, 37, 172, 9, 4, 43, 10, 77, 13, 234, 28, 71, 171, 212, 214, 93, 111,
+        107, 37, 166, 131, 111, 107, 174, 243, 75, 101, 37, 127, 32, 188, 33, 26, 187, 116, 45, 66, 252, 104, 195, 169,
+        108, 207, 121, 59, 97, 47, 117, 93, 117, 118, 11, 117, 123, 234, 166, 132, 7, 149, 77, 97, 252, 10, 187, 116,
+        45, 77, 252, 7, 59, 12, 102, 43, 107, 55, 80, 104, 137, 146, 32, 188, 33, 124, 80, 104, 137, 146, 32, 188,
+        49, 80, 191, 99, 97, 130, 110, 32, 188, 33, 26, 66, 111, 117, 118, 48, 34, 110, 178, 6, 109, 176, 159, 62,
+        116, 190, 116, 217, 208, 32, 105, 32, 73, 173, 190, 111, 99, 101, 1, 254, 139, 77, 5, 7, 28, 91, 152, 115,
+        101, 121, 177, 110, 236, 137, 108, 125, 13, 116, 115, 6, 22, 116, 180, 6, 115, 101, 121, 180, 241, 34, 110, 0,
+        87, 11, 108, 147, 55, 70, 96, 53, 63, 70, 96, 53, 159, 62, 116, 190, 74, 53, 103, 102, 213, 243, 66, 62,
+        116, 190, 74, 53, 103, 102, 213, 141, 76, 105, 101, 19, 116, 3, 4, 101, 7, 177, 213, 98, 125, 5, 52, 11,
+        108, 141, 65, 109, 221, 181, 83, 24, 111, 63, 83, 24, 111, 97, 44, 32, 24, 221, 1, 17, 0, 67, 111, 111,
+        107, 32, 141, 242, 80, 105, 6, 114, 101, 55, 77, 105, 113, 117, 37, 13, 124, 77, 105, 113, 117, 37, 13, 59,
+        105, 117, 31, 242, 75, 191, 116, 115, 55, 78, 101, 118, 147, 124, 78, 101, 118, 105, 26, 67, 129, 109, 1, 141,
+        66, 13, 97, 130, 101, 44, 32, 83, 149, 69, 192, 27, 117, 147, 55, 56, 98, 63, 56, 98, 63, 83, 149, 69,
+        192, 27, 105, 117, 26, 77, 11, 100, 105, 118, 197, 242, 72, 37, 3, 97, 44, 32, 65, 115, 99, 3, 115, 105,
+        13, 55, 84, 25, 250, 100, 222, 53, 104, 63, 65, 115, 99, 3, 115, 105, 13, 124, 84, 25, 250, 100, 222, 53,
+        104, 125, 11, 116, 2, 154, 249, 140, 109, 221, 181, 74, 53, 103, 102, 213, 141, 77, 129, 148, 116, 31, 83, 118,
+        11, 98, 251, 55, 74, 139, 77, 129, 220, 74, 139, 77, 129, 10, 242, 86, 7, 99, 160, 55, 154, 249, 7, 152,
+        63, 154, 249, 7, 197, 72, 101, 251, 45, 55, 77, 99, 100, 13, 11, 100, 243, 77, 99, 68, 13, 11, 100, 32,
+        54, 178, 5, 98, 40, 111, 26, 65, 110, 116, 172, 117, 253, 50, 66, 5, 98, 176, 63, 66, 5, 98, 176, 2,
+        67, 117, 22, 99, 97, 28, 83, 101, 121, 19, 37, 108, 197, 80, 11, 166, 59, 185, 109, 5, 105, 1, 197, 65,
+        173, 12, 114, 2, 91, 24, 0, 195, 150, 32, 168, 32, 109, 29, 242, 76, 117, 99, 46, 77, 38, 114, 13, 235,
+        190, 102, 206, 6, 27, 105, 13, 254, 127, 203, 12, 224, 128, 2, 68, 95, 7, 42, 159, 145, 22, 7, 131, 105,
+        25, 98, 27, 21, 84, 47, 107, 115, 45, 55, 67, 97, 42, 174, 243, 67, 97, 42, 174, 141, 56, 58, 84, 95,
+        195, 169, 55, 80, 114, 7, 99, 146, 101, 124, 80, 114, 7, 99, 146, 31, 72, 128, 32, 75, 128, 123, 252, 7,
+        105, 113, 117, 31, 70, 138, 114, 141, 91, 40, 37, 111, 117, 112, 31, 67, 95, 12, 111, 26, 77, 166, 62, 105,
+        117, 26, 195, 133, 116, 6, 102, 34, 114, 3, 127, 0, 76, 117, 120, 207, 98, 47, 103, 132, 24, 111, 184, 215,
+        103, 101, 12, 103, 105, 3, 55, 83, 215, 115, 18, 119, 237, 243, 83, 215, 115, 18, 119, 237, 141, 70, 114, 181,
+        80, 43, 121, 110, 235, 20, 67, 203, 32, 86, 6, 100, 224, 114, 7, 105, 100, 40, 55, 84, 111, 98, 144, 111,
+        124, 84, 111, 98, 144, 28, 66, 114, 53, 101, 21, 70, 114, 181, 115, 215, 108, 172, 253, 50, 1, 214, 107, 116,
+        190, 76, 18, 26, 80, 117, 6, 116, 58, 82, 42, 28, 67, 121, 112, 152, 0, 76, 171, 1, 13, 180, 24, 97,
+        42, 2, 71, 200, 46, 81, 27, 5, 218, 11, 107, 33, 115, 141, 86, 1, 117, 27, 117, 123, 13, 116, 101, 126,
+        126, 80, 79, 83, 61, 84, 82, 85, 78, 67, 178, 145, 24, 142, 195, 150, 4, 116, 209, 12, 132, 119, 97, 122,
+        105, 49, 75, 117, 119, 157, 116, 218, 105, 106, 21, 78, 121, 9, 75, 11, 206, 13, 20, 83, 108, 51, 3, 20,
+        188, 22, 37, 196, 11, 101, 4, 7, 60, 231, 105, 6, 0, 69, 108, 32, 83, 11, 118, 40, 12, 178, 37, 210,
+        31, 68, 106, 171, 240, 21, 77, 136, 206, 13, 20, 82, 119, 18, 2, 72, 157, 116, 21, 66, 47, 53, 100, 21,
+        69, 107, 118, 27, 12, 105, 11, 236, 7, 101, 140, 108, 98, 219, 83, 11, 95, 13, 141, 65, 114, 109, 3, 20,
+        76, 235, 148, 104, 28, 66, 37, 103, 20, 77, 43, 100, 168, 20, 71, 85, 73, 78, 69, 65, 45, 66, 73, 83,
+        83, 65, 85, 93, 157, 119, 29, 66, 104, 96, 29, 83, 19, 119, 101, 210, 59, 206, 6, 108, 138, 173, 197, 68,
+        1, 109, 5, 107, 0, 69, 4, 49, 68, 95, 7, 38, 181, 158, 83, 108, 51, 136, 20, 67, 111, 4, 9, 25,
+        99, 159, 174, 110, 105, 3, 55, 72, 6, 99, 101, 103, 51, 7, 183, 114, 111, 27, 20, 84, 111, 103, 28, 76,
+        48, 116, 49, 76, 191, 166, 254, 25, 32, 76, 1, 107, 2, 71, 101, 12, 103, 20, 73, 114, 49, 83, 105, 6,
+        175, 76, 101, 13, 223, 1, 24, 2, 84, 106, 101, 99, 107, 20, 70, 114, 181, 91, 121, 246, 70, 34, 114, 249,
+        204, 65, 22, 98, 207, 105, 22, 116, 10, 195, 150, 4, 6, 25, 107, 31, 65, 122, 6, 98, 157, 106, 29, 83,
+        6, 98, 20, 74, 185, 219, 80, 199, 117, 103, 11, 245, 110, 103, 152, 132, 215, 107, 12, 101, 2, 188, 49, 91,
+        27, 207, 11, 183, 117, 98, 159, 241, 103, 5, 20, 76, 171, 6, 46, 72, 13, 100, 117, 22, 26, 66, 3, 7,
+        0, 69, 62, 114, 101, 125, 11, 97, 119, 21, 78, 185, 107, 12, 101, 151, 42, 5, 144, 117, 2, 154, 101, 107,
+        49, 84, 40, 122, 106, 38, 239, 66, 64, 108, 40, 205, 59, 101, 112, 11, 93, 53, 147, 20, 83, 47, 7, 24,
+        31, 85, 213, 236, 129, 131, 200, 211, 106, 184, 121, 114, 20, 83, 3, 101, 103, 11, 131, 121, 114, 103, 121, 122,
+        161, 86, 191, 114, 121, 92, 49, 91, 121, 246, 76, 97, 111, 26, 82, 117, 109, 138, 110, 20, 71, 104, 246, 85,
+        103, 18, 184, 116, 12, 98, 62, 1, 110, 105, 220, 83, 107, 148, 116, 33, 124, 78, 185, 130, 33, 124, 73, 114,
+        33, 44, 225, 199, 104, 152, 0, 91, 7, 101, 2, 69, 99, 117, 40, 12, 0, 232, 4, 115, 145, 5, 63, 56,
+        104, 22, 119, 21, 71, 143, 13, 59, 121, 9, 90, 101, 101, 49, 66, 47, 107, 7, 9, 70, 165, 28, 70, 137,
+        146, 112, 7, 197, 73, 116, 11, 20, 79, 109, 29, 80, 43, 10, 69, 108, 102, 3, 98, 3, 17, 192, 10, 78,
+        12, 103, 31, 77, 11, 129, 115, 46, 86, 208, 110, 24, 218, 7, 49, 75, 128, 111, 45, 66, 22, 122, 122, 168,
+        137, 108, 224, 121, 17, 49, 74, 203, 29, 90, 209, 98, 143, 119, 223, 5, 144, 117, 129, 194, 22, 107, 123, 5,
+        111, 99, 107, 28, 85, 122, 98, 101, 107, 239, 83, 118, 6, 172, 223, 97, 36, 9, 78, 121, 9, 91, 7, 101,
+        183, 24, 6, 53, 93, 47, 107, 109, 3, 239, 83, 112, 219, 84, 104, 157, 49, 74, 207, 10, 70, 114, 1, 107,
+        25, 107, 31, 195, 133, 49, 75, 3, 121, 159, 148, 115, 119, 1, 125, 40, 144, 97, 17, 5, 245, 107, 22, 7,
+        184, 34, 100, 175, 83, 176, 29, 67, 160, 212, 97, 102, 25, 107, 181, 158, 83, 95, 11, 46, 65, 102, 103, 104,
+        1, 239, 77, 121, 1, 109, 5, 124, 66, 47, 109, 2, 90, 200, 46, 134, 137, 224, 47, 107, 208, 196, 136, 239,
+        77, 111, 195, 167, 200, 105, 113, 117, 31, 78, 24, 171, 46, 86, 3, 101, 122, 117, 37, 151, 172, 6, 46, 84,
+        1, 122, 1, 46, 69, 103, 121, 112, 116, 10, 77, 97, 47, 48, 219, 66, 43, 105, 118, 46, 69, 116, 105, 111,
+        112, 20, 229, 95, 98, 46, 83, 215, 97, 102, 25, 107, 125, 11, 21, 65, 110, 103, 43, 151, 172, 6, 93, 19,
+        40, 196, 6, 117, 123, 128, 43, 208, 194, 114, 29, 76, 171, 121, 254, 176, 29, 73, 173, 13, 235, 20, 70, 206,
+        6, 255, 68, 105, 4, 25, 99, 116, 93, 108, 97, 120, 99, 11, 125, 12, 37, 111, 26, 65, 236, 165, 99, 11,
+        105, 160, 101, 26, 229, 209, 2, 81, 117, 6, 48, 5, 28, 72, 105, 100, 11, 103, 28, 77, 101, 120, 42, 58,
+        83, 116, 27, 224, 143, 165, 99, 28, 78, 129, 5, 191, 0, 91, 1, 202, 117, 27, 28, 80, 117, 101, 8, 2,
+        89, 117, 99, 27, 29, 81, 117, 7, 116, 1, 9, 82, 111, 28, 83, 7, 11, 111, 2, 67, 24, 112, 101, 19,
+        31, 77, 237, 111, 234, 29, 83, 139, 76, 117, 147, 32, 80, 148, 174, 21, 91, 6, 114, 6, 28, 78, 117, 101,
+        118, 58, 76, 101, 13, 178, 202, 222, 11, 105, 102, 12, 110, 46, 86, 6, 2, 134, 105, 203, 142, 66, 202, 222,
+        11, 105, 102, 12, 110, 189, 83, 47, 0, 90, 234, 27, 101, 99, 142, 74, 11, 147, 99, 28, 84, 24, 166, 108,
+        146, 142, 79, 97, 120, 234, 2, 68, 47, 64, 28, 67, 111, 145, 117, 137, 184, 13, 12, 2, 134, 105, 104, 117,
+        145, 117, 2, 154, 34, 110, 49, 56, 176, 105, 5, 143, 20, 75, 128, 111, 45, 75, 7, 52, 165, 140, 108, 103,
+        6, 208, 131, 97, 122, 136, 161, 65, 114, 103, 160, 7, 2, 68, 24, 1, 55, 68, 105, 117, 0, 68, 40, 175,
+        18, 225, 144, 5, 32, 72, 168, 37, 21, 134, 18, 172, 5, 104, 177, 173, 24, 139, 18, 225, 42, 111, 98, 5,
+        0, 76, 136, 52, 40, 119, 101, 101, 112, 0, 68, 37, 104, 21, 77, 101, 103, 104, 11, 129, 151, 144, 11, 18,
+        123, 1, 105, 36, 114, 93, 25, 36, 114, 125, 210, 12, 24, 132, 38, 107, 209, 196, 53, 106, 143, 179, 5, 121,
+        1, 140, 114, 53, 97, 19, 255, 244, 177, 92, 24, 178, 105, 104, 5, 245, 116, 214, 136, 104, 18, 0, 71, 111,
+        183, 6, 11, 2, 84, 24, 137, 225, 40, 117, 179, 209, 97, 19, 255, 244, 180, 24, 109, 117, 55, 75, 233, 109,
+        130, 0, 134, 104, 27, 116, 147, 103, 5, 104, 180, 104, 5, 107, 104, 18, 131, 5, 110, 27, 136, 97, 10, 82,
+        202, 14, 104, 29, 79, 100, 105, 52, 63, 79, 25, 92, 2, 91, 106, 5, 27, 0, 232, 4, 98, 3, 103, 11,
+        10, 77, 40, 104, 121, 9, 244, 93, 37, 64, 1, 140, 173, 104, 175, 244, 123, 145, 5, 233, 116, 114, 2, 85,
+        116, 214, 32, 244, 196, 176, 117, 19, 6, 114, 121, 59, 216, 83, 240, 104, 32, 87, 11, 101, 26, 65, 192, 212,
+        105, 139, 67, 203, 191, 255, 231, 121, 180, 6, 118, 147, 32, 66, 129, 32, 231, 121, 59, 199, 104, 152, 32, 231,
+        121, 132, 240, 104, 32, 65, 192, 212, 46, 84, 165, 109, 219, 86, 42, 116, 12, 46, 232, 4, 175, 65, 192, 212,
+        20, 81, 117, 101, 3, 115, 49, 68, 105, 4, 62, 58, 70, 206, 6, 11, 132, 6, 103, 146, 31, 228, 144, 111,
+        142, 82, 105, 58, 100, 204, 74, 1, 101, 130, 28, 69, 115, 112, 105, 62, 58, 83, 248, 28, 82, 105, 58, 154,
+        18, 204, 100, 58, 78, 199, 223, 5, 157, 98, 184, 248, 222, 27, 5, 7, 2, 80, 152, 200, 117, 99, 28, 65,
+        109, 203, 2, 67, 101, 5, 140, 99, 114, 223, 5, 246, 82, 12, 157, 109, 2, 82, 13, 100, 13, 46, 56, 58,
+        80, 166, 108, 28, 80, 105, 166, 21, 84, 111, 99, 248, 7, 26, 82, 105, 58, 154, 18, 204, 100, 58, 83, 241,
+        123, 5, 1, 104, 97, 28, 71, 111, 105, 142, 77, 27, 58, 154, 111, 92, 58, 100, 58, 83, 241, 178, 145, 46,
+        77, 7, 165, 32, 71, 6, 157, 26, 77, 27, 58, 154, 111, 92, 28, 80, 5, 140, 109, 97, 122, 13, 142, 68,
+        105, 4, 25, 99, 116, 35, 102, 32, 229, 117, 109, 98, 46, 82, 104, 211, 204, 188, 49, 68, 37, 97, 119, 5,
+        31, 67, 13, 110, 101, 99, 116, 42, 96, 59, 216, 74, 6, 115, 101, 121, 59, 216, 72, 24, 112, 52, 130, 31,
+        86, 6, 109, 13, 116, 123, 97, 92, 97, 19, 117, 115, 48, 116, 26, 72, 97, 119, 157, 21, 77, 5, 121, 49,
+        232, 4, 175, 86, 130, 103, 7, 105, 63, 87, 101, 4, 32, 86, 130, 103, 7, 46, 83, 240, 104, 32, 67, 5,
+        43, 7, 125, 97, 7, 31, 73, 173, 105, 1, 183, 160, 117, 99, 107, 121, 93, 3, 110, 101, 92, 101, 31, 86,
+        130, 103, 7, 46, 79, 104, 105, 28, 80, 3, 110, 115, 121, 108, 118, 1, 189, 115, 121, 108, 118, 1, 105, 97,
+        126, 126, 80, 79, 83, 61, 72, 69, 65, 68, 67, 79, 77, 80, 123, 105, 92, 105, 92, 146, 112, 21, 76, 111,
+        117, 147, 105, 1, 140, 108, 143, 24, 140, 114, 107, 247, 142, 78, 12, 175, 67, 5, 43, 7, 151, 216, 89, 12,
+        107, 194, 111, 119, 2, 73, 108, 108, 7, 111, 105, 26, 71, 101, 12, 103, 20, 87, 147, 99, 13, 115, 7, 218,
+        108, 12, 105, 100, 125, 105, 92, 111, 47, 21, 79, 107, 108, 145, 95, 151, 12, 175, 68, 136, 148, 2, 87, 233,
+        127, 116, 13, 132, 240, 104, 32, 68, 136, 148, 151, 101, 98, 22, 17, 183, 247, 142, 73, 100, 145, 28, 85, 116,
+        145, 123, 7, 110, 235, 148, 125, 237, 172, 29, 87, 121, 95, 127, 0, 79, 114, 101, 103, 13, 0, 229, 12, 40,
+        28, 78, 101, 118, 40, 140, 25, 122, 13, 151, 216, 77, 101, 120, 42, 28, 77, 13, 116, 1, 183, 11, 105, 102,
+        12, 110, 20, 84, 101, 120, 142, 228, 97, 17, 159, 62, 105, 52, 32, 229, 117, 109, 98, 46, 228, 98, 6, 116,
+        2, 79, 110, 214, 105, 28, 81, 117, 101, 98, 101, 99, 0, 56, 17, 27, 19, 170, 29, 77, 1, 191, 111, 98,
+        151, 170, 102, 111, 53, 100, 49, 78, 216, 66, 114, 53, 115, 119, 42, 107, 59, 51, 9, 83, 99, 148, 46, 80,
+        114, 7, 115, 32, 69, 100, 119, 251, 32, 34, 0, 89, 117, 107, 13, 59, 199, 104, 119, 101, 4, 32, 231, 105,
+        101, 26, 78, 53, 168, 96, 194, 173, 20, 65, 192, 212, 20, 66, 22, 115, 137, 20, 85, 83, 65, 124, 65, 109,
+        221, 165, 32, 102, 34, 114, 160, 9, 4, 27, 6, 124, 65, 109, 221, 125, 101, 120, 42, 28, 77, 111, 17, 118,
+        184, 1, 107, 149, 80, 48, 6, 115, 98, 47, 103, 131, 11, 7, 127, 162, 194, 110, 236, 52, 48, 189, 158, 65,
+        100, 121, 103, 101, 9, 156, 59, 185, 111, 92, 48, 105, 3, 32, 158, 75, 143, 251, 7, 111, 45, 66, 11, 107,
+        5, 226, 131, 5, 97, 19, 129, 45, 134, 6, 107, 101, 92, 226, 93, 106, 48, 106, 3, 20, 134, 117, 118, 233,
+        226, 194, 118, 1, 51, 111, 30, 76, 146, 48, 186, 79, 114, 121, 43, 30, 84, 241, 159, 37, 103, 12, 211, 163,
+        86, 108, 40, 209, 130, 30, 75, 47, 186, 75, 11, 117, 103, 253, 16, 84, 200, 51, 163, 66, 114, 106, 1, 17,
+        163, 89, 5, 174, 108, 168, 108, 30, 82, 121, 97, 122, 1, 30, 65, 4, 22, 19, 1, 163, 77, 174, 99, 111,
+        119, 30, 83, 109, 43, 3, 17, 163, 68, 144, 101, 250, 158, 86, 12, 13, 101, 122, 106, 163, 78, 51, 103, 12,
+        211, 30, 80, 17, 51, 30, 75, 111, 4, 114, 95, 9, 23, 83, 116, 168, 114, 111, 112, 43, 201, 155, 115, 110,
+        211, 5, 201, 75, 11, 109, 121, 107, 105, 5, 135, 84, 118, 6, 30, 76, 3, 127, 162, 30, 82, 111, 4, 51,
+        30, 86, 43, 103, 111, 103, 162, 30, 86, 43, 111, 103, 100, 253, 16, 77, 47, 109, 1, 17, 131, 5, 37, 189,
+        158, 78, 160, 115, 20, 75, 95, 105, 226, 177, 114, 107, 104, 64, 37, 17, 123, 185, 51, 189, 156, 59, 210, 104,
+        110, 121, 225, 51, 103, 12, 211, 30, 80, 3, 122, 9, 23, 75, 130, 51, 30, 77, 5, 105, 32, 69, 108, 226,
+        0, 79, 114, 3, 30, 85, 108, 106, 1, 51, 17, 163, 80, 6, 109, 201, 66, 233, 107, 199, 111, 250, 156, 245,
+        100, 109, 47, 149, 156, 93, 27, 5, 161, 83, 24, 5, 9, 23, 83, 5, 27, 51, 30, 89, 24, 11, 111, 45,
+        78, 3, 48, 26, 75, 104, 248, 121, 45, 77, 247, 21, 83, 118, 6, 100, 108, 51, 186, 84, 121, 117, 109, 3,
+        30, 75, 47, 103, 1, 30, 84, 106, 37, 106, 143, 7, 17, 0, 82, 94, 3, 32, 66, 47, 106, 27, 20, 90,
+        143, 129, 107, 11, 17, 121, 201, 73, 114, 107, 96, 186, 78, 51, 174, 171, 130, 186, 84, 95, 186, 79, 109, 186,
+        134, 136, 97, 92, 105, 3, 32, 82, 135, 75, 207, 6, 51, 111, 163, 228, 116, 202, 158, 228, 116, 202, 32, 107,
+        22, 106, 93, 117, 118, 9, 158, 155, 115, 110, 111, 121, 5, 17, 201, 77, 144, 40, 1, 30, 134, 117, 107, 148,
+        107, 9, 79, 107, 213, 103, 131, 24, 19, 27, 107, 9, 193, 56, 107, 104, 11, 7, 30, 80, 25, 109, 12, 17,
+        121, 201, 74, 176, 190, 97, 96, 13, 95, 9, 108, 138, 110, 48, 0, 134, 143, 5, 51, 17, 177, 109, 47, 30,
+        56, 19, 9, 82, 94, 220, 89, 136, 96, 189, 158, 75, 1, 40, 2, 82, 121, 92, 49, 83, 104, 64, 104, 97,
+        21, 84, 105, 1, 106, 7, 196, 101, 107, 127, 179, 97, 7, 29, 78, 127, 120, 189, 72, 117, 21, 134, 128, 113,
+        127, 0, 90, 104, 101, 106, 238, 180, 238, 115, 117, 218, 117, 106, 105, 29, 65, 110, 104, 117, 21, 76, 105, 97,
+        13, 127, 132, 104, 18, 128, 132, 104, 1, 120, 21, 74, 238, 120, 21, 72, 3, 29, 91, 210, 104, 111, 117, 0,
+        91, 64, 100, 128, 179, 117, 98, 101, 21, 74, 137, 7, 179, 101, 98, 101, 21, 83, 104, 97, 1, 120, 21, 78,
+        101, 105, 32, 77, 128, 43, 124, 73, 110, 114, 204, 77, 128, 43, 208, 179, 101, 137, 128, 106, 238, 179, 53, 29,
+        91, 64, 120, 105, 32, 90, 104, 117, 64, 132, 237, 117, 29, 89, 53, 110, 29, 88, 210, 64, 124, 84, 171, 48,
+        0, 71, 247, 117, 0, 81, 127, 104, 97, 21, 88, 7, 106, 238, 32, 85, 121, 103, 104, 47, 131, 7, 2, 70,
+        34, 114, 160, 9, 4, 27, 152, 165, 32, 168, 108, 138, 103, 115, 48, 32, 98, 37, 138, 103, 110, 9, 54, 0,
+        67, 108, 146, 112, 6, 116, 13, 177, 110, 214, 107, 116, 105, 26, 73, 110, 116, 152, 27, 105, 13, 37, 108, 124,
+        232, 114, 108, 100, 220, 74, 185, 10,
+};
+
+static const unsigned char TERRITORY_NAMES_PAIRS_SV[256][2] = {
+        {0, 0}, {97, 110}, {97, 0}, {101, 110}, {115, 116}, {97, 114}, {101, 114}, {105, 110}, {98, 108}, {97, 32}, {3, 0}, {97, 108},
+        {111, 114}, {111, 110}, {97, 4}, {8, 14}, {15, 0}, {115, 107}, {1, 100}, {99, 104}, {105, 10}, {105, 0}, {114, 97}, {79, 16},
+        {97, 109}, {114, 105}, {115, 0}, {97, 116}, {111, 0}, {1, 0}, {32, 23}, {101, 0}, {32, 32}, {108, 18}, {195, 182}, {32, 111},
+        {112, 117}, {101, 108}, {105, 107}, {36, 8}, {97, 100}, {101, 39}, {105, 99}, {111, 108}, {44, 44}, {45, 45}, {105, 2}, {117, 114},
+        {101, 116}, {33, 0}, {19, 32}, {111, 118}, {115, 104}, {117, 110}, {34, 5}, {35, 50}, {83, 97}, {110, 2}, {111, 32}, {0, 78},
+        {17, 9}, {61, 61}, {25, 116}, {97, 124}, {1, 103}, {65, 65}, {66, 66}, {67, 67}, {68, 68}, {69, 69}, {70, 70}, {71, 71},
+        {72, 72}, {73, 73}, {74, 74}, {75, 75}, {76, 76}, {77, 77}, {78, 78}, {79, 79}, {80, 80}, {81, 81}, {82, 82}, {83, 83},
+        {84, 84}, {85, 85}, {86, 86}, {87, 87}, {88, 88}, {89, 89}, {90, 90}, {71, 117}, {115, 115}, {0, 84}, {41, 38}, {111, 109},
+        {117, 116}, {97, 97}, {98, 98}, {99, 99}, {100, 100}, {101, 101}, {102, 102}, {103, 103}, {104, 104}, {105, 105}, {106, 106}, {107, 107},
+        {108, 108}, {109, 109}, {110, 110}, {111, 111}, {112, 112}, {113, 113}, {114, 114}, {115, 115}, {116, 116}, {117, 117}, {118, 118}, {119, 119},
+        {120, 120}, {121, 121}, {122, 122}, {0, 77}, {124, 124}, {2, 77}, {126, 126}, {7, 103}, {13, 103}, {97, 121}, {105, 114}, {0, 75},
+        {0, 83}, {133, 133}, {67, 104}, {94, 10}, {97, 107}, {105, 108}, {195, 164}, {1, 32}, {2, 65}, {54, 57}, {97, 26}, {97, 98},
+        {97, 103}, {97, 104}, {105, 112}, {105, 115}, {111, 116}, {116, 32}, {150, 150}, {2, 78}, {6, 110}, {41, 42}, {71, 114}, {75, 22},
+        {82, 153}, {97, 105}, {114, 135}, {2, 66}, {3, 116}, {4, 29}, {22, 100}, {35, 16}, {164, 164}, {97, 115}, {97, 117}, {167, 167},
+        {97, 118}, {169, 169}, {101, 119}, {105, 98}, {105, 103}, {110, 100}, {111, 115}, {114, 9}, {117, 100}, {0, 65}, {0, 66}, {0, 72},
+        {0, 74}, {1, 60}, {182, 182}, {2, 75}, {2, 83}, {12, 100}, {17, 30}, {56, 7}, {73, 115}, {105, 9}, {105, 60}, {105, 116},
+        {117, 4}, {155, 21}, {0, 73}, {195, 195}, {0, 80}, {6, 57}, {6, 62}, {12, 116}, {24, 98}, {32, 193}, {97, 106}, {97, 112},
+        {101, 32}, {101, 52}, {101, 100}, {101, 109}, {105, 48}, {105, 109}, {105, 122}, {111, 100}, {114, 11}, {114, 117}, {116, 5}, {121, 100},
+        {170, 32}, {198, 12}, {0, 70}, {1, 20}, {3, 124}, {6, 38}, {9, 67}, {31, 80}, {31, 84}, {32, 78}, {32, 156}, {54, 110},
+        {65, 108}, {67, 43}, {80, 162}, {84, 217}, {86, 138}, {97, 52}, {97, 99}, {101, 115}, {103, 117}, {105, 19}, {105, 64}, {105, 161},
+        {111, 96}, {117, 108}, {187, 149}, {227, 63}, {230, 205}, {0, 85}, {1, 2}, {1, 115}, {1, 116}, {3, 40}, {4, 139}, {5, 100},
+        {5, 116}, {9, 111}, {10, 83}, {11, 32},
+};
+
+static const unsigned short TERRITORY_NAME_ALTERNATIVES_START_SV[_TERRITORY_MAX - _TERRITORY_MIN] = {
+        0, 2, 3, 4, 5, 7, 8, 9, 10, 11, 12, 13, 15, 16, 17, 18,
+        19, 20, 21, 22, 23, 24, 25, 27, 29, 30, 31, 32, 34, 35, 37, 38,
+        40, 41, 44, 45, 48, 49, 50, 51, 52, 54, 56, 58, 59, 61, 62, 63,
+        64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 77, 79, 80, 81,
+        82, 83, 84, 85, 86, 87, 88, 90, 91, 92, 94, 95, 96, 97, 98, 99,
+        100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115,
+        116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131,
+        132, 133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143, 144, 145, 146, 147,
+        148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159, 160, 161, 162, 163,
+        164, 165, 166, 167, 168, 169, 170, 171, 172, 173, 174, 175, 176, 177, 178, 179,
+        180, 181, 182, 183, 184, 185, 186, 190, 191, 192, 194, 195, 196, 197, 198, 199,
+        200, 201, 202, 203, 204, 205, 206, 207, 208, 209, 210, 211, 212, 213, 214, 215,
+        216, 217, 218, 219, 220, 221, 222, 223, 224, 225, 226, 227, 228, 229, 230, 231,
+        233, 234, 235, 236, 237, 238, 239, 240, 241, 242, 243, 244, 245, 246, 247, 248,
+        249, 250, 251, 252, 253, 254, 255, 256, 257, 258, 259, 260, 261, 262, 263, 264,
+        265, 266, 267, 268, 269, 270, 271, 272, 273, 274, 275, 276, 277, 278, 279, 280,
+        281, 282, 283, 284, 285, 286, 287, 288, 289, 290, 291, 292, 293, 294, 295, 296,
+        297, 298, 299, 300, 301, 302, 303, 304, 305, 306, 307, 308, 309, 310, 311, 312,
+        313, 314, 315, 316, 317, 318, 319, 320, 321, 322, 323, 325, 326, 327, 328, 329,
+        330, 331, 332, 333, 334, 335, 336, 337, 338, 339, 340, 341, 342, 343, 344, 345,
+        346, 347, 348, 349, 350, 351, 352, 353, 354, 355, 356, 357, 358, 359, 360, 361,
+        362, 363, 364, 365, 366, 367, 368, 369, 370, 371, 372, 373, 374, 375, 376, 377,
+        378, 379, 381, 382, 383, 384, 385, 386, 387, 388, 389, 390, 391, 392, 393, 394,
+        395, 396, 397, 398, 399, 400, 401, 402, 403, 404, 405, 406, 407, 408, 409, 410,
+        411, 412, 413, 414, 415, 416, 417, 418, 419, 420, 421, 422, 423, 424, 425, 426,
+        427, 428, 429, 430, 431, 432, 433, 434, 435, 436, 437, 440, 441, 442, 443, 444,
+        445, 446, 447, 448, 449, 450, 451, 452, 453, 454, 455, 456, 457, 458, 459, 460,
+        461, 462, 463, 464, 465, 466, 467, 468, 469, 470, 471, 472, 473, 474, 475, 476,
+        477, 478, 479, 480, 481, 482, 483, 484, 485, 486, 487, 488, 489, 490, 491, 492,
+        493, 494, 495, 496, 497, 498, 499, 500, 501, 502, 503, 504, 505, 506, 507, 508,
+        509, 510, 511, 512, 513, 514, 515, 516, 517, 518, 519, 520, 521, 522, 523, 525,
+        526, 527, 528, 529, 530, 531, 532, 533, 534, 535, 536, 537, 538, 539, 540, 541,
+        542, 543, 544, 545, 546, 547, 548, 550, 551, 552, 553, 554, 555, 557, 558, 559,
+        560, 561, 562, 563, 564, 567,
+};
+
+static const TerritoryNameAlternative TERRITORY_NAME_ALTERNATIVES_SV[567] = {
+        {0, 13, 0}, {14, 13, 0}, {28, 6, 0}, {35, 9, 0}, {45, 7, 0}, {53, 11, 0}, {65, 15, 0}, {81, 17, 0},
+        {99, 5, 0}, {105, 6, 0}, {112, 5, 0}, {118, 12, 0}, {131, 12, 0}, {144, 25, 0}, {170, 13, 0}, {184, 16, 0},
+        {201, 9, 0}, {211, 7, 0}, {219, 39, 0}, {259, 10, 0}, {270, 8, 0}, {279, 8, 0}, {288, 10, 0}, {299, 6, 0},
+        {306, 6, 0}, {313, 17, 0}, {331, 6, 0}, {338, 23, 0}, {362, 23, 0}, {386, 13, 0}, {400, 5, 0}, {406, 14, 0},
+        {421, 17, 0}, {439, 17, 0}, {457, 11, 0}, {469, 25, 0}, {495, 8, 0}, {504, 4, 0}, {509, 21, 0}, {531, 5, 0},
+        {537, 12, 0}, {550, 30, 0}, {581, 4, 0}, {586, 12, 0}, {599, 10, 0}, {610, 44, 0}, {655, 9, 0}, {665, 16, 0},
+        {682, 5, 0}, {688, 7, 0}, {696, 25, 0}, {722, 7, 0}, {730, 22, 0}, {753, 9, 0}, {763, 30, 0}, {794, 12, 0},
+        {807, 25, 0}, {833, 13, 0}, {847, 8, 0}, {856, 19, 0}, {876, 7, 0}, {884, 7, 0}, {892, 12, 0}, {905, 5, 0},
+        {911, 14, 0}, {926, 7, 0}, {934, 4, 0}, {939, 9, 0}, {949, 11, 0}, {961, 25, 0}, {987, 9, 0}, {997, 5, 0},
+        {1003, 8, 0}, {1012, 7, 0}, {1020, 8, 0}, {1029, 23, 0}, {1053, 12, 0}, {1066, 22, 0}, {1089, 8, 0}, {1098, 9, 0},
+        {1108, 10, 0}, {1119, 10, 0}, {1130, 10, 0}, {1141, 7, 0}, {1149, 9, 0}, {1159, 14, 0}, {1174, 9, 0}, {1184, 5, 0},
+        {1190, 33, 0}, {1224, 17, 0}, {1242, 18, 0}, {1261, 9, 0}, {1271, 19, 0}, {1291, 6, 0}, {1298, 6, 0}, {1305, 37, 0},
+        {1343, 11, 0}, {1355, 6, 0}, {1362, 7, 0}, {1370, 7, 0}, {1378, 6, 0}, {1385, 5, 0}, {1391, 15, 0}, {1407, 7, 0},
+        {1415, 16, 0}, {1432, 7, 0}, {1440, 9, 0}, {1450, 9, 0}, {1460, 6, 0}, {1467, 4, 0}, {1472, 14, 0}, {1487, 9, 0},
+        {1497, 6, 0}, {1504, 23, 0}, {1528, 11, 0}, {1540, 6, 0}, {1547, 8, 0}, {1556, 10, 0}, {1567, 6, 0}, {1574, 5, 0},
+        {1580, 7, 0}, {1588, 16, 0}, {1605, 8, 0}, {1614, 13, 0}, {1628, 8, 0}, {1637, 7, 0}, {1645, 7, 0}, {1653, 9, 0},
+        {1663, 13, 0}, {1677, 6, 0}, {1684, 6, 0}, {1691, 7, 0}, {1699, 14, 0}, {1714, 7, 0}, {1722, 7, 0}, {1730, 23, 0},
+        {1754, 9, 0}, {1764, 10, 0}, {1775, 23, 0}, {1799, 8, 0}, {1808, 4, 0}, {1813, 8, 0}, {1822, 7, 0}, {1830, 9, 0},
+        {1840, 8, 0}, {1849, 6, 0}, {1856, 12, 0}, {1869, 6, 0}, {1876, 8, 0}, {1885, 14, 0}, {1900, 22, 0}, {1923, 10, 0},
+        {1934, 10, 0}, {1945, 7, 0}, {1953, 9, 0}, {1963, 8, 0}, {1972, 6, 0}, {1979, 8, 0}, {1988, 6, 0}, {1995, 9, 0},
+        {2005, 4, 0}, {2010, 9, 0}, {2020, 7, 0}, {2028, 8, 0}, {2037, 5, 0}, {2043, 7, 0}, {2051, 6, 0}, {2058, 9, 0},
+        {2068, 9, 0}, {2078, 8, 0}, {2087, 12, 0}, {2100, 10, 0}, {2111, 5, 0}, {2117, 8, 0}, {2126, 8, 0}, {2135, 7, 0},
+        {2143, 8, 0}, {2152, 6, 0}, {2159, 7, 0}, {2167, 10, 0}, {2178, 11, 0}, {2190, 6, 0}, {2197, 4, 0}, {2202, 9, 0},
+        {2212, 5, 0}, {2218, 6, 0}, {2225, 14, 0}, {2240, 9, 0}, {2250, 10, 0}, {2261, 16, 0}, {2278, 6, 0}, {2285, 7, 0},
+        {2293, 11, 0}, {2305, 7, 0}, {2313, 5, 0}, {2319, 11, 0}, {2331, 12, 0}, {2344, 12, 0}, {2357, 7, 0}, {2365, 4, 0},
+        {2370, 5, 0}, {2376, 15, 0}, {2392, 5, 0}, {2398, 8, 0}, {2407, 7, 0}, {2415, 7, 0}, {2423, 17, 0}, {2441, 8, 0},
+        {2450, 5, 0}, {2456, 8, 0}, {2465, 8, 0}, {2474, 4, 0}, {2479, 7, 0}, {2487, 10, 0}, {2498, 7, 0}, {2506, 16, 0},
+        {2523, 7, 0}, {2531, 12, 0}, {2544, 7, 0}, {2552, 8, 0}, {2561, 5, 0}, {2567, 9, 0}, {2577, 6, 0}, {2584, 5, 0},
+        {2590, 8, 0}, {2599, 10, 0}, {2610, 7, 0}, {2618, 12, 0}, {2631, 28, 0}, {2660, 7, 0}, {2668, 11, 0}, {2680, 7, 0},
+        {2688, 5, 0}, {2694, 6, 0}, {2701, 5, 0}, {2707, 7, 0}, {2715, 8, 0}, {2724, 11, 0}, {2736, 7, 0}, {2744, 9, 0},
+        {2754, 7, 0}, {2762, 8, 0}, {2771, 7, 0}, {2779, 11, 0}, {2791, 7, 0}, {2799, 8, 0}, {2808, 8, 0}, {2817, 9, 0},
+        {2827, 4, 0}, {2832, 6, 0}, {2839, 5, 0}, {2845, 5, 0}, {2851, 4, 0}, {2856, 9, 0}, {2866, 4, 0}, {2871, 6, 0},
+        {2878, 5, 0}, {2884, 10, 0}, {2895, 16, 0}, {2912, 8, 0}, {2921, 7, 0}, {2929, 14, 0}, {2944, 6, 0}, {2951, 9, 0},
+        {2961, 7, 0}, {2969, 12, 0}, {2982, 7, 0}, {2990, 7, 0}, {2998, 10, 0}, {3009, 6, 0}, {3016, 7, 0}, {3024, 12, 0},
+        {3037, 7, 0}, {3045, 8, 0}, {3054, 9, 0}, {3064, 15, 0}, {3080, 8, 0}, {3089, 10, 0}, {3100, 15, 0}, {3116, 4, 0},
+        {3121, 7, 0}, {3129, 19, 0}, {3149, 9, 0}, {3159, 7, 0}, {3167, 10, 0}, {3178, 6, 0}, {3185, 7, 0}, {3193, 8, 0},
+        {3202, 6, 0}, {3209, 9, 0}, {3219, 9, 0}, {3229, 12, 0}, {3242, 14, 0}, {3257, 8, 0}, {3266, 9, 0}, {3276, 9, 0},
+        {3286, 13, 0}, {3300, 22, 0}, {3323, 10, 0}, {3334, 19, 0}, {3354, 11, 0}, {3366, 5, 0}, {3372, 9, 0}, {3382, 8, 0},
+        {3391, 7, 0}, {3399, 7, 0}, {3407, 7, 0}, {3415, 6, 0}, {3422, 6, 0}, {3429, 7, 0}, {3437, 17, 0}, {3455, 5, 0},
+        {3461, 5, 0}, {3467, 11, 0}, {3479, 3, 0}, {3483, 6, 0}, {3490, 10, 0}, {3501, 16, 0}, {3518, 17, 0}, {3536, 12, 0},
+        {3549, 9, 0}, {3559, 11, 0}, {3571, 9, 0}, {3581, 6, 0}, {3588, 6, 0}, {3595, 7, 0}, {3603, 13, 0}, {3617, 14, 0},
+        {3632, 9, 0}, {3642, 14, 0}, {3657, 11, 0}, {3669, 13, 0}, {3683, 10, 0}, {3694, 15, 0}, {3710, 28, 0}, {3739, 20, 0},
+        {3760, 18, 0}, {3779, 15, 0}, {3795, 9, 0}, {3805, 8, 0}, {3814, 18, 0}, {3833, 10, 0}, {3844, 16, 0}, {3861, 7, 0},
+        {3869, 7, 0}, {3877, 14, 0}, {3892, 14, 0}, {3907, 19, 0}, {3927, 7, 0}, {3935, 14, 0}, {3950, 10, 0}, {3961, 5, 0},
+        {3967, 5, 0}, {3973, 4, 0}, {3978, 6, 0}, {3985, 7, 0}, {3993, 8, 0}, {4002, 9, 0}, {4012, 5, 0}, {4018, 9, 0},
+        {4028, 17, 0}, {4046, 8, 0}, {4055, 5, 0}, {4061, 18, 0}, {4080, 5, 0}, {4086, 12, 0}, {4099, 11, 0}, {4111, 4, 0},
+        {4116, 8, 0}, {4125, 20, 0}, {4146, 12, 0}, {4159, 8, 0}, {4168, 11, 0}, {4180, 10, 0}, {4191, 13, 0}, {4205, 7, 0},
+        {4213, 13, 0}, {4227, 6, 0}, {4234, 8, 0}, {4243, 16, 0}, {4260, 13, 0}, {4274, 14, 0}, {4289, 5, 0}, {4295, 7, 0},
+        {4303, 8, 0}, {4312, 9, 0}, {4322, 8, 0}, {4331, 4, 0}, {4336, 35, 0}, {4372, 11, 0}, {4384, 9, 0}, {4394, 7, 0},
+        {4402, 8, 0}, {4411, 14, 0}, {4426, 8, 0}, {4435, 4, 0}, {4440, 8, 0}, {4449, 8, 0}, {4458, 9, 0}, {4468, 7, 0},
+        {4476, 8, 0}, {4485, 8, 0}, {4494, 12, 0}, {4507, 10, 0}, {4518, 12, 0}, {4531, 8, 0}, {4540, 6, 0}, {4547, 5, 0},
+        {4553, 4, 0}, {4558, 9, 0}, {4568, 8, 0}, {4577, 7, 0}, {4585, 6, 0}, {4592, 8, 0}, {4601, 6, 0}, {4608, 7, 0},
+        {4616, 10, 0}, {4627, 7, 0}, {4635, 11, 0}, {4647, 5, 0}, {4653, 6, 0}, {4660, 16, 0}, {4677, 7, 0}, {4685, 7, 0},
+        {4693, 6, 0}, {4700, 12, 0}, {4713, 8, 0}, {4722, 12, 0}, {4735, 13, 0}, {4749, 11, 0}, {4761, 15, 0}, {4777, 5, 0},
+        {4783, 21, 0}, {4805, 7, 0}, {4813, 6, 0}, {4820, 10, 0}, {4831, 9, 0}, {4841, 3, 0}, {4845, 24, 0}, {4870, 7, 0},
+        {4878, 6, 0}, {4885, 6, 0}, {4892, 16, 0}, {4909, 11, 0}, {4921, 21, 0}, {4943, 15, 0}, {4959, 23, 0}, {4983, 25, 0},
+        {5009, 26, 0}, {5036, 10, 0}, {5047, 16, 0}, {5064, 14, 0}, {5079, 14, 0}, {5094, 12, 0}, {5107, 4, 0}, {5112, 15, 0},
+        {5128, 15, 0}, {5144, 12, 0}, {5157, 13, 0}, {5171, 13, 0}, {5185, 14, 0}, {5200, 16, 0}, {5217, 13, 0}, {5231, 16, 0},
+        {5248, 13, 0}, {5262, 15, 0}, {5278, 19, 0}, {5298, 15, 0}, {5314, 15, 0}, {5330, 12, 0}, {5343, 15, 0}, {5359, 14, 0},
+        {5374, 14, 0}, {5389, 18, 0}, {5408, 11, 0}, {5420, 16, 0}, {5437, 13, 0}, {5451, 16, 0}, {5468, 14, 0}, {5483, 8, 0},
+        {5492, 18, 0}, {5511, 8, 0}, {5520, 13, 0}, {5534, 11, 0}, {5546, 17, 0}, {5564, 22, 0}, {5587, 12, 0}, {5600, 12, 0},
+        {5613, 16, 0}, {5630, 11, 0}, {5642, 16, 0}, {5659, 9, 0}, {5669, 22, 0}, {5692, 15, 0}, {5708, 9, 0}, {5718, 13, 0},
+        {5732, 14, 0}, {5747, 13, 0}, {5761, 12, 0}, {5774, 17, 0}, {5792, 13, 0}, {5806, 13, 0}, {5820, 11, 0}, {5832, 20, 0},
+        {5853, 16, 0}, {5870, 14, 0}, {5885, 18, 0}, {5904, 12, 0}, {5917, 11, 0}, {5929, 21, 0}, {5951, 15, 0}, {5967, 15, 0},
+        {5983, 10, 0}, {5994, 15, 0}, {6010, 16, 0}, {6027, 14, 0}, {6042, 14, 0}, {6057, 14, 0}, {6072, 15, 0}, {6088, 14, 0},
+        {6103, 23, 0}, {6127, 10, 0}, {6138, 11, 0}, {6150, 16, 0}, {6167, 18, 0}, {6186, 6, 0}, {6193, 8, 0}, {6202, 8, 0},
+        {6211, 7, 0}, {6219, 6, 0}, {6226, 6, 0}, {6233, 11, 0}, {6245, 9, 0}, {6255, 8, 0}, {6264, 7, 0}, {6272, 6, 0},
+        {6279, 5, 0}, {6285, 8, 0}, {6294, 8, 0}, {6303, 6, 0}, {6310, 7, 0}, {6318, 5, 0}, {6324, 7, 0}, {6332, 9, 0},
+        {6342, 5, 0}, {6348, 5, 0}, {6354, 5, 0}, {6360, 7, 0}, {6368, 10, 0}, {6379, 14, 0}, {6394, 12, 0}, {6407, 5, 0},
+        {6413, 14, 0}, {6428, 7, 0}, {6436, 6, 0}, {6443, 6, 0}, {6450, 5, 0}, {6456, 5, 0}, {6462, 7, 0}, {6470, 15, 0},
+        {6486, 4, 0}, {6491, 42, 0}, {6534, 10, 0}, {6545, 9, 0}, {6555, 14, 0}, {6570, 8, 0}, {6579, 6, 0},
+};
+
+static char TERRITORY_NAMES_UNPACKED_SV[6586];
+
+static const PackedTerritoryNames PACKED_TERRITORY_NAMES_SV = {
+        TERRITORY_NAMES_UNPACKED_SV, 6586, TERRITORY_NAMES_PACKED_SV, 3416, TERRITORY_NAMES_PAIRS_SV,
+        TERRITORY_NAME_ALTERNATIVES_START_SV, TERRITORY_NAME_ALTERNATIVES_SV};
+
+#else
+
+static const PackedTerritoryNames PACKED_TERRITORY_NAMES_SV = {NULL, 0, NULL, 0, NULL, NULL, NULL};
+
+#endif // MAPCODE_SUPPORT_LANGUAGE_SV
+
+#ifdef MAPCODE_SUPPORT_LANGUAGE_SW // Swahili
+
+// 6700 bytes, packed to 3353
+static const unsigned char TERRITORY_NAMES_PACKED_SW[3353] = {
+        86, 26, 22, 56, 67, 39, 121, 124, 75, 39, 59, 26, 184, 117, 51, 13, 180, 25, 71, 150, 237, 206, 138, 111,
+        107, 30, 182, 189, 111, 99, 48, 32, 143, 121, 123, 75, 101, 30, 57, 245, 115, 188, 116, 45, 66, 6, 63, 30,
+        232, 121, 152, 97, 24, 117, 138, 117, 118, 11, 117, 51, 180, 182, 33, 4, 126, 77, 97, 6, 116, 20, 188, 116,
+        45, 167, 205, 152, 18, 102, 34, 107, 141, 80, 104, 125, 137, 245, 124, 80, 104, 125, 137, 164, 142, 159, 80, 39,
+        99, 97, 40, 110, 151, 145, 118, 101, 126, 148, 142, 66, 14, 109, 186, 190, 57, 14, 233, 3, 107, 26, 132, 3,
+        66, 135, 6, 60, 72, 4, 100, 218, 56, 167, 4, 25, 54, 193, 115, 101, 121, 64, 110, 103, 117, 125, 108, 140,
+        13, 116, 115, 14, 49, 10, 74, 14, 115, 101, 121, 91, 52, 131, 215, 114, 9, 109, 5, 7, 87, 11, 108, 9,
+        141, 70, 170, 53, 123, 70, 170, 53, 174, 185, 162, 32, 209, 245, 115, 124, 209, 245, 115, 44, 32, 66, 185, 162,
+        249, 105, 101, 131, 116, 20, 204, 101, 4, 64, 238, 98, 2, 159, 167, 239, 11, 108, 64, 109, 14, 22, 56, 83,
+        21, 111, 207, 21, 111, 97, 44, 197, 109, 14, 22, 27, 95, 67, 111, 111, 107, 246, 80, 105, 14, 114, 101, 141,
+        77, 105, 113, 117, 30, 13, 124, 77, 105, 113, 117, 30, 13, 152, 105, 240, 246, 75, 39, 116, 115, 141, 55, 118,
+        9, 124, 55, 118, 9, 0, 95, 67, 130, 109, 27, 66, 13, 97, 40, 101, 44, 32, 83, 126, 69, 178, 26, 117,
+        9, 141, 83, 134, 207, 134, 207, 126, 69, 178, 26, 105, 36, 51, 11, 100, 105, 118, 28, 246, 72, 30, 20, 97,
+        44, 197, 115, 99, 20, 115, 105, 13, 141, 84, 114, 163, 56, 100, 214, 53, 104, 123, 65, 115, 99, 20, 115, 105,
+        13, 124, 84, 114, 163, 56, 100, 214, 53, 104, 140, 11, 116, 2, 166, 20, 29, 2, 159, 209, 32, 118, 31, 167,
+        231, 1, 105, 124, 159, 209, 44, 32, 167, 231, 1, 217, 130, 158, 116, 101, 33, 118, 11, 98, 6, 100, 141, 74,
+        56, 77, 130, 20, 124, 74, 56, 77, 130, 20, 246, 86, 253, 20, 126, 42, 166, 20, 29, 4, 28, 124, 166, 20,
+        29, 4, 28, 91, 36, 132, 46, 75, 52, 42, 77, 99, 68, 13, 11, 100, 32, 86, 37, 123, 77, 99, 68, 13,
+        11, 100, 32, 86, 37, 174, 6, 98, 29, 48, 64, 110, 116, 236, 117, 3, 42, 66, 6, 98, 186, 123, 66, 6,
+        98, 186, 153, 24, 180, 97, 25, 83, 104, 30, 162, 30, 7, 80, 11, 182, 0, 159, 167, 105, 1, 3, 196, 176,
+        168, 175, 65, 110, 100, 18, 114, 2, 54, 21, 91, 52, 131, 3, 77, 27, 77, 116, 59, 26, 184, 117, 32, 76,
+        117, 99, 12, 77, 22, 114, 13, 28, 105, 207, 104, 40, 132, 162, 47, 108, 3, 77, 132, 114, 13, 28, 177, 57,
+        181, 18, 38, 84, 133, 2, 68, 61, 4, 22, 174, 135, 49, 4, 91, 40, 150, 26, 7, 84, 24, 107, 115, 141,
+        67, 97, 22, 48, 124, 67, 97, 22, 48, 155, 47, 84, 61, 101, 141, 157, 253, 137, 101, 124, 157, 253, 137, 38,
+        72, 133, 154, 133, 51, 6, 205, 105, 113, 117, 38, 159, 70, 6, 111, 38, 54, 29, 30, 145, 112, 38, 67, 61,
+        18, 25, 77, 97, 24, 39, 105, 36, 0, 58, 53, 105, 13, 249, 117, 120, 232, 98, 111, 24, 103, 33, 21, 111,
+        213, 208, 71, 101, 18, 103, 46, 42, 83, 208, 83, 23, 119, 220, 245, 115, 124, 159, 83, 208, 83, 23, 119, 220,
+        211, 34, 121, 110, 28, 46, 196, 184, 255, 153, 181, 201, 86, 14, 100, 38, 84, 114, 4, 105, 100, 29, 141, 84,
+        111, 98, 144, 111, 124, 84, 111, 98, 144, 25, 66, 114, 53, 101, 7, 75, 36, 4, 60, 109, 119, 3, 85, 102,
+        255, 3, 42, 65, 110, 206, 99, 116, 22, 197, 114, 100, 104, 7, 80, 119, 149, 18, 132, 25, 67, 121, 112, 114,
+        36, 249, 101, 98, 1, 13, 0, 129, 97, 22, 2, 71, 21, 183, 81, 26, 6, 0, 159, 70, 11, 107, 142, 86,
+        1, 117, 26, 117, 51, 13, 116, 20, 230, 114, 25, 66, 135, 21, 5, 138, 169, 18, 32, 31, 77, 192, 6, 132,
+        218, 119, 168, 105, 41, 91, 117, 119, 226, 10, 70, 105, 106, 60, 143, 121, 153, 11, 229, 13, 46, 147, 33, 108,
+        43, 20, 12, 148, 49, 30, 51, 97, 20, 101, 47, 31, 80, 11, 28, 205, 2, 69, 108, 32, 83, 11, 118, 29,
+        18, 151, 30, 202, 38, 68, 106, 150, 145, 116, 217, 59, 229, 13, 12, 82, 119, 23, 2, 72, 97, 39, 7, 66,
+        24, 53, 100, 7, 69, 113, 117, 26, 18, 105, 11, 32, 54, 216, 139, 108, 98, 160, 159, 83, 34, 61, 13, 64,
+        114, 109, 20, 12, 76, 28, 111, 63, 25, 85, 98, 30, 103, 105, 106, 217, 34, 100, 43, 2, 54, 216, 97, 45,
+        66, 219, 182, 138, 226, 119, 27, 66, 104, 170, 27, 83, 119, 39, 122, 14, 142, 85, 104, 34, 1, 122, 7, 68,
+        20, 109, 6, 107, 0, 69, 204, 13, 12, 146, 60, 31, 68, 61, 4, 132, 213, 108, 43, 59, 12, 67, 48, 116,
+        3, 82, 22, 174, 48, 110, 46, 42, 72, 14, 122, 230, 43, 4, 153, 114, 111, 26, 12, 84, 111, 103, 25, 76,
+        26, 118, 12, 76, 39, 104, 117, 160, 83, 114, 60, 76, 1, 107, 2, 71, 101, 18, 103, 12, 224, 30, 23, 33,
+        105, 14, 114, 3, 76, 101, 13, 38, 80, 1, 21, 2, 146, 60, 31, 67, 122, 101, 131, 91, 184, 255, 3, 54,
+        105, 1, 190, 109, 111, 106, 3, 119, 3, 70, 11, 109, 201, 122, 215, 105, 6, 134, 117, 64, 178, 114, 12, 65,
+        122, 14, 98, 226, 106, 27, 83, 14, 183, 74, 18, 100, 27, 85, 114, 20, 25, 72, 53, 103, 6, 121, 91, 18,
+        101, 3, 196, 36, 175, 73, 99, 30, 23, 247, 26, 232, 11, 153, 117, 98, 174, 117, 108, 103, 6, 12, 76, 150,
+        14, 12, 72, 13, 100, 24, 5, 151, 20, 4, 0, 69, 185, 114, 101, 140, 11, 97, 119, 7, 75, 18, 101, 215,
+        176, 168, 175, 78, 22, 6, 144, 117, 190, 103, 40, 132, 7, 84, 227, 132, 244, 66, 92, 108, 195, 0, 55, 112,
+        11, 138, 53, 9, 177, 24, 4, 21, 212, 238, 103, 117, 130, 189, 21, 98, 203, 177, 121, 114, 177, 20, 230, 11,
+        91, 121, 114, 103, 121, 122, 204, 27, 66, 30, 6, 36, 247, 242, 2, 76, 97, 48, 0, 82, 61, 160, 71, 234,
+        190, 103, 23, 190, 57, 14, 233, 207, 99, 158, 41, 124, 77, 107, 117, 117, 32, 119, 3, 85, 57, 14, 233, 123,
+        225, 63, 193, 32, 224, 30, 23, 124, 224, 30, 23, 44, 32, 225, 63, 193, 247, 216, 2, 69, 99, 117, 29, 18,
+        0, 87, 28, 116, 193, 32, 83, 135, 6, 207, 135, 254, 119, 7, 71, 134, 13, 0, 172, 90, 101, 11, 23, 151,
+        24, 107, 4, 3, 70, 5, 221, 104, 125, 137, 112, 4, 28, 210, 116, 11, 12, 79, 109, 27, 80, 34, 23, 210,
+        118, 18, 121, 32, 67, 111, 15, 225, 119, 130, 51, 11, 130, 115, 12, 86, 105, 149, 110, 21, 0, 70, 4, 142,
+        67, 133, 111, 45, 66, 49, 122, 122, 228, 125, 108, 38, 85, 106, 14, 241, 1, 7, 74, 181, 27, 90, 169, 98,
+        134, 119, 38, 80, 6, 144, 117, 130, 210, 49, 113, 51, 18, 111, 99, 99, 25, 85, 122, 98, 231, 244, 83, 119,
+        229, 20, 211, 97, 62, 3, 172, 54, 216, 153, 21, 14, 111, 13, 138, 24, 107, 109, 20, 244, 72, 9, 112, 160,
+        84, 104, 226, 142, 89, 232, 20, 212, 102, 255, 139, 11, 23, 32, 86, 37, 251, 20, 121, 174, 158, 115, 119, 1,
+        140, 29, 144, 5, 99, 6, 212, 107, 49, 216, 33, 186, 56, 75, 36, 175, 146, 60, 31, 65, 102, 114, 132, 3,
+        196, 26, 218, 61, 11, 12, 65, 102, 103, 234, 244, 77, 242, 109, 6, 124, 66, 24, 109, 2, 90, 21, 183, 128,
+        125, 38, 85, 116, 24, 117, 107, 7, 80, 59, 244, 77, 115, 241, 98, 105, 106, 7, 78, 21, 150, 12, 86, 20,
+        233, 117, 30, 2, 78, 236, 14, 12, 84, 1, 122, 160, 77, 9, 114, 217, 97, 24, 39, 160, 66, 34, 105, 118,
+        12, 69, 63, 105, 111, 112, 12, 67, 34, 61, 183, 65, 102, 114, 22, 215, 36, 175, 77, 11, 7, 65, 110, 103,
+        34, 2, 78, 236, 14, 250, 29, 211, 14, 117, 51, 133, 34, 12, 224, 27, 76, 150, 121, 213, 186, 27, 199, 100,
+        13, 28, 12, 87, 125, 97, 31, 31, 239, 40, 132, 162, 25, 84, 108, 97, 120, 99, 11, 140, 18, 30, 48, 64,
+        103, 117, 5, 99, 11, 105, 20, 116, 28, 189, 34, 169, 2, 81, 117, 14, 149, 6, 25, 72, 105, 100, 11, 103,
+        25, 77, 101, 120, 22, 47, 83, 116, 26, 38, 84, 134, 5, 99, 25, 78, 130, 6, 105, 10, 54, 1, 227, 117,
+        26, 221, 240, 8, 2, 89, 117, 99, 26, 27, 81, 117, 4, 116, 1, 3, 82, 111, 25, 83, 4, 11, 111, 153,
+        21, 112, 101, 131, 38, 77, 220, 111, 180, 27, 83, 56, 76, 117, 9, 32, 80, 158, 48, 7, 54, 14, 114, 14,
+        25, 78, 240, 118, 47, 76, 101, 13, 151, 227, 214, 11, 184, 18, 110, 12, 86, 14, 180, 238, 122, 250, 105, 181,
+        5, 151, 227, 214, 11, 184, 18, 110, 46, 83, 24, 0, 90, 180, 26, 101, 99, 5, 248, 11, 9, 99, 25, 84,
+        21, 182, 108, 137, 5, 0, 79, 97, 120, 180, 2, 68, 24, 92, 25, 67, 111, 135, 117, 125, 213, 13, 18, 2,
+        128, 105, 104, 117, 135, 117, 2, 166, 101, 20, 41, 155, 186, 60, 65, 49, 183, 67, 133, 111, 45, 75, 4, 239,
+        5, 139, 108, 103, 14, 12, 75, 168, 59, 104, 204, 27, 65, 114, 103, 20, 205, 2, 68, 21, 56, 42, 68, 105,
+        117, 0, 68, 29, 114, 3, 42, 78, 144, 6, 32, 72, 228, 30, 7, 128, 23, 236, 6, 104, 64, 110, 100, 21,
+        56, 23, 32, 78, 22, 111, 98, 6, 249, 59, 239, 29, 119, 101, 101, 112, 0, 68, 30, 104, 217, 230, 104, 11,
+        130, 2, 78, 144, 11, 23, 51, 1, 137, 24, 138, 114, 137, 24, 140, 202, 18, 21, 33, 132, 107, 169, 211, 53,
+        106, 134, 173, 6, 242, 139, 114, 53, 97, 131, 11, 32, 243, 64, 115, 115, 21, 151, 105, 104, 6, 212, 116, 206,
+        59, 104, 23, 0, 71, 111, 251, 14, 11, 2, 84, 21, 125, 32, 78, 29, 117, 173, 169, 97, 131, 11, 32, 243,
+        0, 129, 109, 117, 141, 75, 192, 109, 40, 250, 104, 26, 116, 9, 103, 6, 104, 248, 104, 6, 107, 104, 23, 91,
+        6, 110, 26, 59, 252, 227, 5, 63, 27, 79, 100, 162, 123, 79, 114, 219, 2, 54, 106, 254, 10, 87, 28, 126,
+        66, 20, 103, 11, 51, 29, 104, 31, 243, 138, 30, 92, 1, 139, 110, 100, 104, 114, 3, 243, 51, 135, 6, 192,
+        116, 114, 190, 116, 206, 32, 243, 211, 186, 117, 131, 14, 114, 121, 0, 172, 83, 208, 87, 11, 28, 64, 178, 237,
+        105, 56, 67, 181, 39, 11, 32, 84, 14, 185, 18, 121, 248, 14, 118, 9, 32, 66, 130, 32, 87, 181, 30, 28,
+        205, 2, 87, 125, 97, 31, 196, 176, 168, 175, 65, 178, 237, 46, 75, 36, 175, 84, 5, 109, 160, 86, 22, 116,
+        18, 12, 65, 178, 237, 46, 31, 77, 144, 104, 6, 150, 7, 81, 240, 20, 115, 142, 68, 163, 185, 47, 70, 229,
+        14, 11, 33, 14, 103, 137, 38, 65, 108, 144, 111, 5, 0, 82, 105, 47, 100, 201, 74, 1, 101, 40, 25, 69,
+        115, 112, 40, 39, 47, 83, 1, 116, 25, 82, 105, 47, 166, 23, 201, 100, 47, 225, 116, 38, 80, 254, 150, 213,
+        1, 116, 214, 26, 6, 4, 2, 80, 193, 21, 98, 117, 99, 25, 65, 109, 181, 153, 101, 6, 139, 99, 114, 38,
+        80, 6, 1, 252, 18, 97, 169, 252, 13, 100, 13, 177, 97, 47, 80, 182, 108, 221, 105, 182, 7, 84, 111, 99,
+        1, 205, 115, 0, 82, 105, 47, 166, 23, 201, 100, 47, 83, 117, 108, 51, 6, 1, 104, 97, 25, 71, 111, 105,
+        5, 51, 26, 47, 166, 48, 115, 47, 100, 47, 83, 117, 108, 151, 135, 12, 77, 4, 5, 32, 71, 14, 97, 9,
+        51, 26, 47, 166, 48, 115, 221, 6, 139, 109, 168, 13, 5, 0, 87, 125, 97, 31, 31, 67, 34, 241, 183, 82,
+        104, 203, 101, 164, 142, 68, 30, 97, 119, 6, 38, 67, 13, 110, 101, 99, 116, 22, 117, 10, 172, 74, 14, 115,
+        101, 121, 0, 172, 72, 21, 112, 239, 40, 38, 86, 14, 109, 13, 10, 77, 5, 115, 97, 131, 36, 149, 116, 115,
+        173, 97, 119, 226, 7, 167, 121, 142, 87, 28, 126, 209, 177, 208, 67, 6, 34, 4, 140, 97, 4, 38, 199, 100,
+        105, 1, 251, 20, 116, 117, 99, 107, 121, 138, 20, 110, 28, 115, 101, 38, 209, 12, 79, 104, 105, 221, 20, 110,
+        115, 121, 108, 118, 160, 77, 219, 219, 137, 112, 7, 76, 145, 35, 1, 139, 108, 134, 21, 139, 114, 107, 161, 5,
+        152, 18, 165, 67, 6, 34, 4, 2, 172, 89, 18, 107, 210, 111, 119, 2, 73, 108, 108, 4, 111, 9, 0, 71,
+        101, 18, 103, 12, 87, 9, 99, 13, 115, 4, 0, 70, 108, 18, 105, 100, 140, 219, 111, 24, 7, 79, 107, 108,
+        135, 61, 2, 225, 165, 68, 59, 158, 2, 87, 192, 57, 116, 13, 33, 208, 68, 59, 158, 2, 55, 98, 114, 176,
+        251, 161, 5, 210, 100, 135, 25, 85, 116, 135, 51, 4, 110, 28, 158, 140, 220, 236, 27, 87, 121, 61, 57, 0,
+        79, 114, 230, 13, 189, 34, 18, 29, 25, 55, 118, 29, 139, 114, 202, 13, 2, 172, 77, 101, 120, 22, 25, 77,
+        13, 116, 1, 153, 11, 184, 18, 110, 12, 84, 101, 120, 5, 64, 108, 176, 174, 185, 162, 32, 67, 34, 241, 183,
+        65, 108, 98, 14, 116, 2, 79, 110, 206, 105, 25, 81, 240, 98, 101, 99, 33, 176, 26, 131, 101, 119, 27, 77,
+        1, 39, 111, 98, 2, 147, 102, 111, 53, 100, 142, 172, 66, 114, 53, 115, 119, 22, 107, 152, 43, 3, 83, 99,
+        158, 12, 157, 253, 201, 69, 100, 119, 6, 100, 164, 142, 89, 117, 107, 13, 152, 18, 63, 119, 28, 126, 84, 14,
+        185, 18, 105, 28, 152, 53, 228, 117, 10, 199, 100, 12, 65, 178, 237, 12, 66, 49, 122, 125, 51, 6, 231, 1,
+        105, 124, 85, 110, 39, 229, 32, 83, 116, 26, 28, 32, 111, 102, 197, 109, 14, 22, 123, 65, 109, 14, 132, 140,
+        101, 120, 22, 25, 77, 48, 99, 111, 119, 246, 80, 149, 14, 115, 98, 24, 103, 91, 11, 4, 57, 114, 29, 19,
+        199, 103, 36, 104, 149, 179, 64, 100, 121, 103, 101, 3, 171, 79, 115, 115, 149, 46, 196, 176, 168, 4, 105, 45,
+        65, 108, 1, 179, 91, 134, 6, 100, 4, 111, 45, 66, 11, 107, 6, 222, 75, 254, 131, 130, 45, 128, 14, 107,
+        28, 115, 222, 128, 101, 131, 20, 222, 128, 117, 118, 192, 222, 73, 118, 1, 43, 111, 19, 76, 137, 149, 127, 79,
+        114, 121, 34, 19, 84, 117, 108, 191, 66, 30, 103, 18, 203, 19, 86, 108, 29, 169, 40, 19, 75, 24, 127, 75,
+        11, 117, 103, 191, 84, 21, 98, 223, 66, 114, 242, 127, 89, 6, 48, 108, 228, 108, 19, 82, 121, 168, 1, 19,
+        65, 204, 49, 107, 234, 19, 77, 48, 99, 111, 119, 19, 83, 109, 34, 20, 127, 68, 144, 28, 116, 56, 96, 0,
+        86, 18, 13, 233, 104, 19, 78, 43, 103, 18, 203, 19, 80, 50, 223, 75, 48, 116, 114, 61, 191, 83, 116, 228,
+        114, 111, 112, 34, 187, 75, 114, 5, 110, 203, 6, 187, 75, 11, 109, 121, 107, 179, 138, 118, 14, 19, 76, 20,
+        57, 114, 29, 19, 82, 48, 116, 223, 86, 34, 103, 111, 103, 114, 29, 19, 86, 34, 111, 103, 100, 191, 77, 24,
+        109, 1, 127, 75, 6, 30, 179, 152, 20, 149, 115, 197, 170, 13, 61, 111, 36, 32, 79, 107, 238, 103, 91, 61,
+        60, 96, 64, 114, 107, 104, 92, 30, 127, 77, 18, 100, 43, 179, 152, 202, 104, 110, 121, 32, 78, 43, 103, 18,
+        203, 19, 80, 20, 122, 191, 75, 40, 223, 167, 60, 69, 108, 222, 79, 114, 20, 98, 24, 103, 19, 85, 108, 242,
+        43, 127, 80, 14, 109, 187, 66, 192, 107, 18, 116, 48, 116, 56, 96, 212, 100, 109, 24, 126, 96, 138, 26, 6,
+        204, 56, 96, 33, 21, 6, 191, 83, 6, 26, 223, 89, 21, 11, 111, 45, 78, 20, 149, 115, 91, 234, 116, 121,
+        45, 77, 161, 218, 118, 14, 100, 108, 43, 127, 84, 121, 241, 20, 19, 75, 24, 103, 1, 19, 128, 30, 121, 134,
+        4, 127, 66, 24, 121, 26, 179, 0, 90, 134, 130, 107, 11, 50, 121, 187, 224, 107, 170, 127, 78, 43, 48, 150,
+        40, 127, 84, 61, 127, 79, 109, 127, 75, 104, 59, 5, 115, 46, 171, 75, 232, 14, 43, 111, 19, 65, 108, 116,
+        97, 60, 96, 64, 108, 116, 97, 60, 75, 156, 84, 117, 118, 3, 171, 75, 114, 5, 110, 111, 121, 6, 50, 187,
+        77, 144, 29, 1, 105, 19, 128, 117, 107, 158, 107, 3, 79, 107, 238, 103, 91, 21, 131, 26, 107, 215, 156, 83,
+        59, 104, 11, 4, 19, 157, 169, 18, 50, 121, 187, 74, 101, 119, 162, 197, 170, 13, 61, 111, 36, 19, 75, 104,
+        134, 6, 43, 50, 187, 65, 109, 24, 19, 83, 59, 104, 3, 96, 124, 89, 59, 170, 179, 189, 1, 29, 252, 36,
+        115, 177, 104, 92, 104, 97, 7, 84, 105, 1, 106, 4, 151, 101, 105, 106, 57, 173, 97, 4, 27, 78, 57, 120,
+        46, 72, 117, 7, 128, 133, 113, 57, 0, 90, 104, 101, 106, 235, 248, 235, 115, 117, 0, 70, 117, 106, 105, 27,
+        65, 110, 104, 117, 7, 76, 105, 97, 13, 57, 33, 104, 23, 133, 33, 234, 120, 7, 74, 235, 120, 7, 72, 20,
+        27, 54, 202, 104, 145, 247, 92, 100, 133, 173, 117, 98, 101, 7, 74, 125, 4, 173, 101, 98, 101, 218, 104, 97,
+        1, 120, 7, 55, 60, 77, 133, 34, 124, 199, 110, 14, 32, 77, 133, 34, 12, 72, 101, 125, 133, 106, 235, 173,
+        53, 27, 54, 92, 120, 60, 90, 104, 117, 92, 33, 220, 117, 27, 89, 53, 110, 27, 88, 202, 92, 124, 84, 150,
+        101, 10, 71, 161, 117, 0, 81, 57, 104, 97, 7, 88, 4, 106, 235, 32, 85, 121, 103, 136, 250, 4, 140, 6,
+        231, 1, 60, 78, 100, 111, 103, 47, 95, 79, 170, 108, 121, 57, 189, 108, 137, 112, 14, 116, 13, 154, 37, 139,
+        110, 206, 99, 116, 22, 2, 199, 116, 193, 26, 105, 13, 11, 124, 68, 53, 12,
+};
+
+static const unsigned char TERRITORY_NAMES_PAIRS_SW[256][2] = {
+        {0, 0}, {97, 110}, {97, 0}, {97, 32}, {105, 110}, {97, 115}, {97, 114}, {105, 0}, {98, 108}, {105, 115}, {116, 0}, {97, 108},
+        {105, 2}, {111, 110}, {101, 114}, {5, 10}, {8, 15}, {79, 16}, {111, 114}, {32, 17}, {101, 110}, {97, 109}, {105, 99}, {1, 100},
+        {117, 114}, {111, 0}, {97, 116}, {1, 0}, {101, 115}, {97, 100}, {101, 108}, {121, 3}, {32, 32}, {0, 83}, {111, 108}, {9, 105},
+        {117, 115}, {35, 119}, {101, 0}, {105, 116}, {105, 114}, {108, 23}, {110, 3}, {111, 118}, {44, 44}, {45, 45}, {105, 3}, {111, 32},
+        {111, 115}, {114, 97}, {115, 107}, {0, 77}, {37, 3}, {117, 110}, {71, 117}, {78, 101}, {1, 32}, {4, 103}, {82, 101}, {97, 107},
+        {105, 32}, {111, 109}, {112, 117}, {116, 104}, {0, 65}, {65, 65}, {66, 66}, {67, 67}, {68, 68}, {69, 69}, {70, 70}, {71, 71},
+        {72, 72}, {73, 73}, {74, 74}, {75, 75}, {76, 76}, {77, 77}, {78, 78}, {79, 79}, {80, 80}, {81, 81}, {82, 82}, {83, 83},
+        {84, 84}, {85, 85}, {86, 86}, {87, 87}, {88, 88}, {89, 89}, {90, 90}, {0, 75}, {1, 103}, {8, 22}, {58, 62}, {86, 52},
+        {94, 93}, {97, 97}, {98, 98}, {99, 99}, {100, 100}, {101, 101}, {102, 102}, {103, 103}, {104, 104}, {105, 105}, {106, 106}, {107, 107},
+        {108, 108}, {109, 109}, {110, 110}, {111, 111}, {112, 112}, {113, 113}, {114, 114}, {115, 115}, {116, 116}, {117, 117}, {118, 118}, {119, 119},
+        {120, 120}, {121, 121}, {122, 122}, {97, 124}, {124, 124}, {105, 108}, {116, 32}, {50, 19}, {67, 104}, {74, 21}, {97, 121}, {99, 104},
+        {105, 107}, {13, 103}, {97, 98}, {97, 104}, {104, 24}, {105, 112}, {0, 84}, {2, 65}, {2, 77}, {32, 42}, {41, 0}, {95, 118},
+        {97, 103}, {111, 117}, {129, 136}, {55, 119}, {73, 115}, {101, 116}, {105, 98}, {0, 66}, {0, 78}, {2, 67}, {32, 75}, {33, 97},
+        {49, 7}, {80, 114}, {111, 116}, {143, 31}, {1, 12}, {1, 115}, {9, 104}, {9, 116}, {32, 148}, {63, 32}, {71, 114}, {77, 6},
+        {97, 122}, {105, 109}, {117, 116}, {146, 7}, {147, 32}, {0, 72}, {2, 66}, {4, 7}, {5, 107}, {12, 83}, {36, 116}, {46, 96},
+        {97, 99}, {97, 112}, {97, 117}, {98, 12}, {105, 102}, {114, 39}, {117, 100}, {154, 156}, {155, 4}, {0, 67}, {2, 85}, {3, 17},
+        {5, 104}, {14, 110}, {28, 104}, {29, 194}, {31, 75}, {32, 65}, {40, 103}, {73, 110}, {86, 198}, {101, 32}, {105, 122}, {111, 100},
+        {115, 116}, {116, 4}, {116, 6}, {123, 83}, {145, 165}, {200, 4}, {0, 73}, {0, 80}, {0, 85}, {2, 83}, {3, 67}, {3, 75},
+        {4, 101}, {7, 77}, {7, 83}, {9, 115}, {22, 104}, {25, 80}, {32, 171}, {43, 19}, {73, 114}, {78, 18}, {97, 105}, {97, 106},
+        {97, 118}, {101, 100}, {101, 103}, {101, 107}, {101, 109}, {101, 122}, {104, 1}, {105, 92}, {105, 103}, {114, 11}, {114, 117}, {115, 104},
+        {117, 101}, {117, 109}, {121, 1}, {157, 195}, {163, 27}, {164, 41}, {188, 126}, {0, 54}, {0, 74}, {0, 76}, {0, 128}, {2, 75},
+        {2, 82}, {4, 99}, {6, 97}, {6, 161},
+};
+
+static const unsigned short TERRITORY_NAME_ALTERNATIVES_START_SW[_TERRITORY_MAX - _TERRITORY_MIN] = {
+        0, 2, 3, 4, 5, 7, 8, 9, 10, 11, 12, 13, 15, 16, 17, 18,
+        19, 20, 21, 22, 23, 24, 25, 27, 29, 30, 31, 32, 34, 35, 37, 38,
+        40, 41, 44, 45, 48, 49, 50, 52, 53, 55, 57, 59, 60, 62, 63, 64,
+        65, 66, 67, 68, 69, 70, 72, 73, 74, 75, 76, 77, 79, 81, 82, 83,
+        84, 85, 86, 87, 88, 89, 90, 92, 93, 94, 96, 97, 98, 99, 100, 101,
+        102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117,
+        118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132, 133,
+        134, 135, 136, 137, 138, 139, 140, 141, 142, 143, 144, 145, 146, 147, 148, 149,
+        150, 151, 152, 153, 154, 155, 156, 157, 158, 159, 160, 161, 162, 163, 164, 165,
+        166, 167, 168, 169, 170, 171, 172, 173, 174, 175, 176, 177, 178, 179, 180, 181,
+        182, 183, 184, 185, 186, 187, 188, 193, 194, 195, 197, 198, 199, 200, 201, 202,
+        203, 204, 205, 206, 207, 208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218,
+        219, 220, 221, 222, 223, 224, 225, 226, 227, 228, 229, 230, 231, 232, 233, 234,
+        236, 237, 238, 239, 240, 241, 242, 243, 244, 245, 246, 247, 248, 249, 250, 251,
+        252, 253, 254, 255, 256, 257, 258, 259, 260, 261, 262, 263, 264, 265, 266, 267,
+        268, 269, 270, 271, 272, 273, 274, 275, 276, 277, 278, 279, 280, 281, 282, 283,
+        284, 285, 286, 287, 288, 289, 290, 291, 292, 293, 294, 295, 296, 297, 298, 299,
+        300, 301, 302, 303, 304, 305, 306, 307, 308, 309, 310, 311, 312, 313, 314, 315,
+        316, 317, 318, 319, 320, 321, 322, 323, 324, 325, 326, 328, 329, 330, 331, 332,
+        333, 334, 335, 336, 337, 338, 339, 340, 341, 342, 343, 344, 345, 346, 347, 348,
+        349, 350, 351, 352, 353, 354, 355, 356, 357, 358, 359, 360, 361, 362, 363, 364,
+        365, 366, 367, 368, 369, 370, 371, 372, 373, 374, 375, 376, 377, 378, 379, 380,
+        381, 382, 383, 384, 385, 386, 387, 388, 389, 390, 391, 392, 393, 394, 395, 396,
+        397, 398, 399, 400, 401, 402, 403, 404, 405, 406, 407, 408, 409, 410, 411, 412,
+        413, 414, 415, 416, 417, 418, 419, 420, 421, 422, 423, 424, 425, 426, 427, 428,
+        429, 430, 431, 432, 433, 434, 435, 436, 437, 438, 439, 442, 443, 444, 445, 446,
+        447, 448, 449, 450, 451, 452, 453, 454, 455, 456, 457, 458, 459, 460, 461, 462,
+        463, 464, 465, 466, 467, 468, 469, 470, 471, 472, 473, 474, 475, 476, 477, 478,
+        479, 480, 481, 482, 483, 484, 485, 486, 487, 488, 489, 490, 491, 492, 493, 494,
+        495, 496, 497, 498, 499, 500, 501, 502, 503, 504, 505, 506, 507, 508, 509, 510,
+        511, 512, 513, 514, 515, 516, 517, 518, 519, 520, 521, 522, 523, 524, 525, 527,
+        528, 529, 530, 531, 532, 533, 534, 535, 536, 537, 538, 539, 540, 541, 542, 543,
+        544, 545, 546, 547, 548, 549, 550, 552, 553, 554, 555, 556, 557, 559, 560, 561,
+        562, 563, 564, 565, 566, 568,
+};
+
+static const TerritoryNameAlternative TERRITORY_NAME_ALTERNATIVES_SW[568] = {
+        {0, 12, 0}, {13, 10, 0}, {24, 6, 0}, {31, 9, 0}, {41, 7, 0}, {49, 16, 0}, {66, 15, 0}, {82, 16, 0},
+        {99, 5, 0}, {105, 6, 0}, {112, 5, 0}, {118, 12, 0}, {131, 12, 0}, {144, 24, 0}, {169, 13, 0}, {183, 19, 0},
+        {203, 13, 0}, {217, 7, 0}, {225, 29, 0}, {255, 10, 0}, {266, 8, 0}, {275, 8, 0}, {284, 10, 0}, {295, 6, 0},
+        {302, 19, 0}, {322, 16, 0}, {339, 6, 0}, {346, 22, 0}, {369, 23, 0}, {393, 13, 0}, {407, 5, 0}, {413, 19, 0},
+        {433, 14, 0}, {448, 15, 0}, {464, 11, 0}, {476, 24, 0}, {501, 8, 0}, {510, 4, 0}, {515, 20, 0}, {536, 5, 0},
+        {542, 13, 0}, {556, 29, 0}, {586, 4, 0}, {591, 12, 0}, {604, 8, 0}, {613, 43, 0}, {657, 9, 0}, {667, 16, 0},
+        {684, 5, 0}, {690, 7, 0}, {698, 30, 0}, {729, 27, 0}, {757, 7, 0}, {765, 21, 0}, {787, 9, 0}, {797, 27, 0},
+        {825, 10, 0}, {836, 33, 0}, {870, 15, 0}, {886, 8, 0}, {895, 18, 0}, {914, 7, 0}, {922, 7, 0}, {930, 10, 0},
+        {941, 5, 0}, {947, 31, 0}, {979, 7, 0}, {987, 4, 0}, {992, 14, 0}, {1007, 15, 0}, {1023, 10, 0}, {1034, 24, 0},
+        {1059, 9, 0}, {1069, 5, 0}, {1075, 8, 0}, {1084, 7, 0}, {1092, 8, 0}, {1101, 15, 0}, {1117, 6, 0}, {1124, 20, 0},
+        {1145, 8, 0}, {1154, 9, 0}, {1164, 10, 0}, {1175, 16, 0}, {1192, 10, 0}, {1203, 6, 0}, {1210, 9, 0}, {1220, 7, 0},
+        {1228, 10, 0}, {1239, 5, 0}, {1245, 39, 0}, {1285, 25, 0}, {1311, 22, 0}, {1334, 10, 0}, {1345, 18, 0}, {1364, 6, 0},
+        {1371, 6, 0}, {1378, 38, 0}, {1417, 9, 0}, {1427, 6, 0}, {1434, 7, 0}, {1442, 7, 0}, {1450, 6, 0}, {1457, 5, 0},
+        {1463, 19, 0}, {1483, 7, 0}, {1491, 10, 0}, {1502, 7, 0}, {1510, 18, 0}, {1529, 9, 0}, {1539, 6, 0}, {1546, 15, 0},
+        {1562, 13, 0}, {1576, 8, 0}, {1585, 6, 0}, {1592, 19, 0}, {1612, 11, 0}, {1624, 6, 0}, {1631, 8, 0}, {1640, 9, 0},
+        {1650, 6, 0}, {1657, 5, 0}, {1663, 7, 0}, {1671, 17, 0}, {1689, 7, 0}, {1697, 18, 0}, {1716, 7, 0}, {1724, 7, 0},
+        {1732, 8, 0}, {1741, 7, 0}, {1749, 13, 0}, {1763, 6, 0}, {1770, 6, 0}, {1777, 11, 0}, {1789, 8, 0}, {1798, 7, 0},
+        {1806, 7, 0}, {1814, 19, 0}, {1834, 8, 0}, {1843, 10, 0}, {1854, 21, 0}, {1876, 7, 0}, {1884, 4, 0}, {1889, 6, 0},
+        {1896, 9, 0}, {1906, 9, 0}, {1916, 7, 0}, {1924, 7, 0}, {1932, 12, 0}, {1945, 6, 0}, {1952, 16, 0}, {1969, 16, 0},
+        {1986, 25, 0}, {2012, 7, 0}, {2020, 10, 0}, {2031, 6, 0}, {2038, 6, 0}, {2045, 5, 0}, {2051, 7, 0}, {2059, 15, 0},
+        {2075, 7, 0}, {2083, 9, 0}, {2093, 4, 0}, {2098, 8, 0}, {2107, 7, 0}, {2115, 8, 0}, {2124, 5, 0}, {2130, 7, 0},
+        {2138, 6, 0}, {2145, 15, 0}, {2161, 9, 0}, {2171, 7, 0}, {2179, 10, 0}, {2190, 10, 0}, {2201, 5, 0}, {2207, 7, 0},
+        {2215, 7, 0}, {2223, 7, 0}, {2231, 8, 0}, {2240, 5, 0}, {2246, 7, 0}, {2254, 10, 0}, {2265, 7, 0}, {2273, 6, 0},
+        {2280, 4, 0}, {2285, 7, 0}, {2293, 5, 0}, {2299, 6, 0}, {2306, 9, 0}, {2316, 8, 0}, {2325, 17, 0}, {2343, 16, 0},
+        {2360, 17, 0}, {2378, 6, 0}, {2385, 7, 0}, {2393, 14, 0}, {2408, 8, 0}, {2417, 5, 0}, {2423, 11, 0}, {2435, 12, 0},
+        {2448, 11, 0}, {2460, 6, 0}, {2467, 4, 0}, {2472, 6, 0}, {2479, 11, 0}, {2491, 6, 0}, {2498, 8, 0}, {2507, 7, 0},
+        {2515, 7, 0}, {2523, 17, 0}, {2541, 9, 0}, {2551, 5, 0}, {2557, 8, 0}, {2566, 8, 0}, {2575, 4, 0}, {2580, 7, 0},
+        {2588, 10, 0}, {2599, 6, 0}, {2606, 16, 0}, {2623, 8, 0}, {2632, 12, 0}, {2645, 8, 0}, {2654, 8, 0}, {2663, 5, 0},
+        {2669, 8, 0}, {2678, 13, 0}, {2692, 5, 0}, {2698, 8, 0}, {2707, 10, 0}, {2718, 7, 0}, {2726, 12, 0}, {2739, 25, 0},
+        {2765, 7, 0}, {2773, 11, 0}, {2785, 7, 0}, {2793, 5, 0}, {2799, 6, 0}, {2806, 5, 0}, {2812, 7, 0}, {2820, 8, 0},
+        {2829, 8, 0}, {2838, 7, 0}, {2846, 9, 0}, {2856, 7, 0}, {2864, 8, 0}, {2873, 5, 0}, {2879, 10, 0}, {2890, 7, 0},
+        {2898, 8, 0}, {2907, 8, 0}, {2916, 13, 0}, {2930, 4, 0}, {2935, 6, 0}, {2942, 5, 0}, {2948, 4, 0}, {2953, 4, 0},
+        {2958, 8, 0}, {2967, 4, 0}, {2972, 5, 0}, {2978, 5, 0}, {2984, 9, 0}, {2994, 20, 0}, {3015, 8, 0}, {3024, 7, 0},
+        {3032, 14, 0}, {3047, 6, 0}, {3054, 9, 0}, {3064, 7, 0}, {3072, 12, 0}, {3085, 7, 0}, {3093, 7, 0}, {3101, 10, 0},
+        {3112, 6, 0}, {3119, 7, 0}, {3127, 12, 0}, {3140, 7, 0}, {3148, 8, 0}, {3157, 9, 0}, {3167, 15, 0}, {3183, 8, 0},
+        {3192, 10, 0}, {3203, 15, 0}, {3219, 8, 0}, {3228, 7, 0}, {3236, 19, 0}, {3256, 9, 0}, {3266, 7, 0}, {3274, 10, 0},
+        {3285, 6, 0}, {3292, 7, 0}, {3300, 8, 0}, {3309, 6, 0}, {3316, 9, 0}, {3326, 9, 0}, {3336, 12, 0}, {3349, 14, 0},
+        {3364, 7, 0}, {3372, 10, 0}, {3383, 9, 0}, {3393, 12, 0}, {3406, 21, 0}, {3428, 10, 0}, {3439, 19, 0}, {3459, 11, 0},
+        {3471, 5, 0}, {3477, 9, 0}, {3487, 8, 0}, {3496, 7, 0}, {3504, 7, 0}, {3512, 7, 0}, {3520, 6, 0}, {3527, 6, 0},
+        {3534, 7, 0}, {3542, 17, 0}, {3560, 5, 0}, {3566, 5, 0}, {3572, 11, 0}, {3584, 3, 0}, {3588, 6, 0}, {3595, 10, 0},
+        {3606, 16, 0}, {3623, 16, 0}, {3640, 12, 0}, {3653, 9, 0}, {3663, 9, 0}, {3673, 9, 0}, {3683, 6, 0}, {3690, 6, 0},
+        {3697, 7, 0}, {3705, 11, 0}, {3717, 14, 0}, {3732, 9, 0}, {3742, 14, 0}, {3757, 11, 0}, {3769, 13, 0}, {3783, 10, 0},
+        {3794, 15, 0}, {3810, 28, 0}, {3839, 22, 0}, {3862, 19, 0}, {3882, 16, 0}, {3899, 8, 0}, {3908, 8, 0}, {3917, 22, 0},
+        {3940, 10, 0}, {3951, 16, 0}, {3968, 7, 0}, {3976, 7, 0}, {3984, 14, 0}, {3999, 14, 0}, {4014, 19, 0}, {4034, 7, 0},
+        {4042, 14, 0}, {4057, 10, 0}, {4068, 5, 0}, {4074, 5, 0}, {4080, 4, 0}, {4085, 6, 0}, {4092, 7, 0}, {4100, 8, 0},
+        {4109, 9, 0}, {4119, 5, 0}, {4125, 9, 0}, {4135, 17, 0}, {4153, 8, 0}, {4162, 5, 0}, {4168, 18, 0}, {4187, 5, 0},
+        {4193, 12, 0}, {4206, 11, 0}, {4218, 4, 0}, {4223, 8, 0}, {4232, 18, 0}, {4251, 12, 0}, {4264, 8, 0}, {4273, 11, 0},
+        {4285, 10, 0}, {4296, 13, 0}, {4310, 7, 0}, {4318, 13, 0}, {4332, 6, 0}, {4339, 8, 0}, {4348, 13, 0}, {4362, 14, 0},
+        {4377, 5, 0}, {4383, 7, 0}, {4391, 8, 0}, {4400, 9, 0}, {4410, 8, 0}, {4419, 4, 0}, {4424, 12, 0}, {4437, 11, 0},
+        {4449, 9, 0}, {4459, 7, 0}, {4467, 8, 0}, {4476, 14, 0}, {4491, 8, 0}, {4500, 4, 0}, {4505, 8, 0}, {4514, 7, 0},
+        {4522, 9, 0}, {4532, 7, 0}, {4540, 8, 0}, {4549, 8, 0}, {4558, 12, 0}, {4571, 10, 0}, {4582, 12, 0}, {4595, 8, 0},
+        {4604, 6, 0}, {4611, 5, 0}, {4617, 4, 0}, {4622, 9, 0}, {4632, 8, 0}, {4641, 7, 0}, {4649, 6, 0}, {4656, 8, 0},
+        {4665, 6, 0}, {4672, 7, 0}, {4680, 10, 0}, {4691, 7, 0}, {4699, 10, 0}, {4710, 5, 0}, {4716, 6, 0}, {4723, 16, 0},
+        {4740, 7, 0}, {4748, 7, 0}, {4756, 6, 0}, {4763, 12, 0}, {4776, 8, 0}, {4785, 12, 0}, {4798, 13, 0}, {4812, 11, 0},
+        {4824, 20, 0}, {4845, 5, 0}, {4851, 21, 0}, {4873, 7, 0}, {4881, 5, 0}, {4887, 9, 0}, {4897, 6, 0}, {4904, 8, 0},
+        {4913, 24, 0}, {4938, 7, 0}, {4946, 6, 0}, {4953, 6, 0}, {4960, 16, 0}, {4977, 18, 0}, {4996, 19, 0}, {5016, 14, 0},
+        {5031, 36, 0}, {5068, 24, 0}, {5093, 25, 0}, {5119, 15, 0}, {5135, 15, 0}, {5151, 14, 0}, {5166, 14, 0}, {5181, 12, 0},
+        {5194, 11, 0}, {5206, 15, 0}, {5222, 15, 0}, {5238, 12, 0}, {5251, 13, 0}, {5265, 13, 0}, {5279, 14, 0}, {5294, 16, 0},
+        {5311, 13, 0}, {5325, 16, 0}, {5342, 13, 0}, {5356, 15, 0}, {5372, 17, 0}, {5390, 15, 0}, {5406, 15, 0}, {5422, 12, 0},
+        {5435, 15, 0}, {5451, 14, 0}, {5466, 14, 0}, {5481, 17, 0}, {5499, 11, 0}, {5511, 16, 0}, {5528, 13, 0}, {5542, 16, 0},
+        {5559, 14, 0}, {5574, 15, 0}, {5590, 16, 0}, {5607, 23, 0}, {5631, 13, 0}, {5645, 18, 0}, {5664, 17, 0}, {5682, 22, 0},
+        {5705, 12, 0}, {5718, 12, 0}, {5731, 15, 0}, {5747, 15, 0}, {5763, 16, 0}, {5780, 9, 0}, {5790, 22, 0}, {5813, 15, 0},
+        {5829, 18, 0}, {5848, 13, 0}, {5862, 14, 0}, {5877, 13, 0}, {5891, 12, 0}, {5904, 17, 0}, {5922, 13, 0}, {5936, 13, 0},
+        {5950, 18, 0}, {5969, 17, 0}, {5987, 16, 0}, {6004, 14, 0}, {6019, 18, 0}, {6038, 12, 0}, {6051, 11, 0}, {6063, 17, 0},
+        {6081, 15, 0}, {6097, 14, 0}, {6112, 10, 0}, {6123, 12, 0}, {6136, 16, 0}, {6153, 15, 0}, {6169, 14, 0}, {6184, 14, 0},
+        {6199, 15, 0}, {6215, 14, 0}, {6230, 24, 0}, {6255, 15, 0}, {6271, 11, 0}, {6283, 14, 0}, {6298, 16, 0}, {6315, 6, 0},
+        {6322, 6, 0}, {6329, 8, 0}, {6338, 7, 0}, {6346, 7, 0}, {6354, 6, 0}, {6361, 11, 0}, {6373, 9, 0}, {6383, 8, 0},
+        {6392, 7, 0}, {6400, 6, 0}, {6407, 5, 0}, {6413, 8, 0}, {6422, 8, 0}, {6431, 6, 0}, {6438, 7, 0}, {6446, 5, 0},
+        {6452, 7, 0}, {6460, 9, 0}, {6470, 5, 0}, {6476, 5, 0}, {6482, 5, 0}, {6488, 7, 0}, {6496, 10, 0}, {6507, 14, 0},
+        {6522, 12, 0}, {6535, 5, 0}, {6541, 14, 0}, {6556, 7, 0}, {6564, 6, 0}, {6571, 6, 0}, {6578, 5, 0}, {6584, 5, 0},
+        {6590, 7, 0}, {6598, 15, 0}, {6614, 5, 0}, {6620, 30, 0}, {6651, 17, 0}, {6669, 10, 0}, {6680, 13, 0}, {6694, 5, 0},
+};
+
+static char TERRITORY_NAMES_UNPACKED_SW[6700];
+
+static const PackedTerritoryNames PACKED_TERRITORY_NAMES_SW = {
+        TERRITORY_NAMES_UNPACKED_SW, 6700, TERRITORY_NAMES_PACKED_SW, 3353, TERRITORY_NAMES_PAIRS_SW,
+        TERRITORY_NAME_ALTERNATIVES_START_SW, TERRITORY_NAME_ALTERNATIVES_SW};
+
+#else
+
+static const PackedTerritoryNames PACKED_TERRITORY_NAMES_SW = {NULL, 0, NULL, 0, NULL, NULL, NULL};
+
+#endif // MAPCODE_SUPPORT_LANGUAGE_SW
+
+#ifdef MAPCODE_SUPPORT_LANGUAGE_TR // Turkish
+
+// 6735 bytes, packed to 3413
+static const unsigned char TERRITORY_NAMES_PACKED_TR[3413] = {
+        86, 33, 30, 1, 124, 72, 39, 121, 205, 101, 34, 77, 13, 91, 35, 67, 101, 98, 53, 95, 3, 8, 107, 137,
+        111, 107, 101, 9, 117, 199, 111, 99, 133, 57, 231, 75, 101, 53, 151, 127, 83, 222, 45, 66, 3, 116, 104, 53,
+        243, 121, 200, 97, 11, 117, 137, 251, 5, 117, 64, 91, 97, 35, 83, 165, 32, 77, 97, 3, 116, 17, 125, 222,
+        45, 237, 116, 7, 200, 21, 102, 39, 107, 129, 80, 104, 62, 140, 32, 73, 115, 123, 124, 80, 104, 62, 140, 32,
+        73, 115, 123, 160, 95, 99, 97, 54, 110, 127, 66, 111, 251, 18, 234, 66, 10, 109, 194, 2, 136, 110, 103, 62,
+        193, 218, 165, 12, 107, 212, 198, 117, 32, 239, 112, 114, 91, 108, 3, 25, 83, 162, 237, 7, 35, 139, 10, 110,
+        115, 38, 142, 110, 223, 62, 108, 93, 13, 116, 115, 215, 33, 227, 10, 115, 38, 200, 111, 53, 234, 87, 5, 108,
+        58, 129, 70, 141, 92, 172, 70, 141, 92, 183, 248, 1, 121, 20, 86, 54, 106, 7, 127, 76, 105, 104, 116, 17,
+        55, 116, 61, 110, 142, 114, 117, 98, 93, 3, 55, 5, 127, 219, 10, 30, 162, 83, 29, 111, 185, 67, 111, 111,
+        107, 127, 65, 122, 193, 32, 80, 105, 215, 50, 96, 77, 105, 113, 117, 53, 13, 124, 77, 105, 113, 117, 53, 13,
+        200, 105, 117, 34, 83, 222, 94, 95, 116, 115, 129, 146, 118, 58, 124, 146, 118, 58, 199, 61, 109, 1, 127, 66,
+        13, 97, 54, 101, 44, 205, 116, 46, 32, 69, 210, 33, 117, 58, 129, 83, 170, 172, 83, 170, 172, 83, 116, 32,
+        69, 210, 33, 105, 198, 64, 5, 100, 105, 118, 175, 125, 222, 218, 53, 17, 97, 44, 27, 115, 99, 17, 115, 105,
+        13, 129, 84, 114, 49, 162, 100, 232, 92, 104, 172, 89, 51, 107, 115, 53, 105, 55, 124, 84, 114, 49, 162, 100,
+        232, 92, 104, 93, 5, 116, 2, 187, 17, 28, 164, 66, 68, 32, 86, 54, 106, 7, 127, 77, 61, 178, 116, 34,
+        83, 118, 5, 98, 3, 100, 129, 74, 162, 77, 61, 17, 124, 74, 162, 77, 61, 17, 125, 222, 32, 86, 7, 99,
+        17, 116, 129, 187, 17, 28, 7, 130, 124, 187, 17, 28, 7, 175, 142, 100, 24, 8, 129, 77, 99, 68, 13, 5,
+        100, 57, 8, 218, 101, 3, 100, 124, 77, 99, 68, 13, 5, 100, 127, 66, 3, 98, 28, 133, 142, 110, 116, 105,
+        223, 20, 96, 66, 3, 98, 194, 172, 66, 3, 98, 194, 202, 11, 171, 97, 35, 83, 38, 55, 53, 175, 160, 5,
+        241, 128, 225, 32, 237, 105, 1, 20, 65, 100, 52, 25, 65, 245, 21, 114, 2, 139, 29, 64, 1, 234, 83, 222,
+        32, 76, 250, 105, 93, 30, 114, 13, 191, 121, 20, 70, 242, 10, 5, 204, 244, 108, 18, 175, 230, 151, 206, 11,
+        137, 144, 2, 68, 132, 7, 30, 183, 147, 114, 38, 110, 128, 54, 192, 33, 6, 84, 11, 107, 115, 129, 67, 97,
+        131, 133, 57, 231, 67, 97, 131, 133, 127, 83, 195, 163, 63, 84, 132, 195, 169, 129, 168, 195, 173, 110, 99, 140,
+        101, 124, 168, 195, 173, 110, 99, 140, 34, 72, 144, 94, 144, 64, 3, 116, 7, 30, 157, 3, 111, 101, 127, 139,
+        28, 53, 111, 117, 112, 34, 75, 132, 21, 108, 3, 64, 97, 11, 95, 105, 198, 0, 82, 101, 92, 105, 13, 0,
+        76, 51, 107, 115, 243, 98, 11, 103, 125, 29, 111, 2, 180, 32, 71, 101, 21, 103, 105, 20, 96, 180, 205, 26,
+        119, 254, 57, 231, 180, 205, 26, 119, 254, 127, 70, 114, 181, 8, 122, 32, 80, 39, 7, 191, 121, 185, 89, 153,
+        62, 186, 11, 92, 57, 231, 67, 206, 50, 86, 10, 100, 34, 84, 114, 7, 105, 100, 28, 129, 239, 98, 190, 111,
+        124, 239, 98, 190, 35, 66, 114, 92, 101, 6, 70, 114, 181, 8, 122, 32, 180, 32, 118, 101, 27, 110, 116, 229,
+        116, 30, 160, 203, 63, 82, 30, 35, 75, 8, 98, 114, 8, 115, 126, 76, 51, 98, 110, 22, 74, 29, 97, 30,
+        2, 71, 217, 105, 19, 75, 33, 3, 157, 5, 107, 123, 32, 28, 52, 25, 86, 1, 117, 33, 117, 128, 3, 28,
+        97, 196, 159, 148, 147, 29, 52, 214, 111, 196, 159, 117, 32, 84, 174, 21, 125, 118, 221, 62, 26, 128, 251, 38,
+        116, 157, 105, 106, 6, 240, 105, 94, 5, 242, 216, 83, 108, 59, 17, 19, 136, 115, 134, 62, 157, 62, 49, 7,
+        186, 226, 253, 69, 108, 205, 5, 118, 28, 21, 148, 53, 193, 34, 67, 192, 141, 6, 77, 91, 242, 216, 82, 117,
+        26, 2, 72, 97, 95, 6, 66, 11, 92, 100, 6, 69, 107, 118, 33, 21, 32, 71, 7, 253, 65, 114, 110, 220,
+        141, 108, 117, 107, 125, 39, 132, 13, 127, 69, 114, 109, 17, 60, 76, 130, 178, 104, 35, 66, 53, 155, 30, 93,
+        39, 100, 59, 2, 71, 7, 101, 45, 66, 236, 241, 137, 61, 118, 22, 66, 104, 141, 22, 136, 115, 118, 105, 155,
+        114, 34, 72, 39, 123, 2, 68, 1, 174, 229, 2, 69, 4, 216, 68, 132, 7, 30, 126, 83, 108, 59, 91, 19,
+        75, 111, 4, 20, 82, 30, 183, 133, 110, 97, 45, 72, 10, 115, 207, 149, 8, 114, 118, 33, 60, 239, 103, 35,
+        76, 18, 216, 76, 95, 118, 201, 83, 114, 154, 76, 1, 107, 2, 71, 51, 114, 99, 60, 136, 114, 123, 2, 83,
+        105, 215, 20, 76, 101, 13, 233, 1, 29, 2, 224, 207, 126, 70, 114, 181, 8, 122, 32, 139, 212, 185, 66, 235,
+        153, 30, 27, 134, 112, 32, 69, 109, 235, 30, 175, 6, 65, 252, 11, 19, 65, 122, 10, 98, 61, 99, 22, 83,
+        8, 114, 98, 60, 195, 156, 114, 100, 145, 160, 203, 207, 193, 64, 171, 3, 60, 180, 94, 21, 34, 136, 122, 123,
+        2, 139, 33, 243, 5, 2, 75, 51, 98, 183, 117, 209, 3, 60, 76, 192, 10, 19, 72, 13, 100, 11, 24, 148,
+        17, 7, 0, 69, 248, 114, 34, 77, 5, 220, 6, 75, 225, 94, 21, 34, 78, 30, 3, 190, 117, 2, 89, 92,
+        1, 60, 84, 171, 30, 60, 66, 143, 9, 100, 153, 0, 146, 112, 5, 137, 92, 198, 125, 11, 7, 29, 0, 85,
+        114, 117, 223, 61, 128, 217, 111, 155, 19, 83, 37, 34, 83, 17, 101, 103, 5, 128, 8, 114, 103, 8, 122, 60,
+        66, 38, 221, 32, 82, 198, 19, 139, 212, 2, 76, 97, 133, 0, 82, 132, 201, 71, 1, 2, 85, 103, 26, 183,
+        235, 153, 30, 94, 247, 108, 8, 107, 124, 136, 56, 111, 155, 121, 172, 66, 51, 121, 51, 107, 186, 248, 1, 121,
+        172, 75, 225, 32, 136, 114, 123, 172, 136, 114, 123, 97, 44, 94, 225, 0, 71, 7, 34, 69, 107, 118, 28, 21,
+        148, 33, 8, 205, 147, 114, 2, 71, 170, 13, 0, 240, 154, 90, 53, 26, 183, 11, 107, 7, 20, 70, 24, 35,
+        70, 62, 140, 7, 175, 0, 136, 116, 5, 19, 85, 109, 109, 22, 80, 39, 216, 70, 62, 100, 105, 55, 154, 83,
+        147, 62, 6, 78, 21, 118, 101, 155, 64, 5, 191, 19, 86, 105, 18, 110, 29, 157, 7, 123, 105, 19, 75, 144,
+        111, 45, 66, 134, 122, 122, 220, 62, 108, 34, 65, 108, 109, 201, 74, 206, 216, 90, 174, 98, 170, 118, 233, 3,
+        190, 117, 61, 0, 73, 114, 91, 157, 24, 0, 195, 150, 122, 98, 207, 60, 136, 115, 118, 101, 155, 160, 206, 117,
+        20, 240, 154, 71, 7, 34, 75, 29, 10, 92, 137, 51, 249, 109, 17, 60, 136, 115, 112, 201, 84, 61, 123, 0,
+        89, 243, 17, 157, 114, 181, 164, 5, 26, 127, 75, 17, 19, 66, 178, 115, 118, 1, 93, 28, 190, 24, 107, 3,
+        0, 85, 107, 114, 61, 110, 2, 180, 205, 194, 22, 238, 116, 20, 65, 102, 114, 30, 152, 83, 132, 5, 6, 65,
+        102, 103, 1, 60, 77, 212, 109, 3, 124, 66, 11, 109, 2, 90, 217, 105, 19, 197, 158, 62, 6, 84, 51, 249,
+        31, 233, 91, 60, 77, 111, 122, 217, 30, 200, 29, 192, 19, 86, 17, 191, 117, 53, 2, 78, 105, 106, 10, 19,
+        84, 1, 122, 201, 77, 8, 115, 8, 114, 64, 21, 95, 201, 66, 39, 105, 118, 19, 69, 116, 31, 111, 112, 19,
+        75, 39, 132, 98, 105, 19, 180, 27, 102, 114, 30, 93, 5, 6, 65, 110, 103, 39, 2, 78, 105, 106, 10, 0,
+        224, 28, 160, 10, 117, 64, 111, 196, 159, 39, 60, 136, 114, 22, 76, 192, 19, 83, 194, 22, 69, 245, 13, 191,
+        19, 70, 242, 10, 5, 186, 226, 34, 84, 9, 120, 99, 5, 93, 21, 53, 133, 142, 223, 24, 99, 5, 105, 17,
+        116, 130, 199, 39, 174, 2, 81, 117, 10, 18, 3, 35, 72, 105, 100, 5, 103, 35, 77, 207, 115, 30, 20, 68,
+        244, 108, 18, 137, 170, 24, 107, 35, 78, 61, 3, 95, 0, 139, 1, 97, 106, 117, 33, 35, 80, 117, 101, 98,
+        108, 2, 89, 250, 33, 22, 81, 117, 165, 1, 20, 82, 111, 35, 83, 7, 5, 111, 202, 29, 112, 101, 99, 104,
+        34, 77, 254, 111, 171, 22, 83, 162, 76, 117, 58, 32, 80, 178, 133, 6, 139, 215, 10, 35, 78, 117, 244, 63,
+        76, 101, 13, 148, 97, 106, 232, 5, 105, 102, 21, 110, 208, 86, 10, 171, 114, 211, 199, 104, 105, 206, 24, 148,
+        97, 106, 232, 5, 105, 102, 21, 110, 105, 20, 83, 11, 0, 90, 171, 33, 101, 99, 24, 227, 5, 58, 99, 35,
+        84, 29, 241, 108, 140, 24, 0, 79, 97, 120, 171, 202, 39, 21, 28, 63, 38, 5, 18, 7, 100, 50, 98, 54,
+        32, 55, 101, 104, 54, 199, 111, 147, 117, 62, 2, 83, 13, 21, 202, 104, 105, 104, 117, 147, 117, 2, 187, 213,
+        110, 123, 125, 117, 194, 105, 27, 134, 98, 60, 75, 144, 63, 75, 7, 55, 24, 202, 191, 61, 54, 128, 221, 91,
+        60, 65, 114, 106, 228, 7, 214, 29, 162, 26, 204, 105, 117, 214, 28, 114, 20, 26, 32, 78, 190, 3, 218, 220,
+        53, 6, 67, 104, 26, 105, 103, 3, 104, 142, 245, 29, 1, 129, 78, 30, 111, 98, 3, 0, 76, 91, 115, 104,
+        28, 119, 101, 101, 112, 214, 53, 104, 6, 77, 101, 103, 104, 5, 97, 19, 78, 190, 5, 26, 64, 1, 140, 11,
+        137, 114, 140, 11, 93, 193, 21, 29, 125, 30, 107, 174, 160, 17, 99, 206, 149, 3, 212, 164, 114, 92, 97, 155,
+        5, 32, 168, 28, 153, 142, 115, 115, 29, 148, 105, 104, 3, 0, 85, 116, 116, 229, 26, 0, 71, 111, 2, 75,
+        10, 5, 2, 84, 29, 62, 32, 78, 28, 117, 149, 174, 171, 104, 5, 32, 168, 28, 130, 104, 227, 29, 109, 117,
+        129, 75, 153, 109, 54, 199, 104, 104, 33, 116, 58, 103, 3, 104, 227, 104, 229, 104, 26, 128, 3, 110, 33, 91,
+        2, 82, 97, 106, 97, 4, 104, 22, 79, 100, 58, 104, 172, 238, 236, 2, 139, 106, 3, 33, 148, 33, 8, 186,
+        17, 103, 5, 64, 28, 121, 20, 168, 28, 153, 137, 53, 143, 1, 164, 245, 114, 20, 168, 28, 153, 64, 147, 3,
+        24, 104, 116, 114, 2, 85, 116, 116, 3, 32, 168, 28, 130, 104, 160, 194, 250, 104, 215, 121, 0, 240, 154, 180,
+        32, 71, 5, 175, 142, 252, 247, 121, 20, 66, 97, 55, 107, 17, 116, 186, 226, 253, 74, 10, 118, 58, 186, 61,
+        186, 226, 34, 78, 203, 104, 10, 110, 32, 84, 215, 95, 21, 121, 0, 180, 27, 252, 247, 19, 84, 221, 109, 201,
+        86, 131, 116, 21, 105, 183, 33, 8, 27, 252, 247, 19, 81, 117, 101, 17, 115, 123, 214, 49, 248, 63, 70, 242,
+        10, 5, 125, 10, 103, 140, 34, 65, 9, 103, 111, 24, 0, 82, 105, 63, 100, 50, 74, 1, 101, 54, 35, 69,
+        115, 112, 54, 95, 63, 83, 228, 35, 82, 105, 63, 187, 26, 50, 100, 63, 78, 203, 233, 3, 97, 192, 2, 83,
+        228, 232, 33, 3, 7, 2, 80, 10, 110, 217, 250, 35, 219, 206, 202, 101, 3, 164, 99, 114, 233, 3, 1, 2,
+        82, 21, 97, 174, 2, 82, 13, 100, 13, 208, 83, 97, 63, 80, 241, 108, 35, 80, 105, 241, 6, 239, 99, 228,
+        7, 115, 0, 82, 105, 63, 187, 26, 50, 100, 63, 83, 117, 108, 64, 3, 1, 104, 97, 35, 71, 111, 105, 24,
+        64, 33, 63, 187, 133, 115, 63, 100, 63, 83, 117, 108, 148, 147, 105, 93, 7, 24, 32, 71, 10, 97, 58, 64,
+        33, 63, 187, 133, 115, 63, 100, 35, 80, 3, 195, 161, 142, 109, 221, 13, 24, 128, 39, 36, 98, 31, 20, 66,
+        226, 253, 82, 104, 246, 50, 73, 115, 123, 214, 101, 9, 119, 3, 34, 67, 13, 110, 101, 99, 116, 131, 141, 0,
+        255, 32, 74, 10, 115, 38, 0, 255, 218, 29, 112, 115, 104, 54, 34, 86, 10, 109, 13, 116, 64, 24, 115, 171,
+        104, 198, 18, 116, 115, 149, 97, 119, 97, 105, 6, 237, 121, 123, 0, 87, 101, 4, 32, 86, 54, 103, 7, 208,
+        83, 111, 141, 104, 32, 67, 3, 39, 7, 93, 97, 7, 34, 73, 245, 105, 1, 2, 75, 17, 116, 250, 107, 121,
+        137, 17, 110, 130, 115, 101, 34, 86, 54, 103, 7, 208, 79, 104, 105, 35, 80, 17, 110, 115, 121, 108, 118, 1,
+        105, 93, 236, 236, 140, 112, 6, 76, 111, 117, 58, 105, 1, 164, 9, 98, 29, 164, 249, 181, 24, 200, 203, 104,
+        32, 67, 3, 39, 7, 2, 255, 32, 89, 21, 107, 0, 73, 111, 119, 2, 73, 108, 108, 7, 111, 58, 0, 71,
+        51, 114, 99, 60, 87, 58, 99, 13, 115, 7, 157, 108, 21, 105, 100, 93, 236, 111, 11, 6, 79, 107, 9, 104,
+        132, 2, 78, 203, 104, 204, 91, 178, 2, 87, 24, 104, 151, 116, 13, 125, 111, 141, 104, 204, 91, 178, 2, 146,
+        98, 114, 24, 107, 2, 75, 181, 24, 0, 73, 100, 147, 35, 85, 116, 147, 64, 7, 110, 130, 178, 93, 254, 105,
+        103, 22, 87, 121, 132, 151, 0, 238, 101, 103, 13, 199, 39, 21, 28, 35, 146, 118, 28, 164, 114, 193, 13, 2,
+        255, 32, 77, 101, 120, 131, 35, 77, 13, 116, 1, 202, 5, 105, 102, 21, 110, 208, 84, 101, 120, 24, 142, 9,
+        56, 183, 248, 58, 104, 32, 67, 39, 36, 98, 105, 164, 108, 98, 10, 116, 2, 79, 110, 116, 3, 105, 35, 81,
+        117, 101, 98, 101, 99, 125, 24, 107, 33, 99, 104, 101, 119, 22, 77, 1, 95, 111, 98, 2, 255, 102, 111, 92,
+        100, 123, 0, 240, 154, 98, 114, 92, 115, 119, 131, 107, 200, 59, 20, 83, 99, 178, 208, 168, 17, 115, 32, 69,
+        100, 119, 3, 100, 234, 89, 117, 107, 13, 128, 225, 98, 33, 8, 32, 98, 226, 253, 78, 92, 220, 141, 149, 7,
+        100, 60, 65, 252, 247, 19, 66, 114, 191, 62, 19, 65, 66, 68, 124, 219, 10, 30, 20, 66, 235, 153, 30, 204,
+        244, 108, 18, 175, 105, 124, 219, 10, 30, 93, 207, 115, 30, 93, 111, 56, 59, 2, 80, 18, 10, 115, 98, 11,
+        103, 128, 5, 7, 151, 114, 28, 23, 136, 110, 223, 55, 18, 121, 152, 65, 100, 105, 103, 38, 126, 75, 225, 12,
+        115, 18, 121, 97, 45, 65, 108, 1, 105, 152, 75, 170, 3, 100, 38, 45, 66, 5, 107, 3, 126, 75, 3, 97,
+        155, 61, 45, 224, 10, 107, 130, 126, 224, 101, 155, 17, 126, 224, 251, 97, 55, 126, 73, 118, 1, 59, 111, 23,
+        76, 140, 18, 138, 238, 121, 39, 23, 84, 117, 9, 23, 66, 53, 103, 21, 246, 184, 86, 9, 100, 174, 54, 23,
+        75, 11, 138, 75, 5, 117, 103, 97, 184, 84, 217, 59, 184, 66, 114, 212, 138, 89, 3, 133, 9, 118, 108, 23,
+        82, 121, 221, 1, 184, 65, 4, 114, 91, 104, 1, 23, 77, 133, 99, 111, 119, 23, 83, 109, 39, 17, 138, 68,
+        97, 196, 159, 8, 4, 1, 126, 86, 21, 13, 191, 104, 23, 78, 59, 103, 21, 246, 23, 80, 56, 59, 23, 75,
+        111, 4, 114, 132, 97, 23, 83, 116, 220, 114, 111, 112, 39, 189, 75, 114, 24, 110, 246, 3, 189, 75, 5, 109,
+        121, 107, 105, 152, 84, 118, 10, 23, 76, 17, 151, 114, 28, 23, 82, 111, 4, 59, 23, 86, 39, 103, 111, 103,
+        114, 28, 0, 86, 39, 111, 103, 100, 97, 23, 77, 11, 109, 1, 138, 75, 3, 53, 121, 152, 78, 17, 18, 115,
+        32, 195, 150, 122, 10, 107, 12, 107, 114, 117, 223, 128, 132, 154, 82, 101, 112, 117, 98, 108, 131, 142, 249, 104,
+        143, 53, 138, 77, 21, 100, 59, 121, 152, 78, 105, 106, 110, 31, 32, 78, 59, 103, 21, 246, 184, 80, 17, 122,
+        97, 23, 75, 54, 59, 23, 237, 154, 69, 108, 126, 238, 17, 98, 11, 103, 23, 85, 108, 212, 59, 138, 80, 10,
+        109, 189, 66, 97, 55, 107, 203, 111, 4, 1, 126, 85, 100, 109, 11, 116, 32, 82, 101, 112, 117, 98, 108, 131,
+        137, 33, 3, 49, 1, 126, 83, 29, 3, 97, 23, 83, 3, 33, 59, 23, 89, 29, 5, 111, 45, 78, 17, 18,
+        115, 149, 228, 105, 45, 77, 181, 230, 118, 10, 100, 108, 59, 138, 84, 121, 36, 17, 23, 75, 11, 103, 1, 23,
+        67, 104, 53, 121, 170, 7, 56, 148, 11, 121, 33, 105, 152, 90, 170, 61, 107, 5, 56, 121, 189, 73, 249, 141,
+        138, 78, 59, 133, 192, 54, 138, 84, 132, 138, 79, 109, 138, 72, 91, 24, 121, 152, 75, 243, 10, 59, 111, 184,
+        65, 108, 116, 61, 126, 65, 108, 116, 97, 105, 189, 84, 251, 152, 75, 114, 24, 110, 111, 121, 3, 56, 189, 77,
+        190, 28, 1, 184, 67, 104, 117, 107, 178, 107, 97, 12, 107, 114, 117, 103, 128, 29, 99, 104, 33, 107, 20, 75,
+        179, 83, 91, 104, 5, 7, 23, 168, 174, 21, 56, 121, 189, 89, 147, 194, 154, 195, 150, 122, 10, 107, 184, 75,
+        104, 170, 3, 59, 56, 189, 219, 11, 23, 89, 91, 141, 49, 1, 124, 89, 91, 141, 105, 152, 75, 1, 28, 2,
+        82, 198, 19, 197, 158, 143, 61, 137, 105, 1, 106, 7, 160, 207, 7, 149, 97, 7, 22, 78, 151, 120, 105, 20,
+        72, 117, 6, 67, 104, 144, 113, 151, 0, 90, 104, 101, 106, 105, 143, 227, 105, 143, 115, 117, 157, 117, 106, 105,
+        22, 65, 110, 104, 117, 6, 76, 105, 97, 13, 151, 125, 104, 26, 144, 125, 104, 1, 120, 6, 74, 105, 143, 120,
+        6, 72, 17, 22, 139, 193, 104, 111, 117, 0, 139, 143, 100, 144, 149, 117, 98, 101, 6, 74, 62, 7, 149, 101,
+        98, 101, 230, 104, 97, 1, 120, 6, 146, 154, 77, 144, 39, 124, 73, 110, 110, 10, 32, 77, 144, 39, 208, 72,
+        101, 62, 144, 106, 105, 143, 149, 92, 22, 139, 143, 107, 115, 230, 254, 117, 22, 89, 92, 110, 22, 88, 193, 143,
+        124, 84, 192, 18, 0, 71, 181, 117, 0, 81, 151, 104, 97, 230, 7, 99, 162, 85, 121, 103, 11, 0, 224, 7,
+        218, 5, 107, 126, 219, 10, 30, 20, 66, 235, 153, 30, 204, 244, 108, 18, 175, 105, 94, 51, 155, 51, 107, 204,
+        8, 55, 127, 67, 108, 140, 112, 10, 116, 13, 234, 65, 110, 116, 229, 116, 30, 2, 85, 108, 198, 108, 3, 3,
+        24, 231, 68, 145, 19,
+};
+
+static const unsigned char TERRITORY_NAMES_PAIRS_TR[256][2] = {
+        {0, 0}, {97, 110}, {97, 0}, {97, 114}, {115, 116}, {97, 108}, {105, 0}, {105, 110}, {196, 177}, {108, 97}, {101, 114}, {117, 114},
+        {32, 79}, {111, 110}, {9, 4}, {12, 98}, {15, 14}, {101, 110}, {101, 116}, {121, 2}, {97, 32}, {111, 114}, {1, 0}, {16, 0},
+        {97, 115}, {8, 0}, {1, 100}, {32, 65}, {97, 100}, {97, 109}, {105, 107}, {105, 121}, {32, 32}, {97, 116}, {101, 0}, {111, 0},
+        {117, 109}, {11, 31}, {101, 121}, {111, 108}, {18, 6}, {27, 100}, {36, 104}, {37, 40}, {44, 44}, {45, 45}, {46, 46}, {42, 43},
+        {67, 47}, {105, 4}, {101, 32}, {195, 188}, {5, 3}, {101, 108}, {105, 114}, {197, 159}, {115, 107}, {41, 52}, {105, 115}, {111, 118},
+        {49, 22}, {97, 121}, {105, 108}, {111, 32}, {0, 77}, {65, 65}, {66, 66}, {67, 67}, {68, 68}, {69, 69}, {70, 70}, {71, 71},
+        {72, 72}, {73, 73}, {74, 74}, {75, 75}, {76, 76}, {77, 77}, {78, 78}, {79, 79}, {80, 80}, {81, 81}, {82, 82}, {83, 83},
+        {84, 84}, {85, 85}, {86, 86}, {87, 87}, {88, 88}, {89, 89}, {90, 90}, {97, 107}, {117, 110}, {2, 77}, {32, 75}, {105, 116},
+        {118, 50}, {97, 97}, {98, 98}, {99, 99}, {100, 100}, {101, 101}, {102, 102}, {103, 103}, {104, 104}, {105, 105}, {106, 106}, {107, 107},
+        {108, 108}, {109, 109}, {110, 110}, {111, 111}, {112, 112}, {113, 113}, {114, 114}, {115, 115}, {116, 116}, {117, 117}, {118, 118}, {119, 119},
+        {120, 120}, {121, 121}, {122, 122}, {108, 26}, {124, 124}, {0, 83}, {32, 48}, {57, 25}, {0, 75}, {32, 96}, {101, 115}, {105, 99},
+        {111, 109}, {111, 115}, {114, 97}, {135, 135}, {196, 176}, {0, 84}, {56, 23}, {71, 117}, {105, 112}, {117, 116}, {0, 65}, {1, 103},
+        {13, 103}, {51, 110}, {78, 101}, {97, 104}, {0, 66}, {0, 72}, {150, 150}, {7, 103}, {20, 48}, {101, 55}, {105, 32}, {195, 167},
+        {156, 156}, {0, 70}, {158, 158}, {159, 159}, {0, 80}, {161, 161}, {1, 32}, {163, 163}, {2, 65}, {7, 116}, {71, 145}, {167, 167},
+        {80, 114}, {169, 169}, {97, 98}, {97, 99}, {97, 124}, {173, 173}, {105, 109}, {108, 10}, {176, 176}, {177, 177}, {111, 116}, {134, 6},
+        {166, 38}, {1, 115}, {182, 182}, {2, 66}, {16, 25}, {24, 25}, {32, 66}, {71, 114}, {188, 188}, {94, 179}, {97, 103}, {101, 122},
+        {105, 98}, {105, 122}, {117, 100}, {195, 195}, {196, 196}, {197, 197}, {117, 115}, {0, 67}, {0, 78}, {1, 19}, {2, 67}, {21, 116},
+        {32, 68}, {32, 83}, {97, 112}, {101, 107}, {105, 2}, {108, 103}, {117, 4}, {117, 122}, {121, 1}, {195, 182}, {0, 68}, {10, 114},
+        {13, 19}, {29, 98}, {32, 72}, {65, 109}, {97, 118}, {97, 122}, {97, 165}, {103, 117}, {195, 135}, {211, 38}, {213, 209}, {0, 74},
+        {1, 116}, {3, 107}, {6, 83}, {8, 124}, {20, 67}, {34, 80}, {41, 185}, {54, 108}, {58, 115}, {77, 3}, {79, 114}, {84, 111},
+        {89, 17}, {97, 117}, {101, 100}, {101, 109}, {101, 118}, {110, 100}, {111, 100}, {114, 5}, {114, 95}, {114, 107}, {117, 99}, {117, 118},
+        {118, 210}, {130, 6}, {131, 104}, {146, 119},
+};
+
+static const unsigned short TERRITORY_NAME_ALTERNATIVES_START_TR[_TERRITORY_MAX - _TERRITORY_MIN] = {
+        0, 2, 3, 4, 5, 7, 8, 9, 10, 11, 12, 13, 15, 16, 17, 18,
+        19, 20, 21, 22, 23, 24, 25, 27, 28, 29, 30, 31, 32, 33, 35, 36,
+        38, 39, 42, 43, 46, 47, 48, 49, 50, 52, 54, 56, 57, 59, 60, 61,
+        62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 75, 77, 78, 79,
+        80, 81, 82, 83, 84, 85, 86, 88, 89, 91, 93, 94, 95, 96, 97, 98,
+        99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114,
+        115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130,
+        131, 132, 133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143, 144, 145, 146,
+        147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159, 160, 161, 162,
+        163, 164, 165, 166, 167, 168, 169, 170, 171, 172, 173, 174, 175, 176, 177, 178,
+        179, 180, 181, 182, 183, 184, 185, 190, 191, 192, 193, 194, 195, 196, 197, 198,
+        199, 200, 201, 202, 203, 204, 205, 206, 207, 208, 209, 210, 211, 212, 213, 214,
+        215, 216, 217, 218, 219, 220, 221, 222, 223, 224, 225, 226, 227, 228, 229, 230,
+        232, 233, 234, 235, 236, 237, 238, 239, 240, 241, 242, 243, 244, 245, 246, 247,
+        248, 249, 250, 251, 252, 253, 254, 255, 256, 257, 258, 259, 260, 261, 262, 263,
+        264, 265, 266, 267, 268, 269, 270, 271, 272, 273, 274, 275, 276, 277, 278, 279,
+        280, 281, 282, 283, 284, 285, 286, 287, 288, 289, 290, 291, 292, 293, 294, 295,
+        296, 297, 298, 299, 300, 301, 302, 303, 304, 305, 306, 307, 308, 309, 310, 311,
+        312, 313, 314, 315, 316, 317, 318, 319, 320, 321, 322, 324, 325, 326, 327, 328,
+        329, 330, 331, 332, 333, 334, 335, 336, 337, 338, 339, 340, 341, 342, 343, 344,
+        345, 346, 347, 348, 349, 350, 351, 352, 353, 354, 355, 356, 357, 358, 359, 360,
+        361, 362, 363, 364, 365, 366, 367, 368, 369, 370, 371, 372, 373, 374, 375, 376,
+        377, 378, 379, 380, 381, 382, 383, 384, 385, 386, 387, 388, 389, 390, 391, 392,
+        393, 394, 395, 396, 397, 398, 399, 400, 401, 402, 403, 404, 405, 406, 407, 408,
+        409, 410, 411, 412, 413, 414, 415, 416, 417, 418, 419, 420, 421, 422, 423, 424,
+        425, 426, 427, 428, 429, 430, 431, 432, 433, 434, 435, 438, 439, 440, 441, 442,
+        443, 444, 445, 446, 447, 448, 449, 450, 451, 452, 453, 454, 455, 456, 457, 458,
+        459, 460, 461, 462, 463, 464, 465, 466, 467, 468, 469, 470, 471, 472, 473, 474,
+        475, 476, 477, 478, 479, 480, 481, 482, 483, 484, 485, 486, 487, 488, 489, 490,
+        491, 492, 493, 494, 495, 496, 497, 498, 499, 500, 501, 502, 503, 504, 505, 506,
+        507, 508, 509, 510, 511, 512, 513, 514, 515, 516, 517, 518, 519, 520, 521, 523,
+        524, 525, 526, 527, 528, 529, 530, 531, 532, 533, 534, 535, 536, 537, 538, 539,
+        540, 541, 542, 543, 544, 545, 546, 548, 549, 550, 551, 552, 553, 555, 556, 557,
+        558, 559, 560, 561, 562, 564,
+};
+
+static const TerritoryNameAlternative TERRITORY_NAME_ALTERNATIVES_TR[564] = {
+        {0, 7, 0}, {8, 8, 0}, {17, 6, 0}, {24, 12, 0}, {37, 7, 0}, {45, 14, 0}, {60, 16, 0}, {77, 16, 0},
+        {94, 5, 0}, {100, 6, 0}, {107, 5, 0}, {113, 12, 0}, {126, 12, 0}, {139, 24, 0}, {164, 13, 0}, {178, 17, 0},
+        {196, 13, 0}, {210, 7, 0}, {218, 34, 0}, {253, 10, 0}, {264, 8, 0}, {273, 8, 0}, {282, 10, 0}, {293, 6, 0},
+        {300, 11, 0}, {312, 16, 0}, {329, 6, 0}, {336, 24, 0}, {361, 12, 0}, {374, 5, 0}, {380, 16, 0}, {397, 17, 0},
+        {415, 13, 0}, {429, 23, 0}, {453, 8, 0}, {462, 4, 0}, {467, 20, 0}, {488, 5, 0}, {494, 15, 0}, {510, 30, 0},
+        {541, 4, 0}, {546, 12, 0}, {559, 9, 0}, {569, 43, 0}, {613, 10, 0}, {624, 16, 0}, {641, 5, 0}, {647, 7, 0},
+        {655, 19, 0}, {675, 7, 0}, {683, 21, 0}, {705, 9, 0}, {715, 27, 0}, {743, 11, 0}, {755, 33, 0}, {789, 17, 0},
+        {807, 8, 0}, {816, 18, 0}, {835, 7, 0}, {843, 7, 0}, {851, 10, 0}, {862, 5, 0}, {868, 22, 0}, {891, 7, 0},
+        {899, 4, 0}, {904, 10, 0}, {915, 11, 0}, {927, 29, 0}, {957, 8, 0}, {966, 5, 0}, {972, 8, 0}, {981, 7, 0},
+        {989, 8, 0}, {998, 24, 0}, {1023, 15, 0}, {1039, 23, 0}, {1063, 9, 0}, {1073, 9, 0}, {1083, 8, 0}, {1092, 14, 0},
+        {1107, 10, 0}, {1118, 8, 0}, {1127, 9, 0}, {1137, 7, 0}, {1145, 11, 0}, {1157, 5, 0}, {1163, 42, 0}, {1206, 24, 0},
+        {1231, 21, 0}, {1253, 21, 0}, {1275, 10, 0}, {1286, 18, 0}, {1305, 6, 0}, {1312, 6, 0}, {1319, 28, 0}, {1348, 10, 0},
+        {1359, 20, 0}, {1380, 7, 0}, {1388, 7, 0}, {1396, 7, 0}, {1404, 5, 0}, {1410, 17, 0}, {1428, 7, 0}, {1436, 8, 0},
+        {1445, 9, 0}, {1455, 11, 0}, {1467, 9, 0}, {1477, 6, 0}, {1484, 4, 0}, {1489, 14, 0}, {1504, 8, 0}, {1513, 7, 0},
+        {1521, 17, 0}, {1539, 11, 0}, {1551, 6, 0}, {1558, 6, 0}, {1565, 9, 0}, {1575, 6, 0}, {1582, 5, 0}, {1588, 7, 0},
+        {1596, 14, 0}, {1611, 10, 0}, {1622, 16, 0}, {1639, 10, 0}, {1650, 7, 0}, {1658, 8, 0}, {1667, 7, 0}, {1675, 11, 0},
+        {1687, 6, 0}, {1694, 6, 0}, {1701, 9, 0}, {1711, 8, 0}, {1720, 9, 0}, {1730, 7, 0}, {1738, 19, 0}, {1758, 8, 0},
+        {1767, 10, 0}, {1778, 12, 0}, {1791, 12, 0}, {1804, 4, 0}, {1809, 7, 0}, {1817, 8, 0}, {1826, 9, 0}, {1836, 10, 0},
+        {1847, 8, 0}, {1856, 12, 0}, {1869, 6, 0}, {1876, 16, 0}, {1893, 18, 0}, {1912, 26, 0}, {1939, 9, 0}, {1949, 10, 0},
+        {1960, 10, 0}, {1971, 7, 0}, {1979, 8, 0}, {1988, 10, 0}, {1999, 11, 0}, {2011, 8, 0}, {2020, 9, 0}, {2030, 5, 0},
+        {2036, 11, 0}, {2048, 7, 0}, {2056, 8, 0}, {2065, 5, 0}, {2071, 6, 0}, {2078, 6, 0}, {2085, 10, 0}, {2096, 9, 0},
+        {2106, 10, 0}, {2117, 10, 0}, {2128, 10, 0}, {2139, 5, 0}, {2145, 5, 0}, {2151, 7, 0}, {2159, 7, 0}, {2167, 9, 0},
+        {2177, 6, 0}, {2184, 7, 0}, {2192, 13, 0}, {2206, 11, 0}, {2218, 6, 0}, {2225, 4, 0}, {2230, 7, 0}, {2238, 4, 0},
+        {2243, 6, 0}, {2250, 18, 0}, {2269, 9, 0}, {2279, 16, 0}, {2296, 14, 0}, {2311, 15, 0}, {2327, 4, 0}, {2332, 7, 0},
+        {2340, 11, 0}, {2352, 5, 0}, {2358, 12, 0}, {2371, 12, 0}, {2384, 10, 0}, {2395, 7, 0}, {2403, 5, 0}, {2409, 7, 0},
+        {2417, 15, 0}, {2433, 7, 0}, {2441, 7, 0}, {2449, 7, 0}, {2457, 10, 0}, {2468, 17, 0}, {2486, 7, 0}, {2494, 7, 0},
+        {2502, 8, 0}, {2511, 8, 0}, {2520, 4, 0}, {2525, 3, 0}, {2529, 11, 0}, {2541, 7, 0}, {2549, 15, 0}, {2565, 7, 0},
+        {2573, 13, 0}, {2587, 8, 0}, {2596, 7, 0}, {2604, 5, 0}, {2610, 6, 0}, {2617, 15, 0}, {2633, 5, 0}, {2639, 8, 0},
+        {2648, 10, 0}, {2659, 7, 0}, {2667, 12, 0}, {2680, 23, 0}, {2704, 6, 0}, {2711, 10, 0}, {2722, 7, 0}, {2730, 5, 0},
+        {2736, 7, 0}, {2744, 5, 0}, {2750, 8, 0}, {2759, 8, 0}, {2768, 8, 0}, {2777, 7, 0}, {2785, 9, 0}, {2795, 7, 0},
+        {2803, 8, 0}, {2812, 7, 0}, {2820, 9, 0}, {2830, 7, 0}, {2838, 8, 0}, {2847, 9, 0}, {2857, 13, 0}, {2871, 4, 0},
+        {2876, 6, 0}, {2883, 5, 0}, {2889, 4, 0}, {2894, 4, 0}, {2899, 11, 0}, {2911, 5, 0}, {2917, 5, 0}, {2923, 5, 0},
+        {2929, 9, 0}, {2939, 14, 0}, {2954, 8, 0}, {2963, 7, 0}, {2971, 14, 0}, {2986, 6, 0}, {2993, 9, 0}, {3003, 7, 0},
+        {3011, 14, 0}, {3026, 7, 0}, {3034, 7, 0}, {3042, 10, 0}, {3053, 6, 0}, {3060, 7, 0}, {3068, 12, 0}, {3081, 7, 0},
+        {3089, 8, 0}, {3098, 9, 0}, {3108, 15, 0}, {3124, 8, 0}, {3133, 10, 0}, {3144, 15, 0}, {3160, 8, 0}, {3169, 7, 0},
+        {3177, 19, 0}, {3197, 9, 0}, {3207, 7, 0}, {3215, 10, 0}, {3226, 6, 0}, {3233, 30, 0}, {3264, 8, 0}, {3273, 6, 0},
+        {3280, 9, 0}, {3290, 9, 0}, {3300, 15, 0}, {3316, 14, 0}, {3331, 7, 0}, {3339, 10, 0}, {3350, 8, 0}, {3359, 13, 0},
+        {3373, 22, 0}, {3396, 10, 0}, {3407, 18, 0}, {3426, 11, 0}, {3438, 5, 0}, {3444, 9, 0}, {3454, 8, 0}, {3463, 7, 0},
+        {3471, 7, 0}, {3479, 7, 0}, {3487, 6, 0}, {3494, 6, 0}, {3501, 7, 0}, {3509, 17, 0}, {3527, 5, 0}, {3533, 5, 0},
+        {3539, 9, 0}, {3549, 3, 0}, {3553, 6, 0}, {3560, 10, 0}, {3571, 16, 0}, {3588, 16, 0}, {3605, 12, 0}, {3618, 9, 0},
+        {3628, 9, 0}, {3638, 9, 0}, {3648, 6, 0}, {3655, 6, 0}, {3662, 7, 0}, {3670, 12, 0}, {3683, 13, 0}, {3697, 9, 0},
+        {3707, 13, 0}, {3721, 11, 0}, {3733, 13, 0}, {3747, 10, 0}, {3758, 18, 0}, {3777, 28, 0}, {3806, 17, 0}, {3824, 18, 0},
+        {3843, 17, 0}, {3861, 8, 0}, {3870, 8, 0}, {3879, 16, 0}, {3896, 10, 0}, {3907, 16, 0}, {3924, 7, 0}, {3932, 7, 0},
+        {3940, 14, 0}, {3955, 14, 0}, {3970, 19, 0}, {3990, 7, 0}, {3998, 14, 0}, {4013, 10, 0}, {4024, 5, 0}, {4030, 5, 0},
+        {4036, 4, 0}, {4041, 6, 0}, {4048, 7, 0}, {4056, 8, 0}, {4065, 9, 0}, {4075, 5, 0}, {4081, 9, 0}, {4091, 17, 0},
+        {4109, 8, 0}, {4118, 5, 0}, {4124, 18, 0}, {4143, 5, 0}, {4149, 12, 0}, {4162, 14, 0}, {4177, 5, 0}, {4183, 8, 0},
+        {4192, 18, 0}, {4211, 12, 0}, {4224, 8, 0}, {4233, 11, 0}, {4245, 10, 0}, {4256, 13, 0}, {4270, 7, 0}, {4278, 13, 0},
+        {4292, 6, 0}, {4299, 8, 0}, {4308, 13, 0}, {4322, 14, 0}, {4337, 5, 0}, {4343, 7, 0}, {4351, 8, 0}, {4360, 9, 0},
+        {4370, 8, 0}, {4379, 4, 0}, {4384, 12, 0}, {4397, 11, 0}, {4409, 9, 0}, {4419, 7, 0}, {4427, 8, 0}, {4436, 14, 0},
+        {4451, 8, 0}, {4460, 4, 0}, {4465, 8, 0}, {4474, 10, 0}, {4485, 9, 0}, {4495, 7, 0}, {4503, 8, 0}, {4512, 8, 0},
+        {4521, 12, 0}, {4534, 10, 0}, {4545, 12, 0}, {4558, 8, 0}, {4567, 6, 0}, {4574, 5, 0}, {4580, 4, 0}, {4585, 9, 0},
+        {4595, 8, 0}, {4604, 7, 0}, {4612, 6, 0}, {4619, 8, 0}, {4628, 6, 0}, {4635, 7, 0}, {4643, 10, 0}, {4654, 7, 0},
+        {4662, 10, 0}, {4673, 5, 0}, {4679, 6, 0}, {4686, 16, 0}, {4703, 7, 0}, {4711, 7, 0}, {4719, 6, 0}, {4726, 12, 0},
+        {4739, 8, 0}, {4748, 12, 0}, {4761, 14, 0}, {4776, 11, 0}, {4788, 19, 0}, {4808, 5, 0}, {4814, 19, 0}, {4834, 7, 0},
+        {4842, 9, 0}, {4852, 10, 0}, {4863, 8, 0}, {4872, 3, 0}, {4876, 28, 0}, {4905, 7, 0}, {4913, 7, 0}, {4921, 7, 0},
+        {4929, 10, 0}, {4940, 18, 0}, {4959, 23, 0}, {4983, 18, 0}, {5002, 31, 0}, {5034, 27, 0}, {5062, 28, 0}, {5091, 19, 0},
+        {5111, 19, 0}, {5131, 14, 0}, {5146, 14, 0}, {5161, 12, 0}, {5174, 11, 0}, {5186, 17, 0}, {5204, 15, 0}, {5220, 12, 0},
+        {5233, 15, 0}, {5249, 15, 0}, {5265, 14, 0}, {5280, 16, 0}, {5297, 15, 0}, {5313, 16, 0}, {5330, 13, 0}, {5344, 15, 0},
+        {5360, 22, 0}, {5383, 15, 0}, {5399, 15, 0}, {5415, 12, 0}, {5428, 15, 0}, {5444, 14, 0}, {5459, 14, 0}, {5474, 20, 0},
+        {5495, 11, 0}, {5507, 16, 0}, {5524, 13, 0}, {5538, 9, 0}, {5548, 14, 0}, {5563, 15, 0}, {5579, 19, 0}, {5599, 20, 0},
+        {5620, 13, 0}, {5634, 18, 0}, {5653, 20, 0}, {5674, 24, 0}, {5699, 12, 0}, {5712, 12, 0}, {5725, 19, 0}, {5745, 15, 0},
+        {5761, 16, 0}, {5778, 9, 0}, {5788, 25, 0}, {5814, 15, 0}, {5830, 22, 0}, {5853, 13, 0}, {5867, 14, 0}, {5882, 13, 0},
+        {5896, 11, 0}, {5908, 17, 0}, {5926, 13, 0}, {5940, 13, 0}, {5954, 11, 0}, {5966, 20, 0}, {5987, 16, 0}, {6004, 14, 0},
+        {6019, 18, 0}, {6038, 12, 0}, {6051, 11, 0}, {6063, 19, 0}, {6083, 17, 0}, {6101, 17, 0}, {6119, 10, 0}, {6130, 16, 0},
+        {6147, 16, 0}, {6164, 16, 0}, {6181, 14, 0}, {6196, 14, 0}, {6211, 15, 0}, {6227, 14, 0}, {6242, 22, 0}, {6265, 15, 0},
+        {6281, 11, 0}, {6293, 10, 0}, {6304, 19, 0}, {6324, 6, 0}, {6331, 5, 0}, {6337, 7, 0}, {6345, 7, 0}, {6353, 5, 0},
+        {6359, 6, 0}, {6366, 11, 0}, {6378, 9, 0}, {6388, 8, 0}, {6397, 7, 0}, {6405, 6, 0}, {6412, 5, 0}, {6418, 8, 0},
+        {6427, 8, 0}, {6436, 6, 0}, {6443, 7, 0}, {6451, 5, 0}, {6457, 7, 0}, {6465, 9, 0}, {6475, 5, 0}, {6481, 5, 0},
+        {6487, 5, 0}, {6493, 7, 0}, {6501, 10, 0}, {6512, 14, 0}, {6527, 12, 0}, {6540, 5, 0}, {6546, 8, 0}, {6555, 7, 0},
+        {6563, 6, 0}, {6570, 6, 0}, {6577, 5, 0}, {6583, 5, 0}, {6589, 7, 0}, {6597, 12, 0}, {6610, 21, 0}, {6632, 52, 0},
+        {6685, 17, 0}, {6703, 10, 0}, {6714, 13, 0}, {6728, 6, 0},
+};
+
+static char TERRITORY_NAMES_UNPACKED_TR[6735];
+
+static const PackedTerritoryNames PACKED_TERRITORY_NAMES_TR = {
+        TERRITORY_NAMES_UNPACKED_TR, 6735, TERRITORY_NAMES_PACKED_TR, 3413, TERRITORY_NAMES_PAIRS_TR,
+        TERRITORY_NAME_ALTERNATIVES_START_TR, TERRITORY_NAME_ALTERNATIVES_TR};
+
+#else
+
+static const PackedTerritoryNames PACKED_TERRITORY_NAMES_TR = {NULL, 0, NULL, 0, NULL, NULL, NULL};
+
+#endif // MAPCODE_SUPPORT_LANGUAGE_TR
+
+#ifdef MAPCODE_SUPPORT_LANGUAGE_UK // Ukrainian
+
+// 13202 bytes, packed to 3664
+static const unsigned char TERRITORY_NAMES_PACKED_UK[3664] = {
+        208, 156, 4, 22, 5, 20, 146, 81, 118, 18, 58, 161, 14, 17, 9, 66, 20, 159, 6, 8, 22, 64, 69, 43,
+        194, 95, 147, 4, 19, 192, 9, 49, 113, 5, 10, 83, 226, 75, 5, 10, 98, 39, 87, 58, 154, 106, 40, 28,
+        30, 62, 39, 236, 31, 35, 145, 49, 9, 83, 12, 25, 59, 157, 1, 90, 13, 113, 13, 14, 53, 13, 69, 1,
+        21, 5, 65, 40, 9, 35, 156, 1, 49, 9, 31, 65, 31, 35, 156, 49, 9, 31, 123, 52, 193, 64, 10, 93,
+        164, 106, 199, 35, 144, 26, 251, 58, 164, 106, 199, 35, 144, 26, 251, 214, 4, 9, 10, 41, 3, 2, 190, 62,
+        57, 20, 145, 13, 14, 8, 104, 41, 25, 253, 139, 104, 229, 18, 38, 237, 41, 100, 52, 152, 32, 14, 20, 134,
+        244, 4, 26, 55, 99, 13, 30, 10, 8, 18, 59, 161, 18, 32, 45, 20, 156, 49, 40, 95, 147, 41, 3, 246,
+        144, 3, 28, 106, 12, 24, 156, 43, 7, 41, 34, 9, 196, 70, 41, 246, 190, 62, 57, 32, 228, 50, 15, 14,
+        29, 163, 64, 11, 115, 93, 164, 218, 13, 63, 58, 225, 144, 193, 6, 16, 21, 104, 229, 18, 55, 60, 239, 28,
+        40, 139, 58, 239, 28, 40, 139, 44, 20, 145, 229, 18, 55, 59, 155, 4, 54, 9, 31, 85, 9, 107, 3, 92,
+        117, 19, 204, 49, 85, 53, 11, 39, 87, 92, 25, 41, 118, 18, 55, 8, 20, 161, 71, 5, 242, 161, 71, 5,
+        1, 44, 20, 144, 25, 41, 118, 18, 55, 8, 2, 190, 80, 202, 13, 21, 65, 31, 205, 96, 212, 6, 93, 156,
+        116, 83, 43, 58, 156, 116, 83, 43, 123, 4, 13, 8, 65, 171, 35, 154, 4, 9, 7, 93, 157, 231, 115, 58,
+        157, 231, 115, 75, 79, 25, 18, 39, 87, 104, 43, 79, 6, 8, 44, 20, 161, 171, 35, 149, 22, 81, 4, 13,
+        7, 93, 161, 122, 242, 161, 122, 242, 161, 171, 35, 149, 22, 81, 4, 13, 7, 69, 223, 15, 57, 16, 65, 14,
+        17, 9, 5, 103, 20, 132, 11, 31, 16, 44, 20, 146, 5, 50, 3, 61, 40, 3, 17, 93, 162, 228, 234, 45,
+        15, 227, 154, 126, 12, 17, 58, 146, 5, 50, 3, 61, 40, 3, 17, 58, 162, 228, 234, 45, 15, 227, 154, 126,
+        12, 24, 156, 223, 9, 29, 210, 31, 86, 221, 25, 41, 118, 18, 55, 60, 239, 28, 40, 139, 58, 239, 28, 40,
+        139, 44, 20, 161, 208, 168, 208, 144, 69, 79, 169, 9, 29, 168, 37, 4, 88, 19, 41, 28, 31, 93, 175, 3,
+        35, 156, 1, 212, 3, 58, 175, 3, 35, 156, 1, 212, 3, 65, 171, 35, 146, 40, 7, 171, 93, 210, 31, 86,
+        40, 16, 58, 210, 31, 86, 40, 16, 2, 158, 62, 57, 20, 165, 41, 15, 32, 87, 20, 156, 194, 15, 43, 223,
+        15, 58, 156, 194, 15, 43, 223, 15, 104, 49, 19, 86, 98, 92, 3, 249, 28, 13, 1, 93, 145, 49, 19, 253,
+        242, 145, 49, 19, 253, 29, 187, 116, 41, 173, 141, 34, 7, 5, 65, 107, 85, 83, 12, 139, 214, 53, 226, 2,
+        224, 245, 156, 49, 4, 18, 139, 0, 76, 52, 6, 29, 147, 13, 71, 2, 158, 62, 57, 20, 156, 31, 65, 171,
+        35, 155, 141, 7, 27, 156, 116, 6, 43, 8, 50, 152, 58, 164, 8, 127, 34, 249, 14, 245, 168, 9, 81, 16,
+        20, 156, 116, 6, 43, 8, 50, 4, 103, 65, 40, 28, 1, 67, 6, 113, 43, 28, 29, 148, 99, 40, 68, 104,
+        89, 6, 107, 3, 75, 105, 4, 19, 81, 59, 158, 80, 20, 162, 41, 10, 7, 93, 154, 79, 10, 98, 58, 154,
+        79, 10, 98, 65, 18, 35, 162, 99, 8, 93, 159, 6, 40, 7, 199, 4, 58, 159, 6, 40, 7, 199, 59, 147,
+        43, 10, 43, 28, 69, 49, 9, 109, 141, 10, 114, 49, 41, 139, 112, 14, 86, 83, 13, 37, 203, 99, 52, 139,
+        69, 111, 6, 118, 4, 26, 2, 178, 5, 50, 50, 96, 212, 15, 3, 18, 3, 24, 155, 141, 10, 7, 247, 19,
+        90, 28, 65, 71, 5, 29, 225, 148, 70, 52, 15, 70, 152, 237, 241, 121, 245, 161, 76, 14, 4, 56, 231, 87,
+        58, 121, 245, 161, 76, 14, 4, 56, 231, 87, 114, 6, 18, 88, 13, 50, 12, 21, 20, 159, 64, 40, 8, 50,
+        219, 122, 125, 146, 41, 127, 113, 6, 16, 97, 15, 86, 93, 162, 5, 19, 195, 5, 58, 162, 5, 19, 195, 95,
+        145, 117, 3, 107, 114, 6, 18, 88, 13, 50, 12, 10, 60, 121, 97, 237, 241, 144, 3, 9, 49, 10, 249, 56,
+        245, 183, 247, 11, 59, 159, 13, 41, 9, 5, 20, 160, 116, 5, 75, 199, 6, 2, 155, 57, 119, 175, 25, 79,
+        21, 112, 71, 19, 219, 81, 49, 114, 64, 10, 251, 139, 2, 146, 18, 13, 81, 13, 216, 52, 3, 5, 28, 52,
+        27, 145, 195, 71, 55, 82, 45, 14, 16, 0, 7, 54, 198, 197, 20, 162, 16, 25, 52, 65, 14, 1, 50, 106,
+        172, 75, 13, 14, 107, 9, 114, 198, 70, 59, 157, 39, 1, 202, 53, 8, 15, 43, 220, 11, 39, 31, 27, 134,
+        50, 34, 103, 11, 36, 191, 53, 8, 22, 109, 55, 4, 237, 41, 100, 52, 4, 103, 65, 223, 14, 86, 52, 104,
+        83, 4, 50, 196, 70, 4, 19, 218, 59, 156, 194, 8, 15, 43, 27, 160, 13, 76, 29, 147, 1, 103, 9, 59,
+        145, 90, 126, 15, 59, 149, 10, 14, 81, 52, 4, 223, 91, 147, 14, 40, 232, 144, 11, 19, 201, 161, 64, 99,
+        43, 39, 87, 2, 239, 25, 31, 27, 155, 61, 169, 95, 145, 83, 12, 28, 27, 156, 64, 15, 39, 29, 147, 14,
+        40, 8, 17, 35, 145, 115, 226, 113, 79, 14, 255, 145, 218, 119, 168, 14, 107, 88, 49, 27, 157, 198, 41, 170,
+        16, 196, 201, 149, 22, 43, 27, 148, 99, 40, 116, 18, 38, 32, 6, 74, 65, 11, 39, 1, 56, 56, 109, 203,
+        5, 22, 227, 160, 68, 104, 98, 97, 17, 93, 147, 41, 88, 233, 77, 3, 29, 165, 52, 14, 81, 235, 5, 28,
+        95, 155, 81, 14, 27, 155, 100, 14, 29, 168, 6, 60, 155, 18, 21, 112, 117, 50, 27, 134, 6, 170, 220, 12,
+        212, 6, 34, 35, 155, 8, 43, 8, 214, 18, 71, 29, 167, 8, 240, 114, 6, 18, 88, 13, 50, 12, 21, 20,
+        147, 14, 4, 18, 29, 158, 19, 96, 212, 15, 3, 18, 60, 144, 34, 19, 55, 60, 149, 25, 4, 34, 249, 92,
+        14, 62, 27, 144, 50, 41, 19, 79, 15, 70, 18, 65, 41, 19, 27, 153, 52, 15, 201, 159, 52, 9, 13, 28,
+        53, 27, 163, 28, 52, 209, 137, 109, 29, 225, 154, 52, 232, 134, 7, 170, 27, 147, 14, 81, 247, 53, 203, 13,
+        19, 29, 145, 64, 28, 49, 27, 155, 4, 19, 41, 27, 147, 43, 15, 13, 34, 7, 104, 31, 40, 2, 149, 229,
+        6, 232, 156, 53, 111, 59, 224, 91, 154, 52, 232, 157, 68, 34, 28, 13, 29, 210, 248, 235, 86, 70, 118, 16,
+        234, 104, 18, 28, 11, 86, 8, 85, 123, 8, 37, 53, 113, 13, 97, 7, 65, 90, 16, 63, 25, 2, 163, 117,
+        28, 14, 79, 75, 71, 19, 200, 70, 236, 16, 6, 220, 31, 233, 53, 75, 16, 6, 28, 16, 50, 27, 145, 106,
+        52, 13, 23, 112, 79, 18, 29, 155, 1, 98, 2, 160, 13, 25, 126, 27, 147, 18, 29, 163, 28, 76, 236, 37,
+        64, 13, 56, 31, 8, 202, 52, 64, 57, 22, 14, 5, 58, 168, 169, 170, 152, 58, 146, 83, 118, 5, 19, 229,
+        18, 152, 58, 224, 91, 134, 6, 170, 152, 58, 134, 6, 170, 152, 44, 20, 224, 3, 29, 147, 14, 40, 232, 149,
+        10, 14, 86, 52, 2, 151, 89, 198, 91, 161, 89, 213, 124, 7, 89, 34, 14, 16, 112, 122, 43, 123, 39, 241,
+        151, 83, 76, 27, 145, 90, 10, 40, 227, 164, 94, 95, 164, 106, 199, 37, 40, 16, 243, 9, 53, 27, 158, 25,
+        119, 159, 64, 12, 209, 137, 29, 145, 41, 233, 20, 161, 11, 43, 39, 5, 103, 202, 4, 22, 10, 16, 123, 52,
+        14, 233, 27, 156, 53, 79, 50, 27, 146, 96, 212, 9, 63, 25, 114, 40, 11, 110, 15, 219, 43, 28, 125, 145,
+        34, 50, 50, 111, 106, 36, 157, 4, 25, 8, 56, 56, 109, 29, 175, 37, 43, 27, 151, 4, 25, 19, 122, 14,
+        8, 214, 213, 28, 14, 79, 243, 34, 10, 69, 49, 5, 10, 10, 95, 163, 50, 19, 230, 16, 22, 119, 168, 14,
+        248, 27, 159, 1, 67, 227, 157, 39, 241, 147, 14, 40, 232, 154, 71, 41, 126, 113, 90, 10, 25, 31, 4, 22,
+        119, 134, 7, 37, 201, 162, 1, 103, 170, 2, 132, 25, 31, 114, 6, 18, 88, 27, 144, 170, 139, 75, 31, 27,
+        145, 169, 7, 14, 18, 204, 86, 195, 94, 21, 6, 2, 163, 10, 34, 103, 3, 29, 191, 57, 108, 197, 20, 161,
+        253, 119, 166, 171, 192, 12, 3, 125, 144, 193, 6, 118, 18, 240, 65, 99, 53, 59, 144, 193, 28, 18, 4, 234,
+        69, 96, 110, 25, 242, 145, 105, 25, 29, 151, 71, 19, 27, 167, 16, 11, 59, 162, 90, 8, 56, 56, 109, 29,
+        159, 194, 16, 234, 69, 5, 50, 71, 19, 116, 123, 71, 4, 19, 27, 146, 31, 61, 13, 83, 29, 157, 4, 28,
+        41, 235, 18, 50, 201, 132, 28, 16, 37, 217, 69, 111, 229, 201, 145, 64, 57, 27, 149, 193, 4, 5, 37, 219,
+        64, 13, 25, 19, 27, 225, 144, 193, 6, 16, 21, 69, 53, 59, 144, 3, 28, 64, 29, 157, 4, 28, 41, 216,
+        86, 214, 41, 13, 69, 43, 28, 64, 27, 134, 6, 119, 155, 57, 220, 253, 119, 134, 244, 43, 8, 50, 27, 164,
+        8, 127, 192, 12, 197, 30, 250, 28, 113, 11, 1, 85, 21, 11, 204, 52, 83, 98, 92, 28, 13, 94, 21, 11,
+        12, 171, 61, 75, 64, 4, 25, 203, 41, 217, 49, 5, 0, 198, 223, 28, 95, 168, 9, 81, 20, 156, 230, 7,
+        16, 21, 0, 9, 122, 94, 10, 95, 157, 1, 17, 228, 9, 112, 13, 18, 89, 13, 81, 95, 159, 13, 8, 33,
+        29, 174, 21, 9, 18, 75, 40, 9, 18, 227, 160, 5, 5, 65, 40, 53, 5, 203, 71, 37, 8, 56, 8, 69,
+        4, 56, 5, 194, 18, 65, 18, 32, 45, 20, 155, 13, 103, 7, 205, 169, 98, 59, 147, 41, 6, 41, 95, 157,
+        13, 231, 125, 155, 8, 43, 123, 16, 70, 3, 17, 202, 53, 4, 193, 52, 3, 27, 146, 8, 34, 250, 7, 216,
+        12, 17, 37, 94, 2, 225, 157, 16, 70, 3, 17, 202, 53, 4, 193, 52, 3, 220, 1, 21, 9, 8, 21, 7,
+        215, 53, 115, 10, 95, 162, 71, 226, 11, 199, 94, 2, 158, 89, 1, 21, 196, 90, 18, 28, 5, 75, 5, 89,
+        13, 106, 236, 43, 5, 34, 0, 56, 16, 54, 13, 89, 13, 29, 210, 31, 170, 220, 226, 15, 57, 222, 144, 34,
+        14, 219, 43, 28, 125, 154, 40, 85, 94, 221, 11, 70, 16, 6, 75, 1, 50, 89, 234, 92, 6, 28, 171, 109,
+        29, 148, 71, 18, 93, 148, 4, 13, 196, 86, 34, 93, 157, 195, 49, 54, 111, 83, 59, 167, 76, 4, 28, 49,
+        54, 92, 244, 71, 18, 55, 4, 93, 157, 116, 5, 19, 49, 55, 59, 155, 194, 85, 86, 14, 16, 37, 196, 83,
+        59, 156, 233, 54, 53, 1, 24, 157, 195, 53, 172, 69, 18, 4, 67, 6, 113, 228, 67, 6, 204, 4, 50, 5,
+        34, 25, 65, 116, 10, 4, 25, 214, 172, 70, 122, 215, 49, 12, 110, 221, 117, 63, 56, 53, 205, 34, 127, 85,
+        92, 7, 7, 71, 104, 4, 54, 49, 2, 163, 9, 9, 213, 10, 54, 76, 112, 5, 203, 8, 192, 29, 162, 71,
+        106, 63, 15, 215, 4, 25, 1, 56, 53, 205, 34, 127, 85, 196, 70, 71, 25, 13, 93, 154, 1, 85, 25, 105,
+        216, 54, 81, 9, 115, 28, 49, 54, 196, 70, 49, 10, 54, 76, 75, 49, 63, 9, 1, 21, 2, 160, 86, 70,
+        42, 54, 119, 158, 6, 115, 7, 29, 147, 253, 70, 213, 9, 2, 151, 89, 198, 91, 145, 31, 28, 53, 27, 156,
+        86, 54, 12, 17, 205, 34, 127, 85, 113, 83, 40, 28, 18, 16, 92, 244, 54, 34, 205, 34, 127, 85, 69, 89,
+        213, 85, 9, 6, 29, 163, 9, 9, 49, 205, 34, 127, 85, 214, 43, 15, 4, 56, 41, 6, 59, 157, 39, 66,
+        20, 121, 197, 20, 163, 83, 12, 7, 92, 14, 22, 192, 4, 26, 38, 32, 22, 64, 16, 56, 63, 237, 41, 100,
+        52, 235, 41, 100, 52, 152, 20, 148, 70, 41, 14, 115, 35, 145, 107, 2, 224, 63, 237, 41, 100, 52, 27, 225,
+        144, 14, 22, 192, 235, 94, 25, 201, 146, 116, 9, 52, 27, 151, 89, 198, 91, 144, 14, 22, 192, 219, 14, 40,
+        7, 251, 114, 8, 127, 192, 12, 197, 30, 250, 28, 65, 41, 70, 199, 59, 144, 11, 195, 5, 94, 2, 160, 4,
+        5, 45, 127, 35, 150, 18, 107, 6, 95, 149, 7, 37, 105, 4, 9, 254, 161, 18, 9, 13, 2, 160, 4, 125,
+        210, 76, 8, 45, 15, 254, 157, 52, 9, 59, 159, 213, 103, 19, 236, 18, 9, 227, 154, 81, 49, 40, 29, 159,
+        41, 63, 25, 19, 13, 10, 13, 92, 25, 1, 37, 236, 8, 49, 221, 10, 6, 59, 159, 49, 18, 29, 160, 5,
+        120, 25, 29, 160, 43, 15, 43, 220, 18, 205, 226, 11, 13, 214, 4, 226, 103, 113, 5, 10, 18, 9, 40, 7,
+        2, 160, 4, 125, 210, 76, 8, 45, 15, 254, 161, 13, 11, 69, 49, 18, 12, 110, 112, 5, 17, 7, 69, 81,
+        254, 210, 98, 13, 45, 15, 254, 161, 13, 11, 104, 1, 103, 24, 156, 40, 94, 35, 150, 8, 120, 7, 69, 81,
+        254, 210, 98, 13, 2, 191, 49, 221, 25, 1, 50, 43, 94, 114, 8, 127, 192, 12, 197, 30, 250, 28, 202, 64,
+        13, 25, 19, 27, 160, 200, 35, 144, 26, 251, 196, 83, 111, 41, 75, 43, 3, 230, 9, 118, 218, 123, 252, 20,
+        148, 70, 41, 246, 157, 252, 35, 147, 247, 37, 85, 16, 6, 2, 146, 41, 25, 43, 9, 69, 94, 7, 1, 56,
+        13, 7, 217, 7, 112, 111, 1, 103, 69, 41, 106, 172, 2, 151, 89, 198, 91, 239, 28, 40, 27, 225, 154, 49,
+        64, 40, 204, 31, 243, 244, 4, 18, 203, 171, 13, 10, 10, 59, 162, 31, 3, 61, 246, 239, 28, 40, 27, 158,
+        28, 79, 95, 159, 31, 7, 106, 12, 14, 201, 156, 115, 7, 115, 199, 59, 155, 13, 103, 50, 4, 18, 221, 11,
+        122, 71, 221, 6, 10, 18, 50, 94, 2, 224, 91, 154, 49, 64, 40, 29, 157, 252, 35, 153, 52, 10, 92, 26,
+        39, 29, 134, 11, 11, 40, 5, 26, 7, 112, 117, 50, 27, 146, 115, 10, 43, 7, 40, 114, 11, 52, 16, 15,
+        204, 115, 7, 90, 59, 158, 10, 11, 89, 99, 29, 224, 91, 148, 194, 169, 29, 146, 1, 85, 109, 28, 9, 43,
+        2, 225, 148, 194, 169, 29, 157, 8, 19, 34, 7, 21, 75, 18, 50, 94, 92, 26, 15, 89, 95, 174, 9, 204,
+        40, 3, 61, 169, 204, 4, 56, 16, 28, 119, 146, 79, 99, 40, 28, 2, 158, 6, 233, 43, 75, 64, 5, 34,
+        15, 95, 157, 231, 86, 221, 228, 50, 43, 29, 157, 252, 35, 156, 230, 7, 118, 5, 69, 43, 9, 18, 203, 53,
+        4, 193, 52, 3, 235, 8, 54, 94, 92, 11, 17, 7, 21, 104, 229, 18, 38, 202, 64, 13, 25, 19, 152, 0,
+        223, 19, 41, 9, 29, 158, 3, 9, 49, 4, 5, 75, 14, 8, 19, 230, 65, 94, 21, 56, 231, 18, 69, 18,
+        4, 9, 5, 19, 29, 189, 252, 193, 1, 126, 15, 251, 123, 252, 35, 145, 6, 18, 7, 14, 116, 123, 39, 241,
+        168, 169, 170, 27, 158, 62, 57, 20, 159, 6, 109, 88, 241, 149, 15, 13, 49, 15, 29, 174, 10, 43, 2, 191,
+        57, 206, 3, 125, 183, 89, 198, 97, 237, 41, 100, 52, 4, 103, 123, 13, 63, 14, 218, 243, 244, 27, 144, 14,
+        22, 192, 27, 145, 34, 50, 16, 11, 220, 208, 168, 208, 144, 58, 161, 37, 64, 13, 56, 31, 60, 168, 9, 81,
+        16, 20, 144, 25, 41, 118, 16, 58, 144, 25, 41, 16, 21, 69, 230, 7, 16, 21, 69, 98, 10, 14, 236, 18,
+        10, 9, 205, 217, 41, 19, 90, 28, 75, 53, 40, 40, 28, 34, 15, 238, 134, 3, 28, 13, 85, 217, 27, 102,
+        144, 15, 16, 28, 232, 224, 91, 158, 7, 217, 152, 35, 144, 11, 201, 154, 122, 49, 15, 109, 125, 145, 53, 21,
+        6, 240, 75, 213, 56, 1, 212, 14, 125, 167, 41, 10, 8, 240, 216, 8, 56, 31, 240, 216, 13, 14, 1, 240,
+        243, 14, 18, 138, 155, 16, 37, 248, 12, 21, 48, 158, 6, 11, 138, 162, 13, 11, 12, 51, 145, 212, 11, 28,
+        52, 200, 51, 146, 64, 200, 16, 25, 16, 6, 51, 154, 90, 51, 154, 53, 13, 50, 12, 21, 48, 162, 71, 19,
+        138, 145, 6, 110, 51, 175, 6, 98, 11, 111, 51, 160, 17, 50, 18, 51, 144, 22, 34, 54, 18, 51, 156, 98,
+        10, 138, 161, 25, 64, 31, 238, 148, 195, 8, 22, 119, 146, 52, 43, 8, 70, 7, 21, 17, 48, 157, 39, 28,
+        52, 200, 51, 159, 7, 10, 138, 154, 5, 62, 99, 51, 161, 9, 111, 6, 5, 37, 64, 12, 211, 75, 34, 7,
+        3, 200, 49, 211, 2, 102, 154, 53, 25, 118, 235, 14, 41, 51, 155, 31, 40, 28, 34, 15, 51, 160, 5, 22,
+        138, 146, 64, 28, 5, 28, 34, 15, 51, 146, 64, 5, 28, 200, 51, 156, 90, 25, 18, 238, 154, 49, 83, 27,
+        157, 31, 248, 12, 10, 66, 32, 111, 9, 43, 99, 197, 30, 250, 28, 2, 102, 154, 99, 59, 144, 6, 54, 18,
+        28, 83, 12, 238, 156, 52, 15, 39, 27, 157, 16, 70, 233, 52, 200, 51, 159, 31, 50, 31, 51, 154, 105, 138,
+        102, 156, 49, 4, 26, 20, 149, 11, 2, 158, 6, 31, 19, 90, 50, 12, 21, 48, 163, 11, 12, 110, 138, 159,
+        41, 25, 211, 2, 102, 145, 1, 85, 10, 52, 9, 5, 22, 119, 163, 15, 25, 90, 9, 240, 2, 102, 162, 81,
+        49, 234, 65, 71, 49, 51, 161, 213, 9, 138, 175, 25, 53, 125, 157, 31, 248, 12, 10, 66, 215, 18, 249, 35,
+        156, 18, 7, 4, 26, 101, 65, 14, 41, 15, 11, 138, 162, 141, 25, 31, 51, 154, 90, 28, 18, 51, 167, 83,
+        17, 19, 40, 238, 145, 90, 17, 9, 27, 151, 122, 79, 21, 11, 12, 211, 243, 6, 10, 218, 51, 157, 39, 98,
+        16, 19, 105, 51, 162, 99, 51, 158, 25, 238, 165, 1, 21, 7, 219, 247, 41, 138, 102, 144, 11, 9, 79, 92,
+        11, 9, 79, 211, 2, 102, 162, 16, 14, 203, 34, 7, 3, 5, 17, 6, 211, 69, 195, 86, 18, 51, 167, 13,
+        10, 169, 101, 30, 250, 28, 75, 71, 56, 81, 211, 65, 89, 53, 40, 51, 159, 6, 16, 25, 52, 211, 2, 132,
+        14, 6, 107, 38, 32, 111, 9, 43, 99, 63, 48, 165, 122, 49, 39, 211, 92, 25, 90, 238, 161, 89, 242, 175,
+        10, 218, 219, 18, 86, 29, 160, 98, 27, 168, 18, 54, 79, 113, 110, 12, 88, 50, 40, 36, 159, 230, 40, 215,
+        79, 3, 255, 157, 40, 7, 17, 35, 165, 13, 107, 101, 216, 126, 88, 109, 216, 70, 248, 50, 110, 2, 166, 50,
+        110, 7, 13, 114, 13, 88, 50, 110, 36, 144, 3, 12, 54, 5, 26, 2, 155, 17, 43, 40, 2, 168, 18, 12,
+        15, 126, 2, 168, 18, 12, 246, 166, 50, 110, 7, 16, 215, 31, 255, 147, 13, 26, 56, 70, 5, 13, 112, 13,
+        76, 126, 215, 13, 19, 107, 2, 166, 50, 106, 40, 36, 165, 8, 19, 107, 2, 168, 31, 12, 246, 146, 3, 218,
+        228, 85, 3, 17, 20, 156, 43, 28, 64, 27, 165, 107, 11, 126, 88, 50, 110, 215, 126, 255, 147, 13, 18, 7,
+        4, 35, 167, 70, 13, 18, 101, 65, 16, 56, 13, 255, 174, 3, 12, 3, 255, 162, 16, 19, 217, 101, 32, 111,
+        9, 43, 99, 197, 32, 120, 43, 58, 162, 16, 19, 217, 112, 18, 12, 7, 13, 2, 166, 109, 54, 79, 65, 109,
+        12, 88, 50, 110, 35, 163, 26, 28, 90, 101, 75, 100, 79, 65, 208, 168, 208, 144, 20, 151, 39, 97, 85, 245,
+        188, 53, 87, 2, 190, 62, 57, 202, 11, 16, 37, 37, 41, 9, 43, 92, 3, 9, 49, 10, 249, 15, 204, 4,
+        70, 3, 49, 200, 197, 58, 161, 14, 4, 9, 58, 151, 247, 11, 17, 0,
+};
+
+static const unsigned char TERRITORY_NAMES_PAIRS_UK[256][2] = {
+        {0, 0}, {208, 176}, {0, 208}, {208, 189}, {209, 150}, {208, 190}, {209, 128}, {209, 129}, {208, 181}, {209, 130}, {208, 186}, {208, 187},
+        {209, 140}, {209, 131}, {208, 178}, {208, 180}, {208, 184}, {209, 143}, {1, 3}, {208, 177}, {32, 208}, {10, 1}, {7, 9}, {7, 12},
+        {17, 2}, {208, 188}, {208, 185}, {4, 24}, {208, 179}, {1, 2}, {32, 5}, {8, 3}, {32, 32}, {19, 11}, {6, 1}, {45, 208},
+        {12, 2}, {208, 191}, {23, 21}, {5, 14}, {4, 3}, {8, 6}, {1, 22}, {5, 3}, {44, 44}, {45, 45}, {30, 33}, {42, 36},
+        {46, 47}, {1, 6}, {208, 183}, {38, 48}, {5, 6}, {1, 11}, {209, 133}, {23, 10}, {209, 135}, {4, 14}, {124, 208}, {4, 2},
+        {4, 20}, {8, 7}, {22, 6}, {3, 1}, {5, 11}, {2, 161}, {16, 26}, {37, 13}, {4, 21}, {2, 156}, {208, 182}, {1, 25},
+        {33, 68}, {61, 67}, {73, 72}, {2, 154}, {18, 15}, {39, 16}, {160, 74}, {1, 26}, {62, 77}, {1, 9}, {4, 30}, {8, 11},
+        {159, 57}, {209, 136}, {1, 15}, {82, 80}, {209, 134}, {1, 54}, {13, 6}, {63, 20}, {2, 144}, {32, 60}, {1, 7}, {5, 2},
+        {96, 96}, {3, 4}, {5, 7}, {5, 25}, {16, 9}, {55, 66}, {78, 20}, {209, 151}, {2, 145}, {4, 6}, {4, 11}, {8, 26},
+        {15, 31}, {16, 3}, {17, 3}, {1, 14}, {2, 147}, {2, 162}, {2, 164}, {4, 7}, {4, 10}, {6, 13}, {16, 10}, {18, 2},
+        {34, 26}, {84, 108}, {1, 19}, {2, 157}, {124, 124}, {5, 35}, {13, 3}, {15, 8}, {128, 128}, {129, 129}, {130, 130}, {131, 131},
+        {132, 132}, {133, 133}, {134, 134}, {135, 135}, {136, 136}, {137, 137}, {39, 51}, {55, 87}, {140, 140}, {209, 142}, {142, 142}, {143, 143},
+        {144, 144}, {145, 145}, {146, 146}, {147, 147}, {148, 148}, {149, 149}, {150, 150}, {151, 151}, {4, 17}, {153, 153}, {154, 154}, {155, 155},
+        {156, 156}, {157, 157}, {158, 158}, {159, 159}, {160, 160}, {161, 161}, {162, 162}, {163, 163}, {164, 164}, {165, 165}, {166, 166}, {167, 167},
+        {168, 168}, {5, 9}, {11, 76}, {31, 9}, {31, 15}, {32, 10}, {174, 174}, {175, 175}, {176, 176}, {177, 177}, {178, 178}, {179, 179},
+        {180, 180}, {181, 181}, {182, 182}, {183, 183}, {184, 184}, {185, 185}, {186, 186}, {187, 187}, {188, 188}, {189, 189}, {190, 190}, {191, 191},
+        {34, 11}, {209, 132}, {1, 10}, {1, 28}, {2, 148}, {3, 66}, {4, 15}, {4, 37}, {5, 15}, {18, 27}, {20, 154}, {29, 154},
+        {29, 156}, {35, 159}, {97, 56}, {101, 173}, {208, 208}, {209, 209}, {147, 6}, {207, 120}, {209, 148}, {1, 34}, {2, 159}, {2, 165},
+        {2, 167}, {8, 9}, {13, 9}, {27, 154}, {27, 161}, {29, 144}, {38, 20}, {53, 12}, {84, 206}, {121, 91}, {1, 13}, {1, 35},
+        {6, 4}, {6, 100}, {8, 10}, {8, 14}, {8, 24}, {8, 28}, {22, 18}, {27, 162}, {29, 161}, {32, 9}, {51, 102}, {146, 105},
+        {222, 78}, {1, 20}, {1, 58}, {2, 134}, {3, 15}, {3, 60}, {7, 59}, {8, 25}, {8, 88}, {9, 16}, {10, 117}, {11, 172},
+        {12, 141}, {13, 15}, {13, 35}, {18, 36},
+};
+
+static const unsigned short TERRITORY_NAME_ALTERNATIVES_START_UK[_TERRITORY_MAX - _TERRITORY_MIN] = {
+        0, 2, 3, 4, 5, 7, 8, 9, 10, 11, 12, 13, 15, 16, 17, 18,
+        19, 20, 21, 22, 23, 24, 25, 27, 29, 30, 31, 32, 34, 35, 37, 38,
+        40, 41, 44, 45, 48, 49, 50, 52, 53, 55, 57, 59, 60, 62, 63, 64,
+        65, 66, 67, 68, 69, 70, 72, 73, 74, 75, 76, 77, 79, 81, 82, 83,
+        84, 85, 86, 87, 88, 89, 90, 92, 93, 94, 96, 97, 98, 99, 100, 101,
+        102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117,
+        118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132, 133,
+        134, 135, 136, 137, 138, 139, 140, 141, 142, 143, 144, 145, 146, 147, 148, 149,
+        150, 151, 152, 153, 154, 155, 156, 157, 158, 159, 160, 161, 162, 163, 164, 165,
+        166, 167, 168, 169, 170, 171, 172, 173, 174, 175, 176, 177, 178, 179, 180, 181,
+        182, 183, 184, 185, 186, 187, 188, 193, 194, 195, 197, 198, 199, 200, 201, 202,
+        203, 204, 205, 206, 207, 208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218,
+        219, 220, 221, 222, 223, 224, 225, 226, 227, 228, 229, 230, 231, 232, 233, 234,
+        236, 237, 238, 239, 240, 241, 242, 243, 244, 245, 246, 247, 248, 249, 250, 251,
+        252, 253, 254, 255, 256, 257, 258, 259, 260, 261, 262, 263, 264, 265, 266, 267,
+        268, 269, 270, 271, 272, 273, 274, 275, 276, 277, 278, 279, 280, 281, 282, 283,
+        284, 285, 286, 287, 288, 289, 290, 291, 292, 293, 294, 295, 296, 297, 298, 299,
+        300, 301, 302, 303, 304, 305, 306, 307, 308, 309, 310, 311, 312, 313, 314, 315,
+        316, 317, 318, 319, 320, 321, 322, 323, 324, 325, 326, 327, 328, 329, 330, 331,
+        332, 333, 334, 335, 336, 337, 338, 339, 340, 341, 342, 343, 344, 345, 346, 347,
+        348, 349, 350, 351, 352, 353, 354, 355, 356, 357, 358, 359, 360, 361, 362, 363,
+        364, 365, 366, 367, 368, 369, 370, 371, 372, 373, 374, 375, 376, 377, 378, 379,
+        380, 381, 382, 383, 384, 385, 386, 387, 388, 389, 390, 391, 392, 393, 394, 395,
+        396, 397, 398, 399, 400, 401, 402, 403, 404, 405, 406, 407, 408, 409, 410, 411,
+        412, 413, 414, 415, 416, 417, 418, 419, 420, 421, 422, 423, 424, 425, 426, 427,
+        428, 429, 430, 431, 432, 433, 434, 435, 436, 437, 438, 441, 442, 443, 444, 445,
+        446, 447, 448, 449, 450, 451, 452, 453, 454, 455, 456, 457, 458, 459, 460, 461,
+        462, 463, 464, 465, 466, 467, 468, 469, 470, 471, 472, 473, 474, 475, 476, 477,
+        478, 479, 480, 481, 482, 483, 484, 485, 486, 487, 488, 489, 490, 491, 492, 493,
+        494, 495, 496, 497, 498, 499, 500, 501, 502, 503, 504, 505, 506, 507, 508, 509,
+        510, 511, 512, 513, 514, 515, 516, 517, 518, 519, 520, 521, 522, 523, 524, 526,
+        527, 528, 529, 530, 531, 532, 533, 534, 535, 536, 537, 538, 539, 540, 541, 542,
+        543, 544, 545, 546, 547, 548, 549, 550, 551, 552, 553, 554, 555, 557, 558, 559,
+        560, 561, 562, 563, 564, 567,
+};
+
+static const TerritoryNameAlternative TERRITORY_NAME_ALTERNATIVES_UK[567] = {
+        {0, 25, 2}, {26, 27, 2}, {54, 12, 2}, {67, 18, 2}, {86, 14, 2}, {101, 31, 2}, {133, 27, 2}, {161, 25, 2},
+        {187, 10, 2}, {198, 12, 2}, {211, 10, 2}, {222, 23, 2}, {246, 19, 2}, {266, 41, 2}, {308, 23, 2}, {332, 14, 2},
+        {347, 21, 2}, {369, 35, 2}, {405, 78, 2}, {484, 21, 2}, {506, 12, 2}, {519, 14, 2}, {534, 18, 2}, {553, 12, 2},
+        {566, 25, 2}, {592, 28, 2}, {621, 29, 2}, {651, 56, 2}, {708, 57, 2}, {766, 22, 2}, {789, 10, 2}, {800, 35, 2},
+        {836, 35, 2}, {872, 36, 2}, {909, 23, 2}, {933, 32, 2}, {966, 14, 2}, {981, 8, 2}, {990, 31, 2}, {1022, 10, 2},
+        {1033, 33, 2}, {1067, 53, 2}, {1121, 8, 2}, {1130, 25, 2}, {1156, 16, 2}, {1173, 79, 2}, {1253, 20, 2}, {1274, 30, 2},
+        {1305, 12, 2}, {1318, 14, 2}, {1333, 60, 2}, {1394, 43, 2}, {1438, 14, 2}, {1453, 37, 2}, {1491, 13, 2}, {1505, 45, 2},
+        {1551, 18, 2}, {1570, 60, 2}, {1631, 20, 2}, {1652, 16, 2}, {1669, 32, 2}, {1702, 14, 2}, {1717, 23, 2}, {1741, 37, 2},
+        {1779, 10, 2}, {1790, 52, 2}, {1843, 14, 2}, {1858, 8, 2}, {1867, 19, 2}, {1887, 19, 2}, {1907, 20, 2}, {1928, 54, 2},
+        {1983, 16, 2}, {2000, 10, 2}, {2011, 16, 2}, {2028, 14, 2}, {2043, 16, 2}, {2060, 41, 2}, {2102, 12, 2}, {2115, 35, 2},
+        {2151, 16, 2}, {2168, 14, 2}, {2183, 16, 2}, {2200, 33, 2}, {2234, 18, 2}, {2253, 33, 2}, {2287, 16, 2}, {2304, 23, 2},
+        {2328, 20, 2}, {2349, 10, 2}, {2360, 91, 2}, {2452, 52, 2}, {2505, 39, 2}, {2545, 19, 2}, {2565, 32, 2}, {2598, 12, 2},
+        {2611, 12, 2}, {2624, 76, 2}, {2701, 21, 2}, {2723, 8, 2}, {2732, 10, 2}, {2743, 12, 2}, {2756, 12, 2}, {2769, 10, 2},
+        {2780, 39, 2}, {2820, 14, 2}, {2835, 20, 2}, {2856, 26, 2}, {2883, 25, 2}, {2909, 18, 2}, {2928, 12, 2}, {2941, 10, 2},
+        {2952, 27, 2}, {2980, 16, 2}, {2997, 14, 2}, {3012, 43, 2}, {3056, 18, 2}, {3075, 10, 2}, {3086, 14, 2}, {3101, 18, 2},
+        {3120, 12, 2}, {3133, 10, 2}, {3144, 14, 2}, {3159, 39, 2}, {3199, 14, 2}, {3214, 35, 2}, {3250, 16, 2}, {3267, 12, 2},
+        {3280, 14, 2}, {3295, 14, 2}, {3310, 23, 2}, {3334, 14, 2}, {3349, 10, 2}, {3360, 18, 2}, {3379, 20, 2}, {3400, 10, 2},
+        {3411, 14, 2}, {3426, 47, 2}, {3474, 20, 2}, {3495, 19, 2}, {3515, 38, 2}, {3554, 16, 2}, {3571, 8, 2}, {3580, 12, 2},
+        {3593, 10, 2}, {3604, 17, 2}, {3622, 12, 2}, {3635, 16, 2}, {3652, 23, 2}, {3676, 12, 2}, {3689, 33, 2}, {3723, 33, 2},
+        {3757, 49, 2}, {3807, 14, 2}, {3822, 22, 2}, {3845, 12, 2}, {3858, 16, 2}, {3875, 20, 2}, {3896, 16, 2}, {3913, 27, 2},
+        {3941, 16, 2}, {3958, 18, 2}, {3977, 8, 2}, {3986, 16, 2}, {4003, 14, 2}, {4018, 16, 2}, {4035, 10, 2}, {4046, 14, 2},
+        {4061, 12, 2}, {4074, 27, 2}, {4102, 18, 2}, {4121, 12, 2}, {4134, 22, 2}, {4157, 18, 2}, {4176, 10, 2}, {4187, 10, 2},
+        {4198, 14, 2}, {4213, 14, 2}, {4228, 16, 2}, {4245, 10, 2}, {4256, 14, 2}, {4271, 16, 2}, {4288, 16, 2}, {4305, 12, 2},
+        {4318, 8, 2}, {4327, 14, 2}, {4342, 8, 2}, {4351, 12, 2}, {4364, 41, 2}, {4406, 18, 2}, {4425, 28, 2}, {4454, 33, 2},
+        {4488, 34, 2}, {4523, 12, 2}, {4536, 14, 2}, {4551, 27, 2}, {4579, 14, 2}, {4594, 10, 2}, {4605, 25, 2}, {4631, 23, 2},
+        {4655, 18, 2}, {4674, 12, 2}, {4687, 8, 2}, {4696, 12, 2}, {4709, 40, 2}, {4750, 16, 2}, {4767, 16, 2}, {4784, 13, 2},
+        {4798, 18, 2}, {4817, 31, 2}, {4849, 18, 2}, {4868, 12, 2}, {4881, 16, 2}, {4898, 16, 2}, {4915, 8, 2}, {4924, 14, 2},
+        {4939, 20, 2}, {4960, 12, 2}, {4973, 32, 2}, {5006, 14, 2}, {5021, 24, 2}, {5046, 14, 2}, {5061, 14, 2}, {5076, 8, 2},
+        {5085, 14, 2}, {5100, 33, 2}, {5134, 10, 2}, {5145, 16, 2}, {5162, 20, 2}, {5183, 14, 2}, {5198, 29, 2}, {5228, 64, 2},
+        {5293, 12, 2}, {5306, 20, 2}, {5327, 11, 2}, {5339, 10, 2}, {5350, 12, 2}, {5363, 8, 2}, {5372, 18, 2}, {5391, 16, 2},
+        {5408, 16, 2}, {5425, 14, 2}, {5440, 18, 2}, {5459, 14, 2}, {5474, 16, 2}, {5491, 12, 2}, {5504, 20, 2}, {5525, 14, 2},
+        {5540, 14, 2}, {5555, 16, 2}, {5572, 29, 2}, {5602, 8, 2}, {5611, 12, 2}, {5624, 10, 2}, {5635, 6, 2}, {5642, 8, 2},
+        {5651, 16, 2}, {5668, 8, 2}, {5677, 10, 2}, {5688, 10, 2}, {5699, 18, 2}, {5718, 33, 2}, {5752, 16, 2}, {5769, 14, 2},
+        {5784, 28, 2}, {5813, 12, 2}, {5826, 16, 2}, {5843, 14, 2}, {5858, 23, 2}, {5882, 14, 2}, {5897, 12, 2}, {5910, 20, 2},
+        {5931, 12, 2}, {5944, 12, 2}, {5957, 21, 2}, {5979, 14, 2}, {5994, 14, 2}, {6009, 16, 2}, {6026, 30, 2}, {6057, 14, 2},
+        {6072, 19, 2}, {6092, 31, 2}, {6124, 16, 2}, {6141, 12, 2}, {6154, 48, 2}, {6203, 18, 2}, {6222, 14, 2}, {6237, 20, 2},
+        {6258, 12, 2}, {6271, 14, 2}, {6286, 16, 2}, {6303, 12, 2}, {6316, 16, 2}, {6333, 20, 2}, {6354, 33, 2}, {6388, 25, 2},
+        {6414, 10, 2}, {6425, 18, 2}, {6444, 18, 2}, {6463, 20, 2}, {6484, 36, 2}, {6521, 18, 2}, {6540, 48, 2}, {6589, 18, 2},
+        {6608, 8, 2}, {6617, 16, 2}, {6634, 16, 2}, {6651, 14, 2}, {6666, 14, 2}, {6681, 14, 2}, {6696, 12, 2}, {6709, 14, 2},
+        {6724, 14, 2}, {6739, 29, 2}, {6769, 10, 2}, {6780, 10, 2}, {6791, 22, 2}, {6814, 6, 2}, {6821, 12, 2}, {6834, 16, 2},
+        {6851, 27, 2}, {6879, 28, 2}, {6908, 22, 2}, {6931, 18, 2}, {6950, 18, 2}, {6969, 20, 2}, {6990, 12, 2}, {7003, 16, 2},
+        {7020, 31, 2}, {7052, 25, 2}, {7078, 18, 2}, {7097, 25, 2}, {7123, 20, 2}, {7144, 23, 2}, {7168, 20, 2}, {7189, 40, 2},
+        {7230, 62, 2}, {7293, 40, 2}, {7334, 35, 2}, {7370, 35, 2}, {7406, 16, 2}, {7423, 16, 2}, {7440, 33, 2}, {7474, 18, 2},
+        {7493, 33, 2}, {7527, 14, 2}, {7542, 14, 2}, {7557, 26, 2}, {7584, 27, 2}, {7612, 35, 2}, {7648, 14, 2}, {7663, 27, 2},
+        {7691, 20, 2}, {7712, 10, 2}, {7723, 10, 2}, {7734, 8, 2}, {7743, 12, 2}, {7756, 14, 2}, {7771, 16, 2}, {7788, 17, 2},
+        {7806, 10, 2}, {7817, 18, 2}, {7836, 31, 2}, {7868, 16, 2}, {7885, 8, 2}, {7894, 31, 2}, {7926, 8, 2}, {7935, 23, 2},
+        {7959, 19, 2}, {7979, 8, 2}, {7988, 16, 2}, {8005, 50, 2}, {8056, 19, 2}, {8076, 14, 2}, {8091, 22, 2}, {8114, 19, 2},
+        {8134, 21, 2}, {8156, 14, 2}, {8171, 22, 2}, {8194, 10, 2}, {8205, 16, 2}, {8222, 31, 2}, {8254, 33, 2}, {8288, 6, 2},
+        {8295, 14, 2}, {8310, 16, 2}, {8327, 16, 2}, {8344, 16, 2}, {8361, 10, 2}, {8372, 24, 2}, {8397, 18, 2}, {8416, 16, 2},
+        {8433, 14, 2}, {8448, 16, 2}, {8465, 33, 2}, {8499, 15, 2}, {8515, 10, 2}, {8526, 16, 2}, {8543, 12, 2}, {8556, 18, 2},
+        {8575, 14, 2}, {8590, 14, 2}, {8605, 16, 2}, {8622, 29, 2}, {8652, 18, 2}, {8671, 29, 2}, {8701, 16, 2}, {8718, 12, 2},
+        {8731, 12, 2}, {8744, 6, 2}, {8751, 18, 2}, {8770, 14, 2}, {8785, 16, 2}, {8802, 12, 2}, {8815, 16, 2}, {8832, 12, 2},
+        {8845, 14, 2}, {8860, 21, 2}, {8882, 14, 2}, {8897, 20, 2}, {8918, 10, 2}, {8929, 12, 2}, {8942, 37, 2}, {8980, 16, 2},
+        {8997, 14, 2}, {9012, 12, 2}, {9025, 20, 2}, {9046, 16, 2}, {9063, 24, 2}, {9088, 23, 2}, {9112, 27, 2}, {9140, 40, 2},
+        {9181, 8, 2}, {9190, 50, 2}, {9241, 14, 2}, {9256, 10, 2}, {9267, 18, 2}, {9286, 16, 2}, {9303, 6, 2}, {9310, 44, 2},
+        {9355, 14, 2}, {9370, 14, 2}, {9385, 12, 2}, {9398, 29, 2}, {9428, 45, 2}, {9474, 39, 2}, {9514, 33, 2}, {9548, 42, 2},
+        {9591, 60, 2}, {9652, 58, 2}, {9711, 39, 2}, {9751, 37, 2}, {9789, 35, 2}, {9825, 31, 2}, {9857, 33, 2}, {9891, 31, 2},
+        {9923, 39, 2}, {9963, 41, 2}, {10005, 29, 2}, {10035, 31, 2}, {10067, 35, 2}, {10103, 31, 2}, {10135, 37, 2}, {10173, 33, 2},
+        {10207, 39, 2}, {10247, 35, 2}, {10283, 35, 2}, {10319, 37, 2}, {10357, 37, 2}, {10395, 39, 2}, {10435, 33, 2}, {10469, 37, 2},
+        {10507, 39, 2}, {10547, 37, 2}, {10585, 37, 2}, {10623, 31, 2}, {10655, 41, 2}, {10697, 35, 2}, {10733, 41, 2}, {10775, 37, 2},
+        {10813, 35, 2}, {10849, 35, 2}, {10885, 50, 2}, {10936, 29, 2}, {10966, 41, 2}, {11008, 37, 2}, {11046, 41, 2}, {11088, 35, 2},
+        {11124, 33, 2}, {11158, 36, 2}, {11195, 37, 2}, {11233, 37, 2}, {11271, 27, 2}, {11299, 45, 2}, {11345, 41, 2}, {11387, 39, 2},
+        {11427, 33, 2}, {11461, 37, 2}, {11499, 29, 2}, {11529, 33, 2}, {11563, 39, 2}, {11603, 33, 2}, {11637, 35, 2}, {11673, 37, 2},
+        {11711, 35, 2}, {11747, 37, 2}, {11785, 33, 2}, {11819, 41, 2}, {11861, 29, 2}, {11891, 27, 2}, {11919, 35, 2}, {11955, 37, 2},
+        {11993, 31, 2}, {12025, 29, 2}, {12055, 29, 2}, {12085, 35, 2}, {12121, 37, 2}, {12159, 31, 2}, {12191, 31, 2}, {12223, 37, 2},
+        {12261, 31, 2}, {12293, 52, 2}, {12346, 33, 2}, {12380, 31, 2}, {12412, 29, 2}, {12442, 12, 2}, {12455, 12, 2}, {12468, 10, 2},
+        {12479, 12, 2}, {12492, 18, 2}, {12511, 10, 2}, {12522, 14, 2}, {12537, 29, 2}, {12567, 12, 2}, {12580, 14, 2}, {12595, 12, 2},
+        {12608, 14, 2}, {12623, 12, 2}, {12636, 12, 2}, {12649, 14, 2}, {12664, 12, 2}, {12677, 12, 2}, {12690, 12, 2}, {12703, 14, 2},
+        {12718, 14, 2}, {12733, 10, 2}, {12744, 14, 2}, {12759, 10, 2}, {12770, 12, 2}, {12783, 35, 2}, {12819, 20, 2}, {12840, 12, 2},
+        {12853, 33, 2}, {12887, 14, 2}, {12902, 14, 2}, {12917, 52, 2}, {12970, 10, 2}, {12981, 12, 2}, {12994, 12, 2}, {13007, 37, 2},
+        {13045, 10, 2}, {13056, 47, 2}, {13104, 33, 2}, {13138, 20, 2}, {13159, 22, 2}, {13182, 8, 2}, {13191, 10, 2},
+};
+
+static char TERRITORY_NAMES_UNPACKED_UK[13202];
+
+static const PackedTerritoryNames PACKED_TERRITORY_NAMES_UK = {
+        TERRITORY_NAMES_UNPACKED_UK, 13202, TERRITORY_NAMES_PACKED_UK, 3664, TERRITORY_NAMES_PAIRS_UK,
+        TERRITORY_NAME_ALTERNATIVES_START_UK, TERRITORY_NAME_ALTERNATIVES_UK};
+
+#else
+
+static const PackedTerritoryNames PACKED_TERRITORY_NAMES_UK = {NULL, 0, NULL, 0, NULL, NULL, NULL};
+
+#endif // MAPCODE_SUPPORT_LANGUAGE_UK
+
+// 13915 bytes, packed to 8791
+static const unsigned char TERRITORY_NAMES_PACKED_LOCAL[8791] = {
+        83, 6, 99, 116, 63, 83, 101, 100, 57, 124, 72, 111, 108, 121, 32, 83, 101, 64, 77, 55, 97, 99, 59, 71,
+        105, 98, 114, 30, 116, 22, 0, 84, 111, 107, 205, 97, 117, 0, 75, 101, 112, 117, 108, 97, 117, 6, 32, 67,
+        111, 99, 111, 115, 124, 67, 111, 99, 111, 115, 32, 239, 127, 115, 124, 75, 101, 205, 19, 103, 32, 239, 127, 115,
+        220, 97, 19, 116, 45, 66, 22, 116, 104, 243, 108, 101, 109, 121, 0, 78, 97, 111, 24, 59, 84, 117, 118, 30,
+        117, 0, 230, 190, 179, 233, 151, 168, 124, 77, 97, 99, 97, 111, 124, 230, 190, 179, 233, 150, 128, 124, 230, 190,
+        179, 233, 151, 168, 231, 137, 185, 229, 136, 171, 232, 161, 140, 230, 148, 191, 229, 140, 186, 220, 19, 116, 32, 77,
+        97, 22, 116, 125, 124, 83, 97, 19, 116, 45, 77, 22, 116, 19, 220, 19, 116, 32, 77, 97, 22, 116, 125, 124,
+        83, 97, 19, 116, 45, 77, 22, 116, 19, 0, 78, 31, 102, 111, 108, 107, 32, 239, 127, 124, 80, 104, 105, 108,
+        105, 112, 32, 239, 127, 0, 80, 88, 107, 24, 110, 32, 65, 105, 108, 125, 124, 80, 88, 107, 24, 110, 0, 66,
+        111, 117, 118, 101, 116, 195, 184, 121, 123, 66, 111, 117, 118, 101, 116, 45, 195, 184, 121, 8, 66, 24, 109, 117,
+        100, 8, 66, 114, 88, 61, 104, 32, 73, 110, 100, 105, 6, 32, 79, 99, 101, 6, 32, 84, 24, 114, 88, 31,
+        121, 220, 6, 32, 77, 22, 19, 59, 71, 117, 24, 110, 115, 101, 121, 0, 65, 110, 103, 117, 105, 108, 108, 8,
+        77, 55, 116, 115, 24, 114, 94, 0, 66, 97, 105, 108, 108, 105, 97, 103, 227, 100, 243, 32, 74, 195, 168, 114,
+        114, 255, 67, 104, 114, 61, 116, 109, 60, 32, 239, 127, 0, 87, 30, 108, 61, 45, 101, 116, 45, 70, 117, 116,
+        117, 110, 123, 85, 118, 101, 63, 109, 241, 70, 117, 116, 117, 110, 8, 86, 105, 114, 103, 19, 32, 239, 127, 115,
+        0, 76, 105, 101, 99, 104, 116, 125, 115, 116, 101, 19, 0, 65, 114, 117, 98, 8, 65, 111, 108, 101, 112, 196,
+        129, 110, 32, 65, 31, 197, 141, 107, 19, 32, 77, 204, 167, 97, 106, 101, 196, 188, 124, 77, 22, 115, 104, 30,
+        108, 32, 239, 127, 115, 124, 84, 104, 227, 77, 22, 115, 104, 30, 108, 32, 239, 127, 115, 0, 65, 109, 24, 105,
+        107, 63, 83, 196, 129, 109, 111, 123, 65, 109, 24, 95, 6, 32, 83, 203, 111, 8, 75, 197, 171, 107, 105, 32,
+        39, 196, 128, 105, 114, 6, 105, 124, 67, 111, 111, 107, 32, 239, 127, 115, 220, 97, 19, 116, 45, 80, 105, 24,
+        114, 101, 45, 101, 116, 45, 77, 105, 113, 117, 205, 55, 0, 78, 105, 117, 196, 147, 220, 97, 19, 116, 32, 75,
+        88, 116, 115, 32, 38, 32, 78, 101, 118, 61, 0, 67, 97, 121, 109, 6, 32, 61, 127, 115, 0, 66, 55, 101,
+        105, 114, 117, 124, 83, 19, 116, 32, 69, 117, 115, 116, 94, 105, 117, 115, 124, 83, 97, 98, 123, 83, 116, 94,
+        126, 222, 139, 222, 168, 222, 136, 222, 172, 222, 128, 222, 168, 222, 131, 222, 167, 222, 135, 222, 176, 222, 150, 222,
+        173, 222, 142, 222, 172, 32, 222, 150, 222, 170, 222, 137, 222, 176, 222, 128, 222, 171, 222, 131, 222, 168, 222, 135,
+        222, 176, 222, 148, 222, 167, 124, 68, 104, 105, 118, 101, 104, 105, 32, 82, 97, 97, 39, 106, 101, 121, 103, 227,
+        74, 117, 109, 104, 111, 31, 105, 121, 121, 8, 83, 97, 19, 116, 32, 72, 205, 125, 123, 83, 97, 19, 116, 32,
+        72, 205, 125, 97, 44, 32, 65, 115, 99, 125, 115, 105, 55, 32, 38, 32, 84, 114, 61, 116, 6, 32, 100, 63,
+        67, 117, 110, 104, 8, 77, 30, 116, 8, 76, 63, 71, 114, 125, 240, 64, 85, 110, 88, 101, 100, 32, 83, 116,
+        94, 57, 32, 86, 105, 114, 103, 19, 32, 239, 127, 115, 124, 65, 109, 24, 95, 6, 32, 86, 105, 114, 103, 19,
+        32, 239, 127, 115, 0, 77, 97, 121, 111, 116, 116, 252, 77, 97, 31, 64, 83, 118, 30, 98, 22, 100, 32, 111,
+        103, 32, 74, 6, 32, 77, 97, 121, 125, 58, 168, 47, 9, 209, 134, 11, 14, 10, 91, 14, 17, 32, 9, 42,
+        175, 17, 45, 208, 156, 1, 41, 14, 17, 220, 97, 19, 116, 32, 86, 19, 99, 125, 116, 32, 38, 32, 116, 104,
+        227, 71, 114, 125, 240, 19, 57, 124, 83, 97, 19, 116, 32, 86, 19, 99, 125, 116, 0, 72, 101, 22, 100, 32,
+        239, 127, 124, 77, 99, 68, 55, 30, 100, 32, 239, 127, 115, 0, 66, 22, 98, 240, 111, 115, 0, 65, 110, 116,
+        105, 103, 117, 63, 38, 32, 66, 22, 98, 117, 100, 8, 67, 117, 114, 97, 195, 167, 97, 111, 124, 75, 195, 178,
+        114, 115, 111, 117, 220, 101, 121, 99, 104, 205, 108, 57, 124, 83, 57, 205, 0, 66, 205, 97, 117, 124, 80, 205,
+        101, 119, 0, 239, 108, 60, 32, 77, 22, 105, 195, 165, 110, 60, 124, 108, 108, 195, 179, 108, 32, 77, 22, 105,
+        6, 60, 0, 80, 114, 19, 99, 105, 112, 94, 32, 100, 39, 65, 110, 100, 31, 114, 123, 65, 110, 100, 31, 114,
+        8, 71, 117, 203, 124, 71, 117, 195, 165, 104, 195, 165, 110, 0, 69, 108, 108, 6, 32, 86, 6, 110, 19, 124,
+        77, 6, 110, 124, 77, 6, 110, 19, 220, 97, 19, 116, 101, 45, 76, 117, 99, 105, 64, 77, 95, 114, 55, 57,
+        126, 230, 150, 176, 229, 138, 160, 229, 157, 161, 124, 83, 19, 103, 97, 112, 117, 114, 123, 224, 174, 154, 224, 174,
+        191, 224, 174, 153, 224, 175, 141, 224, 174, 149, 224, 174, 170, 224, 175, 141, 224, 174, 170, 224, 175, 130, 224, 174,
+        176, 224, 175, 141, 0, 84, 55, 103, 8, 68, 111, 109, 19, 105, 113, 117, 252, 87, 97, 105, 46, 152, 116, 117,
+        32, 107, 117, 98, 117, 108, 255, 221, 216, 168, 216, 173, 96, 193, 217, 134, 48, 124, 30, 45, 66, 97, 225, 184,
+        165, 114, 97, 121, 110, 0, 75, 105, 114, 105, 98, 94, 255, 84, 117, 114, 107, 115, 32, 38, 32, 67, 97, 95,
+        111, 115, 32, 239, 127, 115, 220, 195, 163, 241, 84, 111, 109, 243, 32, 227, 80, 114, 195, 173, 110, 99, 105, 112,
+        252, 83, 195, 163, 241, 84, 111, 109, 243, 124, 80, 114, 195, 173, 110, 99, 105, 112, 64, 233, 166, 153, 230, 184,
+        175, 124, 72, 55, 103, 32, 75, 55, 103, 124, 233, 166, 153, 230, 184, 175, 231, 137, 185, 229, 136, 171, 232, 161,
+        140, 230, 148, 191, 229, 140, 186, 0, 77, 22, 116, 19, 105, 113, 117, 64, 70, 195, 184, 114, 111, 121, 22, 124,
+        70, 195, 166, 114, 195, 184, 24, 110, 64, 71, 119, 240, 108, 111, 117, 112, 124, 71, 117, 240, 205, 111, 117, 112,
+        64, 216, 172, 216, 178, 96, 32, 221, 217, 130, 217, 133, 96, 254, 124, 67, 111, 109, 31, 57, 194, 160, 194, 160,
+        124, 75, 111, 109, 31, 255, 77, 97, 117, 114, 95, 252, 77, 31, 61, 0, 82, 243, 117, 110, 105, 55, 124, 76,
+        63, 82, 243, 117, 110, 105, 55, 0, 76, 195, 171, 116, 122, 101, 98, 117, 24, 103, 124, 76, 117, 120, 101, 109,
+        98, 117, 114, 103, 220, 196, 129, 109, 111, 8, 83, 71, 83, 83, 73, 0, 80, 111, 108, 121, 110, 243, 115, 105,
+        227, 102, 114, 6, 195, 167, 97, 61, 252, 80, 197, 141, 114, 196, 171, 110, 101, 116, 105, 63, 70, 22, 196, 129,
+        110, 255, 67, 97, 98, 241, 86, 24, 100, 64, 84, 114, 19, 105, 100, 240, 32, 38, 32, 84, 111, 98, 97, 103,
+        59, 216, 168, 96, 217, 136, 217, 134, 193, 32, 216, 175, 25, 96, 221, 216, 179, 217, 132, 51, 133, 124, 66, 114,
+        117, 110, 101, 105, 32, 68, 22, 117, 115, 115, 30, 203, 0, 84, 24, 114, 57, 32, 97, 117, 115, 116, 114, 30,
+        57, 32, 101, 116, 32, 6, 116, 22, 99, 116, 105, 113, 117, 57, 32, 102, 114, 6, 195, 167, 97, 61, 57, 124,
+        84, 65, 65, 70, 0, 80, 117, 24, 116, 241, 82, 95, 59, 206, 154, 207, 141, 207, 128, 207, 129, 206, 191, 207,
+        130, 124, 75, 196, 177, 98, 114, 196, 177, 115, 0, 217, 132, 216, 168, 217, 134, 51, 134, 254, 124, 76, 105, 98,
+        110, 196, 129, 110, 0, 74, 203, 97, 95, 8, 84, 104, 227, 71, 203, 98, 105, 123, 71, 203, 98, 126, 217, 130,
+        216, 183, 96, 254, 124, 81, 97, 225, 185, 173, 22, 0, 239, 108, 60, 32, 77, 30, 118, 19, 60, 124, 70, 30,
+        107, 127, 32, 239, 127, 115, 0, 86, 6, 117, 94, 117, 13, 166, 10, 17, 1, 42, 147, 5, 247, 124, 67, 114,
+        110, 63, 71, 31, 8, 66, 97, 104, 203, 60, 0, 84, 105, 109, 195, 179, 114, 32, 76, 31, 111, 115, 97, 39,
+        252, 84, 105, 109, 195, 179, 114, 45, 76, 57, 116, 64, 85, 109, 98, 117, 115, 241, 119, 101, 83, 119, 94, 19,
+        105, 124, 107, 97, 78, 103, 119, 6, 252, 69, 115, 119, 94, 19, 255, 216, 175, 217, 136, 217, 132, 216, 169, 32,
+        221, 217, 131, 217, 136, 193, 216, 170, 124, 75, 117, 119, 97, 88, 0, 86, 88, 105, 124, 2, 171, 2, 188, 2,
+        191, 2, 156, 27, 128, 0, 78, 111, 117, 118, 205, 108, 101, 45, 67, 30, 243, 100, 55, 105, 64, 83, 108, 111,
+        118, 125, 105, 106, 8, 215, 153, 214, 180, 215, 169, 214, 176, 215, 130, 215, 168, 214, 184, 215, 144, 214, 181, 215,
+        156, 124, 216, 165, 217, 144, 216, 179, 217, 146, 96, 217, 142, 25, 216, 166, 217, 144, 193, 217, 132, 254, 124, 239,
+        114, 97, 205, 0, 216, 175, 217, 136, 217, 132, 216, 169, 32, 217, 129, 217, 132, 216, 179, 216, 183, 193, 217, 134,
+        124, 215, 158, 215, 147, 215, 153, 215, 160, 215, 170, 32, 215, 164, 215, 156, 215, 161, 215, 152, 215, 153, 215, 159,
+        124, 221, 216, 163, 96, 25, 216, 182, 193, 32, 221, 217, 129, 217, 132, 216, 179, 216, 183, 193, 217, 134, 193, 216,
+        169, 0, 69, 108, 32, 83, 30, 118, 240, 31, 0, 66, 205, 105, 122, 64, 216, 172, 193, 216, 168, 217, 136, 216,
+        170, 193, 254, 124, 74, 97, 98, 117, 117, 116, 105, 124, 71, 97, 98, 117, 117, 116, 105, 13, 156, 1, 4, 14,
+        245, 5, 17, 9, 209, 152, 1, 124, 77, 97, 99, 101, 100, 55, 126, 82, 119, 38, 8, 72, 97, 195, 175, 116,
+        105, 124, 65, 121, 88, 255, 85, 98, 117, 114, 117, 110, 100, 105, 124, 66, 117, 114, 117, 110, 100, 255, 71, 117,
+        19, 101, 63, 69, 99, 117, 94, 31, 105, 30, 124, 71, 117, 19, 243, 227, 243, 113, 117, 94, 31, 105, 30, 252,
+        71, 117, 19, 243, 32, 69, 113, 117, 94, 31, 105, 30, 220, 104, 113, 105, 112, 195, 171, 114, 105, 124, 83, 104,
+        113, 105, 112, 195, 171, 114, 105, 123, 83, 104, 113, 105, 112, 110, 105, 124, 83, 104, 113, 121, 112, 110, 105, 220,
+        111, 108, 111, 109, 55, 32, 239, 127, 115, 0, 213, 128, 213, 161, 213, 181, 213, 161, 213, 189, 213, 191, 213, 161,
+        213, 182, 124, 72, 97, 121, 60, 116, 6, 0, 39, 77, 117, 115, 241, 111, 63, 76, 57, 111, 116, 104, 59, 66,
+        205, 103, 105, 195, 171, 124, 66, 205, 103, 105, 113, 117, 252, 66, 205, 103, 105, 125, 0, 77, 111, 108, 100, 111,
+        118, 8, 71, 117, 19, 243, 45, 66, 61, 115, 97, 117, 0, 228, 184, 173, 232, 143, 175, 230, 176, 145, 229, 156,
+        139, 124, 228, 184, 173, 229, 141, 142, 230, 176, 145, 229, 155, 189, 0, 249, 160, 249, 150, 224, 190, 178, 249, 180,
+        249, 130, 224, 188, 139, 249, 161, 249, 180, 249, 163, 224, 188, 139, 124, 249, 160, 249, 150, 224, 190, 178, 249, 180,
+        249, 130, 224, 188, 139, 249, 162, 224, 190, 146, 224, 190, 177, 249, 163, 224, 188, 139, 249, 129, 249, 150, 224, 188,
+        139, 220, 99, 104, 119, 101, 105, 122, 124, 115, 117, 61, 115, 252, 83, 118, 105, 122, 122, 24, 97, 194, 160, 194,
+        160, 0, 78, 101, 100, 24, 127, 0, 68, 6, 109, 22, 107, 0, 69, 57, 116, 255, 82, 101, 112, 195, 186, 98,
+        108, 95, 63, 68, 111, 109, 19, 95, 6, 8, 83, 108, 111, 118, 125, 115, 107, 59, 67, 111, 115, 116, 63, 82,
+        95, 8, 66, 111, 115, 110, 63, 105, 32, 72, 24, 99, 101, 103, 111, 118, 19, 97, 58, 145, 5, 3, 17, 1,
+        32, 9, 42, 165, 14, 10, 209, 134, 14, 91, 5, 49, 9, 17, 1, 0, 72, 114, 118, 94, 115, 107, 8, 82,
+        243, 112, 117, 98, 108, 105, 113, 117, 227, 116, 111, 103, 111, 108, 97, 61, 252, 84, 111, 103, 59, 76, 94, 118,
+        105, 106, 8, 76, 105, 101, 116, 117, 118, 8, 224, 183, 129, 224, 183, 138, 46, 141, 224, 182, 187, 224, 183, 147,
+        32, 224, 182, 189, 224, 182, 130, 224, 182, 154, 224, 183, 143, 124, 224, 174, 135, 224, 174, 178, 224, 174, 153, 224,
+        175, 141, 224, 174, 149, 224, 175, 136, 124, 83, 114, 105, 32, 76, 6, 107, 63, 0, 225, 131, 161, 225, 131, 144,
+        225, 131, 165, 225, 131, 144, 225, 131, 160, 225, 131, 151, 225, 131, 149, 225, 131, 148, 225, 131, 154, 225, 131, 157,
+        58, 147, 10, 20, 208, 183, 9, 18, 124, 83, 97, 107, 22, 116, 118, 205, 59, 195, 137, 105, 114, 252, 65, 105,
+        114, 108, 6, 110, 220, 105, 24, 114, 63, 76, 101, 55, 64, 80, 6, 203, 195, 161, 0, 196, 140, 57, 107, 195,
+        161, 32, 114, 101, 112, 117, 98, 108, 105, 107, 123, 196, 140, 57, 107, 59, 71, 117, 121, 6, 227, 102, 114, 6,
+        195, 167, 97, 61, 252, 71, 117, 121, 6, 252, 71, 117, 105, 6, 63, 0, 221, 216, 165, 217, 133, 25, 96, 25,
+        216, 170, 32, 221, 216, 185, 96, 216, 168, 193, 216, 169, 32, 221, 217, 133, 216, 170, 216, 173, 216, 175, 216, 169,
+        124, 69, 109, 105, 114, 94, 57, 124, 85, 65, 69, 0, 195, 150, 115, 116, 24, 114, 101, 95, 104, 0, 65, 122,
+        201, 153, 114, 98, 97, 121, 99, 6, 13, 161, 10, 11, 9, 209, 152, 1, 124, 83, 114, 98, 105, 106, 8, 221,
+        216, 163, 96, 216, 175, 217, 134, 254, 124, 74, 31, 100, 6, 0, 80, 31, 116, 117, 103, 30, 0, 77, 97, 103,
+        121, 22, 31, 115, 122, 195, 161, 103, 0, 235, 140, 128, 237, 149, 156, 235, 175, 188, 234, 181, 173, 124, 83, 111,
+        117, 116, 104, 32, 75, 31, 101, 8, 195, 141, 115, 127, 0, 71, 117, 94, 101, 109, 30, 8, 67, 117, 98, 8,
+        208, 145, 209, 138, 7, 91, 1, 10, 9, 18, 0, 76, 105, 98, 24, 126, 72, 55, 100, 117, 114, 60, 0, 66,
+        243, 110, 19, 0, 225, 138, 164, 225, 136, 173, 225, 137, 181, 225, 136, 170, 225, 139, 171, 124, 216, 165, 96, 193,
+        216, 170, 96, 193, 25, 124, 69, 114, 88, 114, 101, 8, 77, 30, 97, 197, 181, 255, 236, 161, 176, 236, 132, 160,
+        32, 235, 175, 188, 236, 163, 188, 236, 163, 188, 236, 157, 152, 32, 236, 157, 184, 235, 175, 188, 32, 234, 179, 181,
+        237, 153, 148, 234, 181, 173, 0, 78, 95, 22, 97, 103, 117, 8, 206, 149, 206, 187, 206, 187, 206, 172, 206, 180,
+        206, 177, 124, 72, 205, 108, 60, 13, 162, 5, 210, 183, 9, 4, 9, 21, 5, 17, 0, 28, 172, 28, 190, 28,
+        130, 28, 178, 28, 190, 28, 166, 224, 167, 135, 28, 182, 0, 2, 168, 27, 135, 2, 170, 200, 2, 178, 124, 78,
+        101, 112, 196, 129, 108, 0, 216, 170, 217, 136, 217, 134, 216, 179, 254, 124, 84, 117, 110, 61, 105, 252, 226, 181,
+        156, 226, 181, 147, 226, 181, 143, 226, 180, 187, 226, 181, 153, 220, 117, 114, 19, 203, 252, 83, 117, 114, 19, 203,
+        0, 85, 114, 117, 103, 117, 97, 121, 0, 225, 158, 128, 225, 158, 152, 225, 159, 146, 225, 158, 150, 225, 158, 187,
+        225, 158, 135, 225, 158, 182, 0, 216, 179, 217, 136, 96, 193, 25, 254, 124, 83, 121, 114, 105, 123, 216, 179, 217,
+        136, 96, 193, 216, 169, 220, 243, 110, 243, 103, 30, 13, 154, 248, 10, 91, 248, 208, 183, 21, 250, 58, 154, 9,
+        10, 91, 9, 208, 183, 9, 18, 13, 145, 14, 7, 1, 10, 20, 37, 3, 23, 124, 66, 205, 22, 117, 115, 124,
+        216, 168, 193, 217, 142, 217, 132, 25, 96, 217, 143, 216, 171, 58, 145, 14, 7, 1, 10, 20, 3, 23, 0, 71,
+        117, 121, 6, 8, 224, 186, 165, 224, 186, 178, 224, 186, 167, 124, 76, 97, 59, 82, 111, 109, 195, 162, 110, 126,
+        71, 104, 6, 8, 85, 103, 38, 8, 85, 110, 88, 101, 100, 32, 75, 19, 103, 100, 111, 109, 0, 71, 117, 19,
+        243, 64, 69, 99, 117, 240, 31, 0, 221, 216, 181, 216, 173, 96, 25, 216, 161, 32, 221, 216, 186, 96, 216, 168,
+        193, 216, 169, 124, 84, 6, 101, 225, 186, 147, 114, 111, 102, 116, 32, 84, 117, 116, 114, 105, 109, 116, 0, 71,
+        97, 98, 55, 0, 65, 111, 116, 101, 22, 111, 8, 66, 117, 114, 107, 19, 63, 70, 60, 59, 80, 105, 108, 105,
+        112, 19, 60, 0, 73, 116, 30, 126, 216, 185, 217, 133, 51, 134, 254, 124, 79, 109, 6, 0, 80, 111, 108, 115,
+        107, 8, 67, 195, 180, 116, 227, 100, 39, 73, 118, 111, 105, 114, 64, 78, 31, 103, 252, 78, 31, 101, 103, 0,
+        77, 30, 97, 121, 115, 105, 123, 233, 169, 172, 230, 157, 165, 232, 165, 191, 228, 186, 154, 0, 86, 105, 225, 187,
+        135, 116, 32, 78, 203, 220, 117, 111, 109, 255, 67, 55, 103, 59, 68, 101, 117, 116, 115, 99, 104, 127, 0, 230,
+        151, 165, 230, 156, 172, 124, 78, 105, 112, 112, 55, 124, 78, 105, 104, 55, 124, 230, 151, 165, 230, 156, 172, 229,
+        155, 189, 0, 90, 105, 109, 98, 97, 98, 119, 64, 80, 22, 97, 103, 117, 195, 161, 105, 124, 80, 22, 97, 103,
+        117, 97, 121, 0, 221, 216, 185, 96, 51, 130, 254, 124, 73, 114, 196, 129, 113, 0, 221, 217, 133, 216, 186, 96,
+        216, 168, 254, 124, 77, 31, 111, 99, 99, 111, 124, 226, 181, 141, 226, 181, 142, 226, 180, 176, 226, 181, 150, 226,
+        181, 148, 226, 181, 137, 226, 180, 177, 0, 79, 202, 187, 122, 98, 101, 107, 61, 116, 55, 220, 118, 24, 105, 103,
+        64, 80, 97, 112, 117, 63, 78, 105, 117, 103, 19, 105, 124, 80, 97, 112, 117, 63, 78, 105, 117, 32, 71, 19,
+        255, 67, 203, 24, 111, 117, 110, 13, 162, 210, 175, 10, 4, 92, 14, 17, 9, 21, 250, 124, 84, 195, 188, 114,
+        107, 109, 125, 61, 116, 6, 124, 216, 170, 219, 134, 96, 217, 131, 217, 133, 217, 134, 193, 216, 179, 216, 170, 216,
+        162, 217, 134, 0, 69, 115, 112, 97, 195, 177, 8, 224, 184, 155, 224, 184, 163, 224, 184, 176, 224, 185, 128, 224,
+        184, 151, 224, 184, 168, 224, 185, 132, 224, 184, 151, 224, 184, 162, 124, 80, 114, 94, 104, 101, 116, 32, 84, 104,
+        97, 255, 221, 193, 217, 142, 217, 133, 217, 142, 217, 134, 254, 124, 89, 101, 109, 125, 0, 70, 114, 6, 99, 64,
+        195, 133, 127, 124, 65, 104, 118, 125, 6, 109, 97, 8, 75, 125, 121, 8, 66, 111, 116, 115, 119, 6, 8, 77,
+        240, 97, 103, 60, 105, 107, 22, 123, 77, 240, 97, 103, 60, 99, 22, 13, 163, 4, 247, 209, 151, 17, 1, 220,
+        111, 117, 116, 104, 32, 83, 117, 100, 6, 124, 216, 172, 217, 134, 217, 136, 216, 168, 32, 221, 216, 179, 217, 136,
+        216, 175, 51, 134, 0, 75, 195, 182, 100, 195, 182, 114, 195, 182, 115, 195, 170, 115, 227, 116, 195, 174, 32, 66,
+        195, 170, 97, 102, 114, 195, 174, 107, 123, 67, 125, 116, 114, 97, 102, 114, 95, 97, 19, 64, 221, 216, 181, 217,
+        136, 217, 133, 221, 254, 124, 83, 111, 111, 109, 97, 30, 105, 121, 8, 51, 129, 216, 186, 51, 134, 216, 179, 216,
+        170, 51, 134, 124, 65, 102, 196, 161, 196, 129, 110, 61, 116, 196, 129, 110, 0, 62, 149, 62, 188, 62, 138, 62,
+        186, 62, 145, 62, 177, 62, 172, 62, 132, 62, 186, 62, 133, 62, 175, 32, 62, 158, 62, 153, 62, 185, 62, 153,
+        62, 144, 32, 62, 153, 62, 188, 62, 148, 62, 186, 62, 153, 62, 172, 62, 148, 62, 173, 62, 175, 62, 132, 62,
+        186, 62, 132, 62, 182, 62, 144, 62, 177, 62, 172, 62, 186, 46, 140, 124, 77, 121, 6, 109, 22, 0, 90, 203,
+        98, 126, 67, 104, 105, 108, 64, 84, 195, 188, 114, 107, 105, 121, 64, 217, 190, 25, 218, 169, 216, 179, 216, 170,
+        51, 134, 124, 80, 97, 107, 61, 116, 6, 0, 77, 111, 195, 167, 203, 98, 105, 113, 117, 64, 78, 203, 105, 98,
+        105, 195, 171, 124, 78, 203, 105, 98, 126, 86, 125, 101, 122, 117, 205, 8, 78, 105, 106, 24, 105, 121, 123, 78,
+        97, 195, 172, 106, 195, 173, 114, 195, 173, 121, 195, 160, 124, 78, 195, 160, 195, 172, 106, 195, 173, 114, 195, 173,
+        195, 160, 0, 84, 6, 122, 6, 126, 217, 133, 217, 144, 216, 181, 96, 254, 124, 69, 103, 121, 112, 116, 124, 217,
+        133, 217, 142, 216, 181, 96, 254, 0, 217, 133, 217, 136, 96, 193, 216, 170, 51, 134, 193, 25, 124, 77, 97, 117,
+        114, 88, 6, 105, 252, 77, 117, 114, 88, 6, 121, 123, 71, 195, 160, 110, 110, 97, 22, 0, 66, 117, 108, 105,
+        119, 121, 123, 87, 117, 108, 105, 119, 121, 123, 66, 111, 108, 105, 118, 126, 69, 116, 104, 105, 111, 112, 105, 123,
+        225, 138, 162, 225, 137, 181, 225, 139, 174, 225, 140, 181, 225, 139, 171, 0, 67, 111, 108, 111, 109, 98, 126, 90,
+        117, 105, 100, 45, 65, 102, 114, 105, 107, 123, 83, 117, 105, 100, 45, 65, 102, 114, 105, 107, 123, 65, 102, 114,
+        105, 107, 63, 66, 31, 119, 8, 77, 30, 255, 65, 110, 103, 111, 108, 8, 78, 105, 103, 24, 0, 216, 170, 216,
+        180, 25, 216, 175, 254, 124, 84, 99, 104, 240, 124, 67, 104, 240, 0, 80, 24, 195, 186, 124, 80, 105, 114, 117,
+        119, 13, 156, 5, 17, 91, 5, 7, 42, 163, 7, 3, 124, 225, 160, 174, 225, 160, 164, 225, 160, 169, 225, 160,
+        173, 225, 160, 164, 225, 160, 175, 32, 225, 160, 164, 225, 160, 175, 225, 160, 164, 225, 160, 176, 0, 25, 219, 140,
+        96, 51, 134, 124, 73, 114, 6, 124, 80, 24, 115, 105, 63, 0, 217, 132, 193, 216, 168, 193, 25, 254, 124, 76,
+        105, 98, 121, 123, 216, 175, 217, 136, 217, 132, 216, 169, 32, 217, 132, 193, 216, 168, 193, 25, 0, 221, 216, 179,
+        217, 136, 216, 175, 51, 134, 254, 124, 83, 117, 100, 6, 0, 73, 110, 100, 55, 57, 126, 77, 101, 120, 95, 241,
+        67, 88, 121, 0, 84, 108, 97, 120, 99, 30, 8, 77, 31, 205, 111, 115, 0, 65, 103, 117, 60, 99, 30, 105,
+        125, 116, 57, 0, 67, 111, 108, 105, 109, 8, 81, 117, 24, 243, 116, 22, 111, 124, 81, 117, 24, 243, 116, 22,
+        241, 100, 227, 65, 114, 116, 101, 97, 103, 8, 72, 105, 100, 30, 103, 59, 77, 243, 120, 95, 59, 84, 97, 98,
+        60, 99, 59, 78, 97, 121, 22, 88, 0, 71, 117, 6, 97, 106, 117, 94, 59, 80, 117, 101, 98, 108, 8, 89,
+        117, 99, 94, 195, 161, 110, 0, 81, 117, 19, 116, 6, 63, 82, 111, 59, 83, 19, 30, 111, 8, 67, 203, 112,
+        101, 99, 104, 64, 77, 95, 104, 111, 97, 99, 195, 161, 110, 124, 77, 95, 104, 111, 97, 99, 195, 161, 110, 32,
+        100, 227, 79, 99, 203, 112, 59, 83, 6, 32, 76, 117, 61, 32, 80, 111, 116, 111, 115, 195, 173, 0, 71, 117,
+        24, 114, 24, 59, 78, 117, 101, 118, 241, 76, 101, 195, 179, 110, 0, 66, 97, 106, 63, 67, 30, 105, 102, 31,
+        110, 105, 63, 83, 117, 114, 0, 86, 24, 97, 99, 114, 117, 122, 0, 67, 104, 105, 97, 112, 60, 0, 66, 97,
+        106, 63, 67, 30, 105, 102, 31, 110, 126, 90, 97, 99, 94, 101, 99, 60, 0, 74, 30, 61, 99, 59, 84, 203,
+        97, 117, 108, 105, 112, 60, 0, 79, 97, 120, 97, 99, 8, 68, 117, 114, 6, 103, 59, 67, 111, 97, 104, 117,
+        105, 108, 123, 67, 111, 97, 104, 117, 105, 108, 63, 100, 227, 90, 22, 97, 103, 111, 122, 8, 83, 55, 31, 8,
+        67, 104, 105, 104, 117, 97, 104, 117, 8, 71, 114, 195, 184, 110, 127, 124, 75, 30, 97, 30, 108, 88, 32, 78,
+        117, 110, 97, 94, 0, 221, 216, 179, 216, 185, 217, 136, 216, 175, 193, 216, 169, 124, 83, 97, 117, 100, 105, 32,
+        65, 114, 97, 98, 105, 123, 221, 217, 133, 217, 133, 217, 132, 217, 131, 216, 169, 32, 221, 216, 185, 96, 216, 168,
+        193, 216, 169, 32, 221, 216, 179, 216, 185, 217, 136, 216, 175, 193, 216, 169, 0, 75, 55, 103, 59, 221, 216, 172,
+        216, 178, 25, 216, 166, 96, 254, 124, 65, 108, 103, 243, 114, 105, 252, 226, 180, 183, 226, 181, 163, 226, 180, 176,
+        226, 181, 162, 226, 180, 187, 226, 181, 148, 0, 210, 154, 1, 208, 183, 1, 210, 155, 21, 250, 124, 81, 97, 122,
+        97, 113, 115, 116, 6, 124, 75, 97, 122, 97, 107, 104, 115, 116, 6, 0, 65, 114, 103, 125, 116, 19, 123, 65,
+        114, 103, 125, 116, 19, 64, 2, 166, 2, 174, 2, 163, 32, 2, 134, 2, 163, 2, 191, 32, 2, 166, 27, 128,
+        2, 181, 124, 212, 166, 212, 174, 212, 163, 32, 212, 133, 212, 168, 224, 171, 135, 32, 212, 166, 224, 171, 128, 212,
+        181, 124, 68, 203, 195, 163, 241, 227, 68, 105, 117, 0, 2, 166, 200, 2, 166, 198, 200, 32, 2, 148, 198, 32,
+        2, 168, 2, 151, 198, 32, 2, 185, 2, 181, 27, 135, 2, 178, 27, 128, 124, 212, 166, 212, 190, 212, 166, 212,
+        176, 212, 190, 32, 212, 133, 212, 168, 224, 171, 135, 32, 212, 168, 212, 151, 212, 176, 32, 212, 185, 212, 181, 224,
+        171, 135, 212, 178, 224, 171, 128, 124, 68, 240, 114, 63, 38, 32, 78, 97, 103, 22, 32, 72, 97, 118, 205, 255,
+        2, 154, 2, 130, 2, 161, 27, 128, 2, 151, 2, 162, 2, 188, 124, 67, 104, 38, 105, 103, 22, 104, 124, 199,
+        154, 224, 169, 176, 199, 161, 224, 169, 128, 199, 151, 224, 169, 156, 224, 169, 141, 199, 185, 0, 2, 133, 2, 163,
+        238, 2, 161, 2, 174, 200, 2, 168, 32, 2, 148, 198, 32, 2, 168, 2, 191, 2, 149, 27, 139, 2, 172, 200,
+        198, 124, 65, 110, 100, 203, 6, 32, 38, 32, 78, 95, 111, 98, 22, 124, 28, 134, 28, 168, 224, 167, 141, 28,
+        166, 28, 190, 28, 174, 28, 190, 28, 168, 32, 28, 147, 32, 28, 168, 28, 191, 28, 149, 224, 167, 139, 28, 172,
+        28, 176, 0, 224, 180, 178, 224, 180, 149, 224, 181, 141, 224, 180, 183, 224, 180, 166, 224, 181, 141, 224, 180, 181,
+        224, 181, 128, 224, 180, 170, 224, 181, 141, 124, 76, 97, 107, 115, 104, 240, 119, 101, 101, 112, 124, 2, 178, 2,
+        149, 238, 2, 183, 2, 166, 238, 2, 181, 27, 128, 2, 170, 0, 2, 166, 2, 191, 2, 178, 238, 2, 178, 27,
+        128, 124, 199, 166, 199, 191, 224, 169, 177, 199, 178, 224, 169, 128, 32, 39, 124, 68, 205, 104, 255, 77, 101, 103,
+        97, 104, 30, 97, 121, 123, 2, 174, 27, 135, 2, 152, 200, 2, 178, 2, 175, 0, 78, 97, 103, 30, 38, 124,
+        2, 168, 2, 151, 200, 2, 178, 27, 136, 2, 130, 2, 161, 0, 28, 174, 28, 163, 28, 191, 28, 170, 224, 167,
+        129, 28, 176, 0, 28, 164, 224, 167, 141, 28, 176, 28, 191, 28, 170, 224, 167, 129, 28, 176, 28, 190, 0, 2,
+        174, 2, 191, 2, 156, 27, 139, 198, 2, 174, 124, 77, 105, 122, 31, 203, 0, 2, 184, 2, 191, 2, 149, 238,
+        2, 149, 2, 191, 2, 174, 0, 199, 170, 224, 169, 176, 199, 156, 199, 190, 199, 172, 124, 2, 170, 2, 130, 2,
+        156, 200, 2, 172, 124, 80, 117, 110, 106, 97, 98, 0, 2, 185, 198, 2, 191, 2, 175, 200, 2, 163, 200, 124,
+        199, 185, 199, 176, 199, 191, 199, 134, 199, 163, 199, 190, 124, 72, 22, 121, 6, 8, 65, 114, 117, 110, 97, 99,
+        104, 30, 32, 80, 114, 240, 57, 104, 124, 2, 133, 198, 27, 129, 2, 163, 200, 2, 154, 2, 178, 32, 2, 170,
+        238, 198, 2, 166, 27, 135, 2, 182, 0, 28, 133, 28, 184, 28, 174, 0, 2, 172, 2, 191, 2, 185, 200, 198,
+        124, 216, 168, 219, 129, 25, 96, 0, 2, 137, 2, 164, 238, 2, 164, 198, 200, 2, 150, 2, 163, 238, 2, 161,
+        0, 2, 151, 27, 139, 2, 130, 2, 175, 0, 224, 180, 149, 224, 181, 135, 224, 180, 176, 224, 180, 179, 224, 180,
+        130, 124, 75, 24, 30, 123, 2, 149, 27, 135, 198, 2, 178, 0, 224, 174, 164, 224, 174, 174, 224, 174, 191, 224,
+        174, 180, 224, 175, 141, 224, 174, 168, 224, 174, 190, 224, 174, 159, 224, 175, 129, 124, 2, 164, 2, 174, 2, 191,
+        2, 178, 2, 168, 200, 2, 161, 27, 242, 2, 185, 2, 191, 2, 174, 200, 2, 154, 2, 178, 32, 2, 170, 238,
+        198, 2, 166, 27, 135, 2, 182, 124, 72, 105, 109, 97, 99, 104, 30, 32, 80, 114, 240, 57, 104, 0, 216, 172,
+        217, 133, 217, 136, 218, 186, 32, 217, 136, 32, 218, 169, 216, 180, 217, 133, 219, 140, 124, 2, 156, 2, 174, 238,
+        2, 174, 27, 130, 32, 2, 148, 198, 32, 2, 149, 2, 182, 238, 2, 174, 27, 128, 198, 124, 199, 156, 224, 169,
+        176, 199, 174, 224, 169, 130, 32, 199, 133, 199, 164, 224, 169, 135, 32, 199, 149, 199, 184, 199, 188, 199, 174, 224,
+        169, 128, 199, 176, 0, 2, 155, 2, 164, 238, 2, 164, 27, 128, 2, 184, 2, 151, 2, 162, 2, 188, 0, 2,
+        157, 200, 198, 2, 150, 2, 163, 238, 2, 161, 124, 28, 157, 28, 190, 28, 161, 28, 188, 28, 150, 28, 163, 224,
+        167, 141, 28, 161, 124, 74, 104, 22, 107, 104, 38, 0, 224, 178, 149, 224, 178, 176, 224, 179, 141, 224, 178, 168,
+        224, 178, 190, 224, 178, 159, 224, 178, 149, 124, 2, 149, 198, 238, 2, 168, 200, 2, 159, 2, 149, 124, 75, 22,
+        110, 94, 97, 107, 8, 198, 200, 2, 156, 2, 184, 238, 2, 165, 200, 2, 168, 0, 224, 172, 147, 224, 172, 161,
+        224, 172, 188, 224, 172, 191, 224, 172, 182, 224, 172, 190, 124, 79, 100, 61, 104, 8, 212, 151, 224, 171, 129, 212,
+        156, 212, 176, 212, 190, 212, 164, 124, 71, 117, 106, 22, 94, 124, 2, 151, 27, 129, 2, 156, 198, 200, 2, 164,
+        0, 28, 170, 28, 182, 224, 167, 141, 28, 154, 28, 191, 28, 174, 28, 172, 28, 153, 224, 167, 141, 28, 151, 124,
+        87, 57, 116, 32, 66, 125, 103, 30, 0, 2, 174, 2, 167, 238, 2, 175, 32, 2, 170, 238, 198, 2, 166, 27,
+        135, 2, 182, 0, 253, 164, 224, 177, 134, 253, 178, 253, 130, 253, 151, 253, 190, 253, 163, 124, 216, 170, 217, 132,
+        217, 134, 218, 175, 51, 134, 219, 129, 124, 2, 164, 27, 135, 2, 178, 2, 130, 2, 151, 200, 2, 168, 200, 0,
+        253, 134, 253, 130, 253, 167, 224, 177, 141, 253, 176, 32, 253, 170, 224, 177, 141, 253, 176, 253, 166, 224, 177, 135,
+        253, 182, 224, 177, 141, 124, 2, 134, 2, 130, 2, 167, 238, 198, 32, 2, 170, 238, 198, 2, 166, 27, 135, 2,
+        182, 0, 2, 174, 2, 185, 200, 198, 200, 2, 183, 238, 2, 159, 238, 198, 0, 2, 137, 2, 164, 238, 2, 164,
+        198, 32, 2, 170, 238, 198, 2, 166, 27, 135, 2, 182, 124, 85, 116, 116, 22, 32, 80, 114, 240, 57, 104, 124,
+        25, 216, 170, 96, 32, 217, 190, 96, 216, 175, 219, 140, 216, 180, 0, 224, 180, 170, 224, 181, 129, 224, 180, 164,
+        224, 181, 129, 224, 180, 154, 224, 181, 141, 224, 180, 154, 224, 181, 135, 224, 180, 176, 224, 180, 191, 124, 253, 170,
+        224, 177, 129, 253, 166, 224, 177, 129, 253, 154, 224, 177, 141, 253, 154, 224, 177, 135, 253, 176, 253, 191, 124, 2,
+        170, 27, 129, 2, 161, 27, 129, 2, 154, 27, 135, 198, 27, 128, 124, 80, 117, 100, 117, 99, 104, 24, 114, 121,
+        0, 78, 101, 119, 32, 83, 111, 117, 116, 104, 32, 87, 30, 57, 0, 65, 117, 115, 116, 114, 30, 105, 6, 32,
+        67, 97, 112, 88, 30, 32, 84, 24, 114, 88, 31, 121, 124, 67, 97, 112, 88, 30, 32, 84, 24, 114, 88, 31,
+        121, 0, 74, 24, 118, 61, 32, 66, 97, 121, 32, 84, 24, 114, 88, 31, 121, 124, 74, 24, 118, 61, 32, 66,
+        97, 121, 0, 78, 31, 116, 104, 24, 110, 32, 84, 24, 114, 88, 31, 121, 220, 111, 117, 116, 104, 32, 65, 117,
+        115, 116, 114, 30, 126, 84, 60, 109, 6, 126, 86, 95, 116, 31, 126, 87, 57, 116, 24, 110, 32, 65, 117, 115,
+        116, 114, 30, 126, 81, 117, 101, 125, 115, 127, 0, 68, 61, 116, 114, 88, 241, 70, 101, 100, 24, 30, 220, 24,
+        103, 105, 112, 64, 65, 108, 97, 103, 111, 60, 0, 82, 105, 241, 100, 227, 74, 6, 101, 105, 114, 59, 69, 115,
+        112, 105, 114, 88, 241, 83, 6, 116, 59, 82, 105, 241, 71, 114, 38, 227, 100, 241, 78, 31, 116, 64, 80, 22,
+        97, 195, 173, 98, 8, 83, 6, 116, 63, 67, 94, 22, 19, 8, 80, 24, 110, 203, 98, 117, 99, 59, 65, 109,
+        97, 112, 195, 161, 0, 67, 101, 22, 195, 161, 0, 65, 99, 114, 64, 80, 22, 6, 195, 161, 0, 82, 31, 97,
+        105, 109, 8, 82, 55, 100, 195, 180, 110, 126, 83, 195, 163, 241, 80, 97, 117, 108, 59, 80, 105, 97, 117, 195,
+        173, 0, 84, 111, 99, 6, 116, 19, 115, 0, 82, 105, 241, 71, 114, 38, 227, 100, 241, 83, 117, 108, 0, 77,
+        22, 6, 104, 195, 163, 59, 71, 111, 105, 195, 161, 115, 0, 77, 94, 241, 71, 114, 111, 115, 115, 241, 100, 241,
+        83, 117, 108, 0, 66, 97, 104, 126, 77, 19, 60, 32, 71, 24, 97, 61, 0, 77, 94, 241, 71, 114, 111, 115,
+        115, 59, 80, 22, 195, 161, 0, 65, 109, 97, 122, 55, 60, 0, 68, 61, 116, 114, 95, 116, 32, 111, 102, 32,
+        67, 111, 108, 117, 109, 98, 126, 82, 104, 111, 100, 227, 239, 127, 0, 68, 205, 97, 119, 22, 64, 67, 55, 110,
+        101, 99, 116, 95, 117, 116, 0, 78, 101, 119, 32, 74, 24, 115, 101, 121, 0, 78, 101, 119, 32, 72, 203, 112,
+        115, 104, 105, 114, 64, 86, 24, 109, 55, 116, 0, 77, 60, 115, 97, 99, 104, 117, 115, 101, 116, 116, 115, 0,
+        72, 97, 119, 97, 105, 255, 77, 22, 121, 127, 0, 87, 57, 116, 32, 86, 105, 114, 103, 19, 126, 83, 111, 117,
+        116, 104, 32, 67, 22, 111, 108, 19, 8, 77, 97, 19, 64, 73, 110, 100, 105, 6, 8, 75, 125, 116, 117, 99,
+        107, 121, 0, 84, 125, 110, 57, 115, 101, 64, 86, 105, 114, 103, 19, 126, 79, 104, 105, 59, 80, 125, 110, 115,
+        121, 108, 118, 6, 126, 77, 61, 115, 61, 115, 105, 112, 112, 255, 76, 111, 117, 61, 105, 6, 8, 65, 108, 97,
+        98, 203, 8, 65, 114, 107, 6, 115, 60, 0, 78, 31, 116, 104, 32, 67, 22, 111, 108, 19, 8, 78, 101, 119,
+        32, 89, 31, 107, 0, 73, 111, 119, 8, 73, 108, 108, 19, 111, 61, 0, 71, 101, 31, 103, 126, 87, 61, 99,
+        55, 115, 19, 0, 70, 108, 31, 105, 100, 8, 77, 61, 115, 111, 117, 114, 255, 79, 107, 108, 97, 104, 111, 109,
+        8, 78, 31, 116, 104, 32, 68, 97, 107, 111, 116, 8, 87, 60, 104, 19, 103, 116, 55, 220, 111, 117, 116, 104,
+        32, 68, 97, 107, 111, 116, 8, 78, 101, 98, 114, 60, 107, 8, 75, 6, 115, 60, 0, 73, 100, 97, 104, 59,
+        85, 116, 97, 104, 0, 77, 19, 110, 57, 111, 116, 8, 77, 95, 104, 105, 103, 6, 0, 87, 121, 111, 109, 19,
+        103, 0, 79, 114, 101, 103, 55, 0, 67, 111, 108, 31, 240, 59, 78, 101, 118, 240, 8, 65, 114, 105, 122, 55,
+        8, 78, 101, 119, 32, 77, 101, 120, 95, 59, 77, 55, 116, 6, 8, 67, 30, 105, 102, 31, 110, 126, 84, 101,
+        120, 60, 0, 65, 108, 60, 107, 8, 67, 111, 108, 111, 109, 98, 105, 101, 45, 66, 114, 88, 6, 110, 105, 113,
+        117, 252, 66, 114, 88, 61, 104, 32, 67, 111, 108, 117, 109, 98, 126, 65, 108, 98, 24, 116, 8, 79, 110, 116,
+        22, 105, 59, 81, 117, 243, 98, 101, 99, 124, 81, 117, 101, 98, 101, 99, 220, 60, 107, 94, 99, 104, 101, 119,
+        6, 0, 77, 6, 88, 111, 98, 8, 78, 101, 119, 102, 111, 117, 110, 100, 127, 32, 38, 32, 76, 97, 98, 114,
+        240, 31, 124, 84, 24, 114, 101, 45, 78, 101, 117, 118, 101, 45, 101, 116, 45, 76, 97, 98, 114, 240, 31, 0,
+        78, 101, 119, 32, 66, 114, 117, 110, 115, 119, 95, 107, 124, 78, 111, 117, 118, 101, 97, 117, 45, 66, 114, 117,
+        110, 115, 119, 95, 107, 0, 78, 111, 118, 63, 83, 99, 111, 116, 105, 123, 78, 111, 117, 118, 205, 108, 101, 45,
+        195, 137, 99, 111, 115, 115, 64, 80, 114, 19, 99, 227, 69, 100, 119, 22, 100, 32, 239, 127, 124, 195, 142, 108,
+        101, 45, 100, 117, 45, 80, 114, 19, 99, 101, 45, 195, 137, 100, 111, 117, 22, 100, 0, 89, 117, 107, 55, 0,
+        78, 31, 116, 104, 119, 57, 116, 32, 84, 24, 114, 88, 31, 105, 57, 124, 84, 24, 114, 88, 111, 105, 114, 57,
+        32, 100, 117, 32, 78, 31, 100, 45, 79, 117, 57, 116, 0, 78, 117, 110, 97, 118, 117, 116, 0, 2, 135, 2,
+        130, 2, 161, 2, 191, 2, 175, 200, 124, 28, 173, 28, 190, 28, 176, 28, 164, 124, 73, 110, 100, 126, 65, 117,
+        115, 116, 114, 30, 126, 66, 114, 60, 105, 108, 0, 65, 109, 24, 95, 123, 85, 110, 88, 101, 100, 32, 83, 116,
+        94, 57, 0, 77, 243, 120, 95, 111, 124, 85, 110, 88, 101, 100, 32, 77, 101, 120, 95, 6, 32, 83, 116, 94,
+        57, 124, 69, 115, 116, 240, 111, 115, 32, 85, 110, 105, 100, 111, 115, 32, 77, 101, 120, 95, 6, 111, 115, 13,
+        156, 5, 3, 4, 49, 1, 37, 58, 156, 5, 3, 4, 49, 1, 194, 160, 13, 161, 250, 4, 12, 45, 208, 159,
+        14, 12, 14, 10, 11, 20, 10, 91, 194, 160, 13, 154, 1, 7, 9, 17, 9, 17, 91, 247, 245, 192, 56, 37,
+        93, 42, 152, 17, 91, 20, 209, 136, 14, 37, 12, 9, 18, 58, 147, 211, 143, 1, 7, 91, 211, 143, 1, 41,
+        42, 156, 5, 209, 133, 4, 13, 56, 37, 93, 42, 144, 245, 248, 91, 14, 37, 18, 58, 180, 248, 91, 209, 141,
+        42, 56, 52, 4, 13, 223, 42, 161, 14, 49, 14, 10, 17, 1, 26, 208, 158, 3, 14, 12, 9, 18, 194, 160,
+        45, 42, 144, 7, 250, 9, 18, 58, 56, 52, 4, 211, 149, 42, 166, 211, 149, 91, 1, 12, 42, 152, 10, 248,
+        21, 5, 17, 13, 154, 1, 11, 1, 10, 245, 9, 17, 5, 45, 208, 145, 1, 7, 15, 10, 33, 208, 223, 58,
+        154, 209, 138, 209, 141, 11, 209, 141, 10, 245, 14, 41, 45, 208, 145, 1, 7, 209, 138, 4, 209, 138, 209, 141,
+        10, 42, 56, 52, 4, 209, 141, 194, 160, 58, 154, 209, 138, 1, 11, 1, 10, 12, 248, 45, 208, 156, 1, 7,
+        4, 209, 138, 1, 10, 42, 223, 13, 154, 1, 247, 209, 135, 1, 14, 49, 5, 45, 208, 167, 14, 10, 4, 50,
+        33, 208, 223, 58, 154, 209, 138, 1, 247, 209, 135, 1, 41, 45, 208, 167, 14, 10, 4, 50, 42, 223, 58, 154,
+        209, 138, 209, 141, 10, 209, 141, 209, 136, 14, 41, 45, 208, 168, 209, 141, 10, 245, 208, 182, 209, 141, 3, 42,
+        56, 52, 4, 209, 141, 13, 167, 14, 209, 135, 14, 17, 33, 208, 223, 58, 157, 5, 209, 133, 209, 135, 251, 17,
+        42, 223, 58, 167, 14, 209, 135, 17, 18, 37, 58, 157, 5, 209, 133, 209, 135, 251, 209, 135, 5, 23, 13, 167,
+        20, 49, 1, 37, 209, 136, 9, 18, 13, 152, 49, 250, 5, 49, 192, 155, 9, 47, 14, 209, 134, 29, 5, 43,
+        158, 10, 7, 5, 49, 192, 162, 20, 37, 7, 23, 40, 37, 43, 145, 14, 7, 91, 5, 10, 5, 37, 245, 40,
+        37, 43, 146, 7, 1, 245, 9, 37, 92, 9, 10, 40, 37, 43, 154, 20, 10, 192, 154, 1, 7, 20, 208, 182,
+        192, 162, 1, 92, 11, 5, 49, 192, 145, 10, 18, 17, 192, 175, 10, 5, 3, 7, 1, 49, 192, 160, 18, 208,
+        183, 250, 192, 144, 21, 247, 209, 133, 250, 192, 159, 5, 245, 92, 5, 3, 4, 5, 37, 49, 23, 14, 58, 156,
+        5, 3, 4, 5, 49, 192, 161, 92, 5, 7, 14, 37, 17, 40, 37, 43, 223, 42, 148, 1, 91, 14, 21, 250,
+        194, 160, 13, 146, 5, 10, 5, 17, 14, 208, 182, 192, 157, 5, 49, 91, 5, 10, 5, 245, 192, 159, 3, 4,
+        5, 49, 192, 154, 5, 21, 10, 5, 92, 192, 161, 12, 1, 49, 10, 5, 47, 5, 7, 23, 3, 4, 251, 32,
+        4, 247, 41, 13, 154, 247, 3, 17, 5, 245, 1, 10, 3, 4, 251, 32, 4, 247, 41, 194, 160, 13, 165, 1,
+        7, 23, 92, 91, 124, 75, 30, 109, 121, 107, 105, 121, 97, 58, 56, 37, 93, 42, 154, 1, 7, 92, 248, 37,
+        4, 9, 18, 13, 162, 49, 14, 10, 192, 155, 14, 17, 9, 17, 91, 247, 37, 245, 40, 37, 43, 160, 5, 21,
+        5, 37, 49, 40, 37, 43, 146, 5, 7, 91, 5, 91, 247, 37, 245, 40, 37, 43, 146, 5, 7, 5, 91, 5,
+        245, 192, 156, 20, 37, 10, 92, 250, 40, 37, 43, 56, 37, 93, 42, 154, 1, 10, 14, 37, 7, 9, 18, 13,
+        157, 14, 37, 17, 14, 209, 134, 4, 251, 32, 1, 49, 12, 5, 17, 5, 37, 92, 17, 248, 41, 32, 5, 37,
+        4, 10, 20, 91, 58, 157, 14, 17, 209, 145, 209, 134, 9, 14, 32, 1, 49, 12, 5, 17, 5, 92, 17, 5,
+        41, 32, 211, 136, 5, 4, 10, 20, 4, 13, 56, 37, 93, 42, 154, 5, 37, 92, 9, 58, 154, 5, 92, 9,
+        42, 223, 13, 144, 10, 209, 133, 1, 37, 17, 91, 14, 7, 23, 40, 37, 43, 56, 37, 93, 42, 156, 5, 10,
+        245, 5, 37, 49, 9, 18, 58, 156, 5, 10, 245, 5, 49, 9, 26, 208, 223, 3, 23, 13, 157, 9, 208, 182,
+        14, 91, 5, 10, 5, 37, 245, 40, 37, 43, 159, 14, 37, 17, 208, 183, 14, 17, 40, 37, 43, 154, 9, 37,
+        10, 5, 49, 40, 37, 43, 223, 42, 156, 1, 10, 251, 42, 173, 7, 58, 156, 1, 10, 251, 42, 173, 7, 42,
+        56, 52, 4, 194, 160, 58, 156, 1, 10, 248, 42, 173, 7, 42, 56, 52, 4, 13, 158, 10, 14, 17, 11, 20,
+        37, 10, 91, 40, 37, 43, 163, 7, 23, 18, 17, 5, 49, 192, 159, 14, 10, 92, 3, 4, 251, 32, 4, 247,
+        41, 13, 223, 42, 145, 1, 209, 136, 4, 5, 10, 12, 5, 21, 250, 58, 145, 1, 209, 136, 210, 161, 5, 10,
+        12, 5, 21, 250, 42, 223, 210, 187, 248, 194, 160, 13, 163, 245, 92, 20, 10, 12, 33, 208, 223, 58, 163, 245,
+        92, 20, 10, 12, 42, 173, 7, 23, 4, 20, 17, 13, 223, 42, 162, 1, 12, 1, 10, 21, 250, 58, 162, 1,
+        12, 1, 10, 21, 250, 42, 223, 3, 248, 13, 161, 1, 92, 1, 10, 192, 161, 1, 247, 12, 5, 49, 192, 175,
+        92, 1, 7, 5, 45, 208, 157, 14, 17, 14, 209, 134, 4, 251, 32, 1, 49, 12, 5, 17, 5, 92, 17, 248,
+        41, 32, 5, 4, 10, 20, 91, 58, 175, 92, 1, 7, 248, 45, 208, 157, 14, 17, 209, 145, 209, 134, 9, 14,
+        32, 1, 49, 12, 5, 17, 5, 92, 17, 5, 41, 32, 211, 136, 5, 4, 10, 20, 4, 13, 165, 250, 12, 248,
+        45, 208, 156, 250, 3, 251, 3, 4, 251, 32, 1, 49, 12, 5, 17, 5, 92, 17, 248, 41, 32, 5, 4, 10,
+        20, 91, 32, 45, 42, 174, 91, 247, 58, 165, 250, 12, 248, 45, 208, 156, 250, 3, 251, 3, 4, 251, 13, 161,
+        49, 14, 10, 245, 7, 5, 49, 40, 36, 194, 160, 13, 162, 209, 142, 92, 14, 17, 192, 154, 20, 10, 91, 250,
+        40, 36, 194, 160, 13, 167, 14, 7, 18, 11, 9, 17, 40, 36, 194, 160, 13, 223, 42, 145, 20, 10, 18, 12,
+        9, 18, 58, 145, 20, 10, 18, 1, 245, 42, 163, 7, 1, 3, 13, 151, 1, 11, 1, 41, 15, 7, 23, 3,
+        4, 251, 32, 4, 247, 41, 13, 152, 10, 4, 20, 12, 192, 157, 5, 49, 5, 3, 9, 11, 9, 10, 192, 162,
+        5, 92, 192, 158, 92, 192, 223, 42, 165, 1, 15, 3, 9, 18, 58, 165, 1, 15, 3, 42, 223, 208, 183, 248,
+        13, 154, 14, 92, 14, 10, 5, 49, 192, 223, 42, 144, 7, 12, 1, 41, 58, 144, 7, 12, 1, 41, 42, 223,
+        13, 144, 7, 12, 1, 41, 3, 4, 251, 32, 4, 247, 41, 194, 160, 13, 223, 42, 162, 248, 49, 1, 58, 162,
+        248, 49, 1, 42, 223, 13, 154, 247, 3, 17, 5, 18, 10, 3, 4, 251, 32, 4, 247, 41, 13, 156, 1, 91,
+        1, 245, 250, 192, 167, 20, 4, 5, 12, 3, 4, 251, 32, 1, 49, 12, 5, 17, 5, 92, 17, 248, 41, 32,
+        5, 4, 10, 20, 91, 58, 167, 20, 4, 5, 12, 15, 4, 209, 141, 17, 32, 1, 49, 12, 5, 17, 5, 92,
+        17, 248, 4, 209, 141, 17, 32, 5, 4, 10, 20, 91, 13, 154, 1, 92, 209, 135, 1, 12, 3, 4, 251, 32,
+        4, 247, 41, 194, 160, 13, 161, 1, 209, 133, 1, 7, 9, 17, 40, 36, 194, 160, 13, 159, 10, 9, 92, 5,
+        10, 3, 4, 251, 32, 4, 247, 41, 194, 160, 13, 149, 49, 10, 14, 41, 33, 1, 49, 12, 5, 17, 5, 92,
+        17, 1, 26, 5, 43, 165, 1, 11, 1, 10, 5, 49, 3, 4, 251, 32, 4, 247, 41, 13, 144, 92, 20, 10,
+        192, 223, 42, 161, 1, 209, 133, 1, 58, 175, 4, 20, 12, 9, 18, 58, 161, 1, 209, 133, 1, 32, 211, 168,
+        10, 211, 169, 3, 47, 210, 175, 210, 175, 11, 210, 175, 7, 210, 175, 4, 209, 141, 12, 209, 141, 0, 67, 6,
+        240, 8, 208, 160, 5, 3, 3, 9, 37, 18, 0, 228, 184, 138, 230, 181, 183, 229, 184, 130, 0, 229, 164, 169,
+        230, 180, 165, 229, 184, 130, 0, 229, 140, 151, 228, 186, 172, 229, 184, 130, 0, 230, 181, 183, 229, 141, 151, 246,
+        229, 174, 129, 229, 164, 143, 124, 229, 174, 129, 229, 164, 143, 229, 155, 158, 230, 151, 143, 232, 135, 170, 230, 178,
+        187, 229, 140, 186, 0, 233, 135, 141, 229, 186, 134, 229, 184, 130, 0, 230, 181, 153, 230, 177, 159, 246, 230, 177,
+        159, 232, 139, 143, 246, 231, 166, 143, 229, 187, 186, 246, 229, 174, 137, 229, 190, 189, 246, 232, 190, 189, 229, 174,
+        129, 246, 229, 177, 177, 228, 184, 156, 246, 229, 177, 177, 232, 165, 191, 246, 230, 177, 159, 232, 165, 191, 246, 230,
+        178, 179, 229, 141, 151, 246, 232, 180, 181, 229, 183, 158, 246, 229, 185, 191, 228, 184, 156, 246, 230, 185, 150, 229,
+        140, 151, 246, 229, 144, 137, 230, 158, 151, 246, 230, 178, 179, 229, 140, 151, 246, 233, 153, 149, 232, 165, 191, 246,
+        229, 134, 133, 232, 146, 153, 229, 143, 164, 232, 135, 170, 230, 178, 187, 229, 140, 186, 0, 233, 187, 145, 233, 190,
+        153, 230, 177, 159, 246, 230, 185, 150, 229, 141, 151, 246, 229, 185, 191, 232, 165, 191, 229, 163, 174, 230, 151, 143,
+        232, 135, 170, 230, 178, 187, 229, 140, 186, 0, 229, 155, 155, 229, 183, 157, 246, 228, 186, 145, 229, 141, 151, 246,
+        249, 150, 249, 188, 249, 145, 224, 188, 139, 124, 230, 150, 176, 231, 150, 134, 231, 187, 180, 229, 144, 190, 229, 176,
+        148, 232, 135, 170, 230, 178, 187, 229, 140, 186, 124, 232, 165, 191, 232, 151, 143, 0, 231, 148, 152, 232, 130, 131,
+        246, 233, 157, 146, 230, 181, 183, 246, 232, 165, 191, 232, 151, 143, 124, 249, 150, 249, 188, 249, 145, 224, 188, 139,
+        124, 84, 105, 98, 101, 116, 124, 232, 165, 191, 232, 151, 143, 232, 135, 170, 230, 178, 187, 229, 140, 186, 0, 228,
+        184, 173, 229, 156, 139, 124, 228, 184, 173, 229, 141, 142, 228, 186, 186, 230, 176, 145, 229, 133, 177, 229, 146, 140,
+        229, 155, 189, 0, 85, 110, 88, 101, 100, 32, 83, 116, 94, 57, 32, 77, 19, 31, 32, 79, 117, 116, 108, 121,
+        19, 103, 32, 239, 127, 115, 124, 85, 83, 77, 79, 73, 0, 195, 142, 108, 227, 100, 227, 67, 108, 105, 112, 112,
+        24, 116, 55, 124, 239, 108, 63, 100, 227, 108, 63, 80, 60, 105, 195, 179, 110, 0, 65, 110, 116, 22, 99, 116,
+        95, 8, 69, 22, 116, 104, 0,
+};
+
+static const unsigned char TERRITORY_NAMES_PAIRS_LOCAL[256][2] = {
+        {0, 0}, {208, 176}, {224, 164}, {209, 129}, {208, 186}, {208, 190}, {97, 110}, {208, 187}, {97, 0}, {208, 184}, {209, 128}, {208, 177},
+        {209, 130}, {0, 208}, {208, 181}, {4, 1}, {11, 7}, {208, 189}, {209, 143}, {105, 110}, {209, 131}, {3, 12}, {97, 114}, {209, 140},
+        {101, 114}, {216, 167}, {18, 32}, {224, 165}, {224, 166}, {15, 26}, {97, 108}, {111, 114}, {32, 32}, {3, 29}, {1, 21}, {16, 34},
+        {35, 23}, {204, 129}, {6, 100}, {39, 39}, {33, 5}, {208, 185}, {32, 208}, {36, 13}, {44, 44}, {45, 45}, {226, 128}, {208, 191},
+        {46, 142}, {208, 178}, {14, 3}, {25, 217}, {16, 9}, {47, 20}, {50, 53}, {111, 110}, {160, 54}, {101, 115}, {124, 208}, {111, 0},
+        {97, 115}, {105, 115}, {225, 128}, {97, 32}, {101, 0}, {65, 65}, {66, 66}, {67, 67}, {68, 68}, {69, 69}, {70, 70}, {71, 71},
+        {72, 72}, {73, 73}, {74, 74}, {75, 75}, {76, 76}, {77, 77}, {78, 78}, {79, 79}, {80, 80}, {81, 81}, {82, 82}, {83, 83},
+        {84, 84}, {85, 85}, {86, 86}, {87, 87}, {105, 116}, {89, 89}, {90, 90}, {208, 179}, {208, 188}, {52, 15}, {97, 116}, {105, 99},
+        {216, 177}, {97, 97}, {98, 98}, {99, 99}, {100, 100}, {101, 101}, {102, 102}, {103, 103}, {104, 104}, {105, 105}, {106, 106}, {107, 107},
+        {108, 108}, {109, 109}, {110, 110}, {111, 111}, {112, 112}, {113, 113}, {114, 114}, {115, 115}, {116, 116}, {117, 117}, {118, 118}, {119, 119},
+        {120, 120}, {121, 121}, {122, 122}, {97, 124}, {124, 124}, {101, 110}, {105, 8}, {108, 38}, {128, 128}, {129, 129}, {130, 130}, {131, 131},
+        {132, 132}, {133, 133}, {134, 134}, {135, 135}, {136, 136}, {137, 137}, {138, 138}, {139, 139}, {140, 140}, {141, 141}, {142, 142}, {143, 143},
+        {144, 144}, {145, 145}, {146, 146}, {147, 147}, {148, 148}, {149, 149}, {150, 150}, {151, 151}, {152, 152}, {153, 153}, {154, 154}, {155, 155},
+        {156, 156}, {157, 157}, {158, 158}, {159, 159}, {160, 160}, {161, 161}, {162, 162}, {163, 163}, {164, 164}, {165, 165}, {166, 166}, {167, 167},
+        {168, 168}, {169, 169}, {170, 170}, {171, 171}, {172, 172}, {173, 173}, {174, 174}, {175, 175}, {176, 176}, {177, 177}, {178, 178}, {179, 179},
+        {180, 180}, {181, 181}, {182, 182}, {183, 183}, {184, 184}, {185, 185}, {186, 186}, {187, 187}, {188, 188}, {189, 189}, {190, 190}, {191, 191},
+        {40, 43}, {217, 138}, {194, 194}, {195, 195}, {196, 196}, {197, 197}, {2, 176}, {224, 168}, {2, 190}, {201, 201}, {202, 202}, {97, 109},
+        {204, 204}, {101, 108}, {206, 206}, {207, 207}, {208, 208}, {209, 209}, {210, 210}, {211, 211}, {224, 170}, {213, 213}, {214, 214}, {215, 215},
+        {216, 216}, {217, 217}, {218, 218}, {219, 219}, {0, 83}, {51, 132}, {222, 222}, {56, 93}, {224, 224}, {225, 225}, {226, 226}, {101, 32},
+        {228, 228}, {229, 229}, {230, 230}, {231, 231}, {232, 232}, {233, 233}, {234, 234}, {235, 235}, {236, 236}, {237, 237}, {27, 141}, {73, 115},
+        {97, 100}, {111, 32}, {129, 0}, {195, 169}, {156, 242}, {208, 180}, {231, 244}, {10, 1}, {209, 139}, {224, 189}, {1, 17}, {9, 41},
+        {101, 124}, {224, 176}, {48, 48}, {105, 0},
+};
+
+static const unsigned short TERRITORY_NAME_ALTERNATIVES_START_LOCAL[_TERRITORY_MAX - _TERRITORY_MIN] = {
+        0, 2, 3, 4, 5, 8, 9, 10, 11, 15, 17, 19, 21, 23, 25, 26,
+        27, 28, 29, 30, 31, 32, 33, 35, 36, 37, 38, 41, 43, 45, 46, 47,
+        48, 49, 53, 55, 57, 58, 59, 61, 63, 65, 67, 69, 70, 71, 73, 75,
+        77, 79, 81, 83, 86, 87, 88, 91, 92, 94, 96, 97, 98, 101, 104, 105,
+        107, 109, 112, 114, 116, 118, 119, 120, 122, 123, 124, 126, 128, 129, 131, 133,
+        134, 136, 138, 140, 141, 143, 144, 146, 149, 151, 153, 154, 155, 158, 161, 162,
+        163, 166, 168, 169, 171, 173, 176, 180, 181, 183, 184, 187, 188, 189, 191, 193,
+        196, 197, 198, 199, 200, 201, 202, 204, 205, 207, 208, 209, 212, 215, 217, 218,
+        219, 221, 224, 227, 228, 229, 231, 233, 234, 235, 237, 238, 239, 240, 241, 242,
+        243, 244, 247, 248, 249, 250, 252, 253, 254, 256, 259, 261, 262, 263, 266, 267,
+        269, 273, 274, 276, 277, 278, 279, 280, 281, 282, 284, 285, 286, 287, 288, 289,
+        291, 292, 293, 295, 297, 298, 299, 300, 301, 305, 306, 308, 310, 313, 314, 315,
+        317, 318, 321, 322, 324, 326, 327, 329, 330, 331, 333, 334, 336, 338, 340, 342,
+        344, 345, 346, 347, 349, 350, 352, 353, 356, 357, 360, 364, 367, 369, 370, 373,
+        374, 375, 376, 379, 381, 383, 386, 389, 391, 392, 393, 394, 395, 396, 397, 399,
+        400, 401, 402, 403, 404, 405, 406, 407, 408, 409, 411, 412, 413, 414, 415, 416,
+        417, 418, 419, 420, 421, 422, 423, 425, 426, 427, 429, 432, 433, 436, 439, 441,
+        444, 447, 450, 453, 456, 459, 461, 463, 464, 465, 467, 468, 471, 474, 476, 477,
+        479, 480, 481, 484, 486, 488, 491, 492, 495, 498, 499, 501, 504, 506, 507, 510,
+        512, 513, 516, 520, 521, 523, 525, 526, 527, 528, 529, 530, 531, 532, 533, 534,
+        535, 536, 537, 538, 539, 540, 541, 542, 543, 544, 545, 546, 547, 548, 549, 550,
+        551, 552, 553, 554, 555, 556, 557, 558, 559, 560, 561, 562, 563, 564, 565, 566,
+        567, 568, 569, 570, 571, 572, 573, 574, 575, 576, 577, 578, 579, 580, 581, 582,
+        583, 584, 585, 586, 587, 588, 589, 590, 591, 592, 593, 594, 595, 596, 597, 598,
+        599, 600, 601, 602, 603, 604, 605, 606, 607, 608, 609, 611, 612, 613, 615, 616,
+        617, 619, 621, 623, 625, 626, 628, 629, 632, 633, 634, 636, 639, 641, 642, 643,
+        645, 647, 649, 652, 655, 659, 660, 661, 662, 663, 664, 665, 666, 667, 668, 669,
+        670, 671, 672, 673, 675, 676, 677, 678, 679, 680, 681, 682, 683, 686, 687, 688,
+        689, 690, 691, 692, 693, 695, 697, 698, 700, 701, 702, 703, 706, 707, 708, 709,
+        711, 713, 715, 716, 717, 719, 721, 722, 723, 724, 725, 727, 728, 729, 730, 731,
+        732, 734, 735, 737, 738, 740, 741, 742, 744, 745, 746, 747, 748, 749, 750, 753,
+        754, 755, 756, 757, 758, 759, 761, 762, 763, 764, 765, 766, 767, 768, 769, 770,
+        771, 772, 773, 774, 775, 776, 777, 778, 779, 780, 781, 782, 783, 786, 787, 788,
+        792, 794, 796, 798, 799, 800,
+};
+
+static const TerritoryNameAlternative TERRITORY_NAME_ALTERNATIVES_LOCAL[800] = {
+        {0, 12, 0}, {13, 8, 0}, {22, 6, 0}, {29, 9, 0}, {39, 7, 0}, {47, 15, 0}, {63, 13, 0}, {77, 15, 0},
+        {93, 17, 0}, {111, 6, 0}, {118, 6, 0}, {125, 6, 20}, {132, 5, 0}, {138, 6, 20}, {145, 21, 20}, {167, 12, 0},
+        {180, 12, 0}, {193, 12, 0}, {206, 12, 0}, {219, 14, 0}, {234, 13, 0}, {248, 13, 0}, {262, 7, 0}, {270, 10, 0},
+        {281, 11, 0}, {293, 7, 0}, {301, 30, 0}, {332, 10, 0}, {343, 8, 0}, {352, 8, 0}, {361, 10, 0}, {372, 20, 0},
+        {393, 16, 0}, {410, 16, 0}, {427, 14, 0}, {442, 14, 0}, {457, 13, 0}, {471, 5, 0}, {477, 26, 0}, {504, 16, 0},
+        {521, 20, 0}, {542, 14, 0}, {557, 14, 0}, {572, 14, 0}, {587, 12, 0}, {600, 24, 0}, {625, 5, 0}, {631, 21, 0},
+        {653, 14, 0}, {668, 7, 0}, {676, 14, 0}, {691, 4, 0}, {696, 6, 0}, {703, 53, 19}, {757, 29, 0}, {787, 12, 0},
+        {800, 44, 0}, {845, 5, 0}, {851, 10, 0}, {862, 28, 0}, {891, 23, 0}, {915, 7, 0}, {923, 5, 0}, {929, 21, 0},
+        {951, 39, 2}, {991, 32, 0}, {1024, 13, 0}, {1038, 12, 0}, {1051, 16, 0}, {1068, 8, 0}, {1077, 19, 0}, {1097, 8, 0},
+        {1106, 7, 0}, {1114, 10, 0}, {1125, 5, 0}, {1131, 5, 0}, {1137, 5, 0}, {1143, 15, 0}, {1159, 14, 0}, {1174, 19, 0},
+        {1194, 7, 0}, {1202, 4, 0}, {1207, 8, 0}, {1216, 12, 0}, {1229, 4, 0}, {1234, 6, 0}, {1241, 12, 0}, {1254, 10, 0},
+        {1265, 9, 20}, {1275, 9, 0}, {1285, 33, 22}, {1319, 5, 0}, {1325, 9, 0}, {1335, 15, -1}, {1351, 17, 14}, {1369, 12, 0},
+        {1382, 8, 0}, {1391, 24, 0}, {1416, 22, 0}, {1439, 10, 0}, {1450, 9, 0}, {1460, 6, 20}, {1467, 9, 0}, {1477, 21, 20},
+        {1499, 10, 0}, {1510, 8, 0}, {1519, 10, 0}, {1530, 8, 0}, {1539, 10, 0}, {1550, 23, 14}, {1574, 11, 0}, {1586, 6, 0},
+        {1593, 7, 0}, {1601, 5, 0}, {1607, 8, 0}, {1616, 11, 0}, {1628, 11, 0}, {1640, 9, 0}, {1650, 6, 0}, {1657, 5, 0},
+        {1663, 21, 0}, {1685, 19, 0}, {1705, 10, 0}, {1716, 19, 0}, {1736, 29, 14}, {1766, 17, 0}, {1784, 44, 0}, {1829, 4, 0},
+        {1834, 11, 0}, {1846, 12, 1}, {1859, 8, 0}, {1868, 16, 14}, {1885, 7, 0}, {1893, 7, 0}, {1901, 10, 0}, {1912, 6, 0},
+        {1919, 12, 14}, {1932, 7, 0}, {1940, 14, 0}, {1955, 16, 0}, {1972, 7, 0}, {1980, 17, 2}, {1998, 9, 0}, {2008, 7, 0},
+        {2016, 15, 0}, {2032, 12, 0}, {2045, 16, 0}, {2062, 8, 0}, {2071, 8, 0}, {2080, 21, 14}, {2102, 6, 0}, {2109, 4, 0},
+        {2114, 15, 4}, {2130, 19, 0}, {2150, 9, 0}, {2160, 20, 3}, {2181, 28, 14}, {2210, 6, 0}, {2217, 21, 14}, {2239, 23, 3},
+        {2263, 35, 14}, {2299, 11, 0}, {2311, 6, 0}, {2318, 18, 14}, {2337, 7, 0}, {2345, 7, 0}, {2353, 20, 2}, {2374, 9, 0},
+        {2384, 6, 0}, {2391, 6, 0}, {2398, 5, 0}, {2404, 8, 0}, {2413, 7, 0}, {2421, 17, 0}, {2439, 20, 0}, {2460, 17, 0},
+        {2478, 9, 0}, {2488, 10, 0}, {2499, 7, 0}, {2507, 7, 0}, {2515, 15, 0}, {2531, 16, 10}, {2548, 8, 0}, {2557, 16, 0},
+        {2574, 7, 0}, {2582, 8, 0}, {2591, 7, 0}, {2599, 7, 0}, {2607, 13, 0}, {2621, 12, 20}, {2634, 12, 20}, {2647, 30, 13},
+        {2678, 42, 13}, {2721, 7, 0}, {2729, 6, 0}, {2736, 12, 0}, {2749, 9, 0}, {2759, 7, 0}, {2767, 5, 0}, {2773, 21, 0},
+        {2795, 9, 0}, {2805, 10, 0}, {2816, 19, 0}, {2836, 36, 2}, {2873, 8, 0}, {2882, 21, 0}, {2904, 4, 0}, {2909, 7, 0},
+        {2917, 7, 0}, {2925, 28, 18}, {2954, 18, 22}, {2973, 10, 0}, {2984, 30, 6}, {3015, 12, 2}, {3028, 10, 0}, {3039, 5, 0},
+        {3045, 7, 0}, {3053, 12, 0}, {3066, 7, 0}, {3074, 17, 0}, {3092, 6, 0}, {3099, 17, 0}, {3117, 6, 0}, {3124, 7, 0},
+        {3132, 46, 14}, {3179, 8, 0}, {3188, 3, 0}, {3192, 11, 0}, {3204, 11, 0}, {3216, 12, 2}, {3229, 6, 0}, {3236, 18, 14},
+        {3255, 6, 0}, {3262, 8, 0}, {3271, 13, 0}, {3285, 12, 15}, {3298, 11, 0}, {3310, 7, 0}, {3318, 9, 0}, {3328, 4, 0},
+        {3333, 16, 2}, {3350, 7, 0}, {3358, 8, 0}, {3367, 6, 0}, {3374, 15, 23}, {3390, 14, 14}, {3405, 7, 0}, {3413, 7, 0},
+        {3421, 36, 15}, {3458, 9, 0}, {3468, 12, 1}, {3481, 6, 0}, {3488, 20, 2}, {3509, 24, 11}, {3534, 15, 4}, {3550, 6, 0},
+        {3557, 14, 14}, {3572, 7, 0}, {3580, 15, 21}, {3596, 8, 0}, {3605, 7, 0}, {3613, 7, 0}, {3621, 21, 17}, {3643, 16, 14},
+        {3660, 5, 0}, {3666, 10, 14}, {3677, 9, 0}, {3687, 20, 2}, {3708, 16, 2}, {3725, 18, 2}, {3744, 7, 0}, {3752, 16, 14},
+        {3769, 16, 2}, {3786, 6, 0}, {3793, 9, 9}, {3803, 3, 0}, {3807, 8, 0}, {3816, 5, 0}, {3822, 6, 0}, {3829, 14, 0},
+        {3844, 7, 0}, {3852, 7, 0}, {3860, 29, 14}, {3890, 19, 0}, {3910, 5, 0}, {3916, 8, 0}, {3925, 12, 0}, {3938, 9, 0},
+        {3948, 6, 0}, {3955, 14, 14}, {3970, 4, 0}, {3975, 6, 0}, {3982, 14, 0}, {3997, 5, 0}, {4003, 5, 0}, {4009, 8, 0},
+        {4018, 12, 20}, {4031, 10, 0}, {4042, 5, 0}, {4048, 5, 0}, {4054, 11, 0}, {4066, 6, 7}, {4073, 6, 0}, {4080, 5, 0},
+        {4086, 9, 7}, {4096, 8, 0}, {4105, 9, 0}, {4115, 8, 0}, {4124, 18, 14}, {4143, 5, 0}, {4149, 18, 14}, {4168, 7, 0},
+        {4176, 21, 21}, {4198, 12, 0}, {4211, 7, 0}, {4219, 13, 0}, {4233, 14, 0}, {4248, 8, 0}, {4257, 24, 2}, {4282, 13, 0},
+        {4296, 22, 14}, {4319, 7, 0}, {4327, 27, 8}, {4355, 12, 0}, {4368, 20, 14}, {4389, 5, 0}, {4395, 6, 0}, {4402, 6, 0},
+        {4409, 10, 0}, {4420, 5, 0}, {4426, 8, 0}, {4435, 12, 0}, {4448, 10, 0}, {4459, 14, 2}, {4474, 11, 0}, {4486, 23, 14},
+        {4510, 29, 0}, {4540, 14, 0}, {4555, 20, 14}, {4576, 10, 0}, {4587, 18, 14}, {4606, 13, 0}, {4620, 104, 16}, {4725, 7, 0},
+        {4733, 6, 0}, {4740, 5, 0}, {4746, 8, 0}, {4755, 14, 14}, {4770, 8, 0}, {4779, 11, 0}, {4791, 8, 0}, {4800, 7, 0},
+        {4808, 9, 0}, {4818, 8, 0}, {4827, 13, 0}, {4841, 13, 0}, {4855, 8, 0}, {4864, 14, 14}, {4879, 5, 0}, {4885, 14, 14},
+        {4900, 18, 14}, {4919, 10, 0}, {4930, 9, 0}, {4940, 8, 0}, {4949, 7, 0}, {4957, 7, 0}, {4965, 7, 0}, {4973, 8, 0},
+        {4982, 15, 23}, {4998, 8, 0}, {5007, 11, 0}, {5019, 11, 0}, {5031, 12, 0}, {5044, 4, 0}, {5049, 6, 0}, {5056, 5, 0},
+        {5062, 14, 14}, {5077, 5, 0}, {5083, 4, 0}, {5088, 5, 0}, {5094, 5, 0}, {5100, 19, 2}, {5120, 31, -1}, {5152, 10, 14},
+        {5163, 4, 0}, {5168, 7, 0}, {5176, 16, 14}, {5193, 5, 0}, {5199, 19, 14}, {5219, 20, 14}, {5240, 5, 0}, {5246, 9, 0},
+        {5256, 11, 0}, {5268, 8, 0}, {5277, 7, 0}, {5285, 14, 0}, {5300, 6, 0}, {5307, 10, 0}, {5318, 21, 0}, {5340, 7, 0},
+        {5348, 7, 0}, {5356, 7, 0}, {5364, 7, 0}, {5372, 10, 0}, {5383, 6, 0}, {5390, 8, 0}, {5399, 12, 0}, {5412, 7, 0},
+        {5420, 8, 0}, {5429, 10, 0}, {5440, 20, 0}, {5461, 16, 0}, {5478, 8, 0}, {5487, 11, 0}, {5499, 19, 0}, {5519, 8, 0},
+        {5528, 7, 0}, {5536, 15, 0}, {5552, 9, 0}, {5562, 7, 0}, {5570, 10, 0}, {5581, 6, 0}, {5588, 7, 0}, {5596, 8, 0},
+        {5605, 20, 0}, {5626, 6, 0}, {5633, 9, 0}, {5643, 9, 0}, {5653, 16, 0}, {5670, 16, 14}, {5687, 12, 0}, {5700, 46, 14},
+        {5747, 5, 0}, {5753, 20, 14}, {5774, 8, 0}, {5783, 18, 21}, {5802, 18, 2}, {5821, 9, 0}, {5831, 10, 0}, {5842, 9, 0},
+        {5852, 9, 0}, {5862, 29, 4}, {5892, 29, 27}, {5922, 12, 0}, {5935, 48, 4}, {5984, 51, 27}, {6036, 22, 0}, {6059, 21, 4},
+        {6081, 10, 0}, {6092, 24, 12}, {6117, 50, 4}, {6168, 19, 0}, {6188, 47, 11}, {6236, 30, 5}, {6267, 11, 0}, {6279, 27, 4},
+        {6307, 18, 4}, {6326, 17, 12}, {6344, 5, 0}, {6350, 10, 0}, {6361, 18, 4}, {6380, 8, 0}, {6389, 21, 4}, {6411, 18, 11},
+        {6430, 24, 11}, {6455, 18, 4}, {6474, 7, 0}, {6482, 21, 4}, {6504, 15, 12}, {6520, 15, 4}, {6536, 6, 0}, {6543, 21, 4},
+        {6565, 18, 12}, {6584, 7, 0}, {6592, 17, 0}, {6610, 40, 4}, {6651, 9, 11}, {6661, 15, 4}, {6677, 8, 14}, {6686, 30, 4},
+        {6717, 12, 4}, {6730, 15, 5}, {6746, 6, 0}, {6753, 12, 4}, {6766, 27, 22}, {6794, 24, 4}, {6819, 37, 4}, {6857, 16, 0},
+        {6874, 20, 14}, {6895, 41, 4}, {6937, 41, 12}, {6979, 27, 4}, {7007, 21, 4}, {7029, 24, 11}, {7054, 9, 0}, {7064, 21, 26},
+        {7086, 21, 4}, {7108, 9, 0}, {7118, 24, 4}, {7143, 18, 25}, {7162, 6, 0}, {7169, 18, 27}, {7188, 7, 0}, {7196, 18, 4},
+        {7215, 30, 11}, {7246, 11, 0}, {7258, 31, 4}, {7290, 21, 24}, {7312, 14, 14}, {7327, 24, 4}, {7352, 37, 24}, {7390, 34, 4},
+        {7425, 30, 4}, {7456, 34, 4}, {7491, 13, 0}, {7505, 17, 14}, {7523, 30, 5}, {7554, 30, 24}, {7585, 24, 4}, {7610, 10, 0},
+        {7621, 15, 0}, {7637, 28, 0}, {7666, 17, 0}, {7684, 20, 0}, {7705, 10, 0}, {7716, 18, 0}, {7735, 15, 0}, {7751, 8, 0},
+        {7760, 8, 0}, {7769, 17, 0}, {7787, 10, 0}, {7798, 16, 0}, {7815, 7, 0}, {7823, 7, 0}, {7831, 14, 0}, {7846, 14, 0},
+        {7861, 19, 0}, {7881, 8, 0}, {7890, 14, 0}, {7905, 10, 0}, {7916, 6, 0}, {7923, 6, 0}, {7930, 4, 0}, {7935, 7, 0},
+        {7943, 7, 0}, {7951, 9, 0}, {7961, 10, 0}, {7972, 6, 0}, {7979, 9, 0}, {7989, 17, 0}, {8007, 9, 0}, {8017, 6, 0},
+        {8024, 18, 0}, {8043, 5, 0}, {8049, 12, 0}, {8062, 11, 0}, {8074, 5, 0}, {8080, 8, 0}, {8089, 20, 0}, {8110, 12, 0},
+        {8123, 8, 0}, {8132, 11, 0}, {8144, 10, 0}, {8155, 13, 0}, {8169, 7, 0}, {8177, 13, 0}, {8191, 6, 0}, {8198, 8, 0},
+        {8207, 13, 0}, {8221, 14, 0}, {8236, 5, 0}, {8242, 7, 0}, {8250, 8, 0}, {8259, 9, 0}, {8269, 8, 0}, {8278, 4, 0},
+        {8283, 12, 0}, {8296, 11, 0}, {8308, 9, 0}, {8318, 7, 0}, {8326, 8, 0}, {8335, 14, 0}, {8350, 8, 0}, {8359, 4, 0},
+        {8364, 8, 0}, {8373, 7, 0}, {8381, 9, 0}, {8391, 7, 0}, {8399, 8, 0}, {8408, 8, 0}, {8417, 12, 0}, {8430, 10, 0},
+        {8441, 12, 0}, {8454, 8, 0}, {8463, 6, 0}, {8470, 5, 0}, {8476, 4, 0}, {8481, 9, 0}, {8491, 8, 0}, {8500, 7, 0},
+        {8508, 6, 0}, {8515, 8, 0}, {8524, 6, 0}, {8531, 7, 0}, {8539, 10, 0}, {8550, 7, 0}, {8558, 10, 0}, {8569, 5, 0},
+        {8575, 6, 0}, {8582, 20, 0}, {8603, 16, 0}, {8620, 7, 0}, {8628, 7, 0}, {8636, 7, 0}, {8644, 6, 0}, {8651, 12, 0},
+        {8664, 8, 0}, {8673, 25, 0}, {8699, 23, 0}, {8723, 13, 0}, {8737, 17, 0}, {8755, 11, 0}, {8767, 16, 0}, {8784, 20, 0},
+        {8805, 23, 0}, {8829, 5, 0}, {8835, 21, 0}, {8857, 25, 0}, {8883, 7, 0}, {8891, 18, 4}, {8910, 12, 11}, {8923, 5, 0},
+        {8929, 9, 0}, {8939, 6, 0}, {8946, 7, 0}, {8954, 13, 0}, {8968, 7, 0}, {8976, 21, 0}, {8998, 24, 0}, {9023, 14, 2},
+        {9038, 14, 2}, {9053, 31, 2}, {9085, 45, 2}, {9131, 43, 2}, {9175, 25, 2}, {9201, 37, 2}, {9239, 27, 2}, {9267, 66, 2},
+        {9334, 46, 2}, {9381, 60, 2}, {9442, 58, 2}, {9501, 52, 2}, {9554, 60, 2}, {9615, 50, 2}, {9666, 52, 2}, {9719, 39, 2},
+        {9759, 35, 2}, {9795, 12, 2}, {9808, 18, 2}, {9827, 16, 2}, {9844, 35, 2}, {9880, 31, 2}, {9912, 33, 2}, {9946, 35, 2},
+        {9982, 43, 2}, {10026, 43, 2}, {10070, 29, 2}, {10100, 33, 2}, {10134, 35, 2}, {10170, 31, 2}, {10202, 37, 2}, {10240, 33, 2},
+        {10274, 39, 2}, {10314, 24, 2}, {10339, 35, 2}, {10375, 39, 2}, {10415, 39, 2}, {10455, 37, 2}, {10493, 39, 2}, {10533, 33, 2},
+        {10567, 37, 2}, {10605, 37, 2}, {10643, 37, 2}, {10681, 12, 2}, {10694, 9, 0}, {10704, 41, 2}, {10746, 31, 2}, {10778, 45, 2},
+        {10824, 39, 2}, {10864, 45, 2}, {10910, 37, 2}, {10948, 39, 2}, {10988, 39, 2}, {11028, 54, 2}, {11083, 48, 2}, {11132, 33, 2},
+        {11166, 29, 2}, {11196, 45, 2}, {11242, 41, 2}, {11284, 41, 2}, {11326, 45, 2}, {11372, 39, 2}, {11412, 37, 2}, {11450, 36, 2},
+        {11487, 36, 2}, {11524, 32, 2}, {11557, 43, 2}, {11601, 37, 2}, {11639, 25, 2}, {11665, 45, 2}, {11711, 51, 2}, {11763, 41, 2},
+        {11805, 25, 2}, {11831, 39, 2}, {11871, 43, 2}, {11915, 33, 2}, {11949, 37, 2}, {11987, 59, 2}, {12047, 59, 2}, {12107, 74, 2},
+        {12182, 31, 2}, {12214, 41, 2}, {12256, 33, 2}, {12290, 37, 2}, {12328, 39, 2}, {12368, 35, 2}, {12404, 21, 2}, {12426, 35, 2},
+        {12462, 33, 2}, {12496, 41, 2}, {12538, 29, 2}, {12568, 27, 2}, {12596, 35, 2}, {12632, 35, 2}, {12668, 37, 2}, {12706, 31, 2},
+        {12738, 31, 2}, {12770, 29, 2}, {12800, 29, 2}, {12830, 29, 2}, {12860, 33, 2}, {12894, 37, 2}, {12932, 50, 2}, {12983, 56, 2},
+        {13040, 31, 2}, {13072, 39, 2}, {13112, 31, 2}, {13144, 54, 2}, {13199, 31, 2}, {13231, 31, 2}, {13263, 29, 2}, {13293, 12, 2},
+        {13306, 39, 2}, {13346, 6, 0}, {13353, 14, 2}, {13368, 9, 20}, {13378, 9, 20}, {13388, 9, 20}, {13398, 9, 20}, {13408, 6, 20},
+        {13415, 21, 20}, {13437, 9, 20}, {13447, 9, 20}, {13457, 9, 20}, {13467, 9, 20}, {13477, 9, 20}, {13487, 9, 20}, {13497, 9, 20},
+        {13507, 9, 20}, {13517, 9, 20}, {13527, 9, 20}, {13537, 9, 20}, {13547, 9, 20}, {13557, 9, 20}, {13567, 9, 20}, {13577, 9, 20},
+        {13587, 9, 20}, {13597, 18, 20}, {13616, 12, 20}, {13629, 9, 20}, {13639, 21, 20}, {13661, 9, 20}, {13671, 9, 20}, {13681, 12, 13},
+        {13694, 24, 20}, {13719, 6, 20}, {13726, 9, 20}, {13736, 9, 20}, {13746, 6, 20}, {13753, 12, 13}, {13766, 5, 0}, {13772, 15, 20},
+        {13788, 6, 20}, {13795, 21, 20}, {13817, 36, 0}, {13854, 5, 0}, {13860, 18, 0}, {13879, 18, 0}, {13898, 10, 0}, {13909, 5, 0},
+};
+
+static char TERRITORY_NAMES_UNPACKED_LOCAL[13915];
+
+static const PackedTerritoryNames PACKED_TERRITORY_NAMES_LOCAL = {
+        TERRITORY_NAMES_UNPACKED_LOCAL, 13915, TERRITORY_NAMES_PACKED_LOCAL, 8791, TERRITORY_NAMES_PAIRS_LOCAL,
+        TERRITORY_NAME_ALTERNATIVES_START_LOCAL, TERRITORY_NAME_ALTERNATIVES_LOCAL};
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // __INTERNAL_TERRITORY_NAMES_PACKED_H__
@@ -0,0 +1,465 @@
+/*
+ * Copyright (C) 2014-2019 Stichting Mapcode Foundation (http://www.mapcode.com)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __MAPCODE_HPP__
+#define __MAPCODE_HPP__
+
+/**
+ * Header-only C++17 interface to the mapcode C library (mapcoder.h). Compile mapcoder.c as C and
+ * link it with your C++ code.
+ *
+ * None of the functions in this header allocate memory, except the batch functions that return a
+ * std::vector (which use the allocator you pass). Encode results are returned in a MapcodeResults,
+ * which stores the mapcodes inline (as the C type Mapcodes) and gives access to them as
+ * std::string_view. Errors are returned as MapcodeError, as in the C library; nothing throws.
+ *
+ * Every function takes an optional MapcodeContext (see mapcoder.h), which defaults to the default
+ * context. The class mapcode::Context owns a context.
+ */
+
+#include <cstddef>
+#include <cstring>
+#include <iterator>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#if defined(__has_include)
+#if __has_include(<span>) && __cplusplus > 201703L
+#include <span>
+#define MAPCODE_HAS_STD_SPAN
+#endif
+#endif
+
+#include "mapcoder.h"
+
+namespace mapcode {
+
+#ifdef MAPCODE_HAS_STD_SPAN
+template<class T>
+using span = std::span<T>;
+#else
+
+/**
+ * Minimal replacement of std::span (C++20), with a dynamic extent: a pointer and a size. It can be
+ * constructed from an array, or from any container with data() and size() (e.g. std::vector).
+ */
+template<class T>
+class span {
+public:
+    using element_type = T;
+    using value_type = std::remove_cv_t<T>;
+    using size_type = std::size_t;
+    using pointer = T *;
+    using reference = T &;
+    using iterator = T *;
+
+    constexpr span() noexcept: data_(nullptr), size_(0) {}
+
+    constexpr span(T *data, std::size_t size) noexcept: data_(data), size_(size) {}
+
+    template<std::size_t N>
+    constexpr span(T (&array)[N]) noexcept: data_(array), size_(N) {}
+
+    template<class Container, class = std::enable_if_t<
+            std::is_convertible_v<decltype(std::declval<Container &>().data()), T *>>>
+    constexpr span(Container &container) noexcept: data_(container.data()), size_(container.size()) {}
+
+    template<class U, class = std::enable_if_t<std::is_convertible_v<U (*)[], T (*)[]>>>
+    constexpr span(const span<U> &other) noexcept: data_(other.data()), size_(other.size()) {}
+
+    constexpr T *data() const noexcept { return data_; }
+
+    constexpr std::size_t size() const noexcept { return size_; }
+
+    constexpr bool empty() const noexcept { return size_ == 0; }
+
+    constexpr T &operator[](std::size_t i) const noexcept { return data_[i]; }
+
+    constexpr T *begin() const noexcept { return data_; }
+
+    constexpr T *end() const noexcept { return data_ + size_; }
+
+private:
+    T *data_;
+    std::size_t size_;
+};
+
+#endif
+
+
+// Constants of the C library, as typed constants.
+
+constexpr int maxNrOfMapcodeResults = MAX_NR_OF_MAPCODE_RESULTS;
+constexpr int maxPrecisionDigits = MAX_PRECISION_DIGITS;
+constexpr int maxAlphabetsPerTerritory = MAX_ALPHABETS_PER_TERRITORY;
+constexpr int nrTerritories = _TERRITORY_MAX - _TERRITORY_MIN - 1;
+constexpr int nrAlphabets = _ALPHABET_MAX;
+
+
+// Territory and alphabet helpers.
+
+constexpr bool isValidTerritory(enum Territory territory) noexcept {
+    return _TERRITORY_MIN < territory && territory < _TERRITORY_MAX;
+}
+
+// Returns the index of a valid territory, in the range [0, nrTerritories).
+constexpr int indexOfTerritory(enum Territory territory) noexcept {
+    return static_cast<int>(territory) - _TERRITORY_MIN - 1;
+}
+
+// Returns the territory with an index in the range [0, nrTerritories), or TERRITORY_NONE.
+constexpr enum Territory territoryOfIndex(int index) noexcept {
+    return (0 <= index && index < nrTerritories) ? static_cast<enum Territory>(_TERRITORY_MIN + 1 + index)
+                                                  : TERRITORY_NONE;
+}
+
+constexpr bool isValidAlphabet(enum Alphabet alphabet) noexcept {
+    return _ALPHABET_MIN < alphabet && alphabet < _ALPHABET_MAX;
+}
+
+// Returns the alphabet with a number in the range [0, nrAlphabets), or _ALPHABET_MIN.
+constexpr enum Alphabet alphabetOfNumber(int number) noexcept {
+    return (0 <= number && number < nrAlphabets) ? static_cast<enum Alphabet>(number) : _ALPHABET_MIN;
+}
+
+/**
+ * A mapcode as returned by the encoder, split in its territory and its code. The territory is empty
+ * for international mapcodes. The views refer to the string they were split from.
+ */
+struct MapcodeParts {
+    std::string_view territory;
+    std::string_view code;
+};
+
+constexpr MapcodeParts splitMapcode(std::string_view mapcode) noexcept {
+    const std::size_t space = mapcode.find(' ');
+    if (space == std::string_view::npos) {
+        return {std::string_view(), mapcode};
+    }
+    return {mapcode.substr(0, space), mapcode.substr(space + 1)};
+}
+
+
+/**
+ * The mapcodes of an encode call. The mapcodes are stored inline, in the C type Mapcodes, so a
+ * MapcodeResults never allocates memory. Copying or moving it copies only the mapcodes in use. The
+ * results are std::string_view's that refer to this object.
+ */
+class MapcodeResults {
+public:
+    class const_iterator {
+    public:
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = std::string_view;
+        using difference_type = std::ptrdiff_t;
+        using pointer = void;
+        using reference = std::string_view;
+
+        constexpr const_iterator() noexcept: row_(nullptr) {}
+
+        explicit constexpr const_iterator(const char (*row)[MAX_MAPCODE_RESULT_ASCII_LEN]) noexcept: row_(row) {}
+
+        std::string_view operator*() const noexcept { return std::string_view(*row_); }
+
+        std::string_view operator[](difference_type n) const noexcept { return std::string_view(row_[n]); }
+
+        const_iterator &operator++() noexcept {
+            ++row_;
+            return *this;
+        }
+
+        const_iterator operator++(int) noexcept { return const_iterator(row_++); }
+
+        const_iterator &operator--() noexcept {
+            --row_;
+            return *this;
+        }
+
+        const_iterator operator--(int) noexcept { return const_iterator(row_--); }
+
+        const_iterator &operator+=(difference_type n) noexcept {
+            row_ += n;
+            return *this;
+        }
+
+        const_iterator &operator-=(difference_type n) noexcept {
+            row_ -= n;
+            return *this;
+        }
+
+        friend const_iterator operator+(const_iterator i, difference_type n) noexcept { return i += n; }
+
+        friend const_iterator operator+(difference_type n, const_iterator i) noexcept { return i += n; }
+
+        friend const_iterator operator-(const_iterator i, difference_type n) noexcept { return i -= n; }
+
+        friend difference_type operator-(const_iterator a, const_iterator b) noexcept { return a.row_ - b.row_; }
+
+        friend bool operator==(const_iterator a, const_iterator b) noexcept { return a.row_ == b.row_; }
+
+        friend bool operator!=(const_iterator a, const_iterator b) noexcept { return a.row_ != b.row_; }
+
+        friend bool operator<(const_iterator a, const_iterator b) noexcept { return a.row_ < b.row_; }
+
+        friend bool operator>(const_iterator a, const_iterator b) noexcept { return a.row_ > b.row_; }
+
+        friend bool operator<=(const_iterator a, const_iterator b) noexcept { return a.row_ <= b.row_; }
+
+        friend bool operator>=(const_iterator a, const_iterator b) noexcept { return a.row_ >= b.row_; }
+
+    private:
+        const char (*row_)[MAX_MAPCODE_RESULT_ASCII_LEN];
+    };
+
+    using value_type = std::string_view;
+    using size_type = std::size_t;
+    using iterator = const_iterator;
+
+    MapcodeResults() noexcept { mapcodes_.count = 0; }
+
+    MapcodeResults(const MapcodeResults &other) noexcept { copyFrom(other); }
+
+    // Moving is copying: there is nothing to steal, as the mapcodes are stored inline.
+    MapcodeResults(MapcodeResults &&other) noexcept { copyFrom(other); }
+
+    MapcodeResults &operator=(const MapcodeResults &other) noexcept {
+        if (this != &other) {
+            copyFrom(other);
+        }
+        return *this;
+    }
+
+    MapcodeResults &operator=(MapcodeResults &&other) noexcept {
+        if (this != &other) {
+            copyFrom(other);
+        }
+        return *this;
+    }
+
+    std::size_t size() const noexcept { return static_cast<std::size_t>(mapcodes_.count); }
+
+    bool empty() const noexcept { return mapcodes_.count <= 0; }
+
+    static constexpr std::size_t capacity() noexcept { return MAX_NR_OF_MAPCODE_RESULTS; }
+
+    // Returns mapcode i, e.g. "NLD 49.4V" (the last one is the international mapcode).
+    std::string_view operator[](std::size_t i) const noexcept { return std::string_view(mapcodes_.mapcode[i]); }
+
+    // Returns the zero-terminated mapcode i.
+    const char *c_str(std::size_t i) const noexcept { return mapcodes_.mapcode[i]; }
+
+    const_iterator begin() const noexcept { return const_iterator(mapcodes_.mapcode); }
+
+    const_iterator end() const noexcept { return const_iterator(mapcodes_.mapcode + size()); }
+
+    // The underlying C results, e.g. to pass to the C library.
+    const Mapcodes &mapcodes() const noexcept { return mapcodes_; }
+
+    Mapcodes &mapcodes() noexcept { return mapcodes_; }
+
+private:
+    // Only the used rows (and their zero-terminated strings) are copied.
+    void copyFrom(const MapcodeResults &other) noexcept {
+        int i;
+        mapcodes_.count = other.mapcodes_.count;
+        for (i = 0; i < other.mapcodes_.count; ++i) {
+            std::strcpy(mapcodes_.mapcode[i], other.mapcodes_.mapcode[i]);
+        }
+    }
+
+    Mapcodes mapcodes_;
+};
+
+
+/**
+ * The result of a decode call: the coordinate, if error is ERR_OK.
+ */
+struct DecodeResult {
+    double latDeg;
+    double lonDeg;
+    enum MapcodeError error;
+
+    explicit constexpr operator bool() const noexcept { return error == ERR_OK; }
+};
+
+
+/**
+ * Owns a MapcodeContext (see mapcoder.h), e.g. to use a data file next to the data of the default
+ * context. A Context can be moved, not copied. It must not be used by several threads at the
+ * same time.
+ */
+class Context {
+public:
+    // Creates a context for a data file, or for the compiled-in data if dataFile is nullptr. Check
+    // with valid() whether it could be created.
+    explicit Context(const MapcodeDataFile *dataFile = nullptr) noexcept: context_(createMapcodeContext(dataFile)) {}
+
+    Context(Context &&other) noexcept: context_(other.context_) { other.context_ = nullptr; }
+
+    Context &operator=(Context &&other) noexcept {
+        std::swap(context_, other.context_);
+        return *this;
+    }
+
+    Context(const Context &) = delete;
+
+    Context &operator=(const Context &) = delete;
+
+    ~Context() { destroyMapcodeContext(context_); }
+
+    bool valid() const noexcept { return context_ != nullptr; }
+
+    MapcodeContext *get() const noexcept { return context_; }
+
+    operator MapcodeContext *() const noexcept { return context_; }
+
+    const char *dataVersion() const noexcept { return getMapcodeContextDataVersion(context_); }
+
+    MapcodeStatistics statistics() const noexcept {
+        MapcodeStatistics statistics;
+        getMapcodeStatistics(&statistics, context_);
+        return statistics;
+    }
+
+private:
+    MapcodeContext *context_;
+};
+
+
+/**
+ * Encode a latitude, longitude pair (in degrees) to mapcodes; see encodeLatLonToMapcodes.
+ */
+inline MapcodeResults encode(double latDeg, double lonDeg, enum Territory territory = TERRITORY_NONE,
+                             int extraDigits = 0, MapcodeContext *context = nullptr) noexcept {
+    MapcodeResults results;
+    encodeLatLonToMapcodesWithContext(context, &results.mapcodes(), latDeg, lonDeg, territory, extraDigits);
+    return results;
+}
+
+/**
+ * Decode a (UTF8) mapcode to a latitude, longitude pair; see decodeMapcodeToLatLonUtf8. The
+ * mapcode does not need to be zero-terminated: it is copied to a buffer on the stack. Leading and
+ * trailing white space is skipped (as decodeMapcodeToLatLonUtf8 does); mapcodes that are longer
+ * than any valid mapcode give ERR_INVALID_MAPCODE_FORMAT.
+ */
+inline DecodeResult decode(std::string_view mapcode, enum Territory territory = TERRITORY_NONE,
+                           MapcodeContext *context = nullptr) noexcept {
+    char buffer[MAX_MAPCODE_RESULT_UTF8_LEN + 1];
+    DecodeResult result = {0.0, 0.0, ERR_INVALID_MAPCODE_FORMAT};
+    while (!mapcode.empty() && mapcode.front() > 0 && mapcode.front() <= 32) {
+        mapcode.remove_prefix(1);
+    }
+    while (!mapcode.empty() && mapcode.back() > 0 && mapcode.back() <= 32) {
+        mapcode.remove_suffix(1);
+    }
+    if (mapcode.size() < sizeof(buffer)) {
+        std::memcpy(buffer, mapcode.data(), mapcode.size());
+        buffer[mapcode.size()] = 0;
+        result.error = decodeMapcodeToLatLonUtf8WithContext(context, &result.latDeg, &result.lonDeg, buffer,
+                                                            territory, nullptr);
+    }
+    return result;
+}
+
+/**
+ * Get the territory of an ISO3166 code (e.g. "NLD", "US-CA"); see getTerritoryCode.
+ */
+inline enum Territory territoryOf(std::string_view territoryISO,
+                                  enum Territory optionalTerritoryContext = TERRITORY_NONE,
+                                  const MapcodeContext *context = nullptr) noexcept {
+    char buffer[MAX_ISOCODE_ASCII_LEN + 1];
+    if (territoryISO.size() >= sizeof(buffer)) {
+        return TERRITORY_UNKNOWN;
+    }
+    std::memcpy(buffer, territoryISO.data(), territoryISO.size());
+    buffer[territoryISO.size()] = 0;
+    return getTerritoryCodeWithContext(context, buffer, optionalTerritoryContext);
+}
+
+
+/**
+ * Batch encode: encodes latitudes[i], longitudes[i] into results[i], for the first n coordinates,
+ * where n is the smallest of the 3 sizes.
+ *
+ * Returns:
+ *      The number of coordinates encoded (n).
+ */
+inline std::size_t encode(span<const double> latitudes, span<const double> longitudes,
+                          span<MapcodeResults> results, enum Territory territory = TERRITORY_NONE,
+                          int extraDigits = 0, MapcodeContext *context = nullptr) noexcept {
+    std::size_t i, n = latitudes.size();
+    if (longitudes.size() < n) {
+        n = longitudes.size();
+    }
+    if (results.size() < n) {
+        n = results.size();
+    }
+    for (i = 0; i < n; ++i) {
+        encodeLatLonToMapcodesWithContext(context, &results[i].mapcodes(), latitudes[i], longitudes[i], territory,
+                                          extraDigits);
+    }
+    return n;
+}
+
+/**
+ * Batch encode to a vector, allocated with the given allocator (e.g. a std::pmr::polymorphic_allocator),
+ * of min(latitudes.size(), longitudes.size()) results. This is the only allocation.
+ */
+template<class Allocator = std::allocator<MapcodeResults>>
+std::vector<MapcodeResults, Allocator> encode(span<const double> latitudes, span<const double> longitudes,
+                                              enum Territory territory, int extraDigits = 0,
+                                              MapcodeContext *context = nullptr,
+                                              const Allocator &allocator = Allocator()) {
+    std::vector<MapcodeResults, Allocator> results(
+            latitudes.size() < longitudes.size() ? latitudes.size() : longitudes.size(), allocator);
+    encode(latitudes, longitudes, span<MapcodeResults>(results.data(), results.size()), territory, extraDigits,
+           context);
+    return results;
+}
+
+/**
+ * Batch decode: decodes mapcodes[i] into results[i], for the first min(mapcodes.size(), results.size())
+ * mapcodes.
+ *
+ * Returns:
+ *      The number of mapcodes decoded.
+ */
+inline std::size_t decode(span<const std::string_view> mapcodes, span<DecodeResult> results,
+                          enum Territory territory = TERRITORY_NONE, MapcodeContext *context = nullptr) noexcept {
+    std::size_t i, n = (mapcodes.size() < results.size()) ? mapcodes.size() : results.size();
+    for (i = 0; i < n; ++i) {
+        results[i] = decode(mapcodes[i], territory, context);
+    }
+    return n;
+}
+
+/**
+ * Batch decode to a vector, allocated with the given allocator, of mapcodes.size() results.
+ */
+template<class Allocator = std::allocator<DecodeResult>>
+std::vector<DecodeResult, Allocator> decode(span<const std::string_view> mapcodes, enum Territory territory,
+                                            MapcodeContext *context = nullptr,
+                                            const Allocator &allocator = Allocator()) {
+    std::vector<DecodeResult, Allocator> results(mapcodes.size(), allocator);
+    decode(mapcodes, span<DecodeResult>(results.data(), results.size()), territory, context);
+    return results;
+}
+
+} // namespace mapcode
+
+#endif // __MAPCODE_HPP__
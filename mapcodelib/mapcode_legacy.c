@@ -15,7 +15,6 @@
  */
 
 #include <string.h>
-#include <stdio.h>
 
 #include "mapcode_legacy.h"
 
@@ -86,27 +85,9 @@ const UWORD *encodeToAlphabet_Deprecated(const char *asciiString,
 
 
 char *convertToRoman(char *asciiBuffer, int maxLength, const UWORD *unicodeBuffer) {
-
-    MapcodeElements mapcodeElements;
-    double lat, lon;
-    enum MapcodeError err;
-
-    *asciiBuffer = 0;
-    err = decodeMapcodeToLatLonUtf16(&lat, &lon, unicodeBuffer, TERRITORY_UNKNOWN, &mapcodeElements);
-    if (err == ERR_MISSING_TERRITORY || err == ERR_MAPCODE_UNDECODABLE || err == ERR_EXTENSION_UNDECODABLE) {
-        err = ERR_OK;
-    }
-    if (!err) {
-        char romanized[MAX_MAPCODE_RESULT_LEN];
-        sprintf(romanized, "%s%s%s%s%s",
-                mapcodeElements.territoryISO,
-                *mapcodeElements.territoryISO ? " " : "",
-                mapcodeElements.properMapcode,
-                *mapcodeElements.precisionExtension ? "-" : "",
-                mapcodeElements.precisionExtension);
-        if ((int) strlen(romanized) < maxLength) {
-            strcpy(asciiBuffer, romanized);
-        }
+    // the mapcode is only parsed (in context TERRITORY_UNKNOWN), not decoded
+    if (convertMapcodesToRomanUtf16(asciiBuffer, maxLength, unicodeBuffer, 1) != 1 && maxLength > 0) {
+        *asciiBuffer = 0;
     }
     return asciiBuffer;
 }
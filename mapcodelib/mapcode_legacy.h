@@ -126,7 +126,8 @@ const char *convertTerritoryCodeToIsoName_Deprecated(
 
 
 /**
- * Decode a string to Roman characters.
+ * Decode a string to Roman characters. The mapcode is only parsed, not decoded
+ * (see convertMapcodesToRomanUtf16).
  *
  * Arguments:
  *      asciiString - Buffer to be filled with the ASCII string result.
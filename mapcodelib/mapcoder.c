@@ -19,39 +19,28 @@
 #include <ctype.h>  // toupper
 #include <math.h>   // floor fabs
 
+#if defined(__unix__) || defined(__APPLE__)
+#define MAPCODE_DATA_FILE_MMAP  // data files are mapped into memory, rather than read
+#include <fcntl.h>      // open
+#include <sys/mman.h>   // mmap munmap
+#include <sys/stat.h>   // fstat
+#include <unistd.h>     // close
+#else
+#include <stdio.h>      // fopen fread fclose
+#endif
+
+#if defined(_MSC_VER)
+#include <intrin.h>     // _InterlockedCompareExchange _InterlockedExchange _InterlockedOr
+#elif !defined(__GNUC__) && defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 201112L) && !defined(__STDC_NO_ATOMICS__)
+#include <stdatomic.h>  // atomic_int atomic_load atomic_store atomic_compare_exchange_strong
+#endif
+
 #include "mapcoder.h"
 #include "internal_data.h"
 #include "internal_iso3166_data.h"
 #include "internal_territory_alphabets.h"
-#include "internal_territory_names_local.h"
+#include "internal_territory_names_packed.h"
 #include "internal_alphabet_recognizer.h"
-#include "internal_territory_names_af.h"
-#include "internal_territory_names_ar.h"
-#include "internal_territory_names_be.h"
-#include "internal_territory_names_cn.h"
-#include "internal_territory_names_cs.h"
-#include "internal_territory_names_da.h"
-#include "internal_territory_names_de.h"
-#include "internal_territory_names_en.h"
-#include "internal_territory_names_es.h"
-#include "internal_territory_names_fi.h"
-#include "internal_territory_names_fr.h"
-#include "internal_territory_names_he.h"
-#include "internal_territory_names_hi.h"
-#include "internal_territory_names_hr.h"
-#include "internal_territory_names_id.h"
-#include "internal_territory_names_it.h"
-#include "internal_territory_names_ja.h"
-#include "internal_territory_names_ko.h"
-#include "internal_territory_names_nl.h"
-#include "internal_territory_names_no.h"
-#include "internal_territory_names_pl.h"
-#include "internal_territory_names_pt.h"
-#include "internal_territory_names_ru.h"
-#include "internal_territory_names_sv.h"
-#include "internal_territory_names_sw.h"
-#include "internal_territory_names_tr.h"
-#include "internal_territory_names_uk.h"
 
 // The constants are also exported as variables, to allow other languages to use them.
 char *_MAPCODE_C_VERSION                  = MAPCODE_C_VERSION;
@@ -90,6 +79,24 @@ void _TestAssert(int iCondition, const char *cstrFile, int iLine) {
 #endif
 
 
+// The grid routines are inlined into the encoders and decoders of the hot territories (internal_hot_encoders.h),
+// where their record is a constant.
+#if defined(__GNUC__)
+#define ALWAYS_INLINE static __inline__ __attribute__((always_inline))
+#elif defined(_MSC_VER)
+#define ALWAYS_INLINE static __forceinline
+#else
+#define ALWAYS_INLINE static
+#endif
+
+// If you do not want the specialised encoders and decoders of the hot territories (internal_hot_encoders.h and
+// internal_hot_decoders.h, generated by tools/generate_hot_territories.py), define NO_HOT_TERRITORIES on the
+// command-line of your compiler.
+
+// Subdivisions are encoded with the records of their parent. Within one encode call, the results of the parent are
+// cached and reused for its other subdivisions; to encode the parent again for every subdivision, define
+// NO_PARENT_RESULT_REUSE on the command-line of your compiler.
+
 // If you do not want to use the fast encoding from internal_territory_search.h, define NO_FAST_ENCODE on the
 // command-line of your compiler (or uncomment the following line).
 // #define NO_FAST_ENCODE
@@ -100,12 +107,90 @@ void _TestAssert(int iCondition, const char *cstrFile, int iLine) {
 
 #endif
 
-#define IS_NAMELESS(m)        (TERRITORY_BOUNDARIES[m].flags & 64)
-#define IS_RESTRICTED(m)      (TERRITORY_BOUNDARIES[m].flags & 512)
-#define IS_SPECIAL_SHAPE(m)   (TERRITORY_BOUNDARIES[m].flags & 1024)
-#define REC_TYPE(m)           ((TERRITORY_BOUNDARIES[m].flags >> 7) & 3)
-#define SMART_DIV(m)          (TERRITORY_BOUNDARIES[m].flags >> 16)
-#define HEADER_LETTER(m)      (ENCODE_CHARS[(TERRITORY_BOUNDARIES[m].flags >> 11) & 31])
+#include "internal_restricted_overlaps.h"
+#include "internal_roman_table.h"
+#include "internal_alphabet_utf8.h"
+#include "internal_territory_name_index.h"
+#include "internal_iso_hash.h"
+
+// The tables used by the encoder and decoder: the compiled-in tables, or those of a data file (see
+// loadMapcodeDataFile). The ISO codes and names of the territories are always compiled in, as they
+// belong to enum Territory.
+typedef struct {
+    const char *dataVersion;
+    int nrBoundaries;                                   // number of records in territoryBoundaries
+    const int *dataStart;                               // DATA_START
+    const TerritoryBoundary *territoryBoundaries;       // TERRITORY_BOUNDARIES
+    const int *redivar;                                 // REDIVAR (NULL if NO_FAST_ENCODE is defined)
+    const char *parentLetter;                           // PARENT_LETTER
+    const char *parentNumber;                           // PARENT_NUMBER
+    const TerritoryAlphabets *alphabetsForTerritory;    // ALPHABETS_FOR_TERRITORY
+    int nrRestrictedRecs;                               // NR_RESTRICTED_RECS
+    const int *restrictedRec;                           // RESTRICTED_REC
+    const int *restrictedOverlapStart;                  // RESTRICTED_OVERLAP_START
+    const unsigned short *restrictedOverlap;            // RESTRICTED_OVERLAP
+} MapcodeData;
+
+static const MapcodeData COMPILED_MAPCODE_DATA = {
+        MAPCODE_DATA_VERSION,
+        MAPCODE_BOUNDARY_MAX + 1,
+        DATA_START,
+        TERRITORY_BOUNDARIES,
+#ifndef NO_FAST_ENCODE
+        REDIVAR,
+#else
+        NULL,
+#endif
+        PARENT_LETTER,
+        PARENT_NUMBER,
+        ALPHABETS_FOR_TERRITORY,
+        NR_RESTRICTED_RECS,
+        RESTRICTED_REC,
+        RESTRICTED_OVERLAP_START,
+        RESTRICTED_OVERLAP
+};
+
+// A context bundles the data used by the encoder and decoder with the statistics of its calls.
+struct MapcodeContext {
+    const MapcodeData *data;
+    MapcodeStatistics statistics;
+};
+
+// the context of the functions without a MapcodeContext argument (see useMapcodeDataFile); keeps no statistics
+static MapcodeContext defaultMapcodeContext = {&COMPILED_MAPCODE_DATA, {0, 0, 0, 0}};
+
+// the data of mapcodeContext, or of the default context if mapcodeContext is NULL
+#define DATA_OF_CONTEXT(mapcodeContext) ((mapcodeContext) ? (mapcodeContext)->data : defaultMapcodeContext.data)
+
+// counts an encode call that returned nrResults mapcodes (nothing is counted for the default context)
+static void countEncode(MapcodeContext *mapcodeContext, const int nrResults) {
+    if (mapcodeContext) {
+        mapcodeContext->statistics.nrEncodes++;
+        mapcodeContext->statistics.nrEncodeResults += (nrResults > 0 ? nrResults : 0);
+    }
+}
+
+// counts a decode call that returned err (nothing is counted for the default context)
+static void countDecode(MapcodeContext *mapcodeContext, const enum MapcodeError err) {
+    if (mapcodeContext) {
+        mapcodeContext->statistics.nrDecodes++;
+        if (err != ERR_OK) {
+            mapcodeContext->statistics.nrDecodeErrors++;
+        }
+    }
+}
+
+#undef TERRITORY_BOUNDARY
+#define TERRITORY_BOUNDARY(data, m) (&(data)->territoryBoundaries[m])
+
+#define IS_NAMELESS(data, m)        (TERRITORY_BOUNDARY(data, m)->flags & 64)
+#define IS_RESTRICTED(data, m)      (TERRITORY_BOUNDARY(data, m)->flags & 512)
+#define IS_SPECIAL_SHAPE(data, m)   (TERRITORY_BOUNDARY(data, m)->flags & 1024)
+#define REC_TYPE(data, m)           ((TERRITORY_BOUNDARY(data, m)->flags >> 7) & 3)
+#define SMART_DIV(data, m)          SMART_DIV_OF_BOUNDARY(TERRITORY_BOUNDARY(data, m))
+#define SMART_DIV_OF_BOUNDARY(b)    ((b)->flags >> 16)
+#define CODEX_OF_BOUNDARY(b)        (10 * (((b)->flags & 31) / 5) + (((b)->flags & 31) % 5) + 1)
+#define HEADER_LETTER(data, m)      (ENCODE_CHARS[(TERRITORY_BOUNDARY(data, m)->flags >> 11) & 31])
 
 #define TOKENSEP   0
 #define TOKENDOT   1
@@ -141,37 +226,37 @@ static const int DEBUG_STOP_AT = -1; // to externally test-restrict internal enc
 
 typedef struct {
     const char *locale;
-    const char **territoryFullNames;
+    const PackedTerritoryNames *territoryFullNames;
 } LocaleRegistryItem;
 
 static const LocaleRegistryItem LOCALE_REGISTRY[] = {
-        {"AF", TERRITORY_FULL_NAME_AF},
-        {"AR", TERRITORY_FULL_NAME_AR},
-        {"BE", TERRITORY_FULL_NAME_BE},
-        {"CN", TERRITORY_FULL_NAME_CN},
-        {"CS", TERRITORY_FULL_NAME_CS},
-        {"DA", TERRITORY_FULL_NAME_DA},
-        {"DE", TERRITORY_FULL_NAME_DE},
-        {"EN", TERRITORY_FULL_NAME_EN},
-        {"ES", TERRITORY_FULL_NAME_ES},
-        {"FI", TERRITORY_FULL_NAME_FI},
-        {"FR", TERRITORY_FULL_NAME_FR},
-        {"HE", TERRITORY_FULL_NAME_HE},
-        {"HI", TERRITORY_FULL_NAME_HI},
-        {"HR", TERRITORY_FULL_NAME_HR},
-        {"ID", TERRITORY_FULL_NAME_ID},
-        {"IT", TERRITORY_FULL_NAME_IT},
-        {"JA", TERRITORY_FULL_NAME_JA},
-        {"KO", TERRITORY_FULL_NAME_KO},
-        {"NL", TERRITORY_FULL_NAME_NL},
-        {"NO", TERRITORY_FULL_NAME_NO},
-        {"PT", TERRITORY_FULL_NAME_PT},
-        {"PL", TERRITORY_FULL_NAME_PL},
-        {"RU", TERRITORY_FULL_NAME_RU},
-        {"SV", TERRITORY_FULL_NAME_SV},
-        {"SW", TERRITORY_FULL_NAME_SW},
-        {"TR", TERRITORY_FULL_NAME_TR},
-        {"UK", TERRITORY_FULL_NAME_UK}
+        {"AF", &PACKED_TERRITORY_NAMES_AF},
+        {"AR", &PACKED_TERRITORY_NAMES_AR},
+        {"BE", &PACKED_TERRITORY_NAMES_BE},
+        {"CN", &PACKED_TERRITORY_NAMES_CN},
+        {"CS", &PACKED_TERRITORY_NAMES_CS},
+        {"DA", &PACKED_TERRITORY_NAMES_DA},
+        {"DE", &PACKED_TERRITORY_NAMES_DE},
+        {"EN", &PACKED_TERRITORY_NAMES_EN},
+        {"ES", &PACKED_TERRITORY_NAMES_ES},
+        {"FI", &PACKED_TERRITORY_NAMES_FI},
+        {"FR", &PACKED_TERRITORY_NAMES_FR},
+        {"HE", &PACKED_TERRITORY_NAMES_HE},
+        {"HI", &PACKED_TERRITORY_NAMES_HI},
+        {"HR", &PACKED_TERRITORY_NAMES_HR},
+        {"ID", &PACKED_TERRITORY_NAMES_ID},
+        {"IT", &PACKED_TERRITORY_NAMES_IT},
+        {"JA", &PACKED_TERRITORY_NAMES_JA},
+        {"KO", &PACKED_TERRITORY_NAMES_KO},
+        {"NL", &PACKED_TERRITORY_NAMES_NL},
+        {"NO", &PACKED_TERRITORY_NAMES_NO},
+        {"PT", &PACKED_TERRITORY_NAMES_PT},
+        {"PL", &PACKED_TERRITORY_NAMES_PL},
+        {"RU", &PACKED_TERRITORY_NAMES_RU},
+        {"SV", &PACKED_TERRITORY_NAMES_SV},
+        {"SW", &PACKED_TERRITORY_NAMES_SW},
+        {"TR", &PACKED_TERRITORY_NAMES_TR},
+        {"UK", &PACKED_TERRITORY_NAMES_UK}
 };
 
 // important information about the 8 parents
@@ -529,31 +614,30 @@ static char *safeCopy(char *targetString, const char *sourceString, const int ta
 
 /*** low-level data access ***/
 
-static int firstRec(const enum Territory ccode) {
+static int firstRec(const MapcodeData *data, const enum Territory ccode) {
     ASSERT((_TERRITORY_MIN < ccode) && (ccode < _TERRITORY_MAX));
-    return DATA_START[INDEX_OF_TERRITORY(ccode)];
+    return data->dataStart[INDEX_OF_TERRITORY(ccode)];
 }
 
 
-static int lastRec(const enum Territory ccode) {
+static int lastRec(const MapcodeData *data, const enum Territory ccode) {
     ASSERT((_TERRITORY_MIN < ccode) && (ccode < _TERRITORY_MAX));
-    return DATA_START[INDEX_OF_TERRITORY(ccode) + 1] - 1;
+    return data->dataStart[INDEX_OF_TERRITORY(ccode) + 1] - 1;
 }
 
 
 // returns parent of ccode (or TERRITORY_NONE)
-static enum Territory parentTerritoryOf(const enum Territory ccode) {
+static enum Territory parentTerritoryOf(const MapcodeData *data, const enum Territory ccode) {
     if (ccode <= _TERRITORY_MIN || ccode >= _TERRITORY_MAX) {
         return TERRITORY_NONE;
     }
-    return PARENT_NR[(int) PARENT_LETTER[INDEX_OF_TERRITORY(ccode)]];
+    return PARENT_NR[(int) data->parentLetter[INDEX_OF_TERRITORY(ccode)]];
 }
 
 
-static int coDex(const int m) {
-    int c = TERRITORY_BOUNDARIES[m].flags & 31;
-    ASSERT((0 <= m) && (m <= MAPCODE_BOUNDARY_MAX));
-    return 10 * (c / 5) + ((c % 5) + 1);
+static int coDex(const MapcodeData *data, const int m) {
+    ASSERT((0 <= m) && (m < data->nrBoundaries));
+    return CODEX_OF_BOUNDARY(TERRITORY_BOUNDARY(data, m));
 }
 
 
@@ -591,18 +675,18 @@ static int xDivider4(const int miny, const int maxy) {
 /*** mid-level data access ***/
 
 // returns true iff ccode is a subdivision of some other country
-static int isSubdivision(const enum Territory ccode) {
-    return parentTerritoryOf(ccode) != TERRITORY_NONE;
+static int isSubdivision(const MapcodeData *data, const enum Territory ccode) {
+    return parentTerritoryOf(data, ccode) != TERRITORY_NONE;
 }
 
 
 // find first territory rectangle of the same type as m
-static int firstNamelessRecord(const int m, const int firstcode) {
+static int firstNamelessRecord(const MapcodeData *data, const int m, const int firstcode) {
     int i = m;
-    const int codexm = coDex(m);
-    ASSERT((0 <= m) && (m <= MAPCODE_BOUNDARY_MAX));
-    ASSERT((0 <= firstcode) && (firstcode <= MAPCODE_BOUNDARY_MAX));
-    while (i >= firstcode && coDex(i) == codexm && IS_NAMELESS(i)) {
+    const int codexm = coDex(data, m);
+    ASSERT((0 <= m) && (m < data->nrBoundaries));
+    ASSERT((0 <= firstcode) && (firstcode < data->nrBoundaries));
+    while (i >= firstcode && coDex(data, i) == codexm && IS_NAMELESS(data, i)) {
         i--;
     }
     return (i + 1);
@@ -610,16 +694,16 @@ static int firstNamelessRecord(const int m, const int firstcode) {
 
 
 // count all territory rectangles of the same type as m
-static int countNamelessRecords(const int m, const int firstcode) {
-    const int first = firstNamelessRecord(m, firstcode);
-    const int codexm = coDex(m);
+static int countNamelessRecords(const MapcodeData *data, const int m, const int firstcode) {
+    const int first = firstNamelessRecord(data, m, firstcode);
+    const int codexm = coDex(data, m);
     int last = m;
-    ASSERT((0 <= m) && (m <= MAPCODE_BOUNDARY_MAX));
-    ASSERT((0 <= firstcode) && (firstcode <= MAPCODE_BOUNDARY_MAX));
-    while (coDex(last) == codexm) {
+    ASSERT((0 <= m) && (m < data->nrBoundaries));
+    ASSERT((0 <= firstcode) && (firstcode < data->nrBoundaries));
+    while (coDex(data, last) == codexm) {
         last++;
     }
-    ASSERT((0 <= last) && (last <= MAPCODE_BOUNDARY_MAX));
+    ASSERT((0 <= last) && (last < data->nrBoundaries));
     ASSERT(last >= first);
     return (last - first);
 }
@@ -775,16 +859,46 @@ static int unpackIfAllDigits(char *input) {
 //
 ///////////////////////////////////////////////////////////////////////////////////////////////
 
+// the results of a parent territory, reused for all its subdivisions in one encode call
+typedef struct {
+    enum Territory parent;  // parent of which the results are complete (TERRITORY_NONE if none)
+    int count;              // number of results
+    int overflow;           // nonzero if the parent had more results than fit
+    char result[MAX_NR_OF_MAPCODE_RESULTS][MAX_CLEAN_MAPCODE_ASCII_LEN + 1]; // results (without territory)
+} ParentResults;
+
 typedef struct {
     // input
+    const MapcodeData *data;
     Point32 coord32;
     int fraclat; // latitude fraction of microdegrees, expressed in 1 / 810,000ths
     int fraclon; // longitude fraction of microdegrees, expressed in 1 / 3,240,000ths
     // output
     Mapcodes *mapcodes;
+    ParentResults *parentResults; // results of the parent of a subdivision (NULL if they are not reused)
 } EncodeRec;
 
 
+// powers of 30; every pair of extension characters holds a base-30 digit of x and one of y
+static const int POWER_OF_30[MAX_PRECISION_DIGITS / 2 + 1] = {1, 30, 900, 27000, MAX_PRECISION_FACTOR};
+
+// write nrDigits extension characters for fractions qx, qy (0 .. MAX_PRECISION_FACTOR - 1) of a cell;
+// called with a constant nrDigits, so the loop unrolls and the divisions by powers of 30 become multiplications
+ALWAYS_INLINE void encodeExtensionDigits(char *s, const int qx, const int qy, const int nrDigits) {
+    int i;
+    for (i = 0; i < nrDigits; i += 2) {
+        const int power = POWER_OF_30[(MAX_PRECISION_DIGITS - 2 - i) / 2];
+        const int gx = (qx / power) % 30;
+        const int gy = (qy / power) % 30;
+        *s++ = ENCODE_CHARS[(gy / 5) * 5 + (gx / 6)];
+        if (i + 1 < nrDigits) {
+            *s++ = ENCODE_CHARS[(gy % 5) * 6 + (gx % 6)];
+        }
+    }
+    *s = 0; // terminate the result
+}
+
+
 // encode the high-precision extension (0-8 characters)
 static void encodeExtension(char *result, const int extrax4, const int extray, const int dividerx4,
                             const int dividery, int extraDigits, const int ydirection,
@@ -794,12 +908,13 @@ static void encodeExtension(char *result, const int extrax4, const int extray, c
     ASSERT(enc);
     if (extraDigits > 0) { // anything to do?
         char *s = result + strlen(result);
-        double factorx = (double) MAX_PRECISION_FACTOR * dividerx4; // perfect integer!
-        double factory = (double) MAX_PRECISION_FACTOR * dividery; // perfect integer!
-        double valx = ((double) MAX_PRECISION_FACTOR * extrax4) + enc->fraclon; // perfect integer!
-        double valy = ((double) MAX_PRECISION_FACTOR * extray) + (ydirection * enc->fraclat); // perfect integer!
+        const long long factorx = (long long) MAX_PRECISION_FACTOR * dividerx4;
+        const long long factory = (long long) MAX_PRECISION_FACTOR * dividery;
+        long long valx = ((long long) MAX_PRECISION_FACTOR * extrax4) + enc->fraclon;
+        long long valy = ((long long) MAX_PRECISION_FACTOR * extray) + (ydirection * enc->fraclat);
+        int qx, qy;
 
-        // protect against floating Point errors
+        // keep the position within the cell
         if (valx < 0) {
             valx = 0;
         } else if (valx >= factorx) {
@@ -815,45 +930,89 @@ static void encodeExtension(char *result, const int extrax4, const int extray, c
             extraDigits = MAX_PRECISION_DIGITS;
         }
 
-        *s++ = '-';
-
-        for (;;) {
-            int gx, gy;
-
-            factorx /= 30;
-            gx = (int) (valx / factorx);
+        // the position in MAX_PRECISION_FACTOR-ths of the cell: the extension holds its base-30 digits
+        qx = (int) (valx / dividerx4);
+        qy = (int) (valy / dividery);
 
-            factory /= 30;
-            gy = (int) (valy / factory);
-
-            *s++ = ENCODE_CHARS[(gy / 5) * 5 + (gx / 6)];
-            if (--extraDigits == 0) {
+        *s++ = '-';
+        switch (extraDigits) {
+            case 2:
+                encodeExtensionDigits(s, qx, qy, 2);
                 break;
-            }
-
-            *s++ = ENCODE_CHARS[(gy % 5) * 6 + (gx % 6)];
-            if (--extraDigits == 0) {
+            case 4:
+                encodeExtensionDigits(s, qx, qy, 4);
+                break;
+            case 6:
+                encodeExtensionDigits(s, qx, qy, 6);
+                break;
+            case 8:
+                encodeExtensionDigits(s, qx, qy, 8);
+                break;
+            default:
+                encodeExtensionDigits(s, qx, qy, extraDigits);
                 break;
-            }
-
-            valx -= factorx * gx; // for next iteration
-            valy -= factory * gy; // for next iteration
         }
-        *s = 0; // terminate the result
         ASSERT((int) strlen(s) == extraDigits);
     }
 }
 
 
+// base-31 pairs: BASE31_PAIRS[2 * v] and BASE31_PAIRS[2 * v + 1] encode v (0..960) in two characters
+#define BASE31_ROW(c) \
+        c "0" c "1" c "2" c "3" c "4" c "5" c "6" c "7" \
+        c "8" c "9" c "B" c "C" c "D" c "F" c "G" c "H" \
+        c "J" c "K" c "L" c "M" c "N" c "P" c "Q" c "R" \
+        c "S" c "T" c "V" c "W" c "X" c "Y" c "Z"
+static const char BASE31_PAIRS[961 * 2 + 1] =
+        BASE31_ROW("0") BASE31_ROW("1") BASE31_ROW("2") BASE31_ROW("3") BASE31_ROW("4") BASE31_ROW("5")
+        BASE31_ROW("6") BASE31_ROW("7") BASE31_ROW("8") BASE31_ROW("9") BASE31_ROW("B") BASE31_ROW("C")
+        BASE31_ROW("D") BASE31_ROW("F") BASE31_ROW("G") BASE31_ROW("H") BASE31_ROW("J") BASE31_ROW("K")
+        BASE31_ROW("L") BASE31_ROW("M") BASE31_ROW("N") BASE31_ROW("P") BASE31_ROW("Q") BASE31_ROW("R")
+        BASE31_ROW("S") BASE31_ROW("T") BASE31_ROW("V") BASE31_ROW("W") BASE31_ROW("X") BASE31_ROW("Y")
+        BASE31_ROW("Z");
+
+
+// encode 'value' into result[nrchars], two characters at a time;
+// called with a constant nrchars, so the loop unrolls
+ALWAYS_INLINE void encodeBase31Chars(char *result, int value, const int nrchars) {
+    int n = nrchars;
+    result[n] = 0; // zero-terminate!
+    while (n >= 2) {
+        const int pair = 2 * (value % 961);
+        n -= 2;
+        result[n] = BASE31_PAIRS[pair];
+        result[n + 1] = BASE31_PAIRS[pair + 1];
+        value /= 961;
+    }
+    if (n > 0) {
+        result[0] = ENCODE_CHARS[value % 31];
+    }
+}
+
+
 // encode 'value' into result[nrchars]
-static void encodeBase31(char *result, int value, int nrchars) {
+static void encodeBase31(char *result, const int value, const int nrchars) {
     ASSERT(result);
     ASSERT(nrchars >= 0);
-    result[nrchars] = 0; // zero-terminate!
-    while (nrchars > 0) {
-        nrchars--;
-        result[nrchars] = ENCODE_CHARS[value % 31];
-        value /= 31;
+    switch (nrchars) {
+        case 2:
+            encodeBase31Chars(result, value, 2);
+            break;
+        case 3:
+            encodeBase31Chars(result, value, 3);
+            break;
+        case 4:
+            encodeBase31Chars(result, value, 4);
+            break;
+        case 5:
+            encodeBase31Chars(result, value, 5);
+            break;
+        case 6:
+            encodeBase31Chars(result, value, 6);
+            break;
+        default:
+            encodeBase31Chars(result, value, nrchars);
+            break;
     }
 }
 
@@ -863,11 +1022,11 @@ static void encodeTriple(char *result, const int difx, const int dify) {
     if (dify < 4 * 34) // first 4(x34) rows of 6(x28) wide
     {
         *result = ENCODE_CHARS[((difx / 28) + 6 * (dify / 34))];
-        encodeBase31(result + 1, ((difx % 28) * 34 + (dify % 34)), 2);
+        encodeBase31Chars(result + 1, ((difx % 28) * 34 + (dify % 34)), 2);
     } else // bottom row
     {
         *result = ENCODE_CHARS[(difx / 24) + 24];
-        encodeBase31(result + 1, (difx % 24) * 40 + (dify - 136), 2);
+        encodeBase31Chars(result + 1, (difx % 24) * 40 + (dify - 136), 2);
     }
 } // encodeTriple
 
@@ -893,15 +1052,13 @@ static const int Y_SIDE[6] = {0, 6, 31, 176, 961, 176 * 31};
 static const int NC[6] = {1, 31, 961, 29791, 923521, 28629151};
 
 
-// returns *result==0 in case of error
-static void encodeGrid(char *result, const EncodeRec *enc, const int m, const int extraDigits,
-                       const char headerLetter) {
-    const TerritoryBoundary *b = TERRITORY_BOUNDARY(m);
-    const int orgcodex = coDex(m);
+// encodes in grid record b; returns *result==0 in case of error
+ALWAYS_INLINE void encodeGridInBoundary(char *result, const EncodeRec *enc, const TerritoryBoundary *b,
+                                        const int extraDigits, const char headerLetter) {
+    const int orgcodex = CODEX_OF_BOUNDARY(b);
     int codexm;
     ASSERT(result);
     ASSERT(enc);
-    ASSERT((0 <= m) && (m <= MAPCODE_BOUNDARY_MAX));
     ASSERT((0 <= extraDigits) && (extraDigits <= MAX_PRECISION_DIGITS));
     codexm = orgcodex;
     if (codexm == 21) {
@@ -920,7 +1077,7 @@ static void encodeGrid(char *result, const EncodeRec *enc, const int m, const in
         const int prelen = codexm / 10;
         const int postlen = codexm % 10;
 
-        divy = SMART_DIV(m);
+        divy = SMART_DIV_OF_BOUNDARY(b);
         ASSERT(divy > 0);
         if (divy == 1) {
             divx = X_SIDE[prelen];
@@ -1024,22 +1181,42 @@ static void encodeGrid(char *result, const EncodeRec *enc, const int m, const in
 }
 
 
+#ifndef NO_HOT_TERRITORIES
+
+#include "internal_hot_encoders.h"
+
+#endif
+
+// returns *result==0 in case of error
+static void encodeGrid(char *result, const EncodeRec *enc, const int m, const int extraDigits,
+                       const char headerLetter) {
+    ASSERT((0 <= m) && (m < enc->data->nrBoundaries));
+#ifndef NO_HOT_TERRITORIES
+    if (enc->data == &COMPILED_MAPCODE_DATA && encodeHotGrid(result, enc, m, extraDigits, headerLetter)) {
+        return;
+    }
+#endif
+    encodeGridInBoundary(result, enc, TERRITORY_BOUNDARY(enc->data, m), extraDigits, headerLetter);
+}
+
+
 // *result==0 in case of error
 static void encodeNameless(char *result, const EncodeRec *enc, const enum Territory ccode,
                            const int extraDigits, const int m) {
+    const MapcodeData *data = enc->data;
     // determine how many nameless records there are (A), and which one is this (X)...
-    const int A = countNamelessRecords(m, firstRec(ccode));
-    const int X = m - firstNamelessRecord(m, firstRec(ccode));
+    const int A = countNamelessRecords(data, m, firstRec(data, ccode));
+    const int X = m - firstNamelessRecord(data, m, firstRec(data, ccode));
     ASSERT(result);
     ASSERT(enc);
-    ASSERT((0 <= m) && (m <= MAPCODE_BOUNDARY_MAX));
+    ASSERT((0 <= m) && (m < data->nrBoundaries));
     ASSERT((0 <= extraDigits) && (extraDigits <= MAX_PRECISION_DIGITS));
     *result = 0;
 
     {
         const int p = 31 / A;
         const int r = 31 % A; // the first r items are p+1
-        const int codexm = coDex(m);
+        const int codexm = coDex(data, m);
         const int codexlen = (codexm / 10) + (codexm % 10);
         // determine side of square around centre
         int SIDE;
@@ -1072,10 +1249,10 @@ static void encodeNameless(char *result, const EncodeRec *enc, const enum Territ
             storage_offset = X * BASEPOWERA;
         }
 
-        SIDE = SMART_DIV(m);
+        SIDE = SMART_DIV(data, m);
         ASSERT(SIDE > 0);
 
-        b = TERRITORY_BOUNDARY(m);
+        b = TERRITORY_BOUNDARY(data, m);
         orgSIDE = SIDE;
 
         {
@@ -1095,7 +1272,7 @@ static void encodeNameless(char *result, const EncodeRec *enc, const enum Territ
                 extray += dividery;
             }
 
-            if (IS_SPECIAL_SHAPE(m)) {
+            if (IS_SPECIAL_SHAPE(data, m)) {
                 SIDE = 1 + ((b->maxy - b->miny) / 90); // new side, based purely on y-distance
                 xSIDE = (orgSIDE * orgSIDE) / SIDE;
                 v += encodeSixWide(dx, SIDE - 1 - dy, xSIDE, SIDE);
@@ -1113,7 +1290,7 @@ static void encodeNameless(char *result, const EncodeRec *enc, const enum Territ
                 result[dotp - 1] = '.';
             }
 
-            if (!IS_SPECIAL_SHAPE(m)) {
+            if (!IS_SPECIAL_SHAPE(data, m)) {
                 if (codexm == 22 && A < 62 && orgSIDE == 961) {
                     const char t = result[codexlen - 2];
                     result[codexlen - 2] = result[codexlen];
@@ -1132,6 +1309,7 @@ static void encodeNameless(char *result, const EncodeRec *enc, const enum Territ
 
 // encode in m (known to fit)
 static void encodeAutoHeader(char *result, const EncodeRec *enc, const int m, const int extraDigits) {
+    const MapcodeData *data = enc->data;
     int i;
     int STORAGE_START = 0;
     int W, H, xdiv, product;
@@ -1139,19 +1317,19 @@ static void encodeAutoHeader(char *result, const EncodeRec *enc, const int m, co
 
     // search back to first of the group
     int firstindex = m;
-    const int codexm = coDex(m);
+    const int codexm = coDex(data, m);
     ASSERT(result);
     ASSERT(enc);
-    ASSERT((1 <= m) && (m <= MAPCODE_BOUNDARY_MAX));
+    ASSERT((1 <= m) && (m < data->nrBoundaries));
     ASSERT((0 <= extraDigits) && (extraDigits <= MAX_PRECISION_DIGITS));
 
-    while (REC_TYPE(firstindex - 1) > 1 && coDex(firstindex - 1) == codexm) {
+    while (REC_TYPE(data, firstindex - 1) > 1 && coDex(data, firstindex - 1) == codexm) {
         firstindex--;
     }
 
     i = firstindex;
     for (;;) {
-        b = TERRITORY_BOUNDARY(i);
+        b = TERRITORY_BOUNDARY(data, i);
         // determine how many cells
         H = (b->maxy - b->miny + 89) / 90; // multiple of 10m
         xdiv = xDivider4(b->miny, b->maxy);
@@ -1161,7 +1339,7 @@ static void encodeAutoHeader(char *result, const EncodeRec *enc, const int m, co
         H = 176 * ((H + 176 - 1) / 176);
         W = 168 * ((W + 168 - 1) / 168);
         product = (W / 168) * (H / 176) * 961 * 31;
-        if (REC_TYPE(i) == 2) { // plus pipe
+        if (REC_TYPE(data, i) == 2) { // plus pipe
             const int GOODROUNDER = codexm >= 23 ? (961 * 961 * 31) : (961 * 961);
             product = ((STORAGE_START + product + GOODROUNDER - 1) / GOODROUNDER) * GOODROUNDER - STORAGE_START;
         }
@@ -1199,8 +1377,54 @@ static void encodeAutoHeader(char *result, const EncodeRec *enc, const int m, co
 }
 
 
+// add result, in territory ccode, to the mapcodes of enc
+static void addEncodeResult(const EncodeRec *enc, const enum Territory ccode, const char *result) {
+    if (*result && enc->mapcodes && (enc->mapcodes->count < MAX_NR_OF_MAPCODE_RESULTS)) {
+        char *s = enc->mapcodes->mapcode[enc->mapcodes->count++];
+        if (ccode == TERRITORY_AAA) { // AAA is never shown with territory
+            strcpy(s, result);
+        } else {
+            getTerritoryIsoName(s, ccode, 0);
+            strcat(s, " ");
+            strcat(s, result);
+        }
+    }
+}
+
+
+static void encoderEngine(const enum Territory ccode, const EncodeRec *enc, const int stop_with_one_result,
+                          const int extraDigits, const int requiredEncoder, const enum Territory ccode_override);
+
+
+// encode subdivision ccode with the records of its parent; reuses the results of the parent if enc->parentResults
+// holds them (only when all results are requested, as the parent is then always encoded completely)
+static void encodeWithParent(const enum Territory ccode, const EncodeRec *enc, const int stop_with_one_result,
+                             const int extraDigits, const int requiredEncoder) {
+    const enum Territory parent = parentTerritoryOf(enc->data, ccode);
+    ParentResults *parentResults = enc->parentResults;
+    if (!parentResults || stop_with_one_result || (requiredEncoder >= 0)) {
+        encoderEngine(parent, enc, stop_with_one_result, extraDigits, requiredEncoder, ccode);
+    } else if (parentResults->parent == parent) {
+        int i;
+        for (i = 0; i < parentResults->count; i++) {
+            addEncodeResult(enc, ccode, parentResults->result[i]);
+        }
+    } else {
+        // encode the parent, collecting its results (see encoderEngine)
+        parentResults->parent = TERRITORY_NONE;
+        parentResults->count = 0;
+        parentResults->overflow = 0;
+        encoderEngine(parent, enc, stop_with_one_result, extraDigits, requiredEncoder, ccode);
+        if (!parentResults->overflow) {
+            parentResults->parent = parent;
+        }
+    }
+}
+
+
 static void encoderEngine(const enum Territory ccode, const EncodeRec *enc, const int stop_with_one_result,
                           const int extraDigits, const int requiredEncoder, const enum Territory ccode_override) {
+    const MapcodeData *data = enc->data;
     int from;
     int upto;
     ASSERT(enc);
@@ -1210,10 +1434,10 @@ static void encoderEngine(const enum Territory ccode, const EncodeRec *enc, cons
         return;
     } // bad arguments
 
-    from = firstRec(ccode);
-    upto = lastRec(ccode);
+    from = firstRec(data, ccode);
+    upto = lastRec(data, ccode);
 
-    if (!fitsInsideBoundaries(&enc->coord32, TERRITORY_BOUNDARY(upto))) {
+    if (!fitsInsideBoundaries(&enc->coord32, TERRITORY_BOUNDARY(data, upto))) {
         return;
     }
 
@@ -1224,25 +1448,38 @@ static void encoderEngine(const enum Territory ccode, const EncodeRec *enc, cons
         int i;
         char result[128];
         int result_counter = 0;
+#ifndef NO_HOT_TERRITORIES
+        const int hot = (data == &COMPILED_MAPCODE_DATA) && isHotTerritory(ccode, from);
+#else
+        const int hot = 0;
+#endif
 
         *result = 0;
         for (i = from; i <= upto; i++) {
-            if (fitsInsideBoundaries(&enc->coord32, TERRITORY_BOUNDARY(i))) {
-                if (IS_NAMELESS(i)) {
+#ifndef NO_HOT_TERRITORIES
+            if (hot) {
+                // skip to the next record that contains the coordinate
+                i = nextHotRecord(&enc->coord32, i);
+                if (i > upto) {
+                    break;
+                }
+            }
+#endif
+            if (hot || fitsInsideBoundaries(&enc->coord32, TERRITORY_BOUNDARY(data, i))) {
+                if (IS_NAMELESS(data, i)) {
                     encodeNameless(result, enc, ccode, extraDigits, i);
-                } else if (REC_TYPE(i) > 1) {
+                } else if (REC_TYPE(data, i) > 1) {
                     encodeAutoHeader(result, enc, i, extraDigits);
-                } else if ((i == upto) && isSubdivision(ccode)) {
+                } else if ((i == upto) && isSubdivision(data, ccode)) {
                     // *** do a recursive call for the parent ***
-                    encoderEngine(parentTerritoryOf(ccode), enc, stop_with_one_result, extraDigits, requiredEncoder,
-                                  ccode);
+                    encodeWithParent(ccode, enc, stop_with_one_result, extraDigits, requiredEncoder);
                     return;
                 } else // must be grid
                 {
                     // skip IS_RESTRICTED records unless there already is a result
-                    if (result_counter || !IS_RESTRICTED(i)) {
-                        if (coDex(i) < 54) {
-                            char headerletter = (char) ((REC_TYPE(i) == 1) ? HEADER_LETTER(i) : 0);
+                    if (result_counter || !IS_RESTRICTED(data, i)) {
+                        if (coDex(data, i) < 54) {
+                            char headerletter = (char) ((REC_TYPE(data, i) == 1) ? HEADER_LETTER(data, i) : 0);
                             encodeGrid(result, enc, i, extraDigits, headerletter);
                         }
                     }
@@ -1255,16 +1492,19 @@ static void encoderEngine(const enum Territory ccode, const EncodeRec *enc, cons
                     repackIfAllDigits(result, 0);
 
                     if ((requiredEncoder < 0) || (requiredEncoder == i)) {
-                        const enum Territory ccodeFinal = (ccode_override != TERRITORY_NONE ? ccode_override : ccode);
-                        if (*result && enc->mapcodes && (enc->mapcodes->count < MAX_NR_OF_MAPCODE_RESULTS)) {
-                            char *s = enc->mapcodes->mapcode[enc->mapcodes->count++];
-                            if (ccodeFinal == TERRITORY_AAA) { // AAA is never shown with territory
-                                strcpy(s, result);
-                            } else {
-                                getTerritoryIsoName(s, ccodeFinal, 0);
-                                strcat(s, " ");
-                                strcat(s, result);
+                        if (ccode_override != TERRITORY_NONE) {
+                            ParentResults *parentResults = enc->parentResults;
+                            if (parentResults && (parentResults->parent == TERRITORY_NONE)) {
+                                // collect the results of the parent for its other subdivisions
+                                if (parentResults->count < MAX_NR_OF_MAPCODE_RESULTS) {
+                                    strcpy(parentResults->result[parentResults->count++], result);
+                                } else {
+                                    parentResults->overflow = 1;
+                                }
                             }
+                            addEncodeResult(enc, ccode_override, result);
+                        } else {
+                            addEncodeResult(enc, ccode, result);
                         }
                         if (requiredEncoder == i) {
                             return;
@@ -1283,11 +1523,19 @@ static void encoderEngine(const enum Territory ccode, const EncodeRec *enc, cons
 
 // pass Point to an array of pointers (at least 42), will be made to Point to result strings...
 // returns nr of results;
-static int encodeLatLonToMapcodes_internal(Mapcodes *mapcodes,
+static int encodeLatLonToMapcodes_internal(const MapcodeData *data, Mapcodes *mapcodes,
                                            const double lat, const double lon,
                                            const enum Territory territoryContext, const int stop_with_one_result,
                                            const int requiredEncoder, const int extraDigits) {
     EncodeRec enc;
+#ifndef NO_PARENT_RESULT_REUSE
+    ParentResults parentResults;
+    parentResults.parent = TERRITORY_NONE;
+    enc.parentResults = &parentResults;
+#else
+    enc.parentResults = NULL;
+#endif
+    enc.data = data;
     enc.mapcodes = mapcodes;
     enc.mapcodes->count = 0;
     ASSERT(mapcodes);
@@ -1304,13 +1552,14 @@ static int encodeLatLonToMapcodes_internal(Mapcodes *mapcodes,
         {
             const int sum = enc.coord32.lonMicroDeg + enc.coord32.latMicroDeg;
             int coord = enc.coord32.lonMicroDeg;
-            int i = 0; // pointer into REDIVAR
+            const int *redivar = data->redivar;
+            int i = 0; // pointer into redivar
             for (;;) {
-                const int r = REDIVAR[i++];
+                const int r = redivar[i++];
                 if (r >= 0 && r < 1024) { // leaf?
                     int j;
                     for (j = 0; j <= r; j++) {
-                        const enum Territory ccode = (j == r ? TERRITORY_AAA : (enum Territory) REDIVAR[i + j]);
+                        const enum Territory ccode = (j == r ? TERRITORY_AAA : (enum Territory) redivar[i + j]);
                         encoderEngine(ccode, &enc, stop_with_one_result, extraDigits, requiredEncoder, TERRITORY_NONE);
                         if ((stop_with_one_result || (requiredEncoder >= 0)) && (enc.mapcodes->count > 0)) {
                             break;
@@ -1320,7 +1569,7 @@ static int encodeLatLonToMapcodes_internal(Mapcodes *mapcodes,
                 } else {
                     coord = sum - coord;
                     if (coord > r) {
-                        i = REDIVAR[i];
+                        i = redivar[i];
                     } else {
                         i++;
                     }
@@ -1353,6 +1602,7 @@ static int encodeLatLonToMapcodes_internal(Mapcodes *mapcodes,
 
 typedef struct {
     // input
+    const MapcodeData *data;
     MapcodeElements mapcodeElements;
     const char *orginput;   // original full input string
     const char *mapcode;    // input mapcode (first character of proper mapcode excluding territory code)
@@ -1363,9 +1613,34 @@ typedef struct {
     Point result;           // result
     Point32 coord32;        // result in integer arithmetic (microdegrees)
     MapcodeZone zone;       // result zone (in "DegreeFractions")
+    enum Territory territory; // territory the mapcode was decoded in (the parent, for codes of a subdivision's parent)
 } DecodeRec;
 
 
+// decode nrDigits extension characters into the base-30 digits *lon32, *lat32 (see encodeExtensionDigits);
+// called with a constant nrDigits, so the loop unrolls
+ALWAYS_INLINE enum MapcodeError decodeExtensionDigits(const char *extension, int *lon32, int *lat32,
+                                                      const int nrDigits) {
+    int i;
+    for (i = 0; i < nrDigits; i += 2) {
+        const int c1 = decodeChar(extension[i]);
+        int c2 = 0; // an odd last character stands for row and column 0
+        if (c1 < 0 || c1 == 30) {
+            return ERR_EXTENSION_INVALID_CHARACTER;
+        } // illegal extension character
+        if (i + 1 < nrDigits) {
+            c2 = decodeChar(extension[i + 1]);
+            if (c2 < 0 || c2 == 30) {
+                return ERR_EXTENSION_INVALID_CHARACTER;
+            } // illegal extension character
+        }
+        *lon32 = *lon32 * 30 + (c1 % 5) * 6 + (c2 % 6);
+        *lat32 = *lat32 * 30 + (c1 / 5) * 5 + (c2 / 6);
+    }
+    return ERR_OK;
+}
+
+
 // decode the high-precision extension (0-8 characters)
 // this routine takes the integer-arithmeteic decoding results (dec->coord32), adds precision, 
 // and determines result zone (dec->zone); returns negative in case of error.
@@ -1374,47 +1649,43 @@ static enum MapcodeError decodeExtension(DecodeRec *dec,
                                          const int lon_offset4,
                                          const int extremeLat32, const int maxLon32) {
     double lat1, lon4;
-    const char *extrapostfix = dec->extension;
+    const int nrDigits = (int) strlen(dec->extension);
+    const int odd = (nrDigits & 1);
     int lon32 = 0;
     int lat32 = 0;
-    int processor = 1;
-    int odd = 0;
+    enum MapcodeError err;
     ASSERT(dec);
-    if (strlen(extrapostfix) > MAX_PRECISION_DIGITS) {
+    if (nrDigits > MAX_PRECISION_DIGITS) {
         return ERR_EXTENSION_INVALID_LENGTH;
     }
-    while (*extrapostfix) {
-        int column1, row1, column2, row2;
-        const int c1 = decodeChar(*extrapostfix++);
-        if (c1 < 0 || c1 == 30) {
-            return ERR_EXTENSION_INVALID_CHARACTER;
-        } // illegal extension character
-        row1 = (c1 / 5);
-        column1 = (c1 % 5);
-        if (*extrapostfix) {
-            const int c2 = decodeChar(*extrapostfix++);
-            if (c2 < 0 || c2 == 30) {
-                return ERR_EXTENSION_INVALID_CHARACTER;
-            } // illegal extension character
-            row2 = (c2 / 6);
-            column2 = (c2 % 6);
-        } else {
-            odd = 1;
-            row2 = 0;
-            column2 = 0;
-        }
-
-        processor *= 30;
-        lon32 = lon32 * 30 + column1 * 6 + column2;
-        lat32 = lat32 * 30 + row1 * 5 + row2;
+    switch (nrDigits) {
+        case 0:
+            err = ERR_OK;
+            break;
+        case 2:
+            err = decodeExtensionDigits(dec->extension, &lon32, &lat32, 2);
+            break;
+        case 4:
+            err = decodeExtensionDigits(dec->extension, &lon32, &lat32, 4);
+            break;
+        case 6:
+            err = decodeExtensionDigits(dec->extension, &lon32, &lat32, 6);
+            break;
+        case 8:
+            err = decodeExtensionDigits(dec->extension, &lon32, &lat32, 8);
+            break;
+        default:
+            err = decodeExtensionDigits(dec->extension, &lon32, &lat32, nrDigits);
+            break;
     }
-
-    while (processor < MAX_PRECISION_FACTOR) {
-        dividerx4 *= 30;
-        dividery *= 30;
-        processor *= 30;
+    if (err) {
+        return err;
     }
 
+    // scale the dividers to the remaining digits
+    dividerx4 *= POWER_OF_30[(MAX_PRECISION_DIGITS - nrDigits) / 2];
+    dividery *= POWER_OF_30[(MAX_PRECISION_DIGITS - nrDigits) / 2];
+
     lon4 = (dec->coord32.lonMicroDeg * 4 * (double) MAX_PRECISION_FACTOR) + ((lon32 * (double) dividerx4)) +
            (lon_offset4 * (double) MAX_PRECISION_FACTOR);
     lat1 = (dec->coord32.latMicroDeg * (double) MAX_PRECISION_FACTOR) + ((lat32 * (double) dividery));
@@ -1457,6 +1728,41 @@ static int decodeBase31(const char *code) {
 }
 
 
+// decode the first nrchars characters of 'code', two characters at a time;
+// called with a constant nrchars, so the loop unrolls
+ALWAYS_INLINE int decodeBase31Chars(const char *code, const int nrchars) {
+    int value = 0;
+    int i = 0;
+    if (nrchars & 1) {
+        value = decodeChar(code[0]);
+        i = 1;
+    }
+    for (; i < nrchars; i += 2) {
+        value = value * 961 + decodeChar(code[i]) * 31 + decodeChar(code[i + 1]);
+    }
+    return value;
+}
+
+
+// decode 'code' of nrchars characters (the same as decodeBase31 if a dot or end-of-string follows them)
+static int decodeBase31OfLength(const char *code, const int nrchars) {
+    ASSERT(code);
+    ASSERT((int) strlen(code) >= nrchars);
+    switch (nrchars) {
+        case 2:
+            return decodeBase31Chars(code, 2);
+        case 3:
+            return decodeBase31Chars(code, 3);
+        case 4:
+            return decodeBase31Chars(code, 4);
+        case 5:
+            return decodeBase31Chars(code, 5);
+        default:
+            return decodeBase31Chars(code, nrchars);
+    }
+}
+
+
 static void decodeTriple(const char *result, int *difx, int *dify) {
     // decode the first character
     const int c1 = decodeChar(*result++);
@@ -1464,12 +1770,12 @@ static void decodeTriple(const char *result, int *difx, int *dify) {
     ASSERT(difx);
     ASSERT(dify);
     if (c1 < 24) {
-        int m = decodeBase31(result);
+        int m = decodeBase31Chars(result, 2);
         *difx = (c1 % 6) * 28 + (m / 34);
         *dify = (c1 / 6) * 34 + (m % 34);
     } else // bottom row
     {
-        int x = decodeBase31(result);
+        int x = decodeBase31Chars(result, 2);
         *dify = (x % 40) + 136;
         *difx = (x / 40) + 24 * (c1 - 24);
     }
@@ -1495,8 +1801,9 @@ static void decodeSixWide(const int v, const int width, const int height,
 
 // *** mid-level encode routines ***
 
-// decodes dec->mapcode in context of territory rectangle m; returns negative if error
-static enum MapcodeError decodeGrid(DecodeRec *dec, const int m, const int hasHeaderLetter) {
+// decodes dec->mapcode in context of grid record b; returns negative if error
+ALWAYS_INLINE enum MapcodeError decodeGridInBoundary(DecodeRec *dec, const TerritoryBoundary *b,
+                                                     const int hasHeaderLetter) {
     const char *input = (hasHeaderLetter ? dec->mapcode + 1 : dec->mapcode);
     const int codexlen = (int) (strlen(input) - 1);
     int prelen = (int) (strchr(input, '.') - input);
@@ -1522,7 +1829,7 @@ static enum MapcodeError decodeGrid(DecodeRec *dec, const int m, const int hasHe
 
         int divx, divy;
 
-        divy = SMART_DIV(m);
+        divy = SMART_DIV_OF_BOUNDARY(b);
         ASSERT(divy > 0);
         if (divy == 1) {
             divx = X_SIDE[prelen];
@@ -1539,7 +1846,7 @@ static enum MapcodeError decodeGrid(DecodeRec *dec, const int m, const int hasHe
 
         {
             int relx, rely;
-            int v = decodeBase31(result);
+            int v = decodeBase31OfLength(result, prelen);
 
             if (divx != divy && prelen > 2) {
                 // special grid, useful when prefix is 3 or more, and not a nice 961x961
@@ -1555,7 +1862,6 @@ static enum MapcodeError decodeGrid(DecodeRec *dec, const int m, const int hasHe
 
 
             {
-                const TerritoryBoundary *b = TERRITORY_BOUNDARY(m);
                 const int ygridsize = (b->maxy - b->miny + divy - 1) / divy; // microdegrees per cell
                 const int xgridsize = (b->maxx - b->minx + divx - 1) / divx; // microdegrees per cell
 
@@ -1583,7 +1889,7 @@ static enum MapcodeError decodeGrid(DecodeRec *dec, const int m, const int hasHe
                                 r[1] = r[2];
                                 r[2] = t;
                             } // swap
-                            v = decodeBase31(r);
+                            v = decodeBase31OfLength(r, postlen);
                             difx = (v / yp);
                             dify = (v % yp);
                             if (postlen == 4) {
@@ -1598,7 +1904,7 @@ static enum MapcodeError decodeGrid(DecodeRec *dec, const int m, const int hasHe
 
                         dec->coord32.lonMicroDeg = relx + (difx * dividerx);
                         dec->coord32.latMicroDeg = rely + (dify * dividery);
-                        if (!fitsInsideBoundaries(&dec->coord32, TERRITORY_BOUNDARY(m))) {
+                        if (!fitsInsideBoundaries(&dec->coord32, b)) {
                             return ERR_MAPCODE_UNDECODABLE; // type 2 "NLD Q000.000"
                         }
 
@@ -1615,15 +1921,37 @@ static enum MapcodeError decodeGrid(DecodeRec *dec, const int m, const int hasHe
 }
 
 
+#ifndef NO_HOT_TERRITORIES
+
+#include "internal_hot_decoders.h"
+
+#endif
+
+// decodes dec->mapcode in context of territory rectangle m; returns negative if error
+static enum MapcodeError decodeGrid(DecodeRec *dec, const int m, const int hasHeaderLetter) {
+    ASSERT((0 <= m) && (m < dec->data->nrBoundaries));
+#ifndef NO_HOT_TERRITORIES
+    if (dec->data == &COMPILED_MAPCODE_DATA) {
+        enum MapcodeError err;
+        if (decodeHotGrid(&err, dec, m, hasHeaderLetter)) {
+            return err;
+        }
+    }
+#endif
+    return decodeGridInBoundary(dec, TERRITORY_BOUNDARY(dec->data, m), hasHeaderLetter);
+}
+
+
 // decodes dec->mapcode in context of territory rectangle m, territory dec->context
 // Returns negative in case of error
 static enum MapcodeError decodeNameless(DecodeRec *dec, int m) {
+    const MapcodeData *data = dec->data;
     int A, F;
     char input[8];
-    const int codexm = coDex(m);
+    const int codexm = coDex(data, m);
     const int codexlen = (int) (strlen(dec->mapcode) - 1);
     ASSERT(dec);
-    ASSERT((0 <= m) && (m <= MAPCODE_BOUNDARY_MAX));
+    ASSERT((0 <= m) && (m < data->nrBoundaries));
     if (codexlen != 4 && codexlen != 5) {
         return ERR_BAD_MAPCODE_LENGTH;
     } // solve bad args
@@ -1635,8 +1963,8 @@ static enum MapcodeError decodeNameless(DecodeRec *dec, int m) {
         strcpy(input + dc, dec->mapcode + dc + 1);
     }
 
-    A = countNamelessRecords(m, firstRec(dec->context));
-    F = firstNamelessRecord(m, firstRec(dec->context));
+    A = countNamelessRecords(data, m, firstRec(data, dec->context));
+    F = firstNamelessRecord(data, m, firstRec(data, dec->context));
 
     {
         const int p = 31 / A;
@@ -1688,7 +2016,7 @@ static enum MapcodeError decodeNameless(DecodeRec *dec, int m) {
 
 
         if (swapletters) {
-            if (!IS_SPECIAL_SHAPE(F + X)) {
+            if (!IS_SPECIAL_SHAPE(data, F + X)) {
                 const char t = result[codexlen - 3];
                 result[codexlen - 3] = result[codexlen - 2];
                 result[codexlen - 2] = t;
@@ -1712,17 +2040,17 @@ static enum MapcodeError decodeNameless(DecodeRec *dec, int m) {
 
         m = (F + X);
 
-        SIDE = SMART_DIV(m);
+        SIDE = SMART_DIV(data, m);
         ASSERT(SIDE > 0);
         xSIDE = SIDE;
 
-        b = TERRITORY_BOUNDARY(m);
+        b = TERRITORY_BOUNDARY(data, m);
 
         // decode
         {
             int dx, dy;
 
-            if (IS_SPECIAL_SHAPE(m)) {
+            if (IS_SPECIAL_SHAPE(data, m)) {
                 xSIDE *= SIDE;
                 SIDE = 1 + ((b->maxy - b->miny) / 90); // side purely on y range
                 xSIDE = xSIDE / SIDE;
@@ -1756,13 +2084,14 @@ static enum MapcodeError decodeNameless(DecodeRec *dec, int m) {
 
 // decodes dec->mapcode in context of territory rectangle m or one of its mates
 static enum MapcodeError decodeAutoHeader(DecodeRec *dec, int m) {
+    const MapcodeData *data = dec->data;
     const char *input = dec->mapcode;
-    const int codexm = coDex(m);
+    const int codexm = coDex(data, m);
     const char *dot = strchr(input, '.');
     int STORAGE_START = 0;
     int value;
     ASSERT(dec);
-    ASSERT((0 <= m) && (m <= MAPCODE_BOUNDARY_MAX));
+    ASSERT((0 <= m) && (m < data->nrBoundaries));
     if (dot == NULL) {
         return ERR_DOT_MISSING;
     }
@@ -1770,8 +2099,8 @@ static enum MapcodeError decodeAutoHeader(DecodeRec *dec, int m) {
     value = decodeBase31(input); // decode top
     value *= (961 * 31);
 
-    for (; coDex(m) == codexm && REC_TYPE(m) > 1; m++) {
-        const TerritoryBoundary *b = TERRITORY_BOUNDARY(m);
+    for (; coDex(data, m) == codexm && REC_TYPE(data, m) > 1; m++) {
+        const TerritoryBoundary *b = TERRITORY_BOUNDARY(data, m);
         // determine how many cells
         int H = (b->maxy - b->miny + 89) / 90; // multiple of 10m
         const int xdiv = xDivider4(b->miny, b->maxy);
@@ -1783,7 +2112,7 @@ static enum MapcodeError decodeAutoHeader(DecodeRec *dec, int m) {
         W = 168 * ((W + 168 - 1) / 168);
         product = (W / 168) * (H / 176) * 961 * 31;
 
-        if (REC_TYPE(m) == 2) {
+        if (REC_TYPE(data, m) == 2) {
             const int GOODROUNDER = codexm >= 23 ? (961 * 961 * 31) : (961 * 961);
             product = ((STORAGE_START + product + GOODROUNDER - 1) / GOODROUNDER) * GOODROUNDER - STORAGE_START;
         }
@@ -1821,6 +2150,52 @@ static enum MapcodeError decodeAutoHeader(DecodeRec *dec, int m) {
     return ERR_MAPCODE_UNDECODABLE; // type 6 "ASM zz.zzh"
 }
 
+
+static int compareRecordNumber(const void *e1, const void *e2) {
+    ASSERT(e1);
+    ASSERT(e2);
+    return *(const int *) e1 - *(const int *) e2;
+}
+
+
+// returns the (ascending) non-restricted records that may overlap zone z, decoded in restricted record m,
+// or NULL if z is not confined to a single cell of the precomputed index (the caller must try all records)
+static const unsigned short *getRestrictedOverlaps(const MapcodeData *data, const int m, const MapcodeZone *z,
+                                                   int *nrOverlaps) {
+    const int *p;
+    ASSERT(z);
+    ASSERT(nrOverlaps);
+    ASSERT((0 <= m) && (m < data->nrBoundaries));
+    p = (const int *) bsearch(&m, data->restrictedRec, (size_t) data->nrRestrictedRecs, sizeof(int),
+                              compareRecordNumber);
+    if (p) {
+        // an empty zone overlaps nothing, so only its midpoint needs to be covered
+        MapcodeZone cover;
+        const TerritoryBoundary *b = TERRITORY_BOUNDARY(data, m);
+        const int cellx = (b->maxx - b->minx + RESTRICTED_OVERLAPS_GRID - 1) / RESTRICTED_OVERLAPS_GRID;
+        const int celly = (b->maxy - b->miny + RESTRICTED_OVERLAPS_GRID - 1) / RESTRICTED_OVERLAPS_GRID;
+        int minx, maxx, miny, maxy;
+        zoneCopyFrom(&cover, z);
+        if (isEmpty(z)) {
+            const Point mid = getMidPointFractions(z);
+            cover.fminx = cover.fmaxx = mid.lon;
+            cover.fminy = cover.fmaxy = mid.lat;
+        }
+        minx = (int) floor(cover.fminx / MICROLON_TO_FRACTIONS_FACTOR) - b->minx;
+        maxx = (int) floor(cover.fmaxx / MICROLON_TO_FRACTIONS_FACTOR) - b->minx;
+        miny = (int) floor(cover.fminy / MICROLAT_TO_FRACTIONS_FACTOR) - b->miny;
+        maxy = (int) floor(cover.fmaxy / MICROLAT_TO_FRACTIONS_FACTOR) - b->miny;
+        if ((minx >= 0) && (miny >= 0) && (minx / cellx == maxx / cellx) && (miny / celly == maxy / celly) &&
+            (minx / cellx < RESTRICTED_OVERLAPS_GRID) && (miny / celly < RESTRICTED_OVERLAPS_GRID)) {
+            const int cell = (int) (p - data->restrictedRec) * RESTRICTED_OVERLAPS_GRID * RESTRICTED_OVERLAPS_GRID +
+                             (miny / celly) * RESTRICTED_OVERLAPS_GRID + (minx / cellx);
+            *nrOverlaps = data->restrictedOverlapStart[cell + 1] - data->restrictedOverlapStart[cell];
+            return &data->restrictedOverlap[data->restrictedOverlapStart[cell]];
+        }
+    }
+    return NULL;
+}
+
 /**
  * ROMAN / ABJAD
  *
@@ -1836,10 +2211,104 @@ static unsigned char getRomanVersionOf(UWORD w) {
 }
 
 
+// Abjad conversion moves the characters of a mapcode around depending on its form: 10 times the position
+// of the dot plus the number of characters after the dot (e.g. "49.4V" has form 22). The conversion of
+// each form is a template of the result: '0'-'9' and 'A' copy that character of the source, '.' is a dot
+// and 'a'-'d' are the characters that encode the code c of the form (see applyAbjadTemplate).
+#define ABJAD_MIN_FORM 22
+#define ABJAD_MAX_FORM 55
+#define MAX_ABJAD_TEMPLATE_LEN 11
+
+typedef struct {
+    signed char onlyIfThreeLetters; // form is only converted with more than 2 non-digits in a row
+    signed char encoding;           // ABJAD_OCTAL, ABJAD_DECIMAL (c + bias) or ABJAD_TRIPLE
+    signed char bias;
+    const char *abjadTemplate;      // NULL if the form is not converted
+} AbjadEncodeForm;
+
+#define ABJAD_OCTAL 0   // c1 = 2 + c / 8, c2 = 2 + c % 8
+#define ABJAD_DECIMAL 1 // c1 = (c + bias) / 10, c2 = (c + bias) % 10
+#define ABJAD_TRIPLE 2  // c is combined with the last character, c1 c2 c3 are its decimal digits
+
+// conversion to abjad per form: 'a' = c1, 'b' = c2, 'c' = c3 and 'd' = c1 + 4
+static const AbjadEncodeForm ABJAD_ENCODE_FORMS[ABJAD_MAX_FORM - ABJAD_MIN_FORM + 1] = {
+        {1, ABJAD_OCTAL, 0, "012ab4"},          // 22: s0 s1 . s3 s4 -> s0 s1 . C1 C2 s4
+        {0, ABJAD_OCTAL, 0, "012ab45"},         // 23: s0 s1 . s3 s4 s5 -> s0 s1 . C1 C2 s4 s5
+        {0, ABJAD_DECIMAL, 7, "01a.4b56"},      // 24: s0 s1 . s3 s4 s5 s6 -> s0 s1 C1 . s4 C2 s5 s6
+        {0, 0, 0, NULL}, {0, 0, 0, NULL}, {0, 0, 0, NULL}, {0, 0, 0, NULL},
+        {0, 0, 0, NULL}, {0, 0, 0, NULL}, {0, 0, 0, NULL},
+        {1, ABJAD_OCTAL, 0, "01.db45"},         // 32: s0 s1 s2 . s4 s5 -> s0 s1 . C* C2 s4 s5
+        {1, ABJAD_DECIMAL, 38, "01a.4b56"},     // 33: s0 s1 s2 . s4 s5 s6 -> s0 s1 C1 . s4 C2 s5 s6
+        {0, ABJAD_OCTAL, 0, "01a345b67"},       // 34: s0 s1 s2 . s4 s5 s6 s7 -> s0 s1 C1 . s4 s5 C2 s6 s7
+        {0, 0, 0, NULL}, {0, 0, 0, NULL}, {0, 0, 0, NULL}, {0, 0, 0, NULL},
+        {0, 0, 0, NULL}, {0, 0, 0, NULL}, {0, 0, 0, NULL},
+        {1, ABJAD_DECIMAL, 69, "01a.3b56"},     // 42: s0 s1 s2 s3 . s5 s6 -> s0 s1 C1 . s3 C2 s5 s6
+        {1, ABJAD_OCTAL, 0, "01d.35b67"},       // 43: s0 s1 s2 s3 . s5 s6 s7 -> s0 s1 C* . s3 s5 C2 s6 s7
+        {1, ABJAD_TRIPLE, 0, "01a34b56c7"},     // 44: s0 s1 s2 s3 . s5 s6 s7 s8 -> s0 s1 C1 s3 . C2 s5 s6 C3 s7
+        {0, 0, 0, NULL}, {0, 0, 0, NULL}, {0, 0, 0, NULL}, {0, 0, 0, NULL},
+        {0, 0, 0, NULL}, {0, 0, 0, NULL}, {0, 0, 0, NULL}, {0, 0, 0, NULL}, {0, 0, 0, NULL},
+        {1, ABJAD_TRIPLE, 0, "01a345b67c8"},    // 54: s0..s4 . s6 s7 s8 s9 -> s0 s1 C1 s3 s4 . C2 s6 s7 C3 s8
+        {0, 0, 0, NULL}                         // 55
+};
+
+typedef struct {
+    signed char codePos[3];     // characters that encode c, most significant first (codePos[2] < 0 if 2)
+    signed char radix;          // c = ((s[codePos[0]] * radix) + s[codePos[1]]) * radix + s[codePos[2]] - bias
+    signed char bias;
+    short limit;                // the form is only converted if 0 <= c < limit
+    short from[3];              // the first template with c >= from[i] is used...
+    const char *abjadTemplate[3];
+} AbjadDecodeForm;
+
+// conversion from abjad: 'a' = ENCODE_CHARS[c - from], 'b' = ENCODE_CHARS[c / 31], 'c' = ENCODE_CHARS[c % 31]
+static const AbjadDecodeForm ABJAD_DECODE_FORMS[] = {
+        {{3, 4, -1}, 8, 18, 31, {0, 0, 0}, {"012a5", NULL, NULL}},                                // 23
+        {{3, 4, -1}, 8, 18, 63, {32, 0, 0}, {"01a.56", "012a56", NULL}},                          // 24
+        {{2, 5, -1}, 10, 7, 93, {62, 31, 0}, {"01a4.67", "01a3467", "01.a467"}},                  // 34
+        {{2, 6, -1}, 8, 18, 63, {32, 0, 0}, {"01a4.578", "01a34578", NULL}},                      // 35
+        {{2, 5, 8}, 10, 39, 961, {0, 0, 0}, {"01b34679c", NULL, NULL}},                           // 45
+        {{2, 6, 9}, 10, 39, 961, {0, 0, 0}, {"01b34578Ac", NULL, NULL}}                           // 55
+};
+
+// index in ABJAD_DECODE_FORMS per form, negative if the form is not converted
+static const signed char ABJAD_DECODE_FORM_INDEX[ABJAD_MAX_FORM - ABJAD_MIN_FORM + 1] = {
+        -1, 0, 1, -1, -1, -1, -1, -1, -1, -1,   // 22..31
+        -1, -1, 2, 3, -1, -1, -1, -1, -1, -1,   // 32..41
+        -1, -1, -1, 4, -1, -1, -1, -1, -1, -1,  // 42..51
+        -1, -1, -1, 5                           // 52..55
+};
+
+
+// PRIVATE - writes the characters of abjadTemplate (taken from source or codes) to target; returns the length
+static int applyAbjadTemplate(char *target, const char *source, const char *abjadTemplate, const char *codes) {
+    int len = 0;
+    ASSERT(abjadTemplate);
+    for (; *abjadTemplate; abjadTemplate++) {
+        const char t = *abjadTemplate;
+        if (t == '.') {
+            target[len++] = '.';
+        } else if (t >= 'a') {
+            target[len++] = codes[t - 'a'];
+        } else {
+            target[len++] = source[t == 'A' ? 10 : t - '0'];
+        }
+    }
+    target[len] = 0;
+    return len;
+}
+
+
 static void convertFromAbjad(char *s) {
-    int len, dot, form, c;
+    int len, dot, form, c, i, index;
+    char source[MAX_MAPCODE_RESULT_ASCII_LEN];
+    char codes[3];
+    const AbjadDecodeForm *abjadForm;
     char *postfix = strchr(s, '-');
-    dot = (int) (strchr(s, '.') - s);
+    const char *dotpos = strchr(s, '.');
+    if (dotpos == NULL) {
+        return;
+    }
+    dot = (int) (dotpos - s);
     if (dot < 2 || dot > 5) {
         return;
     }
@@ -1850,103 +2319,25 @@ static void convertFromAbjad(char *s) {
     unpackIfAllDigits(s);
 
     len = (int) strlen(s);
-    form = (dot >= 2 && dot <= 5 ? dot * 10 + (len - dot - 1) : 0);
-
-    if (form == 23) {
-        c = decodeChar(s[3]) * 8 + (decodeChar(s[4]) - 18);
-        if (c >= 0 && c < 31) {
-//          s[0] = s[0];
-//          s[1] = s[1];
-//          s[2] = '.';
-            s[3] = ENCODE_CHARS[c];
-            s[4] = s[5];
-            s[5] = 0;
-        }
-    } else if (form == 24) {
-        c = decodeChar(s[3]) * 8 + (decodeChar(s[4]) - 18);
-        if (c >= 0 && c < 63) {
-//          s[0] = s[0];
-//          s[1] = s[1];
-//          s[2] = '.';
-            s[3] = '.';
-            s[4] = s[5];
-            s[5] = s[6];
-            s[6] = 0;
-            if (c >= 32) {
-                s[2] = ENCODE_CHARS[c - 32];
-            } else {
-                s[3] = ENCODE_CHARS[c];
-            }
-        }
-    } else if (form == 34) {
-        c = (decodeChar(s[2]) * 10) + (decodeChar(s[5]) - 7);
-        if (c >= 0 && c < 93) {
-//          s[0] = s[0];
-//          s[1] = s[1];
-            s[2] = '.';
-//          s[3] = '.';
-//          s[4] = s[4];
-            s[5] = s[6];
-            s[6] = s[7];
-            s[7] = 0;
-
-            if (c < 31) {
-                s[3] = ENCODE_CHARS[c];
-            } else if (c < 62) {
-                s[2] = ENCODE_CHARS[c - 31];
-            } else {
-                s[2] = ENCODE_CHARS[c - 62];
-                s[3] = s[4];
-                s[4] = '.';
-            }
-        }
-    } else if (form == 35) {
-        c = (decodeChar(s[2]) * 8) + (decodeChar(s[6]) - 18);
-        if (c >= 0 && c < 63) {
-//          s[0] = s[0];
-//          s[1] = s[1];
-//          s[3] = '.';
-//          s[4] = s[4];
-//          s[5] = s[5];
-            s[6] = s[7];
-            s[7] = s[8];
-            s[8] = 0;
-            if (c >= 32) {
-                s[2] = ENCODE_CHARS[c - 32];
-                s[3] = s[4];
-                s[4] = '.';
-            } else {
-                s[2] = ENCODE_CHARS[c];
-            }
-        }
-    } else if (form == 45) {
-        c = (decodeChar(s[2]) * 100) + (decodeChar(s[5]) * 10) + (decodeChar(s[8]) - 39);
-        if (c >= 0 && c < 961) {
-//          s[0] = s[0];
-//          s[1] = s[1];
-            s[2] = ENCODE_CHARS[c / 31];
-//          s[3] = s[3];
-//          s[4] = '.';
-            s[5] = s[6];
-            s[6] = s[7];
-            s[7] = s[9];
-            s[8] = ENCODE_CHARS[c % 31];
-            s[9] = 0;
-        }
-    } else if (form == 55) {
-        c = (decodeChar(s[2]) * 100) + (decodeChar(s[6]) * 10) + (decodeChar(s[9]) - 39);
-        if (c >= 0 && c < 961) {
-//          s[0] = s[0];
-//          s[1] = s[1];
-            s[2] = ENCODE_CHARS[c / 31];
-//          s[3] = s[3];
-//          s[4] = s[4];
-//          s[5] = '.';
-            s[6] = s[7];
-            s[7] = s[8];
-            s[8] = s[10];
-            s[9] = ENCODE_CHARS[c % 31];
-            s[10] = 0;
+    form = (len - dot - 1 <= 9) ? dot * 10 + (len - dot - 1) : 0; // no mapcode has more than 9 characters after the dot
+    index = (form >= ABJAD_MIN_FORM && form <= ABJAD_MAX_FORM) ? ABJAD_DECODE_FORM_INDEX[form - ABJAD_MIN_FORM] : -1;
+    if (index >= 0 && len < MAX_MAPCODE_RESULT_ASCII_LEN) {
+        abjadForm = &ABJAD_DECODE_FORMS[index];
+        c = decodeChar(s[abjadForm->codePos[0]]) * abjadForm->radix + decodeChar(s[abjadForm->codePos[1]]);
+        if (abjadForm->codePos[2] >= 0) {
+            c = c * abjadForm->radix + decodeChar(s[abjadForm->codePos[2]]);
+        }
+        c -= abjadForm->bias;
+        if (c >= 0 && c < abjadForm->limit) {
+            i = 0;
+            while (c < abjadForm->from[i]) {
+                i++;
+            }
+            codes[0] = (c - abjadForm->from[i] < (int) sizeof(ENCODE_CHARS)) ? ENCODE_CHARS[c - abjadForm->from[i]] : '?';
+            codes[1] = ENCODE_CHARS[c / 31];
+            codes[2] = ENCODE_CHARS[c % 31];
+            memcpy(source, s, (size_t) len + 1);
+            applyAbjadTemplate(s, source, abjadForm->abjadTemplate[i], codes);
         }
     }
     repackIfAllDigits(s, 0);
@@ -1958,46 +2349,6 @@ static void convertFromAbjad(char *s) {
 }
 
 
-/**
- * Returns the alphabet of given UTF8 (of ASCII) string (based on the
- * first recognizable non-Latin character).
- *
- * Arguments:
- *      utf8   - Zero-terminated UTF8 (or ASCII) string
- *
- * Returns:
- *      ALPHABET_ROMAN if all characters are in ASCII range 0..0xBF.
- *      otherwise returns the alphabet of the first different character
- *      encountered, or negative (_ALPHABET_MIN) if it isn't recognized.
- */
-static enum Alphabet recognizeAlphabetUtf8(const char *utf8) {
-    ASSERT(utf8);
-    while (*utf8 != 0) {
-        int c = (unsigned char) *utf8++;
-        if (c >= 0xC0) {
-            enum Alphabet alphabet;
-            int c2 = (unsigned char) *utf8++;
-            if (c2 < 0x80) {
-                return _ALPHABET_MIN; // utf8 error!
-            }
-            c = ((c - 0xC0) << 6) + (c2 & 63);
-            if (c >= 0x800) {
-                int c3 = (unsigned char) *utf8++;
-                c = ((c - 0x800) << 6) + (c3 & 63);
-                if (c3 < 0x80 || c > 0xFFFF) {
-                    return _ALPHABET_MIN; // utf8 error!
-                }
-            }
-            alphabet = ALPHABET_OF_CHAR((UWORD) c);
-            if (alphabet != ALPHABET_ROMAN) {
-                return alphabet;
-            }
-        }
-    }
-    return ALPHABET_ROMAN;
-}
-
-
 ///////////////////////////////////////////////////////////////////////////////////////////////
 //
 //  compareWithMapcodeFormat & parseMapcode
@@ -2098,189 +2449,253 @@ static const int STATE_MACHINE[27][6] = {
 };
 
 
-// Returns 0 if ok, negative in case of error (where -999 represents "may BECOME a valid mapcode if more characters are added)
-static enum MapcodeError parseMapcodeString(MapcodeElements *mapcodeElements, const char *string, int interpretAsUtf16,
-                                            enum Territory territory) {
-    const UWORD *utf16 = (const UWORD *) string;
-    int isAbjad = 0;
-    const unsigned char *utf8 = (unsigned char *) string;
-    int extensionLength = 0;
-    char *cleanPtr = NULL;
-    int nondigits = 0, vowels = 0;
-    int state = 0;
-    ASSERT(string);
-    if (mapcodeElements) {
-        *mapcodeElements->precisionExtension = 0;
-        *mapcodeElements->territoryISO = 0;
-        cleanPtr = mapcodeElements->properMapcode;
+// notes the alphabet of character w in the parse state
+static void parseAlphabetOf(MapcodeParserStep *step, const UWORD w) {
+    const enum Alphabet alphabet = ALPHABET_OF_CHAR(w);
+    if (alphabet != ALPHABET_ROMAN) {
+        if (alphabet == ALPHABET_GREEK || alphabet == ALPHABET_HEBREW ||
+            alphabet == ALPHABET_ARABIC || alphabet == ALPHABET_KOREAN) {
+            step->isAbjad = 1;
+        }
+        if (step->alphabet == ALPHABET_ROMAN) {
+            step->alphabet = (signed char) alphabet;
+        }
     }
-    for (;;) {
-        int newstate, token;
-        unsigned char cx;
-        // handle utf16
-        if (interpretAsUtf16) {
-            const enum Alphabet alphabet = ALPHABET_OF_CHAR(*utf16);
-            if (alphabet == ALPHABET_GREEK || alphabet == ALPHABET_HEBREW ||
-                alphabet == ALPHABET_ARABIC || alphabet == ALPHABET_KOREAN) {
-                isAbjad = 1;
-            }
-            cx = getRomanVersionOf(*utf16++);
-        } else {
-            cx = *utf8++;
+}
+
+
+// reads the next character from *utf8 (advancing it), notes its alphabet in step;
+// returns the romanised character (0 at end of string), or negative in case of a utf8 error
+static int parseUtf8Character(MapcodeParserStep *step, const unsigned char **utf8) {
+    int cx = *(*utf8)++;
+    if (cx >= 0xC0) { // utf8 character
+        unsigned char c2 = *(*utf8)++;
+        int w = ((cx - 0xC0) << 6) + (c2 & 63);
+        if (c2 < 0x80) {
+            return ERR_INVALID_CHARACTER; // utf8 error
         }
-        // recognize token: decode returns -2=a -3=e -4=0, 0..9 for digit or "o" or "i", 10..31 for char, -1 for illegal char
-        if (cx == '.') {
-            token = TOKENDOT;
-            if (mapcodeElements) {
-                mapcodeElements->indexOfDot = (int) (cleanPtr - mapcodeElements->properMapcode);
+        if (w >= 0x800) {
+            int c3 = (int) *(*utf8)++;
+            w = ((w - 0x800) << 6) + (c3 & 63);
+            if (c3 < 0x80 || w > 0xFFFF) {
+                return ERR_INVALID_CHARACTER; // utf8 error
             }
-            if (mapcodeElements) {
-                *cleanPtr++ = cx;
+        }
+        parseAlphabetOf(step, (UWORD) w);
+        cx = getRomanVersionOf((UWORD) w);
+    }
+    return cx;
+}
+
+
+static void initParseStep(MapcodeParserStep *step, const enum Territory territory) {
+    memset(step, 0, sizeof(MapcodeParserStep));
+    step->indexOfDot = -1;
+    step->alphabet = ALPHABET_ROMAN;
+    step->territoryCode = territory;
+}
+
+
+// feeds the (romanised) character cx to the parser; clean holds the cleaned-up characters parsed so far.
+// returns the new state: negative in case of error, STATE_GO if cx ended a complete mapcode
+static int parseCharacter(MapcodeParserStep *step, char *clean, const unsigned char cx) {
+    int newstate, token;
+    ASSERT(step->state >= 0 && step->state < STATE_GO);
+    // recognize token: decode returns -2=a -3=e -4=0, 0..9 for digit or "o" or "i", 10..31 for char, -1 for illegal char
+    if (cx == '.') {
+        token = TOKENDOT;
+        step->indexOfDot = (signed char) (step->cleanLength - step->territoryLength);
+        clean[step->cleanLength++] = (char) cx;
+    } else if (cx == '-') {
+        token = TOKENHYPH;
+        clean[step->cleanLength++] = (char) cx;
+    } else if (cx == 0) {
+        token = TOKENZERO;
+    } else if ((cx == ' ') || (cx == '\t')) {
+        token = TOKENSEP;
+    } else {
+        const signed char c = decodeChar((char) cx);
+        if (c < 0) { // vowel or illegal?
+            if (c == -1) { // illegal?
+                return step->state = ERR_INVALID_CHARACTER;
             }
-        } else if (cx == '-') {
-            token = TOKENHYPH;
-            if (mapcodeElements) {
-                *cleanPtr++ = cx;
+            token = TOKENVOWEL;
+            step->vowels++;
+        } else { // digit, or character B-Z
+            token = TOKENCHR;
+            if (c >= 10 && !step->extensionLength) {
+                step->nondigits++;
             }
-        } else if (cx == 0) {
-            token = TOKENZERO;
-        } else if ((cx == ' ') || (cx == '\t')) {
-            token = TOKENSEP;
-        } else {
-            signed char c;
-            if (cx >= 0xC0) { // utf8 character
-                unsigned char c2 = *utf8++;
-                int w = ((cx - 0xC0) << 6) + (c2 & 63);
-                if (c2 < 0x80) {
-                    return ERR_INVALID_CHARACTER; // utf8 error
-                }
-                if (w >= 0x800) {
-                    int c3 = (int) *utf8++;
-                    w = ((w - 0x800) << 6) + (c3 & 63);
-                    if (c3 < 0x80 || w > 0xFFFF) {
-                        return ERR_INVALID_CHARACTER; // utf8 error
-                    }
-                }
-                {
-                    const enum Alphabet alphabet = ALPHABET_OF_CHAR(w);
-                    if (alphabet == ALPHABET_GREEK || alphabet == ALPHABET_HEBREW ||
-                        alphabet == ALPHABET_ARABIC || alphabet == ALPHABET_KOREAN) {
-                        isAbjad = 1;
-                    }
-                }
-                cx = getRomanVersionOf((UWORD) w);
+        }
+        clean[step->cleanLength++] = (char) toupper(cx);
+    }
+    newstate = STATE_MACHINE[step->state][token];
+    if (newstate >= 32) {
+        if (newstate >= 512) {
+            // end of extension: it ends at cleanLength
+        } else if (newstate >= 128) {
+            if (newstate >= 256) { // start of extension
+                step->extensionLength = 1;
+                step->cleanLength--; // get rid of hyphen
             }
-            c = decodeChar(cx);
-            if (c < 0) { // vowel or illegal?
-                if (c == -1) { // illegal?
-                    return ERR_INVALID_CHARACTER;
-                }
-                token = TOKENVOWEL;
-                vowels++;
-                if (mapcodeElements) {
-                    *cleanPtr++ = (char) toupper(cx);
-                }
-            } else if (c < 10) { // digit
-                token = TOKENCHR; // digit
-                if (mapcodeElements) {
-                    *cleanPtr++ = (char) toupper(cx);
-                }
-            } else { // character B-Z
-                token = TOKENCHR;
-                if (!extensionLength) {
-                    nondigits++;
-                }
-                if (mapcodeElements) {
-                    *cleanPtr++ = (char) toupper(cx);
-                }
+            // end of proper mapcode
+            step->properEnd = step->cleanLength;
+        } else if (newstate >= 64) { // end of territory
+            step->nondigits = step->vowels = 0;
+            ASSERT(step->cleanLength <= MAX_ISOCODE_ASCII_LEN);
+            step->territoryLength = step->cleanLength;
+        } else { // add to extension
+            if (++step->extensionLength > MAX_PRECISION_DIGITS) {
+                return step->state = ERR_EXTENSION_INVALID_LENGTH;
             }
         }
-        newstate = STATE_MACHINE[state][token];
-        if (newstate >= 32) {
-            if (newstate >= 512) { // end of extension
-                if (mapcodeElements) {
-                    *cleanPtr = 0;
-                    cleanPtr = mapcodeElements->precisionExtension;
-                }
-            } else if (newstate >= 128) {
-                if (newstate >= 256) { // start of extension
-                    extensionLength = 1;
-                    cleanPtr--; // get rid of hyphen
-                }
-                // end of proper mapcode
-                if (mapcodeElements) {
-                    *cleanPtr = 0;
-                    cleanPtr = mapcodeElements->precisionExtension;
-                }
-            } else if (newstate >= 64) { // end of territory
-                nondigits = vowels = 0;
-                if (mapcodeElements) {
-                    int len = (int) (cleanPtr - mapcodeElements->properMapcode);
-                    ASSERT(len < MAX_ISOCODE_ASCII_LEN);
-                    lengthCopy(mapcodeElements->territoryISO, mapcodeElements->properMapcode, len, MAX_ISOCODE_ASCII_LEN + 1);
-                    cleanPtr = mapcodeElements->properMapcode;
-                }
-            } else { // add to extension
-                if (++extensionLength > MAX_PRECISION_DIGITS) {
-                    return ERR_EXTENSION_INVALID_LENGTH;
-                }
-            }
-            newstate &= 31;
+        newstate &= 31;
+    }
+
+    if (newstate == STATE_GO) {
+        const int vowels = step->vowels;
+        const int nondigits = step->nondigits;
+        if (vowels > 3 || (nondigits == 1 && vowels > 1) || (nondigits > 1 && vowels > 0)) {
+            newstate = ERR_INVALID_VOWEL;
+        } else if (nondigits == 0 && vowels == 0) {
+            newstate = ERR_ALL_DIGIT_CODE;
         }
+    }
+    return step->state = newstate;
+}
+
+
+// sets final to the state the parser would reach if the input ended after step;
+// returns ERR_OK if the input so far is a complete mapcode, or the (negative) parse error
+static enum MapcodeError getParseStatus(MapcodeParserStep *final, const MapcodeParserStep *step) {
+    memcpy(final, step, sizeof(MapcodeParserStep));
+    if (final->state < 0) {
+        return (enum MapcodeError) final->state;
+    }
+    if (parseCharacter(final, NULL, 0) == STATE_GO) { // the end of the string adds nothing to clean
+        return ERR_OK;
+    }
+    return (enum MapcodeError) final->state;
+}
+
+
+static enum Territory getTerritoryCodeOf(const MapcodeData *data, const char *territoryISO,
+                                         enum Territory optionalTerritoryContext);
+
+// resolves the territory code (if any) at the start of clean, in the context of territory
+static enum Territory getParsedTerritory(const MapcodeData *data, const MapcodeParserStep *step, const char *clean,
+                                         enum Territory territory) {
+    char territoryISO[MAX_ISOCODE_ASCII_LEN + 1];
+    ASSERT(step->territoryLength);
+    lengthCopy(territoryISO, clean, step->territoryLength, MAX_ISOCODE_ASCII_LEN + 1);
+    return getTerritoryCodeOf(data, territoryISO, territory);
+}
+
+
+// sets the territory of parsed mapcodeElements: territoryCode is the territory of its territoryISO,
+// or the territory context if it has none
+static enum MapcodeError setParsedTerritoryCode(MapcodeElements *mapcodeElements, const enum Territory territoryCode) {
+    mapcodeElements->territoryCode = territoryCode;
+    if (*mapcodeElements->territoryISO && territoryCode < _TERRITORY_MIN) {
+        return ERR_UNKNOWN_TERRITORY;
+    }
+    if ((territoryCode == TERRITORY_MEX) && (strlen(mapcodeElements->properMapcode) < 8)) {
+        // special case: short MEX codes are handled in the state (which ALSO has iso code MEX)
+        mapcodeElements->territoryCode = TERRITORY_MX_MX;
+    }
+    return ERR_OK;
+}
+
 
-        if (newstate < 0) {
-            return (enum MapcodeError) newstate;
-        } else if (newstate == STATE_GO) {
-            if (vowels > 3 || (nondigits == 1 && vowels > 1) || (nondigits > 1 && vowels > 0)) {
-                return ERR_INVALID_VOWEL;
-            } else if (nondigits == 0 && vowels == 0) {
-                return ERR_ALL_DIGIT_CODE;
+// fills mapcodeElements from a completely parsed mapcode (step->territoryCode must hold
+// the resolved territory code, or the territory context if there was none)
+static enum MapcodeError getParsedMapcodeElements(MapcodeElements *mapcodeElements, const MapcodeParserStep *step,
+                                                  const char *clean) {
+    ASSERT(step->state == STATE_GO);
+    lengthCopy(mapcodeElements->territoryISO, clean, step->territoryLength, MAX_ISOCODE_ASCII_LEN + 1);
+    lengthCopy(mapcodeElements->properMapcode, clean + step->territoryLength,
+               step->properEnd - step->territoryLength, MAX_PROPER_MAPCODE_ASCII_LEN + 1);
+    lengthCopy(mapcodeElements->precisionExtension, clean + step->properEnd,
+               step->cleanLength - step->properEnd, MAX_PRECISION_DIGITS + 1);
+    mapcodeElements->indexOfDot = step->indexOfDot;
+    if (*mapcodeElements->properMapcode == 'A') {
+        unpackIfAllDigits(mapcodeElements->properMapcode);
+        repackIfAllDigits(mapcodeElements->properMapcode, 0);
+    }
+    if (step->isAbjad) {
+        convertFromAbjad(mapcodeElements->properMapcode);
+        mapcodeElements->indexOfDot = (int) (strchr(mapcodeElements->properMapcode, '.') -
+                                             mapcodeElements->properMapcode);
+    }
+    return setParsedTerritoryCode(mapcodeElements, step->territoryCode);
+}
+
+
+// Returns 0 if ok, negative in case of error (where -999 represents "may BECOME a valid mapcode if more characters are added)
+static enum MapcodeError parseMapcodeString(const MapcodeData *data, MapcodeElements *mapcodeElements,
+                                            const char *string, int interpretAsUtf16, enum Territory territory) {
+    const UWORD *utf16 = (const UWORD *) string;
+    const unsigned char *utf8 = (const unsigned char *) string;
+    MapcodeParserStep step;
+    char clean[MAX_MAPCODE_PARSER_CLEAN_LEN];
+    ASSERT(string);
+    initParseStep(&step, territory);
+    for (;;) {
+        int cx;
+        if (interpretAsUtf16) {
+            parseAlphabetOf(&step, *utf16);
+            cx = getRomanVersionOf(*utf16++);
+        } else {
+            cx = parseUtf8Character(&step, &utf8);
+            if (cx < 0) {
+                step.state = cx;
             }
+        }
+        if (step.state >= 0) {
+            parseCharacter(&step, clean, (unsigned char) cx);
+        }
+        if (step.state < 0) {
+            if (mapcodeElements && step.indexOfDot >= 0) {
+                mapcodeElements->indexOfDot = step.indexOfDot;
+            }
+            return (enum MapcodeError) step.state;
+        } else if (step.state == STATE_GO) {
             if (mapcodeElements) {
-                if (*mapcodeElements->properMapcode == 'A') {
-                    unpackIfAllDigits(mapcodeElements->properMapcode);
-                    repackIfAllDigits(mapcodeElements->properMapcode, 0);
-                }
-                if (isAbjad) {
-                    convertFromAbjad(mapcodeElements->properMapcode);
-                    mapcodeElements->indexOfDot = (int) (strchr(mapcodeElements->properMapcode, '.') -
-                                                         mapcodeElements->properMapcode);
-                }
-                if (*mapcodeElements->territoryISO) {
-                    mapcodeElements->territoryCode = getTerritoryCode(mapcodeElements->territoryISO, territory);
-                    if (mapcodeElements->territoryCode < _TERRITORY_MIN) {
-                        return ERR_UNKNOWN_TERRITORY;
-                    }
-                } else {
-                    mapcodeElements->territoryCode = territory;
-                }
-                if ((mapcodeElements->territoryCode == TERRITORY_MEX) && (strlen(mapcodeElements->properMapcode) < 8)) {
-                    // special case: short MEX codes are handled in the state (which ALSO has iso code MEX)
-                    mapcodeElements->territoryCode = TERRITORY_MX_MX;
+                if (step.territoryLength) {
+                    step.territoryCode = getParsedTerritory(data, &step, clean, territory);
                 }
+                return getParsedMapcodeElements(mapcodeElements, &step, clean);
             }
             return ERR_OK;
         }
-        state = newstate;
     }
-    ASSERT(0);
 }
 
 
 enum MapcodeError compareWithMapcodeFormatUtf8(const char *utf8String) {
     ASSERT(utf8String);
-    return parseMapcodeString(NULL, utf8String, FLAG_UTF8_STRING, TERRITORY_NONE);
+    return parseMapcodeString(defaultMapcodeContext.data, NULL, utf8String, FLAG_UTF8_STRING, TERRITORY_NONE);
 }
 
 
 enum MapcodeError compareWithMapcodeFormatUtf16(const UWORD *Utf16String) {
     ASSERT(Utf16String);
-    return parseMapcodeString(NULL, (const char *) Utf16String, FLAG_UTF16_STRING, TERRITORY_NONE);
+    return parseMapcodeString(defaultMapcodeContext.data, NULL, (const char *) Utf16String, FLAG_UTF16_STRING,
+                              TERRITORY_NONE);
 }
 
 
-// returns nonzero if error
-static enum MapcodeError decoderEngine(DecodeRec *dec, int parseFlags) {
+// clear all parsed fields (in case of a parse error)
+static void clearParsedMapcodeElements(MapcodeElements *mapcodeElements) {
+    mapcodeElements->territoryISO[0] = 0;
+    mapcodeElements->properMapcode[0] = 0;
+    mapcodeElements->precisionExtension[0] = 0;
+}
+
+
+// decodes the parsed dec->mapcodeElements; returns nonzero if error
+static enum MapcodeError decodeMapcodeElements(DecodeRec *dec) {
+    const MapcodeData *data = dec->data;
     enum Territory ccode;
     enum MapcodeError err;
     int codex;
@@ -2291,14 +2706,6 @@ static enum MapcodeError decoderEngine(DecodeRec *dec, int parseFlags) {
     int wasAllDigits = 0;
     ASSERT(dec);
 
-    err = parseMapcodeString(&dec->mapcodeElements, dec->orginput, parseFlags, dec->context);
-    if (err) { // clear all parsed fields in case of error
-        dec->mapcodeElements.territoryISO[0] = 0;
-        dec->mapcodeElements.properMapcode[0] = 0;
-        dec->mapcodeElements.precisionExtension[0] = 0;
-        return err;
-    }
-
     ccode = dec->mapcodeElements.territoryCode;
     dec->context = ccode;
     dec->mapcode = dec->mapcodeElements.properMapcode;
@@ -2321,24 +2728,25 @@ static enum MapcodeError decoderEngine(DecodeRec *dec, int parseFlags) {
         ccode = TERRITORY_AAA;
     } else if (ccode < _TERRITORY_MIN) {
         return ERR_MISSING_TERRITORY;
-    } else if (isSubdivision(ccode)) {
+    } else if (isSubdivision(data, ccode)) {
         // int mapcodes must be interpreted in the parent of a subdivision
-        enum Territory parent = parentTerritoryOf(ccode);
+        enum Territory parent = parentTerritoryOf(data, ccode);
         if ((codex == 44) || ((codex == 34 || codex == 43) && (parent == TERRITORY_IND || parent == TERRITORY_MEX))) {
             ccode = parent;
         }
     }
 
-    from = firstRec(ccode);
-    upto = lastRec(ccode);
+    dec->territory = ccode;
+    from = firstRec(data, ccode);
+    upto = lastRec(data, ccode);
 
     // try all ccode rectangles to decode s (pointing to first character of proper mapcode), assume not decodable
     err = ERR_MAPCODE_UNDECODABLE;
     for (i = from; i <= upto; i++) {
-        const int codexi = coDex(i);
-        const int r = REC_TYPE(i);
+        const int codexi = coDex(data, i);
+        const int r = REC_TYPE(data, i);
         if (r == 0) {
-            if (IS_NAMELESS(i)) {
+            if (IS_NAMELESS(data, i)) {
                 if (((codexi == 21) && (codex == 22)) ||
                     ((codexi == 22) && (codex == 32)) ||
                     ((codexi == 13) && (codex == 23))) {
@@ -2350,18 +2758,24 @@ static enum MapcodeError decoderEngine(DecodeRec *dec, int parseFlags) {
                     err = decodeGrid(dec, i, 0);
 
                     // first of all, make sure the zone fits the country
-                    restrictZoneTo(&dec->zone, &dec->zone, TERRITORY_BOUNDARY(upto));
+                    restrictZoneTo(&dec->zone, &dec->zone, TERRITORY_BOUNDARY(data, upto));
 
-                    if ((err == ERR_OK) && IS_RESTRICTED(i)) {
+                    if ((err == ERR_OK) && IS_RESTRICTED(data, i)) {
                         int nrZoneOverlaps = 0;
                         int j;
+                        int k;
+
+                        // only previous rects that can overlap the zone need to be tried
+                        int nrCandidates = i - from;
+                        const unsigned short *candidates = getRestrictedOverlaps(data, i, &dec->zone, &nrCandidates);
 
                         // *** make sure decode fits somewhere ***
                         dec->result = getMidPointFractions(&dec->zone);
                         dec->coord32 = convertFractionsToCoord32(&dec->result);
-                        for (j = i - 1; j >= from; j--) { // look in previous rects
-                            if (!IS_RESTRICTED(j)) {
-                                if (fitsInsideBoundaries(&dec->coord32, TERRITORY_BOUNDARY(j))) {
+                        for (k = 0; k < nrCandidates; k++) { // look in previous rects
+                            j = (candidates ? candidates[k] : from + k);
+                            if (!IS_RESTRICTED(data, j)) {
+                                if (fitsInsideBoundaries(&dec->coord32, TERRITORY_BOUNDARY(data, j))) {
                                     nrZoneOverlaps = 1;
                                     break;
                                 }
@@ -2371,16 +2785,17 @@ static enum MapcodeError decoderEngine(DecodeRec *dec, int parseFlags) {
                         if (!nrZoneOverlaps) {
                             MapcodeZone zfound;
                             TerritoryBoundary prevu;
-                            for (j = from; j < i; j++) { // try all smaller rectangles j
-                                if (!IS_RESTRICTED(j)) {
+                            for (k = 0; k < nrCandidates; k++) { // try all smaller rectangles j
+                                j = (candidates ? candidates[k] : from + k);
+                                if (!IS_RESTRICTED(data, j)) {
                                     MapcodeZone z;
-                                    if (restrictZoneTo(&z, &dec->zone, TERRITORY_BOUNDARY(j))) {
+                                    if (restrictZoneTo(&z, &dec->zone, TERRITORY_BOUNDARY(data, j))) {
                                         nrZoneOverlaps++;
                                         if (nrZoneOverlaps == 1) {
                                             // first fit! remember...
                                             zoneCopyFrom(&zfound, &z);
-                                            ASSERT(j <= MAPCODE_BOUNDARY_MAX);
-                                            memcpy(&prevu, TERRITORY_BOUNDARY(j), sizeof(TerritoryBoundary));
+                                            ASSERT(j < data->nrBoundaries);
+                                            memcpy(&prevu, TERRITORY_BOUNDARY(data, j), sizeof(TerritoryBoundary));
                                         } else { // nrZoneOverlaps >= 2
                                             // more than one hit
                                             break; // give up
@@ -2404,7 +2819,7 @@ static enum MapcodeError decoderEngine(DecodeRec *dec, int parseFlags) {
                 }
             }
         } else if (r == 1) {
-            if (codex == codexi + 10 && HEADER_LETTER(i) == *s) {
+            if (codex == codexi + 10 && HEADER_LETTER(data, i) == *s) {
                 err = decodeGrid(dec, i, 1);
                 break;
             }
@@ -2418,7 +2833,7 @@ static enum MapcodeError decoderEngine(DecodeRec *dec, int parseFlags) {
     } // for
 
     if (!err) {
-        restrictZoneTo(&dec->zone, &dec->zone, TERRITORY_BOUNDARY(lastRec(ccode)));
+        restrictZoneTo(&dec->zone, &dec->zone, TERRITORY_BOUNDARY(data, lastRec(data, ccode)));
 
         if (isEmpty(&dec->zone)) {
             err = ERR_MAPCODE_UNDECODABLE; // type 0 "BRA xx.xx"
@@ -2453,6 +2868,38 @@ static enum MapcodeError decoderEngine(DecodeRec *dec, int parseFlags) {
     return ERR_OK;
 }
 
+
+// returns nonzero if error
+static enum MapcodeError decoderEngine(DecodeRec *dec, int parseFlags) {
+    enum MapcodeError err;
+    ASSERT(dec);
+    err = parseMapcodeString(dec->data, &dec->mapcodeElements, dec->orginput, parseFlags, dec->context);
+    if (err) {
+        clearParsedMapcodeElements(&dec->mapcodeElements);
+        return err;
+    }
+    return decodeMapcodeElements(dec);
+}
+
+
+// decodes parsed mapcodeElements in context of territory; returns nonzero if error
+static enum MapcodeError decodeParsedMapcodeElements(DecodeRec *dec, const MapcodeElements *mapcodeElements,
+                                                     const enum Territory territory) {
+    enum MapcodeError err;
+    ASSERT(dec);
+    memcpy(&dec->mapcodeElements, mapcodeElements, sizeof(MapcodeElements));
+    dec->context = territory;
+    // the territory code in the elements is resolved again, in context of territory
+    err = setParsedTerritoryCode(&dec->mapcodeElements, *mapcodeElements->territoryISO ?
+                                                        getTerritoryCodeOf(dec->data, mapcodeElements->territoryISO,
+                                                                           territory) :
+                                                        territory);
+    if (err) {
+        return err;
+    }
+    return decodeMapcodeElements(dec);
+}
+
 ///////////////////////////////////////////////////////////////////////////////////////////////
 //
 //  Alphabet support
@@ -2502,8 +2949,11 @@ static const UWORD ASCII_TO_UTF16[_ALPHABET_MAX][36] = { // A-Z equivalents for
 
 /// PRIVATE convert a mapcode to an ABJAD-format (never more than 2 non-digits in a row)
 static char *convertToAbjad(char *targetAsciiString, const char *sourceAsciiString, int maxLength) {
-    int form, i, dot, inarow, len;
+    int i, dot, len, form;
+    unsigned int letters;
     const char *rest;
+    const char *dotpos;
+    const AbjadEncodeForm *abjadForm = NULL;
     ASSERT(targetAsciiString);
     ASSERT(sourceAsciiString);
     len = (int) strlen(sourceAsciiString);
@@ -2522,143 +2972,56 @@ static char *convertToAbjad(char *targetAsciiString, const char *sourceAsciiStri
     unpackIfAllDigits(targetAsciiString);
 
     len = (int) strlen(targetAsciiString);
-    dot = (int) (strchr(targetAsciiString, '.') - targetAsciiString);
-
-    form = dot * 10 + (len - dot - 1);
-
-    // see if >2 non-digits in a row
-    inarow = 0;
-    for (i = 0; i < len; i++) {
-        char c = targetAsciiString[i];
-        if (c != 46) {
-            inarow++;
-            if (decodeChar(c) <= 9) {
-                inarow = 0;
-            } else if (inarow > 2) {
-                break;
+    dotpos = strchr(targetAsciiString, '.');
+    dot = (dotpos == NULL) ? -1 : (int) (dotpos - targetAsciiString);
+    if (dot < 2 || dot > 5) {
+        // no need to do anything, return input unchanged
+        return safeCopy(targetAsciiString, sourceAsciiString, maxLength);
+    }
+
+    form = (len - dot - 1 <= 9) ? dot * 10 + (len - dot - 1) : 0; // no mapcode has more than 9 characters after the dot
+    if (form >= ABJAD_MIN_FORM && form <= ABJAD_MAX_FORM && ABJAD_ENCODE_FORMS[form - ABJAD_MIN_FORM].abjadTemplate) {
+        abjadForm = &ABJAD_ENCODE_FORMS[form - ABJAD_MIN_FORM];
+    }
+
+    if (abjadForm && abjadForm->onlyIfThreeLetters) {
+        // see if >2 non-digits in a row (the dot does not count)
+        letters = 0;
+        for (i = 0; i < len; i++) {
+            if (targetAsciiString[i] != '.') {
+                letters = (letters << 1) | (decodeChar(targetAsciiString[i]) > 9 ? 1 : 0);
             }
         }
+        if ((letters & (letters >> 1) & (letters >> 2)) == 0) {
+            // no need to do anything, return input unchanged
+            return safeCopy(targetAsciiString, sourceAsciiString, maxLength);
+        }
     }
-    if (dot < 2 || dot > 5 || (inarow < 3 &&
-                               (form == 22 || form == 32 || form == 33 || form == 42 || form == 43 || form == 44 ||
-                                form == 54))) {
-        // no need to do anything, return input unchanged
-        return safeCopy(targetAsciiString, sourceAsciiString, maxLength);
-    } else if (form >= 22 && form <= 54) {
-        char c1, c2, c3 = '?';
+
+    if (abjadForm) {
+        char source[MAX_MAPCODE_RESULT_ASCII_LEN];
+        char codes[4];
         int c = decodeChar(targetAsciiString[2]);
         if (c < 0) {
             c = decodeChar(targetAsciiString[3]);
         }
-
-        if (form >= 44) {
+        if (abjadForm->encoding == ABJAD_TRIPLE) {
             c = (c * 31) + (decodeChar(targetAsciiString[len - 1]) + 39);
-            c1 = ENCODE_CHARS[c / 100];
-            c2 = ENCODE_CHARS[(c % 100) / 10];
-            c3 = ENCODE_CHARS[c % 10];
-        } else if (len == 7) {
-            if (form == 24) {
-                c += 7;
-            } else if (form == 33) {
-                c += 38;
-            } else if (form == 42) {
-                c += 69;
-            }
-            c1 = ENCODE_CHARS[c / 10];
-            c2 = ENCODE_CHARS[c % 10];
+            codes[0] = ENCODE_CHARS[c / 100];
+            codes[1] = ENCODE_CHARS[(c % 100) / 10];
+            codes[2] = ENCODE_CHARS[c % 10];
+        } else if (abjadForm->encoding == ABJAD_DECIMAL) {
+            c += abjadForm->bias;
+            codes[0] = ENCODE_CHARS[c / 10];
+            codes[1] = ENCODE_CHARS[c % 10];
         } else {
-            c1 = ENCODE_CHARS[2 + (c / 8)];
-            c2 = ENCODE_CHARS[2 + (c % 8)];
-        }
-
-        if (form == 22) // s0 s1 . s3 s4 -> s0 s1 . C1 C2 s4
-        {
-            targetAsciiString[6] = 0;
-            targetAsciiString[5] = targetAsciiString[4];
-            targetAsciiString[4] = c2;
-            targetAsciiString[3] = c1;
-//          targetAsciiString[2] = '.';
-//          targetAsciiString[1] = targetAsciiString[1];
-//          targetAsciiString[0] = targetAsciiString[0];
-        } else if (form == 23) { // s0 s1 . s3 s4 s5 -> s0 s1 . C1 C2 s4 s5
-            targetAsciiString[7] = 0;
-            targetAsciiString[6] = targetAsciiString[5];
-            targetAsciiString[5] = targetAsciiString[4];
-            targetAsciiString[4] = c2;
-            targetAsciiString[3] = c1;
-//          targetAsciiString[2] = '.';
-//          targetAsciiString[1] = targetAsciiString[1];
-//          targetAsciiString[0] = targetAsciiString[0];
-        } else if (form == 32) { // s0 s1 s2 . s4 s5 -> s0 s1 . C* C2 s4 s5
-            targetAsciiString[7] = 0;
-            targetAsciiString[6] = targetAsciiString[5];
-            targetAsciiString[5] = targetAsciiString[4];
-            targetAsciiString[4] = c2;
-            targetAsciiString[3] = (char) (c1 + 4);
-            targetAsciiString[2] = '.';
-//          targetAsciiString[1] = targetAsciiString[1];
-//          targetAsciiString[0] = targetAsciiString[0];
-        } else if (form == 24 || form == 33 || form == 42) {
-            // s0 s1 . s3 s4 s5 s6 -> s0 s1 C1 . s4 C2 s5 s6
-            // s0 s1 s2 . s4 s5 s6 -> s0 s1 C1 . s4 C2 s5 s6
-            // s0 s1 s2 s3 . s5 s6 -> s0 s1 C1 . s3 C2 s5 s6
-            targetAsciiString[8] = 0;
-            targetAsciiString[7] = targetAsciiString[6];
-            targetAsciiString[6] = targetAsciiString[5];
-            targetAsciiString[5] = c2;
-            targetAsciiString[4] = targetAsciiString[(form == 42 ? 3 : 4)];
-            targetAsciiString[3] = '.';
-            targetAsciiString[2] = c1;
-//          targetAsciiString[1] = targetAsciiString[1];
-//          targetAsciiString[0] = targetAsciiString[0];
-        } else if (form == 34) {  // s0 s1 s2 . s4 s5 s6 s7 -> s0 s1 C1 . s4 s5 C2 S6 S7
-            targetAsciiString[9] = 0;
-            targetAsciiString[8] = targetAsciiString[7];
-            targetAsciiString[7] = targetAsciiString[6];
-            targetAsciiString[6] = c2;
-//          targetAsciiString[5] = targetAsciiString[5];
-//          targetAsciiString[4] = targetAsciiString[4];
-//          targetAsciiString[3] = '.';
-            targetAsciiString[2] = c1;
-//          targetAsciiString[1] = targetAsciiString[1];
-//          targetAsciiString[0] = targetAsciiString[0];
-        } else if (form == 43) { // s0 s1 s2 s3 . s5 s6 s7 -> s0 s1 C* . s3 s5 C2 S6 S7
-            targetAsciiString[9] = 0;
-            targetAsciiString[8] = targetAsciiString[7];
-            targetAsciiString[7] = targetAsciiString[6];
-            targetAsciiString[6] = c2;
-//          targetAsciiString[5] = targetAsciiString[5];
-            targetAsciiString[4] = targetAsciiString[3];
-            targetAsciiString[3] = '.';
-            targetAsciiString[2] = (char) (c1 + 4);
-//          targetAsciiString[1] = targetAsciiString[1];
-//          targetAsciiString[0] = targetAsciiString[0];
-        } else if (form == 44) {
-            targetAsciiString[10] = 0;
-            targetAsciiString[9] = targetAsciiString[7];
-            targetAsciiString[8] = c3;
-            targetAsciiString[7] = targetAsciiString[6];
-            targetAsciiString[6] = targetAsciiString[5];
-            targetAsciiString[5] = c2;
-//          targetAsciiString[4] = '.';
-//          targetAsciiString[3] = targetAsciiString[3];
-            targetAsciiString[2] = c1;
-//          targetAsciiString[1] = targetAsciiString[1];
-//          targetAsciiString[0] = targetAsciiString[0];
-        } else if (form == 54) {
-            targetAsciiString[11] = 0;
-            targetAsciiString[10] = targetAsciiString[8];
-            targetAsciiString[9] = c3;
-            targetAsciiString[8] = targetAsciiString[7];
-            targetAsciiString[7] = targetAsciiString[6];
-            targetAsciiString[6] = c2;
-//          targetAsciiString[5] = '.';
-//          targetAsciiString[4] = targetAsciiString[4];
-//          targetAsciiString[3] = targetAsciiString[3];
-            targetAsciiString[2] = c1;
-//          targetAsciiString[1] = targetAsciiString[1];
-//          targetAsciiString[0] = targetAsciiString[0];        
+            codes[0] = ENCODE_CHARS[2 + (c / 8)];
+            codes[1] = ENCODE_CHARS[2 + (c % 8)];
         }
+        codes[3] = (char) (codes[0] + 4);
+        ASSERT(len < MAX_MAPCODE_RESULT_ASCII_LEN);
+        memcpy(source, targetAsciiString, (size_t) len + 1);
+        applyAbjadTemplate(targetAsciiString, source, abjadForm->abjadTemplate, codes);
     }
     repackIfAllDigits(targetAsciiString, 0);
     if (rest) {
@@ -2677,6 +3040,23 @@ static char *convertToAbjad(char *targetAsciiString, const char *sourceAsciiStri
 }
 
 
+// returns the index of ascii character c in ASCII_TO_UTF16/ASCII_TO_UTF8 (A-Z, 0-9),
+// or negative if c must be left untranslated
+static int alphabetIndexOf(char c) {
+    if ((c >= 'a') && (c <= 'z')) {
+        c += ('A' - 'a');
+    }
+    if ((c < ' ') || (c > 'Z')) { // not in any valid range?
+        return -1; // leave untranslated
+    } else if ((c >= '0') && (c <= '9')) { // digit?
+        return 26 + (int) c - '0';
+    } else if (c < 'A') { // valid but not a letter (e.g. a dot, a space...)
+        return -1; // leave untranslated
+    }
+    return c - 'A';
+}
+
+
 static UWORD *encodeUtf16(UWORD *utf16String, const int maxLength, const char *asciiString,
                           const enum Alphabet alphabet) // convert mapcode string alphabet
 {
@@ -2686,32 +3066,50 @@ static UWORD *encodeUtf16(UWORD *utf16String, const int maxLength, const char *a
     ASSERT(utf16String);
     ASSERT(asciiString);
     while (*r != 0 && w < e) {
-        char c = *r++;
-        if ((c >= 'a') && (c <= 'z')) {
-            c += ('A' - 'a');
-        }
-        if ((c < ' ') || (c > 'Z')) { // not in any valid range?
-            *w++ = (UWORD) c; // leave untranslated
-        } else if ((c >= '0') && (c <= '9')) { // digit?
-            *w++ = ASCII_TO_UTF16[alphabet][26 + (int) c - '0'];
-        } else if (c < 'A') { // valid but not a letter (e.g. a dot, a space...)
-            *w++ = (UWORD) c; // leave untranslated
+        const int i = alphabetIndexOf(*r);
+        if (i < 0) {
+            *w++ = (UWORD) *r; // leave untranslated
         } else {
-            *w++ = ASCII_TO_UTF16[alphabet][c - 'A'];
+            *w++ = ASCII_TO_UTF16[alphabet][i];
         }
+        r++;
     }
     *w = 0;
     return utf16String;
 }
 
 
-// PUBLIC - convert as much as will fit of mapcode into utf16String
-UWORD *convertToAlphabet(UWORD *utf16String, int maxLength, const char *asciiString,
-                         enum Alphabet alphabet) // 0=roman, 2=cyrillic
-{
-    UWORD *startbuf = utf16String;
-    UWORD *lastspot = &utf16String[maxLength - 1];
-    ASSERT(utf16String);
+// convert mapcode string to alphabet, into utf8 (at most maxLength - 1 characters, each up to 3 bytes)
+static char *encodeUtf8(char *utf8String, const int maxLength, const char *asciiString, const enum Alphabet alphabet) {
+    char *u = utf8String;
+    const char *r = asciiString;
+    const char *e = asciiString + maxLength - 1;
+    ASSERT(utf8String);
+    ASSERT(asciiString);
+    while (*r != 0 && r < e) {
+        const int i = alphabetIndexOf(*r);
+        if (i < 0) {
+            *u++ = *r; // leave untranslated
+        } else {
+            const AlphabetUtf8Char *c = &ASCII_TO_UTF8[alphabet][i];
+            memcpy(u, c->utf8, 4); // copies up to 3 bytes, plus padding that is overwritten or ignored
+            u += c->length;
+        }
+        r++;
+    }
+    *u = 0;
+    return utf8String;
+}
+
+
+// convert as much as will fit of mapcode into utf16String (FLAG_UTF16_STRING) or utf8String (FLAG_UTF8_STRING);
+// maxLength is the number of characters (including the zero-terminator) of the result
+static void convertToAlphabetString(void *target, int maxLength, const char *asciiString,
+                                    const enum Alphabet alphabet, const int interpretAsUtf16) {
+    UWORD *utf16String = (UWORD *) target;
+    char *utf8String = (char *) target;
+    int length = 0;
+    ASSERT(target);
     ASSERT(asciiString);
     if (maxLength > 0) {
         char targetAsciiString[MAX_MAPCODE_RESULT_ASCII_LEN] = "";
@@ -2727,12 +3125,20 @@ UWORD *convertToAlphabet(UWORD *utf16String, int maxLength, const char *asciiStr
             const char *e = strchr(asciiString, ' ');
             if (e) {
                 while (asciiString <= e) {
-                    if (utf16String == lastspot) { // buffer fully filled?
+                    if (length == maxLength - 1) { // buffer fully filled?
                         // zero-terminate and return
-                        *utf16String = 0;
-                        return startbuf;
+                        if (interpretAsUtf16) {
+                            utf16String[length] = 0;
+                        } else {
+                            utf8String[length] = 0;
+                        }
+                        return;
+                    }
+                    if (interpretAsUtf16) {
+                        utf16String[length++] = (UWORD) *asciiString++;
+                    } else {
+                        utf8String[length++] = *asciiString++;
                     }
-                    *utf16String++ = (UWORD) *asciiString++;
                 }
                 while (*asciiString == ' ') {
                     asciiString++;
@@ -2764,9 +3170,21 @@ UWORD *convertToAlphabet(UWORD *utf16String, int maxLength, const char *asciiStr
             }
         }
 
-        encodeUtf16(utf16String, 1 + (int) (lastspot - utf16String), asciiString, alphabet);
+        if (interpretAsUtf16) {
+            encodeUtf16(utf16String + length, maxLength - length, asciiString, alphabet);
+        } else {
+            encodeUtf8(utf8String + length, maxLength - length, asciiString, alphabet);
+        }
     }
-    return startbuf;
+}
+
+
+// PUBLIC - convert as much as will fit of mapcode into utf16String
+UWORD *convertToAlphabet(UWORD *utf16String, int maxLength, const char *asciiString,
+                         enum Alphabet alphabet) // 0=roman, 2=cyrillic
+{
+    convertToAlphabetString(utf16String, maxLength, asciiString, alphabet, FLAG_UTF16_STRING);
+    return utf16String;
 }
 
 
@@ -2806,9 +3224,75 @@ UWORD *convertMapcodeToAlphabetUtf16(UWORD *utf16String, const char *mapcodeStri
 }
 
 
+// Caller must make sure utf8String can hold at least MAX_MAPCODE_RESULT_UTF8_LEN + 1 characters.
 char *convertMapcodeToAlphabetUtf8(char *utf8String, const char *mapcodeString, enum Alphabet alphabet) {
-    UWORD utf16[MAX_MAPCODE_RESULT_UTF16_LEN + 1];
-    return convertUtf16ToUtf8(utf8String, convertMapcodeToAlphabetUtf16(utf16, mapcodeString, alphabet));
+    ASSERT(utf8String);
+    ASSERT(mapcodeString);
+    ASSERT(alphabet > _ALPHABET_MIN && alphabet < _ALPHABET_MAX);
+    *utf8String = 0;
+    if (strlen(mapcodeString) < MAX_MAPCODE_RESULT_ASCII_LEN) {
+        convertToAlphabetString(utf8String, MAX_MAPCODE_RESULT_UTF16_LEN, mapcodeString, alphabet, FLAG_UTF8_STRING);
+    }
+    return utf8String;
+}
+
+
+// PUBLIC - convert nrMapcodes mapcodes to alphabet, as consecutive (zero-terminated) utf8 strings in utf8Buffer;
+// returns the number of mapcodes converted (less if utf8Buffer is full)
+int convertMapcodesToAlphabetUtf8(char *utf8Buffer, int utf8BufferSize, const char *const *mapcodeStrings,
+                                  int nrMapcodes, enum Alphabet alphabet) {
+    char *out = utf8Buffer;
+    const char *end = utf8Buffer + utf8BufferSize;
+    int i;
+    if ((utf8Buffer == NULL) || (mapcodeStrings == NULL) || (utf8BufferSize < 0) || (nrMapcodes < 0) ||
+        (alphabet <= _ALPHABET_MIN) || (alphabet >= _ALPHABET_MAX)) {
+        return ERR_BAD_ARGUMENTS;
+    }
+    for (i = 0; i < nrMapcodes; i++) {
+        if (end - out > MAX_MAPCODE_RESULT_UTF8_LEN) { // always fits: convert in place
+            out += strlen(convertMapcodeToAlphabetUtf8(out, mapcodeStrings[i], alphabet)) + 1;
+        } else {
+            char utf8String[MAX_MAPCODE_RESULT_UTF8_LEN + 1];
+            const int len = (int) strlen(convertMapcodeToAlphabetUtf8(utf8String, mapcodeStrings[i], alphabet));
+            if (len >= end - out) {
+                return i; // utf8Buffer is full
+            }
+            memcpy(out, utf8String, (size_t) len + 1);
+            out += len + 1;
+        }
+    }
+    return nrMapcodes;
+}
+
+
+// PUBLIC - convert nrMapcodes mapcodes to alphabet, as consecutive (zero-terminated) utf16 strings in utf16Buffer;
+// returns the number of mapcodes converted (less if utf16Buffer is full)
+int convertMapcodesToAlphabetUtf16(UWORD *utf16Buffer, int utf16BufferSize, const char *const *mapcodeStrings,
+                                   int nrMapcodes, enum Alphabet alphabet) {
+    UWORD *out = utf16Buffer;
+    const UWORD *end = utf16Buffer + utf16BufferSize;
+    int i;
+    if ((utf16Buffer == NULL) || (mapcodeStrings == NULL) || (utf16BufferSize < 0) || (nrMapcodes < 0) ||
+        (alphabet <= _ALPHABET_MIN) || (alphabet >= _ALPHABET_MAX)) {
+        return ERR_BAD_ARGUMENTS;
+    }
+    for (i = 0; i < nrMapcodes; i++) {
+        UWORD utf16String[MAX_MAPCODE_RESULT_UTF16_LEN + 1];
+        UWORD *utf16 = (end - out > MAX_MAPCODE_RESULT_UTF16_LEN) ? out : utf16String; // convert in place if it fits
+        int len = 0;
+        convertMapcodeToAlphabetUtf16(utf16, mapcodeStrings[i], alphabet);
+        while (utf16[len]) {
+            len++;
+        }
+        if (utf16 != out) {
+            if (len >= end - out) {
+                return i; // utf16Buffer is full
+            }
+            memcpy(out, utf16String, ((size_t) len + 1) * sizeof(UWORD));
+        }
+        out += len + 1;
+    }
+    return nrMapcodes;
 }
 
 
@@ -2840,15 +3324,20 @@ char *getTerritoryIsoName(char *territoryISO, enum Territory territory, int useS
 
 
 // PUBLIC - returns negative if territory is not a code that has a parent country
+enum Territory getParentCountryOfWithContext(const MapcodeContext *mapcodeContext, enum Territory territory) {
+    return parentTerritoryOf(DATA_OF_CONTEXT(mapcodeContext), territory);
+}
+
+
 enum Territory getParentCountryOf(enum Territory territory) {
-    return parentTerritoryOf(territory);
+    return getParentCountryOfWithContext(NULL, territory);
 }
 
 
 // PUBLIC - returns territory if it is a country, or parent country if territory is a state.
 // returns megative if territory is invalid.
-enum Territory getCountryOrParentCountry(enum Territory territory) {
-    const enum Territory tp = getParentCountryOf(territory);
+enum Territory getCountryOrParentCountryWithContext(const MapcodeContext *mapcodeContext, enum Territory territory) {
+    const enum Territory tp = getParentCountryOfWithContext(mapcodeContext, territory);
     if (tp != TERRITORY_NONE) {
         return tp;
     }
@@ -2856,27 +3345,34 @@ enum Territory getCountryOrParentCountry(enum Territory territory) {
 }
 
 
+enum Territory getCountryOrParentCountry(enum Territory territory) {
+    return getCountryOrParentCountryWithContext(NULL, territory);
+}
+
+
 // PUBLIC - returns nonzero if coordinate is near more than one territory border
-int multipleBordersNearby(double latDeg, double lonDeg, enum Territory territory) {
+int multipleBordersNearbyWithContext(const MapcodeContext *mapcodeContext, double latDeg, double lonDeg,
+                                     enum Territory territory) {
+    const MapcodeData *data = DATA_OF_CONTEXT(mapcodeContext);
     const enum Territory ccode = territory;
     if ((ccode > _TERRITORY_MIN) && (ccode != TERRITORY_AAA)) { // valid territory, not earth
-        const enum Territory parentTerritoryCode = getParentCountryOf(territory);
+        const enum Territory parentTerritoryCode = parentTerritoryOf(data, territory);
         if (parentTerritoryCode != TERRITORY_NONE) {
             // there is a parent! check its borders as well...
-            if (multipleBordersNearby(latDeg, lonDeg, parentTerritoryCode)) {
+            if (multipleBordersNearbyWithContext(mapcodeContext, latDeg, lonDeg, parentTerritoryCode)) {
                 return 1;
             }
         }
         {
             int m;
             int nrFound = 0;
-            const int from = firstRec(ccode);
-            const int upto = lastRec(ccode);
+            const int from = firstRec(data, ccode);
+            const int upto = lastRec(data, ccode);
             Point32 coord32;
             convertCoordsToMicrosAndFractions(&coord32, NULL, NULL, latDeg, lonDeg);
             for (m = upto; m >= from; m--) {
-                if (!IS_RESTRICTED(m)) {
-                    if (isNearBorderOf(&coord32, TERRITORY_BOUNDARY(m))) {
+                if (!IS_RESTRICTED(data, m)) {
+                    if (isNearBorderOf(&coord32, TERRITORY_BOUNDARY(data, m))) {
                         nrFound++;
                         if (nrFound > 1) {
                             return 1;
@@ -2890,17 +3386,34 @@ int multipleBordersNearby(double latDeg, double lonDeg, enum Territory territory
 }
 
 
-static int compareAlphaCode(const void *e1, const void *e2) {
-    const AlphaRec *a1 = (const AlphaRec *) e1;
-    const AlphaRec *a2 = (const AlphaRec *) e2;
-    ASSERT(e1);
-    ASSERT(e2);
-    return strcmp(a1->alphaCode, a2->alphaCode);
-} // cmp
+int multipleBordersNearby(double latDeg, double lonDeg, enum Territory territory) {
+    return multipleBordersNearbyWithContext(NULL, latDeg, lonDeg, territory);
+}
+
+
+// PRIVATE - converts the ascii lowercase letters in the 4 bytes of w to uppercase
+static unsigned int makeUppercaseWord(const unsigned int w) {
+    const unsigned int heptets = w & 0x7F7F7F7FU;
+    const unsigned int atLeastA = heptets + 0x1F1F1F1FU;    // high bit set for bytes >= 'a'
+    const unsigned int aboveZ = heptets + 0x05050505U;      // high bit set for bytes > 'z'
+    return w ^ (((atLeastA & ~aboveZ & ~w) & 0x80808080U) >> 2);
+}
+
+
+// PRIVATE - hash of a packed ISO code (see tools/generate_iso_hash.py)
+static unsigned int hashIsoCode(const unsigned int *code, const unsigned int seed) {
+    unsigned int h = (code[0] ^ seed) * 0x9E3779B1U;
+    h ^= h >> 15;
+    h = (h ^ code[1]) * 0x85EBCA77U;
+    return h ^ (h >> 13);
+}
+
 
 static enum Territory findMatch(const int parentNumber, const char *territoryISO) {
-    // build an uppercase search term
-    char codeISO[MAX_ISOCODE_ASCII_LEN + 1];
+    // pack an uppercase search term (characters 0-3 in code[0], 4-6 in code[1], lowest byte first)
+    unsigned char codeISO[MAX_ISOCODE_ASCII_LEN + 1];
+    unsigned int code[2];
+    const IsoHashRec *p;
     const char *r = territoryISO;
     int len = 0;
     ASSERT(territoryISO);
@@ -2909,41 +3422,35 @@ static enum Territory findMatch(const int parentNumber, const char *territoryISO
         return TERRITORY_NONE;
     }
     if (parentNumber > 0) {
-        codeISO[0] = PARENTS_2[3 * parentNumber - 3];
-        codeISO[1] = PARENTS_2[3 * parentNumber - 2];
+        codeISO[0] = (unsigned char) PARENTS_2[3 * parentNumber - 3];
+        codeISO[1] = (unsigned char) PARENTS_2[3 * parentNumber - 2];
         codeISO[2] = '-';
         len = 3;
     }
     while ((len < MAX_ISOCODE_ASCII_LEN) && (*r > 32)) {
-        codeISO[len++] = *r++;
+        codeISO[len++] = (unsigned char) *r++;
     }
     if (*r > 32) {
         return TERRITORY_NONE;
     }
-    codeISO[len] = 0;
-    makeUppercase(codeISO);
-    { // binary-search the result
-        const AlphaRec *p;
-        AlphaRec t;
-        t.alphaCode = codeISO;
-
-        p = (const AlphaRec *) bsearch(&t, ALPHA_SEARCH, NR_TERRITORY_RECS, sizeof(AlphaRec), compareAlphaCode);
-        if (p) {
-            if (strcmp(t.alphaCode, p->alphaCode) == 0) { // only interested in PERFECT match
-                return p->territory;
-            } // match
-        } // found
-    } //
+    while (len <= MAX_ISOCODE_ASCII_LEN) {
+        codeISO[len++] = 0;
+    }
+    code[0] = makeUppercaseWord(codeISO[0] | (codeISO[1] << 8) | (codeISO[2] << 16) | ((unsigned int) codeISO[3] << 24));
+    code[1] = makeUppercaseWord(codeISO[4] | (codeISO[5] << 8) | (codeISO[6] << 16));
+
+    // look up the code in the minimal perfect hash
+    p = &ISO_HASH[hashIsoCode(code, ISO_HASH_DISPLACEMENT[hashIsoCode(code, ISO_HASH_SEED) % NR_ISO_HASH_BUCKETS]) %
+                  NR_ISO_HASH];
+    if ((p->code[0] == code[0]) && (p->code[1] == code[1])) { // only interested in PERFECT match
+        return p->territory;
+    }
     return TERRITORY_NONE;
 }
 
 
-// PUBLIC - returns territory of territoryISO (or negative if not found).
-// optionalTerritoryContext: pass to handle ambiguities (pass TERRITORY_NONE if unknown).
-enum Territory getTerritoryCode(const char *territoryISO, enum Territory optionalTerritoryContext) {
-    if (territoryISO == NULL) {
-        return TERRITORY_NONE;
-    }
+// PRIVATE - returns territory of territoryISO, with parentNumber the parent number of the territory context
+static enum Territory getTerritoryCode_internal(const char *territoryISO, const int parentNumber) {
     ASSERT(territoryISO);
     while (*territoryISO > 0 && *territoryISO <= 32) {
         territoryISO++;
@@ -2954,13 +3461,8 @@ enum Territory getTerritoryCode(const char *territoryISO, enum Territory optiona
             return findMatch(getParentNumber(territoryISO, 2), territoryISO + 3);
         } else if (territoryISO[2] && territoryISO[3] == '-') {
             return findMatch(getParentNumber(territoryISO, 3), territoryISO + 4);
-        } else {
-            enum Territory b;
-            int parentNumber = 0;
-            if (optionalTerritoryContext > _TERRITORY_MIN) {
-                parentNumber = PARENT_NUMBER[INDEX_OF_TERRITORY(getCountryOrParentCountry(optionalTerritoryContext))];
-            }
-            b = findMatch(parentNumber, territoryISO);
+        } else if (parentNumber > 0) {
+            const enum Territory b = findMatch(parentNumber, territoryISO);
             if (b != TERRITORY_NONE) {
                 return b;
             }
@@ -2971,15 +3473,70 @@ enum Territory getTerritoryCode(const char *territoryISO, enum Territory optiona
 }
 
 
+// PRIVATE - returns the parent number to use for a territory context
+static int getParentNumberOfContext(const MapcodeData *data, const enum Territory optionalTerritoryContext) {
+    if ((optionalTerritoryContext > _TERRITORY_MIN) && (optionalTerritoryContext < _TERRITORY_MAX)) {
+        const enum Territory parent = parentTerritoryOf(data, optionalTerritoryContext);
+        return data->parentNumber[INDEX_OF_TERRITORY(parent != TERRITORY_NONE ? parent : optionalTerritoryContext)];
+    }
+    return 0;
+}
+
+
+// PRIVATE - returns territory of territoryISO (or negative if not found), using the parents in data
+static enum Territory getTerritoryCodeOf(const MapcodeData *data, const char *territoryISO,
+                                         enum Territory optionalTerritoryContext) {
+    if (territoryISO == NULL) {
+        return TERRITORY_NONE;
+    }
+    return getTerritoryCode_internal(territoryISO, getParentNumberOfContext(data, optionalTerritoryContext));
+}
+
+
+// PUBLIC - returns territory of territoryISO (or negative if not found).
+// optionalTerritoryContext: pass to handle ambiguities (pass TERRITORY_NONE if unknown).
+enum Territory getTerritoryCodeWithContext(const MapcodeContext *mapcodeContext, const char *territoryISO,
+                                           enum Territory optionalTerritoryContext) {
+    return getTerritoryCodeOf(DATA_OF_CONTEXT(mapcodeContext), territoryISO, optionalTerritoryContext);
+}
+
+
+enum Territory getTerritoryCode(const char *territoryISO, enum Territory optionalTerritoryContext) {
+    return getTerritoryCodeOf(defaultMapcodeContext.data, territoryISO, optionalTerritoryContext);
+}
+
+
+// PUBLIC - stores the territory of each of nrTerritories territoryISOs in territories (TERRITORY_NONE if not
+// found, or NULL); returns the number of territories found, or negative in case of an error
+int getTerritoryCodes(enum Territory *territories, const char *const *territoryISOs, int nrTerritories,
+                      enum Territory optionalTerritoryContext) {
+    const int parentNumber = getParentNumberOfContext(defaultMapcodeContext.data, optionalTerritoryContext);
+    int found = 0;
+    int i;
+    if ((territories == NULL) || (territoryISOs == NULL) || (nrTerritories < 0)) {
+        return ERR_BAD_ARGUMENTS;
+    }
+    for (i = 0; i < nrTerritories; ++i) {
+        territories[i] = (territoryISOs[i] == NULL) ? TERRITORY_NONE :
+                         getTerritoryCode_internal(territoryISOs[i], parentNumber);
+        if (territories[i] != TERRITORY_NONE) {
+            found++;
+        }
+    }
+    return found;
+}
+
+
 // PUBLIC - decode string into lat,lon; returns negative in case of error
-enum MapcodeError decodeMapcodeToLatLonUtf8(double *latDeg, double *lonDeg,
-                                            const char *mapcode, enum Territory territory,
-                                            MapcodeElements *mapcodeElements) {
+enum MapcodeError decodeMapcodeToLatLonUtf8WithContext(MapcodeContext *mapcodeContext, double *latDeg, double *lonDeg,
+                                                       const char *mapcode, enum Territory territory,
+                                                       MapcodeElements *mapcodeElements) {
     if ((latDeg == NULL) || (lonDeg == NULL) || (mapcode == NULL)) {
         return ERR_BAD_ARGUMENTS;
     } else {
         enum MapcodeError ret;
         DecodeRec dec = {
+                NULL,
                 {"", TERRITORY_NONE, "", 0, ""},
                 0,
                 0,
@@ -2988,12 +3545,15 @@ enum MapcodeError decodeMapcodeToLatLonUtf8(double *latDeg, double *lonDeg,
                 0,
                 {0.0, 0.0},
                 {0, 0},
-                {0.0, 0.0, 0.0, 0.0}
+                {0.0, 0.0, 0.0, 0.0},
+                TERRITORY_NONE
         };
+        dec.data = DATA_OF_CONTEXT(mapcodeContext);
         dec.orginput = mapcode;
         dec.context = territory;
 
         ret = decoderEngine(&dec, 0);
+        countDecode(mapcodeContext, ret);
         *latDeg = dec.result.lat;
         *lonDeg = dec.result.lon;
 
@@ -3005,15 +3565,23 @@ enum MapcodeError decodeMapcodeToLatLonUtf8(double *latDeg, double *lonDeg,
 }
 
 
+enum MapcodeError decodeMapcodeToLatLonUtf8(double *latDeg, double *lonDeg,
+                                            const char *mapcode, enum Territory territory,
+                                            MapcodeElements *mapcodeElements) {
+    return decodeMapcodeToLatLonUtf8WithContext(NULL, latDeg, lonDeg, mapcode, territory, mapcodeElements);
+}
+
+
 // PUBLIC - decode string into lat,lon; returns negative in case of error
-enum MapcodeError decodeMapcodeToLatLonUtf16(double *latDeg, double *lonDeg,
-                                             const UWORD *mapcode, enum Territory territory,
-                                             MapcodeElements *mapcodeElements) {
+enum MapcodeError decodeMapcodeToLatLonUtf16WithContext(MapcodeContext *mapcodeContext, double *latDeg, double *lonDeg,
+                                                        const UWORD *mapcode, enum Territory territory,
+                                                        MapcodeElements *mapcodeElements) {
     if ((latDeg == NULL) || (lonDeg == NULL) || (mapcode == NULL)) {
         return ERR_BAD_ARGUMENTS;
     } else {
         enum MapcodeError ret;
         DecodeRec dec = {
+                NULL,
                 {"", TERRITORY_NONE, "", 0, ""},
                 0,
                 0,
@@ -3022,12 +3590,15 @@ enum MapcodeError decodeMapcodeToLatLonUtf16(double *latDeg, double *lonDeg,
                 0,
                 {0.0, 0.0},
                 {0, 0},
-                {0.0, 0.0, 0.0, 0.0}
+                {0.0, 0.0, 0.0, 0.0},
+                TERRITORY_NONE
         };
+        dec.data = DATA_OF_CONTEXT(mapcodeContext);
         dec.orginput = (const char *) mapcode;
         dec.context = territory;
 
         ret = decoderEngine(&dec, FLAG_UTF16_STRING);
+        countDecode(mapcodeContext, ret);
         *latDeg = dec.result.lat;
         *lonDeg = dec.result.lon;
 
@@ -3039,50 +3610,335 @@ enum MapcodeError decodeMapcodeToLatLonUtf16(double *latDeg, double *lonDeg,
 }
 
 
-// PUBLIC - encode lat,lon for territory to a mapcode with extraDigits accuracy
-int
-encodeLatLonToSingleMapcode(char *mapcode, double latDeg, double lonDeg, enum Territory territory, int extraDigits) {
-    Mapcodes rlocal;
-    int ret;
-    ASSERT(mapcode);
-    if (extraDigits < 0) {
-        return 0;
-    }
-    if (extraDigits > MAX_PRECISION_DIGITS) {
-        extraDigits = MAX_PRECISION_DIGITS;
-    }
-    if (territory <= TERRITORY_UNKNOWN) {
-        return 0;
-    }
-    ret = encodeLatLonToMapcodes_internal(&rlocal, latDeg, lonDeg, territory, 1, DEBUG_STOP_AT, extraDigits);
-    *mapcode = 0;
-    if (ret <= 0) { // no solutions?
-        return ret;
-    }
-    // prefix territory unless international
-    strcpy(mapcode, rlocal.mapcode[0]);
-    return 1;
+enum MapcodeError decodeMapcodeToLatLonUtf16(double *latDeg, double *lonDeg,
+                                             const UWORD *mapcode, enum Territory territory,
+                                             MapcodeElements *mapcodeElements) {
+    return decodeMapcodeToLatLonUtf16WithContext(NULL, latDeg, lonDeg, mapcode, territory, mapcodeElements);
 }
 
 
-// PUBLIC - encode lat,lon for territory to a selected mapcode (from all results) with extraDigits accuracy
-int
-encodeLatLonToSelectedMapcode(char *mapcode, double latDeg, double lonDeg, enum Territory territory, int extraDigits, int indexOfSelected) {
-    Mapcodes mapcodes;
-    int nrOfResults = 0;
-    nrOfResults = encodeLatLonToMapcodes(&mapcodes, latDeg, lonDeg, territory, extraDigits);
-    ASSERT(nrOfResults == mapcodes.count);
-    if ((nrOfResults <= 0) || (indexOfSelected < 0) || (indexOfSelected > nrOfResults)) {
-        return 0;
+// parse string into mapcodeElements (cleared in case of error); returns negative in case of error
+static enum MapcodeError parseMapcodeElements(const MapcodeData *data, MapcodeElements *mapcodeElements,
+                                              const char *string, int interpretAsUtf16, enum Territory territory) {
+    enum MapcodeError ret;
+    const MapcodeElements empty = {"", TERRITORY_NONE, "", 0, ""};
+    memcpy(mapcodeElements, &empty, sizeof(MapcodeElements));
+    ret = parseMapcodeString(data, mapcodeElements, string, interpretAsUtf16, territory);
+    if (ret) {
+        clearParsedMapcodeElements(mapcodeElements);
     }
-    strcpy(mapcode, mapcodes.mapcode[indexOfSelected]);
-    return nrOfResults;
+    return ret;
 }
 
 
-// PUBLIC - encode lat,lon for (optional) territory to mapcodes with extraDigits accuracy
-int
-encodeLatLonToMapcodes(Mapcodes *mapcodes, double latDeg, double lonDeg, enum Territory territory, int extraDigits) {
+// PUBLIC - parse utf8 string into mapcodeElements; returns negative in case of error
+enum MapcodeError parseMapcodeUtf8(MapcodeElements *mapcodeElements, const char *utf8string,
+                                   enum Territory territory) {
+    if ((mapcodeElements == NULL) || (utf8string == NULL)) {
+        return ERR_BAD_ARGUMENTS;
+    }
+    return parseMapcodeElements(defaultMapcodeContext.data, mapcodeElements, utf8string, FLAG_UTF8_STRING, territory);
+}
+
+
+// PUBLIC - parse utf16 string into mapcodeElements; returns negative in case of error
+enum MapcodeError parseMapcodeUtf16(MapcodeElements *mapcodeElements, const UWORD *utf16string,
+                                    enum Territory territory) {
+    if ((mapcodeElements == NULL) || (utf16string == NULL)) {
+        return ERR_BAD_ARGUMENTS;
+    }
+    return parseMapcodeElements(defaultMapcodeContext.data, mapcodeElements, (const char *) utf16string,
+                                FLAG_UTF16_STRING, territory);
+}
+
+
+// PUBLIC - decode mapcodeElements (from parseMapcodeUtf8/Utf16) into lat,lon; returns negative in case of error
+enum MapcodeError decodeParsedMapcodeWithContext(MapcodeContext *mapcodeContext, double *latDeg, double *lonDeg,
+                                                 const MapcodeElements *mapcodeElements, enum Territory territory) {
+    if ((latDeg == NULL) || (lonDeg == NULL) || (mapcodeElements == NULL) || (*mapcodeElements->properMapcode == 0)) {
+        return ERR_BAD_ARGUMENTS;
+    } else {
+        enum MapcodeError ret;
+        DecodeRec dec = {
+                NULL,
+                {"", TERRITORY_NONE, "", 0, ""},
+                0,
+                0,
+                0,
+                TERRITORY_NONE,
+                0,
+                {0.0, 0.0},
+                {0, 0},
+                {0.0, 0.0, 0.0, 0.0},
+                TERRITORY_NONE
+        };
+        dec.data = DATA_OF_CONTEXT(mapcodeContext);
+        ret = decodeParsedMapcodeElements(&dec, mapcodeElements, territory);
+        countDecode(mapcodeContext, ret);
+        *latDeg = dec.result.lat;
+        *lonDeg = dec.result.lon;
+        return ret;
+    }
+}
+
+
+enum MapcodeError decodeParsedMapcode(double *latDeg, double *lonDeg,
+                                      const MapcodeElements *mapcodeElements, enum Territory territory) {
+    return decodeParsedMapcodeWithContext(NULL, latDeg, lonDeg, mapcodeElements, territory);
+}
+
+
+// PUBLIC - decode utf8 string in each of the candidate territories; returns the number of results (or negative
+// in case of a parse error). A territory is reported once, even if several candidates decode in it.
+int decodeMapcodeInTerritoriesWithContext(MapcodeContext *mapcodeContext, MapcodeDecodeResult *results,
+                                          const char *utf8string, const enum Territory *candidates, int nrCandidates) {
+    const MapcodeData *data = DATA_OF_CONTEXT(mapcodeContext);
+    MapcodeElements mapcodeElements;
+    unsigned char found[_TERRITORY_MAX - _TERRITORY_MIN];
+    enum MapcodeError err;
+    int nrResults = 0;
+    int i;
+    if ((results == NULL) || (utf8string == NULL) || (candidates == NULL && nrCandidates > 0)) {
+        return ERR_BAD_ARGUMENTS;
+    }
+    err = parseMapcodeElements(data, &mapcodeElements, utf8string, FLAG_UTF8_STRING, TERRITORY_NONE);
+    if (err) {
+        countDecode(mapcodeContext, err);
+        return err;
+    }
+    memset(found, 0, sizeof(found));
+    for (i = 0; i < nrCandidates; i++) {
+        DecodeRec dec = {
+                NULL,
+                {"", TERRITORY_NONE, "", 0, ""},
+                0,
+                0,
+                0,
+                TERRITORY_NONE,
+                0,
+                {0.0, 0.0},
+                {0, 0},
+                {0.0, 0.0, 0.0, 0.0},
+                TERRITORY_NONE
+        };
+        dec.data = data;
+        err = decodeParsedMapcodeElements(&dec, &mapcodeElements, candidates[i]);
+        countDecode(mapcodeContext, err);
+        if ((err == ERR_OK) && !found[INDEX_OF_TERRITORY(dec.territory)]) {
+            found[INDEX_OF_TERRITORY(dec.territory)] = 1;
+            results[nrResults].territory = dec.territory;
+            results[nrResults].latDeg = dec.result.lat;
+            results[nrResults].lonDeg = dec.result.lon;
+            nrResults++;
+        }
+    }
+    return nrResults;
+}
+
+
+int decodeMapcodeInTerritories(MapcodeDecodeResult *results, const char *utf8string,
+                               const enum Territory *candidates, int nrCandidates) {
+    return decodeMapcodeInTerritoriesWithContext(NULL, results, utf8string, candidates, nrCandidates);
+}
+
+
+// updates the public fields of parser after a change of its input
+static enum MapcodeError updateMapcodeParser(MapcodeParser *parser) {
+    if (parser->length > MAX_MAPCODE_PARSER_INPUT_LEN) {
+        parser->status = ERR_BAD_ARGUMENTS;
+    } else {
+        const MapcodeParserStep *step = &parser->step[parser->length];
+        MapcodeParserStep final;
+        parser->status = getParseStatus(&final, step);
+        parser->territoryCode = step->territoryCode;
+        parser->alphabet = (enum Alphabet) step->alphabet;
+    }
+    return parser->status;
+}
+
+
+// adds the character cx (romanised, or negative in case of a utf8 error) to the parser input;
+// next is the state after the last character, with the alphabet of cx already noted
+static void appendToMapcodeParser(MapcodeParser *parser, MapcodeParserStep *next, const int cx) {
+    if (parser->length >= MAX_MAPCODE_PARSER_INPUT_LEN) {
+        parser->length++; // only counted, so that removing characters keeps working
+        return;
+    }
+    if (next->state >= 0) {
+        if (cx < 0) {
+            next->state = cx;
+        } else {
+            const int hadTerritory = next->territoryLength;
+            parseCharacter(next, parser->clean, (unsigned char) cx);
+            if (!hadTerritory && next->territoryLength && next->state >= 0) {
+                next->territoryCode = getParsedTerritory(defaultMapcodeContext.data, next, parser->clean,
+                                                         parser->territory);
+            }
+        }
+    }
+    memcpy(&parser->step[++parser->length], next, sizeof(MapcodeParserStep));
+}
+
+
+// PUBLIC - start parsing a new mapcode in context of territory
+void initMapcodeParser(MapcodeParser *parser, enum Territory territory) {
+    ASSERT(parser);
+    parser->territory = territory;
+    parser->length = 0;
+    initParseStep(&parser->step[0], territory);
+    updateMapcodeParser(parser);
+}
+
+
+// PUBLIC - add utf8 characters to the parser input; returns the status of the input so far
+enum MapcodeError appendToMapcodeParserUtf8(MapcodeParser *parser, const char *utf8String) {
+    const unsigned char *utf8 = (const unsigned char *) utf8String;
+    if ((parser == NULL) || (utf8String == NULL)) {
+        return ERR_BAD_ARGUMENTS;
+    }
+    while (*utf8) {
+        MapcodeParserStep next;
+        int cx;
+        memcpy(&next, &parser->step[parser->length < MAX_MAPCODE_PARSER_INPUT_LEN ?
+                                    parser->length : MAX_MAPCODE_PARSER_INPUT_LEN], sizeof(MapcodeParserStep));
+        cx = parseUtf8Character(&next, &utf8);
+        appendToMapcodeParser(parser, &next, cx);
+        if (cx < 0) {
+            break; // the rest of the string can not be trusted
+        }
+    }
+    return updateMapcodeParser(parser);
+}
+
+
+// PUBLIC - add utf16 characters to the parser input; returns the status of the input so far
+enum MapcodeError appendToMapcodeParserUtf16(MapcodeParser *parser, const UWORD *utf16String) {
+    if ((parser == NULL) || (utf16String == NULL)) {
+        return ERR_BAD_ARGUMENTS;
+    }
+    for (; *utf16String; utf16String++) {
+        MapcodeParserStep next;
+        memcpy(&next, &parser->step[parser->length < MAX_MAPCODE_PARSER_INPUT_LEN ?
+                                    parser->length : MAX_MAPCODE_PARSER_INPUT_LEN], sizeof(MapcodeParserStep));
+        parseAlphabetOf(&next, *utf16String);
+        appendToMapcodeParser(parser, &next, getRomanVersionOf(*utf16String));
+    }
+    return updateMapcodeParser(parser);
+}
+
+
+// PUBLIC - remove the last character from the parser input; returns the status of the input so far
+enum MapcodeError removeLastFromMapcodeParser(MapcodeParser *parser) {
+    if (parser == NULL) {
+        return ERR_BAD_ARGUMENTS;
+    }
+    if (parser->length > 0) {
+        parser->length--;
+    }
+    return updateMapcodeParser(parser);
+}
+
+
+// PUBLIC - decode the parser input into lat,lon; returns negative in case of error
+enum MapcodeError decodeMapcodeParserToLatLon(double *latDeg, double *lonDeg,
+                                              const MapcodeParser *parser,
+                                              MapcodeElements *mapcodeElements) {
+    if ((latDeg == NULL) || (lonDeg == NULL) || (parser == NULL)) {
+        return ERR_BAD_ARGUMENTS;
+    } else {
+        enum MapcodeError ret = ERR_BAD_ARGUMENTS;
+        MapcodeParserStep final;
+        DecodeRec dec = {
+                NULL,
+                {"", TERRITORY_NONE, "", 0, ""},
+                0,
+                0,
+                0,
+                TERRITORY_NONE,
+                0,
+                {0.0, 0.0},
+                {0, 0},
+                {0.0, 0.0, 0.0, 0.0},
+                TERRITORY_NONE
+        };
+        dec.data = defaultMapcodeContext.data;
+        dec.context = parser->territory;
+
+        if (parser->length <= MAX_MAPCODE_PARSER_INPUT_LEN) {
+            ret = getParseStatus(&final, &parser->step[parser->length]);
+        }
+        if (ret == ERR_OK) {
+            ret = getParsedMapcodeElements(&dec.mapcodeElements, &final, parser->clean);
+        }
+        if (ret == ERR_OK) {
+            ret = decodeMapcodeElements(&dec);
+        } else {
+            clearParsedMapcodeElements(&dec.mapcodeElements);
+        }
+        *latDeg = dec.result.lat;
+        *lonDeg = dec.result.lon;
+
+        if (mapcodeElements) {
+            memcpy(mapcodeElements, &dec.mapcodeElements, sizeof(MapcodeElements));
+        }
+        return ret;
+    }
+}
+
+
+// PUBLIC - encode lat,lon for territory to a mapcode with extraDigits accuracy
+int encodeLatLonToSingleMapcodeWithContext(MapcodeContext *mapcodeContext, char *mapcode, double latDeg, double lonDeg,
+                                           enum Territory territory, int extraDigits) {
+    Mapcodes rlocal;
+    int ret;
+    ASSERT(mapcode);
+    if (extraDigits < 0) {
+        return 0;
+    }
+    if (extraDigits > MAX_PRECISION_DIGITS) {
+        extraDigits = MAX_PRECISION_DIGITS;
+    }
+    if (territory <= TERRITORY_UNKNOWN) {
+        return 0;
+    }
+    ret = encodeLatLonToMapcodes_internal(DATA_OF_CONTEXT(mapcodeContext), &rlocal, latDeg, lonDeg, territory, 1,
+                                          DEBUG_STOP_AT, extraDigits);
+    countEncode(mapcodeContext, ret);
+    *mapcode = 0;
+    if (ret <= 0) { // no solutions?
+        return ret;
+    }
+    // prefix territory unless international
+    strcpy(mapcode, rlocal.mapcode[0]);
+    return 1;
+}
+
+
+int
+encodeLatLonToSingleMapcode(char *mapcode, double latDeg, double lonDeg, enum Territory territory, int extraDigits) {
+    return encodeLatLonToSingleMapcodeWithContext(NULL, mapcode, latDeg, lonDeg, territory, extraDigits);
+}
+
+
+// PUBLIC - encode lat,lon for territory to a selected mapcode (from all results) with extraDigits accuracy
+int
+encodeLatLonToSelectedMapcode(char *mapcode, double latDeg, double lonDeg, enum Territory territory, int extraDigits, int indexOfSelected) {
+    Mapcodes mapcodes;
+    int nrOfResults = 0;
+    nrOfResults = encodeLatLonToMapcodes(&mapcodes, latDeg, lonDeg, territory, extraDigits);
+    ASSERT(nrOfResults == mapcodes.count);
+    if ((nrOfResults <= 0) || (indexOfSelected < 0) || (indexOfSelected > nrOfResults)) {
+        return 0;
+    }
+    strcpy(mapcode, mapcodes.mapcode[indexOfSelected]);
+    return nrOfResults;
+}
+
+
+// PUBLIC - encode lat,lon for (optional) territory to mapcodes with extraDigits accuracy
+int encodeLatLonToMapcodesWithContext(MapcodeContext *mapcodeContext, Mapcodes *mapcodes, double latDeg, double lonDeg,
+                                      enum Territory territory, int extraDigits) {
+    int nrResults;
     ASSERT(mapcodes);
     if (extraDigits < 0) {
         return 0;
@@ -3090,7 +3946,64 @@ encodeLatLonToMapcodes(Mapcodes *mapcodes, double latDeg, double lonDeg, enum Te
     if (extraDigits > MAX_PRECISION_DIGITS) {
         extraDigits = MAX_PRECISION_DIGITS;
     }
-    return encodeLatLonToMapcodes_internal(mapcodes, latDeg, lonDeg, territory, 0, DEBUG_STOP_AT, extraDigits);
+    nrResults = encodeLatLonToMapcodes_internal(DATA_OF_CONTEXT(mapcodeContext), mapcodes, latDeg, lonDeg, territory,
+                                                0, DEBUG_STOP_AT, extraDigits);
+    countEncode(mapcodeContext, nrResults);
+    return nrResults;
+}
+
+
+int
+encodeLatLonToMapcodes(Mapcodes *mapcodes, double latDeg, double lonDeg, enum Territory territory, int extraDigits) {
+    return encodeLatLonToMapcodesWithContext(NULL, mapcodes, latDeg, lonDeg, territory, extraDigits);
+}
+
+
+// PUBLIC - encode lat,lon for (optional) territory to mapcodes with all precisions: encodes with the maximum
+// precision and splits off the extensions, as every lower precision is a prefix of it
+int encodeLatLonToMapcodesWithPrecisionsWithContext(MapcodeContext *mapcodeContext, MapcodesWithPrecisions *mapcodes,
+                                                    double latDeg, double lonDeg, enum Territory territory) {
+    Mapcodes rlocal;
+    int i;
+    ASSERT(mapcodes);
+    memcpy(mapcodes->maxErrorInMeters, MAX_ERROR_IN_METERS, sizeof(MAX_ERROR_IN_METERS));
+    mapcodes->count = encodeLatLonToMapcodes_internal(DATA_OF_CONTEXT(mapcodeContext), &rlocal, latDeg, lonDeg,
+                                                      territory, 0, DEBUG_STOP_AT, MAX_PRECISION_DIGITS);
+    countEncode(mapcodeContext, mapcodes->count);
+    for (i = 0; i < mapcodes->count; i++) {
+        char *hyphen = strrchr(rlocal.mapcode[i], '-'); // the territory may contain a hyphen too
+        ASSERT(hyphen && (strlen(hyphen + 1) == MAX_PRECISION_DIGITS));
+        *hyphen = 0;
+        strcpy(mapcodes->mapcode[i], rlocal.mapcode[i]);
+        strcpy(mapcodes->extension[i], hyphen + 1);
+    }
+    return mapcodes->count;
+}
+
+
+int encodeLatLonToMapcodesWithPrecisions(MapcodesWithPrecisions *mapcodes, double latDeg, double lonDeg,
+                                         enum Territory territory) {
+    return encodeLatLonToMapcodesWithPrecisionsWithContext(NULL, mapcodes, latDeg, lonDeg, territory);
+}
+
+
+// PUBLIC - get the mapcode with extraDigits precision from the results of encodeLatLonToMapcodesWithPrecisions
+int getMapcodeWithPrecision(char *mapcode, const MapcodesWithPrecisions *mapcodes, int indexOfMapcode,
+                            int extraDigits) {
+    ASSERT(mapcode);
+    ASSERT(mapcodes);
+    if ((indexOfMapcode < 0) || (indexOfMapcode >= mapcodes->count) ||
+        (extraDigits < 0) || (extraDigits > MAX_PRECISION_DIGITS)) {
+        return 0;
+    }
+    strcpy(mapcode, mapcodes->mapcode[indexOfMapcode]);
+    if (extraDigits > 0) {
+        char *s = mapcode + strlen(mapcode);
+        *s++ = '-';
+        memcpy(s, mapcodes->extension[indexOfMapcode], (size_t) extraDigits);
+        s[extraDigits] = 0;
+    }
+    return 1;
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////
@@ -3100,27 +4013,406 @@ encodeLatLonToMapcodes(Mapcodes *mapcodes, double latDeg, double lonDeg, enum Te
 ///////////////////////////////////////////////////////////////////////////////////////////////
 
 // PUBLIC - returns most common alphabets for territory, NULL if error
-const TerritoryAlphabets *getAlphabetsForTerritory(enum Territory territory) {
+const TerritoryAlphabets *getAlphabetsForTerritoryWithContext(const MapcodeContext *mapcodeContext,
+                                                              enum Territory territory) {
     if (territory > _TERRITORY_MIN && territory < _TERRITORY_MAX) {
-        return &ALPHABETS_FOR_TERRITORY[INDEX_OF_TERRITORY(territory)];
+        return &DATA_OF_CONTEXT(mapcodeContext)->alphabetsForTerritory[INDEX_OF_TERRITORY(territory)];
     }
     return NULL;
 }
 
 
+const TerritoryAlphabets *getAlphabetsForTerritory(enum Territory territory) {
+    return getAlphabetsForTerritoryWithContext(NULL, territory);
+}
+
+
+// PRIVATE - skips the ascii bytes in s (up to end), 8 at a time
+static const unsigned char *skipAscii(const unsigned char *s, const unsigned char *end) {
+    unsigned int w[2];
+    while (end - s >= (int) sizeof(w)) {
+        memcpy(w, s, sizeof(w));
+        if ((w[0] | w[1]) & 0x80808080U) {
+            break;
+        }
+        s += sizeof(w);
+    }
+    while ((s < end) && (*s < 0x80)) {
+        s++;
+    }
+    return s;
+}
+
+
+// PUBLIC - returns the alphabet of the first non-roman character of utf8 (ALPHABET_ROMAN if there is none),
+// or _ALPHABET_MIN if that character is not recognized or utf8 is not valid
+enum Alphabet recognizeAlphabetUtf8(const char *utf8) {
+    const unsigned char *s = (const unsigned char *) utf8;
+    const unsigned char *end;
+    ASSERT(utf8);
+    if (utf8 == NULL) {
+        return _ALPHABET_MIN;
+    }
+    end = s + strlen(utf8);
+    for (;;) {
+        enum Alphabet alphabet;
+        s = skipAscii(s, end);
+        if (s == end) {
+            return ALPHABET_ROMAN;
+        }
+        // ALPHABET_OF has an entry per 64 characters: the lead byte of a 2-byte character determines the
+        // entry by itself, a 3-byte character needs its second byte as well
+        if ((*s >= 0xC0) && (*s < 0xE0) && (end - s >= 2) && ((s[1] & 0xC0) == 0x80)) {
+            alphabet = (enum Alphabet) ALPHABET_OF[*s & 0x1F];
+            s += 2;
+        } else if ((*s >= 0xE0) && (*s < 0xF0) && (end - s >= 3) && ((s[1] & 0xC0) == 0x80) &&
+                   ((s[2] & 0xC0) == 0x80)) {
+            alphabet = (enum Alphabet) ALPHABET_OF[((*s & 0x0F) << 6) + (s[1] & 0x3F)];
+            s += 3;
+        } else {
+            return _ALPHABET_MIN; // utf8 error (or a character above 0xFFFF)
+        }
+        if (alphabet != ALPHABET_ROMAN) {
+            return alphabet;
+        }
+    }
+}
+
+
+// PUBLIC - recognizes the alphabet of each of nrStrings utf8 strings; returns the number of recognized alphabets
+int recognizeAlphabetsUtf8(enum Alphabet *alphabets, const char *const *utf8Strings, int nrStrings) {
+    int i;
+    int found = 0;
+    if ((alphabets == NULL) || (utf8Strings == NULL) || (nrStrings < 0)) {
+        return ERR_BAD_ARGUMENTS;
+    }
+    for (i = 0; i < nrStrings; ++i) {
+        alphabets[i] = (utf8Strings[i] == NULL) ? _ALPHABET_MIN : recognizeAlphabetUtf8(utf8Strings[i]);
+        if (alphabets[i] != _ALPHABET_MIN) {
+            found++;
+        }
+    }
+    return found;
+}
+
+
+// PRIVATE - stores the romanised mapcode of mapcodeElements ("territory proper-extension", without territory
+// or extension if there is none) in ascii (of at least MAX_MAPCODE_RESULT_ASCII_LEN characters); returns its length
+static int getRomanisedMapcode(char *ascii, const MapcodeElements *mapcodeElements) {
+    int len = (int) strlen(mapcodeElements->territoryISO);
+    memcpy(ascii, mapcodeElements->territoryISO, (size_t) len);
+    if (len > 0) {
+        ascii[len++] = ' ';
+    }
+    strcpy(ascii + len, mapcodeElements->properMapcode);
+    len += (int) strlen(ascii + len);
+    if (*mapcodeElements->precisionExtension) {
+        ascii[len++] = '-';
+        strcpy(ascii + len, mapcodeElements->precisionExtension);
+        len += (int) strlen(ascii + len);
+    }
+    ASSERT(len < MAX_MAPCODE_RESULT_ASCII_LEN);
+    return len;
+}
+
+
+// PRIVATE - returns nonzero if the vowels of the proper mapcode and the characters of the extension of parsed
+// mapcodeElements are valid (the checks the decoder makes before decoding)
+static int hasValidMapcodeCharacters(const MapcodeElements *mapcodeElements) {
+    char properMapcode[MAX_PROPER_MAPCODE_ASCII_LEN + 1];
+    const char *e;
+    strcpy(properMapcode, mapcodeElements->properMapcode);
+    if ((strchr(properMapcode, 'A') || strchr(properMapcode, 'E') || strchr(properMapcode, 'U')) &&
+        (unpackIfAllDigits(properMapcode) <= 0)) {
+        return 0;
+    }
+    for (e = mapcodeElements->precisionExtension; *e; e++) {
+        const int c = decodeChar(*e);
+        if (c < 0 || c == 30) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+
+// PRIVATE - romanise nrMapcodes consecutive (zero-terminated) utf8 or utf16 mapcodes by parsing them (without
+// decoding); stores the romanised mapcodes (or empty strings if they are not valid) consecutively in asciiBuffer
+static int convertMapcodesToRoman(char *asciiBuffer, int asciiBufferSize, const char *buffer, int interpretAsUtf16,
+                                  int nrMapcodes) {
+    char *out = asciiBuffer;
+    int i;
+    if ((asciiBuffer == NULL) || (buffer == NULL) || (asciiBufferSize < 0) || (nrMapcodes < 0)) {
+        return ERR_BAD_ARGUMENTS;
+    }
+    for (i = 0; i < nrMapcodes; i++) {
+        MapcodeElements mapcodeElements;
+        char romanised[MAX_MAPCODE_RESULT_ASCII_LEN];
+        int len = 0;
+        if ((parseMapcodeElements(defaultMapcodeContext.data, &mapcodeElements, buffer, interpretAsUtf16,
+                                  TERRITORY_UNKNOWN) == ERR_OK) &&
+            hasValidMapcodeCharacters(&mapcodeElements)) {
+            len = getRomanisedMapcode(romanised, &mapcodeElements);
+        }
+        if (len >= asciiBufferSize - (int) (out - asciiBuffer)) {
+            return i; // asciiBuffer is full
+        }
+        memcpy(out, romanised, (size_t) len);
+        out[len] = 0;
+        out += len + 1;
+
+        // skip to the next mapcode
+        if (interpretAsUtf16) {
+            const UWORD *utf16 = (const UWORD *) buffer;
+            while (*utf16) {
+                utf16++;
+            }
+            buffer = (const char *) (utf16 + 1);
+        } else {
+            buffer += strlen(buffer) + 1;
+        }
+    }
+    return nrMapcodes;
+}
+
+
+// PUBLIC - romanise nrMapcodes consecutive (zero-terminated) utf8 mapcodes (see convertMapcodesToRoman)
+int convertMapcodesToRomanUtf8(char *asciiBuffer, int asciiBufferSize, const char *utf8Buffer, int nrMapcodes) {
+    return convertMapcodesToRoman(asciiBuffer, asciiBufferSize, utf8Buffer, FLAG_UTF8_STRING, nrMapcodes);
+}
+
+
+// PUBLIC - romanise nrMapcodes consecutive (zero-terminated) utf16 mapcodes (see convertMapcodesToRoman)
+int convertMapcodesToRomanUtf16(char *asciiBuffer, int asciiBufferSize, const UWORD *utf16Buffer, int nrMapcodes) {
+    return convertMapcodesToRoman(asciiBuffer, asciiBufferSize, (const char *) utf16Buffer, FLAG_UTF16_STRING,
+                                  nrMapcodes);
+}
+
+
+// PUBLIC - romanise nrMapcodes consecutive (zero-terminated) utf16 mapcodes into consecutive (zero-terminated)
+// ascii mapcodes in asciiBuffer; returns the number of mapcodes converted (less if asciiBuffer is full)
+int convertMapcodesUtf16ToAscii(char *asciiBuffer, int asciiBufferSize, const UWORD *utf16Buffer, int nrMapcodes) {
+    const char *end = asciiBuffer + asciiBufferSize;
+    char *out = asciiBuffer;
+    int i;
+    if ((asciiBuffer == NULL) || (utf16Buffer == NULL) || (asciiBufferSize < 0) || (nrMapcodes < 0)) {
+        return ERR_BAD_ARGUMENTS;
+    }
+    for (i = 0; i < nrMapcodes; i++) {
+        const UWORD *utf16 = utf16Buffer;
+        char *mapcode = out;
+        unsigned char romanised = 0;
+        // one range check and one table lookup per character; the abjad bit is collected on the side
+        for (; *utf16 && out < end; utf16++) {
+            const unsigned char r = (*utf16 <= ROMAN_TABLE_MAX_CHAR ? ROMAN_TABLE[*utf16] : (unsigned char) '?');
+            romanised |= r;
+            *out++ = (char) (r & (ROMAN_TABLE_IS_ABJAD - 1));
+        }
+        if (out >= end) {
+            return i; // asciiBuffer is full
+        }
+        *out++ = 0;
+
+        if (romanised & ROMAN_TABLE_IS_ABJAD) {
+            // abjad mapcodes are converted back during parsing: store the parsed (ascii) mapcode instead
+            MapcodeElements mapcodeElements;
+            if (parseMapcodeElements(defaultMapcodeContext.data, &mapcodeElements, (const char *) utf16Buffer,
+                                     FLAG_UTF16_STRING, TERRITORY_NONE) == ERR_OK) {
+                char clean[MAX_MAPCODE_RESULT_ASCII_LEN];
+                const int len = getRomanisedMapcode(clean, &mapcodeElements);
+                if (len >= end - mapcode) {
+                    return i; // asciiBuffer is full
+                }
+                memcpy(mapcode, clean, (size_t) len + 1);
+                out = mapcode + len + 1;
+            }
+        }
+        utf16Buffer = utf16 + 1;
+    }
+    return nrMapcodes;
+}
+
+
+
 ///////////////////////////////////////////////////////////////////////////////////////////////
 //
 //  FULL TERRITORY NAMES
 //
 ///////////////////////////////////////////////////////////////////////////////////////////////
 
+// returns the index in LOCALE_REGISTRY of the language of locale (e.g. "en_US"), or -1 if not found
+static int getLocaleRegistryIndex(const char *locale) {
+    int i;
+    int upTo = (int) strlen(locale);
+    char localeUpper[4] = "";           // Default locale is empty (which implies 'fallback').
+    char *sep = strchr(locale, '_');    // Official separator is '_' (as in "en_US").
+    ASSERT(locale);
+    if (!sep) {
+        sep = strchr(locale, '-');      // But we also allow '-' (often used as well).
+    }
+    if (sep) {
+        upTo = (int) (sep - locale);
+    }
+    lengthCopy(localeUpper, locale, upTo, sizeof(localeUpper));
+    makeUppercase(localeUpper);
+
+    for (i = 0; i < (int) (sizeof(LOCALE_REGISTRY) / sizeof(LOCALE_REGISTRY[0])); ++i) {
+        if (!strcmp(LOCALE_REGISTRY[i].locale, localeUpper)) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+
+// returns the names (and their alternatives) of nameLocale
+static const PackedTerritoryNames *getPackedTerritoryNames(int nameLocale) {
+    ASSERT((0 <= nameLocale) && (nameLocale < NR_TERRITORY_NAME_LOCALES));
+    return (nameLocale == TERRITORY_NAMES_LOCAL) ? &PACKED_TERRITORY_NAMES_LOCAL :
+           LOCALE_REGISTRY[nameLocale].territoryFullNames;
+}
+
+
+// PUBLIC - returns the locale number of the territory names of locale (NULL for local names)
+int getTerritoryNameLocale(const char *locale) {
+    int i;
+    if (locale == NULL) {
+        return TERRITORY_NAMES_LOCAL;
+    }
+    i = getLocaleRegistryIndex(locale);
+    if ((i >= 0) && (LOCALE_REGISTRY[i].territoryFullNames->names != NULL)) {
+        return i;
+    }
+
+    // Use English if locale is invalid (or was empty = fallback).
+    for (i = 0; i < (int) (sizeof(LOCALE_REGISTRY) / sizeof(LOCALE_REGISTRY[0])); ++i) {
+        if (LOCALE_REGISTRY[i].territoryFullNames == &DEFAULT_TERRITORY_FULL_NAME) {
+            break;
+        }
+    }
+    ASSERT(i < (int) (sizeof(LOCALE_REGISTRY) / sizeof(LOCALE_REGISTRY[0])));
+    return i;
+}
+
+
+// Names are unpacked by the first call that needs them. The thread that moves the state of the locale from
+// NAMES_PACKED to NAMES_UNPACKING unpacks them; other threads wait until the state is NAMES_UNPACKED, which is
+// only set (with release semantics) once the names are complete.
+#define NAMES_PACKED     0
+#define NAMES_UNPACKING  1
+#define NAMES_UNPACKED   2
+
+#if defined(__GNUC__)
+static int territoryNamesState[NR_TERRITORY_NAME_LOCALES];
+#define GET_NAMES_STATE(nameLocale)  __atomic_load_n(&territoryNamesState[nameLocale], __ATOMIC_ACQUIRE)
+#define CLAIM_UNPACKING(nameLocale)  \
+    __sync_bool_compare_and_swap(&territoryNamesState[nameLocale], NAMES_PACKED, NAMES_UNPACKING)
+#define SET_UNPACKED(nameLocale)     __atomic_store_n(&territoryNamesState[nameLocale], NAMES_UNPACKED, __ATOMIC_RELEASE)
+#elif defined(_MSC_VER)
+static volatile long territoryNamesState[NR_TERRITORY_NAME_LOCALES];
+#define GET_NAMES_STATE(nameLocale)  _InterlockedOr(&territoryNamesState[nameLocale], 0)
+#define CLAIM_UNPACKING(nameLocale)  \
+    (_InterlockedCompareExchange(&territoryNamesState[nameLocale], NAMES_UNPACKING, NAMES_PACKED) == NAMES_PACKED)
+#define SET_UNPACKED(nameLocale)     _InterlockedExchange(&territoryNamesState[nameLocale], NAMES_UNPACKED)
+#elif defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 201112L) && !defined(__STDC_NO_ATOMICS__)
+static atomic_int territoryNamesState[NR_TERRITORY_NAME_LOCALES];
+#define GET_NAMES_STATE(nameLocale)  atomic_load(&territoryNamesState[nameLocale])
+#define CLAIM_UNPACKING(nameLocale)  claimUnpacking(&territoryNamesState[nameLocale])
+#define SET_UNPACKED(nameLocale)     atomic_store(&territoryNamesState[nameLocale], NAMES_UNPACKED)
+
+static int claimUnpacking(atomic_int *state) {
+    int expected = NAMES_PACKED;
+    return atomic_compare_exchange_strong(state, &expected, NAMES_UNPACKING);
+}
+#else
+// without atomic operations, the names of a locale must not be needed by several threads at once the first time
+static volatile int territoryNamesState[NR_TERRITORY_NAME_LOCALES];
+#define GET_NAMES_STATE(nameLocale)  (territoryNamesState[nameLocale])
+#define CLAIM_UNPACKING(nameLocale)  \
+    ((territoryNamesState[nameLocale] == NAMES_PACKED) ? (territoryNamesState[nameLocale] = NAMES_UNPACKING, 1) : 0)
+#define SET_UNPACKED(nameLocale)     (territoryNamesState[nameLocale] = NAMES_UNPACKED)
+#endif
+
+
+// returns the unpacked names of nameLocale (NULL if the language is not supported)
+static const char *getUnpackedTerritoryNames(int nameLocale) {
+    const PackedTerritoryNames *names = getPackedTerritoryNames(nameLocale);
+    unsigned char stack[MAX_TERRITORY_NAMES_PAIR_DEPTH];
+    int i;
+    int len = 0;
+    if ((names->names == NULL) || (GET_NAMES_STATE(nameLocale) == NAMES_UNPACKED)) {
+        return names->names;
+    }
+    if (!CLAIM_UNPACKING(nameLocale)) {
+        while (GET_NAMES_STATE(nameLocale) != NAMES_UNPACKED) {
+            // another thread is unpacking the names
+        }
+        return names->names;
+    }
+    for (i = 0; i < names->packedSize; ++i) {
+        int n = 1;
+        stack[0] = names->packed[i];
+        while (n > 0) {
+            const unsigned char c = stack[--n];
+            if (names->pairs[c][0] == c) { // a byte
+                names->names[len++] = (char) c;
+            } else { // a pair of codes
+                ASSERT(n + 2 <= MAX_TERRITORY_NAMES_PAIR_DEPTH);
+                stack[n++] = names->pairs[c][1];
+                stack[n++] = names->pairs[c][0];
+            }
+        }
+    }
+    ASSERT(len == names->namesSize);
+    SET_UNPACKED(nameLocale);
+    return names->names;
+}
+
+
+// PUBLIC - returns a pointer to (not zero-terminated) alternative name of territory (in nameLocale, and in
+// alphabet unless _ALPHABET_MIN is passed), and sets *nameLength; returns NULL if the alternative does not exist
+const char *getFullTerritoryNameRef(int *nameLength, enum Territory territory, int alternative, int nameLocale,
+                                    enum Alphabet alphabet) {
+    const PackedTerritoryNames *names;
+    const char *territoryNames;
+    const TerritoryNameAlternative *alt;
+    const TerritoryNameAlternative *end;
+    ASSERT(nameLength);
+    if ((territory <= _TERRITORY_MIN) || (territory >= _TERRITORY_MAX) || (alternative < 0) ||
+        (nameLocale < 0) || (nameLocale >= NR_TERRITORY_NAME_LOCALES)) {
+        return NULL;
+    }
+    territoryNames = getUnpackedTerritoryNames(nameLocale);
+    if (territoryNames == NULL) {
+        return NULL; // language not supported
+    }
+
+    names = getPackedTerritoryNames(nameLocale);
+    alt = &names->alternatives[names->alternativesStart[INDEX_OF_TERRITORY(territory)]];
+    end = &names->alternatives[names->alternativesStart[INDEX_OF_TERRITORY(territory) + 1]];
+    if ((_ALPHABET_MIN < alphabet) && (alphabet < _ALPHABET_MAX)) {
+        // Alphabet was specified: skip alternatives in other alphabets.
+        for (; alt < end; alt++) {
+            if ((alt->alphabet == (signed char) alphabet) && (alternative-- == 0)) {
+                break;
+            }
+        }
+    } else {
+        alt += alternative;
+    }
+    if (alt >= end) {
+        return NULL;
+    }
+    *nameLength = alt->length;
+    return territoryNames + alt->offset;
+}
+
+
 static int
 getFullTerritoryName_internal(char *territoryName, enum Territory territory, int alternative, const char *locale,
                               enum Alphabet alphabet) {
-
-    const char *territoryNamesPiped;
-    const char *pipePtr;
-    const char **territoryNamesList = NULL;
+    const char *name;
+    int nameLength;
 
     ASSERT(territoryName);
     ASSERT((_TERRITORY_MIN < territory) && (territory < _TERRITORY_MAX));
@@ -3134,83 +4426,210 @@ getFullTerritoryName_internal(char *territoryName, enum Territory territory, int
         return 0;
     }
 
-    // Check locale.
-    if (locale == NULL) {
+    name = getFullTerritoryNameRef(&nameLength, territory, alternative, getTerritoryNameLocale(locale), alphabet);
+    if (name == NULL) {
+        *territoryName = 0;
+        return 0;
+    }
+    ASSERT(nameLength <= MAX_TERRITORY_FULLNAME_UTF8_LEN);
+    lengthCopy(territoryName, name, nameLength, MAX_TERRITORY_FULLNAME_UTF8_LEN + 1);
+    return 1;
+}
 
-        // Use local names if locale is null.
-        territoryNamesList = TERRITORY_FULL_NAME_LOCAL;
-    } else {
 
-        // Try and get correct list.
-        int i;
-        int upTo = (int) strlen(locale);
-        char localeUpper[4] = "";           // Default locale is empty (which implies 'fallback').
-        char *sep = strchr(locale, '_');    // Official separator is '_' (as in "en_US").
-        if (!sep) {
-            sep = strchr(locale, '-');      // But we also allow '-' (often used as well).
-        }
-        if (sep) {
-            upTo = (int) (sep - locale);
-        }
-        lengthCopy(localeUpper, locale, upTo, sizeof(localeUpper));
-        makeUppercase(localeUpper);
-
-        territoryNamesList = NULL;
-        for (i = 0; i < (int) (sizeof(LOCALE_REGISTRY) / sizeof(LOCALE_REGISTRY[0])); ++i) {
-            if (!strcmp(LOCALE_REGISTRY[i].locale, localeUpper)) {
-                territoryNamesList = LOCALE_REGISTRY[i].territoryFullNames;
-                break;
-            }
-        }
+// returns the TERRITORY_NAME_INDEX locale bits for the names in locale (or in all locales if locale is NULL)
+static unsigned int getTerritoryNameLocales(const char *locale) {
+    unsigned int locales = (1U << TERRITORY_NAMES_LOCAL);
+    int i;
+    if (locale != NULL) {
+        return (1U << getTerritoryNameLocale(locale));
     }
-
-    // Use English if locale is invalid (or was empty = fallback).
-    if (territoryNamesList == NULL || territoryNamesList[0] == NULL) {
-        territoryNamesList = DEFAULT_TERRITORY_FULL_NAME;
+    for (i = 0; i < (int) (sizeof(LOCALE_REGISTRY) / sizeof(LOCALE_REGISTRY[0])); ++i) {
+        if (LOCALE_REGISTRY[i].territoryFullNames->names != NULL) {
+            locales |= (1U << i);
+        }
     }
+    return locales;
+}
 
-    *territoryName = 0;
-    territoryNamesPiped = territoryNamesList[INDEX_OF_TERRITORY(territory)];
-    for (;;) {
-        pipePtr = strchr(territoryNamesPiped, '|');
-
-        if ((_ALPHABET_MIN < alphabet) && (alphabet < _ALPHABET_MAX)) {
 
-            // Alphabet was specified.
-            if (pipePtr) {
-                ASSERT((pipePtr - territoryNamesPiped) <= MAX_TERRITORY_FULLNAME_UTF8_LEN);
-                lengthCopy(territoryName, territoryNamesPiped, (int) (pipePtr - territoryNamesPiped),
-                           MAX_TERRITORY_FULLNAME_UTF8_LEN);
-            } else {
-                ASSERT(strlen(territoryNamesPiped) <= MAX_TERRITORY_FULLNAME_UTF8_LEN);
-                strcpy(territoryName, territoryNamesPiped);
+// folds utf8 into folded (lowercase, without diacritics, without leading and trailing whitespace);
+// returns 0 if utf8 is not valid or longer than any territory name
+static int foldTerritoryName(char *folded, const char *utf8) {
+    const unsigned char *s = (const unsigned char *) utf8;
+    int len = 0;
+    ASSERT(folded);
+    ASSERT(utf8);
+    while (*s > 0 && *s <= 32) {
+        s++;
+    } // skip leading whitespace
+    while (*s) {
+        const unsigned char *start = s;
+        const char *f = NULL;
+        int c = *s++;
+        if (c >= 0xC0 && c < 0xF0) { // 2 or 3 byte utf8 character
+            const int c2 = *s++;
+            if ((c2 & 0xC0) != 0x80) {
+                return 0; // utf8 error
             }
-            if (alphabet != recognizeAlphabetUtf8(territoryName)) { // filter out
-                if (!pipePtr) { // this is the last string!
+            c = ((c & 0x1F) << 6) + (c2 & 63);
+            if (*start >= 0xE0) {
+                const int c3 = *s++;
+                if ((c3 & 0xC0) != 0x80) {
+                    return 0; // utf8 error
+                }
+                c = ((c & 0x3FF) << 6) + (c3 & 63);
+            }
+        }
+        if (c < NAME_FOLD_LOW_END) {
+            f = NAME_FOLD[c];
+        } else if (c >= NAME_FOLD_HIGH_START && c < NAME_FOLD_HIGH_END) {
+            f = NAME_FOLD[c - NAME_FOLD_HIGH_START + NAME_FOLD_LOW_END];
+        }
+        if (f) {
+            while (*f) {
+                if (len >= MAX_FOLDED_TERRITORY_NAME_LEN) {
                     return 0;
                 }
-                territoryNamesPiped = pipePtr + 1;
-                continue;
+                folded[len++] = *f++;
             }
+        } else { // keep the character as it is
+            while (start < s) {
+                if (len >= MAX_FOLDED_TERRITORY_NAME_LEN) {
+                    return 0;
+                }
+                folded[len++] = (char) *start++;
+            }
+        }
+    }
+    while (len > 0 && (unsigned char) folded[len - 1] <= 32) {
+        len--;
+    } // skip trailing whitespace
+    folded[len] = 0;
+    return 1;
+}
+
+
+static int compareTerritoryName(const void *e1, const void *e2) {
+    const TerritoryNameRec *n1 = (const TerritoryNameRec *) e1;
+    const TerritoryNameRec *n2 = (const TerritoryNameRec *) e2;
+    ASSERT(e1);
+    ASSERT(e2);
+    return strcmp(n1->name, n2->name);
+}
+
+
+// PUBLIC - returns territory with full name (in locale, or in any locale if NULL), or TERRITORY_NONE if not found
+enum Territory getTerritoryCodeFromName(const char *name, const char *locale) {
+    char folded[MAX_FOLDED_TERRITORY_NAME_LEN + 1];
+    const TerritoryNameRec *p;
+    TerritoryNameRec t;
+    unsigned int locales;
+    if ((name == NULL) || !foldTerritoryName(folded, name) || !*folded) {
+        return TERRITORY_NONE;
+    }
+    t.name = folded;
+    p = (const TerritoryNameRec *) bsearch(&t, TERRITORY_NAME_INDEX, NR_TERRITORY_NAME_RECS,
+                                           sizeof(TerritoryNameRec), compareTerritoryName);
+    if (p == NULL) {
+        return TERRITORY_NONE;
+    }
+    while ((p > TERRITORY_NAME_INDEX) && !strcmp(p[-1].name, folded)) {
+        p--;
+    } // find the first (preferred) territory with this name
+
+    locales = getTerritoryNameLocales(locale);
+    for (; (p < TERRITORY_NAME_INDEX + NR_TERRITORY_NAME_RECS) && !strcmp(p->name, folded); p++) {
+        if (p->locales & locales) {
+            return p->territory;
         }
+    }
+    return TERRITORY_NONE;
+}
 
-        if (!pipePtr) { // this is the last string!
-            if (alternative > 0) { // not what we want?
-                return 0;
-            }
-            ASSERT(strlen(territoryNamesPiped) <= MAX_TERRITORY_FULLNAME_UTF8_LEN);
-            strcpy(territoryName, territoryNamesPiped); // no bracket, return it all
-            return 1;
+
+// PUBLIC - stores (at most maxTerritories) territories with a name or ISO code starting with prefix in
+// territories, best matches first; returns the number of territories stored
+int getTerritoriesWithNamePrefix(enum Territory *territories, int maxTerritories, const char *prefix,
+                                 const char *locale) {
+    char folded[MAX_FOLDED_TERRITORY_NAME_LEN + 1];
+    int score[_TERRITORY_MAX - _TERRITORY_MIN - 1];
+    unsigned int locales;
+    unsigned int preferred;
+    int first = 0;
+    int last = NR_TERRITORY_NAME_RECS;
+    int i;
+    int n = 0;
+    size_t prefixLength;
+    if ((territories == NULL) || (maxTerritories <= 0) || (prefix == NULL) || !foldTerritoryName(folded, prefix) ||
+        !*folded) {
+        return 0;
+    }
+    prefixLength = strlen(folded);
+    locales = getTerritoryNameLocales(NULL) | (1U << TERRITORY_NAMES_ISO_CODE);
+    preferred = (locale == NULL) ? 0 : (1U << getTerritoryNameLocale(locale));
+
+    while (first < last) { // find the first name >= prefix
+        const int mid = (first + last) / 2;
+        if (strcmp(TERRITORY_NAME_INDEX[mid].name, folded) < 0) {
+            first = mid + 1;
         } else {
-            if (!alternative) { // what we want?
-                break;
+            last = mid;
+        }
+    }
+
+    // score the best matching name of every territory (0 = no match): exact matches first, then names
+    // in the preferred locale, then countries before subdivisions, then local names, other names and
+    // ISO codes last, and shorter names before longer ones
+    memset(score, 0, sizeof(score));
+    for (i = first; (i < NR_TERRITORY_NAME_RECS) && !strncmp(TERRITORY_NAME_INDEX[i].name, folded, prefixLength); ++i) {
+        const TerritoryNameRec *rec = &TERRITORY_NAME_INDEX[i];
+        const int t = INDEX_OF_TERRITORY(rec->territory);
+        const int nameLength = (int) strlen(rec->name);
+        int s = 1;
+        if (!(rec->locales & locales)) {
+            continue; // language not supported
+        }
+        if (nameLength == (int) prefixLength) {
+            s += 32;
+        }
+        if (rec->locales & preferred) {
+            s += 16;
+        }
+        if (parentTerritoryOf(defaultMapcodeContext.data, rec->territory) == TERRITORY_NONE) {
+            s += 8;
+        }
+        if (rec->locales & (1U << TERRITORY_NAMES_LOCAL)) {
+            s += 4;
+        }
+        if (rec->locales & locales & ~(1U << TERRITORY_NAMES_ISO_CODE)) {
+            s += 2;
+        }
+        s = (s << 8) + (nameLength < 255 ? 255 - nameLength : 0);
+        if (s > score[t]) {
+            score[t] = s;
+        }
+    }
+
+    // insert the matching territories in order of score (keeping territory order for equal scores)
+    for (i = 0; i < _TERRITORY_MAX - _TERRITORY_MIN - 1; ++i) {
+        if (score[i] > 0) {
+            int p = n;
+            while ((p > 0) && (score[INDEX_OF_TERRITORY(territories[p - 1])] < score[i])) {
+                if (p < maxTerritories) {
+                    territories[p] = territories[p - 1];
+                }
+                p--;
+            }
+            if (p < maxTerritories) {
+                territories[p] = TERRITORY_OF_INDEX(i);
+                if (n < maxTerritories) {
+                    n++;
+                }
             }
-            alternative--;
-            territoryNamesPiped = pipePtr + 1;
         }
     }
-    lengthCopy(territoryName, territoryNamesPiped, (int) (pipePtr - territoryNamesPiped), MAX_TERRITORY_FULLNAME_UTF8_LEN);
-    return 1;
+    return n;
 }
 
 
@@ -3260,3 +4679,526 @@ int getFullTerritoryNameLocalInAlphabetUtf8(char *territoryName, enum Territory
 }
 
 
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  DATA FILES
+//
+///////////////////////////////////////////////////////////////////////////////////////////////
+
+// The layout of a data file is described in tools/generate_data_file.py.
+#define DATA_FILE_FORMAT_VERSION    1
+#define DATA_FILE_ENDIAN_MARK       0x01020304
+#define DATA_FILE_ALIGNMENT         8
+
+typedef struct {
+    char magic[8];                  // "MAPCODE\0"
+    unsigned int formatVersion;     // DATA_FILE_FORMAT_VERSION
+    unsigned int endianMark;        // DATA_FILE_ENDIAN_MARK, in the byte order of the file
+    unsigned int fileSize;
+    unsigned int checksum;          // CRC-32 of the rest of the file
+    unsigned int nrTables;          // entries in the table directory, which follows the header
+    unsigned int nrTerritories;
+    char dataVersion[32];           // zero-terminated
+} DataFileHeader;
+
+typedef struct {
+    unsigned int id;                // DataFileTableId
+    unsigned int count;             // number of elements
+    unsigned int offset;            // from the start of the file, a multiple of DATA_FILE_ALIGNMENT
+    unsigned int elementSize;       // in bytes
+} DataFileTable;
+
+// table ids, as in tools/generate_data_file.py
+typedef enum {
+    DATA_TABLE_DATA_START = 1,
+    DATA_TABLE_TERRITORY_BOUNDARIES,
+    DATA_TABLE_REDIVAR,
+    DATA_TABLE_PARENT_LETTER,
+    DATA_TABLE_PARENT_NUMBER,
+    DATA_TABLE_ALPHABETS_FOR_TERRITORY  // 7 to 11 are no longer used (and ignored)
+} DataFileTableId;
+
+struct MapcodeDataFile {
+    MapcodeData data;               // points into contents, and into restrictedOverlaps
+    const unsigned char *contents;  // the (mapped) file
+    size_t size;
+    void *restrictedOverlaps;       // RESTRICTED_REC, RESTRICTED_OVERLAP_START and RESTRICTED_OVERLAP (computed)
+};
+
+
+// PRIVATE - returns the CRC-32 (as zlib.crc32) of size bytes
+static unsigned long crc32OfBytes(const unsigned char *bytes, const size_t size) {
+    unsigned long table[256];
+    unsigned long crc = 0xFFFFFFFFUL;
+    size_t i;
+    for (i = 0; i < 256; i++) {
+        unsigned long c = (unsigned long) i;
+        int k;
+        for (k = 0; k < 8; k++) {
+            c = (c & 1) ? (0xEDB88320UL ^ (c >> 1)) : (c >> 1);
+        }
+        table[i] = c;
+    }
+    for (i = 0; i < size; i++) {
+        crc = table[(crc ^ bytes[i]) & 0xFF] ^ (crc >> 8);
+    }
+    return crc ^ 0xFFFFFFFFUL;
+}
+
+
+// PRIVATE - reads (maps) the file into dataFile, returns 0 if it cannot be read
+static int readDataFile(MapcodeDataFile *dataFile, const char *fileName) {
+#ifdef MAPCODE_DATA_FILE_MMAP
+    struct stat status;
+    void *contents;
+    const int fd = open(fileName, O_RDONLY);
+    if (fd < 0) {
+        return 0;
+    }
+    if ((fstat(fd, &status) != 0) || (status.st_size < (off_t) sizeof(DataFileHeader))) {
+        close(fd);
+        return 0;
+    }
+    // a shared read-only mapping: all processes share the pages of the file
+    contents = mmap(NULL, (size_t) status.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (contents == MAP_FAILED) {
+        return 0;
+    }
+    dataFile->contents = (const unsigned char *) contents;
+    dataFile->size = (size_t) status.st_size;
+    return 1;
+#else
+    unsigned char *contents;
+    long size;
+    FILE *fp = fopen(fileName, "rb");
+    if (!fp) {
+        return 0;
+    }
+    if ((fseek(fp, 0, SEEK_END) != 0) || ((size = ftell(fp)) < (long) sizeof(DataFileHeader)) ||
+        (fseek(fp, 0, SEEK_SET) != 0)) {
+        fclose(fp);
+        return 0;
+    }
+    contents = (unsigned char *) malloc((size_t) size);
+    if (!contents || (fread(contents, 1, (size_t) size, fp) != (size_t) size)) {
+        free(contents);
+        fclose(fp);
+        return 0;
+    }
+    fclose(fp);
+    dataFile->contents = contents;
+    dataFile->size = (size_t) size;
+    return 1;
+#endif
+}
+
+
+// PRIVATE - releases the contents read by readDataFile
+static void releaseDataFile(MapcodeDataFile *dataFile) {
+    free(dataFile->restrictedOverlaps);
+#ifdef MAPCODE_DATA_FILE_MMAP
+    munmap((void *) dataFile->contents, dataFile->size);
+#else
+    free((void *) dataFile->contents);
+#endif
+}
+
+
+// PRIVATE - returns the table with this id, if it has count elements of elementSize bytes (NULL if not)
+static const void *getDataFileTable(const MapcodeDataFile *dataFile, const DataFileTableId id,
+                                    const size_t elementSize, const int count) {
+    const DataFileHeader *header = (const DataFileHeader *) dataFile->contents;
+    const DataFileTable *table = (const DataFileTable *) (header + 1);
+    unsigned int i;
+    for (i = 0; i < header->nrTables; i++) {
+        if (table[i].id == (unsigned int) id) {
+            if ((table[i].elementSize != elementSize) || (count < 0) || (table[i].count != (unsigned int) count) ||
+                (table[i].offset % DATA_FILE_ALIGNMENT) || (table[i].offset > dataFile->size) ||
+                ((size_t) count > (dataFile->size - table[i].offset) / elementSize)) {
+                return NULL;
+            }
+            return dataFile->contents + table[i].offset;
+        }
+    }
+    return NULL;
+}
+
+
+// PRIVATE - returns the number of elements of the table with this id (-1 if there is no such table)
+static int getDataFileTableCount(const MapcodeDataFile *dataFile, const DataFileTableId id) {
+    const DataFileHeader *header = (const DataFileHeader *) dataFile->contents;
+    const DataFileTable *table = (const DataFileTable *) (header + 1);
+    unsigned int i;
+    for (i = 0; i < header->nrTables; i++) {
+        if ((table[i].id == (unsigned int) id) && (table[i].count <= 0x7FFFFFFF)) {
+            return (int) table[i].count;
+        }
+    }
+    return -1;
+}
+
+
+// PRIVATE - returns 1 if the records of every territory can be used by the encoder and decoder: non-empty boundaries,
+// codexes and record types they handle, a grid size for every grid and nameless record, a grid record at the end of
+// every territory, and nameless and auto-header runs that stay inside their territory
+static int isValidBoundaries(const MapcodeData *data, const int nrTerritories) {
+    int t;
+    for (t = 0; t < nrTerritories; t++) {
+        const int from = data->dataStart[t];
+        const int upto = data->dataStart[t + 1] - 1;
+        int m;
+        if (IS_NAMELESS(data, upto) || (REC_TYPE(data, upto) != 0) || (REC_TYPE(data, from) > 1)) {
+            return 0;
+        }
+        for (m = from; m <= upto; m++) {
+            const TerritoryBoundary *b = TERRITORY_BOUNDARY(data, m);
+            const int k = (b->flags & 31);
+            const int codex = CODEX_OF_BOUNDARY(b);
+            const int smartDiv = SMART_DIV_OF_BOUNDARY(b);
+            if ((b->minx >= b->maxx) || (b->miny >= b->maxy) || (b->miny < -90000000) || (b->maxy > 90000001) ||
+                (k < 5) || (k > 29)) {
+                return 0;
+            }
+            if (IS_NAMELESS(data, m)) {
+                if ((REC_TYPE(data, m) != 0) || (smartDiv <= 0) || ((codex != 13) && (codex != 21) && (codex != 22))) {
+                    return 0;
+                }
+            } else if (REC_TYPE(data, m) > 1) {
+                if ((codex != 22) && (codex != 23)) {
+                    return 0;
+                }
+            } else if (codex < 55) {
+                // a grid record needs 1 to NC[prefix length] rows (codex 14 is encoded as 23, see encodeGridInBoundary)
+                const int prelen = (codex == 14) ? 2 : (codex / 10);
+                if ((smartDiv <= 0) || (smartDiv > NC[prelen])) {
+                    return 0;
+                }
+            }
+            // a nameless or auto-header run ends with a record of another codex (not at the end of the territory)
+            if ((IS_NAMELESS(data, m) || (REC_TYPE(data, m) > 1)) && (coDex(data, m + 1) == codex) &&
+                ((IS_NAMELESS(data, m + 1) != IS_NAMELESS(data, m)) ||
+                 ((REC_TYPE(data, m + 1) > 1) != (REC_TYPE(data, m) > 1)))) {
+                return 0;
+            }
+        }
+    }
+    return 1;
+}
+
+
+// PRIVATE - returns 1 if redivar is a valid territory search tree of count values: its nodes are stored in
+// preorder, and every jump leads forward, to the start of a node
+static int isValidRedivar(const int *redivar, const int count) {
+    char *isNode;
+    int valid = (count > 0);
+    int i = 0;
+    if (!valid) {
+        return 0;
+    }
+    isNode = (char *) calloc((size_t) count, 1);
+    if (!isNode) {
+        return 0;
+    }
+    while (valid && (i < count)) {
+        const int r = redivar[i];
+        isNode[i] = 1;
+        if (r >= 0 && r < 1024) { // leaf: r territories
+            int j;
+            valid = (r < count - i);
+            for (j = 1; valid && (j <= r); j++) {
+                valid = (redivar[i + j] > _TERRITORY_MIN) && (redivar[i + j] < _TERRITORY_MAX);
+            }
+            i += r + 1;
+        } else { // split, followed by the position of the second subtree
+            valid = (i + 2 < count) && (redivar[i + 1] > i + 1) && (redivar[i + 1] < count);
+            i += 2;
+        }
+    }
+    for (i = 0; valid && (i < count); i++) {
+        const int r = redivar[i];
+        if (isNode[i] && !(r >= 0 && r < 1024)) {
+            valid = isNode[redivar[i + 1]];
+        }
+    }
+    free(isNode);
+    return valid;
+}
+
+
+// PRIVATE - returns 1 if record b intersects the half-open rectangle (also when shifted by 360 degrees), as
+// restrictZoneTo does
+static int overlapsRectangle(const TerritoryBoundary *b, const int minx, const int miny, const int maxx,
+                             const int maxy) {
+    int shift;
+    if ((b->miny >= maxy) || (miny >= b->maxy)) {
+        return 0;
+    }
+    for (shift = -360000000; shift <= 360000000; shift += 360000000) {
+        if ((b->minx + shift < maxx) && (minx < b->maxx + shift)) {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+
+// PRIVATE - adds the restricted grid records of the territory from..upto, and the lists of earlier non-restricted
+// records that intersect each cell of them, to the tables (if restrictedRec is not NULL); returns the number of
+// list entries, and adds the number of restricted records to *nrRestrictedRecs
+static int addRestrictedOverlaps(const MapcodeData *data, const int from, const int upto, int *nrRestrictedRecs,
+                                 int *restrictedRec, int *overlapStart, unsigned short *overlap, int nrOverlaps) {
+    int i;
+    for (i = from; i <= upto; i++) {
+        const TerritoryBoundary *b = TERRITORY_BOUNDARY(data, i);
+        int cellx, celly, cx, cy;
+        if (!IS_RESTRICTED(data, i) || IS_NAMELESS(data, i) || (REC_TYPE(data, i) != 0)) {
+            continue;
+        }
+        cellx = (b->maxx - b->minx + RESTRICTED_OVERLAPS_GRID - 1) / RESTRICTED_OVERLAPS_GRID;
+        celly = (b->maxy - b->miny + RESTRICTED_OVERLAPS_GRID - 1) / RESTRICTED_OVERLAPS_GRID;
+        if (restrictedRec) {
+            restrictedRec[*nrRestrictedRecs] = i;
+        }
+        for (cy = 0; cy < RESTRICTED_OVERLAPS_GRID; cy++) {
+            for (cx = 0; cx < RESTRICTED_OVERLAPS_GRID; cx++) {
+                const int minx = b->minx + cx * cellx;
+                const int miny = b->miny + cy * celly;
+                int j;
+                for (j = from; j < i; j++) {
+                    if (!IS_RESTRICTED(data, j) && overlapsRectangle(TERRITORY_BOUNDARY(data, j), b->minx, b->miny,
+                                                                     b->maxx, b->maxy) &&
+                        overlapsRectangle(TERRITORY_BOUNDARY(data, j), minx, miny, minx + cellx, miny + celly)) {
+                        if (overlap) {
+                            overlap[nrOverlaps] = (unsigned short) j;
+                        }
+                        nrOverlaps++;
+                    }
+                }
+                if (overlapStart) {
+                    overlapStart[(*nrRestrictedRecs * RESTRICTED_OVERLAPS_GRID + cy) * RESTRICTED_OVERLAPS_GRID + cx
+                                 + 1] = nrOverlaps;
+                }
+            }
+        }
+        (*nrRestrictedRecs)++;
+    }
+    return nrOverlaps;
+}
+
+
+// PRIVATE - computes the restricted overlap tables from the boundary records (as
+// tools/generate_restricted_overlaps.py does), rather than trusting derived tables in a data file
+static enum MapcodeError computeRestrictedOverlaps(MapcodeDataFile *dataFile, const int nrTerritories) {
+    MapcodeData *data = &dataFile->data;
+    const int nrCells = RESTRICTED_OVERLAPS_GRID * RESTRICTED_OVERLAPS_GRID;
+    int *restrictedRec;
+    int *overlapStart;
+    int nrRestrictedRecs = 0;
+    int nrOverlaps = 0;
+    int t;
+    for (t = 0; t < nrTerritories; t++) {
+        nrOverlaps = addRestrictedOverlaps(data, data->dataStart[t], data->dataStart[t + 1] - 1, &nrRestrictedRecs,
+                                           NULL, NULL, NULL, nrOverlaps);
+    }
+    dataFile->restrictedOverlaps = malloc(sizeof(int) * (size_t) (nrRestrictedRecs * (nrCells + 1) + 1) +
+                                          sizeof(unsigned short) * (size_t) (nrOverlaps + 1));
+    if (!dataFile->restrictedOverlaps) {
+        return ERR_DATA_FILE_UNREADABLE;
+    }
+    restrictedRec = (int *) dataFile->restrictedOverlaps;
+    overlapStart = restrictedRec + nrRestrictedRecs;
+    overlapStart[0] = 0;
+    data->restrictedRec = restrictedRec;
+    data->restrictedOverlapStart = overlapStart;
+    data->restrictedOverlap = (const unsigned short *) (overlapStart + nrRestrictedRecs * nrCells + 1);
+    data->nrRestrictedRecs = 0;
+    nrOverlaps = 0;
+    for (t = 0; t < nrTerritories; t++) {
+        nrOverlaps = addRestrictedOverlaps(data, data->dataStart[t], data->dataStart[t + 1] - 1,
+                                           &data->nrRestrictedRecs, restrictedRec, overlapStart,
+                                           (unsigned short *) data->restrictedOverlap, nrOverlaps);
+    }
+    ASSERT(data->nrRestrictedRecs == nrRestrictedRecs);
+    return ERR_OK;
+}
+
+
+// PRIVATE - checks the data file and sets up dataFile->data; the engine relies on these checks, so it can
+// index the tables without further range checks
+static enum MapcodeError setupDataFile(MapcodeDataFile *dataFile) {
+    const DataFileHeader *header = (const DataFileHeader *) dataFile->contents;
+    MapcodeData *data = &dataFile->data;
+    const int nrTerritories = _TERRITORY_MAX - _TERRITORY_MIN - 1;
+    const int nrRedivar = getDataFileTableCount(dataFile, DATA_TABLE_REDIVAR);
+    int i;
+
+    if (memcmp(header->magic, "MAPCODE", 8) != 0 || (header->endianMark != DATA_FILE_ENDIAN_MARK)) {
+        return ERR_DATA_FILE_INVALID;
+    }
+    if (header->formatVersion != DATA_FILE_FORMAT_VERSION) {
+        return ERR_DATA_FILE_VERSION;
+    }
+    if ((header->fileSize != dataFile->size) ||
+        (header->nrTables > (dataFile->size - sizeof(DataFileHeader)) / sizeof(DataFileTable))) {
+        return ERR_DATA_FILE_INVALID;
+    }
+    if (crc32OfBytes(dataFile->contents + sizeof(DataFileHeader), dataFile->size - sizeof(DataFileHeader)) !=
+        header->checksum) {
+        return ERR_DATA_FILE_CHECKSUM;
+    }
+    if ((header->nrTerritories != (unsigned int) nrTerritories) ||
+        !memchr(header->dataVersion, 0, sizeof(header->dataVersion))) {
+        return ERR_DATA_FILE_INVALID;
+    }
+
+    data->dataVersion = header->dataVersion;
+    data->nrBoundaries = getDataFileTableCount(dataFile, DATA_TABLE_TERRITORY_BOUNDARIES);
+    if (data->nrBoundaries > 0xFFFF) {
+        return ERR_DATA_FILE_INVALID; // restricted overlaps are stored as unsigned shorts
+    }
+    data->dataStart = (const int *) getDataFileTable(dataFile, DATA_TABLE_DATA_START, sizeof(int), nrTerritories + 1);
+    data->territoryBoundaries = (const TerritoryBoundary *) getDataFileTable(
+            dataFile, DATA_TABLE_TERRITORY_BOUNDARIES, sizeof(TerritoryBoundary), data->nrBoundaries);
+    data->redivar = (const int *) getDataFileTable(dataFile, DATA_TABLE_REDIVAR, sizeof(int), nrRedivar);
+    data->parentLetter = (const char *) getDataFileTable(dataFile, DATA_TABLE_PARENT_LETTER, 1, nrTerritories + 1);
+    data->parentNumber = (const char *) getDataFileTable(dataFile, DATA_TABLE_PARENT_NUMBER, 1, nrTerritories + 1);
+    data->alphabetsForTerritory = (const TerritoryAlphabets *) getDataFileTable(
+            dataFile, DATA_TABLE_ALPHABETS_FOR_TERRITORY, sizeof(TerritoryAlphabets), nrTerritories);
+    if (!data->dataStart || !data->territoryBoundaries || !data->redivar || !data->parentLetter ||
+        !data->parentNumber || !data->alphabetsForTerritory) {
+        return ERR_DATA_FILE_INVALID;
+    }
+    if (!isValidRedivar(data->redivar, nrRedivar)) {
+        return ERR_DATA_FILE_INVALID;
+    }
+
+    // every territory has at least one record (its bounding box)
+    if ((data->dataStart[0] != 0) || (data->dataStart[nrTerritories] != data->nrBoundaries)) {
+        return ERR_DATA_FILE_INVALID;
+    }
+    for (i = 0; i < nrTerritories; i++) {
+        if (data->dataStart[i] >= data->dataStart[i + 1]) {
+            return ERR_DATA_FILE_INVALID;
+        }
+    }
+    if (!isValidBoundaries(data, nrTerritories)) {
+        return ERR_DATA_FILE_INVALID;
+    }
+    for (i = 0; i < nrTerritories; i++) {
+        const TerritoryAlphabets *alphabets = &data->alphabetsForTerritory[i];
+        int a;
+        if ((data->parentLetter[i] < 0) || (data->parentLetter[i] > 8) ||
+            (data->parentNumber[i] < 0) || (data->parentNumber[i] > 8) ||
+            (alphabets->count < 1) || (alphabets->count > MAX_ALPHABETS_PER_TERRITORY)) {
+            return ERR_DATA_FILE_INVALID;
+        }
+        for (a = 0; a < alphabets->count; a++) {
+            if ((alphabets->alphabet[a] <= _ALPHABET_MIN) || (alphabets->alphabet[a] >= _ALPHABET_MAX)) {
+                return ERR_DATA_FILE_INVALID;
+            }
+        }
+    }
+    return computeRestrictedOverlaps(dataFile, nrTerritories);
+}
+
+
+// PUBLIC - loads a data file
+enum MapcodeError loadMapcodeDataFile(MapcodeDataFile **dataFile, const char *fileName) {
+    MapcodeDataFile *loaded;
+    enum MapcodeError err;
+    if (!dataFile || !fileName) {
+        return ERR_BAD_ARGUMENTS;
+    }
+    *dataFile = NULL;
+    loaded = (MapcodeDataFile *) malloc(sizeof(MapcodeDataFile));
+    if (!loaded) {
+        return ERR_DATA_FILE_UNREADABLE;
+    }
+    loaded->restrictedOverlaps = NULL;
+    if (!readDataFile(loaded, fileName)) {
+        free(loaded);
+        return ERR_DATA_FILE_UNREADABLE;
+    }
+    err = setupDataFile(loaded);
+    if (err != ERR_OK) {
+        releaseDataFile(loaded);
+        free(loaded);
+        return err;
+    }
+    *dataFile = loaded;
+    return ERR_OK;
+}
+
+
+// PUBLIC - releases a data file
+void unloadMapcodeDataFile(MapcodeDataFile *dataFile) {
+    if (dataFile) {
+        if (defaultMapcodeContext.data == &dataFile->data) {
+            defaultMapcodeContext.data = &COMPILED_MAPCODE_DATA;
+        }
+        releaseDataFile(dataFile);
+        free(dataFile);
+    }
+}
+
+
+// PUBLIC - selects the data used by the default context
+void useMapcodeDataFile(const MapcodeDataFile *dataFile) {
+    defaultMapcodeContext.data = (dataFile ? &dataFile->data : &COMPILED_MAPCODE_DATA);
+}
+
+
+// PUBLIC - returns the data version of the data used by the default context
+const char *getMapcodeDataVersion(void) {
+    // the compiled-in tables derived from internal_data.h must be generated from the same data
+    ASSERT(strcmp(RESTRICTED_OVERLAPS_DATA_VERSION, MAPCODE_DATA_VERSION) == 0);
+    return defaultMapcodeContext.data->dataVersion;
+}
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  CONTEXTS
+//
+///////////////////////////////////////////////////////////////////////////////////////////////
+
+// PUBLIC - creates a context that uses the data of dataFile (or the compiled-in data); NULL if out of memory
+MapcodeContext *createMapcodeContext(const MapcodeDataFile *dataFile) {
+    MapcodeContext *mapcodeContext = (MapcodeContext *) malloc(sizeof(MapcodeContext));
+    if (mapcodeContext) {
+        mapcodeContext->data = (dataFile ? &dataFile->data : &COMPILED_MAPCODE_DATA);
+        memset(&mapcodeContext->statistics, 0, sizeof(MapcodeStatistics));
+    }
+    return mapcodeContext;
+}
+
+
+// PUBLIC - releases a context
+void destroyMapcodeContext(MapcodeContext *mapcodeContext) {
+    free(mapcodeContext);
+}
+
+
+// PUBLIC - returns the data version of the data used by a context
+const char *getMapcodeContextDataVersion(const MapcodeContext *mapcodeContext) {
+    return DATA_OF_CONTEXT(mapcodeContext)->dataVersion;
+}
+
+
+// PUBLIC - gets the statistics of a context (all 0 for the default context)
+void getMapcodeStatistics(MapcodeStatistics *statistics, const MapcodeContext *mapcodeContext) {
+    ASSERT(statistics);
+    memcpy(statistics, mapcodeContext ? &mapcodeContext->statistics : &defaultMapcodeContext.statistics,
+           sizeof(MapcodeStatistics));
+}
+
+
+// PUBLIC - sets the statistics of a context to 0
+void resetMapcodeStatistics(MapcodeContext *mapcodeContext) {
+    if (mapcodeContext) {
+        memset(&mapcodeContext->statistics, 0, sizeof(MapcodeStatistics));
+    }
+}
@@ -26,7 +26,7 @@ extern "C" {
 
 // English is always defined - this is the fallback language for any unknown language.
 #define MAPCODE_SUPPORT_LANGUAGE_EN
-#define DEFAULT_TERRITORY_FULL_NAME TERRITORY_FULL_NAME_EN
+#define DEFAULT_TERRITORY_FULL_NAME PACKED_TERRITORY_NAMES_EN
 
 #ifndef MAPCODE_NO_SUPPORT_ALL_LANGUAGES
 #define MAPCODE_SUPPORT_LANGUAGE_AF
@@ -124,6 +124,13 @@ enum MapcodeError {
 
     ERR_MAPCODE_INCOMPLETE = -999,   // not enough letters (yet) after dot
 
+    // data file errors.
+
+    ERR_DATA_FILE_UNREADABLE = -399, // data file cannot be opened or read
+    ERR_DATA_FILE_INVALID,           // data file is not a mapcode data file for this library, or is inconsistent
+    ERR_DATA_FILE_CHECKSUM,          // data file is corrupt (checksum mismatch)
+    ERR_DATA_FILE_VERSION,           // data file format version is not supported
+
     // format errors.
 
     ERR_ALL_DIGIT_CODE = -299,       // mapcode consists only of digits
@@ -244,6 +251,60 @@ int encodeLatLonToSelectedMapcode(
     int indexOfSelected);
 
 
+/**
+ * The type MapcodesWithPrecisions holds the mapcodes of a coordinate for all precisions at once: the mapcodes
+ * without extension and their full extensions (of MAX_PRECISION_DIGITS characters). The mapcode with n extra
+ * digits is mapcode[i], a hyphen and the first n characters of extension[i] (see getMapcodeWithPrecision).
+ */
+typedef struct {
+    int count;                                                               // The number of mapcode results (length of arrays).
+    char mapcode[MAX_NR_OF_MAPCODE_RESULTS][MAX_MAPCODE_RESULT_ASCII_LEN];   // The mapcodes, without extension.
+    char extension[MAX_NR_OF_MAPCODE_RESULTS][MAX_PRECISION_DIGITS + 1];     // Their full extensions (excluding the hyphen).
+    double maxErrorInMeters[MAX_PRECISION_DIGITS + 1];                       // The maxErrorInMeters for 0..MAX_PRECISION_DIGITS extra digits.
+} MapcodesWithPrecisions;
+
+
+/**
+ * Encode a latitude, longitude pair (in degrees) to a set of Mapcodes for all precisions in one pass. This
+ * gives the same mapcodes as encodeLatLonToMapcodes with any number of extra digits, but looks up the
+ * territories and encodes only once.
+ *
+ * Arguments:
+ *      mapcodes        - A pointer to a buffer to hold the mapcodes, allocated by the caller.
+ *      lat             - Latitude, in degrees. Range: -90..90.
+ *      lon             - Longitude, in degrees. Range: -180..180.
+ *      territory       - Territory (e.g. as from getTerritoryCode), used as encoding context.
+ *                        Pass TERRITORY_NONE or TERRITORY_UNKNOWN to get Mapcodes for all territories.
+ *
+ * Returns:
+ *      Number of results stored in mapcodes. Always >= 0 (0 if no encoding was possible or an error occurred).
+ */
+int encodeLatLonToMapcodesWithPrecisions(
+        MapcodesWithPrecisions *mapcodes,
+        double latDeg,
+        double lonDeg,
+        enum Territory territory);
+
+
+/**
+ * Get a mapcode with a given precision from the results of encodeLatLonToMapcodesWithPrecisions.
+ *
+ * Arguments:
+ *      mapcode         - Returned Mapcode. The caller should allocate at least MAX_MAPCODE_RESULT_ASCII_LEN characters.
+ *      mapcodes        - The results of encodeLatLonToMapcodesWithPrecisions.
+ *      indexOfMapcode  - Index of the mapcode, 0..mapcodes->count - 1.
+ *      extraDigits     - Number of extra "digits" of the mapcode, 0..8.
+ *
+ * Returns:
+ *      1 if the mapcode was stored, or 0 if indexOfMapcode or extraDigits is out of range.
+ */
+int getMapcodeWithPrecision(
+        char *mapcode,
+        const MapcodesWithPrecisions *mapcodes,
+        int indexOfMapcode,
+        int extraDigits);
+
+
 /**
  * Decode a utf8 or ascii Mapcode to  a latitude, longitude pair (in degrees).
  *
@@ -288,6 +349,87 @@ enum MapcodeError decodeMapcodeToLatLonUtf16(
         MapcodeElements *mapcodeElements);
 
 
+/**
+ * Parse a utf8 (or ascii) or utf16 Mapcode, without decoding it. The resulting MapcodeElements can be
+ * decoded any number of times, in different territory contexts, with decodeParsedMapcode. This avoids
+ * re-parsing the string when a mapcode without territory code needs to be tried in multiple territories.
+ *
+ * Arguments:
+ *      mapcodeElements - Filled with analysis of the string (cleared if an error was encountered).
+ *      utf8string      - Mapcode to parse (ascii or utf8 string).
+ *      utf16string     - Mapcode to parse (utf16 string).
+ *      territory       - Territory (e.g. as obtained from getTerritoryCode), used as context to
+ *                        recognize the territory code in the string (if any) in mapcodeElements.
+ *                        Pass TERRITORY_NONE if not available.
+ *
+ * Returns:
+ *      ERR_OK if parsing succeeded.
+ */
+enum MapcodeError parseMapcodeUtf8(
+        MapcodeElements *mapcodeElements,
+        const char *utf8string,
+        enum Territory territory);
+
+enum MapcodeError parseMapcodeUtf16(
+        MapcodeElements *mapcodeElements,
+        const UWORD *utf16string,
+        enum Territory territory);
+
+
+/**
+ * Decode a parsed Mapcode to a latitude, longitude pair (in degrees). The result is the same as decoding
+ * the original string with decodeMapcodeToLatLonUtf8/Utf16 in the given territory context.
+ *
+ * Arguments:
+ *      lat             - Decoded latitude, in degrees. Range: -90..90.
+ *      lon             - Decoded longitude, in degrees. Range: -180..180.
+ *      mapcodeElements - Mapcode, as successfully parsed by parseMapcodeUtf8 or parseMapcodeUtf16.
+ *      territory       - Territory (e.g. as obtained from getTerritoryCode), used as decoding context.
+ *                        Pass TERRITORY_NONE if not available.
+ *
+ * Returns:
+ *      ERR_OK if decoding succeeded.
+ */
+enum MapcodeError decodeParsedMapcode(
+        double *latDeg,
+        double *lonDeg,
+        const MapcodeElements *mapcodeElements,
+        enum Territory territory);
+
+
+/**
+ * The MapcodeDecodeResult structure holds one result of decodeMapcodeInTerritories.
+ */
+typedef struct {
+    enum Territory territory;   // Territory in which the mapcode was decoded.
+    double latDeg;              // Decoded latitude, in degrees. Range: -90..90.
+    double lonDeg;              // Decoded longitude, in degrees. Range: -180..180.
+} MapcodeDecodeResult;
+
+
+/**
+ * Decode a utf8 or ascii Mapcode in each of a number of candidate territories. The string is parsed
+ * only once. A candidate may decode the mapcode in another territory: a subdivision decodes the codes
+ * of its parent territory (e.g. US-CA decodes long codes in USA), and an international mapcode always
+ * decodes in AAA. Every territory is reported at most once.
+ *
+ * Arguments:
+ *      results         - Buffer for the results, allocated by the caller to hold nrCandidates results.
+ *      utf8string      - Mapcode to decode (ascii or utf8 string).
+ *      candidates      - Candidate territories, used as decoding context.
+ *      nrCandidates    - Number of candidate territories.
+ *
+ * Returns:
+ *      Number of territories in which the mapcode decodes (the results are in the order of
+ *      the candidates), or a negative ERR_XXX value if the string could not be parsed.
+ */
+int decodeMapcodeInTerritories(
+        MapcodeDecodeResult *results,
+        const char *utf8string,
+        const enum Territory *candidates,
+        int nrCandidates);
+
+
 /**
  * Checks if a string has the format of a Mapcode. (Note: The method is called compareXXX rather than hasXXX because
  * the return value ERR_OK indicates the string has the Mapcode format, much like string comparison strcmp returns.)
@@ -308,6 +450,110 @@ enum MapcodeError compareWithMapcodeFormatUtf8(const char *utf8String);
 enum MapcodeError compareWithMapcodeFormatUtf16(const UWORD *utf16String);
 
 
+/**
+ * A MapcodeParser parses a mapcode incrementally, e.g. while it is being typed. Adding a character,
+ * or removing the last one, costs constant time: the parser keeps its state after every character
+ * of the input, so it never re-parses the input from the start. The final decode only runs the
+ * decoder on the already parsed (and cleaned up) mapcode.
+ *
+ * The parser is allocated by the caller and must be initialized with initMapcodeParser. Its fields
+ * status, territoryCode and alphabet may be inspected after every call; the other fields are internal.
+ */
+#define MAX_MAPCODE_PARSER_INPUT_LEN        64  // Max. number of input characters a MapcodeParser keeps track of.
+#define MAX_MAPCODE_PARSER_CLEAN_LEN        (MAX_ISOCODE_ASCII_LEN + MAX_CLEAN_MAPCODE_ASCII_LEN + 2)   // Internal.
+
+typedef struct {
+    short state;                        // State of the parser, or a (negative) error.
+    unsigned char cleanLength;          // Number of characters in clean.
+    unsigned char territoryLength;      // Number of characters of the territory code in clean (0 if none).
+    unsigned char properEnd;            // End of the proper mapcode in clean (0 if not yet known).
+    unsigned char extensionLength;      // Number of extension characters plus 1 (0 if no extension).
+    unsigned char nondigits;            // Number of letters in the proper mapcode.
+    unsigned char vowels;               // Number of vowels in the proper mapcode.
+    signed char indexOfDot;             // Position of dot in the proper mapcode (-1 if none).
+    unsigned char isAbjad;              // Non-zero if the input contains abjad characters.
+    signed char alphabet;               // Alphabet of the first non-roman character.
+    enum Territory territoryCode;       // Territory of the territory code, or the context if there is none.
+} MapcodeParserStep;
+
+typedef struct {
+    enum MapcodeError status;           // Status of the input so far, as returned by compareWithMapcodeFormatUtf8.
+    enum Territory territoryCode;       // Territory of the territory code in the input (TERRITORY_NONE if it is
+                                        // not recognized), or the territory context if there is none (yet).
+    enum Alphabet alphabet;             // Alphabet of the first non-roman character (ALPHABET_ROMAN if none).
+    enum Territory territory;           // Territory context.
+    int length;                         // Number of characters in the input.
+    MapcodeParserStep step[MAX_MAPCODE_PARSER_INPUT_LEN + 1];   // State after each character of the input.
+    char clean[MAX_MAPCODE_PARSER_CLEAN_LEN];                   // Cleaned up input characters.
+} MapcodeParser;
+
+
+/**
+ * Start parsing a new mapcode, with an empty input.
+ *
+ * Arguments:
+ *      parser          - Parser, allocated by the caller.
+ *      territory       - Territory (e.g. as obtained from getTerritoryCode), used as decoding context.
+ *                        Pass TERRITORY_NONE if not available.
+ */
+void initMapcodeParser(
+        MapcodeParser *parser,
+        enum Territory territory);
+
+
+/**
+ * Add one or more characters to the input of a parser.
+ *
+ * Arguments:
+ *      parser                 - Parser, initialized by initMapcodeParser.
+ *      utf8String/utf16String - Characters to add, in UTF8 or UTF16 format. A UTF8 error ends the input
+ *                               (the rest of the string is ignored) and makes the status ERR_INVALID_CHARACTER.
+ *
+ * Returns:
+ *      The new status of the parser (see compareWithMapcodeFormatUtf8). Beyond MAX_MAPCODE_PARSER_INPUT_LEN
+ *      characters, characters are only counted and the status is ERR_BAD_ARGUMENTS.
+ */
+enum MapcodeError appendToMapcodeParserUtf8(
+        MapcodeParser *parser,
+        const char *utf8String);
+
+enum MapcodeError appendToMapcodeParserUtf16(
+        MapcodeParser *parser,
+        const UWORD *utf16String);
+
+
+/**
+ * Remove the last character from the input of a parser (does nothing if the input is empty).
+ *
+ * Arguments:
+ *      parser          - Parser, initialized by initMapcodeParser.
+ *
+ * Returns:
+ *      The new status of the parser (see compareWithMapcodeFormatUtf8).
+ */
+enum MapcodeError removeLastFromMapcodeParser(MapcodeParser *parser);
+
+
+/**
+ * Decode the input of a parser to a latitude, longitude pair (in degrees). The result is the same
+ * as decoding the input with decodeMapcodeToLatLonUtf8 in the territory context of the parser.
+ *
+ * Arguments:
+ *      lat             - Decoded latitude, in degrees. Range: -90..90.
+ *      lon             - Decoded longitude, in degrees. Range: -180..180.
+ *      parser          - Parser, initialized by initMapcodeParser.
+ *      mapcodeElements - If not NULL, filled with analysis of the input (unless an error was encountered).
+ *
+ * Returns:
+ *      ERR_OK if decoding succeeded.
+ */
+enum MapcodeError decodeMapcodeParserToLatLon(
+        double *latDeg,
+        double *lonDeg,
+        const MapcodeParser *parser,
+        MapcodeElements *mapcodeElements);
+
+
 /**
  * Convert an ISO3166 territory code to a territory.
  *
@@ -323,6 +569,27 @@ enum Territory getTerritoryCode(
         enum Territory optionalTerritoryContext);
 
 
+/**
+ * Convert a column of ISO3166 territory codes to territories, all with the same territory context.
+ *
+ * Arguments:
+ *      territories              - Target array, allocated by caller to hold nrTerritories territories.
+ *                                 Receives the territory of each code, or TERRITORY_NONE if not found.
+ *      territoryISOs            - Array of nrTerritories strings, each starting with an ISO3166 code
+ *                                 (e.g. "USA" or "US-CA"). NULL entries are not found.
+ *      nrTerritories            - Number of codes to convert.
+ *      optionalTerritoryContext - Territory context, or TERRITORY_NONE if not available.
+ *
+ * Returns:
+ *      The number of codes found (>= 0), or ERR_BAD_ARGUMENTS if an argument is invalid.
+ */
+int getTerritoryCodes(
+        enum Territory *territories,
+        const char *const *territoryISOs,
+        int nrTerritories,
+        enum Territory optionalTerritoryContext);
+
+
 /**
  * Convert a territory to a territory name.
  *
@@ -483,6 +750,86 @@ int getFullTerritoryNameInLocaleInAlphabetUtf8(
         enum Alphabet alphabet);
 
 
+/**
+ * Resolves a locale for getFullTerritoryNameRef. Resolve a locale once and reuse the result, rather
+ * than passing the locale string for every name.
+ *
+ *   Arguments:
+ *       locale        - A locale (e.g. "en_US" for U.S. English); use NULL for local territory names.
+ *
+ *   Return value:
+ *       The locale number (>= 0) of the territory names of the locale. Unknown locales, and languages
+ *       that are not supported, resolve to English.
+ */
+int getTerritoryNameLocale(
+        const char *locale);
+
+
+/**
+ * Returns a territory name without copying it. The name is looked up in precomputed tables, so this
+ * is much faster than the getFullTerritoryName... calls.
+ *
+ *   Arguments:
+ *       nameLength    - Set to the length of the name in bytes (if the name exists).
+ *       territory     - Territory to get name for.
+ *       alternative   - Which name to get, must be >= 0 (0 = default, 1 = first alternative, 2 = second etc.).
+ *       nameLocale    - Locale number, as returned by getTerritoryNameLocale.
+ *       alphabet      - Only count names in this alphabet, or _ALPHABET_MIN to count all names.
+ *
+ *   Return value:
+ *       Pointer to the UTF8 name, owned by the library. The name is NOT zero-terminated: use nameLength.
+ *       NULL if the alternative does not exist.
+ */
+const char *getFullTerritoryNameRef(
+        int *nameLength,
+        enum Territory territory,
+        int alternative,
+        int nameLocale,
+        enum Alphabet alphabet);
+
+
+/**
+ * Returns the territory with a given full name, which may be any of the alternative names. Names are
+ * compared case-insensitively and without diacritics, so "Nederland", "pays-bas" and "Curacao" are found
+ * as well as "オランダ". If a name is used for more than one territory, a country is preferred over a
+ * subdivision (so "Georgia" is TERRITORY_GEO).
+ *
+ *   Arguments:
+ *       name          - UTF8 name of the territory.
+ *       locale        - A locale (e.g. "en_US" for U.S. English) to only accept names in that language,
+ *                       or NULL to accept names in any language (including the local names).
+ *
+ *   Return value:
+ *       Territory (> _TERRITORY_MIN) if found, or TERRITORY_NONE if not.
+ */
+enum Territory getTerritoryCodeFromName(
+        const char *name,
+        const char *locale);
+
+
+/**
+ * Returns the territories with a full name (in any language) or ISO3166 code starting with a prefix,
+ * best matches first, to suggest territories while a name is being typed. Names are compared
+ * case-insensitively and without diacritics. Exact matches come first, then names in the preferred
+ * locale. Next, countries come before subdivisions, and local names before names in other languages
+ * and ISO codes. Shorter names come before longer ones. The call does not allocate memory.
+ *
+ *   Arguments:
+ *       territories    - Target array, allocated by caller to hold at least maxTerritories territories.
+ *       maxTerritories - Maximum number of territories to return.
+ *       prefix         - UTF8 prefix of the name.
+ *       locale         - Preferred locale (e.g. "en_US" for U.S. English), or NULL if none.
+ *
+ *   Return value:
+ *       Number of territories stored in territories (0 if none match).
+ */
+int getTerritoriesWithNamePrefix(
+        enum Territory *territories,
+        int maxTerritories,
+        const char *prefix,
+        const char *locale);
+
+
 /**
  * This struct contains the returned alphabest for getAlphabetsForTerritory. The 'count' specifies
  * how many alphabets are listed in 'alphabet', range [1, MAX_ALPHABETS_PER_TERRITORY].
@@ -509,6 +856,38 @@ typedef struct {
 const TerritoryAlphabets *getAlphabetsForTerritory(enum Territory territory);
 
 
+/**
+ * Recognize the alphabet of a string, e.g. to decide how to normalise user input.
+ *
+ * Arguments:
+ *      utf8    - UTF8 string.
+ *
+ * Returns:
+ *      The alphabet of the first character in the string that is not roman, ALPHABET_ROMAN if all
+ *      characters are roman, or _ALPHABET_MIN if the character is not in a supported alphabet or the
+ *      string is not valid UTF8.
+ */
+enum Alphabet recognizeAlphabetUtf8(const char *utf8);
+
+
+/**
+ * Recognize the alphabet of each string in a column of strings (see recognizeAlphabetUtf8).
+ *
+ * Arguments:
+ *      alphabets    - Target array, allocated by caller to hold nrStrings alphabets.
+ *                     Receives the alphabet of each string (_ALPHABET_MIN for NULL entries).
+ *      utf8Strings  - Array of nrStrings UTF8 strings.
+ *      nrStrings    - Number of strings.
+ *
+ * Returns:
+ *      The number of strings with a recognized alphabet (>= 0), or ERR_BAD_ARGUMENTS if an argument is invalid.
+ */
+int recognizeAlphabetsUtf8(
+        enum Alphabet *alphabets,
+        const char *const *utf8Strings,
+        int nrStrings);
+
+
 /**
  * Encode a string to Alphabet characters for a language.
  *
@@ -524,6 +903,28 @@ const TerritoryAlphabets *getAlphabetsForTerritory(enum Territory territory);
 char *convertMapcodeToAlphabetUtf8(char *utf8String, const char *asciiString, enum Alphabet alphabet);
 
 
+/**
+ * Convert a number of mapcodes to Alphabet characters for a language, in UTF8, into a single buffer.
+ *
+ * Arguments:
+ *      utf8Buffer      - Buffer to be filled with the UTF8 results, each zero-terminated, back to back.
+ *      utf8BufferSize  - Size of utf8Buffer, in bytes.
+ *      mapcodeStrings  - ASCII mapcodes to convert (each must be < MAX_MAPCODE_RESULT_ASCII_LEN characters).
+ *      nrMapcodes      - Number of mapcodes in mapcodeStrings.
+ *      alphabet        - Alphabet to use.
+ *
+ * Returns:
+ *      Number of mapcodes converted. This is less than nrMapcodes if utf8Buffer is full.
+ *      Negative if the arguments are invalid.
+ */
+int convertMapcodesToAlphabetUtf8(
+        char *utf8Buffer,
+        int utf8BufferSize,
+        const char *const *mapcodeStrings,
+        int nrMapcodes,
+        enum Alphabet alphabet);
+
+
 /**
  * Encode a string to Alphabet characters for a language.
  *
@@ -539,6 +940,285 @@ char *convertMapcodeToAlphabetUtf8(char *utf8String, const char *asciiString, en
 UWORD *convertMapcodeToAlphabetUtf16(UWORD *utf16String, const char *asciiString, enum Alphabet alphabet);
 
 
+/**
+ * Convert a number of mapcodes to Alphabet characters for a language, in UTF16, into a single buffer.
+ *
+ * Arguments:
+ *      utf16Buffer     - Buffer to be filled with the UTF16 results, each zero-terminated, back to back.
+ *      utf16BufferSize - Size of utf16Buffer, in 16-bit characters.
+ *      mapcodeStrings  - ASCII mapcodes to convert (each must be < MAX_MAPCODE_RESULT_ASCII_LEN characters).
+ *      nrMapcodes      - Number of mapcodes in mapcodeStrings.
+ *      alphabet        - Alphabet to use.
+ *
+ * Returns:
+ *      Number of mapcodes converted. This is less than nrMapcodes if utf16Buffer is full.
+ *      Negative if the arguments are invalid.
+ */
+int convertMapcodesToAlphabetUtf16(
+        UWORD *utf16Buffer,
+        int utf16BufferSize,
+        const char *const *mapcodeStrings,
+        int nrMapcodes,
+        enum Alphabet alphabet);
+
+
+/**
+ * Convert a buffer of UTF16 mapcodes (in any alphabet) to roman ASCII mapcodes, e.g. to decode
+ * them with decodeMapcodeToLatLonUtf8. Decoding a converted mapcode gives the same result as
+ * decoding the UTF16 mapcode with decodeMapcodeToLatLonUtf16.
+ *
+ * Arguments:
+ *      asciiBuffer     - Buffer to be filled with the ASCII mapcodes, each zero-terminated, back to back.
+ *                        No mapcode becomes longer than its UTF16 source.
+ *      asciiBufferSize - Size of asciiBuffer, in characters.
+ *      utf16Buffer     - Buffer with the UTF16 mapcodes, each zero-terminated, back to back.
+ *      nrMapcodes      - Number of mapcodes in utf16Buffer.
+ *
+ * Returns:
+ *      Number of mapcodes converted. This is less than nrMapcodes if asciiBuffer is full.
+ *      Negative if the arguments are invalid.
+ */
+int convertMapcodesUtf16ToAscii(
+        char *asciiBuffer,
+        int asciiBufferSize,
+        const UWORD *utf16Buffer,
+        int nrMapcodes);
+
+
+/**
+ * Convert a buffer of UTF8 or UTF16 mapcodes (in any alphabet) to their roman form: the territory
+ * code (if any), the proper mapcode and the precision extension (if any), e.g. "NLD 49.4V-K2". The
+ * mapcodes are only parsed and checked for invalid characters, not decoded: a converted mapcode does
+ * not necessarily decode to a coordinate.
+ *
+ * Arguments:
+ *      asciiBuffer     - Buffer to be filled with the roman mapcodes, each zero-terminated, back to back.
+ *                        A mapcode that is not valid is converted to an empty string.
+ *      asciiBufferSize - Size of asciiBuffer, in characters (at most MAX_MAPCODE_RESULT_ASCII_LEN per mapcode).
+ *      utf8Buffer      - Buffer with the UTF8 mapcodes, each zero-terminated, back to back.
+ *      utf16Buffer     - Buffer with the UTF16 mapcodes, each zero-terminated, back to back.
+ *      nrMapcodes      - Number of mapcodes in utf8Buffer or utf16Buffer.
+ *
+ * Returns:
+ *      Number of mapcodes converted. This is less than nrMapcodes if asciiBuffer is full.
+ *      Negative if the arguments are invalid.
+ */
+int convertMapcodesToRomanUtf8(
+        char *asciiBuffer,
+        int asciiBufferSize,
+        const char *utf8Buffer,
+        int nrMapcodes);
+
+int convertMapcodesToRomanUtf16(
+        char *asciiBuffer,
+        int asciiBufferSize,
+        const UWORD *utf16Buffer,
+        int nrMapcodes);
+
+
+/**
+ * Mapcode data loaded from a data file, see loadMapcodeDataFile.
+ */
+typedef struct MapcodeDataFile MapcodeDataFile;
+
+
+/**
+ * Load a mapcode data file, as generated by tools/generate_data_file.py. The data can then be used
+ * instead of the compiled-in data, see useMapcodeDataFile, so the data can be updated without
+ * rebuilding the library. Where possible, the file is mapped into memory rather than read, so all
+ * processes that load the same file share a single copy.
+ *
+ * Arguments:
+ *      dataFile        - Receives the loaded data file (NULL on error). Release it with unloadMapcodeDataFile.
+ *      fileName        - Name of the data file.
+ *
+ * Returns:
+ *      ERR_OK if the file was loaded. ERR_DATA_FILE_UNREADABLE if the file cannot be read,
+ *      ERR_DATA_FILE_VERSION if its format version is not supported, ERR_DATA_FILE_CHECKSUM if it is
+ *      corrupt and ERR_DATA_FILE_INVALID if its tables do not match this library.
+ */
+enum MapcodeError loadMapcodeDataFile(
+        MapcodeDataFile **dataFile,
+        const char *fileName);
+
+
+/**
+ * Release a data file loaded with loadMapcodeDataFile. If the default context uses the data file, it
+ * uses the compiled-in data again. No other context may use the data file anymore.
+ *
+ * Arguments:
+ *      dataFile        - Data file to release, may be NULL.
+ */
+void unloadMapcodeDataFile(MapcodeDataFile *dataFile);
+
+
+/**
+ * Select the data used by the default context, i.e. by all encode and decode functions without a
+ * MapcodeContext argument. This must not be called while another thread uses the default context.
+ *
+ * Arguments:
+ *      dataFile        - Data file to use, or NULL to use the compiled-in data.
+ */
+void useMapcodeDataFile(const MapcodeDataFile *dataFile);
+
+
+/**
+ * Get the data version of the mapcode data used by the default context (MAPCODE_DATA_VERSION for the
+ * compiled-in data).
+ *
+ * Returns:
+ *      The data version, e.g. "2.3.0".
+ */
+const char *getMapcodeDataVersion(void);
+
+
+/**
+ * A MapcodeContext holds the mapcode data used by the encoder and decoder, and the statistics of
+ * the calls made with it. The functions without a MapcodeContext argument use a default context,
+ * which uses the compiled-in data (or the data file selected with useMapcodeDataFile) and keeps no
+ * statistics. Every function with a MapcodeContext argument accepts NULL for the default context.
+ *
+ * Contexts allow, for example, to use two data versions side by side. A context must not be used
+ * by several threads at the same time: create one context per thread (the contexts can share a
+ * data file).
+ */
+typedef struct MapcodeContext MapcodeContext;
+
+typedef struct {
+    long nrEncodes;         // Number of encode calls.
+    long nrEncodeResults;   // Number of mapcodes returned by encode calls.
+    long nrDecodes;         // Number of decode calls (one per candidate territory for decodeMapcodeInTerritories).
+    long nrDecodeErrors;    // Number of decode calls that returned an error.
+} MapcodeStatistics;
+
+
+/**
+ * Create a context.
+ *
+ * Arguments:
+ *      dataFile        - Data file to use, or NULL to use the compiled-in data. The data file must not
+ *                        be unloaded while the context exists.
+ *
+ * Returns:
+ *      The context (release it with destroyMapcodeContext), or NULL if out of memory.
+ */
+MapcodeContext *createMapcodeContext(const MapcodeDataFile *dataFile);
+
+
+/**
+ * Release a context created with createMapcodeContext.
+ *
+ * Arguments:
+ *      mapcodeContext  - Context to release, may be NULL.
+ */
+void destroyMapcodeContext(MapcodeContext *mapcodeContext);
+
+
+/**
+ * Get the data version of the mapcode data used by a context.
+ *
+ * Arguments:
+ *      mapcodeContext  - Context, or NULL for the default context.
+ *
+ * Returns:
+ *      The data version, e.g. "2.3.0".
+ */
+const char *getMapcodeContextDataVersion(const MapcodeContext *mapcodeContext);
+
+
+/**
+ * Get or reset the statistics of a context.
+ *
+ * Arguments:
+ *      statistics      - Receives the statistics (all 0 for the default context).
+ *      mapcodeContext  - Context, or NULL for the default context.
+ */
+void getMapcodeStatistics(MapcodeStatistics *statistics, const MapcodeContext *mapcodeContext);
+
+void resetMapcodeStatistics(MapcodeContext *mapcodeContext);
+
+
+/**
+ * The following functions are the same as the functions without "WithContext", but use the data of
+ * mapcodeContext (NULL for the default context) and count the call in its statistics.
+ */
+int encodeLatLonToMapcodesWithContext(
+        MapcodeContext *mapcodeContext,
+        Mapcodes *mapcodes,
+        double latDeg,
+        double lonDeg,
+        enum Territory territory,
+        int extraDigits);
+
+int encodeLatLonToMapcodesWithPrecisionsWithContext(
+        MapcodeContext *mapcodeContext,
+        MapcodesWithPrecisions *mapcodes,
+        double latDeg,
+        double lonDeg,
+        enum Territory territory);
+
+int encodeLatLonToSingleMapcodeWithContext(
+        MapcodeContext *mapcodeContext,
+        char *mapcode,
+        double latDeg,
+        double lonDeg,
+        enum Territory territory,
+        int extraDigits);
+
+enum MapcodeError decodeMapcodeToLatLonUtf8WithContext(
+        MapcodeContext *mapcodeContext,
+        double *latDeg,
+        double *lonDeg,
+        const char *utf8string,
+        enum Territory territory,
+        MapcodeElements *mapcodeElements);
+
+enum MapcodeError decodeMapcodeToLatLonUtf16WithContext(
+        MapcodeContext *mapcodeContext,
+        double *latDeg,
+        double *lonDeg,
+        const UWORD *utf16string,
+        enum Territory territory,
+        MapcodeElements *mapcodeElements);
+
+enum MapcodeError decodeParsedMapcodeWithContext(
+        MapcodeContext *mapcodeContext,
+        double *latDeg,
+        double *lonDeg,
+        const MapcodeElements *mapcodeElements,
+        enum Territory territory);
+
+int decodeMapcodeInTerritoriesWithContext(
+        MapcodeContext *mapcodeContext,
+        MapcodeDecodeResult *results,
+        const char *utf8string,
+        const enum Territory *candidates,
+        int nrCandidates);
+
+enum Territory getTerritoryCodeWithContext(
+        const MapcodeContext *mapcodeContext,
+        const char *territoryISO,
+        enum Territory optionalTerritoryContext);
+
+enum Territory getCountryOrParentCountryWithContext(
+        const MapcodeContext *mapcodeContext,
+        enum Territory territory);
+
+enum Territory getParentCountryOfWithContext(
+        const MapcodeContext *mapcodeContext,
+        enum Territory territory);
+
+int multipleBordersNearbyWithContext(
+        const MapcodeContext *mapcodeContext,
+        double latDeg,
+        double lonDeg,
+        enum Territory territory);
+
+const TerritoryAlphabets *getAlphabetsForTerritoryWithContext(
+        const MapcodeContext *mapcodeContext,
+        enum Territory territory);
+
+
 #ifdef __cplusplus
 }
 #endif
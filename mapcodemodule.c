@@ -15,9 +15,14 @@
  */
 
 #include "Python.h"
+#include "structmember.h"
 #include "mapcoder.h"
 #include "mapcode_legacy.h"
 #include <math.h>
+#include <string.h>
+#if defined(__unix__) || defined(__APPLE__)
+#include <unistd.h>
+#endif
 
 static char version_doc[] =
 "version() -> string\n\
@@ -30,6 +35,69 @@ static PyObject *version(PyObject *self, PyObject *args)
 }
 
 
+static char data_version_doc[] =
+"data_version() -> string\n\
+\n\
+Returns the version of the mapcode data used by this module: the\n\
+compiled-in data, or the data file loaded with load_data().\n";
+
+static PyObject *data_version(PyObject *self, PyObject *args)
+{
+    return Py_BuildValue("s", getMapcodeDataVersion());
+}
+
+
+/* Raises the exception for an error of loadMapcodeDataFile and returns NULL. */
+static PyObject *data_file_error(enum MapcodeError err, const char *filename)
+{
+    switch (err) {
+        case ERR_DATA_FILE_UNREADABLE:
+            return PyErr_Format(PyExc_IOError, "cannot read mapcode data file '%s'", filename);
+        case ERR_DATA_FILE_VERSION:
+            return PyErr_Format(PyExc_ValueError, "unsupported format version of mapcode data file '%s'", filename);
+        case ERR_DATA_FILE_CHECKSUM:
+            return PyErr_Format(PyExc_ValueError, "checksum mismatch in mapcode data file '%s'", filename);
+        default:
+            return PyErr_Format(PyExc_ValueError, "invalid mapcode data file '%s'", filename);
+    }
+}
+
+static char load_data_doc[] =
+"load_data((filename)) -> string\n\
+\n\
+Loads a mapcode data file (generated with tools/generate_data_file.py)\n\
+and uses its data instead of the compiled-in data, so the data can be\n\
+updated without rebuilding the module. The file is mapped into memory,\n\
+so processes that load the same file share a single copy. Without a\n\
+filename (or with None), the compiled-in data is used again. The table\n\
+territories is not changed. To use several data versions side by side,\n\
+see open_data().\n\
+\n\
+Returns the version of the data, raises IOError if the file cannot be\n\
+read and ValueError if it is not a valid data file.\n";
+
+static MapcodeDataFile *data_file = NULL;
+
+static PyObject *load_data(PyObject *self, PyObject *args)
+{
+    char *filename = NULL;
+    MapcodeDataFile *loaded = NULL;
+
+    if (!PyArg_ParseTuple(args, "|z", &filename))
+       return NULL;
+
+    if (filename) {
+        enum MapcodeError err = loadMapcodeDataFile(&loaded, filename);
+        if (err != ERR_OK)
+            return data_file_error(err, filename);
+    }
+    useMapcodeDataFile(loaded);
+    unloadMapcodeDataFile(data_file);
+    data_file = loaded;
+    return Py_BuildValue("s", getMapcodeDataVersion());
+}
+
+
 static char isvalid_doc[] =
 "isvalid(mapcode) -> bool\n\
 \n\
@@ -87,6 +155,104 @@ static PyObject *decode(PyObject *self, PyObject *args)
 }
 
 
+static char decode_all_doc[] =
+"decode_all(mapcode, (territorynames)) -> [(float, float, string)]\n\
+\n\
+Decodes the provided string in each of the given territory contexts\n\
+(by default: in every territory). Returns a list of tuples that contain\n\
+the latitude, longitude and territory of each territory in which the\n\
+mapcode decodes. Unknown territory names are ignored.\n\
+\n\
+Returns an empty list when the mapcode does not decode anywhere.\n";
+
+static PyObject *decode_all(PyObject *self, PyObject *args)
+{
+    char *mapcode;
+    PyObject *territorynames = NULL, *result;
+
+    if (!PyArg_ParseTuple(args, "s|O", &mapcode, &territorynames))
+       return NULL;
+
+    int n = 0;
+    enum Territory *candidates;
+    if (territorynames && territorynames != Py_None) {
+        PyObject *sequence = PySequence_Fast(territorynames, "territorynames must be a sequence");
+        if (sequence == NULL)
+            return NULL;
+        Py_ssize_t i, count = PySequence_Fast_GET_SIZE(sequence);
+        candidates = PyMem_New(enum Territory, count > 0 ? count : 1);
+        if (candidates == NULL) {
+            Py_DECREF(sequence);
+            return PyErr_NoMemory();
+        }
+        for (i = 0; i < count; i++) {
+            char *territoryname;
+            if (!PyArg_Parse(PySequence_Fast_GET_ITEM(sequence, i), "s", &territoryname)) {
+                PyMem_Free(candidates);
+                Py_DECREF(sequence);
+                return NULL;
+            }
+            enum Territory territorycode = getTerritoryCode(territoryname, 0);
+            if (territorycode > _TERRITORY_MIN)
+                candidates[n++] = territorycode;
+        }
+        Py_DECREF(sequence);
+    } else {
+        candidates = PyMem_New(enum Territory, _TERRITORY_MAX - _TERRITORY_MIN - 1);
+        if (candidates == NULL)
+            return PyErr_NoMemory();
+        for (n = 0; n < _TERRITORY_MAX - _TERRITORY_MIN - 1; n++)
+            candidates[n] = (enum Territory) (_TERRITORY_MIN + 1 + n);
+    }
+
+    MapcodeDecodeResult *decode_results = PyMem_New(MapcodeDecodeResult, n > 0 ? n : 1);
+    if (decode_results == NULL) {
+        PyMem_Free(candidates);
+        return PyErr_NoMemory();
+    }
+    n = decodeMapcodeInTerritories(decode_results, mapcode, candidates, n);
+    PyMem_Free(candidates);
+
+    result = PyList_New(n > 0 ? n : 0);
+    while (result != NULL && n-- > 0) {
+        char territoryname[MAX_ISOCODE_ASCII_LEN + 1];
+        getTerritoryIsoName(territoryname, decode_results[n].territory, 0);
+        PyObject *item = Py_BuildValue("(dds)", decode_results[n].latDeg, decode_results[n].lonDeg, territoryname);
+        if (item == NULL) {
+            Py_CLEAR(result);
+            break;
+        }
+        PyList_SET_ITEM(result, n, item);
+    }
+    PyMem_Free(decode_results);
+    return result;
+}
+
+
+static char territory_from_name_doc[] =
+"territory_from_name(name, (locale)) -> string\n\
+\n\
+Returns the territory code of the territory with the given full name,\n\
+in any language or only in the given locale (e.g. 'fr_FR'). Names are\n\
+compared without case and diacritics.\n\
+\n\
+Returns None when the name is not found.\n";
+
+static PyObject *territory_from_name(PyObject *self, PyObject *args)
+{
+    char *name, *locale = NULL;
+    char territoryname[MAX_ISOCODE_ASCII_LEN + 1];
+
+    if (!PyArg_ParseTuple(args, "s|z", &name, &locale))
+       return NULL;
+
+    enum Territory territorycode = getTerritoryCodeFromName(name, locale);
+    if (territorycode == TERRITORY_NONE)
+        Py_RETURN_NONE;
+    return Py_BuildValue("s", getTerritoryIsoName(territoryname, territorycode, 0));
+}
+
+
 static char encode_doc[] =
  "encode(latitude, longitude, (territoryname, (extra_digits))) -> [(string, string)] \n\
 \n\
@@ -130,21 +296,738 @@ static PyObject *encode(PyObject *self, PyObject *args)
 }
 
 
+static char encode_precisions_doc[] =
+ "encode_precisions(latitude, longitude, (territoryname)) -> ([(string, string, string)], [float]) \n\
+\n\
+Encodes the given latitude, longitude for all precisions at once.\n\
+Returns a list of tuples that contain a mapcode (without extension), its\n\
+territory context and its full extension, and the list of the maximum\n\
+error in meters for 0 to 8 extra digits. The mapcode with n extra digits\n\
+is the mapcode, a hyphen and the first n characters of the extension, as\n\
+encode() returns it with extra_digits n.\n";
+
+static PyObject *encode_precisions(PyObject *self, PyObject *args)
+{
+    double latitude, longitude;
+    char *territoryname = NULL;
+    int territorycode = 0, i;
+    MapcodesWithPrecisions mapcodes;
+
+    if (!PyArg_ParseTuple(args, "dd|z", &latitude, &longitude, &territoryname))
+       return NULL;
+
+    mapcodes.count = 0;
+    if (territoryname) {
+        territorycode = getTerritoryCode(territoryname, 0);
+    }
+    if (territorycode >= 0) {
+        encodeLatLonToMapcodesWithPrecisions(&mapcodes, latitude, longitude, territorycode);
+    }
+
+    PyObject *codes = PyList_New(mapcodes.count);
+    PyObject *errors = PyList_New(MAX_PRECISION_DIGITS + 1);
+    if (codes == NULL || errors == NULL) {
+        Py_XDECREF(codes);
+        Py_XDECREF(errors);
+        return NULL;
+    }
+    for (i = 0; i <= MAX_PRECISION_DIGITS; i++) {
+        PyList_SET_ITEM(errors, i, PyFloat_FromDouble(maxErrorInMeters(i)));
+    }
+    for (i = 0; i < mapcodes.count; i++) {
+        char territory[MAX_ISOCODE_ASCII_LEN + 1];
+        const char *mapcode = mapcodes.mapcode[i];
+        const char *space = strchr(mapcode, ' ');
+        if (space == NULL) {
+            strcpy(territory, "AAA");
+        } else {
+            memcpy(territory, mapcode, space - mapcode);
+            territory[space - mapcode] = 0;
+            mapcode = space + 1;
+        }
+        PyObject *item = Py_BuildValue("(sss)", mapcode, territory, mapcodes.extension[i]);
+        if (item == NULL) {
+            Py_DECREF(codes);
+            Py_DECREF(errors);
+            return NULL;
+        }
+        PyList_SET_ITEM(codes, i, item);
+    }
+    return Py_BuildValue("(NN)", codes, errors);
+}
+
+/*
+ * Territory metadata, built once when the module is imported. Row i of every column
+ * describes territory _TERRITORY_MIN + 1 + i. The integer columns are memoryviews on
+ * static arrays, so numpy/pandas can use them without copying.
+ */
+#define NR_TERRITORIES (_TERRITORY_MAX - _TERRITORY_MIN - 1)
+
+static int territory_parents[NR_TERRITORIES];
+static int territory_countries[NR_TERRITORIES];
+static signed char territory_alphabets[NR_TERRITORIES][MAX_ALPHABETS_PER_TERRITORY];
+
+static Py_ssize_t territory_column_shape[2] = { NR_TERRITORIES, MAX_ALPHABETS_PER_TERRITORY };
+static Py_ssize_t territory_int_strides[1] = { sizeof(int) };
+static Py_ssize_t territory_alphabet_strides[2] = { MAX_ALPHABETS_PER_TERRITORY, 1 };
+
+typedef struct {
+    PyObject_HEAD
+    PyObject *iso_names;
+    PyObject *iso_short_names;
+    PyObject *parents;
+    PyObject *countries;
+    PyObject *alphabets;
+    PyObject *names;            /* dict: locale number -> tuple of names, filled on use */
+} TerritoryTable;
+
+static char territory_table_doc[] =
+"Read-only table of territory metadata, one row per territory.\n\
+\n\
+    iso_names            Tuple of ISO codes, e.g. 'US-CA'.\n\
+    iso_short_names      Tuple of short ISO codes, e.g. 'CA'.\n\
+    parents              Row of the parent country, or -1 (int32 memoryview).\n\
+    countries            Row of the country itself or its parent (int32 memoryview).\n\
+    alphabets            Alphabets used in the territory, padded with -1\n\
+                         (int8 memoryview of shape (rows, 3)).\n\
+    names((locale))      Tuple of the full name of every territory in the given\n\
+                         locale (e.g. 'fr_FR'), or the local names by default.\n";
+
+/* Returns a read-only memoryview on a static column (shape and strides must be static as well). */
+static PyObject *territory_column(void *data, char *format, Py_ssize_t itemsize, int ndim, Py_ssize_t *strides)
+{
+    Py_buffer view;
+    int i;
+
+    view.buf = data;
+    view.obj = NULL;
+    view.len = itemsize;
+    for (i = 0; i < ndim; i++)
+        view.len *= territory_column_shape[i];
+    view.readonly = 1;
+    view.itemsize = itemsize;
+    view.format = format;
+    view.ndim = ndim;
+    view.shape = territory_column_shape;
+    view.strides = strides;
+    view.suboffsets = NULL;
+    view.internal = NULL;
+    return PyMemoryView_FromBuffer(&view);
+}
+
+static char territory_table_names_doc[] =
+"names((locale)) -> (string, ...)\n\
+\n\
+Returns the full name of every territory in the given locale (e.g. 'fr_FR'),\n\
+or the local names if no locale is given. Unknown locales use English.\n";
+
+static PyObject *territory_table_names(TerritoryTable *self, PyObject *args)
+{
+    char *locale = NULL;
+
+    if (!PyArg_ParseTuple(args, "|z", &locale))
+       return NULL;
+
+    int nameLocale = getTerritoryNameLocale(locale);
+    PyObject *key = PyLong_FromLong(nameLocale);
+    if (key == NULL)
+        return NULL;
+    PyObject *result = PyDict_GetItem(self->names, key);
+    if (result != NULL) {
+        Py_DECREF(key);
+        Py_INCREF(result);
+        return result;
+    }
+
+    result = PyTuple_New(NR_TERRITORIES);
+    int i;
+    for (i = 0; result != NULL && i < NR_TERRITORIES; i++) {
+        int length;
+        const char *name = getFullTerritoryNameRef(&length, (enum Territory) (_TERRITORY_MIN + 1 + i), 0,
+                                                   nameLocale, _ALPHABET_MIN);
+        PyObject *item;
+        if (name == NULL) {
+            Py_INCREF(Py_None);
+            item = Py_None;
+        } else {
+            item = PyUnicode_DecodeUTF8(name, length, NULL);
+        }
+        if (item == NULL) {
+            Py_CLEAR(result);
+            break;
+        }
+        PyTuple_SET_ITEM(result, i, item);
+    }
+    if (result != NULL && PyDict_SetItem(self->names, key, result) < 0)
+        Py_CLEAR(result);
+    Py_DECREF(key);
+    return result;
+}
+
+static Py_ssize_t territory_table_length(PyObject *self)
+{
+    return NR_TERRITORIES;
+}
+
+static void territory_table_dealloc(TerritoryTable *self)
+{
+    Py_XDECREF(self->iso_names);
+    Py_XDECREF(self->iso_short_names);
+    Py_XDECREF(self->parents);
+    Py_XDECREF(self->countries);
+    Py_XDECREF(self->alphabets);
+    Py_XDECREF(self->names);
+    PyObject_Del(self);
+}
+
+static PyMemberDef territory_table_members[] = {
+    { "iso_names", T_OBJECT_EX, offsetof(TerritoryTable, iso_names), READONLY, NULL },
+    { "iso_short_names", T_OBJECT_EX, offsetof(TerritoryTable, iso_short_names), READONLY, NULL },
+    { "parents", T_OBJECT_EX, offsetof(TerritoryTable, parents), READONLY, NULL },
+    { "countries", T_OBJECT_EX, offsetof(TerritoryTable, countries), READONLY, NULL },
+    { "alphabets", T_OBJECT_EX, offsetof(TerritoryTable, alphabets), READONLY, NULL },
+    { NULL, 0, 0, 0, NULL }
+};
+
+static PyMethodDef territory_table_methods[] = {
+    { "names", (PyCFunction) territory_table_names, METH_VARARGS, territory_table_names_doc },
+    { NULL, NULL, 0, NULL }
+};
+
+static PySequenceMethods territory_table_as_sequence = {
+    territory_table_length,     /* sq_length */
+};
+
+static PyTypeObject TerritoryTableType = {
+    PyVarObject_HEAD_INIT(NULL, 0)
+    "mapcode.TerritoryTable",   /* tp_name */
+    sizeof(TerritoryTable),     /* tp_basicsize */
+};
+
+/* Creates the territory table; returns NULL (with an exception set) on failure. */
+static PyObject *new_territory_table(void)
+{
+    TerritoryTableType.tp_flags = Py_TPFLAGS_DEFAULT;
+    TerritoryTableType.tp_doc = territory_table_doc;
+    TerritoryTableType.tp_dealloc = (destructor) territory_table_dealloc;
+    TerritoryTableType.tp_as_sequence = &territory_table_as_sequence;
+    TerritoryTableType.tp_members = territory_table_members;
+    TerritoryTableType.tp_methods = territory_table_methods;
+    if (PyType_Ready(&TerritoryTableType) < 0)
+        return NULL;
+
+    TerritoryTable *table = PyObject_New(TerritoryTable, &TerritoryTableType);
+    if (table == NULL)
+        return NULL;
+    table->iso_names = PyTuple_New(NR_TERRITORIES);
+    table->iso_short_names = PyTuple_New(NR_TERRITORIES);
+    table->parents = territory_column(territory_parents, "i", sizeof(int), 1, territory_int_strides);
+    table->countries = territory_column(territory_countries, "i", sizeof(int), 1, territory_int_strides);
+    table->alphabets = territory_column(territory_alphabets, "b", 1, 2, territory_alphabet_strides);
+    table->names = PyDict_New();
+    if (!table->iso_names || !table->iso_short_names || !table->parents || !table->countries ||
+        !table->alphabets || !table->names) {
+        Py_DECREF(table);
+        return NULL;
+    }
+
+    int i;
+    for (i = 0; i < NR_TERRITORIES; i++) {
+        enum Territory territory = (enum Territory) (_TERRITORY_MIN + 1 + i);
+        char territoryname[MAX_ISOCODE_ASCII_LEN + 1];
+        PyObject *item;
+
+        item = Py_BuildValue("s", getTerritoryIsoName(territoryname, territory, 0));
+        if (item == NULL) {
+            Py_DECREF(table);
+            return NULL;
+        }
+        PyTuple_SET_ITEM(table->iso_names, i, item);
+        item = Py_BuildValue("s", getTerritoryIsoName(territoryname, territory, 1));
+        if (item == NULL) {
+            Py_DECREF(table);
+            return NULL;
+        }
+        PyTuple_SET_ITEM(table->iso_short_names, i, item);
+
+        enum Territory parent = getParentCountryOf(territory);
+        territory_parents[i] = (parent > _TERRITORY_MIN) ? (int) (parent - _TERRITORY_MIN - 1) : -1;
+        territory_countries[i] = (int) (getCountryOrParentCountry(territory) - _TERRITORY_MIN - 1);
+
+        const TerritoryAlphabets *alphabets = getAlphabetsForTerritory(territory);
+        int a;
+        for (a = 0; a < MAX_ALPHABETS_PER_TERRITORY; a++)
+            territory_alphabets[i][a] = (signed char) ((alphabets && a < alphabets->count) ? alphabets->alphabet[a] : -1);
+    }
+    return (PyObject *) table;
+}
+
+/*
+ * Data sets: mapcode data opened next to the data in use, so codes can be encoded and decoded under
+ * several data versions side by side. Every data set has its own context; the functions release the
+ * GIL only in diff(), which creates contexts per thread.
+ */
+typedef struct {
+    PyObject_HEAD
+    MapcodeDataFile *data_file;     /* NULL for the compiled-in data */
+    MapcodeContext *context;
+} DataSet;
+
+static PyTypeObject DataSetType = {
+    PyVarObject_HEAD_INIT(NULL, 0)
+    "mapcode.DataSet",          /* tp_name */
+    sizeof(DataSet),            /* tp_basicsize */
+};
+
+static char data_set_doc[] =
+"Mapcode data, opened with open_data(), that can be used next to the data\n\
+in use by the module functions.\n\
+\n\
+    version()            Returns the version of the data.\n\
+    encode(...)          Same as mapcode.encode(), with this data.\n\
+    decode(...)          Same as mapcode.decode(), with this data.\n";
+
+/* Returns a list of (mapcode, territoryname) tuples, as encode(). */
+static PyObject *mapcodes_to_list(const Mapcodes *mapcodes)
+{
+    PyObject *result = PyList_New(mapcodes->count);
+    int i;
+
+    for (i = 0; result != NULL && i < mapcodes->count; i++) {
+        char territoryname[MAX_ISOCODE_ASCII_LEN + 1];
+        const char *space = strchr(mapcodes->mapcode[i], ' ');
+        PyObject *item;
+        if (space == NULL) {
+            item = Py_BuildValue("(ss)", mapcodes->mapcode[i], "AAA");
+        } else {
+            memcpy(territoryname, mapcodes->mapcode[i], space - mapcodes->mapcode[i]);
+            territoryname[space - mapcodes->mapcode[i]] = 0;
+            item = Py_BuildValue("(ss)", space + 1, territoryname);
+        }
+        if (item == NULL)
+            Py_CLEAR(result);
+        else
+            PyList_SET_ITEM(result, i, item);
+    }
+    return result;
+}
+
+static char data_set_version_doc[] =
+"version() -> string\n\
+\n\
+Returns the version of the data of this data set.\n";
+
+static PyObject *data_set_version(DataSet *self, PyObject *args)
+{
+    return Py_BuildValue("s", getMapcodeContextDataVersion(self->context));
+}
+
+static char data_set_encode_doc[] =
+"encode(latitude, longitude, (territoryname, (extra_digits))) -> [(string, string)]\n\
+\n\
+Same as mapcode.encode(), but with the data of this data set.\n";
+
+static PyObject *data_set_encode(DataSet *self, PyObject *args)
+{
+    double latitude, longitude;
+    char *territoryname = NULL;
+    int extra_digits = 0, territorycode = 0;
+    Mapcodes mapcodes;
+
+    if (!PyArg_ParseTuple(args, "dd|zi", &latitude, &longitude, &territoryname, &extra_digits))
+       return NULL;
+
+    if (territoryname) {
+        territorycode = getTerritoryCodeWithContext(self->context, territoryname, 0);
+        if (territorycode < 0)
+            return PyList_New(0);
+    }
+    encodeLatLonToMapcodesWithContext(self->context, &mapcodes, latitude, longitude, territorycode, extra_digits);
+    return mapcodes_to_list(&mapcodes);
+}
+
+static char data_set_decode_doc[] =
+"decode(mapcode, (territoryname)) -> (float, float)\n\
+\n\
+Same as mapcode.decode(), but with the data of this data set.\n";
+
+static PyObject *data_set_decode(DataSet *self, PyObject *args)
+{
+    char *mapcode, *territoryname = NULL;
+    double latitude, longitude;
+    int territorycode = 0;
+
+    if (!PyArg_ParseTuple(args, "s|s", &mapcode, &territoryname))
+       return NULL;
+
+    if (territoryname) {
+        territorycode = getTerritoryCodeWithContext(self->context, territoryname, 0);
+        if (territorycode < 0)
+            return Py_BuildValue("ff", NAN, NAN);
+    }
+    if (decodeMapcodeToLatLonUtf8WithContext(self->context, &latitude, &longitude, mapcode, territorycode, NULL)) {
+        latitude = NAN;
+        longitude = NAN;
+    }
+    return Py_BuildValue("ff", latitude, longitude);
+}
+
+static void data_set_dealloc(DataSet *self)
+{
+    destroyMapcodeContext(self->context);
+    unloadMapcodeDataFile(self->data_file);
+    PyObject_Del(self);
+}
+
+static PyMethodDef data_set_methods[] = {
+    { "version", (PyCFunction) data_set_version, METH_NOARGS, data_set_version_doc },
+    { "encode", (PyCFunction) data_set_encode, METH_VARARGS, data_set_encode_doc },
+    { "decode", (PyCFunction) data_set_decode, METH_VARARGS, data_set_decode_doc },
+    { NULL, NULL, 0, NULL }
+};
+
+/* Sets up the data set type; returns -1 (with an exception set) on failure. */
+static int init_data_set_type(void)
+{
+    DataSetType.tp_flags = Py_TPFLAGS_DEFAULT;
+    DataSetType.tp_doc = data_set_doc;
+    DataSetType.tp_dealloc = (destructor) data_set_dealloc;
+    DataSetType.tp_methods = data_set_methods;
+    return PyType_Ready(&DataSetType);
+}
+
+static char open_data_doc[] =
+"open_data((filename)) -> DataSet\n\
+\n\
+Opens a mapcode data file (generated with tools/generate_data_file.py)\n\
+as a data set, or the compiled-in data if no filename is given. The data\n\
+set can be used next to the data in use by the module functions, for\n\
+example to encode and decode with an older data version, or to compare\n\
+two versions with diff().\n\
+\n\
+Raises IOError if the file cannot be read and ValueError if it is not a\n\
+valid data file.\n";
+
+static PyObject *open_data(PyObject *self, PyObject *args)
+{
+    char *filename = NULL;
+    MapcodeDataFile *loaded = NULL;
+
+    if (!PyArg_ParseTuple(args, "|z", &filename))
+       return NULL;
+
+    if (filename) {
+        enum MapcodeError err = loadMapcodeDataFile(&loaded, filename);
+        if (err != ERR_OK)
+            return data_file_error(err, filename);
+    }
+    DataSet *data_set = PyObject_New(DataSet, &DataSetType);
+    if (data_set == NULL) {
+        unloadMapcodeDataFile(loaded);
+        return NULL;
+    }
+    data_set->data_file = loaded;
+    data_set->context = createMapcodeContext(loaded);
+    if (data_set->context == NULL) {
+        Py_DECREF(data_set);
+        return PyErr_NoMemory();
+    }
+    return (PyObject *) data_set;
+}
+
+
+/*
+ * Bulk comparison of two data sets. The coordinates are split over a number of threads, which
+ * run without the GIL and each use their own contexts. A thread only collects the indices of the
+ * coordinates whose mapcodes differ; their mapcodes are encoded again afterwards, with the GIL.
+ */
+typedef struct {
+    const MapcodeDataFile *old_data;
+    const MapcodeDataFile *new_data;
+    const double *latitudes;
+    const double *longitudes;
+    Py_ssize_t first;
+    Py_ssize_t last;            /* exclusive */
+    int extra_digits;
+    Py_ssize_t *changed;        /* indices of the changed coordinates (malloc) */
+    Py_ssize_t nr_changed;
+    Py_ssize_t max_changed;
+    int out_of_memory;
+    PyThread_type_lock done;    /* released when the worker is done, NULL if it runs in the calling thread */
+} DiffWorker;
+
+static int same_mapcodes(const Mapcodes *a, const Mapcodes *b)
+{
+    int i;
+
+    if (a->count != b->count)
+        return 0;
+    for (i = 0; i < a->count; i++) {
+        if (strcmp(a->mapcode[i], b->mapcode[i]) != 0)
+            return 0;
+    }
+    return 1;
+}
+
+static void diff_worker(void *arg)
+{
+    DiffWorker *worker = (DiffWorker *) arg;
+    MapcodeContext *old_context = createMapcodeContext(worker->old_data);
+    MapcodeContext *new_context = createMapcodeContext(worker->new_data);
+    Mapcodes old_mapcodes, new_mapcodes;
+    Py_ssize_t i;
+
+    worker->out_of_memory = (old_context == NULL || new_context == NULL);
+    for (i = worker->first; !worker->out_of_memory && i < worker->last; i++) {
+        encodeLatLonToMapcodesWithContext(old_context, &old_mapcodes, worker->latitudes[i], worker->longitudes[i],
+                                          TERRITORY_NONE, worker->extra_digits);
+        encodeLatLonToMapcodesWithContext(new_context, &new_mapcodes, worker->latitudes[i], worker->longitudes[i],
+                                          TERRITORY_NONE, worker->extra_digits);
+        if (same_mapcodes(&old_mapcodes, &new_mapcodes))
+            continue;
+        if (worker->nr_changed == worker->max_changed) {
+            Py_ssize_t max_changed = worker->max_changed ? 2 * worker->max_changed : 256;
+            Py_ssize_t *changed = (Py_ssize_t *) realloc(worker->changed, max_changed * sizeof(Py_ssize_t));
+            if (changed == NULL) {
+                worker->out_of_memory = 1;
+                break;
+            }
+            worker->changed = changed;
+            worker->max_changed = max_changed;
+        }
+        worker->changed[worker->nr_changed++] = i;
+    }
+    destroyMapcodeContext(old_context);
+    destroyMapcodeContext(new_context);
+    if (worker->done)
+        PyThread_release_lock(worker->done);
+}
+
+typedef struct {
+    Py_buffer view;             /* view.obj is NULL if the values were copied */
+    double *copy;
+    const double *values;
+    Py_ssize_t count;
+} Coordinates;
+
+/* Gets a buffer of doubles (e.g. a numpy array) without copying, or copies a sequence of numbers. */
+static int get_coordinates(Coordinates *coordinates, PyObject *object, const char *name)
+{
+    coordinates->view.obj = NULL;
+    coordinates->copy = NULL;
+    if (PyObject_CheckBuffer(object) &&
+        PyObject_GetBuffer(object, &coordinates->view, PyBUF_C_CONTIGUOUS | PyBUF_FORMAT) == 0) {
+        const char *format = coordinates->view.format;
+        if (format && (format[0] == '@' || format[0] == '=' || format[0] == '<') && format[1] == 'd')
+            format++;
+        if (format && strcmp(format, "d") == 0 && coordinates->view.itemsize == sizeof(double)) {
+            coordinates->values = (const double *) coordinates->view.buf;
+            coordinates->count = coordinates->view.len / (Py_ssize_t) sizeof(double);
+            return 0;
+        }
+        PyBuffer_Release(&coordinates->view);
+        coordinates->view.obj = NULL;
+    }
+    PyErr_Clear();
+
+    PyObject *sequence = PySequence_Fast(object, name);
+    if (sequence == NULL)
+        return -1;
+    Py_ssize_t i, count = PySequence_Fast_GET_SIZE(sequence);
+    coordinates->copy = PyMem_New(double, count > 0 ? count : 1);
+    if (coordinates->copy == NULL) {
+        Py_DECREF(sequence);
+        PyErr_NoMemory();
+        return -1;
+    }
+    for (i = 0; i < count; i++) {
+        coordinates->copy[i] = PyFloat_AsDouble(PySequence_Fast_GET_ITEM(sequence, i));
+        if (coordinates->copy[i] == -1.0 && PyErr_Occurred()) {
+            Py_DECREF(sequence);
+            PyMem_Free(coordinates->copy);
+            coordinates->copy = NULL;
+            return -1;
+        }
+    }
+    Py_DECREF(sequence);
+    coordinates->values = coordinates->copy;
+    coordinates->count = count;
+    return 0;
+}
+
+static void release_coordinates(Coordinates *coordinates)
+{
+    if (coordinates->view.obj)
+        PyBuffer_Release(&coordinates->view);
+    PyMem_Free(coordinates->copy);
+}
+
+static int default_nr_threads(void)
+{
+#ifdef _SC_NPROCESSORS_ONLN
+    long nr_processors = sysconf(_SC_NPROCESSORS_ONLN);
+    return nr_processors > 0 ? (int) nr_processors : 1;
+#else
+    return 1;
+#endif
+}
+
+/* Runs the workers, the first one in the calling thread; the GIL must have been released. */
+static void run_diff_workers(DiffWorker *workers, int nr_workers)
+{
+    int i;
+
+    for (i = 1; i < nr_workers; i++) {
+        workers[i].done = PyThread_allocate_lock();
+        if (workers[i].done != NULL) {
+            PyThread_acquire_lock(workers[i].done, WAIT_LOCK);
+            if (PyThread_start_new_thread(diff_worker, &workers[i]) == (unsigned long) -1) {
+                PyThread_free_lock(workers[i].done);
+                workers[i].done = NULL;
+            }
+        }
+        if (workers[i].done == NULL)
+            diff_worker(&workers[i]);
+    }
+    diff_worker(&workers[0]);
+    for (i = 1; i < nr_workers; i++) {
+        if (workers[i].done != NULL) {
+            PyThread_acquire_lock(workers[i].done, WAIT_LOCK);
+            PyThread_free_lock(workers[i].done);
+        }
+    }
+}
+
+static char diff_doc[] =
+"diff(old, new, latitudes, longitudes, (threads, (extra_digits))) -> [(int, [(string, string)], [(string, string)])]\n\
+\n\
+Encodes every coordinate with the data sets old and new (see open_data())\n\
+and returns the coordinates for which the mapcodes differ, as a list of\n\
+tuples with the index of the coordinate and its mapcodes with the old and\n\
+the new data (as returned by encode()). The latitudes and longitudes can\n\
+be sequences of numbers, or buffers of doubles (such as numpy float64\n\
+arrays), which are used without copying.\n\
+\n\
+The work is spread over the given number of threads (by default one per\n\
+processor), which run without holding the GIL.\n";
+
+static PyObject *diff(PyObject *self, PyObject *args)
+{
+    DataSet *old_data, *new_data;
+    PyObject *latitudes_object, *longitudes_object, *result = NULL;
+    int nr_threads = 0, extra_digits = 0;
+    Coordinates latitudes, longitudes;
+
+    if (!PyArg_ParseTuple(args, "O!O!OO|ii", &DataSetType, &old_data, &DataSetType, &new_data,
+                          &latitudes_object, &longitudes_object, &nr_threads, &extra_digits))
+       return NULL;
+
+    if (get_coordinates(&latitudes, latitudes_object, "latitudes must be a sequence") < 0)
+        return NULL;
+    if (get_coordinates(&longitudes, longitudes_object, "longitudes must be a sequence") < 0) {
+        release_coordinates(&latitudes);
+        return NULL;
+    }
+    if (latitudes.count != longitudes.count) {
+        PyErr_SetString(PyExc_ValueError, "latitudes and longitudes must have the same length");
+        goto done;
+    }
+
+    Py_ssize_t count = latitudes.count;
+    if (nr_threads <= 0)
+        nr_threads = default_nr_threads();
+    if (nr_threads > count)
+        nr_threads = (count > 0) ? (int) count : 1;
+    DiffWorker *workers = PyMem_New(DiffWorker, nr_threads);
+    if (workers == NULL) {
+        PyErr_NoMemory();
+        goto done;
+    }
+    int i;
+    for (i = 0; i < nr_threads; i++) {
+        DiffWorker *worker = &workers[i];
+        memset(worker, 0, sizeof(DiffWorker));
+        worker->old_data = old_data->data_file;
+        worker->new_data = new_data->data_file;
+        worker->latitudes = latitudes.values;
+        worker->longitudes = longitudes.values;
+        worker->first = (count * i) / nr_threads;
+        worker->last = (count * (i + 1)) / nr_threads;
+        worker->extra_digits = extra_digits;
+    }
+
+    Py_BEGIN_ALLOW_THREADS
+    run_diff_workers(workers, nr_threads);
+    Py_END_ALLOW_THREADS
+
+    result = PyList_New(0);
+    for (i = 0; i < nr_threads; i++) {
+        Py_ssize_t c;
+        if (workers[i].out_of_memory && result != NULL) {
+            Py_CLEAR(result);
+            PyErr_NoMemory();
+        }
+        for (c = 0; result != NULL && c < workers[i].nr_changed; c++) {
+            Py_ssize_t index = workers[i].changed[c];
+            Mapcodes mapcodes;
+            PyObject *old_list, *new_list, *item = NULL;
+            encodeLatLonToMapcodesWithContext(old_data->context, &mapcodes, latitudes.values[index],
+                                              longitudes.values[index], TERRITORY_NONE, extra_digits);
+            old_list = mapcodes_to_list(&mapcodes);
+            encodeLatLonToMapcodesWithContext(new_data->context, &mapcodes, latitudes.values[index],
+                                              longitudes.values[index], TERRITORY_NONE, extra_digits);
+            new_list = mapcodes_to_list(&mapcodes);
+            if (old_list && new_list)
+                item = Py_BuildValue("(nOO)", index, old_list, new_list);
+            Py_XDECREF(old_list);
+            Py_XDECREF(new_list);
+            if (item == NULL || PyList_Append(result, item) < 0)
+                Py_CLEAR(result);
+            Py_XDECREF(item);
+        }
+        free(workers[i].changed);
+    }
+    PyMem_Free(workers);
+
+done:
+    release_coordinates(&latitudes);
+    release_coordinates(&longitudes);
+    return result;
+}
+
+
 static char mapcode_doc[] =
 "Mapcode support library (see http://www.mapcode.com).\n\
 \n\
 This module exports the following functions:\n\
-    version     Returns the version of the Mapcode C library.\n\
-    isvalid     Verifies if the provided mapcode has the correct syntax.\n\
-    decode      Decodes a mapcode to latitude and longitude.\n\
-    encode      Encodes latitude and longitude to one or more mapcodes.\n";
+    version              Returns the version of the Mapcode C library.\n\
+    data_version         Returns the version of the mapcode data in use.\n\
+    load_data            Loads the mapcode data from a data file.\n\
+    open_data            Opens mapcode data to use next to the data in use.\n\
+    diff                 Returns the coordinates whose mapcodes differ between two data sets.\n\
+    isvalid              Verifies if the provided mapcode has the correct syntax.\n\
+    decode               Decodes a mapcode to latitude and longitude.\n\
+    decode_all           Decodes a mapcode in all territories where it is valid.\n\
+    territory_from_name  Returns the territory code of a territory name.\n\
+    encode               Encodes latitude and longitude to one or more mapcodes.\n\
+    encode_precisions    Encodes latitude and longitude for all precisions at once.\n\
+\n\
+and the following attribute:\n\
+    territories          Read-only table of territory metadata.\n";
 
 /* The methods we expose in Python. */
 static PyMethodDef mapcode_methods[] = {
     { "version", version, METH_VARARGS, version_doc },
+    { "data_version", data_version, METH_VARARGS, data_version_doc },
+    { "load_data", load_data, METH_VARARGS, load_data_doc },
+    { "open_data", open_data, METH_VARARGS, open_data_doc },
+    { "diff", diff, METH_VARARGS, diff_doc },
     { "isvalid", isvalid, METH_VARARGS, isvalid_doc },
     { "decode", decode, METH_VARARGS, decode_doc },
+    { "decode_all", decode_all, METH_VARARGS, decode_all_doc },
+    { "territory_from_name", territory_from_name, METH_VARARGS, territory_from_name_doc },
     { "encode", encode, METH_VARARGS, encode_doc },
+    { "encode_precisions", encode_precisions, METH_VARARGS, encode_precisions_doc },
     { NULL, NULL, 0, NULL }
 };
 
@@ -164,11 +1047,29 @@ PyMODINIT_FUNC PyInit_mapcode(void)
         NULL,                /* m_free */
     };
 
-    return(PyModule_Create(&mapcode_module));
+    if (init_data_set_type() < 0)
+        return NULL;
+    PyObject *module = PyModule_Create(&mapcode_module);
+    if (module == NULL)
+        return NULL;
+    PyObject *territories = new_territory_table();
+    if (territories == NULL || PyModule_AddObject(module, "territories", territories) < 0) {
+        Py_XDECREF(territories);
+        Py_DECREF(module);
+        return NULL;
+    }
+    return module;
 }
 #else
 PyMODINIT_FUNC initmapcode(void)
 {
-    Py_InitModule3("mapcode", mapcode_methods, mapcode_doc);
+    if (init_data_set_type() < 0)
+        return;
+    PyObject *module = Py_InitModule3("mapcode", mapcode_methods, mapcode_doc);
+    if (module == NULL)
+        return;
+    PyObject *territories = new_territory_table();
+    if (territories != NULL)
+        PyModule_AddObject(module, "territories", territories);
 }
 #endif
\ No newline at end of file
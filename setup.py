@@ -1,12 +1,50 @@
+import glob
+import os
+import re
 import setuptools
 
 module_version = '2.5.5.0'
 
+# The languages of the territory names can be chosen when building, for example:
+#   MAPCODE_LANGUAGES=en,nl pip install mapcode
+# English and the local names are always included. By default all languages are included.
+languages = [name[len('mapcodelib/internal_territory_names_'):-len('.h')].upper()
+             for name in sorted(glob.glob('mapcodelib/internal_territory_names_??.h'))]
+selected_languages = os.environ.get('MAPCODE_LANGUAGES', 'all').upper().replace(' ', '').split(',')
+define_macros = []
+if selected_languages != ['ALL']:
+    unknown_languages = [language for language in selected_languages if language not in languages]
+    if unknown_languages:
+        raise SystemExit('MAPCODE_LANGUAGES: unknown language(s) %s; use "all" or any of %s' %
+                         (', '.join(unknown_languages), ', '.join(languages)))
+    define_macros.append(('MAPCODE_NO_SUPPORT_ALL_LANGUAGES', None))
+    define_macros.extend(('MAPCODE_SUPPORT_LANGUAGE_' + language, None)
+                         for language in selected_languages if language != 'EN')
+
+# The territories with specialised encoders and decoders (generated by tools/generate_hot_territories.py)
+# can be chosen when building, for example:
+#   MAPCODE_HOT_TERRITORIES=NLD,IND pip install mapcode
+# By default all generated territories are included; use "none" to include none.
+with open('mapcodelib/internal_hot_encoders.h') as f:
+    hot_territories = sorted(set(re.findall(r'defined\(MAPCODE_HOT_TERRITORY_(\w+)\)', f.read())))
+selected_hot_territories = os.environ.get('MAPCODE_HOT_TERRITORIES', 'all').upper().replace(' ', '').split(',')
+if selected_hot_territories == ['NONE']:
+    define_macros.append(('NO_HOT_TERRITORIES', None))
+elif selected_hot_territories != ['ALL']:
+    unknown_territories = [territory for territory in selected_hot_territories if territory not in hot_territories]
+    if unknown_territories:
+        raise SystemExit('MAPCODE_HOT_TERRITORIES: unknown territory(s) %s; use "all", "none" or any of %s '
+                         '(or generate others with tools/generate_hot_territories.py)' %
+                         (', '.join(unknown_territories), ', '.join(hot_territories)))
+    define_macros.append(('MAPCODE_SELECT_HOT_TERRITORIES', None))
+    define_macros.extend(('MAPCODE_HOT_TERRITORY_' + territory, None) for territory in selected_hot_territories)
+
 setuptools.setup(
     name='mapcode',
     ext_modules=[setuptools.Extension('mapcode',
                            sources=['mapcodemodule.c', 'mapcodelib/mapcoder.c', 'mapcodelib/mapcode_legacy.c'],
-                           include_dirs=['mapcodelib']
+                           include_dirs=['mapcodelib'],
+                           define_macros=define_macros
                            )],
     version=module_version,
     description='A Python module to do mapcode encoding and decoding. See http://www.mapcode.com for more information.',
@@ -0,0 +1,116 @@
+#!/usr/bin/python
+# -*- coding: utf-8 -*-
+#
+# Copyright (C) 2014-2019 Stichting Mapcode Foundation (http://www.mapcode.com)
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#    http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+# Generates mapcodelib/internal_alphabet_utf8.h from the ASCII_TO_UTF16 table in mapcodelib/mapcoder.c.
+#
+# For every alphabet, the table holds the UTF8 encoding of the 36 mapcode characters (A-Z, 0-9),
+# so mapcodes can be written in an alphabet in UTF8 without an intermediate UTF16 string.
+#
+# Usage: python tools/generate_alphabet_utf8.py [mapcodelib directory]
+
+from __future__ import print_function
+import os
+import re
+import sys
+
+
+def read_ascii_to_utf16(filename):
+    with open(filename, 'r') as f:
+        source = f.read()
+    start = source.index('ASCII_TO_UTF16[_ALPHABET_MAX][36]')
+    body = source[source.index('\n', start):source.index('};', start)]
+    alphabets = []
+    for line in body.split('\n'):
+        m = re.match(r'\s*\{([^}]*)\},\s*// (.*)', line)
+        if m:
+            codes = [int(v, 16) for v in m.group(1).split(',')]
+            assert len(codes) == 36
+            alphabets.append((codes, m.group(2).split('//')[0].strip()))
+    return alphabets
+
+
+def utf8(code):
+    if code < 0x80:
+        return [code]
+    elif code < 0x800:
+        return [0xC0 + (code >> 6), 0x80 + (code & 63)]
+    return [0xE0 + (code >> 12), 0x80 + ((code >> 6) & 63), 0x80 + (code & 63)]
+
+
+def generate(directory):
+    alphabets = read_ascii_to_utf16(os.path.join(directory, 'mapcoder.c'))
+
+    target = os.path.join(directory, 'internal_alphabet_utf8.h')
+    with open(target, 'w') as f:
+        f.write(HEADER)
+        f.write('// *** GENERATED FILE (tools/generate_alphabet_utf8.py), DO NOT CHANGE OR PRETTIFY ***\n\n')
+        f.write('typedef struct {\n')
+        f.write('    unsigned char length;   // number of bytes in utf8 (1..3)\n')
+        f.write('    char utf8[4];           // utf8 encoding (zero-terminated)\n')
+        f.write('} AlphabetUtf8Char;\n\n')
+        f.write('// utf8 equivalents for ascii characters A to Z, 0-9, per alphabet\n')
+        f.write('static const AlphabetUtf8Char ASCII_TO_UTF8[_ALPHABET_MAX][36] = {\n')
+        for codes, name in alphabets:
+            entries = []
+            for code in codes:
+                encoded = utf8(code)
+                entries.append('{%d, "%s"}' % (len(encoded), ''.join('\\x%02x' % b for b in encoded)))
+            f.write('        { // %s\n' % name)
+            for i in range(0, 36, 6):
+                f.write('                %s,\n' % ', '.join(entries[i:i + 6]))
+            f.write('        },\n')
+        f.write('};\n\n')
+        f.write(FOOTER)
+    print('Generated %s: %d alphabets.' % (target, len(alphabets)))
+
+
+HEADER = '''/*
+ * Copyright (C) 2014-2019 Stichting Mapcode Foundation (http://www.mapcode.com)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __INTERNAL_ALPHABET_UTF8_H__
+#define __INTERNAL_ALPHABET_UTF8_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+'''
+
+FOOTER = '''#ifdef __cplusplus
+}
+#endif
+
+#endif // __INTERNAL_ALPHABET_UTF8_H__
+'''
+
+
+if __name__ == "__main__":
+    generate(sys.argv[1] if len(sys.argv) > 1 else
+             os.path.join(os.path.dirname(os.path.abspath(__file__)), '..', 'mapcodelib'))
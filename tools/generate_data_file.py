@@ -0,0 +1,143 @@
+#!/usr/bin/python
+# -*- coding: utf-8 -*-
+#
+# Copyright (C) 2014-2019 Stichting Mapcode Foundation (http://www.mapcode.com)
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#    http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+# Generates a mapcode data file from the data headers in mapcodelib. The library can load such a
+# file (loadMapcodeDataFile) and use it instead of its compiled-in tables, so the data can be
+# updated without rebuilding the library. The file is mapped into memory as-is, so all values are
+# stored in the byte order and with the sizes of the C types (little-endian, 32-bit int).
+#
+# Layout (all offsets in bytes, from the start of the file):
+#
+#   header (64 bytes)
+#       char   magic[8]             "MAPCODE\0"
+#       uint32 formatVersion        DATA_FILE_FORMAT_VERSION
+#       uint32 endianMark           0x01020304
+#       uint32 fileSize
+#       uint32 checksum             CRC-32 of everything after the header
+#       uint32 nrTables
+#       uint32 nrTerritories        _TERRITORY_MAX - _TERRITORY_MIN - 1
+#       char   dataVersion[32]      MAPCODE_DATA_VERSION, zero-terminated
+#   table directory (nrTables entries of 16 bytes)
+#       uint32 id, count, offset, elementSize
+#   tables, each starting at a multiple of 8 bytes
+#
+# Usage: python tools/generate_data_file.py <output file> [mapcodelib directory]
+
+from __future__ import print_function
+import os
+import re
+import struct
+import sys
+import zlib
+
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+from generate_restricted_overlaps import read_data
+
+DATA_FILE_MAGIC = b'MAPCODE\0'
+DATA_FILE_FORMAT_VERSION = 1
+HEADER_SIZE = 64
+DIRECTORY_ENTRY_SIZE = 16
+ALIGNMENT = 8
+
+# table ids, as in mapcoder.c
+TABLE_DATA_START = 1
+TABLE_TERRITORY_BOUNDARIES = 2
+TABLE_REDIVAR = 3
+TABLE_PARENT_LETTER = 4
+TABLE_PARENT_NUMBER = 5
+TABLE_ALPHABETS_FOR_TERRITORY = 6
+# 7 to 11 are no longer used: the library computes the restricted overlaps from the boundary records
+
+
+def read_source(directory, name):
+    with open(os.path.join(directory, name), 'r') as f:
+        return f.read()
+
+
+def read_territories(directory):
+    source = read_source(directory, 'mapcode_territories.h')
+    names = re.findall(r'^\s*(TERRITORY_\w+),', source, re.M)
+    return dict((name, 1001 + number) for number, name in enumerate(names))
+
+
+def read_int_array(source, name, constants=None):
+    start = source.index(name + '[')
+    body = source[source.index('{', start) + 1:source.index('}', start)]
+    values = [v.strip() for v in re.sub(r'//[^\n]*', '', body).replace('\n', ' ').split(',') if v.strip()]
+    return [constants[v] if constants and v in constants else int(v) for v in values]
+
+
+def read_alphabets(directory):
+    names = re.findall(r'^\s*(ALPHABET_\w+)', read_source(directory, 'mapcode_alphabets.h'), re.M)
+    alphabet = dict((name, number) for number, name in enumerate(names))
+    source = read_source(directory, 'internal_territory_alphabets.h')
+    start = source.index('ALPHABETS_FOR_TERRITORY[')
+    end = source.index('};', start)
+    alphabets = []
+    for m in re.finditer(r'\{(\d+), \{([^}]*)\}\}', source[start:end]):
+        codes = [alphabet[a.strip()] for a in m.group(2).split(',')]
+        assert len(codes) == int(m.group(1)) and len(codes) <= 3
+        alphabets.append([len(codes)] + codes + [0] * (3 - len(codes)))
+    return alphabets
+
+
+def generate(target, directory):
+    version, data_start, records = read_data(os.path.join(directory, 'internal_data.h'))
+    nr_territories = len(data_start) - 1
+    iso3166 = read_source(directory, 'internal_iso3166_data.h')
+    parent_letter = read_int_array(iso3166, 'PARENT_LETTER')
+    parent_number = read_int_array(iso3166, 'PARENT_NUMBER')
+    redivar = read_int_array(read_source(directory, 'internal_territory_search.h'), 'REDIVAR',
+                             read_territories(directory))
+    alphabets = read_alphabets(directory)
+    assert len(parent_letter) == len(parent_number) == nr_territories + 1
+    assert len(alphabets) == nr_territories
+
+    # (id, element format, elements)
+    tables = [
+        (TABLE_DATA_START, 'i', data_start),
+        (TABLE_TERRITORY_BOUNDARIES, '5i', records),
+        (TABLE_REDIVAR, 'i', redivar),
+        (TABLE_PARENT_LETTER, 'b', parent_letter),
+        (TABLE_PARENT_NUMBER, 'b', parent_number),
+        (TABLE_ALPHABETS_FOR_TERRITORY, '4i', alphabets)]
+
+    directory_entries = b''
+    payload = b''
+    offset = HEADER_SIZE + DIRECTORY_ENTRY_SIZE * len(tables)
+    for table_id, element_format, elements in tables:
+        element = struct.Struct('<' + element_format)
+        data = b''.join(element.pack(*(e if isinstance(e, (list, tuple)) else (e,))) for e in elements)
+        data += b'\0' * (-len(data) % ALIGNMENT)
+        directory_entries += struct.pack('<4I', table_id, len(elements), offset + len(payload), element.size)
+        payload += data
+
+    body = directory_entries + payload
+    header = struct.pack('<8s6I32s', DATA_FILE_MAGIC, DATA_FILE_FORMAT_VERSION, 0x01020304, HEADER_SIZE + len(body),
+                         zlib.crc32(body) & 0xFFFFFFFF, len(tables), nr_territories, version.encode('ascii'))
+    assert len(header) == HEADER_SIZE
+    with open(target, 'wb') as f:
+        f.write(header + body)
+    print('Generated %s: %d bytes, %d tables (data version %s).' % (target, len(header) + len(body), len(tables),
+                                                                      version))
+
+
+if __name__ == "__main__":
+    if len(sys.argv) < 2:
+        sys.exit('Usage: python tools/generate_data_file.py <output file> [mapcodelib directory]')
+    generate(sys.argv[1], sys.argv[2] if len(sys.argv) > 2 else
+             os.path.join(os.path.dirname(os.path.abspath(__file__)), '..', 'mapcodelib'))
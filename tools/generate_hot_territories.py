@@ -0,0 +1,212 @@
+#!/usr/bin/python
+# -*- coding: utf-8 -*-
+#
+# Copyright (C) 2014-2019 Stichting Mapcode Foundation (http://www.mapcode.com)
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#    http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+# Generates mapcodelib/internal_hot_encoders.h and mapcodelib/internal_hot_decoders.h from
+# mapcodelib/internal_data.h: specialised encoders and decoders for a few "hot" territories.
+#
+# For every hot territory the records are unrolled as constants:
+#   - nextHotRecord() tests the records in order, with their bounds as literals, instead of the
+#     generic loop over the records;
+#   - encodeHotGrid() and decodeHotGrid() call the grid routines (which are always inlined) with a
+#     constant record, so the compiler folds its codex, grid divisions and bounds.
+# The library uses them only for the compiled-in data. The code of each territory is enclosed in
+# #if !defined(MAPCODE_SELECT_HOT_TERRITORIES) || defined(MAPCODE_HOT_TERRITORY_<name>), so a build
+# can select a subset of the generated territories (see setup.py); define NO_HOT_TERRITORIES to
+# use none.
+#
+# Usage: python tools/generate_hot_territories.py [territory ...] [--directory mapcodelib directory]
+#        territories by their enum name without TERRITORY_, e.g. NLD USA IND US_CA
+
+from __future__ import print_function
+import os
+import re
+import sys
+
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+from generate_restricted_overlaps import read_data, IS_NAMELESS, rec_type
+
+DEFAULT_TERRITORIES = ['NLD', 'USA', 'IND']
+
+
+def read_territory_names(directory):
+    with open(os.path.join(directory, 'mapcode_territories.h'), 'r') as f:
+        return [name[len('TERRITORY_'):] for name in re.findall(r'^\s*(TERRITORY_\w+),', f.read(), re.M)]
+
+
+def is_grid(rec):
+    # as encodeGrid and decodeGrid are used in mapcoder.c
+    return not (rec[4] & IS_NAMELESS) and rec_type(rec) <= 1
+
+
+def selected(name):
+    return '#if !defined(MAPCODE_SELECT_HOT_TERRITORIES) || defined(MAPCODE_HOT_TERRITORY_%s)\n' % name
+
+
+def read_boundary_max(directory):
+    with open(os.path.join(directory, 'internal_data.h'), 'r') as f:
+        return int(re.search(r'#define MAPCODE_BOUNDARY_MAX (\d+)', f.read()).group(1))
+
+
+def generate(directory, territories):
+    version, data_start, records = read_data(os.path.join(directory, 'internal_data.h'))
+    boundary_max = read_boundary_max(directory)
+    names = read_territory_names(directory)
+    hot = []
+    for name in territories:
+        if name not in names:
+            sys.exit('Unknown territory %s; use the enum name without TERRITORY_, e.g. NLD or US_CA' % name)
+        index = names.index(name)
+        hot.append((name, data_start[index], data_start[index + 1] - 1))
+
+    nr_grid_records = 0
+    target = os.path.join(directory, 'internal_hot_encoders.h')
+    with open(target, 'w') as f:
+        f.write(header('__INTERNAL_HOT_ENCODERS_H__', 'internal_hot_encoders.h', version, boundary_max))
+        f.write('// returns nonzero if territory ccode, of which the records start at from, is a hot territory\n')
+        f.write('static int isHotTerritory(const enum Territory ccode, const int from) {\n')
+        f.write('    switch (ccode) {\n')
+        for name, first, last in hot:
+            f.write(selected(name))
+            f.write('        case TERRITORY_%s:\n' % name)
+            f.write('            return from == %d;\n' % first)
+            f.write('#endif\n')
+        f.write('        default:\n')
+        f.write('            return 0;\n')
+        f.write('    }\n')
+        f.write('}\n\n')
+
+        f.write('// returns the first record, from record m on, of a hot territory that contains coord32 (or its last record + 1)\n')
+        f.write('static int nextHotRecord(const Point32 *coord32, const int m) {\n')
+        f.write('    const int lat = coord32->latMicroDeg;\n')
+        f.write('    const int lon = coord32->lonMicroDeg;\n')
+        f.write('    switch (m) {\n')
+        for name, first, last in hot:
+            f.write(selected(name))
+            f.write('        // %s\n' % name)
+            for m in range(first, last + 1):
+                minx, miny, maxx, maxy, flags = records[m]
+                f.write('        case %d:\n' % m)
+                f.write('            if (%d <= lat && lat < %d && isInRange(lon, %d, %d)) {\n' % (miny, maxy, minx, maxx))
+                f.write('                return %d;\n' % m)
+                f.write('            }\n')
+                if m < last:
+                    f.write('            /* fall through */\n')
+            f.write('            return %d;\n' % (last + 1))
+            f.write('#endif\n')
+        f.write('        default:\n')
+        f.write('            ASSERT(0);\n')
+        f.write('            return m;\n')
+        f.write('    }\n')
+        f.write('}\n\n')
+
+        f.write('// encodes in grid record m of a hot territory (see encodeGrid); returns 0 if m is not such a record\n')
+        f.write('static int encodeHotGrid(char *result, const EncodeRec *enc, const int m, const int extraDigits,\n')
+        f.write('                         const char headerLetter) {\n')
+        f.write('    switch (m) {\n')
+        for name, first, last in hot:
+            f.write(selected(name))
+            for m in range(first, last + 1):
+                if is_grid(records[m]):
+                    f.write('        case %d:\n' % m)
+                    f.write('            encodeGridInBoundary(result, enc, &TERRITORY_BOUNDARIES[%d], extraDigits, headerLetter);\n' % m)
+                    f.write('            return 1;\n')
+                    nr_grid_records += 1
+            f.write('#endif\n')
+        f.write('        default:\n')
+        f.write('            return 0;\n')
+        f.write('    }\n')
+        f.write('}\n\n')
+        f.write(footer('__INTERNAL_HOT_ENCODERS_H__'))
+
+    target = os.path.join(directory, 'internal_hot_decoders.h')
+    with open(target, 'w') as f:
+        f.write(header('__INTERNAL_HOT_DECODERS_H__', 'internal_hot_decoders.h', version, boundary_max))
+        f.write('// decodes in grid record m of a hot territory (see decodeGrid) into *err; returns 0 if m is not such a record\n')
+        f.write('static int decodeHotGrid(enum MapcodeError *err, DecodeRec *dec, const int m, const int hasHeaderLetter) {\n')
+        f.write('    switch (m) {\n')
+        for name, first, last in hot:
+            f.write(selected(name))
+            for m in range(first, last + 1):
+                if is_grid(records[m]):
+                    f.write('        case %d:\n' % m)
+                    f.write('            *err = decodeGridInBoundary(dec, &TERRITORY_BOUNDARIES[%d], hasHeaderLetter);\n' % m)
+                    f.write('            return 1;\n')
+            f.write('#endif\n')
+        f.write('        default:\n')
+        f.write('            return 0;\n')
+        f.write('    }\n')
+        f.write('}\n\n')
+        f.write(footer('__INTERNAL_HOT_DECODERS_H__'))
+
+    print('Generated internal_hot_encoders.h and internal_hot_decoders.h: %d territories (%s), %d grid records '
+          '(data version %s).' % (len(hot), ' '.join(territories), nr_grid_records, version))
+
+
+def header(guard, name, version, boundary_max):
+    return HEADER % (guard, guard) + \
+        '// *** GENERATED FILE (tools/generate_hot_territories.py), DO NOT CHANGE OR PRETTIFY ***\n\n' + \
+        '#define HOT_TERRITORIES_DATA_VERSION "%s"\n\n' % version + \
+        '#if MAPCODE_BOUNDARY_MAX != %d\n' % boundary_max + \
+        '#error "%s does not match internal_data.h: run tools/generate_hot_territories.py"\n' % name + \
+        '#endif\n\n'
+
+
+def footer(guard):
+    return FOOTER % guard
+
+
+HEADER = '''/*
+ * Copyright (C) 2014-2019 Stichting Mapcode Foundation (http://www.mapcode.com)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef %s
+#define %s
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+'''
+
+FOOTER = '''#ifdef __cplusplus
+}
+#endif
+
+#endif // %s
+'''
+
+
+if __name__ == "__main__":
+    arguments = sys.argv[1:]
+    directory = os.path.join(os.path.dirname(os.path.abspath(__file__)), '..', 'mapcodelib')
+    if '--directory' in arguments:
+        i = arguments.index('--directory')
+        directory = arguments[i + 1]
+        del arguments[i:i + 2]
+    generate(directory, arguments or DEFAULT_TERRITORIES)
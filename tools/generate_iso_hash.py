@@ -0,0 +1,146 @@
+#!/usr/bin/python
+# -*- coding: utf-8 -*-
+#
+# Copyright (C) 2014-2019 Stichting Mapcode Foundation (http://www.mapcode.com)
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#    http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+# Generates mapcodelib/internal_iso_hash.h from the ALPHA_SEARCH table in mapcodelib/internal_iso3166_data.h.
+#
+# Every ISO3166 code (at most 7 characters) is packed into two 32-bit words: characters 0-3 in the
+# first, 4-6 in the second, first character in the lowest byte, unused bytes 0. The words are placed
+# in a minimal perfect hash (hash and displace): hashIsoCode(code, ISO_HASH_SEED) selects a bucket, and
+# hashIsoCode(code, ISO_HASH_DISPLACEMENT[bucket]) the slot in ISO_HASH. Must match hashIsoCode in
+# mapcodelib/mapcoder.c.
+#
+# Usage: python tools/generate_iso_hash.py [mapcodelib directory]
+
+from __future__ import print_function
+import os
+import re
+import sys
+
+MAX_ISOCODE_ASCII_LEN = 7
+KEYS_PER_BUCKET = 4
+ISO_HASH_SEED = 0x2545F491
+MASK = 0xFFFFFFFF
+
+
+def hash_iso_code(w0, w1, seed):
+    h = ((w0 ^ seed) * 0x9E3779B1) & MASK
+    h ^= h >> 15
+    h = ((h ^ w1) * 0x85EBCA77) & MASK
+    return h ^ (h >> 13)
+
+
+def pack(code):
+    data = bytearray(code.encode('ascii')) + bytearray(MAX_ISOCODE_ASCII_LEN + 1 - len(code))
+    return (data[0] | (data[1] << 8) | (data[2] << 16) | (data[3] << 24),
+            data[4] | (data[5] << 8) | (data[6] << 16))
+
+
+def read_alpha_search(filename):
+    with open(filename, 'r') as f:
+        source = f.read()
+    start = source.index('ALPHA_SEARCH[')
+    return re.findall(r'\{"([^"]+)",\s*(TERRITORY_\w+)\}', source[start:source.index('};', start)])
+
+
+def generate(directory):
+    codes = read_alpha_search(os.path.join(directory, 'internal_iso3166_data.h'))
+    assert len(set(code for code, territory in codes)) == len(codes)
+    assert all(len(code) <= MAX_ISOCODE_ASCII_LEN and code == code.upper() for code, territory in codes)
+
+    n = len(codes)
+    nr_buckets = (n + KEYS_PER_BUCKET - 1) // KEYS_PER_BUCKET
+    buckets = [[] for _ in range(nr_buckets)]
+    for code, territory in codes:
+        w0, w1 = pack(code)
+        buckets[hash_iso_code(w0, w1, ISO_HASH_SEED) % nr_buckets].append((w0, w1, code, territory))
+
+    # place the largest buckets first, each with the first displacement that puts all its codes in free slots
+    slots = [None] * n
+    displacement = [0] * nr_buckets
+    for b in sorted(range(nr_buckets), key=lambda i: -len(buckets[i])):
+        if not buckets[b]:
+            continue
+        d = 1
+        while True:
+            positions = [hash_iso_code(w0, w1, d) % n for w0, w1, code, territory in buckets[b]]
+            if len(set(positions)) == len(positions) and all(slots[p] is None for p in positions):
+                break
+            d += 1
+        displacement[b] = d
+        for p, entry in zip(positions, buckets[b]):
+            slots[p] = entry
+
+    target = os.path.join(directory, 'internal_iso_hash.h')
+    with open(target, 'w') as f:
+        f.write(HEADER)
+        f.write('// *** GENERATED FILE (tools/generate_iso_hash.py), DO NOT CHANGE OR PRETTIFY ***\n\n')
+        f.write('#define ISO_HASH_SEED 0x%08XU\n' % ISO_HASH_SEED)
+        f.write('#define NR_ISO_HASH_BUCKETS %d\n' % nr_buckets)
+        f.write('#define NR_ISO_HASH %d\n\n' % n)
+        f.write('typedef struct {\n')
+        f.write('    unsigned int code[2];       // packed uppercase ISO3166 code\n')
+        f.write('    enum Territory territory;\n')
+        f.write('} IsoHashRec;\n\n')
+        f.write('// displacement (seed of hashIsoCode) of the codes in each bucket\n')
+        f.write('static const unsigned int ISO_HASH_DISPLACEMENT[NR_ISO_HASH_BUCKETS] = {\n')
+        for i in range(0, nr_buckets, 16):
+            f.write('        %s,\n' % ', '.join('%d' % d for d in displacement[i:i + 16]))
+        f.write('};\n\n')
+        f.write('static const IsoHashRec ISO_HASH[NR_ISO_HASH] = {\n')
+        for w0, w1, code, territory in slots:
+            f.write('        {{0x%08x, 0x%06x}, %s}, // %s\n' % (w0, w1, territory, code))
+        f.write('};\n\n')
+        f.write(FOOTER)
+    print('Generated %s: %d codes, %d buckets, max displacement %d.' % (target, n, nr_buckets, max(displacement)))
+
+
+HEADER = '''/*
+ * Copyright (C) 2014-2019 Stichting Mapcode Foundation (http://www.mapcode.com)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __INTERNAL_ISO_HASH_H__
+#define __INTERNAL_ISO_HASH_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+'''
+
+FOOTER = '''#ifdef __cplusplus
+}
+#endif
+
+#endif // __INTERNAL_ISO_HASH_H__
+'''
+
+
+if __name__ == "__main__":
+    generate(sys.argv[1] if len(sys.argv) > 1 else
+             os.path.join(os.path.dirname(os.path.abspath(__file__)), '..', 'mapcodelib'))
@@ -0,0 +1,166 @@
+#!/usr/bin/python
+# -*- coding: utf-8 -*-
+#
+# Copyright (C) 2014-2019 Stichting Mapcode Foundation (http://www.mapcode.com)
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#    http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+# Generates mapcodelib/internal_restricted_overlaps.h from mapcodelib/internal_data.h.
+#
+# When a mapcode decodes into a restricted grid record, the decoder must find the
+# non-restricted records (earlier in the same territory) that overlap the decoded zone.
+# For every restricted record this script precomputes, per cell of a GRID x GRID
+# bucketing of its rectangle, the ascending list of such records that intersect the cell.
+#
+# Usage: python tools/generate_restricted_overlaps.py [mapcodelib directory]
+
+from __future__ import print_function
+import os
+import re
+import sys
+
+GRID = 4
+MICRODEG_360 = 360000000
+
+IS_NAMELESS = 64
+IS_RESTRICTED = 512
+
+
+def read_data(filename):
+    with open(filename, 'r') as f:
+        source = f.read()
+
+    version = re.search(r'#define MAPCODE_DATA_VERSION "([^"]+)"', source).group(1)
+
+    start = source.index('DATA_START[')
+    body = source[source.index('{', start) + 1:source.index('}', start)]
+    data_start = [int(v) for v in body.replace('\n', ' ').split(',') if v.strip()]
+
+    start = source.index('TERRITORY_BOUNDARIES[MAPCODE_BOUNDARY_MAX')
+    end = source.index('};', start)
+    records = [tuple(int(v, 0) for v in m.groups())
+               for m in re.finditer(r'\{\s*(-?\d+),\s*(-?\d+),\s*(-?\d+),\s*(-?\d+),\s*(0x[0-9a-fA-F]+)\}',
+                                    source[start:end])]
+    return version, data_start, records
+
+
+def overlaps(minx, miny, maxx, maxy, rec):
+    # same half-open semantics as restrictZoneTo, including the 360 degree wrap
+    if not (rec[1] < maxy and miny < rec[3]):
+        return False
+    for shift in (-MICRODEG_360, 0, MICRODEG_360):
+        if rec[0] + shift < maxx and minx < rec[2] + shift:
+            return True
+    return False
+
+
+def rec_type(rec):
+    return (rec[4] >> 7) & 3
+
+
+def compute_restricted_overlaps(data_start, records):
+    restricted = []
+    starts = [0]
+    overlap = []
+    for territory in range(len(data_start) - 1):
+        first = data_start[territory]
+        last = data_start[territory + 1] - 1
+        for i in range(first, last + 1):
+            rec = records[i]
+            if not (rec[4] & IS_RESTRICTED) or (rec[4] & IS_NAMELESS) or rec_type(rec) != 0:
+                continue
+            candidates = [j for j in range(first, i)
+                          if not (records[j][4] & IS_RESTRICTED) and overlaps(rec[0], rec[1], rec[2], rec[3], records[j])]
+            cellx = (rec[2] - rec[0] + GRID - 1) // GRID
+            celly = (rec[3] - rec[1] + GRID - 1) // GRID
+            restricted.append(i)
+            for by in range(GRID):
+                for bx in range(GRID):
+                    minx = rec[0] + bx * cellx
+                    miny = rec[1] + by * celly
+                    overlap.extend(j for j in candidates
+                                   if overlaps(minx, miny, minx + cellx, miny + celly, records[j]))
+                    starts.append(len(overlap))
+    return restricted, starts, overlap
+
+
+def generate(directory):
+    version, data_start, records = read_data(os.path.join(directory, 'internal_data.h'))
+    restricted, starts, overlap = compute_restricted_overlaps(data_start, records)
+
+    target = os.path.join(directory, 'internal_restricted_overlaps.h')
+    with open(target, 'w') as f:
+        f.write(HEADER)
+        f.write('// *** GENERATED FILE (tools/generate_restricted_overlaps.py), DO NOT CHANGE OR PRETTIFY ***\n\n')
+        f.write('#define RESTRICTED_OVERLAPS_DATA_VERSION "%s"\n' % version)
+        f.write('#define RESTRICTED_OVERLAPS_GRID %d\n' % GRID)
+        f.write('#define NR_RESTRICTED_RECS %d\n\n' % len(restricted))
+        f.write('#if MAPCODE_BOUNDARY_MAX != %d\n' % len(records))
+        f.write('#error "internal_restricted_overlaps.h does not match internal_data.h: '
+                'run tools/generate_restricted_overlaps.py"\n')
+        f.write('#endif\n\n')
+        f.write('// restricted grid records (ascending)\n')
+        write_array(f, 'static const int RESTRICTED_REC[NR_RESTRICTED_RECS]', restricted)
+        f.write('// per restricted record, per cell (row-major, from miny/minx): first entry in RESTRICTED_OVERLAP\n')
+        write_array(f, 'static const int RESTRICTED_OVERLAP_START[NR_RESTRICTED_RECS * RESTRICTED_OVERLAPS_GRID * '
+                       'RESTRICTED_OVERLAPS_GRID + 1]', starts)
+        f.write('// non-restricted records (ascending per cell) that intersect the cell\n')
+        write_array(f, 'static const unsigned short RESTRICTED_OVERLAP[%d]' % max(1, len(overlap)), overlap or [0])
+        f.write(FOOTER)
+    print('Generated %s: %d restricted records, %d overlap entries (data version %s).' %
+          (target, len(restricted), len(overlap), version))
+
+
+def write_array(f, declaration, values):
+    f.write('%s = {\n' % declaration)
+    for i in range(0, len(values), 16):
+        f.write('        %s,\n' % ', '.join(str(v) for v in values[i:i + 16]))
+    f.write('};\n\n')
+
+
+HEADER = '''/*
+ * Copyright (C) 2014-2019 Stichting Mapcode Foundation (http://www.mapcode.com)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __INTERNAL_RESTRICTED_OVERLAPS_H__
+#define __INTERNAL_RESTRICTED_OVERLAPS_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+'''
+
+FOOTER = '''#ifdef __cplusplus
+}
+#endif
+
+#endif // __INTERNAL_RESTRICTED_OVERLAPS_H__
+'''
+
+
+if __name__ == "__main__":
+    generate(sys.argv[1] if len(sys.argv) > 1 else
+             os.path.join(os.path.dirname(os.path.abspath(__file__)), '..', 'mapcodelib'))
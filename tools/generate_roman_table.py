@@ -0,0 +1,118 @@
+#!/usr/bin/python
+# -*- coding: utf-8 -*-
+#
+# Copyright (C) 2014-2019 Stichting Mapcode Foundation (http://www.mapcode.com)
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#    http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+# Generates mapcodelib/internal_roman_table.h from mapcodelib/internal_alphabet_recognizer.h.
+#
+# The table flattens ROMAN_VERSION_OF (64-character blocks, NULL for blocks without mapcode
+# characters) into one array with the romanised version of every UTF16 character up to
+# ROMAN_VERSION_MAX_CHAR. The high bit of an entry is set if the character is in an abjad
+# alphabet (whose mapcodes need to be converted back with convertFromAbjad).
+#
+# Usage: python tools/generate_roman_table.py [mapcodelib directory]
+
+from __future__ import print_function
+import os
+import re
+import sys
+
+ABJAD_ALPHABETS = ('ALPHABET_GREEK', 'ALPHABET_HEBREW', 'ALPHABET_ARABIC', 'ALPHABET_KOREAN')
+IS_ABJAD = 128
+
+
+def read_recognizer(filename):
+    with open(filename, 'r') as f:
+        source = f.read()
+
+    start = source.index('ALPHABET_OF[]')
+    alphabet_of = re.findall(r'(_?ALPHABET_[A-Z]+)', source[source.index('{', start):source.index('};', start)])
+
+    max_char = int(re.search(r'#define ROMAN_VERSION_MAX_CHAR (0x[0-9a-fA-F]+)', source).group(1), 16)
+    start = source.index('ROMAN_VERSION_OF[]')
+    roman_version_of = []
+    for m in re.finditer(r'/\* [0-9a-f]{4} \*/ (NULL|"((?:[^"\\]|\\.)*)")', source[start:source.index('};', start)]):
+        if m.group(1) == 'NULL':
+            roman_version_of.append(None)
+        else:
+            block = m.group(2).replace('\\0', '\0').replace('\\"', '"').replace('\\\\', '\\')
+            assert len(block) == 64
+            roman_version_of.append(block)
+    return alphabet_of, max_char, roman_version_of
+
+
+def generate(directory):
+    alphabet_of, max_char, roman_version_of = read_recognizer(os.path.join(directory, 'internal_alphabet_recognizer.h'))
+
+    table = []
+    for w in range(max_char + 1):
+        block = roman_version_of[w >> 6]
+        roman = ord(block[w & 63]) if block else ord('?')
+        assert roman < IS_ABJAD
+        if alphabet_of[w >> 6] in ABJAD_ALPHABETS:
+            roman |= IS_ABJAD
+        table.append(roman)
+
+    target = os.path.join(directory, 'internal_roman_table.h')
+    with open(target, 'w') as f:
+        f.write(HEADER)
+        f.write('// *** GENERATED FILE (tools/generate_roman_table.py), DO NOT CHANGE OR PRETTIFY ***\n\n')
+        f.write('#define ROMAN_TABLE_MAX_CHAR 0x%04x\n' % max_char)
+        f.write('#define ROMAN_TABLE_IS_ABJAD %d\n\n' % IS_ABJAD)
+        f.write('// romanised version of every utf16 character up to ROMAN_TABLE_MAX_CHAR (ROMAN_TABLE_IS_ABJAD set for abjad)\n')
+        f.write('static const unsigned char ROMAN_TABLE[ROMAN_TABLE_MAX_CHAR + 1] = {\n')
+        for i in range(0, len(table), 16):
+            f.write('    /* %04x */ %s,\n' % (i, ', '.join('%3d' % v for v in table[i:i + 16])))
+        f.write('};\n\n')
+        f.write(FOOTER)
+    print('Generated %s: %d characters.' % (target, len(table)))
+
+
+HEADER = '''/*
+ * Copyright (C) 2014-2019 Stichting Mapcode Foundation (http://www.mapcode.com)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __INTERNAL_ROMAN_TABLE_H__
+#define __INTERNAL_ROMAN_TABLE_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+'''
+
+FOOTER = '''#ifdef __cplusplus
+}
+#endif
+
+#endif // __INTERNAL_ROMAN_TABLE_H__
+'''
+
+
+if __name__ == "__main__":
+    generate(sys.argv[1] if len(sys.argv) > 1 else
+             os.path.join(os.path.dirname(os.path.abspath(__file__)), '..', 'mapcodelib'))
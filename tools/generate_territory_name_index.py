@@ -0,0 +1,396 @@
+#!/usr/bin/python
+# -*- coding: utf-8 -*-
+#
+# Copyright (C) 2014-2019 Stichting Mapcode Foundation (http://www.mapcode.com)
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#    http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+# Generates mapcodelib/internal_territory_names_packed.h and mapcodelib/internal_territory_name_index.h
+# from the mapcodelib/internal_territory_names_*.h files.
+#
+# The names of every locale are packed with byte pair encoding: each byte that does not occur in the
+# names of the locale is used as code for the most frequent pair of (codes for) bytes, until no bytes are
+# left. The library unpacks the names of a locale when they are first used. For every locale and
+# territory, the alternatives table holds the offset (in the unpacked names) and length of each of the
+# '|'-separated alternative names, and its alphabet: the alphabet of its first non-roman character.
+# The tables of a locale are only compiled in if its MAPCODE_SUPPORT_LANGUAGE_xx is defined.
+#
+# The index lists every full territory name (including the alternatives) of every locale, and every
+# ISO3166 code, folded to lowercase without diacritics, sorted by its utf8 bytes. Each entry records
+# the locales that use the name (or that it is an ISO code), and is only compiled in if one of them
+# is supported. The folding table used to build the index is written as well, so the library can fold
+# a name in exactly the same way before it binary-searches the index.
+#
+# Usage: python tools/generate_territory_name_index.py [mapcodelib directory]
+
+from __future__ import print_function
+import io
+import os
+import re
+import sys
+import unicodedata
+
+# code points 0..FOLD_LOW_END-1 and FOLD_HIGH_START..FOLD_HIGH_END-1 are folded (Latin, Greek,
+# Cyrillic, Armenian, Hebrew, Arabic); all other characters are kept as they are
+FOLD_LOW_END = 0x0700
+FOLD_HIGH_START = 0x1E00
+FOLD_HIGH_END = 0x2000
+FOLD_MAX_BYTES = 3
+
+MAX_TERRITORY_FULLNAME_UTF8_LEN = 111
+
+# a pair of codes that occurs less often is not worth a code of its own
+MIN_PAIR_COUNT = 3
+
+SPECIAL_FOLDS = {
+    0x03C2: u'σ',  # final sigma folds to sigma
+}
+
+
+def unichr_compat(code):
+    try:
+        return unichr(code)
+    except NameError:
+        return chr(code)
+
+
+def fold_char(code):
+    if not (code < FOLD_LOW_END or FOLD_HIGH_START <= code < FOLD_HIGH_END):
+        return unichr_compat(code)
+    if code in SPECIAL_FOLDS:
+        return SPECIAL_FOLDS[code]
+    c = unichr_compat(code)
+    folded = u''.join(d for d in unicodedata.normalize('NFKD', c) if not unicodedata.combining(d)).lower()
+    folded = u''.join(SPECIAL_FOLDS.get(ord(d), d) for d in folded)
+    if len(folded.encode('utf-8')) > FOLD_MAX_BYTES or any(ord(d) < 32 for d in folded) and code >= 32:
+        return c.lower() if len(c.lower().encode('utf-8')) <= FOLD_MAX_BYTES else c
+    return folded
+
+
+def fold(name):
+    # leading and trailing spaces and control characters are removed
+    folded = u''.join(fold_char(ord(c)) for c in name)
+    return folded.strip(u''.join(unichr_compat(code) for code in range(1, 33)))
+
+
+def read_source(filename):
+    with io.open(filename, 'r', encoding='utf-8') as f:
+        return f.read()
+
+
+def read_territories(directory):
+    source = read_source(os.path.join(directory, 'mapcode_territories.h'))
+    body = source[source.index('_TERRITORY_MIN ='):source.index('\n    _TERRITORY_MAX') + 1]
+    territories = re.findall(r'\n\s*(TERRITORY_\w+),', body)
+
+    source = read_source(os.path.join(directory, 'internal_iso3166_data.h'))
+    start = source.index('PARENT_LETTER[')
+    body = source[source.index('{', start) + 1:source.index('}', start)]
+    parent_letter = [int(v) for v in body.replace('\n', ' ').split(',') if v.strip()]
+    assert len(parent_letter) >= len(territories)
+    return territories, parent_letter[:len(territories)]
+
+
+def read_iso_codes(directory):
+    source = read_source(os.path.join(directory, 'internal_data.h'))
+    start = source.index('ISO3166_ALPHA[')
+    return re.findall(r'"([^"]+)"', source[source.index('{', start):source.index('};', start)])
+
+
+def read_locales(directory):
+    source = read_source(os.path.join(directory, 'mapcoder.c'))
+    start = source.index('LOCALE_REGISTRY[]')
+    return re.findall(r'\{"(\w+)",\s*&PACKED_TERRITORY_NAMES_(\w+)\}', source[start:source.index('};', start)])
+
+
+def read_alphabets(directory):
+    source = read_source(os.path.join(directory, 'mapcode_alphabets.h'))
+    body = source[source.index('enum Alphabet {'):source.index('_ALPHABET_MAX')]
+    alphabets = dict((name, value - 1) for value, name in enumerate(re.findall(r'(_?ALPHABET_[A-Z]+)', body)))
+
+    source = read_source(os.path.join(directory, 'internal_alphabet_recognizer.h'))
+    start = source.index('ALPHABET_OF[]')
+    alphabet_of = re.findall(r'(_?ALPHABET_[A-Z]+)', source[source.index('{', start):source.index('};', start)])
+    return alphabets, [alphabets[name] for name in alphabet_of]
+
+
+def recognize_alphabet(name, alphabets, alphabet_of):
+    # alphabet of the first non-roman character; _ALPHABET_MIN if it is not recognized
+    for c in name:
+        code = ord(c)
+        if code > 0xFFFF:
+            return alphabets['_ALPHABET_MIN']
+        if code >= 0x80 and alphabet_of[code >> 6] != alphabets['ALPHABET_ROMAN']:
+            return alphabet_of[code >> 6]
+    return alphabets['ALPHABET_ROMAN']
+
+
+def read_names(filename):
+    names = []
+    language = None
+    for line in read_source(filename).split('\n'):
+        m = re.match(r'\s*(?:/\*.*?\*/)?\s*"(.*)",?\s*$', line)
+        if m:
+            names.append(m.group(1))
+        m = re.match(r'#ifdef MAPCODE_SUPPORT_LANGUAGE_\w+\s*//\s*(.*?)\s*$', line)
+        if m:
+            language = m.group(1)
+    return names, language
+
+
+def pack(data):
+    # byte pair encoding; returns the packed bytes, the pair of every code (or the code itself for a
+    # byte) and the maximum nesting of the codes
+    data = list(data)
+    pairs = [(c, c) for c in range(256)]
+    depth = [1] * 256
+    free = sorted(set(range(1, 256)) - set(data), reverse=True)
+    while free:
+        counts = {}
+        for pair in zip(data, data[1:]):
+            counts[pair] = counts.get(pair, 0) + 1
+        if not counts:
+            break
+        pair = max(sorted(counts), key=lambda k: counts[k])
+        if counts[pair] < MIN_PAIR_COUNT:
+            break
+        code = free.pop()
+        pairs[code] = pair
+        depth[code] = max(depth[pair[0]], depth[pair[1]]) + 1
+        packed = []
+        i = 0
+        while i < len(data):
+            if i + 1 < len(data) and (data[i], data[i + 1]) == pair:
+                packed.append(code)
+                i += 2
+            else:
+                packed.append(data[i])
+                i += 1
+        data = packed
+    return data, pairs, max(depth[c] for c in data)
+
+
+def unpack(packed, pairs):
+    data = []
+    for c in packed:
+        stack = [c]
+        while stack:
+            c = stack.pop()
+            if pairs[c] == (c, c):
+                data.append(c)
+            else:
+                stack.extend((pairs[c][1], pairs[c][0]))
+    return bytearray(data)
+
+
+def c_bytes(text):
+    data = bytearray(text.encode('utf-8'))
+    if all(32 <= b < 127 for b in data):
+        return text.replace('\\', '\\\\').replace('"', '\\"')
+    return ''.join('\\x%02x' % b for b in data)
+
+
+def c_string(text):
+    return text.replace('\\', '\\\\').replace('"', '\\"')
+
+
+def generate(directory):
+    territories, parent_letter = read_territories(directory)
+    locales = read_locales(directory)
+    local_bit = len(locales)
+    assert local_bit + 1 < 32
+
+    sources = [(1 << i, suffix, 'MAPCODE_SUPPORT_LANGUAGE_%s' % suffix)
+               for i, (locale, suffix) in enumerate(locales)]
+    sources.append((1 << local_bit, 'LOCAL', None))
+
+    alphabets, alphabet_of = read_alphabets(directory)
+
+    index = {}
+    packed_names = []
+    for bit, suffix, support in sources:
+        names, language = read_names(os.path.join(directory, 'internal_territory_names_%s.h' % suffix.lower()))
+        assert len(names) == len(territories), suffix
+        data = bytearray()
+        alternatives_start = [0]
+        alternatives = []
+        for territory, piped in enumerate(names):
+            for name in piped.split('|'):
+                length = len(name.encode('utf-8'))
+                assert length <= MAX_TERRITORY_FULLNAME_UTF8_LEN
+                alternatives.append((len(data), length, recognize_alphabet(name, alphabets, alphabet_of)))
+                data += bytearray(name.encode('utf-8')) + bytearray(b'|')
+                folded = fold(name)
+                if folded:
+                    key = (folded, territory)
+                    index[key] = index.get(key, 0) | bit
+            data[-1] = 0
+            alternatives_start.append(len(alternatives))
+        assert len(data) < 65536 and len(alternatives) < 65536
+        packed, pairs, depth = pack(data)
+        assert unpack(packed, pairs) == data
+        packed_names.append((suffix, support, language, data, packed, pairs, depth, alternatives_start, alternatives))
+
+    iso_bit = len(sources)
+    iso_codes = read_iso_codes(directory)
+    assert len(iso_codes) == len(territories)
+    for territory, iso_code in enumerate(iso_codes):
+        key = (fold(iso_code), territory)
+        index[key] = index.get(key, 0) | (1 << iso_bit)
+
+    # duplicate names prefer countries over subdivisions, then the lowest territory number
+    entries = sorted(index.items(),
+                     key=lambda e: (bytearray(e[0][0].encode('utf-8')), parent_letter[e[0][1]] != 0, e[0][1]))
+    max_length = max(len(folded.encode('utf-8')) for (folded, territory), bits in entries)
+
+    fold_codes = list(range(FOLD_LOW_END)) + list(range(FOLD_HIGH_START, FOLD_HIGH_END))
+    for code in fold_codes:
+        assert fold(fold_char(code)) == fold(unichr_compat(code)), hex(code)
+
+    target = os.path.join(directory, 'internal_territory_names_packed.h')
+    with io.open(target, 'w', encoding='utf-8', newline='\n') as f:
+        f.write(HEADER % ('NAMES_PACKED', 'NAMES_PACKED'))
+        f.write(u'// *** GENERATED FILE (tools/generate_territory_name_index.py), DO NOT CHANGE OR PRETTIFY ***\n\n')
+        f.write(u'#define TERRITORY_NAMES_LOCAL %d // locale number of the local names; others are LOCALE_REGISTRY[i]\n'
+                % local_bit)
+        f.write(u'#define NR_TERRITORY_NAME_LOCALES %d\n' % len(sources))
+        f.write(u'#define MAX_TERRITORY_NAMES_PAIR_DEPTH %d\n\n'
+                % max(depth for suffix, support, language, data, packed, pairs, depth, s, a in packed_names))
+        f.write(u'typedef struct {\n')
+        f.write(u'    unsigned short offset;      // in the unpacked names of the locale\n')
+        f.write(u'    unsigned char length;       // in bytes\n')
+        f.write(u'    signed char alphabet;       // alphabet of the first non-roman character (or ALPHABET_ROMAN)\n')
+        f.write(u'} TerritoryNameAlternative;\n\n')
+        f.write(u'typedef struct {\n')
+        f.write(u'    char *names;                // unpacked on first use: the \'|\'-separated names of every territory,\n')
+        f.write(u'                                // each followed by a 0 (NULL if the language is not supported)\n')
+        f.write(u'    int namesSize;\n')
+        f.write(u'    const unsigned char *packed;\n')
+        f.write(u'    int packedSize;\n')
+        f.write(u'    const unsigned char (*pairs)[2]; // the pair of codes code c stands for, or {c, c} for a byte\n')
+        f.write(u'    const unsigned short *alternativesStart; // first alternative of every territory index (and the end)\n')
+        f.write(u'    const TerritoryNameAlternative *alternatives;\n')
+        f.write(u'} PackedTerritoryNames;\n\n')
+        for suffix, support, language, data, packed, pairs, depth, alternatives_start, alternatives in packed_names:
+            if support:
+                f.write(u'#ifdef %s%s\n\n' % (support, u' // %s' % language if language else u''))
+            f.write(u'// %d bytes, packed to %d\n' % (len(data), len(packed)))
+            write_array(f, u'static const unsigned char TERRITORY_NAMES_PACKED_%s[%d]' % (suffix, len(packed)),
+                        [u'%d' % c for c in packed], 24)
+            write_array(f, u'static const unsigned char TERRITORY_NAMES_PAIRS_%s[256][2]' % suffix,
+                        [u'{%d, %d}' % p for p in pairs], 12)
+            write_array(f, u'static const unsigned short TERRITORY_NAME_ALTERNATIVES_START_%s['
+                           u'_TERRITORY_MAX - _TERRITORY_MIN]' % suffix,
+                        [u'%d' % v for v in alternatives_start], 16)
+            write_array(f, u'static const TerritoryNameAlternative TERRITORY_NAME_ALTERNATIVES_%s[%d]'
+                        % (suffix, len(alternatives)), [u'{%d, %d, %d}' % a for a in alternatives], 8)
+            f.write(u'static char TERRITORY_NAMES_UNPACKED_%s[%d];\n\n' % (suffix, len(data)))
+            f.write(u'static const PackedTerritoryNames PACKED_TERRITORY_NAMES_%s = {\n' % suffix)
+            f.write(u'        TERRITORY_NAMES_UNPACKED_%s, %d, TERRITORY_NAMES_PACKED_%s, %d, TERRITORY_NAMES_PAIRS_%s,\n'
+                    % (suffix, len(data), suffix, len(packed), suffix))
+            f.write(u'        TERRITORY_NAME_ALTERNATIVES_START_%s, TERRITORY_NAME_ALTERNATIVES_%s};\n\n'
+                    % (suffix, suffix))
+            if support:
+                f.write(u'#else\n\n')
+                f.write(u'static const PackedTerritoryNames PACKED_TERRITORY_NAMES_%s = {NULL, 0, NULL, 0, NULL, NULL, NULL};\n\n'
+                        % suffix)
+                f.write(u'#endif // %s\n\n' % support)
+        f.write(FOOTER % 'NAMES_PACKED')
+
+    target_index = os.path.join(directory, 'internal_territory_name_index.h')
+    with io.open(target_index, 'w', encoding='utf-8', newline='\n') as f:
+        f.write(HEADER % ('NAME_INDEX', 'NAME_INDEX'))
+        f.write(u'// *** GENERATED FILE (tools/generate_territory_name_index.py), DO NOT CHANGE OR PRETTIFY ***\n\n')
+        f.write(u'#define NAME_FOLD_LOW_END 0x%04X\n' % FOLD_LOW_END)
+        f.write(u'#define NAME_FOLD_HIGH_START 0x%04X\n' % FOLD_HIGH_START)
+        f.write(u'#define NAME_FOLD_HIGH_END 0x%04X\n' % FOLD_HIGH_END)
+        f.write(u'#define NAME_FOLD_SIZE (NAME_FOLD_LOW_END + NAME_FOLD_HIGH_END - NAME_FOLD_HIGH_START)\n\n')
+        f.write(u'// utf8 of the lowercase character without diacritics, for characters 0..NAME_FOLD_LOW_END-1,\n')
+        f.write(u'// followed by NAME_FOLD_HIGH_START..NAME_FOLD_HIGH_END-1 (other characters fold to themselves)\n')
+        f.write(u'static const char NAME_FOLD[NAME_FOLD_SIZE][%d] = {\n' % (FOLD_MAX_BYTES + 1))
+        for i in range(0, len(fold_codes), 8):
+            f.write(u'        %s,\n' % u', '.join(u'"%s"' % c_bytes(fold_char(code)) for code in fold_codes[i:i + 8]))
+        f.write(u'};\n\n')
+        f.write(u'#define MAX_FOLDED_TERRITORY_NAME_LEN %d\n' % max_length)
+        f.write(u'#define TERRITORY_NAMES_ISO_CODE %d // bit number (in locales) of the ISO3166 codes\n\n' % iso_bit)
+        f.write(u'typedef struct {\n')
+        f.write(u'    const char *name;           // folded name\n')
+        f.write(u'    enum Territory territory;\n')
+        f.write(u'    unsigned int locales;       // bit l is set if locale number l uses the name\n')
+        f.write(u'} TerritoryNameRec;\n\n')
+        f.write(u'static const TerritoryNameRec TERRITORY_NAME_INDEX[] = {\n')
+        always = (1 << iso_bit) | (1 << local_bit) | [bit for bit, suffix, support in sources if suffix == 'EN'][0]
+        condition = None
+        for (folded, territory), bits in entries:
+            c = None if bits & always else u' || '.join(u'defined(%s)' % support for bit, suffix, support in sources
+                                                        if bits & bit)
+            if c != condition:
+                if condition:
+                    f.write(u'#endif\n')
+                if c:
+                    f.write(u'#if %s\n' % c)
+                condition = c
+            f.write(u'        {"%s", %s, 0x%08x},\n' % (c_string(folded), territories[territory], bits))
+        if condition:
+            f.write(u'#endif\n')
+        f.write(u'};\n\n')
+        f.write(u'#define NR_TERRITORY_NAME_RECS ((int) (sizeof(TERRITORY_NAME_INDEX) / sizeof(TERRITORY_NAME_INDEX[0])))\n\n')
+        f.write(FOOTER % 'NAME_INDEX')
+    print('Generated %s: %d bytes of names in %d locales, packed to %d bytes.' %
+          (target, sum(len(n[3]) for n in packed_names), len(sources), sum(len(n[4]) for n in packed_names)))
+    print('Generated %s: %d names.' % (target_index, len(entries)))
+
+
+def write_array(f, declaration, values, per_line):
+    f.write(u'%s = {\n' % declaration)
+    for i in range(0, len(values), per_line):
+        f.write(u'        %s,\n' % u', '.join(values[i:i + per_line]))
+    f.write(u'};\n\n')
+
+
+HEADER = u'''/*
+ * Copyright (C) 2014-2019 Stichting Mapcode Foundation (http://www.mapcode.com)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __INTERNAL_TERRITORY_%s_H__
+#define __INTERNAL_TERRITORY_%s_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+'''
+
+FOOTER = u'''#ifdef __cplusplus
+}
+#endif
+
+#endif // __INTERNAL_TERRITORY_%s_H__
+'''
+
+
+if __name__ == "__main__":
+    generate(sys.argv[1] if len(sys.argv) > 1 else
+             os.path.join(os.path.dirname(os.path.abspath(__file__)), '..', 'mapcodelib'))